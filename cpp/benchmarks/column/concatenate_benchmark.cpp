@@ -203,3 +203,57 @@ static void BM_concatenate_strings(benchmark::State& state)
 
 CONCAT_STRINGS_BENCHMARK_DEFINE(concat_string_columns_non_null, false)
 CONCAT_STRINGS_BENCHMARK_DEFINE(concat_string_columns_nullable, true)
+
+class ConcatenateManySmall : public cudf::benchmark {
+};
+
+// Many small tables of a nullable INT64 column and a nullable STRING column, as when
+// concatenating micro-batches
+static void BM_concatenate_many_small_tables(benchmark::State& state)
+{
+  using int_wrapper    = cudf::test::fixed_width_column_wrapper<int64_t>;
+  using string_wrapper = cudf::test::strings_column_wrapper;
+
+  auto const num_rows   = state.range(0);
+  auto const num_tables = state.range(1);
+
+  std::string const str(8, 'a');
+  auto iter       = thrust::make_counting_iterator(0);
+  auto str_iter   = thrust::make_constant_iterator(str.c_str());
+  auto valid_iter = thrust::make_transform_iterator(iter, [](auto i) { return i % 3 == 0; });
+
+  // Create owning columns
+  std::vector<int_wrapper> int_columns;
+  std::vector<string_wrapper> string_columns;
+  int_columns.reserve(num_tables);
+  string_columns.reserve(num_tables);
+  for (int i = 0; i < num_tables; ++i) {
+    int_columns.emplace_back(iter, iter + num_rows, valid_iter);
+    string_columns.emplace_back(str_iter, str_iter + num_rows, valid_iter);
+  }
+
+  // Generate table views
+  std::vector<cudf::table_view> table_views;
+  table_views.reserve(num_tables);
+  for (int i = 0; i < num_tables; ++i) {
+    table_views.push_back(cudf::table_view{{int_columns[i], string_columns[i]}});
+  }
+
+  CHECK_CUDA(0);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, 0);
+    auto result = cudf::concatenate(table_views);
+  }
+
+  state.SetBytesProcessed(state.iterations() * num_rows * num_tables *
+                          (sizeof(int64_t) + sizeof(int32_t) + str.size()));
+}
+
+BENCHMARK_DEFINE_F(ConcatenateManySmall, concat_many_small_tables)
+(::benchmark::State& state) { BM_concatenate_many_small_tables(state); }
+BENCHMARK_REGISTER_F(ConcatenateManySmall, concat_many_small_tables)
+  ->RangeMultiplier(8)
+  ->Ranges({{8, 512}, {64, 16384}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
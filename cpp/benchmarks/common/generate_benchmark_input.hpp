@@ -2,12 +2,18 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <map>
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
 /**
@@ -16,10 +22,11 @@
  *
  * Also includes utilies that generate random tables.
  *
- * The distribution of random data is meant to simulate real-world data. For example, numerical
- * values are generated using a normal distribution with a zero mean. Therefore, different column
- * types are filled using different distributions. The distributions are documented in the
- * functions where they are used.
+ * The distribution of random data is meant to simulate real-world data. The shape of the data is
+ * described by a `data_profile`: the distribution of the values of each type, the number of
+ * distinct values, the frequency of nulls, the average length of runs of equal values and the
+ * distribution of the string lengths. The default profile generates numeric values with a normal
+ * distribution, recent timestamps with a geometric distribution, 1% of nulls and no runs.
  *
  * Currently, the data generation is done on the CPU and the data is then copied to the device
  * memory.
@@ -30,7 +37,7 @@
  *
  * Produces the same random sequence on each run.
  */
-auto& deterministic_engine()
+inline auto& deterministic_engine()
 {
   static unsigned seed = 13377331;
   static std::mt19937 engine{seed};
@@ -63,73 +70,324 @@ constexpr int64_t nanoseconds()
 }
 
 /**
- * @brief Creates an random timestamp
+ * @brief Standard deviation for the Normal distribution used to generate numeric elements.
+ *
+ * Deviation depends on the type width; wider types -> larger value range.
+ */
+template <typename T>
+constexpr auto stddev()
+{
+  return 1l << (sizeof(T) * 4);
+}
+
+/**
+ * @brief Identifies the probability distribution of generated values.
+ */
+enum class distribution_id : int8_t {
+  UNIFORM,    ///< All values in the range are equally likely
+  NORMAL,     ///< Centered in the range, which spans six standard deviations
+  GEOMETRIC,  ///< Skewed towards the lower bound, with a mean at a quarter of the range
+  ZIPF,       ///< Zipfian with exponent one: the n-th value from the lower bound has a weight of 1/n
+};
+
+/**
+ * @brief Distribution of values in the range `[lower_bound, upper_bound]`.
+ *
+ * Values that a distribution generates outside of the range are clamped to the bounds.
+ */
+template <typename T>
+struct distribution_params {
+  distribution_id id;
+  T lower_bound;
+  T upper_bound;
+};
+
+/**
+ * @brief Returns the default distribution of the values of type `T`.
+ *
+ * Numeric values are normally distributed around zero, with a standard deviation depending on the
+ * type size, and unsigned types use the positive half of the same range.
+ */
+template <typename T, std::enable_if_t<std::is_integral<T>::value, int> = 0>
+distribution_params<int64_t> default_distribution()
+{
+  if (std::is_signed<T>::value) {
+    return {distribution_id::NORMAL, -3 * stddev<T>(), 3 * stddev<T>()};
+  }
+  return {distribution_id::NORMAL, 0, 6 * stddev<T>()};
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+distribution_params<double> default_distribution()
+{
+  return {distribution_id::NORMAL, -3. * stddev<T>(), 3. * stddev<T>()};
+}
+
+/**
+ * @brief Returns the default distribution of timestamps of type `T`, as the number of seconds
+ * before June 2020.
+ *
+ * Most timestamps are within a few years before 2020: the mean is two years.
+ */
+template <typename T, std::enable_if_t<is_timestamp<T>::value, int> = 0>
+distribution_params<int64_t> default_distribution()
+{
+  return {distribution_id::GEOMETRIC, 0, 8l * 365 * 24 * 60 * 60};
+}
+
+/**
+ * @brief Parameters of the generated data.
+ *
+ * The values of a column are drawn from the distribution of its type. When the cardinality is not
+ * zero, that many values are drawn first and the rows pick among them, so the column has at most
+ * `cardinality` distinct values. Each value is then repeated a geometrically distributed number of
+ * times with a mean of `avg_run_length`, and each row is null with probability `null_frequency`.
+ */
+class data_profile {
+  std::map<cudf::type_id, distribution_params<int64_t>> int_params;
+  std::map<cudf::type_id, distribution_params<double>> float_params;
+  distribution_params<int64_t> string_length_params{distribution_id::NORMAL, 0, 32};
+  double null_frequency       = 0.01;
+  cudf::size_type cardinality = 0;
+  cudf::size_type avg_run_len = 1;
+
+ public:
+  /**
+   * @brief Returns the distribution of the values of integral and timestamp type `T`; timestamps
+   * are distributed as a number of seconds before June 2020.
+   */
+  template <typename T,
+            std::enable_if_t<std::is_integral<T>::value or is_timestamp<T>::value, int> = 0>
+  distribution_params<int64_t> get_distribution() const
+  {
+    auto const it = int_params.find(cudf::type_to_id<T>());
+    return it == int_params.end() ? default_distribution<T>() : it->second;
+  }
+
+  /**
+   * @brief Returns the distribution of the values of floating point type `T`.
+   */
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+  distribution_params<double> get_distribution() const
+  {
+    auto const it = float_params.find(cudf::type_to_id<T>());
+    return it == float_params.end() ? default_distribution<T>() : it->second;
+  }
+
+  /**
+   * @brief Returns the distribution of the string lengths.
+   */
+  template <typename T, std::enable_if_t<std::is_same<T, std::string>::value, int> = 0>
+  distribution_params<int64_t> get_distribution() const
+  {
+    return string_length_params;
+  }
+
+  /**
+   * @brief Sets the distribution of the values of integral and timestamp type `T`.
+   */
+  template <typename T,
+            std::enable_if_t<std::is_integral<T>::value or is_timestamp<T>::value, int> = 0>
+  void set_distribution(distribution_id id, int64_t lower_bound, int64_t upper_bound)
+  {
+    CUDF_EXPECTS(lower_bound <= upper_bound, "Invalid distribution bounds");
+    int_params[cudf::type_to_id<T>()] = {id, lower_bound, upper_bound};
+  }
+
+  /**
+   * @brief Sets the distribution of the values of floating point type `T`.
+   */
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+  void set_distribution(distribution_id id, double lower_bound, double upper_bound)
+  {
+    CUDF_EXPECTS(lower_bound <= upper_bound, "Invalid distribution bounds");
+    float_params[cudf::type_to_id<T>()] = {id, lower_bound, upper_bound};
+  }
+
+  /**
+   * @brief Sets the distribution of the string lengths.
+   */
+  template <typename T, std::enable_if_t<std::is_same<T, std::string>::value, int> = 0>
+  void set_distribution(distribution_id id, int64_t lower_bound, int64_t upper_bound)
+  {
+    CUDF_EXPECTS(0 <= lower_bound && lower_bound <= upper_bound, "Invalid string length bounds");
+    string_length_params = {id, lower_bound, upper_bound};
+  }
+
+  double get_null_frequency() const { return null_frequency; }
+  cudf::size_type get_cardinality() const { return cardinality; }
+  cudf::size_type get_avg_run_length() const { return avg_run_len; }
+
+  /**
+   * @brief Sets the probability of each row to be null; zero generates columns without null mask.
+   */
+  void set_null_frequency(double f)
+  {
+    CUDF_EXPECTS(f >= 0 && f <= 1, "Null frequency must be a probability");
+    null_frequency = f;
+  }
+
+  /**
+   * @brief Sets the maximum number of distinct values in a column; zero means no limit.
+   */
+  void set_cardinality(cudf::size_type c)
+  {
+    CUDF_EXPECTS(c >= 0, "Cardinality cannot be negative");
+    cardinality = c;
+  }
+
+  /**
+   * @brief Sets the average number of consecutive rows with the same value.
+   */
+  void set_avg_run_length(cudf::size_type avg_run_length)
+  {
+    CUDF_EXPECTS(avg_run_length >= 1, "Average run length must be at least one");
+    avg_run_len = avg_run_length;
+  }
+};
+
+/**
+ * @brief Draws an integer from the distribution `params`.
+ */
+inline int64_t random_integer(distribution_params<int64_t> const& params)
+{
+  auto const lower = params.lower_bound;
+  auto const upper = params.upper_bound;
+  if (lower == upper) return lower;
+  // Range of the distribution, computed without overflow
+  auto const range = static_cast<uint64_t>(upper) - static_cast<uint64_t>(lower);
+  switch (params.id) {
+    case distribution_id::UNIFORM:
+      return std::uniform_int_distribution<int64_t>{lower, upper}(deterministic_engine());
+    case distribution_id::NORMAL: {
+      std::normal_distribution<> gaussian{lower / 2. + upper / 2., range / 6.};
+      auto const elem = std::round(gaussian(deterministic_engine()));
+      if (elem <= lower) return lower;
+      if (elem >= upper) return upper;
+      return static_cast<int64_t>(elem);
+    }
+    case distribution_id::GEOMETRIC: {
+      std::geometric_distribution<int64_t> geometric{1. / (1. + range / 4.)};
+      auto const offset = static_cast<uint64_t>(geometric(deterministic_engine()));
+      return offset >= range ? upper : static_cast<int64_t>(lower + offset);
+    }
+    case distribution_id::ZIPF: {
+      // Continuous approximation: the offset is log-uniform in [1, range + 1]
+      std::uniform_real_distribution<> exponent{0., std::log1p(static_cast<double>(range))};
+      auto const offset = static_cast<uint64_t>(std::expm1(exponent(deterministic_engine())));
+      return offset >= range ? upper : static_cast<int64_t>(lower + offset);
+    }
+    default: CUDF_FAIL("Unsupported distribution");
+  }
+}
+
+/**
+ * @brief Draws a floating point number from the distribution `params`.
+ */
+inline double random_floating_point(distribution_params<double> const& params)
+{
+  auto const lower = params.lower_bound;
+  auto const upper = params.upper_bound;
+  if (lower == upper) return lower;
+  double elem{};
+  switch (params.id) {
+    case distribution_id::UNIFORM:
+      elem = std::uniform_real_distribution<>{lower, upper}(deterministic_engine());
+      break;
+    case distribution_id::NORMAL:
+      elem = std::normal_distribution<>{lower / 2. + upper / 2., upper / 6. - lower / 6.}(
+        deterministic_engine());
+      break;
+    case distribution_id::GEOMETRIC:
+      elem = lower + std::exponential_distribution<>{4. / (upper - lower)}(deterministic_engine());
+      break;
+    case distribution_id::ZIPF:
+      elem = lower + std::expm1(std::uniform_real_distribution<>{0., std::log1p(upper - lower)}(
+                       deterministic_engine()));
+      break;
+    default: CUDF_FAIL("Unsupported distribution");
+  }
+  return std::max(std::min(elem, upper), lower);
+}
+
+/**
+ * @brief Returns the mean of the distribution `params`, ignoring the clamping to the bounds.
+ */
+inline double expected_value(distribution_params<int64_t> const& params)
+{
+  if (params.id == distribution_id::GEOMETRIC) {
+    return params.lower_bound + (params.upper_bound / 4. - params.lower_bound / 4.);
+  }
+  if (params.id == distribution_id::ZIPF) {
+    auto const range = params.upper_bound / 1. - params.lower_bound / 1.;
+    return range > 0 ? params.lower_bound + range / std::log1p(range) - 1 : params.lower_bound;
+  }
+  return params.lower_bound / 2. + params.upper_bound / 2.;
+}
+
+/**
+ * @brief Creates a random timestamp
  *
  * Generates 'recent' timestamps. All timstamps are earlier that June 2020. The period between the
- * timestamps and June 2020 has a geometric distribution. Most timestamps are within a few years
- * before 2020.
+ * timestamps and June 2020, in seconds, is drawn from the timestamp distribution of the profile.
  *
  * @return The random timestamp
  * @tparam T Timestamp type
  */
 template <typename T, std::enable_if_t<is_timestamp<T>::value, int> = 0>
-T random_element()
+T random_element(data_profile const& profile)
 {
   // Timestamp for June 2020
-  static constexpr int64_t current_ns    = 1591053936l * nanoseconds<cudf::timestamp_s>();
-  static constexpr auto timestamp_spread = 1. / (2 * 365 * 24 * 60 * 60);  // one in two years
+  static constexpr int64_t current_ns = 1591053936l * nanoseconds<cudf::timestamp_s>();
 
-  // Generate a number of seconds that is 50% likely to be shorter than two years
-  static std::geometric_distribution<int64_t> seconds_gen{timestamp_spread};
   // Generate a random value for the nanoseconds within a second
   static std::uniform_int_distribution<int64_t> nanoseconds_gen{0,
                                                                 nanoseconds<cudf::timestamp_s>()};
 
   // Subtract the seconds from the 2020 timestamp to generate a reccent timestamp
-  auto const timestamp_ns = current_ns -
-                            seconds_gen(deterministic_engine()) * nanoseconds<cudf::timestamp_s>() -
+  auto const seconds      = random_integer(profile.get_distribution<T>());
+  auto const timestamp_ns = current_ns - seconds * nanoseconds<cudf::timestamp_s>() -
                             nanoseconds_gen(deterministic_engine());
   // Return value in the type's precision
   return T(typename T::duration{timestamp_ns / nanoseconds<T>()});
 }
 
 /**
- * @brief Standard deviation for the Normal distribution used to generate numeric elements.
+ * @brief Creates a random integral value, drawn from the distribution of its type in the profile
  *
- * Deviation depends on the type width; wider types -> larger value range.
+ * @return The random number
+ * @tparam T Integral type
  */
-template <typename T>
-constexpr auto stddev()
+template <typename T,
+          std::enable_if_t<std::is_integral<T>::value and not std::is_same<T, bool>::value, int> =
+            0>
+T random_element(data_profile const& profile)
 {
-  return 1l << (sizeof(T) * 4);
+  auto const elem = random_integer(profile.get_distribution<T>());
+  // Clamp to the range of the type
+  if (elem <= static_cast<int64_t>(std::numeric_limits<T>::lowest())) {
+    return std::numeric_limits<T>::lowest();
+  }
+  if (std::numeric_limits<T>::digits < 63 and
+      elem >= static_cast<int64_t>(std::numeric_limits<T>::max())) {
+    return std::numeric_limits<T>::max();
+  }
+  return static_cast<T>(elem);
 }
 
 /**
- * @brief Creates an random numeric value with a normal distribution
- *
- * Zero is always used as the mean for teh distribution. Unsigned types are generated as the
- * absolute value of the normal distribution output.
- * Different standard deviations are used depending on the type size, in order to generate larger
- * range of values for when the types supports it.
+ * @brief Creates a random floating point value, drawn from the distribution of its type in the
+ * profile
  *
  * @return The random number
- * @tparam T Numeric type
+ * @tparam T Floating point type
  */
-template <typename T, std::enable_if_t<not is_timestamp<T>::value, int> = 0>
-T random_element()
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+T random_element(data_profile const& profile)
 {
-  static constexpr T lower_bound = std::numeric_limits<T>::lowest();
-  static constexpr T upper_bound = std::numeric_limits<T>::max();
-
-  // Use the type dependent standard deviation
-  static std::normal_distribution<> gaussian{0., stddev<T>()};
-
-  auto elem = gaussian(deterministic_engine());
-  // Use absolute value for unsigned types
-  if (lower_bound >= 0) elem = abs(elem);
-  elem = std::max(std::min(elem, (double)upper_bound), (double)lower_bound);
-
-  return T(elem);
+  auto const elem = random_floating_point(profile.get_distribution<T>());
+  return static_cast<T>(std::max(std::min(elem, static_cast<double>(std::numeric_limits<T>::max())),
+                                 static_cast<double>(std::numeric_limits<T>::lowest())));
 }
 
 /**
@@ -137,112 +395,187 @@ T random_element()
  *
  * @return The random boolean value
  */
-template <>
-bool random_element<bool>()
+template <typename T, std::enable_if_t<std::is_same<T, bool>::value, int> = 0>
+T random_element(data_profile const&)
 {
   static std::uniform_int_distribution<> uniform{0, 1};
   return uniform(deterministic_engine()) == 1;
 }
 
+/**
+ * @brief Creates a random string, with a length drawn from the string length distribution of the
+ * profile
+ *
+ * The characters follow a pattern, so there can be more unique strings in the column.
+ *
+ * @return The random string
+ */
+template <typename T, std::enable_if_t<std::is_same<T, std::string>::value, int> = 0>
+T random_element(data_profile const& profile)
+{
+  static size_t i = 0;
+  auto const length = random_integer(profile.get_distribution<std::string>());
+  std::string elem;
+  elem.reserve(length);
+  std::generate_n(std::back_inserter(elem), length, []() { return 'a' + (i++ % 26); });
+  return elem;
+}
+
+/**
+ * @brief Generates the values of `num_rows` rows with the cardinality and run length of the profile
+ *
+ * @param profile The parameters of the generated data
+ * @param num_rows Number of generated values
+ * @param sample Callable that draws a new random value
+ *
+ * @return The generated values
+ */
+template <typename T, typename Sampler>
+std::vector<T> generate_values(data_profile const& profile,
+                               cudf::size_type num_rows,
+                               Sampler sample)
+{
+  std::vector<T> dictionary;
+  std::generate_n(std::back_inserter(dictionary), profile.get_cardinality(), sample);
+  std::uniform_int_distribution<size_t> dictionary_index{
+    0, std::max<size_t>(dictionary.size(), 1) - 1};
+  // Each run has at least one row
+  std::geometric_distribution<cudf::size_type> extra_run_rows{1. / profile.get_avg_run_length()};
+
+  std::vector<T> values;
+  values.reserve(num_rows);
+  while (values.size() < static_cast<size_t>(num_rows)) {
+    auto const value = dictionary.empty() ? sample()
+                                          : dictionary[dictionary_index(deterministic_engine())];
+    auto const run_rows =
+      std::min<size_t>(1 + extra_run_rows(deterministic_engine()), num_rows - values.size());
+    values.insert(values.end(), run_rows, value);
+  }
+  return values;
+}
+
+/**
+ * @brief Generates the validity of `num_rows` rows, each null with the null frequency of the
+ * profile
+ */
+inline std::vector<bool> generate_validity(data_profile const& profile, cudf::size_type num_rows)
+{
+  std::bernoulli_distribution valid{1. - profile.get_null_frequency()};
+  std::vector<bool> validity;
+  validity.reserve(num_rows);
+  std::generate_n(
+    std::back_inserter(validity), num_rows, [&]() { return valid(deterministic_engine()); });
+  return validity;
+}
+
 /**
  * @brief Creates a column with random content of the given type
  *
  * The templated implementation is used for all fixed width types. String columns are generated
- * using the specialization implemented below.
+ * using the overload implemented below.
  *
- * @param[in] col_bytes Size of the generated column, in bytes
- * @param[in] include_validity Whether to include the null mask in the columns
+ * @param[in] profile The parameters of the generated data
+ * @param[in] num_rows Number of rows in the column
  *
  * @return Column filled with random data
  */
-template <typename T>
-std::unique_ptr<cudf::column> create_random_column(cudf::size_type col_bytes, bool include_validity)
+template <typename T, std::enable_if_t<not std::is_same<T, std::string>::value, int> = 0>
+std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
+                                                   cudf::size_type num_rows)
 {
-  const cudf::size_type num_rows = col_bytes / sizeof(T);
-
-  // Every 100th element is invalid
-  // TODO: should this also be random?
-  auto valids = cudf::test::make_counting_transform_iterator(
-    0, [](auto i) { return i % 100 == 0 ? false : true; });
-
-  cudf::test::fixed_width_column_wrapper<T> wrapped_col;
-  auto rand_elements =
-    cudf::test::make_counting_transform_iterator(0, [](auto row) { return random_element<T>(); });
-  if (include_validity) {
-    wrapped_col =
-      cudf::test::fixed_width_column_wrapper<T>(rand_elements, rand_elements + num_rows, valids);
-  } else {
-    wrapped_col =
-      cudf::test::fixed_width_column_wrapper<T>(rand_elements, rand_elements + num_rows);
+  auto const values =
+    generate_values<T>(profile, num_rows, [&]() { return random_element<T>(profile); });
+  if (profile.get_null_frequency() == 0) {
+    return cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end()).release();
   }
-  auto col = wrapped_col.release();
-  col->has_nulls();
-  return col;
+  auto const validity = generate_validity(profile, num_rows);
+  return cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end(), validity.begin())
+    .release();
 }
 
 /**
  * @brief Creates a string column with random content
  *
- * Uses a Poisson distribution around the mean string length. The average length of elements is 16
- * and currently there is no way to modify this via parameters.
- *
- * Due to random generation of the length of the columns elements, the resulting column will have a
- * slightly different size from @ref col_bytes.
- *
- * @param[in] col_bytes Size of the generated column, in bytes
- * @param[in] include_validity Whether to include the null mask in the columns
+ * @param[in] profile The parameters of the generated data
+ * @param[in] num_rows Number of rows in the column
  *
  * @return Column filled with random data
  */
-template <>
-std::unique_ptr<cudf::column> create_random_column<std::string>(cudf::size_type col_bytes,
-                                                                bool include_validity)
+template <typename T, std::enable_if_t<std::is_same<T, std::string>::value, int> = 0>
+std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
+                                                   cudf::size_type num_rows)
 {
-  // TODO: have some elements be null?
-
-  static constexpr int avg_string_len = 16;
-  const cudf::size_type num_rows      = col_bytes / avg_string_len;
-
-  std::poisson_distribution<> dist(avg_string_len);
-
-  std::vector<int32_t> offsets{0};
-  offsets.reserve(num_rows + 1);
-  for (int i = 1; i < num_rows; ++i) {
-    offsets.push_back(offsets.back() + dist(deterministic_engine()));
+  auto const values =
+    generate_values<T>(profile, num_rows, [&]() { return random_element<T>(profile); });
+  if (profile.get_null_frequency() == 0) {
+    return cudf::test::strings_column_wrapper(values.begin(), values.end()).release();
   }
-  auto const char_cnt = offsets.back() + 1;
-  std::vector<char> chars;
-  chars.reserve(char_cnt);
-  // Use a pattern so there can be more unique strings in the column
-  std::generate_n(std::back_inserter(chars), char_cnt, []() {
-    static size_t i = 0;
-    return 'a' + (i++ % 26);
-  });
+  auto const validity = generate_validity(profile, num_rows);
+  return cudf::test::strings_column_wrapper(values.begin(), values.end(), validity.begin())
+    .release();
+}
 
-  return cudf::make_strings_column(chars, offsets);
+/**
+ * @brief Returns the average size of an element of type `T` in bytes.
+ *
+ * The size of a string is the mean of the string length distribution of the profile.
+ */
+template <typename T>
+double avg_element_bytes(data_profile const& profile)
+{
+  return sizeof(T);
+}
+
+template <>
+inline double avg_element_bytes<std::string>(data_profile const& profile)
+{
+  return std::max(expected_value(profile.get_distribution<std::string>()), 1.);
 }
 
 /**
  * @brief Creates a table with random content of the given type
  *
+ * Due to random generation of the length of strings, the columns of a strings table have a slightly
+ * different size from @ref col_bytes.
+ *
  * @param[in] num_columns Number of columns in the table
  * @param[in] col_bytes Size of each column, in bytes
- * @param[in] include_validity Whether to include the null mask in the columns
+ * @param[in] profile The parameters of the generated data
  *
  * @return Table filled with random data
  */
 template <typename T>
 std::unique_ptr<cudf::table> create_random_table(cudf::size_type num_columns,
                                                  cudf::size_type col_bytes,
-                                                 bool include_validity)
+                                                 data_profile const& profile)
 {
+  cudf::size_type const num_rows = col_bytes / avg_element_bytes<T>(profile);
   return std::make_unique<cudf::table>([&]() {
     std::vector<std::unique_ptr<cudf::column>> columns;
     std::generate_n(std::back_inserter(columns), num_columns, [&]() {
-      return create_random_column<T>(col_bytes, include_validity);
+      return create_random_column<T>(profile, num_rows);
     });
     return columns;
   }());
 }
 
+/**
+ * @brief Creates a table with random content of the given type, using the default profile
+ *
+ * @param[in] num_columns Number of columns in the table
+ * @param[in] col_bytes Size of each column, in bytes
+ * @param[in] include_validity Whether to include the null mask in the columns
+ *
+ * @return Table filled with random data
+ */
+template <typename T>
+std::unique_ptr<cudf::table> create_random_table(cudf::size_type num_columns,
+                                                 cudf::size_type col_bytes,
+                                                 bool include_validity)
+{
+  data_profile profile;
+  if (not include_validity) profile.set_null_frequency(0);
+  return create_random_table<T>(num_columns, col_bytes, profile);
+}
+
 // TODO: create random mixed table
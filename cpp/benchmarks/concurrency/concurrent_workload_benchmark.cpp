@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+// Server-style workload: each of N host threads issues a mix of queries on its own stream, the
+// way concurrent queries share a GPU. The aggregate throughput and the latency percentiles of
+// the queries show how the library scales with the number of concurrent queries, including the
+// serialization on the default stream and the contention in the memory resource.
+
+namespace cudf_io = cudf::io;
+
+namespace {
+constexpr cudf::size_type num_rows       = 1 << 20;
+constexpr int queries_per_thread         = 16;
+constexpr cudf::size_type num_key_values = num_rows / 4;
+
+/**
+ * @brief Inputs of the queries, shared read-only by all the threads
+ */
+struct workload_inputs {
+  std::vector<char> parquet_file;
+  std::unique_ptr<cudf::table> build;
+  std::unique_ptr<cudf::table> probe;
+  std::unique_ptr<cudf::table> groupby_keys;
+  std::unique_ptr<cudf::column> groupby_values;
+  std::unique_ptr<cudf::table> unsorted;
+};
+
+std::unique_ptr<cudf::table> key_value_table(cudf::size_type rows)
+{
+  data_profile profile;
+  profile.set_null_frequency(0);
+  profile.set_distribution<int32_t>(distribution_id::UNIFORM, 0, num_key_values);
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(create_random_column<int32_t>(profile, rows));
+  columns.push_back(create_random_column<int64_t>(profile, rows));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+workload_inputs make_inputs()
+{
+  workload_inputs inputs;
+  auto const file_table = create_random_table<int64_t>(8, num_rows * sizeof(int64_t), true);
+  cudf_io::write_parquet_args args{cudf_io::sink_info(&inputs.parquet_file), file_table->view()};
+  cudf_io::write_parquet(args);
+
+  inputs.build          = key_value_table(num_rows / 4);
+  inputs.probe          = key_value_table(num_rows);
+  inputs.groupby_keys   = key_value_table(num_rows);
+  inputs.groupby_values = create_random_column<double>(data_profile{}, num_rows);
+  inputs.unsorted       = key_value_table(num_rows);
+  return inputs;
+}
+
+enum class query_kind { READ_PARQUET, HASH_JOIN, GROUPBY, SORT, NUM_KINDS };
+
+/**
+ * @brief Runs one query of `kind` on `stream` and waits for its completion
+ */
+void run_query(workload_inputs const& inputs, query_kind kind, cudaStream_t stream)
+{
+  auto const mr = rmm::mr::get_default_resource();
+  switch (kind) {
+    case query_kind::READ_PARQUET: {
+      cudf_io::read_parquet_args args{
+        cudf_io::source_info(inputs.parquet_file.data(), inputs.parquet_file.size())};
+      cudf_io::read_parquet(args, mr, stream);
+      break;
+    }
+    case query_kind::HASH_JOIN: {
+      cudf::hash_join join(
+        inputs.build->view(), {0}, cudf::hash_join::output_size_policy::ESTIMATE, stream);
+      join.inner_join(inputs.probe->view(),
+                      {0},
+                      {},
+                      cudf::hash_join::common_columns_output_side::PROBE,
+                      cudf::null_equality::EQUAL,
+                      mr,
+                      stream);
+      break;
+    }
+    case query_kind::GROUPBY: {
+      cudf::groupby::groupby gb_obj(inputs.groupby_keys->view());
+      std::vector<cudf::groupby::aggregation_request> requests(1);
+      requests[0].values = inputs.groupby_values->view();
+      requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+      requests[0].aggregations.push_back(cudf::make_max_aggregation());
+      gb_obj.aggregate(requests, mr, stream);
+      break;
+    }
+    case query_kind::SORT: {
+      cudf::sorted_order(inputs.unsorted->view(), {}, {}, mr, stream);
+      break;
+    }
+    default: CUDF_FAIL("Unsupported query kind");
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+}
+
+/**
+ * @brief Runs `queries_per_thread` queries of the mix on a new stream, starting the mix at
+ * `first_kind`, and returns the latency of each query in milliseconds
+ */
+std::vector<double> run_client(workload_inputs const& inputs, int first_kind)
+{
+  cudaStream_t stream;
+  CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+  std::vector<double> latencies;
+  for (int q = 0; q < queries_per_thread; ++q) {
+    auto const kind =
+      static_cast<query_kind>((first_kind + q) % static_cast<int>(query_kind::NUM_KINDS));
+    auto const start = std::chrono::steady_clock::now();
+    run_query(inputs, kind, stream);
+    latencies.push_back(
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+        .count());
+  }
+  CUDA_TRY(cudaStreamDestroy(stream));
+  return latencies;
+}
+
+/**
+ * @brief Returns the `p`-th percentile of the sorted `values`
+ */
+double percentile(std::vector<double> const& values, double p)
+{
+  auto const index = static_cast<size_t>(p / 100. * (values.size() - 1));
+  return values[index];
+}
+
+}  // namespace
+
+class Concurrency : public cudf::benchmark {
+};
+
+void BM_concurrent_queries(benchmark::State& state)
+{
+  int const num_threads = state.range(0);
+  auto const inputs     = make_inputs();
+
+  std::vector<double> latencies;
+  for (auto _ : state) {
+    auto const start = std::chrono::steady_clock::now();
+
+    std::vector<std::future<std::vector<double>>> clients;
+    for (int t = 0; t < num_threads; ++t) {
+      clients.push_back(std::async(std::launch::async, run_client, std::cref(inputs), t));
+    }
+    // get() rethrows the exceptions of the clients
+    for (auto& client : clients) {
+      auto const client_latencies = client.get();
+      latencies.insert(latencies.end(), client_latencies.begin(), client_latencies.end());
+    }
+
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+    state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  state.counters["queries_per_second"] = benchmark::Counter(
+    static_cast<double>(num_threads) * queries_per_thread * state.iterations(),
+    benchmark::Counter::kIsRate);
+  state.counters["p50_latency_ms"] = percentile(latencies, 50);
+  state.counters["p95_latency_ms"] = percentile(latencies, 95);
+  state.counters["p99_latency_ms"] = percentile(latencies, 99);
+}
+
+BENCHMARK_DEFINE_F(Concurrency, QueryMix)(::benchmark::State& state)
+{
+  BM_concurrent_queries(state);
+}
+
+BENCHMARK_REGISTER_F(Concurrency, QueryMix)
+  ->Unit(benchmark::kMillisecond)
+  ->RangeMultiplier(2)
+  ->Range(1, 32)
+  ->UseManualTime();
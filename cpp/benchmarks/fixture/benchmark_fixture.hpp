@@ -15,6 +15,7 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <fixture/memory_tracking_resource.hpp>
 #include <rmm/mr/device/cuda_memory_resource.hpp>
 #include <rmm/mr/device/owning_wrapper.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -44,6 +45,15 @@ inline auto make_pool()
  * and finalize it, respectively. These methods are called automatically by
  * Google Benchmark
  *
+ * The pool is wrapped in a `memory_tracking_resource`, and TearDown reports the
+ * device memory statistics of the benchmark as counters:
+ * - `peak_memory_bytes`: the high-water mark of the allocated device memory
+ * - `allocations`: the number of allocations per iteration
+ * - `allocated_bytes`: the size of the allocations per iteration
+ * The statistics include the allocations made by the benchmark outside of its
+ * timed loop, e.g. for its input, unless it calls `tracker->reset()` before the
+ * loop.
+ *
  * Example:
  *
  * template <class T>
@@ -67,14 +77,16 @@ class benchmark : public ::benchmark::Fixture {
  public:
   virtual void SetUp(const ::benchmark::State& state)
   {
-    mr = make_pool();
-    rmm::mr::set_current_device_resource(mr.get());  // set default resource to pool
+    mr      = make_pool();
+    tracker = std::make_shared<memory_tracking_resource>(mr.get());
+    rmm::mr::set_current_device_resource(tracker.get());  // set default resource to pool
   }
 
   virtual void TearDown(const ::benchmark::State& state)
   {
     // reset default resource to the initial resource
     rmm::mr::set_current_device_resource(nullptr);
+    tracker.reset();
     mr.reset();
   }
 
@@ -82,10 +94,23 @@ class benchmark : public ::benchmark::Fixture {
   virtual void SetUp(::benchmark::State& st) { SetUp(const_cast<const ::benchmark::State&>(st)); }
   virtual void TearDown(::benchmark::State& st)
   {
+    report_memory_statistics(st);
     TearDown(const_cast<const ::benchmark::State&>(st));
   }
 
   std::shared_ptr<rmm::mr::device_memory_resource> mr;
+  std::shared_ptr<memory_tracking_resource> tracker;
+
+ private:
+  void report_memory_statistics(::benchmark::State& st) const
+  {
+    if (tracker == nullptr) return;
+    st.counters["peak_memory_bytes"] = ::benchmark::Counter(tracker->peak_bytes());
+    st.counters["allocations"] =
+      ::benchmark::Counter(tracker->allocation_count(), ::benchmark::Counter::kAvgIterations);
+    st.counters["allocated_bytes"] =
+      ::benchmark::Counter(tracker->allocated_bytes(), ::benchmark::Counter::kAvgIterations);
+  }
 };
 
 };  // namespace cudf
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+namespace cudf {
+
+/**
+ * @brief Device memory resource adaptor counting the allocations made from its upstream resource
+ *
+ * Tracks the bytes currently allocated, their high-water mark, and the number and total size of
+ * all allocations. `cudf::benchmark` wraps its pool resource in this adaptor and reports the
+ * statistics as counters of every benchmark.
+ */
+class memory_tracking_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit memory_tracking_resource(rmm::mr::device_memory_resource* upstream)
+    : upstream_(upstream)
+  {
+  }
+
+  rmm::mr::device_memory_resource* get_upstream() const noexcept { return upstream_; }
+
+  bool supports_streams() const noexcept override { return upstream_->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return upstream_->supports_get_mem_info();
+  }
+
+  /**
+   * @brief Returns the number of bytes currently allocated
+   */
+  std::size_t current_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return current_bytes_;
+  }
+
+  /**
+   * @brief Returns the largest number of bytes allocated at once since the last reset
+   */
+  std::size_t peak_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return peak_bytes_;
+  }
+
+  /**
+   * @brief Returns the number of allocations since the last reset
+   */
+  std::size_t allocation_count() const
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return allocation_count_;
+  }
+
+  /**
+   * @brief Returns the total size of the allocations since the last reset, in bytes
+   */
+  std::size_t allocated_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return allocated_bytes_;
+  }
+
+  /**
+   * @brief Restarts the tracking, the peak from the currently allocated bytes and the allocation
+   * statistics from zero
+   */
+  void reset()
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    peak_bytes_       = current_bytes_;
+    allocation_count_ = 0;
+    allocated_bytes_  = 0;
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override
+  {
+    auto p = upstream_->allocate(bytes, stream);
+    std::lock_guard<std::mutex> lock(mtx_);
+    current_bytes_ += bytes;
+    peak_bytes_ = std::max(peak_bytes_, current_bytes_);
+    allocation_count_ += 1;
+    allocated_bytes_ += bytes;
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override
+  {
+    upstream_->deallocate(p, bytes, stream);
+    std::lock_guard<std::mutex> lock(mtx_);
+    current_bytes_ -= bytes;
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return upstream_->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* upstream_;
+  mutable std::mutex mtx_;
+  std::size_t current_bytes_{0};
+  std::size_t peak_bytes_{0};
+  std::size_t allocation_count_{0};
+  std::size_t allocated_bytes_{0};
+};
+
+}  // namespace cudf
@@ -19,41 +19,37 @@
 #include <cudf/groupby.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
 #include <fixture/benchmark_fixture.hpp>
 #include <synchronization/synchronization.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
 #include <memory>
-#include <random>
 
 class Groupby : public cudf::benchmark {
 };
 
-// TODO: put it in a struct so `uniform` can be remade with different min, max
-template <typename T>
-T random_int(T min, T max)
+/**
+ * @brief Returns a profile of non-null values in [0, 100], with the given distribution
+ */
+inline data_profile group_profile(distribution_id dist = distribution_id::UNIFORM)
 {
-  static unsigned seed = 13377331;
-  static std::mt19937 engine{seed};
-  static std::uniform_int_distribution<T> uniform{min, max};
-
-  return uniform(engine);
+  data_profile profile;
+  profile.set_null_frequency(0);
+  profile.set_distribution<int64_t>(dist, 0, 100);
+  return profile;
 }
 
 void BM_pre_sorted_nth(benchmark::State& state)
 {
-  using wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
-
   // const cudf::size_type num_columns{(cudf::size_type)state.range(0)};
   const cudf::size_type column_size{(cudf::size_type)state.range(0)};
 
-  auto data_it = cudf::test::make_counting_transform_iterator(
-    0, [=](cudf::size_type row) { return random_int(0, 100); });
-
-  wrapper keys(data_it, data_it + column_size);
-  wrapper vals(data_it, data_it + column_size);
+  auto const keys = create_random_column<int64_t>(group_profile(), column_size);
+  auto const vals = create_random_column<int64_t>(group_profile(), column_size);
 
-  auto keys_table  = cudf::table_view({keys});
+  auto keys_table  = cudf::table_view({*keys});
   auto sort_order  = cudf::sorted_order(keys_table);
   auto sorted_keys = cudf::gather(keys_table, *sort_order);
   // No need to sort values using sort_order because they were generated randomly
@@ -62,7 +58,7 @@ void BM_pre_sorted_nth(benchmark::State& state)
 
   std::vector<cudf::groupby::aggregation_request> requests;
   requests.emplace_back(cudf::groupby::aggregation_request());
-  requests[0].values = vals;
+  requests[0].values = *vals;
   requests[0].aggregations.push_back(cudf::make_nth_element_aggregation(-1));
 
   for (auto _ : state) {
@@ -18,46 +18,48 @@
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
 #include <cudf/table/table.hpp>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
 #include <fixture/benchmark_fixture.hpp>
 #include <synchronization/synchronization.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <hash/helper_functions.cuh>
+
+#include <cmath>
 #include <memory>
-#include <random>
+#include <string>
+#include <vector>
 
 class Groupby : public cudf::benchmark {
 };
 
-// TODO: put it in a struct so `uniform` can be remade with different min, max
-template <typename T>
-T random_int(T min, T max)
+/**
+ * @brief Returns a profile of non-null values in [0, 100], with the given distribution
+ */
+inline data_profile group_profile(distribution_id dist = distribution_id::UNIFORM)
 {
-  static unsigned seed = 13377331;
-  static std::mt19937 engine{seed};
-  static std::uniform_int_distribution<T> uniform{min, max};
-
-  return uniform(engine);
+  data_profile profile;
+  profile.set_null_frequency(0);
+  profile.set_distribution<int64_t>(dist, 0, 100);
+  return profile;
 }
 
 void BM_basic_sum(benchmark::State& state)
 {
-  using wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
-
   // const cudf::size_type num_columns{(cudf::size_type)state.range(0)};
   const cudf::size_type column_size{(cudf::size_type)state.range(0)};
 
-  auto data_it = cudf::test::make_counting_transform_iterator(
-    0, [=](cudf::size_type row) { return random_int(0, 100); });
-
-  wrapper keys(data_it, data_it + column_size);
-  wrapper vals(data_it, data_it + column_size);
+  auto const keys = create_random_column<int64_t>(group_profile(), column_size);
+  auto const vals = create_random_column<int64_t>(group_profile(), column_size);
 
-  cudf::groupby::groupby gb_obj(cudf::table_view({keys}));
+  cudf::groupby::groupby gb_obj(cudf::table_view({*keys}));
 
   std::vector<cudf::groupby::aggregation_request> requests;
   requests.emplace_back(cudf::groupby::aggregation_request());
-  requests[0].values = vals;
+  requests[0].values = *vals;
   requests[0].aggregations.push_back(cudf::make_sum_aggregation());
 
   for (auto _ : state) {
@@ -75,19 +77,45 @@ BENCHMARK_REGISTER_F(Groupby, Basic)
   ->Arg(10000)
   ->Arg(10000000);
 
-void BM_pre_sorted_sum(benchmark::State& state)
+void BM_skewed_sum(benchmark::State& state)
 {
-  using wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
-
   const cudf::size_type column_size{(cudf::size_type)state.range(0)};
 
-  auto data_it = cudf::test::make_counting_transform_iterator(
-    0, [=](cudf::size_type row) { return random_int(0, 100); });
+  // Most rows fall into the few groups with the smallest keys
+  auto const keys = create_random_column<int64_t>(group_profile(distribution_id::GEOMETRIC),
+                                                  column_size);
+  auto const vals = create_random_column<int64_t>(group_profile(), column_size);
+
+  cudf::groupby::groupby gb_obj(cudf::table_view({*keys}));
+
+  std::vector<cudf::groupby::aggregation_request> requests;
+  requests.emplace_back(cudf::groupby::aggregation_request());
+  requests[0].values = *vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+
+    auto result = gb_obj.aggregate(requests);
+  }
+}
+
+BENCHMARK_DEFINE_F(Groupby, Skewed)(::benchmark::State& state) { BM_skewed_sum(state); }
+
+BENCHMARK_REGISTER_F(Groupby, Skewed)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(10000)
+  ->Arg(10000000);
+
+void BM_pre_sorted_sum(benchmark::State& state)
+{
+  const cudf::size_type column_size{(cudf::size_type)state.range(0)};
 
-  wrapper keys(data_it, data_it + column_size);
-  wrapper vals(data_it, data_it + column_size);
+  auto const keys = create_random_column<int64_t>(group_profile(), column_size);
+  auto const vals = create_random_column<int64_t>(group_profile(), column_size);
 
-  auto keys_table  = cudf::table_view({keys});
+  auto keys_table  = cudf::table_view({*keys});
   auto sort_order  = cudf::sorted_order(keys_table);
   auto sorted_keys = cudf::gather(keys_table, *sort_order);
   // No need to sort values using sort_order because they were generated randomly
@@ -96,7 +124,7 @@ void BM_pre_sorted_sum(benchmark::State& state)
 
   std::vector<cudf::groupby::aggregation_request> requests;
   requests.emplace_back(cudf::groupby::aggregation_request());
-  requests[0].values = vals;
+  requests[0].values = *vals;
   requests[0].aggregations.push_back(cudf::make_sum_aggregation());
 
   for (auto _ : state) {
@@ -112,3 +140,101 @@ BENCHMARK_REGISTER_F(Groupby, PreSorted)
   ->UseManualTime()
   ->Unit(benchmark::kMillisecond)
   ->Arg(10000000);
+
+/**
+ * @brief Creates a key column of `num_rows` values drawn from `profile`
+ *
+ * String keys are the decimal representations of int64_t keys.
+ */
+template <typename key_type>
+std::unique_ptr<cudf::column> create_key_column(data_profile const& profile,
+                                                cudf::size_type num_rows)
+{
+  return create_random_column<key_type>(profile, num_rows);
+}
+
+template <>
+std::unique_ptr<cudf::column> create_key_column<std::string>(data_profile const& profile,
+                                                             cudf::size_type num_rows)
+{
+  return cudf::strings::from_integers(create_random_column<int64_t>(profile, num_rows)->view());
+}
+
+enum key_skew { UNIFORM_KEYS, ZIPF_KEYS };
+
+template <typename key_type>
+void BM_sum_sweep(benchmark::State& state)
+{
+  const cudf::size_type column_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type cardinality{(cudf::size_type)state.range(1)};
+  const cudf::size_type num_key_columns{(cudf::size_type)state.range(2)};
+  const double null_frequency = state.range(3) / 100.;
+  const auto skew             = static_cast<key_skew>(state.range(4));
+
+  // Each key column spans a range such that the combined keys have up to `cardinality` values
+  auto const column_max_val =
+    static_cast<int64_t>(std::ceil(std::pow(cardinality, 1. / num_key_columns))) - 1;
+  auto const dist = skew == ZIPF_KEYS ? distribution_id::ZIPF : distribution_id::UNIFORM;
+  data_profile profile;
+  profile.set_null_frequency(null_frequency);
+  profile.set_distribution<int64_t>(dist, 0, column_max_val);
+
+  std::vector<std::unique_ptr<cudf::column>> key_columns;
+  for (cudf::size_type i = 0; i < num_key_columns; ++i) {
+    key_columns.push_back(create_key_column<key_type>(profile, column_size));
+  }
+  cudf::table keys(std::move(key_columns));
+  auto const vals = create_random_column<int64_t>(group_profile(), column_size);
+
+  cudf::groupby::groupby gb_obj(keys.view());
+
+  std::vector<cudf::groupby::aggregation_request> requests;
+  requests.emplace_back(cudf::groupby::aggregation_request());
+  requests[0].values = *vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+
+  cudf::size_type num_groups = 0;
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+
+    auto result = gb_obj.aggregate(requests);
+    num_groups  = result.first->num_rows();
+  }
+
+  state.SetItemsProcessed(state.iterations() * column_size);
+  // The hash map is sized for every key row but only holds the distinct keys
+  state.counters["num_groups"] = num_groups;
+  state.counters["hash_table_occupancy"] =
+    static_cast<double>(num_groups) / compute_hash_table_size(column_size);
+}
+
+/**
+ * @brief Registers the arguments {rows, cardinality, key columns, null percentage, skew} of the
+ * groupby sweeps
+ */
+void sum_sweep_args(benchmark::internal::Benchmark* b)
+{
+  constexpr cudf::size_type column_size{10'000'000};
+  for (int cardinality : {100, 10'000, 1'000'000, 10'000'000}) {
+    for (int skew : {UNIFORM_KEYS, ZIPF_KEYS}) { b->Args({column_size, cardinality, 1, 0, skew}); }
+  }
+  for (int num_key_columns : {2, 4}) {
+    b->Args({column_size, 10'000, num_key_columns, 0, UNIFORM_KEYS});
+    b->Args({column_size, 1'000'000, num_key_columns, 0, UNIFORM_KEYS});
+  }
+  b->Args({column_size, 10'000, 1, 10, UNIFORM_KEYS});
+  b->Args({column_size, 1'000'000, 2, 10, UNIFORM_KEYS});
+}
+
+#define SUM_SWEEP_BENCHMARK_DEFINE(name, key_type)              \
+  BENCHMARK_DEFINE_F(Groupby, name)(::benchmark::State & state) \
+  {                                                             \
+    BM_sum_sweep<key_type>(state);                              \
+  }                                                             \
+  BENCHMARK_REGISTER_F(Groupby, name)                           \
+    ->UseManualTime()                                           \
+    ->Unit(benchmark::kMillisecond)                             \
+    ->Apply(sum_sweep_args);
+
+SUM_SWEEP_BENCHMARK_DEFINE(SweepInt64Keys, int64_t);
+SUM_SWEEP_BENCHMARK_DEFINE(SweepStringKeys, std::string);
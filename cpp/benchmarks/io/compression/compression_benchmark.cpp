@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::io;
+
+enum class codec { SNAPPY, DEFLATE, ZSTD };
+
+// Compressibility of the generated data, from random bytes to long runs of few symbols
+enum compressibility { LOW, MEDIUM, HIGH };
+
+constexpr int64_t max_batch_bytes = 512 << 20;  // 512 MB
+
+/**
+ * @brief Generates `size` bytes as runs of symbols, where a smaller alphabet and longer runs make
+ * the data more compressible
+ */
+std::vector<uint8_t> generate_data(size_t size, compressibility level)
+{
+  int const alphabet_size = (level == LOW) ? 256 : (level == MEDIUM) ? 16 : 4;
+  int const mean_run      = (level == LOW) ? 1 : (level == MEDIUM) ? 4 : 32;
+  std::uniform_int_distribution<int> symbol_dist(0, alphabet_size - 1);
+  // One plus a geometric distribution, so that runs have the mean length
+  std::geometric_distribution<size_t> extra_run_dist(1. / std::max(mean_run, 2));
+
+  std::vector<uint8_t> data;
+  data.reserve(size);
+  while (data.size() < size) {
+    auto const symbol = static_cast<uint8_t>(symbol_dist(deterministic_engine()));
+    auto const extra  = (mean_run > 1) ? extra_run_dist(deterministic_engine()) : 0;
+    auto const run    = std::min(1 + extra, size - data.size());
+    data.insert(data.end(), run, symbol);
+  }
+  return data;
+}
+
+// Upper bound of the compressed size of a block, for all the codecs
+size_t max_compressed_size(size_t block_size) { return block_size + block_size / 4 + 1024; }
+
+/**
+ * @brief Device descriptors of a batch of blocks, each one read from `src` and written to `dst`
+ */
+class block_batch {
+ public:
+  block_batch(uint8_t const* src,
+              size_t src_stride,
+              std::vector<size_t> const& src_sizes,
+              uint8_t* dst,
+              size_t dst_stride)
+    : _num_blocks(src_sizes.size()),
+      _inputs(sizeof(cudf_io::gpu_inflate_input_s) * _num_blocks),
+      _statuses(sizeof(cudf_io::gpu_inflate_status_s) * _num_blocks)
+  {
+    std::vector<cudf_io::gpu_inflate_input_s> h_inputs(_num_blocks);
+    for (size_t i = 0; i < _num_blocks; ++i) {
+      h_inputs[i].srcDevice = src + i * src_stride;
+      h_inputs[i].srcSize   = src_sizes[i];
+      h_inputs[i].dstDevice = dst + i * dst_stride;
+      h_inputs[i].dstSize   = dst_stride;
+    }
+    CUDA_TRY(cudaMemcpy(_inputs.data(), h_inputs.data(), _inputs.size(), cudaMemcpyHostToDevice));
+  }
+
+  int size() const { return static_cast<int>(_num_blocks); }
+
+  cudf_io::gpu_inflate_input_s* inputs()
+  {
+    return static_cast<cudf_io::gpu_inflate_input_s*>(_inputs.data());
+  }
+
+  cudf_io::gpu_inflate_status_s* statuses()
+  {
+    return static_cast<cudf_io::gpu_inflate_status_s*>(_statuses.data());
+  }
+
+  /**
+   * @brief Returns the number of bytes written for each block, after checking that all the blocks
+   * were processed successfully
+   */
+  std::vector<size_t> bytes_written()
+  {
+    std::vector<cudf_io::gpu_inflate_status_s> h_statuses(_num_blocks);
+    CUDA_TRY(cudaMemcpy(
+      h_statuses.data(), _statuses.data(), _statuses.size(), cudaMemcpyDeviceToHost));
+    std::vector<size_t> sizes(_num_blocks);
+    std::transform(h_statuses.begin(), h_statuses.end(), sizes.begin(), [](auto const& s) {
+      CUDF_EXPECTS(s.status == 0, "Failed to process a block");
+      return s.bytes_written;
+    });
+    return sizes;
+  }
+
+ private:
+  size_t _num_blocks;
+  rmm::device_buffer _inputs;
+  rmm::device_buffer _statuses;
+};
+
+void compress(codec id, block_batch& batch)
+{
+  switch (id) {
+    case codec::SNAPPY:
+      CUDA_TRY(cudf_io::gpu_snap(batch.inputs(), batch.statuses(), batch.size()));
+      break;
+    case codec::DEFLATE:
+      CUDA_TRY(cudf_io::gpu_deflate(batch.inputs(), batch.statuses(), batch.size()));
+      break;
+    case codec::ZSTD:
+      CUDA_TRY(cudf_io::gpu_zstd(batch.inputs(), batch.statuses(), batch.size()));
+      break;
+  }
+}
+
+void decompress(codec id, block_batch& batch)
+{
+  switch (id) {
+    case codec::SNAPPY:
+      CUDA_TRY(cudf_io::gpu_unsnap(batch.inputs(), batch.statuses(), batch.size()));
+      break;
+    case codec::DEFLATE:
+      CUDA_TRY(cudf_io::gpuinflate(batch.inputs(), batch.statuses(), batch.size()));
+      break;
+    case codec::ZSTD:
+      CUDA_TRY(cudf_io::gpu_unzstd(batch.inputs(), batch.statuses(), batch.size()));
+      break;
+  }
+}
+
+int host_stream_type(codec id)
+{
+  switch (id) {
+    case codec::SNAPPY: return cudf_io::IO_UNCOMP_STREAM_TYPE_SNAPPY;
+    case codec::DEFLATE: return cudf_io::IO_UNCOMP_STREAM_TYPE_INFLATE;
+    case codec::ZSTD: return cudf_io::IO_UNCOMP_STREAM_TYPE_ZSTD;
+  }
+  CUDF_FAIL("Unsupported codec");
+}
+
+/**
+ * @brief Uncompressed blocks of generated data, and their compressed form on the device
+ */
+struct compressed_blocks {
+  compressed_blocks(codec id, size_t block_size, compressibility level, size_t num_blocks)
+    : block_size(block_size),
+      comp_stride(max_compressed_size(block_size)),
+      data(generate_data(block_size * num_blocks, level)),
+      d_data(data.data(), data.size()),
+      d_comp(comp_stride * num_blocks)
+  {
+    block_batch batch(static_cast<uint8_t const*>(d_data.data()),
+                      block_size,
+                      std::vector<size_t>(num_blocks, block_size),
+                      static_cast<uint8_t*>(d_comp.data()),
+                      comp_stride);
+    compress(id, batch);
+    comp_sizes = batch.bytes_written();
+  }
+
+  size_t compressed_bytes() const
+  {
+    return std::accumulate(comp_sizes.begin(), comp_sizes.end(), size_t{0});
+  }
+
+  size_t block_size;
+  size_t comp_stride;
+  std::vector<uint8_t> data;
+  rmm::device_buffer d_data;
+  rmm::device_buffer d_comp;
+  std::vector<size_t> comp_sizes;
+};
+
+class Compression : public cudf::benchmark {
+};
+
+void BM_compress(benchmark::State& state, codec id)
+{
+  size_t const block_size  = state.range(0);
+  auto const level         = static_cast<compressibility>(state.range(1));
+  size_t const num_blocks  = state.range(2);
+  size_t const total_bytes = block_size * num_blocks;
+
+  auto const data = generate_data(total_bytes, level);
+  rmm::device_buffer d_data(data.data(), data.size());
+  auto const comp_stride = max_compressed_size(block_size);
+  rmm::device_buffer d_comp(comp_stride * num_blocks);
+  block_batch batch(static_cast<uint8_t const*>(d_data.data()),
+                    block_size,
+                    std::vector<size_t>(num_blocks, block_size),
+                    static_cast<uint8_t*>(d_comp.data()),
+                    comp_stride);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    compress(id, batch);
+  }
+
+  auto const comp_sizes = batch.bytes_written();
+  state.SetBytesProcessed(total_bytes * state.iterations());
+  state.counters["compression_ratio"] =
+    static_cast<double>(total_bytes) /
+    std::accumulate(comp_sizes.begin(), comp_sizes.end(), size_t{0});
+}
+
+void BM_decompress(benchmark::State& state, codec id)
+{
+  size_t const block_size = state.range(0);
+  auto const level        = static_cast<compressibility>(state.range(1));
+  size_t const num_blocks = state.range(2);
+
+  compressed_blocks const blocks(id, block_size, level, num_blocks);
+  rmm::device_buffer d_decomp(block_size * num_blocks);
+  block_batch batch(static_cast<uint8_t const*>(blocks.d_comp.data()),
+                    blocks.comp_stride,
+                    blocks.comp_sizes,
+                    static_cast<uint8_t*>(d_decomp.data()),
+                    block_size);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    decompress(id, batch);
+  }
+
+  auto const decomp_sizes = batch.bytes_written();
+  CUDF_EXPECTS(std::all_of(decomp_sizes.begin(),
+                           decomp_sizes.end(),
+                           [block_size](auto size) { return size == block_size; }),
+               "Decompressed size mismatch");
+  state.SetBytesProcessed(block_size * num_blocks * state.iterations());
+  state.counters["compression_ratio"] =
+    static_cast<double>(block_size * num_blocks) / blocks.compressed_bytes();
+}
+
+// Baseline: the host decompressors of uncomp.cpp, one block after the other
+void BM_host_decompress(benchmark::State& state, codec id)
+{
+  size_t const block_size = state.range(0);
+  auto const level        = static_cast<compressibility>(state.range(1));
+  size_t const num_blocks = state.range(2);
+
+  compressed_blocks const blocks(id, block_size, level, num_blocks);
+  std::vector<uint8_t> h_comp(blocks.d_comp.size());
+  CUDA_TRY(cudaMemcpy(
+    h_comp.data(), blocks.d_comp.data(), blocks.d_comp.size(), cudaMemcpyDeviceToHost));
+  std::vector<uint8_t> h_decomp(block_size * num_blocks);
+  auto const decompressor = cudf_io::HostDecompressor::Create(host_stream_type(id));
+
+  for (auto _ : state) {
+    auto const start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < num_blocks; ++i) {
+      auto const size = decompressor->Decompress(h_decomp.data() + i * block_size,
+                                                 block_size,
+                                                 h_comp.data() + i * blocks.comp_stride,
+                                                 blocks.comp_sizes[i]);
+      CUDF_EXPECTS(size == block_size, "Decompressed size mismatch");
+    }
+    auto const elapsed = std::chrono::high_resolution_clock::now() - start;
+    state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+  }
+
+  state.SetBytesProcessed(block_size * num_blocks * state.iterations());
+}
+
+// Block sizes from ORC compression blocks to large Parquet pages, with batches of up to 512 MB
+void compression_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t block_size : {16 << 10, 64 << 10, 256 << 10, 1 << 20}) {
+    for (int level : {LOW, MEDIUM, HIGH}) {
+      for (int64_t num_blocks : {16, 256, 4096}) {
+        if (block_size * num_blocks <= max_batch_bytes) {
+          b->Args({block_size, level, num_blocks});
+        }
+      }
+    }
+  }
+}
+
+#define COMPRESSION_BENCHMARK_DEFINE(name, function, codec_id) \
+  BENCHMARK_DEFINE_F(Compression, name)                        \
+  (::benchmark::State & state) { function(state, codec_id); }  \
+  BENCHMARK_REGISTER_F(Compression, name)                      \
+    ->Apply(compression_args)                                  \
+    ->Unit(benchmark::kMillisecond)                            \
+    ->UseManualTime();
+
+COMPRESSION_BENCHMARK_DEFINE(snappy_compress, BM_compress, codec::SNAPPY);
+COMPRESSION_BENCHMARK_DEFINE(deflate_compress, BM_compress, codec::DEFLATE);
+COMPRESSION_BENCHMARK_DEFINE(zstd_compress, BM_compress, codec::ZSTD);
+COMPRESSION_BENCHMARK_DEFINE(snappy_decompress, BM_decompress, codec::SNAPPY);
+COMPRESSION_BENCHMARK_DEFINE(deflate_decompress, BM_decompress, codec::DEFLATE);
+COMPRESSION_BENCHMARK_DEFINE(zstd_decompress, BM_decompress, codec::ZSTD);
+COMPRESSION_BENCHMARK_DEFINE(snappy_host_decompress, BM_host_decompress, codec::SNAPPY);
+COMPRESSION_BENCHMARK_DEFINE(deflate_host_decompress, BM_host_decompress, codec::DEFLATE);
+COMPRESSION_BENCHMARK_DEFINE(zstd_host_decompress, BM_host_decompress, codec::ZSTD);
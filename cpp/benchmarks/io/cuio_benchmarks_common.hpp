@@ -17,10 +17,22 @@
 #pragma once
 
 #include <cudf/io/types.hpp>
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
 
 // used to make CUIO_BENCH_ALL_TYPES calls more readable
 constexpr int UNCOMPRESSED = (int)cudf::io::compression_type::NONE;
 constexpr int USE_SNAPPY   = (int)cudf::io::compression_type::SNAPPY;
+constexpr int USE_GZIP     = (int)cudf::io::compression_type::GZIP;
+constexpr int USE_ZSTD     = (int)cudf::io::compression_type::ZSTD;
+
+// used to make the data profile arguments (cardinality, average run length) more readable
+constexpr int UNLIMITED_CARDINALITY = 0;
+constexpr int NO_RUNS               = 1;
 
 #define CUIO_BENCH_ALL_TYPES(benchmark_define, compression)                         \
   benchmark_define(Boolean##_##compression, bool, compression);                     \
@@ -41,6 +53,13 @@ constexpr int USE_SNAPPY   = (int)cudf::io::compression_type::SNAPPY;
   benchmark_define(Timestamp_us##_##compression, cudf::timestamp_us, compression);  \
   benchmark_define(Timestamp_ns##_##compression, cudf::timestamp_ns, compression);
 
+// subset of the types above used to cover the secondary compression codecs
+#define CUIO_BENCH_CODEC_TYPES(benchmark_define, compression)         \
+  benchmark_define(Int##_##compression, int32_t, compression);        \
+  benchmark_define(Double##_##compression, double, compression);      \
+  benchmark_define(String##_##compression, std::string, compression); \
+  benchmark_define(Timestamp_ms##_##compression, cudf::timestamp_ms, compression);
+
 // sample benchmark define macro that can be passed to the macro above
 #define SAMPLE_BENCHMARK_DEFINE(name, datatype, compression)             \
   BENCHMARK_TEMPLATE_DEFINE_F(SampleFixture, name, datatype)             \
@@ -52,3 +71,40 @@ constexpr int USE_SNAPPY   = (int)cudf::io::compression_type::SNAPPY;
 
 // sample CUIO_BENCH_ALL_TYPES use
 // CUIO_BENCH_ALL_TYPES(SAMPLE_BENCHMARK_DEFINE, USE_SNAPPY)
+
+/**
+ * @brief Returns the metadata naming the columns of a table "col0" to "col<num_cols - 1>"
+ */
+inline cudf::io::table_metadata named_columns_metadata(cudf::size_type num_cols)
+{
+  cudf::io::table_metadata metadata;
+  for (cudf::size_type i = 0; i < num_cols; ++i) {
+    metadata.column_names.push_back("col" + std::to_string(i));
+  }
+  return metadata;
+}
+
+/**
+ * @brief Returns the names of `selected_percent` percent of the columns named by
+ * `named_columns_metadata(num_cols)`, spread evenly across the table
+ */
+inline std::vector<std::string> select_column_names(cudf::size_type num_cols, int selected_percent)
+{
+  auto const num_selected = std::max<cudf::size_type>(1, num_cols * selected_percent / 100);
+  std::vector<std::string> names;
+  for (cudf::size_type i = 0; i < num_selected; ++i) {
+    names.push_back("col" + std::to_string(i * num_cols / num_selected));
+  }
+  return names;
+}
+
+/**
+ * @brief Returns the {skip_rows, num_rows} of the middle `selected_percent` percent of the rows
+ */
+inline std::pair<cudf::size_type, cudf::size_type> select_row_range(cudf::size_type num_rows,
+                                                                    int selected_percent)
+{
+  auto const num_selected =
+    static_cast<cudf::size_type>(static_cast<int64_t>(num_rows) * selected_percent / 100);
+  return {(num_rows - num_selected) / 2, num_selected};
+}
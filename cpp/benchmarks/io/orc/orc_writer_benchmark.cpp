@@ -44,9 +44,13 @@ void ORC_write(benchmark::State& state)
   cudf_io::compression_type const compression =
     state.range(2) ? cudf_io::compression_type::SNAPPY : cudf_io::compression_type::NONE;
 
+  data_profile profile;
+  profile.set_cardinality(state.range(3));
+  profile.set_avg_run_length(state.range(4));
+
   int64_t const col_bytes = total_bytes / num_cols;
 
-  auto const tbl  = create_random_table<T>(num_cols, col_bytes, true);
+  auto const tbl  = create_random_table<T>(num_cols, col_bytes, profile);
   auto const view = tbl->view();
 
   for (auto _ : state) {
@@ -58,12 +62,13 @@ void ORC_write(benchmark::State& state)
   state.SetBytesProcessed(total_bytes * state.iterations());
 }
 
-#define ORC_WR_BENCHMARK_DEFINE(name, datatype, compression)   \
-  BENCHMARK_TEMPLATE_DEFINE_F(OrcWrite, name, datatype)        \
-  (::benchmark::State & state) { ORC_write<datatype>(state); } \
-  BENCHMARK_REGISTER_F(OrcWrite, name)                         \
-    ->Args({data_size, 64, compression})                       \
-    ->Unit(benchmark::kMillisecond)                            \
+#define ORC_WR_BENCHMARK_DEFINE(name, datatype, compression)             \
+  BENCHMARK_TEMPLATE_DEFINE_F(OrcWrite, name, datatype)                  \
+  (::benchmark::State & state) { ORC_write<datatype>(state); }           \
+  BENCHMARK_REGISTER_F(OrcWrite, name)                                   \
+    ->Args({data_size, 64, compression, UNLIMITED_CARDINALITY, NO_RUNS}) \
+    ->Args({data_size, 64, compression, 1000, 32})                       \
+    ->Unit(benchmark::kMillisecond)                                      \
     ->UseManualTime();
 
 CUIO_BENCH_ALL_TYPES(ORC_WR_BENCHMARK_DEFINE, UNCOMPRESSED)
@@ -23,6 +23,9 @@
 
 #include <cudf/io/functions.hpp>
 
+#include <chrono>
+#include <tuple>
+
 // to enable, run cmake with -DBUILD_BENCHMARKS=ON
 
 constexpr int64_t data_size = 512 << 20;  // 512 MB
@@ -38,14 +41,17 @@ void PQ_read(benchmark::State& state)
 {
   int64_t const total_bytes      = state.range(0);
   cudf::size_type const num_cols = state.range(1);
-  cudf_io::compression_type const compression =
-    state.range(2) ? cudf_io::compression_type::SNAPPY : cudf_io::compression_type::NONE;
+  auto const compression         = static_cast<cudf_io::compression_type>(state.range(2));
+
+  data_profile profile;
+  profile.set_cardinality(state.range(3));
+  profile.set_avg_run_length(state.range(4));
 
   int64_t const col_bytes = total_bytes / num_cols;
   std::vector<char> out_buffer;
   out_buffer.reserve(total_bytes);
 
-  auto const tbl  = create_random_table<T>(num_cols, col_bytes, true);
+  auto const tbl  = create_random_table<T>(num_cols, col_bytes, profile);
   auto const view = tbl->view();
 
   cudf_io::write_parquet_args write_args{
@@ -62,13 +68,151 @@ void PQ_read(benchmark::State& state)
   state.SetBytesProcessed(total_bytes * state.iterations());
 }
 
-#define PARQ_RD_BENCHMARK_DEFINE(name, datatype, compression) \
-  BENCHMARK_TEMPLATE_DEFINE_F(ParquetRead, name, datatype)    \
-  (::benchmark::State & state) { PQ_read<datatype>(state); }  \
-  BENCHMARK_REGISTER_F(ParquetRead, name)                     \
-    ->Args({data_size, 64, compression})                      \
-    ->Unit(benchmark::kMillisecond)                           \
+#define PARQ_RD_BENCHMARK_DEFINE(name, datatype, compression)            \
+  BENCHMARK_TEMPLATE_DEFINE_F(ParquetRead, name, datatype)               \
+  (::benchmark::State & state) { PQ_read<datatype>(state); }             \
+  BENCHMARK_REGISTER_F(ParquetRead, name)                                \
+    ->Args({data_size, 64, compression, UNLIMITED_CARDINALITY, NO_RUNS}) \
+    ->Args({data_size, 64, compression, 1000, 32})                       \
+    ->Unit(benchmark::kMillisecond)                                      \
     ->UseManualTime();
 
 CUIO_BENCH_ALL_TYPES(PARQ_RD_BENCHMARK_DEFINE, UNCOMPRESSED)
 CUIO_BENCH_ALL_TYPES(PARQ_RD_BENCHMARK_DEFINE, USE_SNAPPY)
+CUIO_BENCH_CODEC_TYPES(PARQ_RD_BENCHMARK_DEFINE, USE_GZIP)
+CUIO_BENCH_CODEC_TYPES(PARQ_RD_BENCHMARK_DEFINE, USE_ZSTD)
+
+// Reads a subset of the columns and rows of the file; only the selected data is counted
+template <typename T>
+void PQ_read_subset(benchmark::State& state)
+{
+  int64_t const total_bytes      = state.range(0);
+  cudf::size_type const num_cols = state.range(1);
+  auto const compression         = static_cast<cudf_io::compression_type>(state.range(2));
+  int const column_percent       = state.range(3);
+  int const row_percent          = state.range(4);
+
+  int64_t const col_bytes = total_bytes / num_cols;
+  std::vector<char> out_buffer;
+  out_buffer.reserve(total_bytes);
+
+  auto const tbl      = create_random_table<T>(num_cols, col_bytes, data_profile{});
+  auto const view     = tbl->view();
+  auto const metadata = named_columns_metadata(num_cols);
+
+  cudf_io::write_parquet_args write_args{
+    cudf_io::sink_info(&out_buffer), view, &metadata, compression};
+  cudf_io::write_parquet(write_args);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  read_args.columns = select_column_names(num_cols, column_percent);
+  if (row_percent < 100) {
+    std::tie(read_args.skip_rows, read_args.num_rows) =
+      select_row_range(view.num_rows(), row_percent);
+  }
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_parquet(read_args);
+  }
+
+  state.SetBytesProcessed(total_bytes * column_percent / 100 * row_percent / 100 *
+                          state.iterations());
+}
+
+#define PARQ_RD_SUBSET_BENCHMARK_DEFINE(name, datatype, compression) \
+  BENCHMARK_TEMPLATE_DEFINE_F(ParquetRead, name, datatype)           \
+  (::benchmark::State & state) { PQ_read_subset<datatype>(state); }  \
+  BENCHMARK_REGISTER_F(ParquetRead, name)                            \
+    ->Args({data_size, 64, compression, 5, 100})                     \
+    ->Args({data_size, 64, compression, 25, 100})                    \
+    ->Args({data_size, 64, compression, 100, 10})                    \
+    ->Args({data_size, 64, compression, 100, 50})                    \
+    ->Args({data_size, 64, compression, 25, 50})                     \
+    ->Unit(benchmark::kMillisecond)                                  \
+    ->UseManualTime();
+
+PARQ_RD_SUBSET_BENCHMARK_DEFINE(Long_subset_SNAPPY, int64_t, USE_SNAPPY);
+PARQ_RD_SUBSET_BENCHMARK_DEFINE(String_subset_SNAPPY, std::string, USE_SNAPPY);
+
+// Reads low cardinality strings, which the writer encodes with a dictionary, optionally
+// returning them as a dictionary column instead of expanding them
+void PQ_read_dictionary_strings(benchmark::State& state)
+{
+  int64_t const total_bytes      = state.range(0);
+  cudf::size_type const num_cols = state.range(1);
+  data_profile profile;
+  profile.set_cardinality(state.range(2));
+  profile.set_distribution<std::string>(distribution_id::UNIFORM, 16, state.range(3));
+
+  int64_t const col_bytes = total_bytes / num_cols;
+  std::vector<char> out_buffer;
+  out_buffer.reserve(total_bytes);
+
+  auto const tbl  = create_random_table<std::string>(num_cols, col_bytes, profile);
+  auto const view = tbl->view();
+
+  cudf_io::write_parquet_args write_args{
+    cudf_io::sink_info(&out_buffer), view, nullptr, cudf_io::compression_type::SNAPPY};
+  cudf_io::write_parquet(write_args);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  read_args.strings_to_dictionary = state.range(4);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_parquet(read_args);
+  }
+
+  state.SetBytesProcessed(total_bytes * state.iterations());
+}
+
+void dictionary_strings_args(benchmark::internal::Benchmark* b)
+{
+  for (int cardinality : {16, 4096}) {
+    for (int max_length : {32, 256}) {
+      for (int to_dictionary : {false, true}) {
+        b->Args({data_size, 16, cardinality, max_length, to_dictionary});
+      }
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(ParquetRead, DictionaryStrings, std::string)
+(::benchmark::State& state) { PQ_read_dictionary_strings(state); }
+BENCHMARK_REGISTER_F(ParquetRead, DictionaryStrings)
+  ->Apply(dictionary_strings_args)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
+
+// Parses the footer without reading any column data, to separate its cost from the decode cost
+void PQ_parse_footer(benchmark::State& state)
+{
+  cudf::size_type const num_cols = state.range(0);
+  cudf::size_type const num_rows = state.range(1);
+
+  std::vector<char> out_buffer;
+  auto const tbl = create_random_table<int32_t>(num_cols, num_rows * sizeof(int32_t), false);
+
+  cudf_io::write_parquet_args write_args{cudf_io::sink_info(&out_buffer), tbl->view()};
+  cudf_io::write_parquet(write_args);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+
+  for (auto _ : state) {
+    auto const start = std::chrono::high_resolution_clock::now();
+    benchmark::DoNotOptimize(cudf_io::estimate_read_parquet_memory(read_args));
+    auto const elapsed = std::chrono::high_resolution_clock::now() - start;
+    state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+  }
+
+  state.counters["file_bytes"] = out_buffer.size();
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(ParquetRead, ParseFooter, int32_t)
+(::benchmark::State& state) { PQ_parse_footer(state); }
+BENCHMARK_REGISTER_F(ParquetRead, ParseFooter)
+  ->RangeMultiplier(4)
+  ->Ranges({{16, 1024}, {1 << 16, 1 << 22}})
+  ->Unit(benchmark::kMicrosecond)
+  ->UseManualTime();
@@ -41,9 +41,13 @@ void PQ_write(benchmark::State& state)
   cudf_io::compression_type const compression =
     state.range(2) ? cudf_io::compression_type::SNAPPY : cudf_io::compression_type::NONE;
 
+  data_profile profile;
+  profile.set_cardinality(state.range(3));
+  profile.set_avg_run_length(state.range(4));
+
   int64_t const col_bytes = total_bytes / num_cols;
 
-  auto const tbl  = create_random_table<T>(num_cols, col_bytes, true);
+  auto const tbl  = create_random_table<T>(num_cols, col_bytes, profile);
   auto const view = tbl->view();
 
   for (auto _ : state) {
@@ -55,12 +59,13 @@ void PQ_write(benchmark::State& state)
   state.SetBytesProcessed(total_bytes * state.iterations());
 }
 
-#define PARQ_WR_BENCHMARK_DEFINE(name, datatype, compression) \
-  BENCHMARK_TEMPLATE_DEFINE_F(ParquetWrite, name, datatype)   \
-  (::benchmark::State & state) { PQ_write<datatype>(state); } \
-  BENCHMARK_REGISTER_F(ParquetWrite, name)                    \
-    ->Args({data_size, 64, compression})                      \
-    ->Unit(benchmark::kMillisecond)                           \
+#define PARQ_WR_BENCHMARK_DEFINE(name, datatype, compression)            \
+  BENCHMARK_TEMPLATE_DEFINE_F(ParquetWrite, name, datatype)              \
+  (::benchmark::State & state) { PQ_write<datatype>(state); }            \
+  BENCHMARK_REGISTER_F(ParquetWrite, name)                               \
+    ->Args({data_size, 64, compression, UNLIMITED_CARDINALITY, NO_RUNS}) \
+    ->Args({data_size, 64, compression, 1000, 32})                       \
+    ->Unit(benchmark::kMillisecond)                                      \
     ->UseManualTime();
 
 CUIO_BENCH_ALL_TYPES(PARQ_WR_BENCHMARK_DEFINE, UNCOMPRESSED)
@@ -23,6 +23,7 @@
 #include "../synchronization/synchronization.hpp"
 
 #include <cudf/detail/iterator.cuh>  // include iterator header
+#include <cudf/detail/reduction.cuh>
 // for reduction tests
 #include <thrust/device_vector.h>
 #include <cub/device/device_reduce.cuh>
@@ -153,6 +154,41 @@ void BM_iterator(benchmark::State &state)
                           sizeof(TypeParam));
 }
 
+template <typename T>
+void valid_word_bench(cudf::column_view &col)
+{
+  auto d_col = cudf::column_device_view::create(col);
+  cudf::reduction::detail::reduce_valid_rows<T, T>(
+    *d_col, cudf::reduction::op::sum{}, rmm::mr::get_default_resource(), 0);
+}
+
+template <class TypeParam, bool valid_words>
+void BM_null_iterator(benchmark::State &state)
+{
+  const cudf::size_type column_size{(cudf::size_type)state.range(0)};
+  using T      = TypeParam;
+  auto num_gen = thrust::counting_iterator<cudf::size_type>(0);
+  // runs of valid and null rows, with a null row in every 100 of the valid runs
+  auto null_gen = thrust::make_transform_iterator(
+    num_gen, [](cudf::size_type row) { return (row / 4096) % 2 == 0 && row % 100 != 0; });
+
+  cudf::test::fixed_width_column_wrapper<T> wrap_hasnull_T(
+    num_gen, num_gen + column_size, null_gen);
+  cudf::column_view hasnull_T = wrap_hasnull_T;
+
+  rmm::device_vector<T> dev_result(1, T{0});
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    if (valid_words) {
+      valid_word_bench<T>(hasnull_T);  // driven by validity words
+    } else {
+      iterator_bench_cub<T, true>(hasnull_T, dev_result);  // driven by iterator with nulls
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * column_size *
+                          sizeof(TypeParam));
+}
+
 // operator+ defined for pair iterator reduction
 template <typename T>
 __device__ thrust::pair<T, bool> operator+(thrust::pair<T, bool> lhs, thrust::pair<T, bool> rhs)
@@ -241,4 +277,18 @@ ITER_BM_BENCHMARK_DEFINE(double_thrust_iter, double, false, false);
     ->Unit(benchmark::kMillisecond);
 
 PAIRITER_BM_BENCHMARK_DEFINE(double_cub_pair, double, true);
-PAIRITER_BM_BENCHMARK_DEFINE(double_thrust_pair, double, false);
\ No newline at end of file
+PAIRITER_BM_BENCHMARK_DEFINE(double_thrust_pair, double, false);
+
+#define NULLITER_BM_BENCHMARK_DEFINE(name, type, valid_words)    \
+  BENCHMARK_DEFINE_F(Iterator, name)(::benchmark::State & state) \
+  {                                                              \
+    BM_null_iterator<type, valid_words>(state);                  \
+  }                                                              \
+  BENCHMARK_REGISTER_F(Iterator, name)                           \
+    ->RangeMultiplier(10)                                        \
+    ->Range(1000, 10000000)                                      \
+    ->UseManualTime()                                            \
+    ->Unit(benchmark::kMillisecond);
+
+NULLITER_BM_BENCHMARK_DEFINE(double_cub_null_iter, double, false);
+NULLITER_BM_BENCHMARK_DEFINE(double_valid_word, double, true);
@@ -20,14 +20,22 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/join.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <benchmarks/common/generate_benchmark_input.hpp>
 #include <fixture/benchmark_fixture.hpp>
 #include <synchronization/synchronization.hpp>
 
+#include <hash/helper_functions.cuh>
+
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <string>
 #include <vector>
 
 #include "generate_input_tables.cuh"
@@ -87,12 +95,153 @@ static void BM_join(benchmark::State &state)
   }
 }
 
+template <typename key_type, typename payload_type>
+static void BM_join_skewed(benchmark::State &state)
+{
+  const cudf::size_type build_table_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type probe_table_size{(cudf::size_type)state.range(1)};
+  const cudf::size_type rand_max_val{build_table_size * 2};
+
+  // Generate build keys uniformly distributed in [0, rand_max_val] and probe keys skewed towards
+  // the low end of the same range, so that a few build keys see most of the probes
+
+  data_profile build_profile;
+  build_profile.set_null_frequency(0);
+  build_profile.set_distribution<key_type>(distribution_id::UNIFORM, 0, rand_max_val);
+  data_profile probe_profile;
+  probe_profile.set_null_frequency(0);
+  probe_profile.set_distribution<key_type>(distribution_id::GEOMETRIC, 0, rand_max_val);
+
+  auto build_key_column = create_random_column<key_type>(build_profile, build_table_size);
+  auto probe_key_column = create_random_column<key_type>(probe_profile, probe_table_size);
+
+  auto payload_data_it = thrust::make_counting_iterator(0);
+  cudf::test::fixed_width_column_wrapper<payload_type> build_payload_column(
+    payload_data_it, payload_data_it + build_table_size);
+
+  cudf::test::fixed_width_column_wrapper<payload_type> probe_payload_column(
+    payload_data_it, payload_data_it + probe_table_size);
+
+  cudf::table_view build_table({build_key_column->view(), build_payload_column});
+  cudf::table_view probe_table({probe_key_column->view(), probe_payload_column});
+
+  std::vector<cudf::size_type> columns_to_join = {0};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, 0);
+
+    auto result =
+      cudf::inner_join(probe_table, build_table, columns_to_join, columns_to_join, {{0, 0}});
+  }
+}
+
+/**
+ * @brief Creates a key column of `num_rows` values drawn from `profile`
+ *
+ * String keys are the decimal representations of integer keys, so that they match the same rows.
+ */
+template <typename key_type>
+std::unique_ptr<cudf::column> create_key_column(data_profile const &profile,
+                                                cudf::size_type num_rows)
+{
+  return create_random_column<key_type>(profile, num_rows);
+}
+
+template <>
+std::unique_ptr<cudf::column> create_key_column<std::string>(data_profile const &profile,
+                                                             cudf::size_type num_rows)
+{
+  return cudf::strings::from_integers(create_random_column<int64_t>(profile, num_rows)->view());
+}
+
+enum key_skew { UNIFORM_KEYS, ZIPF_KEYS };
+
+template <typename key_type>
+static void BM_join_sweep(benchmark::State &state)
+{
+  const cudf::size_type build_table_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type probe_table_size{build_table_size * (cudf::size_type)state.range(1)};
+  const cudf::size_type num_key_columns{(cudf::size_type)state.range(2)};
+  const double null_frequency = state.range(3) / 100.;
+  const auto skew             = static_cast<key_skew>(state.range(4));
+
+  // Each key column spans a range such that the combined keys have about twice as many distinct
+  // values as there are build rows, so that about half of the uniform probes find a match
+  auto const column_max_val =
+    static_cast<int64_t>(std::ceil(std::pow(2. * build_table_size, 1. / num_key_columns)));
+
+  auto const dist = skew == ZIPF_KEYS ? distribution_id::ZIPF : distribution_id::UNIFORM;
+  data_profile profile;
+  profile.set_null_frequency(null_frequency);
+  // String keys are generated as int64_t keys
+  profile.set_distribution<int32_t>(dist, 0, column_max_val);
+  profile.set_distribution<int64_t>(dist, 0, column_max_val);
+
+  std::vector<std::unique_ptr<cudf::column>> build_columns;
+  std::vector<std::unique_ptr<cudf::column>> probe_columns;
+  for (cudf::size_type i = 0; i < num_key_columns; ++i) {
+    build_columns.push_back(create_key_column<key_type>(profile, build_table_size));
+    probe_columns.push_back(create_key_column<key_type>(profile, probe_table_size));
+  }
+
+  auto payload_data_it = thrust::make_counting_iterator(0);
+  build_columns.push_back(cudf::test::fixed_width_column_wrapper<int32_t>(
+                            payload_data_it, payload_data_it + build_table_size)
+                            .release());
+  probe_columns.push_back(cudf::test::fixed_width_column_wrapper<int32_t>(
+                            payload_data_it, payload_data_it + probe_table_size)
+                            .release());
+
+  cudf::table build_table(std::move(build_columns));
+  cudf::table probe_table(std::move(probe_columns));
+
+  std::vector<cudf::size_type> columns_to_join(num_key_columns);
+  std::iota(columns_to_join.begin(), columns_to_join.end(), 0);
+
+  cudf::size_type result_rows = 0;
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, 0);
+
+    auto result = cudf::inner_join(
+      probe_table.view(), build_table.view(), columns_to_join, columns_to_join, {});
+    result_rows = result->num_rows();
+  }
+
+  state.SetItemsProcessed(state.iterations() * (build_table_size + probe_table_size));
+  // The build side multimap holds every build row
+  state.counters["hash_table_occupancy"] =
+    static_cast<double>(build_table_size) / compute_hash_table_size(build_table_size);
+  state.counters["matches_per_probe_row"] = static_cast<double>(result_rows) / probe_table_size;
+}
+
+/**
+ * @brief Registers the arguments {build rows, probe:build ratio, key columns, null percentage,
+ * skew} of the join sweeps
+ */
+static void join_sweep_args(benchmark::internal::Benchmark *b)
+{
+  for (int build_rows : {100'000, 10'000'000}) {
+    for (int ratio : {1, 4, 16}) {
+      for (int skew : {UNIFORM_KEYS, ZIPF_KEYS}) { b->Args({build_rows, ratio, 1, 0, skew}); }
+    }
+    for (int num_key_columns : {2, 4}) { b->Args({build_rows, 4, num_key_columns, 0, 0}); }
+    b->Args({build_rows, 4, 1, 10, UNIFORM_KEYS});
+    b->Args({build_rows, 4, 2, 10, UNIFORM_KEYS});
+  }
+}
+
 #define JOIN_BENCHMARK_DEFINE(name, key_type, payload_type)       \
   BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, payload_type) \
   (::benchmark::State & st) { BM_join<key_type, payload_type>(st); }
 
+#define JOIN_SKEWED_BENCHMARK_DEFINE(name, key_type, payload_type) \
+  BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, payload_type)  \
+  (::benchmark::State & st) { BM_join_skewed<key_type, payload_type>(st); }
+
 JOIN_BENCHMARK_DEFINE(join_32bit, int32_t, int32_t);
 JOIN_BENCHMARK_DEFINE(join_64bit, int64_t, int64_t);
+JOIN_SKEWED_BENCHMARK_DEFINE(join_skewed_32bit, int32_t, int32_t);
+JOIN_SKEWED_BENCHMARK_DEFINE(join_skewed_64bit, int64_t, int64_t);
 
 BENCHMARK_REGISTER_F(Join, join_32bit)
   ->Unit(benchmark::kMillisecond)
@@ -111,3 +260,29 @@ BENCHMARK_REGISTER_F(Join, join_64bit)
   ->Args({50'000'000, 50'000'000})
   ->Args({40'000'000, 120'000'000})
   ->UseManualTime();
+
+BENCHMARK_REGISTER_F(Join, join_skewed_32bit)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({100'000, 100'000})
+  ->Args({100'000, 1'000'000})
+  ->Args({10'000'000, 10'000'000})
+  ->Args({10'000'000, 40'000'000})
+  ->UseManualTime();
+
+BENCHMARK_REGISTER_F(Join, join_skewed_64bit)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({10'000'000, 10'000'000})
+  ->Args({10'000'000, 40'000'000})
+  ->UseManualTime();
+
+#define JOIN_SWEEP_BENCHMARK_DEFINE(name, key_type)          \
+  BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, int32_t) \
+  (::benchmark::State & st) { BM_join_sweep<key_type>(st); } \
+  BENCHMARK_REGISTER_F(Join, name)                           \
+    ->Unit(benchmark::kMillisecond)                          \
+    ->Apply(join_sweep_args)                                 \
+    ->UseManualTime();
+
+JOIN_SWEEP_BENCHMARK_DEFINE(join_sweep_32bit, int32_t);
+JOIN_SWEEP_BENCHMARK_DEFINE(join_sweep_64bit, int64_t);
+JOIN_SWEEP_BENCHMARK_DEFINE(join_sweep_string, std::string);
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cuda_runtime.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+// Multi-operator pipelines modeled after TPC-H queries, over generated tables whose sizes scale
+// with the scale factor like the TPC-H tables. Each pipeline reads its tables from in-memory
+// parquet files, and reports the time of each of its stages.
+
+namespace cudf_io = cudf::io;
+
+namespace {
+constexpr cudf::size_type lineitem_rows_per_sf = 6'000'000;
+constexpr cudf::size_type orders_rows_per_sf   = 1'500'000;
+// Dates are numbers of days over the seven years of the TPC-H data
+constexpr int32_t num_days = 7 * 365;
+
+// lineitem columns
+enum {
+  L_ORDERKEY,
+  L_QUANTITY,
+  L_EXTENDEDPRICE,
+  L_DISCOUNT,
+  L_SHIPDATE,
+  L_RETURNFLAG,
+  L_LINESTATUS
+};
+// orders columns
+enum { O_ORDERKEY, O_ORDERDATE, O_ORDERPRIORITY };
+
+/**
+ * @brief Creates a column of `num_rows` non-null values uniformly distributed in [lower, upper]
+ */
+template <typename T, typename Bound>
+std::unique_ptr<cudf::column> uniform_column(cudf::size_type num_rows, Bound lower, Bound upper)
+{
+  data_profile profile;
+  profile.set_null_frequency(0);
+  profile.set_distribution<T>(distribution_id::UNIFORM, lower, upper);
+  return create_random_column<T>(profile, num_rows);
+}
+
+/**
+ * @brief Returns a parquet file of the lineitem table with `num_rows` rows, for `num_orders`
+ * orders
+ */
+std::vector<char> make_lineitem(cudf::size_type num_rows, cudf::size_type num_orders)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(uniform_column<int32_t>(num_rows, 0, num_orders - 1));
+  columns.push_back(uniform_column<int32_t>(num_rows, 1, 50));
+  columns.push_back(uniform_column<double>(num_rows, 900., 105'000.));
+  columns.push_back(uniform_column<double>(num_rows, 0., 0.1));
+  columns.push_back(uniform_column<int32_t>(num_rows, 0, num_days - 1));
+  columns.push_back(uniform_column<int8_t>(num_rows, 0, 2));
+  columns.push_back(uniform_column<int8_t>(num_rows, 0, 1));
+  cudf::table const lineitem(std::move(columns));
+
+  std::vector<char> buffer;
+  cudf_io::write_parquet_args args{cudf_io::sink_info(&buffer), lineitem.view()};
+  cudf_io::write_parquet(args);
+  return buffer;
+}
+
+/**
+ * @brief Returns a parquet file of the orders table with `num_rows` rows, with unique keys
+ */
+std::vector<char> make_orders(cudf::size_type num_rows)
+{
+  auto key_it = thrust::make_counting_iterator(0);
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(
+    cudf::test::fixed_width_column_wrapper<int32_t>(key_it, key_it + num_rows).release());
+  columns.push_back(uniform_column<int32_t>(num_rows, 0, num_days - 1));
+  columns.push_back(uniform_column<int8_t>(num_rows, 0, 4));
+  cudf::table const orders(std::move(columns));
+
+  std::vector<char> buffer;
+  cudf_io::write_parquet_args args{cudf_io::sink_info(&buffer), orders.view()};
+  cudf_io::write_parquet(args);
+  return buffer;
+}
+
+std::unique_ptr<cudf::table> scan(std::vector<char> const& buffer)
+{
+  cudf_io::read_parquet_args args{cudf_io::source_info(buffer.data(), buffer.size())};
+  return cudf_io::read_parquet(args).tbl;
+}
+
+/**
+ * @brief Returns the rows of `input` where the date column `date_index` compares to `date` with
+ * `op`
+ */
+std::unique_ptr<cudf::table> filter(cudf::table_view const& input,
+                                    cudf::size_type date_index,
+                                    cudf::binary_operator op,
+                                    int32_t date)
+{
+  auto const mask = cudf::binary_operation(input.column(date_index),
+                                           cudf::numeric_scalar<int32_t>(date),
+                                           op,
+                                           cudf::data_type{cudf::type_id::BOOL8});
+  return cudf::apply_boolean_mask(input, *mask);
+}
+
+/**
+ * @brief Accumulates the time of the stages of a pipeline over the benchmark iterations
+ */
+class stage_timer {
+ public:
+  /**
+   * @brief Runs `stage` and adds its time, up to the completion of its device work, to `name`
+   */
+  template <typename Stage>
+  auto operator()(std::string const& name, Stage&& stage) -> decltype(stage())
+  {
+    auto const start = std::chrono::steady_clock::now();
+    auto result      = stage();
+    cudaStreamSynchronize(0);
+    elapsed_[name] += std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+    return result;
+  }
+
+  /**
+   * @brief Reports the average time per iteration of each stage as `<name>_ms` counters
+   */
+  void report(benchmark::State& state) const
+  {
+    for (auto const& stage : elapsed_) {
+      state.counters[stage.first + "_ms"] =
+        benchmark::Counter(stage.second, benchmark::Counter::kAvgIterations);
+    }
+  }
+
+ private:
+  std::map<std::string, double> elapsed_;
+};
+
+/**
+ * @brief Runs `pipeline(timer)` in the benchmark loop and reports the stage times of the pipeline
+ *
+ * The input tables are host buffers, so the device memory statistics reported by the fixture are
+ * those of the pipeline.
+ */
+template <typename Pipeline>
+void run_pipeline(benchmark::State& state, Pipeline pipeline)
+{
+  stage_timer timer;
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    pipeline(timer);
+  }
+
+  timer.report(state);
+}
+
+}  // namespace
+
+class Query : public cudf::benchmark {
+};
+
+/**
+ * Pricing summary, modeled after TPC-H Q1:
+ * scan lineitem -> filter on ship date -> group by (return flag, line status) with sums, mean
+ * and count -> sort by group keys
+ */
+void BM_pricing_summary(benchmark::State& state)
+{
+  cudf::size_type const scale_factor = state.range(0);
+  auto const lineitem_file =
+    make_lineitem(lineitem_rows_per_sf * scale_factor, orders_rows_per_sf * scale_factor);
+
+  run_pipeline(state, [&](stage_timer& timer) {
+    auto const lineitem = timer("scan", [&]() { return scan(lineitem_file); });
+
+    auto const shipped = timer("filter", [&]() {
+      return filter(
+        lineitem->view(), L_SHIPDATE, cudf::binary_operator::LESS_EQUAL, num_days - 90);
+    });
+
+    auto const summary = timer("groupby", [&]() {
+      auto const view = shipped->view();
+      cudf::groupby::groupby gb_obj(
+        cudf::table_view({view.column(L_RETURNFLAG), view.column(L_LINESTATUS)}));
+
+      std::vector<cudf::groupby::aggregation_request> requests(3);
+      requests[0].values = view.column(L_QUANTITY);
+      requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+      requests[0].aggregations.push_back(cudf::make_count_aggregation());
+      requests[1].values = view.column(L_EXTENDEDPRICE);
+      requests[1].aggregations.push_back(cudf::make_sum_aggregation());
+      requests[2].values = view.column(L_DISCOUNT);
+      requests[2].aggregations.push_back(cudf::make_mean_aggregation());
+      return gb_obj.aggregate(requests);
+    });
+
+    timer("sort", [&]() {
+      auto const& results = summary.second;
+      auto const keys     = summary.first->view();
+      return cudf::sort_by_key(cudf::table_view({keys.column(0),
+                                                 keys.column(1),
+                                                 results[0].results[0]->view(),
+                                                 results[0].results[1]->view(),
+                                                 results[1].results[0]->view(),
+                                                 results[2].results[0]->view()}),
+                               keys);
+    });
+  });
+}
+
+/**
+ * Shipping priority, modeled after TPC-H Q3:
+ * scan lineitem and orders -> filter both on dates -> join on order key -> compute the revenue
+ * and sum it per order -> sort by decreasing revenue and order date
+ */
+void BM_shipping_priority(benchmark::State& state)
+{
+  cudf::size_type const scale_factor = state.range(0);
+  cudf::size_type const num_orders   = orders_rows_per_sf * scale_factor;
+  auto const lineitem_file = make_lineitem(lineitem_rows_per_sf * scale_factor, num_orders);
+  auto const orders_file   = make_orders(num_orders);
+  int32_t const date       = num_days / 2;
+
+  run_pipeline(state, [&](stage_timer& timer) {
+    auto const lineitem = timer("scan", [&]() { return scan(lineitem_file); });
+    auto const orders   = timer("scan", [&]() { return scan(orders_file); });
+
+    auto const shipped = timer("filter", [&]() {
+      return filter(lineitem->view(), L_SHIPDATE, cudf::binary_operator::GREATER, date);
+    });
+    auto const ordered = timer("filter", [&]() {
+      return filter(orders->view(), O_ORDERDATE, cudf::binary_operator::LESS, date);
+    });
+
+    // The joined table holds the lineitem columns followed by the orders columns but the key
+    auto const joined = timer("join", [&]() {
+      return cudf::inner_join(
+        shipped->view(), ordered->view(), {L_ORDERKEY}, {O_ORDERKEY}, {{L_ORDERKEY, O_ORDERKEY}});
+    });
+    auto const num_lineitem_cols = lineitem->num_columns();
+
+    auto const revenue = timer("revenue", [&]() {
+      auto const view     = joined->view();
+      auto const discount = cudf::binary_operation(cudf::numeric_scalar<double>(1.),
+                                                   view.column(L_DISCOUNT),
+                                                   cudf::binary_operator::SUB,
+                                                   cudf::data_type{cudf::type_id::FLOAT64});
+      return cudf::binary_operation(view.column(L_EXTENDEDPRICE),
+                                    *discount,
+                                    cudf::binary_operator::MUL,
+                                    cudf::data_type{cudf::type_id::FLOAT64});
+    });
+
+    auto const order_revenue = timer("groupby", [&]() {
+      auto const view = joined->view();
+      cudf::groupby::groupby gb_obj(
+        cudf::table_view({view.column(L_ORDERKEY),
+                          view.column(num_lineitem_cols + O_ORDERDATE - 1),
+                          view.column(num_lineitem_cols + O_ORDERPRIORITY - 1)}));
+
+      std::vector<cudf::groupby::aggregation_request> requests(1);
+      requests[0].values = revenue->view();
+      requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+      return gb_obj.aggregate(requests);
+    });
+
+    timer("sort", [&]() {
+      auto const keys  = order_revenue.first->view();
+      auto const total = order_revenue.second[0].results[0]->view();
+      return cudf::sort_by_key(
+        cudf::table_view({keys.column(0), keys.column(1), keys.column(2), total}),
+        cudf::table_view({total, keys.column(1)}),
+        {cudf::order::DESCENDING, cudf::order::ASCENDING});
+    });
+  });
+}
+
+BENCHMARK_DEFINE_F(Query, PricingSummary)(::benchmark::State& state) { BM_pricing_summary(state); }
+
+BENCHMARK_REGISTER_F(Query, PricingSummary)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1)
+  ->Arg(2)
+  ->Arg(4)
+  ->UseManualTime();
+
+BENCHMARK_DEFINE_F(Query, ShippingPriority)(::benchmark::State& state)
+{
+  BM_shipping_priority(state);
+}
+
+BENCHMARK_REGISTER_F(Query, ShippingPriority)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1)
+  ->Arg(2)
+  ->Arg(4)
+  ->UseManualTime();
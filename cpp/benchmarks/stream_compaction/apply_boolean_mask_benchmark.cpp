@@ -17,6 +17,8 @@
 #include <fixture/benchmark_fixture.hpp>
 #include <synchronization/synchronization.hpp>
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <tests/utilities/column_wrapper.hpp>
@@ -123,6 +125,40 @@ void BM_apply_boolean_mask(benchmark::State& state, cudf::size_type num_columns)
   calculate_bandwidth<T>(state, num_columns);
 }
 
+// Filters by the predicate `column 0 < threshold` instead of a materialized mask
+template <class T>
+void BM_filter_expression(benchmark::State& state, cudf::size_type num_columns)
+{
+  using wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+  const cudf::size_type column_size{static_cast<cudf::size_type>(state.range(0))};
+  const cudf::size_type percent_true{static_cast<cudf::size_type>(state.range(1))};
+
+  std::vector<T> data(column_size);
+  std::iota(data.begin(), data.end(), 0);
+
+  std::vector<wrapper> columns;
+  for (int i = 0; i < num_columns; i++) { columns.emplace_back(data.cbegin(), data.cend()); }
+
+  std::vector<cudf::column_view> column_views(num_columns);
+  std::transform(columns.begin(), columns.end(), column_views.begin(), [](auto const& col) {
+    return static_cast<cudf::column_view>(col);
+  });
+  cudf::table_view source_table{column_views};
+
+  auto threshold = cudf::numeric_scalar<T>(static_cast<T>(column_size / 100.0 * percent_true));
+  auto column    = cudf::ast::column_reference(0);
+  auto literal   = cudf::ast::literal(threshold);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::LESS, column, literal);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    auto result = cudf::ast::filter(source_table, predicate);
+  }
+
+  calculate_bandwidth<T>(state, num_columns);
+}
+
 template <class T>
 class ApplyBooleanMask : public cudf::benchmark {
  public:
@@ -160,3 +196,14 @@ BENCHMARK_REGISTER_F(ApplyBooleanMask, int16_1_col)->Args({tenM, fifty_percent})
 BENCHMARK_REGISTER_F(ApplyBooleanMask, int32_1_col)->Args({tenM, fifty_percent});
 BENCHMARK_REGISTER_F(ApplyBooleanMask, int64_1_col)->Args({tenM, fifty_percent});
 BENCHMARK_REGISTER_F(ApplyBooleanMask, double_1_col)->Args({tenM, fifty_percent});
+
+#define FILTER_BENCHMARK_DEFINE(name, type, n_columns)                               \
+  BENCHMARK_TEMPLATE_DEFINE_F(ApplyBooleanMask, name, type)(::benchmark::State & st) \
+  {                                                                                  \
+    BM_filter_expression<TypeParam>(st, n_columns);                                  \
+  }
+
+FILTER_BENCHMARK_DEFINE(filter_float_1_col, float, 1);
+FILTER_BENCHMARK_DEFINE(filter_float_4_col, float, 4);
+BENCHMARK_REGISTER_F(ApplyBooleanMask, filter_float_1_col)->Apply(percent_range);
+BENCHMARK_REGISTER_F(ApplyBooleanMask, filter_float_4_col)->Apply(percent_range);
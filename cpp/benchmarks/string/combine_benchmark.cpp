@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_bench_args.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+class StringCombine : public cudf::benchmark {
+};
+
+static void BM_concatenate(benchmark::State& state)
+{
+  cudf::size_type const num_rows = state.range(0);
+  int const mean_words           = state.range(1);
+
+  auto const first  = create_log_lines(num_rows, mean_words);
+  auto const second = create_log_lines(num_rows, mean_words);
+  auto const third  = create_log_lines(num_rows, mean_words);
+  cudf::table_view const input({first->view(), second->view(), third->view()});
+  cudf::string_scalar const separator("|");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::strings::concatenate(input, separator);
+  }
+
+  auto const chars_size = cudf::strings_column_view(first->view()).chars_size() +
+                          cudf::strings_column_view(second->view()).chars_size() +
+                          cudf::strings_column_view(third->view()).chars_size();
+  state.SetBytesProcessed(state.iterations() * chars_size);
+}
+
+BENCHMARK_DEFINE_F(StringCombine, concatenate)(::benchmark::State& state) { BM_concatenate(state); }
+BENCHMARK_REGISTER_F(StringCombine, concatenate)
+  ->Apply(log_line_args)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
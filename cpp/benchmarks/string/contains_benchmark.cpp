@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_bench_args.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/contains.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+class StringContains : public cudf::benchmark {
+};
+
+static void BM_contains_re(benchmark::State& state)
+{
+  cudf::size_type const num_rows = state.range(0);
+  int const mean_words           = state.range(1);
+  auto const tier                = static_cast<regex_tier>(state.range(2));
+
+  auto const lines = create_log_lines(num_rows, mean_words);
+  cudf::strings_column_view const input(lines->view());
+  auto const pattern = regex_pattern(tier);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::strings::contains_re(input, pattern);
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+static void contains_args(benchmark::internal::Benchmark* b)
+{
+  for (int num_rows : {1 << 16, 1 << 20}) {
+    for (int words : {FEW_WORDS, SOME_WORDS, MANY_WORDS}) {
+      for (int tier : {SMALL_PROG, MEDIUM_PROG, LARGE_PROG, GLOBAL_PROG}) {
+        b->Args({num_rows, words, tier});
+      }
+    }
+  }
+}
+
+BENCHMARK_DEFINE_F(StringContains, contains_re)
+(::benchmark::State& state) { BM_contains_re(state); }
+BENCHMARK_REGISTER_F(StringContains, contains_re)
+  ->Apply(contains_args)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
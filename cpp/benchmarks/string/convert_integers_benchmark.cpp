@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <limits>
+
+class StringToIntegers : public cudf::benchmark {
+};
+
+template <typename T>
+static void BM_to_integers(benchmark::State& state)
+{
+  cudf::size_type const num_rows = state.range(0);
+
+  // Full range of values, so that the strings have all the lengths up to the number of digits
+  data_profile profile;
+  profile.set_distribution<T>(distribution_id::UNIFORM,
+                              std::numeric_limits<T>::lowest(),
+                              std::numeric_limits<T>::max());
+  profile.set_null_frequency(0);
+  auto const integers = create_random_column<T>(profile, num_rows);
+  auto const strings  = cudf::strings::from_integers(integers->view());
+  cudf::strings_column_view const input(strings->view());
+  auto const output_type = cudf::data_type(cudf::type_to_id<T>());
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::strings::to_integers(input, output_type);
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+#define TO_INTEGERS_BENCHMARK_DEFINE(name, type)                \
+  BENCHMARK_DEFINE_F(StringToIntegers, name)                    \
+  (::benchmark::State & state) { BM_to_integers<type>(state); } \
+  BENCHMARK_REGISTER_F(StringToIntegers, name)                  \
+    ->RangeMultiplier(1 << 4)                                   \
+    ->Range(1 << 12, 1 << 24)                                   \
+    ->UseManualTime()                                           \
+    ->Unit(benchmark::kMillisecond);
+
+TO_INTEGERS_BENCHMARK_DEFINE(to_int32, int32_t);
+TO_INTEGERS_BENCHMARK_DEFINE(to_int64, int64_t);
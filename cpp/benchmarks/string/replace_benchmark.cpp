@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_bench_args.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/replace.hpp>
+#include <cudf/strings/replace_re.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+class StringReplace : public cudf::benchmark {
+};
+
+static void BM_replace(benchmark::State& state)
+{
+  cudf::size_type const num_rows = state.range(0);
+  int const mean_words           = state.range(1);
+
+  auto const lines = create_log_lines(num_rows, mean_words);
+  cudf::strings_column_view const input(lines->view());
+  cudf::string_scalar const target("timeout");
+  cudf::string_scalar const repl("TIMEOUT");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::strings::replace(input, target, repl);
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+static void BM_replace_re(benchmark::State& state)
+{
+  cudf::size_type const num_rows = state.range(0);
+  int const mean_words           = state.range(1);
+
+  auto const lines = create_log_lines(num_rows, mean_words);
+  cudf::strings_column_view const input(lines->view());
+  cudf::string_scalar const repl("status=5xx");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::strings::replace_re(input, "status=5\\d\\d", repl);
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+BENCHMARK_DEFINE_F(StringReplace, replace)(::benchmark::State& state) { BM_replace(state); }
+BENCHMARK_REGISTER_F(StringReplace, replace)
+  ->Apply(log_line_args)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(StringReplace, replace_re)(::benchmark::State& state) { BM_replace_re(state); }
+BENCHMARK_REGISTER_F(StringReplace, replace_re)
+  ->Apply(log_line_args)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_bench_args.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/split/split.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+class StringSplit : public cudf::benchmark {
+};
+
+enum class split_type { SPLIT, SPLIT_RECORD };
+
+template <split_type Type>
+static void BM_split(benchmark::State& state)
+{
+  cudf::size_type const num_rows = state.range(0);
+  int const mean_words           = state.range(1);
+
+  auto const lines = create_log_lines(num_rows, mean_words);
+  cudf::strings_column_view const input(lines->view());
+  cudf::string_scalar const delimiter(" ");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    if (Type == split_type::SPLIT) {
+      cudf::strings::split(input, delimiter);
+    } else {
+      cudf::strings::split_record(input, delimiter);
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+#define SPLIT_BENCHMARK_DEFINE(name, type)                                                  \
+  BENCHMARK_DEFINE_F(StringSplit, name)(::benchmark::State & state) { BM_split<type>(state); } \
+  BENCHMARK_REGISTER_F(StringSplit, name)                                                     \
+    ->Apply(log_line_args)                                                                    \
+    ->UseManualTime()                                                                         \
+    ->Unit(benchmark::kMillisecond);
+
+SPLIT_BENCHMARK_DEFINE(split, split_type::SPLIT);
+SPLIT_BENCHMARK_DEFINE(split_record, split_type::SPLIT_RECORD);
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/utilities/error.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Mean number of words of the generated log lines, from about 12 to about 200 characters
+ */
+enum log_line_words { FEW_WORDS = 2, SOME_WORDS = 8, MANY_WORDS = 32 };
+
+/**
+ * @brief Creates a strings column of log lines, like "ERROR [db] request failed status=503"
+ *
+ * Each line starts with a level and a component, followed by a number of words uniform in
+ * [1, 2 * `mean_words` - 1]. A quarter of the words are key=value pairs with a numeric value.
+ */
+inline std::unique_ptr<cudf::column> create_log_lines(cudf::size_type num_rows, int mean_words)
+{
+  static std::array<char const*, 4> const levels{"INFO", "WARN", "ERROR", "DEBUG"};
+  static std::array<char const*, 4> const components{"[db]", "[http]", "[auth]", "[cache]"};
+  static std::array<char const*, 12> const words{"request",
+                                                 "completed",
+                                                 "failed",
+                                                 "connection",
+                                                 "timeout",
+                                                 "retry",
+                                                 "from",
+                                                 "client",
+                                                 "session",
+                                                 "opened",
+                                                 "closed",
+                                                 "after"};
+  static std::array<char const*, 4> const keys{"user=", "status=", "latency_ms=", "bytes="};
+
+  auto& engine = deterministic_engine();
+  std::uniform_int_distribution<int> num_words_dist(1, 2 * mean_words - 1);
+  std::uniform_int_distribution<int> value_dist(0, 999);
+  std::vector<std::string> lines(num_rows);
+  for (auto& line : lines) {
+    line = levels[engine() % levels.size()];
+    line += ' ';
+    line += components[engine() % components.size()];
+    auto const num_words = num_words_dist(engine);
+    for (int w = 0; w < num_words; ++w) {
+      line += ' ';
+      if (engine() % 4 == 0) {
+        line += keys[engine() % keys.size()];
+        line += std::to_string(value_dist(engine));
+      } else {
+        line += words[engine() % words.size()];
+      }
+    }
+  }
+  return cudf::test::strings_column_wrapper(lines.begin(), lines.end()).release();
+}
+
+/**
+ * @brief Size of the regex programs, chosen to select each tier of the regex state stack
+ *
+ * The tiers are the programs of up to `RX_SMALL_INSTS`, `RX_MEDIUM_INSTS` and `MAX_STACK_INSTS`
+ * instructions in `regex.cuh`; larger programs keep their state in global memory.
+ */
+enum regex_tier { SMALL_PROG, MEDIUM_PROG, LARGE_PROG, GLOBAL_PROG };
+
+/**
+ * @brief Returns a pattern matching some of the lines of `create_log_lines`, that compiles to a
+ * program of the `tier` size
+ */
+inline std::string regex_pattern(regex_tier tier)
+{
+  // Alternatives that never match extend the program without changing the matches
+  auto alternation = [](int num_alternatives, std::string const& matching) {
+    std::string pattern = "(";
+    for (int i = 0; i < num_alternatives; ++i) {
+      char alternative[8];
+      std::snprintf(alternative, sizeof(alternative), "xq%03d|", i);
+      pattern += alternative;
+    }
+    return pattern + matching + ")";
+  };
+
+  switch (tier) {
+    case SMALL_PROG: return "retry";
+    case MEDIUM_PROG: return "(ERROR|WARN) \\[db\\].*status=5\\d\\d";
+    case LARGE_PROG: return alternation(50, "status=5\\d\\d");
+    case GLOBAL_PROG: return alternation(200, "status=5\\d\\d");
+  }
+  CUDF_FAIL("Unsupported regex tier");
+}
+
+/**
+ * @brief Registers the arguments {num_rows, mean_words} of the string benchmarks
+ */
+inline void log_line_args(benchmark::internal::Benchmark* b)
+{
+  for (int num_rows : {1 << 16, 1 << 20}) {
+    for (int words : {FEW_WORDS, SOME_WORDS, MANY_WORDS}) { b->Args({num_rows, words}); }
+  }
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/sorting.hpp>
 #include <cudf/types.hpp>
 
 #include <functional>
@@ -69,6 +70,11 @@ class aggregation {
     NUNIQUE,         ///< count number of unique elements
     NTH_ELEMENT,     ///< get the nth element
     ROW_NUMBER,      ///< get row-number of element
+    HYPERLOGLOG,     ///< HyperLogLog sketch of the distinct elements
+    APPROX_NUNIQUE,  ///< approximate number of unique elements, from a HyperLogLog sketch
+    TDIGEST,         ///< t-digest of the distribution of the elements
+    APPROX_QUANTILE, ///< approximate quantile(s), from a t-digest
+    RANK,            ///< rank of the element within its group
     PTX,             ///< PTX UDF based reduction
     CUDA             ///< CUDA UDf based reduction
   };
@@ -192,6 +198,94 @@ std::unique_ptr<aggregation> make_nth_element_aggregation(
 /// Factory to create a ROW_NUMBER aggregation
 std::unique_ptr<aggregation> make_row_number_aggregation();
 
+/**
+ * @brief Factory to create a `hyperloglog` aggregation
+ *
+ * `hyperloglog` returns a HyperLogLog sketch of the distinct elements of every
+ * group as a list of `2^precision` UINT8 registers. Sketches of the same
+ * precision can be merged by taking the maximum of every register, e.g. with
+ * `merge_partial_aggregations`.
+ *
+ * A sketch takes `2^precision` bytes, and the relative standard error of the
+ * count it estimates is about `1.04 / sqrt(2^precision)`.
+ *
+ * @param precision Number of bits of the hash of an element that select its
+ * register, in `[4, 18]`
+ * @param null_handling Indicates if null values will be counted.
+ */
+std::unique_ptr<aggregation> make_hyperloglog_aggregation(
+  int precision = 14, null_policy null_handling = null_policy::EXCLUDE);
+
+/**
+ * @brief Factory to create an `approx_nunique` aggregation
+ *
+ * `approx_nunique` returns the number of unique elements estimated from their
+ * HyperLogLog sketch, as INT64, in a single hashing pass over the elements.
+ * Its partial state in `groupby::aggregate_partial` is the sketch.
+ *
+ * @see make_hyperloglog_aggregation()
+ *
+ * @param precision Number of bits of the hash of an element that select its
+ * register, in `[4, 18]`. The default estimates counts within 1%.
+ * @param null_handling Indicates if null values will be counted.
+ */
+std::unique_ptr<aggregation> make_approx_nunique_aggregation(
+  int precision = 14, null_policy null_handling = null_policy::EXCLUDE);
+
+/**
+ * @brief Factory to create a `tdigest` aggregation
+ *
+ * `tdigest` returns a t-digest of the valid values of every group: a list of
+ * at most `max_centroids` centroids in increasing order of their mean, stored
+ * as the FLOAT64 pairs `mean, weight`. Digests are merged by clustering their
+ * centroids again, e.g. with `merge_partial_aggregations`, so that quantiles of
+ * several batches never need all their values at once.
+ *
+ * The centroids are sized on the arcsine scale of the t-digest, so that they
+ * are smallest near the extreme quantiles, which are the most accurate.
+ *
+ * @param max_centroids The maximum number of centroids of a digest, which trades
+ * its size for the accuracy of its quantiles
+ */
+std::unique_ptr<aggregation> make_tdigest_aggregation(int max_centroids = 1000);
+
+/**
+ * @brief Factory to create an `approx_quantile` aggregation
+ *
+ * `approx_quantile` returns the quantiles of the valid values of every group
+ * estimated from their t-digest, as FLOAT64, interpolating linearly between the
+ * centroids. Its partial state in `groupby::aggregate_partial` is the digest.
+ *
+ * @see make_tdigest_aggregation()
+ *
+ * @param quantiles The desired quantiles, in `[0, 1]`
+ * @param max_centroids The maximum number of centroids of the digest
+ */
+std::unique_ptr<aggregation> make_approx_quantile_aggregation(std::vector<double> const& quantiles,
+                                                              int max_centroids = 1000);
+
+/**
+ * @brief Factory to create a `rank` aggregation
+ *
+ * `rank` is a groupby scan that returns the rank of every value among the
+ * values of its group, as `cudf::rank` would on each group on its own. The
+ * result is `size_type`, or FLOAT64 when `method` is `rank_method::AVERAGE` or
+ * `percentage` is true.
+ *
+ * @param method The ranking method used for tie breaking (same values)
+ * @param column_order The desired sort order for ranking
+ * @param null_handling If `null_policy::EXCLUDE`, the rank of a null value is
+ * null and nulls are not counted in percentages
+ * @param null_precedence The desired order of null compared to other elements
+ * @param percentage Convert ranks to percentages of the group in range (0, 1]
+ */
+std::unique_ptr<aggregation> make_rank_aggregation(
+  rank_method method,
+  order column_order         = order::ASCENDING,
+  null_policy null_handling  = null_policy::EXCLUDE,
+  null_order null_precedence = null_order::AFTER,
+  bool percentage            = false);
+
 /**
  * @brief Factory to create an aggregation base on UDF for PTX or CUDA
  *
@@ -205,5 +299,19 @@ std::unique_ptr<aggregation> make_udf_aggregation(udf_type type,
                                                   std::string const& user_defined_aggregator,
                                                   data_type output_type);
 
+/**
+ * @brief Factory to create an aggregation based on a registered PTX or CUDA UDF
+ *
+ * The function is parsed only on its first use by `rolling_window`, and its kernels are reused
+ * from the JIT kernel cache.
+ *
+ * @see cudf::compile_udf
+ *
+ * @param[in] udf The registered aggregator
+ *
+ * @return aggregation unique pointer housing the registered aggregator.
+ */
+std::unique_ptr<aggregation> make_udf_aggregation(std::shared_ptr<compiled_udf const> udf);
+
 /** @} */  // end of group
 }  // namespace cudf
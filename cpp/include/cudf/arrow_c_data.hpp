@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @file arrow_c_data.hpp
+ * @brief Exchange of tables through the Arrow C data interface, without linking Arrow C++.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The structures of the Arrow C data interface and of its device extension, as specified by
+// https://arrow.apache.org/docs/format/CDataInterface.html. The guards allow them to be defined
+// by another header of the same specification.
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+#ifndef ARROW_C_DEVICE_DATA_INTERFACE
+#define ARROW_C_DEVICE_DATA_INTERFACE
+
+typedef int32_t ArrowDeviceType;
+
+#define ARROW_DEVICE_CPU 1
+#define ARROW_DEVICE_CUDA 2
+#define ARROW_DEVICE_CUDA_HOST 3
+#define ARROW_DEVICE_CUDA_MANAGED 13
+
+struct ArrowDeviceArray {
+  // The array, whose buffers are in the memory of the device
+  struct ArrowArray array;
+  int64_t device_id;
+  ArrowDeviceType device_type;
+  // Pointer to a `cudaEvent_t` to wait on before reading the buffers, or NULL
+  void* sync_event;
+  int64_t reserved[3];
+};
+
+#endif  // ARROW_C_DEVICE_DATA_INTERFACE
+
+#ifdef __cplusplus
+}
+#endif
+
+namespace cudf {
+/**
+ * @addtogroup interop_arrow_c_data
+ * @{
+ */
+
+/**
+ * @brief Exports a table through the Arrow C device data interface without copying its data
+ *
+ * The table is exported as an arrow struct array whose children are its columns, named by
+ * `column_names`. The returned array takes ownership of `input`, which is freed once the release
+ * callbacks of the array and of all the children moved out of it have been called, so the
+ * consumer can keep any column alive independently of the others.
+ *
+ * Columns are exported in place, except for BOOL8 columns, whose values are bit-packed into a new
+ * buffer as arrow requires. Dictionary, decimal and `DURATION_DAYS` columns are not supported.
+ *
+ * The function returns once the work on `stream` has completed, so the `sync_event` of the
+ * returned array is NULL and the buffers can be read on any stream.
+ *
+ * @throws cudf::logic_error if a column type is not supported, or if `column_names` is not empty
+ * and its size doesn't match the number of columns
+ *
+ * @param input Table to export
+ * @param schema_out Schema of the table, to be released by the caller
+ * @param array_out Columns of the table, to be released by the caller
+ * @param column_names Names of the columns, or empty for unnamed columns
+ * @param stream CUDA stream on which `input` was produced
+ */
+void to_arrow_device(std::unique_ptr<table> input,
+                     ArrowSchema* schema_out,
+                     ArrowDeviceArray* array_out,
+                     std::vector<std::string> const& column_names = {},
+                     cudaStream_t stream                          = 0);
+
+/**
+ * @brief Exports a copy of a table in host memory through the Arrow C data interface
+ *
+ * All buffers are copied asynchronously into pinned host memory and synchronized once. Columns
+ * with an offset are exported with the same offset rather than compacted.
+ *
+ * @throws cudf::logic_error if a column type is not supported, or if `column_names` is not empty
+ * and its size doesn't match the number of columns
+ *
+ * @param input Table to export
+ * @param schema_out Schema of the table, to be released by the caller
+ * @param array_out Host copy of the columns of the table, to be released by the caller
+ * @param column_names Names of the columns, or empty for unnamed columns
+ * @param stream CUDA stream used for the copies
+ */
+void to_arrow_host(table_view const& input,
+                   ArrowSchema* schema_out,
+                   ArrowArray* array_out,
+                   std::vector<std::string> const& column_names = {},
+                   cudaStream_t stream                          = 0);
+
+/**
+ * @brief Views of the columns of an arrow C device array along with the memory backing them
+ *
+ * The columns of `table` view the buffers of `array` in place, or the buffers of `copied_buffers`
+ * for the arrow buffers that had to be copied. `array` is released when the last copy of it is
+ * destroyed.
+ *
+ * The user is responsible for assuring that `table` or any derived views do not outlive this
+ * object.
+ */
+struct arrow_device_table_view {
+  table_view table;
+  std::shared_ptr<ArrowArray> array;
+  std::vector<rmm::device_buffer> copied_buffers;
+};
+
+/**
+ * @brief Imports a table from the Arrow C device data interface, copying only the buffers that
+ * cannot be used in place
+ *
+ * `input` must be an arrow struct array whose children are the columns of the table. Buffers of
+ * CUDA, CUDA host and CUDA managed memory are viewed in place when they are aligned as cudf
+ * requires; validity bitmaps viewed in place must be padded to a multiple of 4 bytes, as the
+ * specification recommends. Bit-packed booleans and CPU buffers are copied. The offsets of string
+ * columns are read back to size their characters, which synchronizes the stream once per string
+ * column.
+ *
+ * The returned object takes ownership of `input->array`, which is marked released; the schema is
+ * only read and remains owned by the caller.
+ *
+ * @throws cudf::logic_error if `input` is not a struct array, if a format is not supported, or if
+ * the device of `input` is not the current device
+ *
+ * @param schema Schema of the table
+ * @param input Columns of the table
+ * @param mr Device memory resource used to allocate the copied buffers
+ * @return Views of the columns of `input` along with the memory backing them
+ */
+arrow_device_table_view from_arrow_device(
+  ArrowSchema const* schema,
+  ArrowDeviceArray* input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Imports a table in host memory from the Arrow C data interface
+ *
+ * All buffers are copied to device memory, and `input` is released before returning.
+ *
+ * @throws cudf::logic_error if `input` is not a struct array, or if a format is not supported
+ *
+ * @param schema Schema of the table
+ * @param input Columns of the table in host memory
+ * @param mr Device memory resource used to allocate the copied buffers
+ * @return Views of the copied columns along with the memory backing them
+ */
+arrow_device_table_view from_arrow_host(
+  ArrowSchema const* schema,
+  ArrowArray* input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
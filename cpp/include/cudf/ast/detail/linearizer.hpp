@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/types.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace ast {
+namespace detail {
+
+/**
+ * @brief Maximum number of intermediate values of an expression held by a row at once.
+ */
+constexpr int max_stack_depth = 16;
+
+/**
+ * @brief Kinds of instructions of a linearized expression.
+ */
+enum class instruction_kind : int32_t {
+  COLUMN,   ///< Push the value of a column
+  LITERAL,  ///< Push the value of a literal
+  CAST,     ///< Convert a value of the stack to another type
+  UNARY,    ///< Replace the top of the stack by a unary operation on it
+  BINARY    ///< Replace the two values on top of the stack by a binary operation on them
+};
+
+/**
+ * @brief An instruction of a linearized expression.
+ *
+ * An expression is evaluated by running its instructions in order on a stack of values.
+ */
+struct instruction {
+  instruction_kind kind;  ///< Kind of the instruction
+  ast_operator op;        ///< Operator of a `UNARY` or `BINARY` instruction
+  type_id type;           ///< Type of the value the instruction produces
+  type_id operand_type;   ///< Type of the operands of a `CAST`, `UNARY` or `BINARY` instruction
+  size_type index;        ///< Column or literal index, or depth below the top for a `CAST`
+  table_reference table;  ///< Table of a `COLUMN` instruction
+};
+
+/**
+ * @brief Arithmetic representation of a value during the evaluation of an expression.
+ */
+enum class value_class : int32_t { SIGNED, UNSIGNED, FLOATING };
+
+/**
+ * @brief Returns the arithmetic representation of values of a supported type.
+ *
+ * BOOL8, timestamps and durations are represented by their signed integer representation.
+ */
+CUDA_HOST_DEVICE_CALLABLE value_class class_of(type_id id)
+{
+  switch (id) {
+    case type_id::UINT8:
+    case type_id::UINT16:
+    case type_id::UINT32:
+    case type_id::UINT64: return value_class::UNSIGNED;
+    case type_id::FLOAT32:
+    case type_id::FLOAT64: return value_class::FLOATING;
+    default: return value_class::SIGNED;
+  }
+}
+
+/**
+ * @brief Converts an expression tree into a sequence of instructions.
+ *
+ * The nodes of the tree are visited in postorder, which type checks the expression and inserts
+ * the conversions of the operands to their common type.
+ */
+class expression_linearizer {
+ public:
+  /**
+   * @brief Linearizes an expression over two tables.
+   *
+   * @throw cudf::logic_error if the expression is invalid for the tables
+   *
+   * @param expr The expression
+   * @param left The table of the `LEFT` column references
+   * @param right The table of the `RIGHT` column references
+   */
+  expression_linearizer(expression const& expr, table_view const& left, table_view const& right);
+
+  /**
+   * @brief Appends the instruction of a literal.
+   */
+  data_type visit(literal const& expr);
+
+  /**
+   * @brief Appends the instruction of a column reference.
+   */
+  data_type visit(column_reference const& expr);
+
+  /**
+   * @brief Appends the instructions of an operation, after those of its operands.
+   */
+  data_type visit(operation const& expr);
+
+  /**
+   * @brief Returns the type of the value of the expression.
+   */
+  data_type result_type() const { return _result_type; }
+
+  /**
+   * @brief Returns the instructions of the expression.
+   */
+  std::vector<instruction> const& instructions() const { return _instructions; }
+
+  /**
+   * @brief Returns the scalars of the literals, by literal index.
+   */
+  std::vector<std::reference_wrapper<scalar const>> const& literals() const { return _literals; }
+
+ private:
+  void append(instruction const& instr, int stack_change);
+  void cast(type_id from, type_id to, size_type depth);
+
+  table_view _left;
+  table_view _right;
+  data_type _result_type;
+  std::vector<instruction> _instructions;
+  std::vector<std::reference_wrapper<scalar const>> _literals;
+  int _stack_depth{0};
+};
+
+}  // namespace detail
+}  // namespace ast
+}  // namespace cudf
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <functional>
+#include <memory>
+
+/**
+ * @file expressions.hpp
+ * @brief Expression trees evaluated by a single kernel.
+ */
+
+namespace cudf {
+namespace ast {
+namespace detail {
+class expression_linearizer;
+}  // namespace detail
+
+/**
+ * @addtogroup transformation_transform
+ * @{
+ */
+
+/**
+ * @brief Operators of an expression.
+ *
+ * Unless stated otherwise, the result of an operator is null when an operand is null.
+ */
+enum class ast_operator : int32_t {
+  // Binary operators
+  ADD,            ///< operator +
+  SUB,            ///< operator -
+  MUL,            ///< operator *
+  DIV,            ///< operator /, null for an integer division by zero
+  TRUE_DIV,       ///< operator / after converting both operands to FLOAT64
+  MOD,            ///< operator %, null for an integer division by zero
+  POW,            ///< lhs ^ rhs, in FLOAT64
+  EQUAL,          ///< operator ==
+  NOT_EQUAL,      ///< operator !=
+  LESS,           ///< operator <
+  GREATER,        ///< operator >
+  LESS_EQUAL,     ///< operator <=
+  GREATER_EQUAL,  ///< operator >=
+  BITWISE_AND,    ///< operator &
+  BITWISE_OR,     ///< operator |
+  BITWISE_XOR,    ///< operator ^
+  LOGICAL_AND,    ///< operator &&
+  LOGICAL_OR,     ///< operator ||
+  // Unary operators
+  NOT,      ///< operator !
+  ABS,      ///< Absolute value
+  IS_NULL,  ///< true if the operand is null; never null
+};
+
+/**
+ * @brief The table a column reference refers to.
+ *
+ * Expressions over a single table only use `LEFT`.
+ */
+enum class table_reference {
+  LEFT,  ///< Column of the left table
+  RIGHT  ///< Column of the right table
+};
+
+/**
+ * @brief A node of an expression tree.
+ *
+ * Nodes refer to their operands, which must outlive them.
+ */
+class expression {
+ public:
+  virtual ~expression() = default;
+
+  /**
+   * @brief Appends the evaluation of this node to a linearized expression.
+   *
+   * @return The type of the value of this node
+   */
+  virtual data_type accept(detail::expression_linearizer& visitor) const = 0;
+};
+
+/**
+ * @brief A constant of an expression.
+ *
+ * Numeric, BOOL8, timestamp and duration scalars are supported. An invalid scalar is a null.
+ */
+class literal : public expression {
+ public:
+  /**
+   * @brief Constructs a literal referring to `value`.
+   *
+   * @param value The scalar of the literal
+   */
+  literal(scalar const& value) : _value(value) {}
+
+  /**
+   * @brief Returns the scalar of the literal.
+   */
+  scalar const& value() const { return _value.get(); }
+
+  data_type accept(detail::expression_linearizer& visitor) const override;
+
+ private:
+  std::reference_wrapper<scalar const> _value;
+};
+
+/**
+ * @brief A column of the table an expression is evaluated on.
+ *
+ * Numeric, BOOL8, timestamp and duration columns are supported.
+ */
+class column_reference : public expression {
+ public:
+  /**
+   * @brief Constructs a reference to a column.
+   *
+   * @param column_index Index of the column in its table
+   * @param table The table of the column
+   */
+  column_reference(size_type column_index, table_reference table = table_reference::LEFT)
+    : _column_index(column_index), _table(table)
+  {
+  }
+
+  /**
+   * @brief Returns the index of the column in its table.
+   */
+  size_type column_index() const { return _column_index; }
+
+  /**
+   * @brief Returns the table of the column.
+   */
+  table_reference table() const { return _table; }
+
+  data_type accept(detail::expression_linearizer& visitor) const override;
+
+ private:
+  size_type _column_index;
+  table_reference _table;
+};
+
+/**
+ * @brief An operator applied to one or two expressions.
+ *
+ * Operands of arithmetic, bitwise and comparison operators are converted to their common type:
+ * the wider of the two types, floating-point over integer and unsigned over signed on ties.
+ * Arithmetic and bitwise operators return that type, and comparison and logical operators return
+ * BOOL8. Timestamps and durations may only be compared to the same type.
+ */
+class operation : public expression {
+ public:
+  /**
+   * @brief Constructs a unary operation.
+   *
+   * @throw cudf::logic_error if `op` is not a unary operator
+   *
+   * @param op The unary operator
+   * @param input The operand
+   */
+  operation(ast_operator op, expression const& input);
+
+  /**
+   * @brief Constructs a binary operation.
+   *
+   * @throw cudf::logic_error if `op` is not a binary operator
+   *
+   * @param op The binary operator
+   * @param lhs The left operand
+   * @param rhs The right operand
+   */
+  operation(ast_operator op, expression const& lhs, expression const& rhs);
+
+  /**
+   * @brief Returns the operator.
+   */
+  ast_operator op() const { return _op; }
+
+  /**
+   * @brief Returns the operands.
+   */
+  std::vector<std::reference_wrapper<expression const>> const& operands() const
+  {
+    return _operands;
+  }
+
+  data_type accept(detail::expression_linearizer& visitor) const override;
+
+ private:
+  ast_operator _op;
+  std::vector<std::reference_wrapper<expression const>> _operands;
+};
+
+/**
+ * @brief Evaluates an expression on every row of a table.
+ *
+ * The whole expression is evaluated by one kernel, which keeps the intermediate values of a row
+ * on the stack of its thread. A BOOL8 expression can filter the table with
+ * `cudf::apply_boolean_mask`.
+ *
+ * @code{.pseudo}
+ * (a * b + c) > d AND e IS NOT NULL:
+ * auto a      = column_reference(0);
+ * ...
+ * auto e      = column_reference(4);
+ * auto ab     = operation(ast_operator::MUL, a, b);
+ * auto abc    = operation(ast_operator::ADD, ab, c);
+ * auto cmp    = operation(ast_operator::GREATER, abc, d);
+ * auto e_null = operation(ast_operator::IS_NULL, e);
+ * auto e_ok   = operation(ast_operator::NOT, e_null);
+ * auto expr   = operation(ast_operator::LOGICAL_AND, cmp, e_ok);
+ * auto result = compute_column(table, expr);
+ * @endcode
+ *
+ * @throw cudf::logic_error if the expression refers to a column out of range or of an
+ * unsupported type, or applies an operator to unsupported types
+ * @throw cudf::logic_error if the expression is nested too deeply
+ *
+ * @param table The table the column references of the expression refer to
+ * @param expr The expression
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The value of the expression for every row of `table`
+ */
+std::unique_ptr<column> compute_column(
+  table_view const& table,
+  expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Evaluates an expression on pairs of rows of two tables, e.g. as the condition of a join.
+ *
+ * Row `i` of the result evaluates the expression on row `left_indices[i]` of `left` and row
+ * `right_indices[i]` of `right`, such as the gather maps of `cudf::inner_join_indices`. Filtering
+ * the maps with the result applies the condition to the join. A negative index, such as
+ * `cudf::join_no_match`, makes the columns of its table null.
+ *
+ * @throw cudf::logic_error if the indices are not non-nullable INT32 columns of the same size
+ * @throw cudf::logic_error under the same conditions as the single table overload
+ *
+ * @param left The table of the `LEFT` column references
+ * @param right The table of the `RIGHT` column references
+ * @param left_indices The rows of `left`
+ * @param right_indices The rows of `right`
+ * @param expr The expression
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The value of the expression for every pair of rows
+ */
+std::unique_ptr<column> compute_column(
+  table_view const& left,
+  table_view const& right,
+  column_view const& left_indices,
+  column_view const& right_indices,
+  expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Filters a table by a predicate expression.
+ *
+ * Keeps the rows for which `predicate` is true and not null, in their order. Unlike evaluating
+ * the predicate with `compute_column` and filtering with `cudf::apply_boolean_mask`, no BOOL8
+ * column is materialized: the predicate is evaluated once into a bitmask, which the compaction
+ * of every column reads.
+ *
+ * @throw cudf::logic_error if `predicate` is not a BOOL8 expression
+ * @throw cudf::logic_error under the same conditions as `compute_column`
+ *
+ * @param input The table to filter, which the column references of `predicate` refer to
+ * @param predicate The BOOL8 expression of the rows to keep
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The rows of `input` which satisfy `predicate`
+ */
+std::unique_ptr<table> filter(
+  table_view const& input,
+  expression const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace ast
+}  // namespace cudf
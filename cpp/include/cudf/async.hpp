@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * @file async.hpp
+ * @brief Variants of libcudf operations which return before their result is ready.
+ */
+
+namespace cudf {
+/**
+ * @addtogroup utility_async
+ * @{
+ */
+
+/**
+ * @brief Handle to the result of an operation running asynchronously on a stream.
+ *
+ * The operations need the sizes of their outputs on the host to allocate them, so they wait for
+ * their stream at times. An asynchronous variant runs the operation on a host thread of its own,
+ * which does the waiting, so that the calling thread can start independent operations on other
+ * streams meanwhile.
+ *
+ * Destroying a handle whose result was not retrieved waits for the operation to complete.
+ *
+ * @tparam T Type of the result of the operation
+ */
+template <typename T>
+class async_result {
+ public:
+  /**
+   * @brief Constructs a handle to the result of an operation running on `stream`.
+   *
+   * @param result The future of the host thread of the operation
+   * @param stream The stream of the operation
+   */
+  async_result(std::future<T>&& result, cudaStream_t stream)
+    : _result(std::move(result)), _stream(stream)
+  {
+  }
+
+  /**
+   * @brief Returns the stream of the operation.
+   */
+  cudaStream_t stream() const { return _stream; }
+
+  /**
+   * @brief Returns true if the result can be retrieved without waiting.
+   *
+   * May only be called before `get`.
+   */
+  bool is_ready() const
+  {
+    return _result.wait_for(std::chrono::seconds(0)) == std::future_status::ready and
+           cudaStreamQuery(_stream) == cudaSuccess;
+  }
+
+  /**
+   * @brief Waits for the operation and returns its result.
+   *
+   * The result may be read from any stream once `get` returns. May only be called once.
+   *
+   * @throw Any exception thrown by the operation
+   */
+  T get()
+  {
+    auto result = _result.get();
+    CUDA_TRY(cudaStreamSynchronize(_stream));
+    return result;
+  }
+
+ private:
+  std::future<T> _result;
+  cudaStream_t _stream;
+};
+
+namespace detail {
+/**
+ * @brief Calls `f` on a new host thread, on the device of the calling thread.
+ *
+ * @param stream The stream `f` runs its work on
+ * @param f The operation
+ * @return The handle to the result of `f`
+ */
+template <typename Function>
+auto launch_async(cudaStream_t stream, Function&& f) -> async_result<decltype(f())>
+{
+  int device{-1};
+  CUDA_TRY(cudaGetDevice(&device));
+  auto result = std::async(std::launch::async, [device, f = std::forward<Function>(f)]() mutable {
+    CUDA_TRY(cudaSetDevice(device));
+    return f();
+  });
+  return async_result<decltype(f())>{std::move(result), stream};
+}
+}  // namespace detail
+
+/**
+ * @brief Asynchronous variant of `cudf::io::read_parquet`.
+ *
+ * Operations run concurrently only if their streams differ and are not the default stream.
+ * The arguments are copied, but the sources and the buffers they refer to must outlive the
+ * operation.
+ *
+ * @param args Settings for controlling reading behavior
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the table in the result
+ * @return The handle to the set of columns and the metadata read
+ */
+async_result<io::table_with_metadata> read_parquet_async(
+  io::read_parquet_args const& args,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Asynchronous variant of `cudf::io::read_orc`.
+ *
+ * @copydetails cudf::read_parquet_async
+ */
+async_result<io::table_with_metadata> read_orc_async(
+  io::read_orc_args const& args,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Asynchronous variant of `cudf::io::read_csv`.
+ *
+ * @copydetails cudf::read_parquet_async
+ */
+async_result<io::table_with_metadata> read_csv_async(
+  io::read_csv_args const& args,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Asynchronous variant of `cudf::inner_join`.
+ *
+ * The data of `left` and `right` must not be modified or freed until the result is retrieved.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param left_on The column indices from `left` to join on
+ * @param right_on The column indices from `right` to join on
+ * @param columns_in_common The pairs of columns of `left_on` and `right_on` returned once
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The handle to the result of the join
+ */
+async_result<std::unique_ptr<table>> inner_join_async(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  null_equality compare_nulls,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Asynchronous variant of `cudf::sort`.
+ *
+ * The data of `input` must not be modified or freed until the result is retrieved.
+ *
+ * @param input The table to sort
+ * @param column_order The desired order for each column, ascending for all if empty
+ * @param null_precedence The desired order of nulls for each column, before for all if empty
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The handle to the sorted table
+ */
+async_result<std::unique_ptr<table>> sort_async(
+  table_view const& input,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Asynchronous variant of `cudf::contiguous_split`.
+ *
+ * The data of `input` must not be modified or freed until the result is retrieved.
+ *
+ * @param input View of a table to split
+ * @param splits The row indices where the table is split
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the device memory of the result
+ * @return The handle to the split tables and their buffers
+ */
+async_result<std::vector<contiguous_split_result>> contiguous_split_async(
+  table_view const& input,
+  std::vector<size_type> const& splits,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Asynchronous variant of `cudf::groupby::groupby::aggregate`.
+ *
+ * `grouper`, `requests` and the data they refer to must not be used, modified or freed until the
+ * result is retrieved.
+ *
+ * @param grouper The groupby of the keys
+ * @param requests The set of columns to aggregate and the aggregations to perform
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the device memory of the result
+ * @return The handle to the unique keys and the results of the aggregations
+ */
+async_result<std::pair<std::unique_ptr<table>, std::vector<groupby::aggregation_result>>>
+aggregate_async(groupby::groupby& grouper,
+                std::vector<groupby::aggregation_request> const& requests,
+                cudaStream_t stream,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
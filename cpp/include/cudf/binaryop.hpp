@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/indexed_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 
 #include <memory>
@@ -147,6 +148,30 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Performs a binary operation between the rows of two columns selected by indices.
+ *
+ * Returns the same result as `binary_operation(lhs.materialize()->view(),
+ * rhs.materialize()->view(), op, output_type)`. The operations between fixed-width columns of the
+ * same type with a precompiled kernel read the selected rows in place through the indices; the
+ * other operations gather them first.
+ *
+ * @param lhs         The rows of the left operand column
+ * @param rhs         The rows of the right operand column
+ * @param output_type The desired data type of the output column
+ * @param mr          Device memory resource used to allocate the returned column's device memory
+ * @return            Output column of `output_type` type containing the result of
+ *                    the binary operation
+ * @throw cudf::logic_error if @p lhs and @p rhs are different sizes
+ * @throw cudf::logic_error if @p output_type dtype isn't fixed-width
+ */
+std::unique_ptr<column> binary_operation(
+  indexed_column_view const& lhs,
+  indexed_column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Performs a binary operation between two columns using a
  * user-defined PTX function.
@@ -176,5 +201,67 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Performs a binary operation between two columns using a registered
+ * user-defined PTX or CUDA function.
+ *
+ * Like the overload taking the PTX as a string, but the function is parsed only on its first
+ * use, and its kernels are reused from the JIT kernel cache.
+ *
+ * @see cudf::compile_udf
+ *
+ * @param lhs         The left operand column
+ * @param rhs         The right operand column
+ * @param udf         The registered binary function
+ * @param mr          Device memory resource used to allocate the returned column's device memory
+ * @return            Output column of `udf.output_type()` type containing the result of
+ *                    the binary operation
+ * @throw cudf::logic_error if @p lhs and @p rhs are different sizes
+ * @throw cudf::logic_error if @p lhs, @p rhs or the output of @p udf aren't fixed-width, or are
+ * INT8 for a PTX function
+ */
+std::unique_ptr<column> binary_operation(
+  column_view const& lhs,
+  column_view const& rhs,
+  compiled_udf const& udf,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Compiles the kernels of `binary_operation` for the given types and operator without
+ * running them.
+ *
+ * The first `binary_operation` on a combination of types and operator JIT compiles its kernel.
+ * Calling this ahead of time, e.g. at startup, moves that cost out of the first query, for the
+ * column-column, column-scalar and scalar-column forms. The compiled kernels can be written to a
+ * bundle with `cudf::jit::write_kernel_bundle` and loaded by other processes.
+ *
+ * Operations between two string columns are not JIT compiled and are ignored.
+ *
+ * @param lhs_type    The data type of the left operand
+ * @param rhs_type    The data type of the right operand
+ * @param op          The binary operator
+ * @param output_type The data type of the output
+ * @throw cudf::logic_error if @p lhs_type, @p rhs_type or @p output_type isn't fixed-width
+ */
+void precompile_binary_operation(data_type lhs_type,
+                                 data_type rhs_type,
+                                 binary_operator op,
+                                 data_type output_type);
+
+/**
+ * @brief Compiles the kernel of `binary_operation` with a user-defined PTX function for the given
+ * types without running it.
+ *
+ * @param lhs_type    The data type of the left operand
+ * @param rhs_type    The data type of the right operand
+ * @param ptx         String containing the PTX of a binary function
+ * @param output_type The data type of the output
+ * @throw cudf::logic_error if @p lhs_type, @p rhs_type or @p output_type isn't numeric
+ */
+void precompile_binary_operation(data_type lhs_type,
+                                 data_type rhs_type,
+                                 std::string const& ptx,
+                                 data_type output_type);
+
 /** @} */  // end of group
 }  // namespace cudf
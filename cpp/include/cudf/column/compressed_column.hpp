@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstdint>
+#include <memory>
+
+/**
+ * @file compressed_column.hpp
+ * @brief Integer columns compressed in device memory, e.g. to cache more of them.
+ */
+
+namespace cudf {
+/**
+ * @addtogroup compressed_classes
+ * @{
+ */
+
+/**
+ * @brief The cascade of encodings of a `compressed_column`
+ */
+enum class cascade_scheme : int8_t {
+  BITPACK,            ///< The values are bitpacked
+  DELTA_BITPACK,      ///< The differences of consecutive values are bitpacked
+  RLE_BITPACK,        ///< The values and lengths of the runs of equal values are bitpacked
+  RLE_DELTA_BITPACK,  ///< The differences of consecutive run values, and run lengths, are bitpacked
+};
+
+/**
+ * @brief Unsigned 64-bit integers bitpacked relative to their minimum
+ *
+ * Integer `i` is `reference` plus the `bit_width` bits of `words` starting at bit
+ * `i * bit_width`, bit 0 being the least significant bit of the first 64-bit word.
+ */
+struct packed_integers {
+  std::uint64_t reference{0};  ///< The smallest integer
+  int32_t bit_width{0};        ///< The number of bits of every integer, from 0 to 64
+  size_type size{0};           ///< The number of integers
+  rmm::device_buffer words;    ///< The 64-bit words of the packed bits
+};
+
+/**
+ * @brief An integer column compressed by a cascade of delta, run-length and bitpacking encodings
+ *
+ * The values are first mapped to unsigned 64-bit keys preserving their order, the values of null
+ * elements being replaced by the smallest valid value. Depending on `scheme`, runs of equal keys
+ * are replaced by their keys and lengths, and keys are replaced by the differences of consecutive
+ * keys, as signed 64-bit integers mapped to keys. The remaining keys are bitpacked.
+ *
+ * A `BITPACK` column can be gathered, filtered and reduced without being decompressed, as its
+ * elements are accessed directly. The other schemes are decompressed first.
+ */
+struct compressed_column {
+  data_type type{type_id::EMPTY};  ///< The type of the column
+  size_type size{0};               ///< The number of elements
+  size_type null_count{0};         ///< The number of null elements
+  cascade_scheme scheme{cascade_scheme::BITPACK};
+  std::uint64_t delta_base{0};   ///< With delta encoding, the first key
+  packed_integers values;        ///< The keys, run keys, or their differences
+  packed_integers run_lengths;   ///< With run-length encoding, the lengths of the runs
+  rmm::device_buffer null_mask;  ///< The null mask, empty without nulls
+
+  /**
+   * @brief Returns the device memory of the compressed column, in bytes.
+   */
+  std::size_t compressed_size() const
+  {
+    return values.words.size() + run_lengths.words.size() + null_mask.size();
+  }
+};
+
+/**
+ * @brief Compresses a column with the cascade of encodings giving the smallest size.
+ *
+ * @throw cudf::logic_error if `input` is not of an integer type
+ *
+ * @param input The column to compress
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The compressed column
+ */
+std::unique_ptr<compressed_column> compress(
+  column_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Compresses a column with the given cascade of encodings.
+ *
+ * @throw cudf::logic_error if `input` is not of an integer type
+ *
+ * @param input The column to compress
+ * @param scheme The encodings to use
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The compressed column
+ */
+std::unique_ptr<compressed_column> compress(
+  column_view const& input,
+  cascade_scheme scheme,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Decompresses a compressed column.
+ *
+ * @param input The compressed column
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The decompressed column
+ */
+std::unique_ptr<column> decompress(
+  compressed_column const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Gathers the rows of a compressed column into a decompressed column.
+ *
+ * Only the gathered rows of a `BITPACK` column are decompressed.
+ *
+ * @throw cudf::logic_error if `gather_map` is not a non-nullable INT32 column
+ *
+ * @param input The compressed column
+ * @param gather_map The indices of the gathered rows, which must be in `[0, input.size)`
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Column of the gathered rows
+ */
+std::unique_ptr<column> gather(
+  compressed_column const& input,
+  column_view const& gather_map,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Filters the rows of a compressed column into a decompressed column.
+ *
+ * Only the rows of a `BITPACK` column that pass the filter are decompressed.
+ *
+ * @throw cudf::logic_error if `boolean_mask` is not a BOOL8 column of `input.size` rows
+ *
+ * @param input The compressed column
+ * @param boolean_mask The rows to keep, those where it is valid and `true`
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Column of the rows that pass the filter
+ */
+std::unique_ptr<column> apply_boolean_mask(
+  compressed_column const& input,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Reduces a compressed column, as `cudf::reduce` does.
+ *
+ * The MIN and MAX of a `BITPACK` column into its own type, and its SUM into INT64 for a signed
+ * type or UINT64 for an unsigned type, are computed without decompressing it. Other reductions
+ * decompress the column first.
+ *
+ * @param input The compressed column
+ * @param agg The reduction
+ * @param output_dtype The type of the result
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return The result of the reduction, not valid if all the elements are null
+ */
+std::unique_ptr<scalar> reduce(
+  compressed_column const& input,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+
+/**
+ * @file indexed_column_view.hpp
+ * @brief Views of the rows of columns and tables selected by an index vector.
+ */
+
+namespace cudf {
+/**
+ * @addtogroup column_classes
+ * @{
+ */
+
+/**
+ * @brief A non-owning view of the rows of a column selected by an optional vector of indices
+ *
+ * Row `i` of the view is row `indices[i]` of `parent`, or row `i` of `parent` without indices.
+ * The result of a filter or of a join can be kept as the indices of its rows, and passed to the
+ * operations that read the selected rows in place, through the indices, instead of gathering
+ * them into a new column first:
+ *
+ * - `cudf::reduce` for the `SUM`, `PRODUCT`, `MIN`, `MAX`, `SUM_OF_SQUARES`, `ANY` and `ALL`
+ *   aggregations
+ * - `cudf::binary_operation` between fixed-width columns for operators with a precompiled kernel
+ * - `cudf::hash` with the `HASH_MURMUR3`, `HASH_SPARK_MURMUR3` and `HASH_XXHASH64` functions
+ *
+ * The other operations gather the selected rows with `materialize()` first.
+ *
+ * The indices are not checked against the size of `parent`: an index outside
+ * `[0, parent.size())` results in undefined behavior.
+ */
+class indexed_column_view {
+ public:
+  indexed_column_view()                           = default;
+  ~indexed_column_view()                          = default;
+  indexed_column_view(indexed_column_view const&) = default;
+  indexed_column_view(indexed_column_view&&)      = default;
+  indexed_column_view& operator=(indexed_column_view const&) = default;
+  indexed_column_view& operator=(indexed_column_view&&) = default;
+
+  /**
+   * @brief Constructs a view of all the rows of a column, in order.
+   *
+   * @param parent The column
+   */
+  indexed_column_view(column_view const& parent);
+
+  /**
+   * @brief Constructs a view of the rows of `parent` selected by `indices`.
+   *
+   * @throw cudf::logic_error if `indices` is not a non-nullable INT32 column
+   *
+   * @param parent The column
+   * @param indices The indices into `parent` of the rows of the view
+   */
+  indexed_column_view(column_view const& parent, column_view const& indices);
+
+  /**
+   * @brief Returns the column the rows are selected from.
+   */
+  column_view parent() const noexcept { return _parent; }
+
+  /**
+   * @brief Returns the indices of the rows, an empty column if there are none.
+   */
+  column_view indices() const noexcept { return _indices; }
+
+  /**
+   * @brief Returns whether the rows are selected by indices.
+   */
+  bool has_indices() const noexcept { return _has_indices; }
+
+  /**
+   * @brief Returns the type of the rows.
+   */
+  data_type type() const noexcept { return _parent.type(); }
+
+  /**
+   * @brief Returns the number of rows of the view.
+   */
+  size_type size() const noexcept { return _has_indices ? _indices.size() : _parent.size(); }
+
+  /**
+   * @brief Gathers the rows of the view into a new column.
+   *
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return The rows of the view
+   */
+  std::unique_ptr<column> materialize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  column_view _parent{};
+  column_view _indices{};
+  bool _has_indices{false};
+};
+
+/**
+ * @brief A non-owning view of the rows of a table selected by an optional vector of indices
+ *
+ * Every column of the view is an `indexed_column_view` of a column of `table` with the same
+ * indices.
+ */
+class indexed_table_view {
+ public:
+  indexed_table_view()                          = default;
+  ~indexed_table_view()                         = default;
+  indexed_table_view(indexed_table_view const&) = default;
+  indexed_table_view(indexed_table_view&&)      = default;
+  indexed_table_view& operator=(indexed_table_view const&) = default;
+  indexed_table_view& operator=(indexed_table_view&&) = default;
+
+  /**
+   * @brief Constructs a view of all the rows of a table, in order.
+   *
+   * @param table The table
+   */
+  indexed_table_view(table_view const& table);
+
+  /**
+   * @brief Constructs a view of the rows of `table` selected by `indices`.
+   *
+   * @throw cudf::logic_error if `indices` is not a non-nullable INT32 column
+   *
+   * @param table The table
+   * @param indices The indices into `table` of the rows of the view
+   */
+  indexed_table_view(table_view const& table, column_view const& indices);
+
+  /**
+   * @brief Returns the table the rows are selected from.
+   */
+  table_view table() const noexcept { return _table; }
+
+  /**
+   * @brief Returns the indices of the rows, an empty column if there are none.
+   */
+  column_view indices() const noexcept { return _indices; }
+
+  /**
+   * @brief Returns whether the rows are selected by indices.
+   */
+  bool has_indices() const noexcept { return _has_indices; }
+
+  /**
+   * @brief Returns the number of columns.
+   */
+  size_type num_columns() const noexcept { return _table.num_columns(); }
+
+  /**
+   * @brief Returns the number of rows of the view.
+   */
+  size_type num_rows() const noexcept
+  {
+    return _has_indices ? _indices.size() : _table.num_rows();
+  }
+
+  /**
+   * @brief Returns a view of the selected rows of the column `column_index`.
+   */
+  indexed_column_view column(size_type column_index) const
+  {
+    return _has_indices ? indexed_column_view{_table.column(column_index), _indices}
+                        : indexed_column_view{_table.column(column_index)};
+  }
+
+  /**
+   * @brief Gathers the rows of the view into a new table.
+   *
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The rows of the view
+   */
+  std::unique_ptr<cudf::table> materialize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  table_view _table{};
+  column_view _indices{};
+  bool _has_indices{false};
+};
+
+/** @} */  // end of group
+}  // namespace cudf
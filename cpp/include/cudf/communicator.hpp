@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace cudf {
+/**
+ * @addtogroup column_join
+ * @{
+ */
+
+/**
+ * @brief Point-to-point transport between the processes, or ranks, of a distributed operation.
+ *
+ * libcudf has no dependency on a communication library; applications implement this interface on
+ * top of the one they use, e.g. NCCL or UCX, with one rank per GPU.
+ *
+ * Transfers are non-blocking: `send` and `recv` start a transfer of device memory and return a
+ * `request` to poll or wait for its completion. A transfer is ordered after the work submitted to
+ * `stream` before the call. The messages sent from one rank to another with the same tag are
+ * received in the order they were sent. The buffer of a transfer must stay valid, and must not be
+ * modified, until its request completed.
+ */
+class communicator {
+ public:
+  /**
+   * @brief Handle on a transfer in progress
+   */
+  class request {
+   public:
+    virtual ~request() = default;
+
+    /**
+     * @brief Returns whether the transfer completed, without blocking
+     */
+    virtual bool test() = 0;
+
+    /**
+     * @brief Blocks until the transfer completed
+     */
+    virtual void wait() = 0;
+  };
+
+  virtual ~communicator() = default;
+
+  /**
+   * @brief Returns the index of this rank, in `[0, size())`
+   */
+  virtual int rank() const = 0;
+
+  /**
+   * @brief Returns the number of ranks
+   */
+  virtual int size() const = 0;
+
+  /**
+   * @brief Starts sending `size` bytes of device memory at `data` to rank `peer`.
+   *
+   * @param data Device memory to send
+   * @param size Number of bytes to send, never zero
+   * @param peer Rank receiving the message
+   * @param tag Tag matching the message with a `recv` of `peer`
+   * @param stream CUDA stream after whose work the transfer starts
+   */
+  virtual std::unique_ptr<request> send(
+    void const* data, std::size_t size, int peer, int tag, cudaStream_t stream) = 0;
+
+  /**
+   * @brief Starts receiving `size` bytes sent by rank `peer` into the device memory at `data`.
+   *
+   * @param data Device memory receiving the message
+   * @param size Number of bytes to receive, never zero
+   * @param peer Rank sending the message
+   * @param tag Tag matching the message with a `send` of `peer`
+   * @param stream CUDA stream after whose work the transfer starts
+   */
+  virtual std::unique_ptr<request> recv(
+    void* data, std::size_t size, int peer, int tag, cudaStream_t stream) = 0;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
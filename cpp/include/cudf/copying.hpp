@@ -22,6 +22,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -57,13 +58,75 @@ namespace cudf {
  * @param[in] check_bounds Optionally perform bounds checking on the values
  * of `gather_map` and throw an error if any of its values are out of bounds.
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  * @return std::unique_ptr<table> Result of the gather
  */
 std::unique_ptr<table> gather(
   table_view const& source_table,
   column_view const& gather_map,
   bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief A gather map prepared once to gather the rows of many tables with the same number of
+ * rows.
+ *
+ * @ingroup copy_gather
+ *
+ * The gather map is validated, and its negative indices are converted, when the plan is built
+ * instead of on every gather. Each gather then copies the rows of all the fixed-width columns of
+ * the source table with a single kernel, and all their null masks with another. The other
+ * columns are gathered one at a time as by `cudf::gather`.
+ *
+ * @code{.pseudo}
+ * plan = gather_plan(join_indices, batch_rows)
+ * for batch in batches:
+ *   output = plan.gather(batch)
+ * @endcode
+ */
+class gather_plan {
+ public:
+  gather_plan()                   = delete;
+  gather_plan(gather_plan const&) = delete;
+  gather_plan& operator=(gather_plan const&) = delete;
+  ~gather_plan();
+
+  /**
+   * @brief Prepares `gather_map` to gather the rows of tables of `source_rows` rows.
+   *
+   * A negative value `i` in the `gather_map` is interpreted as `i+n`, where `n` is
+   * `source_rows`. The gathered rows of the indices outside the range `[-n, n)` are null when
+   * `check_bounds == false`.
+   *
+   * @throws cudf::logic_error if `gather_map` is not integral or has nulls.
+   * @throws cudf::logic_error if `check_bounds == true` and an index of `gather_map` is outside
+   * the range `[-n, n)`.
+   *
+   * @param gather_map View into a non-nullable column of integral indices that maps the rows in
+   * the source columns to rows in the destination columns
+   * @param source_rows The number of rows of the tables to gather from
+   * @param check_bounds Whether to throw if an index is out of bounds
+   */
+  gather_plan(column_view const& gather_map, size_type source_rows, bool check_bounds = false);
+
+  /**
+   * @brief Gathers the rows of `source_table` according to the gather map of the plan.
+   *
+   * @throws cudf::logic_error if `source_table` does not have the number of rows of the plan.
+   *
+   * @param source_table The input columns whose rows will be gathered
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return Result of the gather
+   */
+  std::unique_ptr<table> gather(
+    table_view const& source_table,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  struct gather_plan_impl;
+  std::unique_ptr<gather_plan_impl> impl;
+};
 
 /**
  * @brief Scatters the rows of the source table into a copy of the target table
@@ -100,6 +163,7 @@ std::unique_ptr<table> gather(
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
  * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return Result of scattering values from source to target
  */
 std::unique_ptr<table> scatter(
@@ -107,7 +171,8 @@ std::unique_ptr<table> scatter(
   column_view const& scatter_map,
   table_view const& target,
   bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Scatters a row of scalar values into a copy of the target table
@@ -140,6 +205,7 @@ std::unique_ptr<table> scatter(
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
  * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return Result of scattering values from source to target
  */
 std::unique_ptr<table> scatter(
@@ -147,7 +213,8 @@ std::unique_ptr<table> scatter(
   column_view const& indices,
   table_view const& target,
   bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Indicates when to allocate a mask, based on an existing mask.
@@ -486,6 +553,65 @@ std::vector<contiguous_split_result> contiguous_split(
   std::vector<size_type> const& splits,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief The result of a `pack`
+ *
+ * @ingroup copy_split
+ *
+ * All the device memory of the packed columns is in the single buffer `gpu_data`, and their
+ * types, sizes, null counts and the offsets of their buffers in `gpu_data` are in the host
+ * buffer `metadata`. Both can be sent as they are and unpacked elsewhere by `unpack`.
+ */
+struct packed_columns {
+  std::unique_ptr<std::vector<uint8_t>> metadata;
+  std::unique_ptr<rmm::device_buffer> gpu_data;
+};
+
+/**
+ * @brief Deep-copies a `table_view` into a single contiguous device buffer and describes its
+ * layout in a host metadata buffer.
+ *
+ * @ingroup copy_split
+ *
+ * Every buffer of the columns and their children is copied to an offset of `gpu_data` aligned to
+ * 64 bytes. Sliced columns are copied so that the packed buffers start at their first row.
+ *
+ * @throws cudf::logic_error if a STRUCT column of `input` or one of its children has a nonzero
+ * offset.
+ *
+ * @param input View of the table to pack
+ * @param[in] mr Device memory resource used to allocate the returned device buffer
+ * @return The metadata and the device memory of the packed table
+ */
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a view of a table packed by `pack`.
+ *
+ * @ingroup copy_split
+ *
+ * No memory is copied: the returned views point into `input.gpu_data`, which must outlive them.
+ *
+ * @param input The packed table
+ * @return View of the packed table
+ */
+table_view unpack(packed_columns const& input);
+
+/**
+ * @brief Returns a view of a table packed by `pack` from its metadata and device buffers.
+ *
+ * @ingroup copy_split
+ *
+ * The buffers may have been sent elsewhere after packing, such as to another process or device.
+ * No memory is copied: the returned views point into `gpu_data`, which must outlive them.
+ *
+ * @param metadata The host metadata buffer of the packed table
+ * @param gpu_data The device buffer of the packed table
+ * @return View of the packed table
+ */
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
+
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -620,6 +746,35 @@ std::unique_ptr<column> copy_if_else(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief   Returns a new table, where each row is selected from either @p lhs or
+ *          @p rhs based on the value of the corresponding element in @p boolean_mask
+ *
+ * Selects each element `i` of every output column `c` using the following rule:
+ * `output[c][i] = (boolean_mask.valid(i) and boolean_mask[i]) ? lhs[c][i] : rhs[c][i]`
+ *
+ * Equivalent to calling `copy_if_else` on every pair of columns, but the mask is read once for
+ * the whole table and all fixed-width columns are selected by a single kernel.
+ *
+ * @throws cudf::logic_error if lhs and rhs do not have the same number of columns
+ * @throws cudf::logic_error if the columns of lhs and rhs are not of the same types
+ * @throws cudf::logic_error if lhs and rhs are not of the same length
+ * @throws cudf::logic_error if boolean mask is not of type bool
+ * @throws cudf::logic_error if boolean mask is not of the same length as lhs and rhs
+ * @param[in] lhs left-hand table_view
+ * @param[in] rhs right-hand table_view
+ * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
+ * boolean for each row. Null element represents false.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns new table with the selected rows
+ */
+std::unique_ptr<table> copy_if_else(
+  table_view const& lhs,
+  table_view const& rhs,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Scatters rows from the input table to rows of the output corresponding
  * to true values in a boolean mask.
@@ -717,6 +872,47 @@ std::unique_ptr<scalar> get_element(
   size_type index,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Get the elements at specified indices from a column
+ *
+ * Returns the same scalars as calling `get_element` for each index, without its launch and
+ * synchronization per element: the elements of a fixed-width column are copied into their
+ * scalars by a single kernel, and the strings of a strings column are located by a single kernel
+ * and device-to-host copy. Each scalar still owns its device memory. The elements of other
+ * columns are read one at a time.
+ *
+ * @throws cudf::logic_error if an index is not within the range `[0, input.size())`
+ *
+ * @param input Column view to get the elements from
+ * @param indices Indices into `input` of the elements to get
+ * @param mr Device memory resource used to allocate the returned scalars' device memory.
+ * @return The scalar of each index, in the order of `indices`
+ */
+std::vector<std::unique_ptr<scalar>> get_elements(
+  column_view const& input,
+  std::vector<size_type> const& indices,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Copies the elements at specified indices of a fixed-width column to host memory
+ *
+ * The elements and their validities are gathered into one device buffer by a single kernel, and
+ * copied to the host with one device-to-host copy and one synchronization, e.g. to read many
+ * partition boundaries or group heads at once.
+ *
+ * @throws cudf::logic_error if the type of `input` is not `T`
+ * @throws cudf::logic_error if an index is not within the range `[0, input.size())`
+ *
+ * @tparam T The element type of `input`, a fixed-width type other than `fixed_point`
+ * @param input Column view to get the elements from
+ * @param indices Indices into `input` of the elements to get
+ * @return The values, in the order of `indices`, and whether each value is valid. The values of
+ * null elements are unspecified.
+ */
+template <typename T>
+std::pair<std::vector<T>, std::vector<bool>> get_elements_to_host(
+  column_view const& input, std::vector<size_type> const& indices);
+
 /**
  * @brief Indicates whether a row can be sampled more than once.
  **/
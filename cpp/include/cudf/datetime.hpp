@@ -18,7 +18,11 @@
 
 #include <cudf/types.hpp>
 
+#include <rmm/device_buffer.hpp>
+
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -32,6 +36,20 @@ namespace datetime {
  * @{
  */
 
+/**
+ * @brief Components of a timestamp that can be extracted
+ */
+enum class datetime_component : int8_t {
+  INVALID = 0,
+  YEAR,
+  MONTH,
+  DAY,
+  WEEKDAY,
+  HOUR,
+  MINUTE,
+  SECOND,
+};
+
 /**
  * @brief  Extracts year from any date time type and returns an int16_t
  * cudf::column.
@@ -123,6 +141,32 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Extracts several components of timestamps in a single pass, as int16_t columns
+ *
+ * Each timestamp is converted to its calendar date and time of day once, and all the requested
+ * components are read from it. Column `i` of the result is the same as the column returned by
+ * the `extract_*` function of `components[i]`.
+ *
+ * @code{.pseudo}
+ * timestamps = [2018-07-04 12:00:00, 2023-01-25 07:32:12]
+ * r = extract_components(timestamps, {YEAR, MONTH, HOUR})
+ * r is [[2018, 2023], [7, 1], [12, 7]]
+ * @endcode
+ *
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if any of `components` is INVALID
+ *
+ * @param column Timestamps to extract the components from.
+ * @param components Components to extract, in the order of the output columns.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Table with one int16_t column per requested component.
+ */
+std::unique_ptr<cudf::table> extract_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
@@ -188,5 +232,145 @@ std::unique_ptr<cudf::column> add_calendrical_months(
   cudf::column_view const& months,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 /** @} */  // end of group
+
+/**
+ * @addtogroup datetime_timezone
+ * @{
+ */
+
+/**
+ * @brief The UTC offsets of a timezone and the times they change, in device memory
+ *
+ * The table is built from the tzdata file of the zone in `/usr/share/zoneinfo`, as for the ORC
+ * reader. Past transitions are stored as they are; the transitions after the last one of the file
+ * follow the daylight saving time rule of the zone, and are stored for 400 years, which then
+ * repeat. The table of "UTC" has no transitions.
+ *
+ * Tables are immutable; `get_timezone_table` returns the table of a zone shared by all its users.
+ */
+class timezone_table {
+ public:
+  /**
+   * @brief Builds the table of a timezone
+   *
+   * @throw cudf::logic_error if the tzdata file of the zone cannot be found or parsed
+   *
+   * @param timezone_name Name of the zone, for example "America/Los_Angeles"
+   * @param stream CUDA stream used for the copy of the table to the device
+   */
+  explicit timezone_table(std::string const& timezone_name, cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the name of the zone
+   */
+  std::string const& name() const { return _name; }
+
+  /**
+   * @brief Returns the UTC times of the transitions in seconds, in device memory
+   */
+  int64_t const* transition_times() const
+  {
+    return static_cast<int64_t const*>(_transition_times.data());
+  }
+
+  /**
+   * @brief Returns the UTC offset in seconds from each transition, in device memory
+   */
+  int64_t const* utc_offsets() const { return static_cast<int64_t const*>(_utc_offsets.data()); }
+
+  /**
+   * @brief Returns the number of transitions before the repeating 400-year cycle
+   */
+  size_type num_transitions() const { return _num_transitions; }
+
+  /**
+   * @brief Returns the number of transitions in the repeating 400-year cycle, zero if the zone
+   * has no daylight saving time rule
+   */
+  size_type cycle_length() const { return _cycle_length; }
+
+ private:
+  std::string _name;
+  rmm::device_buffer _transition_times;
+  rmm::device_buffer _utc_offsets;
+  size_type _num_transitions{0};
+  size_type _cycle_length{0};
+};
+
+/**
+ * @brief Returns the table of a timezone, which is built on first use and cached for the lifetime
+ * of the process
+ *
+ * @throw cudf::logic_error if the tzdata file of the zone cannot be found or parsed
+ *
+ * @param timezone_name Name of the zone, for example "America/Los_Angeles"
+ * @return The shared table of the zone
+ */
+std::shared_ptr<timezone_table const> get_timezone_table(std::string const& timezone_name);
+
+/**
+ * @brief Converts UTC timestamps to the local time of a timezone
+ *
+ * The local times are stored as timestamps of the same type, as if the zone was UTC.
+ *
+ * @code{.pseudo}
+ * timestamps = [2020-07-01 12:00:00, 2020-12-01 12:00:00]
+ * r = utc_to_local(timestamps, *get_timezone_table("America/Los_Angeles"))
+ * r is [2020-07-01 05:00:00, 2020-12-01 04:00:00]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `timestamps` is not a TIMESTAMP type of seconds or finer
+ *
+ * @param timestamps Timestamps in UTC.
+ * @param timezone Table of the zone.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Timestamps in the local time of the zone.
+ */
+std::unique_ptr<cudf::column> utc_to_local(
+  cudf::column_view const& timestamps,
+  timezone_table const& timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Converts timestamps in the local time of a timezone to UTC
+ *
+ * A local time that occurs twice, when the clocks are set back, is converted to the earlier
+ * instant. A local time that is skipped, when the clocks are set forward, is shifted forward by
+ * the length of the gap, so that "02:30" on the day daylight saving time starts in the US is
+ * converted as "03:30".
+ *
+ * @throw cudf::logic_error if `timestamps` is not a TIMESTAMP type of seconds or finer
+ *
+ * @param timestamps Timestamps in the local time of the zone.
+ * @param timezone Table of the zone.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Timestamps in UTC.
+ */
+std::unique_ptr<cudf::column> local_to_utc(
+  cudf::column_view const& timestamps,
+  timezone_table const& timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Extracts a component of UTC timestamps in the local time of a timezone, as an INT16
+ * column
+ *
+ * This is the extraction of `component` from `utc_to_local(timestamps, timezone)`, in one pass.
+ *
+ * @throw cudf::logic_error if `timestamps` is not a TIMESTAMP type of seconds or finer
+ * @throw cudf::logic_error if `component` is INVALID
+ *
+ * @param timestamps Timestamps in UTC.
+ * @param timezone Table of the zone.
+ * @param component Component to extract.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return The local components as INT16.
+ */
+std::unique_ptr<cudf::column> extract_local_component(
+  cudf::column_view const& timestamps,
+  timezone_table const& timezone,
+  datetime_component component,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+/** @} */  // end of group
 }  // namespace datetime
 }  // namespace cudf
@@ -153,6 +153,108 @@ struct nth_element_aggregation final : derived_aggregation<nth_element_aggregati
   }
 };
 
+/// Bounds of the precision of a HyperLogLog sketch, the log2 of its number of registers
+constexpr int HYPERLOGLOG_MIN_PRECISION{4};
+constexpr int HYPERLOGLOG_MAX_PRECISION{18};
+
+/**
+ * @brief Derived class for specifying a hyperloglog or approx_nunique aggregation
+ */
+struct hyperloglog_aggregation final : derived_aggregation<hyperloglog_aggregation> {
+  hyperloglog_aggregation(aggregation::Kind k, int precision, null_policy null_handling)
+    : derived_aggregation{k}, _precision{precision}, _null_handling{null_handling}
+  {
+  }
+  int _precision;              ///< log2 of the number of registers of a sketch
+  null_policy _null_handling;  ///< include or exclude nulls
+
+ protected:
+  friend class derived_aggregation<hyperloglog_aggregation>;
+
+  bool operator==(hyperloglog_aggregation const& other) const
+  {
+    return _precision == other._precision and _null_handling == other._null_handling;
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<int>{}(_precision) ^ std::hash<int>{}(static_cast<int>(_null_handling));
+  }
+};
+
+/**
+ * @brief Derived class for specifying a tdigest or approx_quantile aggregation
+ */
+struct tdigest_aggregation final : derived_aggregation<tdigest_aggregation> {
+  tdigest_aggregation(aggregation::Kind k,
+                      int max_centroids,
+                      std::vector<double> const& quantiles = {})
+    : derived_aggregation{k}, _max_centroids{max_centroids}, _quantiles{quantiles}
+  {
+  }
+  int _max_centroids;              ///< maximum number of centroids of a digest
+  std::vector<double> _quantiles;  ///< Desired quantile(s), for approx_quantile
+
+ protected:
+  friend class derived_aggregation<tdigest_aggregation>;
+
+  bool operator==(tdigest_aggregation const& other) const
+  {
+    return _max_centroids == other._max_centroids and _quantiles == other._quantiles;
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<int>{}(_max_centroids) ^
+           std::accumulate(
+             _quantiles.cbegin(), _quantiles.cend(), size_t{0}, [](size_t a, double b) {
+               return a ^ std::hash<double>{}(b);
+             });
+  }
+};
+
+/**
+ * @brief Derived class for specifying a rank aggregation
+ */
+struct rank_aggregation final : derived_aggregation<rank_aggregation> {
+  rank_aggregation(rank_method method,
+                   order column_order,
+                   null_policy null_handling,
+                   null_order null_precedence,
+                   bool percentage)
+    : derived_aggregation{aggregation::RANK},
+      _method{method},
+      _column_order{column_order},
+      _null_handling{null_handling},
+      _null_precedence{null_precedence},
+      _percentage{percentage}
+  {
+  }
+  rank_method _method;          ///< tie breaking method
+  order _column_order;          ///< sort order of the values
+  null_policy _null_handling;   ///< null rank for null values if EXCLUDE
+  null_order _null_precedence;  ///< order of nulls among the values
+  bool _percentage;             ///< ranks as percentages of the group
+
+ protected:
+  friend class derived_aggregation<rank_aggregation>;
+
+  bool operator==(rank_aggregation const& other) const
+  {
+    return _method == other._method and _column_order == other._column_order and
+           _null_handling == other._null_handling and
+           _null_precedence == other._null_precedence and _percentage == other._percentage;
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<int>{}(static_cast<int>(_method)) ^
+           std::hash<int>{}(static_cast<int>(_column_order)) ^
+           std::hash<int>{}(static_cast<int>(_null_handling)) ^
+           std::hash<int>{}(static_cast<int>(_null_precedence)) ^ std::hash<bool>{}(_percentage);
+  }
+};
+
 /**
  * @brief Derived class for specifying a custom aggregation
  * specified in udf
@@ -160,18 +262,21 @@ struct nth_element_aggregation final : derived_aggregation<nth_element_aggregati
 struct udf_aggregation final : derived_aggregation<udf_aggregation> {
   udf_aggregation(aggregation::Kind type,
                   std::string const& user_defined_aggregator,
-                  data_type output_type)
+                  data_type output_type,
+                  std::shared_ptr<compiled_udf const> udf = nullptr)
     : derived_aggregation{type},
       _source{user_defined_aggregator},
       _operator_name{(type == aggregation::PTX) ? "rolling_udf_ptx" : "rolling_udf_cuda"},
       _function_name{"rolling_udf"},
-      _output_type{output_type}
+      _output_type{output_type},
+      _udf{std::move(udf)}
   {
   }
   std::string const _source;
   std::string const _operator_name;
   std::string const _function_name;
   data_type _output_type;
+  std::shared_ptr<compiled_udf const> _udf;  ///< Registered function of `_source`, or nullptr
 
  protected:
   friend class derived_aggregation<udf_aggregation>;
@@ -301,6 +406,12 @@ struct target_type_impl<Source, k, std::enable_if_t<is_chrono<Source>() && is_su
   using type = Source;
 };
 
+// Summing fixed_point types, use same type accumulator
+template <typename Source>
+struct target_type_impl<Source, aggregation::SUM, std::enable_if_t<is_fixed_point<Source>()>> {
+  using type = Source;
+};
+
 // Always use `double` for VARIANCE
 template <typename SourceType>
 struct target_type_impl<SourceType, aggregation::VARIANCE> {
@@ -355,6 +466,30 @@ struct target_type_impl<Source, aggregation::ROW_NUMBER> {
   using type = cudf::size_type;
 };
 
+// A HYPERLOGLOG sketch is a list of registers
+template <typename Source>
+struct target_type_impl<Source, aggregation::HYPERLOGLOG> {
+  using type = cudf::list_view;
+};
+
+// Always use int64_t for APPROX_NUNIQUE, whose counts may add up across batches
+template <typename Source>
+struct target_type_impl<Source, aggregation::APPROX_NUNIQUE> {
+  using type = int64_t;
+};
+
+// A TDIGEST is a list of the means and weights of its centroids
+template <typename Source>
+struct target_type_impl<Source, aggregation::TDIGEST> {
+  using type = cudf::list_view;
+};
+
+// Always use double for APPROX_QUANTILE, interpolated between centroid means
+template <typename Source>
+struct target_type_impl<Source, aggregation::APPROX_QUANTILE> {
+  using type = double;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -384,6 +519,11 @@ using kind_to_type = typename kind_to_type_impl<k>::type;
 AGG_KIND_MAPPING(aggregation::QUANTILE, quantile_aggregation);
 AGG_KIND_MAPPING(aggregation::STD, std_var_aggregation);
 AGG_KIND_MAPPING(aggregation::VARIANCE, std_var_aggregation);
+AGG_KIND_MAPPING(aggregation::HYPERLOGLOG, hyperloglog_aggregation);
+AGG_KIND_MAPPING(aggregation::APPROX_NUNIQUE, hyperloglog_aggregation);
+AGG_KIND_MAPPING(aggregation::TDIGEST, tdigest_aggregation);
+AGG_KIND_MAPPING(aggregation::APPROX_QUANTILE, tdigest_aggregation);
+AGG_KIND_MAPPING(aggregation::RANK, rank_aggregation);
 
 /**
  * @brief Dispatches `k` as a non-type template parameter to a callable,  `f`.
@@ -440,6 +580,16 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::NTH_ELEMENT>(std::forward<Ts>(args)...);
     case aggregation::ROW_NUMBER:
       return f.template operator()<aggregation::ROW_NUMBER>(std::forward<Ts>(args)...);
+    case aggregation::HYPERLOGLOG:
+      return f.template operator()<aggregation::HYPERLOGLOG>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_NUNIQUE:
+      return f.template operator()<aggregation::APPROX_NUNIQUE>(std::forward<Ts>(args)...);
+    case aggregation::TDIGEST:
+      return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_QUANTILE:
+      return f.template operator()<aggregation::APPROX_QUANTILE>(std::forward<Ts>(args)...);
+    case aggregation::RANK:
+      return f.template operator()<aggregation::RANK>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
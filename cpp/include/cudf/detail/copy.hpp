@@ -84,6 +84,15 @@ std::vector<contiguous_split_result> contiguous_split(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::pack
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                    cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::allocate_like(column_view const&, size_type, mask_allocation_policy,
  * rmm::mr::device_memory_resource*)
@@ -149,6 +158,42 @@ std::unique_ptr<column> copy_if_else(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::copy_if_else( table_view const&, table_view const&,
+ * column_view const&, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> copy_if_else(
+  table_view const& lhs,
+  table_view const& rhs,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns a new table, where each element of column `c` is `lhs[c]` where
+ * @p boolean_mask is valid and true, and `rhs[c][i]` otherwise
+ *
+ * The mask is read once for the whole table.
+ *
+ * @throws cudf::logic_error if a scalar is not of the type of its column
+ * @throws cudf::logic_error if boolean mask is not of type bool
+ * @throws cudf::logic_error if boolean mask is not of the same length as rhs
+ *
+ * @param[in] lhs One scalar per column of `rhs`
+ * @param[in] rhs right-hand table_view
+ * @param[in] boolean_mask column of `type_id::BOOL8`; a null element represents false
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> copy_if_else(
+  std::vector<std::reference_wrapper<scalar>> const& lhs,
+  table_view const& rhs,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::sample
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/table/table.hpp>
@@ -36,28 +37,13 @@
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 #include <algorithm>
 #include <cub/cub.cuh>
 
 namespace {
-// Compute the count of elements that pass the mask within each block
-template <typename Filter, int block_size>
-__global__ void compute_block_counts(cudf::size_type* __restrict__ block_counts,
-                                     cudf::size_type size,
-                                     cudf::size_type per_thread,
-                                     Filter filter)
-{
-  int tid   = threadIdx.x + per_thread * block_size * blockIdx.x;
-  int count = 0;
-
-  for (int i = 0; i < per_thread; i++) {
-    bool mask_true = (tid < size) && filter(tid);
-    count += __syncthreads_count(mask_true);
-    tid += block_size;
-  }
-
-  if (threadIdx.x == 0) block_counts[blockIdx.x] = count;
-}
+using copy_if_tile_state = cub::ScanTileState<cudf::size_type>;
 
 // Compute the exclusive prefix sum of each thread's mask value within each block
 template <int block_size>
@@ -72,36 +58,80 @@ __device__ cudf::size_type block_scan_mask(bool mask_true, cudf::size_type& bloc
   return offset;
 }
 
-// This kernel scatters data and validity mask of a column based on the
-// scan of the boolean mask. The block offsets for the scan are already computed.
-// Just compute the scan of the mask in each block and add it to the block's
-// output offset. This is the output index of each element. Scattering
-// the valid mask is not as easy, because each thread is only responsible for
-// one bit. Warp-level processing (ballot) makes this simpler.
-// To make scattering efficient, we "coalesce" the block's scattered data and
-// valids in shared memory, and then write from shared memory to global memory
+// This kernel filters and scatters data and validity mask of a column in a
+// single pass over the input. Each block processes one tile of
+// block_size * items_per_thread rows. It first evaluates the filter for its rows,
+// then finds the output offset of its tile with a decoupled look-back on the
+// counts of the preceding tiles: a tile publishes its count as soon as it is
+// known, and the running total once its own offset is known, so that a tile only
+// waits for the tiles right before it. The last tile writes the output size.
+//
+// The rows are then scattered like so: compute the scan of the mask in each
+// iteration and add it to the running output offset. This is the output index
+// of each element. Scattering the valid mask is not as easy, because each thread
+// is only responsible for one bit. Warp-level processing (ballot) makes this
+// simpler. To make scattering efficient, we "coalesce" the block's scattered data
+// and valids in shared memory, and then write from shared memory to global memory
 // in a contiguous manner.
 // The has_validity template parameter specializes this kernel for the
 // non-nullable case for performance without writing another kernel.
 //
 // Note: `filter` is not run on indices larger than the input column size
-template <typename T, typename Filter, int block_size, bool has_validity>
+template <typename T, typename Filter, int block_size, int items_per_thread, bool has_validity>
 __launch_bounds__(block_size) __global__
   void scatter_kernel(cudf::mutable_column_device_view output_view,
+                      cudf::size_type* output_size,
                       cudf::size_type* output_null_count,
                       cudf::column_device_view input_view,
-                      cudf::size_type const* __restrict__ block_offsets,
                       cudf::size_type size,
-                      cudf::size_type per_thread,
-                      Filter filter)
+                      Filter filter,
+                      copy_if_tile_state tile_state)
 {
+  using BlockScan    = cub::BlockScan<cudf::size_type, block_size>;
+  using TilePrefixOp = cub::TilePrefixCallbackOp<cudf::size_type, cub::Sum, copy_if_tile_state>;
+
   T* __restrict__ output_data                   = output_view.data<T>();
   cudf::bitmask_type* __restrict__ output_valid = output_view.null_mask();
   constexpr cudf::size_type leader_lane{0};
   static_assert(block_size <= 1024, "Maximum thread block size exceeded");
 
-  int tid                      = threadIdx.x + per_thread * block_size * blockIdx.x;
-  cudf::size_type block_offset = block_offsets[blockIdx.x];
+  int const tile = blockIdx.x;
+  int tid        = threadIdx.x + items_per_thread * block_size * tile;
+
+  __shared__ typename BlockScan::TempStorage scan_storage;
+  __shared__ typename TilePrefixOp::TempStorage prefix_storage;
+  __shared__ cudf::size_type tile_offset;
+
+  // 1. Evaluate the filter once for each row of the tile
+  bool mask_true[items_per_thread];
+  cudf::size_type thread_count = 0;
+#pragma unroll
+  for (int i = 0; i < items_per_thread; i++) {
+    int const row = tid + i * block_size;
+    mask_true[i]  = (row < size) && filter(row);
+    thread_count += mask_true[i];
+  }
+
+  // 2. Find the offset of the tile's output from the counts of the preceding tiles
+  cudf::size_type thread_offset = 0;
+  if (tile == 0) {
+    cudf::size_type tile_count = 0;
+    BlockScan(scan_storage).ExclusiveSum(thread_count, thread_offset, tile_count);
+    if (threadIdx.x == 0) {
+      tile_state.SetInclusive(0, tile_count);
+      tile_offset = 0;
+      if (gridDim.x == 1) *output_size = tile_count;
+    }
+  } else {
+    TilePrefixOp prefix_op(tile_state, prefix_storage, cub::Sum(), tile);
+    BlockScan(scan_storage).ExclusiveSum(thread_count, thread_offset, prefix_op);
+    if (threadIdx.x == 0) {
+      tile_offset = prefix_op.GetExclusivePrefix();
+      if (tile == gridDim.x - 1) *output_size = prefix_op.GetInclusivePrefix();
+    }
+  }
+  __syncthreads();
+  cudf::size_type block_offset = tile_offset;
 
   // one extra warp worth in case the block is not aligned
   __shared__ bool temp_valids[has_validity ? block_size + cudf::detail::warp_size : 1];
@@ -110,15 +140,12 @@ __launch_bounds__(block_size) __global__
   cudf::size_type warp_valid_counts{0};
   cudf::size_type block_sum = 0;
 
-  // Note that since the maximum gridDim.x on all supported GPUs is as big as
-  // cudf::size_type, this loop is sufficient to cover our maximum column size
-  // regardless of the value of block_size and per_thread.
-  for (int i = 0; i < per_thread; i++) {
-    bool mask_true = (tid < size) && filter(tid);
-
+  // 3. Scatter the rows of the tile
+#pragma unroll
+  for (int i = 0; i < items_per_thread; i++) {
     cudf::size_type tmp_block_sum = 0;
     // get output location using a scan of the mask result
-    const cudf::size_type local_index = block_scan_mask<block_size>(mask_true, tmp_block_sum);
+    const cudf::size_type local_index = block_scan_mask<block_size>(mask_true[i], tmp_block_sum);
     block_sum += tmp_block_sum;
 
     if (has_validity) {
@@ -127,7 +154,7 @@ __launch_bounds__(block_size) __global__
       __syncthreads();  // wait for init
     }
 
-    if (mask_true) {
+    if (mask_true[i]) {
       temp_data[local_index] = input_view.data<T>()[tid];  // scatter data to shared
 
       // scatter validity mask to shared memory
@@ -168,7 +195,7 @@ __launch_bounds__(block_size) __global__
         // all zero before the kernel
 
         if (lane == 0 && valid_warp != 0) {
-          warp_valid_counts = __popc(valid_warp);
+          warp_valid_counts += __popc(valid_warp);
           if (wid > 0 && wid < last_warp)
             output_valid[valid_index] = valid_warp;
           else {
@@ -198,32 +225,35 @@ __launch_bounds__(block_size) __global__
   }
 }
 
-// Dispatch functor which performs the scatter for fixed column types and gather for other
-template <typename Filter, int block_size>
-struct scatter_gather_functor {
+// Whether the columns of a type are filtered by `scatter_kernel`
+constexpr bool is_scatterable(cudf::data_type type)
+{
+  return cudf::is_fixed_width(type) and !cudf::is_fixed_point(type);
+}
+
+// Dispatch functor which filters a fixed-width column with `scatter_kernel`.
+// The returned column has the size of `input` until the output size is known.
+template <typename Filter, int block_size, int items_per_thread>
+struct scatter_functor {
   template <typename T,
             std::enable_if_t<cudf::is_fixed_width<T>() and !cudf::is_fixed_point<T>()>* = nullptr>
-  std::unique_ptr<cudf::column> operator()(
-    cudf::column_view const& input,
-    cudf::size_type const& output_size,
-    cudf::size_type const* block_offsets,
-    Filter filter,
-    cudf::size_type per_thread,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-    cudaStream_t stream                 = 0)
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
+                                           Filter filter,
+                                           copy_if_tile_state tile_state,
+                                           cudf::size_type* output_size,
+                                           cudf::size_type* output_null_count,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
   {
     auto output_column = cudf::detail::allocate_like(
-      input, output_size, cudf::mask_allocation_policy::RETAIN, mr, stream);
+      input, input.size(), cudf::mask_allocation_policy::RETAIN, mr, stream);
     auto output = output_column->mutable_view();
 
     bool has_valid = input.nullable();
 
-    auto scatter = (has_valid) ? scatter_kernel<T, Filter, block_size, true>
-                               : scatter_kernel<T, Filter, block_size, false>;
-
-    cudf::detail::grid_1d grid{input.size(), block_size, per_thread};
+    auto scatter = (has_valid) ? scatter_kernel<T, Filter, block_size, items_per_thread, true>
+                               : scatter_kernel<T, Filter, block_size, items_per_thread, false>;
 
-    rmm::device_scalar<cudf::size_type> null_count{0, stream};
     if (output.nullable()) {
       // Have to initialize the output mask to all zeros because we may update
       // it with atomicOr().
@@ -233,59 +263,67 @@ struct scatter_gather_functor {
                                stream));
     }
 
+    // Reset the status of the tiles left by the previous column
+    int const num_tiles =
+      cudf::util::div_rounding_up_safe(input.size(), block_size * items_per_thread);
+    constexpr int init_block_size = 128;
+    cub::DeviceScanInitKernel<<<cudf::util::div_rounding_up_safe(num_tiles, init_block_size),
+                                init_block_size,
+                                0,
+                                stream>>>(tile_state, num_tiles);
+
     auto output_device_view = cudf::mutable_column_device_view::create(output, stream);
     auto input_device_view  = cudf::column_device_view::create(input, stream);
-    scatter<<<grid.num_blocks, block_size, 0, stream>>>(*output_device_view,
-                                                        null_count.data(),
-                                                        *input_device_view,
-                                                        block_offsets,
-                                                        input.size(),
-                                                        per_thread,
-                                                        filter);
-
-    if (has_valid) { output_column->set_null_count(null_count.value(stream)); }
+    scatter<<<num_tiles, block_size, 0, stream>>>(*output_device_view,
+                                                  output_size,
+                                                  output_null_count,
+                                                  *input_device_view,
+                                                  input.size(),
+                                                  filter,
+                                                  tile_state);
     return output_column;
   }
 
   template <typename T,
-            std::enable_if_t<!cudf::is_fixed_width<T>() and !cudf::is_fixed_point<T>()>* = nullptr>
-  std::unique_ptr<cudf::column> operator()(
-    cudf::column_view const& input,
-    cudf::size_type const& output_size,
-    cudf::size_type const* block_offsets,
-    Filter filter,
-    cudf::size_type per_thread,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-    cudaStream_t stream                 = 0)
+            std::enable_if_t<!cudf::is_fixed_width<T>() or cudf::is_fixed_point<T>()>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
+                                           Filter filter,
+                                           copy_if_tile_state tile_state,
+                                           cudf::size_type* output_size,
+                                           cudf::size_type* output_null_count,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
   {
-    rmm::device_uvector<cudf::size_type> indices(output_size, stream);
-
-    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
-                    thrust::counting_iterator<cudf::size_type>(0),
-                    thrust::counting_iterator<cudf::size_type>(input.size()),
-                    indices.begin(),
-                    filter);
-
-    auto output_table = cudf::detail::gather(
-      cudf::table_view{{input}}, indices.begin(), indices.end(), false, mr, stream);
-
-    // There will be only one column
-    return std::make_unique<cudf::column>(std::move(output_table->get_column(0)));
+    CUDF_FAIL("Unexpected non fixed-width type");
   }
+};
 
-  template <typename T, std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
-  std::unique_ptr<cudf::column> operator()(
-    cudf::column_view const& input,
-    cudf::size_type const& output_size,
-    cudf::size_type const* block_offsets,
-    Filter filter,
-    cudf::size_type per_thread,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-    cudaStream_t stream                 = 0)
-  {
-    CUDF_FAIL("fixed_point type not supported for this operation yet");
+// Trims a column filtered by `scatter_kernel` to the output size. The buffers sized for the
+// input are kept unless most of them is unused.
+std::unique_ptr<cudf::column> trim_scattered(std::unique_ptr<cudf::column> scattered,
+                                             cudf::size_type size,
+                                             cudf::size_type null_count,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  auto const type     = scattered->type();
+  auto const nullable = scattered->nullable();
+  auto const shrink   = size < scattered->size() / 2;
+  auto contents       = scattered->release();
+  if (shrink) {
+    *contents.data =
+      rmm::device_buffer(contents.data->data(), size * cudf::size_of(type), stream, mr);
+    if (nullable) {
+      *contents.null_mask = rmm::device_buffer(
+        contents.null_mask->data(), cudf::bitmask_allocation_size_bytes(size), stream, mr);
+    }
   }
-};
+  return std::make_unique<cudf::column>(type,
+                                        size,
+                                        std::move(*contents.data),
+                                        std::move(*contents.null_mask),
+                                        nullable ? null_count : 0);
+}
 
 }  // namespace
 
@@ -299,6 +337,11 @@ namespace detail {
  * It will return true if element i of @p input should be copied,
  * false otherwise.
  *
+ * Each fixed-width column is filtered in a single pass over the rows, which
+ * also computes the output size. The indices of the rows to gather the other
+ * columns are selected in a single pass as well. The stream is synchronized
+ * once, to read the output size.
+ *
  * @tparam Filter the filter functor type
  * @param[in] input The table_view to filter
  * @param[in] filter A function object that takes an index and returns a bool
@@ -315,76 +358,102 @@ std::unique_ptr<table> copy_if(
 
   if (0 == input.num_rows() || 0 == input.num_columns()) { return empty_like(input); }
 
-  constexpr int block_size = 256;
-  cudf::size_type per_thread =
-    elements_per_thread(compute_block_counts<Filter, block_size>, input.num_rows(), block_size);
-  cudf::detail::grid_1d grid{input.num_rows(), block_size, per_thread};
-
-  // temp storage for block counts and offsets
-  rmm::device_uvector<cudf::size_type> block_counts(grid.num_blocks, stream);
-  rmm::device_uvector<cudf::size_type> block_offsets(grid.num_blocks + 1, stream);
+  constexpr int block_size       = 256;
+  constexpr int items_per_thread = 8;
+  auto const num_columns         = input.num_columns();
 
-  // 1. Find the count of elements in each block that "pass" the mask
-  compute_block_counts<Filter, block_size><<<grid.num_blocks, block_size, 0, stream>>>(
-    block_counts.begin(), input.num_rows(), per_thread, filter);
+  // output size, followed by the null count of each column
+  rmm::device_uvector<cudf::size_type> counts(num_columns + 1, stream);
+  CUDA_TRY(cudaMemsetAsync(counts.data(), 0, counts.size() * sizeof(cudf::size_type), stream));
 
-  // initialize just the first element of block_offsets to 0 since the InclusiveSum below
-  // starts at the second element.
-  CUDA_TRY(cudaMemsetAsync(block_offsets.begin(), 0, sizeof(cudf::size_type), stream));
+  auto const scatterable     = [](column_view const& col) { return is_scatterable(col.type()); };
+  bool const all_scatterable = std::all_of(input.begin(), input.end(), scatterable);
+  bool const any_scatterable = std::any_of(input.begin(), input.end(), scatterable);
 
-  // 2. Find the offset for each block's output using a scan of block counts
-  if (grid.num_blocks > 1) {
-    // Determine and allocate temporary device storage
+  // 1. Select the indices of the rows passing the filter for the columns which are gathered
+  rmm::device_uvector<cudf::size_type> indices(all_scatterable ? 0 : input.num_rows(), stream);
+  if (not all_scatterable) {
+    auto const rows           = thrust::make_counting_iterator<cudf::size_type>(0);
     size_t temp_storage_bytes = 0;
-    cub::DeviceScan::InclusiveSum(nullptr,
-                                  temp_storage_bytes,
-                                  block_counts.begin(),
-                                  block_offsets.begin() + 1,
-                                  grid.num_blocks,
-                                  stream);
+    cub::DeviceSelect::If(nullptr,
+                          temp_storage_bytes,
+                          rows,
+                          indices.data(),
+                          counts.data(),
+                          input.num_rows(),
+                          filter,
+                          stream);
     rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
-
-    // Run exclusive prefix sum
-    cub::DeviceScan::InclusiveSum(d_temp_storage.data(),
-                                  temp_storage_bytes,
-                                  block_counts.begin(),
-                                  block_offsets.begin() + 1,
-                                  grid.num_blocks,
-                                  stream);
+    cub::DeviceSelect::If(d_temp_storage.data(),
+                          temp_storage_bytes,
+                          rows,
+                          indices.data(),
+                          counts.data(),
+                          input.num_rows(),
+                          filter,
+                          stream);
   }
 
-  // As it is InclusiveSum, last value in block_offsets will be output_size
-  // unless num_blocks == 1, in which case output_size is just block_counts[0]
-  cudf::size_type output_size{0};
-  CUDA_TRY(cudaMemcpyAsync(
-    &output_size,
-    grid.num_blocks > 1 ? block_offsets.begin() + grid.num_blocks : block_counts.begin(),
-    sizeof(cudf::size_type),
-    cudaMemcpyDefault,
-    stream));
+  // 2. Filter the fixed-width columns in a single pass each, which also finds the output size
+  int const num_tiles =
+    cudf::util::div_rounding_up_safe(input.num_rows(), block_size * items_per_thread);
+  copy_if_tile_state tile_state;
+  size_t tile_state_bytes = 0;
+  CUDA_TRY(copy_if_tile_state::AllocationSize(num_tiles, tile_state_bytes));
+  rmm::device_buffer d_tile_state(any_scatterable ? tile_state_bytes : 0, stream);
+  CUDA_TRY(tile_state.Init(num_tiles, d_tile_state.data(), tile_state_bytes));
+
+  using scatter = scatter_functor<Filter, block_size, items_per_thread>;
+  std::vector<std::unique_ptr<column>> out_columns(num_columns);
+  for (cudf::size_type i = 0; i < num_columns; ++i) {
+    auto const& col = input.column(i);
+    if (is_scatterable(col.type())) {
+      out_columns[i] = cudf::type_dispatcher(col.type(),
+                                             scatter{},
+                                             col,
+                                             filter,
+                                             tile_state,
+                                             counts.data(),
+                                             counts.data() + i + 1,
+                                             mr,
+                                             stream);
+    }
+  }
 
+  std::vector<cudf::size_type> h_counts(counts.size());
+  CUDA_TRY(cudaMemcpyAsync(h_counts.data(),
+                           counts.data(),
+                           counts.size() * sizeof(cudf::size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
   CUDA_TRY(cudaStreamSynchronize(stream));
-
-  if (output_size == input.num_rows()) {
-    return std::make_unique<table>(input, stream, mr);
-  } else if (output_size > 0) {
-    std::vector<std::unique_ptr<column>> out_columns(input.num_columns());
-    std::transform(input.begin(), input.end(), out_columns.begin(), [&](auto col_view) {
-      return cudf::type_dispatcher(col_view.type(),
-                                   scatter_gather_functor<Filter, block_size>{},
-                                   col_view,
-                                   output_size,
-                                   block_offsets.begin(),
-                                   filter,
-                                   per_thread,
-                                   mr,
-                                   stream);
-    });
-
-    return std::make_unique<table>(std::move(out_columns));
-  } else {
-    return empty_like(input);
+  auto const output_size = h_counts.front();
+
+  if (output_size == 0) { return empty_like(input); }
+
+  // 3. Trim the scattered columns and gather the others
+  for (cudf::size_type i = 0; i < num_columns; ++i) {
+    auto const& col = input.column(i);
+    if (is_scatterable(col.type())) {
+      out_columns[i] =
+        trim_scattered(std::move(out_columns[i]), output_size, h_counts[i + 1], mr, stream);
+    } else if (output_size == input.num_rows()) {
+      out_columns[i] = std::make_unique<column>(col, stream, mr);
+    } else {
+      CUDF_EXPECTS(not cudf::is_fixed_point(col.type()),
+                   "fixed_point type not supported for this operation yet");
+      auto output_table = cudf::detail::gather(cudf::table_view{{col}},
+                                               indices.begin(),
+                                               indices.begin() + output_size,
+                                               false,
+                                               mr,
+                                               stream);
+      // There will be only one column
+      out_columns[i] = std::make_unique<cudf::column>(std::move(output_table->get_column(0)));
+    }
   }
+
+  return std::make_unique<table>(std::move(out_columns));
 }
 
 }  // namespace detail
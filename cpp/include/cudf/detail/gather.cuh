@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/release_assert.cuh>
@@ -25,6 +26,7 @@
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/detail/gather.cuh>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
@@ -358,6 +360,20 @@ struct column_gatherer_impl<list_view, MapItRoot> {
   }
 };
 
+template <typename MapIterator>
+std::unique_ptr<table> gather(table_view const& source_table,
+                              MapIterator gather_map_begin,
+                              MapIterator gather_map_end,
+                              bool nullify_out_of_bounds          = false,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream                 = 0);
+
+/**
+ * @brief Column gather specialization for struct column
+ *
+ * The fields are gathered as a table; the null mask of the struct column is gathered with the
+ * other columns of the source table.
+ */
 template <typename MapItRoot>
 struct column_gatherer_impl<struct_view, MapItRoot> {
   std::unique_ptr<column> operator()(column_view const& column,
@@ -367,7 +383,27 @@ struct column_gatherer_impl<struct_view, MapItRoot> {
                                      cudaStream_t stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    CUDF_FAIL("Gather not yet supported on struct_view.");
+    structs_column_view const structs(column);
+    auto const gather_map_size = std::distance(gather_map_begin, gather_map_end);
+
+    std::vector<column_view> fields;
+    for (size_type i = 0; i < structs.num_children(); ++i) {
+      fields.push_back(structs.get_sliced_child(i));
+    }
+    auto gathered_fields = gather(table_view{fields},
+                                  gather_map_begin,
+                                  gather_map_end,
+                                  nullify_out_of_bounds,
+                                  mr,
+                                  stream)
+                             ->release();
+
+    return make_structs_column(gather_map_size,
+                               std::move(gathered_fields),
+                               0,
+                               rmm::device_buffer{0, stream, mr},
+                               stream,
+                               mr);
   }
 };
 
@@ -545,9 +581,9 @@ template <typename MapIterator>
 std::unique_ptr<table> gather(table_view const& source_table,
                               MapIterator gather_map_begin,
                               MapIterator gather_map_end,
-                              bool nullify_out_of_bounds          = false,
-                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-                              cudaStream_t stream                 = 0)
+                              bool nullify_out_of_bounds,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
 {
   std::vector<std::unique_ptr<column>> destination_columns;
 
@@ -17,6 +17,8 @@
 #include <cudf/groupby.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 #include <memory>
 #include <utility>
 
@@ -24,6 +26,33 @@ namespace cudf {
 namespace groupby {
 namespace detail {
 namespace hash {
+/**
+ * @brief Groups of the key rows, kept by a `groupby` across hash-based
+ * aggregations of the same keys
+ *
+ * The groups are numbered by their row in the sparse results, which is the
+ * first row of each key inserted in the hash map.
+ */
+struct key_index {
+  rmm::device_vector<size_type> row_targets;  ///< Sparse target of every key row, negative
+                                              ///< if the row is skipped
+  rmm::device_vector<size_type> gather_map;   ///< Sparse target of every group
+  size_type num_groups{0};                    ///< Number of groups
+
+  /**
+   * @brief Indicates whether the groups of the keys are stored
+   */
+  bool is_populated() const { return not row_targets.empty(); }
+
+  /**
+   * @brief Bytes of device memory held by the index
+   */
+  std::size_t size_bytes() const
+  {
+    return (row_targets.size() + gather_map.size()) * sizeof(size_type);
+  }
+};
+
 /**
  * @brief Indicates if a set of aggregation requests can be satisfied with a
  * hash-based groupby implementation.
@@ -36,11 +65,18 @@ namespace hash {
  */
 bool can_use_hash_groupby(table_view const& keys, std::vector<aggregation_request> const& requests);
 
-// Hash-based groupby
+/**
+ * @brief Hash-based groupby
+ *
+ * If `index` is populated, the values are aggregated into its groups without
+ * hashing the keys. Otherwise, if `index` is not null, it is populated with the
+ * groups of the keys.
+ */
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   std::vector<aggregation_request> const& requests,
   null_policy include_null_keys,
+  key_index* index,
   cudaStream_t stream,
   rmm::mr::device_memory_resource* mr);
 }  // namespace hash
@@ -95,6 +95,24 @@ struct sort_groupby_helper {
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
     cudaStream_t stream                 = 0);
 
+  /**
+   * @brief Groups several columns of values according to `keys` and sorts
+   * each within every group, as `sorted_values` does for one column.
+   *
+   * Columns of the same type are concatenated and sorted together in a single
+   * pass, the group labels of each column offset past those of the previous
+   * ones, so that `n` columns of a type take one sort rather than `n`.
+   *
+   * @throw cudf::logic_error if `values[i].size() != keys.num_rows()`
+   *
+   * @param values The value columns to group and sort
+   * @return the sorted and grouped columns, in the order of `values`
+   */
+  std::vector<std::unique_ptr<column>> sorted_values(
+    std::vector<column_view> const& values,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
   /**
    * @brief Groups a column of values according to `keys`
    *
@@ -183,6 +201,12 @@ struct sort_groupby_helper {
    */
   index_vector const& group_labels(cudaStream_t stream = 0);
 
+  /**
+   * @brief Get the bytes of device memory held by the stored sort order,
+   * offsets and labels of the keys
+   */
+  std::size_t size_bytes() const;
+
  private:
   /**
    * @brief Get the group labels for unsorted keys
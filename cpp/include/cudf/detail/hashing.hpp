@@ -32,22 +32,47 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   cudaStream_t stream                 = 0);
 
 /**
- * @copydoc cudf::hash
+ * @copydoc cudf::hash_partition_map
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
-std::unique_ptr<column> hash(table_view const& input,
+std::pair<std::unique_ptr<column>, std::vector<size_type>> hash_partition_map(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::hash(indexed_table_view const&, hash_id, std::vector<uint32_t> const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> hash(indexed_table_view const& input,
                              hash_id hash_function                     = hash_id::HASH_MURMUR3,
                              std::vector<uint32_t> const& initial_hash = {},
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                              cudaStream_t stream                 = 0);
 
 std::unique_ptr<column> murmur_hash3_32(
-  table_view const& input,
+  indexed_table_view const& input,
   std::vector<uint32_t> const& initial_hash = {},
   rmm::mr::device_memory_resource* mr       = rmm::mr::get_default_resource(),
   cudaStream_t stream                       = 0);
 
+std::unique_ptr<column> spark_murmur_hash3_32(
+  indexed_table_view const& input,
+  uint32_t seed                       = 42,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+std::unique_ptr<column> xxhash_64(
+  indexed_table_view const& input,
+  uint64_t seed                       = 42,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 std::unique_ptr<column> md5_hash(
   table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
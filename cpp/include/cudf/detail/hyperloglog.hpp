@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Computes the HyperLogLog sketch of the distinct values of every group
+ *
+ * Every value is hashed once, and the top `precision` bits of its hash select
+ * the register of its group's sketch that holds the maximum position of the
+ * leftmost set bit of the remaining bits.
+ *
+ * @param values The values to sketch
+ * @param group_indices Group of every row of `values`, or `nullptr` if all rows
+ * are in a single group. Rows of a negative group are skipped.
+ * @param num_groups The number of groups
+ * @param precision log2 of the number of registers of a sketch
+ * @param null_handling Indicates if null values are sketched
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return LIST column of `num_groups` sketches of `2^precision` UINT8 registers
+ */
+std::unique_ptr<column> hyperloglog_sketches(
+  column_view const& values,
+  size_type const* group_indices,
+  size_type num_groups,
+  int precision,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Merges HyperLogLog sketches of the same precision by group, keeping
+ * the maximum of every register
+ *
+ * @throws cudf::logic_error if `sketches` is not a column of sketches of `precision`
+ *
+ * @param sketches The sketches to merge, as returned by `hyperloglog_sketches`
+ * @param group_indices Group of every sketch. Sketches of a negative group are skipped.
+ * @param num_groups The number of groups
+ * @param precision log2 of the number of registers of a sketch
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return LIST column of the `num_groups` merged sketches
+ */
+std::unique_ptr<column> merge_hyperloglog_sketches(
+  column_view const& sketches,
+  size_type const* group_indices,
+  size_type num_groups,
+  int precision,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Estimates the number of distinct values of every HyperLogLog sketch
+ *
+ * @throws cudf::logic_error if `sketches` is not a column of sketches of `precision`
+ *
+ * @param sketches The sketches, as returned by `hyperloglog_sketches`
+ * @param precision log2 of the number of registers of a sketch
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return INT64 column of the estimated counts
+ */
+std::unique_ptr<column> hyperloglog_estimates(
+  column_view const& sketches,
+  int precision,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Estimates the number of distinct values of a column from its
+ * HyperLogLog sketch
+ *
+ * @param values The values to count
+ * @param precision log2 of the number of registers of the sketch
+ * @param null_handling Indicates if nulls are counted, as one distinct value
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The estimated number of distinct values
+ */
+int64_t approx_distinct_count(column_view const& values,
+                              int precision,
+                              null_policy null_handling,
+                              cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace cudf
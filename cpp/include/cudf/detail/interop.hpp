@@ -43,6 +43,23 @@ DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                            cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::to_dlpack(std::unique_ptr<column>, size_type, cudaStream_t)
+ */
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input,
+                           size_type num_columns = 1,
+                           cudaStream_t stream   = 0);
+
+/**
+ * @copydoc cudf::to_dlpack(contiguous_split_result&&, cudaStream_t)
+ */
+DLManagedTensor* to_dlpack(contiguous_split_result&& input, cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::from_dlpack_view
+ */
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor);
+
 // Creating arrow as per given type_id and buffer arguments
 template <typename... Ts>
 std::shared_ptr<arrow::Array> to_arrow_array(cudf::type_id id, Ts&&... args)
@@ -113,5 +130,15 @@ std::unique_ptr<table> from_arrow(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::from_arrow_view
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+arrow_table_view from_arrow_view(
+  std::shared_ptr<arrow::Table const> const& input_table,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace cudf
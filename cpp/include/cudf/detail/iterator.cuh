@@ -103,6 +103,48 @@ struct validity_accessor {
   bool operator()(cudf::size_type i) const { return col.is_valid_nocheck(i); }
 };
 
+/**
+ * @brief validity word accessor of column with null bitmask
+ * A unary functor returns the validity of 32 consecutive rows at word `id`.
+ * `operator() (cudf::size_type id)` returns a word whose bit `j` is the validity of row
+ * `32 * id + j`, with the column's offset applied. Bits of rows past the end of the column are
+ * unset. This functor is only allowed for nullable columns.
+ *
+ * @throws cudf::logic_error if the column is not nullable.
+ */
+struct validity_word_accessor {
+  column_device_view const col;
+
+  /**
+   * @brief constructor
+   * @param[in] _col column device view of cudf column
+   */
+  validity_word_accessor(column_device_view const& _col) : col{_col}
+  {
+    // verify valid is non-null, otherwise, get_mask_word() will crash
+    CUDF_EXPECTS(_col.nullable(), "Unexpected non-nullable column.");
+  }
+
+  CUDA_DEVICE_CALLABLE
+  bitmask_type operator()(cudf::size_type i) const
+  {
+    constexpr size_type word_size{size_in_bits<bitmask_type>()};
+    auto const first_bit = col.offset() + i * word_size;
+    auto const end_bit   = col.offset() + col.size();
+    auto const word      = word_index(first_bit);
+    auto const shift     = intra_word_index(first_bit);
+
+    // an unaligned word straddles two words of the mask, unless the column ends in the first
+    uint64_t bits = col.get_mask_word(word);
+    if (shift > 0 && first_bit - shift + word_size < end_bit) {
+      bits |= static_cast<uint64_t>(col.get_mask_word(word + 1)) << word_size;
+    }
+    auto const valid    = static_cast<bitmask_type>(bits >> shift);
+    auto const num_rows = end_bit - first_bit;
+    return num_rows < word_size ? valid & set_least_significant_bits(num_rows) : valid;
+  }
+};
+
 /**
  * @brief Constructs an iterator over a column's values that replaces null
  * elements with a specified value.
@@ -174,6 +216,27 @@ auto inline make_validity_iterator(column_device_view const& column)
                                          validity_accessor{column});
 }
 
+/**
+ * @brief Constructs an iterator over the words of a column's validities.
+ *
+ * Dereferencing the returned iterator for word `i` returns the validities of the 32 rows
+ * `column[32 * i]` to `column[32 * i + 31]`, one bit per row, the least significant first.
+ * Bits of rows past the end of the column are unset. This lets a warp load the validities of
+ * its 32 rows once rather than once per row, and handle words of all valid or all null rows
+ * without testing each bit.
+ * This iterator is only allowed for nullable columns.
+ *
+ * @throws cudf::logic_error if the column is not nullable.
+ *
+ * @param column The column to iterate
+ * @return auto Iterator that returns validity words of column elements.
+ */
+auto inline make_validity_word_iterator(column_device_view const& column)
+{
+  return thrust::make_transform_iterator(thrust::counting_iterator<cudf::size_type>{0},
+                                         validity_word_accessor{column});
+}
+
 /**
  * @brief value accessor for scalar with valid data.
  * The unary functor returns data of Element type of the scalar.
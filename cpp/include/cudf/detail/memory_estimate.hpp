@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Returns the size of a device allocation of `bytes` bytes, rounded up to the 256 byte
+ * alignment of the RMM memory resources.
+ */
+std::size_t allocation_size(std::size_t bytes);
+
+/**
+ * @brief Returns the device memory of a copy of `input`, as made by `cudf::table(input)`, in
+ * bytes. This is also the size of any permutation of the rows of `input`, such as its sort.
+ *
+ * Only the rows in the view are counted, e.g. the characters of the strings of a sliced strings
+ * column.
+ *
+ * @param input The table to size
+ * @param stream CUDA stream used to read the offsets of strings and lists columns
+ */
+std::size_t copy_size(table_view const& input, cudaStream_t stream = 0);
+
+/**
+ * @copydoc copy_size(table_view const&, cudaStream_t)
+ */
+std::size_t copy_size(column_view const& input, cudaStream_t stream = 0);
+
+/**
+ * @brief Returns an upper bound on the device memory of `num_rows` rows gathered from `input`,
+ * in bytes.
+ *
+ * The rows may be gathered any number of times, so every strings or lists row is counted as large
+ * as the largest row of its column.
+ *
+ * @param input The table gathered from
+ * @param num_rows The number of gathered rows
+ * @param nullable Whether all the gathered columns have a null mask, e.g. for the unmatched rows
+ * of an outer join, even if the columns of `input` do not
+ * @param stream CUDA stream used to compute the largest rows of strings and lists columns
+ */
+std::size_t gather_size_upper_bound(table_view const& input,
+                                    std::size_t num_rows,
+                                    bool nullable,
+                                    cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace cudf
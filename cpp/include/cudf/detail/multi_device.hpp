@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/multi_device.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Makes a device current for the lifetime of the object, restoring the previous one
+ */
+class device_guard {
+ public:
+  explicit device_guard(int device);
+  ~device_guard();
+
+  device_guard(device_guard const&) = delete;
+  device_guard& operator=(device_guard const&) = delete;
+
+ private:
+  int _previous{0};
+};
+
+/**
+ * @brief Returns the memory resource of `resources`, or the per-device resource of its device
+ */
+rmm::mr::device_memory_resource* memory_resource_of(device_resources const& resources);
+
+/**
+ * @brief A table in one contiguous block of the memory of a device
+ */
+struct device_partition {
+  table_view view;
+  std::unique_ptr<rmm::device_buffer> data;
+};
+
+/**
+ * @brief Copies a contiguous split to the device of `target` with one `cudaMemcpyPeerAsync`.
+ *
+ * The copy is ordered after the work on `source_stream`, and the work submitted to
+ * `source_stream` afterwards, including freeing `split`, is ordered after the copy. Peer access
+ * between the devices is enabled if they support it.
+ *
+ * @param split The table to copy, on `source_device`
+ * @param source_device The device of `split`
+ * @param source_stream The stream of the work producing `split`
+ * @param target The device, stream and memory resource of the copy
+ * @return The copy, valid on `target.stream`
+ */
+device_partition copy_to_device(contiguous_split_result const& split,
+                                int source_device,
+                                cudaStream_t source_stream,
+                                device_resources const& target);
+
+/**
+ * @brief Runs `fn(i)` for every device `i` of `devices` concurrently, each on a host thread
+ * with `devices[i].device` current, and returns the results in order.
+ *
+ * All calls complete before the first exception thrown by one of them is rethrown.
+ */
+template <typename Function>
+auto for_each_device(std::vector<device_resources> const& devices, Function fn)
+  -> std::vector<decltype(fn(size_type{0}))>
+{
+  std::vector<std::future<decltype(fn(size_type{0}))>> futures;
+  for (size_type i = 0; i < static_cast<size_type>(devices.size()); ++i) {
+    futures.push_back(std::async(std::launch::async, [&devices, &fn, i]() {
+      device_guard guard(devices[i].device);
+      return fn(i);
+    }));
+  }
+  for (auto& f : futures) { f.wait(); }
+  std::vector<decltype(fn(size_type{0}))> results;
+  for (auto& f : futures) { results.push_back(f.get()); }
+  return results;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -55,6 +55,22 @@ rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
                                cudaStream_t stream,
                                rmm::mr::device_memory_resource *mr);
 
+/**
+ * @brief Returns a bitwise OR of the specified bitmasks
+ *
+ * @param masks The list of data pointers of the bitmasks to be ORed
+ * @param begin_bits The bit offsets from which each mask is to be ORed
+ * @param mask_size The number of bits to be ORed in each mask
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return rmm::device_buffer Output bitmask
+ */
+rmm::device_buffer bitmask_or(std::vector<bitmask_type const *> const &masks,
+                              std::vector<size_type> const &begin_bits,
+                              size_type mask_size,
+                              cudaStream_t stream,
+                              rmm::mr::device_memory_resource *mr);
+
 /**
  * @brief Performs a bitwise AND of the specified bitmasks,
  *        and writes in place to destination
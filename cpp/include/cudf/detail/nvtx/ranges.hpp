@@ -52,3 +52,50 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  *
  */
 #define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+
+#define CUDF_NVTX_CONCAT_IMPL(a, b) a##b
+#define CUDF_NVTX_CONCAT(a, b) CUDF_NVTX_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Convenience macro for generating a named NVTX range in the `libcudf`
+ * domain from the remainder of the enclosing scope.
+ *
+ * Marks the stages of an operation, which nest inside the range of the
+ * operation.
+ *
+ * Example:
+ * ```
+ * void some_function(){
+ *    CUDF_FUNC_RANGE();
+ *    {
+ *      CUDF_SCOPED_RANGE("some_function::stage");
+ *      ...
+ *    }
+ * }
+ * ```
+ *
+ */
+#define CUDF_SCOPED_RANGE(name) \
+  ::cudf::thread_range const CUDF_NVTX_CONCAT(cudf_scoped_range_, __LINE__){::nvtx3::message{name}}
+
+/**
+ * @brief Convenience macro for generating a named NVTX range in the `libcudf`
+ * domain from the remainder of the enclosing scope, with an integer payload.
+ *
+ * The payload is typically the number of bytes processed by the stage, and is
+ * shown next to the range by the profiler.
+ *
+ * Example:
+ * ```
+ * void read_chunks(size_t total_bytes){
+ *    CUDF_SCOPED_RANGE_PAYLOAD("reader::read_chunks", total_bytes);
+ *    ...
+ * }
+ * ```
+ *
+ */
+#define CUDF_SCOPED_RANGE_PAYLOAD(name, value)                               \
+  ::cudf::thread_range const CUDF_NVTX_CONCAT(cudf_scoped_range_, __LINE__)  \
+  {                                                                          \
+    ::nvtx3::message{name}, ::nvtx3::payload { static_cast<int64_t>(value) } \
+  }
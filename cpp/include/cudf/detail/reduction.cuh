@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
@@ -23,9 +27,12 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <cub/block/block_reduce.cuh>
 #include <cub/device/device_reduce.cuh>
 #include "reduction_operators.cuh"
 
+#include <algorithm>
+
 namespace cudf {
 namespace reduction {
 namespace detail {
@@ -141,6 +148,115 @@ std::unique_ptr<scalar> reduce(InputIterator d_in,
   CUDF_FAIL("dictionary type not supported");
 }
 
+/**
+ * @brief Reduces the valid rows of `col`, transformed by `transform`, to one partial result per
+ * block.
+ *
+ * Each warp reduces 32 rows at a time. Their validity word is loaded once by the first lane and
+ * broadcast to the others, rather than each row loading and shifting its own word. Words of all
+ * null rows load no elements, and words of all valid rows test no bits.
+ *
+ * @tparam ElementType  the input column element type
+ * @tparam block_size   the number of threads per block, a multiple of the warp size
+ */
+template <typename ElementType,
+          typename ResultType,
+          typename WordIterator,
+          typename Transformer,
+          typename BinaryOp,
+          int block_size>
+__global__ void __launch_bounds__(block_size)
+  valid_word_reduce_kernel(column_device_view col,
+                           WordIterator valid_words,
+                           Transformer transform,
+                           BinaryOp binary_op,
+                           ResultType identity,
+                           ResultType* block_results)
+{
+  constexpr size_type rows_per_word = cudf::detail::warp_size;
+  static_assert(block_size % rows_per_word == 0, "block_size must be a multiple of the warp size");
+
+  auto const lane      = static_cast<size_type>(threadIdx.x % rows_per_word);
+  auto const num_words = (col.size() + rows_per_word - 1) / rows_per_word;
+  auto const num_warps = static_cast<size_type>(gridDim.x * block_size / rows_per_word);
+
+  ResultType result = identity;
+  for (size_type word = (blockIdx.x * block_size + threadIdx.x) / rows_per_word; word < num_words;
+       word += num_warps) {
+    bitmask_type const valid = __shfl_sync(0xffff'ffff, lane == 0 ? valid_words[word] : 0, 0);
+    if (valid == 0) { continue; }
+    // rows past the end of the column are never valid
+    if (valid == ~bitmask_type{0} || (valid & (bitmask_type{1} << lane))) {
+      result = binary_op(result, transform(col.element<ElementType>(word * rows_per_word + lane)));
+    }
+  }
+
+  using BlockReduce = cub::BlockReduce<ResultType, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  result = BlockReduce(temp_storage).Reduce(result, binary_op);
+  if (threadIdx.x == 0) { block_results[blockIdx.x] = result; }
+}
+
+/** --------------------------------------------------------------------------*
+ * @brief Compute the specified simple reduction over the valid rows of a nullable column,
+ * loading their validities a word at a time.
+ *
+ * This does the same as reducing a null replacing iterator over `col`, without the per element
+ * bitmask loads of the iterator.
+ *
+ * @param[in] col       the nullable column
+ * @param[in] sop       the reduction operator
+ * @param[in] stream    CUDA stream used for device memory operations and kernel launches.
+ * @returns   Output scalar in device memory
+ *
+ * @tparam ElementType  the input column element type
+ * @tparam ResultType   the output type of reduction
+ * @tparam Op           the reduction operator with device binary operator
+ * ----------------------------------------------------------------------------**/
+template <typename ElementType,
+          typename ResultType,
+          typename Op,
+          typename std::enable_if_t<is_fixed_width<ResultType>()>* = nullptr>
+std::unique_ptr<scalar> reduce_valid_rows(column_device_view const& col,
+                                          op::simple_op<Op> sop,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  constexpr int block_size{256};
+  constexpr size_type rows_per_block{block_size};
+  auto binary_op         = sop.get_binary_op();
+  auto transform         = sop.template get_element_transformer<ResultType>();
+  ResultType identity    = sop.template get_identity<ResultType>();
+  auto const valid_words = cudf::detail::make_validity_word_iterator(col);
+  auto const kernel      = valid_word_reduce_kernel<ElementType,
+                                                    ResultType,
+                                                    decltype(valid_words),
+                                                    decltype(transform),
+                                                    decltype(binary_op),
+                                                    block_size>;
+
+  int blocks_per_sm{-1};
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(&blocks_per_sm, kernel, block_size, 0));
+
+  int dev_id{-1};
+  CUDA_TRY(cudaGetDevice(&dev_id));
+
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
+
+  // enough blocks to fill the device, each reducing its rows in a grid stride loop
+  auto const num_blocks = std::max(
+    1, std::min(blocks_per_sm * num_sms, (col.size() + rows_per_block - 1) / rows_per_block));
+  rmm::device_buffer block_results{num_blocks * sizeof(ResultType), stream};
+  auto const d_block_results = static_cast<ResultType*>(block_results.data());
+
+  kernel<<<num_blocks, block_size, 0, stream>>>(
+    col, valid_words, transform, binary_op, identity, d_block_results);
+  CHECK_CUDA(stream);
+
+  return reduce(d_block_results, num_blocks, sop, mr, stream);
+}
+
 /** --------------------------------------------------------------------------*
  * @brief compute reduction by the compound operator (reduce and transform)
  *
@@ -16,9 +16,14 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/column/indexed_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace reduction {
 /**
@@ -35,7 +40,7 @@ namespace reduction {
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return Sum as scalar of type `output_dtype`.
  */
-std::unique_ptr<scalar> sum(column_view const& col,
+std::unique_ptr<scalar> sum(indexed_column_view const& col,
                             data_type const output_dtype,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                             cudaStream_t stream                 = 0);
@@ -52,7 +57,7 @@ std::unique_ptr<scalar> sum(column_view const& col,
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return Minimum element as scalar of type `output_dtype`.
  */
-std::unique_ptr<scalar> min(column_view const& col,
+std::unique_ptr<scalar> min(indexed_column_view const& col,
                             data_type const output_dtype,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                             cudaStream_t stream                 = 0);
@@ -69,7 +74,7 @@ std::unique_ptr<scalar> min(column_view const& col,
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return Maximum element as scalar of type `output_dtype`.
  */
-std::unique_ptr<scalar> max(column_view const& col,
+std::unique_ptr<scalar> max(indexed_column_view const& col,
                             data_type const output_dtype,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                             cudaStream_t stream                 = 0);
@@ -87,7 +92,7 @@ std::unique_ptr<scalar> max(column_view const& col,
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return bool scalar if any of elements is true when typecasted to bool
  */
-std::unique_ptr<scalar> any(column_view const& col,
+std::unique_ptr<scalar> any(indexed_column_view const& col,
                             data_type const output_dtype,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                             cudaStream_t stream                 = 0);
@@ -105,7 +110,7 @@ std::unique_ptr<scalar> any(column_view const& col,
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return bool scalar if all of elements is true when typecasted to bool
  */
-std::unique_ptr<scalar> all(column_view const& col,
+std::unique_ptr<scalar> all(indexed_column_view const& col,
                             data_type const output_dtype,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                             cudaStream_t stream                 = 0);
@@ -124,7 +129,7 @@ std::unique_ptr<scalar> all(column_view const& col,
  * @return Product as scalar of type `output_dtype`.
  */
 std::unique_ptr<scalar> product(
-  column_view const& col,
+  indexed_column_view const& col,
   data_type const output_dtype,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
@@ -144,7 +149,7 @@ std::unique_ptr<scalar> product(
  * @return Sum of squares as scalar of type `output_dtype`.
  */
 std::unique_ptr<scalar> sum_of_squares(
-  column_view const& col,
+  indexed_column_view const& col,
   data_type const output_dtype,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
@@ -210,5 +215,66 @@ std::unique_ptr<scalar> standard_deviation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns whether `fused_reduce()` computes the aggregation `kind` of a column of `type`
+ */
+bool is_fusable(aggregation::Kind kind, data_type type);
+
+/**
+ * @brief Computes the reductions `aggs` of the input column in a single pass
+ *
+ * The sums are accumulated in 64 bits: in `double` for floating point inputs or outputs, in
+ * `int64_t` otherwise. If all elements in input column are null, the output scalars are null
+ * except the counts.
+ *
+ * @throw cudf::logic_error if `is_fusable(aggs[i]->kind, col.type())` is false for some `i`
+ * @throw cudf::logic_error if an output type is not arithmetic, or not floating point for `mean`,
+ * `var` and `std`
+ *
+ * @param col input column to reduce
+ * @param aggs the aggregations to compute
+ * @param output_dtypes data type of the result of each aggregation
+ * @param mr Device memory resource used to allocate the returned scalars' device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The result of each aggregation, in the order of `aggs`
+ */
+std::vector<std::unique_ptr<scalar>> fused_reduce(
+  column_view const& col,
+  std::vector<aggregation const*> const& aggs,
+  std::vector<data_type> const& output_dtypes,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Computes the reduction `agg` of each segment `[d_offsets[i], d_offsets[i + 1])` of
+ * `values`
+ *
+ * A segment is also null in the output if its bit in `segment_null_mask` is unset, which lets
+ * the rows of a lists column be reduced over its child column.
+ *
+ * @param values input column holding the elements of all the segments
+ * @param d_offsets device array of `num_segments + 1` offsets into `values`
+ * @param num_segments number of segments, and rows of the output
+ * @param agg the aggregation applied to each segment
+ * @param output_dtype data type of the output column
+ * @param null_handling whether a null element makes the result of its segment null
+ * @param segment_null_mask optional validity of the segments, or nullptr if all are valid
+ * @param segment_mask_offset index of the bit of the first segment in `segment_null_mask`
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Column with the reduction of each segment
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const& values,
+  size_type const* d_offsets,
+  size_type num_segments,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  null_policy null_handling,
+  bitmask_type const* segment_null_mask = nullptr,
+  size_type segment_mask_offset         = 0,
+  rmm::mr::device_memory_resource* mr   = rmm::mr::get_default_resource(),
+  cudaStream_t stream                   = 0);
+
 }  // namespace reduction
 }  // namespace cudf
@@ -47,6 +47,15 @@ std::unique_ptr<column> replace_nulls(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::replace_nulls_in_place
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void replace_nulls_in_place(mutable_column_view& input,
+                            scalar const& replacement,
+                            cudaStream_t stream = 0);
+
 /**
  * @copydoc cudf::replace_nans(column_view const&, column_view const&,
  * rmm::mr::device_memory_resource*)
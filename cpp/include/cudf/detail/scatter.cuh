@@ -18,6 +18,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
@@ -25,8 +26,11 @@
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/strings/detail/scatter.cuh>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/utilities/traits.hpp>
 
+#include <thrust/sequence.h>
+
 namespace cudf {
 namespace detail {
 
@@ -168,6 +172,95 @@ struct column_scatterer_impl<dictionary32, MapIterator> {
   }
 };
 
+/**
+ * @brief Column scatter specialization for list_view column type.
+ *
+ * The source rows are appended to the target rows and the scatter becomes a gather from the
+ * combined column, so lists at any depth of nesting reuse the nested gather.
+ */
+template <typename MapIterator>
+struct column_scatterer_impl<list_view, MapIterator> {
+  std::unique_ptr<column> operator()(column_view const& source,
+                                     MapIterator scatter_map_begin,
+                                     MapIterator scatter_map_end,
+                                     column_view const& target,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const
+  {
+    auto const combined = concatenate(
+      std::vector<column_view>{target, source}, rmm::mr::get_default_resource(), stream);
+
+    // untouched rows gather themselves from the target; row `i` of the source is at
+    // `target.size() + i` in the combined column
+    auto gather_map = rmm::device_vector<size_type>(target.size());
+    thrust::sequence(rmm::exec_policy(stream)->on(stream), gather_map.begin(), gather_map.end());
+    auto const source_begin = thrust::make_counting_iterator<size_type>(target.size());
+    thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                    source_begin,
+                    source_begin + std::distance(scatter_map_begin, scatter_map_end),
+                    scatter_map_begin,
+                    gather_map.begin());
+
+    auto result = gather(
+      table_view{{combined->view()}}, gather_map.begin(), gather_map.end(), false, mr, stream);
+    return std::move(result->release().front());
+  }
+};
+
+template <typename MapIterator>
+std::unique_ptr<table> scatter(
+  table_view const& source,
+  MapIterator scatter_map_begin,
+  MapIterator scatter_map_end,
+  table_view const& target,
+  bool check_bounds                   = false,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Column scatter specialization for struct column
+ *
+ * The fields are scattered as a table with the same scatter map. The null mask of the struct
+ * column is copied from the target here and scattered with the other columns of the source table.
+ */
+template <typename MapIterator>
+struct column_scatterer_impl<struct_view, MapIterator> {
+  std::unique_ptr<column> operator()(column_view const& source,
+                                     MapIterator scatter_map_begin,
+                                     MapIterator scatter_map_end,
+                                     column_view const& target,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const
+  {
+    structs_column_view const source_structs(source);
+    structs_column_view const target_structs(target);
+    CUDF_EXPECTS(source_structs.num_children() == target_structs.num_children(),
+                 "Scatter source and target struct columns must have the same fields");
+
+    std::vector<column_view> source_fields;
+    std::vector<column_view> target_fields;
+    for (size_type i = 0; i < target_structs.num_children(); ++i) {
+      source_fields.push_back(source_structs.get_sliced_child(i));
+      target_fields.push_back(target_structs.get_sliced_child(i));
+    }
+    auto scattered_fields = scatter(table_view{source_fields},
+                                    scatter_map_begin,
+                                    scatter_map_end,
+                                    table_view{target_fields},
+                                    false,
+                                    mr,
+                                    stream)
+                              ->release();
+
+    return make_structs_column(target.size(),
+                               std::move(scattered_fields),
+                               target.null_count(),
+                               copy_bitmask(target, stream, mr),
+                               stream,
+                               mr);
+  }
+};
+
 template <typename MapIterator>
 struct column_scatterer {
   template <typename Element>
@@ -218,14 +311,13 @@ struct column_scatterer {
  * @return Result of scattering values from source to target
  **/
 template <typename MapIterator>
-std::unique_ptr<table> scatter(
-  table_view const& source,
-  MapIterator scatter_map_begin,
-  MapIterator scatter_map_end,
-  table_view const& target,
-  bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-  cudaStream_t stream                 = 0)
+std::unique_ptr<table> scatter(table_view const& source,
+                               MapIterator scatter_map_begin,
+                               MapIterator scatter_map_end,
+                               table_view const& target,
+                               bool check_bounds,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
 
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief A table in one contiguous block of device memory, that can be moved out to pinned host
+ * memory and back
+ */
+class spillable_partition {
+ public:
+  /**
+   * @brief Takes ownership of the memory of `split`
+   *
+   * @param split The table and its memory
+   * @param mr Device memory resource used to allocate the device memory of the partition when it
+   * is copied back to the device
+   */
+  explicit spillable_partition(
+    contiguous_split_result&& split,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Returns the view of the partition, copying it back to the device if it was spilled
+   *
+   * @throw std::bad_alloc if the partition cannot be copied back to the device
+   */
+  table_view view(cudaStream_t stream = 0);
+
+  /**
+   * @brief Moves the partition to pinned host memory, releasing its device memory
+   */
+  void spill(cudaStream_t stream = 0);
+
+  /**
+   * @brief Releases the memory of the partition; the partition cannot be used afterwards
+   */
+  void release();
+
+  bool is_spilled() const { return _data == nullptr && _host_data != nullptr; }
+
+  /**
+   * @brief Returns the size of the memory of the partition, in device or host memory, in bytes
+   */
+  size_t size() const { return is_spilled() ? _host_size : (_data ? _data->size() : 0); }
+
+ private:
+  using pinned_buffer = std::unique_ptr<uint8_t, decltype(&cudaFreeHost)>;
+
+  table_view _view;
+  std::unique_ptr<rmm::device_buffer> _data;
+  rmm::mr::device_memory_resource* _mr;
+  pinned_buffer _host_data{nullptr, cudaFreeHost};
+  size_t _host_size          = 0;
+  void const* _spilled_base = nullptr;  // Device address that the views referred to
+};
+
+/**
+ * @brief Hash partitions `input` on the `on` columns into separately spillable partitions
+ *
+ * @param input The table to partition
+ * @param on The column indices of `input` to hash
+ * @param num_partitions The number of partitions
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The `num_partitions` partitions of `input`
+ */
+std::vector<spillable_partition> make_spillable_partitions(table_view const& input,
+                                                           std::vector<size_type> const& on,
+                                                           size_type num_partitions,
+                                                           cudaStream_t stream = 0);
+
+/**
+ * @brief Moves the memory of `input` into a spillable partition
+ *
+ * @param input The table to copy into one contiguous block of device memory
+ * @param mr Device memory resource used to allocate the device memory of the partition
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+spillable_partition make_spillable_partition(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Rebuilds a view of the memory of a contiguous split after that memory has been moved
+ *
+ * @param col A column viewing the `size` bytes at `old_base`
+ * @param old_base The address the memory was moved from
+ * @param size The size of the memory in bytes
+ * @param new_base The address the memory was moved to
+ * @return `col` with its buffers in the moved memory; buffers outside of it are kept
+ */
+column_view rebase_column(column_view const& col,
+                          uint8_t const* old_base,
+                          size_t size,
+                          uint8_t const* new_base);
+
+/**
+ * @brief Returns the number of partitions to use, not less than `n`, when every partition is
+ * processed with a hash table
+ *
+ * The partitions and the hash tables built on them use the same row hash, so a partition count
+ * with a common factor with the hash table sizes would leave most of the slots unused. The
+ * returned count is the smallest prime that is not less than `n`.
+ */
+size_type hash_table_partition_count(size_type n);
+
+}  // namespace detail
+}  // namespace cudf
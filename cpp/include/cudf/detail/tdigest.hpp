@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Computes the t-digest of the valid values of every group
+ *
+ * The values of every group are ordered, and every value joins the centroid
+ * given by the arcsine scale function of its quantile in the group, so that a
+ * digest has at most `max_centroids` centroids, smallest at the extremes.
+ *
+ * @throws cudf::logic_error if `values` is not numeric
+ *
+ * @param values The values to digest
+ * @param group_indices Group of every row of `values`, or `nullptr` if all rows
+ * are in a single group. Rows of a negative group are skipped.
+ * @param num_groups The number of groups
+ * @param max_centroids The maximum number of centroids of a digest
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return LIST column of `num_groups` digests, each the FLOAT64 `mean, weight`
+ * pairs of its centroids in increasing order of mean
+ */
+std::unique_ptr<column> tdigests(
+  column_view const& values,
+  size_type const* group_indices,
+  size_type num_groups,
+  int max_centroids,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Merges t-digests by group, clustering the centroids of all digests of
+ * a group again
+ *
+ * @throws cudf::logic_error if `digests` is not a column of t-digests
+ *
+ * @param digests The digests to merge, as returned by `tdigests`
+ * @param group_indices Group of every digest. Digests of a negative group are skipped.
+ * @param num_groups The number of groups
+ * @param max_centroids The maximum number of centroids of a merged digest
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return LIST column of the `num_groups` merged digests
+ */
+std::unique_ptr<column> merge_tdigests(
+  column_view const& digests,
+  size_type const* group_indices,
+  size_type num_groups,
+  int max_centroids,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Estimates quantiles of every t-digest
+ *
+ * A quantile is interpolated linearly between the means of the two centroids
+ * whose centers of mass surround it, and clamped to the means of the first and
+ * last centroids. The quantiles of an empty digest are null.
+ *
+ * @throws cudf::logic_error if `digests` is not a column of t-digests
+ *
+ * @param digests The digests, as returned by `tdigests`
+ * @param quantiles The desired quantiles, in `[0, 1]`
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return FLOAT64 column of the quantiles of every digest, in the order of the
+ * digests then of `quantiles`
+ */
+std::unique_ptr<column> tdigest_quantiles(
+  column_view const& digests,
+  std::vector<double> const& quantiles,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace cudf
@@ -68,6 +68,34 @@ std::unique_ptr<cudf::column> unary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Maximum number of operations `unary_operation` fuses into one kernel.
+ */
+constexpr size_type max_fused_unary_ops = 16;
+
+/**
+ * @copydoc cudf::unary_operation(cudf::column_view const&, std::vector<cudf::unary_op> const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::column> unary_operation(
+  cudf::column_view const& input,
+  std::vector<cudf::unary_op> const& ops,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::unary_operation(cudf::column_view const&, std::vector<cudf::unary_op> const&,
+ * cudf::mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void unary_operation(cudf::column_view const& input,
+                     std::vector<cudf::unary_op> const& ops,
+                     cudf::mutable_column_view& output,
+                     cudaStream_t stream = 0);
+
 /**
  * @copydoc cudf::cast
  *
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/string_view.cuh>
 #include <hash/hash_constants.hpp>
 
@@ -132,6 +133,47 @@ struct MD5Hash {
     }
   }
 
+  /**
+   * @brief Warp-cooperative version of processing a string's bytes.
+   *
+   * The lanes of the warp copy each 64-byte chunk into the buffer together and
+   * the first lane runs `hash_step` on it. The `hash_state` must be in memory
+   * visible to the whole warp and all lanes must call this function.
+   *
+   * @param data Bytes to add to the hash.
+   * @param len Number of bytes in `data`.
+   * @param hash_state Running hash state shared by the warp.
+   * @param lane Lane of the calling thread within its warp.
+   */
+  void __device__ process_warp(uint8_t const* data,
+                               uint32_t len,
+                               md5_intermediate_data* hash_state,
+                               int lane) const
+  {
+    // 64 bytes for the number of bytes processed in a given step
+    constexpr uint32_t md5_chunk_size = 64;
+    if (lane == 0) hash_state->message_length += len;
+
+    uint32_t position = 0;
+    while (position < len) {
+      uint32_t const buffer_length = hash_state->buffer_length;
+      uint32_t const copylen       = std::min(md5_chunk_size - buffer_length, len - position);
+      for (uint32_t idx = lane; idx < copylen; idx += warp_size) {
+        hash_state->buffer[buffer_length + idx] = data[position + idx];
+      }
+      __syncwarp();
+      if (lane == 0) {
+        if (buffer_length + copylen == md5_chunk_size) {
+          hash_step(hash_state);
+        } else {
+          hash_state->buffer_length = buffer_length + copylen;
+        }
+      }
+      __syncwarp();
+      position += copylen;
+    }
+  }
+
   void __device__ finalize(md5_intermediate_data* hash_state, char* result_location) const
   {
     auto const full_length = (static_cast<uint64_t>(hash_state->message_length)) << 3;
@@ -262,6 +304,8 @@ struct MurmurHash3_32 {
 
   CUDA_HOST_DEVICE_CALLABLE MurmurHash3_32() : m_seed(0) {}
 
+  CUDA_HOST_DEVICE_CALLABLE MurmurHash3_32(uint32_t seed) : m_seed(seed) {}
+
   CUDA_HOST_DEVICE_CALLABLE uint32_t rotl32(uint32_t x, int8_t r) const
   {
     return (x << r) | (x >> (32 - r));
@@ -437,6 +481,229 @@ MurmurHash3_32<double>::operator()(double const& key) const
   return this->compute_floating_point(key);
 }
 
+/**
+ * @brief Returns the value Spark hashes in place of a fixed-width `key`.
+ *
+ * Integers narrower than 32 bits are hashed as `int`. Floating-point `-0.0` is
+ * hashed as `0.0` and every NaN as the canonical quiet NaN, which is what Java's
+ * `floatToIntBits` and `doubleToLongBits` produce.
+ */
+template <typename T,
+          std::enable_if_t<std::is_integral<T>::value && (sizeof(T) < 4)>* = nullptr>
+CUDA_HOST_DEVICE_CALLABLE int32_t spark_hash_key(T const& key)
+{
+  return static_cast<int32_t>(key);
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+CUDA_HOST_DEVICE_CALLABLE T spark_hash_key(T const& key)
+{
+  if (isnan(key)) { return std::numeric_limits<T>::quiet_NaN(); }
+  return key == T{0.0} ? T{0.0} : key;
+}
+
+template <typename T,
+          std::enable_if_t<!std::is_floating_point<T>::value &&
+                           !(std::is_integral<T>::value && (sizeof(T) < 4))>* = nullptr>
+CUDA_HOST_DEVICE_CALLABLE T spark_hash_key(T const& key)
+{
+  return key;
+}
+
+/**
+ * @brief MurmurHash3_32 variant that matches Spark's `Murmur3Hash` expression.
+ *
+ * Fixed-width keys are hashed as the standard MurmurHash3_32 of the bytes of
+ * `spark_hash_key(key)`. Strings differ from the standard in how the trailing
+ * bytes are mixed: Spark mixes each of them separately as a sign-extended `int`.
+ */
+template <typename Key>
+struct SparkMurmurHash3_32 {
+  using argument_type = Key;
+  using result_type   = hash_value_type;
+
+  CUDA_HOST_DEVICE_CALLABLE SparkMurmurHash3_32() : m_seed(0) {}
+
+  CUDA_HOST_DEVICE_CALLABLE SparkMurmurHash3_32(uint32_t seed) : m_seed(seed) {}
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const
+  {
+    auto const normalized = spark_hash_key(key);
+    return MurmurHash3_32<std::decay_t<decltype(normalized)>>{m_seed}.compute(normalized);
+  }
+
+ private:
+  uint32_t m_seed;
+};
+
+/**
+ * @brief Specialization of SparkMurmurHash3_32 operator for strings.
+ */
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+#ifndef __CUDA_ARCH__
+  CUDF_FAIL("Hashing a string in host code is not supported.");
+#else
+  MurmurHash3_32<cudf::string_view> const murmur{};
+  constexpr uint32_t c1 = 0xcc9e2d51;
+  constexpr uint32_t c2 = 0x1b873593;
+  auto const mix        = [murmur] __device__(uint32_t h1, uint32_t k1) {
+    k1 *= c1;
+    k1 = murmur.rotl32(k1, 15);
+    k1 *= c2;
+    h1 ^= k1;
+    h1 = murmur.rotl32(h1, 13);
+    return h1 * 5 + 0xe6546b64;
+  };
+
+  auto const len     = key.size_bytes();
+  auto const data    = reinterpret_cast<uint8_t const*>(key.data());
+  auto const nblocks = len / 4;
+  uint32_t h1        = m_seed;
+  for (cudf::size_type i = 0; i < nblocks; ++i) {
+    auto const q = data + i * 4;
+    h1           = mix(h1, q[0] | (q[1] << 8) | (q[2] << 16) | (q[3] << 24));
+  }
+  for (cudf::size_type i = nblocks * 4; i < len; ++i) {
+    h1 = mix(h1, static_cast<uint32_t>(static_cast<int32_t>(static_cast<int8_t>(data[i]))));
+  }
+  h1 ^= len;
+  return murmur.fmix32(h1);
+#endif
+}
+
+// xxHash64 implementation from
+// https://github.com/Cyan4973/xxHash
+//-----------------------------------------------------------------------------
+// xxHash is written by Yann Collet and released under the BSD 2-Clause License.
+/**
+ * @brief xxHash64 hash functor that matches Spark's `XxHash64` expression.
+ *
+ * Fixed-width keys are hashed as the bytes of `spark_hash_key(key)` and strings
+ * as their UTF-8 bytes.
+ */
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  CUDA_HOST_DEVICE_CALLABLE XXHash_64() : m_seed(0) {}
+
+  CUDA_HOST_DEVICE_CALLABLE XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const
+  {
+    auto const normalized = spark_hash_key(key);
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&normalized), sizeof(normalized));
+  }
+
+  /**
+   * @brief Computes the xxHash64 of `len` bytes starting at `data`.
+   *
+   * The bytes are read individually so `data` need not be aligned.
+   */
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_bytes(uint8_t const* data, uint32_t len) const
+  {
+    constexpr uint64_t prime1 = 0x9E3779B185EBCA87ul;
+    constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Ful;
+    constexpr uint64_t prime3 = 0x165667B19E3779F9ul;
+    constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ul;
+    constexpr uint64_t prime5 = 0x27D4EB2F165667C5ul;
+
+    auto const round = [] __host__ __device__(uint64_t acc, uint64_t input) {
+      acc += input * prime2;
+      acc = rotl64(acc, 31);
+      return acc * prime1;
+    };
+    auto const merge_round = [round] __host__ __device__(uint64_t acc, uint64_t value) {
+      acc ^= round(0, value);
+      return acc * prime1 + prime4;
+    };
+
+    uint32_t offset = 0;
+    uint64_t h64;
+    //----------
+    // body
+    if (len >= 32) {
+      uint64_t v1 = m_seed + prime1 + prime2;
+      uint64_t v2 = m_seed + prime2;
+      uint64_t v3 = m_seed;
+      uint64_t v4 = m_seed - prime1;
+      for (; offset + 32 <= len; offset += 32) {
+        v1 = round(v1, getblock64(data + offset));
+        v2 = round(v2, getblock64(data + offset + 8));
+        v3 = round(v3, getblock64(data + offset + 16));
+        v4 = round(v4, getblock64(data + offset + 24));
+      }
+      h64 = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+      h64 = merge_round(h64, v1);
+      h64 = merge_round(h64, v2);
+      h64 = merge_round(h64, v3);
+      h64 = merge_round(h64, v4);
+    } else {
+      h64 = m_seed + prime5;
+    }
+    h64 += len;
+    //----------
+    // tail
+    for (; offset + 8 <= len; offset += 8) {
+      h64 ^= round(0, getblock64(data + offset));
+      h64 = rotl64(h64, 27) * prime1 + prime4;
+    }
+    if (offset + 4 <= len) {
+      h64 ^= static_cast<uint64_t>(getblock32(data + offset)) * prime1;
+      h64 = rotl64(h64, 23) * prime2 + prime3;
+      offset += 4;
+    }
+    for (; offset < len; ++offset) {
+      h64 ^= data[offset] * prime5;
+      h64 = rotl64(h64, 11) * prime1;
+    }
+    //----------
+    // finalization
+    h64 ^= h64 >> 33;
+    h64 *= prime2;
+    h64 ^= h64 >> 29;
+    h64 *= prime3;
+    h64 ^= h64 >> 32;
+    return h64;
+  }
+
+ private:
+  static CUDA_HOST_DEVICE_CALLABLE uint64_t rotl64(uint64_t x, int8_t r)
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  static CUDA_HOST_DEVICE_CALLABLE uint32_t getblock32(uint8_t const* p)
+  {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+  }
+
+  static CUDA_HOST_DEVICE_CALLABLE uint64_t getblock64(uint8_t const* p)
+  {
+    return getblock32(p) | (static_cast<uint64_t>(getblock32(p + 4)) << 32);
+  }
+
+  uint64_t m_seed;
+};
+
+/**
+ * @brief Specialization of XXHash_64 operator for strings.
+ */
+template <>
+XXHash_64<cudf::string_view>::result_type CUDA_HOST_DEVICE_CALLABLE
+XXHash_64<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+#ifndef __CUDA_ARCH__
+  CUDF_FAIL("Hashing a string in host code is not supported.");
+#else
+  return compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+#endif
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @brief  This hash function simply returns the value that is asked to be hash
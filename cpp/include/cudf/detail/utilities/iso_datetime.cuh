@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/**
+ * @file Utility code parsing the fixed-width ISO-8601 date and time forms
+ */
+
+#include <cudf/types.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief A fixed-width ISO-8601 form: `YYYY-MM-DD`, optionally followed by a separator and
+ * `HH:MM:SS`, a '.' and subsecond digits, and a 'Z'
+ */
+struct iso_datetime_format {
+  bool has_time{false};        ///< The date is followed by `time_separator` and `HH:MM:SS`
+  char time_separator{'T'};    ///< 'T' or ' '
+  int8_t subsecond_digits{0};  ///< Digits after a '.' following the seconds, 0 if none
+  bool has_utc_suffix{false};  ///< The form ends with a 'Z'
+
+  /**
+   * @brief Returns the number of characters of the form
+   */
+  CUDA_HOST_DEVICE_CALLABLE size_type size() const
+  {
+    return 10 + (has_time ? 9 : 0) + (subsecond_digits > 0 ? 1 + subsecond_digits : 0) +
+           (has_utc_suffix ? 1 : 0);
+  }
+};
+
+/**
+ * @brief The fields of a date and time, as written
+ */
+struct datetime_fields {
+  int32_t year{1970};
+  int32_t month{1};
+  int32_t day{1};
+  int32_t hour{0};
+  int32_t minute{0};
+  int32_t second{0};
+  int32_t subsecond{0};  ///< Value of the subsecond digits, in units of their last digit
+};
+
+/**
+ * @brief Returns the value of `N` decimal digits at `ptr`, and clears `valid` if one of them is
+ * not a digit, without branching on the characters.
+ */
+template <int N>
+__device__ inline int32_t parse_fixed_digits(char const* ptr, bool& valid)
+{
+  int32_t value = 0;
+#pragma unroll
+  for (int idx = 0; idx < N; ++idx) {
+    auto const digit = static_cast<uint32_t>(ptr[idx] - '0');
+    valid &= digit < 10;
+    value = value * 10 + static_cast<int32_t>(digit);
+  }
+  return value;
+}
+
+/**
+ * @brief Parses the `format.size()` characters at `ptr` in the ISO-8601 `format`.
+ *
+ * Every field is parsed at its fixed offset and every separator checked, so that the only branches
+ * depend on the format rather than on the characters.
+ *
+ * @param ptr The characters to parse, at least `format.size()` of them
+ * @param format The form of the characters
+ * @param[out] fields The parsed fields, the ones not in `format` are left unchanged
+ * @return false if a field is not all digits or a separator does not match `format`
+ */
+__device__ inline bool parse_iso_datetime(char const* ptr,
+                                          iso_datetime_format const& format,
+                                          datetime_fields& fields)
+{
+  bool valid   = (ptr[4] == '-') & (ptr[7] == '-');
+  fields.year  = parse_fixed_digits<4>(ptr, valid);
+  fields.month = parse_fixed_digits<2>(ptr + 5, valid);
+  fields.day   = parse_fixed_digits<2>(ptr + 8, valid);
+  ptr += 10;
+  if (format.has_time) {
+    valid &= (ptr[0] == format.time_separator) & (ptr[3] == ':') & (ptr[6] == ':');
+    fields.hour   = parse_fixed_digits<2>(ptr + 1, valid);
+    fields.minute = parse_fixed_digits<2>(ptr + 4, valid);
+    fields.second = parse_fixed_digits<2>(ptr + 7, valid);
+    ptr += 9;
+  }
+  if (format.subsecond_digits > 0) {
+    valid &= *ptr++ == '.';
+    int32_t subsecond = 0;
+    for (int idx = 0; idx < format.subsecond_digits; ++idx) {
+      subsecond = subsecond * 10 + parse_fixed_digits<1>(ptr++, valid);
+    }
+    fields.subsecond = subsecond;
+  }
+  if (format.has_utc_suffix) { valid &= *ptr == 'Z'; }
+  return valid;
+}
+
+}  // namespace detail
+}  // namespace cudf
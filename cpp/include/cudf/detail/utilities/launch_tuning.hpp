@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/launch_tuning.hpp>
+
+#include <driver_types.h>
+
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief The kernel launch parameters tuned per device, see `cudf::launch_tuning_mode`
+ */
+enum class tuned_parameter : int32_t {
+  JOIN_BUILD_BLOCK_SIZE,
+  JOIN_PROBE_BLOCK_SIZE,
+  HASH_PARTITION_MAX_SHARED_PARTITIONS,
+  NUM_TUNED_PARAMETERS  ///< Must be last
+};
+
+/**
+ * @brief Chooses the value of a tuned parameter for the launches within the lifetime of the
+ * object, and times them while the parameter is being autotuned.
+ *
+ * The launches of a scope must do an amount of work proportional to `work_size`, e.g. the number
+ * of rows they process, so that the timings of scopes of different sizes can be compared. Scopes
+ * whose work is too small to be timed reliably are not timed; a scope whose work size is zero,
+ * because the value of the parameter does not change what it does, is never timed.
+ *
+ * Example:
+ * ```
+ * tuned_launch_scope launch(tuned_parameter::JOIN_PROBE_BLOCK_SIZE, num_rows, stream);
+ * grid_1d config(num_rows, launch.value());
+ * kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(...);
+ * ```
+ */
+class tuned_launch_scope {
+ public:
+  /**
+   * @brief Chooses the value of `parameter` for launches of `work_size` work on `stream`
+   */
+  tuned_launch_scope(tuned_parameter parameter, int64_t work_size, cudaStream_t stream = 0);
+
+  /**
+   * @brief Records the end of the timed launches, without waiting for them
+   */
+  ~tuned_launch_scope();
+
+  tuned_launch_scope(tuned_launch_scope const&) = delete;
+  tuned_launch_scope& operator=(tuned_launch_scope const&) = delete;
+
+  /**
+   * @brief Returns the value of the parameter
+   */
+  int value() const { return value_; }
+
+ private:
+  tuned_parameter parameter_;
+  int64_t work_size_;
+  cudaStream_t stream_;
+  int device_{0};
+  int value_{0};
+  int candidate_{-1};  ///< Index of the timed candidate value, -1 if the launches are not timed
+  cudaEvent_t start_{};
+};
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/metrics.hpp>
+
+#include <driver_types.h>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Collects the metrics of an operation over the lifetime of the object and reports them
+ * to the installed `metrics_sink` on destruction.
+ *
+ * Does nothing when no sink is installed, so that the metrics that are costly to compute can be
+ * guarded by `enabled()`. The elapsed time is measured with CUDA events recorded on the stream of
+ * the operation. Nothing is reported when the operation throws.
+ *
+ * Example:
+ * ```
+ * std::unique_ptr<table> some_operation(table_view const& input, cudaStream_t stream)
+ * {
+ *   operation_metrics_scope metrics("some_operation", stream);
+ *   metrics.add("rows_in", input.num_rows());
+ *   auto result = ...;
+ *   metrics.add("rows_out", result->num_rows());
+ *   return result;
+ * }
+ * ```
+ */
+class operation_metrics_scope {
+ public:
+  /**
+   * @brief Starts collecting the metrics of `operation`, running on `stream`
+   */
+  operation_metrics_scope(char const* operation, cudaStream_t stream = 0);
+
+  /**
+   * @brief Waits for the work on the stream and reports the metrics
+   */
+  ~operation_metrics_scope();
+
+  operation_metrics_scope(operation_metrics_scope const&) = delete;
+  operation_metrics_scope& operator=(operation_metrics_scope const&) = delete;
+
+  /**
+   * @brief Returns whether metrics are collected
+   */
+  bool enabled() const { return sink_ != nullptr; }
+
+  /**
+   * @brief Adds `value` to the counter `name`
+   */
+  void add(char const* name, int64_t value)
+  {
+    if (enabled()) { metrics_.counters[name] += value; }
+  }
+
+  /**
+   * @brief Sets the decision `name` to `choice`
+   */
+  void decide(char const* name, char const* choice)
+  {
+    if (enabled()) { metrics_.decisions[name] = choice; }
+  }
+
+ private:
+  metrics_sink* sink_;
+  cudaStream_t stream_;
+  cudaEvent_t start_{};
+  cudaEvent_t stop_{};
+  operation_metrics metrics_;
+};
+
+}  // namespace detail
+}  // namespace cudf
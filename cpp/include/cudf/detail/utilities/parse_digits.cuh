@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/**
+ * @file Utility code parsing eight decimal digits at a time in a 64-bit word
+ */
+
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+/// Value of eight decimal digits shifted by one chunk
+constexpr uint64_t eight_digits_scale = 100000000;
+
+/**
+ * @brief Returns the 8 bytes at `ptr` in a word, the first byte in the lowest bits.
+ */
+__device__ inline uint64_t load_8_bytes(char const* ptr)
+{
+  if (reinterpret_cast<uintptr_t>(ptr) % sizeof(uint64_t) == 0) {
+    return *reinterpret_cast<uint64_t const*>(ptr);
+  }
+  uint64_t word = 0;
+  for (int idx = 0; idx < 8; ++idx) {
+    word |= static_cast<uint64_t>(static_cast<uint8_t>(ptr[idx])) << (8 * idx);
+  }
+  return word;
+}
+
+/**
+ * @brief Returns true if the 8 bytes of a word loaded by `load_8_bytes` are all in ['0', '9'].
+ */
+__device__ inline bool is_8_digits(uint64_t word)
+{
+  // every high nibble is 3, and adding 6 to every byte does not carry into the high nibble
+  return ((word & 0xF0F0F0F0F0F0F0F0) |
+          (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+/**
+ * @brief Returns the value of the 8 decimal digits of a word loaded by `load_8_bytes`.
+ *
+ * The digits are combined in pairs, then fours, then all eight with three multiplications.
+ */
+__device__ inline uint32_t parse_8_digits(uint64_t word)
+{
+  word -= 0x3030303030303030;
+  word = (word * 10) + (word >> 8);
+  word = (((word & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+          (((word >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >>
+         32;
+  return static_cast<uint32_t>(word);
+}
+
+}  // namespace detail
+}  // namespace cudf
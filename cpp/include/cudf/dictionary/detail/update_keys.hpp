@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/table/table_view.hpp>
 
 namespace cudf {
 namespace dictionary {
@@ -83,6 +84,52 @@ std::unique_ptr<column> set_keys(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns the indices of the values of `dictionary_column` into the new `keys`
+ *
+ * Unlike `set_keys`, the values that are not in `keys` are not nulls but have the index -1,
+ * which is not the index of any key. Only the keys of `dictionary_column` are searched, and the
+ * rows are remapped by a gather of their indices.
+ *
+ * @code{.pseudo}
+ * d1 = {[a, b, c], {0, 1, 2, 1}}
+ * remap_indices(d1, [b, c, d]) is {-1, 0, 1, 0}
+ * @endcode
+ *
+ * @throw cudf_logic_error if the keys types do not match.
+ * @throw cudf_logic_error if the keys contain nulls.
+ *
+ * @param dictionary_column Existing dictionary column.
+ * @param keys Sorted unique keys to map the values of `dictionary_column` to.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return INT32 column of indices into `keys`, with the null mask of `dictionary_column`.
+ */
+std::unique_ptr<column> remap_indices(
+  dictionary_column_view const& dictionary_column,
+  column_view const& keys,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns whether two dictionary columns use the same keys column
+ *
+ * The indices of such dictionaries can be compared instead of their values.
+ */
+bool have_same_keys(dictionary_column_view const& lhs, dictionary_column_view const& rhs);
+
+/**
+ * @brief Returns a view of `input` where the dictionary columns are replaced by their indices
+ *
+ * The keys of a dictionary are sorted and unique, so that within a dictionary column the indices
+ * compare, hash and sort like the values. The hashing and sorting of the rows of `input` can then
+ * run on integer indices instead of the keys, which are often strings.
+ *
+ * @param input Table view that may contain dictionary columns.
+ * @return View of `input` with the indices of each dictionary column, including its null mask.
+ */
+table_view indices_view(table_view const& input);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+
+#include <functional>
+
+namespace cudf {
+namespace dictionary {
+/**
+ * @addtogroup dictionary_transform
+ * @{
+ */
+
+/**
+ * @brief Operation applied to the keys of a dictionary column.
+ *
+ * It must return a column with one row for each row of the keys column.
+ */
+using keys_transform = std::function<std::unique_ptr<column>(column_view const& keys)>;
+
+/**
+ * @brief Applies an operation to the keys of a dictionary column instead of to every row.
+ *
+ * This is intended for row-wise operations, such as the strings APIs, on columns with few
+ * distinct values. The operation is called once with the keys column.
+ *
+ * If the operation returns a fixed-width column, the output is a column of that type with
+ * the result of the key of each row. Otherwise the output is a new dictionary column of the
+ * unique results, with indices remapped to them.
+ *
+ * @code{.pseudo}
+ * d1 = {keys=["a", "B", "b"], indices=[2, 0, 1, 2, 1]}
+ * d2 = transform_keys(d1, to_upper)
+ * d2 is now {keys=["A", "B"], indices=[1, 0, 1, 1, 1]}
+ * b1 = transform_keys(d1, [](keys) { return contains(keys, "b"); })
+ * b1 is now [true, false, false, true, false]
+ * @endcode
+ *
+ * Null entries from the input column are null in the output column.
+ *
+ * @throw cudf::logic_error if the operation does not return a row for every key.
+ * @throw cudf::logic_error if the operation returns a column that is not fixed-width
+ *        and contains nulls.
+ *
+ * @param dictionary_column Existing dictionary column.
+ * @param transform Operation to apply to the keys column.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New column with the result of the operation for every row.
+ */
+std::unique_ptr<column> transform_keys(
+  dictionary_column_view const& dictionary_column,
+  keys_transform const& transform,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace dictionary
+}  // namespace cudf
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/memory_estimate.hpp>
+#include <cudf/multi_device.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
@@ -31,6 +33,10 @@ namespace sort {
 class sort_groupby_helper;
 
 }  // namespace sort
+namespace hash {
+struct key_index;
+
+}  // namespace hash
 }  // namespace detail
 
 /**
@@ -156,14 +162,215 @@ class groupby {
    * @param requests The set of columns to aggregate and the aggregations to
    * perform
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    * @return Pair containing the table with each group's unique key and
    * a vector of aggregation_results for each request in the same order as
    * specified in `requests`.
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
+    std::vector<aggregation_request> const& requests,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Returns upper bounds on the device memory of `aggregate(requests)`.
+   *
+   * Computed from the sizes of the keys and values, assuming every row is a group of its own, and
+   * bounding both the hash-based and the sort-based implementations. The key and the `MIN`,
+   * `MAX` or `NTH_ELEMENT` result of a group are each one row of their column, so they are
+   * bounded by the size of the column. The intermediate results of compound aggregations such as
+   * `MEAN` or `STD` are counted as three columns of 8-byte elements per aggregation.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() != keys.num_rows()`.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param stream CUDA stream used to read the offsets of strings and lists columns.
+   * @return Upper bounds on the temporary and output device memory of the aggregation
+   */
+  memory_estimate estimate_aggregate_memory(std::vector<aggregation_request> const& requests,
+                                            cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Performs grouped scans on the specified values.
+   *
+   * The values to scan and the scans to perform are specified in an
+   * `aggregation_request`. For each `aggregation` in a request, the result at
+   * row `i` aggregates `values[i]` with all `values[j]` of the rows `j` before
+   * `i`, in the original order of `keys`, whose rows in `keys` are equivalent
+   * to row `i`.
+   *
+   * The supported scans are:
+   * SUM, MIN, MAX: The running aggregate of the valid values of arithmetic type.
+   * The result is null where the value is null.
+   * COUNT_VALID, COUNT_ALL: The number of valid, or all, values up to the row
+   * ROW_NUMBER: The 1-based position of the row in its group
+   * RANK: The rank of the value among all values of its group, see
+   * `make_rank_aggregation`
+   *
+   * The returned `table` contains the keys of every row, grouped with all
+   * equivalent rows. Row `i` of every scan result belongs to row `i` of the
+   * returned keys. Within a group, the rows keep their original order. Rows
+   * whose keys contain nulls are excluded unless `null_handling` was
+   * `null_policy::INCLUDE`.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() !=
+   * keys.num_rows()`.
+   * @throws cudf::logic_error If a scan is not one of the above or is not
+   * supported on the type of its values.
+   *
+   * Example:
+   * ```
+   * Input:
+   * keys:     {1 2 1 3 1}
+   * request:
+   *   values: {3 1 4 9 2}
+   *   aggregations: {{SUM}, {MAX}}
+   *
+   * result:
+   *
+   * keys:  {1 1 1 2 3}
+   * values:
+   *   SUM: {3 7 9 1 9}
+   *   MAX: {3 4 4 1 9}
+   * ```
+   *
+   * @param requests The set of columns to scan and the scans to perform
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return Pair containing the table with the key of every scanned row and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> scan(
+    std::vector<aggregation_request> const& requests,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Computes the partial state of grouped aggregations on the specified
+   * values, to be merged with the partial state of the same aggregations on other
+   * rows.
+   *
+   * Aggregating a large or distributed table one batch of rows at a time takes
+   * two phases. First, `aggregate_partial` computes the partial state of the
+   * aggregations on the groups of every batch. Then `merge_partial_aggregations`
+   * merges the partial states of the same groups of several batches, as many
+   * times as needed, and `finalize_partial_aggregations` computes the results of
+   * the aggregations from the merged state.
+   *
+   * The partial state of every aggregation takes one or more columns:
+   * SUM, MIN, MAX, SUM_OF_SQUARES, COUNT_VALID, COUNT_ALL: The result of the aggregation
+   * MEAN: The SUM and the COUNT_VALID of the values
+   * VARIANCE, STD: The COUNT_VALID, the MEAN of the values and the sum of their
+   * squared differences from the mean, as FLOAT64
+   * HYPERLOGLOG, APPROX_NUNIQUE: The HYPERLOGLOG sketch of the values
+   * TDIGEST, APPROX_QUANTILE: The TDIGEST of the values
+   *
+   * The returned state table holds the partial state columns of all aggregations
+   * of all requests, in the order of the requests and of their aggregations. Row
+   * `i` of the state belongs to the group at row `i` of the returned keys.
+   *
+   * Rows whose keys contain nulls are grouped as with `aggregate`.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() !=
+   * keys.num_rows()`.
+   * @throws cudf::logic_error If an aggregation is not one of the above, if
+   * MEAN, VARIANCE, STD or SUM_OF_SQUARES are requested on non-numeric values,
+   * or MIN or MAX on values that are not fixed-width.
+   *
+   * Example:
+   * ```
+   * Input:
+   * keys:     {1 2 1 2}
+   * request:
+   *   values: {2 1 4 9}
+   *   aggregations: {{SUM}, {MEAN}}
+   *
+   * result:
+   *
+   * keys:  {1 2}
+   * state:
+   *   {6 10}  SUM
+   *   {6 10}  SUM of MEAN
+   *   {2  2}  COUNT_VALID of MEAN
+   * ```
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param mr Device memory resource used to allocate the returned tables' device memory
+   * @return Pair containing the table with each group's unique key and the table of
+   * partial states of the groups
+   */
+  std::pair<std::unique_ptr<table>, std::unique_ptr<table>> aggregate_partial(
     std::vector<aggregation_request> const& requests,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+  /**
+   * @brief Performs grouped aggregations like `aggregate()`, one partition of
+   * the keys at a time.
+   *
+   * The keys and the values of all requests are hash partitioned on the keys,
+   * so that all rows of a group land in the same partition, and every partition
+   * is aggregated on its own. Only the hash table and the aggregations of one
+   * partition are in device memory at a time, so the groups of all keys do not
+   * need to fit in device memory at once.
+   *
+   * If the device memory runs out, the partitions waiting to be aggregated and
+   * the results of the aggregated partitions are moved to pinned host memory,
+   * and are copied back to the device when they are needed.
+   *
+   * The groups are in the order of the partitions, so the order of the rows of
+   * the result differs from `aggregate()`.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() !=
+   * keys.num_rows()` or `num_partitions` is negative.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param num_partitions Number of partitions; zero chooses the number so that
+   * the estimated working memory of one partition fits in half of the free
+   * device memory
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> partitioned_aggregate(
+    std::vector<aggregation_request> const& requests,
+    size_type num_partitions            = 0,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Performs grouped aggregations like `aggregate()` across several
+   * devices, returning the groups as one part per device.
+   *
+   * The keys and the values of all requests are hash partitioned on the keys on
+   * the current device, so that all rows of a group land on the same device.
+   * Every partition is copied to its device with `cudaMemcpyPeerAsync`, over
+   * NVLink when the devices are peers, and aggregated there on the stream and
+   * with the memory resource of the device, concurrently with the other
+   * devices. No group spans two devices, so every aggregation of `aggregate()`
+   * is supported and no results are merged between devices.
+   *
+   * Part `i` of the result holds the groups aggregated on `devices[i]`: the
+   * columns of their keys, followed by the result columns of every request in
+   * the order of `requests`, each in the order of the aggregations of its
+   * request.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() !=
+   * keys.num_rows()` or `devices` is empty.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param devices The devices to aggregate on, with the stream and memory
+   * resource of each
+   * @return The keys and results of the groups, of which part `i` is on
+   * `devices[i]`
+   */
+  multi_device_table multi_device_aggregate(std::vector<aggregation_request> const& requests,
+                                            std::vector<device_resources> const& devices);
+
   /**
    * @brief The grouped data corresponding to a groupby operation on a set of values.
    *
@@ -193,6 +400,36 @@ class groupby {
   groups get_groups(cudf::table_view values             = {},
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+  /**
+   * @brief Keeps the groups of the keys across `aggregate` calls
+   *
+   * By default, every `aggregate` call that uses the hash-based implementation
+   * hashes and compares the keys again. Once persistence is enabled, the next
+   * such call also stores the group of every key row, and later calls aggregate
+   * their values into these groups directly. The sort-based implementation
+   * always keeps the sort order and the group offsets of the keys.
+   *
+   * The stored groups hold `key_index_size()` bytes of device memory until
+   * `release_key_index()` is called or the `groupby` is destroyed.
+   *
+   * @param persist Whether the groups of hash-based aggregations are kept
+   */
+  void persist_key_index(bool persist = true);
+
+  /**
+   * @brief Returns the bytes of device memory held by the stored groups of the
+   * keys, of both the hash-based and sort-based implementations
+   */
+  std::size_t key_index_size() const;
+
+  /**
+   * @brief Frees the stored groups of the keys
+   *
+   * The next `aggregate` call computes the groups again, and keeps them if
+   * persistence is still enabled.
+   */
+  void release_key_index();
+
  private:
   table_view _keys;                                      ///< Keys that determine grouping
   null_policy _include_null_keys{null_policy::EXCLUDE};  ///< Include rows in keys
@@ -206,6 +443,11 @@ class groupby {
   std::unique_ptr<detail::sort::sort_groupby_helper>
     _helper;  ///< Helper object
               ///< used by sort based implementation
+  bool _persist_key_index{false};  ///< Whether hash-based aggregations keep
+                                   ///< the groups of the keys
+  std::unique_ptr<detail::hash::key_index>
+    _hash_index;  ///< Groups of the keys kept
+                  ///< by hash based implementation
 
   /**
    * @brief Get the sort helper object
@@ -229,7 +471,64 @@ class groupby {
     std::vector<aggregation_request> const& requests,
     cudaStream_t stream,
     rmm::mr::device_memory_resource* mr);
+
+  // Sort-based groupby scan
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> sort_scan(
+    std::vector<aggregation_request> const& requests,
+    cudaStream_t stream,
+    rmm::mr::device_memory_resource* mr);
 };
+
+/**
+ * @brief Merges the partial states of grouped aggregations computed on several
+ * batches of rows into the partial state of the union of the batches.
+ *
+ * `keys[i]` and `states[i]` are the keys and partial state returned by
+ * `groupby::aggregate_partial`, or by a previous `merge_partial_aggregations`,
+ * for batch `i`. The partial states of equal keys, including null keys, are
+ * merged. The merged state has the same layout, so it can be merged again with
+ * the partial states of further batches.
+ *
+ * The returned keys are sorted in ascending order, with nulls last.
+ *
+ * @throws cudf::logic_error If `keys` and `states` have different sizes, or
+ * if the columns of a state do not match `aggregations`.
+ *
+ * @param keys The unique keys of every batch
+ * @param states The partial state of every batch
+ * @param aggregations The aggregations whose partial state is in `states`: those
+ * of all requests given to `aggregate_partial`, in order
+ * @param mr Device memory resource used to allocate the returned tables' device memory
+ * @return Pair containing the table with each group's unique key and the table of
+ * merged partial states of the groups
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> merge_partial_aggregations(
+  std::vector<table_view> const& keys,
+  std::vector<table_view> const& states,
+  std::vector<std::unique_ptr<aggregation>> const& aggregations,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the results of grouped aggregations from their partial state
+ *
+ * Returns one column per aggregation, in order, whose row `i` is the result of
+ * the aggregation for the group whose state is at row `i` of `state`. The
+ * results are the same as those of `groupby::aggregate` on all the aggregated
+ * rows.
+ *
+ * @throws cudf::logic_error If the columns of `state` do not match `aggregations`.
+ *
+ * @param state The partial state of the groups, as returned by
+ * `groupby::aggregate_partial` or `merge_partial_aggregations`
+ * @param aggregations The aggregations whose partial state is in `state`
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The result of every aggregation
+ */
+std::vector<std::unique_ptr<column>> finalize_partial_aggregations(
+  table_view const& state,
+  std::vector<std::unique_ptr<aggregation>> const& aggregations,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */
 }  // namespace groupby
 }  // namespace cudf
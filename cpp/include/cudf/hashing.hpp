@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/column/indexed_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -27,7 +28,18 @@ namespace cudf {
 /**
  * @brief Computes the hash value of each row in the input set of columns.
  *
+ * `HASH_SPARK_MURMUR3` and `HASH_XXHASH64` match Spark's `hash` and `xxhash64`
+ * functions: each column's hash is seeded with the hash of the columns before it,
+ * null elements leave the running hash unchanged, and the first column is seeded
+ * with `initial_hash[0]` or with Spark's default seed of 42 when `initial_hash`
+ * is empty. They return INT32 and INT64 columns respectively and support only
+ * numeric, timestamp, duration and string columns.
+ *
+ * @throw cudf::logic_error if `initial_hash` has more than one value for
+ * `HASH_SPARK_MURMUR3` or `HASH_XXHASH64`.
+ *
  * @param input The table of columns to hash
+ * @param hash_function The hash function to use
  * @param initial_hash Optional vector of initial hash values for each column.
  * If this vector is empty then each element will be hashed as-is.
  * @param mr Device memory resource used to allocate the returned column's device memory.
@@ -39,5 +51,26 @@ std::unique_ptr<column> hash(table_view const& input,
                              std::vector<uint32_t> const& initial_hash = {},
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the hash value of each row of a table selected by indices.
+ *
+ * Returns the same result as `hash(input.materialize()->view(), hash_function, initial_hash)`.
+ * All hash functions but `HASH_MD5` read the selected rows in place through the indices.
+ *
+ * @throw cudf::logic_error under the same conditions as `hash()` of a table.
+ *
+ * @param input The rows to hash
+ * @param hash_function The hash function to use
+ * @param initial_hash Optional vector of initial hash values for each column.
+ * If this vector is empty then each element will be hashed as-is.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A column where each row is the hash of a row of `input`
+ */
+std::unique_ptr<column> hash(indexed_table_view const& input,
+                             hash_id hash_function                     = hash_id::HASH_MURMUR3,
+                             std::vector<uint32_t> const& initial_hash = {},
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <arrow/api.h>
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -73,6 +74,67 @@ std::unique_ptr<table> from_dlpack(
 DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Convert a cudf column into a DLPack DLTensor without copying its data
+ *
+ * The returned tensor takes ownership of `input`, which is freed by its `deleter`. With
+ * `num_columns` greater than one, `input` holds the rows of a table one after the other, as
+ * returned by `interleave_columns`, and is exported as a row-major 2D tensor of `num_columns`
+ * columns. If `input` is empty, the result will be nullptr.
+ *
+ * The function returns once the work on `stream` has completed, so the tensor can be read on
+ * any stream.
+ *
+ * @throw cudf::logic_error if the data type is not numeric, if `input` has a non-zero null count,
+ * or if its size is not a multiple of `num_columns`
+ *
+ * @param input Column to convert to DLPack
+ * @param num_columns Number of columns of the returned tensor
+ * @param stream CUDA stream on which `input` was produced
+ *
+ * @return 1D or 2D DLPack tensor of the column data, or nullptr
+ */
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input,
+                           size_type num_columns = 1,
+                           cudaStream_t stream   = 0);
+
+/**
+ * @brief Convert a table returned by `contiguous_split` into a DLPack DLTensor without copying its
+ * data
+ *
+ * The returned tensor takes ownership of `input.all_data`, which is freed by its `deleter`. All
+ * columns must have the same numeric data type and no nulls, and must be evenly spaced in
+ * `input.all_data`, which is the case for columns without null masks. If the table is empty or has
+ * zero rows, the result will be nullptr.
+ *
+ * The function returns once the work on `stream` has completed, so the tensor can be read on
+ * any stream.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric, if any of the columns
+ * have non-zero null count, or if the columns are not evenly spaced
+ *
+ * @param input Table to convert to DLPack
+ * @param stream CUDA stream on which `input` was produced
+ *
+ * @return 1D or 2D column-major DLPack tensor of the table data, or nullptr
+ */
+DLManagedTensor* to_dlpack(contiguous_split_result&& input, cudaStream_t stream = 0);
+
+/**
+ * @brief Returns a view of a DLPack DLTensor as a cudf table, without copying its data
+ *
+ * The `device_type` of the DLTensor must be `kDLGPU`, the rows of each column must be contiguous,
+ * and the other requirements of `from_dlpack` apply. The managed tensor must outlive the returned
+ * view.
+ *
+ * @throw cudf::logic_error if the any of the DLTensor fields are unsupported
+ *
+ * @param managed_tensor a 1D or 2D column-major (Fortran order) tensor
+ *
+ * @return View of the tensor data
+ */
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor);
+
 /** @} */  // end of group
 
 /**
@@ -86,6 +148,10 @@ DLManagedTensor* to_dlpack(table_view const& input,
  * Converts the `cudf::table_view` to `arrow::Table` with the provided
  * metadata `column_names`.
  *
+ * All buffers of the table, including those of string and nested children, are allocated first,
+ * then copied to host asynchronously and synchronized once. Allocating them with
+ * `pinned_arrow_memory_pool()` makes the copies truly asynchronous.
+ *
  * @throws cudf::logic_error if `column_names` size doesn't match with number of columns.
  *
  * @param input table_view that needs to be converted to arrow Table
@@ -97,6 +163,16 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
                                        std::vector<std::string> const& column_names = {},
                                        arrow::MemoryPool* ar_mr = arrow::default_memory_pool());
 
+/**
+ * @brief Returns an arrow memory pool of pinned host memory, for `to_arrow` to copy into
+ *
+ * Memory is drawn from a process-wide pool of pinned blocks, shared with the cuDF-IO readers, so
+ * that repeated exports do not pay for `cudaMallocHost()` on every buffer.
+ *
+ * @return The process-wide pinned arrow memory pool
+ **/
+arrow::MemoryPool* pinned_arrow_memory_pool();
+
 /**
  * @brief Create `cudf::table` from given arrow Table input
  *
@@ -108,5 +184,40 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
 std::unique_ptr<table> from_arrow(
   arrow::Table const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Views of the columns of an arrow Table along with the memory backing them
+ *
+ * The columns of `table` view the device-resident buffers of `arrow_table` in place, or the
+ * columns of `copied_columns` for the arrow arrays that had to be copied.
+ *
+ * The user is responsible for assuring that `table` or any derived views do not outlive this
+ * object.
+ */
+struct arrow_table_view {
+  table_view table;
+  std::shared_ptr<arrow::Table const> arrow_table;
+  std::vector<std::unique_ptr<column>> copied_columns;
+};
+
+/**
+ * @brief Create views of the columns of an arrow Table, copying only the columns that cannot be
+ * used in place
+ *
+ * A column is viewed in place when it has a single chunk whose buffers are all in device memory,
+ * e.g. `arrow::cuda::CudaBuffer`s read by the arrow CUDA IPC reader, and when its data, offsets
+ * and validity bitmap are aligned as cudf requires. Boolean, dictionary and empty columns, columns
+ * of several chunks and columns in host memory are copied as by `from_arrow`.
+ *
+ * The returned object shares ownership of `input`, so the device buffers stay alive as long as
+ * the views do.
+ *
+ * @param input arrow:Table to view as a `cudf::table_view`
+ * @param mr    Device memory resource used to allocate the copied columns
+ * @return Views of the columns of `input` along with the memory backing them
+ **/
+arrow_table_view from_arrow_view(
+  std::shared_ptr<arrow::Table const> const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -21,7 +21,9 @@
 #include <arrow/io/interfaces.h>
 #include <arrow/io/memory.h>
 
+#include <future>
 #include <memory>
+#include <vector>
 
 #include <cudf/io/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -58,6 +60,23 @@ class datasource {
     virtual ~buffer() {}
   };
 
+  /**
+   * @brief Expected order of the reads from a source.
+   */
+  enum class access_pattern {
+    NORMAL,      ///< No specific order
+    SEQUENTIAL,  ///< Reads mostly in ascending offset order, each range read once
+    RANDOM       ///< Reads of scattered ranges, e.g. column chunks selected from the metadata
+  };
+
+  /**
+   * @brief Range of bytes to read from a source.
+   */
+  struct read_range {
+    size_t offset;  ///< Bytes from the start
+    size_t size;    ///< Bytes to read
+  };
+
   /**
    * @brief Creates a source from a file path.
    *
@@ -133,6 +152,35 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief Starts reading several ranges from the source and returns without waiting for the data.
+   *
+   * The default implementation coalesces ranges that are at most a few kilobytes apart, then reads
+   * the coalesced ranges concurrently with `host_read()` from a small pool of threads.
+   * Implementations with a native asynchronous or vectored read (e.g. an object store client) can
+   * override this function to submit all the requests at once. Implementations whose `host_read()`
+   * is not thread-safe should override it to read sequentially.
+   *
+   * The source must outlive the returned futures.
+   *
+   * @param[in] ranges Ranges to read, in any order; they may overlap
+   *
+   * @return One future per range, in the order of `ranges`, for a buffer with the data of the
+   * range (can be smaller than requested at the end of the source)
+   */
+  virtual std::vector<std::future<std::unique_ptr<datasource::buffer>>> host_read_async(
+    std::vector<read_range> const& ranges);
+
+  /**
+   * @brief Hints the order in which the reader is going to read from the source.
+   *
+   * Sources backed by files can use the hint to tune the operating system readahead. The hint does
+   * not affect the results of the reads. The default implementation ignores it.
+   *
+   * @param[in] pattern Expected access pattern
+   */
+  virtual void advise_access_pattern(access_pattern pattern) {}
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
@@ -180,6 +228,19 @@ class datasource {
     CUDF_FAIL("datasource classes that support device_read must override this function.");
   }
 
+  /**
+   * @brief Returns the offsets of the records of the source, if they are known without parsing.
+   *
+   * Sources made of discrete messages (e.g. a message queue) can record where each message starts
+   * while they are consumed. The JSON lines and CSV readers use these offsets as the record
+   * starts, instead of scanning the data for line terminators, when they read the whole
+   * uncompressed source; each record is then one row, wherever its line terminators are. The
+   * default implementation returns an empty vector, meaning that the offsets are not known.
+   *
+   * @return Offset of the first byte of each record, in ascending order
+   */
+  virtual std::vector<size_t> record_offsets() const { return {}; }
+
   /**
    * @brief Returns the size of the data in the source.
    *
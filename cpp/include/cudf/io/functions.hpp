@@ -24,9 +24,13 @@
 #include "types.hpp"
 
 #include <cudf/io/writers.hpp>
+#include <cudf/memory_estimate.hpp>
+#include <cudf/statistics.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <functional>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -75,12 +79,14 @@ struct read_avro_args {
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
  * table_with_metadata
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return The set of columns along with metadata
  */
 table_with_metadata read_avro(
   read_avro_args const& args,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Input arguments to the `read_json` interface
@@ -149,12 +155,14 @@ struct read_json_args {
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
  * table_with_metadata
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return The set of columns along with metadata
  */
 table_with_metadata read_json(
   read_json_args const& args,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Settings to use for `read_csv()`
@@ -172,6 +180,9 @@ struct read_csv_args {
   size_t byte_range_offset = 0;
   /// Bytes to read; always reads complete rows
   size_t byte_range_size = 0;
+  /// Bytes to parse at a time when reading a whole uncompressed source, overlapping the reads
+  /// with the decoding; column types are inferred from the first piece. 0 parses it at once
+  size_t chunk_size = 0;
   /// Names of all the columns; if empty then names are auto-generated
   std::vector<std::string> names;
   /// If there is no header or names, prepend this to the column ID as the name
@@ -244,6 +255,11 @@ struct read_csv_args {
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{type_id::EMPTY};
 
+  /// Whether to return NaN floating-point values as nulls
+  bool nans_to_nulls = false;
+  /// Values to replace the nulls of the named columns with, after any `nans_to_nulls`
+  std::unordered_map<std::string, std::shared_ptr<scalar const>> null_fill_values;
+
   read_csv_args() = default;
   explicit read_csv_args(source_info const& src) : source(src) {}
 };
@@ -266,11 +282,13 @@ struct read_csv_args {
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
  * table_with_metadata
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return The set of columns along with metadata
  */
 table_with_metadata read_csv(read_csv_args const& args,
-                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
 
 /**
  * @brief Settings to use for `write_csv()`
@@ -341,6 +359,71 @@ struct write_csv_args : detail::csv::writer_options {
 void write_csv(write_csv_args const& args,
                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Settings to use for `write_json()`
+ *
+ * @ingroup io_writers
+ */
+struct write_json_args : detail::json::writer_options {
+  write_json_args(sink_info const& snk,
+                  table_view const& table,
+                  table_metadata const* metadata = nullptr,
+                  int rows_per_chunk             = std::numeric_limits<int>::max(),
+                  bool include_nulls             = true)
+    : writer_options(rows_per_chunk, include_nulls), sink_(snk), table_(table), metadata_(metadata)
+  {
+  }
+
+  detail::json::writer_options const& get_options(void) const
+  {
+    return *this;  // sliced to base
+  }
+
+  sink_info const& sink(void) const { return sink_; }
+
+  table_view const& table(void) const { return table_; }
+
+  table_metadata const* metadata(void) const { return metadata_; }
+
+  // Specify the sink to use for writer output:
+  //
+  sink_info const sink_;
+
+  // Set of columns to output:
+  //
+  table_view const table_;
+
+  // Optional associated metadata, with the names of the fields of the records
+  //
+  table_metadata const* metadata_;
+};
+
+/**
+ * @brief Writes a set of columns as JSON Lines, one JSON object per row
+ *
+ * The keys of each object are the column names of the metadata, or the column indices if there
+ * is no metadata. The values are formatted on the GPU: numbers and booleans as JSON literals,
+ * strings and timestamps as escaped JSON strings, lists as arrays and structs as objects keyed by
+ * the indices of their fields. Nulls and non-finite floating-point values are written as `null`.
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  #include <cudf/io/functions.hpp>
+ *  ...
+ *  std::string filepath = "dataset.jsonl";
+ *  cudf::io::sink_info sink_info(filepath);
+ *
+ *  cudf::io::write_json_args args{sink_info, table->view(), &metadata};
+ *  ...
+ *  cudf::io::write_json(args);
+ * @endcode
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void write_json(write_json_args const& args,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Settings to use for `read_orc()`
  *
@@ -376,6 +459,21 @@ struct read_orc_args {
   /// For decimals as int, optional forced decimal scale;
   /// -1 is auto (column scale), >=0: number of fractional digits
   int forced_decimals_scale = -1;
+  /// Whether to return decimals as DECIMAL64 columns at the column scale; takes precedence over
+  /// `decimals_as_float` and `forced_decimals_scale`
+  bool decimals_as_fixed_point = false;
+  /// Whether to return string columns as DICTIONARY32 columns keyed by the dictionaries of the
+  /// stripes, without expanding the strings of every row
+  bool strings_to_dictionary = false;
+
+  /// Predicates checked against stripe and row group statistics and bloom filters to skip stripes
+  /// that cannot match; cannot be combined with `skip_rows`/`num_rows`
+  std::vector<column_predicate> filters;
+
+  /// Whether to return NaN floating-point values as nulls
+  bool nans_to_nulls = false;
+  /// Values to replace the nulls of the named columns with, after any `nans_to_nulls`
+  std::unordered_map<std::string, std::shared_ptr<scalar const>> null_fill_values;
 
   read_orc_args() = default;
 
@@ -399,11 +497,150 @@ struct read_orc_args {
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
  * table_with_metadata
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return The set of columns
  */
 table_with_metadata read_orc(read_orc_args const& args,
-                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the statistics of the selected columns of an ORC dataset, read from the file
+ * footer without reading any column data.
+ *
+ * @ingroup io_readers
+ *
+ * Only `num_rows`, `null_count`, `min` and `max` can be known, and only if the file was written
+ * with statistics. Timestamp min/max are truncated to milliseconds. See
+ * `compute_column_statistics` to compute NDV and histograms from the data.
+ *
+ * @param args Settings of the read, of which `source`, `columns` and the output type options are
+ * used
+ * @param mr Device memory resource used to allocate the min/max scalars
+ *
+ * @return The statistics of every selected column
+ */
+std::vector<column_statistics> read_orc_statistics(
+  read_orc_args const& args, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Settings to use for `read_orc_chunked()`
+ *
+ * @ingroup io_readers
+ */
+struct read_orc_chunked_args {
+  source_info source;
+
+  /// Names of column to read; empty is all
+  std::vector<std::string> columns;
+
+  /// Approximate upper bound, in bytes, of the device memory used to read each chunk; `0` is no
+  /// limit
+  size_t byte_limit = 0;
+  /// Maximum number of rows in each chunk; `0` is no limit
+  size_type row_limit = 0;
+
+  /// Whether to use row index to speed-up reading
+  bool use_index = true;
+  /// Whether to use numpy-compatible dtypes
+  bool use_np_dtypes = true;
+  /// Cast timestamp columns to a specific type
+  data_type timestamp_type{type_id::EMPTY};
+
+  /// Whether to convert decimals to float64
+  bool decimals_as_float = true;
+  /// For decimals as int, optional forced decimal scale;
+  /// -1 is auto (column scale), >=0: number of fractional digits
+  int forced_decimals_scale = -1;
+  /// Whether to return decimals as DECIMAL64 columns at the column scale; takes precedence over
+  /// `decimals_as_float` and `forced_decimals_scale`
+  bool decimals_as_fixed_point = false;
+  /// Whether to return string columns as DICTIONARY32 columns keyed by the dictionaries of the
+  /// stripes, without expanding the strings of every row
+  bool strings_to_dictionary = false;
+
+  read_orc_chunked_args() = default;
+
+  explicit read_orc_chunked_args(source_info const& src, size_t byte_limit_, size_type row_limit_)
+    : source(src), byte_limit(byte_limit_), row_limit(row_limit_)
+  {
+  }
+};
+
+namespace detail {
+namespace orc {
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+struct orc_chunked_read_state;
+};  // namespace orc
+};  // namespace detail
+
+/**
+ * @brief Begin the process of reading an ORC file in a chunked/stream form.
+ *
+ * @ingroup io_readers
+ *
+ * The file is split into consecutive ranges of whole stripes, so that each range is expected to
+ * use at most `byte_limit` bytes of device memory and contains at most `row_limit` rows; at
+ * least one of the limits must be set. Stripes with more rows than `row_limit` are split into
+ * several ranges, but stripes larger than `byte_limit` are read in one piece.
+ *
+ * The file footer is parsed once, and the same reader decodes all the ranges.
+ *
+ * The following code snippet demonstrates how to read an ORC file in pieces of one million rows.
+ * @code
+ *  ...
+ *  std::string filepath = "dataset.orc";
+ *  cudf::io::read_orc_chunked_args args{cudf::source_info(filepath), 0, 1000000};
+ *  ...
+ *  auto state = cudf::read_orc_chunked_begin(args);
+ *  while (cudf::read_orc_chunked_has_next(state)) {
+ *    auto piece = cudf::read_orc_chunked(state);
+ *    ...
+ *  }
+ * @endcode
+ *
+ * @param[in] args Settings for controlling reading behavior
+ * @param[in] mr Device memory resource used to allocate device memory of the returned tables
+ *
+ * @returns pointer to an anonymous state structure storing information about the chunked read.
+ * this pointer must be passed to all subsequent read_orc_chunked_has_next() and
+ * read_orc_chunked() calls.
+ */
+std::shared_ptr<detail::orc::orc_chunked_read_state> read_orc_chunked_begin(
+  read_orc_chunked_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether a chunked/stream ORC read has data remaining.
+ *
+ * @ingroup io_readers
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_orc_chunked_begin()
+ *
+ * @return `true` if the next call to read_orc_chunked() returns a table
+ */
+bool read_orc_chunked_has_next(std::shared_ptr<detail::orc::orc_chunked_read_state> state);
+
+/**
+ * @brief Read the next table of a chunked/stream ORC read.
+ *
+ * @ingroup io_readers
+ *
+ * All returned tables have the same columns; concatenated in order, they make up the file.
+ * At least one table is returned, even for a file without rows.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_orc_chunked_begin()
+ *
+ * @throw cudf::logic_error if the whole file has already been read
+ *
+ * @return The set of columns of the next range of rows, along with metadata
+ */
+table_with_metadata read_orc_chunked(std::shared_ptr<detail::orc::orc_chunked_read_state> state);
 
 /**
  * @brief Settings to use for `read_parquet()`
@@ -423,10 +660,30 @@ struct read_parquet_args {
 
   /// Whether to store string data as categorical type
   bool strings_to_categorical = false;
+  /// Whether to return flat string columns as DICTIONARY32 columns keyed by the dictionaries
+  /// of the column chunks, without expanding the strings of every row
+  bool strings_to_dictionary = false;
   /// Whether to use PANDAS metadata to load columns
   bool use_pandas_metadata = true;
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{type_id::EMPTY};
+  /// Whether to return INT32 and INT64 decimals as DECIMAL32 and DECIMAL64 columns instead of
+  /// converting them to float64
+  bool decimals_as_fixed_point = false;
+
+  /// Predicates checked against row group statistics to skip row groups that cannot match;
+  /// cannot be combined with `skip_rows`/`num_rows`
+  std::vector<column_predicate> filters;
+
+  /// Whether to return NaN floating-point values as nulls
+  bool nans_to_nulls = false;
+  /// Values to replace the nulls of the named columns with, after any `nans_to_nulls`
+  std::unordered_map<std::string, std::shared_ptr<scalar const>> null_fill_values;
+
+  /// Device memory resource for the intermediate buffers of the read, such as the compressed and
+  /// decompressed pages; passing a pool that outlives the reads recycles these buffers. The
+  /// default resource is used if null
+  rmm::mr::device_memory_resource* scratch_mr = nullptr;
 
   explicit read_parquet_args() = default;
 
@@ -450,13 +707,168 @@ struct read_parquet_args {
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
  * table_with_metadata
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return The set of columns along with metadata
  */
 table_with_metadata read_parquet(
+  read_parquet_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns upper bounds on the device memory of `read_parquet(args)`, computed from the
+ * footers of the dataset without reading any column data.
+ *
+ * @ingroup io_readers
+ *
+ * The bounds cover reading all the row groups of the selected columns; selecting row groups or
+ * rows only lowers the memory used. The compressed and decompressed pages of all the row groups
+ * are counted as temporaries. Dictionary-encoded strings columns are bounded by the size limit
+ * of a column unless `strings_to_dictionary` is set, since their expanded size is not recorded.
+ *
+ * @param args Settings of the read, of which `source`, `columns`, `use_pandas_metadata` and
+ * `strings_to_dictionary` are used
+ *
+ * @return Upper bounds on the temporary and output device memory of the read
+ */
+memory_estimate estimate_read_parquet_memory(read_parquet_args const& args);
+
+/**
+ * @brief Returns the statistics of the selected columns of a Parquet dataset, combined from the
+ * row group statistics of the footers without reading any column data.
+ *
+ * @ingroup io_readers
+ *
+ * Only `num_rows`, `null_count`, `min` and `max` can be known, and only if all row groups have
+ * statistics. `approx_distinct_count` is the `distinct_count` of the footer when the dataset has
+ * a single row group, as counts of several row groups cannot be combined. See
+ * `compute_column_statistics` to compute NDV and histograms from the data.
+ *
+ * @param args Settings of the read, of which `source`, `columns` and the output type options are
+ * used
+ * @param mr Device memory resource used to allocate the min/max scalars
+ *
+ * @return The statistics of every selected column
+ */
+std::vector<column_statistics> read_parquet_statistics(
   read_parquet_args const& args,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Settings to use for `read_parquet_chunked()`
+ *
+ * @ingroup io_readers
+ */
+struct read_parquet_chunked_args {
+  source_info source;
+
+  /// Names of column to read; empty is all
+  std::vector<std::string> columns;
+
+  /// Approximate upper bound, in bytes, of the device memory used to read each chunk; `0` is no
+  /// limit
+  size_t byte_limit = 0;
+  /// Maximum number of rows in each chunk; `0` is no limit
+  size_type row_limit = 0;
+
+  /// Whether to store string data as categorical type
+  bool strings_to_categorical = false;
+  /// Whether to return flat string columns as DICTIONARY32 columns keyed by the dictionaries
+  /// of the column chunks, without expanding the strings of every row
+  bool strings_to_dictionary = false;
+  /// Whether to use PANDAS metadata to load columns
+  bool use_pandas_metadata = true;
+  /// Cast timestamp columns to a specific type
+  data_type timestamp_type{type_id::EMPTY};
+
+  /// Device memory resource for the intermediate buffers of the reads, such as the compressed
+  /// and decompressed pages; the default resource is used if null
+  rmm::mr::device_memory_resource* scratch_mr = nullptr;
+
+  read_parquet_chunked_args() = default;
+
+  explicit read_parquet_chunked_args(source_info const& src, size_t byte_limit_)
+    : source(src), byte_limit(byte_limit_)
+  {
+  }
+};
+
+namespace detail {
+namespace parquet {
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+struct pq_chunked_read_state;
+};  // namespace parquet
+};  // namespace detail
+
+/**
+ * @brief Begin the process of reading a parquet dataset in a chunked/stream form.
+ *
+ * @ingroup io_readers
+ *
+ * The intent of the read_parquet_chunked_ path is to allow reading a dataset that does not fit in
+ * device memory as a series of tables. The dataset is split into consecutive ranges of rows, at
+ * row group boundaries, so that the decoding of each range is expected to use at most
+ * `byte_limit` bytes of device memory and contains at most `row_limit` rows; at least one of
+ * the limits must be set. Row groups larger than the limits are split into several ranges of
+ * rows; this only bounds the memory used if the file has a page index.
+ *
+ * The following code snippet demonstrates how to read a parquet file in pieces of about 1GB.
+ * @code
+ *  ...
+ *  std::string filepath = "dataset.parquet";
+ *  cudf::io::read_parquet_chunked_args args{cudf::source_info(filepath), 1 << 30};
+ *  ...
+ *  auto state = cudf::read_parquet_chunked_begin(args);
+ *  while (cudf::read_parquet_chunked_has_next(state)) {
+ *    auto piece = cudf::read_parquet_chunked(state);
+ *    ...
+ *  }
+ * @endcode
+ *
+ * @param[in] args Settings for controlling reading behavior
+ * @param[in] mr Device memory resource used to allocate device memory of the returned tables
+ *
+ * @returns pointer to an anonymous state structure storing information about the chunked read.
+ * this pointer must be passed to all subsequent read_parquet_chunked_has_next() and
+ * read_parquet_chunked() calls.
+ */
+std::shared_ptr<detail::parquet::pq_chunked_read_state> read_parquet_chunked_begin(
+  read_parquet_chunked_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether a chunked/stream parquet read has data remaining.
+ *
+ * @ingroup io_readers
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_parquet_chunked_begin()
+ *
+ * @return `true` if the next call to read_parquet_chunked() returns a table
+ */
+bool read_parquet_chunked_has_next(std::shared_ptr<detail::parquet::pq_chunked_read_state> state);
+
+/**
+ * @brief Read the next table of a chunked/stream parquet read.
+ *
+ * @ingroup io_readers
+ *
+ * All returned tables have the same columns; concatenated in order, they make up the dataset.
+ * At least one table is returned, even for a dataset without rows.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_parquet_chunked_begin()
+ *
+ * @throw cudf::logic_error if the whole dataset has already been read
+ *
+ * @return The set of columns of the next range of rows, along with metadata
+ */
+table_with_metadata read_parquet_chunked(
+  std::shared_ptr<detail::parquet::pq_chunked_read_state> state);
+
 /**
  * @brief Settings to use for `write_orc()`
  *
@@ -469,6 +881,11 @@ struct write_orc_args {
   compression_type compression;
   /// Enable writing column statistics
   bool enable_statistics;
+  /// Target size of a stripe in bytes, before compression
+  size_t stripe_size = 64 * 1024 * 1024;
+  /// False positive probability of the row group bloom filters of each column, in table order; no
+  /// bloom filters are written for the columns without a positive value
+  std::vector<double> bloom_filter_fpp;
   /// Set of columns to output
   table_view table;
   /// Optional associated metadata
@@ -522,6 +939,14 @@ struct write_orc_chunked_args {
   compression_type compression;
   /// Enable writing column statistics
   bool enable_statistics;
+  /// Target size of a stripe in bytes, before compression
+  size_t stripe_size = 64 * 1024 * 1024;
+  /// False positive probability of the row group bloom filters of each column, in table order; no
+  /// bloom filters are written for the columns without a positive value
+  std::vector<double> bloom_filter_fpp;
+  /// Whether to buffer the tables until they fill a stripe of `stripe_size`, so that small tables
+  /// do not produce small stripes; otherwise each table is written as its own stripes
+  bool coalesce_chunks = true;
   /// Optional associated metadata
   const table_metadata_with_nullability* metadata;
 
@@ -613,6 +1038,19 @@ struct write_parquet_args {
   compression_type compression = compression_type::AUTO;
   /// Specify the level of statistics in the output file
   statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  /// Maximum size of the dictionary of a column chunk in bytes; the values past it are PLAIN-encoded
+  size_t max_dictionary_size = 1024 * 1024;
+  /// Target size of a row group in bytes, before compression; also bounds the device memory used
+  /// to encode the row groups
+  size_t row_group_size = 128 * 1024 * 1024;
+  /// Target size of a data page in bytes, before compression
+  size_t page_size = 512 * 1024;
+  /// Encode the values that are not dictionary-encoded with DELTA_BINARY_PACKED (integers),
+  /// BYTE_STREAM_SPLIT (floating-point) and DELTA_BYTE_ARRAY (strings) instead of PLAIN
+  bool delta_encodings = false;
+  /// False positive probability of the column chunk bloom filters of each column, in table order;
+  /// no bloom filters are written for the columns without a positive value
+  std::vector<double> bloom_filter_fpp;
   /// Set of columns to output
   table_view table;
   /// Optional associated metadata
@@ -674,6 +1112,88 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet(
 std::unique_ptr<std::vector<uint8_t>> merge_rowgroup_metadata(
   const std::vector<std::unique_ptr<std::vector<uint8_t>>>& metadata_list);
 
+/**
+ * @brief Settings to use for `write_parquet_partitioned()`
+ *
+ * @ingroup io_writers
+ */
+struct write_parquet_partitioned_args {
+  /// Returns the sink of a partition, given the distinct partition keys and the partition index;
+  /// called for each partition in turn, possibly from another thread than the caller's
+  std::function<sink_info(table_view const& keys, size_type partition)> sink_factory;
+  /// Specify the compression format to use
+  compression_type compression = compression_type::AUTO;
+  /// Specify the level of statistics in the output files
+  statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  /// Maximum size of the dictionary of a column chunk in bytes; values past it are PLAIN-encoded
+  size_t max_dictionary_size = 1024 * 1024;
+  /// Target size of a row group in bytes, before compression
+  size_t row_group_size = 128 * 1024 * 1024;
+  /// Target size of a data page in bytes, before compression
+  size_t page_size = 512 * 1024;
+  /// Encode the values that are not dictionary-encoded with DELTA_BINARY_PACKED (integers),
+  /// BYTE_STREAM_SPLIT (floating-point) and DELTA_BYTE_ARRAY (strings) instead of PLAIN
+  bool delta_encodings = false;
+  /// False positive probability of the column chunk bloom filters of each written column, in table
+  /// order without the partition columns; no bloom filters are written for the columns without a
+  /// positive value
+  std::vector<double> bloom_filter_fpp;
+  /// Set of columns to output, including the partition columns
+  table_view table;
+  /// Indices of the columns the rows are partitioned by; they are not written to the files
+  std::vector<size_type> partition_columns;
+  /// Optional associated metadata, with the names of all the columns of `table`
+  const table_metadata* metadata = nullptr;
+
+  write_parquet_partitioned_args() = default;
+
+  explicit write_parquet_partitioned_args(
+    table_view const& table_,
+    std::vector<size_type> partition_columns_,
+    std::function<sink_info(table_view const&, size_type)> sink_factory_,
+    const table_metadata* metadata_ = nullptr)
+    : sink_factory(std::move(sink_factory_)),
+      table(table_),
+      partition_columns(std::move(partition_columns_)),
+      metadata(metadata_)
+  {
+  }
+};
+
+/**
+ * @brief Writes the rows of each partition of a table to a separate parquet file, as in
+ * hive-style partitioned datasets
+ *
+ * @ingroup io_writers
+ *
+ * The rows are grouped by the values of the partition columns in a single sort, keeping their
+ * order within each partition; null keys make up their own partition. The row groups of all the
+ * partitions are then encoded together, in batches, and written to the sink of their partition.
+ * Each sink is only open while the row groups of its partition are written, so that the number of
+ * partitions is not bounded by the number of files that can be open at once.
+ *
+ * The following code snippet demonstrates how to write one file per distinct value of column 0:
+ * @code
+ *  ...
+ *  auto factory = [](cudf::table_view const& keys, cudf::size_type partition) {
+ *    return cudf::io::sink_info("part" + std::to_string(partition) + ".parquet");
+ *  };
+ *  cudf::io::write_parquet_partitioned_args args{table->view(), {0}, factory};
+ *  auto keys = cudf::io::write_parquet_partitioned(args);
+ * @endcode
+ *
+ * @throw cudf::logic_error if `partition_columns` is empty, holds an index out of range, or
+ * holds all the columns
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Device memory resource used to allocate the returned table
+ *
+ * @return The distinct partition keys, in sorted order; row `i` holds the keys of partition `i`
+ */
+std::unique_ptr<table> write_parquet_partitioned(
+  write_parquet_partitioned_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Settings to use for `write_parquet_chunked()`
  *
@@ -686,6 +1206,19 @@ struct write_parquet_chunked_args {
   compression_type compression = compression_type::AUTO;
   /// Specify the level of statistics in the output file
   statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  /// Maximum size of the dictionary of a column chunk in bytes; the values past it are PLAIN-encoded
+  size_t max_dictionary_size = 1024 * 1024;
+  /// Target size of a row group in bytes, before compression; also bounds the device memory used
+  /// to encode the row groups
+  size_t row_group_size = 128 * 1024 * 1024;
+  /// Target size of a data page in bytes, before compression
+  size_t page_size = 512 * 1024;
+  /// Encode the values that are not dictionary-encoded with DELTA_BINARY_PACKED (integers),
+  /// BYTE_STREAM_SPLIT (floating-point) and DELTA_BYTE_ARRAY (strings) instead of PLAIN
+  bool delta_encodings = false;
+  /// False positive probability of the column chunk bloom filters of each column, in table order;
+  /// no bloom filters are written for the columns without a positive value
+  std::vector<double> bloom_filter_fpp;
   /// Optional associated metadata.
   const table_metadata_with_nullability* metadata;
 
@@ -776,5 +1309,33 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet_chunked_end(
   bool return_filemetadata                  = false,
   const std::string& metadata_out_file_path = "");
 
+/**
+ * @brief Sets the capacity of the process-wide cache of parsed Parquet and ORC file footers.
+ *
+ * @ingroup io_readers
+ *
+ * When enabled, reads of files specified by path reuse the footer parsed by a previous read of
+ * the same file, skipping the footer read and decode. Entries are keyed by the path, size and
+ * modification time of the file, so a rewritten file is parsed again. The least recently used
+ * entries are evicted once the total size of the cached footers exceeds the capacity. The cache
+ * is disabled by default.
+ *
+ * @param capacity Maximum total size of the cached footers, in bytes; zero disables the cache
+ * and drops all the entries
+ */
+void set_metadata_cache_capacity(size_t capacity);
+
+/**
+ * @brief Sets the capacity of the process-wide pool of pinned host memory used by the readers.
+ *
+ * The readers stage host data in pinned memory before copying it to the device. Released pinned
+ * blocks are kept for reuse by later reads while their total size is within the capacity, which
+ * is 64MB by default.
+ *
+ * @param capacity Maximum total size of the pinned blocks kept for reuse, in bytes; zero frees
+ * pinned memory as soon as it is released
+ */
+void set_pinned_memory_pool_capacity(size_t capacity);
+
 }  // namespace io
 }  // namespace cudf
@@ -24,6 +24,8 @@
 #include "types.hpp"
 
 #include <cudf/io/datasource.hpp>
+#include <cudf/memory_estimate.hpp>
+#include <cudf/statistics.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
@@ -222,6 +224,8 @@ struct reader_options {
 
   /// Specify the compression format of the source or infer from file extension
   compression_type compression = compression_type::AUTO;
+  /// Bytes parsed at a time when reading a whole uncompressed source; 0 parses it at once
+  size_t chunk_size = 0;
   /// Names of all the columns; if empty then names are auto-generated
   std::vector<std::string> names;
   /// If there is no header or names, prepend this to the column ID as the name
@@ -390,6 +394,9 @@ struct reader_options {
   data_type timestamp_type{type_id::EMPTY};
   bool decimals_as_float    = true;
   int forced_decimals_scale = -1;
+  std::vector<column_predicate> filters;
+  bool decimals_as_fixed_point = false;
+  bool strings_to_dictionary   = false;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -401,19 +408,28 @@ struct reader_options {
    * @param use_index_lookup Whether to use row index for faster scanning
    * @param np_compat Whether to use numpy-compatible dtypes
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param filters Predicates used to skip stripes based on their statistics and bloom filters
+   * @param decimals_as_fixed_point Whether to return decimals as DECIMAL64 columns
+   * @param strings_to_dictionary Whether to return strings as dictionary columns
    */
   reader_options(std::vector<std::string> columns,
                  bool use_index_lookup,
                  bool np_compat,
                  data_type timestamp_type,
-                 bool decimals_as_float_    = true,
-                 int forced_decimals_scale_ = -1)
+                 bool decimals_as_float_               = true,
+                 int forced_decimals_scale_            = -1,
+                 std::vector<column_predicate> filters = {},
+                 bool decimals_as_fixed_point_         = false,
+                 bool strings_to_dictionary_           = false)
     : columns(std::move(columns)),
       use_index(use_index_lookup),
       use_np_dtypes(np_compat),
       timestamp_type(timestamp_type),
       decimals_as_float(decimals_as_float_),
-      forced_decimals_scale(forced_decimals_scale_)
+      forced_decimals_scale(forced_decimals_scale_),
+      filters(std::move(filters)),
+      decimals_as_fixed_point(decimals_as_fixed_point_),
+      strings_to_dictionary(strings_to_dictionary_)
   {
   }
 };
@@ -501,6 +517,35 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Splits the file into ranges of rows that can each be read within the given limits.
+   *
+   * Consecutive stripes are combined as long as their estimated device memory footprint fits in
+   * `byte_limit` and their rows fit in `row_limit`. Stripes with more than `row_limit` rows are
+   * split into several ranges; a larger stripe is never split to fit `byte_limit`.
+   *
+   * @param byte_limit Approximate upper bound of the device memory used to read each range; use
+   * `0` for no limit
+   * @param row_limit Maximum number of rows in each range; use `0` for no limit
+   *
+   * @return List of (skip_rows, num_rows) pairs covering the file in order; contains at least
+   * one range
+   */
+  std::vector<std::pair<size_type, size_type>> get_chunk_row_ranges(size_t byte_limit,
+                                                                    size_type row_limit = 0) const;
+
+  /**
+   * @brief Returns the statistics of the selected columns, from the file footer alone.
+   *
+   * Only `num_rows`, `null_count`, `min` and `max` can be known. Timestamp min/max are truncated
+   * to milliseconds.
+   *
+   * @param stream CUDA stream used to initialize the min/max scalars
+   *
+   * @return The statistics of every selected column
+   */
+  std::vector<column_statistics> read_statistics(cudaStream_t stream = 0) const;
 };
 
 }  // namespace orc
@@ -514,6 +559,10 @@ struct reader_options {
   bool strings_to_categorical = false;
   bool use_pandas_metadata    = false;
   data_type timestamp_type{type_id::EMPTY};
+  std::vector<column_predicate> filters;
+  bool strings_to_dictionary                  = false;
+  bool decimals_as_fixed_point                = false;
+  rmm::mr::device_memory_resource *scratch_mr = nullptr;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -525,15 +574,27 @@ struct reader_options {
    * @param strings_to_categorical Whether to return strings as category
    * @param use_pandas_metadata Whether to always load PANDAS index columns
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param filters Predicates used to skip row groups based on their statistics
+   * @param strings_to_dictionary Whether to return strings as dictionary columns
+   * @param decimals_as_fixed_point Whether to return INT32/INT64 decimals as fixed_point columns
+   * @param scratch_mr Device memory resource for the intermediate buffers; default if null
    */
   reader_options(std::vector<std::string> columns,
                  bool strings_to_categorical,
                  bool use_pandas_metadata,
-                 data_type timestamp_type)
+                 data_type timestamp_type,
+                 std::vector<column_predicate> filters       = {},
+                 bool strings_to_dictionary                  = false,
+                 bool decimals_as_fixed_point                = false,
+                 rmm::mr::device_memory_resource *scratch_mr = nullptr)
     : columns(std::move(columns)),
       strings_to_categorical(strings_to_categorical),
       use_pandas_metadata(use_pandas_metadata),
-      timestamp_type(timestamp_type)
+      timestamp_type(timestamp_type),
+      filters(std::move(filters)),
+      strings_to_dictionary(strings_to_dictionary),
+      decimals_as_fixed_point(decimals_as_fixed_point),
+      scratch_mr(scratch_mr)
   {
   }
 };
@@ -606,6 +667,60 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Splits the dataset into ranges of rows that can each be read within a memory budget.
+   *
+   * Consecutive row groups are combined as long as their estimated device memory footprint
+   * (compressed and decompressed pages, and decoded output) fits in `byte_limit`. Larger row
+   * groups are split into several ranges.
+   *
+   * @param byte_limit Approximate upper bound of the device memory used to read each range; use
+   * `0` for no limit
+   * @param row_limit Maximum number of rows in each range; use `0` for no limit
+   *
+   * @return List of (skip_rows, num_rows) pairs covering the dataset in order; contains at least
+   * one range
+   */
+  std::vector<std::pair<size_type, size_type>> get_chunk_row_ranges(size_t byte_limit,
+                                                                    size_type row_limit = 0) const;
+
+  /**
+   * @brief Returns upper bounds on the device memory of `read_all()`, from the footers alone.
+   *
+   * Reading fewer row groups or rows uses less memory. Dictionary-encoded strings columns are
+   * bounded by the size limit of a column, unless `strings_to_dictionary` is set, since the
+   * footers do not record their expanded size.
+   *
+   * @return Upper bounds on the temporary and output device memory of the read
+   */
+  memory_estimate estimate_read_memory() const;
+
+  /**
+   * @brief Returns the statistics of the selected columns, from the footers alone.
+   *
+   * The statistics of all the row groups are combined. Only `num_rows`, `null_count`, `min`, `max`
+   * and, for a single row group, `approx_distinct_count` can be known.
+   *
+   * @param stream CUDA stream used to initialize the min/max scalars
+   *
+   * @return The statistics of every selected column
+   */
+  std::vector<column_statistics> read_statistics(cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Reads a range of rows as one piece of a chunked read.
+   *
+   * Same as `read_rows`, but the scratch memory used for decompression is kept to be reused when
+   * reading the next piece.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; use `0` for all remaining data
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
 };
 
 }  // namespace parquet
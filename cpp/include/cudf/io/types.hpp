@@ -57,7 +57,8 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD     ///< ZSTD format, using LZ77 + Huffman + finite state entropy coding
 };
 
 /**
@@ -89,6 +90,40 @@ enum statistics_freq {
   STATISTICS_PAGE     = 2,  //!< Per-page column statistics
 };
 
+/**
+ * @brief Comparison operators for predicates evaluated against file column statistics
+ */
+enum class filter_op : int32_t {
+  EQUAL,          ///< column == value
+  NOT_EQUAL,      ///< column != value
+  LESS,           ///< column < value
+  LESS_EQUAL,     ///< column <= value
+  GREATER,        ///< column > value
+  GREATER_EQUAL,  ///< column >= value
+  IS_NULL,        ///< column is null; `value` is ignored
+  IS_NOT_NULL     ///< column is not null; `value` is ignored
+};
+
+/**
+ * @brief Predicate of the form `column <op> value` used by readers to skip data
+ *
+ * Readers evaluate a list of predicates as a conjunction against the min/max statistics stored
+ * in the file: a row group (or stripe) is only read if every predicate may hold for at least one
+ * of its rows. Data without usable statistics for a column is always read. The filtering is
+ * coarse-grained; the returned table may still contain rows that do not satisfy the predicates.
+ */
+struct column_predicate {
+  std::string column_name;              ///< Name of the column the predicate applies to
+  filter_op op = filter_op::EQUAL;      ///< Comparison operator
+  std::shared_ptr<scalar const> value;  ///< Literal compared against; must be valid
+
+  column_predicate() = default;
+  column_predicate(std::string name, filter_op op, std::shared_ptr<scalar const> value = nullptr)
+    : column_name(std::move(name)), op(op), value(std::move(value))
+  {
+  }
+};
+
 /**
  * @brief Table metadata for io readers/writers (primarily column names)
  * For nested types (structs, maps, unions), the ordering of names in the column_names vector
@@ -23,13 +23,17 @@
 
 #include "types.hpp"
 
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
 #include <cudf/io/data_sink.hpp>
 
+#include <functional>
+#include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 //! cuDF interfaces
 namespace cudf {
@@ -38,6 +42,9 @@ namespace io {
 namespace detail {
 namespace orc {
 
+/// Default target size of a stripe, before compression
+constexpr size_t default_stripe_size = 64 * 1024 * 1024;
+
 /**
  * @brief Options for the ORC writer.
  */
@@ -46,6 +53,11 @@ struct writer_options {
   compression_type compression = compression_type::AUTO;
   /// Enables writing column statistics in the ORC file
   bool enable_statistics = true;
+  /// Target size of a stripe in bytes, before compression
+  size_t stripe_size = default_stripe_size;
+  /// False positive probability of the row group bloom filters of each top-level column; no bloom
+  /// filters are written for the columns without a positive value
+  std::vector<double> bloom_filter_fpp;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -54,9 +66,18 @@ struct writer_options {
    * @brief Constructor to populate writer options.
    *
    * @param format Compression format to use
+   * @param stats_en Whether to write column statistics
+   * @param stripe_size_bytes Target size of a stripe in bytes, before compression
+   * @param fpp_per_column False positive probability of the bloom filters of each column
    */
-  explicit writer_options(compression_type format, bool stats_en)
-    : compression(format), enable_statistics(stats_en)
+  explicit writer_options(compression_type format,
+                          bool stats_en,
+                          size_t stripe_size_bytes           = default_stripe_size,
+                          std::vector<double> fpp_per_column = {})
+    : compression(format),
+      enable_statistics(stats_en),
+      stripe_size(stripe_size_bytes),
+      bloom_filter_fpp(std::move(fpp_per_column))
   {
   }
 };
@@ -124,6 +145,20 @@ class writer {
 
 namespace parquet {
 
+/// Default maximum size of the dictionary of a column chunk
+constexpr size_t default_max_dictionary_size = 1024 * 1024;
+/// Default target size of a row group, before compression
+constexpr size_t default_row_group_size = 128 * 1024 * 1024;
+/// Default target size of a data page, before compression
+constexpr size_t default_page_size = 512 * 1024;
+
+/**
+ * @brief Returns the sink of a partition written by `writer::write_partitioned()`, given the
+ * distinct partition keys and the index of the partition in them.
+ */
+using partition_sink_factory =
+  std::function<std::unique_ptr<data_sink>(table_view const& keys, size_type partition)>;
+
 /**
  * @brief Options for the parquet writer.
  */
@@ -132,6 +167,17 @@ struct writer_options {
   compression_type compression = compression_type::AUTO;
   /// Select the statistics level to generate in the parquet file
   statistics_freq stats_granularity = statistics_freq::STATISTICS_ROWGROUP;
+  /// Maximum size of the dictionary of a column chunk in bytes
+  size_t max_dictionary_size = default_max_dictionary_size;
+  /// Target size of a row group in bytes, before compression
+  size_t row_group_size = default_row_group_size;
+  /// Target size of a data page in bytes, before compression
+  size_t page_size = default_page_size;
+  /// Encode the values of the pages that are not dictionary-encoded with DELTA_BINARY_PACKED
+  /// (integers), BYTE_STREAM_SPLIT (floating-point) and DELTA_BYTE_ARRAY (strings) instead of PLAIN
+  bool delta_encodings = false;
+  /// False positive probability of the column chunk bloom filters of each column
+  std::vector<double> bloom_filter_fpp;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -140,9 +186,28 @@ struct writer_options {
    * @brief Constructor to populate writer options.
    *
    * @param format Compression format to use
+   * @param stats_lvl Statistics level to generate
+   * @param max_dict_size Maximum size of the dictionary of a column chunk in bytes
+   * @param row_group_size_bytes Target size of a row group in bytes, before compression
+   * @param page_size_bytes Target size of a data page in bytes, before compression
+   * @param use_delta_encodings Whether to use the delta and byte stream split encodings
+   * @param fpp_per_column False positive probability of the bloom filters of each column; no
+   * bloom filters are written for the columns without a positive value
    */
-  explicit writer_options(compression_type format, statistics_freq stats_lvl)
-    : compression(format), stats_granularity(stats_lvl)
+  explicit writer_options(compression_type format,
+                          statistics_freq stats_lvl,
+                          size_t max_dict_size               = default_max_dictionary_size,
+                          size_t row_group_size_bytes        = default_row_group_size,
+                          size_t page_size_bytes             = default_page_size,
+                          bool use_delta_encodings           = false,
+                          std::vector<double> fpp_per_column = {})
+    : compression(format),
+      stats_granularity(stats_lvl),
+      max_dictionary_size(max_dict_size),
+      row_group_size(row_group_size_bytes),
+      page_size(page_size_bytes),
+      delta_encodings(use_delta_encodings),
+      bloom_filter_fpp(std::move(fpp_per_column))
   {
   }
 };
@@ -227,6 +292,24 @@ class writer {
    */
   static std::unique_ptr<std::vector<uint8_t>> merge_rowgroup_metadata(
     const std::vector<std::unique_ptr<std::vector<uint8_t>>>& metadata_list);
+
+  /**
+   * @brief Writes the rows of each partition of a table to a separate file.
+   *
+   * The sink the writer was constructed with is not used.
+   *
+   * @param table Set of columns to output, including the partition columns
+   * @param partition_columns Indices of the columns the rows are partitioned by
+   * @param sink_factory Returns the sink of each partition
+   * @param metadata Table metadata and column names
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return The distinct partition keys, in the order of the partitions
+   */
+  std::unique_ptr<table> write_partitioned(table_view const& table,
+                                           std::vector<size_type> const& partition_columns,
+                                           partition_sink_factory const& sink_factory,
+                                           const table_metadata* metadata = nullptr,
+                                           cudaStream_t stream            = 0);
 };
 
 }  // namespace parquet
@@ -358,6 +441,84 @@ class writer {
 
 }  // namespace csv
 
+namespace json {
+
+/**
+ * @brief Options for the JSON writer.
+ * Also base class for `write_json_args`
+ */
+struct writer_options {
+  writer_options()                      = default;
+  writer_options(writer_options const&) = default;
+
+  virtual ~writer_options(void) = default;
+
+  /**
+   * @brief Constructor to populate writer options.
+   *
+   * @param rows_per_chunk maximum number of rows to format for each write to the sink
+   * @param include_nulls flag that indicates whether to write the null fields of a record
+   * as `null`, or to leave them out
+   */
+  writer_options(int rows_per_chunk, bool include_nulls = true)
+    : rows_per_chunk_(rows_per_chunk), include_nulls_(include_nulls)
+  {
+  }
+
+  int rows_per_chunk(void) const { return rows_per_chunk_; }
+
+  bool include_nulls(void) const { return include_nulls_; }
+
+  // maximum number of rows to format for each write to the sink:
+  //
+  int rows_per_chunk_ = std::numeric_limits<int>::max();
+
+  // Indicates whether to write the null fields as `null`:
+  //
+  bool include_nulls_ = true;
+};
+
+/**
+ * @brief Class to write a table as JSON Lines, one JSON object per row.
+ */
+class writer {
+ public:
+  class impl;
+
+ private:
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for output to a sink.
+   *
+   * @param sinkp The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  writer(std::unique_ptr<cudf::io::data_sink> sinkp,
+         writer_options const& options,
+         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~writer();
+
+  /**
+   * @brief Writes the entire dataset.
+   *
+   * @param table Set of columns to output
+   * @param metadata Table metadata and column names
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write_all(table_view const& table,
+                 const table_metadata* metadata = nullptr,
+                 cudaStream_t stream            = 0);
+};
+
+}  // namespace json
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
@@ -1,7 +1,14 @@
+#pragma once
+
 #include <arrow/api.h>
 #include <arrow/gpu/cuda_api.h>
 #include <arrow/io/memory.h>
 #include <arrow/ipc/api.h>
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <vector>
 
 class CudaMessageReader : arrow::ipc::MessageReader {
  public:
@@ -17,3 +24,57 @@ class CudaMessageReader : arrow::ipc::MessageReader {
   arrow::io::BufferReader* host_schema_reader_ = nullptr;
   std::shared_ptr<arrow::cuda::CudaBufferReader> owned_stream_;
 };
+
+namespace cudf {
+/**
+ * @brief A table exported by `export_ipc` for other processes on the same device
+ *
+ * `handle` is sent to the importing processes. `packed` holds the device memory they map, and
+ * must be kept alive until every importer has released its `ipc_table_view`.
+ */
+struct ipc_exported_table {
+  std::vector<uint8_t> handle;
+  packed_columns packed;
+};
+
+/**
+ * @brief A table imported by `import_ipc`, viewing the device memory of the exporting process
+ *
+ * The memory stays mapped as long as a copy of `mapping` is alive, so `table` and any views
+ * derived from it must not outlive it.
+ */
+struct ipc_table_view {
+  table_view table;
+  std::shared_ptr<void const> mapping;
+};
+
+/**
+ * @brief Exports a table to other processes on the same device through CUDA IPC
+ *
+ * The table is packed into a single device buffer as by `pack`, and `handle` holds the CUDA IPC
+ * memory handle of the buffer along with the metadata of the packed columns. Only the metadata
+ * crosses the process boundary: importers map the packed buffer in place.
+ *
+ * @param input The table to export
+ * @param mr Device memory resource used to allocate the packed device buffer. It must allocate
+ * device memory that CUDA IPC can share, such as `cudaMalloc` memory or a pool of it.
+ * @return The handle to send to importers and the packed table backing it
+ */
+ipc_exported_table export_ipc(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Imports a table exported by `export_ipc` in another process, without copying it
+ *
+ * @throws cudf::logic_error if `handle` is not a table exported by `export_ipc` or was exported
+ * on another device.
+ * @throws cudf::cuda_error if the memory of the exporting process cannot be mapped, e.g. if it was
+ * exported by the calling process.
+ *
+ * @param handle Start of the handle of the exported table
+ * @param size Size of the handle in bytes
+ * @return View of the exported table, mapped for as long as it is alive
+ */
+ipc_table_view import_ipc(uint8_t const* handle, std::size_t size);
+
+}  // namespace cudf
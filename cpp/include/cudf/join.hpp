@@ -16,12 +16,22 @@
 
 #pragma once
 
+#include <cudf/communicator.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/memory_estimate.hpp>
+#include <cudf/types.hpp>
+
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+class expression;
+}  // namespace ast
+
 /**
  * @addtogroup column_join
  * @{
@@ -79,6 +89,7 @@ namespace cudf {
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -91,7 +102,8 @@ std::unique_ptr<cudf::table> inner_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls         = null_equality::EQUAL,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a left join (also known as left outer join) on the
@@ -147,6 +159,7 @@ std::unique_ptr<cudf::table> inner_join(
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -159,6 +172,71 @@ std::unique_ptr<cudf::table> left_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Performs an inner join like `cudf::inner_join()`, using a merge join when both tables
+ * are sorted on the join keys.
+ *
+ * If `keys_order[i].is_sorted` is `sorted::YES` for every key, both `left` and `right` must be
+ * sorted on their key columns with the given orderings. The rows of each table are then matched
+ * with binary searches into the other instead of a hash table, so no hash table memory is used,
+ * and the result is sorted on the key columns. Otherwise this is the same as `cudf::inner_join()`.
+ *
+ * @throw cudf::logic_error under the same conditions as `cudf::inner_join()`.
+ * @throw cudf::logic_error if the number of elements in `keys_order` and `left_on` mismatch.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] columns_in_common is a vector of pairs of column indices into `left` and `right`,
+ * respectively, that are "in common". More details please @see cudf::inner_join().
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param[in] keys_order How both tables are ordered on each pair of key columns.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return Result of joining `left` and `right` tables on the columns
+ * specified by `left_on` and `right_on`.
+ */
+std::unique_ptr<cudf::table> inner_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  null_equality compare_nulls,
+  std::vector<order_info> const& keys_order,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a left join like `cudf::left_join()`, using a merge join when both tables are
+ * sorted on the join keys.
+ *
+ * More details please @see the `cudf::inner_join()` overload taking `keys_order`.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] columns_in_common is a vector of pairs of column indices into `left` and `right`,
+ * respectively, that are "in common". More details please @see cudf::left_join().
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param[in] keys_order How both tables are ordered on each pair of key columns.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return Result of joining `left` and `right` tables on the columns
+ * specified by `left_on` and `right_on`.
+ */
+std::unique_ptr<cudf::table> left_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  null_equality compare_nulls,
+  std::vector<order_info> const& keys_order,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
 /**
@@ -215,6 +293,7 @@ std::unique_ptr<cudf::table> left_join(
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -227,7 +306,303 @@ std::unique_ptr<cudf::table> full_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+/**
+ * @brief Index in the join gather maps for the rows that have no match in the other table.
+ *
+ * The value is out of bounds for any table, also with negative indices, so `cudf::gather()` with
+ * `check_bounds` throws on it; gathers with a nullifying out-of-bounds policy produce nulls.
+ */
+constexpr size_type join_no_match = std::numeric_limits<size_type>::min();
+
+/**
+ * @brief Returns the row indices of `left` and `right` that make up the inner join of the two
+ * tables, instead of gathering the joined table.
+ *
+ * Row `i` of the join is row `first[i]` of `left` with row `second[i]` of `right`; gathering the
+ * needed columns with these maps yields the same rows as `cudf::inner_join()`, in the same order.
+ *
+ * @throw cudf::logic_error under the same conditions as `cudf::inner_join()`.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Pair of non-nullable `INT32` columns of row indices into `left` and `right`.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of `left` and `right` that make up the left join of the two
+ * tables, instead of gathering the joined table.
+ *
+ * Rows of `left` without a match have the index `join_no_match` in the second column.
+ *
+ * More details please @see cudf::inner_join_indices().
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Pair of non-nullable `INT32` columns of row indices into `left` and `right`.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of `left` and `right` that make up the full join of the two
+ * tables, instead of gathering the joined table.
+ *
+ * Rows of either table without a match have the index `join_no_match` in the column of the other
+ * table.
+ *
+ * More details please @see cudf::inner_join_indices().
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Pair of non-nullable `INT32` columns of row indices into `left` and `right`.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of the pairs of rows of `left` and `right` where the value of
+ * `left` lies within the interval of `right`, and the equality keys of both rows match.
+ *
+ * A pair (`l`, `r`) is in the result if
+ * `right[right_lower][r] <= left[left_value][l] <= right[right_upper][r]` and
+ * `left[left_equal_on[i]][l] == right[right_equal_on[i]][r]` for every `i`, such as for
+ * `left.ts BETWEEN right.start AND right.end`. `left` is sorted on its equality keys and value,
+ * so the matches of each `right` row are a contiguous range of the sorted rows, found with two
+ * binary searches; the work and memory are proportional to the inputs and the number of matches,
+ * never to the product of the table sizes.
+ *
+ * The result lists the matches of each `right` row in turn, in `right` order. Rows with a null
+ * value or interval bound never match.
+ *
+ * @code{.pseudo}
+ *          Left ts: {1, 5, 9, 12}
+ *          Right start: {0, 4, 20}, end: {5, 10, 30}
+ * Result: { left: {0, 1, 1, 2}, right: {0, 0, 1, 1} }
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of elements in `left_equal_on` and `right_equal_on`
+ * mismatch.
+ * @throw cudf::logic_error if the types of the equality keys or of the value and the interval
+ * bounds differ.
+ *
+ * @param[in] left The table of values
+ * @param[in] right The table of intervals
+ * @param[in] left_equal_on The column indices from `left` that must equal those of `right`.
+ * @param[in] right_equal_on The column indices from `right` that must equal those of `left`.
+ * @param[in] left_value The index of the column of `left` holding the values.
+ * @param[in] right_lower The index of the column of `right` holding the inclusive lower bounds.
+ * @param[in] right_upper The index of the column of `right` holding the inclusive upper bounds.
+ * @param[in] compare_nulls controls whether null equality-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return Pair of non-nullable `INT32` columns of row indices into `left` and `right`.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> interval_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_equal_on,
+  std::vector<cudf::size_type> const& right_equal_on,
+  cudf::size_type left_value,
+  cudf::size_type right_lower,
+  cudf::size_type right_upper,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs an inner join like `cudf::inner_join()`, one partition at a time.
+ *
+ * Both tables are hash partitioned on the join columns, so that matching rows land in the same
+ * partition, and each pair of partitions is joined with its own hash table. Compared to one hash
+ * table over all of `right`, the small hash tables stay in the L2 cache while they are probed.
+ * Partitions waiting to be joined are moved to host memory if the device memory runs out, and are
+ * copied back when their turn comes.
+ *
+ * The rows of the result are grouped by partition, so their order differs from `inner_join()`.
+ *
+ * @throw cudf::logic_error under the same conditions as `cudf::inner_join()`.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] columns_in_common @see cudf::inner_join().
+ * @param[in] num_partitions Number of partitions; zero chooses the number so that the hash table
+ * of one partition of `right` fits in the L2 cache.
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return Result of joining `left` and `right` tables, as `cudf::inner_join()`.
+ */
+std::unique_ptr<cudf::table> partitioned_inner_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  cudf::size_type num_partitions      = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a left join like `cudf::left_join()`, one partition at a time.
+ *
+ * More details please @see cudf::partitioned_inner_join().
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] columns_in_common @see cudf::left_join().
+ * @param[in] num_partitions Number of partitions; zero chooses the number so that the hash table
+ * of one partition of `right` fits in the L2 cache.
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return Result of joining `left` and `right` tables, as `cudf::left_join()`.
+ */
+std::unique_ptr<cudf::table> partitioned_left_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  cudf::size_type num_partitions      = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a full join like `cudf::full_join()`, one partition at a time.
+ *
+ * More details please @see cudf::partitioned_inner_join().
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] columns_in_common @see cudf::full_join().
+ * @param[in] num_partitions Number of partitions; zero chooses the number so that the hash table
+ * of one partition of `right` fits in the L2 cache.
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return Result of joining `left` and `right` tables, as `cudf::full_join()`.
+ */
+std::unique_ptr<cudf::table> partitioned_full_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  cudf::size_type num_partitions      = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs an inner join like `cudf::inner_join()` of tables distributed over the ranks
+ * of `comm`.
+ *
+ * Every rank calls this function with its own rows of `left` and `right`. Both tables are hash
+ * partitioned on the join columns into `comm.size()` partitions, and partition `i` is sent to
+ * rank `i`, so that all the matching rows meet on one rank. The partitions are sent as the single
+ * buffers of `cudf::contiguous_split()`. Once the partitions of `right` arrived, a rank builds a
+ * hash table over them and probes it with each partition of `left` as soon as that partition
+ * arrived, while the others are still being received.
+ *
+ * Each rank returns its part of the join; the union over all the ranks is the join of the whole
+ * tables. The messages of a call use the tags `[0, 5)`, so other messages of the same ranks must
+ * not be in flight during the call.
+ *
+ * @throw cudf::logic_error under the same conditions as `cudf::inner_join()`.
+ * @throw cudf::logic_error if `left_on` is empty.
+ *
+ * @param[in] left The rows of the left table on this rank
+ * @param[in] right The rows of the right table on this rank
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] columns_in_common @see cudf::inner_join().
+ * @param[in] comm Transport between the ranks taking part in the join
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return The rows of the join found on this rank, grouped by the rank they were received from.
+ */
+std::unique_ptr<cudf::table> distributed_inner_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  communicator& comm,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a left join like `cudf::left_join()` of tables distributed over the ranks of
+ * `comm`.
+ *
+ * More details please @see cudf::distributed_inner_join().
+ *
+ * @param[in] left The rows of the left table on this rank
+ * @param[in] right The rows of the right table on this rank
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] columns_in_common @see cudf::left_join().
+ * @param[in] comm Transport between the ranks taking part in the join
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return The rows of the join found on this rank, grouped by the rank they were received from.
+ */
+std::unique_ptr<cudf::table> distributed_left_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  communicator& comm,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Performs a left semi join on the specified columns of two
  * tables (`left`, `right`)
@@ -270,6 +645,7 @@ std::unique_ptr<cudf::table> full_join(
  * @param[in] compare_nulls    Controls whether null join-key values should match or not.
  * @param[in] mr               Device memory resource used to allocate the returned table's
  *                             device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return                     Result of joining `left` and `right` tables on the columns
  *                             specified by `left_on` and `right_on`. The resulting table
@@ -282,7 +658,8 @@ std::unique_ptr<cudf::table> left_semi_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<cudf::size_type> const& return_columns,
   null_equality compare_nulls         = null_equality::EQUAL,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a left anti join on the specified columns of two
@@ -326,6 +703,7 @@ std::unique_ptr<cudf::table> left_semi_join(
  * @param[in] compare_nulls    Controls whether null join-key values should match or not.
  * @param[in] mr               Device memory resource used to allocate the returned table's
  *                             device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return                     Result of joining `left` and `right` tables on the columns
  *                             specified by `left_on` and `right_on`. The resulting table
@@ -338,7 +716,8 @@ std::unique_ptr<cudf::table> left_anti_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<cudf::size_type> const& return_columns,
   null_equality compare_nulls         = null_equality::EQUAL,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a cross join on two tables (`left`, `right`)
@@ -359,13 +738,187 @@ std::unique_ptr<cudf::table> left_anti_join(
  * @param left  The left table
  * @param right The right table
  * @param mr    Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return     Result of cross joining `left` and `right` tables
  */
 std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Cross join, optionally conditioned by a predicate, that produces its result in chunks of
+ * bounded size.
+ *
+ * Each chunk is the join of a range of consecutive rows of `left` with all the rows of `right`,
+ * sized so that it pairs at most `max_chunk_pairs` rows, and the chunks follow each other in the
+ * order of `cross_join`. With a predicate, the pairs of a chunk are filtered by evaluating the
+ * predicate on their row indices before any column is gathered, so only the pairs which satisfy
+ * it are materialized; this is a nested-loop join on an arbitrary condition.
+ *
+ * @code{.pseudo}
+ * auto a = ast::column_reference(0, ast::table_reference::LEFT);
+ * auto b = ast::column_reference(0, ast::table_reference::RIGHT);
+ * auto less = ast::operation(ast::ast_operator::LESS, a, b);
+ * cudf::chunked_cross_join join(left, right, 1 << 24, &less);
+ * while (join.has_next()) { process(join.next()); }
+ * @endcode
+ *
+ * @note The `chunked_cross_join` object must not outlive `left`, `right` or the predicate.
+ */
+class chunked_cross_join {
+ public:
+  chunked_cross_join() = delete;
+  ~chunked_cross_join();
+  chunked_cross_join(chunked_cross_join const&) = delete;
+  chunked_cross_join(chunked_cross_join&&)      = delete;
+  chunked_cross_join& operator=(chunked_cross_join const&) = delete;
+  chunked_cross_join& operator=(chunked_cross_join&&) = delete;
+
+  /**
+   * @brief Constructs a chunked cross join of `left` and `right`.
+   *
+   * @throw cudf::logic_error if the number of columns in either `left` or `right` table is 0
+   * @throw cudf::logic_error if `max_chunk_pairs` is not positive
+   *
+   * @param left The left table
+   * @param right The right table
+   * @param max_chunk_pairs Maximum number of pairs of rows of a chunk, before the predicate is
+   * applied. A chunk holds at least one row of `left`, whatever the size of `right`.
+   * @param predicate Optional BOOL8 expression of the pairs to keep, whose `LEFT` and `RIGHT`
+   * column references refer to `left` and `right`
+   */
+  chunked_cross_join(cudf::table_view const& left,
+                     cudf::table_view const& right,
+                     size_type max_chunk_pairs,
+                     ast::expression const* predicate = nullptr);
+
+  /**
+   * @brief Returns whether there are chunks left to produce.
+   *
+   * There are none if either table has no rows.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Returns the number of rows of `left` not joined yet.
+   */
+  size_type remaining_left_rows() const;
+
+  /**
+   * @brief Produces the row indices of the pairs of the next chunk.
+   *
+   * @throw cudf::logic_error if there are no chunks left
+   * @throw cudf::logic_error if the predicate is not a BOOL8 expression
+   *
+   * @param mr Device memory resource used to allocate the returned columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The indices into `left` and into `right` of the pairs of rows of the chunk
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> next_indices(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Produces the next chunk of the join.
+   *
+   * @throw cudf::logic_error if there are no chunks left
+   * @throw cudf::logic_error if the predicate is not a BOOL8 expression
+   *
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The columns of `left` followed by the columns of `right` for the pairs of the chunk
+   */
+  std::unique_ptr<cudf::table> next(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+ private:
+  struct chunked_cross_join_impl;
+  const std::unique_ptr<chunked_cross_join_impl> impl;
+};
+
+/**
+ * @brief Blocked Bloom filter over the rows of a key table, used as a runtime filter for joins.
+ *
+ * Each key row sets 8 bits in one 256-bit block chosen by its hash, so a lookup touches a single
+ * 32-byte block. `contains()` has no false negatives; with the default of 10 bits per key about
+ * 1% of the rows that are not keys are reported as possible matches.
+ *
+ * The filter is typically built from the build side of a join to drop the probe rows that cannot
+ * match before the join:
+ * @code{.pseudo}
+ * cudf::bloom_filter filter(dimension.select({0}));
+ * auto facts = cudf::read_parquet(args);  // args.filters = filter.range_predicates({"fk"})
+ * auto kept  = cudf::apply_boolean_mask(facts.tbl->view(),
+ *                                       filter.contains(facts.tbl->select({fk_index}))->view());
+ * @endcode
+ *
+ * The filter does not reference the key table after construction.
+ */
+class bloom_filter {
+ public:
+  bloom_filter() = delete;
+  ~bloom_filter();
+  bloom_filter(bloom_filter const&) = delete;
+  bloom_filter(bloom_filter&&)      = delete;
+  bloom_filter& operator=(bloom_filter const&) = delete;
+  bloom_filter& operator=(bloom_filter&&) = delete;
+
+  /**
+   * @brief Builds the filter from the rows of `keys`.
+   *
+   * @throw cudf::logic_error if `keys` has no columns or `bits_per_key` is not positive.
+   *
+   * @param keys The key columns.
+   * @param bits_per_key Number of filter bits per key row; more bits give fewer false positives.
+   * @param compare_nulls Whether key rows with nulls are inserted, and found by `contains()`.
+   * @param mr Device memory resource used to allocate the filter's device memory.
+   */
+  bloom_filter(cudf::table_view const& keys,
+               size_type bits_per_key              = 10,
+               null_equality compare_nulls         = null_equality::EQUAL,
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Returns whether each row of `keys` may be one of the rows the filter was built from.
+   *
+   * @throw cudf::logic_error if the column types of `keys` differ from the key columns.
+   *
+   * @param keys The rows to look up.
+   * @param mr Device memory resource used to allocate the returned column's device memory.
+   *
+   * @return Non-nullable `BOOL8` column, `false` for the rows that are certainly not keys
+   */
+  std::unique_ptr<cudf::column> contains(
+    cudf::table_view const& keys,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Returns reader predicates bounding the key columns by their minimum and maximum.
+   *
+   * Passed as the `filters` of the Parquet or ORC reader, the predicates skip the row groups and
+   * stripes whose statistics show they only hold values outside of the key range, before any of
+   * their data is decoded. No predicate is returned for key columns whose type has no ordering,
+   * that are all null, or that hold nulls which `compare_nulls` makes match.
+   *
+   * @throw cudf::logic_error if the number of names differs from the number of key columns.
+   *
+   * @param column_names Names of the key columns in the file to read.
+   *
+   * @return `GREATER_EQUAL` and `LESS_EQUAL` predicates for each bounded key column
+   */
+  std::vector<io::column_predicate> range_predicates(
+    std::vector<std::string> const& column_names) const;
+
+ private:
+  struct bloom_filter_impl;
+  const std::unique_ptr<const bloom_filter_impl> impl;
+};
 
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
@@ -373,6 +926,10 @@ std::unique_ptr<cudf::table> cross_join(
  *
  * This class enables the hash join scheme that builds hash table once, and probes as many times as
  * needed (possibly in parallel).
+ *
+ * The hash table is complete when the constructor returns and is never modified afterwards, so
+ * the `const` member functions may be called concurrently from several threads, each probing on
+ * its own stream (e.g. with per-thread default streams).
  */
 class hash_join {
  public:
@@ -383,6 +940,16 @@ class hash_join {
   hash_join& operator=(hash_join const&) = delete;
   hash_join& operator=(hash_join&&) = delete;
 
+  /**
+   * @brief Controls how the probe calls size the join output.
+   */
+  enum class output_size_policy {
+    ESTIMATE,  ///< Allocate the output from an estimate computed on a sample of the probe rows,
+               ///< and probe again with twice the size if the estimate is too small.
+    EXACT      ///< Count the output rows of every probe row, then write the matches of each probe
+               ///< row at its offset. Always two passes, and the output has the exact size.
+  };
+
   /**
    * @brief Construct a hash join object for subsequent probe calls.
    *
@@ -391,8 +958,14 @@ class hash_join {
    *
    * @param build The build table, from which the hash table is built.
    * @param build_on The column indices from `build` to join on.
+   * @param size_policy How the probe calls size the join output. `EXACT` avoids the repeated
+   * probes and the over-allocation of `ESTIMATE` when the keys are skewed.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    */
-  hash_join(cudf::table_view const& build, std::vector<size_type> const& build_on);
+  hash_join(cudf::table_view const& build,
+            std::vector<size_type> const& build_on,
+            output_size_policy size_policy = output_size_policy::ESTIMATE,
+            cudaStream_t stream            = 0);
 
   /**
    * @brief Controls where common columns will be output for a inner join.
@@ -431,6 +1004,7 @@ class hash_join {
    * @param compare_nulls Controls whether null join-key values should match or not.
    * @param mr Device memory resource used to allocate the returned table and columns' device
    * memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return Table pair of (`probe`, `build`) of joining both tables on the columns
    * specified by `probe_on` and `build_on`. The resulting table pair will be joined columns of
@@ -444,7 +1018,8 @@ class hash_join {
     std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
     common_columns_output_side common_columns_output_side = common_columns_output_side::PROBE,
     null_equality compare_nulls                           = null_equality::EQUAL,
-    rmm::mr::device_memory_resource* mr                   = rmm::mr::get_default_resource()) const;
+    rmm::mr::device_memory_resource* mr                   = rmm::mr::get_default_resource(),
+    cudaStream_t stream                                   = 0) const;
 
   /**
    * @brief Performs a left join by probing in the internal hash table.
@@ -462,6 +1037,7 @@ class hash_join {
    * @param compare_nulls Controls whether null join-key values should match or not.
    * @param mr Device memory resource used to allocate the returned table and columns' device
    * memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return Result of joining `build` and `probe` tables on the columns
    * specified by `build_on` and `probe_on`. The resulting table will be joined columns of
@@ -472,7 +1048,8 @@ class hash_join {
     std::vector<size_type> const& probe_on,
     std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
     null_equality compare_nulls         = null_equality::EQUAL,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
 
   /**
    * @brief Performs a full join by probing in the internal hash table.
@@ -490,6 +1067,7 @@ class hash_join {
    * @param compare_nulls Controls whether null join-key values should match or not.
    * @param mr Device memory resource used to allocate the returned table and columns' device
    * memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return Result of joining `build` and `probe` tables on the columns
    * specified by `build_on` and `probe_on`. The resulting table will be joined columns of
@@ -500,8 +1078,211 @@ class hash_join {
     std::vector<size_type> const& probe_on,
     std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
     null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the row indices of `probe` and of the build table that make up their inner
+   * join, instead of gathering the joined tables.
+   *
+   * More details please @see cudf::inner_join_indices().
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned columns' device memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Pair of non-nullable `INT32` columns of row indices into `probe` and the build table.
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join_indices(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the row indices of `probe` and of the build table that make up their left
+   * join, instead of gathering the joined table.
+   *
+   * More details please @see cudf::left_join_indices().
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned columns' device memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Pair of non-nullable `INT32` columns of row indices into `probe` and the build table.
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join_indices(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the row indices of `probe` and of the build table that make up their full
+   * join, instead of gathering the joined table.
+   *
+   * More details please @see cudf::full_join_indices().
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned columns' device memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Pair of non-nullable `INT32` columns of row indices into `probe` and the build table.
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join_indices(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Performs a left semi join by probing in the internal hash table.
+   *
+   * Returns the `return_columns` of the rows of `probe` that have a match in the build table, in
+   * `probe` order.
+   *
+   * More details please @see cudf::left_semi_join().
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param return_columns The column indices from `probe` to include in the returned table.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned table's device memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Result of the semi join of `probe` with the build table.
+   */
+  std::unique_ptr<cudf::table> left_semi_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    std::vector<size_type> const& return_columns,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Performs a left anti join by probing in the internal hash table.
+   *
+   * Returns the `return_columns` of the rows of `probe` that have no match in the build table, in
+   * `probe` order.
+   *
+   * More details please @see cudf::left_anti_join().
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param return_columns The column indices from `probe` to include in the returned table.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned table's device memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Result of the anti join of `probe` with the build table.
+   */
+  std::unique_ptr<cudf::table> left_anti_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    std::vector<size_type> const& return_columns,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Builds a Bloom filter from the key columns of the build table.
+   *
+   * Probe rows for which the filter's `contains()` is `false` have no match in the build table, so
+   * they can be dropped before probing, or skipped by the readers. More details please
+   * @see cudf::bloom_filter.
+   *
+   * @param bits_per_key Number of filter bits per build row.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the filter's device memory.
+   *
+   * @return Bloom filter of the build keys, independent of the lifetime of the build table
+   */
+  std::unique_ptr<bloom_filter> make_bloom_filter(
+    size_type bits_per_key              = 10,
+    null_equality compare_nulls         = null_equality::EQUAL,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
 
+  /**
+   * @brief Returns upper bounds on the device memory of constructing a `hash_join` of `build`.
+   *
+   * Computed from the sizes of `build` alone, without any device work, so that it can be called
+   * before deciding whether and where to build. `output_bytes` is the memory held by the
+   * `hash_join` object until it is destroyed.
+   *
+   * @param build The build table, from which the hash table would be built.
+   * @param build_on The column indices from `build` to join on.
+   *
+   * @return Upper bounds on the temporary memory of the construction and on the memory of the
+   * hash table
+   */
+  static memory_estimate estimate_build_memory(cudf::table_view const& build,
+                                               std::vector<size_type> const& build_on);
+
+  /**
+   * @brief Returns upper bounds on the device memory of `inner_join(probe, probe_on, ...)`.
+   *
+   * The output rows of the probe are counted exactly, as by the first pass of the `EXACT` output
+   * size policy, and the over-allocations of the `ESTIMATE` policy are replayed from the same
+   * estimate as the probe uses. `output_bytes` bounds the joined tables with all the columns of
+   * `probe` and of the build table, where every strings or lists row is counted as large as the
+   * largest row of its column. It also bounds the output of `inner_join_indices()`.
+   *
+   * @param probe The probe table, from which the tuples would be probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Upper bounds on the temporary and output device memory of the join
+   */
+  memory_estimate estimate_inner_join_memory(cudf::table_view const& probe,
+                                             std::vector<size_type> const& probe_on,
+                                             null_equality compare_nulls = null_equality::EQUAL,
+                                             cudaStream_t stream         = 0) const;
+
+  /**
+   * @brief Returns upper bounds on the device memory of `left_join(probe, probe_on, ...)`.
+   *
+   * More details please @see estimate_inner_join_memory().
+   *
+   * @param probe The probe table, from which the tuples would be probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Upper bounds on the temporary and output device memory of the join
+   */
+  memory_estimate estimate_left_join_memory(cudf::table_view const& probe,
+                                            std::vector<size_type> const& probe_on,
+                                            null_equality compare_nulls = null_equality::EQUAL,
+                                            cudaStream_t stream         = 0) const;
+
+  /**
+   * @brief Returns upper bounds on the device memory of `full_join(probe, probe_on, ...)`.
+   *
+   * More details please @see estimate_inner_join_memory().
+   *
+   * @param probe The probe table, from which the tuples would be probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Upper bounds on the temporary and output device memory of the join
+   */
+  memory_estimate estimate_full_join_memory(cudf::table_view const& probe,
+                                            std::vector<size_type> const& probe_on,
+                                            null_equality compare_nulls = null_equality::EQUAL,
+                                            cudaStream_t stream         = 0) const;
+
  private:
   struct hash_join_impl;
   const std::unique_ptr<const hash_join_impl> impl;
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_contains
+ * @{
+ */
+
+/**
+ * @brief Create a column of bool values indicating whether the specified scalar
+ * is an element of each row of a list column.
+ *
+ * Output `column[i]` is `true` if any valid element of the sublist `lists_column[i]` equals
+ * `search_key`. Floating point NaN elements are equal to a NaN key.
+ *
+ * @code{.pseudo}
+ * l = { {1, 2, 3}, {}, null, {4, null, 1} }
+ * r = contains(l, 1)
+ * r is now {true, false, null, true}
+ * @endcode
+ *
+ * Any input where `lists_column[i] == null` will produce output `column[i] = null`. If
+ * `search_key` is invalid, all the output rows are null.
+ *
+ * @throws cudf::logic_error if the type of `search_key` is not the type of the elements.
+ * @throws cudf::logic_error if the elements are not of a fixed-width, non fixed-point type or
+ * strings.
+ *
+ * @param lists_column Column of lists to search.
+ * @param search_key The scalar to search for in each sublist.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return BOOL8 column of the result of the search in each sublist.
+ */
+std::unique_ptr<column> contains(
+  lists_column_view const& lists_column,
+  scalar const& search_key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace lists
+}  // namespace cudf
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup aggregation_reduction
+ * @{
+ */
+
+/**
+ * @brief Computes the reduction of the elements of each list of a lists column.
+ *
+ * Output `column[i]` is the reduction `agg` of the sublist `lists_column[i]`, computed with
+ * `cudf::segmented_reduce` over the child column and the offsets of the lists.
+ *
+ * @code{.pseudo}
+ * l = { {1, 2, 3}, {}, null, {4, null} }
+ * r = reduce_list_elements(l, max, INT32)
+ * r is now {3, null, null, 4}
+ * @endcode
+ *
+ * Any input where `lists_column[i] == null` or `lists_column[i]` is empty will produce
+ * output `column[i] = null`. The null elements of the sublists follow `null_handling`, as in
+ * `cudf::segmented_reduce`.
+ *
+ * @throws cudf::logic_error if the aggregation, the child type or `output_dtype` is not supported
+ * by `cudf::segmented_reduce`.
+ *
+ * @param lists_column Column of lists of arithmetic elements.
+ * @param agg The aggregation operator applied to each sublist.
+ * @param output_dtype The computation and output precision.
+ * @param null_handling Whether a null element makes the result of its sublist null.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Column of the reduction of each sublist.
+ */
+std::unique_ptr<column> reduce_list_elements(
+  lists_column_view const& lists_column,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace lists
+}  // namespace cudf
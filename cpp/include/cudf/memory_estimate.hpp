@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @file memory_estimate.hpp
+ * @brief Upper bounds on the device memory used by an operation, returned by the `estimate_*`
+ * functions of the join, groupby, sorting and parquet reader APIs.
+ */
+
+namespace cudf {
+/**
+ * @brief Upper bounds on the device memory allocated by an operation
+ *
+ * Every buffer is counted as rounded up to 256 bytes, the alignment of the RMM memory resources.
+ * Allocations of the memory resources themselves, and memory used by the CUDA runtime, are not
+ * counted.
+ */
+struct memory_estimate {
+  std::size_t temporary_bytes{0};  ///< Bytes allocated and freed during the operation
+  std::size_t output_bytes{0};     ///< Bytes of the returned columns
+
+  /**
+   * @brief Returns an upper bound on the device memory in use at any point of the operation
+   */
+  std::size_t peak_bytes() const { return temporary_bytes + output_bytes; }
+
+  memory_estimate& operator+=(memory_estimate const& other)
+  {
+    temporary_bytes += other.temporary_bytes;
+    output_bytes += other.output_bytes;
+    return *this;
+  }
+};
+
+}  // namespace cudf
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup reorder_partition
+ * @{
+ */
+
+/**
+ * @brief A device taking part in a multi-device operation, with the stream and the memory
+ * resource of the work of the operation on it
+ *
+ * A device may be listed more than once, e.g. with different streams.
+ */
+struct device_resources {
+  int device;                                     ///< CUDA device ordinal
+  cudaStream_t stream                 = 0;        ///< Stream of the work on `device`
+  rmm::mr::device_memory_resource* mr = nullptr;  ///< Allocates the results on `device`, the
+                                                  ///< per-device resource of `device` if null
+};
+
+/**
+ * @brief A table split into consecutive parts, each in the memory of one device.
+ *
+ * Part `i` is owned by the table and lives on `device(i)`. The table is the concatenation of
+ * its parts in order, which `views()` returns without copying them and `combine()` copies to a
+ * single device.
+ */
+class multi_device_table {
+ public:
+  multi_device_table(std::vector<device_resources> devices,
+                     std::vector<std::unique_ptr<table>> parts);
+
+  /**
+   * @brief Returns the number of parts, one per device of the operation
+   */
+  size_type num_parts() const { return static_cast<size_type>(_parts.size()); }
+
+  /**
+   * @brief Returns the number of rows of all parts
+   */
+  size_type num_rows() const;
+
+  /**
+   * @brief Returns the device, stream and memory resource of part `i`
+   */
+  device_resources const& device(size_type i) const { return _devices.at(i); }
+
+  /**
+   * @brief Returns the view of part `i`, in the memory of `device(i)`
+   */
+  table_view part(size_type i) const { return _parts.at(i)->view(); }
+
+  /**
+   * @brief Returns the views of all parts in order, each in the memory of its device
+   */
+  std::vector<table_view> views() const;
+
+  /**
+   * @brief Copies all parts to the device of `target` and concatenates them there.
+   *
+   * Every part is copied with `cudaMemcpyPeerAsync` as one contiguous block, after the work on
+   * its stream. The result is allocated with the memory resource of `target`.
+   *
+   * @param target The device, stream and memory resource of the result
+   * @return The concatenation of the parts in order
+   */
+  std::unique_ptr<table> combine(device_resources const& target) const;
+
+  /**
+   * @brief Releases ownership of the parts, leaving the table empty
+   */
+  std::vector<std::unique_ptr<table>> release();
+
+ private:
+  std::vector<device_resources> _devices;
+  std::vector<std::unique_ptr<table>> _parts;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 #include <memory>
 #include <vector>
@@ -88,6 +89,58 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   int num_partitions,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the hash partitions of the rows of the input table without reordering it.
+ *
+ * The rows are assigned to partitions as in `hash_partition`. Returns a gather map of the row
+ * indices of `input` in partition order, in which the rows of every partition keep their order
+ * in `input`, and a vector of offsets to the start of each partition in the gather map.
+ *
+ * The partitions are computed by radix sorting the partition numbers, so the cost does not
+ * depend on the number of partitions being small.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A gather map of `size_type` row indices and a vector of offsets to each partition
+ */
+std::pair<std::unique_ptr<column>, std::vector<size_type>> hash_partition_map(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Partitions the rows of the input table by hash into one contiguous buffer per partition.
+ *
+ * The rows are assigned to partitions as in `hash_partition`, and the result is the one of
+ * `contiguous_split` of the table returned by `hash_partition` at its partition offsets, without
+ * the partitioned table: the rows of a table of fixed-width columns are gathered directly into
+ * the buffer of their partition. The rows of every partition keep their order in `input`.
+ *
+ * Returns `num_partitions` results, of which the `i`th holds the rows of partition `i`, or no
+ * results if `num_partitions <= 0`, `input` has no rows or `columns_to_hash` is empty.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ * @throw cudf::logic_error if a column of `input` is not fixed-width or strings
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param mr Device memory resource used to allocate the returned buffers' device memory.
+ *
+ * @returns The view of every partition and the buffer it views
+ */
+std::vector<contiguous_split_result> contiguous_hash_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Round-robin partition.
  *
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @file query_plan.hpp
+ * @brief Chains of operations evaluated lazily, as a whole.
+ */
+
+namespace cudf {
+
+/**
+ * @addtogroup column_apis
+ * @{
+ */
+
+/**
+ * @brief A graph of operations on tables, evaluated when its results are requested.
+ *
+ * Each method adds a node to the plan and returns its id, to be used as the input of later
+ * nodes. Nothing is computed until `execute`, which evaluates the nodes the requested outputs
+ * depend on:
+ * - The rows selected by filters, gathers and joins are tracked as row maps, which are composed
+ *   instead of gathering every intermediate table. A column is gathered once, through the
+ *   composed row map, when a predicate, join key, reduction or output reads it.
+ * - Projections only drop columns, so the columns no later node reads are never gathered.
+ * - All the reductions of the same column are computed by a single multi-reduction.
+ * - The row maps and the columns of an intermediate node are released as soon as the last node
+ *   reading it is evaluated.
+ *
+ * @code{.pseudo}
+ * query_plan plan;
+ * auto orders   = plan.scan(orders_table);
+ * auto big      = plan.filter(orders, amount_greater_than_100);
+ * auto joined   = plan.inner_join(big, plan.scan(customers_table), {1}, {0});
+ * auto selected = plan.project(joined, {0, 5});
+ * auto total    = plan.reduce(selected, 0, make_sum_aggregation(), data_type{type_id::INT64});
+ * auto results  = plan.execute({selected, total});
+ * // results[0].rows is the projected table, results[1].value the sum
+ * @endcode
+ *
+ * The tables, gather maps and expressions given to the plan are referred to, not copied, and
+ * must outlive the calls to `execute`.
+ */
+class query_plan {
+ public:
+  using node_id = size_type;  ///< Id of a node of the plan
+
+  /**
+   * @brief The result of an output of `execute`.
+   *
+   * `rows` holds the table of a table node and `value` the scalar of a reduction node.
+   */
+  struct result {
+    std::unique_ptr<table> rows;
+    std::unique_ptr<scalar> value;
+  };
+
+  query_plan();
+  ~query_plan();
+  query_plan(query_plan const&) = delete;
+  query_plan& operator=(query_plan const&) = delete;
+
+  /**
+   * @brief Adds a node reading a table.
+   *
+   * @param input The table, which must outlive the calls to `execute`
+   * @return The id of the node
+   */
+  node_id scan(table_view const& input);
+
+  /**
+   * @brief Adds a node keeping the rows of `input` for which `predicate` is true and not null.
+   *
+   * @throw cudf::logic_error if `input` is not a table node
+   * @throw cudf::logic_error if `predicate` refers to a column out of the range of `input` or to
+   * the `RIGHT` table
+   *
+   * @param input The node to filter
+   * @param predicate The BOOL8 expression of the rows to keep, evaluated on the columns of
+   * `input`. It must outlive the calls to `execute`.
+   * @return The id of the node
+   */
+  node_id filter(node_id input, ast::expression const& predicate);
+
+  /**
+   * @brief Adds a node selecting columns of `input`.
+   *
+   * @throw cudf::logic_error if `input` is not a table node or a column index is out of range
+   *
+   * @param input The node to select columns of
+   * @param columns The indices of the columns to keep, in their output order
+   * @return The id of the node
+   */
+  node_id project(node_id input, std::vector<size_type> const& columns);
+
+  /**
+   * @brief Adds a node gathering the rows of `input`, as `cudf::gather`.
+   *
+   * The indices must be in the range `[-n, n)`, where `n` is the number of rows of `input`.
+   *
+   * @throw cudf::logic_error if `input` is not a table node
+   * @throw cudf::logic_error if `gather_map` is not integral or has nulls
+   *
+   * @param input The node to gather the rows of
+   * @param gather_map The rows of `input` to gather. It must outlive the calls to `execute`.
+   * @return The id of the node
+   */
+  node_id gather(node_id input, column_view const& gather_map);
+
+  /**
+   * @brief Adds a node with the inner join of `left` and `right`.
+   *
+   * The columns of the node are the columns of `left` followed by the columns of `right`.
+   * The rows are in the order of `cudf::inner_join_indices`.
+   *
+   * @throw cudf::logic_error if `left` or `right` is not a table node
+   * @throw cudf::logic_error if `left_on` and `right_on` have different sizes or an index is out
+   * of range
+   *
+   * @param left The left node
+   * @param right The right node
+   * @param left_on The indices of the key columns of `left`
+   * @param right_on The indices of the key columns of `right`
+   * @param compare_nulls Whether null keys are equal
+   * @return The id of the node
+   */
+  node_id inner_join(node_id left,
+                     node_id right,
+                     std::vector<size_type> const& left_on,
+                     std::vector<size_type> const& right_on,
+                     null_equality compare_nulls = null_equality::EQUAL);
+
+  /**
+   * @brief Adds a node with the reduction of a column of `input`, as `cudf::reduce`.
+   *
+   * A reduction node cannot be the input of other nodes.
+   *
+   * @throw cudf::logic_error if `input` is not a table node or `column` is out of range
+   *
+   * @param input The node to reduce a column of
+   * @param column The index of the column to reduce
+   * @param agg The aggregation of the reduction
+   * @param output_dtype The computation and output precision
+   * @return The id of the node
+   */
+  node_id reduce(node_id input,
+                 size_type column,
+                 std::unique_ptr<aggregation> const& agg,
+                 data_type output_dtype);
+
+  /**
+   * @brief Evaluates the nodes `outputs` depend on and returns the results of `outputs`.
+   *
+   * The plan is not modified, so it can be executed again, e.g. after the data of its scanned
+   * tables changed.
+   *
+   * @throw cudf::logic_error if an id of `outputs` is not a node of the plan
+   * @throw cudf::logic_error under the same conditions as the operation of a node
+   *
+   * @param outputs The nodes to return the results of
+   * @param mr Device memory resource used to allocate the device memory of the results
+   * @return The result of each node of `outputs`, in their order
+   */
+  std::vector<result> execute(
+    std::vector<node_id> const& outputs,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  struct node;
+  std::vector<std::unique_ptr<node>> nodes;
+
+  node const& table_node(node_id id) const;
+  node_id add(std::unique_ptr<node> n);
+};
+
+/** @} */  // end of group
+}  // namespace cudf
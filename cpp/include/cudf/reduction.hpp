@@ -17,7 +17,11 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/column/indexed_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
 
 namespace cudf {
 /**
@@ -62,13 +66,125 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the reduction of the values in the rows of a column selected by indices.
+ *
+ * Returns the same result as `reduce(col.materialize(), agg, output_dtype)`. The `sum`,
+ * `product`, `min`, `max`, `sum_of_squares`, `any` and `all` reductions read the selected rows
+ * in place through the indices; the other reductions gather them first.
+ *
+ * @throws cudf::logic_error under the same conditions as `reduce()` of a column.
+ *
+ * @param[in] col Input rows
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned scalar's device memory
+ * @returns  cudf::scalar the result value
+ */
+std::unique_ptr<scalar> reduce(
+  indexed_column_view const &col,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes several reductions of the values in all rows of a column.
+ *
+ * Returns the same results as calling `reduce(col, aggs[i], output_dtypes[i])` for each `i`, but
+ * the `sum`, `min`, `max`, `sum_of_squares`, `mean`, `var` and `std` reductions of an arithmetic
+ * column are computed together in a single pass over the column, accumulating sums in 64 bits.
+ * The `count` aggregation is also supported, with `null_policy::INCLUDE` counting all the rows.
+ * Other reductions, and the reductions of non-arithmetic columns, read the column once each.
+ *
+ * @throws cudf::logic_error if `aggs` and `output_dtypes` have different sizes.
+ * @throws cudf::logic_error under the same conditions as `reduce()` for each reduction.
+ *
+ * @param[in] col Input column view
+ * @param[in] aggs The aggregation operators applied by the reductions
+ * @param[in] output_dtypes The computation and output precision of each reduction
+ * @param[in] mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns The result of each reduction, in the order of `aggs`
+ */
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const &col,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  std::vector<data_type> const &output_dtypes,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes several reductions of each column of a table.
+ *
+ * Equivalent to calling the multi-reduction `reduce(table.column(c), aggs, output_dtypes[c])`
+ * for each column `c`, so that every column is read once for all its fused reductions.
+ *
+ * @throws cudf::logic_error if `output_dtypes` does not have one entry per column of `table`.
+ * @throws cudf::logic_error under the same conditions as the multi-reduction of a column.
+ *
+ * @param[in] table Input table view
+ * @param[in] aggs The aggregation operators applied to each column
+ * @param[in] output_dtypes For each column, the output precision of each aggregation of `aggs`
+ * @param[in] mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns For each column, the result of each reduction in the order of `aggs`
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const &table,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  std::vector<std::vector<data_type>> const &output_dtypes,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the reduction of each segment of a column.
+ *
+ * The segment `i` is made of the rows `[segment_offsets[i], segment_offsets[i + 1])` of
+ * `values`, so that the output has `segment_offsets.size() - 1` rows. All the segments are
+ * reduced by a single device-wide segmented reduction.
+ *
+ * Only the `sum`, `product`, `min`, `max`, `sum_of_squares`, `any` and `all` aggregations of
+ * arithmetic columns are supported; `any` and `all` require a `BOOL8` output.
+ *
+ * The output row `i` is null if the segment `i` is empty or, when `null_handling` is
+ * null_policy::EXCLUDE, has only null elements. When `null_handling` is null_policy::INCLUDE, it is
+ * null if the segment has any null element.
+ *
+ * @code{.pseudo}
+ * values  = {1, 2, 3, null, 5, 6}
+ * offsets = {0, 3, 3, 6}
+ * r = segmented_reduce(values, offsets, sum, INT64)
+ * r is now {6, null, 11}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `segment_offsets` is empty, has nulls or is not of `size_type`.
+ * @throws cudf::logic_error if the aggregation, `values` or `output_dtype` is not supported.
+ *
+ * @param[in] values Input column view
+ * @param[in] segment_offsets The ascending offsets of the segments into `values`, followed by the
+ * end offset of the last segment
+ * @param[in] agg unique_ptr of the aggregation operator applied to each segment
+ * @param[in] output_dtype The computation and output precision
+ * @param[in] null_handling Whether a null element makes the result of its segment null
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @returns Column with the reduction of each segment
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const &values,
+  column_view const &segment_offsets,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
  * The null values are skipped for the operation, and if an input element
  * at `i` is null, then the output element at `i` will also be null.
  *
- * @throws cudf::logic_error if column datatype is not numeric type.
+ * Arithmetic columns support the `sum`, `product`, `min` and `max` scans. Duration and
+ * fixed_point columns support `sum`, `min` and `max`, computed in the scale of the column, and
+ * timestamp and string columns support `min` and `max`. String columns only support inclusive
+ * scans.
+ *
+ * @throws cudf::logic_error if the aggregation is not supported for the column datatype.
  *
  * @param[in] input The input column view for the scan
  * @param[in] agg unique_ptr to aggregation operator applied by the scan
@@ -86,5 +202,46 @@ std::unique_ptr<column> scan(const column_view &input,
                              null_policy null_handling           = null_policy::EXCLUDE,
                              rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the scan of each segment of a column.
+ *
+ * The segment `i` is made of the rows `[segment_offsets[i], segment_offsets[i + 1])` of `input`,
+ * and the scan restarts at the first row of every segment. The segments must cover the column:
+ * the first offset is 0 and the last is `input.size()`.
+ *
+ * With null_policy::EXCLUDE, the null elements are skipped and stay null in the output. With
+ * null_policy::INCLUDE, an output row is null if its input row or a previous row of its segment
+ * is null, for both inclusive and exclusive scans.
+ *
+ * @code{.pseudo}
+ * input   = {1, 2, 3, 4, null, 6}
+ * offsets = {0, 3, 6}
+ * r = segmented_scan(input, offsets, sum, INCLUSIVE)
+ * r is now {1, 3, 6, 4, null, 10}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `segment_offsets` is empty, has nulls or is not of `size_type`.
+ * @throws cudf::logic_error if the aggregation is not supported by `scan` for the fixed-width
+ * column datatype. String columns are not supported.
+ *
+ * @param[in] input The input column view for the scan
+ * @param[in] segment_offsets The ascending offsets of the segments into `input`, followed by
+ * `input.size()`
+ * @param[in] agg unique_ptr to aggregation operator applied by the scan
+ * @param[in] inclusive The flag for applying an inclusive scan if
+ *            scan_type::INCLUSIVE, an exclusive scan if scan_type::EXCLUSIVE.
+ * @param[in] null_handling Whether the null elements are skipped or make the rest of their segment
+ * null
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @returns unique pointer to new output column
+ */
+std::unique_ptr<column> segmented_scan(
+  const column_view &input,
+  column_view const &segment_offsets,
+  std::unique_ptr<aggregation> const &agg,
+  scan_type inclusive,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -60,6 +60,22 @@ std::unique_ptr<column> replace_nulls(
   scalar const& replacement,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Replaces all null values in a fixed-width column in-place with a scalar.
+ *
+ * Null elements of `input` are overwritten with `replacement` and every element
+ * of `input` is marked valid. Use the out-of-place `replace_nulls` for columns
+ * that would need memory reallocation.
+ *
+ * @throws cudf::logic_error if `input` is not a fixed-width column.
+ * @throws cudf::logic_error if `input` and `replacement` have different types.
+ * @throws cudf::logic_error if `replacement` is invalid.
+ *
+ * @param[in,out] input A column whose null values will be replaced
+ * @param[in] replacement Scalar used to replace null values in `input`.
+ */
+void replace_nulls_in_place(mutable_column_view& input, scalar const& replacement);
+
 /**
  * @brief Replaces all NaN values in a column with corresponding values from another column
  *
@@ -68,5 +68,60 @@ std::unique_ptr<table> tile(table_view const& input,
                             size_type count,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Explodes a list column's elements.
+ *
+ * Any list is exploded, which means the elements of the list in each row are expanded into new
+ * rows in the output. The corresponding rows of the other columns in the input are duplicated.
+ * Null and empty lists produce no output rows.
+ *
+ * ```
+ * input_table = [[[1, 2], 7], [[], 8], [[5, 6, 7], 9]]
+ * explode_column_idx = 0
+ * return = [[1, 7], [2, 7], [5, 9], [6, 9], [7, 9]]
+ * ```
+ *
+ * The output rows are in the order of the elements in the child column of the lists. Without
+ * null lists the exploded column is a copy of the elements covered by the lists, and only the
+ * other columns are gathered.
+ *
+ * @throws cudf::logic_error if `explode_column_idx` is not the index of a lists column.
+ *
+ * @param[in] input_table Table to explode.
+ * @param[in] explode_column_idx Index of the lists column to explode.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @return The table with the list column replaced by its elements.
+ */
+std::unique_ptr<table> explode(
+  table_view const& input_table,
+  size_type explode_column_idx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Explodes a list column's elements, and includes their position in their list.
+ *
+ * As `explode`, with an `INT32` column of the position of each element in its list inserted
+ * before the exploded column.
+ *
+ * ```
+ * input_table = [[[1, 2], 7], [[], 8], [[5, 6, 7], 9]]
+ * explode_column_idx = 0
+ * return = [[0, 1, 7], [1, 2, 7], [0, 5, 9], [1, 6, 9], [2, 7, 9]]
+ * ```
+ *
+ * @throws cudf::logic_error if `explode_column_idx` is not the index of a lists column.
+ *
+ * @param[in] input_table Table to explode.
+ * @param[in] explode_column_idx Index of the lists column to explode.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @return The table with the list column replaced by the positions and the elements.
+ */
+std::unique_ptr<table> explode_position(
+  table_view const& input_table,
+  size_type explode_column_idx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
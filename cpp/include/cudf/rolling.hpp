@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -60,6 +61,32 @@ std::unique_ptr<column> rolling_window(
   std::unique_ptr<aggregation> const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies several fixed-size rolling window functions to the values in a column.
+ *
+ * Returns the column of `rolling_window(input, preceding_window, following_window, min_periods,
+ * aggs[i])` for every aggregation of `aggs`. The SUM, MEAN, MIN, MAX, COUNT_VALID and COUNT_ALL
+ * aggregations of a numeric column read every window once for all of them.
+ *
+ * @throws cudf::logic_error if an aggregation of `aggs` is a UDF
+ *
+ * @param[in] input The input column
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregation types (SUM, MAX, MIN, etc.)
+ *
+ * @returns   The nullable output columns containing the rolling window results of `aggs`
+ **/
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a grouping-aware, fixed-size rolling window function to the values in a column.
  *
@@ -139,6 +166,36 @@ std::unique_ptr<column> grouped_rolling_window(
   std::unique_ptr<aggregation> const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies several grouping-aware, fixed-size rolling window functions to the values in a
+ *         column.
+ *
+ * Returns the column of `grouped_rolling_window(group_keys, input, preceding_window,
+ * following_window, min_periods, aggs[i])` for every aggregation of `aggs`. The groups are found
+ * once for all the aggregations, and the SUM, MEAN, MIN, MAX, COUNT_VALID and COUNT_ALL
+ * aggregations of a numeric column read every window once for all of them.
+ *
+ * @throws cudf::logic_error if an aggregation of `aggs` is a UDF
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] input The input column (to be aggregated)
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregation types (SUM, MAX, MIN, etc.)
+ *
+ * @returns   The nullable output columns containing the rolling window results of `aggs`
+ **/
+std::vector<std::unique_ptr<column>> grouped_rolling_window(
+  table_view const& group_keys,
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a grouping-aware, timestamp-based rolling window function to the values in a
  *column.
@@ -233,6 +290,120 @@ std::unique_ptr<column> grouped_time_range_rolling_window(
   std::unique_ptr<aggregation> const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies several grouping-aware, timestamp-based rolling window functions to the values
+ *         in a column.
+ *
+ * Returns the column of `grouped_time_range_rolling_window(group_keys, timestamp_column,
+ * timestamp_order, input, preceding_window_in_days, following_window_in_days, min_periods,
+ * aggs[i])` for every aggregation of `aggs`. The window bounds are searched for once for all the
+ * aggregations, and the SUM, MEAN, MIN, MAX, COUNT_VALID and COUNT_ALL aggregations of a numeric
+ * column read every window once for all of them.
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] timestamp_column The (pre-sorted) timestamps for each row
+ * @param[in] timestamp_order  The order (ASCENDING/DESCENDING) in which the timestamps are sorted
+ * @param[in] input The input column (to be aggregated)
+ * @param[in] preceding_window_in_days The rolling window time-interval in the backward direction.
+ * @param[in] following_window_in_days The rolling window time-interval in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregation types (SUM, MAX, MIN, etc.)
+ *
+ * @returns   The nullable output columns containing the rolling window results of `aggs`
+ */
+std::vector<std::unique_ptr<column>> grouped_time_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& timestamp_column,
+  cudf::order const& timestamp_order,
+  column_view const& input,
+  size_type preceding_window_in_days,
+  size_type following_window_in_days,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Applies a grouping-aware, value range-based rolling window function to the values in a
+ *         column.
+ *
+ * Like `grouped_time_range_rolling_window()`, the window of each row spans the rows of its group
+ * whose `orderby_column` values lie within a range around its own value. The range is
+ * `preceding_window` before and `following_window` after the value of the row, in the direction
+ * of `order`. `orderby_column` may be of any numeric type other than BOOL8, or of any timestamp
+ * type. The range bounds are scalars of the same type as `orderby_column` for numeric types, and
+ * durations of the same resolution for timestamps.
+ *
+ * @code{.pseudo}
+ * orderby  = [ 1, 2, 4, 5, 9,   1, 3, 3 ]
+ * input    = [ 1, 1, 1, 1, 1,   1, 1, 1 ]
+ *              <---group1--->|<-group2->
+ * preceding_window = 1, following_window = 2
+ * SUM      = [ 2, 3, 2, 2, 1,   3, 2, 2 ]
+ * @endcode
+ *
+ * The window bounds of all rows are found by one vectorized binary search over the pre-sorted
+ * groups.
+ *
+ * @throws cudf::logic_error if `orderby_column` has nulls, or is not of a supported type
+ * @throws cudf::logic_error if the range bounds are null, negative, or of the wrong type
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] orderby_column The (pre-sorted) order-by column, within each group
+ * @param[in] order The order (ASCENDING/DESCENDING) in which `orderby_column` is sorted
+ * @param[in] input The input column (to be aggregated)
+ * @param[in] preceding_window The range of values in the backward direction
+ * @param[in] following_window The range of values in the forward direction
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggr The rolling window aggregation type (SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column containing the rolling window results
+ */
+std::unique_ptr<column> grouped_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  column_view const& input,
+  scalar const& preceding_window,
+  scalar const& following_window,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Applies several grouping-aware, value range-based rolling window functions to the
+ *         values in a column.
+ *
+ * Returns the column of `grouped_range_rolling_window(group_keys, orderby_column, order, input,
+ * preceding_window, following_window, min_periods, aggs[i])` for every aggregation of `aggs`. The
+ * window bounds are searched for once for all the aggregations, and the SUM, MEAN, MIN, MAX,
+ * COUNT_VALID and COUNT_ALL aggregations of a numeric column read every window once for all of
+ * them.
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] orderby_column The (pre-sorted) order-by column, within each group
+ * @param[in] order The order (ASCENDING/DESCENDING) in which `orderby_column` is sorted
+ * @param[in] input The input column (to be aggregated)
+ * @param[in] preceding_window The range of values in the backward direction
+ * @param[in] following_window The range of values in the forward direction
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregation types (SUM, MAX, MIN, etc.)
+ *
+ * @returns   The nullable output columns containing the rolling window results of `aggs`
+ */
+std::vector<std::unique_ptr<column>> grouped_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  column_view const& input,
+  scalar const& preceding_window,
+  scalar const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
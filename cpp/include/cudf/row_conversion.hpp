@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup reshape_row_conversion
+ * @{
+ */
+
+/**
+ * @brief Converts a table into a column of packed rows.
+ *
+ * Row `i` of the result is a list of the bytes of row `i` of `input`, laid out as follows:
+ * - the value of every column, in column order, each at an offset aligned to its size. A STRING
+ *   value is a pair of 32-bit integers, the offset of its characters in the row and their number,
+ *   aligned to 4 bytes.
+ * - one validity byte per 8 columns, bit `c % 8` of byte `c / 8` being set if column `c` is valid
+ * - padding to a multiple of 8 bytes, followed by the characters of the STRING values in column
+ *   order, and padding of the row to a multiple of 8 bytes.
+ *
+ * The values of null elements are unspecified, and null strings have no characters. Without
+ * STRING columns all rows have the same size.
+ *
+ * @code{.pseudo}
+ * input:  {{1, 2}, {3, null}} of INT32 and INT16
+ * result: {{1, 0, 0, 0, 3, 0, 0b11, 0}, {2, 0, 0, 0, ?, ?, 0b01, 0}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if a column of `input` is neither fixed-width nor STRING
+ * @throw cudf::logic_error if the fixed-width part of a row, which includes the validity bytes,
+ * is larger than 48KB
+ * @throw cudf::logic_error if the rows hold more than `size_type` bytes in total
+ *
+ * @param input The table to convert
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return LIST of INT8 column of the rows of `input`
+ */
+std::unique_ptr<column> convert_to_rows(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Converts a column of packed rows, as returned by `convert_to_rows`, back into a table.
+ *
+ * @throw cudf::logic_error if `input` is not a LIST of INT8 column
+ * @throw cudf::logic_error if a type of `schema` is neither fixed-width nor STRING
+ *
+ * @param input The rows to convert
+ * @param schema The data types of the columns of the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table of the rows of `input`, with the types of `schema`
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
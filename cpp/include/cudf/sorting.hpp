@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/memory_estimate.hpp>
+#include <cudf/multi_device.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
@@ -52,6 +54,7 @@ enum class rank_method {
  * for each column.  Size must be equal to `input.num_columns()` or empty.
  * If empty, all columns will be sorted in `null_order::BEFORE`.
  * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return A non-nullable column of `size_type` elements containing the permuted row indices of
  * `input` if it were sorted
  */
@@ -59,7 +62,8 @@ std::unique_ptr<column> sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
-  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
 
 /**
  * @brief Computes the row indices that would produce `input` in a stable
@@ -73,8 +77,216 @@ std::unique_ptr<column> stable_sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
+/**
+ * @brief Computes the row indices that would sort every segment of the rows of `keys` in a stable
+ * lexicographical order.
+ *
+ * Segment `i` is the rows `[segment_offsets[i], segment_offsets[i + 1])`, and the indices of
+ * every segment stay within it. Rows before the first offset and rows after the last offset are
+ * sorted as two more segments. The offsets of a `LIST` column sort the elements of every list.
+ * When all the key columns are of fixed-width types, the segments are radix sorted together in
+ * a fixed number of passes over the rows.
+ *
+ * @code{.pseudo}
+ * keys            = {{3, 1, 2, 9, 7, 8}}
+ * segment_offsets = {0, 3, 6}
+ * result          = {1, 2, 0, 4, 5, 3}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `segment_offsets` is not a `size_type` column without nulls
+ *
+ * @param keys The table to sort
+ * @param segment_offsets The ascending offsets of the starts of the segments, followed by the
+ * end of the last segment
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column.  Size must be equal to `keys.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` elements containing the permuted row indices of
+ * `keys` if every segment were sorted
+ */
+std::unique_ptr<column> segmented_sorted_order(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a key-value sort within every segment of the rows.
+ *
+ * @throws cudf::logic_error if `values.num_rows() != keys.num_rows()`.
+ *
+ * @copydetails cudf::segmented_sorted_order
+ * @param values The table to reorder
+ * @return The reordering of `values` determined by the lexicographic order of the rows of `keys`
+ * within every segment
+ */
+std::unique_ptr<table> segmented_sort_by_key(
+  table_view const& values,
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the row indices of the first `k` rows of `input` in a stable lexicographical
+ * sorted order.
+ *
+ * The result is the first `k` indices of `stable_sorted_order`, that is the indices of the `k`
+ * smallest rows for ascending order and of the `k` largest rows for descending order. When the
+ * first column is of a fixed-width type, the kth smallest key of that column is radix selected
+ * first, and only the rows which can be among the first `k` rows are sorted.
+ *
+ * @throws cudf::logic_error if `k` is negative.
+ *
+ * @param input The table to select from
+ * @param k The number of rows to select. All the rows are selected if `k` is larger.
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `input.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column.  Size must be equal to `input.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` elements containing the indices of the first
+ * `min(k, input.num_rows())` rows of `input` if it were sorted
+ */
+std::unique_ptr<column> top_k_order(
+  table_view const& input,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the first `k` rows of `input` in a stable lexicographical sorted order.
+ *
+ * A single column is selected from as a table of one column.
+ *
+ * @copydetails cudf::top_k_order
+ * @return New table containing the first `min(k, input.num_rows())` rows of the sorted `input`
+ */
+std::unique_ptr<table> top_k(
+  table_view const& input,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Sorts a table too large for device memory, pushed as a sequence of tables, and returns
+ * it in sorted chunks.
+ *
+ * Every pushed table is sorted on the device as one run, which is split into blocks of
+ * `chunk_rows` rows spilled to pinned host memory. Once all the tables are pushed, every call to
+ * `next_chunk` merges the runs with `cudf::merge`, copying their blocks back to the device one at
+ * a time, and returns the next `chunk_rows` rows of the sorted table. The device memory used
+ * while merging is about one block of every run and one chunk of output.
+ *
+ * Rows with equal keys from different runs are returned in no particular order.
+ *
+ * @code{.pseudo}
+ * external_sorter sorter({0}, {order::ASCENDING});
+ * for (auto const& part : parts) { sorter.push(part); }
+ * while (sorter.has_next_chunk()) { write(sorter.next_chunk()->view()); }
+ * @endcode
+ */
+class external_sorter {
+ public:
+  external_sorter()                       = delete;
+  external_sorter(external_sorter const&) = delete;
+  external_sorter& operator=(external_sorter const&) = delete;
+  ~external_sorter();
+
+  /**
+   * @brief Construct an external sorter.
+   *
+   * @throws cudf::logic_error if `chunk_rows` is not positive, or if `column_order` or
+   * `null_precedence` is not empty and has a different size than `key_columns`.
+   *
+   * @param key_columns The indices of the columns of the pushed tables to sort on
+   * @param column_order The desired order for each key column. If empty, all key columns are
+   * sorted in ascending order.
+   * @param null_precedence The desired order of a null element compared to other elements for
+   * each key column. If empty, all key columns are sorted with `null_order::BEFORE`.
+   * @param chunk_rows The number of rows of the spilled blocks and of the returned chunks
+   */
+  external_sorter(std::vector<size_type> const& key_columns,
+                  std::vector<order> const& column_order         = {},
+                  std::vector<null_order> const& null_precedence = {},
+                  size_type chunk_rows                           = 1 << 24);
+
+  /**
+   * @brief Sorts `input` as one run and spills it to host memory.
+   *
+   * @throws cudf::logic_error if `next_chunk` was already called, or if `input` does not have
+   * the columns of the previously pushed tables.
+   *
+   * @param input The rows to add to the sorted table
+   */
+  void push(table_view const& input);
+
+  /**
+   * @brief Returns true if `next_chunk` has rows left to return.
+   */
+  bool has_next_chunk() const;
+
+  /**
+   * @brief Returns the next rows of the sorted table.
+   *
+   * @throws cudf::logic_error if there are no rows left.
+   *
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The next `chunk_rows` rows of the sorted table, or the remaining rows if fewer
+   */
+  std::unique_ptr<table> next_chunk(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+ private:
+  struct external_sorter_impl;
+  std::unique_ptr<external_sorter_impl> impl;
+};
+
+/**
+ * @brief Sorts a table across several devices, returning the sorted table as one part per
+ * device.
+ *
+ * Splitter rows are chosen from a sorted sample of the keys of `input`, and the rows of `input`
+ * are partitioned between them on the current device, so that part `i` holds the rows that sort
+ * between splitters `i - 1` and `i`. Every partition is copied to its device with
+ * `cudaMemcpyPeerAsync`, over NVLink when the devices are peers, and sorted there on the stream
+ * and with the memory resource of the device, concurrently with the other devices. The parts in
+ * order are the sorted table.
+ *
+ * The parts are about equally large unless many rows have equal keys. Rows with equal keys are
+ * returned in no particular order.
+ *
+ * @throws cudf::logic_error if `devices` is empty, if a key column index is out of range, or if
+ * `column_order` or `null_precedence` is not empty and has a different size than `key_columns`.
+ *
+ * @param input The table to sort, on the current device
+ * @param key_columns The indices of the columns of `input` to sort on
+ * @param devices The devices to sort on, with the stream and memory resource of each
+ * @param column_order The desired order for each key column. If empty, all key columns are
+ * sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to other elements for
+ * each key column. If empty, all key columns are sorted with `null_order::BEFORE`.
+ * @return The sorted table, of which part `i` is on `devices[i]`
+ */
+multi_device_table multi_device_sort(table_view const& input,
+                                     std::vector<size_type> const& key_columns,
+                                     std::vector<device_resources> const& devices,
+                                     std::vector<order> const& column_order         = {},
+                                     std::vector<null_order> const& null_precedence = {});
+
 /**
  * @brief Checks whether the rows of a `table` are sorted in a lexicographical
  *        order.
@@ -107,12 +319,14 @@ bool is_sorted(cudf::table_view const& table,
  * `input.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
  * @param mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return New table containing the desired sorted order of `input`
  */
 std::unique_ptr<table> sort(table_view input,
                             std::vector<order> const& column_order         = {},
                             std::vector<null_order> const& null_precedence = {},
-                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                            cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a key-value sort.
@@ -132,6 +346,7 @@ std::unique_ptr<table> sort(table_view input,
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
  * @param mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return The reordering of `values` determined by the lexicographic order of
  * the rows of `keys`.
  */
@@ -140,7 +355,35 @@ std::unique_ptr<table> sort_by_key(
   table_view const& keys,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
-  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
+/**
+ * @brief Returns upper bounds on the device memory of `sort_by_key(values, keys, ...)`.
+ *
+ * The sorted order is a temporary, counted with the scratch space of the radix sort of
+ * fixed-width and strings keys or of the comparison sort of other keys. The output is a
+ * permutation of the rows of `values`, which has exactly the size of a copy of `values`.
+ *
+ * @throws cudf::logic_error if `values.num_rows() != keys.num_rows()`.
+ *
+ * @param values The table to reorder
+ * @param keys The table that determines the ordering
+ * @param stream CUDA stream used to read the offsets of strings and lists columns.
+ * @return Upper bounds on the temporary and output device memory of the sort
+ */
+memory_estimate estimate_sort_by_key_memory(table_view const& values,
+                                            table_view const& keys,
+                                            cudaStream_t stream = 0);
+
+/**
+ * @brief Returns upper bounds on the device memory of `sort(input, ...)`.
+ *
+ * @param input The table to sort
+ * @param stream CUDA stream used to read the offsets of strings and lists columns.
+ * @return Upper bounds on the temporary and output device memory of the sort
+ */
+memory_estimate estimate_sort_memory(table_view const& input, cudaStream_t stream = 0);
 
 /**
  * @brief Computes the ranks of input column in sorted order.
@@ -167,6 +410,7 @@ std::unique_ptr<table> sort_by_key(
  * for column
  * @param percentage flag to convert ranks to percentage in range (0,1}
  * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return std::unique_ptr<column> A column of containing the rank of the each
  * element of the column of `input`. The output column type will be `size_type`
  * column by default or else `double` when `method=rank_method::AVERAGE` or
@@ -178,7 +422,8 @@ std::unique_ptr<column> rank(column_view const& input,
                              null_policy null_handling,
                              null_order null_precedence,
                              bool percentage,
-                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
 
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/spillable_partition.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+
+/**
+ * @file spill.hpp
+ * @brief Tables whose device memory can be evicted to host memory under device memory pressure.
+ */
+
+namespace cudf {
+/**
+ * @addtogroup copy_split
+ * @{
+ */
+
+class spillable_table;
+
+/**
+ * @brief A view of a `spillable_table` that is kept in device memory while it is alive
+ *
+ * `table` can be passed to any API taking a `table_view`. The table cannot be spilled as long as
+ * a copy of `pin` is alive, so `table` and any views derived from it must not outlive it, and the
+ * work queued on them must be complete when it is released.
+ */
+struct pinned_table_view {
+  table_view table;
+  std::shared_ptr<void const> pin;
+};
+
+/**
+ * @brief Keeps the device memory of the tables it manages within a limit by spilling the least
+ * recently used ones to pinned host memory.
+ *
+ * Each managed table is copied into a single device buffer as by `contiguous_split`. Whenever a
+ * table is added, or a spilled table is brought back to the device, the least recently used
+ * tables that are not pinned are spilled until the device memory of all the tables fits within
+ * the limit. When every other table is pinned, the limit is exceeded rather than failing. When an
+ * allocation fails, unpinned tables are spilled and the allocation is retried.
+ *
+ * @code{.cpp}
+ * cudf::spill_manager manager(4ul << 30);
+ * auto cached = manager.make_spillable(table->view());
+ * table.reset();
+ * ...
+ * auto pinned = cached->pin();  // brought back to the device if it was spilled
+ * auto result = cudf::sort(pinned.table);
+ * @endcode
+ *
+ * All member functions of `spill_manager` and `spillable_table` are thread-safe. The managed
+ * tables may outlive the manager.
+ */
+class spill_manager {
+ public:
+  /**
+   * @brief Constructs a manager of tables using at most `device_limit` bytes of device memory.
+   *
+   * @param device_limit The device memory the managed tables may use before spilling, in bytes
+   * @param mr Device memory resource used to allocate the device memory of the managed tables
+   */
+  explicit spill_manager(std::size_t device_limit,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  ~spill_manager();
+  spill_manager(spill_manager const&) = delete;
+  spill_manager& operator=(spill_manager const&) = delete;
+
+  /**
+   * @brief Deep-copies a table into a new managed table, spilling other tables as needed.
+   *
+   * @param input The table to copy; it can be freed once this returns
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return The managed table, most recently used and not pinned
+   */
+  std::shared_ptr<spillable_table> make_spillable(table_view const& input,
+                                                  cudaStream_t stream = 0);
+
+  /**
+   * @brief Spills unpinned tables, least recently used first, until at least `size` bytes of
+   * device memory are freed or no unpinned table remains in device memory.
+   *
+   * This can be called when an allocation fails, to retry it.
+   *
+   * @param size The device memory to free, in bytes
+   * @return The device memory freed, in bytes
+   */
+  std::size_t spill(std::size_t size);
+
+  /**
+   * @brief Returns the device memory used by the managed tables, in bytes.
+   */
+  std::size_t device_size() const;
+
+  /**
+   * @brief Returns the device memory the managed tables may use before spilling, in bytes.
+   */
+  std::size_t device_limit() const;
+
+  /**
+   * @brief Sets the device memory the managed tables may use, spilling tables as needed.
+   *
+   * @param device_limit The new limit, in bytes
+   */
+  void set_device_limit(std::size_t device_limit);
+
+ private:
+  friend class spillable_table;
+  struct impl;
+  std::shared_ptr<impl> _impl;
+};
+
+/**
+ * @brief A table managed by a `spill_manager`, in device memory or spilled to pinned host memory
+ */
+class spillable_table : public std::enable_shared_from_this<spillable_table> {
+ public:
+  ~spillable_table();
+  spillable_table(spillable_table const&) = delete;
+  spillable_table& operator=(spillable_table const&) = delete;
+
+  /**
+   * @brief Returns a view of the table, bringing it back to the device if it was spilled.
+   *
+   * The table becomes the most recently used one, and is not spilled until the returned pin is
+   * released. A table may be pinned several times.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return View of the table, in device memory for as long as it is alive
+   */
+  pinned_table_view pin(cudaStream_t stream = 0);
+
+  /**
+   * @brief Spills the table to pinned host memory now.
+   *
+   * @return `false` if the table is pinned, else `true`
+   */
+  bool spill();
+
+  /**
+   * @brief Returns whether the table is spilled to host memory.
+   */
+  bool is_spilled() const;
+
+  /**
+   * @brief Returns whether the table is pinned in device memory.
+   */
+  bool is_pinned() const;
+
+  /**
+   * @brief Returns the memory used by the table in device memory or host memory, in bytes.
+   */
+  std::size_t size() const { return _size; }
+
+ private:
+  friend struct spill_manager::impl;
+
+  spillable_table(std::shared_ptr<spill_manager::impl> manager,
+                  detail::spillable_partition&& partition);
+
+  std::shared_ptr<spill_manager::impl> _manager;
+  detail::spillable_partition _partition;
+  std::size_t _size{};
+  int _pin_count{};
+  std::list<spillable_table*>::iterator _lru_position;  ///< Valid while in device memory
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @file statistics.hpp
+ * @brief Per-column statistics for query planning, computed from the data or read from file
+ * footers.
+ */
+
+namespace cudf {
+/**
+ * @addtogroup column_statistics
+ * @{
+ */
+
+/**
+ * @brief Statistics of a column
+ *
+ * Statistics that are not known are left at their default value: `-1` for counts and `nullptr`
+ * for values.
+ */
+struct column_statistics {
+  int64_t num_rows{0};                  ///< Number of rows described, including nulls
+  int64_t null_count{-1};               ///< Number of null rows
+  std::unique_ptr<scalar> min;          ///< Smallest non-null value
+  std::unique_ptr<scalar> max;          ///< Largest non-null value
+  int64_t approx_distinct_count{-1};    ///< Estimated number of distinct non-null values
+  std::unique_ptr<column> histogram;    ///< Bounds of equi-depth buckets of the non-null values
+  size_type sampled_rows{0};            ///< Number of rows min, max, NDV and histogram come from
+};
+
+/**
+ * @brief Options of `compute_column_statistics`
+ */
+struct statistics_options {
+  /// Number of rows to sample for min, max, NDV and histogram; all rows if 0 or `>= num_rows`
+  size_type sample_size{0};
+  /// Number of equi-depth histogram buckets; no histogram if 0
+  size_type num_histogram_buckets{16};
+  /// log2 of the number of registers of the HyperLogLog sketch used to estimate NDV, in [4, 18]
+  int distinct_count_precision{12};
+  /// Seed of the random sample
+  int64_t seed{0};
+};
+
+/**
+ * @brief Computes the statistics of every column of a table
+ *
+ * `num_rows` and `null_count` are always exact. `min`, `max`, `approx_distinct_count` and the
+ * `histogram` are computed from a random sample of `options.sample_size` rows, taken once for the
+ * whole table, or from all rows if `options.sample_size` is 0. Each of them is a reduction over
+ * the sampled values, except for the histogram which sorts them.
+ *
+ * The `histogram` holds `options.num_histogram_buckets + 1` bounds of the column's type: the
+ * values at the quantiles `i / num_histogram_buckets`, so that every bucket holds about the same
+ * number of non-null values.
+ *
+ * Min, max, NDV and histogram are only computed for fixed-width (except fixed-point) and string
+ * columns, and min, max and histogram are left unset if the sampled values are all null.
+ *
+ * @code{.pseudo}
+ * input = {{1, 5, 3, null, 9}}
+ * options.num_histogram_buckets = 2
+ * result[0] = {num_rows: 5, null_count: 1, min: 1, max: 9, approx_distinct_count: 4,
+ *              histogram: {1, 5, 9}, sampled_rows: 5}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `options.distinct_count_precision` is out of range
+ * @throw cudf::logic_error if `options.sample_size` or `options.num_histogram_buckets` is negative
+ *
+ * @param input Table whose columns are described
+ * @param options Sampling and sketch options
+ * @param mr Device memory resource used to allocate the returned scalars and columns
+ * @return The statistics of every column of `input`, in order
+ */
+std::vector<column_statistics> compute_column_statistics(
+  table_view const& input,
+  statistics_options const& options   = {},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
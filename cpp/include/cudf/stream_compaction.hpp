@@ -239,6 +239,49 @@ std::unique_ptr<table> drop_duplicates(
   null_equality nulls_equal           = null_equality::EQUAL,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Create a new table without duplicate rows, using a hash table rather than a sort
+ *
+ * Given an `input` table_view, each row is copied to output table if the corresponding
+ * row of `keys` columns is unique, where the definition of unique depends on the value of @p keep:
+ * - KEEP_FIRST: only the first of a set of duplicate rows is copied
+ * - KEEP_LAST: only the last of a set of duplicate rows is copied
+ * - KEEP_NONE: no duplicate rows are copied
+ *
+ * Unlike `drop_duplicates`, "first" and "last" refer to the position of the rows in `input`
+ * and the output is not sorted by `keys`. If @p preserve_input_order is true, the retained rows
+ * appear in their input order; otherwise their order is unspecified, which saves a second pass
+ * over the input.
+ *
+ * @code{.pseudo}
+ *          input   {col1: {5, 4, 3, 5, 8, 5},
+ *                   col2: {a, b, c, d, e, f}}
+ *          keys = {0}
+ *
+ *          distinct(input, keys, KEEP_FIRST) = {col1: {5, 4, 3, 8}, col2: {a, b, c, e}}
+ *          distinct(input, keys, KEEP_LAST)  = {col1: {4, 3, 8, 5}, col2: {b, c, e, f}}
+ *          distinct(input, keys, KEEP_NONE)  = {col1: {4, 3, 8},    col2: {b, c, e}}
+ * @endcode
+ *
+ * @param[in] input                input table_view to copy only unique rows
+ * @param[in] keys                 vector of indices representing key columns from `input`
+ * @param[in] keep                 keep first entry, last entry, or no entries if duplicates found
+ * @param[in] nulls_equal          flag to denote nulls are equal if null_equality::EQUAL,
+ * nulls are not equal if null_equality::UNEQUAL
+ * @param[in] preserve_input_order if true, the output rows are in the same order as in `input`
+ * @param[in] mr                   Device memory resource used to allocate the returned table's
+ * device memory
+ *
+ * @return Table with unique rows as per specified `keep`.
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  duplicate_keep_option keep          = duplicate_keep_option::KEEP_FIRST,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  bool preserve_input_order           = true,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Count the unique elements in the column_view
  *
@@ -156,6 +156,54 @@ std::unique_ptr<column> concatenate(
   string_scalar const& col_narep       = string_scalar("", false),
   rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
 
+/**
+ * @brief Row-wise formats the given columns into a single strings column
+ * using a format template.
+ *
+ * Each `{}` in the template is replaced by the value of the next column in
+ * the row. Use `{{` and `}}` for literal braces.
+ *
+ * The values are formatted as follows.
+ * - Strings are copied as is.
+ * - Integers are converted to base-10 with a `-` for negative values.
+ * - Booleans are converted to `true` or `false`.
+ * - Day timestamps are converted to `YYYY-MM-DD`, other timestamps to `YYYY-MM-DDThh:mm:ssZ`.
+ *
+ * All the rows are written in one pass, so no intermediate strings column is
+ * created for the converted or concatenated values.
+ *
+ * Any row with a null entry will result in the corresponding output
+ * row to be null entry unless a narep string is specified to be used
+ * in its place.
+ *
+ * @code{.pseudo}
+ * Example:
+ * c1 = [1, 22, null]
+ * c2 = ['a', 'b', 'c']
+ * r1 = format([c1,c2], "user:{}/{}")
+ * r1 is ['user:1/a', 'user:22/b', null]
+ * r2 = format([c1,c2], "{{{}}}-{}", '?')
+ * r2 is ['{1}-a', '{22}-b', '{?}-c']
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of `{}` in the template is not the number of columns.
+ * @throw cudf::logic_error if the template has an unmatched `{` or `}`.
+ * @throw cudf::logic_error if any column is not of a supported type.
+ *
+ * @param columns Columns whose values replace the `{}` in order.
+ * @param format_template Template of each output string.
+ * @param narep String that should be used in place of any null entries
+ *        found in any column. Default of invalid-scalar means any null entry in any column will
+ *        produces a null result for that row.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column with the formatted results.
+ */
+std::unique_ptr<column> format(
+  table_view const& columns,
+  std::string const& format_template,
+  string_scalar const& narep          = string_scalar("", false),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -48,6 +48,18 @@ std::unique_ptr<column> join_strings(strings_column_view const& strings,
                                      cudaStream_t stream,
                                      rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc format(table_view const&,std::string const&,string_scalar
+ * const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> format(table_view const& columns,
+                               std::string const& format_template,
+                               string_scalar const& narep,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
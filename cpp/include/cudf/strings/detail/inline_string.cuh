@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief A string of a strings column stored in 16 bytes, with its first bytes inline.
+ *
+ * The size and the first 4 bytes of the string, zero-padded, are stored first. The next 8 bytes
+ * store the rest of a string of up to 12 bytes, zero-padded, or the address of the bytes of a
+ * longer string in the chars of its column. A null string has size -1.
+ *
+ * Strings of different sizes or prefixes are told apart from their first 8 bytes alone, and
+ * strings of up to 12 bytes never read the offsets or the chars of their column.
+ */
+struct alignas(8) inline_string {
+  static constexpr size_type prefix_bytes = 4;
+  static constexpr size_type inline_bytes = prefix_bytes + sizeof(char const*);
+
+  size_type _size;
+  char _prefix[prefix_bytes];
+  union {
+    char _suffix[sizeof(char const*)];
+    char const* _data;
+  };
+
+  /**
+   * @brief Returns the inline string of `d_str`, which must stay valid as long as the inline
+   * string is used.
+   */
+  __device__ static inline_string create(string_view const& d_str)
+  {
+    inline_string result{};
+    result._size = d_str.size_bytes();
+    if (result._size <= inline_bytes) {
+      memcpy(result._prefix, d_str.data(), result._size);
+    } else {
+      memcpy(result._prefix, d_str.data(), prefix_bytes);
+      result._data = d_str.data();
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns the inline string of a null string.
+   */
+  __device__ static inline_string null()
+  {
+    inline_string result{};
+    result._size = -1;
+    return result;
+  }
+
+  __device__ bool is_null() const { return _size < 0; }
+
+  __device__ bool is_inline() const { return _size <= inline_bytes; }
+
+  /**
+   * @brief Returns a view of the string, which points into this object for inline strings.
+   */
+  __device__ string_view view() const
+  {
+    if (is_null()) return string_view(nullptr, 0);
+    return string_view(is_inline() ? _prefix : _data, _size);
+  }
+
+  /**
+   * @brief Returns true if both strings are equal, comparing the size and the prefix first.
+   *
+   * Two null strings are equal.
+   */
+  __device__ bool operator==(inline_string const& rhs) const
+  {
+    auto const lhs_words = reinterpret_cast<uint64_t const*>(this);
+    auto const rhs_words = reinterpret_cast<uint64_t const*>(&rhs);
+    if (lhs_words[0] != rhs_words[0]) return false;
+    if (is_inline()) return lhs_words[1] == rhs_words[1];
+    return string_view(_data + prefix_bytes, _size - prefix_bytes)
+             .compare(rhs._data + prefix_bytes, _size - prefix_bytes) == 0;
+  }
+
+  __device__ bool operator!=(inline_string const& rhs) const { return !(*this == rhs); }
+
+  /**
+   * @brief Compares the bytes of both strings, the prefixes first.
+   *
+   * @return Negative, zero or positive as in `string_view::compare`.
+   */
+  __device__ int compare(inline_string const& rhs) const
+  {
+    for (size_type idx = 0; idx < prefix_bytes; ++idx) {
+      auto const lhs_byte = static_cast<uint8_t>(_prefix[idx]);
+      auto const rhs_byte = static_cast<uint8_t>(rhs._prefix[idx]);
+      if (lhs_byte != rhs_byte) return lhs_byte < rhs_byte ? -1 : 1;
+    }
+    return view().compare(rhs.view());
+  }
+
+  /**
+   * @brief Returns the MurmurHash3 value of the string, equal to the one of its `string_view`.
+   */
+  __device__ hash_value_type hash() const { return MurmurHash3_32<string_view>{}(view()); }
+};
+
+static_assert(sizeof(inline_string) == 16, "inline_string must be 16 bytes");
+
+/**
+ * @brief Creates an inline string vector from a strings column.
+ *
+ * The long strings point into the chars of `strings`, which must outlive the vector.
+ *
+ * @param strings Strings column instance.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Device vector of inline strings
+ */
+rmm::device_vector<inline_string> create_inline_string_vector(strings_column_view const& strings,
+                                                              cudaStream_t stream = 0);
+
+/**
+ * @brief Creates a strings column from an inline string vector.
+ *
+ * @param strings Inline strings vector
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column
+ */
+std::unique_ptr<column> make_strings_column(
+  rmm::device_vector<inline_string> const& strings,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 namespace cudf {
 namespace strings {
@@ -32,6 +33,8 @@ namespace strings {
  * The size of the output column is targets.size() * strings.size().
  * output[i] contains the position of target[i % targets.size()] in string[i/targets.size()]
  *
+ * Each string is searched for all the targets in one pass over its bytes.
+ *
  * @code{.pseudo}
  * Example:
  * s = ["abc","def"]
@@ -53,6 +56,36 @@ std::unique_ptr<column> find_multiple(
   strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a table of boolean columns, one for each target, telling whether the target
+ * is found in each string.
+ *
+ * Each string is searched for all the targets in one pass over its bytes, so the cost does
+ * not grow with the number of targets. An empty target is found in every string.
+ * A null string has a null result for every target.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc","def"]
+ * t = ["a","c","e"]
+ * r = contains_multiple(s,t)
+ * r is now [[true, false],   // "a" is in "abc"
+ *           [true, false],   // "c" is in "abc"
+ *           [false, true]]   // "e" is in "def"
+ * @endcode
+ *
+ * @throw cudf::logic_error targets is empty or contains nulls
+ *
+ * @param strings Strings instance for this operation.
+ * @param targets Strings to search for in each string.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table with a BOOL8 column for each target.
+ */
+std::unique_ptr<table> contains_multiple(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -51,6 +51,27 @@ std::unique_ptr<cudf::column> sort(
   cudaStream_t stream                 = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns the row indices that sort the strings by their characters.
+ *
+ * The strings are radix sorted on 8-byte prefixes packed into integers. Only the rows
+ * with an equal prefix are sorted again, on their next 8 bytes, so most of the rows are never
+ * compared byte by byte. The sort is stable.
+ *
+ * @param strings Strings instance for this operation.
+ * @param order Sort strings in ascending or descending order.
+ * @param null_order Sort nulls to the beginning or the end of the new column.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of the indices of the strings in sorted order.
+ */
+std::unique_ptr<cudf::column> sorted_order(
+  strings_column_view const& strings,
+  cudf::order order                   = cudf::order::ASCENDING,
+  cudf::null_order null_order         = cudf::null_order::BEFORE,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace structs {
+namespace detail {
+/**
+ * @brief The leaf columns of a table whose struct columns are flattened, with the orders of the
+ * leaves and the null masks they own.
+ */
+class flattened_table {
+ public:
+  flattened_table(std::vector<column_view> const& columns,
+                  std::vector<order> const& column_order,
+                  std::vector<null_order> const& null_precedence,
+                  std::vector<rmm::device_buffer>&& null_masks)
+    : _columns(columns),
+      _column_order(column_order),
+      _null_precedence(null_precedence),
+      _null_masks(std::move(null_masks))
+  {
+  }
+
+  table_view flattened_columns() const { return table_view{_columns}; }
+
+  std::vector<order> const& orders() const { return _column_order; }
+
+  std::vector<null_order> const& null_orders() const { return _null_precedence; }
+
+ private:
+  std::vector<column_view> _columns;
+  std::vector<order> _column_order;
+  std::vector<null_order> _null_precedence;
+  std::vector<rmm::device_buffer> _null_masks;  // folded masks viewed by `_columns`
+};
+
+/**
+ * @brief Returns whether `input` has struct columns
+ */
+bool has_struct_columns(table_view const& input);
+
+/**
+ * @brief Returns whether `input` has nulls, including in the children of its struct columns
+ */
+bool has_nested_nulls(table_view const& input);
+
+/**
+ * @brief Replaces the struct columns of `input` by their leaf columns, depth first.
+ *
+ * The leaves of a nullable struct column also carry its nulls: the null mask of a leaf without
+ * nulls is replaced by the mask of its parent, and the masks of both are ANDed otherwise. Only
+ * these ANDed masks are allocated; the data of the leaves is never copied. Each leaf gets the
+ * order and null order of its top-level column, so that comparing and hashing the flattened rows
+ * compares and hashes the struct rows field by field.
+ *
+ * @code{.pseudo}
+ * input = [ {a: [1, 2], b: [x, y]}, [5, 6] ] with the struct column null at row 1
+ * flatten_nested_columns(input) = [ [1, null], [x, null], [5, 6] ]
+ * @endcode
+ *
+ * @throw cudf::logic_error if a child of a nullable struct column has another offset than its
+ * parent, which the struct column factories never produce.
+ *
+ * @param input Table whose struct columns are flattened.
+ * @param column_order The order of every column of `input`, or empty.
+ * @param null_precedence The null order of every column of `input`, or empty.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The flattened columns, their orders and the masks they view.
+ */
+flattened_table flatten_nested_columns(table_view const& input,
+                                       std::vector<order> const& column_order,
+                                       std::vector<null_order> const& null_precedence,
+                                       cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace structs
+}  // namespace cudf
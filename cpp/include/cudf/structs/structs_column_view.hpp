@@ -36,9 +36,26 @@ class structs_column_view : private column_view {
   using column_view::has_nulls;
   using column_view::null_count;
   using column_view::null_mask;
+  using column_view::nullable;
+  using column_view::num_children;
   using column_view::offset;
   using column_view::size;
 
+  /**
+   * @brief Returns the parent column.
+   */
+  column_view parent() const;
+
+  /**
+   * @brief Returns the child column `index`, sliced to the rows of this view.
+   *
+   * The children of a sliced struct column are not sliced themselves, so this view applies the
+   * offset and size of the parent to the child. The null mask of the child is unchanged.
+   *
+   * @param index Index of the child column.
+   */
+  column_view get_sliced_child(size_type index) const;
+
 };  // class structs_column_view;
 
 }  // namespace cudf
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @addtogroup table_classes
+ * @{
+ */
+
+/**
+ * @brief A table made of a sequence of tables with the same columns, whose total number of rows
+ * may exceed the range of `size_type`.
+ *
+ * Each chunk is an ordinary table, so it holds at most `size_type` rows and at most
+ * `size_type` bytes of characters per strings column. Rows are addressed by 64-bit indices into
+ * the whole table. The operations producing a single table, such as `gather` and `slice`, throw
+ * if their result does not fit in a table.
+ */
+class chunked_table {
+ public:
+  chunked_table()                     = default;
+  ~chunked_table()                    = default;
+  chunked_table(chunked_table&&)      = default;
+  chunked_table(chunked_table const&) = delete;
+  chunked_table& operator=(chunked_table const&) = delete;
+  chunked_table& operator=(chunked_table&&) = default;
+
+  /**
+   * @brief Moves a sequence of tables into a chunked table.
+   *
+   * @throws cudf::logic_error if the tables do not have the same number and types of columns
+   *
+   * @param chunks The chunks, in row order
+   */
+  chunked_table(std::vector<std::unique_ptr<table>>&& chunks);
+
+  /**
+   * @brief Concatenates tables into as few chunks as possible.
+   *
+   * Consecutive tables are concatenated into one chunk as long as the chunk has at most
+   * `max_chunk_rows` rows and the characters of each of its strings columns fit in `size_type`.
+   * Unlike `cudf::concatenate`, the total size of `tables` is not limited.
+   *
+   * @throws cudf::logic_error if the tables do not have the same number and types of columns
+   * @throws cudf::logic_error if `max_chunk_rows` is not positive
+   *
+   * @param tables The tables to concatenate, in row order
+   * @param max_chunk_rows The maximum number of rows of a chunk made of several tables
+   * @param mr Device memory resource used to allocate the device memory of the chunks
+   * @return The chunked table of the rows of all `tables`
+   */
+  static chunked_table concatenate(
+    std::vector<table_view> const& tables,
+    size_type max_chunk_rows            = std::numeric_limits<size_type>::max(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Returns the total number of rows of the chunks.
+   */
+  int64_t num_rows() const noexcept { return _offsets.back(); }
+
+  /**
+   * @brief Returns the number of columns, 0 if there are no chunks.
+   */
+  size_type num_columns() const noexcept
+  {
+    return _chunks.empty() ? 0 : _chunks.front()->num_columns();
+  }
+
+  /**
+   * @brief Returns the number of chunks.
+   */
+  size_type num_chunks() const noexcept { return static_cast<size_type>(_chunks.size()); }
+
+  /**
+   * @brief Returns a view of the chunk `i`.
+   */
+  table_view chunk(size_type i) const { return _chunks.at(i)->view(); }
+
+  /**
+   * @brief Returns the index of the first row of the chunk `i` in the whole table.
+   */
+  int64_t chunk_offset(size_type i) const { return _offsets.at(i); }
+
+  /**
+   * @brief Releases the chunks.
+   *
+   * After `release()`, `num_chunks() == 0` and `num_rows() == 0`.
+   */
+  std::vector<std::unique_ptr<table>> release();
+
+  /**
+   * @brief Copies the rows `[begin, end)` of the whole table into a single table.
+   *
+   * @throws cudf::logic_error if `begin > end`, `begin < 0` or `end > num_rows()`
+   * @throws cudf::logic_error if the rows do not fit in a single table
+   *
+   * @param begin The index of the first row
+   * @param end The index after the last row
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The rows of the range
+   */
+  std::unique_ptr<table> slice(
+    int64_t begin,
+    int64_t end,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Gathers rows of the whole table into a single table.
+   *
+   * Row `i` of the result is row `gather_map[i]` of the whole table. The rows of each chunk are
+   * gathered by one gather of the chunk.
+   *
+   * @throws cudf::logic_error if `gather_map` is not a non-nullable INT64 column
+   * @throws cudf::logic_error if an index of `gather_map` is outside `[0, num_rows())`
+   * @throws cudf::logic_error if there are no chunks
+   *
+   * @param gather_map The indices of the rows to gather
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The gathered rows
+   */
+  std::unique_ptr<table> gather(
+    column_view const& gather_map,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  std::vector<std::unique_ptr<table>> _chunks;
+  std::vector<int64_t> _offsets{0};  ///< first row of each chunk, followed by `num_rows()`
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -51,6 +51,26 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Creates a new column by applying a registered unary function against every
+ * element of an input column.
+ *
+ * Like the overload taking the UDF as a string, but the function is parsed only on its first
+ * use, and its kernels are reused from the JIT kernel cache.
+ *
+ * @see cudf::compile_udf
+ *
+ * @param input         An immutable view of the input column to transform
+ * @param unary_udf     The registered unary function to apply
+ * @param mr            Device memory resource used to allocate the returned column's device memory
+ * @return              The column of `unary_udf.output_type()` resulting from applying the unary
+ *                      function to every element of the input
+ **/
+std::unique_ptr<column> transform(
+  column_view const& input,
+  compiled_udf const& unary_udf,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
  * preserving existing null values and also returns new null_count.
@@ -94,6 +94,8 @@ class table;
 class table_view;
 class mutable_table_view;
 
+class compiled_udf;
+
 /**
  * @addtogroup utility_types
  * @{
@@ -287,9 +289,11 @@ std::size_t size_of(data_type t);
  *  @brief Identifies the hash function to be used
  */
 enum class hash_id {
-  HASH_IDENTITY = 0,  ///< Identity hash function that simply returns the key to be hashed
-  HASH_MURMUR3,       ///< Murmur3 hash function
-  HASH_MD5            ///< MD5 hash function
+  HASH_IDENTITY = 0,   ///< Identity hash function that simply returns the key to be hashed
+  HASH_MURMUR3,        ///< Murmur3 hash function
+  HASH_MD5,            ///< MD5 hash function
+  HASH_SPARK_MURMUR3,  ///< Murmur3 hash function compatible with Spark's `hash`
+  HASH_XXHASH64        ///< xxHash64 hash function compatible with Spark's `xxhash64`
 };
 
 /** @} */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/types.hpp>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @file udf.hpp
+ * @brief User-defined functions registered once and reused by the JIT-compiled APIs.
+ */
+
+namespace cudf {
+/**
+ * @addtogroup transformation_transform
+ * @{
+ */
+
+/**
+ * @brief A PTX or CUDA user-defined function, registered once and reused across calls.
+ *
+ * The APIs taking a UDF as a string parse it and rebuild its program source on every call. A
+ * `compiled_udf` parses its function once for each kind of kernel it is used in, and names its
+ * programs after its source, so the kernels JIT compiled for each combination of column types are
+ * looked up in the JIT kernel cache instead of being parsed again.
+ *
+ * A `compiled_udf` can be used by `rolling_window` through `make_udf_aggregation`, by `transform`
+ * and by `binary_operation`, from several threads.
+ */
+class compiled_udf {
+ public:
+  /**
+   * @brief Constructs a UDF from its source.
+   *
+   * @param source The PTX or CUDA source of the function
+   * @param type Whether `source` is PTX or CUDA
+   * @param output_type The data type the function returns
+   */
+  compiled_udf(std::string source, udf_type type, data_type output_type);
+
+  compiled_udf(compiled_udf const&) = delete;
+  compiled_udf& operator=(compiled_udf const&) = delete;
+
+  /**
+   * @brief Returns the source of the function.
+   */
+  std::string const& source() const { return _source; }
+
+  /**
+   * @brief Returns whether the source is PTX or CUDA.
+   */
+  udf_type type() const { return _type; }
+
+  /**
+   * @brief Returns the data type the function returns.
+   */
+  data_type output_type() const { return _output_type; }
+
+  /**
+   * @brief Returns the name the programs of the function are cached under.
+   */
+  std::string const& name() const { return _name; }
+
+  /**
+   * @brief Returns the program of the function for one kind of kernel, building it on first use.
+   *
+   * @param kernel Name of the kind of kernel, e.g. "transform"
+   * @param build Returns the CUDA source of the program
+   * @return The cache name and the CUDA source of the program
+   */
+  std::pair<std::string, std::string> const& program(
+    std::string const& kernel, std::function<std::string()> const& build) const;
+
+ private:
+  std::string const _source;
+  udf_type const _type;
+  data_type const _output_type;
+  std::string const _name;
+
+  mutable std::mutex _mutex;
+  mutable std::unordered_map<std::string, std::pair<std::string, std::string>> _programs;
+};
+
+/**
+ * @brief Registers a PTX or CUDA user-defined function for reuse across calls.
+ *
+ * @code{.cpp}
+ * auto udf = cudf::compile_udf(ptx, cudf::udf_type::PTX, cudf::data_type{cudf::type_id::FLOAT64});
+ * for (auto const& batch : batches) {
+ *   auto result = cudf::transform(batch, *udf);
+ * }
+ * @endcode
+ *
+ * @param source The PTX or CUDA source of the function
+ * @param type Whether `source` is PTX or CUDA
+ * @param output_type The data type the function returns
+ * @return The registered function
+ */
+std::shared_ptr<compiled_udf const> compile_udf(std::string const& source,
+                                                udf_type type,
+                                                data_type output_type);
+
+/** @} */  // end of group
+}  // namespace cudf
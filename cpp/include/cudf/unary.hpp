@@ -18,6 +18,7 @@
 
 #include <cudf/types.hpp>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -64,6 +65,51 @@ std::unique_ptr<cudf::column> unary_operation(
   cudf::unary_op op,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Performs a chain of unary ops on all values in column in a single kernel
+ *
+ * `ops` are applied in order, e.g. `{unary_op::ABS, unary_op::LOG}` computes `log(abs(x))`,
+ * without materializing the intermediate columns. Every op but NOT keeps the type of `input`;
+ * NOT may only be the last op, and makes the output BOOL8. At most 16 ops are fused.
+ *
+ * The null mask of `input` is copied once to the output.
+ *
+ * @throws cudf::logic_error if `ops` is empty, too long, or has a NOT before its last op
+ * @throws cudf::logic_error if an op does not support the type of `input`
+ *
+ * @param input A `column_view` as input
+ * @param ops operations to perform, in order
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns Column of same size as `input` containing result of the operations
+ */
+std::unique_ptr<cudf::column> unary_operation(
+  cudf::column_view const& input,
+  std::vector<cudf::unary_op> const& ops,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a chain of unary ops on all values in column in a single kernel, writing the
+ * results into `output`
+ *
+ * Like the overload returning a column, but only the data of `output` is written: its null mask
+ * is left untouched, and nothing is allocated. The result of a row is meaningful where `input` is
+ * valid, so it is viewed with the null mask of `input`. `output` may be `input` itself, which
+ * transforms the column in place and keeps its null mask.
+ *
+ * @throws cudf::logic_error if `ops` is empty, too long, or has a NOT before its last op
+ * @throws cudf::logic_error if an op does not support the type of `input`
+ * @throws cudf::logic_error if `output` has a different size than `input`, or is not of the type
+ * of the results
+ *
+ * @param input A `column_view` as input
+ * @param ops operations to perform, in order
+ * @param output Column of the results
+ */
+void unary_operation(cudf::column_view const& input,
+                     std::vector<cudf::unary_op> const& ops,
+                     cudf::mutable_column_view& output);
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements where for every element in `input` `true`
  * indicates the value is null and `false` indicates the value is valid.
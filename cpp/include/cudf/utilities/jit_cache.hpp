@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @file jit_cache.hpp
+ * @brief Control of the JIT kernel cache: counters, memory limit and kernel bundles.
+ */
+
+namespace cudf {
+namespace jit {
+/**
+ * @addtogroup utility_apis
+ * @{
+ */
+
+/**
+ * @brief Counters of the JIT kernel cache, over the programs and the kernels it looked up.
+ */
+struct kernel_cache_stats {
+  std::size_t memory_hits;   ///< Lookups found in memory
+  std::size_t bundle_hits;   ///< Lookups loaded from a kernel bundle
+  std::size_t file_hits;     ///< Lookups loaded from the file cache
+  std::size_t misses;        ///< Lookups which were JIT compiled
+  std::size_t evictions;     ///< Objects evicted from memory by the size limit
+  double compile_seconds;    ///< Time spent JIT compiling
+  std::size_t memory_bytes;  ///< Serialized size of the objects in memory
+};
+
+/**
+ * @brief Returns the counters of the JIT kernel cache since the process started.
+ */
+kernel_cache_stats get_kernel_cache_stats();
+
+/**
+ * @brief Limits the memory of the JIT kernel cache.
+ *
+ * The least recently used programs, and the least recently used kernels of each CUDA context, are
+ * evicted from memory while their serialized size is over `bytes`, and are reloaded from the file
+ * cache when used again. The limit can also be set by the environment variable
+ * `LIBCUDF_KERNEL_CACHE_LIMIT`, and is unbounded by default.
+ *
+ * @param bytes Size limit of the programs, and of the kernels of each context
+ */
+void set_kernel_cache_limit(std::size_t bytes);
+
+/**
+ * @brief Writes every JIT program and kernel in the memory of the kernel cache to a bundle file.
+ *
+ * Kernels can be compiled without running them with e.g. `cudf::precompile_binary_operation`,
+ * or by running a representative workload once. Loading the bundle in another process skips
+ * their JIT compilation.
+ *
+ * The bundle is tagged with the cudf version and the compute capability of the current device.
+ *
+ * @throw cudf::logic_error if the file cannot be written
+ *
+ * @param path Path of the bundle file to write
+ */
+void write_kernel_bundle(std::string const& path);
+
+/**
+ * @brief Loads a bundle file written by `write_kernel_bundle`.
+ *
+ * The bundled programs and kernels are used instead of JIT compiling them, ahead of the file
+ * cache. A bundle is also loaded when the process starts if the environment variable
+ * `LIBCUDF_KERNEL_CACHE_BUNDLE` names it.
+ *
+ * @throw cudf::logic_error if the file cannot be read or is not a kernel bundle
+ *
+ * @param path Path of the bundle file to load
+ * @return `false` if the bundle was written by another cudf version or for another compute
+ * capability and was ignored, `true` otherwise
+ */
+bool load_kernel_bundle(std::string const& path);
+
+/** @} */  // end of group
+}  // namespace jit
+}  // namespace cudf
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace cudf {
+/**
+ * @addtogroup utility_launch_tuning
+ * @{
+ */
+
+/**
+ * @brief How the tuned launch parameters of libcudf kernels are chosen
+ *
+ * The tuned parameters are:
+ * - `join_build_block_size`: threads per block of the hash join build kernel
+ * - `join_probe_block_size`: threads per block of the hash join probe kernels
+ * - `hash_partition_max_shared_partitions`: largest number of partitions that `hash_partition`
+ *   counts with shared memory histograms, rather than radix partitioning the rows
+ */
+enum class launch_tuning_mode : int32_t {
+  TABLE,    ///< Use the values of the tuning table for the architecture of the device
+  AUTOTUNE  ///< Time every candidate value on the first large launches of each device, then
+            ///< use the fastest. The tuning table values are used until the timings complete.
+};
+
+/**
+ * @brief Sets how the tuned launch parameters are chosen for all subsequent launches.
+ *
+ * The mode is `TABLE` by default, or `AUTOTUNE` if the `LIBCUDF_LAUNCH_TUNING` environment
+ * variable is `AUTOTUNE`. Autotuning records CUDA events around the tuned launches until every
+ * candidate has been timed a few times; it never synchronizes the stream. The tuned values are
+ * kept for the lifetime of the process, including when switching back and forth between modes.
+ *
+ * @param mode The mode
+ */
+void set_launch_tuning_mode(launch_tuning_mode mode);
+
+/**
+ * @brief Returns how the tuned launch parameters are chosen.
+ */
+launch_tuning_mode get_launch_tuning_mode();
+
+/**
+ * @brief Returns the values used for the tuned launch parameters on the current device.
+ *
+ * Autotuned values can be saved and restored in later processes with `set_launch_parameter`.
+ *
+ * @return The value of every tuned parameter, by name
+ */
+std::map<std::string, int> get_launch_parameters();
+
+/**
+ * @brief Sets the value of a tuned launch parameter on the current device, whatever the mode.
+ *
+ * @throw cudf::logic_error if `name` is not a tuned parameter or `value` is not one of its
+ * candidate values
+ *
+ * @param name The name of the parameter
+ * @param value The value, or -1 to choose it according to the mode again
+ */
+void set_launch_parameter(std::string const& name, int value);
+
+/** @} */  // end of group
+}  // namespace cudf
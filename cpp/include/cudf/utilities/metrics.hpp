@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace cudf {
+/**
+ * @addtogroup utility_metrics
+ * @{
+ */
+
+/**
+ * @brief Metrics of one call of a libcudf operation
+ */
+struct operation_metrics {
+  std::string operation;  ///< Name of the operation, e.g. "read_parquet" or "inner_join"
+  float elapsed_ms{0};    ///< Time between the start and the end of the operation on its stream
+  /// Quantities of the operation, e.g. "rows_in", "rows_out" or "bytes_out"
+  std::map<std::string, int64_t> counters;
+  /// Choices made by the operation, e.g. "algorithm" is "hash" or "sort" for a groupby
+  std::map<std::string, std::string> decisions;
+};
+
+/**
+ * @brief Interface of the receivers of the metrics of libcudf operations
+ *
+ * Metrics are only collected while a sink is installed with `set_metrics_sink`. The instrumented
+ * operations are the readers, the joins, the groupby aggregations and the sorts.
+ */
+class metrics_sink {
+ public:
+  virtual ~metrics_sink() = default;
+
+  /**
+   * @brief Receives the metrics of an operation that completed.
+   *
+   * Called by the thread that called the operation, once the work of the operation on its stream
+   * completed. Operations called concurrently from several threads call `record` concurrently.
+   * Exceptions thrown by `record` are ignored.
+   *
+   * @param metrics The metrics of the operation
+   */
+  virtual void record(operation_metrics const& metrics) = 0;
+};
+
+/**
+ * @brief Installs the sink receiving the metrics of all subsequent operations.
+ *
+ * Collecting metrics synchronizes the stream of each instrumented operation once it completed,
+ * and may launch extra work to compute the metrics, so it is disabled by default.
+ *
+ * @param sink The sink receiving the metrics, or `nullptr` to stop collecting metrics. The sink
+ * must outlive its use, i.e. until it is replaced and the operations that started before returned.
+ */
+void set_metrics_sink(metrics_sink* sink);
+
+/**
+ * @brief Returns the sink receiving the metrics of operations, `nullptr` if none is installed.
+ */
+metrics_sink* get_metrics_sink();
+
+/** @} */  // end of group
+}  // namespace cudf
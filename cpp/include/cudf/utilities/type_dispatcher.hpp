@@ -330,6 +330,10 @@ using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceT
  * lambda must be the same, else there will be a compiler error as you would be
  * trying to return different types from the same function.
  *
+ * When libcudf is configured with `CUDF_EXCLUDE_DISPATCH_TYPES`, the listed
+ * `type_id`s are not dispatched and the functor is never instantiated for
+ * them; dispatching one of them fails as an unsupported `type_id`.
+ *
  * @tparam id_to_type_impl Maps a `cudf::type_id` its dispatched C++ type
  * @tparam Functor The callable object's type
  * @tparam Ts Variadic parameter pack type
@@ -351,87 +355,141 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
                                                                    Ts&&... args)
 {
   switch (dtype.id()) {
+#ifndef CUDF_DISPATCH_EXCLUDE_BOOL8
     case type_id::BOOL8:
       return f.template operator()<typename IdTypeMap<type_id::BOOL8>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_INT8
     case type_id::INT8:
       return f.template operator()<typename IdTypeMap<type_id::INT8>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_INT16
     case type_id::INT16:
       return f.template operator()<typename IdTypeMap<type_id::INT16>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_INT32
     case type_id::INT32:
       return f.template operator()<typename IdTypeMap<type_id::INT32>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_INT64
     case type_id::INT64:
       return f.template operator()<typename IdTypeMap<type_id::INT64>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_UINT8
     case type_id::UINT8:
       return f.template operator()<typename IdTypeMap<type_id::UINT8>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_UINT16
     case type_id::UINT16:
       return f.template operator()<typename IdTypeMap<type_id::UINT16>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_UINT32
     case type_id::UINT32:
       return f.template operator()<typename IdTypeMap<type_id::UINT32>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_UINT64
     case type_id::UINT64:
       return f.template operator()<typename IdTypeMap<type_id::UINT64>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_FLOAT32
     case type_id::FLOAT32:
       return f.template operator()<typename IdTypeMap<type_id::FLOAT32>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_FLOAT64
     case type_id::FLOAT64:
       return f.template operator()<typename IdTypeMap<type_id::FLOAT64>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_STRING
     case type_id::STRING:
       return f.template operator()<typename IdTypeMap<type_id::STRING>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_DAYS
     case type_id::TIMESTAMP_DAYS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_DAYS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_SECONDS
     case type_id::TIMESTAMP_SECONDS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_SECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_MILLISECONDS
     case type_id::TIMESTAMP_MILLISECONDS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MILLISECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_MICROSECONDS
     case type_id::TIMESTAMP_MICROSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MICROSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_NANOSECONDS
     case type_id::TIMESTAMP_NANOSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_NANOSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_DURATION_DAYS
     case type_id::DURATION_DAYS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_DAYS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_DURATION_SECONDS
     case type_id::DURATION_SECONDS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_SECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_DURATION_MILLISECONDS
     case type_id::DURATION_MILLISECONDS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_MILLISECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_DURATION_MICROSECONDS
     case type_id::DURATION_MICROSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_MICROSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_DURATION_NANOSECONDS
     case type_id::DURATION_NANOSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_NANOSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_DICTIONARY32
     case type_id::DICTIONARY32:
       return f.template operator()<typename IdTypeMap<type_id::DICTIONARY32>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_LIST
     case type_id::LIST:
       return f.template operator()<typename IdTypeMap<type_id::LIST>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_DECIMAL32
     case type_id::DECIMAL32:
       return f.template operator()<typename IdTypeMap<type_id::DECIMAL32>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_DECIMAL64
     case type_id::DECIMAL64:
       return f.template operator()<typename IdTypeMap<type_id::DECIMAL64>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISPATCH_EXCLUDE_STRUCT
     case type_id::STRUCT:
       return f.template operator()<typename IdTypeMap<type_id::STRUCT>::type>(
         std::forward<Ts>(args)...);
+#endif
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported type_id.");
@@ -451,6 +509,104 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
   }
 }
 
+/**
+ * @brief A compile-time list of `cudf::type_id`s for restricted dispatch.
+ *
+ * @tparam Ids The `type_id`s that may be dispatched
+ **/
+template <cudf::type_id... Ids>
+struct type_id_list {
+};
+
+namespace detail {
+template <template <cudf::type_id> typename IdTypeMap, typename R, cudf::type_id... Ids>
+struct restricted_dispatch;
+
+template <template <cudf::type_id> typename IdTypeMap, typename R>
+struct restricted_dispatch<IdTypeMap, R> {
+#pragma nv_exec_check_disable
+  template <typename Functor, typename... Ts>
+  static CUDA_HOST_DEVICE_CALLABLE R invoke(cudf::type_id, Functor&, Ts&&...)
+  {
+#ifndef __CUDA_ARCH__
+    CUDF_FAIL("Unsupported type_id.");
+#else
+    release_assert(false && "Unsupported type_id.");
+    return R();
+#endif
+  }
+};
+
+template <template <cudf::type_id> typename IdTypeMap,
+          typename R,
+          cudf::type_id Id,
+          cudf::type_id... Ids>
+struct restricted_dispatch<IdTypeMap, R, Id, Ids...> {
+#pragma nv_exec_check_disable
+  template <typename Functor, typename... Ts>
+  static CUDA_HOST_DEVICE_CALLABLE R invoke(cudf::type_id id, Functor& f, Ts&&... args)
+  {
+    if (id == Id) {
+      return f.template operator()<typename IdTypeMap<Id>::type>(std::forward<Ts>(args)...);
+    }
+    return restricted_dispatch<IdTypeMap, R, Ids...>::invoke(id, f, std::forward<Ts>(args)...);
+  }
+};
+
+template <typename IdList, template <cudf::type_id> typename IdTypeMap>
+struct type_list_dispatcher;
+
+template <template <cudf::type_id> typename IdTypeMap, cudf::type_id Id, cudf::type_id... Ids>
+struct type_list_dispatcher<type_id_list<Id, Ids...>, IdTypeMap> {
+#pragma nv_exec_check_disable
+  template <typename Functor, typename... Ts>
+  static CUDA_HOST_DEVICE_CALLABLE decltype(auto) invoke(cudf::type_id id, Functor& f, Ts&&... args)
+  {
+    using return_type =
+      decltype(f.template operator()<typename IdTypeMap<Id>::type>(std::forward<Ts>(args)...));
+    return restricted_dispatch<IdTypeMap, return_type, Id, Ids...>::invoke(
+      id, f, std::forward<Ts>(args)...);
+  }
+};
+}  // namespace detail
+
+/**
+ * @brief Invokes an `operator()` template with the type instantiation based on
+ * the specified `cudf::data_type`'s `id()`, considering only the `type_id`s in
+ * `IdList`.
+ *
+ * The functor is instantiated only for the types in `IdList`, rather than for
+ * every `type_id`. This keeps kernels for types a caller can never see out of
+ * the binary. Any other `type_id` fails as an unsupported `type_id`.
+ *
+ * @code
+ * using timestamp_ids = cudf::type_id_list<cudf::type_id::TIMESTAMP_SECONDS,
+ *                                          cudf::type_id::TIMESTAMP_MILLISECONDS>;
+ * cudf::type_dispatcher<timestamp_ids>(data_type, f);
+ * @endcode
+ *
+ * @tparam IdList A `cudf::type_id_list` of the `type_id`s to dispatch
+ * @tparam IdTypeMap Maps a `cudf::type_id` its dispatched C++ type
+ * @param dtype The `cudf::data_type` whose `id()` determines which template
+ * instantiation is invoked
+ * @param f The callable whose `operator()` template is invoked
+ * @param args Parameter pack of arguments forwarded to the `operator()`
+ * invocation
+ * @return Whatever is returned by the callable's `operator()`
+ **/
+#pragma nv_exec_check_disable
+template <typename IdList,
+          template <cudf::type_id> typename IdTypeMap = id_to_type_impl,
+          typename Functor,
+          typename... Ts>
+CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_type dtype,
+                                                                   Functor f,
+                                                                   Ts&&... args)
+{
+  return detail::type_list_dispatcher<IdList, IdTypeMap>::invoke(
+    dtype.id(), f, std::forward<Ts>(args)...);
+}
+
 namespace detail {
 template <typename T1>
 struct double_type_dispatcher_second_type {
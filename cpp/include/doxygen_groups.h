@@ -33,6 +33,7 @@
  *      @defgroup dictionary_classes Dictionary
  *      @defgroup timestamp_classes Timestamp
  *      @defgroup lists_classes Lists
+ *      @defgroup compressed_classes Compressed
  *   @}
  *   @defgroup table_classes Table
  *   @defgroup scalar_classes Scalar
@@ -59,6 +60,7 @@
  *   @defgroup column_merge Merging
  *   @defgroup column_join Joining
  *   @defgroup column_quantiles Quantiles
+ *   @defgroup column_statistics Statistics
  *   @defgroup column_aggregation Aggregation
  *   @{
  *     @defgroup aggregation_factories Aggregation Factories
@@ -77,6 +79,7 @@
  *   @defgroup column_reshape Reshaping
  *   @{
  *     @defgroup reshape_transpose Transpose
+ *     @defgroup reshape_row_conversion Row Conversion
  *   @}
  *   @defgroup column_reorder Reordering
  *   @{
@@ -87,12 +90,14 @@
  *   @{
  *     @defgroup interop_dlpack DLPack
  *     @defgroup interop_arrow Arrow
+ *     @defgroup interop_arrow_c_data Arrow C Data Interface
  *   @}
  * @}
  * @defgroup datetime_apis DateTime
  * @{
  *   @defgroup datetime_extract Extracting
  *   @defgroup datetime_compute Compute Day
+ *   @defgroup datetime_timezone Timezones
  * @}
  * @defgroup strings_apis Strings
  * @{
@@ -112,6 +117,7 @@
  *   @defgroup dictionary_encode Encoding
  *   @defgroup dictionary_search Searching
  *   @defgroup dictionary_update Updating Keys
+ *   @defgroup dictionary_transform Transforming Keys
  * @}
  * @defgroup io_apis IO
  * @{
@@ -122,6 +128,7 @@
  * @defgroup lists_apis Lists
  * @{
  *   @defgroup lists_extract Extracting
+ *   @defgroup lists_contains Searching
  * @}
  * @defgroup nvtext_apis NVText
  * @{
@@ -131,6 +138,7 @@
  *   @defgroup nvtext_edit_distance Edit Distance
  *   @defgroup nvtext_tokenize Tokenizing
  *   @defgroup nvtext_replace Replacing
+ *   @defgroup nvtext_minhash MinHashing
  * @}
  * @defgroup utility_apis Utilities
  * @{
@@ -138,5 +146,8 @@
  *   @defgroup utility_dispatcher Type Dispatcher
  *   @defgroup utility_bitmask Bitmask
  *   @defgroup utility_error Exception
+ *   @defgroup utility_metrics Metrics
+ *   @defgroup utility_launch_tuning Kernel Launch Tuning
+ *   @defgroup utility_async Asynchronous Execution
  * @}
  */
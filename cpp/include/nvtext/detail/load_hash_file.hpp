@@ -41,5 +41,23 @@ hashed_vocabulary load_vocabulary_file(std::string const& filename_hashed_vocabu
                                        cudaStream_t stream,
                                        rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc nvtext::build_hashed_vocabulary
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+hashed_vocabulary build_hashed_vocabulary(std::string const& filename_vocabulary,
+                                          cudaStream_t stream,
+                                          rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc nvtext::get_cached_vocabulary
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::shared_ptr<hashed_vocabulary const> get_cached_vocabulary(std::string const& filename,
+                                                               bool is_hashed_file,
+                                                               cudaStream_t stream);
+
 }  // namespace detail
 }  // namespace nvtext
@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 //! NVText APIs
 namespace nvtext {
@@ -96,5 +97,81 @@ std::unique_ptr<cudf::column> edit_distance_matrix(
   cudf::strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Maximum `max_distance` supported by @ref edit_distance_pairs and
+ *        @ref edit_distance_nearest.
+ */
+constexpr cudf::size_type max_banded_edit_distance = 31;
+
+/**
+ * @brief Returns all pairs of strings in the input column whose edit distance
+ *        is less than or equal to `max_distance`.
+ *
+ * This computes the same Levenshtein distance as @ref edit_distance_matrix but only
+ * evaluates the `2 * max_distance + 1` diagonals of the calculation that can produce
+ * a distance within the threshold (Ukkonen's banded algorithm). A pair is abandoned
+ * as soon as it can no longer be within the threshold and pairs whose lengths differ
+ * by more than `max_distance` are skipped entirely. The full distance matrix is
+ * never created.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "hallo", "world", "hella"]
+ * r = edit_distance_pairs(s, 1)
+ * r is now {[0, 0], [1, 3], [1, 1]}
+ * @endcode
+ *
+ * Null entries for `strings` are computed as though the null entry is an empty string.
+ *
+ * @throw cudf::logic_error if `max_distance < 0` or
+ *                          `max_distance > max_banded_edit_distance`
+ * @throw cudf::logic_error if the number of pairs exceeds the column size limit
+ *
+ * @param strings Strings column of input strings
+ * @param max_distance Largest edit distance of the returned pairs
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Table of three INT32 columns: the row index of the first string, the row index
+ *         of the second string (always greater than the first) and their edit distance.
+ *         The rows are sorted by the first and then the second index.
+ */
+std::unique_ptr<cudf::table> edit_distance_pairs(
+  cudf::strings_column_view const& strings,
+  cudf::size_type max_distance,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the nearest strings within `max_distance` for each string in the input.
+ *
+ * For each string this returns up to `count` other rows with the smallest edit distance
+ * that is less than or equal to `max_distance`. Ties are ordered by row index.
+ * The distances are computed with the banded algorithm described in
+ * @ref edit_distance_pairs.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "hallo", "world", "hella"]
+ * r = edit_distance_nearest(s, 1, 2)
+ * r is now {[[1], [0], [], [0]], [[1], [1], [], [1]]}
+ * @endcode
+ *
+ * Null entries for `strings` are computed as though the null entry is an empty string.
+ *
+ * @throw cudf::logic_error if `count < 1`
+ * @throw cudf::logic_error if `max_distance < 0` or
+ *                          `max_distance > max_banded_edit_distance`
+ *
+ * @param strings Strings column of input strings
+ * @param count Maximum number of nearest strings returned for each row
+ * @param max_distance Largest edit distance of the returned strings
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Table of two LIST columns of INT32: the row indices of the nearest strings
+ *         and their edit distances.
+ */
+std::unique_ptr<cudf::table> edit_distance_nearest(
+  cudf::strings_column_view const& strings,
+  cudf::size_type count,
+  cudf::size_type max_distance,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+//! NVText APIs
+namespace nvtext {
+/**
+ * @addtogroup nvtext_minhash
+ * @{
+ */
+
+/**
+ * @brief The units used to build the n-grams hashed by @ref minhash.
+ */
+enum class ngram_type {
+  CHARACTER,  ///< n-grams of consecutive UTF-8 characters
+  WORD        ///< n-grams of consecutive whitespace-delimited words
+};
+
+/**
+ * @brief Returns the minhash values for each string.
+ *
+ * For each seed, every n-gram of `width` characters (or words) of a string is hashed
+ * with MurmurHash3_32 using that seed and the minimum hash value is kept.
+ * The n-grams are processed in place and are never materialized.
+ *
+ * A word n-gram is the substring from the first byte of its first word to the last
+ * byte of its last word. Words are separated by whitespace (code-point <= ' ').
+ * A string with fewer than `width` characters (or words) is hashed as a single n-gram.
+ * Empty strings, and strings containing only whitespace for `ngram_type::WORD`,
+ * have no n-grams and produce the maximum uint32 value for each seed.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abcdef", "abcdeg", null]
+ * r = minhash(s, [0, 1], 4)
+ * r is [[h0, h1], [h0', h1'], null]
+ * where h0 = min(hash0("abcd"), hash0("bcde"), hash0("cdef"))
+ * @endcode
+ *
+ * Null string rows produce null rows in the output.
+ *
+ * @throw cudf::logic_error if `seeds` is not of type UINT32 or contains nulls
+ * @throw cudf::logic_error if `seeds` is empty
+ * @throw cudf::logic_error if `width < 1`
+ * @throw cudf::logic_error if `strings.size() * seeds.size()` exceeds the column size limit
+ *
+ * @param strings Strings column to compute minhash values for.
+ * @param seeds Seed values for the hash function; one minhash value is computed per seed.
+ * @param width The number of characters (or words) in each n-gram.
+ * @param type Whether the n-grams are made of characters or words.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return LIST column of UINT32 with `seeds.size()` minhash values per row
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::column_view const& seeds,
+  cudf::size_type width               = 4,
+  ngram_type type                     = ngram_type::CHARACTER,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Combines the minhash values of each row into locality-sensitive-hashing bands.
+ *
+ * The `K` minhash values of each row are split into `bands` consecutive groups of
+ * `K / bands` values and each group is hashed into a single value.
+ * Two rows that produce the same value for the same band are candidate near-duplicates.
+ *
+ * @code{.pseudo}
+ * Example:
+ * m = [[1, 2, 3, 4], [1, 2, 5, 6]]
+ * r = minhash_bands(m, 2)
+ * r is [[b(1,2), b(3,4)], [b(1,2), b(5,6)]]
+ * @endcode
+ *
+ * Null rows produce null rows in the output.
+ *
+ * @throw cudf::logic_error if the child of `minhashes` is not of type UINT32
+ * @throw cudf::logic_error if `bands < 1`
+ * @throw cudf::logic_error if any row does not have the same number of values as the
+ *        first row or that number is not a multiple of `bands`
+ *
+ * @param minhashes LIST column of UINT32 values as returned by @ref minhash.
+ * @param bands Number of bands to produce for each row.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return LIST column of UINT32 with `bands` values per row
+ */
+std::unique_ptr<cudf::column> minhash_bands(
+  cudf::lists_column_view const& minhashes,
+  cudf::size_type bands,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
@@ -21,6 +21,8 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <memory>
+#include <vector>
 
 namespace nvtext {
 
@@ -62,6 +64,55 @@ hashed_vocabulary load_vocabulary_file(
   std::string const& filename_hashed_vocabulary,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Build the hashed vocabulary directly from a vocab.txt file.
+ *
+ * This creates the same perfect-hash tables that @ref load_vocabulary_file
+ * reads from a file preprocessed by python/perfect_hash.py so the
+ * preprocessing step is not required.
+ *
+ * The file contains one word per line and the token-id of each word is its
+ * zero-based line number. The `[UNK]`, `[CLS]` and `[SEP]` words provide the
+ * unknown, first and separator token-ids.
+ *
+ * @throw cudf::logic_error if `filename_vocabulary` could not be opened.
+ * @throw cudf::logic_error if the file has more than 65536 lines.
+ * @throw cudf::logic_error if the `[UNK]`, `[CLS]` or `[SEP]` words are missing.
+ *
+ * @param filename_vocabulary A path to a vocab.txt file.
+ * @param mr Memory resource to allocate any returned objects.
+ * @return vocabulary hash-table elements
+ */
+hashed_vocabulary build_hashed_vocabulary(
+  std::string const& filename_vocabulary,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Return the vocabulary for the given file from a process-level cache.
+ *
+ * The first call for a file loads it with @ref load_vocabulary_file or
+ * @ref build_hashed_vocabulary and keeps the result. Later calls with the same
+ * path return the same object without reading the file again. The cached
+ * vocabularies are allocated with the default memory resource.
+ *
+ * Changes to a file after it is cached are not detected.
+ * Use @ref clear_vocabulary_cache to release the cached vocabularies.
+ *
+ * @param filename Path to the vocabulary file.
+ * @param is_hashed_file True if the file was preprocessed by python/perfect_hash.py.
+ *        False if it is a plain vocab.txt file.
+ * @return shared vocabulary hash-table elements
+ */
+std::shared_ptr<hashed_vocabulary const> get_cached_vocabulary(std::string const& filename,
+                                                               bool is_hashed_file = true);
+
+/**
+ * @brief Release all the vocabularies held by @ref get_cached_vocabulary.
+ *
+ * Vocabularies still referenced by the caller remain valid.
+ */
+void clear_vocabulary_cache();
+
 /**
  * @brief Result object for the subword_tokenize functions.
  */
@@ -119,7 +170,8 @@ struct tokenizer_result {
  * @param strings The input strings to tokenize.
  * @param filename_hashed_vocabulary A path to the preprocessed vocab.txt file.
  *        Note that this is the file AFTER python/perfect_hash.py has been used
- *        for preprocessing.
+ *        for preprocessing. The file is only loaded by the first call
+ *        for this path (see @ref get_cached_vocabulary).
  * @param max_sequence_length Limit of the number of token-ids per row in final tensor
  *        for each string.
  * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
@@ -176,5 +228,86 @@ tokenizer_result subword_tokenize(
   uint32_t max_rows_tensor,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Tokenizer object that can be reused across many batches of strings.
+ *
+ * The @ref subword_tokenize functions allocate the tokenizer's working memory
+ * on every call. This object instead holds the vocabulary table in device memory
+ * and allocates its working memory once, sized by `max_num_strings` and
+ * `max_num_chars`, and then reuses it for every call to `tokenize()`.
+ *
+ * Input strings columns of any size are accepted. The strings are processed
+ * in consecutive batches that fit within the working memory and the resulting
+ * token-ids are returned as a sequence of `tokenizer_result` objects of
+ * `max_rows_tensor` rows each. Only the last result may have fewer rows.
+ *
+ * @code{.pseudo}
+ * nvtext::subword_tokenizer tokenizer(nvtext::load_vocabulary_file(hash_file), 64, 48, ...);
+ * for (auto const& batch : batches) {
+ *   auto results = tokenizer.tokenize(cudf::strings_column_view{batch});
+ *   ...
+ * }
+ * @endcode
+ */
+class subword_tokenizer {
+ public:
+  /**
+   * @brief Create a tokenizer from a pre-loaded vocabulary table.
+   *
+   * The parameters have the same meaning as the ones for @ref subword_tokenize.
+   *
+   * @throw cudf::logic_error if `stride > max_sequence_length`
+   * @throw cudf::logic_error if `max_sequence_length * max_rows_tensor` is
+   *        larger than the max value for cudf::size_type
+   * @throw cudf::logic_error if `max_num_strings`, `max_num_chars` or `max_rows_tensor` is 0
+   *
+   * @param vocabulary_table The vocabulary table. This object takes ownership of its data.
+   * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+   *        for each string.
+   * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+   *        the token-ids from the previous row, unless it is the first string.
+   * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+   *        input stream to lower-case and strip accents from those characters.
+   * @param do_truncate If true, the tokenizer will discard all the token-ids after
+   *        `max_sequence_length` for each input string.
+   * @param max_num_strings Maximum number of strings tokenized in a single batch.
+   * @param max_num_chars Maximum number of bytes tokenized in a single batch.
+   *        No individual string may be larger than this.
+   * @param max_rows_tensor Number of rows in each returned `tokenizer_result`.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  subword_tokenizer(hashed_vocabulary&& vocabulary_table,
+                    uint32_t max_sequence_length,
+                    uint32_t stride,
+                    bool do_lower_case,
+                    bool do_truncate,
+                    uint32_t max_num_strings,
+                    uint32_t max_num_chars,
+                    uint32_t max_rows_tensor,
+                    cudaStream_t stream = 0);
+  ~subword_tokenizer();
+  subword_tokenizer(subword_tokenizer&&);
+  subword_tokenizer& operator=(subword_tokenizer&&);
+
+  /**
+   * @brief Tokenize the given strings.
+   *
+   * The `row-id` values in each result's metadata are the row positions within `strings`.
+   *
+   * @throw cudf::logic_error if any string is larger than `max_num_chars` bytes
+   *
+   * @param strings The input strings to tokenize.
+   * @param mr Memory resource to allocate any returned objects.
+   * @return token-ids, attention-mask, and metadata in chunks of `max_rows_tensor` rows
+   */
+  std::vector<tokenizer_result> tokenize(
+    cudf::strings_column_view const& strings,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -214,5 +214,67 @@ std::unique_ptr<cudf::column> detokenize(
   cudf::string_scalar const& separator = cudf::string_scalar(" "),
   rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
 
+/**
+ * @brief Vocabulary object to be used with @ref tokenize_with_vocabulary.
+ *
+ * The vocabulary strings are stored in sorted order along with the token-id
+ * of each string so tokens can be located with a binary search.
+ */
+struct tokenize_vocabulary {
+  std::unique_ptr<cudf::column> vocabulary;  ///< sorted vocabulary strings
+  std::unique_ptr<cudf::column> ids;         ///< INT32 token-id for each vocabulary string
+};
+
+/**
+ * @brief Create a tokenize_vocabulary object from a strings column.
+ *
+ * The token-id of each vocabulary string is its row index in `input`.
+ * If a string appears more than once, the token-id of its first occurrence is used.
+ *
+ * @throw cudf::logic_error if `input` contains nulls
+ *
+ * @param input Strings of the vocabulary
+ * @param mr Device memory resource used to allocate the returned object's device memory.
+ * @return Object to be used with @ref tokenize_with_vocabulary
+ */
+std::unique_ptr<tokenize_vocabulary> load_vocabulary(
+  cudf::strings_column_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the token-ids for the input strings by tokenizing them and
+ * looking up each token in the vocabulary.
+ *
+ * The strings are tokenized around the `delimiter` characters in the same way as
+ * @ref tokenize and each token is replaced with its token-id from `vocabulary`.
+ * The token strings are never created.
+ *
+ * @code{.pseudo}
+ * Example:
+ * v = load_vocabulary(["hello", "world", "goodbye"])
+ * s = ["hello world", null, "goodbye cruel world"]
+ * t = tokenize_with_vocabulary(s, v, " ", -1)
+ * t is now [[0, 1], null, [2, -1, 1]]
+ * @endcode
+ *
+ * Null rows in `input` produce null rows in the output.
+ *
+ * @throw cudf::logic_error if `delimiter` is invalid
+ *
+ * @param input Strings column to tokenize
+ * @param vocabulary Used to look up the token-ids
+ * @param delimiter Characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param default_id Token-id for tokens not found in the vocabulary
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return LIST column of INT32 token-ids
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(
+  cudf::strings_column_view const& input,
+  tokenize_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  cudf::size_type default_id           = -1,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
+
 /** @} */  // end of tokenize group
 }  // namespace nvtext
@@ -18,7 +18,9 @@
 #include <librdkafka/rdkafkacpp.h>
 #include <algorithm>
 #include <chrono>
+#include <cudf/column/column.hpp>
 #include <cudf/io/datasource.hpp>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -102,6 +104,35 @@ class kafka_consumer : public cudf::io::datasource {
    */
   size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
 
+  /**
+   * @brief Consumes a batch of messages directly into a strings column, one row per message
+   *
+   * Message payloads are copied into fixed-size pinned host chunks as they are polled, and the
+   * message offsets are recorded at the same time, so no delimiter is inserted or parsed. The
+   * chunks are then copied into the chars of the column with asynchronous transfers. Consumption
+   * stops at `end_offset`, at the end of the partition, or after `batch_timeout` milliseconds.
+   *
+   * @throws cudf::logic_error if the consumed messages exceed the size limit of a strings column
+   *
+   * @param[in] topic Name of the Kafka topic to consume from
+   * @param[in] partition Partition on the specified topic to consume from
+   * @param[in] start_offset Offset of the first message to consume
+   * @param[in] end_offset Offset after the last message to consume
+   * @param[in] batch_timeout Maximum (millisecond) time spent consuming
+   * @param[in] stream CUDA stream used for device memory operations
+   * @param[in] mr Device memory resource used to allocate the returned column's device memory
+   *
+   * @return Strings column with the payload of each consumed message
+   */
+  std::unique_ptr<cudf::column> consume_to_strings_column(
+    std::string const &topic,
+    int partition,
+    int64_t start_offset,
+    int64_t end_offset,
+    int batch_timeout,
+    cudaStream_t stream                 = 0,
+    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
   /**
    * @brief Commits an offset to a specified Kafka Topic/Partition instance
    *
@@ -187,6 +218,17 @@ class kafka_consumer : public cudf::io::datasource {
    **/
   int64_t now();
 
+  /**
+   * Consume messages from a TOPPAR and pass each one to `on_message`, until `end_offset`, the end
+   * of the partition, or the timeout is reached
+   **/
+  void consume_messages(std::string const &topic,
+                        int partition,
+                        int64_t start_offset,
+                        int64_t end_offset,
+                        int batch_timeout,
+                        std::function<void(RdKafka::Message const &)> const &on_message);
+
   void consume_to_buffer();
 };
 
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuda_runtime_api.h>
+#include <librdkafka/rdkafkacpp.h>
+#include <cudf/io/datasource.hpp>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+/**
+ * @brief Range of offsets to consume from one partition of a Kafka topic
+ **/
+struct partition_range {
+  int partition;         ///< Partition index, between `0` and `TOPIC_NUM_PARTITIONS - 1`
+  int64_t start_offset;  ///< Offset of the first message to consume
+  int64_t end_offset;    ///< Offset after the last message to consume
+};
+
+/**
+ * @brief libcudf datasource for a batch of messages consumed from several partitions of a Kafka
+ * topic at once
+ *
+ * Each partition is polled from its own rdkafka queue, on its own thread. Once all partitions are
+ * consumed, the message payloads are copied into a single pinned host buffer, in partition order,
+ * each followed by `delimiter`. The start of each message is recorded while consuming and is
+ * returned by `record_offsets()`, so the JSON lines and CSV readers use one row per message
+ * without scanning the data for line terminators.
+ *
+ * @ingroup io_datasources
+ **/
+class kafka_partitions_source : public cudf::io::datasource {
+ public:
+  /**
+   * @brief Consumes a batch of messages from several partitions of a topic.
+   *
+   * Consumption of each partition stops at its `end_offset`, at the end of the partition, or
+   * after `batch_timeout` milliseconds, whichever comes first. Documentation for librdkafka
+   * configurations can be found at
+   * https://github.com/edenhill/librdkafka/blob/master/CONFIGURATION.md
+   *
+   * @throws cudf::logic_error if the configurations are invalid or `group.id` is missing
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param topic name of the Kafka topic to consume from
+   * @param partitions partitions to consume from, with their ranges of offsets
+   * @param batch_timeout maximum (millisecond) read time allowed
+   * @param delimiter delimiter inserted after each message, Ex: "\n"
+   **/
+  kafka_partitions_source(std::map<std::string, std::string> const &configs,
+                          std::string const &topic,
+                          std::vector<partition_range> const &partitions,
+                          int batch_timeout,
+                          std::string const &delimiter = "\n");
+
+  /**
+   * @brief Returns a buffer with a subset of the consumed data, without copying it
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   *
+   * @return The data buffer
+   */
+  std::unique_ptr<cudf::io::datasource::buffer> host_read(size_t offset, size_t size) override;
+
+  /**
+   * @brief Reads a selected range into a preallocated buffer.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing host memory
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  /**
+   * @brief Returns buffers with subsets of the consumed data, without copying them
+   *
+   * The data is already in host memory, so the returned futures are ready.
+   *
+   * @param[in] ranges Ranges to read, in any order; they may overlap
+   *
+   * @return One future per range, in the order of `ranges`
+   */
+  std::vector<std::future<std::unique_ptr<cudf::io::datasource::buffer>>> host_read_async(
+    std::vector<read_range> const &ranges) override;
+
+  /**
+   * @brief Returns the offset of the payload of each consumed message within the data
+   *
+   * @return Offset of the first byte of each message, in ascending order
+   */
+  std::vector<size_t> record_offsets() const override { return message_offsets; }
+
+  /**
+   * @brief Returns the size of the consumed data, including the delimiters
+   *
+   * @return size_t The size of the source data in bytes
+   */
+  size_t size() const override { return data_size; }
+
+  /**
+   * @brief Returns the offset after the last consumed message of each partition
+   *
+   * The offsets can be committed, or used as the start offsets of the next batch.
+   *
+   * @return Map of partition index to the offset of the next message to consume
+   */
+  std::map<int, int64_t> next_offsets() const { return next_partition_offsets; }
+
+ private:
+  std::unique_ptr<char, cudaError_t (*)(void *)> data{nullptr, cudaFreeHost};
+  size_t data_size = 0;
+  std::vector<size_t> message_offsets;
+  std::map<int, int64_t> next_partition_offsets;
+};
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
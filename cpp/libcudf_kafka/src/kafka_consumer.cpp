@@ -17,7 +17,12 @@
 #include "cudf_kafka/kafka_consumer.hpp"
 #include <librdkafka/rdkafkacpp.h>
 #include <chrono>
+#include <cstring>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -109,9 +114,15 @@ RdKafka::ErrorCode kafka_consumer::update_consumer_topic_partition_assignment(
   return consumer.get()->assign(topic_partitions);
 }
 
-void kafka_consumer::consume_to_buffer()
+void kafka_consumer::consume_messages(
+  std::string const &topic,
+  int partition,
+  int64_t start_offset,
+  int64_t end_offset,
+  int batch_timeout,
+  std::function<void(RdKafka::Message const &)> const &on_message)
 {
-  update_consumer_topic_partition_assignment(topic_name, partition, start_offset);
+  update_consumer_topic_partition_assignment(topic, partition, start_offset);
 
   int64_t messages_read = 0;
   auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
@@ -121,8 +132,7 @@ void kafka_consumer::consume_to_buffer()
       consumer->consume((end - std::chrono::steady_clock::now()).count())};
 
     if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char *>(msg->payload()));
-      buffer.append(delimiter);
+      on_message(*msg);
       messages_read++;
     } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
       // If there are no more messages return
@@ -131,6 +141,122 @@ void kafka_consumer::consume_to_buffer()
   }
 }
 
+void kafka_consumer::consume_to_buffer()
+{
+  consume_messages(
+    topic_name, partition, start_offset, end_offset, batch_timeout, [&](auto const &msg) {
+      buffer.append(static_cast<char const *>(msg.payload()), msg.len());
+      buffer.append(delimiter);
+    });
+}
+
+namespace {
+constexpr size_t pinned_chunk_size = 16 * 1024 * 1024;
+
+/**
+ * @brief Sequence of fixed-size pinned host buffers that messages are appended to
+ *
+ * Unlike a single growing buffer, appending never reallocates or copies the previous data.
+ **/
+class pinned_chunks {
+ public:
+  pinned_chunks() = default;
+
+  pinned_chunks(pinned_chunks const &) = delete;
+  pinned_chunks &operator=(pinned_chunks const &) = delete;
+
+  ~pinned_chunks()
+  {
+    for (auto chunk : chunks) { cudaFreeHost(chunk); }
+  }
+
+  void append(char const *data, size_t length)
+  {
+    while (length != 0) {
+      auto const chunk_offset = bytes % pinned_chunk_size;
+      if (chunk_offset == 0) {
+        void *chunk = nullptr;
+        CUDA_TRY(cudaMallocHost(&chunk, pinned_chunk_size));
+        chunks.push_back(static_cast<char *>(chunk));
+      }
+      auto const copy_size = std::min(length, pinned_chunk_size - chunk_offset);
+      std::memcpy(chunks.back() + chunk_offset, data, copy_size);
+      data += copy_size;
+      length -= copy_size;
+      bytes += copy_size;
+    }
+  }
+
+  size_t size() const { return bytes; }
+
+  /**
+   * @brief Copies the contents to contiguous device memory and waits for the copies to complete
+   **/
+  void copy_to_device(char *dst, cudaStream_t stream) const
+  {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      auto const copy_size = std::min(pinned_chunk_size, bytes - i * pinned_chunk_size);
+      CUDA_TRY(cudaMemcpyAsync(
+        dst + i * pinned_chunk_size, chunks[i], copy_size, cudaMemcpyHostToDevice, stream));
+    }
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+
+ private:
+  std::vector<char *> chunks;
+  size_t bytes = 0;
+};
+}  // namespace
+
+std::unique_ptr<cudf::column> kafka_consumer::consume_to_strings_column(
+  std::string const &topic,
+  int partition,
+  int64_t start_offset,
+  int64_t end_offset,
+  int batch_timeout,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource *mr)
+{
+  pinned_chunks chars;
+  std::vector<cudf::size_type> offsets{0};
+  if (end_offset > start_offset) {
+    offsets.reserve(end_offset - start_offset + 1);
+    consume_messages(
+      topic, partition, start_offset, end_offset, batch_timeout, [&](auto const &msg) {
+        chars.append(static_cast<char const *>(msg.payload()), msg.len());
+        CUDF_EXPECTS(
+          chars.size() <= static_cast<size_t>(std::numeric_limits<cudf::size_type>::max()),
+          "Consumed messages exceed the size limit of a strings column");
+        offsets.push_back(chars.size());
+      });
+  }
+
+  auto const num_strings = static_cast<cudf::size_type>(offsets.size() - 1);
+  auto offsets_column    = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                  offsets.size(),
+                                                  cudf::mask_state::UNALLOCATED,
+                                                  stream,
+                                                  mr);
+  CUDA_TRY(cudaMemcpyAsync(offsets_column->mutable_view().data<cudf::size_type>(),
+                           offsets.data(),
+                           offsets.size() * sizeof(cudf::size_type),
+                           cudaMemcpyHostToDevice,
+                           stream));
+
+  auto chars_column = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT8}, chars.size(), cudf::mask_state::UNALLOCATED, stream, mr);
+  // Also waits for the offsets copy, as both are on the same stream
+  chars.copy_to_device(chars_column->mutable_view().data<char>(), stream);
+
+  return cudf::make_strings_column(num_strings,
+                                   std::move(offsets_column),
+                                   std::move(chars_column),
+                                   0,
+                                   rmm::device_buffer{0, stream, mr},
+                                   stream,
+                                   mr);
+}
+
 std::map<std::string, std::string> kafka_consumer::current_configs()
 {
   std::map<std::string, std::string> configs;
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cudf_kafka/kafka_partitions_source.hpp"
+#include <librdkafka/rdkafkacpp.h>
+#include <chrono>
+#include <cstring>
+#include <cudf/utilities/error.hpp>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+namespace {
+/**
+ * Messages consumed from one partition, kept alive until their payloads are copied
+ **/
+struct partition_messages {
+  std::vector<std::unique_ptr<RdKafka::Message>> messages;
+  size_t bytes = 0;
+};
+
+/**
+ * Polls the queue of one partition until `end_offset`, the end of the partition, or the deadline
+ **/
+partition_messages consume_partition(RdKafka::Queue *queue,
+                                     partition_range const &range,
+                                     std::chrono::steady_clock::time_point deadline)
+{
+  partition_messages result;
+  auto const num_messages = range.end_offset - range.start_offset;
+  while (static_cast<int64_t>(result.messages.size()) < num_messages) {
+    auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline - std::chrono::steady_clock::now());
+    if (remaining.count() <= 0) { break; }
+
+    std::unique_ptr<RdKafka::Message> msg{queue->consume(remaining.count())};
+    if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
+      result.bytes += msg->len();
+      result.messages.push_back(std::move(msg));
+    } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+      // If there are no more messages return
+      break;
+    }
+  }
+  return result;
+}
+}  // namespace
+
+kafka_partitions_source::kafka_partitions_source(std::map<std::string, std::string> const &configs,
+                                                 std::string const &topic,
+                                                 std::vector<partition_range> const &partitions,
+                                                 int batch_timeout,
+                                                 std::string const &delimiter)
+{
+  auto kafka_conf =
+    std::unique_ptr<RdKafka::Conf>(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+  for (auto const &key_value : configs) {
+    std::string error_string;
+    CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
+                   kafka_conf->set(key_value.first, key_value.second, error_string),
+                 "Invalid Kafka configuration");
+  }
+
+  // Kafka 0.9 > requires group.id in the configuration
+  std::string conf_val;
+  CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK == kafka_conf->get("group.id", conf_val),
+               "Kafka group.id must be configured");
+
+  std::vector<partition_range> active_partitions;
+  for (auto const &range : partitions) {
+    next_partition_offsets[range.partition] = range.start_offset;
+    if (range.end_offset > range.start_offset) { active_partitions.push_back(range); }
+  }
+  // Empty ranges do not poll the broker
+  if (active_partitions.empty()) { return; }
+
+  std::string errstr;
+  std::unique_ptr<RdKafka::KafkaConsumer> consumer{
+    RdKafka::KafkaConsumer::create(kafka_conf.get(), errstr)};
+  CUDF_EXPECTS(consumer != nullptr, "Failed to create Kafka consumer");
+
+  std::vector<std::unique_ptr<RdKafka::TopicPartition>> topic_partitions;
+  std::vector<RdKafka::TopicPartition *> assignment;
+  for (auto const &range : active_partitions) {
+    topic_partitions.emplace_back(
+      RdKafka::TopicPartition::create(topic, range.partition, range.start_offset));
+    assignment.push_back(topic_partitions.back().get());
+  }
+  CUDF_EXPECTS(RdKafka::ERR_NO_ERROR == consumer->assign(assignment),
+               "Failed to assign Kafka partitions");
+
+  // Each partition is forwarded to its own queue, so that the partitions are polled concurrently
+  std::vector<std::unique_ptr<RdKafka::Queue>> queues;
+  for (auto const &toppar : topic_partitions) {
+    queues.emplace_back(consumer->get_partition_queue(toppar.get()));
+    CUDF_EXPECTS(queues.back() != nullptr, "Failed to get Kafka partition queue");
+  }
+
+  auto const deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+  std::vector<std::future<partition_messages>> tasks;
+  for (size_t i = 0; i < active_partitions.size(); ++i) {
+    tasks.emplace_back(std::async(std::launch::async,
+                                  consume_partition,
+                                  queues[i].get(),
+                                  std::cref(active_partitions[i]),
+                                  deadline));
+  }
+  std::vector<partition_messages> consumed;
+  for (auto &task : tasks) { consumed.push_back(task.get()); }
+
+  // Message boundaries are known before copying, so every partition is copied to its final place
+  std::vector<size_t> partition_starts;
+  size_t num_messages = 0;
+  for (auto const &part : consumed) {
+    partition_starts.push_back(data_size);
+    data_size += part.bytes + part.messages.size() * delimiter.size();
+    num_messages += part.messages.size();
+  }
+  if (data_size != 0) {
+    void *ptr = nullptr;
+    CUDA_TRY(cudaMallocHost(&ptr, data_size));
+    data.reset(static_cast<char *>(ptr));
+  }
+
+  message_offsets.resize(num_messages);
+  std::vector<std::future<void>> copies;
+  size_t first_message = 0;
+  for (size_t i = 0; i < consumed.size(); ++i) {
+    copies.emplace_back(std::async(std::launch::async, [&, i, first_message]() {
+      auto pos = partition_starts[i];
+      for (size_t m = 0; m < consumed[i].messages.size(); ++m) {
+        auto const &msg                    = *consumed[i].messages[m];
+        message_offsets[first_message + m] = pos;
+        std::memcpy(data.get() + pos, msg.payload(), msg.len());
+        pos += msg.len();
+        std::memcpy(data.get() + pos, delimiter.data(), delimiter.size());
+        pos += delimiter.size();
+      }
+    }));
+    if (!consumed[i].messages.empty()) {
+      next_partition_offsets[active_partitions[i].partition] =
+        consumed[i].messages.back()->offset() + 1;
+    }
+    first_message += consumed[i].messages.size();
+  }
+  for (auto &copy : copies) { copy.get(); }
+
+  // Queues must be released before the consumer
+  queues.clear();
+  consumer->close();
+}
+
+std::unique_ptr<cudf::io::datasource::buffer> kafka_partitions_source::host_read(size_t offset,
+                                                                                 size_t size)
+{
+  if (offset > data_size) { return std::make_unique<non_owning_buffer>(); }
+  size = std::min(size, data_size - offset);
+  return std::make_unique<non_owning_buffer>(reinterpret_cast<uint8_t *>(data.get()) + offset,
+                                             size);
+}
+
+size_t kafka_partitions_source::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  if (offset > data_size) { return 0; }
+  auto const read_size = std::min(size, data_size - offset);
+  std::memcpy(dst, data.get() + offset, read_size);
+  return read_size;
+}
+
+std::vector<std::future<std::unique_ptr<cudf::io::datasource::buffer>>>
+kafka_partitions_source::host_read_async(std::vector<read_range> const &ranges)
+{
+  std::vector<std::future<std::unique_ptr<buffer>>> buffers;
+  for (auto const &range : ranges) {
+    std::promise<std::unique_ptr<buffer>> ready;
+    ready.set_value(host_read(range.offset, range.size));
+    buffers.push_back(ready.get_future());
+  }
+  return buffers;
+}
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
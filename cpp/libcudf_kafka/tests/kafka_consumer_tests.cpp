@@ -19,7 +19,9 @@
 #include <memory>
 #include <string>
 #include "cudf_kafka/kafka_consumer.hpp"
+#include "cudf_kafka/kafka_partitions_source.hpp"
 
+#include <cudf/column/column.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/functions.hpp>
 
@@ -54,3 +56,39 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
   EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs, "csv-topic", 0, 0, 3, 5000, "\n"),
                cudf::logic_error);
 }
+
+TEST_F(KafkaDatasourceTest, EmptyBatchToStringsColumn)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+  kafka_configs.insert({"group.id", "cudf-consumer"});
+  kafka::kafka_consumer kc(kafka_configs);
+
+  // An empty offset range does not poll the broker
+  auto const column = kc.consume_to_strings_column("csv-topic", 0, 5, 5, 100);
+  EXPECT_EQ(column->type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(column->size(), 0);
+}
+
+TEST_F(KafkaDatasourceTest, PartitionsSourceMissingGroupID)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+
+  EXPECT_THROW(kafka::kafka_partitions_source src(kafka_configs, "csv-topic", {{0, 0, 3}}, 5000),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, PartitionsSourceEmptyRanges)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+  kafka_configs.insert({"group.id", "cudf-consumer"});
+
+  // Empty offset ranges do not poll the broker
+  kafka::kafka_partitions_source src(kafka_configs, "csv-topic", {{0, 5, 5}, {1, 7, 7}}, 100);
+  EXPECT_EQ(src.size(), 0u);
+  EXPECT_TRUE(src.record_offsets().empty());
+  std::map<int, int64_t> const expected_offsets{{0, 5}, {1, 7}};
+  EXPECT_EQ(src.next_offsets(), expected_offsets);
+}
@@ -16,8 +16,10 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/udf.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <algorithm>
 #include <memory>
 
 namespace cudf {
@@ -116,6 +118,53 @@ std::unique_ptr<aggregation> make_row_number_aggregation()
 {
   return std::make_unique<aggregation>(aggregation::ROW_NUMBER);
 }
+/// Factory to create a HYPERLOGLOG aggregation
+std::unique_ptr<aggregation> make_hyperloglog_aggregation(int precision, null_policy null_handling)
+{
+  CUDF_EXPECTS(precision >= detail::HYPERLOGLOG_MIN_PRECISION and
+                 precision <= detail::HYPERLOGLOG_MAX_PRECISION,
+               "HyperLogLog precision out of range");
+  return std::make_unique<detail::hyperloglog_aggregation>(
+    aggregation::HYPERLOGLOG, precision, null_handling);
+}
+/// Factory to create a APPROX_NUNIQUE aggregation
+std::unique_ptr<aggregation> make_approx_nunique_aggregation(int precision,
+                                                             null_policy null_handling)
+{
+  CUDF_EXPECTS(precision >= detail::HYPERLOGLOG_MIN_PRECISION and
+                 precision <= detail::HYPERLOGLOG_MAX_PRECISION,
+               "HyperLogLog precision out of range");
+  return std::make_unique<detail::hyperloglog_aggregation>(
+    aggregation::APPROX_NUNIQUE, precision, null_handling);
+}
+/// Factory to create a TDIGEST aggregation
+std::unique_ptr<aggregation> make_tdigest_aggregation(int max_centroids)
+{
+  CUDF_EXPECTS(max_centroids > 0, "t-digest needs at least one centroid");
+  return std::make_unique<detail::tdigest_aggregation>(aggregation::TDIGEST, max_centroids);
+}
+/// Factory to create a APPROX_QUANTILE aggregation
+std::unique_ptr<aggregation> make_approx_quantile_aggregation(std::vector<double> const& quantiles,
+                                                              int max_centroids)
+{
+  CUDF_EXPECTS(max_centroids > 0, "t-digest needs at least one centroid");
+  CUDF_EXPECTS(std::all_of(quantiles.begin(),
+                           quantiles.end(),
+                           [](double q) { return q >= 0.0 and q <= 1.0; }),
+               "Quantiles must be in [0, 1]");
+  return std::make_unique<detail::tdigest_aggregation>(
+    aggregation::APPROX_QUANTILE, max_centroids, quantiles);
+}
+/// Factory to create a RANK aggregation
+std::unique_ptr<aggregation> make_rank_aggregation(rank_method method,
+                                                   order column_order,
+                                                   null_policy null_handling,
+                                                   null_order null_precedence,
+                                                   bool percentage)
+{
+  return std::make_unique<detail::rank_aggregation>(
+    method, column_order, null_handling, null_precedence, percentage);
+}
 /// Factory to create a UDF aggregation
 std::unique_ptr<aggregation> make_udf_aggregation(udf_type type,
                                                   std::string const& user_defined_aggregator,
@@ -128,6 +177,15 @@ std::unique_ptr<aggregation> make_udf_aggregation(udf_type type,
   return std::unique_ptr<aggregation>(a);
 }
 
+/// Factory to create an aggregation based on a registered UDF
+std::unique_ptr<aggregation> make_udf_aggregation(std::shared_ptr<compiled_udf const> udf)
+{
+  CUDF_EXPECTS(udf != nullptr, "Null UDF");
+  auto const kind = udf->type() == udf_type::PTX ? aggregation::PTX : aggregation::CUDA;
+  aggregation* a  = new detail::udf_aggregation{kind, udf->source(), udf->output_type(), udf};
+  return std::unique_ptr<aggregation>(a);
+}
+
 namespace detail {
 namespace {
 struct target_type_functor {
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Sets the register at `index` to `rank` if it is larger
+ *
+ * The registers are bytes, so the maximum is computed with a CAS loop on their
+ * 4-byte word, which is aligned since device allocations are.
+ */
+__device__ void atomic_max_register(uint8_t* registers, size_type index, uint8_t rank)
+{
+  auto const address = reinterpret_cast<uintptr_t>(registers + index);
+  auto* word         = reinterpret_cast<unsigned int*>(address & ~uintptr_t{3});
+  auto const shift   = static_cast<unsigned int>(address & 3) * 8;
+
+  unsigned int old = *word;
+  while (((old >> shift) & 0xffu) < rank) {
+    unsigned int const assumed = old;
+    unsigned int const updated =
+      (assumed & ~(0xffu << shift)) | (static_cast<unsigned int>(rank) << shift);
+    old = atomicCAS(word, assumed, updated);
+    if (old == assumed) { break; }
+  }
+}
+
+/**
+ * @brief Updates the register of the sketch of the group of every value with
+ * the rank of the value's hash
+ */
+struct sketch_value {
+  column_device_view d_values;
+  size_type const* group_indices;
+  uint8_t* registers;
+  int precision;
+  bool count_nulls;
+
+  __device__ void operator()(size_type i) const
+  {
+    if (not count_nulls and d_values.is_null(i)) { return; }
+    size_type const group = group_indices == nullptr ? 0 : group_indices[i];
+    if (group < 0) { return; }
+
+    hash_value_type const hash = type_dispatcher(
+      d_values.type(), element_hasher<MurmurHash3_32, true>{}, d_values, i);
+    size_type const bucket = hash >> (32 - precision);
+    // The rank is the position of the leftmost set bit of the bits after the bucket
+    int const rank = min(__clz(hash << precision), 32 - precision) + 1;
+    atomic_max_register(registers, (group << precision) + bucket, static_cast<uint8_t>(rank));
+  }
+};
+
+/**
+ * @brief Merges every register of the input sketches into the register of the
+ * sketch of their group
+ */
+struct merge_register {
+  uint8_t const* input;
+  size_type const* group_indices;
+  uint8_t* registers;
+  int precision;
+
+  __device__ void operator()(size_type i) const
+  {
+    size_type const group = group_indices[i >> precision];
+    if (group < 0 or input[i] == 0) { return; }
+    size_type const bucket = i & ((size_type{1} << precision) - 1);
+    atomic_max_register(registers, (group << precision) + bucket, input[i]);
+  }
+};
+
+/**
+ * @brief Sum of `2^-register` and number of zero registers of a sketch
+ */
+struct register_sums {
+  double harmonic_sum;
+  size_type num_zeros;
+};
+
+struct register_contribution {
+  uint8_t const* registers;
+
+  __device__ register_sums operator()(size_type i) const
+  {
+    return register_sums{ldexp(1.0, -static_cast<int>(registers[i])), registers[i] == 0};
+  }
+};
+
+struct add_register_sums {
+  __device__ register_sums operator()(register_sums const& lhs, register_sums const& rhs) const
+  {
+    return register_sums{lhs.harmonic_sum + rhs.harmonic_sum, lhs.num_zeros + rhs.num_zeros};
+  }
+};
+
+struct sketch_of_register {
+  int precision;
+
+  __device__ size_type operator()(size_type i) const { return i >> precision; }
+};
+
+/**
+ * @brief Estimates the count of a sketch from its register sums, with the
+ * small and large range corrections of the 32-bit hash HyperLogLog
+ */
+struct estimate_count {
+  int precision;
+
+  __device__ int64_t operator()(register_sums const& sums) const
+  {
+    double constexpr hash_range = 4294967296.0;
+    double const m              = static_cast<double>(1 << precision);
+    double const alpha          = precision == 4   ? 0.673
+                                  : precision == 5 ? 0.697
+                                  : precision == 6 ? 0.709
+                                                   : 0.7213 / (1 + 1.079 / m);
+
+    double estimate = alpha * m * m / sums.harmonic_sum;
+    if (estimate <= 2.5 * m) {
+      if (sums.num_zeros > 0) { estimate = m * log(m / sums.num_zeros); }
+    } else if (estimate > hash_range / 30) {
+      estimate = estimate < hash_range ? -hash_range * log(1 - estimate / hash_range) : hash_range;
+    }
+    return llround(estimate);
+  }
+};
+
+std::unique_ptr<column> make_sketches(size_type num_groups,
+                                      int precision,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(precision >= HYPERLOGLOG_MIN_PRECISION and precision <= HYPERLOGLOG_MAX_PRECISION,
+               "HyperLogLog precision out of range");
+  CUDF_EXPECTS((int64_t{num_groups} << precision) <= std::numeric_limits<size_type>::max(),
+               "Too many HyperLogLog sketches for a column");
+  size_type const num_registers = size_type{1} << precision;
+
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  auto offsets_view = offsets->mutable_view();
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   offsets_view.begin<size_type>(),
+                   offsets_view.end<size_type>(),
+                   0,
+                   num_registers);
+
+  auto registers = make_numeric_column(
+    data_type{type_id::UINT8}, num_groups * num_registers, mask_state::UNALLOCATED, stream, mr);
+  auto registers_view = registers->mutable_view();
+  thrust::fill(rmm::exec_policy(stream)->on(stream),
+               registers_view.begin<uint8_t>(),
+               registers_view.end<uint8_t>(),
+               uint8_t{0});
+
+  return make_lists_column(num_groups,
+                           std::move(offsets),
+                           std::move(registers),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+/// Returns the registers of `sketches`, verifying they are sketches of `precision`
+column_view sketch_registers(column_view const& sketches, int precision, cudaStream_t stream)
+{
+  CUDF_EXPECTS(sketches.type().id() == type_id::LIST,
+               "HyperLogLog sketches must be a LIST column");
+  auto const registers = lists_column_view(sketches).get_sliced_child(stream);
+  CUDF_EXPECTS(registers.type().id() == type_id::UINT8 and
+                 registers.size() == (int64_t{sketches.size()} << precision),
+               "Malformed HyperLogLog sketches");
+  return registers;
+}
+
+}  // namespace
+
+std::unique_ptr<column> hyperloglog_sketches(column_view const& values,
+                                             size_type const* group_indices,
+                                             size_type num_groups,
+                                             int precision,
+                                             null_policy null_handling,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  CUDF_EXPECTS(group_indices != nullptr or num_groups <= 1,
+               "Values without group indices are sketched in a single group");
+  auto sketches = make_sketches(num_groups, precision, mr, stream);
+  if (values.is_empty()) { return sketches; }
+
+  auto d_values = column_device_view::create(values, stream);
+  auto registers =
+    sketches->child(lists_column_view::child_column_index).mutable_view().data<uint8_t>();
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    values.size(),
+    sketch_value{
+      *d_values, group_indices, registers, precision, null_handling == null_policy::INCLUDE});
+  return sketches;
+}
+
+std::unique_ptr<column> merge_hyperloglog_sketches(column_view const& sketches,
+                                                   size_type const* group_indices,
+                                                   size_type num_groups,
+                                                   int precision,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream)
+{
+  auto const input = sketch_registers(sketches, precision, stream);
+  auto merged      = make_sketches(num_groups, precision, mr, stream);
+  if (input.is_empty()) { return merged; }
+
+  auto registers =
+    merged->child(lists_column_view::child_column_index).mutable_view().data<uint8_t>();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     input.size(),
+                     merge_register{input.data<uint8_t>(), group_indices, registers, precision});
+  return merged;
+}
+
+std::unique_ptr<column> hyperloglog_estimates(column_view const& sketches,
+                                              int precision,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  auto const registers = sketch_registers(sketches, precision, stream);
+  auto estimates       = make_numeric_column(
+    data_type{type_id::INT64}, sketches.size(), mask_state::UNALLOCATED, stream, mr);
+  if (sketches.is_empty()) { return estimates; }
+
+  rmm::device_vector<register_sums> sums(sketches.size());
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_transform_iterator(counting, sketch_of_register{precision}),
+                        thrust::make_transform_iterator(counting + registers.size(),
+                                                        sketch_of_register{precision}),
+                        thrust::make_transform_iterator(
+                          counting, register_contribution{registers.data<uint8_t>()}),
+                        thrust::make_discard_iterator(),
+                        sums.begin(),
+                        thrust::equal_to<size_type>{},
+                        add_register_sums{});
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    sums.begin(),
+                    sums.end(),
+                    estimates->mutable_view().data<int64_t>(),
+                    estimate_count{precision});
+  return estimates;
+}
+
+int64_t approx_distinct_count(column_view const& values,
+                              int precision,
+                              null_policy null_handling,
+                              cudaStream_t stream)
+{
+  auto const temp_mr  = rmm::mr::get_default_resource();
+  auto const sketch =
+    hyperloglog_sketches(values, nullptr, 1, precision, null_handling, temp_mr, stream);
+  auto const estimate = hyperloglog_estimates(sketch->view(), precision, temp_mr, stream);
+  int64_t result{0};
+  CUDA_TRY(cudaMemcpyAsync(&result,
+                           estimate->view().data<int64_t>(),
+                           sizeof(int64_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return result;
+}
+
+}  // namespace detail
+}  // namespace cudf
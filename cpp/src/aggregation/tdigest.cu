@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/tdigest.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Indicates whether a row of the values is digested: it is valid and
+ * not in a negative group
+ */
+struct is_digested_row {
+  column_device_view d_values;
+  size_type const* group_indices;
+
+  __device__ bool operator()(size_type i) const
+  {
+    return d_values.is_valid(i) and (group_indices == nullptr or group_indices[i] >= 0);
+  }
+};
+
+struct group_of_row {
+  size_type const* group_indices;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return group_indices == nullptr ? 0 : group_indices[i];
+  }
+};
+
+template <typename T>
+struct value_as_double {
+  column_device_view d_values;
+
+  __device__ double operator()(size_type i) const
+  {
+    return static_cast<double>(d_values.element<T>(i));
+  }
+};
+
+/**
+ * @brief Converts the values of the digested rows to double, the mean of their
+ * centroid of one value
+ */
+struct extract_means {
+  template <typename T>
+  std::enable_if_t<cudf::is_numeric<T>()> operator()(column_device_view const& d_values,
+                                                     rmm::device_vector<size_type> const& rows,
+                                                     rmm::device_vector<double>& means,
+                                                     cudaStream_t stream)
+  {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      rows.begin(),
+                      rows.end(),
+                      means.begin(),
+                      value_as_double<T>{d_values});
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_numeric<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("t-digest only supports numeric values");
+  }
+};
+
+/**
+ * @brief Stores the total weight of every group, the cumulative weight of its
+ * last centroid
+ */
+struct store_group_total {
+  size_type const* groups;
+  double const* cumulative;
+  double* totals;
+  size_type size;
+
+  __device__ void operator()(size_type i) const
+  {
+    if (i == size - 1 or groups[i + 1] != groups[i]) { totals[groups[i]] = cumulative[i]; }
+  }
+};
+
+/**
+ * @brief Returns the key of the cluster of a centroid, numbered across groups
+ *
+ * The cluster is the integer part of the arcsine scale function of the
+ * quantile of the centroid's center of mass, `max_centroids / pi * asin(2q - 1)`
+ * shifted to start at 0, so that clusters are narrow near the extreme quantiles.
+ */
+struct cluster_key {
+  size_type const* groups;
+  double const* weights;
+  double const* cumulative;
+  double const* totals;
+  int max_centroids;
+
+  __device__ int64_t operator()(size_type i) const
+  {
+    double constexpr pi = 3.14159265358979323846;
+    double const q = fmin(fmax((cumulative[i] - weights[i] / 2) / totals[groups[i]], 0.0), 1.0);
+    auto const k   = static_cast<int64_t>(max_centroids * (asin(2 * q - 1) / pi + 0.5));
+    auto const cluster = max(min(k, int64_t{max_centroids - 1}), int64_t{0});
+    return int64_t{groups[i]} * max_centroids + cluster;
+  }
+};
+
+struct weighted_centroid {
+  double const* means;
+  double const* weights;
+
+  __device__ thrust::tuple<double, double> operator()(size_type i) const
+  {
+    return thrust::make_tuple(means[i] * weights[i], weights[i]);
+  }
+};
+
+struct add_weighted_centroids {
+  __device__ thrust::tuple<double, double> operator()(
+    thrust::tuple<double, double> const& lhs, thrust::tuple<double, double> const& rhs) const
+  {
+    return thrust::make_tuple(thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                              thrust::get<1>(lhs) + thrust::get<1>(rhs));
+  }
+};
+
+struct first_key_of_group {
+  int max_centroids;
+
+  __device__ int64_t operator()(size_type g) const { return int64_t{g} * max_centroids; }
+};
+
+/// Offset of the first double of a centroid in the child of a digest column
+struct centroid_offset {
+  __device__ size_type operator()(size_type centroid) const { return 2 * centroid; }
+};
+
+struct store_centroid {
+  double const* weighted_sums;
+  double const* weights;
+  double* centroids;
+
+  __device__ void operator()(size_type i) const
+  {
+    centroids[2 * i]     = weighted_sums[i] / weights[i];
+    centroids[2 * i + 1] = weights[i];
+  }
+};
+
+/**
+ * @brief Clusters weighted centroids into the digests of their groups
+ *
+ * @param groups Group of every centroid, in `[0, num_groups)`
+ * @param means Mean of every centroid
+ * @param weights Weight of every centroid
+ */
+std::unique_ptr<column> build_tdigests(rmm::device_vector<size_type>& groups,
+                                       rmm::device_vector<double>& means,
+                                       rmm::device_vector<double>& weights,
+                                       size_type num_groups,
+                                       int max_centroids,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  CUDF_EXPECTS(max_centroids > 0, "t-digest needs at least one centroid");
+  auto const size     = static_cast<size_type>(groups.size());
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+
+  // Order the centroids by group, then by mean
+  thrust::sort_by_key(rmm::exec_policy(stream)->on(stream),
+                      means.begin(),
+                      means.end(),
+                      thrust::make_zip_iterator(thrust::make_tuple(groups.begin(), weights.begin())));
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream)->on(stream),
+    groups.begin(),
+    groups.end(),
+    thrust::make_zip_iterator(thrust::make_tuple(means.begin(), weights.begin())));
+
+  rmm::device_vector<double> cumulative(size);
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                groups.begin(),
+                                groups.end(),
+                                weights.begin(),
+                                cumulative.begin());
+  rmm::device_vector<double> totals(num_groups, 0.0);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    counting,
+    size,
+    store_group_total{groups.data().get(), cumulative.data().get(), totals.data().get(), size});
+
+  // Clusters are sorted since centroids are, so that each is one run of keys
+  rmm::device_vector<int64_t> keys(size);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    counting,
+                    counting + size,
+                    keys.begin(),
+                    cluster_key{groups.data().get(),
+                                weights.data().get(),
+                                cumulative.data().get(),
+                                totals.data().get(),
+                                max_centroids});
+
+  rmm::device_vector<int64_t> centroid_keys(size);
+  rmm::device_vector<double> weighted_sums(size);
+  rmm::device_vector<double> centroid_weights(size);
+  auto const ends = thrust::reduce_by_key(
+    rmm::exec_policy(stream)->on(stream),
+    keys.begin(),
+    keys.end(),
+    thrust::make_transform_iterator(counting,
+                                    weighted_centroid{means.data().get(), weights.data().get()}),
+    centroid_keys.begin(),
+    thrust::make_zip_iterator(thrust::make_tuple(weighted_sums.begin(), centroid_weights.begin())),
+    thrust::equal_to<int64_t>{},
+    add_weighted_centroids{});
+  auto const num_centroids = static_cast<size_type>(ends.first - centroid_keys.begin());
+  CUDF_EXPECTS(2 * int64_t{num_centroids} <= std::numeric_limits<size_type>::max(),
+               "Too many t-digest centroids for a column");
+
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  auto offsets_view = offsets->mutable_view();
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      centroid_keys.begin(),
+                      centroid_keys.begin() + num_centroids,
+                      thrust::make_transform_iterator(counting, first_key_of_group{max_centroids}),
+                      thrust::make_transform_iterator(counting + num_groups + 1,
+                                                      first_key_of_group{max_centroids}),
+                      offsets_view.begin<size_type>());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    offsets_view.begin<size_type>(),
+                    offsets_view.end<size_type>(),
+                    offsets_view.begin<size_type>(),
+                    centroid_offset{});
+
+  auto centroids = make_numeric_column(
+    data_type{type_id::FLOAT64}, 2 * num_centroids, mask_state::UNALLOCATED, stream, mr);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     counting,
+                     num_centroids,
+                     store_centroid{weighted_sums.data().get(),
+                                    centroid_weights.data().get(),
+                                    centroids->mutable_view().data<double>()});
+
+  return make_lists_column(num_groups,
+                           std::move(offsets),
+                           std::move(centroids),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+void verify_tdigests(column_view const& digests)
+{
+  CUDF_EXPECTS(digests.type().id() == type_id::LIST, "t-digests must be a LIST column");
+  CUDF_EXPECTS(lists_column_view(digests).child().type().id() == type_id::FLOAT64,
+               "Malformed t-digests");
+}
+
+/**
+ * @brief Returns the group of every centroid of the digests, from the group of
+ * its digest
+ */
+struct group_of_centroid {
+  size_type const* offsets;
+  size_type num_digests;
+  size_type const* group_indices;
+
+  __device__ size_type operator()(size_type c) const
+  {
+    auto const row =
+      thrust::upper_bound(thrust::seq, offsets, offsets + num_digests + 1, offsets[0] + 2 * c) -
+      offsets - 1;
+    return group_indices[row];
+  }
+};
+
+struct centroid_field {
+  double const* centroids;
+  int field;
+
+  __device__ double operator()(size_type c) const { return centroids[2 * c + field]; }
+};
+
+struct is_negative {
+  __device__ bool operator()(size_type g) const { return g < 0; }
+};
+
+/**
+ * @brief Estimates a quantile of a digest, interpolating linearly between the
+ * means of the centroids around it
+ */
+struct estimate_quantile {
+  size_type const* offsets;
+  double const* centroids;
+  double const* quantiles;
+  size_type num_quantiles;
+
+  __device__ double operator()(size_type i) const
+  {
+    auto const digest = i / num_quantiles;
+    auto const begin  = offsets[digest] / 2;
+    auto const end    = offsets[digest + 1] / 2;
+    if (begin == end) { return 0.0; }
+
+    double total{0};
+    for (auto c = begin; c < end; ++c) { total += centroids[2 * c + 1]; }
+    double const target = quantiles[i % num_quantiles] * total;
+
+    double cumulative{0};
+    double previous_center{0};
+    for (auto c = begin; c < end; ++c) {
+      double const mean   = centroids[2 * c];
+      double const center = cumulative + centroids[2 * c + 1] / 2;
+      if (target < center) {
+        if (c == begin) { return mean; }
+        double const previous_mean = centroids[2 * (c - 1)];
+        return previous_mean +
+               (target - previous_center) / (center - previous_center) * (mean - previous_mean);
+      }
+      cumulative += centroids[2 * c + 1];
+      previous_center = center;
+    }
+    return centroids[2 * (end - 1)];
+  }
+};
+
+struct is_nonempty_digest {
+  size_type const* offsets;
+  size_type num_quantiles;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const digest = i / num_quantiles;
+    return offsets[digest + 1] > offsets[digest];
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> tdigests(column_view const& values,
+                                 size_type const* group_indices,
+                                 size_type num_groups,
+                                 int max_centroids,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
+{
+  CUDF_EXPECTS(group_indices != nullptr or num_groups <= 1,
+               "Values without group indices are digested in a single group");
+
+  auto d_values       = column_device_view::create(values, stream);
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  rmm::device_vector<size_type> rows(values.size());
+  auto const rows_end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                        counting,
+                                        counting + (num_groups > 0 ? values.size() : 0),
+                                        rows.begin(),
+                                        is_digested_row{*d_values, group_indices});
+  rows.resize(rows_end - rows.begin());
+
+  rmm::device_vector<size_type> groups(rows.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    rows.begin(),
+                    rows.end(),
+                    groups.begin(),
+                    group_of_row{group_indices});
+  rmm::device_vector<double> means(rows.size());
+  type_dispatcher(values.type(), extract_means{}, *d_values, rows, means, stream);
+  rmm::device_vector<double> weights(rows.size(), 1.0);
+
+  return build_tdigests(groups, means, weights, num_groups, max_centroids, mr, stream);
+}
+
+std::unique_ptr<column> merge_tdigests(column_view const& digests,
+                                       size_type const* group_indices,
+                                       size_type num_groups,
+                                       int max_centroids,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  verify_tdigests(digests);
+  lists_column_view const lists(digests);
+  auto const centroids     = lists.get_sliced_child(stream);
+  auto const num_centroids = centroids.size() / 2;
+  auto const offsets       = lists.offsets().data<size_type>() + lists.offset();
+  auto const counting      = thrust::make_counting_iterator<size_type>(0);
+
+  rmm::device_vector<size_type> groups(num_centroids);
+  rmm::device_vector<double> means(num_centroids);
+  rmm::device_vector<double> weights(num_centroids);
+  if (num_centroids > 0) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      counting,
+                      counting + num_centroids,
+                      groups.begin(),
+                      group_of_centroid{offsets, digests.size(), group_indices});
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      counting,
+                      counting + num_centroids,
+                      means.begin(),
+                      centroid_field{centroids.data<double>(), 0});
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      counting,
+                      counting + num_centroids,
+                      weights.begin(),
+                      centroid_field{centroids.data<double>(), 1});
+
+    auto const all     = thrust::make_zip_iterator(thrust::make_tuple(
+      groups.begin(), means.begin(), weights.begin()));
+    auto const all_end = thrust::remove_if(rmm::exec_policy(stream)->on(stream),
+                                           all,
+                                           all + num_centroids,
+                                           groups.begin(),
+                                           is_negative{});
+    auto const remaining = all_end - all;
+    groups.resize(remaining);
+    means.resize(remaining);
+    weights.resize(remaining);
+  }
+
+  return build_tdigests(groups, means, weights, num_groups, max_centroids, mr, stream);
+}
+
+std::unique_ptr<column> tdigest_quantiles(column_view const& digests,
+                                          std::vector<double> const& quantiles,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  verify_tdigests(digests);
+  auto const num_quantiles = static_cast<size_type>(quantiles.size());
+  auto const size          = digests.size() * num_quantiles;
+  auto result =
+    make_numeric_column(data_type{type_id::FLOAT64}, size, mask_state::UNALLOCATED, stream, mr);
+  if (size == 0) { return result; }
+
+  lists_column_view const lists(digests);
+  auto const offsets = lists.offsets().data<size_type>() + lists.offset();
+  rmm::device_vector<double> d_quantiles(quantiles);
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    counting,
+                    counting + size,
+                    result->mutable_view().data<double>(),
+                    estimate_quantile{offsets,
+                                      lists.child().data<double>(),
+                                      d_quantiles.data().get(),
+                                      num_quantiles});
+  auto null_mask = cudf::detail::valid_if(
+    counting, counting + size, is_nonempty_digest{offsets, num_quantiles}, stream, mr);
+  result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  return result;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/linearizer.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+namespace cudf {
+namespace ast {
+namespace {
+
+bool is_unary(ast_operator op)
+{
+  return op == ast_operator::NOT or op == ast_operator::ABS or op == ast_operator::IS_NULL;
+}
+
+bool is_supported_type(data_type type) { return is_numeric(type) or is_chrono(type); }
+
+bool is_arithmetic(type_id id) { return is_numeric(data_type{id}) and id != type_id::BOOL8; }
+
+bool is_integer(type_id id) { return is_arithmetic(id) and not is_floating_point(data_type{id}); }
+
+/**
+ * @brief Returns the type both operands of an arithmetic operator are converted to.
+ */
+type_id common_type(type_id lhs, type_id rhs)
+{
+  if (lhs == rhs) { return lhs; }
+  auto const lhs_floating = is_floating_point(data_type{lhs});
+  if (lhs_floating != is_floating_point(data_type{rhs})) { return lhs_floating ? lhs : rhs; }
+  auto const lhs_size = size_of(data_type{lhs});
+  auto const rhs_size = size_of(data_type{rhs});
+  if (lhs_size != rhs_size) { return lhs_size > rhs_size ? lhs : rhs; }
+  return is_unsigned(data_type{lhs}) ? lhs : rhs;
+}
+
+}  // namespace
+
+data_type literal::accept(detail::expression_linearizer& visitor) const
+{
+  return visitor.visit(*this);
+}
+
+data_type column_reference::accept(detail::expression_linearizer& visitor) const
+{
+  return visitor.visit(*this);
+}
+
+operation::operation(ast_operator op, expression const& input) : _op(op), _operands{input}
+{
+  CUDF_EXPECTS(is_unary(op), "Invalid operator for a unary operation");
+}
+
+operation::operation(ast_operator op, expression const& lhs, expression const& rhs)
+  : _op(op), _operands{lhs, rhs}
+{
+  CUDF_EXPECTS(not is_unary(op), "Invalid operator for a binary operation");
+}
+
+data_type operation::accept(detail::expression_linearizer& visitor) const
+{
+  return visitor.visit(*this);
+}
+
+namespace detail {
+
+expression_linearizer::expression_linearizer(expression const& expr,
+                                             table_view const& left,
+                                             table_view const& right)
+  : _left(left), _right(right)
+{
+  _result_type = expr.accept(*this);
+}
+
+void expression_linearizer::append(instruction const& instr, int stack_change)
+{
+  _stack_depth += stack_change;
+  CUDF_EXPECTS(_stack_depth <= max_stack_depth, "Expression is nested too deeply");
+  _instructions.push_back(instr);
+}
+
+void expression_linearizer::cast(type_id from, type_id to, size_type depth)
+{
+  if (from == to) { return; }
+  append({instruction_kind::CAST, ast_operator{}, to, from, depth, table_reference::LEFT}, 0);
+}
+
+data_type expression_linearizer::visit(literal const& expr)
+{
+  auto const type = expr.value().type();
+  CUDF_EXPECTS(is_supported_type(type), "Unsupported literal type");
+  auto const index = static_cast<size_type>(_literals.size());
+  append({instruction_kind::LITERAL, ast_operator{}, type.id(), type.id(), index,
+          table_reference::LEFT},
+         1);
+  _literals.push_back(expr.value());
+  return type;
+}
+
+data_type expression_linearizer::visit(column_reference const& expr)
+{
+  auto const& table = expr.table() == table_reference::LEFT ? _left : _right;
+  auto const index  = expr.column_index();
+  CUDF_EXPECTS(index >= 0 and index < table.num_columns(), "Column reference out of range");
+  auto const type = table.column(index).type();
+  CUDF_EXPECTS(is_supported_type(type), "Unsupported column type");
+  append({instruction_kind::COLUMN, ast_operator{}, type.id(), type.id(), index, expr.table()},
+         1);
+  return type;
+}
+
+data_type expression_linearizer::visit(operation const& expr)
+{
+  auto const op        = expr.op();
+  auto const& operands = expr.operands();
+  auto const lhs       = operands[0].get().accept(*this).id();
+
+  if (operands.size() == 1) {
+    auto output = type_id::BOOL8;
+    if (op == ast_operator::NOT) {
+      CUDF_EXPECTS(lhs == type_id::BOOL8, "NOT requires a BOOL8 operand");
+    } else if (op == ast_operator::ABS) {
+      CUDF_EXPECTS(is_arithmetic(lhs), "ABS requires a numeric operand");
+      output = lhs;
+    }
+    append({instruction_kind::UNARY, op, output, lhs, 0, table_reference::LEFT}, 0);
+    return data_type{output};
+  }
+
+  auto const rhs = operands[1].get().accept(*this).id();
+  type_id operand_type;
+  auto output = type_id::BOOL8;
+  switch (op) {
+    case ast_operator::ADD:
+    case ast_operator::SUB:
+    case ast_operator::MUL:
+    case ast_operator::DIV:
+    case ast_operator::MOD:
+      CUDF_EXPECTS(is_arithmetic(lhs) and is_arithmetic(rhs),
+                   "Arithmetic operators require numeric operands");
+      operand_type = output = common_type(lhs, rhs);
+      break;
+    case ast_operator::TRUE_DIV:
+    case ast_operator::POW:
+      CUDF_EXPECTS(is_arithmetic(lhs) and is_arithmetic(rhs),
+                   "Arithmetic operators require numeric operands");
+      operand_type = output = type_id::FLOAT64;
+      break;
+    case ast_operator::BITWISE_AND:
+    case ast_operator::BITWISE_OR:
+    case ast_operator::BITWISE_XOR:
+      CUDF_EXPECTS((is_integer(lhs) and is_integer(rhs)) or
+                     (lhs == type_id::BOOL8 and rhs == type_id::BOOL8),
+                   "Bitwise operators require integer or BOOL8 operands");
+      operand_type = output = common_type(lhs, rhs);
+      break;
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::LOGICAL_OR:
+      CUDF_EXPECTS(lhs == type_id::BOOL8 and rhs == type_id::BOOL8,
+                   "Logical operators require BOOL8 operands");
+      operand_type = type_id::BOOL8;
+      break;
+    default:
+      if (is_arithmetic(lhs) and is_arithmetic(rhs)) {
+        operand_type = common_type(lhs, rhs);
+      } else {
+        CUDF_EXPECTS(lhs == rhs, "Comparison of non-numeric operands of different types");
+        operand_type = lhs;
+      }
+      break;
+  }
+  cast(lhs, operand_type, 1);
+  cast(rhs, operand_type, 0);
+  append({instruction_kind::BINARY, op, output, operand_type, 0, table_reference::LEFT}, -1);
+  return data_type{output};
+}
+
+}  // namespace detail
+}  // namespace ast
+}  // namespace cudf
@@ -0,0 +1,540 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/linearizer.hpp>
+#include <cudf/ast/detail/transform.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cmath>
+
+namespace cudf {
+namespace ast {
+namespace detail {
+namespace {
+
+/**
+ * @brief A value of the evaluation stack, in the representation given by `class_of` its type
+ */
+union value {
+  int64_t i;
+  uint64_t u;
+  double f;
+};
+
+struct literal_value {
+  value v;
+  bool valid;
+};
+
+/**
+ * @brief Truncates a value to the range of its type, as storing it would
+ */
+__device__ value normalize(value v, type_id type)
+{
+  switch (type) {
+    case type_id::BOOL8: v.i = v.i != 0; break;
+    case type_id::INT8: v.i = static_cast<int8_t>(v.i); break;
+    case type_id::INT16: v.i = static_cast<int16_t>(v.i); break;
+    case type_id::INT32: v.i = static_cast<int32_t>(v.i); break;
+    case type_id::UINT8: v.u = static_cast<uint8_t>(v.u); break;
+    case type_id::UINT16: v.u = static_cast<uint16_t>(v.u); break;
+    case type_id::UINT32: v.u = static_cast<uint32_t>(v.u); break;
+    case type_id::FLOAT32: v.f = static_cast<float>(v.f); break;
+    default: break;
+  }
+  return v;
+}
+
+__device__ value load(column_device_view const& col, size_type row, type_id type)
+{
+  value v;
+  switch (type) {
+    case type_id::BOOL8: v.i = col.data<bool>()[row]; break;
+    case type_id::INT8: v.i = col.data<int8_t>()[row]; break;
+    case type_id::INT16: v.i = col.data<int16_t>()[row]; break;
+    case type_id::INT32: v.i = col.data<int32_t>()[row]; break;
+    case type_id::INT64: v.i = col.data<int64_t>()[row]; break;
+    case type_id::UINT8: v.u = col.data<uint8_t>()[row]; break;
+    case type_id::UINT16: v.u = col.data<uint16_t>()[row]; break;
+    case type_id::UINT32: v.u = col.data<uint32_t>()[row]; break;
+    case type_id::UINT64: v.u = col.data<uint64_t>()[row]; break;
+    case type_id::FLOAT32: v.f = col.data<float>()[row]; break;
+    case type_id::FLOAT64: v.f = col.data<double>()[row]; break;
+    case type_id::TIMESTAMP_DAYS:
+    case type_id::DURATION_DAYS: v.i = col.data<int32_t>()[row]; break;
+    default: v.i = col.data<int64_t>()[row]; break;
+  }
+  return v;
+}
+
+__device__ void store(void* out, size_type row, type_id type, value v)
+{
+  switch (type) {
+    case type_id::BOOL8: static_cast<bool*>(out)[row] = v.i; break;
+    case type_id::INT8: static_cast<int8_t*>(out)[row] = v.i; break;
+    case type_id::INT16: static_cast<int16_t*>(out)[row] = v.i; break;
+    case type_id::INT32: static_cast<int32_t*>(out)[row] = v.i; break;
+    case type_id::INT64: static_cast<int64_t*>(out)[row] = v.i; break;
+    case type_id::UINT8: static_cast<uint8_t*>(out)[row] = v.u; break;
+    case type_id::UINT16: static_cast<uint16_t*>(out)[row] = v.u; break;
+    case type_id::UINT32: static_cast<uint32_t*>(out)[row] = v.u; break;
+    case type_id::UINT64: static_cast<uint64_t*>(out)[row] = v.u; break;
+    case type_id::FLOAT32: static_cast<float*>(out)[row] = v.f; break;
+    case type_id::FLOAT64: static_cast<double*>(out)[row] = v.f; break;
+    case type_id::TIMESTAMP_DAYS:
+    case type_id::DURATION_DAYS: static_cast<int32_t*>(out)[row] = v.i; break;
+    default: static_cast<int64_t*>(out)[row] = v.i; break;
+  }
+}
+
+__device__ value cast(value v, type_id from, type_id to)
+{
+  auto const from_class = class_of(from);
+  auto const to_class   = class_of(to);
+  if (to_class == value_class::FLOATING and from_class != value_class::FLOATING) {
+    v.f = from_class == value_class::SIGNED ? static_cast<double>(v.i) : static_cast<double>(v.u);
+  } else if (from_class == value_class::FLOATING and to_class == value_class::SIGNED) {
+    v.i = static_cast<int64_t>(v.f);
+  } else if (from_class == value_class::FLOATING and to_class == value_class::UNSIGNED) {
+    v.u = static_cast<uint64_t>(v.f);
+  }
+  // Integers keep their two's complement bits, which `normalize` truncates
+  return normalize(v, to);
+}
+
+template <typename T>
+__device__ bool compare(ast_operator op, T lhs, T rhs)
+{
+  switch (op) {
+    case ast_operator::EQUAL: return lhs == rhs;
+    case ast_operator::NOT_EQUAL: return lhs != rhs;
+    case ast_operator::LESS: return lhs < rhs;
+    case ast_operator::GREATER: return lhs > rhs;
+    case ast_operator::LESS_EQUAL: return lhs <= rhs;
+    default: return lhs >= rhs;
+  }
+}
+
+/**
+ * @brief Evaluates a unary operator other than IS_NULL on a valid operand of type `type`
+ */
+__device__ value evaluate_unary(ast_operator op, type_id type, value v)
+{
+  value result;
+  if (op == ast_operator::NOT) {
+    result.i = v.i == 0;
+  } else if (class_of(type) == value_class::FLOATING) {
+    result.f = fabs(v.f);
+  } else {
+    result.u = (class_of(type) == value_class::SIGNED and v.i < 0) ? 0 - v.u : v.u;
+  }
+  return result;
+}
+
+/**
+ * @brief Evaluates a binary operator on valid operands of type `type`
+ *
+ * @return `false` if the result is null
+ */
+__device__ bool evaluate_binary(ast_operator op, type_id type, value lhs, value rhs, value& result)
+{
+  auto const vc = class_of(type);
+  switch (op) {
+    case ast_operator::EQUAL:
+    case ast_operator::NOT_EQUAL:
+    case ast_operator::LESS:
+    case ast_operator::GREATER:
+    case ast_operator::LESS_EQUAL:
+    case ast_operator::GREATER_EQUAL:
+      result.i = vc == value_class::FLOATING   ? compare(op, lhs.f, rhs.f)
+                 : vc == value_class::UNSIGNED ? compare(op, lhs.u, rhs.u)
+                                               : compare(op, lhs.i, rhs.i);
+      return true;
+    case ast_operator::LOGICAL_AND: result.i = lhs.i != 0 and rhs.i != 0; return true;
+    case ast_operator::LOGICAL_OR: result.i = lhs.i != 0 or rhs.i != 0; return true;
+    case ast_operator::TRUE_DIV: result.f = lhs.f / rhs.f; return true;
+    case ast_operator::POW: result.f = pow(lhs.f, rhs.f); return true;
+    default: break;
+  }
+
+  if (vc == value_class::FLOATING) {
+    switch (op) {
+      case ast_operator::ADD: result.f = lhs.f + rhs.f; break;
+      case ast_operator::SUB: result.f = lhs.f - rhs.f; break;
+      case ast_operator::MUL: result.f = lhs.f * rhs.f; break;
+      case ast_operator::DIV: result.f = lhs.f / rhs.f; break;
+      default: result.f = fmod(lhs.f, rhs.f); break;
+    }
+    return true;
+  }
+
+  // Signed integers use unsigned arithmetic, which wraps around like the stored type
+  switch (op) {
+    case ast_operator::ADD: result.u = lhs.u + rhs.u; break;
+    case ast_operator::SUB: result.u = lhs.u - rhs.u; break;
+    case ast_operator::MUL: result.u = lhs.u * rhs.u; break;
+    case ast_operator::BITWISE_AND: result.u = lhs.u & rhs.u; break;
+    case ast_operator::BITWISE_OR: result.u = lhs.u | rhs.u; break;
+    case ast_operator::BITWISE_XOR: result.u = lhs.u ^ rhs.u; break;
+    case ast_operator::DIV:
+      if (rhs.u == 0) { return false; }
+      if (vc == value_class::UNSIGNED) {
+        result.u = lhs.u / rhs.u;
+      } else if (rhs.i == -1) {
+        result.u = 0 - lhs.u;
+      } else {
+        result.i = lhs.i / rhs.i;
+      }
+      break;
+    default:
+      if (rhs.u == 0) { return false; }
+      if (vc == value_class::UNSIGNED) {
+        result.u = lhs.u % rhs.u;
+      } else if (rhs.i == -1) {
+        result.i = 0;
+      } else {
+        result.i = lhs.i % rhs.i;
+      }
+      break;
+  }
+  return true;
+}
+
+/**
+ * @brief Evaluates a linearized expression on one row
+ *
+ * Row `i` reads the rows `left_indices[i]` and `right_indices[i]` of the tables, or row `i` of
+ * both when the indices are null.
+ */
+struct expression_evaluator {
+  table_device_view left;
+  table_device_view right;
+  size_type const* left_indices;
+  size_type const* right_indices;
+  instruction const* instructions;
+  size_type num_instructions;
+  literal_value const* literals;
+
+  /**
+   * @brief Returns the validity of the value of row `row`, and sets `result` to it if valid
+   */
+  __device__ bool evaluate(size_type row, value& result) const
+  {
+    value values[max_stack_depth];
+    bool valid[max_stack_depth];
+    int top = -1;
+
+    auto const left_row  = left_indices == nullptr ? row : left_indices[row];
+    auto const right_row = right_indices == nullptr ? row : right_indices[row];
+
+    for (size_type i = 0; i < num_instructions; ++i) {
+      auto const instr = instructions[i];
+      switch (instr.kind) {
+        case instruction_kind::COLUMN: {
+          auto const is_left = instr.table == table_reference::LEFT;
+          auto const& col    = is_left ? left.column(instr.index) : right.column(instr.index);
+          auto const col_row = is_left ? left_row : right_row;
+          ++top;
+          valid[top] = col_row >= 0 and col.is_valid(col_row);
+          if (valid[top]) { values[top] = load(col, col_row, instr.type); }
+          break;
+        }
+        case instruction_kind::LITERAL:
+          ++top;
+          values[top] = literals[instr.index].v;
+          valid[top]  = literals[instr.index].valid;
+          break;
+        case instruction_kind::CAST: {
+          auto const pos = top - instr.index;
+          if (valid[pos]) { values[pos] = cast(values[pos], instr.operand_type, instr.type); }
+          break;
+        }
+        case instruction_kind::UNARY:
+          if (instr.op == ast_operator::IS_NULL) {
+            values[top].i = not valid[top];
+            valid[top]    = true;
+          } else if (valid[top]) {
+            auto const result = evaluate_unary(instr.op, instr.operand_type, values[top]);
+            values[top]       = normalize(result, instr.type);
+          }
+          break;
+        case instruction_kind::BINARY: {
+          --top;
+          if (valid[top] and valid[top + 1]) {
+            value result;
+            valid[top] =
+              evaluate_binary(instr.op, instr.operand_type, values[top], values[top + 1], result);
+            values[top] = normalize(result, instr.type);
+          } else {
+            valid[top] = false;
+          }
+          break;
+        }
+      }
+    }
+
+    result = values[0];
+    return valid[0];
+  }
+};
+
+/**
+ * @brief Writes the value of a row to the output column and returns its validity
+ */
+struct output_fn {
+  expression_evaluator evaluator;
+  void* out;
+  type_id out_type;
+
+  __device__ bool operator()(size_type row) const
+  {
+    value result;
+    auto const valid = evaluator.evaluate(row, result);
+    if (valid) { store(out, row, out_type, result); }
+    return valid;
+  }
+};
+
+/**
+ * @brief Returns whether a BOOL8 expression is true and valid for a row
+ */
+struct predicate_fn {
+  expression_evaluator evaluator;
+
+  __device__ bool operator()(size_type row) const
+  {
+    value result;
+    return evaluator.evaluate(row, result) and result.i != 0;
+  }
+};
+
+/**
+ * @brief Returns whether the bit of a row is set in a bitmask
+ */
+struct bitmask_filter {
+  bitmask_type const* mask;
+
+  __device__ bool operator()(size_type row) const { return bit_is_set(mask, row); }
+};
+
+struct literal_value_fn {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  value operator()(scalar const& s, cudaStream_t stream) const
+  {
+    auto const v = static_cast<scalar_type_t<T> const&>(s).value(stream);
+    value result;
+    if (std::is_floating_point<T>::value) {
+      result.f = v;
+    } else if (std::is_unsigned<T>::value) {
+      result.u = v;
+    } else {
+      result.i = v;
+    }
+    return result;
+  }
+
+  template <typename T, std::enable_if_t<is_timestamp<T>()>* = nullptr>
+  value operator()(scalar const& s, cudaStream_t stream) const
+  {
+    value result;
+    result.i = static_cast<scalar_type_t<T> const&>(s).value(stream).time_since_epoch().count();
+    return result;
+  }
+
+  template <typename T, std::enable_if_t<is_duration<T>()>* = nullptr>
+  value operator()(scalar const& s, cudaStream_t stream) const
+  {
+    value result;
+    result.i = static_cast<scalar_type_t<T> const&>(s).value(stream).count();
+    return result;
+  }
+
+  template <typename T,
+            std::enable_if_t<not std::is_arithmetic<T>::value and not is_chrono<T>()>* = nullptr>
+  value operator()(scalar const&, cudaStream_t) const
+  {
+    CUDF_FAIL("Unsupported literal type");
+  }
+};
+
+/**
+ * @brief Device copies of the instructions and literals of a linearized expression
+ */
+struct device_program {
+  rmm::device_vector<instruction> instructions;
+  rmm::device_vector<literal_value> literals;
+
+  device_program(expression_linearizer const& linearizer, cudaStream_t stream)
+    : instructions(linearizer.instructions())
+  {
+    std::vector<literal_value> h_literals;
+    for (auto const& lit : linearizer.literals()) {
+      auto const& s = lit.get();
+      h_literals.push_back({type_dispatcher(s.type(), literal_value_fn{}, s, stream),
+                            s.is_valid(stream)});
+    }
+    literals = h_literals;
+  }
+
+  expression_evaluator evaluator(table_device_view left,
+                                 table_device_view right,
+                                 size_type const* left_indices,
+                                 size_type const* right_indices) const
+  {
+    return expression_evaluator{left,
+                                right,
+                                left_indices,
+                                right_indices,
+                                instructions.data().get(),
+                                static_cast<size_type>(instructions.size()),
+                                literals.data().get()};
+  }
+};
+
+std::unique_ptr<column> evaluate(expression_linearizer const& linearizer,
+                                 table_view const& left,
+                                 table_view const& right,
+                                 size_type const* left_indices,
+                                 size_type const* right_indices,
+                                 size_type size,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
+{
+  device_program const program(linearizer, stream);
+  auto d_left  = table_device_view::create(left, stream);
+  auto d_right = table_device_view::create(right, stream);
+
+  auto const output_type = linearizer.result_type();
+  auto output = make_fixed_width_column(output_type, size, mask_state::UNALLOCATED, stream, mr);
+  auto const evaluator = program.evaluator(*d_left, *d_right, left_indices, right_indices);
+  auto const write     = output_fn{evaluator, output->mutable_view().head(), output_type.id()};
+
+  auto mask = cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                     thrust::make_counting_iterator<size_type>(size),
+                                     write,
+                                     stream,
+                                     mr);
+  if (mask.second > 0) { output->set_null_mask(std::move(mask.first), mask.second); }
+  return output;
+}
+
+}  // namespace
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  // RIGHT column references are rejected, so the right table is never read
+  expression_linearizer const linearizer(expr, table, table_view{});
+  return evaluate(linearizer, table, table, nullptr, nullptr, table.num_rows(), mr, stream);
+}
+
+std::unique_ptr<column> compute_column(table_view const& left,
+                                       table_view const& right,
+                                       column_view const& left_indices,
+                                       column_view const& right_indices,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  CUDF_EXPECTS(left_indices.type().id() == type_id::INT32 and
+                 right_indices.type().id() == type_id::INT32,
+               "Row indices must be INT32 columns");
+  CUDF_EXPECTS(not left_indices.has_nulls() and not right_indices.has_nulls(),
+               "Row indices must not have nulls");
+  CUDF_EXPECTS(left_indices.size() == right_indices.size(),
+               "Row indices must have the same size");
+  expression_linearizer const linearizer(expr, left, right);
+  return evaluate(linearizer,
+                  left,
+                  right,
+                  left_indices.data<size_type>(),
+                  right_indices.data<size_type>(),
+                  left_indices.size(),
+                  mr,
+                  stream);
+}
+
+std::unique_ptr<table> filter(table_view const& input,
+                              expression const& predicate,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
+{
+  expression_linearizer const linearizer(predicate, input, table_view{});
+  CUDF_EXPECTS(linearizer.result_type().id() == type_id::BOOL8,
+               "Filter predicate must be a BOOL8 expression");
+  if (input.num_rows() == 0) { return empty_like(input); }
+
+  // The predicate is evaluated once into a bitmask, which `copy_if` reads for every column
+  device_program const program(linearizer, stream);
+  auto d_input         = table_device_view::create(input, stream);
+  auto const evaluator = program.evaluator(*d_input, *d_input, nullptr, nullptr);
+
+  auto passed = cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                       thrust::make_counting_iterator<size_type>(input.num_rows()),
+                                       predicate_fn{evaluator},
+                                       stream);
+  if (passed.second == 0) { return std::make_unique<table>(input, stream, mr); }
+  auto const mask = static_cast<bitmask_type const*>(passed.first.data());
+  return cudf::detail::copy_if(input, bitmask_filter{mask}, mr, stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(table, expr, mr);
+}
+
+std::unique_ptr<column> compute_column(table_view const& left,
+                                       table_view const& right,
+                                       column_view const& left_indices,
+                                       column_view const& right_indices,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(left, right, left_indices, right_indices, expr, mr);
+}
+
+std::unique_ptr<table> filter(table_view const& input,
+                              expression const& predicate,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::filter(input, predicate, mr);
+}
+
+}  // namespace ast
+}  // namespace cudf
@@ -23,6 +23,7 @@
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/udf.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
@@ -214,25 +215,31 @@ void binary_operation(mutable_column_view& out,
   }
 }
 
-void binary_operation(mutable_column_view& out,
-                      column_view const& lhs,
-                      column_view const& rhs,
-                      const std::string& ptx,
-                      cudaStream_t stream)
+/**
+ * @brief Returns the hash and the source of the program of a PTX binary function
+ */
+std::pair<std::string, std::string> ptx_program(std::string const& ptx,
+                                                std::string const& output_type_name)
 {
-  std::string const output_type_name = cudf::jit::get_type_name(out.type());
-
   std::string ptx_hash =
     hash + "." + std::to_string(std::hash<std::string>{}(ptx + output_type_name));
   std::string cuda_source =
     "\n#include <cudf/types.hpp>\n" +
     cudf::jit::parse_single_function_ptx(ptx, "GENERIC_BINARY_OP", output_type_name) + code::kernel;
+  return std::make_pair(std::move(ptx_hash), std::move(cuda_source));
+}
 
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      std::pair<std::string, std::string> const& program,
+                      cudaStream_t stream)
+{
   cudf::jit::launcher(
-    ptx_hash, cuda_source, header_names, cudf::jit::compiler_flags, headers_code, stream)
-    .set_kernel_inst("kernel_v_v",       // name of the kernel
-                                         // we are launching
-                     {output_type_name,  // list of template arguments
+    program.first, program.second, header_names, cudf::jit::compiler_flags, headers_code, stream)
+    .set_kernel_inst("kernel_v_v",                           // name of the kernel we are
+                                                             // launching
+                     {cudf::jit::get_type_name(out.type()),  // list of template arguments
                       cudf::jit::get_type_name(lhs.type()),
                       cudf::jit::get_type_name(rhs.type()),
                       get_operator_name(binary_operator::GENERIC_BINARY, OperatorType::Direct)})
@@ -242,6 +249,74 @@ void binary_operation(mutable_column_view& out,
             cudf::jit::get_data_ptr(rhs));
 }
 
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      const std::string& ptx,
+                      cudaStream_t stream)
+{
+  binary_operation(out, lhs, rhs, ptx_program(ptx, cudf::jit::get_type_name(out.type())), stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      compiled_udf const& udf,
+                      cudaStream_t stream)
+{
+  auto const& program = udf.program("binop", [&udf] {
+    auto const function =
+      udf.type() == udf_type::PTX
+        ? cudf::jit::parse_single_function_ptx(
+            udf.source(), "GENERIC_BINARY_OP", cudf::jit::get_type_name(udf.output_type()))
+        : cudf::jit::parse_single_function_cuda(udf.source(), "GENERIC_BINARY_OP");
+    return "\n#include <cudf/types.hpp>\n" + function + code::kernel;
+  });
+
+  binary_operation(out, lhs, rhs, program, stream);
+}
+
+/**
+ * @brief Compiles the kernels the column-column, column-scalar and scalar-column binary
+ * operations launch for these types, without launching them
+ */
+void precompile(data_type lhs_type, data_type rhs_type, binary_operator op, data_type output_type)
+{
+  std::string const suffix = null_using_binop(op) ? "_with_validity" : "";
+  auto const out_name      = cudf::jit::get_type_name(output_type);
+  auto const lhs_name      = cudf::jit::get_type_name(lhs_type);
+  auto const rhs_name      = cudf::jit::get_type_name(rhs_type);
+
+  cudf::jit::launcher(hash, code::kernel, header_names, cudf::jit::compiler_flags, headers_code, 0)
+    .set_kernel_inst("kernel_v_v" + suffix,
+                     {out_name, lhs_name, rhs_name, get_operator_name(op, OperatorType::Direct)})
+    .set_kernel_inst("kernel_v_s" + suffix,
+                     {out_name, lhs_name, rhs_name, get_operator_name(op, OperatorType::Direct)})
+    .set_kernel_inst("kernel_v_s" + suffix,
+                     {out_name, rhs_name, lhs_name, get_operator_name(op, OperatorType::Reverse)});
+}
+
+/**
+ * @brief Compiles the kernel the binary operation with a PTX function launches for these types,
+ * without launching it
+ */
+void precompile(data_type lhs_type,
+                data_type rhs_type,
+                std::string const& ptx,
+                data_type output_type)
+{
+  std::string const output_type_name = cudf::jit::get_type_name(output_type);
+  auto const program                  = ptx_program(ptx, output_type_name);
+
+  cudf::jit::launcher(
+    program.first, program.second, header_names, cudf::jit::compiler_flags, headers_code, 0)
+    .set_kernel_inst("kernel_v_v",
+                     {output_type_name,
+                      cudf::jit::get_type_name(lhs_type),
+                      cudf::jit::get_type_name(rhs_type),
+                      get_operator_name(binary_operator::GENERIC_BINARY, OperatorType::Direct)});
+}
+
 }  // namespace jit
 }  // namespace binops
 
@@ -276,7 +351,12 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
   if (rhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  if (binops::compiled::is_supported_fixed_width_operation(
+        lhs.type(), rhs.type(), op, output_type)) {
+    binops::compiled::fixed_width_binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
   return out;
 }
 
@@ -309,7 +389,12 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  if (binops::compiled::is_supported_fixed_width_operation(
+        lhs.type(), rhs.type(), op, output_type)) {
+    binops::compiled::fixed_width_binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
   return out;
 }
 
@@ -346,7 +431,12 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.size() == 0 || rhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  if (binops::compiled::is_supported_fixed_width_operation(
+        lhs.type(), rhs.type(), op, output_type)) {
+    binops::compiled::fixed_width_binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
   return out;
 }
 
@@ -380,6 +470,70 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return out;
 }
 
+std::unique_ptr<column> binary_operation(column_view const& lhs,
+                                         column_view const& rhs,
+                                         compiled_udf const& udf,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  // Numba PTX doesn't support int8
+  auto is_type_supported = [&udf](data_type type) -> bool {
+    return is_fixed_width(type) and (udf.type() != udf_type::PTX or type.id() != type_id::INT8);
+  };
+
+  CUDF_EXPECTS(is_type_supported(lhs.type()), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_type_supported(rhs.type()), "Invalid/Unsupported rhs datatype");
+  CUDF_EXPECTS(is_type_supported(udf.output_type()), "Invalid/Unsupported output datatype");
+
+  CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
+
+  auto new_mask = bitmask_and(table_view({lhs, rhs}), mr, stream);
+  auto out      = make_fixed_width_column(
+    udf.output_type(), lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+
+  // Check for 0 sized data
+  if (lhs.size() == 0 || rhs.size() == 0) { return out; }
+
+  auto out_view = out->mutable_view();
+  binops::jit::binary_operation(out_view, lhs, rhs, udf, stream);
+  return out;
+}
+
+std::unique_ptr<column> binary_operation(indexed_column_view const& lhs,
+                                         indexed_column_view const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
+  if (not lhs.has_indices() and not rhs.has_indices()) {
+    return binary_operation(lhs.parent(), rhs.parent(), op, output_type, mr, stream);
+  }
+
+  if (binops::null_using_binop(op) or not binops::compiled::is_supported_fixed_width_operation(
+                                          lhs.type(), rhs.type(), op, output_type)) {
+    // the other operations read their operands as columns
+    auto const lhs_rows = lhs.has_indices() ? lhs.materialize() : nullptr;
+    auto const rhs_rows = rhs.has_indices() ? rhs.materialize() : nullptr;
+    return binary_operation(lhs_rows ? lhs_rows->view() : lhs.parent(),
+                            rhs_rows ? rhs_rows->view() : rhs.parent(),
+                            op,
+                            output_type,
+                            mr,
+                            stream);
+  }
+
+  auto mask = binops::compiled::indexed_bitmask_and(lhs, rhs, mr, stream);
+  auto out  = make_fixed_width_column(
+    output_type, lhs.size(), std::move(mask.first), mask.second, stream, mr);
+  if (lhs.size() == 0) { return out; }
+
+  auto out_view = out->mutable_view();
+  binops::compiled::fixed_width_binary_operation(out_view, lhs, rhs, op, stream);
+  return out;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> binary_operation(scalar const& lhs,
@@ -412,6 +566,16 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return detail::binary_operation(lhs, rhs, op, output_type, mr);
 }
 
+std::unique_ptr<column> binary_operation(indexed_column_view const& lhs,
+                                         indexed_column_view const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::binary_operation(lhs, rhs, op, output_type, mr);
+}
+
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          std::string const& ptx,
@@ -422,4 +586,46 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return detail::binary_operation(lhs, rhs, ptx, output_type, mr);
 }
 
+std::unique_ptr<column> binary_operation(column_view const& lhs,
+                                         column_view const& rhs,
+                                         compiled_udf const& udf,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::binary_operation(lhs, rhs, udf, mr);
+}
+
+void precompile_binary_operation(data_type lhs_type,
+                                 data_type rhs_type,
+                                 binary_operator op,
+                                 data_type output_type)
+{
+  CUDF_FUNC_RANGE();
+  // string operations are not JIT compiled
+  if (lhs_type.id() == type_id::STRING and rhs_type.id() == type_id::STRING) { return; }
+  CUDF_EXPECTS(is_fixed_width(output_type), "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(is_fixed_width(lhs_type), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_fixed_width(rhs_type), "Invalid/Unsupported rhs datatype");
+  // precompiled operations have no kernel to JIT compile
+  if (binops::compiled::is_supported_fixed_width_operation(lhs_type, rhs_type, op, output_type)) {
+    return;
+  }
+  binops::jit::precompile(lhs_type, rhs_type, op, output_type);
+}
+
+void precompile_binary_operation(data_type lhs_type,
+                                 data_type rhs_type,
+                                 std::string const& ptx,
+                                 data_type output_type)
+{
+  CUDF_FUNC_RANGE();
+  auto is_type_supported_ptx = [](data_type type) -> bool {
+    return is_fixed_width(type) and type.id() != type_id::INT8;  // Numba PTX doesn't support int8
+  };
+  CUDF_EXPECTS(is_type_supported_ptx(lhs_type), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_type_supported_ptx(rhs_type), "Invalid/Unsupported rhs datatype");
+  CUDF_EXPECTS(is_type_supported_ptx(output_type), "Invalid/Unsupported output datatype");
+  binops::jit::precompile(lhs_type, rhs_type, ptx, output_type);
+}
+
 }  // namespace cudf
@@ -121,6 +121,77 @@ std::unique_ptr<column> binary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns whether a binary operation between fixed-width operands has a precompiled
+ * kernel.
+ *
+ * The operands must have the same type. Arithmetic and bitwise operators return that type, and
+ * comparison and logical operators return BOOL8. Other combinations are JIT compiled.
+ *
+ * @param lhs_type    The data type of the left operand
+ * @param rhs_type    The data type of the right operand
+ * @param op          The binary operator
+ * @param output_type The desired data type of the output column
+ */
+bool is_supported_fixed_width_operation(data_type lhs_type,
+                                        data_type rhs_type,
+                                        binary_operator op,
+                                        data_type output_type);
+
+/**
+ * @brief Computes a binary operation supported by `is_supported_fixed_width_operation` into the
+ * values of `out`.
+ *
+ * The values of the null rows are undefined. The null mask of `out` is left to the caller.
+ *
+ * @param out    The output column, of the size of the operand columns
+ * @param lhs    The left operand
+ * @param rhs    The right operand
+ * @param op     The binary operator
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void fixed_width_binary_operation(mutable_column_view& out,
+                                  indexed_column_view const& lhs,
+                                  indexed_column_view const& rhs,
+                                  binary_operator op,
+                                  cudaStream_t stream);
+
+/**
+ * @copydoc fixed_width_binary_operation(mutable_column_view&, indexed_column_view const&,
+ * indexed_column_view const&, binary_operator, cudaStream_t)
+ */
+void fixed_width_binary_operation(mutable_column_view& out,
+                                  column_view const& lhs,
+                                  scalar const& rhs,
+                                  binary_operator op,
+                                  cudaStream_t stream);
+
+/**
+ * @copydoc fixed_width_binary_operation(mutable_column_view&, indexed_column_view const&,
+ * indexed_column_view const&, binary_operator, cudaStream_t)
+ */
+void fixed_width_binary_operation(mutable_column_view& out,
+                                  scalar const& lhs,
+                                  column_view const& rhs,
+                                  binary_operator op,
+                                  cudaStream_t stream);
+
+/**
+ * @brief Returns the logical AND of the validities of the rows of two columns selected by
+ * indices, as a null mask and its null count.
+ *
+ * The null mask is empty if neither column is nullable.
+ *
+ * @param lhs    The rows of the left operand
+ * @param rhs    The rows of the right operand, as many as `lhs`
+ * @param mr     Device memory resource used to allocate the returned null mask
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<rmm::device_buffer, size_type> indexed_bitmask_and(indexed_column_view const& lhs,
+                                                             indexed_column_view const& rhs,
+                                                             rmm::mr::device_memory_resource* mr,
+                                                             cudaStream_t stream);
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
@@ -0,0 +1,482 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/column/indexed_column_view.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include "binary_ops.hpp"
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+
+namespace {
+
+/**
+ * @brief Operators which return the type of their operands
+ */
+struct add_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return (is_numeric<T>() and not std::is_same<T, bool>::value) or is_duration<T>() or
+           is_fixed_point<T>();
+  }
+  template <typename T>
+  __device__ T operator()(T const& x, T const& y) const
+  {
+    return x + y;
+  }
+};
+
+struct sub_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return add_op::is_supported<T>();
+  }
+  template <typename T>
+  __device__ T operator()(T const& x, T const& y) const
+  {
+    return x - y;
+  }
+};
+
+struct mul_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    // fixed_point multiplication adds the scales and division subtracts them, per element
+    return (is_numeric<T>() and not std::is_same<T, bool>::value) or is_fixed_point<T>();
+  }
+  template <typename T>
+  __device__ T operator()(T const& x, T const& y) const
+  {
+    return x * y;
+  }
+};
+
+struct div_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return mul_op::is_supported<T>();
+  }
+  template <typename T>
+  __device__ T operator()(T const& x, T const& y) const
+  {
+    return x / y;
+  }
+};
+
+struct bitwise_and_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return std::is_integral<T>::value;
+  }
+  template <typename T>
+  __device__ T operator()(T const& x, T const& y) const
+  {
+    return x & y;
+  }
+};
+
+struct bitwise_or_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return std::is_integral<T>::value;
+  }
+  template <typename T>
+  __device__ T operator()(T const& x, T const& y) const
+  {
+    return x | y;
+  }
+};
+
+struct bitwise_xor_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return std::is_integral<T>::value;
+  }
+  template <typename T>
+  __device__ T operator()(T const& x, T const& y) const
+  {
+    return x ^ y;
+  }
+};
+
+/**
+ * @brief Operators which return BOOL8
+ */
+struct equal_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_fixed_width<T>();
+  }
+  template <typename T>
+  __device__ bool operator()(T const& x, T const& y) const
+  {
+    return x == y;
+  }
+};
+
+struct not_equal_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_fixed_width<T>();
+  }
+  template <typename T>
+  __device__ bool operator()(T const& x, T const& y) const
+  {
+    return x != y;
+  }
+};
+
+struct less_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_fixed_width<T>();
+  }
+  template <typename T>
+  __device__ bool operator()(T const& x, T const& y) const
+  {
+    return x < y;
+  }
+};
+
+struct greater_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_fixed_width<T>();
+  }
+  template <typename T>
+  __device__ bool operator()(T const& x, T const& y) const
+  {
+    return x > y;
+  }
+};
+
+struct less_equal_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_fixed_width<T>();
+  }
+  template <typename T>
+  __device__ bool operator()(T const& x, T const& y) const
+  {
+    return x <= y;
+  }
+};
+
+struct greater_equal_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_fixed_width<T>();
+  }
+  template <typename T>
+  __device__ bool operator()(T const& x, T const& y) const
+  {
+    return x >= y;
+  }
+};
+
+struct logical_and_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_numeric<T>();
+  }
+  template <typename T>
+  __device__ bool operator()(T const& x, T const& y) const
+  {
+    return x && y;
+  }
+};
+
+struct logical_or_op {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_numeric<T>();
+  }
+  template <typename T>
+  __device__ bool operator()(T const& x, T const& y) const
+  {
+    return x || y;
+  }
+};
+
+/**
+ * @brief Calls `f.operator()<Op, returns_bool>()` with the operator type of `op`, or returns
+ * `f.unsupported()` for the operators without a precompiled kernel
+ */
+template <typename Functor>
+auto operator_dispatcher(binary_operator op, Functor f)
+{
+  switch (op) {
+    case binary_operator::ADD: return f.template operator()<add_op, false>();
+    case binary_operator::SUB: return f.template operator()<sub_op, false>();
+    case binary_operator::MUL: return f.template operator()<mul_op, false>();
+    case binary_operator::DIV: return f.template operator()<div_op, false>();
+    case binary_operator::BITWISE_AND: return f.template operator()<bitwise_and_op, false>();
+    case binary_operator::BITWISE_OR: return f.template operator()<bitwise_or_op, false>();
+    case binary_operator::BITWISE_XOR: return f.template operator()<bitwise_xor_op, false>();
+    case binary_operator::EQUAL: return f.template operator()<equal_op, true>();
+    case binary_operator::NOT_EQUAL: return f.template operator()<not_equal_op, true>();
+    case binary_operator::LESS: return f.template operator()<less_op, true>();
+    case binary_operator::GREATER: return f.template operator()<greater_op, true>();
+    case binary_operator::LESS_EQUAL: return f.template operator()<less_equal_op, true>();
+    case binary_operator::GREATER_EQUAL: return f.template operator()<greater_equal_op, true>();
+    case binary_operator::LOGICAL_AND: return f.template operator()<logical_and_op, true>();
+    case binary_operator::LOGICAL_OR: return f.template operator()<logical_or_op, true>();
+    default: return f.unsupported();
+  }
+}
+
+template <typename T>
+struct is_supported_op_fn {
+  data_type type;
+  data_type output_type;
+
+  template <typename Op, bool returns_bool>
+  bool operator()() const
+  {
+    auto const expected = returns_bool ? type_id::BOOL8 : type.id();
+    return Op::template is_supported<T>() and output_type.id() == expected;
+  }
+
+  bool unsupported() const { return false; }
+};
+
+struct is_supported_fn {
+  template <typename T>
+  bool operator()(binary_operator op, data_type type, data_type output_type) const
+  {
+    return operator_dispatcher(op, is_supported_op_fn<T>{type, output_type});
+  }
+};
+
+/**
+ * @brief An operand of the computation; a scalar has a stride of 0
+ *
+ * Element `i` of the operand is `data[indices[i]]` if it has indices, else `data[i * stride]`.
+ */
+struct operand {
+  void const* data;
+  size_type stride;
+  size_type const* indices{nullptr};
+};
+
+template <typename T>
+struct launch_op_fn {
+  operand lhs;
+  operand rhs;
+  void* out;
+  size_type size;
+  cudaStream_t stream;
+
+  template <typename Op,
+            bool returns_bool,
+            std::enable_if_t<Op::template is_supported<T>()>* = nullptr>
+  void operator()() const
+  {
+    using Out          = std::conditional_t<returns_bool, bool, T>;
+    auto const d_lhs   = static_cast<T const*>(lhs.data);
+    auto const d_rhs   = static_cast<T const*>(rhs.data);
+    auto const lhs_inc = lhs.stride;
+    auto const rhs_inc = rhs.stride;
+    auto const lhs_map = lhs.indices;
+    auto const rhs_map = rhs.indices;
+    if (lhs_map == nullptr and rhs_map == nullptr) {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(size),
+                        static_cast<Out*>(out),
+                        [d_lhs, d_rhs, lhs_inc, rhs_inc] __device__(size_type idx) -> Out {
+                          return Op{}(d_lhs[idx * lhs_inc], d_rhs[idx * rhs_inc]);
+                        });
+      return;
+    }
+    // the rows selected by indices are read in place
+    thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(size),
+      static_cast<Out*>(out),
+      [d_lhs, d_rhs, lhs_inc, rhs_inc, lhs_map, rhs_map] __device__(size_type idx) -> Out {
+        auto const lhs_idx = lhs_map ? lhs_map[idx] : idx * lhs_inc;
+        auto const rhs_idx = rhs_map ? rhs_map[idx] : idx * rhs_inc;
+        return Op{}(d_lhs[lhs_idx], d_rhs[rhs_idx]);
+      });
+  }
+
+  template <typename Op,
+            bool returns_bool,
+            std::enable_if_t<not Op::template is_supported<T>()>* = nullptr>
+  void operator()() const
+  {
+    unsupported();
+  }
+
+  void unsupported() const { CUDF_FAIL("Unsupported binary operation for precompiled kernels"); }
+};
+
+struct launch_fn {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  void operator()(binary_operator op,
+                  operand lhs,
+                  operand rhs,
+                  mutable_column_view& out,
+                  cudaStream_t stream) const
+  {
+    auto const d_out = static_cast<char*>(out.head()) + out.offset() * size_of(out.type());
+    operator_dispatcher(op, launch_op_fn<T>{lhs, rhs, d_out, out.size(), stream});
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_width<T>()>* = nullptr>
+  void operator()(binary_operator, operand, operand, mutable_column_view&, cudaStream_t) const
+  {
+    CUDF_FAIL("Unsupported binary operation for precompiled kernels");
+  }
+};
+
+struct scalar_data_fn {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  void const* operator()(scalar const& s) const
+  {
+    return static_cast<scalar_type_t<T> const&>(s).data();
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_width<T>()>* = nullptr>
+  void const* operator()(scalar const&) const
+  {
+    CUDF_FAIL("Unsupported scalar type for precompiled kernels");
+  }
+};
+
+void launch(mutable_column_view& out,
+            data_type type,
+            operand lhs,
+            operand rhs,
+            binary_operator op,
+            cudaStream_t stream)
+{
+  if (out.size() == 0) { return; }
+  type_dispatcher(type, launch_fn{}, op, lhs, rhs, out, stream);
+  CHECK_CUDA(stream);
+}
+
+operand make_operand(indexed_column_view const& col)
+{
+  auto const parent       = col.parent();
+  auto const element_size = size_of(parent.type());
+  auto const indices      = col.has_indices() ? col.indices().data<size_type>() : nullptr;
+  return operand{
+    static_cast<char const*>(parent.head()) + parent.offset() * element_size, 1, indices};
+}
+
+operand make_operand(scalar const& s)
+{
+  return operand{type_dispatcher(s.type(), scalar_data_fn{}, s), 0};
+}
+
+}  // namespace
+
+bool is_supported_fixed_width_operation(data_type lhs_type,
+                                        data_type rhs_type,
+                                        binary_operator op,
+                                        data_type output_type)
+{
+  if (lhs_type.id() != rhs_type.id() or not is_fixed_width(lhs_type)) { return false; }
+  return type_dispatcher(lhs_type, is_supported_fn{}, op, lhs_type, output_type);
+}
+
+void fixed_width_binary_operation(mutable_column_view& out,
+                                  indexed_column_view const& lhs,
+                                  indexed_column_view const& rhs,
+                                  binary_operator op,
+                                  cudaStream_t stream)
+{
+  launch(out, lhs.type(), make_operand(lhs), make_operand(rhs), op, stream);
+}
+
+void fixed_width_binary_operation(mutable_column_view& out,
+                                  column_view const& lhs,
+                                  scalar const& rhs,
+                                  binary_operator op,
+                                  cudaStream_t stream)
+{
+  launch(out, lhs.type(), make_operand(lhs), make_operand(rhs), op, stream);
+}
+
+void fixed_width_binary_operation(mutable_column_view& out,
+                                  scalar const& lhs,
+                                  column_view const& rhs,
+                                  binary_operator op,
+                                  cudaStream_t stream)
+{
+  launch(out, rhs.type(), make_operand(lhs), make_operand(rhs), op, stream);
+}
+
+std::pair<rmm::device_buffer, size_type> indexed_bitmask_and(indexed_column_view const& lhs,
+                                                             indexed_column_view const& rhs,
+                                                             rmm::mr::device_memory_resource* mr,
+                                                             cudaStream_t stream)
+{
+  auto const lhs_nullable = lhs.parent().nullable();
+  auto const rhs_nullable = rhs.parent().nullable();
+  if (not lhs_nullable and not rhs_nullable) {
+    return std::make_pair(rmm::device_buffer{0, stream, mr}, 0);
+  }
+  auto const d_lhs   = column_device_view::create(lhs.parent(), stream);
+  auto const d_rhs   = column_device_view::create(rhs.parent(), stream);
+  auto const lhs_map = lhs.has_indices() ? lhs.indices().data<size_type>() : nullptr;
+  auto const rhs_map = rhs.has_indices() ? rhs.indices().data<size_type>() : nullptr;
+  return cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(lhs.size()),
+    [d_lhs = *d_lhs, d_rhs = *d_rhs, lhs_map, rhs_map] __device__(size_type idx) {
+      return d_lhs.is_valid(lhs_map ? lhs_map[idx] : idx) and
+             d_rhs.is_valid(rhs_map ? rhs_map[idx] : idx);
+    },
+    stream,
+    mr);
+}
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -34,6 +34,7 @@
 #include <rmm/device_scalar.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <numeric>
 #include <type_traits>
 
@@ -311,36 +312,104 @@ __global__ void copy_offset_bitmask(bitmask_type *__restrict__ destination,
 }
 
 /**
- * @brief Computes the bitwise AND of an array of bitmasks
+ * @brief Bitwise AND of two bitmask words
+ */
+struct bitmask_and_op {
+  __device__ bitmask_type operator()(bitmask_type lhs, bitmask_type rhs) const { return lhs & rhs; }
+};
+
+/**
+ * @brief Bitwise OR of two bitmask words
+ */
+struct bitmask_or_op {
+  __device__ bitmask_type operator()(bitmask_type lhs, bitmask_type rhs) const { return lhs | rhs; }
+};
+
+/**
+ * @brief Computes a bitwise operation, AND or OR, of an array of bitmasks
  *
+ * @param op The bitwise operation of two words
  * @param destination The bitmask to write result into
  * @param source Array of source mask pointers. All masks must be of same size
  * @param begin_bit Array of offsets into corresponding @p source masks.
  *                  Must be same size as source array
- * @param num_sources Number of masks in @p source array
+ * @param num_sources Number of masks in @p source array, at least one
  * @param source_size Number of bits in each mask in @p source
  * @param number_of_mask_words The number of words of type bitmask_type to copy
  */
-__global__ void offset_bitmask_and(bitmask_type *__restrict__ destination,
-                                   bitmask_type const *const *__restrict__ source,
-                                   size_type const *__restrict__ begin_bit,
-                                   size_type num_sources,
-                                   size_type source_size,
-                                   size_type number_of_mask_words)
+template <typename BinaryOp>
+__global__ void offset_bitmask_binop(BinaryOp op,
+                                     bitmask_type *__restrict__ destination,
+                                     bitmask_type const *const *__restrict__ source,
+                                     size_type const *__restrict__ begin_bit,
+                                     size_type num_sources,
+                                     size_type source_size,
+                                     size_type number_of_mask_words)
 {
   for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
        destination_word_index < number_of_mask_words;
        destination_word_index += blockDim.x * gridDim.x) {
-    bitmask_type destination_word = ~bitmask_type{0};  // All bits 1
-    for (size_type i = 0; i < num_sources; i++) {
-      destination_word &= get_mask_offset_word(
-        source[i], destination_word_index, begin_bit[i], begin_bit[i] + source_size);
+    bitmask_type destination_word = get_mask_offset_word(
+      source[0], destination_word_index, begin_bit[0], begin_bit[0] + source_size);
+    for (size_type i = 1; i < num_sources; i++) {
+      destination_word = op(destination_word,
+                            get_mask_offset_word(source[i],
+                                                 destination_word_index,
+                                                 begin_bit[i],
+                                                 begin_bit[i] + source_size));
     }
 
     destination[destination_word_index] = destination_word;
   }
 }
 
+/**
+ * @brief Computes a bitwise operation, AND or OR, of an array of bitmasks which all begin at bit
+ * 0, loading and storing four words at a time
+ *
+ * The masks must be aligned to 16 bytes. The words past the last multiple of four are computed
+ * one at a time.
+ *
+ * @param op The bitwise operation of two words
+ * @param destination The bitmask to write result into
+ * @param source Array of source mask pointers. All masks must be of same size
+ * @param num_sources Number of masks in @p source array, at least one
+ * @param number_of_mask_words The number of words of type bitmask_type to copy
+ */
+template <typename BinaryOp>
+__global__ void aligned_bitmask_binop(BinaryOp op,
+                                      bitmask_type *__restrict__ destination,
+                                      bitmask_type const *const *__restrict__ source,
+                                      size_type num_sources,
+                                      size_type number_of_mask_words)
+{
+  static_assert(sizeof(uint4) == 4 * sizeof(bitmask_type), "uint4 must hold four mask words");
+  size_type const number_of_vectors = number_of_mask_words / 4;
+  size_type const stride            = blockDim.x * gridDim.x;
+
+  for (size_type vector_index = threadIdx.x + blockIdx.x * blockDim.x;
+       vector_index < number_of_vectors;
+       vector_index += stride) {
+    uint4 result = reinterpret_cast<uint4 const *>(source[0])[vector_index];
+    for (size_type i = 1; i < num_sources; i++) {
+      uint4 const words = reinterpret_cast<uint4 const *>(source[i])[vector_index];
+      result.x          = op(result.x, words.x);
+      result.y          = op(result.y, words.y);
+      result.z          = op(result.z, words.z);
+      result.w          = op(result.w, words.w);
+    }
+    reinterpret_cast<uint4 *>(destination)[vector_index] = result;
+  }
+
+  for (size_type word_index = number_of_vectors * 4 + threadIdx.x + blockIdx.x * blockDim.x;
+       word_index < number_of_mask_words;
+       word_index += stride) {
+    bitmask_type result = source[0][word_index];
+    for (size_type i = 1; i < num_sources; i++) { result = op(result, source[i][word_index]); }
+    destination[word_index] = result;
+  }
+}
+
 // convert [first_bit_index,last_bit_index) to
 // [first_word_index,last_word_index)
 struct to_word_index : public thrust::unary_function<size_type, size_type> {
@@ -371,39 +440,123 @@ struct to_word_index : public thrust::unary_function<size_type, size_type> {
 
 namespace detail {
 
-// Inplace Bitwise AND of the masks
-void inplace_bitmask_and(bitmask_type *dest_mask,
-                         std::vector<bitmask_type const *> const &masks,
-                         std::vector<size_type> const &begin_bits,
-                         size_type mask_size,
-                         cudaStream_t stream,
-                         rmm::mr::device_memory_resource *mr)
+namespace {
+
+/**
+ * @brief Writes a bitwise operation, AND or OR, of the masks to `dest_mask`
+ *
+ * Masks which all begin at bit 0 and are aligned to 16 bytes, as cudf allocates them, are
+ * combined with 128-bit loads.
+ */
+template <typename BinaryOp>
+void inplace_bitmask_binop(BinaryOp op,
+                           bitmask_type *dest_mask,
+                           std::vector<bitmask_type const *> const &masks,
+                           std::vector<size_type> const &begin_bits,
+                           size_type mask_size,
+                           cudaStream_t stream)
 {
   CUDF_EXPECTS(std::all_of(begin_bits.begin(), begin_bits.end(), [](auto b) { return b >= 0; }),
                "Invalid range.");
   CUDF_EXPECTS(mask_size > 0, "Invalid bit range.");
+  CUDF_EXPECTS(not masks.empty(), "At least one mask is required");
   CUDF_EXPECTS(std::all_of(masks.begin(), masks.end(), [](auto p) { return p != nullptr; }),
                "Mask pointer cannot be null");
 
-  auto num_bytes = bitmask_allocation_size_bytes(mask_size);
-
   auto number_of_mask_words = num_bitmask_words(mask_size);
 
+  auto const is_aligned = [](void const *p) {
+    return reinterpret_cast<std::uintptr_t>(p) % sizeof(uint4) == 0;
+  };
+  auto const vectorizable =
+    is_aligned(dest_mask) and
+    std::all_of(begin_bits.begin(), begin_bits.end(), [](auto b) { return b == 0; }) and
+    std::all_of(masks.begin(), masks.end(), is_aligned);
+
   rmm::device_vector<bitmask_type const *> d_masks(masks);
-  rmm::device_vector<size_type> d_begin_bits(begin_bits);
 
-  cudf::detail::grid_1d config(number_of_mask_words, 256);
-  offset_bitmask_and<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-    dest_mask,
-    d_masks.data().get(),
-    d_begin_bits.data().get(),
-    d_masks.size(),
-    mask_size,
-    number_of_mask_words);
+  if (vectorizable) {
+    cudf::detail::grid_1d config(std::max(number_of_mask_words / 4, 1), 256);
+    aligned_bitmask_binop<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      op, dest_mask, d_masks.data().get(), d_masks.size(), number_of_mask_words);
+  } else {
+    rmm::device_vector<size_type> d_begin_bits(begin_bits);
+
+    cudf::detail::grid_1d config(number_of_mask_words, 256);
+    offset_bitmask_binop<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      op,
+      dest_mask,
+      d_masks.data().get(),
+      d_begin_bits.data().get(),
+      d_masks.size(),
+      mask_size,
+      number_of_mask_words);
+  }
 
   CHECK_CUDA(stream);
 }
 
+/**
+ * @brief Returns a bitwise operation, AND or OR, of the masks, or a copy of the only mask
+ */
+template <typename BinaryOp>
+rmm::device_buffer bitmask_binop(BinaryOp op,
+                                 std::vector<bitmask_type const *> const &masks,
+                                 std::vector<size_type> const &begin_bits,
+                                 size_type mask_size,
+                                 cudaStream_t stream,
+                                 rmm::mr::device_memory_resource *mr)
+{
+  if (masks.size() == 1) {
+    CUDF_EXPECTS(begin_bits.size() == 1 and begin_bits[0] >= 0, "Invalid range.");
+    CUDF_EXPECTS(masks[0] != nullptr, "Mask pointer cannot be null");
+    return cudf::copy_bitmask(masks[0], begin_bits[0], begin_bits[0] + mask_size, stream, mr);
+  }
+
+  auto num_bytes = bitmask_allocation_size_bytes(mask_size);
+  rmm::device_buffer dest_mask{num_bytes, stream, mr};
+  inplace_bitmask_binop(
+    op, static_cast<bitmask_type *>(dest_mask.data()), masks, begin_bits, mask_size, stream);
+
+  return dest_mask;
+}
+
+/**
+ * @brief Returns a bitwise operation, AND or OR, of the null masks of the nullable columns of
+ * `view`, or an empty buffer if none is nullable
+ */
+template <typename BinaryOp>
+rmm::device_buffer table_bitmask_binop(BinaryOp op,
+                                       table_view const &view,
+                                       cudaStream_t stream,
+                                       rmm::mr::device_memory_resource *mr)
+{
+  std::vector<bitmask_type const *> masks;
+  std::vector<size_type> offsets;
+  for (auto &&col : view) {
+    if (col.nullable()) {
+      masks.push_back(col.null_mask());
+      offsets.push_back(col.offset());
+    }
+  }
+
+  if (masks.empty()) { return rmm::device_buffer{0, stream, mr}; }
+  return bitmask_binop(op, masks, offsets, view.num_rows(), stream, mr);
+}
+
+}  // namespace
+
+// Inplace Bitwise AND of the masks
+void inplace_bitmask_and(bitmask_type *dest_mask,
+                         std::vector<bitmask_type const *> const &masks,
+                         std::vector<size_type> const &begin_bits,
+                         size_type mask_size,
+                         cudaStream_t stream,
+                         rmm::mr::device_memory_resource *mr)
+{
+  inplace_bitmask_binop(bitmask_and_op{}, dest_mask, masks, begin_bits, mask_size, stream);
+}
+
 // Bitwise AND of the masks
 rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
                                std::vector<size_type> const &begin_bits,
@@ -411,16 +564,17 @@ rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
                                cudaStream_t stream,
                                rmm::mr::device_memory_resource *mr)
 {
-  rmm::device_buffer dest_mask{};
-  auto num_bytes = bitmask_allocation_size_bytes(mask_size);
-
-  auto number_of_mask_words = num_bitmask_words(mask_size);
-
-  dest_mask = rmm::device_buffer{num_bytes, stream, mr};
-  inplace_bitmask_and(
-    static_cast<bitmask_type *>(dest_mask.data()), masks, begin_bits, mask_size, stream, mr);
+  return bitmask_binop(bitmask_and_op{}, masks, begin_bits, mask_size, stream, mr);
+}
 
-  return dest_mask;
+// Bitwise OR of the masks
+rmm::device_buffer bitmask_or(std::vector<bitmask_type const *> const &masks,
+                              std::vector<size_type> const &begin_bits,
+                              size_type mask_size,
+                              cudaStream_t stream,
+                              rmm::mr::device_memory_resource *mr)
+{
+  return bitmask_binop(bitmask_or_op{}, masks, begin_bits, mask_size, stream, mr);
 }
 
 cudf::size_type count_set_bits(bitmask_type const *bitmask,
@@ -447,7 +601,7 @@ cudf::size_type count_set_bits(bitmask_type const *bitmask,
   count_set_bits_kernel<block_size><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
     bitmask, start, stop - 1, non_zero_count.data());
 
-  return non_zero_count.value();
+  return non_zero_count.value(stream);
 }
 
 cudf::size_type count_unset_bits(bitmask_type const *bitmask,
@@ -666,23 +820,25 @@ rmm::device_buffer bitmask_and(table_view const &view,
                                cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+  if (view.num_rows() == 0 or view.num_columns() == 0) { return rmm::device_buffer{0, stream, mr}; }
 
-  std::vector<bitmask_type const *> masks;
-  std::vector<size_type> offsets;
-  for (auto &&col : view) {
-    if (col.nullable()) {
-      masks.push_back(col.null_mask());
-      offsets.push_back(col.offset());
-    }
-  }
+  return detail::table_bitmask_binop(bitmask_and_op{}, view, stream, mr);
+}
 
-  if (masks.size() > 0) {
-    return cudf::detail::bitmask_and(masks, offsets, view.num_rows(), stream, mr);
-  }
+// Returns the bitwise OR of the null masks of all columns in the table view
+rmm::device_buffer bitmask_or(table_view const &view,
+                              rmm::mr::device_memory_resource *mr,
+                              cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  if (view.num_rows() == 0 or view.num_columns() == 0) { return rmm::device_buffer{0, stream, mr}; }
 
-  return null_mask;
+  // A column without a null mask makes every row valid
+  auto const all_nullable =
+    std::all_of(view.begin(), view.end(), [](auto const &col) { return col.nullable(); });
+  if (not all_nullable) { return rmm::device_buffer{0, stream, mr}; }
+
+  return detail::table_bitmask_binop(bitmask_or_op{}, view, stream, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,653 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/compressed_column.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/extrema.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/replace.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr uint64_t sign_bit{uint64_t{1} << 63};
+constexpr int32_t word_bits{64};
+
+template <typename T>
+constexpr bool is_compressible()
+{
+  return std::is_integral<T>::value && not std::is_same<T, bool>::value;
+}
+
+/**
+ * @brief Maps an integer to an unsigned 64-bit key of the same order
+ */
+template <typename T>
+__host__ __device__ uint64_t to_key(T value)
+{
+  return std::is_signed<T>::value ? static_cast<uint64_t>(static_cast<int64_t>(value)) ^ sign_bit
+                                  : static_cast<uint64_t>(value);
+}
+
+template <typename T>
+__host__ __device__ T from_key(uint64_t key)
+{
+  return std::is_signed<T>::value ? static_cast<T>(static_cast<int64_t>(key ^ sign_bit))
+                                  : static_cast<T>(key);
+}
+
+/**
+ * @brief Device view of `packed_integers`
+ */
+struct packed_integers_view {
+  uint64_t const* words;
+  uint64_t reference;
+  int32_t bit_width;
+
+  explicit packed_integers_view(packed_integers const& packed)
+    : words(static_cast<uint64_t const*>(packed.words.data())),
+      reference(packed.reference),
+      bit_width(packed.bit_width)
+  {
+  }
+
+  __device__ uint64_t operator[](size_type i) const
+  {
+    if (bit_width == 0) { return reference; }
+    int64_t const bit = static_cast<int64_t>(i) * bit_width;
+    auto const word   = bit / word_bits;
+    auto const shift  = static_cast<int32_t>(bit % word_bits);
+    uint64_t value    = words[word] >> shift;
+    // The integer may straddle two words
+    if (shift + bit_width > word_bits) { value |= words[word + 1] << (word_bits - shift); }
+    if (bit_width < word_bits) { value &= (uint64_t{1} << bit_width) - 1; }
+    return reference + value;
+  }
+};
+
+/**
+ * @brief The smallest and largest of a sequence of keys
+ */
+struct key_range {
+  uint64_t min{0};
+  uint64_t max{0};
+
+  int32_t bit_width() const
+  {
+    return min == max ? 0 : word_bits - __builtin_clzll(max - min);
+  }
+};
+
+key_range range_of(rmm::device_vector<uint64_t> const& keys, cudaStream_t stream)
+{
+  if (keys.empty()) { return {}; }
+  auto const extrema =
+    thrust::minmax_element(rmm::exec_policy(stream)->on(stream), keys.begin(), keys.end());
+  return {*extrema.first, *extrema.second};
+}
+
+/**
+ * @brief Bitpacks keys relative to their minimum, each thread writing one 64-bit word.
+ */
+packed_integers pack(rmm::device_vector<uint64_t> const& keys,
+                     rmm::mr::device_memory_resource* mr,
+                     cudaStream_t stream)
+{
+  auto const range = range_of(keys, stream);
+  packed_integers packed;
+  packed.reference = range.min;
+  packed.bit_width = range.bit_width();
+  packed.size      = keys.size();
+
+  auto const num_words =
+    util::div_rounding_up_safe<int64_t>(static_cast<int64_t>(packed.size) * packed.bit_width,
+                                        word_bits);
+  packed.words = rmm::device_buffer(num_words * sizeof(uint64_t), stream, mr);
+  if (num_words == 0) { return packed; }
+
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<int64_t>(0),
+    thrust::make_counting_iterator<int64_t>(num_words),
+    static_cast<uint64_t*>(packed.words.data()),
+    [keys      = keys.data().get(),
+     size      = static_cast<int64_t>(packed.size),
+     reference = packed.reference,
+     width     = packed.bit_width] __device__(int64_t w) {
+      uint64_t word{0};
+      int64_t const first_bit = w * word_bits;
+      for (int64_t i = first_bit / width; i < size && i * width < first_bit + word_bits; ++i) {
+        uint64_t const value = keys[i] - reference;
+        int64_t const shift  = i * width - first_bit;
+        word |= shift >= 0 ? value << shift : value >> -shift;
+      }
+      return word;
+    });
+  return packed;
+}
+
+rmm::device_vector<uint64_t> unpack(packed_integers const& packed, cudaStream_t stream)
+{
+  rmm::device_vector<uint64_t> keys(packed.size);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(packed.size),
+                    keys.begin(),
+                    [packed = packed_integers_view{packed}] __device__(size_type i) {
+                      return packed[i];
+                    });
+  return keys;
+}
+
+/**
+ * @brief Returns the differences of consecutive keys, the first one being zero, as signed
+ * integers mapped to keys
+ */
+rmm::device_vector<uint64_t> deltas_of(rmm::device_vector<uint64_t> const& keys,
+                                       cudaStream_t stream)
+{
+  rmm::device_vector<uint64_t> deltas(keys.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(keys.size()),
+                    deltas.begin(),
+                    [keys = keys.data().get()] __device__(size_type i) {
+                      return (i == 0 ? 0 : keys[i] - keys[i - 1]) ^ sign_bit;
+                    });
+  return deltas;
+}
+
+/**
+ * @brief Returns the keys whose differences are `deltas`, as returned by `deltas_of`
+ */
+rmm::device_vector<uint64_t> undo_deltas(rmm::device_vector<uint64_t> const& deltas,
+                                         uint64_t base,
+                                         cudaStream_t stream)
+{
+  rmm::device_vector<uint64_t> keys(deltas.size());
+  auto const differences = thrust::make_transform_iterator(
+    deltas.begin(), [] __device__(uint64_t d) { return d ^ sign_bit; });
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         differences,
+                         differences + deltas.size(),
+                         keys.begin());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    keys.begin(),
+                    keys.end(),
+                    keys.begin(),
+                    [base] __device__(uint64_t key) { return base + key; });
+  return keys;
+}
+
+struct runs {
+  rmm::device_vector<uint64_t> keys;
+  rmm::device_vector<uint64_t> lengths;
+};
+
+runs runs_of(rmm::device_vector<uint64_t> const& keys, cudaStream_t stream)
+{
+  runs result{rmm::device_vector<uint64_t>(keys.size()),
+              rmm::device_vector<uint64_t>(keys.size())};
+  auto const ends = thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                                          keys.begin(),
+                                          keys.end(),
+                                          thrust::make_constant_iterator<uint64_t>(1),
+                                          result.keys.begin(),
+                                          result.lengths.begin());
+  result.keys.resize(thrust::distance(result.keys.begin(), ends.first));
+  result.lengths.resize(result.keys.size());
+  return result;
+}
+
+bool uses_rle(cascade_scheme scheme)
+{
+  return scheme == cascade_scheme::RLE_BITPACK || scheme == cascade_scheme::RLE_DELTA_BITPACK;
+}
+
+bool uses_delta(cascade_scheme scheme)
+{
+  return scheme == cascade_scheme::DELTA_BITPACK || scheme == cascade_scheme::RLE_DELTA_BITPACK;
+}
+
+/**
+ * @brief Returns the number of bits of the keys encoded with `scheme`
+ */
+int64_t encoded_bits(rmm::device_vector<uint64_t> const& keys,
+                     cascade_scheme scheme,
+                     cudaStream_t stream)
+{
+  auto const values_bits = [&](rmm::device_vector<uint64_t> const& values) {
+    auto const width = uses_delta(scheme) ? range_of(deltas_of(values, stream), stream).bit_width()
+                                          : range_of(values, stream).bit_width();
+    return static_cast<int64_t>(values.size()) * width;
+  };
+  if (not uses_rle(scheme)) { return values_bits(keys); }
+  auto const r = runs_of(keys, stream);
+  return values_bits(r.keys) +
+         static_cast<int64_t>(r.lengths.size()) * range_of(r.lengths, stream).bit_width();
+}
+
+struct to_keys_fn {
+  template <typename T, std::enable_if_t<is_compressible<T>()>* = nullptr>
+  rmm::device_vector<uint64_t> operator()(column_view const& input, cudaStream_t stream)
+  {
+    auto const policy  = rmm::exec_policy(stream)->on(stream);
+    auto const d_input = column_device_view::create(input, stream);
+    rmm::device_vector<uint64_t> keys(input.size());
+    thrust::transform(policy,
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      keys.begin(),
+                      [d_input = *d_input] __device__(size_type i) {
+                        return d_input.is_valid(i) ? to_key(d_input.element<T>(i))
+                                                   : std::numeric_limits<uint64_t>::max();
+                      });
+    // Nulls take the smallest valid key, so that they do not widen the range of the keys
+    if (input.has_nulls()) {
+      auto const smallest = thrust::reduce(policy,
+                                           keys.begin(),
+                                           keys.end(),
+                                           std::numeric_limits<uint64_t>::max(),
+                                           thrust::minimum<uint64_t>());
+      thrust::replace_if(
+        policy,
+        keys.begin(),
+        keys.end(),
+        thrust::make_counting_iterator<size_type>(0),
+        [d_input = *d_input] __device__(size_type i) { return d_input.is_null(i); },
+        smallest);
+    }
+    return keys;
+  }
+
+  template <typename T, std::enable_if_t<not is_compressible<T>()>* = nullptr>
+  rmm::device_vector<uint64_t> operator()(column_view const&, cudaStream_t)
+  {
+    CUDF_FAIL("Only integer columns can be compressed");
+  }
+};
+
+/**
+ * @brief Creates a column of `size` rows from the keys `keys[map[i]]`, or `keys[i]` without map
+ */
+struct from_keys_fn {
+  template <typename T, typename Keys, std::enable_if_t<is_compressible<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(data_type type,
+                                     size_type size,
+                                     Keys keys,
+                                     size_type const* map,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    auto result = make_fixed_width_column(type, size, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(size),
+                      result->mutable_view().begin<T>(),
+                      [keys, map] __device__(size_type i) {
+                        return from_key<T>(keys[map == nullptr ? i : map[i]]);
+                      });
+    return result;
+  }
+
+  template <typename T, typename... Args, std::enable_if_t<not is_compressible<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(Args&&...)
+  {
+    CUDF_FAIL("Only integer columns can be compressed");
+  }
+};
+
+/**
+ * @brief Reduces the keys of a `BITPACK` column, the null elements being skipped
+ */
+struct reduce_keys_fn {
+  template <typename T, std::enable_if_t<is_compressible<T>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(compressed_column const& input,
+                                     aggregation::Kind kind,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    auto const policy    = rmm::exec_policy(stream)->on(stream);
+    auto const keys      = packed_integers_view{input.values};
+    auto const null_mask = static_cast<bitmask_type const*>(input.null_mask.data());
+    auto const begin     = thrust::make_counting_iterator<size_type>(0);
+    auto const end       = thrust::make_counting_iterator<size_type>(input.size);
+    auto const is_valid  = [null_mask] __device__(size_type i) {
+      return null_mask == nullptr || bit_is_set(null_mask, i);
+    };
+
+    if (kind == aggregation::SUM) {
+      using Sum = std::conditional_t<std::is_signed<T>::value, int64_t, uint64_t>;
+      auto const sum = thrust::transform_reduce(
+        policy,
+        begin,
+        end,
+        [keys, is_valid] __device__(size_type i) {
+          return is_valid(i) ? static_cast<Sum>(from_key<T>(keys[i])) : Sum{0};
+        },
+        Sum{0},
+        thrust::plus<Sum>());
+      return std::make_unique<numeric_scalar<Sum>>(sum, true, stream, mr);
+    }
+
+    // The order of the keys is the order of the values
+    bool const is_min   = kind == aggregation::MIN;
+    uint64_t const none = is_min ? std::numeric_limits<uint64_t>::max() : 0;
+    auto const key      = thrust::transform_reduce(
+      policy,
+      begin,
+      end,
+      [keys, is_valid, none] __device__(size_type i) { return is_valid(i) ? keys[i] : none; },
+      none,
+      [is_min] __device__(uint64_t lhs, uint64_t rhs) {
+        return is_min ? thrust::min(lhs, rhs) : thrust::max(lhs, rhs);
+      });
+    return std::make_unique<numeric_scalar<T>>(from_key<T>(key), true, stream, mr);
+  }
+
+  template <typename T, std::enable_if_t<not is_compressible<T>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(compressed_column const&,
+                                     aggregation::Kind,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t)
+  {
+    CUDF_FAIL("Only integer columns can be compressed");
+  }
+};
+
+/**
+ * @brief Returns whether `reduce_keys_fn` computes the reduction of `input`
+ */
+bool reduces_keys(compressed_column const& input, aggregation::Kind kind, data_type output_dtype)
+{
+  if (input.scheme != cascade_scheme::BITPACK) { return false; }
+  if (kind == aggregation::MIN || kind == aggregation::MAX) { return output_dtype == input.type; }
+  if (kind != aggregation::SUM) { return false; }
+  auto const is_signed = input.type.id() == type_id::INT8 || input.type.id() == type_id::INT16 ||
+                         input.type.id() == type_id::INT32 || input.type.id() == type_id::INT64;
+  return output_dtype.id() == (is_signed ? type_id::INT64 : type_id::UINT64);
+}
+
+rmm::device_buffer copy_null_mask(compressed_column const& input,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  return rmm::device_buffer(input.null_mask.data(), input.null_mask.size(), stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<compressed_column> compress(column_view const& input,
+                                            cascade_scheme scheme,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  auto const keys = type_dispatcher(input.type(), to_keys_fn{}, input, stream);
+
+  auto result        = std::make_unique<compressed_column>();
+  result->type       = input.type();
+  result->size       = input.size();
+  result->null_count = input.null_count();
+  result->scheme     = scheme;
+  if (input.has_nulls()) { result->null_mask = copy_bitmask(input, stream, mr); }
+
+  auto const encode_values = [&](rmm::device_vector<uint64_t> const& values) {
+    if (not uses_delta(scheme)) { return pack(values, mr, stream); }
+    if (not values.empty()) { result->delta_base = values.front(); }
+    return pack(deltas_of(values, stream), mr, stream);
+  };
+  if (uses_rle(scheme)) {
+    auto const r        = runs_of(keys, stream);
+    result->values      = encode_values(r.keys);
+    result->run_lengths = pack(r.lengths, mr, stream);
+  } else {
+    result->values = encode_values(keys);
+  }
+  return result;
+}
+
+std::unique_ptr<compressed_column> compress(column_view const& input,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  auto const keys = type_dispatcher(input.type(), to_keys_fn{}, input, stream);
+
+  auto best      = cascade_scheme::BITPACK;
+  auto best_bits = encoded_bits(keys, best, stream);
+  for (auto const scheme : {cascade_scheme::DELTA_BITPACK,
+                            cascade_scheme::RLE_BITPACK,
+                            cascade_scheme::RLE_DELTA_BITPACK}) {
+    auto const bits = encoded_bits(keys, scheme, stream);
+    if (bits < best_bits) {
+      best      = scheme;
+      best_bits = bits;
+    }
+  }
+  return compress(input, best, mr, stream);
+}
+
+std::unique_ptr<column> decompress(compressed_column const& input,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  if (input.scheme == cascade_scheme::BITPACK) {
+    auto result = type_dispatcher(input.type,
+                                  from_keys_fn{},
+                                  input.type,
+                                  input.size,
+                                  packed_integers_view{input.values},
+                                  nullptr,
+                                  mr,
+                                  stream);
+    result->set_null_mask(copy_null_mask(input, mr, stream), input.null_count);
+    return result;
+  }
+
+  auto keys = unpack(input.values, stream);
+  if (uses_delta(input.scheme)) { keys = undo_deltas(keys, input.delta_base, stream); }
+  if (uses_rle(input.scheme)) {
+    // Row `i` belongs to the run of the first run end larger than `i`
+    auto const policy = rmm::exec_policy(stream)->on(stream);
+    auto run_ends     = unpack(input.run_lengths, stream);
+    thrust::inclusive_scan(policy, run_ends.begin(), run_ends.end(), run_ends.begin());
+    rmm::device_vector<size_type> runs(input.size);
+    thrust::upper_bound(policy,
+                        run_ends.begin(),
+                        run_ends.end(),
+                        thrust::make_counting_iterator<uint64_t>(0),
+                        thrust::make_counting_iterator<uint64_t>(input.size),
+                        runs.begin());
+    rmm::device_vector<uint64_t> expanded(input.size);
+    thrust::gather(policy, runs.begin(), runs.end(), keys.begin(), expanded.begin());
+    keys = std::move(expanded);
+  }
+
+  auto result = type_dispatcher(input.type,
+                                from_keys_fn{},
+                                input.type,
+                                input.size,
+                                static_cast<uint64_t const*>(keys.data().get()),
+                                nullptr,
+                                mr,
+                                stream);
+  result->set_null_mask(copy_null_mask(input, mr, stream), input.null_count);
+  return result;
+}
+
+std::unique_ptr<column> gather(compressed_column const& input,
+                               column_view const& gather_map,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
+{
+  CUDF_EXPECTS(gather_map.type().id() == type_id::INT32 && not gather_map.has_nulls(),
+               "Gather map must be a non-nullable INT32 column");
+  if (input.scheme != cascade_scheme::BITPACK) {
+    auto const decompressed = decompress(input, rmm::mr::get_default_resource(), stream);
+    auto result             = detail::gather(table_view{{decompressed->view()}},
+                                 gather_map,
+                                 out_of_bounds_policy::IGNORE,
+                                 negative_index_policy::NOT_ALLOWED,
+                                 mr,
+                                 stream);
+    return std::move(result->release().front());
+  }
+
+  auto const map = gather_map.data<size_type>();
+  auto result    = type_dispatcher(input.type,
+                                from_keys_fn{},
+                                input.type,
+                                gather_map.size(),
+                                packed_integers_view{input.values},
+                                map,
+                                mr,
+                                stream);
+  if (input.null_count > 0) {
+    auto mask = valid_if(
+      map,
+      map + gather_map.size(),
+      [null_mask = static_cast<bitmask_type const*>(input.null_mask.data())] __device__(
+        size_type row) { return bit_is_set(null_mask, row); },
+      stream,
+      mr);
+    result->set_null_mask(std::move(mask.first), mask.second);
+  }
+  return result;
+}
+
+std::unique_ptr<column> apply_boolean_mask(compressed_column const& input,
+                                           column_view const& boolean_mask,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be of type BOOL8");
+  CUDF_EXPECTS(boolean_mask.size() == input.size, "Mask must have one row per row of input");
+  if (input.scheme != cascade_scheme::BITPACK) {
+    auto const decompressed = decompress(input, rmm::mr::get_default_resource(), stream);
+    auto result =
+      detail::apply_boolean_mask(table_view{{decompressed->view()}}, boolean_mask, mr, stream);
+    return std::move(result->release().front());
+  }
+
+  // The rows passing the filter are gathered
+  auto const d_mask = column_device_view::create(boolean_mask, stream);
+  rmm::device_vector<size_type> indices(input.size);
+  auto const end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(input.size),
+                                   indices.begin(),
+                                   [d_mask = *d_mask] __device__(size_type i) {
+                                     return d_mask.is_valid(i) and d_mask.element<bool>(i);
+                                   });
+  column_view const gather_map(
+    data_type{type_id::INT32}, thrust::distance(indices.begin(), end), indices.data().get());
+  return detail::gather(input, gather_map, mr, stream);
+}
+
+std::unique_ptr<scalar> reduce(compressed_column const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
+{
+  if (not reduces_keys(input, agg->kind, output_dtype)) {
+    auto const decompressed = decompress(input, rmm::mr::get_default_resource(), stream);
+    return cudf::reduce(decompressed->view(), agg, output_dtype, mr);
+  }
+  if (input.size <= input.null_count) {
+    auto result = make_default_constructed_scalar(output_dtype);
+    result->set_valid(false, stream);
+    return result;
+  }
+  return type_dispatcher(input.type, reduce_keys_fn{}, input, agg->kind, mr, stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<compressed_column> compress(column_view const& input,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compress(input, mr);
+}
+
+std::unique_ptr<compressed_column> compress(column_view const& input,
+                                            cascade_scheme scheme,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compress(input, scheme, mr);
+}
+
+std::unique_ptr<column> decompress(compressed_column const& input,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decompress(input, mr);
+}
+
+std::unique_ptr<column> gather(compressed_column const& input,
+                               column_view const& gather_map,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::gather(input, gather_map, mr);
+}
+
+std::unique_ptr<column> apply_boolean_mask(compressed_column const& input,
+                                           column_view const& boolean_mask,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_boolean_mask(input, boolean_mask, mr);
+}
+
+std::unique_ptr<scalar> reduce(compressed_column const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(input, agg, output_dtype, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/indexed_column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+namespace cudf {
+namespace {
+void check_indices(column_view const& indices)
+{
+  CUDF_EXPECTS(indices.type().id() == type_to_id<size_type>(), "Indices must be INT32");
+  CUDF_EXPECTS(not indices.has_nulls(), "Indices must not contain nulls");
+}
+
+}  // namespace
+
+indexed_column_view::indexed_column_view(column_view const& parent) : _parent{parent} {}
+
+indexed_column_view::indexed_column_view(column_view const& parent, column_view const& indices)
+  : _parent{parent}, _indices{indices}, _has_indices{true}
+{
+  check_indices(indices);
+}
+
+std::unique_ptr<column> indexed_column_view::materialize(rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  if (not _has_indices) { return std::make_unique<column>(_parent, 0, mr); }
+  return std::move(cudf::gather(table_view{{_parent}}, _indices, false, mr)->release().front());
+}
+
+indexed_table_view::indexed_table_view(table_view const& table) : _table{table} {}
+
+indexed_table_view::indexed_table_view(table_view const& table, column_view const& indices)
+  : _table{table}, _indices{indices}, _has_indices{true}
+{
+  check_indices(indices);
+}
+
+std::unique_ptr<cudf::table> indexed_table_view::materialize(
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  if (not _has_indices) { return std::make_unique<cudf::table>(_table, 0, mr); }
+  return cudf::gather(_table, _indices, false, mr);
+}
+
+}  // namespace cudf
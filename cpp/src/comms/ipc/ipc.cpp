@@ -1,5 +1,13 @@
 #include <arrow/result.h>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/ipc.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include <cstring>
 
 CudaMessageReader::CudaMessageReader(arrow::cuda::CudaBufferReader* stream,
                                      arrow::io::BufferReader* schema)
@@ -23,3 +31,74 @@ std::unique_ptr<arrow::ipc::MessageReader> CudaMessageReader::Open(
 {
   return std::unique_ptr<arrow::ipc::MessageReader>(new CudaMessageReader(stream, schema));
 }
+
+namespace cudf {
+namespace {
+/**
+ * @brief The header of an exported table's handle, followed by the metadata of the packed table
+ */
+struct ipc_header {
+  uint32_t magic;
+  int32_t device;
+  cudaIpcMemHandle_t memory;  // handle of the allocation holding the packed buffer
+  int64_t offset;             // offset of the packed buffer in the allocation
+  int64_t data_size;          // zero if the packed table has no device memory
+};
+
+constexpr uint32_t ipc_magic = 0x43554446;  // "CUDF"
+
+}  // namespace
+
+ipc_exported_table export_ipc(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  ipc_exported_table result{{}, detail::pack(input, mr)};
+
+  ipc_header header{};
+  header.magic     = ipc_magic;
+  header.data_size = static_cast<int64_t>(result.packed.gpu_data->size());
+  CUDA_TRY(cudaGetDevice(&header.device));
+  if (header.data_size > 0) {
+    // CUDA IPC shares whole allocations, and memory resources may suballocate the buffer
+    CUdeviceptr base{};
+    std::size_t base_size{};
+    auto const data = reinterpret_cast<CUdeviceptr>(result.packed.gpu_data->data());
+    CUDF_EXPECTS(cuMemGetAddressRange(&base, &base_size, data) == CUDA_SUCCESS,
+                 "Failed to find the allocation of the packed table");
+    CUDA_TRY(cudaIpcGetMemHandle(&header.memory, reinterpret_cast<void*>(base)));
+    header.offset = static_cast<int64_t>(data - base);
+  }
+
+  auto const& metadata = *result.packed.metadata;
+  result.handle.resize(sizeof(header) + metadata.size());
+  std::memcpy(result.handle.data(), &header, sizeof(header));
+  std::memcpy(result.handle.data() + sizeof(header), metadata.data(), metadata.size());
+  return result;
+}
+
+ipc_table_view import_ipc(uint8_t const* handle, std::size_t size)
+{
+  CUDF_FUNC_RANGE();
+  ipc_header header{};
+  CUDF_EXPECTS(handle != nullptr and size > sizeof(header), "Invalid IPC table handle");
+  std::memcpy(&header, handle, sizeof(header));
+  CUDF_EXPECTS(header.magic == ipc_magic, "Invalid IPC table handle");
+
+  int device{};
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDF_EXPECTS(header.device == device, "IPC table was exported on another device");
+
+  ipc_table_view result;
+  if (header.data_size > 0) {
+    void* base = nullptr;
+    CUDA_TRY(cudaIpcOpenMemHandle(&base, header.memory, cudaIpcMemLazyEnablePeerAccess));
+    result.mapping = std::shared_ptr<void const>(
+      base, [](void const* ptr) { cudaIpcCloseMemHandle(const_cast<void*>(ptr)); });
+  }
+  auto const gpu_data =
+    result.mapping ? static_cast<uint8_t const*>(result.mapping.get()) + header.offset : nullptr;
+  result.table = unpack(handle + sizeof(header), gpu_data);
+  return result;
+}
+
+}  // namespace cudf
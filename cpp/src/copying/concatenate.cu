@@ -86,17 +86,32 @@ auto create_device_views(std::vector<column_view> const& views, cudaStream_t str
 }
 
 /**
- * @brief Concatenates the null mask bits of all the column device views in the
- * `views` array to the destination bitmask.
+ * @brief The null mask of one input of a concatenation
+ */
+struct mask_partition {
+  bitmask_type const* null_mask;  // nullptr if every row is valid
+  size_type offset;
+
+  __device__ bool is_valid(size_type element_index) const
+  {
+    return null_mask == nullptr or bit_is_set(null_mask, offset + element_index);
+  }
+};
+
+/**
+ * @brief Concatenates the null mask bits of all the inputs in the `views` array to the
+ * destination bitmask.
  *
- * @param views Array of column_device_view
+ * @tparam Partition `column_device_view` or `mask_partition`
+ * @param views Array of inputs
  * @param output_offsets Prefix sum of sizes of elements of `views`
  * @param number_of_views Size of `views` array
  * @param dest_mask The output buffer to copy null masks into
  * @param number_of_mask_bits The total number of null masks bits that are being
  * copied
  **/
-__global__ void concatenate_masks_kernel(column_device_view const* views,
+template <typename Partition>
+__global__ void concatenate_masks_kernel(Partition const* views,
                                          size_t const* output_offsets,
                                          size_type number_of_views,
                                          bitmask_type* dest_mask,
@@ -145,13 +160,28 @@ void concatenate_masks(std::vector<column_view> const& views,
                        bitmask_type* dest_mask,
                        cudaStream_t stream)
 {
-  // Preprocess and upload inputs to device memory
-  auto const device_views = create_device_views(views, stream);
-  auto const& d_views     = std::get<1>(device_views);
-  auto const& d_offsets   = std::get<2>(device_views);
-  auto const output_size  = std::get<3>(device_views);
+  // Only the null masks are needed, so build them on the host and upload them at once rather
+  // than creating a device view of every input and its children
+  auto partitions = thrust::host_vector<mask_partition>();
+  partitions.reserve(views.size());
+  auto offsets = thrust::host_vector<size_t>(views.size() + 1, 0);
+  for (std::size_t i = 0; i < views.size(); ++i) {
+    partitions.push_back(mask_partition{views[i].null_mask(), views[i].offset()});
+    offsets[i + 1] = offsets[i] + views[i].size();
+  }
+  auto const d_partitions = rmm::device_vector<mask_partition>{partitions};
+  auto const d_offsets    = rmm::device_vector<size_t>{offsets};
+  auto const output_size  = static_cast<size_type>(offsets.back());
+  if (output_size == 0) { return; }
 
-  concatenate_masks(d_views, d_offsets, dest_mask, output_size, stream);
+  constexpr size_type block_size{256};
+  cudf::detail::grid_1d config(output_size, block_size);
+  concatenate_masks_kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+    d_partitions.data().get(),
+    d_offsets.data().get(),
+    static_cast<size_type>(d_partitions.size()),
+    dest_mask,
+    output_size);
 }
 
 template <typename T, size_type block_size, bool Nullable>
@@ -230,7 +260,7 @@ std::unique_ptr<column> fused_concatenate(std::vector<column_view> const& views,
   auto out_view   = out_col->mutable_view();
   auto d_out_view = mutable_column_device_view::create(out_view, stream);
 
-  rmm::device_scalar<size_type> d_valid_count(0);
+  rmm::device_scalar<size_type> d_valid_count(0, stream);
 
   // Launch kernel
   constexpr size_type block_size{256};
@@ -1,173 +1,154 @@
-/*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
- *
- * Licensed under the Apache License, Version 2.0 (the "License");
- * you may not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- *     http://www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
 
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/extrema.h>
+#include <thrust/transform.h>
+
+#include <cub/cub.cuh>
+
+#include <algorithm>
 #include <numeric>
 
 namespace cudf {
 namespace detail {
 namespace {
+// align all column size allocations to this boundary so that all output column buffers
+// start at that alignment.
+static constexpr size_t split_align = 64;
+
+constexpr int copy_block_size = 256;
+// bytes, offsets or validity words copied by one block of the copy kernel
+constexpr size_t units_per_block = copy_block_size * 32;
+
 /**
- * @brief Copies contents of `in` to `out`.  Copies validity if present
- * but does not compute null count.
- *
- * @param in column_view to copy from
- * @param out mutable_column_view to copy to.
+ * @brief How a buffer is copied by `copy_partitions_kernel`
+ */
+enum class copy_kind : int8_t {
+  BYTES,     ///< a plain copy of `size` bytes
+  OFFSETS,   ///< `size` string offsets shifted down by `src_offset`
+  VALIDITY,  ///< `size` words of the `num_rows` bits of a null mask from bit `src_offset`
+};
+
+/**
+ * @brief Describes the copy of one buffer of one column of one split
  */
-template <size_type block_size, typename T, bool has_validity>
-__launch_bounds__(block_size) __global__
-  void copy_in_place_kernel(column_device_view const in, mutable_column_device_view out)
+struct copy_descriptor {
+  copy_kind kind;
+  void const* src;
+  void* dst;
+  size_t size;           // number of bytes, offsets or validity words to write
+  size_type src_offset;  // first bit of the validity, or shift of the offsets
+  size_type num_rows;    // number of rows of the validity
+};
+
+__device__ void copy_bytes(copy_descriptor const& desc, size_t begin, size_t end)
 {
-  const size_type tid            = threadIdx.x + blockIdx.x * block_size;
-  const int warp_id              = tid / cudf::detail::warp_size;
-  const size_type warps_per_grid = gridDim.x * block_size / cudf::detail::warp_size;
-
-  // begin/end indices for the column data
-  size_type begin = 0;
-  size_type end   = in.size();
-  // warp indices.  since 1 warp == 32 threads == sizeof(bit_mask_t) * 8,
-  // each warp will process one (32 bit) of the validity mask via
-  // __ballot_sync()
-  size_type warp_begin = cudf::word_index(begin);
-  size_type warp_end   = cudf::word_index(end - 1);
-
-  // lane id within the current warp
-  const int lane_id = threadIdx.x % cudf::detail::warp_size;
-
-  // current warp.
-  size_type warp_cur = warp_begin + warp_id;
-  size_type index    = tid;
-  while (warp_cur <= warp_end) {
-    bool in_range = (index >= begin && index < end);
-
-    bool valid = true;
-    if (has_validity) { valid = in_range && in.is_valid(index); }
-    if (in_range) { out.element<T>(index) = in.element<T>(index); }
-
-    // update validity
-    if (has_validity) {
-      // the final validity mask for this warp
-      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid && in_range);
-      // only one guy in the warp needs to update the mask and count
-      if (lane_id == 0) { out.set_mask_word(warp_cur, warp_mask); }
+  auto const src = static_cast<char const*>(desc.src);
+  auto const dst = static_cast<char*>(desc.dst);
+  // every destination buffer is aligned to split_align, and every block starts at a multiple of
+  // units_per_block, so aligned sources can be copied a word at a time
+  if (reinterpret_cast<uintptr_t>(src) % sizeof(uint64_t) == 0) {
+    auto const words_end = begin + (end - begin) / sizeof(uint64_t) * sizeof(uint64_t);
+    for (auto idx = begin + threadIdx.x * sizeof(uint64_t); idx < words_end;
+         idx += copy_block_size * sizeof(uint64_t)) {
+      *reinterpret_cast<uint64_t*>(dst + idx) = *reinterpret_cast<uint64_t const*>(src + idx);
     }
+    begin = words_end;
+  }
+  for (auto idx = begin + threadIdx.x; idx < end; idx += copy_block_size) { dst[idx] = src[idx]; }
+}
 
-    // next grid
-    warp_cur += warps_per_grid;
-    index += block_size * gridDim.x;
+__device__ void copy_offsets(copy_descriptor const& desc, size_t begin, size_t end)
+{
+  auto const src = static_cast<size_type const*>(desc.src);
+  auto const dst = static_cast<size_type*>(desc.dst);
+  // each output column starts at a new base pointer. so we have to
+  // shift every offset down by the point (in chars) at which it was split.
+  for (auto idx = begin + threadIdx.x; idx < end; idx += copy_block_size) {
+    dst[idx] = src[idx] - desc.src_offset;
   }
 }
 
 /**
- * @brief Copies contents of one string column to another.  Copies validity if present
- * but does not compute null count.
- *
- * The purpose of this kernel is to reduce the number of
- * kernel calls for copying a string column from 2 to 1, since number of kernel calls is the
- * dominant factor in large scale contiguous_split() calls.  To do this, the kernel is
- * invoked with using max(num_chars, num_offsets) threads and then doing separate
- * bounds checking on offset, chars and validity indices.
+ * @brief Copies the validity words of the range and returns the number of valid rows the thread
+ * copied.
+ */
+__device__ size_type copy_validity(copy_descriptor const& desc, size_t begin, size_t end)
+{
+  auto const src     = static_cast<bitmask_type const*>(desc.src);
+  auto const dst     = static_cast<bitmask_type*>(desc.dst);
+  auto const end_bit = desc.src_offset + desc.num_rows;
+  size_type valid    = 0;
+  for (auto idx = begin + threadIdx.x; idx < end; idx += copy_block_size) {
+    auto const first_bit = desc.src_offset + static_cast<size_type>(idx) * warp_size;
+    auto const src_word  = word_index(first_bit);
+    auto const next_word = word_index(end_bit - 1) > src_word ? src[src_word + 1] : 0;
+    auto word            = __funnelshift_r(src[src_word], next_word, first_bit);
+    // clear the bits past the last row
+    auto const rows = desc.num_rows - static_cast<size_type>(idx) * warp_size;
+    if (rows < warp_size) { word &= (bitmask_type{1} << rows) - 1; }
+    dst[idx] = word;
+    valid += __popc(word);
+  }
+  return valid;
+}
+
+/**
+ * @brief Copies the buffers of all the columns of all the splits.
  *
- * Outgoing offset values are shifted down to account for the new base address
- * each column gets as a result of the contiguous_split() process.
+ * Every descriptor is copied by a range of blocks starting at `block_offsets[i]`, each of which
+ * copies `units_per_block` units of the descriptor. The number of valid rows of each validity
+ * descriptor is added to `valid_counts`.
  *
- * @param in num_strings number of strings (rows) in the column
- * @param in offsets_in pointer to incoming offsets to be copied
- * @param out offsets_out pointer to output offsets
- * @param in validity_in_offset offset into validity buffer to add to element indices
- * @param in validity_in pointer to incoming validity vector to be copied
- * @param out validity_out pointer to output validity vector
- * @param in offset_shift value to shift copied offsets down by
- * @param in num_chars number of chars to copy
- * @param in chars_in input chars to be copied
- * @param out chars_out output chars to be copied.
+ * @param descriptors The buffers to copy
+ * @param num_descriptors Number of descriptors
+ * @param block_offsets First block of every descriptor
+ * @param valid_counts Number of valid rows of every descriptor, initialized to 0
  */
-template <size_type block_size, bool has_validity>
-__launch_bounds__(block_size) __global__
-  void copy_in_place_strings_kernel(size_type num_strings,
-                                    size_type const* __restrict__ offsets_in,
-                                    size_type* __restrict__ offsets_out,
-                                    size_type validity_in_offset,
-                                    bitmask_type const* __restrict__ validity_in,
-                                    bitmask_type* __restrict__ validity_out,
-                                    size_type offset_shift,
-                                    size_type num_chars,
-                                    char const* __restrict__ chars_in,
-                                    char* __restrict__ chars_out)
+__launch_bounds__(copy_block_size) __global__
+  void copy_partitions_kernel(copy_descriptor const* __restrict__ descriptors,
+                              size_type num_descriptors,
+                              size_type const* __restrict__ block_offsets,
+                              size_type* __restrict__ valid_counts)
 {
-  const size_type tid            = threadIdx.x + blockIdx.x * block_size;
-  const int warp_id              = tid / cudf::detail::warp_size;
-  const size_type warps_per_grid = gridDim.x * block_size / cudf::detail::warp_size;
-
-  // how many warps we'll be processing. with strings, the chars and offsets
-  // lengths may be different.  so we'll just march the worst case.
-  size_type warp_begin = cudf::word_index(0);
-  size_type warp_end   = cudf::word_index(std::max(num_chars, num_strings + 1) - 1);
-
-  // end indices for chars
-  size_type chars_end = num_chars;
-  // end indices for offsets
-  size_type offsets_end = num_strings + 1;
-  // end indices for validity and the last warp that actually should
-  // be updated
-  size_type validity_end      = num_strings;
-  size_type validity_warp_end = cudf::word_index(num_strings - 1);
-
-  // lane id within the current warp
-  const int lane_id = threadIdx.x % cudf::detail::warp_size;
-
-  size_type warp_cur = warp_begin + warp_id;
-  size_type index    = tid;
-  while (warp_cur <= warp_end) {
-    if (index < chars_end) { chars_out[index] = chars_in[index]; }
-
-    if (index < offsets_end) {
-      // each output column starts at a new base pointer. so we have to
-      // shift every offset down by the point (in chars) at which it was split.
-      offsets_out[index] = offsets_in[index] - offset_shift;
+  // the descriptor of this block is the last one starting at or before it
+  auto const desc_idx = thrust::upper_bound(thrust::seq,
+                                            block_offsets,
+                                            block_offsets + num_descriptors,
+                                            static_cast<size_type>(blockIdx.x)) -
+                        block_offsets - 1;
+  auto const desc  = descriptors[desc_idx];
+  auto const begin = static_cast<size_t>(blockIdx.x - block_offsets[desc_idx]) * units_per_block;
+  auto const end   = thrust::min(begin + units_per_block, desc.size);
+
+  // the kind is the same for the whole block
+  switch (desc.kind) {
+    case copy_kind::BYTES: copy_bytes(desc, begin, end); break;
+    case copy_kind::OFFSETS: copy_offsets(desc, begin, end); break;
+    case copy_kind::VALIDITY: {
+      using BlockReduce = cub::BlockReduce<size_type, copy_block_size>;
+      __shared__ typename BlockReduce::TempStorage temp_storage;
+      size_type const block_valid =
+        BlockReduce(temp_storage).Sum(copy_validity(desc, begin, end));
+      if (threadIdx.x == 0) { atomicAdd(&valid_counts[desc_idx], block_valid); }
+      break;
     }
-
-    // if we're still in range of validity at all
-    if (has_validity && warp_cur <= validity_warp_end) {
-      bool valid = (index < validity_end) && bit_is_set(validity_in, validity_in_offset + index);
-
-      // the final validity mask for this warp
-      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid);
-      // only one guy in the warp needs to update the mask and count
-      if (lane_id == 0) { validity_out[warp_cur] = warp_mask; }
-    }
-
-    // next grid
-    warp_cur += warps_per_grid;
-    index += block_size * gridDim.x;
   }
 }
 
-// align all column size allocations to this boundary so that all output column buffers
-// start at that alignment.
-static constexpr size_t split_align = 64;
-
 /**
  * @brief Information about the split for a given column. Bundled together
  *        into a struct because tuples were getting pretty unreadable.
@@ -179,272 +160,206 @@ struct column_split_info {
   size_t offsets_buf_size;  // (strings only) size of offset column (including padding)
   size_type num_chars;      // (strings only) number of chars in the column
   size_type chars_offset;   // (strings only) offset from head of chars data
-};
 
-/**
- * @brief Functor called by the `type_dispatcher` to incrementally compute total
- * memory buffer size needed to allocate a contiguous copy of all columns within
- * a source table.
- */
-struct column_buffer_size_functor {
-  template <typename T>
-  size_t operator()(column_view const& c, column_split_info& split_info)
-  {
-    split_info.data_buf_size = cudf::util::round_up_safe(c.size() * sizeof(T), split_align);
-    split_info.validity_buf_size =
-      (c.has_nulls() ? cudf::bitmask_allocation_size_bytes(c.size(), split_align) : 0);
-    return split_info.data_buf_size + split_info.validity_buf_size;
-  }
+  char* data;                // output data, or chars for strings
+  bitmask_type* validity;    // output validity, nullptr if not copied
+  size_type* offsets;        // (strings only) output offsets
+  size_type validity_index;  // index of the validity copy_descriptor, -1 if not copied
 };
-template <>
-size_t column_buffer_size_functor::operator()<string_view>(column_view const& c,
-                                                           column_split_info& split_info)
-{
-  // this has already been precomputed in an earlier step. return the sum.
-  return split_info.data_buf_size + split_info.validity_buf_size + split_info.offsets_buf_size;
-}
 
 /**
- * @brief Functor called by the `type_dispatcher` to copy a column into a contiguous
- * buffer of output memory.
+ * @brief Computes the buffer sizes of every column of every split, indexed by
+ * `split * num_columns + column`.
  *
- * Used for copying each column in a source table into one contiguous buffer of memory.
+ * The chars ranges of all the strings columns of all the splits are read from the device with a
+ * single transform and a single copy to the host.
  */
-struct column_copy_functor {
-  template <typename T>
-  void operator()(column_view const& in,
-                  column_split_info const& split_info,
-                  char*& dst,
-                  std::vector<column_view>& out_cols)
-  {
-    // outgoing pointers
-    char* data             = dst;
-    bitmask_type* validity = split_info.validity_buf_size == 0
-                               ? nullptr
-                               : reinterpret_cast<bitmask_type*>(dst + split_info.data_buf_size);
-
-    // increment working buffer
-    dst += (split_info.data_buf_size + split_info.validity_buf_size);
-
-    // no work to do
-    if (in.size() == 0) {
-      out_cols.push_back(column_view{in.type(), 0, nullptr});
-      return;
-    }
-
-    // custom copy kernel (which could probably just be an in-place copy() function in cudf).
-    cudf::size_type num_els  = cudf::util::round_up_safe(in.size(), cudf::detail::warp_size);
-    constexpr int block_size = 256;
-    cudf::detail::grid_1d grid{num_els, block_size, 1};
-
-    // output copied column
-    mutable_column_view mcv{in.type(), in.size(), data, validity, in.null_count()};
-    if (in.has_nulls()) {
-      copy_in_place_kernel<block_size, T, true><<<grid.num_blocks, block_size, 0, 0>>>(
-        *column_device_view::create(in), *mutable_column_device_view::create(mcv));
-    } else {
-      copy_in_place_kernel<block_size, T, false><<<grid.num_blocks, block_size, 0, 0>>>(
-        *column_device_view::create(in), *mutable_column_device_view::create(mcv));
+std::vector<column_split_info> compute_split_info(std::vector<table_view> const& subtables,
+                                                  cudaStream_t stream)
+{
+  std::vector<column_split_info> split_info;
+  // the offsets of the first row and the number of rows of every strings column
+  std::vector<thrust::pair<size_type const*, size_type>> string_rows;
+  std::vector<size_t> string_indices;
+  for (auto const& t : subtables) {
+    for (auto const& c : t) {
+      column_split_info info{};
+      info.validity_index = -1;
+      if (c.type().id() == type_id::STRING) {
+        if (c.num_children() > 0) {
+          string_rows.emplace_back(strings_column_view(c).offsets().data<size_type>() + c.offset(),
+                                   c.size());
+          string_indices.push_back(split_info.size());
+        }
+      } else {
+        info.data_buf_size =
+          cudf::util::round_up_safe(c.size() * size_of(c.type()), split_align);
+      }
+      info.validity_buf_size =
+        c.nullable() ? cudf::bitmask_allocation_size_bytes(c.size(), split_align) : 0;
+      split_info.push_back(info);
     }
-
-    out_cols.push_back(mcv);
   }
-};
-template <>
-void column_copy_functor::operator()<string_view>(column_view const& in,
-                                                  column_split_info const& split_info,
-                                                  char*& dst,
-                                                  std::vector<column_view>& out_cols)
-{
-  // outgoing pointers
-  char* chars_buf            = dst;
-  bitmask_type* validity_buf = split_info.validity_buf_size == 0
-                                 ? nullptr
-                                 : reinterpret_cast<bitmask_type*>(dst + split_info.data_buf_size);
-  size_type* offsets_buf =
-    reinterpret_cast<size_type*>(dst + split_info.data_buf_size + split_info.validity_buf_size);
-
-  // increment working buffer
-  dst += (split_info.data_buf_size + split_info.validity_buf_size + split_info.offsets_buf_size);
-
-  // offsets column.
-  strings_column_view strings_c(in);
-  column_view in_offsets = strings_c.offsets();
-  // note, incoming columns are sliced, so their size is fundamentally different from their child
-  // offset columns, which are unsliced.
-  size_type num_offsets = in.size() + 1;
-  cudf::size_type num_threads =
-    cudf::util::round_up_safe(std::max(split_info.num_chars, num_offsets), cudf::detail::warp_size);
-  column_view in_chars = strings_c.chars();
-
-  // a column with no strings will still have a single offset.
-  CUDF_EXPECTS(num_offsets > 0, "Invalid offsets child column");
-
-  // 1 combined kernel call that copies chars, offsets and validity in one pass. see notes on why
-  // this exists in the kernel brief.
-  constexpr int block_size = 256;
-  cudf::detail::grid_1d grid{num_threads, block_size, 1};
-  if (in.has_nulls()) {
-    copy_in_place_strings_kernel<block_size, true><<<grid.num_blocks, block_size, 0, 0>>>(
-      in.size(),                                        // num_rows
-      in_offsets.head<size_type>() + in.offset(),       // offsets_in
-      offsets_buf,                                      // offsets_out
-      in.offset(),                                      // validity_in_offset
-      in.null_mask(),                                   // validity_in
-      validity_buf,                                     // validity_out
-      split_info.chars_offset,                          // offset_shift
-      split_info.num_chars,                             // num_chars
-      in_chars.head<char>() + split_info.chars_offset,  // chars_in
-      chars_buf);
-  } else {
-    copy_in_place_strings_kernel<block_size, false><<<grid.num_blocks, block_size, 0, 0>>>(
-      in.size(),                                        // num_rows
-      in_offsets.head<size_type>() + in.offset(),       // offsets_in
-      offsets_buf,                                      // offsets_out
-      0,                                                // validity_in_offset
-      nullptr,                                          // validity_in
-      nullptr,                                          // validity_out
-      split_info.chars_offset,                          // offset_shift
-      split_info.num_chars,                             // num_chars
-      in_chars.head<char>() + split_info.chars_offset,  // chars_in
-      chars_buf);
+  if (string_rows.empty()) { return split_info; }
+
+  rmm::device_buffer d_string_rows(
+    string_rows.data(), string_rows.size() * sizeof(string_rows.front()), stream);
+  rmm::device_vector<thrust::pair<size_type, size_type>> d_chars_ranges(string_rows.size());
+  auto const d_rows_begin =
+    static_cast<thrust::pair<size_type const*, size_type> const*>(d_string_rows.data());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    d_rows_begin,
+                    d_rows_begin + string_rows.size(),
+                    d_chars_ranges.begin(),
+                    [] __device__(thrust::pair<size_type const*, size_type> const& rows) {
+                      return thrust::make_pair(rows.first[0], rows.first[rows.second]);
+                    });
+  std::vector<thrust::pair<size_type, size_type>> chars_ranges(string_rows.size());
+  CUDA_TRY(cudaMemcpyAsync(chars_ranges.data(),
+                           d_chars_ranges.data().get(),
+                           chars_ranges.size() * sizeof(chars_ranges.front()),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  for (size_t idx = 0; idx < string_indices.size(); ++idx) {
+    auto& info        = split_info[string_indices[idx]];
+    auto const rows   = string_rows[idx].second;
+    info.num_chars    = chars_ranges[idx].second - chars_ranges[idx].first;
+    info.chars_offset = chars_ranges[idx].first;
+    info.data_buf_size =
+      cudf::util::round_up_safe(static_cast<size_t>(info.num_chars), split_align);
+    info.offsets_buf_size = cudf::util::round_up_safe((rows + 1) * sizeof(size_type), split_align);
   }
-
-  // output child columns
-  column_view out_offsets{in_offsets.type(), num_offsets, offsets_buf};
-  column_view out_chars{in_chars.type(), static_cast<size_type>(split_info.num_chars), chars_buf};
-
-  // result
-  out_cols.push_back(column_view(
-    in.type(), in.size(), nullptr, validity_buf, in.null_count(), 0, {out_offsets, out_chars}));
+  return split_info;
 }
 
 /**
- * @brief Information about a string column in a table view.
- *
- * Used internally by preprocess_string_column_info as part of a device-accessible
- * vector for computing final string information in a single kernel call.
+ * @brief Assigns the output buffers of the columns of `t` in `dst`, and appends the copies
+ * filling them to `descriptors`.
  */
-struct column_preprocess_info {
-  size_type index;
-  size_type offset;
-  size_type size;
-  bool has_nulls;
-  cudf::column_device_view offsets;
-};
-
-/**
- * @brief Preprocess information about all strings columns in a table view.
- *
- * In order to minimize how often we touch the gpu, we need to preprocess various pieces of
- * information about the string columns in a table as a batch process.  This function builds a list
- * of the offset columns for all input string columns and computes this information with a single
- * thrust call.  In addition, the vector returned is allocated for -all- columns in the table so
- * further processing of non-string columns can happen afterwards.
- *
- * The key things this function avoids
- * - avoiding reaching into gpu memory on the cpu to retrieve offsets to compute string sizes.
- * - creating column_device_views on the base string_column_view itself as that causes gpu memory
- * allocation.
- */
-thrust::host_vector<column_split_info> preprocess_string_column_info(
-  cudf::table_view const& t,
-  rmm::device_vector<column_split_info>& device_split_info,
-  cudaStream_t stream)
+void add_copies(table_view const& t,
+                column_split_info* split_info,
+                char* dst,
+                std::vector<copy_descriptor>& descriptors)
 {
-  // build a list of all the offset columns and their indices for all input string columns and put
-  // them on the gpu
-  thrust::host_vector<column_preprocess_info> offset_columns;
-  offset_columns.reserve(t.num_columns());  // worst case
-
-  // collect only string columns
-  size_type column_index = 0;
-  std::for_each(t.begin(), t.end(), [&offset_columns, &column_index](cudf::column_view const& c) {
+  for (auto const& c : t) {
+    auto& info    = *split_info++;
+    info.data     = dst;
+    info.validity = info.validity_buf_size == 0
+                      ? nullptr
+                      : reinterpret_cast<bitmask_type*>(dst + info.data_buf_size);
+    info.offsets =
+      info.offsets_buf_size == 0
+        ? nullptr
+        : reinterpret_cast<size_type*>(dst + info.data_buf_size + info.validity_buf_size);
+    dst += info.data_buf_size + info.validity_buf_size + info.offsets_buf_size;
+
     if (c.type().id() == type_id::STRING) {
-      cudf::column_device_view cdv((strings_column_view(c)).offsets(), 0, 0);
-      offset_columns.push_back(
-        column_preprocess_info{column_index, c.offset(), c.size(), c.has_nulls(), cdv});
+      if (info.num_chars > 0) {
+        strings_column_view strings_c(c);
+        descriptors.push_back({copy_kind::BYTES,
+                               strings_c.chars().data<char>() + info.chars_offset,
+                               info.data,
+                               static_cast<size_t>(info.num_chars),
+                               0,
+                               0});
+      }
+      if (info.offsets != nullptr) {
+        // note, incoming columns are sliced, so their size is fundamentally different from their
+        // child offset columns, which are unsliced.
+        descriptors.push_back({copy_kind::OFFSETS,
+                               strings_column_view(c).offsets().data<size_type>() + c.offset(),
+                               info.offsets,
+                               static_cast<size_t>(c.size()) + 1,
+                               info.chars_offset,
+                               0});
+      }
+    } else if (c.size() > 0) {
+      auto const element_size = size_of(c.type());
+      descriptors.push_back({copy_kind::BYTES,
+                             c.head<char>() + c.offset() * element_size,
+                             info.data,
+                             c.size() * element_size,
+                             0,
+                             0});
     }
-    column_index++;
-  });
-  rmm::device_vector<column_preprocess_info> device_offset_columns = offset_columns;
-
-  // compute column split information
-  rmm::device_vector<thrust::pair<size_type, size_type>> device_offsets(t.num_columns());
-  auto* offsets_p = device_offsets.data().get();
-  thrust::for_each(rmm::exec_policy(stream)->on(stream),
-                   device_offset_columns.begin(),
-                   device_offset_columns.end(),
-                   [offsets_p] __device__(column_preprocess_info const& cpi) {
-                     offsets_p[cpi.index] =
-                       thrust::make_pair(cpi.offsets.head<int32_t>()[cpi.offset],
-                                         cpi.offsets.head<int32_t>()[cpi.offset + cpi.size]);
-                   });
-  thrust::host_vector<thrust::pair<size_type, size_type>> host_offsets(device_offsets);
-  thrust::host_vector<column_split_info> split_info(t.num_columns());
-  std::for_each(offset_columns.begin(),
-                offset_columns.end(),
-                [&split_info, &host_offsets](column_preprocess_info const& cpi) {
-                  int32_t offset_start = host_offsets[cpi.index].first;
-                  int32_t offset_end   = host_offsets[cpi.index].second;
-                  auto num_chars       = offset_end - offset_start;
-                  split_info[cpi.index].data_buf_size =
-                    cudf::util::round_up_safe(static_cast<size_t>(num_chars), split_align);
-                  split_info[cpi.index].validity_buf_size =
-                    cpi.has_nulls ? cudf::bitmask_allocation_size_bytes(cpi.size, split_align) : 0;
-                  split_info[cpi.index].offsets_buf_size =
-                    cudf::util::round_up_safe((cpi.size + 1) * sizeof(size_type), split_align);
-                  split_info[cpi.index].num_chars    = num_chars;
-                  split_info[cpi.index].chars_offset = offset_start;
-                });
-  return split_info;
+    if (info.validity != nullptr and c.size() > 0) {
+      info.validity_index = static_cast<size_type>(descriptors.size());
+      descriptors.push_back({copy_kind::VALIDITY,
+                             c.null_mask(),
+                             info.validity,
+                             static_cast<size_t>(num_bitmask_words(c.size())),
+                             c.offset(),
+                             c.size()});
+    }
+  }
 }
 
 /**
- * @brief Creates a contiguous_split_result object which contains a deep-copy of the input
- * table_view into a single contiguous block of memory.
- *
- * The table_view contained within the contiguous_split_result will pass an expect_tables_equal()
- * call with the input table.  The memory referenced by the table_view and its internal column_views
- * is entirely contained in single block of memory.
+ * @brief Launches one kernel copying all the described buffers and returns the number of valid
+ * rows of every validity descriptor.
  */
-contiguous_split_result alloc_and_copy(cudf::table_view const& t,
-                                       rmm::device_vector<column_split_info>& device_split_info,
-                                       rmm::mr::device_memory_resource* mr,
+std::vector<size_type> copy_partitions(std::vector<copy_descriptor> const& descriptors,
                                        cudaStream_t stream)
 {
-  // preprocess column split information for string columns.
-  thrust::host_vector<column_split_info> split_info =
-    preprocess_string_column_info(t, device_split_info, stream);
-
-  // compute the rest of the column sizes (non-string columns, and total buffer size)
-  size_t total_size      = 0;
-  size_type column_index = 0;
-  std::for_each(
-    t.begin(), t.end(), [&total_size, &column_index, &split_info](cudf::column_view const& c) {
-      total_size +=
-        cudf::type_dispatcher(c.type(), column_buffer_size_functor{}, c, split_info[column_index]);
-      column_index++;
-    });
-
-  // allocate
-  auto device_buf = std::make_unique<rmm::device_buffer>(total_size, stream, mr);
-  char* buf       = static_cast<char*>(device_buf->data());
-
-  // copy (this would be cleaner with a std::transform, but there's an nvcc compiler issue in the
-  // way)
-  std::vector<column_view> out_cols;
-  out_cols.reserve(t.num_columns());
-
-  column_index = 0;
-  std::for_each(
-    t.begin(), t.end(), [&out_cols, &buf, &column_index, &split_info](cudf::column_view const& c) {
-      cudf::type_dispatcher(
-        c.type(), column_copy_functor{}, c, split_info[column_index], buf, out_cols);
-      column_index++;
-    });
-
-  return contiguous_split_result{cudf::table_view{out_cols}, std::move(device_buf)};
+  std::vector<size_type> valid_counts(descriptors.size());
+  if (descriptors.empty()) { return valid_counts; }
+
+  std::vector<size_type> block_offsets;
+  block_offsets.reserve(descriptors.size());
+  size_type num_blocks = 0;
+  for (auto const& desc : descriptors) {
+    block_offsets.push_back(num_blocks);
+    num_blocks +=
+      static_cast<size_type>(cudf::util::div_rounding_up_safe(desc.size, units_per_block));
+  }
+
+  rmm::device_buffer d_descriptors(
+    descriptors.data(), descriptors.size() * sizeof(copy_descriptor), stream);
+  rmm::device_buffer d_block_offsets(
+    block_offsets.data(), block_offsets.size() * sizeof(size_type), stream);
+  rmm::device_buffer d_valid_counts(valid_counts.size() * sizeof(size_type), stream);
+  CUDA_TRY(cudaMemsetAsync(d_valid_counts.data(), 0, d_valid_counts.size(), stream));
+
+  copy_partitions_kernel<<<num_blocks, copy_block_size, 0, stream>>>(
+    static_cast<copy_descriptor const*>(d_descriptors.data()),
+    static_cast<size_type>(descriptors.size()),
+    static_cast<size_type const*>(d_block_offsets.data()),
+    static_cast<size_type*>(d_valid_counts.data()));
+  CHECK_CUDA(stream);
+
+  CUDA_TRY(cudaMemcpyAsync(valid_counts.data(),
+                           d_valid_counts.data(),
+                           d_valid_counts.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return valid_counts;
+}
+
+/**
+ * @brief Returns the view of the copy of `c` described by `info`.
+ */
+column_view make_output_column(column_view const& c,
+                               column_split_info const& info,
+                               std::vector<size_type> const& valid_counts)
+{
+  auto const null_count =
+    info.validity_index < 0 ? 0 : c.size() - valid_counts[info.validity_index];
+  auto const validity = null_count > 0 ? info.validity : nullptr;
+
+  if (c.type().id() == type_id::STRING) {
+    std::vector<column_view> children;
+    if (info.offsets != nullptr) {
+      children.emplace_back(data_type{type_id::INT32}, c.size() + 1, info.offsets);
+      children.emplace_back(data_type{type_id::INT8}, info.num_chars, info.data);
+    }
+    return column_view(c.type(), c.size(), nullptr, validity, null_count, 0, children);
+  }
+  // no work to do
+  if (c.size() == 0) { return column_view{c.type(), 0, nullptr}; }
+  return column_view{c.type(), c.size(), info.data, validity, null_count};
 }
 
 };  // anonymous namespace
@@ -454,25 +369,49 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
                                                       rmm::mr::device_memory_resource* mr,
                                                       cudaStream_t stream)
 {
-  auto subtables = cudf::split(input, splits);
+  CUDF_EXPECTS(std::all_of(input.begin(),
+                           input.end(),
+                           [](column_view const& c) {
+                             return is_fixed_width(c.type()) or c.type().id() == type_id::STRING;
+                           }),
+               "contiguous_split supports only fixed-width and strings columns");
+  auto const subtables   = cudf::split(input, splits);
+  auto const num_columns = static_cast<size_t>(input.num_columns());
+
+  // optimization : for large numbers of splits, launching kernels per split and per column
+  //                dominates the total time. so every buffer of every split is described
+  //                up front and copied by a single kernel.
+  auto split_info = compute_split_info(subtables, stream);
+
+  std::vector<std::unique_ptr<rmm::device_buffer>> buffers;
+  std::vector<copy_descriptor> descriptors;
+  for (size_t split = 0; split < subtables.size(); ++split) {
+    auto const info  = split_info.begin() + split * num_columns;
+    auto const total = std::accumulate(
+      info, info + num_columns, size_t{0}, [](size_t sum, column_split_info const& i) {
+        return sum + i.data_buf_size + i.validity_buf_size + i.offsets_buf_size;
+      });
+    buffers.push_back(std::make_unique<rmm::device_buffer>(total, stream, mr));
+    add_copies(subtables[split],
+               split_info.data() + split * num_columns,
+               static_cast<char*>(buffers.back()->data()),
+               descriptors);
+  }
 
-  // optimization : for large numbers of splits this allocation can dominate total time
-  //                spent if done inside alloc_and_copy().  so we'll allocate it once
-  //                and reuse it.
-  //
-  //                benchmark:        1 GB data, 10 columns, 256 splits.
-  //                no optimization:  106 ms (8 GB/s)
-  //                optimization:     20 ms (48 GB/s)
-  rmm::device_vector<column_split_info> device_split_info(input.num_columns());
+  auto const valid_counts = copy_partitions(descriptors, stream);
 
   std::vector<contiguous_split_result> result;
-  std::transform(subtables.begin(),
-                 subtables.end(),
-                 std::back_inserter(result),
-                 [mr, stream, &device_split_info](table_view const& t) {
-                   return alloc_and_copy(t, device_split_info, mr, stream);
-                 });
-
+  for (size_t split = 0; split < subtables.size(); ++split) {
+    std::vector<column_view> out_cols;
+    out_cols.reserve(num_columns);
+    for (size_t col = 0; col < num_columns; ++col) {
+      out_cols.push_back(make_output_column(subtables[split].column(col),
+                                            split_info[split * num_columns + col],
+                                            valid_counts));
+    }
+    result.push_back(
+      contiguous_split_result{cudf::table_view{out_cols}, std::move(buffers[split])});
+  }
   return result;
 }
 
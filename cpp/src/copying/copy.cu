@@ -19,9 +19,20 @@
 #include <cudf/detail/copy_if_else.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 #include "cudf/fixed_point/fixed_point.hpp"
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -237,8 +248,246 @@ std::unique_ptr<column> copy_if_else(Left const& lhs,
   }
 }
 
+// selects the rows whose bit is set in `filter_mask` from lhs, and the others from rhs
+template <typename Left, typename Right>
+std::unique_ptr<column> copy_if_else(Left const& lhs,
+                                     Right const& rhs,
+                                     bool left_nullable,
+                                     bool right_nullable,
+                                     bitmask_type const* filter_mask,
+                                     size_type size,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  auto filter = [filter_mask] __device__(cudf::size_type i) { return bit_is_set(filter_mask, i); };
+  return cudf::type_dispatcher(lhs.type(),
+                               copy_if_else_functor{},
+                               lhs,
+                               rhs,
+                               size,
+                               left_nullable,
+                               right_nullable,
+                               filter,
+                               mr,
+                               stream);
+}
+
+/**
+ * @brief Converts a boolean mask column to a bitmask whose bit `i` is set where element `i` is
+ * valid and true.
+ */
+rmm::device_buffer make_filter_mask(column_view const& boolean_mask, cudaStream_t stream)
+{
+  auto d_mask = column_device_view::create(boolean_mask, stream);
+  return cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                thrust::make_counting_iterator<size_type>(boolean_mask.size()),
+                                [d_mask = *d_mask] __device__(size_type i) {
+                                  return d_mask.is_valid(i) and d_mask.element<bool>(i);
+                                },
+                                stream)
+    .first;
+}
+
+/**
+ * @brief Selects every element of all output columns from either the lhs or the rhs column.
+ *
+ * Every `blockIdx.y` processes one column, whose elements are copied by their width in bytes
+ * as given by `widths`. As in `copy_if_else_kernel`, every warp writes whole words of the output
+ * null mask, and the valid elements of column `c` are counted in `valid_counts[c]`.
+ */
+template <size_type block_size>
+__launch_bounds__(block_size) __global__
+  void copy_if_else_table_kernel(table_device_view lhs,
+                                 table_device_view rhs,
+                                 bitmask_type const* __restrict__ filter_mask,
+                                 size_type const* __restrict__ widths,
+                                 mutable_table_device_view out,
+                                 size_type* __restrict__ valid_counts)
+{
+  auto const col      = blockIdx.y;
+  auto const& left    = lhs.column(col);
+  auto const& right   = rhs.column(col);
+  auto& output        = out.column(col);
+  auto const width    = widths[col];
+  auto const nullable = output.nullable();
+
+  const size_type tid            = threadIdx.x + blockIdx.x * block_size;
+  const int warp_id              = tid / warp_size;
+  const size_type warps_per_grid = gridDim.x * block_size / warp_size;
+  const size_type size           = output.size();
+  const size_type warp_end       = cudf::word_index(size - 1);
+  constexpr size_type leader_lane{0};
+  const int lane_id = threadIdx.x % warp_size;
+
+  size_type warp_valid_count{0};
+  size_type warp_cur = warp_id;
+  size_type index    = tid;
+  while (warp_cur <= warp_end) {
+    bool const in_range = index < size;
+    bool valid          = false;
+    if (in_range) {
+      auto const& source = bit_is_set(filter_mask, index) ? left : right;
+      switch (width) {
+        case 1: output.data<uint8_t>()[index] = source.data<uint8_t>()[index]; break;
+        case 2: output.data<uint16_t>()[index] = source.data<uint16_t>()[index]; break;
+        case 4: output.data<uint32_t>()[index] = source.data<uint32_t>()[index]; break;
+        default: output.data<uint64_t>()[index] = source.data<uint64_t>()[index]; break;
+      }
+      valid = source.is_valid(index);
+    }
+
+    if (nullable) {
+      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid);
+      if (lane_id == leader_lane) {
+        output.set_mask_word(warp_cur, warp_mask);
+        warp_valid_count += __popc(warp_mask);
+      }
+    }
+
+    warp_cur += warps_per_grid;
+    index += block_size * gridDim.x;
+  }
+
+  if (nullable) {
+    size_type block_valid_count =
+      single_lane_block_sum_reduce<block_size, leader_lane>(warp_valid_count);
+    if (threadIdx.x == 0) { atomicAdd(&valid_counts[col], block_valid_count); }
+  }
+}
+
+/**
+ * @brief Returns true if the column is copied by `copy_if_else_table_kernel`
+ */
+bool is_copied_by_width(data_type type)
+{
+  return is_fixed_width(type) and not is_fixed_point(type) and size_of(type) <= 8;
+}
+
 };  // namespace
 
+std::unique_ptr<table> copy_if_else(table_view const& lhs,
+                                    table_view const& rhs,
+                                    column_view const& boolean_mask,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  CUDF_EXPECTS(lhs.num_columns() == rhs.num_columns(),
+               "Both tables must have the same number of columns");
+  CUDF_EXPECTS(lhs.num_rows() == rhs.num_rows(), "Both tables must be of the same size");
+  CUDF_EXPECTS(boolean_mask.size() == lhs.num_rows(),
+               "Boolean mask column must be the same size as lhs and rhs tables");
+  CUDF_EXPECTS(boolean_mask.type() == data_type(type_id::BOOL8),
+               "Boolean mask column must be of type type_id::BOOL8");
+  CUDF_EXPECTS(std::equal(lhs.begin(),
+                          lhs.end(),
+                          rhs.begin(),
+                          [](auto const& l, auto const& r) { return l.type() == r.type(); }),
+               "Both inputs must be of the same type");
+
+  if (lhs.num_rows() == 0) { return empty_like(lhs); }
+
+  // the mask is read once, as bits, for all the columns
+  auto const size        = lhs.num_rows();
+  auto const filter_mask = make_filter_mask(boolean_mask, stream);
+  auto const d_filter    = static_cast<bitmask_type const*>(filter_mask.data());
+
+  std::vector<std::unique_ptr<column>> out_columns(lhs.num_columns());
+  std::vector<column_view> fixed_lhs, fixed_rhs;
+  std::vector<mutable_column_view> fixed_out;
+  std::vector<size_type> widths;
+  for (size_type c = 0; c < lhs.num_columns(); ++c) {
+    auto const nullable = lhs.column(c).has_nulls() or rhs.column(c).has_nulls();
+    if (is_copied_by_width(lhs.column(c).type())) {
+      out_columns[c] = make_fixed_width_column(lhs.column(c).type(),
+                                               size,
+                                               nullable ? mask_state::UNINITIALIZED
+                                                        : mask_state::UNALLOCATED,
+                                               stream,
+                                               mr);
+      fixed_lhs.push_back(lhs.column(c));
+      fixed_rhs.push_back(rhs.column(c));
+      fixed_out.push_back(out_columns[c]->mutable_view());
+      widths.push_back(static_cast<size_type>(size_of(lhs.column(c).type())));
+    } else {
+      out_columns[c] = copy_if_else(*column_device_view::create(lhs.column(c), stream),
+                                    *column_device_view::create(rhs.column(c), stream),
+                                    lhs.column(c).has_nulls(),
+                                    rhs.column(c).has_nulls(),
+                                    d_filter,
+                                    size,
+                                    mr,
+                                    stream);
+    }
+  }
+
+  if (not fixed_out.empty()) {
+    auto const num_fixed = static_cast<size_type>(fixed_out.size());
+    auto d_lhs           = table_device_view::create(table_view{fixed_lhs}, stream);
+    auto d_rhs           = table_device_view::create(table_view{fixed_rhs}, stream);
+    auto d_out           = mutable_table_device_view::create(mutable_table_view{fixed_out}, stream);
+    rmm::device_vector<size_type> d_widths(widths);
+    rmm::device_vector<size_type> valid_counts(num_fixed, 0);
+
+    constexpr int block_size = 256;
+    cudf::detail::grid_1d grid{cudf::util::round_up_safe(size, warp_size), block_size, 1};
+    dim3 const blocks(grid.num_blocks, num_fixed);
+    copy_if_else_table_kernel<block_size><<<blocks, block_size, 0, stream>>>(
+      *d_lhs, *d_rhs, d_filter, d_widths.data().get(), *d_out, valid_counts.data().get());
+
+    std::vector<size_type> h_valid_counts(num_fixed);
+    CUDA_TRY(cudaMemcpyAsync(h_valid_counts.data(),
+                             valid_counts.data().get(),
+                             num_fixed * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    size_type fixed = 0;
+    for (auto& out_column : out_columns) {
+      if (not is_copied_by_width(out_column->type())) { continue; }
+      if (out_column->nullable()) { out_column->set_null_count(size - h_valid_counts[fixed]); }
+      ++fixed;
+    }
+  }
+
+  return std::make_unique<table>(std::move(out_columns));
+}
+
+std::unique_ptr<table> copy_if_else(std::vector<std::reference_wrapper<scalar>> const& lhs,
+                                    table_view const& rhs,
+                                    column_view const& boolean_mask,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  CUDF_EXPECTS(boolean_mask.type() == data_type(type_id::BOOL8),
+               "Boolean mask column must be of type type_id::BOOL8");
+  CUDF_EXPECTS(boolean_mask.size() == rhs.num_rows(),
+               "Boolean mask column must be the same size as rhs table");
+  if (rhs.num_rows() == 0) { return empty_like(rhs); }
+
+  // the mask is read once, as bits, for all the columns
+  auto const filter_mask = make_filter_mask(boolean_mask, stream);
+  auto const d_filter    = static_cast<bitmask_type const*>(filter_mask.data());
+
+  std::vector<std::unique_ptr<column>> out_columns(rhs.num_columns());
+  std::transform(lhs.begin(),
+                 lhs.end(),
+                 rhs.begin(),
+                 out_columns.begin(),
+                 [&](auto const& scalar, auto const& rhs_column) {
+                   CUDF_EXPECTS(scalar.get().type() == rhs_column.type(),
+                                "Both inputs must be of the same type");
+                   return copy_if_else(scalar.get(),
+                                       *column_device_view::create(rhs_column, stream),
+                                       !scalar.get().is_valid(),
+                                       rhs_column.has_nulls(),
+                                       d_filter,
+                                       rhs.num_rows(),
+                                       mr,
+                                       stream);
+                 });
+  return std::make_unique<table>(std::move(out_columns));
+}
+
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
                                      column_view const& rhs,
                                      column_view const& boolean_mask,
@@ -338,4 +587,13 @@ std::unique_ptr<column> copy_if_else(scalar const& lhs,
   return detail::copy_if_else(lhs, rhs, boolean_mask, mr);
 }
 
+std::unique_ptr<table> copy_if_else(table_view const& lhs,
+                                    table_view const& rhs,
+                                    column_view const& boolean_mask,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr);
+}
+
 }  // namespace cudf
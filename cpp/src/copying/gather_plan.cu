@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/count.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Converts the indices of a gather map to `size_type`, with the negative indices counted
+ * from the end and every out of bounds index replaced by `source_rows`.
+ */
+struct normalize_map_fn {
+  template <typename map_type, std::enable_if_t<is_index_type<map_type>()>* = nullptr>
+  void operator()(column_view const& gather_map,
+                  size_type source_rows,
+                  size_type* output,
+                  cudaStream_t stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      gather_map.begin<map_type>(),
+                      gather_map.end<map_type>(),
+                      output,
+                      [source_rows] __device__(map_type index) {
+                        auto row = static_cast<int64_t>(index);
+                        if (row < 0) { row += source_rows; }
+                        return (row < 0 or row >= source_rows) ? source_rows
+                                                               : static_cast<size_type>(row);
+                      });
+  }
+
+  template <typename map_type, std::enable_if_t<not is_index_type<map_type>()>* = nullptr>
+  void operator()(column_view const&, size_type, size_type*, cudaStream_t) const
+  {
+    CUDF_FAIL("Gather map must be an integral type.");
+  }
+};
+
+/**
+ * @brief The source and target data of a fixed-width column gathered by
+ * `gather_fixed_width_kernel`
+ */
+struct gather_column_info {
+  void const* source;
+  void* target;
+  size_type element_size;
+};
+
+template <typename T>
+__device__ inline void gather_element(gather_column_info const& info,
+                                      size_type source_row,
+                                      size_type target_row)
+{
+  static_cast<T*>(info.target)[target_row] = static_cast<T const*>(info.source)[source_row];
+}
+
+/**
+ * @brief Gathers the rows of all the fixed-width columns of a table.
+ *
+ * Every thread copies one row of every column, so the writes to each column are coalesced.
+ *
+ * @tparam nullify_out_of_bounds Whether rows with out of bounds indices are skipped, to be
+ * nullified by the null mask gather
+ */
+template <bool nullify_out_of_bounds>
+__global__ void gather_fixed_width_kernel(gather_column_info const* __restrict__ columns,
+                                          size_type num_columns,
+                                          size_type const* __restrict__ gather_map,
+                                          size_type num_rows,
+                                          size_type source_rows)
+{
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < num_rows;
+       row += blockDim.x * gridDim.x) {
+    auto const source_row = gather_map[row];
+    if (nullify_out_of_bounds and source_row >= source_rows) { continue; }
+    for (size_type col = 0; col < num_columns; ++col) {
+      auto const info = columns[col];
+      switch (info.element_size) {
+        case 1: gather_element<uint8_t>(info, source_row, row); break;
+        case 2: gather_element<uint16_t>(info, source_row, row); break;
+        case 4: gather_element<uint32_t>(info, source_row, row); break;
+        case 8: gather_element<uint64_t>(info, source_row, row); break;
+        default:
+          for (size_type byte = 0; byte < info.element_size; ++byte) {
+            static_cast<char*>(info.target)[row * info.element_size + byte] =
+              static_cast<char const*>(info.source)[source_row * info.element_size + byte];
+          }
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace detail
+
+struct gather_plan::gather_plan_impl {
+  gather_plan_impl(column_view const& gather_map,
+                   size_type source_rows,
+                   bool check_bounds,
+                   cudaStream_t stream = 0)
+    : _source_rows(source_rows)
+  {
+    CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
+    _map = make_numeric_column(
+      data_type{type_to_id<size_type>()}, gather_map.size(), mask_state::UNALLOCATED, stream);
+    auto const d_map = _map->mutable_view().data<size_type>();
+    cudf::type_dispatcher(
+      gather_map.type(), detail::normalize_map_fn{}, gather_map, source_rows, d_map, stream);
+
+    auto const out_of_bounds = thrust::count(
+      rmm::exec_policy(stream)->on(stream), d_map, d_map + gather_map.size(), source_rows);
+    CUDF_EXPECTS(not check_bounds or out_of_bounds == 0, "Index out of bounds.");
+    _nullify = out_of_bounds > 0;
+  }
+
+  std::unique_ptr<table> gather(table_view const& source_table,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream = 0) const
+  {
+    CUDF_EXPECTS(source_table.num_rows() == _source_rows,
+                 "Mismatch between the number of rows of the source table and the gather plan.");
+    auto const num_rows  = _map->size();
+    auto const map_begin = _map->view().begin<size_type>();
+
+    std::vector<std::unique_ptr<column>> destination_columns;
+    std::vector<detail::gather_column_info> fixed_width_columns;
+    for (auto const& source_column : source_table) {
+      if (is_fixed_width(source_column.type())) {
+        destination_columns.push_back(detail::allocate_like(
+          source_column, num_rows, mask_allocation_policy::NEVER, mr, stream));
+        auto const element_size = static_cast<size_type>(size_of(source_column.type()));
+        fixed_width_columns.push_back(
+          {source_column.head<char>() + source_column.offset() * element_size,
+           destination_columns.back()->mutable_view().head<char>(),
+           element_size});
+      } else {
+        destination_columns.push_back(cudf::type_dispatcher(source_column.type(),
+                                                            detail::column_gatherer{},
+                                                            source_column,
+                                                            map_begin,
+                                                            map_begin + num_rows,
+                                                            _nullify,
+                                                            stream,
+                                                            mr));
+      }
+    }
+
+    if (num_rows > 0 and not fixed_width_columns.empty()) {
+      constexpr size_type block_size = 256;
+      cudf::detail::grid_1d grid{num_rows, block_size};
+
+      rmm::device_buffer d_columns(fixed_width_columns.data(),
+                                   fixed_width_columns.size() * sizeof(detail::gather_column_info),
+                                   stream);
+      auto const d_columns_ptr = static_cast<detail::gather_column_info const*>(d_columns.data());
+      auto const num_columns   = static_cast<size_type>(fixed_width_columns.size());
+      if (_nullify) {
+        detail::gather_fixed_width_kernel<true><<<grid.num_blocks, block_size, 0, stream>>>(
+          d_columns_ptr, num_columns, map_begin, num_rows, _source_rows);
+      } else {
+        detail::gather_fixed_width_kernel<false><<<grid.num_blocks, block_size, 0, stream>>>(
+          d_columns_ptr, num_columns, map_begin, num_rows, _source_rows);
+      }
+      CHECK_CUDA(stream);
+    }
+
+    auto const op =
+      _nullify ? detail::gather_bitmask_op::NULLIFY : detail::gather_bitmask_op::DONT_CHECK;
+    detail::gather_bitmask(source_table, map_begin, destination_columns, op, mr, stream);
+
+    return std::make_unique<table>(std::move(destination_columns));
+  }
+
+ private:
+  std::unique_ptr<column> _map;  // normalized gather map
+  size_type _source_rows;
+  bool _nullify;  // whether the map has out of bounds indices
+};
+
+gather_plan::gather_plan(column_view const& gather_map, size_type source_rows, bool check_bounds)
+  : impl{std::make_unique<gather_plan_impl>(gather_map, source_rows, check_bounds)}
+{
+}
+
+gather_plan::~gather_plan() = default;
+
+std::unique_ptr<table> gather_plan::gather(table_view const& source_table,
+                                           rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->gather(source_table, mr);
+}
+
+}  // namespace cudf
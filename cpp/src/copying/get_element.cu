@@ -16,12 +16,23 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
 
 #include <cudf/detail/utilities/cuda.cuh>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 
@@ -61,8 +72,8 @@ struct get_element_functor {
   {
     auto device_col = column_device_view::create(input, stream);
 
-    rmm::device_scalar<string_view> temp_data;
-    rmm::device_scalar<bool> temp_valid;
+    rmm::device_scalar<string_view> temp_data(stream);
+    rmm::device_scalar<bool> temp_valid(stream);
 
     device_single_thread(
       [buffer   = temp_data.data(),
@@ -146,6 +157,16 @@ struct get_element_functor {
   }
 };
 
+void check_indices(column_view const &input, std::vector<size_type> const &indices)
+{
+  CUDF_EXPECTS(std::all_of(indices.begin(),
+                           indices.end(),
+                           [size = input.size()](size_type index) {
+                             return index >= 0 and index < size;
+                           }),
+               "Index out of bounds");
+}
+
 }  // namespace
 
 std::unique_ptr<scalar> get_element(column_view const &input,
@@ -157,6 +178,155 @@ std::unique_ptr<scalar> get_element(column_view const &input,
   return type_dispatcher(input.type(), get_element_functor{}, input, index, stream, mr);
 }
 
+namespace {
+
+struct get_elements_functor {
+  // The scalars are allocated first, then a single kernel copies every element into its scalar
+  template <typename T, std::enable_if_t<is_fixed_width<T>() && !is_fixed_point<T>()> *p = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const &input,
+                                                  std::vector<size_type> const &indices,
+                                                  cudaStream_t stream,
+                                                  rmm::mr::device_memory_resource *mr)
+  {
+    using ScalarType = cudf::scalar_type_t<T>;
+    std::vector<std::unique_ptr<scalar>> results;
+    thrust::host_vector<T *> h_values;
+    thrust::host_vector<bool *> h_validities;
+    for (size_t i = 0; i < indices.size(); ++i) {
+      results.push_back(make_fixed_width_scalar(data_type(type_to_id<T>()), stream, mr));
+      auto typed_s = static_cast<ScalarType *>(results.back().get());
+      h_values.push_back(typed_s->data());
+      h_validities.push_back(typed_s->validity_data());
+    }
+
+    rmm::device_vector<size_type> d_indices(indices.begin(), indices.end());
+    rmm::device_vector<T *> d_values(h_values);
+    rmm::device_vector<bool *> d_validities(h_validities);
+    auto device_col = column_device_view::create(input, stream);
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       indices.size(),
+                       [d_col        = *device_col,
+                        d_indices    = d_indices.data().get(),
+                        d_values     = d_values.data().get(),
+                        d_validities = d_validities.data().get()] __device__(size_type i) {
+                         auto const index = d_indices[i];
+                         *d_values[i]     = d_col.element<T>(index);
+                         *d_validities[i] = d_col.is_valid(index);
+                       });
+    return results;
+  }
+
+  // The strings are located with a single kernel and device-to-host copy, then each scalar
+  // copies its characters
+  template <typename T, std::enable_if_t<std::is_same<T, string_view>::value> *p = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const &input,
+                                                  std::vector<size_type> const &indices,
+                                                  cudaStream_t stream,
+                                                  rmm::mr::device_memory_resource *mr)
+  {
+    using element_type = thrust::pair<string_view, bool>;
+    rmm::device_vector<size_type> d_indices(indices.begin(), indices.end());
+    rmm::device_vector<element_type> d_elements(indices.size());
+    auto device_col = column_device_view::create(input, stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      d_indices.begin(),
+                      d_indices.end(),
+                      d_elements.begin(),
+                      [d_col = *device_col] __device__(size_type index) {
+                        return d_col.is_valid(index)
+                                 ? element_type{d_col.element<string_view>(index), true}
+                                 : element_type{string_view{}, false};
+                      });
+    thrust::host_vector<element_type> h_elements(indices.size());
+    CUDA_TRY(cudaMemcpyAsync(h_elements.data(),
+                             d_elements.data().get(),
+                             indices.size() * sizeof(element_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    std::vector<std::unique_ptr<scalar>> results;
+    for (auto const &element : h_elements) {
+      results.push_back(
+        std::make_unique<string_scalar>(element.first, element.second, stream, mr));
+    }
+    return results;
+  }
+
+  // The other types are read one element at a time
+  template <typename T,
+            std::enable_if_t<not(is_fixed_width<T>() && !is_fixed_point<T>()) &&
+                             !std::is_same<T, string_view>::value> *p = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const &input,
+                                                  std::vector<size_type> const &indices,
+                                                  cudaStream_t stream,
+                                                  rmm::mr::device_memory_resource *mr)
+  {
+    std::vector<std::unique_ptr<scalar>> results;
+    for (auto const index : indices) {
+      results.push_back(
+        type_dispatcher(input.type(), get_element_functor{}, input, index, stream, mr));
+    }
+    return results;
+  }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<scalar>> get_elements(column_view const &input,
+                                                  std::vector<size_type> const &indices,
+                                                  cudaStream_t stream,
+                                                  rmm::mr::device_memory_resource *mr)
+{
+  check_indices(input, indices);
+  if (indices.empty()) { return {}; }
+  return type_dispatcher(input.type(), get_elements_functor{}, input, indices, stream, mr);
+}
+
+template <typename T>
+std::pair<std::vector<T>, std::vector<bool>> get_elements_to_host(
+  column_view const &input, std::vector<size_type> const &indices, cudaStream_t stream)
+{
+  static_assert(is_fixed_width<T>() && !is_fixed_point<T>(), "Unexpected non fixed-width type.");
+  CUDF_EXPECTS(input.type() == data_type(type_to_id<T>()), "Type mismatch");
+  check_indices(input, indices);
+  auto const count = indices.size();
+  if (count == 0) { return {}; }
+
+  // the values followed by their validities, to be copied to the host at once
+  auto const values_size = count * sizeof(T);
+  rmm::device_vector<size_type> d_indices(indices.begin(), indices.end());
+  rmm::device_buffer d_elements(values_size + count * sizeof(bool), stream);
+  auto device_col = column_device_view::create(input, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    count,
+    [d_col        = *device_col,
+     d_indices    = d_indices.data().get(),
+     d_values     = static_cast<T *>(d_elements.data()),
+     d_validities = reinterpret_cast<bool *>(static_cast<char *>(d_elements.data()) +
+                                             values_size)] __device__(size_type i) {
+      auto const index = d_indices[i];
+      d_values[i]      = d_col.element<T>(index);
+      d_validities[i]  = d_col.is_valid(index);
+    });
+
+  std::vector<char> h_elements(d_elements.size());
+  CUDA_TRY(cudaMemcpyAsync(h_elements.data(),
+                           d_elements.data(),
+                           d_elements.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  auto const h_values     = reinterpret_cast<T const *>(h_elements.data());
+  auto const h_validities = reinterpret_cast<bool const *>(h_elements.data() + values_size);
+  return {std::vector<T>(h_values, h_values + count),
+          std::vector<bool>(h_validities, h_validities + count)};
+}
+
 }  // namespace detail
 
 std::unique_ptr<scalar> get_element(column_view const &input,
@@ -166,4 +336,46 @@ std::unique_ptr<scalar> get_element(column_view const &input,
   return detail::get_element(input, index, 0, mr);
 }
 
+std::vector<std::unique_ptr<scalar>> get_elements(column_view const &input,
+                                                  std::vector<size_type> const &indices,
+                                                  rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_elements(input, indices, 0, mr);
+}
+
+template <typename T>
+std::pair<std::vector<T>, std::vector<bool>> get_elements_to_host(
+  column_view const &input, std::vector<size_type> const &indices)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_elements_to_host<T>(input, indices, 0);
+}
+
+#define INSTANTIATE_GET_ELEMENTS_TO_HOST(T)                                          \
+  template std::pair<std::vector<T>, std::vector<bool>> get_elements_to_host<T>( \
+    column_view const &input, std::vector<size_type> const &indices);
+
+INSTANTIATE_GET_ELEMENTS_TO_HOST(int8_t)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(int16_t)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(int32_t)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(int64_t)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(uint8_t)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(uint16_t)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(uint32_t)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(uint64_t)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(float)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(double)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(bool)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(timestamp_D)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(timestamp_s)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(timestamp_ms)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(timestamp_us)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(timestamp_ns)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(duration_D)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(duration_s)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(duration_ms)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(duration_us)
+INSTANTIATE_GET_ELEMENTS_TO_HOST(duration_ns)
+
 }  // namespace cudf
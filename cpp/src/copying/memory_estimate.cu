@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/memory_estimate.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <climits>
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr std::size_t allocation_alignment{256};
+
+/**
+ * @brief Returns the size of the offsets child of a strings or lists column of `num_rows` rows
+ */
+std::size_t offsets_size(std::size_t num_rows)
+{
+  return allocation_size((num_rows + 1) * sizeof(size_type));
+}
+
+/**
+ * @brief Returns the size of the null mask of `num_rows` rows, which is padded to less than the
+ * allocation alignment
+ */
+std::size_t null_mask_size(std::size_t num_rows)
+{
+  return allocation_size((num_rows + CHAR_BIT - 1) / CHAR_BIT);
+}
+
+/**
+ * @brief Returns the range of the child rows of the rows of `input`, a strings or lists column
+ */
+std::pair<size_type, size_type> child_range(column_view const& input,
+                                            column_view const& offsets,
+                                            cudaStream_t stream)
+{
+  if (input.size() == 0) { return {0, 0}; }
+  return {get_value<size_type>(offsets, input.offset(), stream),
+          get_value<size_type>(offsets, input.offset() + input.size(), stream)};
+}
+
+/**
+ * @brief Returns the number of child rows of the largest row of `input`, a strings or lists column
+ */
+size_type largest_row_size(column_view const& input,
+                           column_view const& offsets,
+                           cudaStream_t stream)
+{
+  if (input.size() == 0) { return 0; }
+  auto const d_offsets = offsets.data<size_type>() + input.offset();
+  return thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(input.size()),
+    [d_offsets] __device__(size_type i) { return d_offsets[i + 1] - d_offsets[i]; },
+    size_type{0},
+    thrust::maximum<size_type>());
+}
+
+std::size_t gather_size_upper_bound(column_view const& input,
+                                    std::size_t num_rows,
+                                    bool nullable,
+                                    cudaStream_t stream)
+{
+  std::size_t size = (nullable || input.nullable()) ? null_mask_size(num_rows) : 0;
+  if (num_rows == 0) { return size; }
+  switch (input.type().id()) {
+    case type_id::STRING: {
+      auto const offsets = input.child(strings_column_view::offsets_column_index);
+      return size + offsets_size(num_rows) +
+             allocation_size(num_rows * largest_row_size(input, offsets, stream));
+    }
+    case type_id::LIST: {
+      lists_column_view const lists(input);
+      auto const largest = largest_row_size(input, lists.offsets(), stream);
+      return size + offsets_size(num_rows) +
+             gather_size_upper_bound(
+               lists.get_sliced_child(stream), num_rows * largest, false, stream);
+    }
+    case type_id::STRUCT:
+      for (size_type i = 0; i < input.num_children(); ++i) {
+        auto const child = slice(input.child(i), {input.offset(), input.offset() + input.size()});
+        size += gather_size_upper_bound(child.front(), num_rows, false, stream);
+      }
+      return size;
+    case type_id::DICTIONARY32: {
+      dictionary_column_view const dictionary(input);
+      // The gathered column keeps all the keys
+      return size + allocation_size(num_rows * size_of(dictionary.indices().type())) +
+             copy_size(dictionary.keys(), stream);
+    }
+    default:
+      CUDF_EXPECTS(is_fixed_width(input.type()), "Unsupported column type");
+      return size + allocation_size(num_rows * size_of(input.type()));
+  }
+}
+
+}  // namespace
+
+std::size_t allocation_size(std::size_t bytes)
+{
+  return util::round_up_safe(bytes, allocation_alignment);
+}
+
+std::size_t copy_size(column_view const& input, cudaStream_t stream)
+{
+  std::size_t const num_rows = input.size();
+  std::size_t size           = input.nullable() ? null_mask_size(num_rows) : 0;
+  switch (input.type().id()) {
+    case type_id::STRING: {
+      auto const offsets = input.child(strings_column_view::offsets_column_index);
+      auto const range   = child_range(input, offsets, stream);
+      return size + offsets_size(num_rows) + allocation_size(range.second - range.first);
+    }
+    case type_id::LIST: {
+      lists_column_view const lists(input);
+      return size + offsets_size(num_rows) + copy_size(lists.get_sliced_child(stream), stream);
+    }
+    case type_id::STRUCT:
+      for (size_type i = 0; i < input.num_children(); ++i) {
+        auto const child = slice(input.child(i), {input.offset(), input.offset() + input.size()});
+        size += copy_size(child.front(), stream);
+      }
+      return size;
+    case type_id::DICTIONARY32: {
+      dictionary_column_view const dictionary(input);
+      return size + allocation_size(num_rows * size_of(dictionary.indices().type())) +
+             copy_size(dictionary.keys(), stream);
+    }
+    default:
+      CUDF_EXPECTS(is_fixed_width(input.type()), "Unsupported column type");
+      return size + allocation_size(num_rows * size_of(input.type()));
+  }
+}
+
+std::size_t copy_size(table_view const& input, cudaStream_t stream)
+{
+  return std::accumulate(
+    input.begin(), input.end(), std::size_t{0}, [stream](std::size_t size, column_view const& c) {
+      return size + copy_size(c, stream);
+    });
+}
+
+std::size_t gather_size_upper_bound(table_view const& input,
+                                    std::size_t num_rows,
+                                    bool nullable,
+                                    cudaStream_t stream)
+{
+  return std::accumulate(input.begin(),
+                         input.end(),
+                         std::size_t{0},
+                         [num_rows, nullable, stream](std::size_t size, column_view const& c) {
+                           return size + gather_size_upper_bound(c, num_rows, nullable, stream);
+                         });
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+namespace {
+// alignment of every buffer in the packed device memory
+constexpr std::size_t pack_align = 64;
+
+/**
+ * @brief The metadata of one column in the packed metadata, followed by its children
+ */
+struct serialized_column {
+  type_id id;
+  size_type size;
+  size_type null_count;
+  size_type num_children;
+  int64_t data_offset;       // -1 if the column has no data
+  int64_t null_mask_offset;  // -1 if the column has no null mask
+};
+
+/**
+ * @brief The header of the packed metadata
+ */
+struct serialized_header {
+  size_type num_columns;
+  size_type num_serialized_columns;
+  int64_t data_size;
+};
+
+std::size_t round_up(std::size_t size) { return (size + pack_align - 1) / pack_align * pack_align; }
+
+bool has_offsets(column_view const& col)
+{
+  if (col.offset() != 0) { return true; }
+  return std::any_of(col.child_begin(), col.child_end(), has_offsets);
+}
+
+/**
+ * @brief Appends the metadata of `col` and its children to `columns`, and the device copies
+ * of its buffers to `copies`
+ */
+void serialize_column(column_view const& col,
+                      std::vector<serialized_column>& columns,
+                      std::vector<std::pair<void const*, std::size_t>>& copies,
+                      std::size_t& data_size)
+{
+  auto add_buffer = [&](void const* src, std::size_t bytes, std::size_t reserved) -> int64_t {
+    if (src == nullptr or reserved == 0) { return -1; }
+    auto const offset = data_size;
+    copies.emplace_back(src, bytes);
+    data_size += round_up(reserved);
+    return static_cast<int64_t>(offset);
+  };
+
+  auto const data_bytes =
+    is_fixed_width(col.type()) ? static_cast<std::size_t>(col.size()) * size_of(col.type()) : 0;
+  auto const mask_bytes =
+    col.nullable() ? num_bitmask_words(col.size()) * sizeof(bitmask_type) : std::size_t{0};
+  serialized_column meta{col.type().id(), col.size(), col.null_count(), col.num_children(), -1, -1};
+  meta.data_offset      = add_buffer(col.head(), data_bytes, data_bytes);
+  meta.null_mask_offset = add_buffer(col.null_mask(), mask_bytes, mask_bytes);
+  columns.push_back(meta);
+  for (size_type idx = 0; idx < col.num_children(); ++idx) {
+    serialize_column(col.child(idx), columns, copies, data_size);
+  }
+}
+
+/**
+ * @brief Builds the view of the next serialized column and its children over `gpu_data`
+ */
+column_view deserialize_column(serialized_column const*& meta, uint8_t const* gpu_data)
+{
+  auto const current = *meta++;
+  std::vector<column_view> children;
+  for (size_type idx = 0; idx < current.num_children; ++idx) {
+    children.push_back(deserialize_column(meta, gpu_data));
+  }
+  auto const data =
+    current.data_offset < 0 ? nullptr : static_cast<void const*>(gpu_data + current.data_offset);
+  auto const null_mask =
+    current.null_mask_offset < 0
+      ? nullptr
+      : reinterpret_cast<bitmask_type const*>(gpu_data + current.null_mask_offset);
+  return column_view(
+    data_type{current.id}, current.size, data, null_mask, current.null_count, 0, children);
+}
+
+}  // namespace
+
+packed_columns pack(table_view const& input,
+                    rmm::mr::device_memory_resource* mr,
+                    cudaStream_t stream)
+{
+  // sliced columns are copied first so that every buffer starts at the first row
+  std::vector<std::unique_ptr<column>> copies;
+  std::vector<column_view> columns;
+  for (auto const& col : input) {
+    if (has_offsets(col)) {
+      CUDF_EXPECTS(col.type().id() != type_id::STRUCT, "Packing a sliced STRUCT is not supported.");
+      copies.push_back(std::make_unique<column>(col, stream));
+      columns.push_back(copies.back()->view());
+    } else {
+      columns.push_back(col);
+    }
+  }
+
+  std::vector<serialized_column> serialized;
+  std::vector<std::pair<void const*, std::size_t>> buffers;
+  std::size_t data_size = 0;
+  for (auto const& col : columns) { serialize_column(col, serialized, buffers, data_size); }
+
+  auto gpu_data = std::make_unique<rmm::device_buffer>(data_size, stream, mr);
+  auto dst      = static_cast<uint8_t*>(gpu_data->data());
+  for (auto const& buffer : buffers) {
+    CUDA_TRY(cudaMemcpyAsync(dst, buffer.first, buffer.second, cudaMemcpyDeviceToDevice, stream));
+    dst += round_up(buffer.second);
+  }
+
+  serialized_header const header{static_cast<size_type>(columns.size()),
+                                 static_cast<size_type>(serialized.size()),
+                                 static_cast<int64_t>(data_size)};
+  auto metadata = std::make_unique<std::vector<uint8_t>>(
+    sizeof(serialized_header) + serialized.size() * sizeof(serialized_column));
+  std::memcpy(metadata->data(), &header, sizeof(header));
+  std::memcpy(metadata->data() + sizeof(header),
+              serialized.data(),
+              serialized.size() * sizeof(serialized_column));
+
+  // the copied columns are released when the copies are done
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return packed_columns{std::move(metadata), std::move(gpu_data)};
+}
+
+}  // namespace detail
+
+packed_columns pack(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::pack(input, mr);
+}
+
+table_view unpack(packed_columns const& input)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(input.metadata != nullptr, "Packed columns have no metadata.");
+  return unpack(input.metadata->data(),
+                input.gpu_data ? static_cast<uint8_t const*>(input.gpu_data->data()) : nullptr);
+}
+
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
+{
+  CUDF_FUNC_RANGE();
+  detail::serialized_header header;
+  std::memcpy(&header, metadata, sizeof(header));
+  CUDF_EXPECTS(header.data_size == 0 or gpu_data != nullptr, "Packed columns have no data.");
+
+  // the metadata buffer may not be aligned for the serialized columns
+  std::vector<detail::serialized_column> serialized(header.num_serialized_columns);
+  std::memcpy(serialized.data(),
+              metadata + sizeof(header),
+              serialized.size() * sizeof(detail::serialized_column));
+
+  std::vector<column_view> columns;
+  auto meta = static_cast<detail::serialized_column const*>(serialized.data());
+  for (size_type idx = 0; idx < header.num_columns; ++idx) {
+    columns.push_back(detail::deserialize_column(meta, gpu_data));
+  }
+  return table_view(columns);
+}
+
+}  // namespace cudf
@@ -335,44 +335,6 @@ std::unique_ptr<table> scatter(std::vector<std::unique_ptr<scalar>> const& sourc
     indices.type(), scatter_scalar_impl{}, source, indices, target, check_bounds, mr, stream);
 }
 
-std::unique_ptr<column> boolean_mask_scatter(column_view const& input,
-                                             column_view const& target,
-                                             column_view const& boolean_mask,
-                                             rmm::mr::device_memory_resource* mr,
-                                             cudaStream_t stream)
-{
-  auto indices = cudf::make_numeric_column(
-    data_type{type_id::INT32}, target.size(), mask_state::UNALLOCATED, stream);
-  auto mutable_indices = indices->mutable_view();
-
-  thrust::sequence(rmm::exec_policy(stream)->on(stream),
-                   mutable_indices.begin<size_type>(),
-                   mutable_indices.end<size_type>(),
-                   0);
-
-  // The scatter map is actually a table with only one column, which is scatter map.
-  auto scatter_map = detail::apply_boolean_mask(
-    table_view{{indices->view()}}, boolean_mask, rmm::mr::get_default_resource(), stream);
-  auto output_table = detail::scatter(table_view{{input}},
-                                      scatter_map->get_column(0).view(),
-                                      table_view{{target}},
-                                      false,
-                                      mr,
-                                      stream);
-
-  // There is only one column in output_table
-  return std::make_unique<column>(std::move(output_table->get_column(0)));
-}
-
-std::unique_ptr<column> boolean_mask_scatter(scalar const& input,
-                                             column_view const& target,
-                                             column_view const& boolean_mask,
-                                             rmm::mr::device_memory_resource* mr,
-                                             cudaStream_t stream)
-{
-  return detail::copy_if_else(input, target, boolean_mask, mr, stream);
-}
-
 std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
                                             table_view const& target,
                                             column_view const& boolean_mask,
@@ -393,21 +355,19 @@ std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
                 }),
     "Type mismatch in input column and target column");
 
-  if (target.num_rows() != 0) {
-    std::vector<std::unique_ptr<column>> out_columns(target.num_columns());
-    std::transform(
-      input.begin(),
-      input.end(),
-      target.begin(),
-      out_columns.begin(),
-      [&boolean_mask, mr, stream](auto const& input_column, auto const& target_column) {
-        return boolean_mask_scatter(input_column, target_column, boolean_mask, mr, stream);
-      });
-
-    return std::make_unique<table>(std::move(out_columns));
-  } else {
-    return empty_like(target);
-  }
+  if (target.num_rows() == 0) { return empty_like(target); }
+
+  // The scatter map, the rows where the mask is true, is computed once for all the columns
+  auto indices = cudf::make_numeric_column(
+    data_type{type_id::INT32}, target.num_rows(), mask_state::UNALLOCATED, stream);
+  auto mutable_indices = indices->mutable_view();
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   mutable_indices.begin<size_type>(),
+                   mutable_indices.end<size_type>(),
+                   0);
+  auto scatter_map = detail::apply_boolean_mask(
+    table_view{{indices->view()}}, boolean_mask, rmm::mr::get_default_resource(), stream);
+  return detail::scatter(input, scatter_map->get_column(0).view(), target, false, mr, stream);
 }
 
 std::unique_ptr<table> boolean_mask_scatter(
@@ -432,21 +392,9 @@ std::unique_ptr<table> boolean_mask_scatter(
                 }),
     "Type mismatch in input scalar and target column");
 
-  if (target.num_rows() != 0) {
-    std::vector<std::unique_ptr<column>> out_columns(target.num_columns());
-    std::transform(input.begin(),
-                   input.end(),
-                   target.begin(),
-                   out_columns.begin(),
-                   [&boolean_mask, mr, stream](auto const& scalar, auto const& target_column) {
-                     return boolean_mask_scatter(
-                       scalar.get(), target_column, boolean_mask, mr, stream);
-                   });
+  if (target.num_rows() == 0) { return empty_like(target); }
 
-    return std::make_unique<table>(std::move(out_columns));
-  } else {
-    return empty_like(target);
-  }
+  return detail::copy_if_else(input, target, boolean_mask, mr, stream);
 }
 
 }  // namespace detail
@@ -455,20 +403,22 @@ std::unique_ptr<table> scatter(table_view const& source,
                                column_view const& scatter_map,
                                table_view const& target,
                                bool check_bounds,
-                               rmm::mr::device_memory_resource* mr)
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, scatter_map, target, check_bounds, mr);
+  return detail::scatter(source, scatter_map, target, check_bounds, mr, stream);
 }
 
 std::unique_ptr<table> scatter(std::vector<std::unique_ptr<scalar>> const& source,
                                column_view const& indices,
                                table_view const& target,
                                bool check_bounds,
-                               rmm::mr::device_memory_resource* mr)
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, indices, target, check_bounds, mr);
+  return detail::scatter(source, indices, target, check_bounds, mr, stream);
 }
 
 std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
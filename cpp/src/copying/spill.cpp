@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/spill.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <new>
+
+namespace cudf {
+
+struct spill_manager::impl {
+  impl(std::size_t device_limit, rmm::mr::device_memory_resource* mr)
+    : device_limit{device_limit}, mr{mr}
+  {
+  }
+
+  std::mutex mutex;
+  std::size_t device_limit;
+  std::size_t device_size{};
+  rmm::mr::device_memory_resource* mr;
+  // The tables in device memory, most recently used first
+  std::list<spillable_table*> lru;
+
+  // The following member functions require `mutex` to be locked
+
+  void spill(spillable_table& table)
+  {
+    table._partition.spill();
+    lru.erase(table._lru_position);
+    device_size -= table._size;
+  }
+
+  std::size_t spill_lru(std::size_t size)
+  {
+    std::size_t freed = 0;
+    auto it           = lru.end();
+    while (freed < size and it != lru.begin()) {
+      auto table = *std::prev(it);
+      if (table->_pin_count > 0 or table->_size == 0) {
+        --it;
+        continue;
+      }
+      freed += table->_size;
+      spill(*table);  // erases the element before `it` only
+    }
+    return freed;
+  }
+
+  void make_room(std::size_t size)
+  {
+    if (device_size + size > device_limit) { spill_lru(device_size + size - device_limit); }
+  }
+
+  /**
+   * @brief Calls `allocate`, spilling unpinned tables and retrying while it throws
+   * `std::bad_alloc`, since other allocations may leave less free device memory than the limit
+   */
+  template <typename Allocate>
+  auto retry_allocation(std::size_t size, Allocate allocate)
+  {
+    while (true) {
+      try {
+        return allocate();
+      } catch (std::bad_alloc const&) {
+        if (spill_lru(std::max<std::size_t>(size, 1)) == 0) { throw; }
+      }
+    }
+  }
+
+  void unspill(spillable_table& table, cudaStream_t stream)
+  {
+    make_room(table._size);
+    retry_allocation(table._size, [&] { return table._partition.view(stream); });
+    table._lru_position = lru.insert(lru.begin(), &table);
+    device_size += table._size;
+  }
+};
+
+spill_manager::spill_manager(std::size_t device_limit, rmm::mr::device_memory_resource* mr)
+  : _impl{std::make_shared<impl>(device_limit, mr)}
+{
+}
+
+spill_manager::~spill_manager() = default;
+
+std::shared_ptr<spillable_table> spill_manager::make_spillable(table_view const& input,
+                                                               cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  auto copy = [&] { return detail::make_spillable_partition(input, _impl->mr, stream); };
+  // the copy is made without holding the lock unless tables need to be spilled for it
+  std::unique_lock<std::mutex> lock(_impl->mutex, std::defer_lock);
+  auto partition = [&] {
+    try {
+      return copy();
+    } catch (std::bad_alloc const&) {
+      lock.lock();
+      return _impl->retry_allocation(0, copy);
+    }
+  }();
+  if (not lock.owns_lock()) { lock.lock(); }
+  auto const size = partition.size();
+  _impl->make_room(size);
+
+  auto table = std::shared_ptr<spillable_table>(new spillable_table(_impl, std::move(partition)));
+  table->_lru_position = _impl->lru.insert(_impl->lru.begin(), table.get());
+  _impl->device_size += size;
+  return table;
+}
+
+std::size_t spill_manager::spill(std::size_t size)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  return _impl->spill_lru(size);
+}
+
+std::size_t spill_manager::device_size() const
+{
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  return _impl->device_size;
+}
+
+std::size_t spill_manager::device_limit() const
+{
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  return _impl->device_limit;
+}
+
+void spill_manager::set_device_limit(std::size_t device_limit)
+{
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  _impl->device_limit = device_limit;
+  _impl->make_room(0);
+}
+
+spillable_table::spillable_table(std::shared_ptr<spill_manager::impl> manager,
+                                 detail::spillable_partition&& partition)
+  : _manager{std::move(manager)}, _partition{std::move(partition)}, _size{_partition.size()}
+{
+}
+
+spillable_table::~spillable_table()
+{
+  std::lock_guard<std::mutex> lock(_manager->mutex);
+  if (not _partition.is_spilled()) {
+    _manager->lru.erase(_lru_position);
+    _manager->device_size -= _size;
+  }
+}
+
+pinned_table_view spillable_table::pin(cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(_manager->mutex);
+  if (_partition.is_spilled()) {
+    _manager->unspill(*this, stream);
+  } else {
+    _manager->lru.splice(_manager->lru.begin(), _manager->lru, _lru_position);
+  }
+  ++_pin_count;
+
+  auto self  = shared_from_this();
+  auto unpin = [self](void const*) {
+    std::lock_guard<std::mutex> lock(self->_manager->mutex);
+    --self->_pin_count;
+  };
+  return pinned_table_view{_partition.view(stream), std::shared_ptr<void const>(this, unpin)};
+}
+
+bool spillable_table::spill()
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(_manager->mutex);
+  if (_pin_count > 0) { return false; }
+  if (not _partition.is_spilled() and _size > 0) { _manager->spill(*this); }
+  return true;
+}
+
+bool spillable_table::is_spilled() const
+{
+  std::lock_guard<std::mutex> lock(_manager->mutex);
+  return _partition.is_spilled();
+}
+
+bool spillable_table::is_pinned() const
+{
+  std::lock_guard<std::mutex> lock(_manager->mutex);
+  return _pin_count > 0;
+}
+
+}  // namespace cudf
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <datetime/timezone.cuh>
+
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
@@ -21,26 +23,21 @@
 #include <cudf/datetime.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
-enum class datetime_component {
-  INVALID = 0,
-  YEAR,
-  MONTH,
-  DAY,
-  WEEKDAY,
-  HOUR,
-  MINUTE,
-  SECOND,
-};
-
 template <datetime_component Component>
 struct extract_component_operator {
   template <typename Timestamp>
@@ -75,6 +72,91 @@ struct extract_component_operator {
   }
 };
 
+// Extract a component of the local time of a UTC timestamp
+template <datetime_component Component>
+struct extract_local_component_operator {
+  timezone_device_view timezone;
+
+  template <typename Timestamp>
+  CUDA_DEVICE_CALLABLE int16_t operator()(Timestamp const ts) const
+  {
+    return extract_component_operator<Component>{}(timezone.to_local(ts));
+  }
+};
+
+// The calendar date and time of day of a timestamp, from which any of its components is read
+struct civil_time {
+  simt::std::chrono::year_month_day date;
+  simt::std::chrono::weekday weekday;
+  int32_t seconds_of_day;
+
+  template <typename Timestamp>
+  CUDA_DEVICE_CALLABLE civil_time(Timestamp const ts,
+                                  simt::std::chrono::sys_days const days_since_epoch)
+    : date{days_since_epoch},
+      weekday{days_since_epoch},
+      seconds_of_day{static_cast<int32_t>(
+        simt::std::chrono::duration_cast<simt::std::chrono::seconds>(ts - days_since_epoch)
+          .count())}
+  {
+  }
+
+  template <typename Timestamp>
+  CUDA_DEVICE_CALLABLE explicit civil_time(Timestamp const ts)
+    : civil_time(ts, simt::std::chrono::floor<simt::std::chrono::days>(ts))
+  {
+  }
+
+  CUDA_DEVICE_CALLABLE int16_t component(datetime_component component) const
+  {
+    switch (component) {
+      case datetime_component::YEAR: return static_cast<int>(date.year());
+      case datetime_component::MONTH: return static_cast<unsigned>(date.month());
+      case datetime_component::DAY: return static_cast<unsigned>(date.day());
+      case datetime_component::WEEKDAY: return weekday.iso_encoding();
+      case datetime_component::HOUR: return seconds_of_day / 3600;
+      case datetime_component::MINUTE: return seconds_of_day / 60 % 60;
+      case datetime_component::SECOND: return seconds_of_day % 60;
+      default: return 0;
+    }
+  }
+};
+
+// Write the requested components of every timestamp to their output columns
+struct extract_components_functor {
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    column_view const&,
+    rmm::device_vector<datetime_component> const&,
+    rmm::device_vector<int16_t*> const&,
+    cudaStream_t) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& input,
+    rmm::device_vector<datetime_component> const& components,
+    rmm::device_vector<int16_t*> const& outputs,
+    cudaStream_t stream) const
+  {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       input.size(),
+                       [d_input        = input.begin<Timestamp>(),
+                        d_components   = components.data().get(),
+                        d_outputs      = outputs.data().get(),
+                        num_components = static_cast<size_type>(components.size())] __device__(
+                         size_type idx) {
+                         civil_time const time{d_input[idx]};
+                         for (size_type i = 0; i < num_components; ++i) {
+                           d_outputs[i][idx] = time.component(d_components[i]);
+                         }
+                       });
+  }
+};
+
 // Number of days until month indexed by leap year and month (0-based index)
 static __device__ int16_t const days_until_month[2][13] = {
   {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},  // For non leap years
@@ -130,8 +212,12 @@ template <typename TransformFunctor, typename OutputColT>
 struct launch_functor {
   column_view input;
   mutable_column_view output;
+  TransformFunctor transform;
 
-  launch_functor(column_view inp, mutable_column_view out) : input(inp), output(out) {}
+  launch_functor(column_view inp, mutable_column_view out, TransformFunctor op)
+    : input(inp), output(out), transform(op)
+  {
+  }
 
   template <typename Element>
   typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
@@ -148,7 +234,7 @@ struct launch_functor {
                       input.begin<Timestamp>(),
                       input.end<Timestamp>(),
                       output.begin<OutputColT>(),
-                      TransformFunctor{});
+                      transform);
   }
 };
 
@@ -156,7 +242,8 @@ struct launch_functor {
 template <typename TransformFunctor, cudf::type_id OutputColCudfT>
 std::unique_ptr<column> apply_datetime_op(column_view const& column,
                                           cudaStream_t stream,
-                                          rmm::mr::device_memory_resource* mr)
+                                          rmm::mr::device_memory_resource* mr,
+                                          TransformFunctor op = {})
 {
   CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
   auto size            = column.size();
@@ -169,7 +256,7 @@ std::unique_ptr<column> apply_datetime_op(column_view const& column,
     output_col_type, size, copy_bitmask(column, stream, mr), column.null_count(), stream, mr);
   auto launch =
     launch_functor<TransformFunctor, typename cudf::id_to_type_impl<OutputColCudfT>::type>{
-      column, static_cast<mutable_column_view>(*output)};
+      column, static_cast<mutable_column_view>(*output), op};
 
   type_dispatcher(column.type(), launch, stream);
 
@@ -271,13 +358,84 @@ std::unique_ptr<column> add_calendrical_months(column_view const& timestamp_colu
 
   return output;
 }
+
+std::unique_ptr<table> extract_components(column_view const& column,
+                                          std::vector<datetime_component> const& components,
+                                          cudaStream_t stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(std::find(components.begin(), components.end(), datetime_component::INVALID) ==
+                 components.end(),
+               "Invalid datetime component");
+
+  std::vector<std::unique_ptr<column>> output_columns;
+  std::vector<int16_t*> output_data;
+  for (size_t i = 0; i < components.size(); ++i) {
+    output_columns.push_back(make_fixed_width_column(data_type{type_id::INT16},
+                                                     column.size(),
+                                                     copy_bitmask(column, stream, mr),
+                                                     column.null_count(),
+                                                     stream,
+                                                     mr));
+    output_data.push_back(output_columns.back()->mutable_view().data<int16_t>());
+  }
+  if (column.size() == 0 or components.empty()) {
+    return std::make_unique<table>(std::move(output_columns));
+  }
+
+  rmm::device_vector<datetime_component> d_components(components);
+  rmm::device_vector<int16_t*> d_output_data(output_data);
+  type_dispatcher(
+    column.type(), extract_components_functor{}, column, d_components, d_output_data, stream);
+
+  return std::make_unique<table>(std::move(output_columns));
+}
+
+template <datetime_component Component>
+std::unique_ptr<column> apply_local_component_op(column_view const& column,
+                                                 timezone_table const& timezone,
+                                                 cudaStream_t stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  using operator_type = extract_local_component_operator<Component>;
+  return apply_datetime_op<operator_type, cudf::type_id::INT16>(
+    column, stream, mr, operator_type{timezone_device_view{timezone}});
+}
+
+std::unique_ptr<column> extract_local_component(column_view const& column,
+                                                timezone_table const& timezone,
+                                                datetime_component component,
+                                                cudaStream_t stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timezone_convertible(column.type()),
+               "Column type should be a timestamp of seconds or finer");
+  switch (component) {
+    case datetime_component::YEAR:
+      return apply_local_component_op<datetime_component::YEAR>(column, timezone, stream, mr);
+    case datetime_component::MONTH:
+      return apply_local_component_op<datetime_component::MONTH>(column, timezone, stream, mr);
+    case datetime_component::DAY:
+      return apply_local_component_op<datetime_component::DAY>(column, timezone, stream, mr);
+    case datetime_component::WEEKDAY:
+      return apply_local_component_op<datetime_component::WEEKDAY>(column, timezone, stream, mr);
+    case datetime_component::HOUR:
+      return apply_local_component_op<datetime_component::HOUR>(column, timezone, stream, mr);
+    case datetime_component::MINUTE:
+      return apply_local_component_op<datetime_component::MINUTE>(column, timezone, stream, mr);
+    case datetime_component::SECOND:
+      return apply_local_component_op<datetime_component::SECOND>(column, timezone, stream, mr);
+    default: CUDF_FAIL("Invalid datetime component");
+  }
+}
 }  // namespace detail
 
 std::unique_ptr<column> extract_year(column_view const& column, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -287,7 +445,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
   CUDF_FUNC_RANGE();
 
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -295,7 +453,7 @@ std::unique_ptr<column> extract_day(column_view const& column, rmm::mr::device_m
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -304,7 +462,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -312,7 +470,7 @@ std::unique_ptr<column> extract_hour(column_view const& column, rmm::mr::device_
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -321,7 +479,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -330,10 +488,18 @@ std::unique_ptr<column> extract_second(column_view const& column,
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
+std::unique_ptr<table> extract_components(column_view const& column,
+                                          std::vector<datetime_component> const& components,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_components(column, components, 0, mr);
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::mr::device_memory_resource* mr)
 {
@@ -356,5 +522,14 @@ std::unique_ptr<cudf::column> add_calendrical_months(cudf::column_view const& ti
   CUDF_FUNC_RANGE();
   return detail::add_calendrical_months(timestamp_column, months_column, 0, mr);
 }
+
+std::unique_ptr<column> extract_local_component(column_view const& column,
+                                                timezone_table const& timezone,
+                                                datetime_component component,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_local_component(column, timezone, component, 0, mr);
+}
 }  // namespace datetime
 }  // namespace cudf
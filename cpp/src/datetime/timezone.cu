@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <datetime/timezone.cuh>
+#include <io/orc/timezone.h>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/transform.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+namespace {
+template <bool to_local>
+struct convert_timezone_fn {
+  timezone_device_view timezone;
+
+  template <typename Timestamp>
+  __device__ Timestamp operator()(Timestamp ts) const
+  {
+    return to_local ? timezone.to_local(ts) : timezone.from_local(ts);
+  }
+};
+
+template <bool to_local>
+struct convert_timezone_dispatch {
+  template <typename Timestamp, std::enable_if_t<cudf::is_timestamp<Timestamp>()>* = nullptr>
+  void operator()(column_view const& input,
+                  mutable_column_view& output,
+                  timezone_device_view timezone,
+                  cudaStream_t stream)
+  {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      input.begin<Timestamp>(),
+                      input.end<Timestamp>(),
+                      output.begin<Timestamp>(),
+                      convert_timezone_fn<to_local>{timezone});
+  }
+
+  template <typename Timestamp, std::enable_if_t<not cudf::is_timestamp<Timestamp>()>* = nullptr>
+  void operator()(column_view const&, mutable_column_view&, timezone_device_view, cudaStream_t)
+  {
+    CUDF_FAIL("Column type should be timestamp");
+  }
+};
+
+template <bool to_local>
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         timezone_table const& timezone,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timezone_convertible(timestamps.type()),
+               "Column type should be a timestamp of seconds or finer");
+  if (timestamps.is_empty()) { return make_empty_column(timestamps.type()); }
+
+  auto output = make_fixed_width_column(timestamps.type(),
+                                        timestamps.size(),
+                                        copy_bitmask(timestamps, stream, mr),
+                                        timestamps.null_count(),
+                                        stream,
+                                        mr);
+  auto output_view = output->mutable_view();
+  type_dispatcher(timestamps.type(),
+                  convert_timezone_dispatch<to_local>{},
+                  timestamps,
+                  output_view,
+                  timezone_device_view{timezone},
+                  stream);
+  return output;
+}
+
+}  // namespace
+
+std::unique_ptr<column> utc_to_local(column_view const& timestamps,
+                                     timezone_table const& timezone,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  return convert_timezone<true>(timestamps, timezone, stream, mr);
+}
+
+std::unique_ptr<column> local_to_utc(column_view const& timestamps,
+                                     timezone_table const& timezone,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  return convert_timezone<false>(timestamps, timezone, stream, mr);
+}
+
+}  // namespace detail
+
+timezone_table::timezone_table(std::string const& timezone_name, cudaStream_t stream)
+  : _name(timezone_name)
+{
+  std::vector<int64_t> table;
+  CUDF_EXPECTS(io::BuildTimezoneTransitionTable(table, timezone_name),
+               "Cannot find the tzdata of timezone " + timezone_name);
+  if (table.empty()) { return; }
+
+  // The table is the offset of the ORC epoch, then pairs of (transition time, UTC offset), the
+  // last 800 of which are the 400-year cycle if the zone has a daylight saving time rule
+  constexpr size_type cycle_entries = 800;
+  auto const num_entries            = static_cast<size_type>(table.size() / 2);
+  _cycle_length                     = num_entries > cycle_entries ? cycle_entries : 0;
+  _num_transitions                  = num_entries - _cycle_length;
+
+  std::vector<int64_t> times(num_entries);
+  std::vector<int64_t> offsets(num_entries);
+  for (size_type i = 0; i < num_entries; ++i) {
+    times[i]   = table[i * 2 + 1];
+    offsets[i] = table[i * 2 + 2];
+  }
+  _transition_times = rmm::device_buffer(times.data(), num_entries * sizeof(int64_t), stream);
+  _utc_offsets      = rmm::device_buffer(offsets.data(), num_entries * sizeof(int64_t), stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+}
+
+std::shared_ptr<timezone_table const> get_timezone_table(std::string const& timezone_name)
+{
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::shared_ptr<timezone_table const>> tables;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& table = tables[timezone_name];
+  if (table == nullptr) { table = std::make_shared<timezone_table const>(timezone_name); }
+  return table;
+}
+
+std::unique_ptr<column> utc_to_local(column_view const& timestamps,
+                                     timezone_table const& timezone,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::utc_to_local(timestamps, timezone, 0, mr);
+}
+
+std::unique_ptr<column> local_to_utc(column_view const& timestamps,
+                                     timezone_table const& timezone,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::local_to_utc(timestamps, timezone, 0, mr);
+}
+
+}  // namespace datetime
+}  // namespace cudf
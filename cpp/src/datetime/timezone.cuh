@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/datetime.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+/**
+ * @brief Device view of a `timezone_table`
+ */
+struct timezone_device_view {
+  int64_t const* transition_times;
+  int64_t const* utc_offsets;
+  size_type num_transitions;
+  size_type cycle_length;
+
+  explicit timezone_device_view(timezone_table const& table)
+    : transition_times(table.transition_times()),
+      utc_offsets(table.utc_offsets()),
+      num_transitions(table.num_transitions()),
+      cycle_length(table.cycle_length())
+  {
+  }
+
+  /**
+   * @brief Returns the UTC offset in seconds of the zone at a UTC time in seconds
+   *
+   * Same lookup as the ORC reader: the transitions after the last transition of the file repeat
+   * with a 400-year cycle, which is exact for the Gregorian calendar.
+   */
+  __device__ int64_t utc_offset(int64_t utc_seconds) const
+  {
+    if (num_transitions == 0) { return 0; }
+    constexpr int64_t seconds_per_400_years = (365 * 400 + (100 - 3)) * 24 * 60 * 60ll;
+
+    size_type first = 0;
+    size_type last  = num_transitions - 1;
+    auto ts         = utc_seconds;
+    if (ts <= transition_times[0]) {
+      return utc_offsets[0];
+    } else if (ts > transition_times[last]) {
+      if (cycle_length == 0) { return utc_offsets[last]; }
+      ts %= seconds_per_400_years;
+      if (ts < 0) { ts += seconds_per_400_years; }
+      first = num_transitions;
+      last  = num_transitions + cycle_length - 1;
+      if (ts < transition_times[first]) { return utc_offsets[last]; }
+    }
+    // binary search for the last transition at or before `ts`
+    while (first < last) {
+      auto const mid = first + (last - first + 1) / 2;
+      if (transition_times[mid] <= ts) {
+        first = mid;
+      } else {
+        last = mid - 1;
+      }
+    }
+    return utc_offsets[first];
+  }
+
+  /**
+   * @brief Returns the UTC time in seconds of a local time in seconds of the zone
+   *
+   * The offsets a day before and after bracket the transition that may be near the local time,
+   * if any. A local time valid for both offsets takes the earlier instant, and a local time valid
+   * for neither, in the gap of a forward transition, is shifted forward.
+   */
+  __device__ int64_t to_utc(int64_t local_seconds) const
+  {
+    constexpr int64_t seconds_per_day = 24 * 60 * 60;
+    auto const offset_before          = utc_offset(local_seconds - seconds_per_day);
+    auto const offset_after           = utc_offset(local_seconds + seconds_per_day);
+    if (offset_before == offset_after or
+        utc_offset(local_seconds - offset_before) == offset_before) {
+      return local_seconds - offset_before;
+    }
+    if (utc_offset(local_seconds - offset_after) == offset_after) {
+      return local_seconds - offset_after;
+    }
+    return local_seconds - offset_before;
+  }
+
+  /**
+   * @brief Converts a UTC timestamp to the local time of the zone
+   */
+  template <typename Timestamp>
+  __device__ Timestamp to_local(Timestamp ts) const
+  {
+    using namespace simt::std::chrono;
+    auto const utc_seconds = floor<seconds>(ts).time_since_epoch().count();
+    return ts + duration_cast<typename Timestamp::duration>(seconds{utc_offset(utc_seconds)});
+  }
+
+  /**
+   * @brief Converts a timestamp in the local time of the zone to UTC
+   */
+  template <typename Timestamp>
+  __device__ Timestamp from_local(Timestamp ts) const
+  {
+    using namespace simt::std::chrono;
+    auto const local_seconds = floor<seconds>(ts).time_since_epoch().count();
+    return ts - duration_cast<typename Timestamp::duration>(
+                  seconds{local_seconds - to_utc(local_seconds)});
+  }
+};
+
+/**
+ * @brief Returns whether timestamps of `type` can be converted between timezones
+ */
+inline bool is_timezone_convertible(data_type type)
+{
+  return is_timestamp(type) and type.id() != type_id::TIMESTAMP_DAYS;
+}
+
+}  // namespace detail
+}  // namespace datetime
+}  // namespace cudf
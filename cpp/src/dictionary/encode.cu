@@ -15,19 +15,161 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
-#include <cudf/detail/transform.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
-#include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <hash/open_addressing_map.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <cooperative_groups.h>
+
+#include <limits>
 
 namespace cudf {
 namespace dictionary {
 namespace detail {
+namespace {
+using map_type = cudf::detail::open_addressing_map<size_type, void>;
+
+/**
+ * @brief Inserts the index of every valid row of the input into `map`, and stores in
+ * `row_targets[i]` the index of the first row inserted with the value of row `i`
+ *
+ * Null rows are not inserted and get the target `-1`.
+ */
+template <int tile_size, typename MapView, typename Hasher, typename KeyEqual>
+__global__ void find_row_targets(MapView map,
+                                 Hasher hasher,
+                                 KeyEqual key_equal,
+                                 size_type num_rows,
+                                 bitmask_type const* __restrict__ null_mask,
+                                 size_type mask_offset,
+                                 size_type* __restrict__ row_targets)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  size_type const stride = (blockDim.x * gridDim.x) / tile_size;
+
+  for (size_type i = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size; i < num_rows;
+       i += stride) {
+    size_type target{-1};
+    if (null_mask == nullptr or bit_is_set(null_mask, mask_offset + i)) {
+      hash_value_type const hash = tile.shfl(tile.thread_rank() == 0 ? hasher(i) : 0, 0);
+      target                     = map.insert_or_find(tile, i, hash, key_equal);
+    }
+    if (tile.thread_rank() == 0) { row_targets[i] = target; }
+  }
+}
+
+/**
+ * @brief Dictionary encodes `input` with a hash table of its distinct values
+ *
+ * Every row is hashed once to find the first row with an equal value, and only the distinct
+ * values are then sorted to order the keys. This avoids the comparison sort of all the rows done
+ * by `cudf::detail::encode`, which is much more expensive for long columns with few keys,
+ * especially of strings.
+ *
+ * @return The sorted keys without nulls, and the INT32 indices of the rows into the keys. The
+ * indices of the null rows are the number of keys, as with `cudf::detail::encode`.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_encode(
+  column_view const& input, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  auto const num_rows = input.size();
+  auto indices        = make_numeric_column(
+    data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto d_indices = indices->mutable_view().data<size_type>();
+
+  // the representative of every row is the first row inserted with the same value
+  auto const input_table = table_view{{input}};
+  auto const d_input     = table_device_view::create(input_table, stream);
+  map_type map(
+    num_rows, std::numeric_limits<size_type>::max(), DEFAULT_HASH_TABLE_OCCUPANCY, stream);
+  rmm::device_vector<size_type> row_targets(num_rows);
+  if (num_rows > 0) {
+    constexpr int tile_size{cudf::detail::DEFAULT_PROBE_TILE_SIZE};
+    constexpr int block_size{256};
+    cudf::detail::grid_1d config(num_rows, block_size / tile_size);
+    find_row_targets<tile_size><<<config.num_blocks, block_size, 0, stream>>>(
+      map.view(),
+      row_hasher<default_hash, false>{*d_input},
+      row_equality_comparator<false>{*d_input, *d_input},
+      num_rows,
+      input.nullable() ? input.null_mask() : nullptr,
+      input.offset(),
+      row_targets.data().get());
+    CHECK_CUDA(stream);
+  }
+
+  // the distinct values are few, so sorting them is cheap
+  rmm::device_vector<size_type> unique_rows(num_rows);
+  auto const unique_end = thrust::copy_if(
+    rmm::exec_policy(stream)->on(stream),
+    map.keys(),
+    map.keys() + map.capacity(),
+    unique_rows.begin(),
+    [empty_key = map.empty_key()] __device__(size_type key) { return key != empty_key; });
+  unique_rows.resize(thrust::distance(unique_rows.begin(), unique_end));
+  auto const num_keys = static_cast<size_type>(unique_rows.size());
+
+  auto const unsorted_keys = cudf::detail::gather(input_table,
+                                                  unique_rows.begin(),
+                                                  unique_rows.end(),
+                                                  false,
+                                                  rmm::mr::get_default_resource(),
+                                                  stream);
+  auto const keys_order = cudf::detail::sorted_order(
+    unsorted_keys->view(), {}, {}, rmm::mr::get_default_resource(), stream);
+  rmm::device_vector<size_type> sorted_rows(num_keys);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 keys_order->view().begin<size_type>(),
+                 keys_order->view().end<size_type>(),
+                 unique_rows.begin(),
+                 sorted_rows.begin());
+  auto keys = std::move(
+    cudf::detail::gather(input_table, sorted_rows.begin(), sorted_rows.end(), false, mr, stream)
+      ->release()
+      .front());
+  keys->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);
+
+  // the index of each key is written at its representative row, then copied to the other rows
+  // of the same value; the representative rows only ever read their own index
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_keys),
+                  sorted_rows.begin(),
+                  d_indices);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    row_targets.begin(),
+                    row_targets.end(),
+                    d_indices,
+                    [d_indices, num_keys] __device__(size_type target) {
+                      return target < 0 ? num_keys : d_indices[target];
+                    });
+  return std::make_pair(std::move(keys), std::move(indices));
+}
+
+}  // namespace
+
 /**
  * @brief Create a new dictionary column from a column_view.
  *
@@ -41,15 +183,10 @@ std::unique_ptr<column> encode(column_view const& input_column,
   CUDF_EXPECTS(input_column.type().id() != type_id::DICTIONARY32,
                "cannot encode a dictionary from a dictionary");
 
-  // this returns a column with no null entries
-  // - it appears to ignore the null entries in the input and tries to place the value regardless
-  auto codified       = cudf::detail::encode(input_column, mr, stream);
+  auto codified       = hash_encode(input_column, mr, stream);
   auto keys_column    = std::move(codified.first);
   auto indices_column = std::move(codified.second);
 
-  // we should probably copy/cast to type_id::INT32 type if different
-  CUDF_EXPECTS(indices_column->type() == indices_type, "expecting type_id::INT32 indices type");
-
   // create column with keys_column and indices_column
   return make_dictionary_column(std::move(keys_column),
                                 std::move(indices_column),
@@ -20,12 +20,15 @@
 #include <cudf/detail/search.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/stream_compaction.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/binary_search.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace dictionary {
@@ -142,6 +145,91 @@ std::unique_ptr<column> set_keys(
                                 std::move(new_nulls.first),
                                 new_nulls.second);
 }
+
+std::unique_ptr<column> remap_indices(dictionary_column_view const& dictionary_column,
+                                      column_view const& keys,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(!keys.has_nulls(), "keys parameter must not have nulls");
+  auto result = make_numeric_column(data_type{type_id::INT32},
+                                    dictionary_column.size(),
+                                    copy_bitmask(dictionary_column.parent(), stream, mr),
+                                    dictionary_column.null_count(),
+                                    stream,
+                                    mr);
+  if (dictionary_column.size() == 0) { return result; }
+  auto old_keys = dictionary_column.keys();
+  CUDF_EXPECTS(old_keys.type() == keys.type(), "keys types must match");
+
+  // a key is in the new keys if its lower bound is not its upper bound
+  std::vector<order> const column_order{order::ASCENDING};
+  std::vector<null_order> const null_precedence{null_order::BEFORE};
+  auto const lower = cudf::detail::lower_bound(table_view{{keys}},
+                                               table_view{{old_keys}},
+                                               column_order,
+                                               null_precedence,
+                                               rmm::mr::get_default_resource(),
+                                               stream);
+  auto const upper = cudf::detail::upper_bound(table_view{{keys}},
+                                               table_view{{old_keys}},
+                                               column_order,
+                                               null_precedence,
+                                               rmm::mr::get_default_resource(),
+                                               stream);
+  rmm::device_vector<int32_t> key_map(old_keys.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    lower->view().begin<size_type>(),
+                    lower->view().end<size_type>(),
+                    upper->view().begin<size_type>(),
+                    key_map.begin(),
+                    [] __device__(size_type lower, size_type upper) {
+                      return lower < upper ? lower : -1;
+                    });
+
+  // the null rows may have any index, so they are clamped into the keys
+  auto const indices   = dictionary_column.get_indices_annotated();
+  auto const d_key_map = key_map.data().get();
+  auto const max_index = old_keys.size() - 1;
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    indices.begin<int32_t>(),
+                    indices.end<int32_t>(),
+                    result->mutable_view().begin<int32_t>(),
+                    [d_key_map, max_index] __device__(int32_t index) {
+                      return d_key_map[thrust::min(thrust::max(index, 0), max_index)];
+                    });
+  return result;
+}
+
+bool have_same_keys(dictionary_column_view const& lhs, dictionary_column_view const& rhs)
+{
+  if (lhs.size() == 0 || rhs.size() == 0) { return false; }
+  auto const lhs_keys = lhs.keys();
+  auto const rhs_keys = rhs.keys();
+  return lhs_keys.type() == rhs_keys.type() && lhs_keys.head() == rhs_keys.head() &&
+         lhs_keys.offset() == rhs_keys.offset() && lhs_keys.size() == rhs_keys.size() &&
+         lhs_keys.num_children() == rhs_keys.num_children() &&
+         std::equal(lhs_keys.child_begin(),
+                    lhs_keys.child_end(),
+                    rhs_keys.child_begin(),
+                    [](column_view const& lhs_child, column_view const& rhs_child) {
+                      return lhs_child.head() == rhs_child.head() &&
+                             lhs_child.offset() == rhs_child.offset() &&
+                             lhs_child.size() == rhs_child.size();
+                    });
+}
+
+table_view indices_view(table_view const& input)
+{
+  std::vector<column_view> columns(input.begin(), input.end());
+  for (auto& col : columns) {
+    if (col.type().id() != type_id::DICTIONARY32) { continue; }
+    col = col.size() == 0 ? column_view{data_type{type_id::INT32}, 0, nullptr}
+                          : dictionary_column_view(col).get_indices_annotated();
+  }
+  return table_view{columns};
+}
+
 }  // namespace detail
 
 // external API
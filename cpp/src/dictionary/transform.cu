@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/dictionary/detail/transform.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace dictionary {
+namespace detail {
+/**
+ * @brief Apply the transform to the keys and map the results to the rows.
+ */
+std::unique_ptr<column> transform_keys(dictionary_column_view const& dictionary_column,
+                                       keys_transform const& transform,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  if (dictionary_column.size() == 0) return make_empty_column(data_type{type_id::EMPTY});
+
+  auto keys_result = transform(dictionary_column.keys());
+  CUDF_EXPECTS(keys_result->size() == dictionary_column.keys_size(),
+               "transform must return one row for each key");
+
+  // null entries may have any index so the indices are checked with the null mask
+  column_view indices{data_type{type_id::INT32},
+                      dictionary_column.size(),
+                      dictionary_column.indices().head<int32_t>(),
+                      nullptr,
+                      0,
+                      dictionary_column.offset()};
+
+  if (is_fixed_width(keys_result->type())) {
+    // gather the result of each row's key -- use ignore_out_of_bounds=true
+    auto table_column = cudf::detail::gather(table_view{{keys_result->view()}},
+                                             indices,
+                                             cudf::detail::out_of_bounds_policy::IGNORE,
+                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                             mr,
+                                             stream)
+                          ->release();
+    auto output_column = std::unique_ptr<column>(std::move(table_column.front()));
+    if (keys_result->has_nulls()) {
+      auto null_mask =
+        bitmask_and(table_view{{dictionary_column.parent(), output_column->view()}}, mr, stream);
+      output_column->set_null_mask(std::move(null_mask), UNKNOWN_NULL_COUNT);
+    } else {
+      output_column->set_null_mask(copy_bitmask(dictionary_column.parent(), stream, mr),
+                                   dictionary_column.null_count());
+    }
+    return output_column;
+  }
+
+  // the results may have duplicates and are not sorted so they are encoded as new keys
+  CUDF_EXPECTS(!keys_result->has_nulls(), "transform must not return null keys");
+  auto codified = cudf::detail::encode(keys_result->view(), mr, stream);
+  auto d_map    = codified.second->view().data<int32_t>();
+
+  auto indices_column = make_numeric_column(
+    data_type{type_id::INT32}, dictionary_column.size(), mask_state::UNALLOCATED, stream, mr);
+  auto d_null_mask = dictionary_column.null_mask();
+  auto offset      = dictionary_column.offset();
+  auto d_indices   = indices.data<int32_t>();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(dictionary_column.size()),
+                    indices_column->mutable_view().data<int32_t>(),
+                    [d_null_mask, offset, d_indices, d_map] __device__(size_type idx) {
+                      if (d_null_mask && !bit_is_set(d_null_mask, idx + offset)) return 0;
+                      return d_map[d_indices[idx]];
+                    });
+
+  return make_dictionary_column(std::move(codified.first),
+                                std::move(indices_column),
+                                copy_bitmask(dictionary_column.parent(), stream, mr),
+                                dictionary_column.null_count());
+}
+
+}  // namespace detail
+
+// external API
+
+std::unique_ptr<column> transform_keys(dictionary_column_view const& dictionary_column,
+                                       keys_transform const& transform,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform_keys(dictionary_column, transform, mr);
+}
+
+}  // namespace dictionary
+}  // namespace cudf
@@ -22,15 +22,23 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/memory_estimate.hpp>
+#include <cudf/detail/tdigest.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <hash/open_addressing_map.cuh>
 
 #include <thrust/copy.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -64,7 +72,11 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   // satisfied with a hash implementation
   if (_keys_are_sorted == sorted::NO and not _helper and
       detail::hash::can_use_hash_groupby(_keys, requests)) {
-    return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
+    if (_persist_key_index and not _hash_index) {
+      _hash_index = std::make_unique<detail::hash::key_index>();
+    }
+    return detail::hash::groupby(
+      _keys, requests, _include_null_keys, _hash_index.get(), stream, mr);
   } else {
     return sort_aggregate(requests, stream, mr);
   }
@@ -89,6 +101,17 @@ auto empty_results(std::vector<aggregation_request> const& requests)
         request.aggregations.end(),
         std::back_inserter(results),
         [&request](auto const& agg) {
+          if (agg->kind == aggregation::HYPERLOGLOG) {
+            // A column of no sketches still has the registers child of their precision
+            auto const& hll_agg = static_cast<cudf::detail::hyperloglog_aggregation const&>(*agg);
+            return cudf::detail::hyperloglog_sketches(
+              request.values, nullptr, 0, hll_agg._precision, hll_agg._null_handling);
+          }
+          if (agg->kind == aggregation::TDIGEST) {
+            // A column of no digests still has the FLOAT64 centroids child
+            auto const& tdigest_agg = static_cast<cudf::detail::tdigest_aggregation const&>(*agg);
+            return cudf::detail::tdigests(request.values, nullptr, 0, tdigest_agg._max_centroids);
+          }
           return make_empty_column(cudf::detail::target_type(request.values.type(), agg->kind));
         });
 
@@ -114,13 +137,82 @@ void verify_valid_requests(std::vector<aggregation_request> const& requests)
                "Invalid type/aggregation combination.");
 }
 
+/// Verifies every aggregation requested is a supported scan
+void verify_scan_requests(std::vector<aggregation_request> const& requests)
+{
+  CUDF_EXPECTS(std::all_of(requests.begin(),
+                           requests.end(),
+                           [](auto const& request) {
+                             return std::all_of(
+                               request.aggregations.begin(),
+                               request.aggregations.end(),
+                               [](auto const& agg) {
+                                 return agg->kind == aggregation::SUM or
+                                        agg->kind == aggregation::MIN or
+                                        agg->kind == aggregation::MAX or
+                                        agg->kind == aggregation::COUNT_VALID or
+                                        agg->kind == aggregation::COUNT_ALL or
+                                        agg->kind == aggregation::ROW_NUMBER or
+                                        agg->kind == aggregation::RANK;
+                               });
+                           }),
+               "Unsupported groupby scan aggregation.");
+}
+
+/// Returns an upper bound on the device memory of the result of `agg` for `num_groups` groups
+std::size_t aggregation_result_size(column_view const& values,
+                                    aggregation const& agg,
+                                    std::size_t num_groups,
+                                    cudaStream_t stream)
+{
+  using cudf::detail::allocation_size;
+  auto const null_mask =
+    allocation_size(bitmask_allocation_size_bytes(static_cast<size_type>(num_groups)));
+  auto const offsets = allocation_size((num_groups + 1) * sizeof(size_type));
+  switch (agg.kind) {
+    case aggregation::QUANTILE: {
+      auto const& quantile     = static_cast<cudf::detail::quantile_aggregation const&>(agg);
+      auto const num_quantiles = std::max<std::size_t>(quantile._quantiles.size(), 1);
+      return null_mask + allocation_size(num_groups * num_quantiles * sizeof(double));
+    }
+    case aggregation::HYPERLOGLOG: {
+      auto const& hll = static_cast<cudf::detail::hyperloglog_aggregation const&>(agg);
+      return offsets + allocation_size(num_groups << hll._precision);
+    }
+    case aggregation::TDIGEST:
+      // Every value is at most one centroid of `mean, weight` pairs
+      return offsets + allocation_size(values.size() * 2 * sizeof(double));
+    case aggregation::APPROX_QUANTILE: {
+      auto const& tdigest      = static_cast<cudf::detail::tdigest_aggregation const&>(agg);
+      auto const num_quantiles = std::max<std::size_t>(tdigest._quantiles.size(), 1);
+      return null_mask + allocation_size(num_groups * num_quantiles * sizeof(double));
+    }
+    case aggregation::PTX:
+    case aggregation::CUDA: {
+      auto const& udf = static_cast<cudf::detail::udf_aggregation const&>(agg);
+      return null_mask + allocation_size(num_groups * size_of(udf._output_type));
+    }
+    default: {
+      auto const target = cudf::detail::target_type(values.type(), agg.kind);
+      if (is_fixed_width(target)) {
+        return null_mask + allocation_size(num_groups * size_of(target));
+      }
+      // The result of every group is one row of `values`
+      return cudf::detail::copy_size(values, stream);
+    }
+  }
+}
+
 }  // namespace
 
 // Compute aggregation requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate(
-  std::vector<aggregation_request> const& requests, rmm::mr::device_memory_resource* mr)
+  std::vector<aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
+  detail::operation_metrics_scope metrics("groupby_aggregate", stream);
   CUDF_EXPECTS(
     std::all_of(requests.begin(),
                 requests.end(),
@@ -131,7 +223,81 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
 
   if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
 
-  return dispatch_aggregation(requests, 0, mr);
+  auto result = dispatch_aggregation(requests, stream, mr);
+  // The sort implementation is the one that creates the sort helper
+  metrics.decide("algorithm", _helper ? "sort" : "hash");
+  metrics.add("rows_in", _keys.num_rows());
+  metrics.add("requests", requests.size());
+  metrics.add("groups_out", result.first->num_rows());
+  return result;
+}
+
+memory_estimate groupby::estimate_aggregate_memory(std::vector<aggregation_request> const& requests,
+                                                   cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  verify_valid_requests(requests);
+
+  using cudf::detail::allocation_size;
+  memory_estimate estimate;
+  std::size_t const num_rows = _keys.num_rows();
+  if (num_rows == 0) { return estimate; }
+
+  auto const keys_size = cudf::detail::copy_size(_keys, stream);
+  std::size_t results_size{0};
+  std::size_t values_size{0};
+  std::size_t num_aggs{0};
+  for (auto const& request : requests) {
+    values_size += cudf::detail::copy_size(request.values, stream);
+    for (auto const& agg : request.aggregations) {
+      results_size += aggregation_result_size(request.values, *agg, num_rows, stream);
+    }
+    num_aggs += request.aggregations.size();
+  }
+  // Every group key is one row of the keys
+  estimate.output_bytes = keys_size + results_size;
+
+  auto const index_size = allocation_size(num_rows * sizeof(size_type));
+  auto const intermediates_size =
+    num_aggs * 3 *
+    (allocation_size(num_rows * sizeof(double)) +
+     allocation_size(bitmask_allocation_size_bytes(_keys.num_rows())));
+  // The map of the keys, the row targets, group maps and gather map, and the sparse results
+  auto const hash_size =
+    cudf::detail::open_addressing_map<size_type, void>::memory_size(_keys.num_rows()) +
+    6 * index_size + results_size + intermediates_size;
+  // The sort order and its scratch space, the group labels and offsets, and the sorted keys and
+  // values
+  auto const sort_size = 6 * index_size + keys_size + values_size + intermediates_size;
+  estimate.temporary_bytes = std::max(hash_size, sort_size);
+  return estimate;
+}
+
+// Compute scan requests
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan(
+  std::vector<aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  verify_valid_requests(requests);
+  verify_scan_requests(requests);
+
+  if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
+
+  return sort_scan(requests, stream, mr);
 }
 
 groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_resource* mr)
@@ -157,6 +323,23 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
   }
 }
 
+void groupby::persist_key_index(bool persist)
+{
+  _persist_key_index = persist;
+  if (not persist) { _hash_index.reset(); }
+}
+
+std::size_t groupby::key_index_size() const
+{
+  return (_hash_index ? _hash_index->size_bytes() : 0) + (_helper ? _helper->size_bytes() : 0);
+}
+
+void groupby::release_key_index()
+{
+  _hash_index.reset();
+  _helper.reset();
+}
+
 // Get the sort helper object
 detail::sort::sort_groupby_helper& groupby::helper()
 {
@@ -27,19 +27,35 @@
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/structs/detail/flatten.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
-#include <hash/concurrent_unordered_map.cuh>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <hash/open_addressing_map.cuh>
 
+#include <rmm/device_scalar.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -55,10 +71,12 @@ namespace {
  * @brief List of aggregation operations that can be computed with a hash-based
  * implementation.
  */
-constexpr std::array<aggregation::Kind, 7> hash_aggregations{
+constexpr std::array<aggregation::Kind, 11> hash_aggregations{
     aggregation::SUM, aggregation::MIN, aggregation::MAX,
     aggregation::COUNT_VALID, aggregation::COUNT_ALL,
-    aggregation::ARGMIN, aggregation::ARGMAX};
+    aggregation::ARGMIN, aggregation::ARGMAX,
+    aggregation::SUM_OF_SQUARES, aggregation::MEAN,
+    aggregation::VARIANCE, aggregation::STD};
 
 template <class T, size_t N>
 constexpr bool array_contains(std::array<T, N> const& haystack, T needle) {
@@ -84,7 +102,55 @@ bool constexpr is_hash_aggregation(aggregation::Kind t)
   // return array_contains(hash_aggregations, t);
   return (t == aggregation::SUM) or (t == aggregation::MIN) or (t == aggregation::MAX) or
          (t == aggregation::COUNT_VALID) or (t == aggregation::COUNT_ALL) or
-         (t == aggregation::ARGMIN) or (t == aggregation::ARGMAX);
+         (t == aggregation::ARGMIN) or (t == aggregation::ARGMAX) or
+         (t == aggregation::SUM_OF_SQUARES) or (t == aggregation::MEAN) or
+         (t == aggregation::VARIANCE) or (t == aggregation::STD) or
+         (t == aggregation::HYPERLOGLOG) or (t == aggregation::APPROX_NUNIQUE);
+}
+
+/**
+ * @brief Indicates whether the specified aggregation operation is computed from
+ * the results of other hash-based aggregations instead of in the single pass.
+ *
+ * MEAN is computed from SUM and COUNT_VALID, VARIANCE and STD from these and
+ * the sum of squared differences from the mean, which takes a second pass.
+ */
+bool constexpr is_compound_hash_aggregation(aggregation::Kind t)
+{
+  return (t == aggregation::MEAN) or (t == aggregation::VARIANCE) or (t == aggregation::STD);
+}
+
+/**
+ * @brief Indicates whether the specified aggregation operation is computed
+ * from the HyperLogLog sketches of the groups, once the groups are known.
+ */
+bool constexpr is_sketch_hash_aggregation(aggregation::Kind t)
+{
+  return (t == aggregation::HYPERLOGLOG) or (t == aggregation::APPROX_NUNIQUE);
+}
+
+/**
+ * @brief Indicates whether the specified hash-based aggregation operation is
+ * only supported on numeric values.
+ */
+bool constexpr is_numeric_hash_aggregation(aggregation::Kind t)
+{
+  return is_compound_hash_aggregation(t) or (t == aggregation::SUM_OF_SQUARES);
+}
+
+/**
+ * @brief Indicates whether the specified hash-based aggregation operation is
+ * supported on fixed_point values.
+ *
+ * fixed_point elements carry their own scale and cannot be updated atomically,
+ * so MIN and MAX are computed through ARGMIN and ARGMAX and the rest are left
+ * to the sort-based groupby.
+ */
+bool constexpr is_fixed_point_hash_aggregation(aggregation::Kind t)
+{
+  return (t == aggregation::MIN) or (t == aggregation::MAX) or (t == aggregation::ARGMIN) or
+         (t == aggregation::ARGMAX) or (t == aggregation::COUNT_VALID) or
+         (t == aggregation::COUNT_ALL);
 }
 
 // flatten aggs to filter in single pass aggs
@@ -99,19 +165,29 @@ flatten_single_pass_aggs(std::vector<aggregation_request> const& requests)
     auto const& request = requests[i];
     auto const& agg_v   = request.aggregations;
 
-    auto insert_agg = [&agg_kinds, &columns, &col_ids, &request, i](aggregation::Kind k) {
-      agg_kinds.push_back(k);
-      columns.push_back(request.values);
-      col_ids.push_back(i);
-    };
+    // Compound aggregations share their pieces, so every kind is inserted once per request
+    auto const first_agg = agg_kinds.size();
+    auto insert_agg =
+      [&agg_kinds, &columns, &col_ids, &request, i, first_agg](aggregation::Kind k) {
+        if (std::find(agg_kinds.begin() + first_agg, agg_kinds.end(), k) != agg_kinds.end()) {
+          return;
+        }
+        agg_kinds.push_back(k);
+        columns.push_back(request.values);
+        col_ids.push_back(i);
+      };
 
     for (auto&& agg : agg_v) {
-      if (is_hash_aggregation(agg->kind)) {
-        if (is_fixed_width(request.values.type()) or agg->kind == aggregation::COUNT_VALID or
-            agg->kind == aggregation::COUNT_ALL) {
+      if (is_compound_hash_aggregation(agg->kind)) {
+        insert_agg(aggregation::SUM);
+        insert_agg(aggregation::COUNT_VALID);
+      } else if (is_hash_aggregation(agg->kind) and not is_sketch_hash_aggregation(agg->kind)) {
+        auto const values_type = request.values.type();
+        if ((is_fixed_width(values_type) and not is_fixed_point(values_type)) or
+            agg->kind == aggregation::COUNT_VALID or agg->kind == aggregation::COUNT_ALL) {
           insert_agg(agg->kind);
-        } else if (request.values.type().id() == type_id::STRING) {
-          // For string type, only ARGMIN, ARGMAX, MIN, and MAX are supported
+        } else if (values_type.id() == type_id::STRING or is_fixed_point(values_type)) {
+          // For string and fixed_point types, only ARGMIN, ARGMAX, MIN, and MAX are supported
           if (agg->kind == aggregation::ARGMIN or agg->kind == aggregation::ARGMAX) {
             insert_agg(agg->kind);
           } else if (agg->kind == aggregation::MIN) {
@@ -140,6 +216,7 @@ void sparse_to_dense_results(std::vector<aggregation_request> const& requests,
                              cudaStream_t stream,
                              rmm::mr::device_memory_resource* mr)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby::hash::sparse_to_dense_results", map_size);
   for (size_t i = 0; i < requests.size(); i++) {
     auto const& agg_v = requests[i].aggregations;
     auto const& col   = requests[i].values;
@@ -182,7 +259,7 @@ void sparse_to_dense_results(std::vector<aggregation_request> const& requests,
       auto const& agg_ref = *agg;
       if (agg->kind == aggregation::COUNT_VALID or agg->kind == aggregation::COUNT_ALL) {
         dense_results->add_result(i, agg_ref, to_dense_agg_result(agg_ref));
-      } else if (col.type().id() == type_id::STRING and
+      } else if ((col.type().id() == type_id::STRING or is_fixed_point(col.type())) and
                  (agg->kind == aggregation::MAX or agg->kind == aggregation::MIN)) {
         if (agg->kind == aggregation::MAX) {
           dense_results->add_result(i, agg_ref, transformed_result(aggregation::ARGMAX));
@@ -197,59 +274,237 @@ void sparse_to_dense_results(std::vector<aggregation_request> const& requests,
 }
 
 /**
- * @brief Construct hash map that uses row comparator and row hasher on
- * `d_keys` table and stores indices
+ * @brief Hash map storing the indices of unique rows of `d_keys`
  */
-template <bool keys_have_nulls>
-auto create_hash_map(table_device_view const& d_keys,
-                     null_policy include_null_keys,
-                     cudaStream_t stream = 0)
+using map_type = cudf::detail::open_addressing_map<size_type, void>;
+
+/**
+ * @brief Construct hash map that stores indices of `d_keys` rows
+ */
+std::unique_ptr<map_type> create_hash_map(table_device_view const& d_keys, cudaStream_t stream = 0)
 {
   size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
-  size_type constexpr unused_value{std::numeric_limits<size_type>::max()};
+  return std::make_unique<map_type>(
+    d_keys.num_rows(), unused_key, DEFAULT_HASH_TABLE_OCCUPANCY, stream);
+}
 
-  using map_type = concurrent_unordered_map<size_type,
-                                            size_type,
-                                            row_hasher<default_hash, keys_have_nulls>,
-                                            row_equality_comparator<keys_have_nulls>>;
+/**
+ * @brief Number of key rows inserted to estimate the number of groups
+ */
+constexpr size_type PRIVATIZED_SAMPLE_SIZE{4096};
 
-  using allocator_type = typename map_type::allocator_type;
+/**
+ * @brief Largest number of distinct sampled keys for which the groups are
+ * aggregated in shared memory
+ */
+constexpr size_type MAX_PRIVATIZED_GROUPS{1024};
 
-  bool const null_keys_are_equal{include_null_keys == null_policy::INCLUDE};
+/**
+ * @brief Bytes of shared memory available to a block of `compute_privatized_aggs`
+ */
+constexpr size_t MAX_PRIVATIZED_SHARED_MEMORY{48 * 1024};
 
-  row_hasher<default_hash, keys_have_nulls> hasher{d_keys};
-  row_equality_comparator<keys_have_nulls> rows_equal{d_keys, d_keys, null_keys_are_equal};
+/**
+ * @brief Number of blocks of `compute_privatized_aggs` launched per multiprocessor
+ */
+constexpr int PRIVATIZED_BLOCKS_PER_SM{4};
 
-  return map_type::create(compute_hash_table_size(d_keys.num_rows()),
-                          unused_key,
-                          unused_value,
-                          hasher,
-                          rows_equal,
-                          allocator_type(),
-                          stream);
+/**
+ * @brief Smallest number of flattened single pass aggregations for which the
+ * target of every row is found first, and the aggregations are then computed
+ * one element per thread by `aggregate_columns_by_row_targets`
+ */
+constexpr size_t MIN_FUSED_AGGREGATIONS{8};
+
+/**
+ * @brief Indicates whether all the flattened single pass aggregations can be
+ * computed in shared memory by `compute_privatized_aggs`
+ */
+bool can_use_privatized_aggs(table_view const& flattened_values,
+                             std::vector<aggregation::Kind> const& aggs)
+{
+  if (aggs.empty()) { return false; }
+  for (size_t i = 0; i < aggs.size(); i++) {
+    if (aggs[i] == aggregation::COUNT_VALID or aggs[i] == aggregation::COUNT_ALL) { continue; }
+    auto const type = flattened_values.column(i).type();
+    if (not(aggs[i] == aggregation::SUM or aggs[i] == aggregation::SUM_OF_SQUARES or
+            aggs[i] == aggregation::MIN or aggs[i] == aggregation::MAX) or
+        not cudf::is_numeric(type) or type.id() == type_id::BOOL8) {
+      return false;
+    }
+  }
+  return true;
 }
 
 /**
- * @brief Computes all aggregations from `requests` that require a single pass
- * over the data and stores the results in `sparse_results`
+ * @brief Inserts a sample of the key rows into `map` and returns the number of
+ * distinct keys in the sample
  *
- * @see groupby_null_templated()
+ * The sampled rows are not aggregated, they find their group in `map` when all
+ * rows are.
  */
-template <bool keys_have_nulls, typename Map>
-void compute_single_pass_aggs(table_view const& keys,
-                              std::vector<aggregation_request> const& requests,
-                              cudf::detail::result_cache* sparse_results,
-                              Map& map,
-                              null_policy include_null_keys,
-                              cudaStream_t stream)
+template <typename Hasher, typename KeyEqual>
+size_type count_distinct_sampled_keys(map_type::device_view map,
+                                      Hasher hasher,
+                                      KeyEqual key_equal,
+                                      size_type num_rows,
+                                      bitmask_type const* row_bitmask,
+                                      cudaStream_t stream)
 {
-  // flatten the aggs to a table that can be operated on by aggregate_row
-  table_view flattened_values;
-  std::vector<aggregation::Kind> aggs;
-  std::vector<size_t> col_ids;
-  std::tie(flattened_values, aggs, col_ids) = flatten_single_pass_aggs(requests);
+  auto const sample_size   = std::min(num_rows, PRIVATIZED_SAMPLE_SIZE);
+  auto const sample_stride = num_rows / sample_size;
+  rmm::device_scalar<size_type> num_groups(0, stream);
+
+  constexpr int tile_size{cudf::detail::DEFAULT_PROBE_TILE_SIZE};
+  constexpr int block_size{256};
+  cudf::detail::grid_1d config(sample_size, block_size / tile_size);
+
+  if (row_bitmask != nullptr) {
+    hash::count_sampled_groups<true, tile_size><<<config.num_blocks, block_size, 0, stream>>>(
+      map, hasher, key_equal, sample_size, sample_stride, num_groups.data(), row_bitmask);
+  } else {
+    hash::count_sampled_groups<false, tile_size><<<config.num_blocks, block_size, 0, stream>>>(
+      map, hasher, key_equal, sample_size, sample_stride, num_groups.data(), nullptr);
+  }
+  CHECK_CUDA(stream);
+  return num_groups.value(stream);
+}
+
+/**
+ * @brief Returns whether a row is the row of its group in the sparse output
+ */
+struct is_group_target {
+  size_type const* row_targets;
+
+  __device__ bool operator()(size_type i) const { return row_targets[i] == i; }
+};
+
+/**
+ * @brief Maps the sparse target of a row to its dense group, keeping skipped
+ * rows negative
+ */
+struct dense_group {
+  size_type const* sparse_to_dense;
+
+  __device__ size_type operator()(size_type target) const
+  {
+    return target < 0 ? target : sparse_to_dense[target];
+  }
+};
+
+/**
+ * @brief Computes the single pass aggregations `aggs` of keys with few distinct
+ * values into the sparse `d_sparse_table`, and populates `map`
+ *
+ * The target of every row is found first, which only reads the map once the
+ * few keys are stored. The targets are then numbered densely, and if the
+ * elements of all groups fit in shared memory, every block of
+ * `compute_privatized_aggs` aggregates its rows there before merging them into
+ * the sparse table. Otherwise, the rows are aggregated into their targets
+ * directly.
+ *
+ * @param row_targets Output sparse target of every row, of the size of the keys
+ */
+template <typename Hasher, typename KeyEqual>
+void compute_low_cardinality_aggs(map_type::device_view map,
+                                  Hasher hasher,
+                                  KeyEqual key_equal,
+                                  table_view const& flattened_values,
+                                  table_device_view const& d_values,
+                                  mutable_table_device_view const& d_sparse_table,
+                                  std::vector<aggregation::Kind> const& aggs,
+                                  aggregation::Kind const* d_aggs,
+                                  bitmask_type const* row_bitmask,
+                                  rmm::device_vector<size_type>& row_targets,
+                                  cudaStream_t stream)
+{
+  auto const num_rows = flattened_values.num_rows();
 
-  // make table that will hold sparse results
+  constexpr int tile_size{cudf::detail::DEFAULT_PROBE_TILE_SIZE};
+  constexpr int block_size{256};
+  cudf::detail::grid_1d probe_config(num_rows, block_size / tile_size);
+
+  if (row_bitmask != nullptr) {
+    hash::find_row_targets<true, tile_size><<<probe_config.num_blocks, block_size, 0, stream>>>(
+      map, hasher, key_equal, num_rows, row_targets.data().get(), row_bitmask);
+  } else {
+    hash::find_row_targets<false, tile_size><<<probe_config.num_blocks, block_size, 0, stream>>>(
+      map, hasher, key_equal, num_rows, row_targets.data().get(), nullptr);
+  }
+  CHECK_CUDA(stream);
+
+  // The groups are numbered in the order of their rows in the sparse output
+  rmm::device_vector<size_type> group_targets(num_rows);
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  auto const end      = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                        counting,
+                                        counting + num_rows,
+                                        group_targets.begin(),
+                                        is_group_target{row_targets.data().get()});
+  size_type const num_groups = end - group_targets.begin();
+
+  // Every privatized column is aligned for its widest possible target type
+  std::vector<size_type> element_offsets;
+  size_t shared_memory_size{0};
+  for (size_t i = 0; i < aggs.size(); i++) {
+    element_offsets.push_back(static_cast<size_type>(shared_memory_size));
+    auto const target_size =
+      cudf::size_of(cudf::detail::target_type(flattened_values.column(i).type(), aggs[i]));
+    shared_memory_size += (num_groups * target_size + sizeof(int64_t) - 1) /
+                          sizeof(int64_t) * sizeof(int64_t);
+  }
+  element_offsets.push_back(static_cast<size_type>(shared_memory_size));
+  shared_memory_size += num_groups * aggs.size() * sizeof(bool);
+
+  if (shared_memory_size > MAX_PRIVATIZED_SHARED_MEMORY) {
+    cudf::detail::grid_1d config(num_rows, block_size);
+    hash::aggregate_by_row_targets<<<config.num_blocks, block_size, 0, stream>>>(
+      num_rows, row_targets.data().get(), d_values, d_sparse_table, d_aggs);
+    CHECK_CUDA(stream);
+    return;
+  }
+
+  rmm::device_vector<size_type> sparse_to_dense(num_rows);
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  counting,
+                  counting + num_groups,
+                  group_targets.begin(),
+                  sparse_to_dense.begin());
+  rmm::device_vector<size_type> row_groups(num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    row_targets.begin(),
+                    row_targets.end(),
+                    row_groups.begin(),
+                    dense_group{sparse_to_dense.data().get()});
+
+  int device{0};
+  int num_sms{0};
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device));
+  cudf::detail::grid_1d config(num_rows, block_size);
+  auto const num_blocks = std::min(config.num_blocks, num_sms * PRIVATIZED_BLOCKS_PER_SM);
+
+  rmm::device_vector<size_type> d_element_offsets(element_offsets);
+  hash::compute_privatized_aggs<<<num_blocks, block_size, shared_memory_size, stream>>>(
+    num_rows,
+    row_groups.data().get(),
+    num_groups,
+    group_targets.data().get(),
+    d_values,
+    d_sparse_table,
+    d_aggs,
+    d_element_offsets.data().get());
+  CHECK_CUDA(stream);
+}
+
+/**
+ * @brief Makes the table of sparse results of the flattened single pass
+ * aggregations, initialized with their identities
+ */
+table make_sparse_table(table_view const& flattened_values,
+                        std::vector<aggregation::Kind> const& aggs,
+                        cudaStream_t stream)
+{
   std::vector<std::unique_ptr<column>> sparse_columns;
   std::transform(flattened_values.begin(),
                  flattened_values.end(),
@@ -269,41 +524,385 @@ void compute_single_pass_aggs(table_view const& keys,
   table sparse_table(std::move(sparse_columns));
   mutable_table_view table_view = sparse_table.mutable_view();
   cudf::detail::initialize_with_identity(table_view, aggs, stream);
+  return sparse_table;
+}
+
+/**
+ * @brief Adds the columns of `sparse_table` to `sparse_results`, as the
+ * results of the flattened single pass aggregations of their requests
+ */
+void store_sparse_results(table&& sparse_table,
+                          std::vector<aggregation::Kind> const& aggs,
+                          std::vector<size_t> const& col_ids,
+                          cudf::detail::result_cache* sparse_results)
+{
+  auto sparse_result_cols = sparse_table.release();
+  for (size_t i = 0; i < aggs.size(); i++) {
+    // Note that the cache will make a copy of this temporary aggregation
+    auto agg = std::make_unique<aggregation>(aggs[i]);
+    sparse_results->add_result(col_ids[i], *agg, std::move(sparse_result_cols[i]));
+  }
+}
+
+/**
+ * @brief Computes all aggregations from `requests` that require a single pass
+ * over the data and stores the results in `sparse_results`
+ *
+ * When the aggregations allow it and a sample of the keys has few distinct
+ * values, the groups are aggregated by `compute_low_cardinality_aggs`, which
+ * avoids the contention of all rows on the few elements of the output.
+ *
+ * Wide requests, of at least `MIN_FUSED_AGGREGATIONS` aggregations, probe the
+ * map once to find the target of every row, and then compute all aggregations
+ * from these targets in one kernel with one thread per element. Otherwise,
+ * every row is aggregated by the thread that inserts it.
+ *
+ * @param row_targets If not null, set to the sparse target of every row,
+ * negative for skipped rows, for the aggregations that pass over the rows again
+ *
+ * @see groupby_null_templated()
+ */
+template <bool keys_have_nulls>
+void compute_single_pass_aggs(table_view const& keys,
+                              table_device_view const& d_keys,
+                              std::vector<aggregation_request> const& requests,
+                              cudf::detail::result_cache* sparse_results,
+                              map_type& map,
+                              null_policy include_null_keys,
+                              rmm::device_vector<size_type>* row_targets,
+                              cudaStream_t stream)
+{
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby::hash::single_pass_aggs", keys.num_rows());
+  // flatten the aggs to a table that can be operated on by aggregate_row
+  table_view flattened_values;
+  std::vector<aggregation::Kind> aggs;
+  std::vector<size_t> col_ids;
+  std::tie(flattened_values, aggs, col_ids) = flatten_single_pass_aggs(requests);
+
+  table sparse_table = make_sparse_table(flattened_values, aggs, stream);
 
   // prepare to launch kernel to do the actual aggregation
   auto d_sparse_table = mutable_table_device_view::create(sparse_table);
   auto d_values       = table_device_view::create(flattened_values);
   rmm::device_vector<aggregation::Kind> d_aggs(aggs);
 
-  bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
+  // the rows with null keys are skipped, so the remaining nulls are fields of valid struct keys
+  bool skip_key_rows_with_nulls =
+    keys_have_nulls and include_null_keys == null_policy::EXCLUDE and has_nulls(keys);
+  bool const null_keys_are_equal{true};
+
+  row_hasher<default_hash, keys_have_nulls> hasher{d_keys};
+  row_equality_comparator<keys_have_nulls> rows_equal{d_keys, d_keys, null_keys_are_equal};
 
+  rmm::device_buffer row_bitmask;
   if (skip_key_rows_with_nulls) {
-    auto row_bitmask{bitmask_and(keys, rmm::mr::get_default_resource(), stream)};
-    thrust::for_each_n(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::make_counting_iterator(0),
-      keys.num_rows(),
-      hash::compute_single_pass_aggs<true, Map>{map,
-                                                keys.num_rows(),
-                                                *d_values,
-                                                *d_sparse_table,
-                                                d_aggs.data().get(),
-                                                static_cast<bitmask_type*>(row_bitmask.data())});
+    row_bitmask = bitmask_and(keys, rmm::mr::get_default_resource(), stream);
+  }
+  auto const d_row_bitmask =
+    skip_key_rows_with_nulls ? static_cast<bitmask_type const*>(row_bitmask.data()) : nullptr;
+
+  auto const num_rows = keys.num_rows();
+  rmm::device_vector<size_type> local_row_targets;
+  auto& targets = row_targets != nullptr ? *row_targets : local_row_targets;
+
+  // One tile of threads inserts every key row
+  constexpr int tile_size{cudf::detail::DEFAULT_PROBE_TILE_SIZE};
+  constexpr int block_size{256};
+  cudf::detail::grid_1d probe_config(num_rows, block_size / tile_size);
+
+  if (num_rows > 0 and can_use_privatized_aggs(flattened_values, aggs) and
+      count_distinct_sampled_keys(
+        map.view(), hasher, rows_equal, num_rows, d_row_bitmask, stream) <=
+        MAX_PRIVATIZED_GROUPS) {
+    targets.resize(num_rows);
+    compute_low_cardinality_aggs(map.view(),
+                                 hasher,
+                                 rows_equal,
+                                 flattened_values,
+                                 *d_values,
+                                 *d_sparse_table,
+                                 aggs,
+                                 d_aggs.data().get(),
+                                 d_row_bitmask,
+                                 targets,
+                                 stream);
+  } else if (aggs.size() >= MIN_FUSED_AGGREGATIONS) {
+    targets.resize(num_rows);
+    if (skip_key_rows_with_nulls) {
+      hash::find_row_targets<true, tile_size><<<probe_config.num_blocks, block_size, 0, stream>>>(
+        map.view(), hasher, rows_equal, num_rows, targets.data().get(), d_row_bitmask);
+    } else {
+      hash::find_row_targets<false, tile_size><<<probe_config.num_blocks, block_size, 0, stream>>>(
+        map.view(), hasher, rows_equal, num_rows, targets.data().get(), nullptr);
+    }
+    CHECK_CUDA(stream);
+
+    // Every thread aggregates the elements of a row in the different columns in turn
+    cudf::detail::grid_1d config(num_rows, block_size);
+    hash::aggregate_columns_by_row_targets<<<config.num_blocks, block_size, 0, stream>>>(
+      num_rows, targets.data().get(), *d_values, *d_sparse_table, d_aggs.data().get());
+    CHECK_CUDA(stream);
   } else {
-    thrust::for_each_n(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::make_counting_iterator(0),
-      keys.num_rows(),
-      hash::compute_single_pass_aggs<false, Map>{
-        map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(), nullptr});
+    if (row_targets != nullptr) { targets.resize(num_rows); }
+    auto const d_row_targets = row_targets != nullptr ? targets.data().get() : nullptr;
+    if (skip_key_rows_with_nulls) {
+      hash::compute_single_pass_aggs<true, tile_size>
+        <<<probe_config.num_blocks, block_size, 0, stream>>>(map.view(),
+                                                             hasher,
+                                                             rows_equal,
+                                                             num_rows,
+                                                             *d_values,
+                                                             *d_sparse_table,
+                                                             d_aggs.data().get(),
+                                                             d_row_bitmask,
+                                                             d_row_targets);
+    } else {
+      hash::compute_single_pass_aggs<false, tile_size>
+        <<<probe_config.num_blocks, block_size, 0, stream>>>(map.view(),
+                                                             hasher,
+                                                             rows_equal,
+                                                             num_rows,
+                                                             *d_values,
+                                                             *d_sparse_table,
+                                                             d_aggs.data().get(),
+                                                             nullptr,
+                                                             d_row_targets);
+    }
+    CHECK_CUDA(stream);
   }
 
-  // Add results back to sparse_results cache
-  auto sparse_result_cols = sparse_table.release();
-  for (size_t i = 0; i < aggs.size(); i++) {
-    // Note that the cache will make a copy of this temporary aggregation
-    auto agg = std::make_unique<aggregation>(aggs[i]);
-    sparse_results->add_result(col_ids[i], *agg, std::move(sparse_result_cols[i]));
+  store_sparse_results(std::move(sparse_table), aggs, col_ids, sparse_results);
+}
+
+/**
+ * @brief Computes all aggregations from `requests` that require a single pass
+ * over the data into the targets of the rows stored in a key index, and stores
+ * the results in `sparse_results`
+ */
+void compute_single_pass_aggs_by_row_targets(std::vector<aggregation_request> const& requests,
+                                             cudf::detail::result_cache* sparse_results,
+                                             rmm::device_vector<size_type> const& row_targets,
+                                             cudaStream_t stream)
+{
+  table_view flattened_values;
+  std::vector<aggregation::Kind> aggs;
+  std::vector<size_t> col_ids;
+  std::tie(flattened_values, aggs, col_ids) = flatten_single_pass_aggs(requests);
+
+  table sparse_table  = make_sparse_table(flattened_values, aggs, stream);
+  auto d_sparse_table = mutable_table_device_view::create(sparse_table);
+  auto d_values       = table_device_view::create(flattened_values);
+  rmm::device_vector<aggregation::Kind> d_aggs(aggs);
+
+  auto const num_rows = static_cast<size_type>(row_targets.size());
+  constexpr int block_size{256};
+  cudf::detail::grid_1d config(num_rows, block_size);
+  if (aggs.size() >= MIN_FUSED_AGGREGATIONS) {
+    hash::aggregate_columns_by_row_targets<<<config.num_blocks, block_size, 0, stream>>>(
+      num_rows, row_targets.data().get(), *d_values, *d_sparse_table, d_aggs.data().get());
+  } else {
+    hash::aggregate_by_row_targets<<<config.num_blocks, block_size, 0, stream>>>(
+      num_rows, row_targets.data().get(), *d_values, *d_sparse_table, d_aggs.data().get());
+  }
+  CHECK_CUDA(stream);
+
+  store_sparse_results(std::move(sparse_table), aggs, col_ids, sparse_results);
+}
+
+/**
+ * @brief Returns whether a sparse group has more than `min_count` valid values
+ */
+struct has_enough_values {
+  size_type const* counts;
+  size_type min_count;
+
+  __device__ bool operator()(size_type i) const { return counts[i] > min_count; }
+};
+
+/**
+ * @brief Returns the mean of a sparse group from its sum and count of valid values
+ */
+template <typename SumType>
+struct sparse_mean {
+  SumType const* sums;
+  size_type const* counts;
+
+  __device__ double operator()(size_type i) const
+  {
+    return counts[i] > 0 ? static_cast<double>(sums[i]) / counts[i] : 0.0;
+  }
+};
+
+/**
+ * @brief Returns the variance, or standard deviation, of a sparse group from its
+ * sum of squared differences from the mean, M2
+ */
+struct sparse_variance {
+  double const* m2;
+  size_type const* counts;
+  size_type ddof;
+  bool take_sqrt;
+
+  __device__ double operator()(size_type i) const
+  {
+    if (counts[i] <= 0 or counts[i] - ddof <= 0) { return 0.0; }
+    double const variance = m2[i] / (counts[i] - ddof);
+    return take_sqrt ? sqrt(variance) : variance;
+  }
+};
+
+/**
+ * @brief Makes a sparse FLOAT64 result of `size` rows whose row `i` is
+ * `transform(i)`, and null where `is_valid(i)` is false
+ */
+template <typename Transform>
+std::unique_ptr<column> make_sparse_result(size_type size,
+                                           Transform transform,
+                                           has_enough_values is_valid,
+                                           cudaStream_t stream)
+{
+  auto result =
+    make_numeric_column(data_type{type_id::FLOAT64}, size, mask_state::UNALLOCATED, stream);
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    counting,
+                    counting + size,
+                    result->mutable_view().data<double>(),
+                    transform);
+  auto null_mask = cudf::detail::valid_if(counting, counting + size, is_valid, stream);
+  result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  return result;
+}
+
+struct compute_sparse_mean {
+  template <typename SumType>
+  std::enable_if_t<std::is_arithmetic<SumType>::value, std::unique_ptr<column>> operator()(
+    column_view const& sums, column_view const& counts, cudaStream_t stream)
+  {
+    return make_sparse_result(sums.size(),
+                              sparse_mean<SumType>{sums.data<SumType>(), counts.data<size_type>()},
+                              has_enough_values{counts.data<size_type>(), 0},
+                              stream);
+  }
+
+  template <typename SumType, typename... Args>
+  std::enable_if_t<not std::is_arithmetic<SumType>::value, std::unique_ptr<column>> operator()(
+    Args&&... args)
+  {
+    CUDF_FAIL("Only numeric types are supported in hash-based mean");
+  }
+};
+
+/**
+ * @brief Accumulates the squared difference of every valid element from the
+ * mean of its row's target into the sparse `m2`
+ */
+template <typename Source>
+struct accumulate_m2 {
+  column_device_view values;
+  size_type const* row_targets;
+  double const* means;
+  double* m2;
+
+  __device__ void operator()(size_type i) const
+  {
+    auto const target = row_targets[i];
+    if (target < 0 or values.is_null(i)) { return; }
+    double const delta = static_cast<double>(values.element<Source>(i)) - means[target];
+    atomicAdd(m2 + target, delta * delta);
+  }
+};
+
+struct compute_sparse_m2 {
+  template <typename Source>
+  std::enable_if_t<std::is_arithmetic<Source>::value, void> operator()(
+    size_type const* row_targets,
+    column_view const& values,
+    double const* means,
+    double* m2,
+    cudaStream_t stream)
+  {
+    auto d_values = column_device_view::create(values, stream);
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       values.size(),
+                       accumulate_m2<Source>{*d_values, row_targets, means, m2});
+  }
+
+  template <typename Source, typename... Args>
+  std::enable_if_t<not std::is_arithmetic<Source>::value, void> operator()(Args&&... args)
+  {
+    CUDF_FAIL("Only numeric types are supported in hash-based std/variance");
+  }
+};
+
+/**
+ * @brief Computes the compound aggregations from `requests` out of the single
+ * pass results in `sparse_results`, and stores their sparse results there too
+ *
+ * MEAN divides SUM by COUNT_VALID. VARIANCE and STD take a second pass over
+ * the values to sum their squared differences from their group mean, M2, which
+ * is computed once per request from the target of every row and shared by all
+ * their `ddof`s.
+ *
+ * @param row_targets The sparse target of every row, negative for skipped rows
+ *
+ * @see groupby_null_templated()
+ */
+void compute_compound_aggs(std::vector<aggregation_request> const& requests,
+                           cudf::detail::result_cache* sparse_results,
+                           rmm::device_vector<size_type> const& row_targets,
+                           cudaStream_t stream)
+{
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby::hash::compound_aggs", row_targets.size());
+  auto const sum_agg   = make_sum_aggregation();
+  auto const count_agg = make_count_aggregation();
+  auto const mean_agg  = make_mean_aggregation();
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const& values = requests[i].values;
+    std::unique_ptr<column> m2;
+
+    for (auto&& agg : requests[i].aggregations) {
+      if (not is_compound_hash_aggregation(agg->kind) or sparse_results->has_result(i, *agg)) {
+        continue;
+      }
+      column_view const counts = sparse_results->get_result(i, *count_agg);
+      if (not sparse_results->has_result(i, *mean_agg)) {
+        column_view const sums = sparse_results->get_result(i, *sum_agg);
+        sparse_results->add_result(
+          i, *mean_agg, type_dispatcher(sums.type(), compute_sparse_mean{}, sums, counts, stream));
+      }
+      if (agg->kind == aggregation::MEAN) { continue; }
+
+      if (m2 == nullptr) {
+        m2 = make_numeric_column(
+          data_type{type_id::FLOAT64}, values.size(), mask_state::UNALLOCATED, stream);
+        thrust::fill_n(rmm::exec_policy(stream)->on(stream),
+                       m2->mutable_view().data<double>(),
+                       values.size(),
+                       0.0);
+        type_dispatcher(values.type(),
+                        compute_sparse_m2{},
+                        row_targets.data().get(),
+                        values,
+                        sparse_results->get_result(i, *mean_agg).data<double>(),
+                        m2->mutable_view().data<double>(),
+                        stream);
+      }
+
+      auto const ddof = static_cast<cudf::detail::std_var_aggregation const&>(*agg)._ddof;
+      sparse_results->add_result(
+        i,
+        *agg,
+        make_sparse_result(
+          values.size(),
+          sparse_variance{m2->view().data<double>(),
+                          counts.data<size_type>(),
+                          ddof,
+                          agg->kind == aggregation::STD},
+          has_enough_values{counts.data<size_type>(), std::max<size_type>(ddof, 0)},
+          stream));
+    }
   }
 }
 
@@ -311,31 +910,115 @@ void compute_single_pass_aggs(table_view const& keys,
  * @brief Computes and returns a device vector containing all populated keys in
  * `map`.
  */
-template <typename Map>
-std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(Map map,
+std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(map_type const& map,
                                                                            size_type num_keys,
                                                                            cudaStream_t stream = 0)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby::hash::extract_populated_keys", map.capacity());
   rmm::device_vector<size_type> populated_keys(num_keys);
 
-  auto get_key = [] __device__(auto const& element) {
-    size_type key, value;
-    thrust::tie(key, value) = element;
-    return key;
-  };
-
   auto end_it = thrust::copy_if(
     rmm::exec_policy(stream)->on(stream),
-    thrust::make_transform_iterator(map.data(), get_key),
-    thrust::make_transform_iterator(map.data() + map.capacity(), get_key),
+    map.keys(),
+    map.keys() + map.capacity(),
     populated_keys.begin(),
-    [unused_key = map.get_unused_key()] __device__(size_type key) { return key != unused_key; });
+    [unused_key = map.empty_key()] __device__(size_type key) { return key != unused_key; });
 
   size_type map_size = end_it - populated_keys.begin();
 
   return std::make_pair(std::move(populated_keys), map_size);
 }
 
+/// Indicates whether any request holds an aggregation computed from sketches
+bool has_sketch_aggs(std::vector<aggregation_request> const& requests)
+{
+  return std::any_of(requests.begin(), requests.end(), [](auto const& r) {
+    return std::any_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
+      return is_sketch_hash_aggregation(a->kind);
+    });
+  });
+}
+
+/**
+ * @brief Indicates whether any request holds an aggregation that passes over
+ * the rows again after the single pass aggregations
+ */
+bool has_multi_pass_aggs(std::vector<aggregation_request> const& requests)
+{
+  return std::any_of(requests.begin(), requests.end(), [](auto const& r) {
+    return std::any_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
+      return is_sketch_hash_aggregation(a->kind) or a->kind == aggregation::VARIANCE or
+             a->kind == aggregation::STD;
+    });
+  });
+}
+
+/**
+ * @brief Computes the HyperLogLog sketch aggregations from `requests` into
+ * `dense_results`, once the sparse target of every row is known
+ *
+ * The targets are numbered in the order of the populated keys of `gather_map`,
+ * so that the sketches of all groups, which are too large to be sparse, are
+ * computed dense in one hashing pass over the values of every request.
+ *
+ * @see groupby_null_templated()
+ */
+void compute_sketch_aggs(std::vector<aggregation_request> const& requests,
+                         cudf::detail::result_cache* dense_results,
+                         rmm::device_vector<size_type> const& row_targets,
+                         rmm::device_vector<size_type> const& gather_map,
+                         size_type map_size,
+                         cudaStream_t stream,
+                         rmm::mr::device_memory_resource* mr)
+{
+  if (not has_sketch_aggs(requests)) { return; }
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby::hash::sketch_aggs", map_size);
+
+  auto const num_rows = static_cast<size_type>(row_targets.size());
+  rmm::device_vector<size_type> sparse_to_dense(num_rows);
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  counting,
+                  counting + map_size,
+                  gather_map.begin(),
+                  sparse_to_dense.begin());
+  rmm::device_vector<size_type> row_groups(num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    row_targets.begin(),
+                    row_targets.end(),
+                    row_groups.begin(),
+                    dense_group{sparse_to_dense.data().get()});
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    for (auto&& agg : requests[i].aggregations) {
+      if (not is_sketch_hash_aggregation(agg->kind) or dense_results->has_result(i, *agg)) {
+        continue;
+      }
+      auto const& hll_agg = static_cast<cudf::detail::hyperloglog_aggregation const&>(*agg);
+      auto const sketch_agg =
+        make_hyperloglog_aggregation(hll_agg._precision, hll_agg._null_handling);
+      if (not dense_results->has_result(i, *sketch_agg)) {
+        dense_results->add_result(i,
+                                  *sketch_agg,
+                                  cudf::detail::hyperloglog_sketches(requests[i].values,
+                                                                     row_groups.data().get(),
+                                                                     map_size,
+                                                                     hll_agg._precision,
+                                                                     hll_agg._null_handling,
+                                                                     mr,
+                                                                     stream));
+      }
+      if (agg->kind == aggregation::APPROX_NUNIQUE) {
+        dense_results->add_result(
+          i,
+          *agg,
+          cudf::detail::hyperloglog_estimates(
+            dense_results->get_result(i, *sketch_agg), hll_agg._precision, mr, stream));
+      }
+    }
+  }
+}
+
 /**
  * @brief Computes groupby using hash table.
  *
@@ -354,7 +1037,9 @@ std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(Map m
  *
  * All the aggregations which can be computed in a single pass are computed
  * first, in a combined kernel. Then using these results, aggregations that
- * require multiple passes, will be computed.
+ * require multiple passes, will be computed. The single pass records the
+ * sparse target of every row when these aggregations or `index` need it, so
+ * that no row probes the hash map twice.
  *
  * Finally, using the hash map, we generate a vector of indices of populated
  * values in sparse result columns. Then, for each aggregation originally
@@ -362,28 +1047,44 @@ std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(Map m
  * results using the aforementioned index vector. Dense results are stored into
  * the in/out parameter `cache`.
  *
+ * If `index` is not null, the sparse target of every row and the gather map
+ * are moved into it, so that later calls skip the hash map.
  */
 template <bool keys_have_nulls>
 std::unique_ptr<table> groupby_null_templated(table_view const& keys,
                                               std::vector<aggregation_request> const& requests,
                                               cudf::detail::result_cache* cache,
                                               null_policy include_null_keys,
+                                              key_index* index,
                                               cudaStream_t stream,
                                               rmm::mr::device_memory_resource* mr)
 {
-  auto d_keys = table_device_view::create(keys);
-  auto map    = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, stream);
+  // struct keys are hashed and compared by their leaves, and dictionary keys by their indices;
+  // both are gathered from `keys`
+  auto const flattened   = structs::detail::flatten_nested_columns(keys, {}, {}, stream);
+  auto const hashed_keys = dictionary::detail::indices_view(flattened.flattened_columns());
+  auto d_keys            = table_device_view::create(hashed_keys);
+  auto map               = create_hash_map(*d_keys, stream);
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash map
   cudf::detail::result_cache sparse_results(requests.size());
 
-  // Compute all single pass aggs first
-  compute_single_pass_aggs<keys_have_nulls>(
-    keys, requests, &sparse_results, *map, include_null_keys, stream);
+  // Compute all single pass aggs first, keeping the target of every row for the
+  // aggregations that take another pass over the rows
+  rmm::device_vector<size_type> row_targets;
+  bool const keep_row_targets = index != nullptr or has_multi_pass_aggs(requests);
+  compute_single_pass_aggs<keys_have_nulls>(keys,
+                                            *d_keys,
+                                            requests,
+                                            &sparse_results,
+                                            *map,
+                                            include_null_keys,
+                                            keep_row_targets ? &row_targets : nullptr,
+                                            stream);
 
   // Now continue with remaining multi-pass aggs
-  // <placeholder>
+  compute_compound_aggs(requests, &sparse_results, row_targets, stream);
 
   // Extract the populated indices from the hash map and create a gather map.
   // Gathering using this map from sparse results will give dense results.
@@ -394,8 +1095,53 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
   // Compact all results from sparse_results and insert into cache
   sparse_to_dense_results(requests, sparse_results, cache, gather_map, map_size, stream, mr);
 
-  return cudf::detail::gather(
+  // Sketch the groups, which are dense now
+  compute_sketch_aggs(requests, cache, row_targets, gather_map, map_size, stream, mr);
+
+  auto unique_keys = cudf::detail::gather(
     keys, gather_map.begin(), gather_map.begin() + map_size, false, mr, stream);
+
+  if (index != nullptr) {
+    gather_map.resize(map_size);
+    gather_map.shrink_to_fit();
+    index->row_targets = std::move(row_targets);
+    index->gather_map  = std::move(gather_map);
+    index->num_groups  = map_size;
+  }
+  return unique_keys;
+}
+
+/**
+ * @brief Computes groupby into the groups stored in `index`, without hashing
+ * or comparing any key
+ *
+ * @see groupby_null_templated()
+ */
+std::unique_ptr<table> groupby_with_key_index(table_view const& keys,
+                                              std::vector<aggregation_request> const& requests,
+                                              cudf::detail::result_cache* cache,
+                                              key_index const& index,
+                                              cudaStream_t stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  cudf::detail::result_cache sparse_results(requests.size());
+
+  compute_single_pass_aggs_by_row_targets(requests, &sparse_results, index.row_targets, stream);
+
+  compute_compound_aggs(requests, &sparse_results, index.row_targets, stream);
+
+  sparse_to_dense_results(
+    requests, sparse_results, cache, index.gather_map, index.num_groups, stream, mr);
+
+  compute_sketch_aggs(
+    requests, cache, index.row_targets, index.gather_map, index.num_groups, stream, mr);
+
+  return cudf::detail::gather(keys,
+                              index.gather_map.begin(),
+                              index.gather_map.begin() + index.num_groups,
+                              false,
+                              mr,
+                              stream);
 }
 
 }  // namespace
@@ -413,8 +1159,11 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
 bool can_use_hash_groupby(table_view const& keys, std::vector<aggregation_request> const& requests)
 {
   return std::all_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
-    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
-      return is_hash_aggregation(a->kind);
+    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [&r](auto const& a) {
+      return is_hash_aggregation(a->kind) and
+             (not is_numeric_hash_aggregation(a->kind) or cudf::is_numeric(r.values.type())) and
+             (not cudf::is_fixed_point(r.values.type()) or
+              is_fixed_point_hash_aggregation(a->kind));
     });
   });
 }
@@ -424,18 +1173,21 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   std::vector<aggregation_request> const& requests,
   null_policy include_null_keys,
+  key_index* index,
   cudaStream_t stream,
   rmm::mr::device_memory_resource* mr)
 {
   cudf::detail::result_cache cache(requests.size());
 
   std::unique_ptr<table> unique_keys;
-  if (has_nulls(keys)) {
+  if (index != nullptr and index->is_populated()) {
+    unique_keys = groupby_with_key_index(keys, requests, &cache, *index, stream, mr);
+  } else if (structs::detail::has_nested_nulls(keys)) {
     unique_keys =
-      groupby_null_templated<true>(keys, requests, &cache, include_null_keys, stream, mr);
+      groupby_null_templated<true>(keys, requests, &cache, include_null_keys, index, stream, mr);
   } else {
     unique_keys =
-      groupby_null_templated<false>(keys, requests, &cache, include_null_keys, stream, mr);
+      groupby_null_templated<false>(keys, requests, &cache, include_null_keys, index, stream, mr);
   }
 
   return std::make_pair(std::move(unique_keys), extract_results(requests, cache));
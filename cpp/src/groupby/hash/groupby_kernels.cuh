@@ -18,9 +18,12 @@
 
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/groupby.hpp>
 #include <cudf/utilities/bit.hpp>
 
+#include <cooperative_groups.h>
+
 namespace cudf {
 namespace groupby {
 namespace detail {
@@ -29,27 +32,25 @@ namespace hash {
  * @brief Compute single-pass aggregations and store results into a sparse
  * `output_values` table, and populate `map` with indices of unique keys
  *
- * The hash map is built by inserting every row `i` from the `keys` and
- * `values` tables as a single (key,value) pair. When the pair is inserted, if
- * the key was not already present in the map, then the corresponding value is
- * simply copied to the output. If the key was already present in the map,
- * then the inserted `values` row is aggregated with the existing row. This
- * aggregation is done for every element `j` in the row by applying aggregation
- * operation `j` between the new and existing element.
+ * The hash map is built by inserting the index `i` of every row of the `keys`
+ * table. When the index is inserted, if no equal key row was already present
+ * in the map, then the corresponding `values` row is simply copied to the
+ * output. If an equal key row was already present in the map, then the
+ * inserted `values` row is aggregated with the existing row. This aggregation
+ * is done for every element `j` in the row by applying aggregation operation
+ * `j` between the new and existing element.
  *
  * Instead of storing the entire rows from `input_keys` and `input_values` in
  * the hashmap, we instead store the row indices. For example, when inserting
  * row at index `i` from `input_keys` into the hash map, the value `i` is what
- * gets stored for the hash map's "key". It is assumed the `map` was constructed
- * with a custom comparator that uses these row indices to check for equality
- * between key rows. For example, comparing two keys `k0` and `k1` will compare
- * the two rows `input_keys[k0] ?= input_keys[k1]`
+ * gets stored for the hash map's "key". `key_equal` uses these row indices to
+ * check for equality between key rows. For example, comparing two keys `k0`
+ * and `k1` will compare the two rows `input_keys[k0] ?= input_keys[k1]`
  *
- * Likewise, we store the row indices for the hash maps "values". These indices
- * index into the `output_values` table. For a given key `k` (which is an index
- * into `input_keys`), the corresponding value `v` indexes into `output_values`
- * and stores the result of aggregating rows from `input_values` from rows of
- * `input_keys` equivalent to the row at `k`.
+ * The stored key also indexes into the `output_values` table: for a given key
+ * `k` (which is an index into `input_keys`), row `k` of `output_values` stores
+ * the result of aggregating rows from `input_values` from rows of `input_keys`
+ * equivalent to the row at `k`.
  *
  * The exact size of the result is not known a priori, but can be upper bounded
  * by the number of rows in `input_keys` & `input_values`. Therefore, it is
@@ -57,61 +58,497 @@ namespace hash {
  * rows. In this way, after all rows are aggregated, `output_values` will likely
  * be "sparse", meaning that not all rows contain the result of an aggregation.
  *
+ * Every row is inserted by a tile of `tile_size` threads probing the map
+ * together; the first thread of the tile then aggregates the row.
+ *
  * @tparam skip_rows_with_nulls Indicates if rows in `input_keys` containing
  * null values should be skipped. It `true`, it is assumed `row_bitmask` is a
  * bitmask where bit `i` indicates the presence of a null value in row `i`.
- * @tparam Map The type of the hash map
+ * @tparam tile_size The number of threads cooperating on the insert of a row
+ * @tparam MapView The type of the device view of the hash map
+ * @tparam Hasher The type of the key row hasher
+ * @tparam KeyEqual The type of the key row equality comparator
+ *
+ * @param map Hash map to insert the key row indices into
+ * @param hasher Hasher of the rows of input keys
+ * @param key_equal Equality comparator of the rows of input keys
+ * @param num_keys The number of rows in input keys table
+ * @param input_values The table whose rows will be aggregated in the values
+ * of the hash map
+ * @param output_values Table that stores the results of aggregating rows of
+ * `input_values`.
+ * @param aggs The set of aggregation operations to perform accross the
+ * columns of the `input_values` rows
+ * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
+ * value in row `i` of input keys. Only used if `skip_rows_with_nulls` is `true`
+ * @param row_targets Optional output of the target of every row, as stored by
+ * `find_row_targets`, or `nullptr`
  */
-template <bool skip_rows_with_nulls, typename Map>
-struct compute_single_pass_aggs {
-  Map map;
-  size_type num_keys;
-  table_device_view input_values;
-  mutable_table_device_view output_values;
-  aggregation::Kind const* __restrict__ aggs;
-  bitmask_type const* __restrict__ row_bitmask;
-
-  /**
-   * @brief Construct a new compute_single_pass_aggs functor object
-   *
-   * @param map Hash map object to insert key,value pairs into.
-   * @param num_keys The number of rows in input keys table
-   * @param input_values The table whose rows will be aggregated in the values
-   * of the hash map
-   * @param output_values Table that stores the results of aggregating rows of
-   * `input_values`.
-   * @param aggs The set of aggregation operations to perform accross the
-   * columns of the `input_values` rows
-   * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
-   * value in row `i` of input keys. Only used if `skip_rows_with_nulls` is `true`
-   */
-  compute_single_pass_aggs(Map map,
-                           size_type num_keys,
-                           table_device_view input_values,
-                           mutable_table_device_view output_values,
-                           aggregation::Kind const* aggs,
-                           bitmask_type const* row_bitmask)
-    : map(map),
-      num_keys(num_keys),
-      input_values(input_values),
-      output_values(output_values),
-      aggs(aggs),
-      row_bitmask(row_bitmask)
-  {
-  }
-
-  __device__ void operator()(size_type i)
-  {
+template <bool skip_rows_with_nulls,
+          int tile_size,
+          typename MapView,
+          typename Hasher,
+          typename KeyEqual>
+__global__ void compute_single_pass_aggs(MapView map,
+                                         Hasher hasher,
+                                         KeyEqual key_equal,
+                                         size_type num_keys,
+                                         table_device_view input_values,
+                                         mutable_table_device_view output_values,
+                                         aggregation::Kind const* __restrict__ aggs,
+                                         bitmask_type const* __restrict__ row_bitmask,
+                                         size_type* __restrict__ row_targets)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  size_type const stride = (blockDim.x * gridDim.x) / tile_size;
+
+  for (size_type i = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size; i < num_keys;
+       i += stride) {
+    size_type target{-1};
     if (not skip_rows_with_nulls or cudf::bit_is_set(row_bitmask, i)) {
-      auto result = map.insert(thrust::make_pair(i, i));
+      hash_value_type const hash = tile.shfl(tile.thread_rank() == 0 ? hasher(i) : 0, 0);
+      target                     = map.insert_or_find(tile, i, hash, key_equal);
+
+      if (tile.thread_rank() == 0) {
+        cudf::detail::aggregate_row<true, true>(output_values, target, input_values, i, aggs);
+      }
+    }
+    if (row_targets != nullptr and tile.thread_rank() == 0) { row_targets[i] = target; }
+  }
+}
+
+/**
+ * @brief Inserts every `sample_stride`-th row of the keys, up to `sample_size`
+ * rows, into `map` and counts the inserted rows that started a new group
+ *
+ * This counts the distinct keys of the sample, a lower bound on the number of
+ * groups, without aggregating anything: the rows are aggregated later by
+ * whichever kernel the estimate selects, which finds the groups already stored.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in `input_keys` containing
+ * null values should be skipped, see `compute_single_pass_aggs`
+ * @tparam tile_size The number of threads cooperating on the insert of a row
+ *
+ * @param map Hash map to insert the key row indices into
+ * @param hasher Hasher of the rows of input keys
+ * @param key_equal Equality comparator of the rows of input keys
+ * @param sample_size The number of rows to insert
+ * @param sample_stride The distance between two inserted rows
+ * @param num_groups Counter of the distinct keys of the sample, initialized to zero
+ * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
+ * value in row `i` of input keys. Only used if `skip_rows_with_nulls` is `true`
+ */
+template <bool skip_rows_with_nulls,
+          int tile_size,
+          typename MapView,
+          typename Hasher,
+          typename KeyEqual>
+__global__ void count_sampled_groups(MapView map,
+                                     Hasher hasher,
+                                     KeyEqual key_equal,
+                                     size_type sample_size,
+                                     size_type sample_stride,
+                                     size_type* num_groups,
+                                     bitmask_type const* __restrict__ row_bitmask)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  size_type const stride = (blockDim.x * gridDim.x) / tile_size;
+
+  for (size_type s = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size; s < sample_size;
+       s += stride) {
+    size_type const i = s * sample_stride;
+    if (not skip_rows_with_nulls or cudf::bit_is_set(row_bitmask, i)) {
+      hash_value_type const hash = tile.shfl(tile.thread_rank() == 0 ? hasher(i) : 0, 0);
+      auto const target          = map.insert_or_find(tile, i, hash, key_equal);
+
+      if (tile.thread_rank() == 0 and target == i) { atomicAdd(num_groups, size_type{1}); }
+    }
+  }
+}
+
+/**
+ * @brief Inserts every row of the keys into `map` and stores the row index of
+ * the group of every row, the group's row in the sparse output, in `row_targets`
+ *
+ * The rows that are skipped because of null keys get the target `-1`.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in `input_keys` containing
+ * null values should be skipped, see `compute_single_pass_aggs`
+ * @tparam tile_size The number of threads cooperating on the insert of a row
+ *
+ * @param map Hash map to insert the key row indices into
+ * @param hasher Hasher of the rows of input keys
+ * @param key_equal Equality comparator of the rows of input keys
+ * @param num_keys The number of rows in input keys table
+ * @param row_targets Output target of every row
+ * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
+ * value in row `i` of input keys. Only used if `skip_rows_with_nulls` is `true`
+ */
+template <bool skip_rows_with_nulls,
+          int tile_size,
+          typename MapView,
+          typename Hasher,
+          typename KeyEqual>
+__global__ void find_row_targets(MapView map,
+                                 Hasher hasher,
+                                 KeyEqual key_equal,
+                                 size_type num_keys,
+                                 size_type* __restrict__ row_targets,
+                                 bitmask_type const* __restrict__ row_bitmask)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  size_type const stride = (blockDim.x * gridDim.x) / tile_size;
+
+  for (size_type i = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size; i < num_keys;
+       i += stride) {
+    size_type target{-1};
+    if (not skip_rows_with_nulls or cudf::bit_is_set(row_bitmask, i)) {
+      hash_value_type const hash = tile.shfl(tile.thread_rank() == 0 ? hasher(i) : 0, 0);
+      target                     = map.insert_or_find(tile, i, hash, key_equal);
+    }
+    if (tile.thread_rank() == 0) { row_targets[i] = target; }
+  }
+}
+
+/**
+ * @brief Aggregates every row of `input_values` into the row `row_targets[i]`
+ * of the sparse `output_values`, as `compute_single_pass_aggs` does once the
+ * targets are known. Rows with a negative target are skipped.
+ */
+__global__ void aggregate_by_row_targets(size_type num_rows,
+                                         size_type const* __restrict__ row_targets,
+                                         table_device_view input_values,
+                                         mutable_table_device_view output_values,
+                                         aggregation::Kind const* __restrict__ aggs)
+{
+  size_type const stride = blockDim.x * gridDim.x;
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < num_rows; i += stride) {
+    auto const target = row_targets[i];
+    if (target >= 0) {
+      cudf::detail::aggregate_row<true, true>(output_values, target, input_values, i, aggs);
+    }
+  }
+}
+
+/**
+ * @brief Aggregates every element of `input_values` into the element of the
+ * row `row_targets[i]` of the same column of the sparse `output_values`
+ *
+ * Unlike `aggregate_by_row_targets`, every thread aggregates a single element,
+ * and the threads of a warp aggregate consecutive rows of the same column, so
+ * that the reads of wide tables are coalesced and every row's target is only
+ * read once per column instead of the whole row being processed serially.
+ * Rows with a negative target are skipped.
+ */
+__global__ void aggregate_columns_by_row_targets(size_type num_rows,
+                                                 size_type const* __restrict__ row_targets,
+                                                 table_device_view input_values,
+                                                 mutable_table_device_view output_values,
+                                                 aggregation::Kind const* __restrict__ aggs)
+{
+  int64_t const num_elements = static_cast<int64_t>(num_rows) * input_values.num_columns();
+  int64_t const stride       = static_cast<int64_t>(blockDim.x) * gridDim.x;
+  for (int64_t e = threadIdx.x + static_cast<int64_t>(blockIdx.x) * blockDim.x; e < num_elements;
+       e += stride) {
+    auto const col    = static_cast<size_type>(e / num_rows);
+    auto const i      = static_cast<size_type>(e % num_rows);
+    auto const target = row_targets[i];
+    if (target >= 0) {
+      cudf::detail::dispatch_type_and_aggregation(
+        input_values.column(col).type(),
+        aggs[col],
+        cudf::detail::elementwise_aggregator<true, true>{},
+        output_values.column(col),
+        target,
+        input_values.column(col),
+        i);
+    }
+  }
+}
+
+/**
+ * @brief Indicates whether the aggregation `k` of `Source` elements can be
+ * accumulated in shared memory by `compute_privatized_aggs`
+ */
+template <typename Source, aggregation::Kind k>
+constexpr bool is_privatized_aggregation()
+{
+  return cudf::detail::is_valid_aggregation<Source, k>() and
+         ((k == aggregation::COUNT_VALID) or (k == aggregation::COUNT_ALL) or
+          (std::is_arithmetic<Source>::value and not std::is_same<Source, bool>::value and
+           ((k == aggregation::SUM) or (k == aggregation::SUM_OF_SQUARES) or
+            (k == aggregation::MIN) or (k == aggregation::MAX))));
+}
+
+/**
+ * @brief Operations of the aggregation `k` on the elements of a privatized table:
+ * `update` aggregates a source value into an element, and `merge` aggregates an
+ * element into another one
+ */
+template <aggregation::Kind k>
+struct privatized_operator {
+};
+
+template <>
+struct privatized_operator<aggregation::SUM> {
+  template <typename T>
+  __device__ static void update(T* target, T value)
+  {
+    atomicAdd(target, value);
+  }
+  template <typename T>
+  __device__ static void merge(T* target, T value)
+  {
+    atomicAdd(target, value);
+  }
+};
+
+template <>
+struct privatized_operator<aggregation::SUM_OF_SQUARES> {
+  template <typename T>
+  __device__ static void update(T* target, T value)
+  {
+    atomicAdd(target, value * value);
+  }
+  template <typename T>
+  __device__ static void merge(T* target, T value)
+  {
+    atomicAdd(target, value);
+  }
+};
 
-      cudf::detail::aggregate_row<true, true>(
-        output_values, result.first->second, input_values, i, aggs);
+template <>
+struct privatized_operator<aggregation::MIN> {
+  template <typename T>
+  __device__ static void update(T* target, T value)
+  {
+    atomicMin(target, value);
+  }
+  template <typename T>
+  __device__ static void merge(T* target, T value)
+  {
+    atomicMin(target, value);
+  }
+};
+
+template <>
+struct privatized_operator<aggregation::MAX> {
+  template <typename T>
+  __device__ static void update(T* target, T value)
+  {
+    atomicMax(target, value);
+  }
+  template <typename T>
+  __device__ static void merge(T* target, T value)
+  {
+    atomicMax(target, value);
+  }
+};
+
+template <>
+struct privatized_operator<aggregation::COUNT_VALID> {
+  template <typename T>
+  __device__ static void merge(T* target, T value)
+  {
+    atomicAdd(target, value);
+  }
+};
+
+template <>
+struct privatized_operator<aggregation::COUNT_ALL> {
+  template <typename T>
+  __device__ static void merge(T* target, T value)
+  {
+    atomicAdd(target, value);
+  }
+};
+
+/**
+ * @brief Dispatched functor initializing the privatized elements of a column
+ * with the identity of their aggregation
+ */
+struct initialize_privatized_column {
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<is_privatized_aggregation<Source, k>()> operator()(
+    void* elements, size_type num_groups) const noexcept
+  {
+    using Target        = cudf::detail::target_type_t<Source, k>;
+    auto const identity = cudf::detail::corresponding_operator_t<k>::template identity<Target>();
+    for (size_type g = threadIdx.x; g < num_groups; g += blockDim.x) {
+      static_cast<Target*>(elements)[g] = identity;
     }
   }
+
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<not is_privatized_aggregation<Source, k>()> operator()(
+    void*, size_type) const noexcept
+  {
+    release_assert(false and "Invalid source type and aggregation combination.");
+  }
 };
 
-// TODO (dm): variance kernel
+/**
+ * @brief Dispatched functor aggregating a source element into the privatized
+ * element of its group, and marking the element as updated
+ */
+struct update_privatized_element {
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<is_privatized_aggregation<Source, k>() and
+                              k != aggregation::COUNT_VALID and k != aggregation::COUNT_ALL>
+  operator()(void* elements,
+             bool* updated,
+             size_type group,
+             column_device_view source,
+             size_type source_index) const noexcept
+  {
+    if (source.is_null(source_index)) { return; }
+    using Target = cudf::detail::target_type_t<Source, k>;
+    privatized_operator<k>::update(static_cast<Target*>(elements) + group,
+                                   static_cast<Target>(source.element<Source>(source_index)));
+    updated[group] = true;
+  }
+
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<is_privatized_aggregation<Source, k>() and
+                              (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL)>
+  operator()(void* elements,
+             bool* updated,
+             size_type group,
+             column_device_view source,
+             size_type source_index) const noexcept
+  {
+    if (k == aggregation::COUNT_VALID and source.is_null(source_index)) { return; }
+    using Target = cudf::detail::target_type_t<Source, k>;
+    atomicAdd(static_cast<Target*>(elements) + group, Target{1});
+    updated[group] = true;
+  }
+
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<not is_privatized_aggregation<Source, k>()> operator()(
+    void*, bool*, size_type, column_device_view, size_type) const noexcept
+  {
+    release_assert(false and "Invalid source type and aggregation combination.");
+  }
+};
+
+/**
+ * @brief Dispatched functor merging a privatized element into the element of
+ * its group in the sparse output
+ */
+struct merge_privatized_element {
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<is_privatized_aggregation<Source, k>()> operator()(
+    void const* elements,
+    size_type group,
+    mutable_column_device_view target,
+    size_type target_index) const noexcept
+  {
+    using Target = cudf::detail::target_type_t<Source, k>;
+    privatized_operator<k>::merge(&target.element<Target>(target_index),
+                                  static_cast<Target const*>(elements)[group]);
+    if (target.nullable() and target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<not is_privatized_aggregation<Source, k>()> operator()(
+    void const*, size_type, mutable_column_device_view, size_type) const noexcept
+  {
+    release_assert(false and "Invalid source type and aggregation combination.");
+  }
+};
+
+/**
+ * @brief Computes single-pass aggregations of few groups in a privatized table
+ * in the shared memory of every block, and merges these into the sparse
+ * `output_values`
+ *
+ * When all rows fall into a few groups, the atomic updates of
+ * `compute_single_pass_aggs` serialize on the few elements of the output.
+ * Instead, every block aggregates the rows it visits into its own copy of the
+ * output, with one element per group and aggregation, and merges every updated
+ * element into the output once. The number of blocks should be small, a few
+ * per multiprocessor, for the rows of a block to outnumber the groups.
+ *
+ * The privatized element of group `g` and aggregation `j` is at
+ * `element_offsets[j] + g * sizeof(target type)` bytes of the dynamic shared
+ * memory, followed by one flag per group and aggregation from byte
+ * `element_offsets[num_columns]`, which must hold
+ * `num_groups * output_values.num_columns()` flags.
+ *
+ * Only aggregations for which `is_privatized_aggregation` holds are supported.
+ *
+ * @param num_rows The number of rows in `input_values`
+ * @param row_groups The dense group of every row in `[0, num_groups)`, or a
+ * negative value for the skipped rows
+ * @param num_groups The number of groups
+ * @param group_targets The row of every group in the sparse `output_values`
+ * @param input_values The table whose rows will be aggregated
+ * @param output_values Sparse table that stores the results of aggregating rows
+ * of `input_values`, initialized as for `compute_single_pass_aggs`
+ * @param aggs The set of aggregation operations to perform accross the
+ * columns of the `input_values` rows
+ * @param element_offsets Byte offset of the privatized elements of every
+ * aggregation, followed by the byte offset of the flags
+ */
+__global__ void compute_privatized_aggs(size_type num_rows,
+                                        size_type const* __restrict__ row_groups,
+                                        size_type num_groups,
+                                        size_type const* __restrict__ group_targets,
+                                        table_device_view input_values,
+                                        mutable_table_device_view output_values,
+                                        aggregation::Kind const* __restrict__ aggs,
+                                        size_type const* __restrict__ element_offsets)
+{
+  extern __shared__ int64_t privatized_storage[];
+  auto const storage     = reinterpret_cast<char*>(privatized_storage);
+  auto const num_columns = output_values.num_columns();
+  bool* const updated    = reinterpret_cast<bool*>(storage + element_offsets[num_columns]);
+
+  for (size_type j = 0; j < num_columns; ++j) {
+    cudf::detail::dispatch_type_and_aggregation(input_values.column(j).type(),
+                                                aggs[j],
+                                                initialize_privatized_column{},
+                                                storage + element_offsets[j],
+                                                num_groups);
+  }
+  for (size_type e = threadIdx.x; e < num_groups * num_columns; e += blockDim.x) {
+    updated[e] = false;
+  }
+  __syncthreads();
+
+  size_type const stride = blockDim.x * gridDim.x;
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < num_rows; i += stride) {
+    auto const group = row_groups[i];
+    if (group < 0) { continue; }
+    for (size_type j = 0; j < num_columns; ++j) {
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(j).type(),
+                                                  aggs[j],
+                                                  update_privatized_element{},
+                                                  storage + element_offsets[j],
+                                                  updated + j * num_groups,
+                                                  group,
+                                                  input_values.column(j),
+                                                  i);
+    }
+  }
+  __syncthreads();
+
+  for (size_type e = threadIdx.x; e < num_groups * num_columns; e += blockDim.x) {
+    if (not updated[e]) { continue; }
+    size_type const j     = e / num_groups;
+    size_type const group = e % num_groups;
+    cudf::detail::dispatch_type_and_aggregation(input_values.column(j).type(),
+                                                aggs[j],
+                                                merge_privatized_element{},
+                                                storage + element_offsets[j],
+                                                group,
+                                                output_values.column(j),
+                                                group_targets[group]);
+  }
+}
 
 }  // namespace hash
 }  // namespace detail
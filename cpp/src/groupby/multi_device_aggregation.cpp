@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/multi_device.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/spillable_partition.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/multi_device.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+// Hash partitions per device; more partitions than devices keep the shares of the devices close
+// while the partition count is rounded up to one that suits the hash tables
+constexpr size_type partitions_per_device = 4;
+
+}  // namespace
+
+// Compute aggregation requests with the keys hash partitioned across devices
+multi_device_table groupby::multi_device_aggregate(std::vector<aggregation_request> const& requests,
+                                                   std::vector<device_resources> const& devices)
+{
+  CUDF_FUNC_RANGE();
+  cudaStream_t stream = 0;
+  CUDF_EXPECTS(not devices.empty(), "Multi-device aggregation needs at least one device.");
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  int home_device{0};
+  CUDA_TRY(cudaGetDevice(&home_device));
+  auto const num_devices = static_cast<size_type>(devices.size());
+
+  // The keys and the values of all requests are partitioned together, on the keys
+  std::vector<column_view> columns(_keys.begin(), _keys.end());
+  for (auto const& request : requests) { columns.push_back(request.values); }
+  std::vector<size_type> key_indices(_keys.num_columns());
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+
+  // Device `i` aggregates the consecutive hash partitions starting at `i * n / num_devices`. As
+  // in `partitioned_aggregate`, the partition count `n` has no common factor with the sizes of
+  // the hash tables built on the partitions.
+  std::unique_ptr<table> partitioned;
+  std::vector<size_type> splits(num_devices - 1, 0);
+  if (num_devices > 1 and _keys.num_rows() > 0) {
+    auto const num_partitions =
+      cudf::detail::hash_table_partition_count(num_devices * partitions_per_device);
+    auto result = cudf::detail::hash_partition(
+      table_view(columns), key_indices, num_partitions, rmm::mr::get_default_resource(), stream);
+    partitioned = std::move(result.first);
+    for (size_type i = 1; i < num_devices; ++i) {
+      splits[i - 1] = result.second[i * num_partitions / num_devices];
+    }
+  }
+  auto const split_results =
+    cudf::detail::contiguous_split(partitioned ? partitioned->view() : table_view(columns),
+                                   splits,
+                                   rmm::mr::get_default_resource(),
+                                   stream);
+  partitioned.reset();
+
+  // The keys and the results of every device are kept as one table: the keys, then the results
+  // of every request in order
+  auto parts = cudf::detail::for_each_device(devices, [&](size_type i) {
+    auto const& target = devices[i];
+    auto const local =
+      cudf::detail::copy_to_device(split_results[i], home_device, stream, target);
+
+    std::vector<aggregation_request> local_requests(requests.size());
+    for (size_t r = 0; r < requests.size(); ++r) {
+      local_requests[r].values = local.view.column(_keys.num_columns() + r);
+      for (auto const& agg : requests[r].aggregations) {
+        local_requests[r].aggregations.push_back(agg->clone());
+      }
+    }
+
+    groupby local_groupby(local.view.select(key_indices), _include_null_keys);
+    auto result = local_groupby.aggregate(
+      local_requests, cudf::detail::memory_resource_of(target), target.stream);
+    auto result_columns = result.first->release();
+    for (auto& request_result : result.second) {
+      for (auto& col : request_result.results) { result_columns.push_back(std::move(col)); }
+    }
+    return std::make_unique<table>(std::move(result_columns));
+  });
+  return multi_device_table(devices, std::move(parts));
+}
+
+}  // namespace groupby
+}  // namespace cudf
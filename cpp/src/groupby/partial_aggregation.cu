@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_reductions.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/tdigest.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+/// Number of columns of the partial state of an aggregation
+size_type num_state_columns(aggregation::Kind k)
+{
+  switch (k) {
+    case aggregation::SUM:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::HYPERLOGLOG:
+    case aggregation::APPROX_NUNIQUE:
+    case aggregation::TDIGEST:
+    case aggregation::APPROX_QUANTILE: return 1;
+    case aggregation::MEAN: return 2;
+    case aggregation::VARIANCE:
+    case aggregation::STD: return 3;
+    default: CUDF_FAIL("Unsupported aggregation in a partial groupby aggregation");
+  }
+}
+
+/// Verifies the partial state of every aggregation of `aggregations` is in `state`
+void verify_state_columns(table_view const& state,
+                          std::vector<std::unique_ptr<aggregation>> const& aggregations)
+{
+  auto const num_columns = std::accumulate(
+    aggregations.begin(), aggregations.end(), size_type{0}, [](size_type sum, auto const& agg) {
+      return sum + num_state_columns(agg->kind);
+    });
+  CUDF_EXPECTS(state.num_columns() == num_columns,
+               "Partial state columns do not match the aggregations");
+}
+
+/**
+ * @brief Returns the variance, or standard deviation, of a group from its count
+ * of valid values and their sum of squared differences from the mean, M2
+ */
+struct variance_from_m2 {
+  size_type const* counts;
+  double const* m2s;
+  size_type ddof;
+  bool take_sqrt;
+
+  __device__ double operator()(size_type i) const
+  {
+    if (counts[i] <= 0 or counts[i] - ddof <= 0) { return 0.0; }
+    double const variance = m2s[i] / (counts[i] - ddof);
+    return take_sqrt ? sqrt(variance) : variance;
+  }
+};
+
+struct has_more_values_than {
+  size_type const* counts;
+  size_type min_count;
+
+  __device__ bool operator()(size_type i) const { return counts[i] > min_count; }
+};
+
+std::unique_ptr<column> finalize_variance(column_view const& counts,
+                                          column_view const& m2s,
+                                          size_type ddof,
+                                          bool take_sqrt,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  auto result = make_numeric_column(
+    data_type{type_id::FLOAT64}, counts.size(), mask_state::UNALLOCATED, stream, mr);
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    counting,
+    counting + counts.size(),
+    result->mutable_view().data<double>(),
+    variance_from_m2{counts.data<size_type>(), m2s.data<double>(), ddof, take_sqrt});
+  auto null_mask = cudf::detail::valid_if(
+    counting,
+    counting + counts.size(),
+    has_more_values_than{counts.data<size_type>(), std::max<size_type>(ddof, 0)},
+    stream,
+    mr);
+  result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  return result;
+}
+
+}  // namespace
+
+// Compute the partial state of aggregation requests
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::aggregate_partial(
+  std::vector<aggregation_request> const& requests, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  cudaStream_t stream = 0;
+
+  // The partial state of every aggregation is the result of a request of simpler aggregations
+  // of the same values, so that aggregations sharing some of these get their own copy
+  std::vector<aggregation_request> partial_requests;
+  for (auto const& request : requests) {
+    auto const& values = request.values;
+    for (auto const& agg : request.aggregations) {
+      num_state_columns(agg->kind);
+      CUDF_EXPECTS(cudf::is_numeric(values.type()) or
+                     not(agg->kind == aggregation::MEAN or agg->kind == aggregation::VARIANCE or
+                         agg->kind == aggregation::STD or agg->kind == aggregation::SUM_OF_SQUARES),
+                   "Partial MEAN, VARIANCE, STD and SUM_OF_SQUARES only support numeric values");
+      CUDF_EXPECTS(cudf::is_fixed_width(values.type()) or
+                     not(agg->kind == aggregation::MIN or agg->kind == aggregation::MAX),
+                   "Partial MIN and MAX only support fixed-width values");
+      CUDF_EXPECTS(cudf::is_numeric(values.type()) or
+                     not(agg->kind == aggregation::TDIGEST or
+                         agg->kind == aggregation::APPROX_QUANTILE),
+                   "Partial TDIGEST and APPROX_QUANTILE only support numeric values");
+
+      aggregation_request partial_request;
+      partial_request.values = values;
+      if (agg->kind == aggregation::MEAN) {
+        partial_request.aggregations.push_back(make_sum_aggregation());
+        partial_request.aggregations.push_back(make_count_aggregation());
+      } else if (agg->kind == aggregation::VARIANCE or agg->kind == aggregation::STD) {
+        partial_request.aggregations.push_back(make_count_aggregation());
+        partial_request.aggregations.push_back(make_mean_aggregation());
+        partial_request.aggregations.push_back(make_variance_aggregation(0));
+      } else if (agg->kind == aggregation::APPROX_NUNIQUE) {
+        auto const& hll_agg = static_cast<cudf::detail::hyperloglog_aggregation const&>(*agg);
+        partial_request.aggregations.push_back(
+          make_hyperloglog_aggregation(hll_agg._precision, hll_agg._null_handling));
+      } else if (agg->kind == aggregation::APPROX_QUANTILE) {
+        auto const& tdigest_agg = static_cast<cudf::detail::tdigest_aggregation const&>(*agg);
+        partial_request.aggregations.push_back(
+          make_tdigest_aggregation(tdigest_agg._max_centroids));
+      } else {
+        partial_request.aggregations.push_back(agg->clone());
+      }
+      partial_requests.push_back(std::move(partial_request));
+    }
+  }
+
+  auto result = aggregate(partial_requests, mr);
+
+  std::vector<std::unique_ptr<column>> state;
+  for (size_t i = 0; i < partial_requests.size(); i++) {
+    auto& results = result.second[i].results;
+    if (partial_requests[i].aggregations.back()->kind == aggregation::VARIANCE) {
+      // The population variance times the count is the M2 of the values
+      auto m2 = cudf::detail::binary_operation(results[2]->view(),
+                                               results[0]->view(),
+                                               binary_operator::MUL,
+                                               data_type{type_id::FLOAT64},
+                                               mr,
+                                               stream);
+      results[2] = std::move(m2);
+    }
+    std::move(results.begin(), results.end(), std::back_inserter(state));
+  }
+
+  return std::make_pair(std::move(result.first), std::make_unique<table>(std::move(state)));
+}
+
+// Merge the partial states of several batches
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> merge_partial_aggregations(
+  std::vector<table_view> const& keys,
+  std::vector<table_view> const& states,
+  std::vector<std::unique_ptr<aggregation>> const& aggregations,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  cudaStream_t stream = 0;
+
+  CUDF_EXPECTS(not keys.empty(), "No partial aggregation to merge");
+  CUDF_EXPECTS(keys.size() == states.size(), "Mismatch between the number of keys and states");
+  for (size_t i = 0; i < keys.size(); i++) {
+    verify_state_columns(states[i], aggregations);
+    CUDF_EXPECTS(keys[i].num_rows() == states[i].num_rows(),
+                 "Size mismatch between partial keys and states");
+  }
+
+  auto const temp_mr    = rmm::mr::get_default_resource();
+  auto const all_keys   = cudf::detail::concatenate(keys, temp_mr, stream);
+  auto const all_states = cudf::detail::concatenate(states, temp_mr, stream);
+  if (all_keys->num_rows() == 0) {
+    return std::make_pair(empty_like(keys[0]), empty_like(states[0]));
+  }
+
+  // Partial states only hold null keys when they are included, which merges them
+  detail::sort::sort_groupby_helper helper(all_keys->view(), null_policy::INCLUDE, sorted::NO);
+  auto const& group_labels = helper.group_labels(stream);
+  auto const num_groups    = helper.num_groups();
+
+  auto grouped = [&](size_type c) {
+    return helper.grouped_values(all_states->get_column(c), temp_mr, stream);
+  };
+  auto merged_sum = [&](size_type c, rmm::mr::device_memory_resource* sum_mr) {
+    return detail::group_sum(grouped(c)->view(), num_groups, group_labels, sum_mr, stream);
+  };
+  auto merged_count = [&](size_type c) {
+    auto const sums = merged_sum(c, temp_mr);
+    return cudf::detail::cast(sums->view(), data_type(type_to_id<size_type>()), mr, stream);
+  };
+
+  std::vector<std::unique_ptr<column>> merged;
+  size_type c = 0;
+  for (auto const& agg : aggregations) {
+    switch (agg->kind) {
+      case aggregation::SUM:
+      case aggregation::SUM_OF_SQUARES: merged.push_back(merged_sum(c, mr)); break;
+      case aggregation::MIN:
+        merged.push_back(
+          detail::group_min(grouped(c)->view(), num_groups, group_labels, mr, stream));
+        break;
+      case aggregation::MAX:
+        merged.push_back(
+          detail::group_max(grouped(c)->view(), num_groups, group_labels, mr, stream));
+        break;
+      case aggregation::COUNT_VALID:
+      case aggregation::COUNT_ALL: merged.push_back(merged_count(c)); break;
+      case aggregation::MEAN:
+        merged.push_back(merged_sum(c, mr));
+        merged.push_back(merged_count(c + 1));
+        break;
+      case aggregation::HYPERLOGLOG:
+      case aggregation::APPROX_NUNIQUE:
+        merged.push_back(cudf::detail::merge_hyperloglog_sketches(
+          grouped(c)->view(),
+          group_labels.data().get(),
+          num_groups,
+          static_cast<cudf::detail::hyperloglog_aggregation const&>(*agg)._precision,
+          mr,
+          stream));
+        break;
+      case aggregation::TDIGEST:
+      case aggregation::APPROX_QUANTILE:
+        merged.push_back(cudf::detail::merge_tdigests(
+          grouped(c)->view(),
+          group_labels.data().get(),
+          num_groups,
+          static_cast<cudf::detail::tdigest_aggregation const&>(*agg)._max_centroids,
+          mr,
+          stream));
+        break;
+      default: {
+        auto m2_state = detail::group_merge_m2(grouped(c)->view(),
+                                               grouped(c + 1)->view(),
+                                               grouped(c + 2)->view(),
+                                               num_groups,
+                                               group_labels,
+                                               mr,
+                                               stream);
+        std::move(m2_state.begin(), m2_state.end(), std::back_inserter(merged));
+      }
+    }
+    c += num_state_columns(agg->kind);
+  }
+
+  return std::make_pair(helper.unique_keys(mr, stream), std::make_unique<table>(std::move(merged)));
+}
+
+// Compute the results of aggregations from their partial state
+std::vector<std::unique_ptr<column>> finalize_partial_aggregations(
+  table_view const& state,
+  std::vector<std::unique_ptr<aggregation>> const& aggregations,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  cudaStream_t stream = 0;
+  verify_state_columns(state, aggregations);
+
+  std::vector<std::unique_ptr<column>> results;
+  size_type c = 0;
+  for (auto const& agg : aggregations) {
+    if (agg->kind == aggregation::MEAN) {
+      results.push_back(cudf::detail::binary_operation(state.column(c),
+                                                       state.column(c + 1),
+                                                       binary_operator::TRUE_DIV,
+                                                       data_type{type_id::FLOAT64},
+                                                       mr,
+                                                       stream));
+    } else if (agg->kind == aggregation::VARIANCE or agg->kind == aggregation::STD) {
+      auto const ddof = static_cast<cudf::detail::std_var_aggregation const&>(*agg)._ddof;
+      results.push_back(finalize_variance(
+        state.column(c), state.column(c + 2), ddof, agg->kind == aggregation::STD, mr, stream));
+    } else if (agg->kind == aggregation::APPROX_NUNIQUE) {
+      auto const& hll_agg = static_cast<cudf::detail::hyperloglog_aggregation const&>(*agg);
+      results.push_back(
+        cudf::detail::hyperloglog_estimates(state.column(c), hll_agg._precision, mr, stream));
+    } else if (agg->kind == aggregation::APPROX_QUANTILE) {
+      auto const& tdigest_agg = static_cast<cudf::detail::tdigest_aggregation const&>(*agg);
+      results.push_back(
+        cudf::detail::tdigest_quantiles(state.column(c), tdigest_agg._quantiles, mr, stream));
+    } else {
+      results.push_back(std::make_unique<column>(state.column(c), stream, mr));
+    }
+    c += num_state_columns(agg->kind);
+  }
+  return results;
+}
+
+}  // namespace groupby
+}  // namespace cudf
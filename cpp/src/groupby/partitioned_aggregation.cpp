@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/spillable_partition.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+// Hash map entries are (key row, target row) pairs, at 50% occupancy
+constexpr size_t hash_map_bytes_per_row = 2 * (2 * sizeof(size_type));
+
+/// Returns the bytes of a row of a column of `type`, counting offsets for other types
+size_t row_bytes(data_type type)
+{
+  return is_fixed_width(type) ? size_of(type) : 2 * sizeof(size_type);
+}
+
+/**
+ * @brief Returns the number of partitions for which the estimated working memory of the
+ * aggregation of one partition fits in half of the free device memory
+ *
+ * Every row is counted with its hash map entry, its keys twice, for the partitioned and the
+ * unique keys, and its values once plus once per aggregation.
+ */
+size_type default_num_partitions(table_view const& keys,
+                                 std::vector<aggregation_request> const& requests)
+{
+  size_t free_bytes{0};
+  size_t total_bytes{0};
+  CUDA_TRY(cudaMemGetInfo(&free_bytes, &total_bytes));
+
+  size_t bytes_per_row = hash_map_bytes_per_row;
+  for (auto const& col : keys) { bytes_per_row += 2 * row_bytes(col.type()); }
+  for (auto const& request : requests) {
+    bytes_per_row += (request.aggregations.size() + 1) * row_bytes(request.values.type());
+  }
+
+  auto const working_bytes  = static_cast<size_t>(keys.num_rows()) * bytes_per_row;
+  auto const budget         = std::max<size_t>(free_bytes / 2, 1);
+  auto const num_partitions = (working_bytes + budget - 1) / budget;
+  return static_cast<size_type>(std::min<size_t>(num_partitions, keys.num_rows()));
+}
+
+}  // namespace
+
+// Compute aggregation requests one partition of the keys at a time
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::partitioned_aggregate(
+  std::vector<aggregation_request> const& requests,
+  size_type num_partitions,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  cudaStream_t stream = 0;
+  CUDF_EXPECTS(num_partitions >= 0, "Number of partitions cannot be negative");
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  if (num_partitions == 0) { num_partitions = default_num_partitions(_keys, requests); }
+  if (num_partitions <= 1 || _keys.num_rows() == 0) { return aggregate(requests, mr); }
+  num_partitions = detail::hash_table_partition_count(num_partitions);
+
+  // The keys and the values of all requests are partitioned together, on the keys
+  std::vector<column_view> columns(_keys.begin(), _keys.end());
+  for (auto const& request : requests) { columns.push_back(request.values); }
+  std::vector<size_type> key_indices(_keys.num_columns());
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+
+  std::vector<detail::spillable_partition> partitions;
+  std::vector<detail::spillable_partition> results;
+  auto spill_all = [&](size_t except) {
+    for (size_t i = 0; i < partitions.size(); ++i) {
+      if (i != except) { partitions[i].spill(stream); }
+    }
+    for (auto& result : results) { result.spill(stream); }
+  };
+  auto with_spilling = [&](size_t except, auto&& fn) {
+    try {
+      return fn();
+    } catch (std::bad_alloc const&) {
+      spill_all(except);
+      return fn();
+    }
+  };
+
+  constexpr size_t none = static_cast<size_t>(-1);
+  partitions            = with_spilling(none, [&]() {
+    return detail::make_spillable_partitions(
+      table_view(columns), key_indices, num_partitions, stream);
+  });
+
+  // The keys and the results of every partition are kept as one table: the keys, then the
+  // results of every request in order
+  for (size_t i = 0; i < partitions.size(); ++i) {
+    results.push_back(with_spilling(i, [&]() {
+      auto const partition = partitions[i].view(stream);
+      std::vector<aggregation_request> partition_requests(requests.size());
+      for (size_t r = 0; r < requests.size(); ++r) {
+        partition_requests[r].values = partition.column(_keys.num_columns() + r);
+        for (auto const& agg : requests[r].aggregations) {
+          partition_requests[r].aggregations.push_back(agg->clone());
+        }
+      }
+
+      groupby partition_groupby(partition.select(key_indices), _include_null_keys);
+      auto const result      = partition_groupby.aggregate(partition_requests);
+      auto const result_keys = result.first->view();
+      std::vector<column_view> result_columns(result_keys.begin(), result_keys.end());
+      for (auto const& request_result : result.second) {
+        for (auto const& col : request_result.results) { result_columns.push_back(col->view()); }
+      }
+      return detail::make_spillable_partition(
+        table_view(result_columns), rmm::mr::get_default_resource(), stream);
+    }));
+    partitions[i].release();
+  }
+
+  std::vector<table_view> result_views;
+  for (auto& result : results) { result_views.push_back(result.view(stream)); }
+  auto result_columns = cudf::concatenate(result_views, mr)->release();
+  results.clear();
+
+  auto const num_keys = static_cast<size_t>(_keys.num_columns());
+  std::vector<std::unique_ptr<column>> key_columns;
+  for (size_t i = 0; i < num_keys; ++i) { key_columns.push_back(std::move(result_columns[i])); }
+
+  std::vector<aggregation_result> request_results(requests.size());
+  auto next_column = result_columns.begin() + num_keys;
+  for (size_t r = 0; r < requests.size(); ++r) {
+    for (size_t a = 0; a < requests[r].aggregations.size(); ++a) {
+      request_results[r].results.push_back(std::move(*next_column++));
+    }
+  }
+  return std::make_pair(std::make_unique<table>(std::move(key_columns)),
+                        std::move(request_results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
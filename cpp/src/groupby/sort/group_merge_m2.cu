@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_reductions.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+struct partial_count {
+  column_device_view d_counts;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return d_counts.is_valid(i) ? d_counts.element<size_type>(i) : 0;
+  }
+};
+
+struct partial_weighted_sum {
+  column_device_view d_counts;
+  column_device_view d_means;
+
+  __device__ double operator()(size_type i) const
+  {
+    if (d_counts.is_null(i) or d_means.is_null(i)) return 0.0;
+    return d_counts.element<size_type>(i) * d_means.element<double>(i);
+  }
+};
+
+struct merged_mean {
+  double const* d_sums;
+  size_type const* d_counts;
+
+  __device__ double operator()(size_type g) const
+  {
+    return d_counts[g] > 0 ? d_sums[g] / d_counts[g] : 0.0;
+  }
+};
+
+struct partial_m2_about_merged_mean {
+  column_device_view d_counts;
+  column_device_view d_means;
+  column_device_view d_m2s;
+  size_type const* d_group_labels;
+  double const* d_merged_means;
+
+  __device__ double operator()(size_type i) const
+  {
+    if (d_counts.is_null(i) or d_means.is_null(i)) return 0.0;
+    double const delta = d_means.element<double>(i) - d_merged_means[d_group_labels[i]];
+    double const m2    = d_m2s.is_valid(i) ? d_m2s.element<double>(i) : 0.0;
+    return m2 + d_counts.element<size_type>(i) * delta * delta;
+  }
+};
+
+struct has_valid_values {
+  size_type const* d_counts;
+
+  __device__ bool operator()(size_type g) const { return d_counts[g] > 0; }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> group_merge_m2(
+  column_view const& counts,
+  column_view const& means,
+  column_view const& m2s,
+  size_type num_groups,
+  rmm::device_vector<size_type> const& group_labels,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(counts.type().id() == type_to_id<size_type>(), "Partial counts must be INT32");
+  CUDF_EXPECTS(means.type().id() == type_id::FLOAT64 and m2s.type().id() == type_id::FLOAT64,
+               "Partial means and M2s must be FLOAT64");
+  CUDF_EXPECTS(counts.size() == means.size() and counts.size() == m2s.size(),
+               "Size mismatch between partial counts, means and M2s");
+
+  auto d_counts = column_device_view::create(counts, stream);
+  auto d_means  = column_device_view::create(means, stream);
+  auto d_m2s    = column_device_view::create(m2s, stream);
+
+  auto merged_counts = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto merged_means = make_numeric_column(
+    data_type(type_id::FLOAT64), num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto merged_m2s = make_numeric_column(
+    data_type(type_id::FLOAT64), num_groups, mask_state::UNALLOCATED, stream, mr);
+  size_type* d_merged_counts = merged_counts->mutable_view().data<size_type>();
+  double* d_merged_means     = merged_means->mutable_view().data<double>();
+  double* d_merged_m2s       = merged_m2s->mutable_view().data<double>();
+
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+
+  thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                        group_labels.begin(),
+                        group_labels.end(),
+                        thrust::make_transform_iterator(counting, partial_count{*d_counts}),
+                        thrust::make_discard_iterator(),
+                        d_merged_counts);
+
+  // The weighted sums are gathered in the M2 column before they are divided into the means
+  thrust::reduce_by_key(
+    rmm::exec_policy(stream)->on(stream),
+    group_labels.begin(),
+    group_labels.end(),
+    thrust::make_transform_iterator(counting, partial_weighted_sum{*d_counts, *d_means}),
+    thrust::make_discard_iterator(),
+    d_merged_m2s);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    counting,
+                    counting + num_groups,
+                    d_merged_means,
+                    merged_mean{d_merged_m2s, d_merged_counts});
+
+  auto const m2_about_merged_mean = partial_m2_about_merged_mean{
+    *d_counts, *d_means, *d_m2s, group_labels.data().get(), d_merged_means};
+  thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                        group_labels.begin(),
+                        group_labels.end(),
+                        thrust::make_transform_iterator(counting, m2_about_merged_mean),
+                        thrust::make_discard_iterator(),
+                        d_merged_m2s);
+
+  for (auto* result : {merged_means.get(), merged_m2s.get()}) {
+    auto null_mask = cudf::detail::valid_if(
+      counting, counting + num_groups, has_valid_values{d_merged_counts}, stream, mr);
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  }
+
+  std::vector<std::unique_ptr<column>> merged;
+  merged.push_back(std::move(merged_counts));
+  merged.push_back(std::move(merged_means));
+  merged.push_back(std::move(merged_m2s));
+  return merged;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
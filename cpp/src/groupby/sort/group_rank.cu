@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_scan.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+/**
+ * @brief Returns true if sorted position `i` starts a run of equal values in
+ * its group
+ */
+template <bool has_nulls>
+struct is_run_start {
+  row_equality_comparator<has_nulls> equal;
+  size_type const* sorted_labels;
+  size_type const* sorted_order;
+
+  __device__ bool operator()(size_type i) const
+  {
+    return i == 0 or sorted_labels[i] != sorted_labels[i - 1] or
+           not equal(sorted_order[i], sorted_order[i - 1]);
+  }
+};
+
+template <bool has_nulls>
+void mark_run_starts(column_view const& values,
+                     rmm::device_vector<size_type> const& sorted_labels,
+                     size_type const* sorted_order,
+                     rmm::device_vector<bool>& run_starts,
+                     cudaStream_t stream)
+{
+  auto const d_values = table_device_view::create(table_view{{values}}, stream);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(values.size()),
+    run_starts.begin(),
+    is_run_start<has_nulls>{row_equality_comparator<has_nulls>{*d_values, *d_values, true},
+                            sorted_labels.data().get(),
+                            sorted_order});
+}
+
+/**
+ * @brief Writes the rank of every sorted position to its row
+ */
+template <typename OutputType>
+void assign_ranks(rank_method method,
+                  bool percentage,
+                  size_type num_rows,
+                  size_type const* sorted_order,
+                  size_type const* sorted_labels,
+                  size_type const* group_offsets,
+                  size_type const* group_counts,
+                  size_type const* run_first,
+                  size_type const* run_last,
+                  size_type const* dense_ranks,
+                  OutputType* ranks,
+                  cudaStream_t stream)
+{
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows,
+    [=] __device__(size_type i) {
+      auto const group_start = group_offsets[sorted_labels[i]];
+      double rank            = 0;
+      switch (method) {
+        case rank_method::FIRST: rank = i - group_start + 1; break;
+        case rank_method::MIN: rank = run_first[i] - group_start + 1; break;
+        case rank_method::MAX: rank = run_last[i] - group_start + 1; break;
+        case rank_method::AVERAGE:
+          rank = (run_first[i] + run_last[i]) / 2.0 - group_start + 1;
+          break;
+        case rank_method::DENSE: rank = dense_ranks[i]; break;
+      }
+      if (percentage) {
+        // as cudf::rank, relative to the number of ranked values of the group
+        auto const count = group_counts[sorted_labels[i]];
+        auto const total =
+          method == rank_method::DENSE
+            ? (count > 0 ? dense_ranks[group_start + count - 1] : 0)
+            : count;
+        rank = total > 0 ? rank / total : 0;
+      }
+      ranks[sorted_order[i]] = static_cast<OutputType>(rank);
+    });
+}
+
+}  // namespace
+
+std::unique_ptr<column> group_rank(column_view const& values,
+                                   rank_method method,
+                                   order column_order,
+                                   null_policy null_handling,
+                                   null_order null_precedence,
+                                   bool percentage,
+                                   rmm::device_vector<size_type> const& group_labels,
+                                   rmm::device_vector<size_type> const& group_offsets,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  auto const num_rows         = values.size();
+  bool const is_double_result = percentage or method == rank_method::AVERAGE;
+  data_type const output_type =
+    is_double_result ? data_type(type_id::FLOAT64) : data_type(type_to_id<size_type>());
+  // the ranks of nulls are null with null_policy::EXCLUDE, as cudf::rank
+  auto result = null_handling == null_policy::EXCLUDE
+                  ? make_numeric_column(output_type,
+                                        num_rows,
+                                        copy_bitmask(values, stream, mr),
+                                        values.null_count(),
+                                        stream,
+                                        mr)
+                  : make_numeric_column(output_type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  if (num_rows == 0) { return result; }
+
+  // Sort by value, then stably by group label. The second sort keeps the value
+  // order within every group, so the rows end up sorted by (group, value)
+  // without a multi-column comparator, and its integer keys are radix sorted.
+  auto sorted_order = cudf::detail::stable_sorted_order(table_view{{values}},
+                                                        {column_order},
+                                                        {null_precedence},
+                                                        rmm::mr::get_default_resource(),
+                                                        stream);
+  auto const d_order = sorted_order->mutable_view().data<size_type>();
+  rmm::device_vector<size_type> sorted_labels(num_rows);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 d_order,
+                 d_order + num_rows,
+                 group_labels.begin(),
+                 sorted_labels.begin());
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream)->on(stream), sorted_labels.begin(), sorted_labels.end(), d_order);
+
+  // runs of equal values within the groups
+  rmm::device_vector<bool> run_starts(num_rows);
+  if (values.has_nulls()) {
+    mark_run_starts<true>(values, sorted_labels, d_order, run_starts, stream);
+  } else {
+    mark_run_starts<false>(values, sorted_labels, d_order, run_starts, stream);
+  }
+  auto const d_run_starts = run_starts.data().get();
+
+  // first sorted position of the run of every position
+  rmm::device_vector<size_type> run_first(num_rows);
+  auto const first_it = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_run_starts] __device__(size_type i) { return d_run_starts[i] ? i : 0; });
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         first_it,
+                         first_it + num_rows,
+                         run_first.begin(),
+                         thrust::maximum<size_type>());
+
+  // last sorted position of the run of every position, scanning from the end
+  rmm::device_vector<size_type> run_last(num_rows);
+  auto const last_it = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_run_starts, num_rows] __device__(size_type i) {
+      return (i == num_rows - 1 or d_run_starts[i + 1]) ? i : num_rows;
+    });
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_reverse_iterator(last_it + num_rows),
+                         thrust::make_reverse_iterator(last_it),
+                         thrust::make_reverse_iterator(run_last.end()),
+                         thrust::minimum<size_type>());
+
+  // dense rank: the number of runs up to the position within its group
+  rmm::device_vector<size_type> dense_ranks(method == rank_method::DENSE ? num_rows : 0);
+  if (method == rank_method::DENSE) {
+    auto const starts_it = thrust::make_transform_iterator(
+      run_starts.begin(), [] __device__(bool start) -> size_type { return start ? 1 : 0; });
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  sorted_labels.begin(),
+                                  sorted_labels.end(),
+                                  starts_it,
+                                  dense_ranks.begin());
+  }
+
+  // number of ranked values of every group, for percentages
+  auto const num_groups = static_cast<size_type>(group_offsets.size()) - 1;
+  rmm::device_vector<size_type> group_counts(percentage ? num_groups : 0);
+  if (percentage) {
+    auto const d_offsets = group_offsets.data().get();
+    if (null_handling == null_policy::EXCLUDE and values.has_nulls()) {
+      auto const d_values = column_device_view::create(values, stream);
+      auto const valid_it = thrust::make_transform_iterator(
+        thrust::make_counting_iterator<size_type>(0),
+        [d_values = *d_values] __device__(size_type i) -> size_type {
+          return d_values.is_valid(i) ? 1 : 0;
+        });
+      thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                            group_labels.begin(),
+                            group_labels.end(),
+                            valid_it,
+                            thrust::make_discard_iterator(),
+                            group_counts.begin());
+    } else {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_groups),
+                        group_counts.begin(),
+                        [d_offsets] __device__(size_type g) {
+                          return d_offsets[g + 1] - d_offsets[g];
+                        });
+    }
+  }
+
+  auto const assign = [&](auto* ranks) {
+    assign_ranks(method,
+                 percentage,
+                 num_rows,
+                 d_order,
+                 sorted_labels.data().get(),
+                 group_offsets.data().get(),
+                 group_counts.data().get(),
+                 run_first.data().get(),
+                 run_last.data().get(),
+                 dense_ranks.data().get(),
+                 ranks,
+                 stream);
+  };
+  if (is_double_result) {
+    assign(result->mutable_view().data<double>());
+  } else {
+    assign(result->mutable_view().data<size_type>());
+  }
+  return result;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
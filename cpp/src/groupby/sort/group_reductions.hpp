@@ -22,6 +22,7 @@
 #include <rmm/thrust_rmm_allocator.h>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -154,6 +155,33 @@ std::unique_ptr<column> group_var(column_view const& values,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream = 0);
 
+/**
+ * @brief Internal API to merge partial groupwise counts, means and sums of
+ * squared differences from the mean, M2, into those of the merged groups
+ *
+ * For the rows `i` of group `g`, the merged count is `n = sum(n_i)`, the merged
+ * mean is `sum(n_i * mean_i) / n`, and the merged M2 is
+ * `sum(M2_i + n_i * (mean_i - mean)^2)`. Rows with a null mean or M2 are
+ * those of no valid values. The merged mean and M2 are null where `n == 0`.
+ *
+ * @param counts Grouped INT32 partial counts of valid values
+ * @param means Grouped FLOAT64 partial means
+ * @param m2s Grouped FLOAT64 partial M2s
+ * @param num_groups Number of groups
+ * @param group_labels ID of group that the corresponding partial state belongs to
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The merged counts, means and M2s, in that order
+ */
+std::vector<std::unique_ptr<column>> group_merge_m2(
+  column_view const& counts,
+  column_view const& means,
+  column_view const& m2s,
+  size_type num_groups,
+  rmm::device_vector<size_type> const& group_labels,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0);
+
 /**
  * @brief Internal API to calculate groupwise quantiles
  *
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_scan.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the value of a row as the target type of the scan, or the
+ * identity of the scan if the value is null
+ */
+template <typename Source, typename Target>
+struct null_replaced_value {
+  column_device_view d_values;
+  Target identity;
+
+  __device__ Target operator()(size_type i) const
+  {
+    return d_values.is_valid(i) ? static_cast<Target>(d_values.element<Source>(i)) : identity;
+  }
+};
+
+struct is_counted {
+  column_device_view d_values;
+  bool count_nulls;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return (count_nulls or d_values.is_valid(i)) ? 1 : 0;
+  }
+};
+
+template <aggregation::Kind k>
+struct scan_functor {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return std::is_arithmetic<T>::value and cudf::detail::is_valid_aggregation<T, k>();
+  }
+
+  template <typename T>
+  std::enable_if_t<is_supported<T>(), std::unique_ptr<column>> operator()(
+    column_view const& values,
+    rmm::device_vector<size_type> const& group_labels,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+  {
+    using Target   = cudf::detail::target_type_t<T, k>;
+    using Operator = cudf::detail::corresponding_operator_t<k>;
+
+    auto result = make_fixed_width_column(
+      data_type{type_to_id<Target>()}, values.size(), mask_state::UNALLOCATED, stream, mr);
+    if (values.is_empty()) { return result; }
+
+    auto d_values  = column_device_view::create(values, stream);
+    auto values_it = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      null_replaced_value<T, Target>{*d_values, Operator::template identity<Target>()});
+
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  group_labels.begin(),
+                                  group_labels.end(),
+                                  values_it,
+                                  result->mutable_view().data<Target>(),
+                                  thrust::equal_to<size_type>{},
+                                  Operator{});
+
+    if (values.nullable()) {
+      result->set_null_mask(cudf::copy_bitmask(values, stream, mr), values.null_count());
+    }
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_supported<T>(), std::unique_ptr<column>> operator()(Args&&... args)
+  {
+    CUDF_FAIL("Unsupported type for groupby scan");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> group_scan(column_view const& values,
+                                   aggregation::Kind k,
+                                   rmm::device_vector<size_type> const& group_labels,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  switch (k) {
+    case aggregation::SUM:
+      return type_dispatcher(
+        values.type(), scan_functor<aggregation::SUM>{}, values, group_labels, mr, stream);
+    case aggregation::MIN:
+      return type_dispatcher(
+        values.type(), scan_functor<aggregation::MIN>{}, values, group_labels, mr, stream);
+    case aggregation::MAX:
+      return type_dispatcher(
+        values.type(), scan_functor<aggregation::MAX>{}, values, group_labels, mr, stream);
+    default: CUDF_FAIL("Unsupported groupby scan aggregation");
+  }
+}
+
+std::unique_ptr<column> group_count_scan(column_view const& values,
+                                         null_policy null_handling,
+                                         rmm::device_vector<size_type> const& group_labels,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  auto result = make_numeric_column(
+    data_type(type_to_id<size_type>()), values.size(), mask_state::UNALLOCATED, stream, mr);
+  if (values.is_empty()) { return result; }
+
+  auto d_values  = column_device_view::create(values, stream);
+  auto counts_it = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    is_counted{*d_values, null_handling == null_policy::INCLUDE});
+
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                group_labels.begin(),
+                                group_labels.end(),
+                                counts_it,
+                                result->mutable_view().data<size_type>());
+  return result;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/sorting.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <memory>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+/**
+ * @brief Internal API to calculate the groupwise running SUM, MIN or MAX
+ *
+ * The running aggregate skips null values, and the result is null where
+ * @p values is null.
+ *
+ * @param values Grouped values to scan, in their original order within each group
+ * @param k The aggregation to scan with, one of SUM, MIN and MAX
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_scan(column_view const& values,
+                                   aggregation::Kind k,
+                                   rmm::device_vector<size_type> const& group_labels,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to calculate the groupwise running count of values
+ *
+ * With `null_policy::INCLUDE`, the count of row `i` is its 1-based position in
+ * its group.
+ *
+ * @param values Grouped values to count
+ * @param null_handling Exclude nulls while counting if null_policy::EXCLUDE,
+ *  Include nulls if null_policy::INCLUDE.
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_count_scan(column_view const& values,
+                                         null_policy null_handling,
+                                         rmm::device_vector<size_type> const& group_labels,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to calculate the rank of every value within its group
+ *
+ * The ranks are computed as `cudf::rank` computes them over a whole column,
+ * with ties broken by `method`. The result is FLOAT64 if `percentage` is true
+ * or `method` is `rank_method::AVERAGE`, and `size_type` otherwise.
+ *
+ * @param values Grouped values to rank
+ * @param method The method used to rank equal values
+ * @param column_order The order in which the values are ranked
+ * @param null_handling With null_policy::EXCLUDE, the ranks of nulls are null
+ *  and nulls are not counted by percentages
+ * @param null_precedence Whether nulls rank before or after the valid values
+ * @param percentage Whether to divide the ranks by the number of ranked values
+ *  of their group
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of the groups in @p values
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_rank(column_view const& values,
+                                   rank_method method,
+                                   order column_order,
+                                   null_policy null_handling,
+                                   null_order null_precedence,
+                                   bool percentage,
+                                   rmm::device_vector<size_type> const& group_labels,
+                                   rmm::device_vector<size_type> const& group_offsets,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
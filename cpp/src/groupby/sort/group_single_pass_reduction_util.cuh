@@ -28,6 +28,9 @@
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
 
 namespace cudf {
 namespace groupby {
@@ -38,7 +41,7 @@ struct reduce_functor {
   static constexpr bool is_supported()
   {
     if (K == aggregation::SUM)
-      return cudf::is_numeric<T>() || cudf::is_duration<T>();
+      return cudf::is_numeric<T>() || cudf::is_duration<T>() || cudf::is_fixed_point<T>();
     else if (K == aggregation::MIN or K == aggregation::MAX)
       return cudf::is_fixed_width<T>() and is_relationally_comparable<T, T>();
     else if (K == aggregation::ARGMIN or K == aggregation::ARGMAX)
@@ -48,8 +51,8 @@ struct reduce_functor {
   }
 
   template <typename T>
-  std::enable_if_t<is_supported<T>(), std::unique_ptr<column>> operator()(
-    column_view const& values,
+  std::enable_if_t<is_supported<T>() and not cudf::is_fixed_point<T>(), std::unique_ptr<column>>
+  operator()(column_view const& values,
     size_type num_groups,
     rmm::device_vector<cudf::size_type> const& group_labels,
     rmm::mr::device_memory_resource* mr,
@@ -86,6 +89,60 @@ struct reduce_functor {
     return result;
   }
 
+  /**
+   * @brief fixed_point elements carry their own scale and cannot be updated
+   * atomically, so the values, which are sorted by group, are reduced one
+   * group at a time, skipping the nulls.
+   */
+  template <typename T>
+  std::enable_if_t<is_supported<T>() and cudf::is_fixed_point<T>(), std::unique_ptr<column>>
+  operator()(column_view const& values,
+             size_type num_groups,
+             rmm::device_vector<cudf::size_type> const& group_labels,
+             rmm::mr::device_memory_resource* mr,
+             cudaStream_t stream)
+  {
+    using OpType = cudf::detail::corresponding_operator_t<K>;
+
+    std::unique_ptr<column> result = make_fixed_width_column(
+      values.type(), num_groups, mask_state::UNALLOCATED, stream, mr);
+
+    if (values.size() == 0) { return result; }
+
+    auto valuesview = column_device_view::create(values, stream);
+    auto valid_and_values =
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                      [d_values = *valuesview] __device__(size_type i) {
+                                        return d_values.is_valid(i)
+                                                 ? thrust::make_tuple(true, d_values.element<T>(i))
+                                                 : thrust::make_tuple(false, T{});
+                                      });
+
+    rmm::device_vector<bool> validity(num_groups);
+    thrust::reduce_by_key(
+      rmm::exec_policy(stream)->on(stream),
+      group_labels.begin(),
+      group_labels.begin() + values.size(),
+      valid_and_values,
+      thrust::make_discard_iterator(),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(validity.begin(), result->mutable_view().begin<T>())),
+      thrust::equal_to<size_type>{},
+      [] __device__(thrust::tuple<bool, T> const& lhs, thrust::tuple<bool, T> const& rhs) {
+        if (not thrust::get<0>(lhs)) { return rhs; }
+        if (not thrust::get<0>(rhs)) { return lhs; }
+        return thrust::make_tuple(true, OpType{}(thrust::get<1>(lhs), thrust::get<1>(rhs)));
+      });
+
+    if (values.has_nulls()) {
+      auto null_mask = cudf::detail::valid_if(
+        validity.begin(), validity.end(), thrust::identity<bool>{}, stream, mr);
+      result->set_null_mask(std::move(null_mask.first), null_mask.second);
+    }
+
+    return result;
+  }
+
   template <typename T, typename... Args>
   std::enable_if_t<not is_supported<T>(), std::unique_ptr<column>> operator()(Args&&... args)
   {
@@ -27,12 +27,16 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/tdigest.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -40,6 +44,30 @@
 namespace cudf {
 namespace groupby {
 namespace detail {
+namespace {
+/**
+ * @brief Indicates whether the aggregation `k` needs the values sorted within
+ * every group
+ */
+bool needs_sorted_values(aggregation::Kind k)
+{
+  return (k == aggregation::MEDIAN) or (k == aggregation::QUANTILE) or
+         (k == aggregation::NUNIQUE);
+}
+
+/**
+ * @brief Indicates whether two views are views of the same elements
+ */
+bool is_same_view(column_view const& lhs, column_view const& rhs)
+{
+  return lhs.type() == rhs.type() and lhs.size() == rhs.size() and
+         lhs.offset() == rhs.offset() and lhs.head() == rhs.head() and
+         lhs.null_mask() == rhs.null_mask() and lhs.num_children() == 0 and
+         rhs.num_children() == 0;
+}
+
+}  // namespace
+
 /**
  * @brief Functor to dispatch aggregation with
  *
@@ -47,7 +75,8 @@ namespace detail {
  * appropriate aggregation. If the values on which to run the aggregation are
  * unchanged, then this functor should be re-used. This is because it stores
  * memoised sorted and/or grouped values and re-using will save on computation
- * of these values.
+ * of these values. Sorted values computed beforehand, possibly shared with
+ * other requests of the same values, are passed as `sorted_values`.
  */
 struct store_result_functor {
   store_result_functor(size_type col_idx,
@@ -55,8 +84,15 @@ struct store_result_functor {
                        sort::sort_groupby_helper& helper,
                        cudf::detail::result_cache& cache,
                        cudaStream_t stream,
-                       rmm::mr::device_memory_resource* mr)
-    : col_idx(col_idx), values(values), helper(helper), cache(cache), stream(stream), mr(mr)
+                       rmm::mr::device_memory_resource* mr,
+                       std::shared_ptr<column> sorted_values = nullptr)
+    : col_idx(col_idx),
+      values(values),
+      helper(helper),
+      cache(cache),
+      stream(stream),
+      mr(mr),
+      sorted_values(std::move(sorted_values))
   {
   }
 
@@ -108,7 +144,7 @@ struct store_result_functor {
   cudaStream_t stream;                  ///< CUDA stream on which to execute kernels
   rmm::mr::device_memory_resource* mr;  ///< Memory resource to allocate space for results
 
-  std::unique_ptr<column> sorted_values;   ///< Memoised grouped and sorted values
+  std::shared_ptr<column> sorted_values;   ///< Memoised grouped and sorted values
   std::unique_ptr<column> grouped_values;  ///< Memoised grouped values
 };
 
@@ -397,6 +433,69 @@ void store_result_functor::operator()<aggregation::NTH_ELEMENT>(aggregation cons
                                              mr,
                                              stream));
 }
+
+template <>
+void store_result_functor::operator()<aggregation::HYPERLOGLOG>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto hll_agg = static_cast<cudf::detail::hyperloglog_aggregation const&>(agg);
+
+  cache.add_result(col_idx,
+                   agg,
+                   cudf::detail::hyperloglog_sketches(get_grouped_values(),
+                                                      helper.group_labels().data().get(),
+                                                      helper.num_groups(),
+                                                      hll_agg._precision,
+                                                      hll_agg._null_handling,
+                                                      mr,
+                                                      stream));
+}
+
+template <>
+void store_result_functor::operator()<aggregation::APPROX_NUNIQUE>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto hll_agg    = static_cast<cudf::detail::hyperloglog_aggregation const&>(agg);
+  auto sketch_agg = make_hyperloglog_aggregation(hll_agg._precision, hll_agg._null_handling);
+  operator()<aggregation::HYPERLOGLOG>(*sketch_agg);
+  column_view sketches = cache.get_result(col_idx, *sketch_agg);
+
+  cache.add_result(
+    col_idx, agg, cudf::detail::hyperloglog_estimates(sketches, hll_agg._precision, mr, stream));
+}
+
+template <>
+void store_result_functor::operator()<aggregation::TDIGEST>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto tdigest_agg = static_cast<cudf::detail::tdigest_aggregation const&>(agg);
+
+  cache.add_result(col_idx,
+                   agg,
+                   cudf::detail::tdigests(get_grouped_values(),
+                                          helper.group_labels().data().get(),
+                                          helper.num_groups(),
+                                          tdigest_agg._max_centroids,
+                                          mr,
+                                          stream));
+}
+
+template <>
+void store_result_functor::operator()<aggregation::APPROX_QUANTILE>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto tdigest_agg = static_cast<cudf::detail::tdigest_aggregation const&>(agg);
+  auto digest_agg  = make_tdigest_aggregation(tdigest_agg._max_centroids);
+  operator()<aggregation::TDIGEST>(*digest_agg);
+  column_view digests = cache.get_result(col_idx, *digest_agg);
+
+  cache.add_result(
+    col_idx, agg, cudf::detail::tdigest_quantiles(digests, tdigest_agg._quantiles, mr, stream));
+}
 }  // namespace detail
 
 // Sort-based groupby
@@ -410,13 +509,45 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort
   // sum and count. std depends on mean and count
   cudf::detail::result_cache cache(requests.size());
 
+  // Sort the values of all requests that need them sorted within groups at once,
+  // and only once for requests of the same values
+  std::vector<column_view> unsorted_values;
+  std::vector<int> sorted_index(requests.size(), -1);
   for (size_t i = 0; i < requests.size(); i++) {
-    auto store_functor =
-      detail::store_result_functor(i, requests[i].values, helper(), cache, stream, mr);
-    for (size_t j = 0; j < requests[i].aggregations.size(); j++) {
-      // TODO (dm): single pass compute all supported reductions
-      cudf::detail::aggregation_dispatcher(
-        requests[i].aggregations[j]->kind, store_functor, *requests[i].aggregations[j]);
+    if (not std::any_of(requests[i].aggregations.begin(),
+                        requests[i].aggregations.end(),
+                        [](auto const& agg) { return detail::needs_sorted_values(agg->kind); })) {
+      continue;
+    }
+    auto const same_values =
+      std::find_if(unsorted_values.begin(), unsorted_values.end(), [&](auto const& v) {
+        return detail::is_same_view(v, requests[i].values);
+      });
+    sorted_index[i] = same_values - unsorted_values.begin();
+    if (same_values == unsorted_values.end()) { unsorted_values.push_back(requests[i].values); }
+  }
+  std::vector<std::shared_ptr<column>> sorted_values;
+  for (auto& sorted :
+       helper().sorted_values(unsorted_values, rmm::mr::get_default_resource(), stream)) {
+    sorted_values.push_back(std::move(sorted));
+  }
+
+  {
+    CUDF_SCOPED_RANGE_PAYLOAD("groupby::sort::aggregate", requests.size());
+    for (size_t i = 0; i < requests.size(); i++) {
+      auto store_functor = detail::store_result_functor(
+        i,
+        requests[i].values,
+        helper(),
+        cache,
+        stream,
+        mr,
+        sorted_index[i] < 0 ? nullptr : sorted_values[sorted_index[i]]);
+      for (size_t j = 0; j < requests[i].aggregations.size(); j++) {
+        // TODO (dm): single pass compute all supported reductions
+        cudf::detail::aggregation_dispatcher(
+          requests[i].aggregations[j]->kind, store_functor, *requests[i].aggregations[j]);
+      }
     }
   }
 
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_scan.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace cudf {
+namespace groupby {
+// Sort-based groupby scan
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort_scan(
+  std::vector<aggregation_request> const& requests,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  // The stable sort of the keys keeps the rows of every group in their original order
+  auto const& group_labels = helper().group_labels(stream);
+
+  std::vector<aggregation_result> results(requests.size());
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const grouped_values =
+      helper().grouped_values(requests[i].values, rmm::mr::get_default_resource(), stream);
+
+    for (auto const& agg : requests[i].aggregations) {
+      switch (agg->kind) {
+        case aggregation::COUNT_VALID:
+          results[i].results.push_back(detail::group_count_scan(
+            grouped_values->view(), null_policy::EXCLUDE, group_labels, mr, stream));
+          break;
+        case aggregation::COUNT_ALL:
+        case aggregation::ROW_NUMBER:
+          results[i].results.push_back(detail::group_count_scan(
+            grouped_values->view(), null_policy::INCLUDE, group_labels, mr, stream));
+          break;
+        case aggregation::RANK: {
+          auto const& rank_agg = static_cast<cudf::detail::rank_aggregation const&>(*agg);
+          results[i].results.push_back(detail::group_rank(grouped_values->view(),
+                                                          rank_agg._method,
+                                                          rank_agg._column_order,
+                                                          rank_agg._null_handling,
+                                                          rank_agg._null_precedence,
+                                                          rank_agg._percentage,
+                                                          group_labels,
+                                                          helper().group_offsets(stream),
+                                                          mr,
+                                                          stream));
+          break;
+        }
+        default:
+          results[i].results.push_back(
+            detail::group_scan(grouped_values->view(), agg->kind, group_labels, mr, stream));
+      }
+    }
+  }
+
+  return std::make_pair(helper().sorted_keys(mr, stream), std::move(results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
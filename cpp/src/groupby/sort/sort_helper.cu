@@ -15,13 +15,17 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/structs/detail/flatten.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 
@@ -31,9 +35,12 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/sequence.h>
+#include <thrust/transform.h>
 #include <thrust/unique.h>
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
 #include <numeric>
 #include <tuple>
 
@@ -107,6 +114,7 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
   };
 
   if (_key_sorted_order) { return sliced_key_sorted_order(); }
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby::sort::sort_keys", _keys.num_rows());
 
   // TODO (dm): optimization. When keys are pre sorted but ignore nulls is true,
   //            we still want all rows with nulls in the end. Sort is costly, so
@@ -155,15 +163,19 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
 sort_groupby_helper::index_vector const& sort_groupby_helper::group_offsets(cudaStream_t stream)
 {
   if (_group_offsets) return *_group_offsets;
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby::sort::group_offsets", _keys.num_rows());
 
   _group_offsets = std::make_unique<index_vector>(num_keys(stream) + 1);
 
-  auto device_input_table = table_device_view::create(_keys, stream);
+  // struct keys are compared by their leaves
+  auto const flattened    = structs::detail::flatten_nested_columns(_keys, {}, {}, stream);
+  auto const keys         = flattened.flattened_columns();
+  auto device_input_table = table_device_view::create(keys, stream);
   auto sorted_order       = key_sort_order().data<size_type>();
   decltype(_group_offsets->begin()) result_end;
   auto exec = rmm::exec_policy(stream);
 
-  if (has_nulls(_keys)) {
+  if (has_nulls(keys)) {
     result_end = thrust::unique_copy(
       exec->on(stream),
       thrust::make_counting_iterator<size_type>(0),
@@ -257,6 +269,21 @@ column_view sort_groupby_helper::keys_bitmask_column(cudaStream_t stream)
   return _keys_bitmask_column->view();
 }
 
+std::size_t sort_groupby_helper::size_bytes() const
+{
+  auto const column_bytes = [](column_ptr const& c) -> std::size_t {
+    if (not c) { return 0; }
+    return c->size() * size_of(c->type()) +
+           (c->nullable() ? bitmask_allocation_size_bytes(c->size()) : 0);
+  };
+  auto const vector_bytes = [](index_vector_ptr const& v) -> std::size_t {
+    return v ? v->size() * sizeof(size_type) : 0;
+  };
+  return column_bytes(_key_sorted_order) + column_bytes(_unsorted_keys_labels) +
+         column_bytes(_keys_bitmask_column) + vector_bytes(_group_offsets) +
+         vector_bytes(_group_labels);
+}
+
 sort_groupby_helper::column_ptr sort_groupby_helper::sorted_values(
   column_view const& values, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
@@ -280,6 +307,87 @@ sort_groupby_helper::column_ptr sort_groupby_helper::sorted_values(
   return std::move(sorted_values_table->release()[0]);
 }
 
+std::vector<sort_groupby_helper::column_ptr> sort_groupby_helper::sorted_values(
+  std::vector<column_view> const& values,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const num_rows = _keys.num_rows();
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby::sort::sort_values", num_rows * values.size());
+  CUDF_EXPECTS(std::all_of(values.begin(),
+                           values.end(),
+                           [num_rows](auto const& v) { return v.size() == num_rows; }),
+               "Size mismatch between values and groupby keys");
+
+  std::vector<column_ptr> results(values.size());
+  std::vector<bool> is_batched(values.size(), false);
+  for (size_t i = 0; i < values.size(); i++) {
+    if (is_batched[i]) { continue; }
+
+    // Batch the columns of the same type, as long as their rows fit in a column
+    std::vector<size_t> batch{i};
+    for (size_t j = i + 1; j < values.size(); j++) {
+      if (not is_batched[j] and values[j].type() == values[i].type() and
+          int64_t{num_rows} * static_cast<int64_t>(batch.size() + 1) <=
+            std::numeric_limits<size_type>::max()) {
+        batch.push_back(j);
+        is_batched[j] = true;
+      }
+    }
+    if (batch.size() == 1) {
+      results[i] = sorted_values(values[i], mr, stream);
+      continue;
+    }
+
+    auto const temp_mr = rmm::mr::get_default_resource();
+    std::vector<column_view> batch_values;
+    std::transform(batch.begin(), batch.end(), std::back_inserter(batch_values), [&](auto b) {
+      return values[b];
+    });
+    auto all_values = cudf::detail::concatenate(batch_values, temp_mr, stream);
+
+    // The labels of the `b`-th column are offset by `b * num_groups`. Null labels
+    // of excluded keys keep sorting after the rows of all columns.
+    auto all_labels = cudf::detail::concatenate(
+      std::vector<column_view>(batch.size(), unsorted_keys_labels(stream)), temp_mr, stream);
+    auto all_labels_view   = all_labels->mutable_view();
+    auto const num_groups_ = num_groups();
+    auto const counting    = thrust::make_counting_iterator<size_type>(0);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      counting,
+                      counting + all_labels_view.size(),
+                      all_labels_view.begin<size_type>(),
+                      all_labels_view.begin<size_type>(),
+                      [num_rows, num_groups_] __device__(size_type i, size_type label) {
+                        return label + (i / num_rows) * num_groups_;
+                      });
+
+    auto const values_sort_order =
+      cudf::detail::stable_sorted_order(table_view({all_labels->view(), all_values->view()}),
+                                        {},
+                                        std::vector<null_order>(2, null_order::AFTER),
+                                        temp_mr,
+                                        stream);
+
+    // The sorted rows of the `b`-th column are the `b`-th run of num_keys() rows
+    auto const num_sorted = num_keys(stream);
+    for (size_t b = 0; b < batch.size(); b++) {
+      auto const begin       = static_cast<size_type>(b) * num_sorted;
+      column_view gather_map =
+        cudf::detail::slice(values_sort_order->view(), begin, begin + num_sorted);
+      auto sorted_values_table =
+        cudf::detail::gather(table_view({all_values->view()}),
+                             gather_map,
+                             cudf::detail::out_of_bounds_policy::NULLIFY,
+                             cudf::detail::negative_index_policy::NOT_ALLOWED,
+                             mr,
+                             stream);
+      results[batch[b]] = std::move(sorted_values_table->release()[0]);
+    }
+  }
+  return results;
+}
+
 sort_groupby_helper::column_ptr sort_groupby_helper::grouped_values(
   column_view const& values, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
@@ -303,6 +411,7 @@ std::unique_ptr<table> sort_groupby_helper::unique_keys(rmm::mr::device_memory_r
   auto gather_map_it = thrust::make_transform_iterator(
     group_offsets().begin(), [idx_data] __device__(size_type i) { return idx_data[i]; });
 
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby::sort::unique_keys", num_groups());
   return cudf::detail::gather(
     _keys, gather_map_it, gather_map_it + num_groups(), false, mr, stream);
 }
@@ -19,7 +19,6 @@
 
 #include <hash/hash_allocator.cuh>
 #include <hash/helper_functions.cuh>
-#include <hash/managed.cuh>
 
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/device_atomics.cuh>
@@ -29,7 +28,6 @@
 #include <thrust/pair.h>
 
 #include <cassert>
-#include <iostream>
 #include <iterator>
 #include <type_traits>
 
@@ -52,7 +50,7 @@ template <typename Key,
           Element unused_element,
           typename Hasher       = default_hash<Key>,
           typename Equality     = equal_to<Key>,
-          typename Allocator    = managed_allocator<thrust::pair<Key, Element>>,
+          typename Allocator    = default_allocator<thrust::pair<Key, Element>>,
           bool count_collisions = false>
 class concurrent_unordered_multimap {
  public:
@@ -142,9 +140,6 @@ class concurrent_unordered_multimap {
   /**
    * @brief Returns an iterator to the first element in the map
    *
-   * @note When using the managed allocator, host code that calls this function
-   * should ensure the stream used for `create()` is appropriately synchronized.
-   *
    * @note When called in a device code, user should make sure that it should
    * either be running on the same stream as create(), or the accessing stream
    * should be appropriately synchronized with the creating stream.
@@ -159,9 +154,6 @@ class concurrent_unordered_multimap {
   /**
    * @brief Returns a constant iterator to the first element in the map
    *
-   * @note When using the managed allocator, host code that calls this function
-   * should ensure the stream used for `create()` is appropriately synchronized.
-   *
    * @note When called in a device code, user should make sure that it should
    * either be running on the same stream as create(), or the accessing stream
    * should be appropriately synchronized with the creating stream.
@@ -176,9 +168,6 @@ class concurrent_unordered_multimap {
   /**
    * @brief Returns an iterator to the one past the last element in the map
    *
-   * @note When using the managed allocator, host code that calls this function
-   * should ensure the stream used for `create()` is appropriately synchronized.
-   *
    * @note When called in a device code, user should make sure that it should
    * either be running on the same stream as create(), or the accessing stream
    * should be appropriately synchronized with the creating stream.
@@ -194,9 +183,6 @@ class concurrent_unordered_multimap {
   /**
    * @brief Returns a constant iterator to the one past the last element in the map
    *
-   * @note When using the managed allocator, host code that calls this function
-   * should ensure the stream used for `create()` is appropriately synchronized.
-   *
    * @note When called in a device code, user should make sure that it should
    * either be running on the same stream as create(), or the accessing stream
    * should be appropriately synchronized with the creating stream.
@@ -512,25 +498,6 @@ class concurrent_unordered_multimap {
 
   unsigned long long get_num_collisions() const { return m_collisions; }
 
-  void print()
-  {
-    for (size_type i = 0; i < m_hashtbl_size; ++i) {
-      std::cout << i << ": " << m_hashtbl_values[i].first << "," << m_hashtbl_values[i].second
-                << std::endl;
-    }
-  }
-
-  void prefetch(const int dev_id, cudaStream_t stream = 0)
-  {
-    cudaPointerAttributes hashtbl_values_ptr_attributes;
-    cudaError_t status = cudaPointerGetAttributes(&hashtbl_values_ptr_attributes, m_hashtbl_values);
-
-    if (cudaSuccess == status && isPtrManaged(hashtbl_values_ptr_attributes)) {
-      CUDA_TRY(cudaMemPrefetchAsync(
-        m_hashtbl_values, m_hashtbl_size * sizeof(value_type), dev_id, stream));
-    }
-  }
-
   concurrent_unordered_multimap()                                     = delete;
   concurrent_unordered_multimap(concurrent_unordered_multimap const&) = default;
   concurrent_unordered_multimap(concurrent_unordered_multimap&&)      = default;
@@ -575,19 +542,6 @@ class concurrent_unordered_multimap {
   {
     m_hashtbl_values         = m_allocator.allocate(m_hashtbl_capacity, stream);
     constexpr int block_size = 128;
-    {
-      cudaPointerAttributes hashtbl_values_ptr_attributes;
-      cudaError_t status =
-        cudaPointerGetAttributes(&hashtbl_values_ptr_attributes, m_hashtbl_values);
-
-      if (cudaSuccess == status && isPtrManaged(hashtbl_values_ptr_attributes)) {
-        int dev_id = 0;
-        CUDA_TRY(cudaGetDevice(&dev_id));
-        CUDA_TRY(cudaMemPrefetchAsync(
-          m_hashtbl_values, m_hashtbl_size * sizeof(value_type), dev_id, stream));
-      }
-    }
-
     if (init) {
       init_hashtbl<<<((m_hashtbl_size - 1) / block_size) + 1, block_size, 0, stream>>>(
         m_hashtbl_values, m_hashtbl_size, unused_key, unused_element);
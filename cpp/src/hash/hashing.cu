@@ -23,12 +23,16 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/partitioning.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 
+#include <thrust/fill.h>
 #include <thrust/tabulate.h>
 
+#include <numeric>
+
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
@@ -609,6 +613,203 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   }
 }
 
+/**
+ * @brief Folds the MurmurHash3_32 of each element into the row hash with `hash_combine`.
+ *
+ * This produces the same values as `row_hasher` and `row_hasher_initial_values`.
+ */
+struct murmur3_folder {
+  using result_type = hash_value_type;
+
+  bool has_initial_hash;
+  hash_value_type initial_hash;  ///< initial hash value for the column being folded
+
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return true;
+  }
+
+  template <typename T>
+  __device__ result_type fold(result_type row_hash,
+                              column_device_view const& col,
+                              size_type row_index) const
+  {
+    MurmurHash3_32<hash_value_type> combiner{};
+    auto hash_value = element_hasher<MurmurHash3_32, true>{}.template operator()<T>(col, row_index);
+    if (has_initial_hash) { hash_value = combiner.hash_combine(initial_hash, hash_value); }
+    return combiner.hash_combine(row_hash, hash_value);
+  }
+};
+
+/**
+ * @brief Returns true if Spark-compatible hashing supports the type `T`.
+ */
+template <typename T>
+constexpr bool is_spark_hashable()
+{
+  return is_numeric<T>() || is_chrono<T>() || std::is_same<T, string_view>::value;
+}
+
+/**
+ * @brief Folds each element into the row hash by hashing it with the row hash as its seed.
+ *
+ * Null elements leave the row hash unchanged. This is how Spark combines the
+ * column hashes for its `hash` and `xxhash64` functions.
+ *
+ * @tparam hash_function SparkMurmurHash3_32 or XXHash_64
+ */
+template <template <typename> class hash_function>
+struct spark_folder {
+  using result_type = typename hash_function<int32_t>::result_type;
+
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_spark_hashable<T>();
+  }
+
+  template <typename T>
+  __device__ result_type fold(result_type row_hash,
+                              column_device_view const& col,
+                              size_type row_index) const
+  {
+    if (col.is_null(row_index)) { return row_hash; }
+    return hash_function<T>{row_hash}(col.element<T>(row_index));
+  }
+};
+
+template <typename Folder, typename T>
+struct fold_element_fn {
+  column_device_view d_column;
+  size_type const* d_indices;  // rows of `d_column` to hash, or all of them if null
+  typename Folder::result_type* d_results;
+  Folder folder;
+
+  __device__ void operator()(size_type row_index)
+  {
+    auto const element_index = d_indices ? d_indices[row_index] : row_index;
+    d_results[row_index] = folder.template fold<T>(d_results[row_index], d_column, element_index);
+  }
+};
+
+/**
+ * @brief Type-dispatched functor that folds one column into the row hash values.
+ *
+ * Hashing the table one column at a time reads each column with coalesced
+ * accesses and resolves its type once instead of once per element.
+ */
+template <typename Folder>
+struct fold_column_fn {
+  template <typename T, std::enable_if_t<Folder::template is_supported<T>()>* = nullptr>
+  void operator()(column_device_view const& d_column,
+                  size_type const* d_indices,
+                  size_type num_rows,
+                  typename Folder::result_type* d_results,
+                  Folder folder,
+                  cudaStream_t stream) const
+  {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_rows,
+                       fold_element_fn<Folder, T>{d_column, d_indices, d_results, folder});
+  }
+
+  template <typename T, std::enable_if_t<!Folder::template is_supported<T>()>* = nullptr>
+  void operator()(column_device_view const&,
+                  size_type const*,
+                  size_type,
+                  typename Folder::result_type*,
+                  Folder,
+                  cudaStream_t) const
+  {
+    CUDF_FAIL("Unsupported column type for hashing");
+  }
+};
+
+/**
+ * @brief Folds each column of `input` in order into the row hash values in `d_results`.
+ *
+ * @tparam Folder murmur3_folder or spark_folder
+ *
+ * @param input Rows to hash, read through their indices if they have any.
+ * @param d_results Row hash values, already initialized by the caller.
+ * @param make_folder Returns the folder to use for the given column index.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename Folder, typename FolderFactory>
+void fold_columns(indexed_table_view const& input,
+                  typename Folder::result_type* d_results,
+                  FolderFactory make_folder,
+                  cudaStream_t stream)
+{
+  auto const d_indices = input.has_indices() ? input.indices().data<size_type>() : nullptr;
+  for (size_type col_index = 0; col_index < input.num_columns(); ++col_index) {
+    auto const column   = input.table().column(col_index);
+    auto const d_column = column_device_view::create(column, stream);
+    cudf::type_dispatcher(column.type(),
+                          fold_column_fn<Folder>{},
+                          *d_column,
+                          d_indices,
+                          input.num_rows(),
+                          d_results,
+                          make_folder(col_index),
+                          stream);
+  }
+}
+
+// Spark-compatible hashes take at most one initial hash value as their seed
+uint32_t spark_seed(std::vector<uint32_t> const& initial_hash)
+{
+  CUDF_EXPECTS(initial_hash.size() <= 1, "Expected at most one initial hash value as seed");
+  return initial_hash.empty() ? 42 : initial_hash.front();
+}
+
+// Launch configuration for the warp-per-row MD5 kernel
+constexpr size_type MD5_WARP_BLOCK_SIZE = 256;
+// Average string bytes per row above which each row is hashed by a warp
+constexpr size_type MD5_WARP_THRESHOLD = 256;
+
+/**
+ * @brief Computes the MD5 of each row with one warp per row.
+ *
+ * The lanes copy the bytes of string elements into the shared hash state together
+ * while the first lane hashes the fixed-width elements and runs each MD5 step.
+ * This keeps the string reads coalesced when the rows hold long strings.
+ */
+__global__ void md5_warp_hash_kernel(table_device_view input, char* d_chars)
+{
+  constexpr size_type warps_per_block = MD5_WARP_BLOCK_SIZE / cudf::detail::warp_size;
+  __shared__ __align__(8) uint8_t shared_states[warps_per_block * sizeof(md5_intermediate_data)];
+
+  auto const thread_index = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  auto const row_index    = static_cast<size_type>(thread_index / cudf::detail::warp_size);
+  if (row_index >= input.num_rows()) { return; }  // the whole warp returns together
+
+  auto const lane = static_cast<int>(threadIdx.x % cudf::detail::warp_size);
+  auto hash_state = reinterpret_cast<md5_intermediate_data*>(shared_states) +
+                    (threadIdx.x / cudf::detail::warp_size);
+  if (lane == 0) { *hash_state = md5_intermediate_data{}; }
+  __syncwarp();
+
+  MD5Hash hasher = MD5Hash{};
+  for (int col_index = 0; col_index < input.num_columns(); col_index++) {
+    auto const column = input.column(col_index);
+    if (column.is_null(row_index)) { continue; }
+    if (column.type().id() == type_id::STRING) {
+      auto const key = column.element<string_view>(row_index);
+      hasher.process_warp(reinterpret_cast<uint8_t const*>(key.data()),
+                          static_cast<uint32_t>(key.size_bytes()),
+                          hash_state,
+                          lane);
+    } else if (lane == 0) {
+      cudf::type_dispatcher(column.type(), hasher, column, row_index, hash_state);
+    }
+    __syncwarp();
+  }
+  if (lane == 0) { hasher.finalize(hash_state, d_chars + (row_index * 32)); }
+}
+
 }  // namespace
 
 namespace detail {
@@ -635,7 +836,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   }
 }
 
-std::unique_ptr<column> hash(table_view const& input,
+std::unique_ptr<column> hash(indexed_table_view const& input,
                              hash_id hash_function,
                              std::vector<uint32_t> const& initial_hash,
                              rmm::mr::device_memory_resource* mr,
@@ -643,7 +844,13 @@ std::unique_ptr<column> hash(table_view const& input,
 {
   switch (hash_function) {
     case (hash_id::HASH_MURMUR3): return murmur_hash3_32(input, initial_hash, mr, stream);
-    case (hash_id::HASH_MD5): return md5_hash(input, mr, stream);
+    case (hash_id::HASH_MD5):
+      // the MD5 kernels read the rows of a table
+      if (input.has_indices()) { return md5_hash(input.materialize()->view(), mr, stream); }
+      return md5_hash(input.table(), mr, stream);
+    case (hash_id::HASH_SPARK_MURMUR3):
+      return spark_murmur_hash3_32(input, spark_seed(initial_hash), mr, stream);
+    case (hash_id::HASH_XXHASH64): return xxhash_64(input, spark_seed(initial_hash), mr, stream);
     default: return nullptr;
   }
 }
@@ -653,7 +860,7 @@ std::unique_ptr<column> md5_hash(table_view const& input,
                                  cudaStream_t stream)
 {
   if (input.num_columns() == 0 || input.num_rows() == 0) {
-    const string_scalar string_128bit("d41d8cd98f00b204e9orig98ecf8427e");
+    const string_scalar string_128bit("d41d8cd98f00b204e9800998ecf8427e");
     auto output = make_column_from_scalar(string_128bit, input.num_rows(), mr, stream);
     return output;
   }
@@ -684,6 +891,26 @@ std::unique_ptr<column> md5_hash(table_view const& input,
   bool const nullable     = has_nulls(input);
   auto const device_input = table_device_view::create(input, stream);
 
+  // Rows holding long strings are hashed by a warp each
+  auto const string_bytes =
+    std::accumulate(input.begin(), input.end(), int64_t{0}, [](int64_t bytes, auto col) {
+      return col.type().id() == type_id::STRING ? bytes + strings_column_view(col).chars_size()
+                                                : bytes;
+    });
+  if (string_bytes / input.num_rows() > MD5_WARP_THRESHOLD) {
+    auto const num_threads = static_cast<int64_t>(input.num_rows()) * cudf::detail::warp_size;
+    auto const num_blocks  = (num_threads + MD5_WARP_BLOCK_SIZE - 1) / MD5_WARP_BLOCK_SIZE;
+    md5_warp_hash_kernel<<<num_blocks, MD5_WARP_BLOCK_SIZE, 0, stream>>>(*device_input, d_chars);
+    CHECK_CUDA(stream);
+    return make_strings_column(input.num_rows(),
+                               std::move(offsets_column),
+                               std::move(chars_column),
+                               0,
+                               std::move(null_mask),
+                               stream,
+                               mr);
+  }
+
   // Hash each row, hashing each element sequentially left to right
   thrust::for_each(
     rmm::exec_policy(stream)->on(stream),
@@ -713,7 +940,7 @@ std::unique_ptr<column> md5_hash(table_view const& input,
                              mr);
 }
 
-std::unique_ptr<column> murmur_hash3_32(table_view const& input,
+std::unique_ptr<column> murmur_hash3_32(indexed_table_view const& input,
                                         std::vector<uint32_t> const& initial_hash,
                                         rmm::mr::device_memory_resource* mr,
                                         cudaStream_t stream)
@@ -725,46 +952,60 @@ std::unique_ptr<column> murmur_hash3_32(table_view const& input,
   // Return early if there's nothing to hash
   if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
 
-  bool const nullable     = has_nulls(input);
-  auto const device_input = table_device_view::create(input, stream);
-  auto output_view        = output->mutable_view();
-
-  // Compute the hash value for each row depending on the specified hash function
-  if (!initial_hash.empty()) {
-    CUDF_EXPECTS(initial_hash.size() == size_t(input.num_columns()),
-                 "Expected same size of initial hash values as number of columns");
-    auto device_initial_hash = rmm::device_vector<uint32_t>(initial_hash);
-
-    if (nullable) {
-      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher_initial_values<MurmurHash3_32, true>(
-                         *device_input, device_initial_hash.data().get()));
-    } else {
-      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher_initial_values<MurmurHash3_32, false>(
-                         *device_input, device_initial_hash.data().get()));
-    }
-  } else {
-    if (nullable) {
-      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher<MurmurHash3_32, true>(*device_input));
-    } else {
-      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher<MurmurHash3_32, false>(*device_input));
-    }
-  }
+  CUDF_EXPECTS(initial_hash.empty() || initial_hash.size() == size_t(input.num_columns()),
+               "Expected same size of initial hash values as number of columns");
+
+  // Hash one column at a time, combining each into the running row hash values
+  auto d_results = output->mutable_view().data<hash_value_type>();
+  thrust::fill_n(rmm::exec_policy(stream)->on(stream), d_results, input.num_rows(), 0);
+  fold_columns<murmur3_folder>(
+    input,
+    d_results,
+    [&initial_hash](size_type col_index) {
+      return initial_hash.empty() ? murmur3_folder{false, 0}
+                                  : murmur3_folder{true, initial_hash[col_index]};
+    },
+    stream);
 
   return output;
 }
 
+std::unique_ptr<column> spark_murmur_hash3_32(indexed_table_view const& input,
+                                              uint32_t seed,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::INT32), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (input.num_rows() == 0) { return output; }
+
+  // Each column is hashed with the hash of the columns before it as the seed
+  using folder_type = spark_folder<SparkMurmurHash3_32>;
+  auto d_results    = output->mutable_view().data<folder_type::result_type>();
+  thrust::fill_n(rmm::exec_policy(stream)->on(stream), d_results, input.num_rows(), seed);
+  fold_columns<folder_type>(
+    input, d_results, [](size_type) { return folder_type{}; }, stream);
+  return output;
+}
+
+std::unique_ptr<column> xxhash_64(indexed_table_view const& input,
+                                  uint64_t seed,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::INT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (input.num_rows() == 0) { return output; }
+
+  // Each column is hashed with the hash of the columns before it as the seed
+  using folder_type = spark_folder<XXHash_64>;
+  auto d_results    = output->mutable_view().data<folder_type::result_type>();
+  thrust::fill_n(rmm::exec_policy(stream)->on(stream), d_results, input.num_rows(), seed);
+  fold_columns<folder_type>(
+    input, d_results, [](size_type) { return folder_type{}; }, stream);
+  return output;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> hash(table_view const& input,
@@ -776,6 +1017,15 @@ std::unique_ptr<column> hash(table_view const& input,
   return detail::hash(input, hash_function, initial_hash, mr);
 }
 
+std::unique_ptr<column> hash(indexed_table_view const& input,
+                             hash_id hash_function,
+                             std::vector<uint32_t> const& initial_hash,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash(input, hash_function, initial_hash, mr);
+}
+
 std::unique_ptr<column> murmur_hash3_32(table_view const& input,
                                         std::vector<uint32_t> const& initial_hash,
                                         rmm::mr::device_memory_resource* mr)
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <hash/helper_functions.cuh>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+
+#include <cooperative_groups.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Default number of threads cooperating on one probe of an `open_addressing_map`
+ */
+constexpr int DEFAULT_PROBE_TILE_SIZE = 4;
+
+/**
+ * @brief Size in bytes of one value slot, zero for a map without values
+ */
+template <typename Value>
+struct map_value_size {
+  static constexpr size_t value = sizeof(Value);
+};
+
+template <>
+struct map_value_size<void> {
+  static constexpr size_t value = 0;
+};
+
+/**
+ * @brief Insert-only open-addressing hash table with linear probing done cooperatively by tiles
+ * of threads.
+ *
+ * Keys and values live in two separate arrays, so probing only loads keys and a value is read
+ * once its key matched. A probe starts at slot `hash % capacity` and moves over the table in
+ * windows of `tile.size()` consecutive slots: every thread of the tile loads one slot of the
+ * window, and the tile votes on the outcome, stopping after the first window holding an empty
+ * slot. A long collision chain is thus traversed `tile.size()` slots at a time, instead of one
+ * slot per dependent load as in `concurrent_unordered_map`.
+ *
+ * Inserts claim the first empty slot of the first window holding one, so all keys of a probe
+ * sequence lie before its first empty slot, which is what ends the search. The capacity is
+ * derived from the desired occupancy, i.e. the load factor, and always leaves an empty slot.
+ *
+ * All the threads of `tile` must call the device functions with the same arguments.
+ *
+ * @tparam Key Integral key type of 4 or 8 bytes, usable with `atomicCAS`
+ * @tparam Value Type of the value stored with every key, or `void` for a set of keys
+ */
+template <typename Key, typename Value>
+class open_addressing_map {
+ public:
+  using key_type   = Key;
+  using value_type = Value;
+
+  /**
+   * @brief Non-owning view of the map passed by value to kernels
+   */
+  class device_view {
+   public:
+    device_view(Key* keys, Value* values, size_t capacity, Key empty_key)
+      : _keys(keys), _values(values), _capacity(capacity), _empty_key(empty_key)
+    {
+    }
+
+    __host__ __device__ size_t capacity() const { return _capacity; }
+
+    __host__ __device__ Key empty_key() const { return _empty_key; }
+
+    template <typename V = Value>
+    __device__ V const& value(size_t slot) const
+    {
+      return _values[slot];
+    }
+
+    /**
+     * @brief Inserts `key` unless an equal key is present, and returns the key stored in the
+     * map, i.e. `key` or the first equal key inserted before it.
+     *
+     * @param tile The threads cooperating on the insert
+     * @param key The key to insert, never `empty_key()`
+     * @param hash The hash value of `key`
+     * @param key_equal Device callable comparing a stored key with `key`
+     */
+    template <typename Tile, typename KeyEqual>
+    __device__ Key insert_or_find(Tile const& tile,
+                                  Key key,
+                                  hash_value_type hash,
+                                  KeyEqual key_equal)
+    {
+      size_t window = hash % _capacity;
+      while (true) {
+        size_t const slot    = (window + tile.thread_rank()) % _capacity;
+        Key const existing   = load_key(slot);
+        bool const empty     = existing == _empty_key;
+        unsigned const found = tile.ballot(not empty and key_equal(existing, key));
+        if (found != 0) { return tile.shfl(existing, __ffs(found) - 1); }
+
+        unsigned const vacant = tile.ballot(empty);
+        if (vacant == 0) {
+          window = (window + tile.size()) % _capacity;
+          continue;
+        }
+        int const leader = __ffs(vacant) - 1;
+        Key winner{};
+        if (tile.thread_rank() == leader) { winner = atomicCAS(_keys + slot, _empty_key, key); }
+        winner = tile.shfl(winner, leader);
+        if (winner == _empty_key) { return key; }
+        // Another tile claimed the slot first, maybe with an equal key; look at the window again
+        if (key_equal(winner, key)) { return winner; }
+      }
+    }
+
+    /**
+     * @brief Inserts the pair (`key`, `value`), even if an equal key is already present.
+     *
+     * The value is written after its key is claimed, so it may only be read by kernels launched
+     * after the insert completed.
+     *
+     * @param tile The threads cooperating on the insert
+     * @param key The key to insert, never `empty_key()`
+     * @param hash The hash value of `key`
+     * @param value The value stored with `key`
+     */
+    template <typename Tile, typename V = Value>
+    __device__ void insert(Tile const& tile, Key key, hash_value_type hash, V const& value)
+    {
+      size_t window = hash % _capacity;
+      while (true) {
+        size_t const slot     = (window + tile.thread_rank()) % _capacity;
+        unsigned const vacant = tile.ballot(load_key(slot) == _empty_key);
+        if (vacant == 0) {
+          window = (window + tile.size()) % _capacity;
+          continue;
+        }
+        int const leader = __ffs(vacant) - 1;
+        int claimed{0};
+        if (tile.thread_rank() == leader) {
+          claimed = atomicCAS(_keys + slot, _empty_key, key) == _empty_key;
+          if (claimed) { _values[slot] = value; }
+        }
+        if (tile.shfl(claimed, leader) != 0) { return; }
+      }
+    }
+
+    /**
+     * @brief Calls `window_fn(occupied, key, slot)` on every thread of `tile` for each window of
+     * the probe sequence of `hash`, until the window holding the first empty slot was visited or
+     * `window_fn` returned `true` on a thread.
+     *
+     * @return Whether the probe was ended by `window_fn`
+     */
+    template <typename Tile, typename WindowFn>
+    __device__ bool probe(Tile const& tile, hash_value_type hash, WindowFn window_fn) const
+    {
+      size_t window = hash % _capacity;
+      while (true) {
+        size_t const slot = (window + tile.thread_rank()) % _capacity;
+        Key const key     = _keys[slot];
+        bool const empty  = key == _empty_key;
+        if (tile.any(window_fn(not empty, key, slot))) { return true; }
+        if (tile.any(empty)) { return false; }
+        window = (window + tile.size()) % _capacity;
+      }
+    }
+
+   private:
+    // Inserts race with other tiles, so the key is reloaded from memory on every attempt
+    __device__ Key load_key(size_t slot) const
+    {
+      return *reinterpret_cast<Key volatile const*>(_keys + slot);
+    }
+
+    Key* _keys;
+    Value* _values;
+    size_t _capacity;
+    Key _empty_key;
+  };
+
+  /**
+   * @brief Allocates a map for `num_keys` keys, with all slots empty.
+   *
+   * @param num_keys The number of keys that will be inserted
+   * @param empty_key Sentinel marking empty slots, which may never be inserted
+   * @param desired_occupancy The desired occupancy percentage, e.g., 50 implies a 50% occupancy
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  open_addressing_map(size_type num_keys,
+                      Key empty_key,
+                      uint32_t desired_occupancy = DEFAULT_HASH_TABLE_OCCUPANCY,
+                      cudaStream_t stream        = 0)
+    : _capacity(std::max(compute_hash_table_size(num_keys, desired_occupancy),
+                         static_cast<size_t>(num_keys) + 1)),
+      _empty_key(empty_key),
+      _keys(_capacity * sizeof(Key), stream),
+      _values(_capacity * map_value_size<Value>::value, stream)
+  {
+    CUDF_EXPECTS(desired_occupancy > 0 && desired_occupancy <= 100,
+                 "Hash map occupancy must be a percentage");
+    thrust::fill_n(rmm::exec_policy(stream)->on(stream),
+                   static_cast<Key*>(_keys.data()),
+                   _capacity,
+                   empty_key);
+  }
+
+  /**
+   * @brief Returns the device memory of a map for `num_keys` keys, in bytes.
+   */
+  static size_t memory_size(size_type num_keys,
+                            uint32_t desired_occupancy = DEFAULT_HASH_TABLE_OCCUPANCY)
+  {
+    auto const capacity = std::max(compute_hash_table_size(num_keys, desired_occupancy),
+                                   static_cast<size_t>(num_keys) + 1);
+    return capacity * (sizeof(Key) + map_value_size<Value>::value);
+  }
+
+  size_t capacity() const { return _capacity; }
+
+  Key empty_key() const { return _empty_key; }
+
+  /**
+   * @brief Returns the keys of all the slots, `empty_key()` in the empty ones
+   */
+  Key const* keys() const { return static_cast<Key const*>(_keys.data()); }
+
+  device_view view()
+  {
+    return device_view(static_cast<Key*>(_keys.data()),
+                       static_cast<Value*>(_values.data()),
+                       _capacity,
+                       _empty_key);
+  }
+
+  /**
+   * @brief Returns a view for probing; its insert functions must not be called.
+   */
+  device_view view() const { return const_cast<open_addressing_map*>(this)->view(); }
+
+ private:
+  size_t _capacity;
+  Key _empty_key;
+  rmm::device_buffer _keys;
+  rmm::device_buffer _values;
+};
+
+}  // namespace detail
+}  // namespace cudf
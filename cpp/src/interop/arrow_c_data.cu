@@ -0,0 +1,680 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/arrow_c_data.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/arrow_c_data.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <io/utilities/pinned_memory_pool.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the arrow format string of `type`
+ */
+std::string arrow_format(data_type type)
+{
+  switch (type.id()) {
+    case type_id::INT8: return "c";
+    case type_id::INT16: return "s";
+    case type_id::INT32: return "i";
+    case type_id::INT64: return "l";
+    case type_id::UINT8: return "C";
+    case type_id::UINT16: return "S";
+    case type_id::UINT32: return "I";
+    case type_id::UINT64: return "L";
+    case type_id::FLOAT32: return "f";
+    case type_id::FLOAT64: return "g";
+    case type_id::BOOL8: return "b";
+    case type_id::TIMESTAMP_DAYS: return "tdD";
+    case type_id::TIMESTAMP_SECONDS: return "tss:";
+    case type_id::TIMESTAMP_MILLISECONDS: return "tsm:";
+    case type_id::TIMESTAMP_MICROSECONDS: return "tsu:";
+    case type_id::TIMESTAMP_NANOSECONDS: return "tsn:";
+    case type_id::DURATION_SECONDS: return "tDs";
+    case type_id::DURATION_MILLISECONDS: return "tDm";
+    case type_id::DURATION_MICROSECONDS: return "tDu";
+    case type_id::DURATION_NANOSECONDS: return "tDn";
+    case type_id::STRING: return "u";
+    case type_id::LIST: return "+l";
+    case type_id::STRUCT: return "+s";
+    default: CUDF_FAIL("Unsupported type for the arrow C data interface");
+  }
+}
+
+/**
+ * @brief Returns the cudf type of an arrow format string
+ *
+ * The timezone of timestamps is ignored.
+ */
+data_type arrow_format_to_cudf_type(std::string format)
+{
+  static std::unordered_map<std::string, type_id> const types{
+    {"c", type_id::INT8},
+    {"s", type_id::INT16},
+    {"i", type_id::INT32},
+    {"l", type_id::INT64},
+    {"C", type_id::UINT8},
+    {"S", type_id::UINT16},
+    {"I", type_id::UINT32},
+    {"L", type_id::UINT64},
+    {"f", type_id::FLOAT32},
+    {"g", type_id::FLOAT64},
+    {"b", type_id::BOOL8},
+    {"tdD", type_id::TIMESTAMP_DAYS},
+    {"tss:", type_id::TIMESTAMP_SECONDS},
+    {"tsm:", type_id::TIMESTAMP_MILLISECONDS},
+    {"tsu:", type_id::TIMESTAMP_MICROSECONDS},
+    {"tsn:", type_id::TIMESTAMP_NANOSECONDS},
+    {"tDs", type_id::DURATION_SECONDS},
+    {"tDm", type_id::DURATION_MILLISECONDS},
+    {"tDu", type_id::DURATION_MICROSECONDS},
+    {"tDn", type_id::DURATION_NANOSECONDS},
+    {"u", type_id::STRING},
+    {"+l", type_id::LIST},
+    {"+s", type_id::STRUCT}};
+  if (format.compare(0, 2, "ts") == 0) { format = format.substr(0, 4); }
+  auto const type = types.find(format);
+  CUDF_EXPECTS(type != types.end(), "Unsupported arrow format " + format);
+  return data_type{type->second};
+}
+
+/**
+ * @brief The strings referenced by an exported schema, along with its children
+ */
+struct exported_schema {
+  std::string format;
+  std::string name;
+  std::vector<ArrowSchema*> children;
+
+  ~exported_schema()
+  {
+    for (auto child : children) {
+      if (child->release != nullptr) { child->release(child); }
+      delete child;
+    }
+  }
+};
+
+void release_schema(ArrowSchema* schema)
+{
+  delete static_cast<exported_schema*>(schema->private_data);
+  schema->release = nullptr;
+}
+
+/**
+ * @brief Exports the schema of `column` named `name` into `out`
+ */
+void export_schema(column_view const& column, std::string const& name, ArrowSchema* out);
+
+/**
+ * @brief Exports a schema of the given format and children into `out`
+ */
+void export_schema(std::string const& format,
+                   std::string const& name,
+                   int64_t flags,
+                   std::vector<column_view> const& children,
+                   std::vector<std::string> const& child_names,
+                   ArrowSchema* out)
+{
+  auto exported = std::make_unique<exported_schema>(exported_schema{format, name, {}});
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    exported->children.push_back(new ArrowSchema{});
+    export_schema(children[i], child_names[i], exported->children.back());
+  }
+  *out = ArrowSchema{exported->format.c_str(),
+                     exported->name.c_str(),
+                     nullptr,
+                     flags,
+                     static_cast<int64_t>(exported->children.size()),
+                     exported->children.data(),
+                     nullptr,
+                     release_schema,
+                     exported.get()};
+  exported.release();
+}
+
+void export_schema(column_view const& column, std::string const& name, ArrowSchema* out)
+{
+  auto const flags = column.nullable() ? ARROW_FLAG_NULLABLE : 0;
+  switch (column.type().id()) {
+    case type_id::LIST: {
+      auto const child = lists_column_view{column}.child();
+      return export_schema("+l", name, flags, {child}, {"item"}, out);
+    }
+    case type_id::STRUCT: {
+      std::vector<column_view> children(column.child_begin(), column.child_end());
+      std::vector<std::string> const child_names(children.size());
+      return export_schema("+s", name, flags, children, child_names, out);
+    }
+    default: return export_schema(arrow_format(column.type()), name, flags, {}, {}, out);
+  }
+}
+
+/**
+ * @brief Frees a block of the pinned memory pool
+ */
+struct pinned_deleter {
+  std::size_t size;
+  void operator()(void* ptr) const { io::detail::pinned_memory_pool::get().deallocate(ptr, size); }
+};
+
+/**
+ * @brief The memory backing the exported arrays of a table, shared by all of them
+ */
+struct exported_memory {
+  std::unique_ptr<table> table;
+  std::vector<rmm::device_buffer> device_buffers;
+  std::vector<std::unique_ptr<void, pinned_deleter>> host_buffers;
+};
+
+/**
+ * @brief The buffer addresses of an exported array, along with its children
+ *
+ * Every array holds a reference to the memory of the table, so children moved out of their parent
+ * by the consumer keep their buffers alive after the parent is released.
+ */
+struct exported_array {
+  std::shared_ptr<exported_memory> memory;
+  std::vector<void const*> buffers;
+  std::vector<ArrowArray*> children;
+
+  ~exported_array()
+  {
+    for (auto child : children) {
+      if (child->release != nullptr) { child->release(child); }
+      delete child;
+    }
+  }
+};
+
+void release_array(ArrowArray* array)
+{
+  delete static_cast<exported_array*>(array->private_data);
+  array->release = nullptr;
+}
+
+/**
+ * @brief Exports columns as arrow arrays of their device buffers, or of host copies of them
+ */
+class array_exporter {
+ public:
+  array_exporter(std::shared_ptr<exported_memory> memory, bool to_host, cudaStream_t stream)
+    : _memory{std::move(memory)}, _to_host{to_host}, _stream{stream}
+  {
+  }
+
+  /**
+   * @brief Exports the columns of `input` as the children of a struct array into `out`
+   */
+  void export_table(table_view const& input, ArrowArray* out)
+  {
+    std::vector<column_view> const columns(input.begin(), input.end());
+    export_array(input.num_rows(), 0, 0, {nullptr}, columns, out);
+  }
+
+ private:
+  /**
+   * @brief Returns the address of the exported copy of the `size` bytes at `data`
+   */
+  void const* buffer(void const* data, std::size_t size)
+  {
+    if (not _to_host or data == nullptr or size == 0) { return data; }
+    auto host = io::detail::pinned_memory_pool::get().allocate(size);
+    _memory->host_buffers.emplace_back(host, pinned_deleter{size});
+    CUDA_TRY(cudaMemcpyAsync(host, data, size, cudaMemcpyDeviceToHost, _stream));
+    return host;
+  }
+
+  /**
+   * @brief Returns the address of the exported copy of a new device buffer
+   */
+  void const* buffer(rmm::device_buffer&& data)
+  {
+    _memory->device_buffers.push_back(std::move(data));
+    auto const& stored = _memory->device_buffers.back();
+    return buffer(stored.data(), stored.size());
+  }
+
+  /**
+   * @brief Returns a device buffer of a single zero offset, for the offsets of empty columns
+   */
+  rmm::device_buffer zero_offset()
+  {
+    rmm::device_buffer offsets{sizeof(size_type), _stream};
+    CUDA_TRY(cudaMemsetAsync(offsets.data(), 0, sizeof(size_type), _stream));
+    return offsets;
+  }
+
+  void export_array(int64_t length,
+                    int64_t null_count,
+                    int64_t offset,
+                    std::vector<void const*>&& buffers,
+                    std::vector<column_view> const& children,
+                    ArrowArray* out)
+  {
+    auto exported     = std::make_unique<exported_array>();
+    exported->memory  = _memory;
+    exported->buffers = std::move(buffers);
+    for (auto const& child : children) {
+      exported->children.push_back(new ArrowArray{});
+      export_column(child, exported->children.back());
+    }
+    *out = ArrowArray{length,
+                      null_count,
+                      offset,
+                      static_cast<int64_t>(exported->buffers.size()),
+                      static_cast<int64_t>(exported->children.size()),
+                      exported->buffers.data(),
+                      exported->children.data(),
+                      nullptr,
+                      release_array,
+                      exported.get()};
+    exported.release();
+  }
+
+  /**
+   * @brief Exports `column` into `out`
+   *
+   * The arrow offset is the offset of the column, so the buffers are exported from their start
+   * up to the last row of the column.
+   */
+  void export_column(column_view const& column, ArrowArray* out)
+  {
+    auto const num_rows = column.offset() + column.size();
+    auto const mask =
+      column.nullable()
+        ? buffer(column.null_mask(), num_bitmask_words(num_rows) * sizeof(bitmask_type))
+        : nullptr;
+    auto const null_count = column.null_count();
+
+    switch (column.type().id()) {
+      case type_id::BOOL8: {
+        auto const values = column.head<bool>();
+        auto bits         = valid_if(
+          thrust::make_counting_iterator<size_type>(0),
+          thrust::make_counting_iterator<size_type>(num_rows),
+          [values] __device__(size_type row) { return values[row]; },
+          _stream);
+        auto const data = buffer(std::move(bits.first));
+        return export_array(column.size(), null_count, column.offset(), {mask, data}, {}, out);
+      }
+      case type_id::STRING: {
+        if (column.num_children() == 0) {
+          auto const offsets = buffer(zero_offset());
+          return export_array(0, 0, 0, {nullptr, offsets, nullptr}, {}, out);
+        }
+        strings_column_view const strings{column};
+        auto const offsets =
+          buffer(strings.offsets().data<size_type>(), (num_rows + 1) * sizeof(size_type));
+        auto const chars = buffer(strings.chars().data<char>(), strings.chars_size());
+        return export_array(
+          column.size(), null_count, column.offset(), {mask, offsets, chars}, {}, out);
+      }
+      case type_id::LIST: {
+        lists_column_view const lists{column};
+        auto const offsets =
+          buffer(lists.offsets().data<size_type>(), (num_rows + 1) * sizeof(size_type));
+        return export_array(
+          column.size(), null_count, column.offset(), {mask, offsets}, {lists.child()}, out);
+      }
+      case type_id::STRUCT: {
+        std::vector<column_view> const children(column.child_begin(), column.child_end());
+        return export_array(column.size(), null_count, column.offset(), {mask}, children, out);
+      }
+      default: {
+        CUDF_EXPECTS(is_fixed_width(column.type()) and column.type().id() != type_id::DURATION_DAYS,
+                     "Unsupported type for the arrow C data interface");
+        auto const data = buffer(column.head(), num_rows * size_of(column.type()));
+        return export_array(column.size(), null_count, column.offset(), {mask, data}, {}, out);
+      }
+    }
+  }
+
+  std::shared_ptr<exported_memory> _memory;
+  bool _to_host;
+  cudaStream_t _stream;
+};
+
+/**
+ * @brief Exports the schema and the arrays of a table, returning once the export has completed
+ */
+void export_table(table_view const& input,
+                  std::shared_ptr<exported_memory> memory,
+                  bool to_host,
+                  ArrowSchema* schema_out,
+                  ArrowArray* array_out,
+                  std::vector<std::string> const& column_names,
+                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(schema_out != nullptr and array_out != nullptr, "Invalid output arrow structures");
+  CUDF_EXPECTS(column_names.empty() or
+                 column_names.size() == static_cast<std::size_t>(input.num_columns()),
+               "column names should be empty or should be equal to number of columns in table");
+
+  std::vector<column_view> const columns(input.begin(), input.end());
+  auto const names =
+    column_names.empty() ? std::vector<std::string>(columns.size()) : column_names;
+
+  ArrowSchema schema{};
+  export_schema("+s", "", 0, columns, names, &schema);
+  *array_out = ArrowArray{};
+  try {
+    array_exporter{memory, to_host, stream}.export_table(input, array_out);
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  } catch (...) {
+    if (array_out->release != nullptr) { array_out->release(array_out); }
+    schema.release(&schema);
+    throw;
+  }
+  *schema_out = schema;
+
+  // the host copies are complete, so the device buffers created for them can be freed
+  if (to_host) { memory->device_buffers.clear(); }
+}
+
+/**
+ * @brief Imports arrow arrays as column views, copying the buffers that cannot be used in place
+ */
+class array_importer {
+ public:
+  array_importer(bool device_accessible,
+                 std::vector<rmm::device_buffer>& copies,
+                 rmm::mr::device_memory_resource* mr,
+                 cudaStream_t stream)
+    : _device_accessible{device_accessible}, _copies{copies}, _mr{mr}, _stream{stream}
+  {
+  }
+
+  column_view import_column(ArrowSchema const& schema, ArrowArray const& array)
+  {
+    CUDF_EXPECTS(array.dictionary == nullptr, "Unsupported arrow dictionary array");
+    CUDF_EXPECTS(array.offset + array.length <= std::numeric_limits<size_type>::max(),
+                 "Arrow array too large for a cudf column");
+    auto const type     = arrow_format_to_cudf_type(schema.format);
+    auto const size     = static_cast<size_type>(array.length);
+    auto const offset   = static_cast<size_type>(array.offset);
+    auto const num_rows = offset + size;
+
+    auto const has_mask = array.n_buffers > 0 and array.buffers[0] != nullptr and
+                          array.null_count != 0;
+    auto const null_mask =
+      has_mask ? static_cast<bitmask_type const*>(bitmask_buffer(array.buffers[0], num_rows))
+               : nullptr;
+    // An unknown arrow null count is -1, the same as `UNKNOWN_NULL_COUNT`
+    auto const null_count = has_mask ? static_cast<size_type>(array.null_count) : 0;
+
+    switch (type.id()) {
+      case type_id::BOOL8: {
+        check_layout(array, 2, 0);
+        auto const bits =
+          static_cast<bitmask_type const*>(bitmask_buffer(array.buffers[1], num_rows));
+        _copies.emplace_back(num_rows * sizeof(bool), _stream, _mr);
+        auto const values = static_cast<bool*>(_copies.back().data());
+        thrust::transform(rmm::exec_policy(_stream)->on(_stream),
+                          thrust::make_counting_iterator<size_type>(0),
+                          thrust::make_counting_iterator<size_type>(num_rows),
+                          values,
+                          [bits] __device__(size_type row) { return bit_is_set(bits, row); });
+        return column_view{type, size, values, null_mask, null_count, offset};
+      }
+      case type_id::STRING: {
+        check_layout(array, 3, 0);
+        if (num_rows == 0) { return column_view{type, 0, nullptr}; }
+        auto const offsets    = offsets_buffer(array.buffers[1], num_rows);
+        auto const chars_size = last_offset(offsets, num_rows);
+        column_view const chars{
+          data_type{type_id::INT8}, chars_size, buffer(array.buffers[2], chars_size, 1)};
+        std::vector<column_view> const children{offsets_view(offsets, num_rows), chars};
+        return column_view{type, size, nullptr, null_mask, null_count, offset, children};
+      }
+      case type_id::LIST: {
+        check_layout(array, 2, 1);
+        auto const offsets = offsets_buffer(array.buffers[1], num_rows);
+        auto const child   = import_column(*schema.children[0], *array.children[0]);
+        std::vector<column_view> const children{offsets_view(offsets, num_rows), child};
+        return column_view{type, size, nullptr, null_mask, null_count, offset, children};
+      }
+      case type_id::STRUCT: {
+        check_layout(array, 1, schema.n_children);
+        std::vector<column_view> children;
+        for (int64_t i = 0; i < array.n_children; ++i) {
+          children.push_back(import_column(*schema.children[i], *array.children[i]));
+        }
+        return column_view{type, size, nullptr, null_mask, null_count, offset, children};
+      }
+      default: {
+        check_layout(array, 2, 0);
+        auto const data = buffer(array.buffers[1], num_rows * size_of(type), size_of(type));
+        return column_view{type, size, data, null_mask, null_count, offset};
+      }
+    }
+  }
+
+ private:
+  static void check_layout(ArrowArray const& array, int64_t n_buffers, int64_t n_children)
+  {
+    CUDF_EXPECTS(array.n_buffers == n_buffers and array.n_children == n_children,
+                 "Arrow array layout does not match its format");
+  }
+
+  /**
+   * @brief Returns the device address of the `size` bytes at `data`, copying them if they are not
+   * device accessible or not aligned to `alignment` bytes
+   *
+   * @param allocation_size Minimum size of the copy, for buffers read past their used bytes
+   */
+  void const* buffer(void const* data,
+                     std::size_t size,
+                     std::size_t alignment,
+                     std::size_t allocation_size = 0)
+  {
+    if (data == nullptr or size == 0) { return data; }
+    if (_device_accessible and reinterpret_cast<std::uintptr_t>(data) % alignment == 0) {
+      return data;
+    }
+    _copies.emplace_back(std::max(size, allocation_size), _stream, _mr);
+    CUDA_TRY(cudaMemcpyAsync(_copies.back().data(), data, size, cudaMemcpyDefault, _stream));
+    return _copies.back().data();
+  }
+
+  /**
+   * @brief Returns the device address of a bitmap of `num_bits` bits, which cudf reads a word at a
+   * time
+   */
+  void const* bitmask_buffer(void const* data, size_type num_bits)
+  {
+    return buffer(data,
+                  (num_bits + 7) / 8,
+                  sizeof(bitmask_type),
+                  bitmask_allocation_size_bytes(num_bits));
+  }
+
+  size_type const* offsets_buffer(void const* data, size_type num_rows)
+  {
+    CUDF_EXPECTS(data != nullptr, "Missing arrow offsets buffer");
+    return static_cast<size_type const*>(
+      buffer(data, (num_rows + 1) * sizeof(size_type), sizeof(size_type)));
+  }
+
+  static column_view offsets_view(size_type const* offsets, size_type num_rows)
+  {
+    return column_view{data_type{type_id::INT32}, num_rows + 1, offsets};
+  }
+
+  /**
+   * @brief Returns the offset past the last row, which is read back from device memory
+   */
+  size_type last_offset(size_type const* offsets, size_type num_rows)
+  {
+    size_type last{};
+    CUDA_TRY(cudaMemcpyAsync(
+      &last, offsets + num_rows, sizeof(size_type), cudaMemcpyDefault, _stream));
+    CUDA_TRY(cudaStreamSynchronize(_stream));
+    return last;
+  }
+
+  bool _device_accessible;
+  std::vector<rmm::device_buffer>& _copies;
+  rmm::mr::device_memory_resource* _mr;
+  cudaStream_t _stream;
+};
+
+}  // namespace
+
+arrow_device_table_view from_arrow_device(ArrowSchema const* schema,
+                                          ArrowDeviceArray* input,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  CUDF_EXPECTS(schema != nullptr and input != nullptr and input->array.release != nullptr,
+               "Invalid arrow array");
+  CUDF_EXPECTS(std::string{schema->format} == "+s" and
+                 schema->n_children == input->array.n_children,
+               "The arrow array must be a struct array of the columns of a table");
+  auto const device_type = input->device_type;
+  CUDF_EXPECTS(device_type == ARROW_DEVICE_CPU or device_type == ARROW_DEVICE_CUDA or
+                 device_type == ARROW_DEVICE_CUDA_HOST or device_type == ARROW_DEVICE_CUDA_MANAGED,
+               "Unsupported arrow device type");
+  if (device_type == ARROW_DEVICE_CUDA) {
+    int device{};
+    CUDA_TRY(cudaGetDevice(&device));
+    CUDF_EXPECTS(input->device_id == device, "The arrow array is not on the current device");
+  }
+  if (input->sync_event != nullptr) {
+    CUDA_TRY(cudaStreamWaitEvent(stream, *static_cast<cudaEvent_t*>(input->sync_event), 0));
+  }
+
+  arrow_device_table_view result;
+  result.array = std::shared_ptr<ArrowArray>(new ArrowArray(input->array), [](ArrowArray* array) {
+    if (array->release != nullptr) { array->release(array); }
+    delete array;
+  });
+  input->array.release = nullptr;
+
+  auto const& array = *result.array;
+  CUDF_EXPECTS(array.n_buffers == 0 or array.buffers[0] == nullptr or array.null_count == 0,
+               "The struct array of a table cannot have nulls");
+  array_importer importer{device_type != ARROW_DEVICE_CPU, result.copied_buffers, mr, stream};
+  // the offset of the struct array applies to all of its children
+  auto const begin = static_cast<size_type>(array.offset);
+  auto const end   = static_cast<size_type>(array.offset + array.length);
+  std::vector<column_view> columns;
+  for (int64_t i = 0; i < array.n_children; ++i) {
+    auto const column = importer.import_column(*schema->children[i], *array.children[i]);
+    columns.push_back(slice(column, {begin, end})[0]);
+  }
+  result.table = table_view{columns};
+
+  if (device_type == ARROW_DEVICE_CPU) {
+    // nothing references the host buffers once they have been copied
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    result.array.reset();
+  }
+  return result;
+}
+
+arrow_device_table_view from_arrow_host(ArrowSchema const* schema,
+                                        ArrowArray* input,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  CUDF_EXPECTS(input != nullptr, "Invalid arrow array");
+  ArrowDeviceArray device_array{};
+  device_array.array       = *input;
+  device_array.device_id   = -1;
+  device_array.device_type = ARROW_DEVICE_CPU;
+  input->release           = nullptr;
+  return from_arrow_device(schema, &device_array, mr, stream);
+}
+
+}  // namespace detail
+
+void to_arrow_device(std::unique_ptr<table> input,
+                     ArrowSchema* schema_out,
+                     ArrowDeviceArray* array_out,
+                     std::vector<std::string> const& column_names,
+                     cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(input != nullptr and array_out != nullptr, "Invalid table");
+
+  auto const view = input->view();
+  auto memory     = std::make_shared<detail::exported_memory>();
+  memory->table   = std::move(input);
+
+  int device{};
+  CUDA_TRY(cudaGetDevice(&device));
+  *array_out             = ArrowDeviceArray{};
+  array_out->device_id   = device;
+  array_out->device_type = ARROW_DEVICE_CUDA;
+  array_out->sync_event  = nullptr;
+  detail::export_table(
+    view, std::move(memory), false, schema_out, &array_out->array, column_names, stream);
+}
+
+void to_arrow_host(table_view const& input,
+                   ArrowSchema* schema_out,
+                   ArrowArray* array_out,
+                   std::vector<std::string> const& column_names,
+                   cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  detail::export_table(input,
+                       std::make_shared<detail::exported_memory>(),
+                       true,
+                       schema_out,
+                       array_out,
+                       column_names,
+                       stream);
+}
+
+arrow_device_table_view from_arrow_device(ArrowSchema const* schema,
+                                          ArrowDeviceArray* input,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_arrow_device(schema, input, mr);
+}
+
+arrow_device_table_view from_arrow_host(ArrowSchema const* schema,
+                                        ArrowArray* input,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_arrow_host(schema, input, mr);
+}
+
+}  // namespace cudf
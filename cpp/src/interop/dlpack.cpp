@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/interop.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -100,6 +101,9 @@ struct dltensor_context {
   int64_t shape[2];
   int64_t strides[2];
   rmm::device_buffer buffer;
+  // Owners of the tensor data when it is exported without a copy
+  std::unique_ptr<column> owned_column;
+  std::unique_ptr<rmm::device_buffer> owned_data;
 
   static void deleter(DLManagedTensor* arg)
   {
@@ -109,28 +113,44 @@ struct dltensor_context {
   }
 };
 
-}  // namespace
-
-namespace detail {
-std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
-                                   rmm::mr::device_memory_resource* mr,
-                                   cudaStream_t stream)
+/**
+ * @brief Describes `data` in `tensor` as a GPU tensor of `num_rows` rows and `num_cols` columns of
+ * `type`, whose rows are `row_stride` and columns `col_stride` elements apart.
+ *
+ * A single column is described as a 1D compact tensor. The shape and strides are stored in
+ * `context`.
+ */
+void describe_tensor(DLTensor& tensor,
+                     dltensor_context& context,
+                     void* data,
+                     data_type type,
+                     int64_t num_rows,
+                     int64_t num_cols,
+                     int64_t row_stride,
+                     int64_t col_stride)
 {
-  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
-  auto const& tensor = managed_tensor->dl_tensor;
-
-  // We can copy from host or device pointers
-  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type || kDLCPU == tensor.ctx.device_type ||
-                 kDLCPUPinned == tensor.ctx.device_type,
-               "DLTensor must be GPU, CPU, or pinned type");
+  tensor.data  = data;
+  tensor.dtype = data_type_to_DLDataType(type);
 
-  // Make sure the current device ID matches the Tensor's device ID
-  if (tensor.ctx.device_type != kDLCPU) {
-    int device_id = 0;
-    CUDA_TRY(cudaGetDevice(&device_id));
-    CUDF_EXPECTS(tensor.ctx.device_id == device_id, "DLTensor device ID must be current device");
+  tensor.ndim     = (num_cols > 1) ? 2 : 1;
+  tensor.shape    = context.shape;
+  tensor.shape[0] = num_rows;
+  if (tensor.ndim > 1) {
+    tensor.shape[1]   = num_cols;
+    tensor.strides    = context.strides;
+    tensor.strides[0] = row_stride;
+    tensor.strides[1] = col_stride;
   }
 
+  CUDA_TRY(cudaGetDevice(&tensor.ctx.device_id));
+  tensor.ctx.device_type = kDLGPU;
+}
+
+/**
+ * @brief Throws if the shape of `tensor` is not supported by cudf
+ */
+void validate_tensor_shape(DLTensor const& tensor)
+{
   // Currently only 1D and 2D tensors are supported
   CUDF_EXPECTS(tensor.ndim > 0 && tensor.ndim <= 2, "DLTensor must be 1D or 2D");
 
@@ -144,6 +164,37 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
     CUDF_EXPECTS(tensor.shape[1] < std::numeric_limits<size_type>::max(),
                  "DLTensor second dim exceeds size supported by cudf");
   }
+}
+
+/**
+ * @brief Throws if `tensor` is not on the current device
+ */
+void validate_tensor_device(DLTensor const& tensor)
+{
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  CUDF_EXPECTS(tensor.ctx.device_id == device_id, "DLTensor device ID must be current device");
+}
+
+}  // namespace
+
+namespace detail {
+std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  // We can copy from host or device pointers
+  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type || kDLCPU == tensor.ctx.device_type ||
+                 kDLCPUPinned == tensor.ctx.device_type,
+               "DLTensor must be GPU, CPU, or pinned type");
+
+  // Make sure the current device ID matches the Tensor's device ID
+  if (tensor.ctx.device_type != kDLCPU) { validate_tensor_device(tensor); }
+
+  validate_tensor_shape(tensor);
 
   size_t const num_columns = (tensor.ndim == 2) ? static_cast<size_t>(tensor.shape[1]) : 1;
 
@@ -188,8 +239,8 @@ DLManagedTensor* to_dlpack(table_view const& input,
   if (num_rows == 0) { return nullptr; }
 
   // Ensure that type is convertible to DLDataType
-  data_type const type    = input.column(0).type();
-  DLDataType const dltype = data_type_to_DLDataType(type);
+  data_type const type = input.column(0).type();
+  data_type_to_DLDataType(type);
 
   // Ensure all columns are the same type
   CUDF_EXPECTS(
@@ -204,36 +255,17 @@ DLManagedTensor* to_dlpack(table_view const& input,
   auto managed_tensor = std::make_unique<DLManagedTensor>();
   auto context        = std::make_unique<dltensor_context>();
 
-  DLTensor& tensor = managed_tensor->dl_tensor;
-  tensor.dtype     = dltype;
-
-  tensor.ndim     = (num_cols > 1) ? 2 : 1;
-  tensor.shape    = context->shape;
-  tensor.shape[0] = num_rows;
-  if (tensor.ndim > 1) {
-    tensor.shape[1]   = num_cols;
-    tensor.strides    = context->strides;
-    tensor.strides[0] = 1;
-    tensor.strides[1] = num_rows;
-  }
-
-  CUDA_TRY(cudaGetDevice(&tensor.ctx.device_id));
-  tensor.ctx.device_type = kDLGPU;
-
-  // If there is only one column, then a 1D tensor can just copy the pointer
-  // to the data in the column, and the deleter should not delete the original
-  // data. However, this is inconsistent with the 2D cases where we must do a
-  // copy of each column's data into the dense tensor array. Also, if we don't
-  // copy, then the original column data could be changed, which would change
-  // the contents of the tensor, which might be surprising or cause issues.
-  // Therefore, for now we ALWAYS do a copy of the data. If this becomes
-  // a performance issue we can reevaluate in the future.
+  // The view does not own its data, which could be changed or freed while the tensor is in use,
+  // so the data is always copied. The overloads taking ownership of their input export it
+  // without a copy.
 
   size_t const stride_bytes = num_rows * size_of(type);
   size_t const total_bytes  = stride_bytes * num_cols;
 
   context->buffer = rmm::device_buffer(total_bytes, stream, mr);
-  tensor.data     = context->buffer.data();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  describe_tensor(tensor, *context, context->buffer.data(), type, num_rows, num_cols, 1, num_rows);
 
   auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data);
   for (auto const& col : input) {
@@ -251,6 +283,119 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return managed_tensor.release();
 }
 
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input,
+                           size_type num_columns,
+                           cudaStream_t stream)
+{
+  CUDF_EXPECTS(nullptr != input, "input is null");
+  CUDF_EXPECTS(num_columns > 0, "Number of columns must be positive");
+  CUDF_EXPECTS(input->size() % num_columns == 0,
+               "Column size must be a multiple of the number of columns");
+  CUDF_EXPECTS(not input->has_nulls(), "Input required to have null count zero");
+  data_type const type = input->type();
+  data_type_to_DLDataType(type);
+
+  auto const num_rows = input->size() / num_columns;
+  if (num_rows == 0) { return nullptr; }
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  // Element `(r, c)` of the tensor is row `r * num_columns + c` of the column
+  auto const data = const_cast<void*>(get_column_data(input->view()));
+  describe_tensor(
+    managed_tensor->dl_tensor, *context, data, type, num_rows, num_columns, num_columns, 1);
+  context->owned_column = std::move(input);
+
+  // The consumer may read the tensor on any stream
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
+DLManagedTensor* to_dlpack(contiguous_split_result&& input, cudaStream_t stream)
+{
+  auto const& view    = input.table;
+  auto const num_rows = view.num_rows();
+  auto const num_cols = view.num_columns();
+  if (num_rows == 0) { return nullptr; }
+
+  data_type const type = view.column(0).type();
+  data_type_to_DLDataType(type);
+  CUDF_EXPECTS(
+    std::all_of(view.begin(), view.end(), [type](auto const& col) { return col.type() == type; }),
+    "All columns required to have same data type");
+  CUDF_EXPECTS(
+    std::none_of(view.begin(), view.end(), [](auto const& col) { return col.has_nulls(); }),
+    "Input required to have null count zero");
+
+  // The columns must be evenly spaced in `all_data`, which `contiguous_split` does for columns
+  // without null masks
+  auto const first = reinterpret_cast<uintptr_t>(get_column_data(view.column(0)));
+  auto const spacing =
+    (num_cols > 1) ? reinterpret_cast<uintptr_t>(get_column_data(view.column(1))) - first : 0;
+  auto const byte_width = size_of(type);
+  CUDF_EXPECTS(num_cols == 1 || (spacing % byte_width == 0 &&
+                                 spacing >= static_cast<uintptr_t>(num_rows) * byte_width),
+               "Columns must be evenly spaced to be exported without a copy");
+  for (size_type i = 2; i < num_cols; ++i) {
+    CUDF_EXPECTS(reinterpret_cast<uintptr_t>(get_column_data(view.column(i))) ==
+                   first + i * spacing,
+                 "Columns must be evenly spaced to be exported without a copy");
+  }
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  describe_tensor(managed_tensor->dl_tensor,
+                  *context,
+                  reinterpret_cast<void*>(first),
+                  type,
+                  num_rows,
+                  num_cols,
+                  1,
+                  spacing / byte_width);
+  context->owned_data = std::move(input.all_data);
+
+  // The consumer may read the tensor on any stream
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor)
+{
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type, "DLTensor must be GPU type to be viewed");
+  validate_tensor_device(tensor);
+  validate_tensor_shape(tensor);
+
+  data_type const dtype = DLDataType_to_data_type(tensor.dtype);
+  auto const num_rows   = static_cast<size_type>(tensor.shape[0]);
+  auto const num_cols   = (tensor.ndim == 2) ? static_cast<size_type>(tensor.shape[1]) : 1;
+
+  // The rows of every column must be consecutive, the columns may be any number of elements apart
+  CUDF_EXPECTS(nullptr == tensor.strides || tensor.strides[0] == 1 || num_rows <= 1,
+               "DLTensor columns must be contiguous to be viewed");
+  int64_t const col_stride =
+    (tensor.ndim == 2 && nullptr != tensor.strides) ? tensor.strides[1] : num_rows;
+
+  auto const tensor_data = static_cast<char const*>(tensor.data) + tensor.byte_offset;
+
+  std::vector<column_view> columns;
+  columns.reserve(num_cols);
+  for (size_type i = 0; i < num_cols; ++i) {
+    columns.emplace_back(dtype, num_rows, tensor_data + i * col_stride * size_of(dtype));
+  }
+  return table_view(columns);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
@@ -264,4 +409,21 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resou
   return detail::to_dlpack(input, mr);
 }
 
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input,
+                           size_type num_columns,
+                           cudaStream_t stream)
+{
+  return detail::to_dlpack(std::move(input), num_columns, stream);
+}
+
+DLManagedTensor* to_dlpack(contiguous_split_result&& input, cudaStream_t stream)
+{
+  return detail::to_dlpack(std::move(input), stream);
+}
+
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor)
+{
+  return detail::from_dlpack_view(managed_tensor);
+}
+
 }  // namespace cudf
@@ -86,6 +86,8 @@ namespace {
 struct dispatch_to_cudf_column {
   /**
    * @brief Returns mask from an array withut any offsets.
+   *
+   * Buffers are copied with `cudaMemcpyDefault`, so arrays in host or device memory are supported.
    */
   std::unique_ptr<rmm::device_buffer> get_mask_buffer(arrow::Array const& array,
                                                       rmm::mr::device_memory_resource* mr,
@@ -101,7 +103,7 @@ struct dispatch_to_cudf_column {
     CUDA_TRY(cudaMemcpyAsync(mask->data(),
                              array.null_bitmap_data(),
                              array.null_bitmap()->size(),
-                             cudaMemcpyHostToDevice,
+                             cudaMemcpyDefault,
                              stream));
     return mask;
   }
@@ -121,7 +123,7 @@ struct dispatch_to_cudf_column {
     CUDA_TRY(cudaMemcpyAsync(mutable_column_view.data<void*>(),
                              data_buffer->data() + array.offset() * sizeof(T),
                              sizeof(T) * num_rows,
-                             cudaMemcpyHostToDevice,
+                             cudaMemcpyDefault,
                              stream));
     if (has_nulls) {
       auto tmp_mask = get_mask_buffer(array, mr, stream);
@@ -164,7 +166,7 @@ std::unique_ptr<column> dispatch_to_cudf_column::operator()<bool>(
   auto data_buffer = array.data()->buffers[1];
   auto data        = rmm::device_buffer(data_buffer->size(), stream, mr);
   CUDA_TRY(cudaMemcpyAsync(
-    data.data(), data_buffer->data(), data_buffer->size(), cudaMemcpyHostToDevice, stream));
+    data.data(), data_buffer->data(), data_buffer->size(), cudaMemcpyDefault, stream));
   auto out_col = mask_to_bools(static_cast<bitmask_type*>(data.data()),
                                array.offset(),
                                array.offset() + array.length(),
@@ -293,6 +295,135 @@ std::unique_ptr<column> get_column(arrow::Array const& array,
   return type_dispatcher(type, dispatch_to_cudf_column{}, array, type, skip_mask, mr, stream);
 }
 
+/**
+ * @brief Returns a cudf column copied from the chunks of `chunked_array`
+ */
+std::unique_ptr<column> chunked_array_to_column(arrow::ChunkedArray const& chunked_array,
+                                                rmm::mr::device_memory_resource* mr,
+                                                cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<column>> concat_columns;
+  auto cudf_type    = arrow_to_cudf_type(*(chunked_array.type()));
+  auto array_chunks = chunked_array.chunks();
+  if (cudf_type.id() == type_id::EMPTY) {
+    return std::make_unique<column>(
+      cudf_type, chunked_array.length(), std::move(rmm::device_buffer(0)));
+  }
+  std::transform(array_chunks.begin(),
+                 array_chunks.end(),
+                 std::back_inserter(concat_columns),
+                 [&cudf_type, &mr, &stream](auto const& array_chunk) {
+                   return get_column(*array_chunk, cudf_type, false, mr, stream);
+                 });
+  if (concat_columns.size() == 0) {
+    return std::make_unique<column>(cudf_type, 0, rmm::device_buffer(0));
+  } else if (concat_columns.size() == 1) {
+    return std::move(concat_columns[0]);
+  }
+
+  std::vector<cudf::column_view> column_views;
+  std::transform(concat_columns.begin(),
+                 concat_columns.end(),
+                 std::back_inserter(column_views),
+                 [](auto const& col) { return col->view(); });
+  return cudf::detail::concatenate(column_views, mr, stream);
+}
+
+/**
+ * @brief Returns the device address of an arrow buffer
+ */
+template <typename T>
+T const* buffer_address(arrow::Buffer const& buffer)
+{
+  return reinterpret_cast<T const*>(buffer.address());
+}
+
+/**
+ * @brief Returns whether an arrow buffer is in device memory and aligned to `alignment` bytes
+ */
+bool is_aligned_device_buffer(std::shared_ptr<arrow::Buffer> const& buffer, std::size_t alignment)
+{
+  return buffer != nullptr and not buffer->is_cpu() and buffer->address() % alignment == 0;
+}
+
+/**
+ * @brief Returns whether the validity bitmap of `array` can be used in place as a cudf null mask
+ *
+ * cudf reads null masks a word at a time, so the bitmap must be word aligned and hold every word
+ * spanned by the array.
+ */
+bool is_viewable_mask(arrow::Array const& array)
+{
+  auto const& mask = array.data()->buffers[0];
+  if (mask == nullptr) { return true; }
+  auto const num_bits = static_cast<size_type>(array.offset() + array.length());
+  return is_aligned_device_buffer(mask, sizeof(bitmask_type)) and
+         mask->size() >= static_cast<int64_t>(num_bitmask_words(num_bits) * sizeof(bitmask_type));
+}
+
+/**
+ * @brief Returns whether `array` can be viewed as a cudf column of type `type` without a copy
+ *
+ * Booleans are bit-packed in arrow and dictionary indices are not always INT32, so both are
+ * always copied.
+ */
+bool is_viewable(arrow::Array const& array, data_type type)
+{
+  if (not is_viewable_mask(array)) { return false; }
+  auto const& buffers = array.data()->buffers;
+  switch (type.id()) {
+    case type_id::EMPTY:
+    case type_id::BOOL8:
+    case type_id::DICTIONARY32: return false;
+    case type_id::STRING:
+      return array.length() > 0 and is_aligned_device_buffer(buffers[1], sizeof(size_type)) and
+             is_aligned_device_buffer(buffers[2], 1);
+    case type_id::LIST: {
+      auto const& values = *static_cast<arrow::ListArray const&>(array).values();
+      return is_aligned_device_buffer(buffers[1], sizeof(size_type)) and
+             is_viewable(values, arrow_to_cudf_type(*values.type()));
+    }
+    default: return is_fixed_width(type) and is_aligned_device_buffer(buffers[1], size_of(type));
+  }
+}
+
+/**
+ * @brief Returns a view of the device-resident buffers of `array`, which must be viewable
+ * according to `is_viewable`
+ */
+column_view view_array(arrow::Array const& array, data_type type)
+{
+  auto const& buffers = array.data()->buffers;
+  auto const size     = static_cast<size_type>(array.length());
+  auto const offset   = static_cast<size_type>(array.offset());
+  auto const null_mask =
+    buffers[0] == nullptr ? nullptr : buffer_address<bitmask_type>(*buffers[0]);
+  // An unknown arrow null count is -1, the same as `UNKNOWN_NULL_COUNT`
+  auto const null_count =
+    null_mask == nullptr ? 0 : static_cast<size_type>(array.data()->null_count);
+
+  switch (type.id()) {
+    case type_id::STRING: {
+      column_view offsets{
+        data_type{type_id::INT32}, offset + size + 1, buffer_address<void>(*buffers[1])};
+      column_view chars{data_type{type_id::INT8},
+                        static_cast<size_type>(buffers[2]->size()),
+                        buffer_address<void>(*buffers[2])};
+      return column_view{type, size, nullptr, null_mask, null_count, offset, {offsets, chars}};
+    }
+    case type_id::LIST: {
+      auto const& values = *static_cast<arrow::ListArray const&>(array).values();
+      column_view offsets{
+        data_type{type_id::INT32}, offset + size + 1, buffer_address<void>(*buffers[1])};
+      auto child = view_array(values, arrow_to_cudf_type(*values.type()));
+      return column_view{type, size, nullptr, null_mask, null_count, offset, {offsets, child}};
+    }
+    default:
+      return column_view{
+        type, size, buffer_address<void>(*buffers[1]), null_mask, null_count, offset};
+  }
+}
+
 }  // namespace
 
 std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
@@ -306,36 +437,36 @@ std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
                  chunked_arrays.end(),
                  std::back_inserter(columns),
                  [&mr, &stream](auto const& chunked_array) {
-                   std::vector<std::unique_ptr<column>> concat_columns;
-                   auto cudf_type    = arrow_to_cudf_type(*(chunked_array->type()));
-                   auto array_chunks = chunked_array->chunks();
-                   if (cudf_type.id() == type_id::EMPTY) {
-                     return std::make_unique<column>(
-                       cudf_type, chunked_array->length(), std::move(rmm::device_buffer(0)));
-                   }
-                   transform(array_chunks.begin(),
-                             array_chunks.end(),
-                             std::back_inserter(concat_columns),
-                             [&cudf_type, &mr, &stream](auto const& array_chunk) {
-                               return get_column(*array_chunk, cudf_type, false, mr, stream);
-                             });
-                   if (concat_columns.size() == 0) {
-                     return std::make_unique<column>(cudf_type, 0, rmm::device_buffer(0));
-                   } else if (concat_columns.size() == 1) {
-                     return std::move(concat_columns[0]);
-                   }
-
-                   std::vector<cudf::column_view> column_views;
-                   std::transform(concat_columns.begin(),
-                                  concat_columns.end(),
-                                  std::back_inserter(column_views),
-                                  [](auto const& col) { return col->view(); });
-                   return cudf::detail::concatenate(column_views, mr, stream);
+                   return chunked_array_to_column(*chunked_array, mr, stream);
                  });
 
   return std::make_unique<table>(std::move(columns));
 }
 
+arrow_table_view from_arrow_view(std::shared_ptr<arrow::Table const> const& input_table,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
+{
+  CUDF_EXPECTS(input_table != nullptr, "Invalid arrow table");
+
+  arrow_table_view result;
+  result.arrow_table = input_table;
+
+  std::vector<column_view> views;
+  for (auto const& chunked_array : input_table->columns()) {
+    auto const cudf_type = arrow_to_cudf_type(*(chunked_array->type()));
+    if (chunked_array->num_chunks() == 1 and is_viewable(*chunked_array->chunk(0), cudf_type)) {
+      views.push_back(view_array(*chunked_array->chunk(0), cudf_type));
+    } else {
+      result.copied_columns.push_back(chunked_array_to_column(*chunked_array, mr, stream));
+      views.push_back(result.copied_columns.back()->view());
+    }
+  }
+  result.table = table_view{views};
+
+  return result;
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
@@ -346,4 +477,12 @@ std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
   return detail::from_arrow(input_table, mr);
 }
 
+arrow_table_view from_arrow_view(std::shared_ptr<arrow::Table const> const& input_table,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::from_arrow_view(input_table, mr);
+}
+
 }  // namespace cudf
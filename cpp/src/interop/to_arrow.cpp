@@ -25,28 +25,109 @@
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <io/utilities/pinned_memory_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
 namespace cudf {
 namespace detail {
 namespace {
 
+/**
+ * @brief Arrow memory pool of pinned host memory, drawn from the pinned memory pool shared with
+ * the cuDF-IO readers
+ */
+class pinned_arrow_memory_pool : public arrow::MemoryPool {
+ public:
+  arrow::Status Allocate(int64_t size, uint8_t** out) override
+  {
+    try {
+      *out = static_cast<uint8_t*>(io::detail::pinned_memory_pool::get().allocate(size));
+    } catch (cudf::cuda_error const& e) {
+      return arrow::Status::OutOfMemory(e.what());
+    }
+    _bytes_allocated += size;
+    return arrow::Status::OK();
+  }
+
+  arrow::Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override
+  {
+    uint8_t* out = nullptr;
+    ARROW_RETURN_NOT_OK(Allocate(new_size, &out));
+    std::memcpy(out, *ptr, std::min(old_size, new_size));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return arrow::Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) override
+  {
+    io::detail::pinned_memory_pool::get().deallocate(buffer, size);
+    _bytes_allocated -= size;
+  }
+
+  int64_t bytes_allocated() const override { return _bytes_allocated; }
+
+  std::string backend_name() const override { return "cudf_pinned"; }
+
+ private:
+  std::atomic<int64_t> _bytes_allocated{0};
+};
+
+/**
+ * @brief Device-to-host copies into arrow buffers, deferred until every buffer of the table has
+ * been allocated so that they are all issued back to back and synchronized once
+ *
+ * Device temporaries the copies read from are kept alive until the copies complete.
+ */
+struct host_copies {
+  struct copy {
+    void* destination;
+    void const* source;
+    std::size_t size;
+  };
+
+  std::vector<copy> copies;
+  std::vector<std::shared_ptr<arrow::Buffer>> masks;
+  std::vector<rmm::device_buffer> device_buffers;
+  std::vector<std::unique_ptr<column>> columns;
+
+  void add(void* destination, void const* source, std::size_t size)
+  {
+    copies.push_back(copy{destination, source, size});
+  }
+
+  /**
+   * @brief Issues every copy on `stream`, synchronizes once and resets the padding of the masks
+   */
+  void run(cudaStream_t stream)
+  {
+    for (auto const& c : copies) {
+      CUDA_TRY(cudaMemcpyAsync(c.destination, c.source, c.size, cudaMemcpyDeviceToHost, stream));
+    }
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    // Resets all padded bits to 0
+    for (auto const& mask : masks) { mask->ZeroPadding(); }
+  }
+};
+
 /**
  * @brief Create arrow data buffer from given cudf column
  */
 template <typename T>
 std::shared_ptr<arrow::Buffer> fetch_data_buffer(column_view input_view,
                                                  arrow::MemoryPool* ar_mr,
-                                                 cudaStream_t stream)
+                                                 host_copies& copies)
 {
   const int64_t data_size_in_bytes = sizeof(T) * input_view.size();
   std::shared_ptr<arrow::Buffer> data_buffer;
 
   CUDF_EXPECTS(arrow::AllocateBuffer(ar_mr, data_size_in_bytes, &data_buffer).ok(),
                "Failed to allocate Arrow buffer for data");
-  CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                           input_view.data<T>(),
-                           data_size_in_bytes,
-                           cudaMemcpyDeviceToHost,
-                           stream));
+  copies.add(data_buffer->mutable_data(), input_view.data<T>(), data_size_in_bytes);
 
   return data_buffer;
 }
@@ -56,6 +137,7 @@ std::shared_ptr<arrow::Buffer> fetch_data_buffer(column_view input_view,
  */
 std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
                                                  arrow::MemoryPool* ar_mr,
+                                                 host_copies& copies,
                                                  cudaStream_t stream)
 {
   const int64_t mask_size_in_bytes = cudf::bitmask_allocation_size_bytes(input_view.size());
@@ -65,15 +147,13 @@ std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
     CUDF_EXPECTS(
       arrow::AllocateBitmap(ar_mr, static_cast<int64_t>(input_view.size()), &mask_buffer).ok(),
       "Failed to allocate Arrow buffer for mask");
-    CUDA_TRY(cudaMemcpyAsync(
-      mask_buffer->mutable_data(),
-      (input_view.offset() > 0) ? cudf::copy_bitmask(input_view).data() : input_view.null_mask(),
-      mask_size_in_bytes,
-      cudaMemcpyDeviceToHost,
-      stream));
-
-    // Resets all padded bits to 0
-    mask_buffer->ZeroPadding();
+    void const* mask = input_view.null_mask();
+    if (input_view.offset() > 0) {
+      copies.device_buffers.push_back(cudf::copy_bitmask(input_view, stream));
+      mask = copies.device_buffers.back().data();
+    }
+    copies.add(mask_buffer->mutable_data(), mask, mask_size_in_bytes);
+    copies.masks.push_back(mask_buffer);
 
     return mask_buffer;
   }
@@ -83,8 +163,12 @@ std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
 
 /**
  * @brief Functor to convert cudf column to arrow array
+ *
+ * The copies into the buffers of the arrays are added to `copies` rather than issued.
  */
 struct dispatch_to_arrow {
+  host_copies* copies;
+
   /**
    * @brief Creates vector Arrays from given cudf column childrens
    */
@@ -98,14 +182,25 @@ struct dispatch_to_arrow {
     std::transform(child_indices.begin(),
                    child_indices.end(),
                    std::back_inserter(child_arrays),
-                   [&input_view, &ar_mr, &stream](auto const& i) {
+                   [this, &input_view, &ar_mr, &stream](auto const& i) {
                      auto c = input_view.child(i);
                      return type_dispatcher(
-                       c.type(), dispatch_to_arrow{}, c, c.type().id(), ar_mr, stream);
+                       c.type(), dispatch_to_arrow{copies}, c, c.type().id(), ar_mr, stream);
                    });
     return child_arrays;
   }
 
+  /**
+   * @brief Returns `input`, or a copy of it if it is sliced, keeping the copy alive until the
+   * copies to host complete
+   */
+  column_view unsliced(column_view input, bool sliced)
+  {
+    if (not sliced) { return input; }
+    copies->columns.push_back(std::make_unique<cudf::column>(input));
+    return copies->columns.back()->view();
+  }
+
   template <typename T>
   std::shared_ptr<arrow::Array> operator()(column_view input_view,
                                            cudf::type_id id,
@@ -114,8 +209,8 @@ struct dispatch_to_arrow {
   {
     return to_arrow_array(id,
                           static_cast<int64_t>(input_view.size()),
-                          fetch_data_buffer<T>(input_view, ar_mr, stream),
-                          fetch_mask_buffer(input_view, ar_mr, stream),
+                          fetch_data_buffer<T>(input_view, ar_mr, *copies),
+                          fetch_mask_buffer(input_view, ar_mr, *copies, stream),
                           static_cast<int64_t>(input_view.null_count()));
   }
 };
@@ -133,15 +228,14 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<bool>(column_view in
   CUDF_EXPECTS(
     arrow::AllocateBuffer(ar_mr, static_cast<int64_t>(bitmask.first->size()), &data_buffer).ok(),
     "Failed to allocate Arrow buffer for data");
-  CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                           bitmask.first->data(),
-                           bitmask.first->size(),
-                           cudaMemcpyDeviceToHost,
-                           stream));
+  copies->device_buffers.push_back(std::move(*bitmask.first));
+  copies->add(data_buffer->mutable_data(),
+              copies->device_buffers.back().data(),
+              copies->device_buffers.back().size());
   return to_arrow_array(id,
                         static_cast<int64_t>(input.size()),
                         data_buffer,
-                        fetch_mask_buffer(input, ar_mr, stream),
+                        fetch_mask_buffer(input, ar_mr, *copies, stream),
                         static_cast<int64_t>(input.null_count()));
 }
 
@@ -149,14 +243,11 @@ template <>
 std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::string_view>(
   column_view input, cudf::type_id id, arrow::MemoryPool* ar_mr, cudaStream_t stream)
 {
-  std::unique_ptr<column> tmp_column =
-    ((input.offset() != 0) or
-     ((input.num_children() == 2) and (input.child(0).size() - 1 != input.size())))
-      ? std::make_unique<cudf::column>(input)
-      : nullptr;
-
-  column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
-  auto child_arrays      = fetch_child_array(input_view, ar_mr, stream);
+  column_view input_view = unsliced(
+    input,
+    (input.offset() != 0) or
+      ((input.num_children() == 2) and (input.child(0).size() - 1 != input.size())));
+  auto child_arrays = fetch_child_array(input_view, ar_mr, stream);
   if (child_arrays.size() == 0) {
     std::shared_ptr<arrow::Buffer> tmp_offset_buffer;
     // Empty string will have only one value in offset of 4 bytes
@@ -175,7 +266,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::string_view>(
   return std::make_shared<arrow::StringArray>(static_cast<int64_t>(input_view.size()),
                                               offset_buffer,
                                               data_buffer,
-                                              fetch_mask_buffer(input_view, ar_mr, stream),
+                                              fetch_mask_buffer(input_view, ar_mr, *copies, stream),
                                               static_cast<int64_t>(input_view.null_count()));
 }
 
@@ -183,18 +274,14 @@ template <>
 std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::dictionary32>(
   column_view input, cudf::type_id id, arrow::MemoryPool* ar_mr, cudaStream_t stream)
 {
-  std::unique_ptr<column> tmp_column = nullptr;
-  if ((input.offset() != 0) or (input.child(0).size() != input.size())) {
-    tmp_column = std::make_unique<cudf::column>(input);
-  }
-
-  column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
-  auto child_arrays      = fetch_child_array(input_view, ar_mr, stream);
+  column_view input_view =
+    unsliced(input, (input.offset() != 0) or (input.child(0).size() != input.size()));
+  auto child_arrays = fetch_child_array(input_view, ar_mr, stream);
 
   auto indices    = to_arrow_array(type_id::INT32,
                                 static_cast<int64_t>(input_view.size()),
                                 child_arrays[0]->data()->buffers[1],
-                                fetch_mask_buffer(input_view, ar_mr, stream),
+                                fetch_mask_buffer(input_view, ar_mr, *copies, stream),
                                 static_cast<int64_t>(input_view.null_count()));
   auto dictionary = child_arrays[1];
   return std::make_shared<arrow::DictionaryArray>(
@@ -205,14 +292,11 @@ template <>
 std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::list_view>(
   column_view input, cudf::type_id id, arrow::MemoryPool* ar_mr, cudaStream_t stream)
 {
-  std::unique_ptr<column> tmp_column = nullptr;
-  if ((input.offset() != 0) or
-      ((input.num_children() == 2) and (input.child(0).size() - 1 != input.size()))) {
-    tmp_column = std::make_unique<cudf::column>(input);
-  }
-
-  column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
-  auto child_arrays      = fetch_child_array(input_view, ar_mr, stream);
+  column_view input_view = unsliced(
+    input,
+    (input.offset() != 0) or
+      ((input.num_children() == 2) and (input.child(0).size() - 1 != input.size())));
+  auto child_arrays = fetch_child_array(input_view, ar_mr, stream);
   if (child_arrays.size() == 0) {
     return std::make_shared<arrow::ListArray>(arrow::list(arrow::null()), 0, nullptr, nullptr);
   }
@@ -223,7 +307,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::list_view>(
                                             static_cast<int64_t>(input_view.size()),
                                             offset_buffer,
                                             data,
-                                            fetch_mask_buffer(input_view, ar_mr, stream),
+                                            fetch_mask_buffer(input_view, ar_mr, *copies, stream),
                                             static_cast<int64_t>(input_view.null_count()));
 }
 
@@ -241,12 +325,16 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
   std::vector<std::shared_ptr<arrow::Field>> fields;
   bool const has_names = not column_names.empty();
 
+  // All buffers are allocated before any copy is issued, so that allocating pinned memory does
+  // not wait for earlier copies
+  host_copies copies;
   std::transform(input.begin(), input.end(), std::back_inserter(arrays), [&](auto const& c) {
     return c.type().id() != type_id::EMPTY
              ? type_dispatcher(
-                 c.type(), detail::dispatch_to_arrow{}, c, c.type().id(), ar_mr, stream)
+                 c.type(), detail::dispatch_to_arrow{&copies}, c, c.type().id(), ar_mr, stream)
              : std::make_shared<arrow::NullArray>(c.size());
   });
+  copies.run(stream);
 
   std::transform(
     arrays.begin(),
@@ -268,4 +356,11 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
   return detail::to_arrow(input, column_names, ar_mr);
 }
 
+arrow::MemoryPool* pinned_arrow_memory_pool()
+{
+  // Never destroyed, as the pinned memory pool it draws from
+  static auto* pool = new detail::pinned_arrow_memory_pool();
+  return pool;
+}
+
 }  // namespace cudf
@@ -22,6 +22,7 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/device_read_pipeline.hpp>
 
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -135,11 +136,15 @@ class metadata : public file_metadata {
 };
 
 rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_block_data,
+                                                 const uint8_t *host_comp_block_data,
                                                  cudaStream_t stream)
 {
   size_t uncompressed_data_size = 0;
   hostdevice_vector<gpu_inflate_input_s> inflate_in(_metadata->block_list.size());
   hostdevice_vector<gpu_inflate_status_s> inflate_out(_metadata->block_list.size());
+  const auto base_offset = _metadata->block_list[0].offset;
+  // Each snappy block is followed by the CRC32 checksum of its uncompressed data
+  const size_t block_trailer_size = (_metadata->codec == "snappy") ? 4 : 0;
 
   if (_metadata->codec == "deflate") {
     // Guess an initial maximum uncompressed block size
@@ -147,10 +152,10 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
     uncompressed_data_size   = initial_blk_len * _metadata->block_list.size();
     for (size_t i = 0; i < inflate_in.size(); ++i) { inflate_in[i].dstSize = initial_blk_len; }
   } else if (_metadata->codec == "snappy") {
-    // Extract the uncompressed length from the snappy stream
+    // Extract the uncompressed length from the snappy stream, already in host memory
     for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-      const auto buffer  = _source->host_read(_metadata->block_list[i].offset, 4);
-      const uint8_t *blk = buffer->data();
+      CUDF_EXPECTS(_metadata->block_list[i].size > block_trailer_size, "Invalid snappy block");
+      const uint8_t *blk = host_comp_block_data + _metadata->block_list[i].offset - base_offset;
       uint32_t blk_len   = blk[0];
       if (blk_len > 0x7f) {
         blk_len = (blk_len & 0x7f) | (blk[1] << 7);
@@ -168,12 +173,11 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
 
   rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
 
-  const auto base_offset = _metadata->block_list[0].offset;
   for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
     const auto src_pos = _metadata->block_list[i].offset - base_offset;
 
     inflate_in[i].srcDevice = static_cast<const uint8_t *>(comp_block_data.data()) + src_pos;
-    inflate_in[i].srcSize   = _metadata->block_list[i].size;
+    inflate_in[i].srcSize   = _metadata->block_list[i].size - block_trailer_size;
     inflate_in[i].dstDevice = static_cast<uint8_t *>(decomp_block_data.data()) + dst_pos;
 
     // Update blocks offsets & sizes to refer to uncompressed data
@@ -233,6 +237,9 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
       break;
     }
   }
+  for (size_t i = 0; i < _metadata->block_list.size(); i++) {
+    CUDF_EXPECTS(inflate_out[i].status == 0, "Error decompressing Avro data blocks");
+  }
 
   return decomp_block_data;
 }
@@ -352,6 +359,9 @@ reader::impl::impl(std::unique_ptr<datasource> source,
                    rmm::mr::device_memory_resource *mr)
   : _source(std::move(source)), _mr(mr), _columns(options.columns)
 {
+  // Data blocks are read front to back
+  _source->advise_access_pattern(datasource::access_pattern::SEQUENTIAL);
+
   // Open the source Avro dataset metadata
   _metadata = std::make_unique<metadata>(_source.get());
 }
@@ -380,10 +390,10 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
     if (_metadata->total_data_size > 0) {
       const auto buffer =
         _source->host_read(_metadata->block_list[0].offset, _metadata->total_data_size);
-      rmm::device_buffer block_data(buffer->data(), buffer->size(), stream);
+      auto block_data = upload_to_device(buffer->data(), buffer->size(), stream);
 
       if (_metadata->codec != "" && _metadata->codec != "null") {
-        auto decomp_block_data = decompress_data(block_data, stream);
+        auto decomp_block_data = decompress_data(block_data, buffer->data(), stream);
         block_data             = std::move(decomp_block_data);
       } else {
         auto dst_ofs = _metadata->block_list[0].offset;
@@ -77,11 +77,13 @@ class reader::impl {
    * @brief Decompresses the block data.
    *
    * @param comp_block_data Compressed block data
+   * @param host_comp_block_data Host copy of the compressed block data, used to index the blocks
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return Device buffer to decompressed block data
    */
   rmm::device_buffer decompress_data(const rmm::device_buffer &comp_block_data,
+                                     const uint8_t *host_comp_block_data,
                                      cudaStream_t stream);
 
   /**
@@ -0,0 +1,510 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file deflate.cu
+ * @brief GPU DEFLATE compression, with an optional GZIP wrapper
+ *
+ * One warp compresses one stream. The input is split into blocks of about 32KB: a first pass over
+ * a block collects the symbol frequencies used to build its Huffman codes, and the block is then
+ * stored with these codes, with the fixed codes, or uncompressed, whichever is smallest.
+ */
+
+#include "gpuinflate.h"
+#include "huffman.cuh"
+#include "lz77.cuh"
+
+namespace cudf {
+namespace io {
+constexpr uint32_t deflate_block_size   = 32 * 1024;  // Target uncompressed size of a block
+constexpr uint32_t deflate_max_distance = 32 * 1024;
+constexpr uint32_t deflate_max_match    = 258;
+constexpr uint32_t deflate_num_lit      = 288;  // Literal/length alphabet (incl. 2 unused codes)
+constexpr uint32_t deflate_num_dist     = 32;   // Distance alphabet (incl. 2 unused codes)
+constexpr uint32_t deflate_num_cl       = 19;   // Code length alphabet
+constexpr uint32_t deflate_max_rle      = 286 + 30;
+
+enum deflate_block_type_e { DEFLATE_STORED = 0, DEFLATE_FIXED = 1, DEFLATE_DYNAMIC = 2 };
+
+/**
+ * @brief deflate compressor state
+ **/
+struct deflate_state_s {
+  uint16_t hash_map[lz77_hash_size];        ///< Low 16 bits of recent positions, by hash
+  uint16_t hash_copy[lz77_hash_size];       ///< Hash table at the start of the block
+  uint32_t lit_freq[deflate_num_lit];       ///< Literal/length symbol frequencies
+  uint32_t dist_freq[deflate_num_dist];     ///< Distance symbol frequencies
+  uint32_t cl_freq[deflate_num_cl];         ///< Code length symbol frequencies
+  uint16_t lit_code[deflate_num_lit];       ///< Literal/length codes (bit-reversed)
+  uint16_t dist_code[deflate_num_dist];     ///< Distance codes (bit-reversed)
+  uint16_t cl_code[deflate_num_cl];         ///< Code length codes (bit-reversed)
+  uint8_t lit_len[deflate_num_lit];         ///< Literal/length code lengths
+  uint8_t dist_len[deflate_num_dist];       ///< Distance code lengths
+  uint8_t cl_len[deflate_num_cl + 1];       ///< Code length code lengths
+  uint8_t rle_sym[deflate_max_rle];         ///< Run-length coded code lengths
+  uint8_t rle_extra[deflate_max_rle];       ///< Repeat counts of the run-length coded lengths
+  uint16_t sorted[deflate_num_lit];         ///< Huffman construction scratch
+  uint32_t work[deflate_num_lit];           ///< Huffman construction scratch
+  uint32_t crc_table[256];                  ///< CRC32 table (GZIP only)
+};
+
+// Order in which the code length code lengths are stored
+static __device__ __constant__ uint8_t deflate_cl_order[deflate_num_cl] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+/**
+ * @brief Returns the length code (0..28, symbol 257+code) of a match length and its extra bits
+ **/
+inline __device__ uint32_t deflate_length_code(uint32_t len, uint32_t &nbits, uint32_t &extra)
+{
+  uint32_t const l = len - 3;
+  if (len == deflate_max_match) {
+    nbits = extra = 0;
+    return 28;
+  } else if (l < 8) {
+    nbits = extra = 0;
+    return l;
+  }
+  nbits = 29 - __clz(l);
+  extra = l & ((1 << nbits) - 1);
+  return 4 * nbits + (l >> nbits);
+}
+
+/**
+ * @brief Returns the distance code (0..29) of a match distance and its extra bits
+ **/
+inline __device__ uint32_t deflate_dist_code(uint32_t dist, uint32_t &nbits, uint32_t &extra)
+{
+  uint32_t const d = dist - 1;
+  if (d < 4) {
+    nbits = extra = 0;
+    return d;
+  }
+  nbits = 30 - __clz(d);
+  extra = d & ((1 << nbits) - 1);
+  return 2 * nbits + (d >> nbits);
+}
+
+/**
+ * @brief Number of extra bits of a literal/length symbol
+ **/
+inline __device__ uint32_t deflate_length_extra_bits(uint32_t sym)
+{
+  return (sym < 265 || sym >= 285) ? 0 : (sym - 261) >> 2;
+}
+
+/**
+ * @brief Number of extra bits of a distance symbol
+ **/
+inline __device__ uint32_t deflate_dist_extra_bits(uint32_t sym)
+{
+  return (sym < 4) ? 0 : (sym - 2) >> 1;
+}
+
+/**
+ * @brief Computes canonical (bit-reversed) Huffman codes from code lengths
+ **/
+inline __device__ void deflate_codes(const uint8_t *lengths, uint32_t n, uint16_t *codes)
+{
+  uint32_t bl_count[huffman_max_code_length + 1] = {0};
+  uint32_t next_code[huffman_max_code_length + 1];
+  for (uint32_t i = 0; i < n; i++) { bl_count[lengths[i]]++; }
+  bl_count[0] = 0;
+  uint32_t code = 0;
+  for (uint32_t l = 1; l <= huffman_max_code_length; l++) {
+    code         = (code + bl_count[l - 1]) << 1;
+    next_code[l] = code;
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t const len = lengths[i];
+    codes[i]           = (len != 0) ? __brev(next_code[len]++) >> (32 - len) : 0;
+  }
+}
+
+/**
+ * @brief Makes sure that at least two symbols are used, so that the code is complete
+ **/
+inline __device__ void deflate_min_two_symbols(uint32_t *freq, uint32_t n)
+{
+  uint32_t num_used = 0;
+  for (uint32_t i = 0; i < n; i++) { num_used += (freq[i] != 0); }
+  for (uint32_t i = 0; num_used < 2; i++) {
+    if (freq[i] == 0) {
+      freq[i] = 1;
+      num_used++;
+    }
+  }
+}
+
+/**
+ * @brief Run-length codes the literal/length and distance code lengths (symbols 16, 17, 18)
+ *
+ * @return Number of run-length coded symbols
+ **/
+inline __device__ uint32_t deflate_rle_lengths(deflate_state_s *s, uint32_t hlit, uint32_t hdist)
+{
+  uint32_t const total = hlit + hdist;
+  uint32_t num_rle     = 0;
+  auto length_at       = [&](uint32_t i) -> uint32_t {
+    return (i < hlit) ? s->lit_len[i] : s->dist_len[i - hlit];
+  };
+  auto add = [&](uint32_t sym, uint32_t extra) {
+    s->rle_sym[num_rle]   = sym;
+    s->rle_extra[num_rle] = extra;
+    s->cl_freq[sym]++;
+    num_rle++;
+  };
+  for (uint32_t i = 0; i < total;) {
+    uint32_t const len = length_at(i);
+    uint32_t run       = 1;
+    while (i + run < total && length_at(i + run) == len) { run++; }
+    i += run;
+    if (len == 0) {
+      while (run >= 11) {
+        uint32_t const r = min(run, 138u);
+        add(18, r - 11);
+        run -= r;
+      }
+      if (run >= 3) {
+        add(17, run - 3);
+        run = 0;
+      }
+    } else {
+      add(len, 0);
+      run--;
+      while (run >= 3) {
+        uint32_t const r = min(run, 6u);
+        add(16, r - 3);
+        run -= r;
+      }
+    }
+    while (run > 0) {
+      add(len, 0);
+      run--;
+    }
+  }
+  return num_rle;
+}
+
+/**
+ * @brief Parses a block, either collecting the symbol frequencies or emitting the symbols
+ *
+ * Both passes must see the same hash table on entry so that they find the same matches.
+ *
+ * @return Position of the end of the block
+ **/
+template <bool emit>
+inline __device__ uint32_t deflate_parse(deflate_state_s *s,
+                                         const uint8_t *src,
+                                         uint32_t pos,
+                                         uint32_t blk_end,
+                                         uint32_t src_len,
+                                         bit_writer_s &bw,
+                                         uint32_t t)
+{
+  while (pos < blk_end) {
+    uint32_t dist;
+    uint32_t const literal_cnt =
+      lz77_find_match(s->hash_map, src, pos, src_len, deflate_max_distance, t, dist);
+    if (emit) {
+      if (t == 0) {
+        for (uint32_t i = 0; i < literal_cnt; i++) {
+          uint32_t const sym = src[pos + i];
+          bw.put(s->lit_code[sym], s->lit_len[sym]);
+        }
+      }
+    } else if (t < literal_cnt) {
+      atomicAdd(&s->lit_freq[src[pos + t]], 1);
+    }
+    pos += literal_cnt;
+    if (dist != 0) {
+      uint32_t const max_len = min(deflate_max_match, src_len - pos);
+      uint32_t const len =
+        4 + lz77_match_length(src + pos + 4, src + pos + 4 - dist, max_len - 4, t);
+      if (t == 0) {
+        uint32_t len_bits, len_extra, dist_bits, dist_extra;
+        uint32_t const lsym = 257 + deflate_length_code(len, len_bits, len_extra);
+        uint32_t const dsym = deflate_dist_code(dist, dist_bits, dist_extra);
+        if (emit) {
+          bw.put(s->lit_code[lsym], s->lit_len[lsym]);
+          bw.put(len_extra, len_bits);
+          bw.put(s->dist_code[dsym], s->dist_len[dsym]);
+          bw.put(dist_extra, dist_bits);
+        } else {
+          atomicAdd(&s->lit_freq[lsym], 1);
+          atomicAdd(&s->dist_freq[dsym], 1);
+        }
+      }
+      pos += len;
+    }
+    SYNCWARP();
+  }
+  return pos;
+}
+
+/**
+ * @brief Multiplies two polynomials modulo the CRC32 polynomial (reflected)
+ **/
+inline __device__ uint32_t crc32_multmodp(uint32_t a, uint32_t b)
+{
+  uint32_t m = 1u << 31, p = 0;
+  for (;;) {
+    if (a & m) {
+      p ^= b;
+      if ((a & (m - 1)) == 0) break;
+    }
+    m >>= 1;
+    b = (b & 1) ? (b >> 1) ^ 0xedb88320 : b >> 1;
+  }
+  return p;
+}
+
+/**
+ * @brief Combines the CRC32 of two consecutive byte sequences
+ **/
+inline __device__ uint32_t crc32_combine(uint32_t crc1, uint32_t crc2, uint32_t len2)
+{
+  uint32_t xp = 1u << 31;   // x^0
+  uint32_t x2k = 1u << 23;  // x^8
+  for (; len2 != 0; len2 >>= 1) {
+    if (len2 & 1) { xp = crc32_multmodp(x2k, xp); }
+    x2k = crc32_multmodp(x2k, x2k);
+  }
+  return crc32_multmodp(xp, crc1) ^ crc2;
+}
+
+/**
+ * @brief Computes the CRC32 of the input, used by the GZIP trailer
+ *
+ * Each thread computes the CRC of a contiguous segment, and the segment CRCs are then combined.
+ **/
+inline __device__ uint32_t deflate_crc32(const deflate_state_s *s,
+                                         const uint8_t *src,
+                                         uint32_t src_len,
+                                         uint32_t t)
+{
+  uint32_t const seg_len = (src_len + 31) >> 5;
+  uint32_t const beg     = min(t * seg_len, src_len);
+  uint32_t len           = min(beg + seg_len, src_len) - beg;
+  uint32_t crc           = ~0u;
+  for (uint32_t i = 0; i < len; i++) { crc = s->crc_table[(crc ^ src[beg + i]) & 0xff] ^ (crc >> 8); }
+  crc = ~crc;
+  for (uint32_t d = 1; d < 32; d <<= 1) {
+    uint32_t const crc2 = SHFL(crc, min(t + d, 31u));
+    uint32_t const len2 = SHFL(len, min(t + d, 31u));
+    if ((t & (2 * d - 1)) == 0) {
+      crc = crc32_combine(crc, crc2, len2);
+      len += len2;
+    }
+  }
+  return crc;
+}
+
+/**
+ * @brief DEFLATE compression kernel
+ *
+ * See https://tools.ietf.org/html/rfc1951 and https://tools.ietf.org/html/rfc1952
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ * @param[in] gzip_hdr Whether to add the GZIP header and trailer
+ **/
+extern "C" __global__ void __launch_bounds__(32)
+  deflate_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count, int gzip_hdr)
+{
+  __shared__ __align__(16) deflate_state_s state_g;
+
+  deflate_state_s *const s = &state_g;
+  uint32_t const t         = threadIdx.x;
+  const uint8_t *src       = reinterpret_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+  uint32_t const src_len   = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+  bit_writer_s bw;
+  bw.dst    = reinterpret_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+  bw.pos    = 0;
+  bw.size   = static_cast<uint32_t>(inputs[blockIdx.x].dstSize);
+  bw.bitbuf = 0;
+  bw.bitcnt = 0;
+
+  for (uint32_t i = t; i < lz77_hash_size; i += 32) { s->hash_map[i] = 0; }
+  if (gzip_hdr) {
+    for (uint32_t i = t; i < 256; i += 32) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) { c = (c & 1) ? (c >> 1) ^ 0xedb88320 : c >> 1; }
+      s->crc_table[i] = c;
+    }
+    if (t == 0) {
+      // ID1 ID2 CM=deflate FLG=0 MTIME=0 XFL=0 OS=unix
+      bw.put(0x8b1f, 16);
+      bw.put(8, 8);
+      bw.put(0, 16);
+      bw.put(0, 16);
+      bw.put(0, 16);
+      bw.put(3, 8);
+    }
+  }
+  SYNCWARP();
+  uint32_t pos = 0;
+  while (pos < src_len) {
+    uint32_t const blk_end = min(pos + deflate_block_size, src_len);
+    for (uint32_t i = t; i < deflate_num_lit; i += 32) { s->lit_freq[i] = 0; }
+    for (uint32_t i = t; i < deflate_num_dist; i += 32) { s->dist_freq[i] = 0; }
+    if (t < deflate_num_cl) { s->cl_freq[t] = 0; }
+    for (uint32_t i = t; i < lz77_hash_size; i += 32) { s->hash_copy[i] = s->hash_map[i]; }
+    SYNCWARP();
+    // Pass 1: symbol frequencies
+    uint32_t const end_pos = deflate_parse<false>(s, src, pos, blk_end, src_len, bw, t);
+    if (t == 0) {
+      s->lit_freq[256] = 1;  // end of block
+      deflate_min_two_symbols(s->dist_freq, 30);
+    }
+    SYNCWARP();
+    huffman_code_lengths(
+      s->lit_freq, 286, huffman_max_code_length, s->lit_len, s->sorted, s->work, t);
+    huffman_code_lengths(
+      s->dist_freq, 30, huffman_max_code_length, s->dist_len, s->sorted, s->work, t);
+    uint32_t hlit = 286, hdist = 30, num_rle = 0;
+    if (t == 0) {
+      while (hlit > 257 && s->lit_len[hlit - 1] == 0) { hlit--; }
+      while (hdist > 1 && s->dist_len[hdist - 1] == 0) { hdist--; }
+      num_rle = deflate_rle_lengths(s, hlit, hdist);
+      deflate_min_two_symbols(s->cl_freq, deflate_num_cl);
+    }
+    SYNCWARP();
+    huffman_code_lengths(s->cl_freq, deflate_num_cl, 7, s->cl_len, s->sorted, s->work, t);
+    // Select the smallest block type
+    uint32_t btype = DEFLATE_STORED;
+    if (t == 0) {
+      uint32_t hclen = deflate_num_cl;
+      while (hclen > 4 && s->cl_len[deflate_cl_order[hclen - 1]] == 0) { hclen--; }
+      uint64_t extra_bits = 0, dyn_bits = 3 + 14 + 3 * hclen, fixed_bits = 3;
+      for (uint32_t i = 0; i < num_rle; i++) {
+        uint32_t const sym = s->rle_sym[i];
+        dyn_bits += s->cl_len[sym] + ((sym < 16) ? 0 : (sym == 16) ? 2 : (sym == 17) ? 3 : 7);
+      }
+      for (uint32_t i = 0; i < 286; i++) {
+        uint32_t const f = s->lit_freq[i];
+        extra_bits += f * deflate_length_extra_bits(i);
+        dyn_bits += f * s->lit_len[i];
+        fixed_bits += f * ((i < 144) ? 8 : (i < 256) ? 9 : (i < 280) ? 7 : 8);
+      }
+      for (uint32_t i = 0; i < 30; i++) {
+        uint32_t const f = s->dist_freq[i];
+        extra_bits += f * deflate_dist_extra_bits(i);
+        dyn_bits += f * s->dist_len[i];
+        fixed_bits += f * 5;
+      }
+      uint64_t const stored_bits =
+        ((bw.bitcnt + 3 + 7) & ~7) - bw.bitcnt + 32 + 8 * (end_pos - pos);
+      dyn_bits += extra_bits;
+      fixed_bits += extra_bits;
+      if (dyn_bits < fixed_bits && dyn_bits < stored_bits) {
+        btype = DEFLATE_DYNAMIC;
+      } else if (fixed_bits < stored_bits) {
+        btype = DEFLATE_FIXED;
+      }
+      bw.put(end_pos >= src_len, 1);
+      bw.put(btype, 2);
+      if (btype == DEFLATE_DYNAMIC) {
+        bw.put(hlit - 257, 5);
+        bw.put(hdist - 1, 5);
+        bw.put(hclen - 4, 4);
+        for (uint32_t i = 0; i < hclen; i++) { bw.put(s->cl_len[deflate_cl_order[i]], 3); }
+        deflate_codes(s->cl_len, deflate_num_cl, s->cl_code);
+        for (uint32_t i = 0; i < num_rle; i++) {
+          uint32_t const sym = s->rle_sym[i];
+          bw.put(s->cl_code[sym], s->cl_len[sym]);
+          if (sym >= 16) { bw.put(s->rle_extra[i], (sym == 16) ? 2 : (sym == 17) ? 3 : 7); }
+        }
+      } else if (btype == DEFLATE_STORED) {
+        uint32_t const len = end_pos - pos;
+        bw.align();
+        bw.put(len, 16);
+        bw.put(len ^ 0xffff, 16);
+      }
+    }
+    btype = SHFL0(btype);
+    if (btype == DEFLATE_STORED) {
+      uint32_t const out_pos = SHFL0(bw.pos);
+      uint32_t const len     = end_pos - pos;
+      if (out_pos + len <= bw.size) {
+        for (uint32_t i = t; i < len; i += 32) { bw.dst[out_pos + i] = src[pos + i]; }
+      }
+      bw.pos = out_pos + len;
+    } else {
+      if (btype == DEFLATE_FIXED) {
+        for (uint32_t i = t; i < deflate_num_lit; i += 32) {
+          s->lit_len[i] = (i < 144) ? 8 : (i < 256) ? 9 : (i < 280) ? 7 : 8;
+        }
+        s->dist_len[t] = 5;
+        SYNCWARP();
+      }
+      if (t == 0) {
+        bool const fixed = (btype == DEFLATE_FIXED);
+        deflate_codes(s->lit_len, fixed ? deflate_num_lit : 286, s->lit_code);
+        deflate_codes(s->dist_len, fixed ? deflate_num_dist : 30, s->dist_code);
+      }
+      for (uint32_t i = t; i < lz77_hash_size; i += 32) { s->hash_map[i] = s->hash_copy[i]; }
+      SYNCWARP();
+      // Pass 2: emit the symbols with the codes of the block
+      deflate_parse<true>(s, src, pos, blk_end, src_len, bw, t);
+      if (t == 0) { bw.put(s->lit_code[256], s->lit_len[256]); }
+    }
+    pos = end_pos;
+    SYNCWARP();
+  }
+  if (t == 0) {
+    if (src_len == 0) {
+      bw.put(1, 1);  // last block
+      bw.put(DEFLATE_FIXED, 2);
+      bw.put(0, 7);  // end of block
+    }
+    bw.align();
+  }
+  if (gzip_hdr) {
+    uint32_t const crc = deflate_crc32(s, src, src_len, t);
+    if (t == 0) {
+      bw.put(crc & 0xffff, 16);
+      bw.put(crc >> 16, 16);
+      bw.put(src_len & 0xffff, 16);
+      bw.put(src_len >> 16, 16);
+    }
+  }
+  if (t == 0) {
+    outputs[blockIdx.x].bytes_written = bw.pos;
+    outputs[blockIdx.x].status        = (bw.pos > bw.size) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_deflate(gpu_inflate_input_s *inputs,
+                                 gpu_inflate_status_s *outputs,
+                                 int count,
+                                 int gzip_hdr,
+                                 cudaStream_t stream)
+{
+  dim3 dim_block(32, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) {
+    deflate_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count, gzip_hdr);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -85,6 +85,23 @@ cudaError_t gpu_unsnap(gpu_inflate_input_s *inputs,
                        int count           = 1,
                        cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for decompressing Zstandard-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk. Each
+ * chunk may hold several concatenated frames; dictionaries are not supported.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unzstd(gpu_inflate_input_s *inputs,
+                       gpu_inflate_status_s *outputs,
+                       int count           = 1,
+                       cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Computes the size of temporary memory for Brotli decompression
  *
@@ -130,6 +147,41 @@ cudaError_t gpu_snap(gpu_inflate_input_s *inputs,
                      int count           = 1,
                      cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for compressing data with DEFLATE
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] gzip_hdr Wrap the raw deflate stream in a GZIP header and trailer, default 0
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_deflate(gpu_inflate_input_s *inputs,
+                        gpu_inflate_status_s *outputs,
+                        int count           = 1,
+                        int gzip_hdr        = 0,
+                        cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Interface for compressing data with Zstandard
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk. Each
+ * chunk is written as a single frame with its content size.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_zstd(gpu_inflate_input_s *inputs,
+                     gpu_inflate_status_s *outputs,
+                     int count           = 1,
+                     cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace io
 }  // namespace cudf
 
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file huffman.cuh
+ * @brief Length-limited Huffman code construction and bit output shared by the GPU compressors
+ */
+
+#pragma once
+
+#include <io/utilities/block_utils.cuh>
+
+namespace cudf {
+namespace io {
+constexpr uint32_t huffman_max_code_length = 15;
+
+/**
+ * @brief LSB-first bit-level output, used by a single thread
+ **/
+struct bit_writer_s {
+  uint8_t *dst;     ///< Output buffer
+  uint32_t pos;     ///< Current byte position, may exceed the buffer size
+  uint32_t size;    ///< Output buffer size
+  uint64_t bitbuf;  ///< Pending bits
+  uint32_t bitcnt;  ///< Number of pending bits
+
+  inline __device__ void put(uint32_t v, uint32_t nbits)
+  {
+    bitbuf |= static_cast<uint64_t>(v) << bitcnt;
+    bitcnt += nbits;
+    while (bitcnt >= 8) {
+      if (pos < size) { dst[pos] = static_cast<uint8_t>(bitbuf); }
+      pos++;
+      bitbuf >>= 8;
+      bitcnt -= 8;
+    }
+  }
+  inline __device__ void align()
+  {
+    if (bitcnt != 0) { put(0, 8 - bitcnt); }
+  }
+};
+
+/**
+ * @brief In-place minimum-redundancy code lengths (Moffat & Katajainen)
+ *
+ * @param a Frequencies in ascending order on input, code lengths on output
+ * @param n Number of symbols, at least 2
+ **/
+inline __device__ void huffman_minimum_redundancy(uint32_t *a, int n)
+{
+  int root = 0, leaf = 2;
+  a[0] += a[1];
+  for (int next = 1; next < n - 1; next++) {
+    if (leaf >= n || a[root] < a[leaf]) {
+      a[next]   = a[root];
+      a[root++] = next;
+    } else {
+      a[next] = a[leaf++];
+    }
+    if (leaf >= n || (root < next && a[root] < a[leaf])) {
+      a[next] += a[root];
+      a[root++] = next;
+    } else {
+      a[next] += a[leaf++];
+    }
+  }
+  a[n - 2] = 0;
+  for (int next = n - 3; next >= 0; next--) { a[next] = a[a[next]] + 1; }
+  int avbl = 1, used = 0, depth = 0, next = n - 1;
+  root = n - 2;
+  while (avbl > 0) {
+    while (root >= 0 && static_cast<int>(a[root]) == depth) {
+      used++;
+      root--;
+    }
+    while (avbl > used) {
+      a[next--] = depth;
+      avbl--;
+    }
+    avbl  = 2 * used;
+    depth = depth + 1;
+    used  = 0;
+  }
+}
+
+/**
+ * @brief Computes length-limited Huffman code lengths
+ *
+ * Must be called by all the threads of the warp. Symbols are ranked by frequency in parallel, and
+ * thread 0 builds the code, limiting the code lengths by moving leaves up the tree.
+ *
+ * @param freq Symbol frequencies
+ * @param num_symbols Number of symbols
+ * @param max_len Maximum code length, at most `huffman_max_code_length`
+ * @param[out] lengths Code length of each symbol, 0 for unused symbols
+ * @param sorted Scratch space for `num_symbols` symbols
+ * @param work Scratch space for `num_symbols` values
+ * @param t Thread in warp
+ *
+ * @return Number of symbols with a non-zero frequency
+ **/
+inline __device__ uint32_t huffman_code_lengths(const uint32_t *freq,
+                                                uint32_t num_symbols,
+                                                uint32_t max_len,
+                                                uint8_t *lengths,
+                                                uint16_t *sorted,
+                                                uint32_t *work,
+                                                uint32_t t)
+{
+  uint32_t num_used = 0;
+  for (uint32_t i = t; i < num_symbols; i += 32) {
+    uint32_t const f = freq[i];
+    lengths[i]       = 0;
+    if (f != 0) {
+      uint32_t rank = 0;
+      for (uint32_t j = 0; j < num_symbols; j++) {
+        uint32_t const g = freq[j];
+        rank += (g != 0 && (g < f || (g == f && j < i)));
+      }
+      sorted[rank] = i;
+      num_used++;
+    }
+  }
+  num_used = WarpReduceSum32(num_used);
+  SYNCWARP();
+  if (t == 0 && num_used != 0) {
+    if (num_used == 1) {
+      lengths[sorted[0]] = 1;
+    } else {
+      uint32_t bl_count[huffman_max_code_length + 1] = {0};
+      for (uint32_t k = 0; k < num_used; k++) { work[k] = freq[sorted[k]]; }
+      huffman_minimum_redundancy(work, num_used);
+      for (uint32_t k = 0; k < num_used; k++) { bl_count[min(work[k], max_len)]++; }
+      // Clamping the lengths over-subscribes the code: lengthen shorter codes until it is complete
+      uint32_t total = 0;
+      for (uint32_t l = 1; l <= max_len; l++) { total += bl_count[l] << (max_len - l); }
+      while (total != (1u << max_len)) {
+        bl_count[max_len]--;
+        for (uint32_t l = max_len - 1; l > 0; l--) {
+          if (bl_count[l] != 0) {
+            bl_count[l]--;
+            bl_count[l + 1] += 2;
+            break;
+          }
+        }
+        total--;
+      }
+      // Least frequent symbols get the longest codes
+      uint32_t k = 0;
+      for (uint32_t l = max_len; l > 0; l--) {
+        for (uint32_t c = 0; c < bl_count[l]; c++) { lengths[sorted[k++]] = l; }
+      }
+    }
+  }
+  SYNCWARP();
+  return num_used;
+}
+
+}  // namespace io
+}  // namespace cudf
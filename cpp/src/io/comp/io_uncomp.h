@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -36,11 +40,27 @@ enum {
   IO_UNCOMP_STREAM_TYPE_ZSTD    = 10,
 };
 
-std::vector<char> io_uncompress_single_h2d(const void* src, size_t src_size, int stream_type);
+std::vector<char> io_uncompress_single_h2d(const void* src,
+                                           size_t src_size,
+                                           int stream_type,
+                                           cudaStream_t stream = 0);
 
 std::vector<char> getUncompressedHostData(const char* h_data,
                                           size_t num_bytes,
-                                          const std::string& compression);
+                                          const std::string& compression,
+                                          cudaStream_t stream = 0);
+
+/**
+ * @brief Decompresses Zstandard data on the host
+ *
+ * @param[out] dst Output buffer
+ * @param[in] dst_size Size of the output buffer
+ * @param[in] src Compressed data
+ * @param[in] src_size Compressed size
+ *
+ * @return Number of decompressed bytes, 0 on failure
+ */
+size_t cpu_unzstd(uint8_t* dst, size_t dst_size, const uint8_t* src, size_t src_size);
 
 class HostDecompressor {
  public:
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file lz77.cuh
+ * @brief Warp-level LZ77 match finding shared by the GPU compressors
+ *
+ * A warp looks for a 4-byte match at 32 consecutive positions at a time, using a hash table of
+ * the low 16 bits of recent positions, as in the snappy compressor.
+ */
+
+#pragma once
+
+#include <io/utilities/block_utils.cuh>
+
+namespace cudf {
+namespace io {
+constexpr int lz77_hash_bits            = 12;
+constexpr uint32_t lz77_hash_size       = 1 << lz77_hash_bits;
+constexpr uint32_t lz77_max_distance_16 = 0xffff;  // Largest distance the hash table can reach
+
+/**
+ * @brief 12-bit hash from four consecutive bytes
+ **/
+inline __device__ uint32_t lz77_hash(uint32_t v)
+{
+  return (v * ((1 << 20) + (0x2a00) + (0x6a) + 1)) >> (32 - lz77_hash_bits);
+}
+
+/**
+ * @brief Fetches four consecutive bytes (little-endian)
+ **/
+inline __device__ uint32_t lz77_fetch4(const uint8_t *src)
+{
+  return src[0] | (src[1] << 8) | (src[2] << 16) | (static_cast<uint32_t>(src[3]) << 24);
+}
+
+/**
+ * @brief Returns mask of any thread in the warp that has a hash value equal to that of the
+ * calling thread
+ **/
+inline __device__ uint32_t lz77_match_any(uint32_t v)
+{
+#if (__CUDA_ARCH__ >= 700)
+  return __match_any_sync(~0, v);
+#else
+  uint32_t err_map = 0;
+  for (uint32_t i = 0; i < lz77_hash_bits; i++, v >>= 1) {
+    uint32_t b       = v & 1;
+    uint32_t match_b = BALLOT(b);
+    err_map |= match_b ^ -(int32_t)b;
+  }
+  return ~err_map;
+#endif
+}
+
+/**
+ * @brief Looks for a 4-byte match at the next 32 positions
+ *
+ * Must be called by all the threads of the warp. The hash table is updated with the positions
+ * up to the start of the match.
+ *
+ * @param hash_map Hash table of previous positions (low 16 bits)
+ * @param src Uncompressed data
+ * @param pos Current position
+ * @param end End of the data a match may start in (at least 4 bytes before it)
+ * @param max_distance Largest allowed match distance
+ * @param t Thread in warp
+ * @param[out] distance Distance of the match, 0 if no match was found
+ *
+ * @return Number of literal bytes before the match (or up to 32 if there is no match)
+ **/
+inline __device__ uint32_t lz77_find_match(uint16_t *hash_map,
+                                           const uint8_t *src,
+                                           uint32_t pos,
+                                           uint32_t end,
+                                           uint32_t max_distance,
+                                           uint32_t t,
+                                           uint32_t &distance)
+{
+  bool const valid4         = (pos + t + 4 <= end);
+  uint32_t const data32     = (valid4) ? lz77_fetch4(src + pos + t) : 0;
+  uint32_t const hash       = (valid4) ? lz77_hash(data32) : 0;
+  uint32_t local_match      = lz77_match_any(hash);
+  uint32_t local_match_lane = 31 - __clz(local_match & ((1 << t) - 1));
+  uint32_t local_match_data = SHFL(data32, min(local_match_lane, t));
+  uint32_t offset           = pos + t;
+  bool match                = false;
+  if (valid4) {
+    if (local_match_lane < t && local_match_data == data32) {
+      match  = true;
+      offset = pos + local_match_lane;
+    } else {
+      offset = (pos & ~0xffff) | hash_map[hash];
+      if (offset >= pos) { offset = (offset >= 0x10000) ? offset - 0x10000 : pos; }
+      match = (offset < pos && offset + max_distance >= pos + t &&
+               lz77_fetch4(src + offset) == data32);
+    }
+  } else {
+    local_match = 0;
+  }
+  uint32_t const match_mask = BALLOT(match);
+  uint32_t literal_cnt;
+  if (match_mask != 0) {
+    literal_cnt = __ffs(match_mask) - 1;
+    distance    = SHFL(pos + t - offset, literal_cnt);
+  } else {
+    literal_cnt = min(32u, end > pos ? end - pos : 0u);
+    distance    = 0;
+  }
+  // Update hash up to the first 4 bytes of the match
+  local_match &= (literal_cnt >= 31) ? ~0u : (2u << literal_cnt) - 1;
+  if (t <= literal_cnt && valid4 && t == 31 - __clz(local_match)) { hash_map[hash] = pos + t; }
+  SYNCWARP();
+  return literal_cnt;
+}
+
+/**
+ * @brief Returns the number of matching bytes of two byte sequences, up to `max_len`
+ **/
+inline __device__ uint32_t lz77_match_length(const uint8_t *cur,
+                                             const uint8_t *ref,
+                                             uint32_t max_len,
+                                             uint32_t t)
+{
+  for (uint32_t len = 0; len < max_len; len += 32) {
+    uint32_t const i        = len + t;
+    uint32_t const mismatch = BALLOT(i >= max_len || cur[i] != ref[i]);
+    if (mismatch != 0) { return min(len + __ffs(mismatch) - 1, max_len); }
+  }
+  return max_len;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,10 +17,18 @@
 #include <cuda_runtime.h>
 #include <string.h>  // memset
 #include <zlib.h>    // uncompress
+#include "gpuinflate.h"
 #include "io_uncomp.h"
 #include "unbz2.h"  // bz2 uncompress
 
 #include <cudf/utilities/error.hpp>
+#include <io/utilities/host_parallel_for.hpp>
+#include <io/utilities/hostdevice_vector.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <atomic>
+#include <numeric>
 
 namespace cudf {
 namespace io {
@@ -277,6 +285,127 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
   return (zerr == Z_STREAM_END) ? Z_OK : zerr;
 }
 
+/**
+ * @Brief Returns the size of a gzip member which records it in a "BC" extra subfield, as the
+ * blocks of the blocked gzip (BGZF) format do, 0 if the size is not recorded.
+ *
+ * @param raw[in] Start of the member
+ * @param len[in] Size of the data from the start of the member
+ */
+size_t gz_member_size(const uint8_t *raw, size_t len)
+{
+  if (len < sizeof(gz_file_header_s) + 2) return 0;
+  const gz_file_header_s *fhdr = (const gz_file_header_s *)raw;
+  if (fhdr->id1 != 0x1f || fhdr->id2 != 0x8b || !(fhdr->flags & GZ_FLG_FEXTRA)) return 0;
+  const uint8_t *xtra = raw + sizeof(gz_file_header_s) + 2;
+  size_t xlen         = raw[sizeof(gz_file_header_s)] | (raw[sizeof(gz_file_header_s) + 1] << 8);
+  if (sizeof(gz_file_header_s) + 2 + xlen > len) return 0;
+  while (xlen >= 4) {
+    size_t slen = xtra[2] | (xtra[3] << 8);
+    if (4 + slen > xlen) return 0;
+    if (xtra[0] == 'B' && xtra[1] == 'C' && slen == 2) {
+      size_t member_size = (xtra[4] | (xtra[5] << 8)) + 1;
+      return (member_size <= len) ? member_size : 0;
+    }
+    xtra += 4 + slen;
+    xlen -= 4 + slen;
+  }
+  return 0;
+}
+
+/**
+ * @Brief Splits a gzip file into its members, if each member records its size.
+ *
+ * Empty members are skipped.
+ *
+ * @param raw[in] Gzip file
+ * @param len[in] Size of the file
+ *
+ * @return The members, empty if the size of a member is not recorded
+ */
+std::vector<gz_archive_s> split_gz_members(const uint8_t *raw, size_t len)
+{
+  std::vector<gz_archive_s> members;
+  size_t ofs = 0;
+  while (ofs < len) {
+    gz_archive_s gz;
+    size_t member_size = gz_member_size(raw + ofs, len - ofs);
+    if (member_size == 0 || !ParseGZArchive(&gz, raw + ofs, member_size)) return {};
+    if (gz.isize != 0) members.push_back(gz);
+    ofs += member_size;
+  }
+  return members;
+}
+
+/**
+ * @Brief Uncompresses the members of a gzip file with the GPU inflate kernel, one member per
+ * thread block.
+ *
+ * @param dst[out] Destination, of the total uncompressed size of the members
+ * @param members[in] The members
+ * @param raw[in] Gzip file
+ * @param len[in] Size of the file
+ * @param stream[in] CUDA stream to use
+ *
+ * @return true if every member was uncompressed to its recorded size
+ */
+bool gpu_inflate_gz_members(std::vector<char> &dst,
+                            std::vector<gz_archive_s> const &members,
+                            const uint8_t *raw,
+                            size_t len,
+                            cudaStream_t stream)
+{
+  rmm::device_buffer d_src(raw, len, stream);
+  rmm::device_buffer d_dst(dst.size(), stream);
+  hostdevice_vector<gpu_inflate_input_s> inputs(members.size(), stream);
+  hostdevice_vector<gpu_inflate_status_s> statuses(members.size(), stream);
+  size_t dst_ofs = 0;
+  for (size_t i = 0; i < members.size(); ++i) {
+    inputs[i].srcDevice = static_cast<const uint8_t *>(d_src.data()) + (members[i].comp_data - raw);
+    inputs[i].srcSize   = members[i].comp_len;
+    inputs[i].dstDevice = static_cast<uint8_t *>(d_dst.data()) + dst_ofs;
+    inputs[i].dstSize   = members[i].isize;
+    dst_ofs += members[i].isize;
+  }
+  inputs.host_to_device(stream);
+  CUDA_TRY(gpuinflate(
+    inputs.device_ptr(), statuses.device_ptr(), static_cast<int>(members.size()), 0, stream));
+  statuses.device_to_host(stream, true);
+  for (size_t i = 0; i < members.size(); ++i) {
+    if (statuses[i].status != 0 || statuses[i].bytes_written != members[i].isize) return false;
+  }
+  CUDA_TRY(
+    cudaMemcpyAsync(dst.data(), d_dst.data(), dst.size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return true;
+}
+
+/**
+ * @Brief Uncompresses the members of a gzip file with zlib, from several host threads.
+ *
+ * @param dst[out] Destination, of the total uncompressed size of the members
+ * @param members[in] The members
+ *
+ * @return true if every member was uncompressed to its recorded size
+ */
+bool cpu_inflate_gz_members(std::vector<char> &dst, std::vector<gz_archive_s> const &members)
+{
+  std::vector<size_t> dst_offsets(members.size() + 1, 0);
+  for (size_t i = 0; i < members.size(); ++i) {
+    dst_offsets[i + 1] = dst_offsets[i] + members[i].isize;
+  }
+  std::atomic<bool> valid{true};
+  detail::host_parallel_for(members.size(), detail::default_host_threads(), [&](size_t i, size_t) {
+    size_t dst_len = members[i].isize;
+    auto dst_ptr   = reinterpret_cast<uint8_t *>(dst.data()) + dst_offsets[i];
+    if (cpu_inflate(dst_ptr, &dst_len, members[i].comp_data, members[i].comp_len) != Z_OK ||
+        dst_len != members[i].isize) {
+      valid = false;
+    }
+  });
+  return valid;
+}
+
 /**
  * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
  *
@@ -286,10 +415,14 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
  * @param src[in] Pointer to the compressed data in system memory
  * @param src_size[in] The size of the compressed data, in bytes
  * @param stream_type[in] Type of compression of the input data
+ * @param stream[in] CUDA stream used to uncompress on the GPU
  *
  * @return Vector containing the uncompressed output
  */
-std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int stream_type)
+std::vector<char> io_uncompress_single_h2d(const void *src,
+                                           size_t src_size,
+                                           int stream_type,
+                                           cudaStream_t stream)
 {
   const uint8_t *raw       = (const uint8_t *)src;
   const uint8_t *comp_data = nullptr;
@@ -372,6 +505,19 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
                                        // ~4:1 compression for initial size
   }
 
+  if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP) {
+    // Members of known sizes are inflated in parallel, on the GPU if possible
+    auto const members = split_gz_members(raw, src_size);
+    if (members.size() > 1) {
+      std::vector<char> dst(std::accumulate(
+        members.begin(), members.end(), size_t{0}, [](size_t sum, gz_archive_s const &gz) {
+          return sum + gz.isize;
+        }));
+      if (gpu_inflate_gz_members(dst, members, raw, src_size, stream)) return dst;
+      CUDF_EXPECTS(cpu_inflate_gz_members(dst, members), "Decompression: error in stream");
+      return dst;
+    }
+  }
   if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP || stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
     // INFLATE
     std::vector<char> dst(uncomp_len);
@@ -414,12 +560,14 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
  * @param[in] h_data Pointer to the csv data in host memory
  * @param[in] num_bytes Size of the input data, in bytes
  * @param[in] compression String describing the compression type
+ * @param[in] stream CUDA stream used to uncompress on the GPU
  *
  * @return Vector containing the output uncompressed data
  */
 std::vector<char> getUncompressedHostData(const char *h_data,
                                           size_t num_bytes,
-                                          const std::string &compression)
+                                          const std::string &compression,
+                                          cudaStream_t stream)
 {
   int comp_type = IO_UNCOMP_STREAM_TYPE_INFER;
   if (compression == "gzip")
@@ -431,7 +579,7 @@ std::vector<char> getUncompressedHostData(const char *h_data,
   else if (compression == "xz")
     comp_type = IO_UNCOMP_STREAM_TYPE_XZ;
 
-  return io_uncompress_single_h2d(h_data, num_bytes, comp_type);
+  return io_uncompress_single_h2d(h_data, num_bytes, comp_type, stream);
 }
 
 /**
@@ -556,6 +704,21 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/**
+ * @Brief ZSTD host decompressor class
+ */
+class HostDecompressor_ZSTD : public HostDecompressor {
+ public:
+  HostDecompressor_ZSTD() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    return cpu_unzstd(dstBytes, dstLen, srcBytes, srcLen);
+  }
+};
+
 /**
  * @Brief CPU decompression class
  *
@@ -569,6 +732,7 @@ std::unique_ptr<HostDecompressor> HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: return std::make_unique<HostDecompressor_ZLIB>(true);
     case IO_UNCOMP_STREAM_TYPE_INFLATE: return std::make_unique<HostDecompressor_ZLIB>(false);
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: return std::make_unique<HostDecompressor_SNAPPY>();
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: return std::make_unique<HostDecompressor_ZSTD>();
   }
   CUDF_FAIL("Unsupported compression type");
 }
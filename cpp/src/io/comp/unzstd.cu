@@ -0,0 +1,929 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file unzstd.cu
+ * @brief Zstandard (RFC 8878) decompression
+ *
+ * Each stream is decoded by a single warp. The entropy-coded parts of a block (FSE table
+ * descriptions, Huffman literals and the sequence bitstream) are inherently serial and are
+ * evaluated redundantly by every lane, so that all lanes agree on the sequence being executed
+ * without any shuffles; the lanes then cooperate on copying the literals and matches. Up to four
+ * Huffman literal streams are decoded in parallel by the first four lanes.
+ *
+ * Literals of compressed blocks are decoded into the end of the output buffer: since a block
+ * never produces more bytes than there is room left in the output, the write position can never
+ * overtake the literals that still have to be read.
+ *
+ * The same code is compiled for the host (one lane) to decompress file metadata.
+ *
+ * Dictionaries are not supported, and content checksums are not verified.
+ */
+
+#include "gpuinflate.h"
+#include "io_uncomp.h"
+#include "zstd.cuh"
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace {
+constexpr uint32_t zstd_skippable_magic = 0x184D2A50;  // low 4 bits are user-defined
+
+constexpr int max_weight_log = 6;
+constexpr int max_huf_log    = 11;
+
+constexpr int max_weight_symbol = 12;
+constexpr int max_huf_symbols   = 256;
+
+constexpr int warp_size = 32;
+
+/**
+ * @brief FSE decoding table entry
+ **/
+struct fse_entry_s {
+  uint16_t new_state;  // base of the next state
+  uint8_t symbol;
+  uint8_t num_bits;  // number of bits to add to new_state
+};
+
+/**
+ * @brief Huffman decoding table entry
+ **/
+struct huf_entry_s {
+  uint8_t symbol;
+  uint8_t num_bits;
+};
+
+/**
+ * @brief Decoder state persisting across the blocks of a frame
+ **/
+struct unzstd_state_s {
+  fse_entry_s ll_table[1 << max_ll_log];
+  fse_entry_s of_table[1 << max_of_log];
+  fse_entry_s ml_table[1 << max_ml_log];
+  fse_entry_s weight_table[1 << max_weight_log];
+  huf_entry_s huf_table[1 << max_huf_log];
+  int32_t ll_log;  // negative if there is no table to repeat
+  int32_t of_log;
+  int32_t ml_log;
+  int32_t huf_log;
+  uint32_t rep[3];  // repeat offsets
+};
+
+/**
+ * @brief Synchronizes the lanes of the warp decoding a stream (no-op on the host)
+ **/
+__device__ __host__ inline void lane_sync()
+{
+#ifdef __CUDA_ARCH__
+  __syncwarp();
+#endif
+}
+
+/**
+ * @brief Returns true if any lane of the warp reports an error
+ **/
+__device__ __host__ inline bool lane_any(bool err)
+{
+#ifdef __CUDA_ARCH__
+  return __any_sync(0xffffffff, err);
+#else
+  return err;
+#endif
+}
+
+__device__ __host__ inline int highbit32(uint32_t v)
+{
+#ifdef __CUDA_ARCH__
+  return 31 - __clz(v);
+#else
+  return 31 - __builtin_clz(v);
+#endif
+}
+
+__device__ __host__ inline uint32_t read_le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+__device__ __host__ inline uint32_t read_le24(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16);
+}
+
+__device__ __host__ inline uint32_t read_le32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+/**
+ * @brief Little-endian bit reader used for FSE table descriptions
+ **/
+struct forward_bits_s {
+  const uint8_t *base;
+  size_t size;
+  size_t bit_pos;
+
+  __device__ __host__ uint32_t peek(int n) const
+  {
+    uint64_t v       = 0;
+    size_t const pos = bit_pos >> 3;
+    for (int k = 0; k < 4; k++) {
+      if (pos + k < size) { v |= static_cast<uint64_t>(base[pos + k]) << (8 * k); }
+    }
+    return static_cast<uint32_t>(v >> (bit_pos & 7)) & ((1u << n) - 1);
+  }
+  __device__ __host__ void skip(int n) { bit_pos += n; }
+};
+
+/**
+ * @brief Bit reader for the backward bitstreams of Huffman and FSE coded data
+ *
+ * The stream is read from its last byte, whose highest set bit marks the end of the data.
+ * Bits past the start of the stream read as zeros; `bit_pos` then becomes negative.
+ **/
+struct backward_bits_s {
+  const uint8_t *base;
+  int64_t size;
+  int64_t bit_pos;  // number of bits left
+
+  __device__ __host__ bool init(const uint8_t *src, int64_t len)
+  {
+    base = src;
+    size = len;
+    if (len <= 0 || src[len - 1] == 0) { return false; }
+    bit_pos = (len - 1) * 8 + highbit32(src[len - 1]);
+    return true;
+  }
+
+  __device__ __host__ uint32_t extract(int64_t lo, int n) const
+  {
+    uint64_t v       = 0;
+    int64_t const by = lo >> 3;
+    for (int k = 0; k < 5; k++) {
+      if (by + k < size) { v |= static_cast<uint64_t>(base[by + k]) << (8 * k); }
+    }
+    return static_cast<uint32_t>((v >> (lo & 7)) & ((1ull << n) - 1));
+  }
+
+  __device__ __host__ uint32_t peek(int n) const
+  {
+    if (n <= 0) { return 0; }
+    int64_t const lo = bit_pos - n;
+    if (lo >= 0) { return extract(lo, n); }
+    if (n + lo <= 0) { return 0; }
+    return extract(0, n + static_cast<int>(lo)) << static_cast<int>(-lo);
+  }
+
+  __device__ __host__ uint32_t get(int n)
+  {
+    uint32_t const v = peek(n);
+    bit_pos -= n;
+    return v;
+  }
+};
+
+/**
+ * @brief Reads an FSE table description
+ *
+ * @param[in] src Start of the description
+ * @param[in] size Number of bytes available
+ * @param[in] max_symbol Largest allowed symbol
+ * @param[in] max_log Largest allowed accuracy log
+ * @param[out] norm Normalized symbol counts (-1 denotes a "less than 1" probability)
+ * @param[out] num_symbols Number of symbols in `norm`
+ * @param[out] log Accuracy log
+ *
+ * @return Number of bytes consumed, 0 if the description is invalid
+ **/
+__device__ __host__ size_t read_fse_description(const uint8_t *src,
+                                                size_t size,
+                                                int max_symbol,
+                                                int max_log,
+                                                int16_t *norm,
+                                                int &num_symbols,
+                                                int &log)
+{
+  forward_bits_s br{src, size, 0};
+  if (size < 1) { return 0; }
+  log = br.peek(4) + 5;
+  br.skip(4);
+  if (log > max_log) { return 0; }
+  int remaining = (1 << log) + 1;
+  int threshold = 1 << log;
+  int nb        = log + 1;
+  int sym       = 0;
+  bool prev0    = false;
+  while (remaining > 1 && sym <= max_symbol) {
+    if (prev0) {
+      uint32_t repeat;
+      do {
+        repeat = br.peek(2);
+        br.skip(2);
+        for (uint32_t r = 0; r < repeat; r++) {
+          if (sym > max_symbol) { return 0; }
+          norm[sym++] = 0;
+        }
+      } while (repeat == 3);
+      if (sym > max_symbol) { return 0; }
+    }
+    int const max_small = (2 * threshold - 1) - remaining;
+    uint32_t const bits = br.peek(nb);
+    int count;
+    if (static_cast<int>(bits & (threshold - 1)) < max_small) {
+      count = bits & (threshold - 1);
+      br.skip(nb - 1);
+    } else {
+      count = bits & (2 * threshold - 1);
+      if (count >= threshold) { count -= max_small; }
+      br.skip(nb);
+    }
+    count--;
+    remaining -= (count < 0) ? -count : count;
+    norm[sym++] = count;
+    prev0       = (count == 0);
+    while (remaining < threshold) {
+      nb--;
+      threshold >>= 1;
+    }
+  }
+  size_t const consumed = (br.bit_pos + 7) >> 3;
+  if (remaining != 1 || consumed > size) { return 0; }
+  num_symbols = sym;
+  return consumed;
+}
+
+/**
+ * @brief Builds an FSE decoding table from normalized counts
+ *
+ * Every lane builds the same table; the caller must synchronize the lanes before the table is
+ * read.
+ **/
+__device__ __host__ void build_fse_table(fse_entry_s *table,
+                                         const int16_t *norm,
+                                         int num_symbols,
+                                         int log)
+{
+  uint16_t next[max_ml_symbol + 1];
+  int const table_size = 1 << log;
+  int high             = table_size - 1;
+  for (int s = 0; s < num_symbols; s++) {
+    if (norm[s] == -1) {
+      table[high--].symbol = s;
+      next[s]              = 1;
+    } else {
+      next[s] = norm[s];
+    }
+  }
+  int const step = (table_size >> 1) + (table_size >> 3) + 3;
+  int const mask = table_size - 1;
+  int pos        = 0;
+  for (int s = 0; s < num_symbols; s++) {
+    for (int i = 0; i < norm[s]; i++) {
+      table[pos].symbol = s;
+      do {
+        pos = (pos + step) & mask;
+      } while (pos > high);
+    }
+  }
+  for (int u = 0; u < table_size; u++) {
+    uint32_t const ns  = next[table[u].symbol]++;
+    int const nb       = log - highbit32(ns);
+    table[u].num_bits  = nb;
+    table[u].new_state = (ns << nb) - table_size;
+  }
+}
+
+/**
+ * @brief Builds a predefined FSE table
+ **/
+template <typename NormFn>
+__device__ __host__ void build_default_table(fse_entry_s *table,
+                                             NormFn fn,
+                                             int num_symbols,
+                                             int log)
+{
+  int16_t norm[max_ml_symbol + 1];
+  for (int s = 0; s < num_symbols; s++) { norm[s] = fn(s); }
+  build_fse_table(table, norm, num_symbols, log);
+}
+
+/**
+ * @brief Reads a Huffman tree description and builds the literals decoding table
+ *
+ * @return Number of bytes consumed, 0 if the description is invalid
+ **/
+__device__ __host__ size_t read_huffman_table(unzstd_state_s *s, const uint8_t *src, size_t size)
+{
+  uint8_t weights[max_huf_symbols];
+  int num_weights = 0;
+  size_t consumed;
+  if (size < 1) { return 0; }
+  uint32_t const hdr = src[0];
+  if (hdr >= 128) {
+    // Direct representation: 4 bits per weight
+    num_weights = hdr - 127;
+    consumed    = 1 + (num_weights + 1) / 2;
+    if (consumed > size) { return 0; }
+    for (int i = 0; i < num_weights; i++) {
+      uint32_t const b = src[1 + i / 2];
+      weights[i]       = (i & 1) ? (b & 0xf) : (b >> 4);
+    }
+  } else {
+    // FSE-compressed weights, decoded with two interleaved states
+    int16_t norm[max_weight_symbol + 1];
+    int num_symbols, log;
+    consumed = 1 + hdr;
+    if (consumed > size) { return 0; }
+    size_t const desc_len =
+      read_fse_description(src + 1, hdr, max_weight_symbol, max_weight_log, norm, num_symbols, log);
+    if (desc_len == 0) { return 0; }
+    lane_sync();
+    build_fse_table(s->weight_table, norm, num_symbols, log);
+    lane_sync();
+    backward_bits_s br;
+    if (!br.init(src + 1 + desc_len, hdr - desc_len)) { return 0; }
+    fse_entry_s const *wt = s->weight_table;
+    uint32_t s1           = br.get(log);
+    uint32_t s2           = br.get(log);
+    for (;;) {
+      if (num_weights >= max_huf_symbols - 2) { return 0; }
+      weights[num_weights++] = wt[s1].symbol;
+      s1                     = wt[s1].new_state + br.get(wt[s1].num_bits);
+      if (br.bit_pos < 0) {
+        weights[num_weights++] = wt[s2].symbol;
+        break;
+      }
+      weights[num_weights++] = wt[s2].symbol;
+      s2                     = wt[s2].new_state + br.get(wt[s2].num_bits);
+      if (br.bit_pos < 0) {
+        weights[num_weights++] = wt[s1].symbol;
+        break;
+      }
+    }
+  }
+  if (num_weights >= max_huf_symbols) { return 0; }
+  // The weight of the last symbol is implied by the others
+  uint32_t total = 0;
+  for (int i = 0; i < num_weights; i++) {
+    if (weights[i] > max_huf_log) { return 0; }
+    if (weights[i] != 0) { total += 1u << (weights[i] - 1); }
+  }
+  if (total == 0) { return 0; }
+  int const max_bits = highbit32(total) + 1;
+  if (max_bits > max_huf_log) { return 0; }
+  uint32_t const rest = (1u << max_bits) - total;
+  if (rest & (rest - 1)) { return 0; }
+  weights[num_weights++] = highbit32(rest) + 1;
+
+  // Symbols with the longest codes (lowest weights) come first
+  uint32_t rank_start[max_huf_log + 2];
+  uint32_t rank_count[max_huf_log + 2] = {0};
+  for (int i = 0; i < num_weights; i++) { rank_count[weights[i]]++; }
+  uint32_t pos = 0;
+  for (int w = 1; w <= max_bits; w++) {
+    rank_start[w] = pos;
+    pos += rank_count[w] << (w - 1);
+  }
+  lane_sync();
+  for (int i = 0; i < num_weights; i++) {
+    uint32_t const w = weights[i];
+    if (w == 0) { continue; }
+    uint32_t const len = 1u << (w - 1);
+    huf_entry_s const e{static_cast<uint8_t>(i), static_cast<uint8_t>(max_bits + 1 - w)};
+    for (uint32_t j = 0; j < len; j++) { s->huf_table[rank_start[w] + j] = e; }
+    rank_start[w] += len;
+  }
+  s->huf_log = max_bits;
+  lane_sync();
+  return consumed;
+}
+
+/**
+ * @brief Decodes a single Huffman-coded literals stream
+ **/
+__device__ __host__ bool decode_huffman_stream(huf_entry_s const *table,
+                                               int log,
+                                               const uint8_t *src,
+                                               size_t size,
+                                               uint8_t *out,
+                                               size_t count)
+{
+  backward_bits_s br;
+  if (!br.init(src, size)) { return false; }
+  for (size_t i = 0; i < count; i++) {
+    huf_entry_s const e = table[br.peek(log)];
+    out[i]              = e.symbol;
+    br.bit_pos -= e.num_bits;
+  }
+  return br.bit_pos == 0;
+}
+
+/**
+ * @brief Copies non-overlapping bytes, or bytes to a lower address, with all lanes
+ **/
+__device__ __host__ void copy_lanes(uint8_t *dst, const uint8_t *src, size_t len, int t, int nt)
+{
+  for (size_t i0 = 0; i0 < len; i0 += nt) {
+    size_t const i  = i0 + t;
+    uint8_t const v = (i < len) ? src[i] : 0;
+    lane_sync();
+    if (i < len) { dst[i] = v; }
+  }
+  lane_sync();
+}
+
+/**
+ * @brief Decodes the literals section of a compressed block
+ *
+ * @param[out] lit Start of the literals
+ * @param[out] lit_len Number of literals
+ *
+ * @return Number of bytes consumed, 0 if the section is invalid
+ **/
+__device__ __host__ size_t decode_literals(unzstd_state_s *s,
+                                           const uint8_t *src,
+                                           size_t size,
+                                           uint8_t *dst,
+                                           size_t dst_size,
+                                           size_t pos,
+                                           const uint8_t *&lit,
+                                           size_t &lit_len,
+                                           int t,
+                                           int nt)
+{
+  if (size < 1) { return 0; }
+  uint32_t const b0   = src[0];
+  uint32_t const type = b0 & 3;
+  uint32_t const fmt  = (b0 >> 2) & 3;
+  size_t hdr, regen;
+  if (type < 2) {
+    // Raw or RLE literals
+    if (fmt == 0 || fmt == 2) {
+      hdr   = 1;
+      regen = b0 >> 3;
+    } else if (fmt == 1) {
+      hdr = 2;
+      if (size < hdr) { return 0; }
+      regen = (b0 >> 4) + (src[1] << 4);
+    } else {
+      hdr = 3;
+      if (size < hdr) { return 0; }
+      regen = (b0 >> 4) + (src[1] << 4) + (src[2] << 12);
+    }
+    if (regen > dst_size - pos) { return 0; }
+    if (type == 0) {
+      if (hdr + regen > size) { return 0; }
+      lit     = src + hdr;
+      lit_len = regen;
+      return hdr + regen;
+    }
+    if (hdr + 1 > size) { return 0; }
+    uint8_t *const out = dst + dst_size - regen;
+    uint8_t const v    = src[hdr];
+    for (size_t i = t; i < regen; i += nt) { out[i] = v; }
+    lane_sync();
+    lit     = out;
+    lit_len = regen;
+    return hdr + 1;
+  }
+
+  // Huffman-coded literals, with a new (type 2) or repeated (type 3) tree
+  int const num_streams = (fmt == 0) ? 1 : 4;
+  int const size_bits   = (fmt < 2) ? 10 : (fmt == 2) ? 14 : 18;
+  hdr                   = (fmt < 2) ? 3 : (fmt == 2) ? 4 : 5;
+  if (size < hdr) { return 0; }
+  uint64_t h = 0;
+  for (size_t i = 0; i < hdr; i++) { h |= static_cast<uint64_t>(src[i]) << (8 * i); }
+  uint32_t const mask = (1u << size_bits) - 1;
+  regen               = (h >> 4) & mask;
+  size_t const csize  = (h >> (4 + size_bits)) & mask;
+  if (hdr + csize > size || regen > dst_size - pos || regen > zstd_max_block_size) { return 0; }
+  const uint8_t *p = src + hdr;
+  size_t rem       = csize;
+  if (type == 2) {
+    size_t const tree_len = read_huffman_table(s, p, rem);
+    if (tree_len == 0) { return 0; }
+    p += tree_len;
+    rem -= tree_len;
+  } else if (s->huf_log < 0) {
+    return 0;
+  }
+  uint8_t *const out = dst + dst_size - regen;
+  bool err           = false;
+  if (num_streams == 1) {
+    if (t == 0) { err = !decode_huffman_stream(s->huf_table, s->huf_log, p, rem, out, regen); }
+  } else {
+    if (rem < 6) { return 0; }
+    size_t const len1 = read_le16(p);
+    size_t const len2 = read_le16(p + 2);
+    size_t const len3 = read_le16(p + 4);
+    if (len1 + len2 + len3 + 6 > rem) { return 0; }
+    size_t const seg = (regen + 3) / 4;
+    if (3 * seg > regen) { return 0; }
+    size_t const lens[4] = {len1, len2, len3, rem - 6 - len1 - len2 - len3};
+    for (int k = t; k < 4; k += nt) {
+      const uint8_t *sp = p + 6;
+      for (int i = 0; i < k; i++) { sp += lens[i]; }
+      size_t const count = (k < 3) ? seg : regen - 3 * seg;
+      err |= !decode_huffman_stream(s->huf_table, s->huf_log, sp, lens[k], out + k * seg, count);
+    }
+  }
+  lane_sync();
+  if (lane_any(err)) { return 0; }
+  lit     = out;
+  lit_len = regen;
+  return hdr + csize;
+}
+
+/**
+ * @brief Sets up the decoding table of one of the sequence codes
+ *
+ * @return Number of bytes consumed, or -1 if the table is invalid
+ **/
+template <typename NormFn>
+__device__ __host__ int setup_sequence_table(fse_entry_s *table,
+                                             int32_t &table_log,
+                                             uint32_t mode,
+                                             const uint8_t *src,
+                                             size_t size,
+                                             NormFn default_norm,
+                                             int default_symbols,
+                                             int default_log,
+                                             int max_symbol,
+                                             int max_log)
+{
+  switch (mode) {
+    case 0:  // Predefined
+      lane_sync();
+      build_default_table(table, default_norm, default_symbols, default_log);
+      table_log = default_log;
+      lane_sync();
+      return 0;
+    case 1:  // RLE
+      if (size < 1 || src[0] > max_symbol) { return -1; }
+      lane_sync();
+      table[0]  = fse_entry_s{0, src[0], 0};
+      table_log = 0;
+      lane_sync();
+      return 1;
+    case 2: {  // FSE-compressed
+      int16_t norm[max_ml_symbol + 1];
+      int num_symbols, log;
+      size_t const len =
+        read_fse_description(src, size, max_symbol, max_log, norm, num_symbols, log);
+      if (len == 0) { return -1; }
+      lane_sync();
+      build_fse_table(table, norm, num_symbols, log);
+      table_log = log;
+      lane_sync();
+      return static_cast<int>(len);
+    }
+    default:  // Repeat
+      return (table_log < 0) ? -1 : 0;
+  }
+}
+
+/**
+ * @brief Copies a match from earlier output with all lanes
+ **/
+__device__ __host__ void copy_match(uint8_t *out, uint32_t offset, uint32_t len, int t, int nt)
+{
+  uint32_t const step = (offset < static_cast<uint32_t>(nt)) ? offset : nt;
+  for (uint32_t i0 = 0; i0 < len; i0 += step) {
+    uint32_t const i = i0 + t;
+    if (static_cast<uint32_t>(t) < step && i < len) { out[i] = (out - offset)[i]; }
+    lane_sync();
+  }
+}
+
+/**
+ * @brief Decodes and executes the sequences section of a compressed block
+ *
+ * @return false if the section is invalid
+ **/
+__device__ __host__ bool decode_sequences(unzstd_state_s *s,
+                                          const uint8_t *src,
+                                          size_t size,
+                                          uint8_t *dst,
+                                          size_t dst_size,
+                                          size_t &pos,
+                                          size_t frame_start,
+                                          const uint8_t *lit,
+                                          size_t lit_len,
+                                          int t,
+                                          int nt)
+{
+  const uint8_t *const lit_end = lit + lit_len;
+  if (size < 1) { return false; }
+  uint32_t num_seq = src[0];
+  size_t p         = 1;
+  if (num_seq >= 128) {
+    if (num_seq < 255) {
+      if (size < 2) { return false; }
+      num_seq = ((num_seq - 128) << 8) + src[1];
+      p       = 2;
+    } else {
+      if (size < 3) { return false; }
+      num_seq = src[1] + (src[2] << 8) + 0x7F00;
+      p       = 3;
+    }
+  }
+  if (num_seq != 0) {
+    if (p >= size) { return false; }
+    uint32_t const modes = src[p++];
+    if (modes & 3) { return false; }
+    int len = setup_sequence_table(s->ll_table,
+                                   s->ll_log,
+                                   modes >> 6,
+                                   src + p,
+                                   size - p,
+                                   ll_default_norm,
+                                   max_ll_symbol + 1,
+                                   ll_default_log,
+                                   max_ll_symbol,
+                                   max_ll_log);
+    if (len < 0) { return false; }
+    p += len;
+    len = setup_sequence_table(s->of_table,
+                               s->of_log,
+                               (modes >> 4) & 3,
+                               src + p,
+                               size - p,
+                               of_default_norm,
+                               max_of_symbol - 2,
+                               of_default_log,
+                               max_of_symbol,
+                               max_of_log);
+    if (len < 0) { return false; }
+    p += len;
+    len = setup_sequence_table(s->ml_table,
+                               s->ml_log,
+                               (modes >> 2) & 3,
+                               src + p,
+                               size - p,
+                               ml_default_norm,
+                               max_ml_symbol + 1,
+                               ml_default_log,
+                               max_ml_symbol,
+                               max_ml_log);
+    if (len < 0) { return false; }
+    p += len;
+
+    backward_bits_s br;
+    if (!br.init(src + p, size - p)) { return false; }
+    uint32_t ll_state = br.get(s->ll_log);
+    uint32_t of_state = br.get(s->of_log);
+    uint32_t ml_state = br.get(s->ml_log);
+    // Every lane updates its own copy of the repeat offsets
+    uint32_t rep[3] = {s->rep[0], s->rep[1], s->rep[2]};
+    for (uint32_t n = 0; n < num_seq; n++) {
+      fse_entry_s const ll_e = s->ll_table[ll_state];
+      fse_entry_s const of_e = s->of_table[of_state];
+      fse_entry_s const ml_e = s->ml_table[ml_state];
+      uint32_t const of_code = of_e.symbol;
+      if (ll_e.symbol > max_ll_symbol || ml_e.symbol > max_ml_symbol) { return false; }
+      // Extra bits are read in the order offset, match length, literals length
+      uint32_t offset;
+      bool const ll0 = (ll_e.symbol == 0);
+      if (of_code > 1) {
+        offset = (1u << of_code) + br.get(of_code) - 3;
+        rep[2] = rep[1];
+        rep[1] = rep[0];
+        rep[0] = offset;
+      } else {
+        uint32_t const idx = of_code + br.get(of_code) + ll0;
+        if (idx == 0) {
+          offset = rep[0];
+        } else {
+          offset = (idx == 3) ? rep[0] - 1 : rep[idx];
+          if (offset == 0) { offset = 1; }
+          if (idx != 1) { rep[2] = rep[1]; }
+          rep[1] = rep[0];
+          rep[0] = offset;
+        }
+      }
+      uint32_t const ml = ml_base(ml_e.symbol) + br.get(ml_bits(ml_e.symbol));
+      uint32_t const ll = ll_base(ll_e.symbol) + br.get(ll_bits(ll_e.symbol));
+      if (n + 1 < num_seq) {
+        // States are updated in the order literals length, match length, offset
+        ll_state = ll_e.new_state + br.get(ll_e.num_bits);
+        ml_state = ml_e.new_state + br.get(ml_e.num_bits);
+        of_state = of_e.new_state + br.get(of_e.num_bits);
+      }
+      if (br.bit_pos < 0 || ll > static_cast<size_t>(lit_end - lit) || ll + ml > dst_size - pos ||
+          offset > pos + ll - frame_start) {
+        return false;
+      }
+      copy_lanes(dst + pos, lit, ll, t, nt);
+      lit += ll;
+      pos += ll;
+      copy_match(dst + pos, offset, ml, t, nt);
+      pos += ml;
+    }
+    if (br.bit_pos != 0) { return false; }
+    lane_sync();
+    s->rep[0] = rep[0];
+    s->rep[1] = rep[1];
+    s->rep[2] = rep[2];
+  }
+  // Remaining literals
+  size_t const ll = lit_end - lit;
+  if (ll > dst_size - pos) { return false; }
+  copy_lanes(dst + pos, lit, ll, t, nt);
+  pos += ll;
+  return true;
+}
+
+/**
+ * @brief Decompresses a sequence of Zstandard frames
+ *
+ * @param[in] s Decoder state (shared by the lanes)
+ * @param[in] src Compressed data
+ * @param[in] src_size Compressed size
+ * @param[in] dst Output buffer
+ * @param[in] dst_size Output buffer size
+ * @param[out] out_size Number of decompressed bytes
+ * @param[in] t Lane index
+ * @param[in] nt Number of lanes
+ *
+ * @return false if the data is invalid or does not fit in the output buffer
+ **/
+__device__ __host__ bool unzstd(unzstd_state_s *s,
+                                const uint8_t *src,
+                                size_t src_size,
+                                uint8_t *dst,
+                                size_t dst_size,
+                                size_t &out_size,
+                                int t,
+                                int nt)
+{
+  const uint8_t *cur       = src;
+  const uint8_t *const end = src + src_size;
+  size_t pos               = 0;
+  out_size                 = 0;
+  if (src_size == 0) { return false; }
+  while (cur < end) {
+    if (end - cur < 4) { return false; }
+    uint32_t const magic = read_le32(cur);
+    cur += 4;
+    if ((magic & ~0xfu) == zstd_skippable_magic) {
+      if (end - cur < 4) { return false; }
+      uint32_t const len = read_le32(cur);
+      cur += 4;
+      if (len > static_cast<size_t>(end - cur)) { return false; }
+      cur += len;
+      continue;
+    }
+    if (magic != zstd_magic || cur >= end) { return false; }
+    // Frame header
+    uint32_t const fhd       = *cur++;
+    uint32_t const fcs_flag  = fhd >> 6;
+    bool const single_seg    = (fhd >> 5) & 1;
+    bool const has_checksum  = (fhd >> 2) & 1;
+    uint32_t const dict_flag = fhd & 3;
+    if (fhd & 8) { return false; }
+    size_t const dict_len = (dict_flag == 3) ? 4 : dict_flag;
+    size_t const fcs_len  = (fcs_flag == 0) ? (single_seg ? 1 : 0) : (1 << fcs_flag);
+    size_t const hdr_len  = (single_seg ? 0 : 1) + dict_len + fcs_len;
+    if (hdr_len > static_cast<size_t>(end - cur)) { return false; }
+    cur += single_seg ? 0 : 1;
+    uint32_t dict_id = 0;
+    for (size_t i = 0; i < dict_len; i++) { dict_id |= cur[i] << (8 * i); }
+    if (dict_id != 0) { return false; }
+    cur += dict_len + fcs_len;
+
+    size_t const frame_start = pos;
+    lane_sync();
+    s->ll_log  = -1;
+    s->of_log  = -1;
+    s->ml_log  = -1;
+    s->huf_log = -1;
+    s->rep[0]  = 1;
+    s->rep[1]  = 4;
+    s->rep[2]  = 8;
+    lane_sync();
+    bool last;
+    do {
+      if (end - cur < 3) { return false; }
+      uint32_t const bh    = read_le24(cur);
+      uint32_t const type  = (bh >> 1) & 3;
+      size_t const bsize   = bh >> 3;
+      size_t const in_size = (type == 1) ? 1 : bsize;
+      last                 = bh & 1;
+      cur += 3;
+      if (in_size > static_cast<size_t>(end - cur) || bsize > zstd_max_block_size) { return false; }
+      switch (type) {
+        case 0:  // Raw
+          if (bsize > dst_size - pos) { return false; }
+          copy_lanes(dst + pos, cur, bsize, t, nt);
+          pos += bsize;
+          break;
+        case 1:  // RLE
+          if (bsize > dst_size - pos) { return false; }
+          for (size_t i = t; i < bsize; i += nt) { dst[pos + i] = cur[0]; }
+          lane_sync();
+          pos += bsize;
+          break;
+        case 2: {  // Compressed
+          const uint8_t *lit;
+          size_t lit_len;
+          size_t const lit_hdr =
+            decode_literals(s, cur, bsize, dst, dst_size, pos, lit, lit_len, t, nt);
+          if (lit_hdr == 0) { return false; }
+          if (!decode_sequences(s,
+                                cur + lit_hdr,
+                                bsize - lit_hdr,
+                                dst,
+                                dst_size,
+                                pos,
+                                frame_start,
+                                lit,
+                                lit_len,
+                                t,
+                                nt)) {
+            return false;
+          }
+          break;
+        }
+        default: return false;
+      }
+      cur += in_size;
+    } while (!last);
+    if (has_checksum) {
+      if (end - cur < 4) { return false; }
+      cur += 4;
+    }
+  }
+  out_size = pos;
+  return true;
+}
+
+}  // namespace
+
+/**
+ * @brief ZSTD decompression kernel
+ *
+ * blockDim {32,1,1}, one warp per stream
+ *
+ * @param[in] inputs Source and destination information per block
+ * @param[out] outputs Decompression status per block
+ * @param[in] count Number of blocks to decompress
+ **/
+__global__ void __launch_bounds__(warp_size)
+  unzstd_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count)
+{
+  __shared__ __align__(16) unzstd_state_s state_g;
+  int const z = blockIdx.x;
+  int const t = threadIdx.x;
+  if (z >= count) { return; }
+
+  size_t out_size = 0;
+  bool const ok   = unzstd(&state_g,
+                         static_cast<const uint8_t *>(inputs[z].srcDevice),
+                         inputs[z].srcSize,
+                         static_cast<uint8_t *>(inputs[z].dstDevice),
+                         inputs[z].dstSize,
+                         out_size,
+                         t,
+                         warp_size);
+  if (t == 0) {
+    outputs[z].bytes_written = ok ? out_size : 0;
+    outputs[z].status        = ok ? 0 : 1;
+    outputs[z].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_unzstd(gpu_inflate_input_s *inputs,
+                                gpu_inflate_status_s *outputs,
+                                int count,
+                                cudaStream_t stream)
+{
+  uint32_t count32 = (count > 0) ? count : 0;
+  dim3 dim_block(warp_size, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(count32, 1);
+  if (count32 > 0) { unzstd_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count); }
+  return cudaSuccess;
+}
+
+size_t cpu_unzstd(uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size)
+{
+  auto state      = std::make_unique<unzstd_state_s>();
+  size_t out_size = 0;
+  return unzstd(state.get(), src, src_size, dst, dst_size, out_size, 0, 1) ? out_size : 0;
+}
+
+}  // namespace io
+}  // namespace cudf
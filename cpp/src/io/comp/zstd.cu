@@ -0,0 +1,823 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file zstd.cu
+ * @brief GPU Zstandard (RFC 8878) compression
+ *
+ * One warp compresses one stream into a single frame of 16KB blocks. Matches are found with the
+ * same hash table as the other LZ77 compressors. The literals of a block are Huffman-coded in
+ * four streams written by the first four threads. Each sequence code uses the predefined FSE
+ * distribution unless a table fitted to the block is estimated to be smaller. Repeat offsets are
+ * not used.
+ */
+
+#include "gpuinflate.h"
+#include "huffman.cuh"
+#include "lz77.cuh"
+#include "zstd.cuh"
+
+namespace cudf {
+namespace io {
+constexpr uint32_t zstd_block_size       = 16 * 1024;  // Uncompressed size of a block
+constexpr uint32_t zstd_max_seqs         = zstd_block_size / 4;
+constexpr uint32_t zstd_frame_hdr_size   = 9;   // Magic, descriptor and 4-byte content size
+constexpr uint32_t zstd_max_huf_bits     = 11;  // Maximum length of a literal code
+constexpr uint32_t zstd_min_huf_literals = 64;  // Fewer literals are always stored raw
+constexpr uint32_t zstd_weight_log       = 6;   // Accuracy of FSE-compressed Huffman weights
+constexpr uint32_t zstd_max_huf_desc     = 128;
+
+/**
+ * @brief FSE encoding transform of a symbol
+ **/
+struct fse_symbol_tt_s {
+  int32_t delta_find_state;
+  uint32_t delta_nb_bits;
+};
+
+/**
+ * @brief FSE encoder state
+ **/
+struct fse_cstate_s {
+  uint32_t value;
+  const uint16_t *state_table;
+  const fse_symbol_tt_s *tt;
+  uint32_t log;
+};
+
+/**
+ * @brief zstd compressor state
+ **/
+struct zstd_enc_state_s {
+  uint16_t hash_map[lz77_hash_size];           ///< Low 16 bits of recent positions, by hash
+  uint16_t seq_ll[zstd_max_seqs + 1];          ///< Literal length of each sequence
+  uint16_t seq_ml[zstd_max_seqs + 1];          ///< Match length of each sequence
+  uint16_t seq_of[zstd_max_seqs + 1];          ///< Match offset of each sequence
+  uint32_t lit_freq[256];                      ///< Literal frequencies
+  uint16_t huf_code[256];                      ///< Literal codes
+  uint8_t huf_len[256];                        ///< Literal code lengths
+  uint8_t huf_weight[256];                     ///< Literal code weights
+  uint16_t sorted[256];                        ///< Huffman construction scratch
+  uint32_t work[256];                          ///< Huffman construction scratch
+  uint8_t huf_desc[zstd_max_huf_desc + 8];     ///< Huffman tree description
+  uint32_t ll_count[max_ll_symbol + 1];        ///< Literal length code frequencies
+  uint32_t of_count[max_of_symbol + 1];        ///< Offset code frequencies
+  uint32_t ml_count[max_ml_symbol + 1];        ///< Match length code frequencies
+  uint16_t ll_state[1 << max_ll_log];          ///< Literal length FSE state table
+  uint16_t of_state[1 << max_of_log];          ///< Offset FSE state table
+  uint16_t ml_state[1 << max_ml_log];          ///< Match length FSE state table
+  uint16_t wt_state[1 << zstd_weight_log];     ///< Huffman weight FSE state table
+  fse_symbol_tt_s ll_tt[max_ll_symbol + 1];    ///< Literal length symbol transforms
+  fse_symbol_tt_s of_tt[max_of_symbol + 1];    ///< Offset symbol transforms
+  fse_symbol_tt_s ml_tt[max_ml_symbol + 1];    ///< Match length symbol transforms
+  fse_symbol_tt_s wt_tt[zstd_max_huf_bits + 1];  ///< Huffman weight symbol transforms
+};
+
+/**
+ * @brief Writes a little-endian value of up to 8 bytes
+ **/
+inline __device__ void zstd_put_le(uint8_t *dst, uint32_t dst_size, uint32_t pos, uint64_t v, int n)
+{
+  for (int i = 0; i < n; i++, v >>= 8) {
+    if (pos + i < dst_size) { dst[pos + i] = static_cast<uint8_t>(v); }
+  }
+}
+
+/**
+ * @brief Builds an FSE encoding table from normalized counts
+ **/
+inline __device__ void fse_build_ctable(uint16_t *state_table,
+                                        fse_symbol_tt_s *tt,
+                                        const int16_t *norm,
+                                        int num_symbols,
+                                        uint32_t log)
+{
+  uint32_t const table_size = 1 << log;
+  uint32_t const mask       = table_size - 1;
+  uint32_t const step       = (table_size >> 1) + (table_size >> 3) + 3;
+  uint32_t high             = table_size - 1;
+  uint8_t symbols[1 << max_ml_log];
+  uint16_t cumul[max_ml_symbol + 2];
+  cumul[0] = 0;
+  for (int u = 1; u <= num_symbols; u++) {
+    if (norm[u - 1] == -1) {
+      cumul[u]        = cumul[u - 1] + 1;
+      symbols[high--] = u - 1;
+    } else {
+      cumul[u] = cumul[u - 1] + norm[u - 1];
+    }
+  }
+  uint32_t pos = 0;
+  for (int s = 0; s < num_symbols; s++) {
+    for (int n = 0; n < norm[s]; n++) {
+      symbols[pos] = s;
+      do {
+        pos = (pos + step) & mask;
+      } while (pos > high);
+    }
+  }
+  for (uint32_t u = 0; u < table_size; u++) { state_table[cumul[symbols[u]]++] = table_size + u; }
+  int total = 0;
+  for (int s = 0; s < num_symbols; s++) {
+    int const n = norm[s];
+    if (n == 0) {
+      tt[s].delta_nb_bits    = ((log + 1) << 16) - table_size;
+      tt[s].delta_find_state = 0;
+    } else if (n == 1 || n == -1) {
+      tt[s].delta_nb_bits    = (log << 16) - table_size;
+      tt[s].delta_find_state = total - 1;
+      total++;
+    } else {
+      uint32_t const max_bits_out = log - (31 - __clz(n - 1));
+      tt[s].delta_nb_bits         = (max_bits_out << 16) - (n << max_bits_out);
+      tt[s].delta_find_state      = total - n;
+      total += n;
+    }
+  }
+}
+
+inline __device__ void fse_init_state(fse_cstate_s &st,
+                                      const uint16_t *state_table,
+                                      const fse_symbol_tt_s *tt,
+                                      uint32_t log,
+                                      uint32_t sym)
+{
+  uint32_t const nb_bits = (tt[sym].delta_nb_bits + (1 << 15)) >> 16;
+  uint32_t const v       = (nb_bits << 16) - tt[sym].delta_nb_bits;
+  st.state_table         = state_table;
+  st.tt                  = tt;
+  st.log                 = log;
+  st.value               = state_table[static_cast<int>(v >> nb_bits) + tt[sym].delta_find_state];
+}
+
+inline __device__ void fse_encode(bit_writer_s &bw, fse_cstate_s &st, uint32_t sym)
+{
+  uint32_t const nb_bits = (st.value + st.tt[sym].delta_nb_bits) >> 16;
+  bw.put(st.value & ((1 << nb_bits) - 1), nb_bits);
+  st.value = st.state_table[static_cast<int>(st.value >> nb_bits) + st.tt[sym].delta_find_state];
+}
+
+inline __device__ void fse_flush(bit_writer_s &bw, const fse_cstate_s &st)
+{
+  bw.put(st.value & ((1 << st.log) - 1), st.log);
+}
+
+/**
+ * @brief Normalizes symbol frequencies to a table size
+ *
+ * @return `false` if the symbols cannot all be represented
+ **/
+inline __device__ bool fse_normalize(
+  const uint32_t *counts, int num_symbols, uint32_t total, uint32_t log, int16_t *norm)
+{
+  int const table_size = 1 << log;
+  int sum              = 0;
+  for (int s = 0; s < num_symbols; s++) {
+    norm[s] = (counts[s] != 0)
+                ? max(1u, (counts[s] * static_cast<uint32_t>(table_size) + (total >> 1)) / total)
+                : 0;
+    sum += norm[s];
+  }
+  // Give the rounding error to (or take it from) the most probable symbols
+  while (sum != table_size) {
+    int largest = 0;
+    for (int s = 1; s < num_symbols; s++) {
+      if (norm[s] > norm[largest]) { largest = s; }
+    }
+    if (sum < table_size) {
+      norm[largest] += table_size - sum;
+      sum = table_size;
+    } else {
+      if (norm[largest] <= 1) { return false; }
+      norm[largest]--;
+      sum--;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Writes the description of a normalized distribution
+ **/
+inline __device__ void fse_write_ncount(bit_writer_s &bw,
+                                        const int16_t *norm,
+                                        int num_symbols,
+                                        uint32_t log)
+{
+  int const table_size = 1 << log;
+  int remaining        = table_size + 1;
+  int threshold        = table_size;
+  uint32_t nb_bits     = log + 1;
+  bool prev0           = false;
+  bw.put(log - 5, 4);
+  for (int sym = 0; sym < num_symbols && remaining > 1;) {
+    if (prev0) {
+      int start = sym;
+      while (norm[sym] == 0) { sym++; }
+      while (sym >= start + 24) {
+        start += 24;
+        bw.put(0xffff, 16);
+      }
+      while (sym >= start + 3) {
+        start += 3;
+        bw.put(3, 2);
+      }
+      bw.put(sym - start, 2);
+    }
+    int count    = norm[sym++];
+    int const mx = (2 * threshold - 1) - remaining;
+    remaining -= (count < 0) ? -count : count;
+    count++;
+    if (count >= threshold) { count += mx; }
+    bw.put(count, nb_bits - (count < mx));
+    prev0 = (count == 1);
+    while (remaining < threshold) {
+      nb_bits--;
+      threshold >>= 1;
+    }
+  }
+  bw.align();
+}
+
+/**
+ * @brief Estimated number of bits to code symbols with a normalized distribution
+ **/
+inline __device__ float fse_cost(const uint32_t *counts,
+                                 const int16_t *norm,
+                                 int num_symbols,
+                                 uint32_t log)
+{
+  float bits = 0;
+  for (int s = 0; s < num_symbols; s++) {
+    if (counts[s] != 0) {
+      if (norm[s] == 0) { return 1e30f; }
+      bits += counts[s] * (log - log2f(static_cast<float>(norm[s] > 0 ? norm[s] : 1)));
+    }
+  }
+  return bits;
+}
+
+/**
+ * @brief Accuracy of a distribution, given the number of coded symbols
+ **/
+inline __device__ uint32_t fse_optimal_log(uint32_t max_log, uint32_t total, uint32_t max_symbol)
+{
+  int const max_bits_src = (31 - __clz(max(total - 1, 1u))) - 2;
+  int const min_bits     = min((31 - __clz(total)) + 1, (31 - __clz(max(max_symbol, 1u))) + 2);
+  int log                = max_log;
+  if (max_bits_src < log) { log = max_bits_src; }
+  if (min_bits > log) { log = min_bits; }
+  return min(max(log, 5), static_cast<int>(max_log));
+}
+
+inline __device__ uint32_t zstd_ll_code(uint32_t ll)
+{
+  if (ll < 16) { return ll; }
+  if (ll >= 64) { return (31 - __clz(ll)) + 19; }
+  uint32_t code = 16;
+  while (ll_base(code + 1) <= ll) { code++; }
+  return code;
+}
+
+inline __device__ uint32_t zstd_ml_code(uint32_t ml)
+{
+  uint32_t const ml_base_value = ml - 3;
+  if (ml_base_value < 32) { return ml_base_value; }
+  if (ml_base_value >= 128) { return (31 - __clz(ml_base_value)) + 36; }
+  uint32_t code = 32;
+  while (ml_base(code + 1) <= ml) { code++; }
+  return code;
+}
+
+/**
+ * @brief Size of the header of a raw or RLE literals section
+ **/
+inline __device__ uint32_t zstd_literals_header_size(uint32_t num_lits)
+{
+  return (num_lits < 32) ? 1 : (num_lits < 4096) ? 2 : 3;
+}
+
+/**
+ * @brief Writes the header of a raw or RLE literals section
+ **/
+inline __device__ void zstd_put_literals_header(
+  uint8_t *dst, uint32_t dst_size, uint32_t pos, uint32_t type, uint32_t num_lits)
+{
+  switch (zstd_literals_header_size(num_lits)) {
+    case 1: zstd_put_le(dst, dst_size, pos, type | (num_lits << 3), 1); break;
+    case 2: zstd_put_le(dst, dst_size, pos, type | (1 << 2) | (num_lits << 4), 2); break;
+    default: zstd_put_le(dst, dst_size, pos, type | (3 << 2) | (num_lits << 4), 3); break;
+  }
+}
+
+/**
+ * @brief Huffman-codes (or measures) one of the four literal streams of a block
+ *
+ * Literals are visited from the last to the first one, as they are read back in reverse order.
+ *
+ * @param lit_beg Index of the first literal of the stream
+ * @param lit_end Index past the last literal of the stream
+ *
+ * @return Number of bits of the stream, excluding the end marker
+ **/
+template <bool emit>
+inline __device__ uint32_t zstd_literal_stream(const zstd_enc_state_s *s,
+                                               const uint8_t *src,
+                                               uint32_t blk_end,
+                                               uint32_t num_seqs,
+                                               uint32_t num_lits,
+                                               uint32_t lit_beg,
+                                               uint32_t lit_end,
+                                               bit_writer_s &bw)
+{
+  uint32_t bits    = 0;
+  uint32_t lit_idx = num_lits;
+  uint32_t src_pos = blk_end;
+  for (int i = num_seqs; i >= 0 && lit_idx > lit_beg; i--) {
+    uint32_t const ll      = s->seq_ll[i];
+    uint32_t const run_beg = lit_idx - ll;
+    uint32_t const hi      = min(lit_idx, lit_end);
+    uint32_t const lo      = max(run_beg, lit_beg);
+    for (uint32_t k = hi; k > lo; k--) {
+      uint32_t const sym = src[src_pos - lit_idx + k - 1];
+      if (emit) {
+        bw.put(s->huf_code[sym], s->huf_len[sym]);
+      } else {
+        bits += s->huf_len[sym];
+      }
+    }
+    lit_idx = run_beg;
+    src_pos -= ll;
+    if (i > 0) { src_pos -= s->seq_ml[i - 1]; }
+  }
+  return bits;
+}
+
+/**
+ * @brief Describes the Huffman literal code by its FSE-compressed weights
+ *
+ * @return Size of the description, 0 if the weights cannot be compressed this way
+ **/
+inline __device__ uint32_t zstd_fse_weights(zstd_enc_state_s *s, uint32_t num_weights)
+{
+  uint32_t counts[zstd_max_huf_bits + 1] = {0};
+  uint32_t max_w = 0, num_distinct = 0;
+  for (uint32_t i = 0; i < num_weights; i++) {
+    uint32_t const w = s->huf_weight[i];
+    num_distinct += (counts[w]++ == 0);
+    max_w = max(max_w, w);
+  }
+  int16_t norm[zstd_max_huf_bits + 1];
+  if (num_weights <= 2 || num_distinct < 2 ||
+      !fse_normalize(counts, max_w + 1, num_weights, zstd_weight_log, norm)) {
+    return 0;
+  }
+  bit_writer_s bw{s->huf_desc, 1, zstd_max_huf_desc, 0, 0};
+  fse_write_ncount(bw, norm, max_w + 1, zstd_weight_log);
+  // Weights, coded with two interleaved states from the last to the first one
+  fse_build_ctable(s->wt_state, s->wt_tt, norm, max_w + 1, zstd_weight_log);
+  fse_cstate_s st1, st2;
+  const uint8_t *wt = s->huf_weight;
+  int i             = num_weights;
+  if (i & 1) {
+    fse_init_state(st1, s->wt_state, s->wt_tt, zstd_weight_log, wt[--i]);
+    fse_init_state(st2, s->wt_state, s->wt_tt, zstd_weight_log, wt[--i]);
+    fse_encode(bw, st1, wt[--i]);
+  } else {
+    fse_init_state(st2, s->wt_state, s->wt_tt, zstd_weight_log, wt[--i]);
+    fse_init_state(st1, s->wt_state, s->wt_tt, zstd_weight_log, wt[--i]);
+  }
+  while (i > 0) {
+    fse_encode(bw, st2, wt[--i]);
+    fse_encode(bw, st1, wt[--i]);
+  }
+  fse_flush(bw, st2);
+  fse_flush(bw, st1);
+  bw.put(1, 1);
+  bw.align();
+  if (bw.pos > zstd_max_huf_desc) { return 0; }
+  s->huf_desc[0] = bw.pos - 1;
+  return bw.pos;
+}
+
+/**
+ * @brief Builds the Huffman literal code of a block and its description
+ *
+ * @return Size of the tree description, 0 if the literals should not be Huffman-coded
+ **/
+inline __device__ uint32_t zstd_build_literal_code(zstd_enc_state_s *s, uint32_t max_sym)
+{
+  uint32_t huf_log = 0;
+  uint32_t nb_per_rank[zstd_max_huf_bits + 2]  = {0};
+  uint32_t val_per_rank[zstd_max_huf_bits + 2] = {0};
+  for (uint32_t i = 0; i <= max_sym; i++) {
+    huf_log = max(huf_log, static_cast<uint32_t>(s->huf_len[i]));
+    nb_per_rank[s->huf_len[i]]++;
+  }
+  // Canonical codes, with the longest codes first and the symbols in order within a length
+  uint32_t code = 0;
+  for (uint32_t n = huf_log; n > 0; n--) {
+    val_per_rank[n] = code;
+    code            = (code + nb_per_rank[n]) >> 1;
+  }
+  for (uint32_t i = 0; i <= max_sym; i++) {
+    uint32_t const len = s->huf_len[i];
+    s->huf_code[i]     = (len != 0) ? val_per_rank[len]++ : 0;
+    s->huf_weight[i]   = (len != 0) ? huf_log + 1 - len : 0;
+  }
+  // The weight of the last symbol is implied
+  uint32_t const num_weights = max_sym;
+  uint32_t desc_size         = zstd_fse_weights(s, num_weights);
+  uint32_t const direct_size = 1 + ((num_weights + 1) >> 1);
+  if (num_weights <= 128 && (desc_size == 0 || direct_size <= desc_size)) {
+    s->huf_desc[0] = 127 + num_weights;
+    for (uint32_t i = 0; i < num_weights; i += 2) {
+      uint32_t const w2   = (i + 1 < num_weights) ? s->huf_weight[i + 1] : 0;
+      s->huf_desc[1 + (i >> 1)] = (s->huf_weight[i] << 4) | w2;
+    }
+    desc_size = direct_size;
+  }
+  return desc_size;
+}
+
+/**
+ * @brief Encodes the literals section of a block
+ *
+ * Must be called by all the threads of the warp.
+ *
+ * @return Size of the literals section in bytes
+ **/
+inline __device__ uint32_t zstd_encode_literals(zstd_enc_state_s *s,
+                                                const uint8_t *src,
+                                                uint32_t blk_end,
+                                                uint32_t num_seqs,
+                                                uint32_t num_lits,
+                                                uint8_t *dst,
+                                                uint32_t dst_size,
+                                                uint32_t out,
+                                                uint32_t t)
+{
+  uint32_t max_sym = 0, num_distinct = 0;
+  for (uint32_t i = t; i < 256; i += 32) {
+    if (s->lit_freq[i] != 0) {
+      max_sym = i;
+      num_distinct++;
+    }
+  }
+  for (uint32_t m = 16; m > 0; m >>= 1) { max_sym = max(max_sym, SHFL_XOR(max_sym, m)); }
+  num_distinct = WarpReduceSum32(num_distinct);
+  uint32_t const lit_hdr_size = zstd_literals_header_size(num_lits);
+  if (num_distinct == 1) {
+    if (t == 0) {
+      zstd_put_literals_header(dst, dst_size, out, 1, num_lits);
+      zstd_put_le(dst, dst_size, out + lit_hdr_size, max_sym, 1);
+    }
+    return lit_hdr_size + 1;
+  }
+  uint32_t const raw_size = lit_hdr_size + num_lits;
+  uint32_t huf_size       = raw_size;
+  if (num_lits >= zstd_min_huf_literals) {
+    huffman_code_lengths(
+      s->lit_freq, max_sym + 1, zstd_max_huf_bits, s->huf_len, s->sorted, s->work, t);
+    uint32_t desc_size = 0;
+    if (t == 0) { desc_size = zstd_build_literal_code(s, max_sym); }
+    desc_size = SHFL0(desc_size);
+    SYNCWARP();
+    if (desc_size != 0) {
+      // Measure the four streams, then write them at their offsets
+      uint32_t const seg_len = (num_lits + 3) >> 2;
+      uint32_t const lit_beg = min(t * seg_len, num_lits);
+      uint32_t const lit_end = min(lit_beg + seg_len, num_lits);
+      bit_writer_s bw{dst, 0, dst_size, 0, 0};
+      uint32_t stream_size = 0;
+      if (t < 4) {
+        stream_size =
+          (zstd_literal_stream<false>(s, src, blk_end, num_seqs, num_lits, lit_beg, lit_end, bw) +
+           8) >>
+          3;
+      }
+      uint32_t const size0 = SHFL(stream_size, 0), size1 = SHFL(stream_size, 1);
+      uint32_t const size2 = SHFL(stream_size, 2), size3 = SHFL(stream_size, 3);
+      uint32_t const csize = desc_size + 6 + size0 + size1 + size2 + size3;
+      uint32_t const hdr_size = (num_lits < 1024 && csize < 1024)     ? 3
+                                : (num_lits < 16384 && csize < 16384) ? 4
+                                                                      : 5;
+      if (hdr_size + csize < raw_size) {
+        huf_size = hdr_size + csize;
+        if (t == 0) {
+          // Four streams, with 10, 14 or 18-bit sizes
+          uint64_t const sf      = hdr_size - 2;
+          uint32_t const sz_bits = 10 + 4 * (hdr_size - 3);
+          zstd_put_le(dst,
+                      dst_size,
+                      out,
+                      2 | (sf << 2) | (num_lits << 4) | (static_cast<uint64_t>(csize) << (4 + sz_bits)),
+                      hdr_size);
+          for (uint32_t i = 0; i < desc_size; i++) {
+            zstd_put_le(dst, dst_size, out + hdr_size + i, s->huf_desc[i], 1);
+          }
+          uint32_t const jump = out + hdr_size + desc_size;
+          zstd_put_le(dst, dst_size, jump, size0, 2);
+          zstd_put_le(dst, dst_size, jump + 2, size1, 2);
+          zstd_put_le(dst, dst_size, jump + 4, size2, 2);
+        }
+        if (t < 4) {
+          bw.pos = out + hdr_size + desc_size + 6 + ((t > 0) ? size0 : 0) + ((t > 1) ? size1 : 0) +
+                   ((t > 2) ? size2 : 0);
+          zstd_literal_stream<true>(s, src, blk_end, num_seqs, num_lits, lit_beg, lit_end, bw);
+          bw.put(1, 1);
+          bw.align();
+        }
+      }
+    }
+  }
+  if (huf_size >= raw_size) {
+    // Raw literals, gathered from the literal runs of the sequences
+    if (t == 0) { zstd_put_literals_header(dst, dst_size, out, 0, num_lits); }
+    uint32_t pos     = out + lit_hdr_size;
+    uint32_t src_pos = blk_end;
+    for (uint32_t i = 0; i <= num_seqs; i++) { src_pos -= s->seq_ll[i] + s->seq_ml[i]; }
+    for (uint32_t i = 0; i <= num_seqs; i++) {
+      uint32_t const ll = s->seq_ll[i];
+      if (pos + ll <= dst_size) {
+        for (uint32_t k = t; k < ll; k += 32) { dst[pos + k] = src[src_pos + k]; }
+      }
+      pos += ll;
+      src_pos += ll + s->seq_ml[i];
+    }
+    huf_size = raw_size;
+  }
+  SYNCWARP();
+  return huf_size;
+}
+
+/**
+ * @brief Selects the cheapest coding of one of the sequence codes and builds its table
+ *
+ * The table description, if any, is written to the output.
+ *
+ * @return Compression mode: 0 (predefined), 1 (RLE) or 2 (FSE-compressed)
+ **/
+template <typename NormFn>
+inline __device__ uint32_t zstd_sequence_table(bit_writer_s &bw,
+                                               const uint32_t *counts,
+                                               uint32_t num_seqs,
+                                               NormFn default_norm,
+                                               int default_symbols,
+                                               uint32_t default_log,
+                                               int max_symbol,
+                                               uint32_t max_log,
+                                               uint16_t *state_table,
+                                               fse_symbol_tt_s *tt)
+{
+  int16_t norm[max_ml_symbol + 1];
+  int num_symbols = 0;
+  for (int sym = 0; sym <= max_symbol; sym++) {
+    if (counts[sym] != 0) { num_symbols = sym + 1; }
+  }
+  if (counts[num_symbols - 1] == num_seqs) {
+    // Single code: no bits per sequence
+    for (int sym = 0; sym < num_symbols; sym++) { norm[sym] = (sym == num_symbols - 1); }
+    fse_build_ctable(state_table, tt, norm, num_symbols, 0);
+    bw.put(num_symbols - 1, 8);
+    return 1;
+  }
+  for (int sym = 0; sym < default_symbols; sym++) { norm[sym] = default_norm(sym); }
+  float const default_cost = (num_symbols <= default_symbols)
+                               ? fse_cost(counts, norm, num_symbols, default_log)
+                               : 1e30f;
+  uint32_t const log = fse_optimal_log(max_log, num_seqs, num_symbols - 1);
+  int16_t fse_norm[max_ml_symbol + 1];
+  if (fse_normalize(counts, num_symbols, num_seqs, log, fse_norm)) {
+    bit_writer_s hdr{nullptr, 0, 0, 0, 0};
+    fse_write_ncount(hdr, fse_norm, num_symbols, log);
+    if (8 * hdr.pos + fse_cost(counts, fse_norm, num_symbols, log) < default_cost) {
+      fse_write_ncount(bw, fse_norm, num_symbols, log);
+      fse_build_ctable(state_table, tt, fse_norm, num_symbols, log);
+      return 2;
+    }
+  }
+  fse_build_ctable(state_table, tt, norm, default_symbols, default_log);
+  return 0;
+}
+
+/**
+ * @brief Encodes the sequences section of a block
+ *
+ * Must be called by all the threads of the warp.
+ *
+ * @return Size of the sequences section in bytes
+ **/
+inline __device__ uint32_t zstd_encode_sequences(
+  zstd_enc_state_s *s, uint32_t num_seqs, uint8_t *dst, uint32_t dst_size, uint32_t out, uint32_t t)
+{
+  for (uint32_t i = t; i <= max_ml_symbol; i += 32) {
+    if (i <= max_ll_symbol) { s->ll_count[i] = 0; }
+    if (i <= max_of_symbol) { s->of_count[i] = 0; }
+    s->ml_count[i] = 0;
+  }
+  SYNCWARP();
+  for (uint32_t i = t; i < num_seqs; i += 32) {
+    atomicAdd(&s->ll_count[zstd_ll_code(s->seq_ll[i])], 1);
+    atomicAdd(&s->of_count[31 - __clz(s->seq_of[i] + 3)], 1);
+    atomicAdd(&s->ml_count[zstd_ml_code(s->seq_ml[i])], 1);
+  }
+  SYNCWARP();
+  bit_writer_s bw{dst, out, dst_size, 0, 0};
+  if (t != 0) { return 0; }
+  if (num_seqs < 128) {
+    bw.put(num_seqs, 8);
+  } else {
+    bw.put((num_seqs >> 8) + 0x80, 8);
+    bw.put(num_seqs & 0xff, 8);
+  }
+  if (num_seqs == 0) { return bw.pos - out; }
+  uint32_t const modes_pos = bw.pos;
+  bw.put(0, 8);
+  uint32_t const ll_mode = zstd_sequence_table(bw,
+                                               s->ll_count,
+                                               num_seqs,
+                                               ll_default_norm,
+                                               max_ll_symbol + 1,
+                                               ll_default_log,
+                                               max_ll_symbol,
+                                               max_ll_log,
+                                               s->ll_state,
+                                               s->ll_tt);
+  uint32_t const of_mode = zstd_sequence_table(bw,
+                                               s->of_count,
+                                               num_seqs,
+                                               of_default_norm,
+                                               max_of_symbol - 2,
+                                               of_default_log,
+                                               max_of_symbol,
+                                               max_of_log,
+                                               s->of_state,
+                                               s->of_tt);
+  uint32_t const ml_mode = zstd_sequence_table(bw,
+                                               s->ml_count,
+                                               num_seqs,
+                                               ml_default_norm,
+                                               max_ml_symbol + 1,
+                                               ml_default_log,
+                                               max_ml_symbol,
+                                               max_ml_log,
+                                               s->ml_state,
+                                               s->ml_tt);
+  zstd_put_le(dst, dst_size, modes_pos, (ll_mode << 6) | (of_mode << 4) | (ml_mode << 2), 1);
+  auto table_log = [](uint32_t mode, const uint16_t *state_table, uint32_t default_log) {
+    // The state table of a 2^n-entry table holds states 2^n..2^(n+1)-1
+    return (mode == 0) ? default_log : 31 - __clz(state_table[0]);
+  };
+  auto put_extra_bits = [&](int i, uint32_t llc, uint32_t mlc, uint32_t ofc) {
+    bw.put((s->seq_ll[i] - ll_base(llc)), ll_bits(llc));
+    bw.put((s->seq_ml[i] - ml_base(mlc)), ml_bits(mlc));
+    bw.put((s->seq_of[i] + 3) & ((1 << ofc) - 1), ofc);
+  };
+  fse_cstate_s ll_st, of_st, ml_st;
+  int i              = num_seqs - 1;
+  uint32_t const llc = zstd_ll_code(s->seq_ll[i]);
+  uint32_t const mlc = zstd_ml_code(s->seq_ml[i]);
+  uint32_t const ofc = 31 - __clz(s->seq_of[i] + 3);
+  fse_init_state(ml_st, s->ml_state, s->ml_tt, table_log(ml_mode, s->ml_state, ml_default_log), mlc);
+  fse_init_state(of_st, s->of_state, s->of_tt, table_log(of_mode, s->of_state, of_default_log), ofc);
+  fse_init_state(ll_st, s->ll_state, s->ll_tt, table_log(ll_mode, s->ll_state, ll_default_log), llc);
+  put_extra_bits(i, llc, mlc, ofc);
+  while (--i >= 0) {
+    uint32_t const llc = zstd_ll_code(s->seq_ll[i]);
+    uint32_t const mlc = zstd_ml_code(s->seq_ml[i]);
+    uint32_t const ofc = 31 - __clz(s->seq_of[i] + 3);
+    fse_encode(bw, of_st, ofc);
+    fse_encode(bw, ml_st, mlc);
+    fse_encode(bw, ll_st, llc);
+    put_extra_bits(i, llc, mlc, ofc);
+  }
+  fse_flush(bw, ml_st);
+  fse_flush(bw, of_st);
+  fse_flush(bw, ll_st);
+  bw.put(1, 1);
+  bw.align();
+  return bw.pos - out;
+}
+
+/**
+ * @brief zstd compression kernel
+ *
+ * See https://tools.ietf.org/html/rfc8878
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ **/
+extern "C" __global__ void __launch_bounds__(32)
+  zstd_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count)
+{
+  __shared__ __align__(16) zstd_enc_state_s state_g;
+
+  zstd_enc_state_s *const s = &state_g;
+  uint32_t const t          = threadIdx.x;
+  const uint8_t *src        = reinterpret_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+  uint32_t const src_len    = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+  uint8_t *dst              = reinterpret_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+  uint32_t const dst_len    = static_cast<uint32_t>(inputs[blockIdx.x].dstSize);
+
+  for (uint32_t i = t; i < lz77_hash_size; i += 32) { s->hash_map[i] = 0; }
+  if (t == 0) {
+    // Single-segment frame with a 4-byte content size and no checksum
+    zstd_put_le(dst, dst_len, 0, zstd_magic, 4);
+    zstd_put_le(dst, dst_len, 4, 0xa0, 1);
+    zstd_put_le(dst, dst_len, 5, src_len, 4);
+  }
+  SYNCWARP();
+  uint32_t out = zstd_frame_hdr_size;
+  uint32_t pos = 0;
+  do {
+    uint32_t const blk_end = min(pos + zstd_block_size, src_len);
+    uint32_t const blk_len = blk_end - pos;
+    for (uint32_t i = t; i < 256; i += 32) { s->lit_freq[i] = 0; }
+    SYNCWARP();
+    uint32_t num_seqs = 0, num_lits = 0, lit_run = 0;
+    for (uint32_t p = pos; p < blk_end;) {
+      uint32_t dist;
+      uint32_t const literal_cnt =
+        lz77_find_match(s->hash_map, src, p, blk_end, lz77_max_distance_16, t, dist);
+      if (t < literal_cnt) { atomicAdd(&s->lit_freq[src[p + t]], 1); }
+      p += literal_cnt;
+      lit_run += literal_cnt;
+      if (dist != 0) {
+        uint32_t const len =
+          4 + lz77_match_length(src + p + 4, src + p + 4 - dist, blk_end - p - 4, t);
+        if (t == 0) {
+          s->seq_ll[num_seqs] = lit_run;
+          s->seq_ml[num_seqs] = len;
+          s->seq_of[num_seqs] = dist;
+        }
+        num_seqs++;
+        num_lits += lit_run;
+        lit_run = 0;
+        p += len;
+      }
+      SYNCWARP();
+    }
+    if (t == 0) {
+      // Trailing literals, as a sequence without a match
+      s->seq_ll[num_seqs] = lit_run;
+      s->seq_ml[num_seqs] = 0;
+    }
+    num_lits += lit_run;
+    SYNCWARP();
+    uint32_t const lit_size =
+      zstd_encode_literals(s, src, blk_end, num_seqs, num_lits, dst, dst_len, out + 3, t);
+    uint32_t blk_size =
+      lit_size + zstd_encode_sequences(s, num_seqs, dst, dst_len, out + 3 + lit_size, t);
+    blk_size            = SHFL0(blk_size);
+    uint32_t const last = (blk_end == src_len);
+    if (blk_size < blk_len) {
+      if (t == 0) { zstd_put_le(dst, dst_len, out, (blk_size << 3) | (2 << 1) | last, 3); }
+    } else {
+      // Raw block
+      blk_size = blk_len;
+      if (t == 0) { zstd_put_le(dst, dst_len, out, (blk_size << 3) | last, 3); }
+      if (out + 3 + blk_len <= dst_len) {
+        for (uint32_t i = t; i < blk_len; i += 32) { dst[out + 3 + i] = src[pos + i]; }
+      }
+    }
+    out += 3 + blk_size;
+    pos = blk_end;
+    SYNCWARP();
+  } while (pos < src_len);
+  if (t == 0) {
+    outputs[blockIdx.x].bytes_written = out;
+    outputs[blockIdx.x].status        = (out > dst_len) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_zstd(gpu_inflate_input_s *inputs,
+                              gpu_inflate_status_s *outputs,
+                              int count,
+                              cudaStream_t stream)
+{
+  dim3 dim_block(32, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) { zstd_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count); }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file zstd.cuh
+ * @brief Zstandard (RFC 8878) format constants shared by the compressor and decompressor
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+constexpr uint32_t zstd_magic          = 0xFD2FB528;
+constexpr uint32_t zstd_max_block_size = 128 * 1024;
+
+constexpr int max_ll_symbol = 35;
+constexpr int max_of_symbol = 31;
+constexpr int max_ml_symbol = 52;
+
+// Largest accuracy of the sequence code distributions
+constexpr int max_ll_log = 9;
+constexpr int max_of_log = 8;
+constexpr int max_ml_log = 9;
+
+// Accuracy of the predefined distributions
+constexpr int ll_default_log = 6;
+constexpr int of_default_log = 5;
+constexpr int ml_default_log = 6;
+
+// Predefined distributions of the sequence codes
+__device__ __host__ inline int16_t ll_default_norm(int s)
+{
+  constexpr int16_t norm[max_ll_symbol + 1] = {4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                                               2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+                                               2, 3, 2, 1, 1, 1, 1, 1, -1, -1, -1, -1};
+  return norm[s];
+}
+
+__device__ __host__ inline int16_t of_default_norm(int s)
+{
+  constexpr int16_t norm[max_of_symbol - 2] = {1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1,
+                                               1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+  return norm[s];
+}
+
+__device__ __host__ inline int16_t ml_default_norm(int s)
+{
+  constexpr int16_t norm[max_ml_symbol + 1] = {
+    1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  1,  -1, -1, -1, -1, -1, -1, -1};
+  return norm[s];
+}
+
+// Baselines and number of extra bits of the literal length and match length codes
+__device__ __host__ inline uint32_t ll_base(int code)
+{
+  constexpr uint32_t base[max_ll_symbol + 1] = {
+    0,  1,  2,  3,  4,  5,  6,  7,  8,   9,   10,  11,   12,   13,   14,   15,    16,    18,
+    20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536};
+  return base[code];
+}
+
+__device__ __host__ inline uint32_t ll_bits(int code)
+{
+  constexpr uint8_t bits[max_ll_symbol + 1] = {0, 0, 0, 0, 0, 0, 0, 0, 0,  0,  0,  0,
+                                               0, 0, 0, 0, 1, 1, 1, 1, 2,  2,  3,  3,
+                                               4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+  return bits[code];
+}
+
+__device__ __host__ inline uint32_t ml_base(int code)
+{
+  constexpr uint32_t base[max_ml_symbol + 1] = {
+    3,  4,  5,  6,  7,  8,  9,  10, 11, 12,  13,  14,  15,  16,   17,   18,   19,    20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30,  31,  32,  33,  34,   35,   37,   39,    41,
+    43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539};
+  return base[code];
+}
+
+__device__ __host__ inline uint32_t ml_bits(int code)
+{
+  constexpr uint8_t bits[max_ml_symbol + 1] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0,  0,  0,
+                                               0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0,  0,  0,
+                                               0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3,  3,  4,  4,
+                                               5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+  return bits[code];
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -33,6 +33,10 @@
 #include <io/utilities/parsing_utils.cuh>
 #include <type_traits>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
 using namespace ::cudf::io;
 
 namespace cudf {
@@ -973,6 +977,105 @@ __global__ void __launch_bounds__(rowofs_block_dim) gather_row_offsets_gpu(uint6
   }
 }
 
+/*
+ * @brief Total row counts and output contexts of a sequence of character blocks, for each of the
+ * non-EOF input contexts
+ *
+ * Unlike the packed row context, the row counts are not limited to 18 bits, so that the contexts
+ * of all the blocks in a chunk can be combined.
+ **/
+struct row_context_transition {
+  uint64_t row_count[3];
+  uint32_t out_ctx[3];
+};
+
+/*
+ * @brief Expand a packed row context into a row context transition
+ **/
+struct unpack_row_context {
+  __device__ row_context_transition operator()(packed_rowctx_t packed_ctx) const
+  {
+    row_context_transition result;
+    for (uint32_t id = ROW_CTX_NONE; id < ROW_CTX_EOF; id++) {
+      auto const ctx       = get_row_context(packed_ctx, id);
+      result.row_count[id] = ctx >> 2;
+      result.out_ctx[id]   = ctx & 3;
+    }
+    return result;
+  }
+};
+
+/*
+ * @brief Merge the transitions of two consecutive sequences of character blocks
+ * (associative, so it can be used for a prefix scan)
+ **/
+struct merge_row_context_transitions {
+  __device__ row_context_transition operator()(row_context_transition const &first,
+                                               row_context_transition const &second) const
+  {
+    row_context_transition result;
+    for (uint32_t id = ROW_CTX_NONE; id < ROW_CTX_EOF; id++) {
+      auto const mid_ctx = first.out_ctx[id];
+      if (mid_ctx == ROW_CTX_EOF) {
+        result.row_count[id] = first.row_count[id];
+        result.out_ctx[id]   = ROW_CTX_EOF;
+      } else {
+        result.row_count[id] = first.row_count[id] + second.row_count[mid_ctx];
+        result.out_ctx[id]   = second.out_ctx[mid_ctx];
+      }
+    }
+    return result;
+  }
+};
+
+/*
+ * @brief Same as select_row_context, for a row context transition
+ **/
+inline __host__ __device__ rowctx64_t select_row_context(rowctx64_t sel_ctx,
+                                                         row_context_transition const &transition)
+{
+  uint32_t ctxid = static_cast<uint32_t>(sel_ctx & 3);
+  if (ctxid == ROW_CTX_EOF) { return sel_ctx; }
+  return (sel_ctx & ~3) + (transition.row_count[ctxid] << 2) + transition.out_ctx[ctxid];
+}
+
+rowctx64_t __host__ select_row_contexts(uint64_t *row_ctx,
+                                        uint32_t num_blocks,
+                                        rowctx64_t start_ctx,
+                                        cudaStream_t stream)
+{
+  if (num_blocks == 0) { return start_ctx; }
+
+  // Inclusive scan: transition from the start of the chunk to the end of each block
+  rmm::device_vector<row_context_transition> transitions(num_blocks);
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                                   row_ctx,
+                                   row_ctx + num_blocks,
+                                   transitions.begin(),
+                                   unpack_row_context{},
+                                   merge_row_context_transitions{});
+
+  // The input context of each block is the output context of the previous one
+  auto const d_transitions = transitions.data().get();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<uint32_t>(0),
+                    thrust::make_counting_iterator<uint32_t>(num_blocks),
+                    row_ctx,
+                    [d_transitions, start_ctx] __device__(uint32_t block) {
+                      return (block == 0) ? start_ctx
+                                          : select_row_context(start_ctx, d_transitions[block - 1]);
+                    });
+
+  row_context_transition last;
+  CUDA_TRY(cudaMemcpyAsync(&last,
+                           d_transitions + num_blocks - 1,
+                           sizeof(row_context_transition),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return select_row_context(start_ctx, last);
+}
+
 size_t __host__ count_blank_rows(rmm::device_vector<uint64_t> const &row_offsets,
                                  rmm::device_vector<char> const &data,
                                  const cudf::io::ParseOptions &opts,
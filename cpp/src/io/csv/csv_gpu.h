@@ -161,6 +161,25 @@ uint32_t gather_row_offsets(uint64_t *row_ctx,
                             const cudf::io::ParseOptions &options,
                             cudaStream_t stream = 0);
 
+/**
+ * @brief Resolve the input parsing context of each character block on the device
+ *
+ * Combines the packed row contexts from phase 1 of gather_row_offsets with a parallel prefix
+ * scan, without copying them to the host. Each packed row context is replaced with the input
+ * context of its block (in the format returned by select_row_context), as expected by phase 2.
+ *
+ * @param row_ctx Packed row contexts on input; input context of each block on output
+ * @param num_blocks Number of row contexts
+ * @param start_ctx Parsing context at the beginning of the first block
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Parsing context at the end of the last block
+ **/
+rowctx64_t select_row_contexts(uint64_t *row_ctx,
+                               uint32_t num_blocks,
+                               rowctx64_t start_ctx,
+                               cudaStream_t stream = 0);
+
 /**
  * Count the number of blank rows in the given row offset array
  *
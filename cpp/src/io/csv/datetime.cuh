@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/detail/utilities/iso_datetime.cuh>
+
 /**
  * @brief Returns location to the first occurrence of a character in a string
  *
@@ -299,6 +301,37 @@ __inline__ __device__ void extractTime(
   }
 }
 
+/**
+ * @brief Parses the fixed-width ISO-8601 forms `YYYY-MM-DD`, `YYYY-MM-DDTHH:MM:SS` and
+ * `YYYY-MM-DDTHH:MM:SS.sss`, with a 'T' or a space between the date and the time
+ *
+ * These forms are parsed at fixed offsets, without searching for the separators.
+ *
+ * @param[in] data The character string to parse
+ * @param[in] start The start index of the character stream
+ * @param[in] end The end index of the character stream
+ * @param[in] date_only Flag to only accept the `YYYY-MM-DD` form
+ * @param[out] fields The date and time field values, with the milliseconds as subseconds
+ *
+ * @return true if the characters are in one of the forms, false otherwise
+ */
+__inline__ __device__ bool parseIsoDateTime(const char *data,
+                                            long start,
+                                            long end,
+                                            bool date_only,
+                                            cudf::detail::datetime_fields *fields)
+{
+  cudf::detail::iso_datetime_format format;
+  auto const length = end - start + 1;
+  if (length != 10) {
+    if (date_only || (length != 19 && length != 23)) { return false; }
+    format.has_time         = true;
+    format.time_separator   = data[start + 10] == ' ' ? ' ' : 'T';
+    format.subsecond_digits = length == 23 ? 3 : 0;
+  }
+  return cudf::detail::parse_iso_datetime(data + start, format, *fields);
+}
+
 /**
  * @brief Parse a Date string into a date32, days since epoch
  *
@@ -317,6 +350,11 @@ __inline__ __device__ int32_t parseDateFormat(const char *data,
                                               long end_idx,
                                               bool dayfirst)
 {
+  cudf::detail::datetime_fields fields;
+  if (parseIsoDateTime(data, start_idx, end_idx, true, &fields)) {
+    return daysSinceEpoch(fields.year, fields.month, fields.day);
+  }
+
   int day, month, year;
   int32_t e = -1;
 
@@ -346,6 +384,14 @@ __inline__ __device__ int64_t parseDateTimeFormat(const char *data,
                                                   long end,
                                                   bool dayfirst)
 {
+  cudf::detail::datetime_fields fields;
+  if (parseIsoDateTime(data, start, end, false, &fields)) {
+    return secondsSinceEpoch(
+             fields.year, fields.month, fields.day, fields.hour, fields.minute, fields.second) *
+             1000 +
+           fields.subsecond;
+  }
+
   int day, month, year;
   int hour, minute, second, millisecond = 0;
   int64_t answer = -1;
@@ -27,14 +27,19 @@
 #include <tuple>
 #include <unordered_map>
 
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/replace.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <io/comp/io_uncomp.h>
+#include <io/utilities/device_read_pipeline.hpp>
 #include <io/utilities/parsing_utils.cuh>
 #include <io/utilities/type_conversion.cuh>
 
+#include <thrust/reduce.h>
+
 using std::string;
 using std::vector;
 
@@ -199,19 +204,34 @@ table_with_metadata reader::impl::read(size_t range_offset,
     assert(!filepath_.empty());
     source_ = datasource::create(filepath_, range_offset, map_range_size);
   }
+  source_->advise_access_pattern(datasource::access_pattern::SEQUENTIAL);
 
   // Return an empty dataframe if no data and no column metadata to process
   if (source_->is_empty() && (args_.names.empty() || args_.dtype.empty())) {
     return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
   }
 
+  // None of the parameters for row selection is used, we are parsing the entire file
+  const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
+                               skip_end_rows <= 0 && num_rows == -1;
+
+  // Large sources can be parsed in pieces, with the reads overlapping the decoding
+  if (args_.chunk_size != 0 && load_whole_file && compression_type_ == "none" &&
+      source_->size() > args_.chunk_size) {
+    return read_chunked(stream);
+  }
+
   // Transfer source data to GPU
   if (!source_->is_empty()) {
     const char *h_uncomp_data = nullptr;
     size_t h_uncomp_size      = 0;
 
     auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
-    auto buffer    = source_->host_read(range_offset, data_size);
+    std::unique_ptr<datasource::buffer> buffer;
+    {
+      CUDF_SCOPED_RANGE_PAYLOAD("csv::read_source", data_size);
+      buffer = source_->host_read(range_offset, data_size);
+    }
 
     std::vector<char> h_uncomp_data_owner;
     if (compression_type_ == "none") {
@@ -219,14 +239,14 @@ table_with_metadata reader::impl::read(size_t range_offset,
       h_uncomp_data = reinterpret_cast<const char *>(buffer->data());
       h_uncomp_size = buffer->size();
     } else {
-      h_uncomp_data_owner = getUncompressedHostData(
-        reinterpret_cast<const char *>(buffer->data()), buffer->size(), compression_type_);
+      CUDF_SCOPED_RANGE_PAYLOAD("csv::decompress", buffer->size());
+      h_uncomp_data_owner = getUncompressedHostData(reinterpret_cast<const char *>(buffer->data()),
+                                                    buffer->size(),
+                                                    compression_type_,
+                                                    stream);
       h_uncomp_data = h_uncomp_data_owner.data();
       h_uncomp_size = h_uncomp_data_owner.size();
     }
-    // None of the parameters for row selection is used, we are parsing the entire file
-    const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
-                                 skip_end_rows <= 0 && num_rows == -1;
 
     // With byte range, find the start of the first data row
     size_t const data_start_offset =
@@ -236,15 +256,29 @@ table_with_metadata reader::impl::read(size_t range_offset,
     CUDF_EXPECTS((range_offset == 0 || args_.header < 0),
                  "byte_range offset with header not supported");
 
-    // Gather row offsets
-    gather_row_offsets(h_uncomp_data,
-                       h_uncomp_size,
-                       data_start_offset,
-                       (range_size) ? range_size : h_uncomp_size,
-                       (skip_rows > 0) ? skip_rows : 0,
-                       num_rows,
-                       load_whole_file,
-                       stream);
+    // Sources of discrete messages know where the rows start, as long as the whole source is
+    // parsed without decompression
+    auto const record_offsets = (load_whole_file && compression_type_ == "none")
+                                  ? source_->record_offsets()
+                                  : std::vector<size_t>{};
+    if (!record_offsets.empty()) {
+      set_row_offsets_from_records(h_uncomp_data,
+                                   h_uncomp_size,
+                                   record_offsets,
+                                   (args_.header >= 0) ? args_.header + 1 : 0,
+                                   stream);
+    } else {
+      // Gather row offsets
+      gather_row_offsets(h_uncomp_data,
+                         h_uncomp_size,
+                         data_start_offset,
+                         (range_size) ? range_size : h_uncomp_size,
+                         (skip_rows > 0) ? skip_rows : 0,
+                         (args_.header >= 0) ? args_.header + 1 : 0,
+                         num_rows,
+                         load_whole_file,
+                         stream);
+    }
 
     // Exclude the rows that are to be skipped from the end
     if (skip_end_rows > 0 && static_cast<size_t>(skip_end_rows) < row_offsets.size()) {
@@ -258,6 +292,103 @@ table_with_metadata reader::impl::read(size_t range_offset,
     num_records = 0;
   }
 
+  configure_columns();
+
+  // Return empty table rather than exception if nothing to load
+  if (num_active_cols == 0) {
+    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+  }
+
+  std::vector<data_type> column_types = gather_column_types(stream);
+  for (int col = 0; col < num_actual_cols; ++col) {
+    if (h_column_flags[col] & column_parse::enabled) {
+      metadata.column_names.emplace_back(col_names[col]);
+    }
+  }
+
+  out_columns = decode_columns(column_types, stream);
+  return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+}
+
+table_with_metadata reader::impl::read_chunked(cudaStream_t stream)
+{
+  auto const total_size  = source_->size();
+  auto const num_columns = std::max(args_.names.size(), args_.dtype.size());
+  // Each piece includes enough data past the chunk size to complete its last row
+  auto const window_size = args_.chunk_size + calculateMaxRowSize(num_columns);
+  auto read_window       = [&](size_t offset) {
+    auto const size = std::min(window_size, total_size - offset);
+    return std::move(source_->host_read_async({{offset, size}}).front());
+  };
+
+  table_metadata metadata;
+  std::vector<data_type> column_types;
+  std::vector<std::unique_ptr<table>> pieces;
+  auto next_window = read_window(0);
+  for (size_t offset = 0; offset < total_size;) {
+    auto const buffer    = next_window.get();
+    auto const h_data    = reinterpret_cast<const char *>(buffer->data());
+    auto const h_size    = buffer->size();
+    auto const is_first  = (offset == 0);
+    auto const is_last   = (offset + h_size == total_size);
+    auto const range_end = is_last ? h_size : args_.chunk_size;
+
+    auto const data_start =
+      gather_row_offsets(h_data,
+                         h_size,
+                         0,
+                         range_end,
+                         0,
+                         (is_first && args_.header >= 0) ? args_.header + 1 : 0,
+                         -1,
+                         is_last,
+                         stream);
+
+    // The last offset is the start of the next piece
+    auto next_offset = total_size;
+    if (!is_last) {
+      CUDF_EXPECTS(row_offsets.size() != 0, "CSV row larger than the chunk size");
+      auto const next_row = data_start + static_cast<size_t>(row_offsets.back());
+      CUDF_EXPECTS(next_row >= range_end && next_row < h_size,
+                   "CSV row larger than the chunk size");
+      next_offset = offset + next_row;
+    }
+
+    num_records = row_offsets.size();
+    num_records -= (num_records > 0);
+
+    if (is_first) {
+      configure_columns();
+      if (num_active_cols == 0) {
+        return {std::make_unique<table>(std::vector<std::unique_ptr<column>>{}),
+                std::move(metadata)};
+      }
+
+      column_types = gather_column_types(stream);
+      for (int col = 0; col < num_actual_cols; ++col) {
+        if (h_column_flags[col] & column_parse::enabled) {
+          metadata.column_names.emplace_back(col_names[col]);
+        }
+      }
+    }
+
+    // Read the next piece while this one is decoded
+    if (next_offset < total_size) { next_window = read_window(next_offset); }
+    if (num_records != 0 || pieces.empty()) {
+      pieces.emplace_back(std::make_unique<table>(decode_columns(column_types, stream)));
+    }
+    offset = next_offset;
+  }
+
+  if (pieces.size() == 1) { return {std::move(pieces.front()), std::move(metadata)}; }
+  std::vector<table_view> views;
+  views.reserve(pieces.size());
+  for (auto const &piece : pieces) { views.push_back(piece->view()); }
+  return {cudf::concatenate(views, mr_), std::move(metadata)};
+}
+
+void reader::impl::configure_columns()
+{
   // Check if the user gave us a list of column names
   if (not args_.names.empty()) {
     h_column_flags.resize(args_.names.size(), column_parse::enabled);
@@ -330,32 +461,22 @@ table_with_metadata reader::impl::read(size_t range_offset,
       }
     }
   }
+}
 
-  // Return empty table rather than exception if nothing to load
-  if (num_active_cols == 0) {
-    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
-  }
-
-  std::vector<data_type> column_types = gather_column_types(stream);
+std::vector<std::unique_ptr<column>> reader::impl::decode_columns(
+  std::vector<data_type> &column_types, cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<column>> out_columns;
 
   // Alloc output; columns' data memory is still expected for empty dataframe
   std::vector<column_buffer> out_buffers;
   out_buffers.reserve(column_types.size());
-  for (int col = 0, active_col = 0; col < num_actual_cols; ++col) {
-    if (h_column_flags[col] & column_parse::enabled) {
-      // Replace EMPTY dtype with STRING
-      if (column_types[active_col].id() == type_id::EMPTY) {
-        column_types[active_col] = data_type{type_id::STRING};
-      }
-      const bool is_final_allocation = column_types[active_col].id() != type_id::STRING;
-      out_buffers.emplace_back(column_types[active_col],
-                               num_records,
-                               true,
-                               stream,
-                               is_final_allocation ? mr_ : rmm::mr::get_default_resource());
-      metadata.column_names.emplace_back(col_names[col]);
-      active_col++;
-    }
+  for (auto &type : column_types) {
+    // Replace EMPTY dtype with STRING
+    if (type.id() == type_id::EMPTY) { type = data_type{type_id::STRING}; }
+    const bool is_final_allocation = type.id() != type_id::STRING;
+    out_buffers.emplace_back(
+      type, num_records, true, stream, is_final_allocation ? mr_ : rmm::mr::get_default_resource());
   }
 
   out_columns.reserve(column_types.size());
@@ -384,7 +505,7 @@ table_with_metadata reader::impl::read(size_t range_offset,
       out_columns.emplace_back(make_empty_column(column_types[i]));
     }
   }
-  return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+  return out_columns;
 }
 
 size_t reader::impl::find_first_row_start(const char *h_data, size_t h_size)
@@ -396,24 +517,25 @@ size_t reader::impl::find_first_row_start(const char *h_data, size_t h_size)
   return std::min(pos + 1, h_size);
 }
 
-void reader::impl::gather_row_offsets(const char *h_data,
-                                      size_t h_size,
-                                      size_t range_begin,
-                                      size_t range_end,
-                                      size_t skip_rows,
-                                      int64_t num_rows,
-                                      bool load_whole_file,
-                                      cudaStream_t stream)
+size_t reader::impl::gather_row_offsets(const char *h_data,
+                                        size_t h_size,
+                                        size_t range_begin,
+                                        size_t range_end,
+                                        size_t skip_rows,
+                                        size_t header_rows,
+                                        int64_t num_rows,
+                                        bool load_whole_file,
+                                        cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("csv::gather_row_offsets", h_size);
   constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
   size_t buffer_size               = std::min(max_chunk_bytes, h_size);
   size_t max_blocks =
     std::max<size_t>((buffer_size / cudf::io::csv::gpu::rowofs_block_bytes) + 1, 2);
-  hostdevice_vector<uint64_t> row_ctx(max_blocks);
-  size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), h_size);
-  size_t pos         = std::min(range_begin, h_size);
-  size_t header_rows = (args_.header >= 0) ? args_.header + 1 : 0;
-  uint64_t ctx       = 0;
+  rmm::device_vector<uint64_t> row_ctx(max_blocks);
+  size_t buffer_pos = std::min(range_begin - std::min(range_begin, sizeof(char)), h_size);
+  size_t pos        = std::min(range_begin, h_size);
+  uint64_t ctx      = 0;
 
   // For compatibility with the previous parser, a row is considered in-range if the
   // previous row terminator is within the given range
@@ -421,15 +543,21 @@ void reader::impl::gather_row_offsets(const char *h_data,
   data_.resize(0);
   row_offsets.resize(0);
   data_.reserve((load_whole_file) ? h_size : std::min(buffer_size * 2, h_size));
+  // Copies of the input go through pinned staging buffers
+  device_read_pipeline upload_pipeline(stream);
   do {
     size_t target_pos = std::min(pos + max_chunk_bytes, h_size);
     size_t chunk_size = target_pos - pos;
 
-    data_.insert(data_.end(), h_data + buffer_pos + data_.size(), h_data + target_pos);
+    auto const uploaded_size = data_.size();
+    data_.resize(target_pos - buffer_pos);
+    upload_pipeline.upload(reinterpret_cast<uint8_t const *>(h_data) + buffer_pos + uploaded_size,
+                           data_.size() - uploaded_size,
+                           reinterpret_cast<uint8_t *>(data_.data().get()) + uploaded_size);
 
     // Pass 1: Count the potential number of rows in each character block for each
     // possible parser state at the beginning of the block.
-    uint32_t num_blocks = cudf::io::csv::gpu::gather_row_offsets(row_ctx.device_ptr(),
+    uint32_t num_blocks = cudf::io::csv::gpu::gather_row_offsets(row_ctx.data().get(),
                                                                  nullptr,
                                                                  data_.data().get(),
                                                                  chunk_size,
@@ -442,32 +570,17 @@ void reader::impl::gather_row_offsets(const char *h_data,
                                                                  0,
                                                                  opts,
                                                                  stream);
-    CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
-                             row_ctx.device_ptr(),
-                             num_blocks * sizeof(uint64_t),
-                             cudaMemcpyDeviceToHost,
-                             stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
     // Sum up the rows in each character block, selecting the row count that
     // corresponds to the current input context. Also stores the now known input
     // context per character block that will be needed by the second pass.
-    for (uint32_t i = 0; i < num_blocks; i++) {
-      uint64_t ctx_next = cudf::io::csv::gpu::select_row_context(ctx, row_ctx[i]);
-      row_ctx[i]        = ctx;
-      ctx               = ctx_next;
-    }
+    ctx = cudf::io::csv::gpu::select_row_contexts(row_ctx.data().get(), num_blocks, ctx, stream);
     size_t total_rows = ctx >> 2;
     if (total_rows > skip_rows) {
       // At least one row in range in this batch
       size_t num_row_offsets = total_rows - skip_rows;
       row_offsets.resize(num_row_offsets);
-      CUDA_TRY(cudaMemcpyAsync(row_ctx.device_ptr(),
-                               row_ctx.host_ptr(),
-                               num_blocks * sizeof(uint64_t),
-                               cudaMemcpyHostToDevice,
-                               stream));
       // Pass 2: Output row offsets
-      cudf::io::csv::gpu::gather_row_offsets(row_ctx.device_ptr(),
+      cudf::io::csv::gpu::gather_row_offsets(row_ctx.data().get(),
                                              row_offsets.data().get(),
                                              data_.data().get(),
                                              chunk_size,
@@ -482,14 +595,10 @@ void reader::impl::gather_row_offsets(const char *h_data,
                                              stream);
       // With byte range, we want to keep only one row out of the specified range
       if (range_end < h_size) {
-        CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
-                                 row_ctx.device_ptr(),
-                                 num_blocks * sizeof(uint64_t),
-                                 cudaMemcpyDeviceToHost,
-                                 stream));
-        CUDA_TRY(cudaStreamSynchronize(stream));
-        size_t rows_out_of_range = 0;
-        for (uint32_t i = 0; i < num_blocks; i++) { rows_out_of_range += row_ctx[i]; }
+        size_t const rows_out_of_range = thrust::reduce(rmm::exec_policy(stream)->on(stream),
+                                                        row_ctx.begin(),
+                                                        row_ctx.begin() + num_blocks,
+                                                        uint64_t{0});
         if (rows_out_of_range != 0) {
           // Keep one row out of range (used to infer length of previous row)
           num_row_offsets -= std::min(rows_out_of_range - 1, num_row_offsets);
@@ -520,6 +629,36 @@ void reader::impl::gather_row_offsets(const char *h_data,
     pos = target_pos;
   } while (pos < h_size);
 
+  finalize_row_offsets(h_data, h_size, buffer_pos, header_rows, num_rows, stream);
+
+  return buffer_pos;
+}
+
+void reader::impl::set_row_offsets_from_records(const char *h_data,
+                                                size_t h_size,
+                                                std::vector<size_t> const &record_offsets,
+                                                size_t header_rows,
+                                                cudaStream_t stream)
+{
+  CUDF_EXPECTS(record_offsets.back() < h_size, "Record offset out of the source");
+  data_.resize(h_size);
+  CUDA_TRY(cudaMemcpyAsync(data_.data().get(), h_data, h_size, cudaMemcpyHostToDevice, stream));
+
+  // The end of the data closes the last row
+  std::vector<uint64_t> h_row_offsets(record_offsets.begin(), record_offsets.end());
+  h_row_offsets.push_back(h_size);
+  row_offsets = h_row_offsets;
+
+  finalize_row_offsets(h_data, h_size, 0, header_rows, -1, stream);
+}
+
+void reader::impl::finalize_row_offsets(const char *h_data,
+                                        size_t h_size,
+                                        size_t buffer_pos,
+                                        size_t header_rows,
+                                        int64_t num_rows,
+                                        cudaStream_t stream)
+{
   // Eliminate blank rows
   if (row_offsets.size() != 0) {
     cudf::io::csv::gpu::remove_blank_rows(row_offsets, data_, opts, stream);
@@ -527,14 +666,15 @@ void reader::impl::gather_row_offsets(const char *h_data,
   // Remove header rows and extract header
   const size_t header_row_index = std::max<size_t>(header_rows, 1) - 1;
   if (header_row_index + 1 < row_offsets.size()) {
-    CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
+    uint64_t header_offsets[2];
+    CUDA_TRY(cudaMemcpyAsync(header_offsets,
                              row_offsets.data().get() + header_row_index,
                              2 * sizeof(uint64_t),
                              cudaMemcpyDeviceToHost,
                              stream));
     CUDA_TRY(cudaStreamSynchronize(stream));
-    const auto header_start = buffer_pos + row_ctx[0];
-    const auto header_end   = buffer_pos + row_ctx[1];
+    const auto header_start = buffer_pos + header_offsets[0];
+    const auto header_end   = buffer_pos + header_offsets[1];
     CUDF_EXPECTS(header_start <= header_end && header_end <= h_size, "Invalid csv header location");
     header.assign(h_data + header_start, h_data + header_end);
     if (header_rows > 0) {
@@ -547,6 +687,7 @@ void reader::impl::gather_row_offsets(const char *h_data,
 
 std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("csv::gather_column_types", data_.size());
   std::vector<data_type> dtypes;
 
   if (args_.dtype.empty()) {
@@ -667,6 +808,7 @@ void reader::impl::decode_data(const std::vector<data_type> &column_types,
                                std::vector<column_buffer> &out_buffers,
                                cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("csv::decode_data", data_.size());
   thrust::host_vector<void *> h_data(num_active_cols);
   thrust::host_vector<bitmask_type *> h_valid(num_active_cols);
 
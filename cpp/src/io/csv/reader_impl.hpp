@@ -113,18 +113,56 @@ class reader::impl {
    * @param range_begin Only include rows starting after this position
    * @param range_end Only include rows starting before this position
    * @param skip_rows Number of rows to skip from the start
+   * @param header_rows Number of rows after the skipped ones that end with the header row
    * @param num_rows Number of rows to read; -1: all remaining data
    * @param load_whole_file Hint that the entire data will be needed on gpu
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Position of the device data (and of the row offsets origin) within the input data
    */
-  void gather_row_offsets(const char *h_data,
-                          size_t h_size,
-                          size_t range_begin,
-                          size_t range_end,
-                          size_t skip_rows,
-                          int64_t num_rows,
-                          bool load_whole_file,
-                          cudaStream_t stream);
+  size_t gather_row_offsets(const char *h_data,
+                            size_t h_size,
+                            size_t range_begin,
+                            size_t range_end,
+                            size_t skip_rows,
+                            size_t header_rows,
+                            int64_t num_rows,
+                            bool load_whole_file,
+                            cudaStream_t stream);
+
+  /**
+   * @brief Uploads the whole input data and uses the record offsets known by the source as the
+   * row offsets, without scanning the data for row terminators.
+   *
+   * @param h_data Uncompressed input data in host memory
+   * @param h_size Number of bytes of uncompressed input data
+   * @param record_offsets Offset of the first byte of each record, in ascending order
+   * @param header_rows Number of rows that end with the header row
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void set_row_offsets_from_records(const char *h_data,
+                                    size_t h_size,
+                                    std::vector<size_t> const &record_offsets,
+                                    size_t header_rows,
+                                    cudaStream_t stream);
+
+  /**
+   * @brief Removes the blank rows, extracts the header and applies the row limit, once the row
+   * offsets are gathered.
+   *
+   * @param h_data Uncompressed input data in host memory
+   * @param h_size Number of bytes of uncompressed input data
+   * @param buffer_pos Position of the device data within the input data
+   * @param header_rows Number of rows that end with the header row
+   * @param num_rows Number of rows to read; -1: all remaining data
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void finalize_row_offsets(const char *h_data,
+                            size_t h_size,
+                            size_t buffer_pos,
+                            size_t header_rows,
+                            int64_t num_rows,
+                            cudaStream_t stream);
 
   /**
    * @brief Find the start position of the first data row
@@ -136,6 +174,25 @@ class reader::impl {
    */
   size_t find_first_row_start(const char *h_data, size_t h_size);
 
+  /**
+   * @brief Parses a large source in fixed-size pieces and concatenates the resulting columns.
+   *
+   * Each piece ends at the first row that starts past `chunk_size` bytes into it; the column
+   * names, selection and types are determined from the first piece and reused for the others.
+   * The host read of the next piece overlaps the decoding of the current one.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunked(cudaStream_t stream);
+
+  /**
+   * @brief Sets the names of the columns and selects the ones to parse, from the reader options
+   * and the header.
+   */
+  void configure_columns();
+
   /**
    * @brief Returns a detected or parsed list of column dtypes.
    *
@@ -156,6 +213,17 @@ class reader::impl {
                    std::vector<column_buffer> &out_buffers,
                    cudaStream_t stream);
 
+  /**
+   * @brief Decodes the gathered rows into output columns.
+   *
+   * @param column_types Column types; columns of unknown type are read as strings
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The decoded columns
+   */
+  std::vector<std::unique_ptr<column>> decode_columns(std::vector<data_type> &column_types,
+                                                      cudaStream_t stream);
+
  private:
   rmm::mr::device_memory_resource *mr_ = nullptr;
   std::unique_ptr<datasource> source_;
@@ -22,7 +22,9 @@
 #include "writer_impl.hpp"
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_device_view.cuh>
 
 #include <cudf/utilities/traits.hpp>
 
@@ -31,7 +33,6 @@
 #include <cudf/strings/convert/convert_floats.hpp>
 #include <cudf/strings/convert/convert_integers.hpp>
 
-#include <cudf/strings/combine.hpp>
 #include <cudf/strings/replace.hpp>
 
 #include <strings/utilities.cuh>
@@ -45,6 +46,8 @@
 
 #include <thrust/count.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/scan.h>
@@ -200,6 +203,72 @@ struct modify_special_chars {
   predicate_special_chars predicate_;
 };
 
+// computes the number of bytes of each formatted CSV row:
+// the cells (or `na_rep` for nulls), the delimiters between them, and the row terminator;
+//
+struct row_size_fn {
+  row_size_fn(table_device_view const d_table, string_view const na_rep, size_type terminator_size)
+    : d_table_(d_table), na_rep_(na_rep), terminator_size_(terminator_size)
+  {
+  }
+
+  __device__ size_t operator()(size_type row) const
+  {
+    size_t row_size = (d_table_.num_columns() - 1) + terminator_size_;  // delimiters + terminator
+    for (auto const& d_column : d_table_) {
+      row_size += d_column.is_null(row) ? na_rep_.size_bytes()
+                                        : d_column.element<string_view>(row).size_bytes();
+    }
+    return row_size;
+  }
+
+ private:
+  table_device_view const d_table_;
+  string_view const na_rep_;
+  size_type const terminator_size_;
+};
+
+// writes each formatted CSV row at its offset in the output buffer;
+//
+struct write_row_fn {
+  write_row_fn(table_device_view const d_table,
+               size_t const* d_offsets,
+               char* d_chars,
+               char delimiter,
+               string_view const na_rep,
+               string_view const terminator)
+    : d_table_(d_table),
+      d_offsets_(d_offsets),
+      d_chars_(d_chars),
+      delimiter_(delimiter),
+      na_rep_(na_rep),
+      terminator_(terminator)
+  {
+  }
+
+  __device__ void operator()(size_type row) const
+  {
+    using namespace cudf::strings::detail;
+
+    char* d_buffer = d_chars_ + d_offsets_[row];
+    for (size_type col = 0; col < d_table_.num_columns(); ++col) {
+      auto const& d_column = d_table_.column(col);
+      if (col > 0) { *d_buffer++ = delimiter_; }
+      d_buffer = copy_string(d_buffer,
+                             d_column.is_null(row) ? na_rep_ : d_column.element<string_view>(row));
+    }
+    copy_string(d_buffer, terminator_);
+  }
+
+ private:
+  table_device_view const d_table_;
+  size_t const* d_offsets_;
+  char* d_chars_;
+  char const delimiter_;
+  string_view const na_rep_;
+  string_view const terminator_;
+};
+
 struct column_to_strings_fn {
   // compile-time predicate that defines unsupported column types;
   // based on the conditions used for instantiations of individual
@@ -226,7 +295,7 @@ struct column_to_strings_fn {
   {
   }
 
-  // Note: `null` replacement with `na_rep` deferred to `concatenate()`
+  // Note: `null` replacement with `na_rep` deferred to the row formatting in `write_chunked()`
   // instead of column-wise; might be faster
   //
   // Note: Cannot pass `stream` to detail::<fname> version of <fname> calls below, because they are
@@ -385,38 +454,63 @@ void writer::impl::write_chunked_begin(table_view const& table,
   }
 }
 
-void writer::impl::write_chunked(strings_column_view const& str_column_view,
+void writer::impl::write_chunked(table_view const& str_table_view,
                                  const table_metadata* metadata,
                                  cudaStream_t stream)
 {
   // algorithm outline:
   //
-  //  for_each(strings_column.begin(), strings_column.end(),
-  //           [sink = out_sink_](auto str_row) mutable {
-  //               auto host_buffer = str_row.host_buffer();
-  //               sink->host_write(host_buffer_.data(), host_buffer_.size());
-  //           });//or...sink->device_write(device_buffer,...);
+  //  row_sizes = transform(rows, sum(cell sizes) + delimiters + line_terminator);
+  //  offsets   = exclusive_scan(row_sizes);
+  //  for_each(rows, write cells, delimiters and line_terminator at offsets[row]);
   //
-  // added line_terminator functionality
+  // so that the whole chunk is formatted into one contiguous device buffer,
+  // which is then handed to the sink in a single write;
   //
-
-  CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
-
-  cudf::string_scalar newline{options_.line_terminator()};
-  auto p_str_col_w_nl = cudf::strings::join_strings(str_column_view, newline);
-  strings_column_view strings_column{std::move(p_str_col_w_nl->view())};
-
-  auto total_num_bytes      = strings_column.chars_size();
-  char const* ptr_all_bytes = strings_column.chars().data<char>();
-
+  CUDF_EXPECTS(str_table_view.num_rows() > 0, "Unexpected empty table.");
+
+  auto const num_rows = str_table_view.num_rows();
+  CUDF_SCOPED_RANGE_PAYLOAD("csv::format_rows", num_rows);
+  auto exec = rmm::exec_policy(stream);
+  auto d_table        = table_device_view::create(str_table_view, stream);
+
+  cudf::string_scalar na_rep{options_.na_rep(), true, stream};
+  cudf::string_scalar newline{options_.line_terminator(), true, stream};
+
+  rmm::device_vector<size_t> offsets(num_rows + 1, 0);
+  thrust::transform(exec->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    offsets.begin(),
+                    row_size_fn{*d_table, na_rep.value(stream), newline.size()});
+  thrust::exclusive_scan(exec->on(stream), offsets.begin(), offsets.end(), offsets.begin());
+
+  size_t total_num_bytes = 0;
+  CUDA_TRY(cudaMemcpyAsync(&total_num_bytes,
+                           offsets.data().get() + num_rows,
+                           sizeof(size_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  rmm::device_buffer chars(total_num_bytes, stream, mr_);
+  auto ptr_all_bytes = static_cast<char*>(chars.data());
+  thrust::for_each_n(exec->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     write_row_fn{*d_table,
+                                  offsets.data().get(),
+                                  ptr_all_bytes,
+                                  options_.inter_column_delimiter(),
+                                  na_rep.value(stream),
+                                  newline.value(stream)});
+
+  CUDF_SCOPED_RANGE_PAYLOAD("csv::write_sink", total_num_bytes);
   if (out_sink_->supports_device_write()) {
     // host algorithm call, but the underlying call
     // is a device_write taking a device buffer;
     //
     out_sink_->device_write(ptr_all_bytes, total_num_bytes, stream);
-    out_sink_->device_write(newline.data(),
-                            newline.size(),
-                            stream);  // needs newline at the end, to separate from next chunk
   } else {
     // no device write possible;
     //
@@ -434,11 +528,7 @@ void writer::impl::write_chunked(strings_column_view const& str_column_view,
     // host algorithm call, where the underlying call
     // is also host_write taking a host buffer;
     //
-    char const* ptr_h_bytes = h_bytes.data();
-    out_sink_->host_write(ptr_h_bytes, total_num_bytes);
-    out_sink_->host_write(
-      options_.line_terminator().data(),
-      options_.line_terminator().size());  // needs newline at the end, to separate from next chunk
+    out_sink_->host_write(h_bytes.data(), total_num_bytes);
   }
 }
 
@@ -505,26 +595,25 @@ void writer::impl::write(table_view const& table,
 
       // populate vector of string-converted columns:
       //
-      std::transform(sub_view.begin(),
-                     sub_view.end(),
-                     std::back_inserter(str_column_vec),
-                     [converter](auto const& current_col) {
-                       return cudf::type_dispatcher(current_col.type(), converter, current_col);
-                     });
+      {
+        CUDF_SCOPED_RANGE_PAYLOAD("csv::convert_to_strings", sub_view.num_rows());
+        std::transform(sub_view.begin(),
+                       sub_view.end(),
+                       std::back_inserter(str_column_vec),
+                       [converter](auto const& current_col) {
+                         return cudf::type_dispatcher(current_col.type(), converter, current_col);
+                       });
+      }
 
       // create string table view from str_column_vec:
       //
       auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
       auto str_table_view = str_table_ptr->view();
 
-      // concatenate columns in each row into one big string column
-      //(using null representation and delimiter):
+      // format the rows of the chunk into one buffer
+      //(using null representation, delimiter and line terminator):
       //
-      std::string delimiter_str{options_.inter_column_delimiter()};
-      auto str_concat_col =
-        cudf::strings::concatenate(str_table_view, delimiter_str, options_.na_rep(), mr_);
-
-      write_chunked(str_concat_col->view(), metadata, stream);
+      write_chunked(str_table_view, metadata, stream);
     }
   }
 
@@ -86,11 +86,13 @@ class writer::impl {
   /**
    * @brief Write dataset to CSV format without header.
    *
-   * @param strings_column Subset of columns converted to string to be written.
+   * Formats the rows into a single device buffer that is passed to the sink as one write.
+   *
+   * @param str_table_view Subset of rows, with each column converted to strings.
    * @param metadata The metadata associated with the table
    * @param stream CUDA stream used for device memory operations and kernel launches.
    **/
-  void write_chunked(strings_column_view const& strings_column,
+  void write_chunked(table_view const& str_table_view,
                      const table_metadata* metadata = nullptr,
                      cudaStream_t stream            = nullptr);
 
@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 
+#include <cudf/detail/memory_estimate.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/io/readers.hpp>
 #include <cudf/io/writers.hpp>
@@ -23,6 +25,11 @@
 
 #include "orc/chunked_state.hpp"
 #include "parquet/chunked_state.hpp"
+#include "utilities/metadata_cache.hpp"
+#include "utilities/null_options.hpp"
+#include "utilities/pinned_memory_pool.hpp"
+
+#include <fstream>
 
 namespace cudf {
 namespace io {
@@ -48,30 +55,61 @@ std::unique_ptr<reader> make_reader(source_info const& src_info,
   return std::make_unique<reader>(std::move(datasources), options, mr);
 }
 
+std::unique_ptr<data_sink> make_sink(sink_info const& sink)
+{
+  if (sink.type == io_type::FILEPATH) { return cudf::io::data_sink::create(sink.filepath); }
+  if (sink.type == io_type::HOST_BUFFER) { return cudf::io::data_sink::create(sink.buffer); }
+  if (sink.type == io_type::VOID) { return cudf::io::data_sink::create(); }
+  if (sink.type == io_type::USER_IMPLEMENTED) {
+    return cudf::io::data_sink::create(sink.user_sink);
+  }
+  CUDF_FAIL("Unsupported sink type");
+}
+
 template <typename writer, typename writer_options>
 std::unique_ptr<writer> make_writer(sink_info const& sink,
                                     writer_options const& options,
                                     rmm::mr::device_memory_resource* mr)
 {
-  if (sink.type == io_type::FILEPATH) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(sink.filepath), options, mr);
-  }
-  if (sink.type == io_type::HOST_BUFFER) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(sink.buffer), options, mr);
-  }
-  if (sink.type == io_type::VOID) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(), options, mr);
-  }
-  if (sink.type == io_type::USER_IMPLEMENTED) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(sink.user_sink), options, mr);
+  return std::make_unique<writer>(make_sink(sink), options, mr);
+}
+
+/**
+ * @brief Returns the total size of the sources in bytes
+ */
+size_t source_size(source_info const& src_info)
+{
+  size_t size = 0;
+  for (auto const& path : src_info.filepaths) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (file.good()) { size += static_cast<size_t>(file.tellg()); }
   }
-  CUDF_FAIL("Unsupported sink type");
+  for (auto const& buffer : src_info.buffers) { size += buffer.size; }
+  for (auto const source : src_info.user_sources) { size += source->size(); }
+  return size;
+}
+
+/**
+ * @brief Adds the metrics of a reader returning `output`, read from `src_info`
+ */
+void add_read_metrics(cudf::detail::operation_metrics_scope& metrics,
+                      source_info const& src_info,
+                      table_view const& output,
+                      cudaStream_t stream)
+{
+  if (not metrics.enabled()) { return; }
+  metrics.add("source_bytes", source_size(src_info));
+  metrics.add("rows_out", output.num_rows());
+  metrics.add("columns_out", output.num_columns());
+  metrics.add("bytes_out", cudf::detail::copy_size(output, stream));
 }
 
 }  // namespace
 
 // Freeform API wraps the detail reader class API
-table_with_metadata read_avro(read_avro_args const& args, rmm::mr::device_memory_resource* mr)
+table_with_metadata read_avro(read_avro_args const& args,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
 {
   namespace avro = cudf::io::detail::avro;
 
@@ -80,14 +118,16 @@ table_with_metadata read_avro(read_avro_args const& args, rmm::mr::device_memory
   auto reader = make_reader<avro::reader>(args.source, options, mr);
 
   if (args.skip_rows != -1 || args.num_rows != -1) {
-    return reader->read_rows(args.skip_rows, args.num_rows);
+    return reader->read_rows(args.skip_rows, args.num_rows, stream);
   } else {
-    return reader->read_all();
+    return reader->read_all(stream);
   }
 }
 
 // Freeform API wraps the detail reader class API
-table_with_metadata read_json(read_json_args const& args, rmm::mr::device_memory_resource* mr)
+table_with_metadata read_json(read_json_args const& args,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
 {
   namespace json = cudf::io::detail::json;
 
@@ -96,20 +136,24 @@ table_with_metadata read_json(read_json_args const& args, rmm::mr::device_memory
   auto reader = make_reader<json::reader>(args.source, options, mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
-    return reader->read_byte_range(args.byte_range_offset, args.byte_range_size);
+    return reader->read_byte_range(args.byte_range_offset, args.byte_range_size, stream);
   } else {
-    return reader->read_all();
+    return reader->read_all(stream);
   }
 }
 
 // Freeform API wraps the detail reader class API
-table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_resource* mr)
+table_with_metadata read_csv(read_csv_args const& args,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
 {
   namespace csv = cudf::io::detail::csv;
 
   CUDF_FUNC_RANGE();
+  cudf::detail::operation_metrics_scope metrics("read_csv", stream);
   csv::reader_options options{};
   options.compression        = args.compression;
+  options.chunk_size         = args.chunk_size;
   options.lineterminator     = args.lineterminator;
   options.delimiter          = args.delimiter;
   options.decimal            = args.decimal;
@@ -145,13 +189,18 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   options.timestamp_type   = args.timestamp_type;
   auto reader              = make_reader<csv::reader>(args.source, options, mr);
 
-  if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
-    return reader->read_byte_range(args.byte_range_offset, args.byte_range_size);
-  } else if (args.skiprows != -1 || args.skipfooter != -1 || args.nrows != -1) {
-    return reader->read_rows(args.skiprows, args.skipfooter, args.nrows);
-  } else {
-    return reader->read_all();
-  }
+  auto result = [&]() {
+    if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
+      return reader->read_byte_range(args.byte_range_offset, args.byte_range_size, stream);
+    } else if (args.skiprows != -1 || args.skipfooter != -1 || args.nrows != -1) {
+      return reader->read_rows(args.skiprows, args.skipfooter, args.nrows, stream);
+    } else {
+      return reader->read_all(stream);
+    }
+  }();
+  detail::apply_null_options(result, args.nans_to_nulls, args.null_fill_values, mr, stream);
+  add_read_metrics(metrics, args.source, result.tbl->view(), stream);
+  return result;
 }
 
 // Freeform API wraps the detail writer class API
@@ -164,36 +213,122 @@ void write_csv(write_csv_args const& args, rmm::mr::device_memory_resource* mr)
   writer->write_all(args.table(), args.metadata());
 }
 
+// Freeform API wraps the detail writer class API
+void write_json(write_json_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  using namespace cudf::io::detail;
+
+  auto writer = make_writer<json::writer>(args.sink(), args, mr);
+
+  writer->write_all(args.table(), args.metadata());
+}
+
 namespace detail_orc = cudf::io::detail::orc;
 
 // Freeform API wraps the detail reader class API
-table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_resource* mr)
+table_with_metadata read_orc(read_orc_args const& args,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
+  cudf::detail::operation_metrics_scope metrics("read_orc", stream);
   detail_orc::reader_options options{args.columns,
                                      args.use_index,
                                      args.use_np_dtypes,
                                      args.timestamp_type,
                                      args.decimals_as_float,
-                                     args.forced_decimals_scale};
+                                     args.forced_decimals_scale,
+                                     args.filters,
+                                     args.decimals_as_fixed_point,
+                                     args.strings_to_dictionary};
   auto reader = make_reader<detail_orc::reader>(args.source, options, mr);
 
-  if (args.stripe_list.size() > 0) {
-    return reader->read_stripes(args.stripe_list);
-  } else if (args.stripe != -1) {
-    return reader->read_stripe(args.stripe, std::max(args.stripe_count, 1));
-  } else if (args.skip_rows != -1 || args.num_rows != -1) {
-    return reader->read_rows(args.skip_rows, args.num_rows);
-  } else {
-    return reader->read_all();
-  }
+  auto result = [&]() {
+    if (args.stripe_list.size() > 0) {
+      return reader->read_stripes(args.stripe_list, stream);
+    } else if (args.stripe != -1) {
+      return reader->read_stripe(args.stripe, std::max(args.stripe_count, 1), stream);
+    } else if (args.skip_rows != -1 || args.num_rows != -1) {
+      return reader->read_rows(args.skip_rows, args.num_rows, stream);
+    } else {
+      return reader->read_all(stream);
+    }
+  }();
+  detail::apply_null_options(result, args.nans_to_nulls, args.null_fill_values, mr, stream);
+  add_read_metrics(metrics, args.source, result.tbl->view(), stream);
+  return result;
+}
+
+std::vector<column_statistics> read_orc_statistics(read_orc_args const& args,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_orc::reader_options options{args.columns,
+                                     args.use_index,
+                                     args.use_np_dtypes,
+                                     args.timestamp_type,
+                                     args.decimals_as_float,
+                                     args.forced_decimals_scale,
+                                     args.filters,
+                                     args.decimals_as_fixed_point,
+                                     args.strings_to_dictionary};
+  return make_reader<detail_orc::reader>(args.source, options, mr)->read_statistics();
+}
+
+/**
+ * @copydoc cudf::io::read_orc_chunked_begin
+ *
+ **/
+std::shared_ptr<detail_orc::orc_chunked_read_state> read_orc_chunked_begin(
+  read_orc_chunked_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(args.byte_limit > 0 || args.row_limit > 0,
+               "Chunked read requires a positive byte or row limit");
+  CUDF_EXPECTS(args.row_limit >= 0, "Chunked read requires a non-negative row limit");
+  detail_orc::reader_options options{args.columns,
+                                     args.use_index,
+                                     args.use_np_dtypes,
+                                     args.timestamp_type,
+                                     args.decimals_as_float,
+                                     args.forced_decimals_scale,
+                                     {},
+                                     args.decimals_as_fixed_point,
+                                     args.strings_to_dictionary};
+
+  auto state        = std::make_shared<detail_orc::orc_chunked_read_state>();
+  state->rp         = make_reader<detail_orc::reader>(args.source, options, mr);
+  state->row_ranges = state->rp->get_chunk_row_ranges(args.byte_limit, args.row_limit);
+  return state;
+}
+
+/**
+ * @copydoc cudf::io::read_orc_chunked_has_next
+ *
+ **/
+bool read_orc_chunked_has_next(std::shared_ptr<detail_orc::orc_chunked_read_state> state)
+{
+  return state->next_range < state->row_ranges.size();
+}
+
+/**
+ * @copydoc cudf::io::read_orc_chunked
+ *
+ **/
+table_with_metadata read_orc_chunked(std::shared_ptr<detail_orc::orc_chunked_read_state> state)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(read_orc_chunked_has_next(state), "No more chunks to read");
+  auto const& range = state->row_ranges[state->next_range++];
+  return state->rp->read_rows(range.first, range.second, state->stream);
 }
 
 // Freeform API wraps the detail writer class API
 void write_orc(write_orc_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  detail_orc::writer_options options{args.compression, args.enable_statistics};
+  detail_orc::writer_options options{
+    args.compression, args.enable_statistics, args.stripe_size, args.bloom_filter_fpp};
   auto writer = make_writer<detail_orc::writer>(args.sink, options, mr);
 
   writer->write_all(args.table, args.metadata);
@@ -207,7 +342,8 @@ std::shared_ptr<detail_orc::orc_chunked_state> write_orc_chunked_begin(
   write_orc_chunked_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  detail_orc::writer_options options{args.compression, args.enable_statistics};
+  detail_orc::writer_options options{
+    args.compression, args.enable_statistics, args.stripe_size, args.bloom_filter_fpp};
 
   auto state = std::make_shared<detail_orc::orc_chunked_state>();
   state->wp  = make_writer<detail_orc::writer>(args.sink, options, mr);
@@ -218,7 +354,8 @@ std::shared_ptr<detail_orc::orc_chunked_state> write_orc_chunked_begin(
     state->user_metadata_with_nullability = *args.metadata;
     state->user_metadata                  = &state->user_metadata_with_nullability;
   }
-  state->stream = 0;
+  state->stream          = 0;
+  state->coalesce_chunks = args.coalesce_chunks;
   state->wp->write_chunked_begin(*state);
   return state;
 }
@@ -249,20 +386,112 @@ using namespace cudf::io::detail::parquet;
 namespace detail_parquet = cudf::io::detail::parquet;
 
 // Freeform API wraps the detail reader class API
-table_with_metadata read_parquet(read_parquet_args const& args, rmm::mr::device_memory_resource* mr)
+table_with_metadata read_parquet(read_parquet_args const& args,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  detail_parquet::reader_options options{
-    args.columns, args.strings_to_categorical, args.use_pandas_metadata, args.timestamp_type};
+  cudf::detail::operation_metrics_scope metrics("read_parquet", stream);
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         args.filters,
+                                         args.strings_to_dictionary,
+                                         args.decimals_as_fixed_point,
+                                         args.scratch_mr};
   auto reader = make_reader<detail_parquet::reader>(args.source, options, mr);
 
-  if (args.row_groups.size() > 0) {
-    return reader->read_row_groups(args.row_groups);
-  } else if (args.skip_rows != -1 || args.num_rows != -1) {
-    return reader->read_rows(args.skip_rows, args.num_rows);
-  } else {
-    return reader->read_all();
+  auto result = [&]() {
+    if (args.row_groups.size() > 0) {
+      return reader->read_row_groups(args.row_groups, stream);
+    } else if (args.skip_rows != -1 || args.num_rows != -1) {
+      return reader->read_rows(args.skip_rows, args.num_rows, stream);
+    } else {
+      return reader->read_all(stream);
+    }
+  }();
+  detail::apply_null_options(result, args.nans_to_nulls, args.null_fill_values, mr, stream);
+  add_read_metrics(metrics, args.source, result.tbl->view(), stream);
+  return result;
+}
+
+memory_estimate estimate_read_parquet_memory(read_parquet_args const& args)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         args.filters,
+                                         args.strings_to_dictionary};
+  return make_reader<detail_parquet::reader>(args.source, options, rmm::mr::get_default_resource())
+    ->estimate_read_memory();
+}
+
+std::vector<column_statistics> read_parquet_statistics(read_parquet_args const& args,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         args.filters,
+                                         args.strings_to_dictionary,
+                                         args.decimals_as_fixed_point};
+  return make_reader<detail_parquet::reader>(args.source, options, mr)->read_statistics();
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_chunked_begin
+ *
+ **/
+std::shared_ptr<pq_chunked_read_state> read_parquet_chunked_begin(
+  read_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(args.byte_limit > 0 || args.row_limit > 0,
+               "Chunked read requires a positive byte or row limit");
+  CUDF_EXPECTS(args.row_limit >= 0, "Chunked read requires a non-negative row limit");
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         {},
+                                         args.strings_to_dictionary,
+                                         false,
+                                         args.scratch_mr};
+
+  auto state        = std::make_shared<pq_chunked_read_state>();
+  state->rp         = make_reader<detail_parquet::reader>(args.source, options, mr);
+  state->row_ranges = state->rp->get_chunk_row_ranges(args.byte_limit, args.row_limit);
+  return state;
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_chunked_has_next
+ *
+ **/
+bool read_parquet_chunked_has_next(std::shared_ptr<pq_chunked_read_state> state)
+{
+  return state->next_range < state->row_ranges.size();
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_chunked
+ *
+ **/
+table_with_metadata read_parquet_chunked(std::shared_ptr<pq_chunked_read_state> state)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(read_parquet_chunked_has_next(state), "No more chunks to read");
+  auto const& range = state->row_ranges[state->next_range++];
+  if (state->next_range == state->row_ranges.size()) {
+    // Last piece: no need to keep the scratch memory around
+    return state->rp->read_rows(range.first, range.second, state->stream);
   }
+  return state->rp->read_chunk(range.first, range.second, state->stream);
 }
 
 // Freeform API wraps the detail writer class API
@@ -270,7 +499,13 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet(write_parquet_args const& ar
                                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  detail_parquet::writer_options options{args.compression, args.stats_level};
+  detail_parquet::writer_options options{args.compression,
+                                         args.stats_level,
+                                         args.max_dictionary_size,
+                                         args.row_group_size,
+                                         args.page_size,
+                                         args.delta_encodings,
+                                         args.bloom_filter_fpp};
   auto writer = make_writer<detail_parquet::writer>(args.sink, options, mr);
 
   return writer->write_all(
@@ -288,6 +523,31 @@ std::unique_ptr<std::vector<uint8_t>> merge_rowgroup_metadata(
   return detail_parquet::writer::merge_rowgroup_metadata(metadata_list);
 }
 
+// Freeform API wraps the detail writer class API
+std::unique_ptr<table> write_parquet_partitioned(write_parquet_partitioned_args const& args,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::writer_options options{args.compression,
+                                         args.stats_level,
+                                         args.max_dictionary_size,
+                                         args.row_group_size,
+                                         args.page_size,
+                                         args.delta_encodings,
+                                         args.bloom_filter_fpp};
+  // Each partition is written to its own sink
+  detail_parquet::writer writer(cudf::io::data_sink::create(), options, mr);
+
+  auto const& factory = args.sink_factory;
+  return writer.write_partitioned(
+    args.table,
+    args.partition_columns,
+    [&factory](table_view const& keys, size_type partition) {
+      return make_sink(factory(keys, partition));
+    },
+    args.metadata);
+}
+
 /**
  * @copydoc cudf::io::write_parquet_chunked_begin
  *
@@ -296,7 +556,13 @@ std::shared_ptr<pq_chunked_state> write_parquet_chunked_begin(
   write_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  detail_parquet::writer_options options{args.compression, args.stats_level};
+  detail_parquet::writer_options options{args.compression,
+                                         args.stats_level,
+                                         args.max_dictionary_size,
+                                         args.row_group_size,
+                                         args.page_size,
+                                         args.delta_encodings,
+                                         args.bloom_filter_fpp};
 
   auto state = std::make_shared<pq_chunked_state>();
   state->wp  = make_writer<detail_parquet::writer>(args.sink, options, mr);
@@ -337,5 +603,23 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet_chunked_end(
   return meta;
 }
 
+/**
+ * @copydoc cudf::io::set_metadata_cache_capacity
+ *
+ **/
+void set_metadata_cache_capacity(size_t capacity)
+{
+  detail::metadata_cache::get().set_capacity(capacity);
+}
+
+/**
+ * @copydoc cudf::io::set_pinned_memory_pool_capacity
+ *
+ **/
+void set_pinned_memory_pool_capacity(size_t capacity)
+{
+  detail::pinned_memory_pool::get().set_capacity(capacity);
+}
+
 }  // namespace io
 }  // namespace cudf
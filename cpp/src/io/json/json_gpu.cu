@@ -40,8 +40,6 @@ namespace json {
 namespace gpu {
 using namespace ::cudf;
 
-using string_pair = std::pair<const char *, size_t>;
-
 namespace {
 /**
  * @brief CUDA Kernel that adjusts the row range to exclude the character outside of the top level
@@ -448,6 +446,38 @@ __device__ __inline__ bool is_like_float(
   return true;
 }
 
+/**
+ * @brief Find the end of the value that starts at the beginning of the range.
+ *
+ * Unlike `seek_field_end`, delimiters inside nested arrays and objects do not end the value.
+ *
+ * @param[in] begin Pointer to the first character of the value
+ * @param[in] end pointer to the first character after the parsing range
+ * @param[in] opts The global parsing behavior options
+ *
+ * @return Pointer to the delimiter or terminator that follows the value; `end` if none is found
+ */
+__device__ char const *seek_value_end(char const *begin, char const *end, ParseOptions const &opts)
+{
+  bool quotation = false;
+  int depth      = 0;
+  auto current   = begin;
+  for (; current < end; ++current) {
+    if (*current == opts.quotechar && (current == begin || *(current - 1) != '\\')) {
+      quotation = !quotation;
+    } else if (!quotation) {
+      if (*current == '[' || *current == '{') {
+        ++depth;
+      } else if (*current == ']' || *current == '}') {
+        --depth;
+      } else if (depth == 0 && (*current == opts.delimiter || *current == opts.terminator)) {
+        break;
+      }
+    }
+  }
+  return current;
+}
+
 /**
  * @brief Contains information on a JSON file field.
  */
@@ -477,7 +507,7 @@ __device__ field_descriptor next_field_descriptor(const char *begin,
   auto const desc_pre_trim =
     col_map == nullptr
       // No key - column and begin are trivial
-      ? field_descriptor{field_idx, begin, cudf::io::gpu::seek_field_end(begin, end, opts)}
+      ? field_descriptor{field_idx, begin, seek_value_end(begin, end, opts)}
       : [&]() {
           auto const key_range = get_next_key(begin, end, opts.quotechar);
           auto const key_hash  = MurmurHash3_32<cudf::string_view>{}(
@@ -488,8 +518,7 @@ __device__ field_descriptor next_field_descriptor(const char *begin,
 
           // Skip the colon between the key and the value
           auto const value_begin = thrust::find(thrust::seq, key_range.second, end, ':') + 1;
-          return field_descriptor{
-            column, value_begin, cudf::io::gpu::seek_field_end(value_begin, end, opts)};
+          return field_descriptor{column, value_begin, seek_value_end(value_begin, end, opts)};
         }();
 
   // Modify start & end to ignore whitespace and quotechars
@@ -520,34 +549,68 @@ __device__ std::pair<char const *, char const *> get_row_data_range(
 }
 
 /**
- * @brief CUDA kernel that parses and converts plain text data into cuDF column data.
+ * @brief Decodes a single field and stores it in the given row of the output column.
+ *
+ * String, list and struct fields are stored as ranges in the input data; nested fields are
+ * tokenized further when their child columns are built.
+ *
+ * @param[in] begin Pointer to the first character of the (trimmed) field
+ * @param[in] end pointer to the first character after the field
+ * @param[in] dtype The data type of the output column
+ * @param[out] output_column The output column data
+ * @param[in] row The output row
+ * @param[in] opts A set of parsing options
+ *
+ * @return `true` if the field is valid, `false` otherwise
+ */
+__device__ bool decode_field(char const *begin,
+                             char const *end,
+                             data_type dtype,
+                             void *output_column,
+                             cudf::size_type row,
+                             ParseOptions const &opts)
+{
+  auto const value_len = end - begin;
+  // Empty fields are not legal values
+  auto const is_valid =
+    value_len > 0 && !serializedTrieContains(opts.naValuesTrie, begin, value_len);
+
+  // Type dispatcher does not handle strings and nested types
+  if (dtype.id() == type_id::STRING || dtype.id() == type_id::LIST ||
+      dtype.id() == type_id::STRUCT) {
+    static_cast<string_pair *>(output_column)[row] =
+      is_valid ? string_pair{begin, static_cast<size_t>(value_len)} : string_pair{nullptr, 0};
+    return is_valid;
+  }
+
+  return is_valid &&
+         cudf::type_dispatcher(dtype, ConvertFunctor{}, begin, end, output_column, row, opts);
+}
+
+/**
+ * @brief CUDA kernel that splits each record into its fields and stores the ranges of the values.
  *
- * Data is processed one record at a time
+ * Data is processed one record at a time. The ranges are stored in a column-major table, so that
+ * type inference and conversion can process the fields without parsing the records again.
  *
  * @param[in] data The entire data to read
  * @param[in] data_size Size of the data buffer, in bytes
  * @param[in] rec_starts The offset of each row in the input
  * @param[in] num_records The number of lines/rows
- * @param[in] dtypes The data type of each column
  * @param[in] opts A set of parsing options
  * @param[in] col_map Pointer to the (column name hash -> solumn index) map in device memory.
  * nullptr is passed when the input file does not consist of objects.
- * @param[out] output_columns The output column data
  * @param[in] num_columns The number of columns
- * @param[out] valid_fields The bitmaps indicating whether column fields are valid
- * @param[out] num_valid_fields The numbers of valid fields in columns
+ * @param[out] fields Ranges of the field values; null and missing fields are left unchanged
  */
-__global__ void convert_data_to_columns_kernel(const char *data,
-                                               size_t data_size,
-                                               const uint64_t *rec_starts,
-                                               cudf::size_type num_records,
-                                               const data_type *dtypes,
-                                               ParseOptions opts,
-                                               col_map_type *col_map,
-                                               void *const *output_columns,
-                                               cudf::size_type num_columns,
-                                               bitmask_type *const *valid_fields,
-                                               cudf::size_type *num_valid_fields)
+__global__ void tokenize_fields_kernel(const char *data,
+                                       size_t data_size,
+                                       const uint64_t *rec_starts,
+                                       cudf::size_type num_records,
+                                       ParseOptions opts,
+                                       col_map_type *col_map,
+                                       cudf::size_type num_columns,
+                                       string_pair *fields)
 {
   const auto rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
   if (rec_id >= num_records) return;
@@ -562,170 +625,206 @@ __global__ void convert_data_to_columns_kernel(const char *data,
       next_field_descriptor(current, row_data_range.second, opts, input_field_index, col_map);
     auto const value_len = desc.value_end - desc.value_begin;
 
+    // Advance to the next field; +1 to skip the delimiter
     current = desc.value_end + 1;
 
-    // Empty fields are not legal values
     if (value_len > 0 && !serializedTrieContains(opts.naValuesTrie, desc.value_begin, value_len)) {
-      // Type dispatcher does not handle strings
-      if (dtypes[desc.column].id() == type_id::STRING) {
-        auto str_list           = static_cast<string_pair *>(output_columns[desc.column]);
-        str_list[rec_id].first  = desc.value_begin;
-        str_list[rec_id].second = value_len;
-
-        // set the valid bitmap - all bits were set to 0 to start
-        set_bit(valid_fields[desc.column], rec_id);
-        atomicAdd(&num_valid_fields[desc.column], 1);
-      } else {
-        if (cudf::type_dispatcher(dtypes[desc.column],
-                                  ConvertFunctor{},
-                                  desc.value_begin,
-                                  desc.value_end,
-                                  output_columns[desc.column],
-                                  rec_id,
-                                  opts)) {
-          // set the valid bitmap - all bits were set to 0 to start
-          set_bit(valid_fields[desc.column], rec_id);
-          atomicAdd(&num_valid_fields[desc.column], 1);
-        }
-      }
-    } else if (dtypes[desc.column].id() == type_id::STRING) {
-      auto str_list           = static_cast<string_pair *>(output_columns[desc.column]);
-      str_list[rec_id].first  = nullptr;
-      str_list[rec_id].second = 0;
+      fields[static_cast<size_t>(desc.column) * num_records + rec_id] =
+        string_pair{desc.value_begin, static_cast<size_t>(value_len)};
     }
   }
 }
 
 /**
- * @brief CUDA kernel that processes a buffer of data and determines information about the
- * column types within.
+ * @brief CUDA kernel that converts the tokenized fields of multiple columns into cuDF column data.
  *
- * Data is processed in one row/record at a time, so the number of total
- * threads (tid) is equal to the number of rows.
+ * Data is processed one row at a time.
  *
- * @param[in] data Input data buffer
- * @param[in] data_size Size of the data buffer, in bytes
+ * @param[in] values Ranges of the values of each column
+ * @param[in] num_values The number of values in each column
+ * @param[in] dtypes The data type of each column
  * @param[in] opts A set of parsing options
- * @param[in] col_map Pointer to the (column name hash -> column index) map in device memory.
- * nullptr is passed when the input file does not consist of objects.
- * @param[in] num_columns The number of columns of input data
- * @param[in] rec_starts The offset of each row in the input
- * @param[in] num_records The number of rows
- * @param[out] column_infos The count for each column data type
+ * @param[out] output_columns The output column data
+ * @param[out] valid_fields The bitmaps indicating whether column fields are valid
+ * @param[out] num_valid_fields The numbers of valid fields in columns
+ * @param[in] num_columns The number of columns
  */
-__global__ void detect_data_types_kernel(const char *data,
-                                         size_t data_size,
-                                         const ParseOptions opts,
-                                         col_map_type *col_map,
-                                         int num_columns,
-                                         const uint64_t *rec_starts,
-                                         cudf::size_type num_records,
-                                         ColumnInfo *column_infos)
+__global__ void convert_values_to_columns_kernel(string_pair const *const *values,
+                                                 cudf::size_type num_values,
+                                                 data_type const *dtypes,
+                                                 ParseOptions opts,
+                                                 void *const *output_columns,
+                                                 bitmask_type *const *valid_fields,
+                                                 cudf::size_type *num_valid_fields,
+                                                 cudf::size_type num_columns)
 {
-  auto const rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
-  if (rec_id >= num_records) return;
+  const auto idx = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (idx >= num_values) return;
+
+  for (size_type col = 0; col < num_columns; ++col) {
+    auto const value = values[col][idx];
+    if (decode_field(
+          value.first, value.first + value.second, dtypes[col], output_columns[col], idx, opts)) {
+      // set the valid bitmap - all bits were set to 0 to start
+      set_bit(valid_fields[col], idx);
+      atomicAdd(&num_valid_fields[col], 1);
+    }
+  }
+}
 
-  auto const are_rows_objects = col_map != nullptr;
-  auto const row_data_range = get_row_data_range(data, data_size, rec_starts, num_records, rec_id);
+/**
+ * @brief CUDA kernel that parses and converts an array of values into cuDF column data.
+ *
+ * @param[in] values Ranges of the values in the input data
+ * @param[in] num_values The number of values
+ * @param[in] dtype The data type of the output column
+ * @param[in] opts A set of parsing options
+ * @param[out] output_column The output column data
+ * @param[out] valid_field The bitmap indicating whether values are valid
+ * @param[out] num_valid_fields The number of valid values
+ */
+__global__ void convert_values_to_column_kernel(string_pair const *values,
+                                                cudf::size_type num_values,
+                                                data_type dtype,
+                                                ParseOptions opts,
+                                                void *output_column,
+                                                bitmask_type *valid_field,
+                                                cudf::size_type *num_valid_fields)
+{
+  const auto idx = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (idx >= num_values) return;
 
-  size_type input_field_index = 0;
-  for (auto current = row_data_range.first;
-       input_field_index < num_columns && current < row_data_range.second;
-       input_field_index++) {
-    auto const desc =
-      next_field_descriptor(current, row_data_range.second, opts, input_field_index, col_map);
-    auto const value_len = desc.value_end - desc.value_begin;
+  auto const value = values[idx];
+  if (decode_field(value.first, value.first + value.second, dtype, output_column, idx, opts)) {
+    set_bit(valid_field, idx);
+    atomicAdd(num_valid_fields, 1);
+  }
+}
 
-    // Advance to the next field; +1 to skip the delimiter
-    current = desc.value_end + 1;
+/**
+ * @brief Updates the column type counts with the type of a single non-null value.
+ *
+ * @param[in] begin Pointer to the first character of the (trimmed) value
+ * @param[in] end pointer to the first character after the value
+ * @param[in] opts A set of parsing options
+ * @param[in,out] info The count for each data type
+ */
+__device__ void count_value_type(char const *begin,
+                                 char const *end,
+                                 ParseOptions const &opts,
+                                 ColumnInfo &info)
+{
+  auto const value_len = end - begin;
 
-    // Checking if the field is empty/valid
-    if (value_len <= 0 || serializedTrieContains(opts.naValuesTrie, desc.value_begin, value_len)) {
-      // Increase the null count for array rows, where the null count is initialized to zero.
-      if (!are_rows_objects) { atomicAdd(&column_infos[desc.column].null_count, 1); }
+  // Don't need counts to detect strings, any field in quotes is deduced to be a string
+  if (*(begin - 1) == opts.quotechar && *end == opts.quotechar) {
+    atomicAdd(&info.string_count, 1);
+    return;
+  }
+  // Nested values are tokenized further when their child columns are built
+  if (*begin == '[') {
+    atomicAdd(&info.list_count, 1);
+    return;
+  } else if (*begin == '{') {
+    atomicAdd(&info.struct_count, 1);
+    return;
+  }
+
+  int digit_count    = 0;
+  int decimal_count  = 0;
+  int slash_count    = 0;
+  int dash_count     = 0;
+  int colon_count    = 0;
+  int exponent_count = 0;
+  int other_count    = 0;
+
+  const bool maybe_hex =
+    ((value_len > 2 && *begin == '0' && *(begin + 1) == 'x') ||
+     (value_len > 3 && *begin == '-' && *(begin + 1) == '0' && *(begin + 2) == 'x'));
+  for (auto pos = begin; pos < end; ++pos) {
+    if (is_digit(*pos, maybe_hex)) {
+      digit_count++;
       continue;
-    } else if (are_rows_objects) {
-      // For files with object rows, null count is initialized to row count. The value is decreased
-      // here for every valid field.
-      atomicAdd(&column_infos[desc.column].null_count, -1);
     }
-    // Don't need counts to detect strings, any field in quotes is deduced to be a string
-    if (*(desc.value_begin - 1) == opts.quotechar && *desc.value_end == opts.quotechar) {
-      atomicAdd(&column_infos[desc.column].string_count, 1);
-      continue;
+    // Looking for unique characters that will help identify column types
+    switch (*pos) {
+      case '.': decimal_count++; break;
+      case '-': dash_count++; break;
+      case '/': slash_count++; break;
+      case ':': colon_count++; break;
+      case 'e':
+      case 'E':
+        if (!maybe_hex && pos > begin && pos < end - 1) exponent_count++;
+        break;
+      default: other_count++; break;
     }
+  }
 
-    int digit_count    = 0;
-    int decimal_count  = 0;
-    int slash_count    = 0;
-    int dash_count     = 0;
-    int colon_count    = 0;
-    int exponent_count = 0;
-    int other_count    = 0;
-
-    const bool maybe_hex =
-      ((value_len > 2 && *desc.value_begin == '0' && *(desc.value_begin + 1) == 'x') ||
-       (value_len > 3 && *desc.value_begin == '-' && *(desc.value_begin + 1) == '0' &&
-        *(desc.value_begin + 2) == 'x'));
-    for (auto pos = desc.value_begin; pos < desc.value_end; ++pos) {
-      if (is_digit(*pos, maybe_hex)) {
-        digit_count++;
-        continue;
-      }
-      // Looking for unique characters that will help identify column types
-      switch (*pos) {
-        case '.': decimal_count++; break;
-        case '-': dash_count++; break;
-        case '/': slash_count++; break;
-        case ':': colon_count++; break;
-        case 'e':
-        case 'E':
-          if (!maybe_hex && pos > desc.value_begin && pos < desc.value_end - 1) exponent_count++;
-          break;
-        default: other_count++; break;
+  // Integers have to have the length of the string
+  int int_req_number_cnt = value_len;
+  // Off by one if they start with a minus sign
+  if (*begin == '-' && value_len > 1) { --int_req_number_cnt; }
+  // Off by one if they are a hexadecimal number
+  if (maybe_hex) { --int_req_number_cnt; }
+  if (serializedTrieContains(opts.trueValuesTrie, begin, value_len) ||
+      serializedTrieContains(opts.falseValuesTrie, begin, value_len)) {
+    atomicAdd(&info.bool_count, 1);
+  } else if (digit_count == int_req_number_cnt) {
+    atomicAdd(&info.int_count, 1);
+  } else if (is_like_float(value_len, digit_count, decimal_count, dash_count, exponent_count)) {
+    atomicAdd(&info.float_count, 1);
+  }
+  // A date-time field cannot have more than 3 non-special characters
+  // A number field cannot have more than one decimal point
+  else if (other_count > 3 || decimal_count > 1) {
+    atomicAdd(&info.string_count, 1);
+  } else {
+    // A date field can have either one or two '-' or '\'; A legal combination will only have one
+    // of them To simplify the process of auto column detection, we are not covering all the
+    // date-time formation permutations
+    if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
+        (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
+      if (colon_count <= 2) {
+        atomicAdd(&info.datetime_count, 1);
+      } else {
+        atomicAdd(&info.string_count, 1);
       }
+    } else {
+      // Default field type is string
+      atomicAdd(&info.string_count, 1);
     }
+  }
+}
 
-    // Integers have to have the length of the string
-    int int_req_number_cnt = value_len;
-    // Off by one if they start with a minus sign
-    if (*desc.value_begin == '-' && value_len > 1) { --int_req_number_cnt; }
-    // Off by one if they are a hexadecimal number
-    if (maybe_hex) { --int_req_number_cnt; }
-    if (serializedTrieContains(opts.trueValuesTrie, desc.value_begin, value_len) ||
-        serializedTrieContains(opts.falseValuesTrie, desc.value_begin, value_len)) {
-      atomicAdd(&column_infos[desc.column].bool_count, 1);
-    } else if (digit_count == int_req_number_cnt) {
-      atomicAdd(&column_infos[desc.column].int_count, 1);
-    } else if (is_like_float(value_len, digit_count, decimal_count, dash_count, exponent_count)) {
-      atomicAdd(&column_infos[desc.column].float_count, 1);
-    }
-    // A date-time field cannot have more than 3 non-special characters
-    // A number field cannot have more than one decimal point
-    else if (other_count > 3 || decimal_count > 1) {
-      atomicAdd(&column_infos[desc.column].string_count, 1);
+/**
+ * @brief CUDA kernel that determines information about the common type of each column of values.
+ *
+ * Data is processed one row at a time, so the number of total threads is equal to the number of
+ * values in each column.
+ *
+ * @param[in] values Ranges of the values in the input data, stored column after column
+ * @param[in] num_values The number of values in each column
+ * @param[in] num_columns The number of columns
+ * @param[in] opts A set of parsing options
+ * @param[out] column_infos The count for each column data type
+ */
+__global__ void detect_value_types_kernel(string_pair const *values,
+                                          cudf::size_type num_values,
+                                          cudf::size_type num_columns,
+                                          const ParseOptions opts,
+                                          ColumnInfo *column_infos)
+{
+  auto const idx = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (idx >= num_values) return;
+
+  for (size_type col = 0; col < num_columns; ++col) {
+    auto const value = values[static_cast<size_t>(col) * num_values + idx];
+    if (value.first == nullptr) {
+      atomicAdd(&column_infos[col].null_count, 1);
     } else {
-      // A date field can have either one or two '-' or '\'; A legal combination will only have one
-      // of them To simplify the process of auto column detection, we are not covering all the
-      // date-time formation permutations
-      if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
-          (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
-        if (colon_count <= 2) {
-          atomicAdd(&column_infos[desc.column].datetime_count, 1);
-        } else {
-          atomicAdd(&column_infos[desc.column].string_count, 1);
-        }
-      } else {
-        // Default field type is string
-        atomicAdd(&column_infos[desc.column].string_count, 1);
-      }
+      count_value_type(value.first, value.first + value.second, opts, column_infos[col]);
     }
   }
-  if (!are_rows_objects) {
-    // For array rows, mark missing fields as null
-    for (; input_field_index < num_columns; ++input_field_index)
-      atomicAdd(&column_infos[input_field_index].null_count, 1);
-  }
 }
 
 /**
@@ -752,10 +851,41 @@ __device__ key_value_range get_next_key_value_range(char const *begin,
   if (colon == end) return {end, end, end};
 
   // Field value (including delimiters)
-  auto const value_end = cudf::io::gpu::seek_field_end(colon + 1, end, opts);
+  auto const value_end = seek_value_end(colon + 1, end, opts);
   return {key_range.first, key_range.second, colon + 1, value_end};
 }
 
+/**
+ * @brief Collects information about the JSON object keys in the range.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] begin Pointer to the first character after the opening brace
+ * @param[in] end Pointer to the closing brace
+ * @param[in] opts A set of parsing options
+ * @param[out] keys_cnt Number of keys found in the file
+ * @param[out] keys_info optional, information (offset, length, hash) for each found key
+ */
+__device__ void collect_keys_in_range(const char *data,
+                                      const char *begin,
+                                      const char *end,
+                                      ParseOptions const &opts,
+                                      unsigned long long int *keys_cnt,
+                                      thrust::optional<mutable_table_device_view> &keys_info)
+{
+  auto advance = [&](const char *pos) { return get_next_key_value_range(pos, end, opts); };
+  for (auto field_range = advance(begin); field_range.key_begin < end;
+       field_range = advance(field_range.value_end)) {
+    auto const idx = atomicAdd(keys_cnt, 1);
+    if (keys_info.has_value()) {
+      auto const len                              = field_range.key_end - field_range.key_begin;
+      keys_info->column(0).element<uint64_t>(idx) = field_range.key_begin - data;
+      keys_info->column(1).element<uint16_t>(idx) = len;
+      keys_info->column(2).element<uint32_t>(idx) =
+        MurmurHash3_32<cudf::string_view>{}(cudf::string_view(field_range.key_begin, len));
+    }
+  }
+}
+
 /**
  * @brief Cuda kernel that collects information about JSON object keys in the file.
  *
@@ -780,20 +910,136 @@ __global__ void collect_keys_info_kernel(const char *data,
   if (rec_id >= num_records) return;
 
   auto const row_data_range = get_row_data_range(data, data_size, rec_starts, num_records, rec_id);
+  collect_keys_in_range(
+    data, row_data_range.first, row_data_range.second, opts, keys_cnt, keys_info);
+}
 
-  auto advance = [&](const char *begin) {
-    return get_next_key_value_range(begin, row_data_range.second, opts);
-  };
-  for (auto field_range = advance(row_data_range.first);
-       field_range.key_begin < row_data_range.second;
-       field_range = advance(field_range.value_end)) {
-    auto const idx = atomicAdd(keys_cnt, 1);
-    if (keys_info.has_value()) {
-      auto const len                              = field_range.key_end - field_range.key_begin;
-      keys_info->column(0).element<uint64_t>(idx) = field_range.key_begin - data;
-      keys_info->column(1).element<uint16_t>(idx) = len;
-      keys_info->column(2).element<uint32_t>(idx) =
-        MurmurHash3_32<cudf::string_view>{}(cudf::string_view(field_range.key_begin, len));
+/**
+ * @brief Cuda kernel that collects information about the keys of JSON objects nested in the file.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] objects Ranges of the objects, including the braces
+ * @param[in] num_objects The number of objects
+ * @param[in] opts A set of parsing options
+ * @param[out] keys_cnt Number of keys found in the objects
+ * @param[out] keys_info optional, information (offset, length, hash) for each found key
+ */
+__global__ void collect_value_keys_info_kernel(
+  const char *data,
+  string_pair const *objects,
+  cudf::size_type num_objects,
+  const ParseOptions opts,
+  unsigned long long int *keys_cnt,
+  thrust::optional<mutable_table_device_view> keys_info)
+{
+  auto const idx = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (idx >= num_objects || objects[idx].first == nullptr) return;
+
+  auto const object_range =
+    limit_range_to_brackets(objects[idx].first, objects[idx].first + objects[idx].second);
+  collect_keys_in_range(data, object_range.first, object_range.second, opts, keys_cnt, keys_info);
+}
+
+/**
+ * @brief Cuda kernel that counts the elements of each JSON array.
+ *
+ * @param[in] lists Ranges of the arrays, including the brackets
+ * @param[in] num_lists The number of arrays
+ * @param[in] opts A set of parsing options
+ * @param[out] counts The number of elements in each array
+ */
+__global__ void count_list_elements_kernel(string_pair const *lists,
+                                           cudf::size_type num_lists,
+                                           const ParseOptions opts,
+                                           cudf::size_type *counts)
+{
+  auto const idx = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (idx >= num_lists) return;
+
+  cudf::size_type count = 0;
+  if (lists[idx].first != nullptr) {
+    auto const list_range =
+      limit_range_to_brackets(lists[idx].first, lists[idx].first + lists[idx].second);
+    auto const content = trim_whitespaces_quotes(list_range.first, list_range.second);
+    // Each delimiter outside of nested values separates two elements; `[]` has no elements
+    for (auto current = content.first; current < content.second; ++count) {
+      current = seek_value_end(current, content.second, opts) + 1;
+    }
+  }
+  counts[idx] = count;
+}
+
+/**
+ * @brief Cuda kernel that extracts the element ranges of each JSON array.
+ *
+ * @param[in] lists Ranges of the arrays, including the brackets
+ * @param[in] num_lists The number of arrays
+ * @param[in] offsets Position of each array's first element in the output
+ * @param[in] opts A set of parsing options
+ * @param[out] elements Ranges of the elements of all arrays
+ */
+__global__ void extract_list_elements_kernel(string_pair const *lists,
+                                             cudf::size_type num_lists,
+                                             cudf::size_type const *offsets,
+                                             const ParseOptions opts,
+                                             string_pair *elements)
+{
+  auto const idx = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (idx >= num_lists || lists[idx].first == nullptr) return;
+
+  auto const list_range =
+    limit_range_to_brackets(lists[idx].first, lists[idx].first + lists[idx].second);
+  auto const content = trim_whitespaces_quotes(list_range.first, list_range.second);
+
+  auto out = elements + offsets[idx];
+  for (auto current = content.first; current < content.second; ++out) {
+    auto const element_end = seek_value_end(current, content.second, opts);
+    auto const element     = trim_whitespaces_quotes(current, element_end, opts.quotechar);
+    auto const len         = element.second - element.first;
+
+    auto const is_valid = len > 0 && !serializedTrieContains(opts.naValuesTrie, element.first, len);
+    *out =
+      is_valid ? string_pair{element.first, static_cast<size_t>(len)} : string_pair{nullptr, 0};
+
+    current = element_end + 1;
+  }
+}
+
+/**
+ * @brief Cuda kernel that extracts the field value ranges of each JSON object.
+ *
+ * @param[in] objects Ranges of the objects, including the braces
+ * @param[in] num_objects The number of objects
+ * @param[in] opts A set of parsing options
+ * @param[in] col_map Pointer to the (field name hash -> field index) map in device memory
+ * @param[out] fields Ranges of the values of each field
+ * @param[in] num_fields The number of fields
+ */
+__global__ void extract_struct_fields_kernel(string_pair const *objects,
+                                             cudf::size_type num_objects,
+                                             const ParseOptions opts,
+                                             col_map_type *col_map,
+                                             string_pair *const *fields,
+                                             cudf::size_type num_fields)
+{
+  auto const idx = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (idx >= num_objects || objects[idx].first == nullptr) return;
+
+  auto const object_range =
+    limit_range_to_brackets(objects[idx].first, objects[idx].first + objects[idx].second);
+
+  auto current = object_range.first;
+  for (size_type field_index = 0; field_index < num_fields && current < object_range.second;
+       field_index++) {
+    auto const desc =
+      next_field_descriptor(current, object_range.second, opts, field_index, col_map);
+    auto const value_len = desc.value_end - desc.value_begin;
+
+    current = desc.value_end + 1;
+
+    if (desc.column < num_fields && value_len > 0 &&
+        !serializedTrieContains(opts.naValuesTrie, desc.value_begin, value_len)) {
+      fields[desc.column][idx] = string_pair{desc.value_begin, static_cast<size_t>(value_len)};
     }
   }
 }
@@ -801,92 +1047,245 @@ __global__ void collect_keys_info_kernel(const char *data,
 }  // namespace
 
 /**
- * @copydoc cudf::io::json::gpu::convert_json_to_columns
+ * @copydoc cudf::io::json::gpu::tokenize_fields
  */
-void convert_json_to_columns(rmm::device_buffer const &input_data,
-                             data_type *const dtypes,
-                             void *const *output_columns,
-                             cudf::size_type num_records,
-                             cudf::size_type num_columns,
-                             const uint64_t *rec_starts,
-                             bitmask_type *const *valid_fields,
-                             cudf::size_type *num_valid_fields,
-                             ParseOptions const &opts,
-                             col_map_type *col_map,
-                             cudaStream_t stream)
+void tokenize_fields(rmm::device_buffer const &input_data,
+                     const uint64_t *rec_starts,
+                     cudf::size_type num_records,
+                     ParseOptions const &opts,
+                     col_map_type *col_map,
+                     cudf::size_type num_columns,
+                     string_pair *fields,
+                     cudaStream_t stream)
 {
   int block_size;
   int min_grid_size;
-  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
-    &min_grid_size, &block_size, convert_data_to_columns_kernel));
+  CUDA_TRY(
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, tokenize_fields_kernel));
 
   const int grid_size = (num_records + block_size - 1) / block_size;
 
-  convert_data_to_columns_kernel<<<grid_size, block_size, 0, stream>>>(
+  tokenize_fields_kernel<<<grid_size, block_size, 0, stream>>>(
     static_cast<const char *>(input_data.data()),
     input_data.size(),
     rec_starts,
     num_records,
-    dtypes,
     opts,
     col_map,
-    output_columns,
     num_columns,
-    valid_fields,
-    num_valid_fields);
+    fields);
 
   CUDA_TRY(cudaGetLastError());
 }
 
 /**
- * @copydoc cudf::io::json::gpu::detect_data_types
+ * @copydoc cudf::io::json::gpu::gpu_collect_keys_info
  */
-void detect_data_types(ColumnInfo *column_infos,
-                       const char *data,
+void collect_keys_info(const char *data,
                        size_t data_size,
                        const ParseOptions &options,
-                       col_map_type *col_map,
-                       int num_columns,
                        const uint64_t *rec_starts,
                        cudf::size_type num_records,
+                       unsigned long long int *keys_cnt,
+                       thrust::optional<mutable_table_device_view> keys_info,
                        cudaStream_t stream)
 {
   int block_size;
   int min_grid_size;
   CUDA_TRY(
-    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, detect_data_types_kernel));
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, collect_keys_info_kernel));
 
   // Calculate actual block count to use based on records count
   const int grid_size = (num_records + block_size - 1) / block_size;
 
-  detect_data_types_kernel<<<grid_size, block_size, 0, stream>>>(
-    data, data_size, options, col_map, num_columns, rec_starts, num_records, column_infos);
+  collect_keys_info_kernel<<<grid_size, block_size, 0, stream>>>(
+    data, data_size, options, rec_starts, num_records, keys_cnt, keys_info);
 
   CUDA_TRY(cudaGetLastError());
 }
 
 /**
- * @copydoc cudf::io::json::gpu::gpu_collect_keys_info
+ * @copydoc cudf::io::json::gpu::detect_value_types
  */
-void collect_keys_info(const char *data,
-                       size_t data_size,
-                       const ParseOptions &options,
-                       const uint64_t *rec_starts,
-                       cudf::size_type num_records,
-                       unsigned long long int *keys_cnt,
-                       thrust::optional<mutable_table_device_view> keys_info,
-                       cudaStream_t stream)
+void detect_value_types(string_pair const *values,
+                        cudf::size_type num_values,
+                        cudf::size_type num_columns,
+                        ParseOptions const &opts,
+                        ColumnInfo *column_infos,
+                        cudaStream_t stream)
 {
+  if (num_values == 0 || num_columns == 0) return;
+
   int block_size;
   int min_grid_size;
   CUDA_TRY(
-    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, collect_keys_info_kernel));
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, detect_value_types_kernel));
 
-  // Calculate actual block count to use based on records count
-  const int grid_size = (num_records + block_size - 1) / block_size;
+  const int grid_size = (num_values + block_size - 1) / block_size;
 
-  collect_keys_info_kernel<<<grid_size, block_size, 0, stream>>>(
-    data, data_size, options, rec_starts, num_records, keys_cnt, keys_info);
+  detect_value_types_kernel<<<grid_size, block_size, 0, stream>>>(
+    values, num_values, num_columns, opts, column_infos);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::convert_values_to_column
+ */
+void convert_values_to_column(string_pair const *values,
+                              cudf::size_type num_values,
+                              data_type dtype,
+                              ParseOptions const &opts,
+                              void *output_column,
+                              bitmask_type *valid_field,
+                              cudf::size_type *num_valid_fields,
+                              cudaStream_t stream)
+{
+  if (num_values == 0) return;
+
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+    &min_grid_size, &block_size, convert_values_to_column_kernel));
+
+  const int grid_size = (num_values + block_size - 1) / block_size;
+
+  convert_values_to_column_kernel<<<grid_size, block_size, 0, stream>>>(
+    values, num_values, dtype, opts, output_column, valid_field, num_valid_fields);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::convert_values_to_columns
+ */
+void convert_values_to_columns(string_pair const *const *values,
+                               cudf::size_type num_values,
+                               data_type const *dtypes,
+                               ParseOptions const &opts,
+                               void *const *output_columns,
+                               bitmask_type *const *valid_fields,
+                               cudf::size_type *num_valid_fields,
+                               cudf::size_type num_columns,
+                               cudaStream_t stream)
+{
+  if (num_values == 0 || num_columns == 0) return;
+
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+    &min_grid_size, &block_size, convert_values_to_columns_kernel));
+
+  const int grid_size = (num_values + block_size - 1) / block_size;
+
+  convert_values_to_columns_kernel<<<grid_size, block_size, 0, stream>>>(values,
+                                                                         num_values,
+                                                                         dtypes,
+                                                                         opts,
+                                                                         output_columns,
+                                                                         valid_fields,
+                                                                         num_valid_fields,
+                                                                         num_columns);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::count_list_elements
+ */
+void count_list_elements(string_pair const *lists,
+                         cudf::size_type num_lists,
+                         ParseOptions const &opts,
+                         cudf::size_type *counts,
+                         cudaStream_t stream)
+{
+  if (num_lists == 0) return;
+
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, count_list_elements_kernel));
+
+  const int grid_size = (num_lists + block_size - 1) / block_size;
+
+  count_list_elements_kernel<<<grid_size, block_size, 0, stream>>>(lists, num_lists, opts, counts);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::extract_list_elements
+ */
+void extract_list_elements(string_pair const *lists,
+                           cudf::size_type num_lists,
+                           cudf::size_type const *offsets,
+                           ParseOptions const &opts,
+                           string_pair *elements,
+                           cudaStream_t stream)
+{
+  if (num_lists == 0) return;
+
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, extract_list_elements_kernel));
+
+  const int grid_size = (num_lists + block_size - 1) / block_size;
+
+  extract_list_elements_kernel<<<grid_size, block_size, 0, stream>>>(
+    lists, num_lists, offsets, opts, elements);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::collect_value_keys_info
+ */
+void collect_value_keys_info(const char *data,
+                             string_pair const *objects,
+                             cudf::size_type num_objects,
+                             const ParseOptions &options,
+                             unsigned long long int *keys_cnt,
+                             thrust::optional<mutable_table_device_view> keys_info,
+                             cudaStream_t stream)
+{
+  if (num_objects == 0) return;
+
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+    &min_grid_size, &block_size, collect_value_keys_info_kernel));
+
+  const int grid_size = (num_objects + block_size - 1) / block_size;
+
+  collect_value_keys_info_kernel<<<grid_size, block_size, 0, stream>>>(
+    data, objects, num_objects, options, keys_cnt, keys_info);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::extract_struct_fields
+ */
+void extract_struct_fields(string_pair const *objects,
+                           cudf::size_type num_objects,
+                           ParseOptions const &opts,
+                           col_map_type *col_map,
+                           string_pair *const *fields,
+                           cudf::size_type num_fields,
+                           cudaStream_t stream)
+{
+  if (num_objects == 0) return;
+
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, extract_struct_fields_kernel));
+
+  const int grid_size = (num_objects + block_size - 1) / block_size;
+
+  extract_struct_fields_kernel<<<grid_size, block_size, 0, stream>>>(
+    objects, num_objects, opts, col_map, fields, num_fields);
 
   CUDA_TRY(cudaGetLastError());
 }
@@ -25,63 +25,47 @@
 
 #include <io/utilities/parsing_utils.cuh>
 
+#include <utility>
+
 namespace cudf {
 namespace io {
 namespace json {
 namespace gpu {
 
 using col_map_type = concurrent_unordered_map<uint32_t, cudf::size_type>;
+
 /**
- * @brief Convert a buffer of input data (text) into raw cuDF column data.
+ * @brief Location and length of a value in the input data; `{nullptr, 0}` for null values.
  *
- * @param[in] input_data The entire data to read
- * @param[in] dtypes The data type of each column
- * @param[out] output_columns The output column data
- * @param[in] num_records The number of lines/rows
- * @param[in] num_columns The number of columns
- * @param[in] rec_starts The start of each data record
- * @param[out] valid_fields The bitmaps indicating whether column fields are valid
- * @param[out] num_valid_fields The numbers of valid fields in columns
- * @param[in] opts A set of parsing options
- * @param[in] col_map Pointer to the (column name hash -> solumn index) map in device memory.
- * nullptr is passed when the input file does not consist of objects.
- * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * Also used as the intermediate representation of string, list and struct column elements.
  */
-void convert_json_to_columns(rmm::device_buffer const &input_data,
-                             data_type *const dtypes,
-                             void *const *output_columns,
-                             cudf::size_type num_records,
-                             cudf::size_type num_columns,
-                             const uint64_t *rec_starts,
-                             bitmask_type *const *valid_fields,
-                             cudf::size_type *num_valid_fields,
-                             ParseOptions const &opts,
-                             col_map_type *col_map,
-                             cudaStream_t stream = 0);
+using string_pair = std::pair<const char *, size_t>;
 
 /**
- * @brief Process a buffer of data and determine information about the column types within.
+ * @brief Split each record of the input data into fields and store the ranges of their values.
  *
- * @param[out] column_infos The count for each column data type
- * @param[in] data Input data buffer
- * @param[in] data_size Size of the data buffer, in bytes
+ * The ranges are stored in a column-major table of `num_columns * num_records` elements, which
+ * is reused for type inference and conversion instead of parsing the input again.
+ *
+ * @param[in] input_data The entire data to read
+ * @param[in] rec_starts The start of each data record
+ * @param[in] num_records The number of lines/rows
  * @param[in] opts A set of parsing options
  * @param[in] col_map Pointer to the (column name hash -> solumn index) map in device memory.
  * nullptr is passed when the input file does not consist of objects.
- * @param[in] num_columns The number of columns of input data
- * @param[in] rec_starts The offset of each row in the input
- * @param[in] num_records The number of rows
+ * @param[in] num_columns The number of columns
+ * @param[in,out] fields Ranges of the field values; must be initialized to `{nullptr, 0}`, which
+ * is left unchanged for null and missing fields
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
-void detect_data_types(ColumnInfo *column_infos,
-                       const char *data,
-                       size_t data_size,
-                       const ParseOptions &options,
-                       col_map_type *col_map,
-                       int num_columns,
-                       const uint64_t *rec_starts,
-                       cudf::size_type num_records,
-                       cudaStream_t stream = 0);
+void tokenize_fields(rmm::device_buffer const &input_data,
+                     const uint64_t *rec_starts,
+                     cudf::size_type num_records,
+                     ParseOptions const &opts,
+                     col_map_type *col_map,
+                     cudf::size_type num_columns,
+                     string_pair *fields,
+                     cudaStream_t stream = 0);
 
 /**
  * @brief Collects information about JSON object keys in the file.
@@ -104,6 +88,139 @@ void collect_keys_info(const char *data,
                        thrust::optional<mutable_table_device_view> keys_info,
                        cudaStream_t stream = 0);
 
+/**
+ * @brief Process arrays of values and determine information about the common type of each.
+ *
+ * @param[in] values Ranges of the values in the input data, stored column after column
+ * @param[in] num_values The number of values in each column
+ * @param[in] num_columns The number of columns
+ * @param[in] opts A set of parsing options
+ * @param[out] column_infos The count for each column data type
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void detect_value_types(string_pair const *values,
+                        cudf::size_type num_values,
+                        cudf::size_type num_columns,
+                        ParseOptions const &opts,
+                        ColumnInfo *column_infos,
+                        cudaStream_t stream = 0);
+
+/**
+ * @brief Convert an array of values into raw cuDF column data.
+ *
+ * String, list and struct values are stored as `string_pair` ranges.
+ *
+ * @param[in] values Ranges of the values in the input data
+ * @param[in] num_values The number of values
+ * @param[in] dtype The data type of the output column
+ * @param[in] opts A set of parsing options
+ * @param[out] output_column The output column data
+ * @param[out] valid_field The bitmap indicating whether values are valid
+ * @param[out] num_valid_fields The number of valid values
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void convert_values_to_column(string_pair const *values,
+                              cudf::size_type num_values,
+                              data_type dtype,
+                              ParseOptions const &opts,
+                              void *output_column,
+                              bitmask_type *valid_field,
+                              cudf::size_type *num_valid_fields,
+                              cudaStream_t stream = 0);
+
+/**
+ * @brief Convert arrays of values into raw cuDF column data, one column per array.
+ *
+ * @param[in] values Ranges of the values of each column
+ * @param[in] num_values The number of values in each column
+ * @param[in] dtypes The data type of each column
+ * @param[in] opts A set of parsing options
+ * @param[out] output_columns The output column data
+ * @param[out] valid_fields The bitmaps indicating whether values are valid
+ * @param[out] num_valid_fields The numbers of valid values in columns
+ * @param[in] num_columns The number of columns
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void convert_values_to_columns(string_pair const *const *values,
+                               cudf::size_type num_values,
+                               data_type const *dtypes,
+                               ParseOptions const &opts,
+                               void *const *output_columns,
+                               bitmask_type *const *valid_fields,
+                               cudf::size_type *num_valid_fields,
+                               cudf::size_type num_columns,
+                               cudaStream_t stream = 0);
+
+/**
+ * @brief Count the elements of each JSON array in the input.
+ *
+ * @param[in] lists Ranges of the arrays, including the brackets
+ * @param[in] num_lists The number of arrays
+ * @param[in] opts A set of parsing options
+ * @param[out] counts The number of elements in each array; zero for null arrays
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void count_list_elements(string_pair const *lists,
+                         cudf::size_type num_lists,
+                         ParseOptions const &opts,
+                         cudf::size_type *counts,
+                         cudaStream_t stream = 0);
+
+/**
+ * @brief Extract the element ranges of each JSON array in the input.
+ *
+ * @param[in] lists Ranges of the arrays, including the brackets
+ * @param[in] num_lists The number of arrays
+ * @param[in] offsets Position of each array's first element in the output
+ * @param[in] opts A set of parsing options
+ * @param[out] elements Ranges of the elements of all arrays
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void extract_list_elements(string_pair const *lists,
+                           cudf::size_type num_lists,
+                           cudf::size_type const *offsets,
+                           ParseOptions const &opts,
+                           string_pair *elements,
+                           cudaStream_t stream = 0);
+
+/**
+ * @brief Collects information about the keys of JSON objects nested in the input.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] objects Ranges of the objects, including the braces
+ * @param[in] num_objects The number of objects
+ * @param[in] options A set of parsing options
+ * @param[out] keys_cnt Number of keys found in the objects
+ * @param[out] keys_info optional, information (offset, length, hash) for each found key
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void collect_value_keys_info(const char *data,
+                             string_pair const *objects,
+                             cudf::size_type num_objects,
+                             const ParseOptions &options,
+                             unsigned long long int *keys_cnt,
+                             thrust::optional<mutable_table_device_view> keys_info,
+                             cudaStream_t stream = 0);
+
+/**
+ * @brief Extract the field value ranges of each JSON object in the input.
+ *
+ * @param[in] objects Ranges of the objects, including the braces
+ * @param[in] num_objects The number of objects
+ * @param[in] opts A set of parsing options
+ * @param[in] col_map Pointer to the (field name hash -> field index) map in device memory
+ * @param[out] fields Ranges of the values of each field; missing fields are left unchanged
+ * @param[in] num_fields The number of fields
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void extract_struct_fields(string_pair const *objects,
+                           cudf::size_type num_objects,
+                           ParseOptions const &opts,
+                           col_map_type *col_map,
+                           string_pair *const *fields,
+                           cudf::size_type num_fields,
+                           cudaStream_t stream = 0);
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
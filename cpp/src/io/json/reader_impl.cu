@@ -22,11 +22,13 @@
 #include "reader_impl.hpp"
 
 #include <thrust/optional.h>
+#include <thrust/scan.h>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_scalar.hpp>
 
 #include <cudf/detail/utilities/trie.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/groupby.hpp>
 #include <cudf/io/readers.hpp>
 #include <cudf/sorting.hpp>
@@ -34,6 +36,7 @@
 #include <cudf/utilities/error.hpp>
 
 #include <io/comp/io_uncomp.h>
+#include <io/utilities/device_read_pipeline.hpp>
 #include <io/utilities/parsing_utils.cuh>
 #include <io/utilities/type_conversion.cuh>
 
@@ -70,8 +73,57 @@ constexpr size_t calculate_max_row_size(int num_columns = 0) noexcept
   }
 }
 
+/**
+ * @brief Functor that checks whether a value range is valid (non-null).
+ */
+struct is_valid_value {
+  __device__ bool operator()(string_pair const &value) const { return value.first != nullptr; }
+};
+
+/**
+ * @brief Returns whether the column type is read through the nested value ranges.
+ */
+bool is_nested(data_type type)
+{
+  return type.id() == type_id::LIST || type.id() == type_id::STRUCT;
+}
+
 }  // anonymous namespace
 
+/**
+ * @brief Selects the column data type based on the type counts of its values.
+ *
+ * Columns whose valid values are all arrays or all objects are nested; columns that mix nested
+ * values with other values are read as strings.
+ *
+ * @param[in] cinfo The count for each data type
+ * @param[in] num_rows The number of values in the column
+ *
+ * @return The column data type
+ */
+data_type select_data_type(cudf::io::json::ColumnInfo const &cinfo, size_type num_rows)
+{
+  if (cinfo.null_count == num_rows) {
+    // Entire column is NULL; allocate the smallest amount of memory
+    return data_type(type_id::INT8);
+  } else if (cinfo.list_count + cinfo.null_count == num_rows) {
+    return data_type(type_id::LIST);
+  } else if (cinfo.struct_count + cinfo.null_count == num_rows) {
+    return data_type(type_id::STRUCT);
+  } else if (cinfo.string_count > 0 || cinfo.list_count > 0 || cinfo.struct_count > 0) {
+    return data_type(type_id::STRING);
+  } else if (cinfo.datetime_count > 0) {
+    return data_type(type_id::TIMESTAMP_MILLISECONDS);
+  } else if (cinfo.float_count > 0 || (cinfo.int_count > 0 && cinfo.null_count > 0)) {
+    return data_type(type_id::FLOAT64);
+  } else if (cinfo.int_count > 0) {
+    return data_type(type_id::INT64);
+  } else if (cinfo.bool_count > 0) {
+    return data_type(type_id::BOOL8);
+  }
+  CUDF_FAIL("Data type detection failed.\n");
+}
+
 /**
  * @brief Aggregate the table containing keys info by their hash values.
  *
@@ -120,6 +172,20 @@ col_map_ptr_type create_col_names_hash_map(column_view column_name_hashes, cudaS
   return key_col_map;
 }
 
+/**
+ * @brief Allocates a table to hold the offset, length and hash of each JSON object key.
+ */
+std::unique_ptr<table> allocate_keys_info_table(size_type num_keys)
+{
+  // Allocate columns to store hash value, length, and offset of each JSON object key in the input
+  std::vector<std::unique_ptr<column>> info_columns;
+  info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT64), num_keys));
+  info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT16), num_keys));
+  info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT32), num_keys));
+  // Create a table out of these columns to pass them around more easily
+  return std::make_unique<table>(std::move(info_columns));
+}
+
 /**
  * @brief Create a table whose columns contain the information on JSON objects' keys.
  *
@@ -150,14 +216,7 @@ std::unique_ptr<table> create_json_keys_info_table(
                                          {},
                                          stream);
 
-  // Allocate columns to store hash value, length, and offset of each JSON object key in the input
-  auto const num_keys = key_counter.value();
-  std::vector<std::unique_ptr<column>> info_columns;
-  info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT64), num_keys));
-  info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT16), num_keys));
-  info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT32), num_keys));
-  // Create a table out of these columns to pass them around more easily
-  auto info_table           = std::make_unique<table>(std::move(info_columns));
+  auto info_table           = allocate_keys_info_table(key_counter.value(stream));
   auto const info_table_mdv = mutable_table_device_view::create(info_table->mutable_view(), stream);
 
   // Reset the key counter - now used for indexing
@@ -229,6 +288,166 @@ std::pair<std::vector<std::string>, col_map_ptr_type> reader::impl::get_json_obj
           create_col_names_hash_map(sorted_info->get_column(2).view(), stream)};
 }
 
+/**
+ * @brief Extract the keys of JSON objects nested in the file.
+ *
+ * @param[in] objects Ranges of the objects in the input data
+ * @param[in] num_objects The number of objects
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Keys in the order of appearance and a map that maps their hash values to field indices
+ */
+std::pair<std::vector<std::string>, col_map_ptr_type> reader::impl::get_value_keys_hashes(
+  string_pair const *objects, size_type num_objects, cudaStream_t stream)
+{
+  rmm::device_scalar<unsigned long long int> key_counter(0, stream);
+  auto const data_ptr = static_cast<const char *>(data_.data());
+  cudf::io::json::gpu::collect_value_keys_info(
+    data_ptr, objects, num_objects, opts_, key_counter.data(), {}, stream);
+  auto const num_keys = key_counter.value(stream);
+  if (num_keys == 0) { return {{}, nullptr}; }
+
+  auto info_table           = allocate_keys_info_table(num_keys);
+  auto const info_table_mdv = mutable_table_device_view::create(info_table->mutable_view(), stream);
+  // Reset the key counter - now used for indexing
+  key_counter.set_value(0, stream);
+  cudf::io::json::gpu::collect_value_keys_info(
+    data_ptr, objects, num_objects, opts_, key_counter.data(), {*info_table_mdv}, stream);
+
+  auto aggregated_info = aggregate_keys_info(std::move(info_table));
+  auto sorted_info     = sort_keys_info_by_offset(std::move(aggregated_info));
+
+  return {create_key_strings(uncomp_data_, sorted_info->view(), stream),
+          create_col_names_hash_map(sorted_info->get_column(2).view(), stream)};
+}
+
+/**
+ * @brief Parse an array of values and store the results in a column.
+ *
+ * List and struct values are tokenized on the GPU into the values of their child columns, which
+ * are built recursively.
+ *
+ * @param[in] values Ranges of the values in the input data; `{nullptr, 0}` for null values
+ * @param[in] num_values The number of values
+ * @param[in] dtype The data type of the column
+ * @param[in,out] column_names Names of the nested struct fields, in pre-order
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The column
+ */
+std::unique_ptr<column> reader::impl::make_column_from_values(
+  string_pair const *values,
+  size_type num_values,
+  data_type dtype,
+  std::vector<std::string> &column_names,
+  cudaStream_t stream)
+{
+  if (dtype.id() != type_id::LIST && dtype.id() != type_id::STRUCT) {
+    column_buffer out_buffer(dtype, num_values, true, stream, mr_);
+    rmm::device_scalar<size_type> valid_count(0, stream);
+    cudf::io::json::gpu::convert_values_to_column(values,
+                                                  num_values,
+                                                  dtype,
+                                                  opts_,
+                                                  out_buffer.data(),
+                                                  out_buffer.null_mask(),
+                                                  valid_count.data(),
+                                                  stream);
+    out_buffer.null_count() = num_values - valid_count.value(stream);
+    return make_column(out_buffer, stream, mr_);
+  }
+
+  auto null_mask =
+    cudf::detail::valid_if(values, values + num_values, is_valid_value{}, stream, mr_);
+
+  if (dtype.id() == type_id::LIST) {
+    // Offsets are computed in place from the element counts
+    auto offsets = make_numeric_column(
+      data_type(type_id::INT32), num_values + 1, mask_state::UNALLOCATED, stream, mr_);
+    auto const d_offsets = offsets->mutable_view().data<size_type>();
+    cudf::io::json::gpu::count_list_elements(values, num_values, opts_, d_offsets, stream);
+    CUDA_TRY(cudaMemsetAsync(d_offsets + num_values, 0, sizeof(size_type), stream));
+    thrust::exclusive_scan(
+      rmm::exec_policy(stream)->on(stream), d_offsets, d_offsets + num_values + 1, d_offsets);
+
+    size_type num_elements = 0;
+    CUDA_TRY(cudaMemcpyAsync(&num_elements,
+                             d_offsets + num_values,
+                             sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    rmm::device_vector<string_pair> elements(num_elements, string_pair{nullptr, 0});
+    cudf::io::json::gpu::extract_list_elements(
+      values, num_values, d_offsets, opts_, elements.data().get(), stream);
+
+    auto const child_type = infer_value_type(elements.data().get(), num_elements, stream);
+    auto child            = make_column_from_values(
+      elements.data().get(), num_elements, child_type, column_names, stream);
+    return make_lists_column(num_values,
+                             std::move(offsets),
+                             std::move(child),
+                             null_mask.second,
+                             std::move(null_mask.first),
+                             stream,
+                             mr_);
+  }
+
+  auto const keys       = get_value_keys_hashes(values, num_values, stream);
+  auto const num_fields = keys.first.size();
+
+  std::vector<rmm::device_vector<string_pair>> fields;
+  fields.reserve(num_fields);
+  thrust::host_vector<string_pair *> h_fields;
+  for (size_t i = 0; i < num_fields; ++i) {
+    fields.emplace_back(num_values, string_pair{nullptr, 0});
+  }
+  for (auto &field : fields) {
+    h_fields.push_back(field.data().get());
+  }
+  if (num_fields != 0) {
+    rmm::device_vector<string_pair *> d_fields = h_fields;
+    rmm::device_scalar<col_map_type> d_field_map(*keys.second, stream);
+    cudf::io::json::gpu::extract_struct_fields(
+      values, num_values, opts_, d_field_map.data(), d_fields.data().get(), num_fields, stream);
+  }
+
+  std::vector<std::unique_ptr<column>> children;
+  for (size_t i = 0; i < num_fields; ++i) {
+    column_names.push_back(keys.first[i]);
+    auto const child_type = infer_value_type(fields[i].data().get(), num_values, stream);
+    children.emplace_back(make_column_from_values(
+      fields[i].data().get(), num_values, child_type, column_names, stream));
+  }
+  return make_structs_column(num_values,
+                             std::move(children),
+                             null_mask.second,
+                             std::move(null_mask.first),
+                             stream,
+                             mr_);
+}
+
+/**
+ * @brief Infers the data type of an array of values, e.g. the elements of list columns.
+ *
+ * @param[in] values Ranges of the values in the input data; `{nullptr, 0}` for null values
+ * @param[in] num_values The number of values
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The inferred data type
+ */
+data_type reader::impl::infer_value_type(string_pair const *values,
+                                         size_type num_values,
+                                         cudaStream_t stream)
+{
+  rmm::device_scalar<cudf::io::json::ColumnInfo> d_column_info(cudf::io::json::ColumnInfo{},
+                                                               stream);
+  cudf::io::json::gpu::detect_value_types(
+    values, num_values, 1, opts_, d_column_info.data(), stream);
+  return select_data_type(d_column_info.value(), num_values);
+}
+
 /**
  * @brief Ingest input JSON file/buffer, without decompression.
  *
@@ -248,6 +467,7 @@ void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
     assert(!filepath_.empty());
     source_ = datasource::create(filepath_, range_offset, map_range_size);
   }
+  source_->advise_access_pattern(datasource::access_pattern::SEQUENTIAL);
 
   if (!source_->is_empty()) {
     auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
@@ -274,12 +494,14 @@ void reader::impl::decompress_input(cudaStream_t stream)
     uncomp_data_ = reinterpret_cast<const char *>(buffer_->data());
     uncomp_size_ = buffer_->size();
   } else {
-    uncomp_data_owner_ = getUncompressedHostData(
-      reinterpret_cast<const char *>(buffer_->data()), buffer_->size(), compression_type);
+    uncomp_data_owner_ = getUncompressedHostData(reinterpret_cast<const char *>(buffer_->data()),
+                                                 buffer_->size(),
+                                                 compression_type,
+                                                 stream);
     uncomp_data_ = uncomp_data_owner_.data();
     uncomp_size_ = uncomp_data_owner_.size();
   }
-  if (load_whole_file_) data_ = rmm::device_buffer(uncomp_data_, uncomp_size_, stream);
+  if (load_whole_file_) data_ = upload_to_device(uncomp_data_, uncomp_size_, stream);
 }
 
 /**
@@ -291,6 +513,17 @@ void reader::impl::decompress_input(cudaStream_t stream)
  */
 void reader::impl::set_record_starts(cudaStream_t stream)
 {
+  // Sources of discrete messages know where the records start; only usable if the offsets are
+  // those of the data being parsed, i.e. the whole source without decompression
+  if (load_whole_file_ && uncomp_data_ == reinterpret_cast<const char *>(buffer_->data())) {
+    auto const offsets = source_->record_offsets();
+    if (!offsets.empty()) {
+      CUDF_EXPECTS(offsets.back() < uncomp_size_, "Record offset out of the source");
+      rec_starts_ = offsets;
+      return;
+    }
+  }
+
   std::vector<char> chars_to_count{'\n'};
   // Currently, ignoring lineterminations within quotes is handled by recording the records of both,
   // and then filtering out the records that is a quotechar or a linetermination within a quotechar
@@ -395,7 +628,7 @@ void reader::impl::upload_data_to_device(cudaStream_t stream)
                "Error finding the record within the specified byte range.\n");
 
   // Upload the raw data that is within the rows of interest
-  data_ = rmm::device_buffer(uncomp_data_ + start_offset, bytes_to_upload, stream);
+  data_ = upload_to_device(uncomp_data_ + start_offset, bytes_to_upload, stream);
 }
 
 /**
@@ -439,13 +672,20 @@ void reader::impl::set_column_names(cudaStream_t stream)
   } else {
     int cols_found = 0;
     bool quotation = false;
+    // Delimiters inside nested arrays and objects do not separate columns
+    int depth = 0;
     for (size_t pos = 0; pos < first_row.size(); ++pos) {
       // Flip the quotation flag if current character is a quotechar
       if (first_row[pos] == opts_.quotechar) {
         quotation = !quotation;
+      } else if (!quotation && (first_row[pos] == '[' || first_row[pos] == '{')) {
+        ++depth;
+      } else if (!quotation && (first_row[pos] == ']' || first_row[pos] == '}')) {
+        --depth;
       }
       // Check if end of a column/row
-      else if (pos == first_row.size() - 1 || (!quotation && first_row[pos] == opts_.delimiter)) {
+      if (pos == first_row.size() - 1 ||
+          (!quotation && depth <= 1 && first_row[pos] == opts_.delimiter)) {
         metadata.column_names.emplace_back(std::to_string(cols_found++));
       }
     }
@@ -453,16 +693,27 @@ void reader::impl::set_column_names(cudaStream_t stream)
 }
 
 /**
- * @brief Set the null count to the row count (all fields assumes to be null).
+ * @brief Split the rows into fields and store the value ranges of all columns
+ *
+ * Sets the field_ranges_ data member.
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
-void set_null_count(size_type num_rows,
-                    rmm::device_vector<cudf::io::json::ColumnInfo> &infos,
-                    cudaStream_t stream)
+void reader::impl::set_field_ranges(cudaStream_t stream)
 {
-  thrust::for_each(rmm::exec_policy(stream)->on(stream),
-                   infos.begin(),
-                   infos.end(),
-                   [num_rows] __device__(auto &info) { info.null_count = num_rows; });
+  const auto num_columns = metadata.column_names.size();
+  const auto num_records = rec_starts_.size();
+
+  field_ranges_ =
+    rmm::device_vector<string_pair>(num_columns * num_records, string_pair{nullptr, 0});
+  cudf::io::json::gpu::tokenize_fields(data_,
+                                       rec_starts_.data().get(),
+                                       num_records,
+                                       opts_,
+                                       get_column_map_device_ptr(),
+                                       num_columns,
+                                       field_ranges_.data().get(),
+                                       stream);
 }
 
 /**
@@ -512,37 +763,16 @@ void reader::impl::set_data_types(cudaStream_t stream)
 
     rmm::device_vector<cudf::io::json::ColumnInfo> d_column_infos(num_columns,
                                                                   cudf::io::json::ColumnInfo{});
-    // For object rows, it's not efficient for the kernel to determine which fields are missing in
-    // each row. Set the null count to row count; kernel reduces this value for each valid field.
-    if (key_to_col_idx_map) set_null_count(rec_starts_.size(), d_column_infos, stream);
-
-    cudf::io::json::gpu::detect_data_types(d_column_infos.data().get(),
-                                           static_cast<const char *>(data_.data()),
-                                           data_.size(),
-                                           opts_,
-                                           get_column_map_device_ptr(),
-                                           num_columns,
-                                           rec_starts_.data().get(),
-                                           rec_starts_.size(),
-                                           stream);
+    // Missing and null fields are both stored as null ranges, so all columns are counted alike
+    cudf::io::json::gpu::detect_value_types(field_ranges_.data().get(),
+                                            rec_starts_.size(),
+                                            num_columns,
+                                            opts_,
+                                            d_column_infos.data().get(),
+                                            stream);
     thrust::host_vector<cudf::io::json::ColumnInfo> h_column_infos = d_column_infos;
     for (const auto &cinfo : h_column_infos) {
-      if (cinfo.null_count == static_cast<int>(rec_starts_.size())) {
-        // Entire column is NULL; allocate the smallest amount of memory
-        dtypes_.push_back(data_type(type_id::INT8));
-      } else if (cinfo.string_count > 0) {
-        dtypes_.push_back(data_type(type_id::STRING));
-      } else if (cinfo.datetime_count > 0) {
-        dtypes_.push_back(data_type(type_id::TIMESTAMP_MILLISECONDS));
-      } else if (cinfo.float_count > 0 || (cinfo.int_count > 0 && cinfo.null_count > 0)) {
-        dtypes_.push_back(data_type(type_id::FLOAT64));
-      } else if (cinfo.int_count > 0) {
-        dtypes_.push_back(data_type(type_id::INT64));
-      } else if (cinfo.bool_count > 0) {
-        dtypes_.push_back(data_type(type_id::BOOL8));
-      } else {
-        CUDF_FAIL("Data type detection failed.\n");
-      }
+      dtypes_.push_back(select_data_type(cinfo, rec_starts_.size()));
     }
   }
 }
@@ -558,50 +788,68 @@ table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream)
 {
   const auto num_columns = dtypes_.size();
   const auto num_records = rec_starts_.size();
+  auto const column_values = [&](size_t col) {
+    return field_ranges_.data().get() + col * num_records;
+  };
 
-  // alloc output buffers.
+  // alloc output buffers; nested columns are built directly from the field ranges
+  std::vector<size_t> flat_columns;
   std::vector<column_buffer> out_buffers;
   for (size_t col = 0; col < num_columns; ++col) {
+    if (is_nested(dtypes_[col])) continue;
+    flat_columns.push_back(col);
     out_buffers.emplace_back(dtypes_[col], num_records, true, stream, mr_);
   }
 
-  thrust::host_vector<data_type> h_dtypes(num_columns);
-  thrust::host_vector<void *> h_data(num_columns);
-  thrust::host_vector<bitmask_type *> h_valid(num_columns);
+  thrust::host_vector<string_pair const *> h_values(flat_columns.size());
+  thrust::host_vector<data_type> h_dtypes(flat_columns.size());
+  thrust::host_vector<void *> h_data(flat_columns.size());
+  thrust::host_vector<bitmask_type *> h_valid(flat_columns.size());
 
-  for (size_t i = 0; i < num_columns; ++i) {
-    h_dtypes[i] = dtypes_[i];
+  for (size_t i = 0; i < flat_columns.size(); ++i) {
+    h_values[i] = column_values(flat_columns[i]);
+    h_dtypes[i] = dtypes_[flat_columns[i]];
     h_data[i]   = out_buffers[i].data();
     h_valid[i]  = out_buffers[i].null_mask();
   }
 
+  rmm::device_vector<string_pair const *> d_values = h_values;
   rmm::device_vector<data_type> d_dtypes           = h_dtypes;
   rmm::device_vector<void *> d_data                = h_data;
   rmm::device_vector<cudf::bitmask_type *> d_valid = h_valid;
-  rmm::device_vector<cudf::size_type> d_valid_counts(num_columns, 0);
-
-  cudf::io::json::gpu::convert_json_to_columns(data_,
-                                               d_dtypes.data().get(),
-                                               d_data.data().get(),
-                                               num_records,
-                                               num_columns,
-                                               rec_starts_.data().get(),
-                                               d_valid.data().get(),
-                                               d_valid_counts.data().get(),
-                                               opts_,
-                                               get_column_map_device_ptr(),
-                                               stream);
+  rmm::device_vector<cudf::size_type> d_valid_counts(flat_columns.size(), 0);
+
+  cudf::io::json::gpu::convert_values_to_columns(d_values.data().get(),
+                                                 num_records,
+                                                 d_dtypes.data().get(),
+                                                 opts_,
+                                                 d_data.data().get(),
+                                                 d_valid.data().get(),
+                                                 d_valid_counts.data().get(),
+                                                 flat_columns.size(),
+                                                 stream);
   CUDA_TRY(cudaStreamSynchronize(stream));
   CUDA_TRY(cudaGetLastError());
 
   // postprocess columns
   thrust::host_vector<cudf::size_type> h_valid_counts = d_valid_counts;
   std::vector<std::unique_ptr<column>> out_columns;
+  // Names of struct fields follow their columns' names in pre-order
+  std::vector<std::string> column_names;
+  size_t flat_idx = 0;
   for (size_t i = 0; i < num_columns; ++i) {
-    out_buffers[i].null_count() = num_records - h_valid_counts[i];
+    column_names.push_back(metadata.column_names[i]);
+    if (is_nested(dtypes_[i])) {
+      out_columns.emplace_back(
+        make_column_from_values(column_values(i), num_records, dtypes_[i], column_names, stream));
+    } else {
+      out_buffers[flat_idx].null_count() = num_records - h_valid_counts[flat_idx];
 
-    out_columns.emplace_back(make_column(out_buffers[i]));
+      out_columns.emplace_back(make_column(out_buffers[flat_idx]));
+      ++flat_idx;
+    }
   }
+  metadata.column_names = std::move(column_names);
 
   CUDF_EXPECTS(!out_columns.empty(), "Error converting json input into gdf columns.\n");
 
@@ -655,6 +903,8 @@ table_with_metadata reader::impl::read(size_t range_offset, size_t range_size, c
   set_column_names(stream);
   CUDF_EXPECTS(!metadata.column_names.empty(), "Error determining column names.\n");
 
+  set_field_ranges(stream);
+
   set_data_types(stream);
   CUDF_EXPECTS(!dtypes_.empty(), "Error in data type detection.\n");
 
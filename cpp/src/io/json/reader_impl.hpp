@@ -42,6 +42,7 @@ using namespace cudf::io;
 
 using col_map_type     = cudf::io::json::gpu::col_map_type;
 using col_map_ptr_type = std::unique_ptr<col_map_type, std::function<void(col_map_type *)>>;
+using string_pair      = cudf::io::json::gpu::string_pair;
 
 /**
  * @brief Class used to parse Json input and convert it into gdf columns.
@@ -64,6 +65,8 @@ class reader::impl {
   std::vector<char> uncomp_data_owner_;
   rmm::device_buffer data_;
   rmm::device_vector<uint64_t> rec_starts_;
+  // Ranges of all field values, one column after another; `{nullptr, 0}` for null fields
+  rmm::device_vector<string_pair> field_ranges_;
 
   size_t byte_range_offset_ = 0;
   size_t byte_range_size_   = 0;
@@ -118,6 +121,48 @@ class reader::impl {
   std::pair<std::vector<std::string>, col_map_ptr_type> get_json_object_keys_hashes(
     cudaStream_t stream);
 
+  /**
+   * @brief Extract the keys of JSON objects nested in the input.
+   *
+   * @param[in] objects Ranges of the objects in the input data
+   * @param[in] num_objects The number of objects
+   *
+   * @return Array of keys and a map that maps their hash values to field indices
+   */
+  std::pair<std::vector<std::string>, col_map_ptr_type> get_value_keys_hashes(
+    string_pair const *objects, size_type num_objects, cudaStream_t stream);
+
+  /**
+   * @brief Infers the data type of an array of values, e.g. the elements of list columns.
+   *
+   * @param[in] values Ranges of the values in the input data; `{nullptr, 0}` for null values
+   * @param[in] num_values The number of values
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The inferred data type
+   */
+  data_type infer_value_type(string_pair const *values, size_type num_values, cudaStream_t stream);
+
+  /**
+   * @brief Parse an array of values and store the results in a column.
+   *
+   * List and struct values are tokenized into the values of their child columns, which are built
+   * recursively.
+   *
+   * @param[in] values Ranges of the values in the input data; `{nullptr, 0}` for null values
+   * @param[in] num_values The number of values
+   * @param[in] dtype The data type of the column
+   * @param[in,out] column_names Names of the nested struct fields, in pre-order
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The column
+   */
+  std::unique_ptr<column> make_column_from_values(string_pair const *values,
+                                                  size_type num_values,
+                                                  data_type dtype,
+                                                  std::vector<std::string> &column_names,
+                                                  cudaStream_t stream);
+
   /**
    * @brief Decompress the input data, if needed
    *
@@ -152,6 +197,16 @@ class reader::impl {
    */
   void set_column_names(cudaStream_t stream);
 
+  /**
+   * @brief Split the rows into fields and store the value ranges of all columns
+   *
+   * Sets the field_ranges_ data member. The input is only parsed once; type inference and
+   * conversion operate on the stored ranges.
+   *
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void set_field_ranges(cudaStream_t stream);
+
   /**
    * @brief Set the data type array data member
    *
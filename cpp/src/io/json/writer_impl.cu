@@ -0,0 +1,555 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cu
+ * @brief cuDF-IO JSON writer class implementation
+ */
+
+#include "writer_impl.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/convert/convert_booleans.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <strings/utilities.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+namespace {  // anonym.
+using cudf::strings::detail::copy_string;
+
+/**
+ * @brief Writes the JSON escape sequence of a byte of a UTF-8 string, if `d_buffer` is not null.
+ *
+ * The quote, the backslash and the control characters are escaped; the other bytes, including
+ * those of multi-byte characters, are copied.
+ *
+ * @return The number of bytes of the escape sequence
+ */
+__device__ size_type escape_byte(unsigned char chr, char* d_buffer)
+{
+  char escaped = 0;
+  switch (chr) {
+    case '"': escaped = '"'; break;
+    case '\\': escaped = '\\'; break;
+    case '\b': escaped = 'b'; break;
+    case '\f': escaped = 'f'; break;
+    case '\n': escaped = 'n'; break;
+    case '\r': escaped = 'r'; break;
+    case '\t': escaped = 't'; break;
+    default: break;
+  }
+  if (escaped != 0) {
+    if (d_buffer) {
+      d_buffer[0] = '\\';
+      d_buffer[1] = escaped;
+    }
+    return 2;
+  }
+  if (chr < 0x20) {
+    if (d_buffer) {
+      constexpr char const* hex_digits = "0123456789abcdef";
+      copy_string(d_buffer, string_view("\\u00", 4));
+      d_buffer[4] = hex_digits[chr >> 4];
+      d_buffer[5] = hex_digits[chr & 0xf];
+    }
+    return 6;
+  }
+  if (d_buffer) { d_buffer[0] = static_cast<char>(chr); }
+  return 1;
+}
+
+__device__ string_view null_literal() { return string_view("null", 4); }
+
+// formats each string as a quoted and escaped JSON string;
+// called by `make_strings_children` to size and then to write the output
+//
+struct quote_strings_fn {
+  column_device_view const d_strings;
+  int32_t* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+    auto const d_str = d_strings.element<string_view>(idx);
+    char* d_buffer   = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes  = 2;  // quotes
+    if (d_buffer) *d_buffer++ = '"';
+    for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+      auto const size = escape_byte(static_cast<unsigned char>(d_str.data()[i]), d_buffer);
+      if (d_buffer) d_buffer += size;
+      bytes += size;
+    }
+    if (d_buffer) *d_buffer = '"';
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+// formats each list as a JSON array of the formatted values of its elements
+//
+struct format_lists_fn {
+  column_device_view const d_lists;
+  size_type const* d_list_offsets;    // offsets of the lists of the view into the child
+  column_device_view const d_values;  // formatted elements of the sliced child
+  int32_t* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_lists.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+    auto const base  = d_list_offsets[0];
+    auto const begin = d_list_offsets[idx] - base;
+    auto const end   = d_list_offsets[idx + 1] - base;
+    char* d_buffer   = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes  = 2;  // brackets
+    if (d_buffer) *d_buffer++ = '[';
+    for (size_type i = begin; i < end; ++i) {
+      if (i > begin) {
+        if (d_buffer) *d_buffer++ = ',';
+        ++bytes;
+      }
+      auto const value = d_values.is_null(i) ? null_literal() : d_values.element<string_view>(i);
+      if (d_buffer) d_buffer = copy_string(d_buffer, value);
+      bytes += value.size_bytes();
+    }
+    if (d_buffer) *d_buffer = ']';
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+// formats each row of formatted fields as a JSON object, followed by `terminator`;
+// the rows which are null in `d_parent_mask` are null
+//
+struct format_objects_fn {
+  table_device_view const d_fields;
+  column_device_view const d_keys;  // JSON-encoded keys followed by a colon
+  bitmask_type const* d_parent_mask;
+  size_type const parent_offset;
+  bool const include_nulls;
+  string_view const terminator;
+  int32_t* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_parent_mask && !bit_is_set(d_parent_mask, idx + parent_offset)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+    char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes = 2 + terminator.size_bytes();  // braces
+    if (d_buffer) *d_buffer++ = '{';
+    bool first = true;
+    for (size_type field = 0; field < d_fields.num_columns(); ++field) {
+      auto const& d_field = d_fields.column(field);
+      auto const is_null  = d_field.is_null(idx);
+      if (is_null && !include_nulls) continue;
+      if (!first) {
+        if (d_buffer) *d_buffer++ = ',';
+        ++bytes;
+      }
+      first            = false;
+      auto const key   = d_keys.element<string_view>(field);
+      auto const value = is_null ? null_literal() : d_field.element<string_view>(idx);
+      if (d_buffer) d_buffer = copy_string(copy_string(d_buffer, key), value);
+      bytes += key.size_bytes() + value.size_bytes();
+    }
+    if (d_buffer) copy_string(copy_string(d_buffer, string_view("}", 1)), terminator);
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+/**
+ * @brief Builds a strings column of `size` rows with a formatter called by
+ * `make_strings_children`.
+ */
+template <typename Formatter>
+std::unique_ptr<column> make_json_strings(Formatter formatter,
+                                          size_type size,
+                                          rmm::device_buffer&& null_mask,
+                                          size_type null_count,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  auto children =
+    cudf::strings::detail::make_strings_children(formatter, size, null_count, mr, stream);
+  return make_strings_column(size,
+                             std::move(children.first),
+                             std::move(children.second),
+                             null_count,
+                             std::move(null_mask),
+                             stream,
+                             mr);
+}
+
+/**
+ * @brief Returns the JSON-encoded key of each name, followed by a colon.
+ */
+std::unique_ptr<column> make_json_keys(std::vector<std::string> const& names,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  std::vector<char> chars;
+  std::vector<size_type> offsets{0};
+  for (auto const& name : names) {
+    chars.push_back('"');
+    for (unsigned char chr : name) {
+      char escaped[6];
+      auto const size = (chr == '"' || chr == '\\') ? 2 : (chr < 0x20 ? 6 : 1);
+      if (size == 1) {
+        escaped[0] = chr;
+      } else if (size == 2) {
+        escaped[0] = '\\';
+        escaped[1] = chr;
+      } else {
+        snprintf(escaped, sizeof(escaped), "\\u%04x", chr);
+      }
+      chars.insert(chars.end(), escaped, escaped + size);
+    }
+    chars.push_back('"');
+    chars.push_back(':');
+    offsets.push_back(static_cast<size_type>(chars.size()));
+  }
+  return make_strings_column(chars, offsets, {}, 0, stream, mr);
+}
+
+/**
+ * @brief Returns the names of the fields of the objects of a struct column, their indices.
+ */
+std::vector<std::string> field_indices(size_type num_fields)
+{
+  std::vector<std::string> names(num_fields);
+  for (size_type i = 0; i < num_fields; ++i) { names[i] = std::to_string(i); }
+  return names;
+}
+
+std::unique_ptr<column> to_json_values(column_view const& column,
+                                       bool include_nulls,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream);
+
+std::unique_ptr<column> quote_strings(column_view const& strings,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  auto d_strings = column_device_view::create(strings, stream);
+  return make_json_strings(quote_strings_fn{*d_strings},
+                           strings.size(),
+                           copy_bitmask(strings, stream, mr),
+                           strings.null_count(),
+                           mr,
+                           stream);
+}
+
+std::unique_ptr<column> format_lists(column_view const& lists,
+                                     bool include_nulls,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  lists_column_view const lists_view(lists);
+  auto values   = to_json_values(lists_view.get_sliced_child(stream), include_nulls, mr, stream);
+  auto d_lists  = column_device_view::create(lists, stream);
+  auto d_values = column_device_view::create(values->view(), stream);
+  return make_json_strings(
+    format_lists_fn{
+      *d_lists, lists_view.offsets().data<size_type>() + lists_view.offset(), *d_values},
+    lists.size(),
+    copy_bitmask(lists, stream, mr),
+    lists.null_count(),
+    mr,
+    stream);
+}
+
+/**
+ * @brief Formats the rows of `fields` as JSON objects keyed by `keys`.
+ */
+std::unique_ptr<column> format_objects(table_view const& fields,
+                                       column_view const& keys,
+                                       bitmask_type const* parent_mask,
+                                       size_type parent_offset,
+                                       rmm::device_buffer&& null_mask,
+                                       size_type null_count,
+                                       bool include_nulls,
+                                       string_view terminator,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  auto d_fields = table_device_view::create(fields, stream);
+  auto d_keys   = column_device_view::create(keys, stream);
+  return make_json_strings(
+    format_objects_fn{
+      *d_fields, *d_keys, parent_mask, parent_offset, include_nulls, terminator},
+    fields.num_rows(),
+    std::move(null_mask),
+    null_count,
+    mr,
+    stream);
+}
+
+std::unique_ptr<column> format_structs(column_view const& structs,
+                                       bool include_nulls,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  structs_column_view const structs_view(structs);
+  std::vector<std::unique_ptr<column>> fields;
+  std::vector<column_view> field_views;
+  for (size_type i = 0; i < structs_view.num_children(); ++i) {
+    fields.push_back(to_json_values(structs_view.get_sliced_child(i), include_nulls, mr, stream));
+    field_views.push_back(fields.back()->view());
+  }
+  auto const keys = make_json_keys(field_indices(structs_view.num_children()), mr, stream);
+  return format_objects(table_view{field_views},
+                        keys->view(),
+                        structs.null_mask(),
+                        structs.offset(),
+                        copy_bitmask(structs, stream, mr),
+                        structs.null_count(),
+                        include_nulls,
+                        string_view{},
+                        mr,
+                        stream);
+}
+
+// converts the columns which are not strings, booleans or nested to their JSON values
+//
+struct to_json_values_fn {
+  // ints:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_integral<column_type>::value && !std::is_same<column_type, bool>::value,
+                   std::unique_ptr<column>>
+  operator()(column_view const& column,
+             rmm::mr::device_memory_resource* mr,
+             cudaStream_t stream) const
+  {
+    return cudf::strings::from_integers(column, mr);
+  }
+
+  // floats: NaN and infinities are not JSON numbers, so they are written as null
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_floating_point<column_type>::value, std::unique_ptr<column>> operator()(
+    column_view const& column, rmm::mr::device_memory_resource* mr, cudaStream_t stream) const
+  {
+    auto values   = cudf::strings::from_floats(column, mr);
+    auto d_column = column_device_view::create(column, stream);
+    auto finite   = cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(column.size()),
+      [d_column = *d_column] __device__(size_type idx) {
+        return d_column.is_valid(idx) && isfinite(d_column.element<column_type>(idx));
+      },
+      stream,
+      mr);
+    values->set_null_mask(std::move(finite.first), finite.second);
+    return values;
+  }
+
+  // timestamps:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_timestamp<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column, rmm::mr::device_memory_resource* mr, cudaStream_t stream) const
+  {
+    auto values = cudf::strings::from_timestamps(column, "%Y-%m-%dT%H:%M:%SZ", mr);
+    return quote_strings(values->view(), mr, stream);
+  }
+
+  // unsupported type of column:
+  //
+  template <typename column_type>
+  std::enable_if_t<!std::is_integral<column_type>::value &&
+                     !std::is_floating_point<column_type>::value &&
+                     !cudf::is_timestamp<column_type>(),
+                   std::unique_ptr<column>>
+  operator()(column_view const& column,
+             rmm::mr::device_memory_resource* mr,
+             cudaStream_t stream) const
+  {
+    CUDF_FAIL("Unsupported column type.");
+  }
+};
+
+/**
+ * @brief Converts a column to a strings column of the JSON values of its rows.
+ *
+ * The null rows stay null.
+ */
+std::unique_ptr<column> to_json_values(column_view const& column,
+                                       bool include_nulls,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  if (column.size() == 0) { return cudf::strings::detail::make_empty_strings_column(mr, stream); }
+  switch (column.type().id()) {
+    case type_id::STRING: return quote_strings(column, mr, stream);
+    case type_id::BOOL8:
+      return cudf::strings::from_booleans(column, std::string{"true"}, std::string{"false"}, mr);
+    case type_id::LIST: return format_lists(column, include_nulls, mr, stream);
+    case type_id::STRUCT: return format_structs(column, include_nulls, mr, stream);
+    default: return type_dispatcher(column.type(), to_json_values_fn{}, column, mr, stream);
+  }
+}
+
+}  // unnamed namespace
+
+// Forward to implementation
+writer::writer(std::unique_ptr<data_sink> sink,
+               writer_options const& options,
+               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(std::move(sink), options, mr))
+{
+}
+
+// Destructor within this translation unit
+writer::~writer() = default;
+
+writer::impl::impl(std::unique_ptr<data_sink> sink,
+                   writer_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : out_sink_(std::move(sink)), mr_(mr), options_(options)
+{
+}
+
+void writer::impl::write_chunk(table_view const& table,
+                               column_view const& keys,
+                               cudaStream_t stream)
+{
+  // algorithm outline:
+  //
+  //  values  = convert each column to the JSON values of its rows;
+  //  records = format the values of each row as an object, followed by a newline;
+  //
+  // so that the chars of the records are the whole chunk in one contiguous device buffer,
+  // which is then handed to the sink in a single write;
+  //
+  CUDF_EXPECTS(table.num_rows() > 0, "Unexpected empty table.");
+  CUDF_SCOPED_RANGE_PAYLOAD("json::format_rows", table.num_rows());
+
+  std::vector<std::unique_ptr<column>> values;
+  std::vector<column_view> value_views;
+  for (auto const& column : table) {
+    values.push_back(to_json_values(column, options_.include_nulls(), mr_, stream));
+    value_views.push_back(values.back()->view());
+  }
+
+  cudf::string_scalar newline{"\n", true, stream};
+  auto records = format_objects(table_view{value_views},
+                                keys,
+                                nullptr,
+                                0,
+                                rmm::device_buffer{0, stream, mr_},
+                                0,
+                                options_.include_nulls(),
+                                newline.value(stream),
+                                mr_,
+                                stream);
+
+  auto const chars           = records->child(strings_column_view::chars_column_index).view();
+  auto const ptr_all_bytes   = chars.data<char>();
+  size_t const total_num_bytes = chars.size();
+
+  CUDF_SCOPED_RANGE_PAYLOAD("json::write_sink", total_num_bytes);
+  if (out_sink_->supports_device_write()) {
+    out_sink_->device_write(ptr_all_bytes, total_num_bytes, stream);
+  } else {
+    thrust::host_vector<char> h_bytes(total_num_bytes);
+    CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
+                             ptr_all_bytes,
+                             total_num_bytes * sizeof(char),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    out_sink_->host_write(h_bytes.data(), total_num_bytes);
+  }
+}
+
+void writer::impl::write(table_view const& table,
+                         const table_metadata* metadata,
+                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(table.num_columns() > 0, "Empty table.");
+  CUDF_EXPECTS(options_.rows_per_chunk() > 0, "write_json: invalid chunk_rows; must be positive");
+
+  auto const names = [&]() {
+    if (metadata == nullptr || metadata->column_names.empty()) {
+      return field_indices(table.num_columns());
+    }
+    CUDF_EXPECTS(metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
+                 "Mismatch between number of column names and table columns.");
+    return metadata->column_names;
+  }();
+  auto const keys = make_json_keys(names, mr_, stream);
+
+  // format the records in chunks of rows to bound the size of the buffers
+  //
+  std::vector<size_type> splits;
+  for (size_type row = options_.rows_per_chunk(); row < table.num_rows();
+       row += std::min(options_.rows_per_chunk(), table.num_rows() - row)) {
+    splits.push_back(row);
+  }
+  for (auto const& chunk : cudf::split(table, splits)) {
+    if (chunk.num_rows() > 0) { write_chunk(chunk, keys->view(), stream); }
+  }
+}
+
+void writer::write_all(table_view const& table, const table_metadata* metadata, cudaStream_t stream)
+{
+  _impl->write(table, metadata, stream);
+}
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
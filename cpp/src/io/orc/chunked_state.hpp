@@ -24,12 +24,14 @@
 #include "orc.h"
 
 #include <cudf/io/data_sink.hpp>
+#include <cudf/io/readers.hpp>
 #include <cudf/io/writers.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -58,6 +60,28 @@ struct orc_chunked_state {
   /// special parameter only used by detail::write() to indicate that we are guaranteeing
   /// a single table write.  this enables some internal optimizations.
   bool single_write_mode = false;
+  /// whether write_chunked() buffers the chunks until they fill a stripe
+  bool coalesce_chunks = true;
+  /// chunks buffered by write_chunked() until they fill a stripe. owned copies, since the caller's
+  /// tables may be released as soon as write_chunked() returns
+  std::vector<std::unique_ptr<table>> pending_tables;
+  /// estimated uncompressed size of the buffered chunks
+  size_t pending_bytes = 0;
+};
+
+/**
+ * @brief Chunked reader state struct. Keeps the reader, and the footer it parsed, across the
+ *        read_orc_chunked() calls.
+ */
+struct orc_chunked_read_state {
+  /// The reader to be used
+  std::unique_ptr<reader> rp;
+  /// Cuda stream to be used
+  cudaStream_t stream = 0;
+  /// Ranges of rows (skip_rows, num_rows) returned by each read
+  std::vector<std::pair<size_type, size_type>> row_ranges;
+  /// Index of the next range to read
+  std::size_t next_range = 0;
 };
 
 }  // namespace orc
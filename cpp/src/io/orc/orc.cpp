@@ -111,6 +111,96 @@ void ProtobufReader::skip_struct_field(int t)
     break;                                       \
   }
 
+#define ORC_FLD_PACKED_UINT64(id, m)                     \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {                      \
+    uint32_t len           = get_u32();                  \
+    const uint8_t *fld_end = std::min(m_cur + len, end); \
+    while (m_cur < fld_end) s->m.push_back(get_u64());   \
+    break;                                               \
+  }
+
+// Repeated fixed64 field, either packed or with one key per value
+#define ORC_FLD_REPEATED_FIXED64(id, m)          \
+  case (id)*8 + PB_TYPE_FIXED64: {               \
+    if (end - m_cur < 8) return false;           \
+    uint64_t v;                                  \
+    memcpy(&v, m_cur, 8);                        \
+    s->m.push_back(v);                           \
+    m_cur += 8;                                  \
+    break;                                       \
+  }                                              \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {              \
+    uint32_t n = get_u32();                      \
+    if (n > (size_t)(end - m_cur)) return false; \
+    for (uint32_t i = 0; i + 8 <= n; i += 8) {   \
+      uint64_t v;                                \
+      memcpy(&v, m_cur + i, 8);                  \
+      s->m.push_back(v);                         \
+    }                                            \
+    m_cur += n;                                  \
+    break;                                       \
+  }
+
+// Optional fields that also record their presence in `has_<m>`
+#define ORC_FLD_OPTIONAL_UINT64(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:        \
+    s->m       = get_u64();            \
+    s->has_##m = true;                 \
+    break;
+
+#define ORC_FLD_OPTIONAL_INT64(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:       \
+    s->m       = get_i64();           \
+    s->has_##m = true;                \
+    break;
+
+#define ORC_FLD_OPTIONAL_INT32(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:       \
+    s->m       = get_i32();           \
+    s->has_##m = true;                \
+    break;
+
+#define ORC_FLD_OPTIONAL_BOOL(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:      \
+    s->m       = get_u32() != 0;     \
+    s->has_##m = true;               \
+    break;
+
+#define ORC_FLD_OPTIONAL_DOUBLE(id, m) \
+  case (id)*8 + PB_TYPE_FIXED64:       \
+    if (end - m_cur < 8) return false; \
+    memcpy(&s->m, m_cur, 8);           \
+    m_cur += 8;                        \
+    s->has_##m = true;                 \
+    break;
+
+#define ORC_FLD_OPTIONAL_STRING(id, m)           \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {              \
+    uint32_t n = get_u32();                      \
+    if (n > (size_t)(end - m_cur)) return false; \
+    s->m.assign((const char *)m_cur, n);         \
+    m_cur += n;                                  \
+    s->has_##m = true;                           \
+    break;                                       \
+  }
+
+#define ORC_FLD_STRUCT(id, m)                    \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {              \
+    uint32_t n = get_u32();                      \
+    if (n > (size_t)(end - m_cur)) return false; \
+    if (!read(&s->m, n)) return false;           \
+    break;                                       \
+  }
+
+#define ORC_FLD_OPTIONAL_STRUCT(id, m)           \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {              \
+    uint32_t n = get_u32();                      \
+    if (n > (size_t)(end - m_cur)) return false; \
+    if (!read(&s->m, n)) return false;           \
+    s->has_##m = true;                           \
+    break;                                       \
+  }
+
 #define ORC_END_STRUCT_(postproccond)                                    \
   default: /*printf("unknown fld %d of type %d\n", fld >> 3, fld & 7);*/ \
            skip_struct_field(fld & 7);                                   \
@@ -189,6 +279,69 @@ ORC_BEGIN_STRUCT(Metadata)
 ORC_FLD_REPEATED_STRUCT(1, stripeStats)
 ORC_END_STRUCT()
 
+ORC_BEGIN_STRUCT(IntegerStatistics)
+ORC_FLD_OPTIONAL_INT64(1, minimum)
+ORC_FLD_OPTIONAL_INT64(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(DoubleStatistics)
+ORC_FLD_OPTIONAL_DOUBLE(1, minimum)
+ORC_FLD_OPTIONAL_DOUBLE(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(StringStatistics)
+ORC_FLD_OPTIONAL_STRING(1, minimum)
+ORC_FLD_OPTIONAL_STRING(2, maximum)
+ORC_FLD_OPTIONAL_STRING(4, lowerBound)
+ORC_FLD_OPTIONAL_STRING(5, upperBound)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(BucketStatistics)
+ORC_FLD_PACKED_UINT64(1, count)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(DateStatistics)
+ORC_FLD_OPTIONAL_INT32(1, minimum)
+ORC_FLD_OPTIONAL_INT32(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(TimestampStatistics)
+ORC_FLD_OPTIONAL_INT64(1, minimum)
+ORC_FLD_OPTIONAL_INT64(2, maximum)
+ORC_FLD_OPTIONAL_INT64(3, minimumUtc)
+ORC_FLD_OPTIONAL_INT64(4, maximumUtc)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(DecodedColumnStatistics)
+ORC_FLD_OPTIONAL_UINT64(1, numberOfValues)
+ORC_FLD_STRUCT(2, intStatistics)
+ORC_FLD_STRUCT(3, doubleStatistics)
+ORC_FLD_STRUCT(4, stringStatistics)
+ORC_FLD_STRUCT(5, bucketStatistics)
+ORC_FLD_STRUCT(7, dateStatistics)
+ORC_FLD_STRUCT(9, timestampStatistics)
+ORC_FLD_OPTIONAL_BOOL(10, hasNull)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(RowIndexEntry)
+ORC_FLD_PACKED_UINT64(1, positions)
+ORC_FLD_OPTIONAL_STRUCT(2, statistics)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(RowIndex)
+ORC_FLD_REPEATED_STRUCT(1, entry)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(BloomFilter)
+ORC_FLD_UINT32(1, numHashFunctions)
+ORC_FLD_REPEATED_FIXED64(2, bitset)
+ORC_FLD_STRING(3, utf8bitset)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(BloomFilterIndex)
+ORC_FLD_REPEATED_STRUCT(1, bloomFilter)
+ORC_END_STRUCT()
+
 // return the column name
 std::string FileFooter::GetColumnName(uint32_t column_id)
 {
@@ -431,6 +584,15 @@ PBW_BEGIN_STRUCT(Metadata)
 PBW_FLD_REPEATED_STRUCT(1, stripeStats)
 PBW_END_STRUCT()
 
+PBW_BEGIN_STRUCT(BloomFilter)
+PBW_FLD_UINT(1, numHashFunctions)
+PBW_FLD_STRING(3, utf8bitset)
+PBW_END_STRUCT()
+
+PBW_BEGIN_STRUCT(BloomFilterIndex)
+PBW_FLD_REPEATED_STRUCT(1, bloomFilter)
+PBW_END_STRUCT()
+
 /* ----------------------------------------------------------------------------*/
 /**
  * @Brief ORC decompression class
@@ -454,7 +616,10 @@ OrcDecompressor::OrcDecompressor(CompressionKind kind, uint32_t blockSize)
         break;
       case LZO: stream_type = IO_UNCOMP_STREAM_TYPE_LZO; break;
       case LZ4: stream_type = IO_UNCOMP_STREAM_TYPE_LZ4; break;
-      case ZSTD: stream_type = IO_UNCOMP_STREAM_TYPE_ZSTD; break;
+      case ZSTD:
+        stream_type    = IO_UNCOMP_STREAM_TYPE_ZSTD;
+        m_log2MaxRatio = 15;  // < 32768:1 (RLE blocks)
+        break;
     }
     m_decompressor = HostDecompressor::Create(stream_type);
   } else {
@@ -105,6 +105,87 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+// Decoded column statistics; optional fields are only set if the matching has_* flag is true
+struct IntegerStatistics {
+  int64_t minimum  = 0;
+  int64_t maximum  = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct DoubleStatistics {
+  double minimum   = 0;
+  double maximum   = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct StringStatistics {
+  std::string minimum;
+  std::string maximum;
+  std::string lowerBound;  // truncated lower bound, written instead of a long minimum
+  std::string upperBound;  // truncated upper bound, written instead of a long maximum
+  bool has_minimum    = false;
+  bool has_maximum    = false;
+  bool has_lowerBound = false;
+  bool has_upperBound = false;
+};
+
+struct BucketStatistics {
+  std::vector<uint64_t> count;  // for booleans, the number of true values
+};
+
+struct DateStatistics {
+  int32_t minimum  = 0;  // days since epoch
+  int32_t maximum  = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct TimestampStatistics {
+  int64_t minimum     = 0;  // milliseconds since epoch, in the writer's local time
+  int64_t maximum     = 0;
+  int64_t minimumUtc  = 0;  // milliseconds since UNIX epoch
+  int64_t maximumUtc  = 0;
+  bool has_minimum    = false;
+  bool has_maximum    = false;
+  bool has_minimumUtc = false;
+  bool has_maximumUtc = false;
+};
+
+struct DecodedColumnStatistics {
+  uint64_t numberOfValues = 0;  // the number of non-null values
+  IntegerStatistics intStatistics;
+  DoubleStatistics doubleStatistics;
+  StringStatistics stringStatistics;
+  BucketStatistics bucketStatistics;
+  DateStatistics dateStatistics;
+  TimestampStatistics timestampStatistics;
+  bool hasNull            = false;
+  bool has_numberOfValues = false;
+  bool has_hasNull        = false;
+};
+
+struct RowIndexEntry {
+  std::vector<uint64_t> positions;     // the stream positions of the row group
+  DecodedColumnStatistics statistics;  // the statistics of the row group
+  bool has_statistics = false;
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // one entry per row group
+};
+
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;
+  std::vector<uint64_t> bitset;  // bitset of BLOOM_FILTER streams
+  std::string utf8bitset;        // little-endian bitset of BLOOM_FILTER_UTF8 streams
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // one filter per row group
+};
+
 // Minimal protobuf reader for orc metadata
 
 /**
@@ -170,6 +251,17 @@ class ProtobufReader {
   DECL_ORC_STRUCT(ColumnEncoding);
   DECL_ORC_STRUCT(StripeStatistics);
   DECL_ORC_STRUCT(Metadata);
+  DECL_ORC_STRUCT(IntegerStatistics);
+  DECL_ORC_STRUCT(DoubleStatistics);
+  DECL_ORC_STRUCT(StringStatistics);
+  DECL_ORC_STRUCT(BucketStatistics);
+  DECL_ORC_STRUCT(DateStatistics);
+  DECL_ORC_STRUCT(TimestampStatistics);
+  DECL_ORC_STRUCT(DecodedColumnStatistics);
+  DECL_ORC_STRUCT(RowIndexEntry);
+  DECL_ORC_STRUCT(RowIndex);
+  DECL_ORC_STRUCT(BloomFilter);
+  DECL_ORC_STRUCT(BloomFilterIndex);
 #undef DECL_ORC_STRUCT
  protected:
   bool InitSchema(FileFooter *);
@@ -225,6 +317,8 @@ class ProtobufWriter {
   DECL_PBW_STRUCT(ColumnEncoding);
   DECL_PBW_STRUCT(StripeStatistics);
   DECL_PBW_STRUCT(Metadata);
+  DECL_PBW_STRUCT(BloomFilter);
+  DECL_PBW_STRUCT(BloomFilterIndex);
 #undef DECL_PBW_STRUCT
  protected:
   std::vector<uint8_t> *m_buf;
@@ -20,6 +20,8 @@
 #include <io/comp/gpuinflate.h>
 #include <io/statistics/column_stats.h>
 
+#include <cudf/types.hpp>
+
 namespace cudf {
 namespace io {
 namespace orc {
@@ -69,6 +71,62 @@ struct nvstrdesc_s {
   size_t count;
 };
 
+/**
+ * @brief Hash of integer values in bloom filters (Thomas Wang's 64-bit mix)
+ *
+ * Floating-point values are hashed as the bits of their double-precision value.
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_filter_long_hash(int64_t value)
+{
+  // Right shifts are arithmetic, as in the reference implementation
+  auto key = static_cast<uint64_t>(value);
+  key      = ~key + (key << 21);
+  key      = key ^ static_cast<uint64_t>(static_cast<int64_t>(key) >> 24);
+  key      = (key + (key << 3)) + (key << 8);
+  key      = key ^ static_cast<uint64_t>(static_cast<int64_t>(key) >> 14);
+  key      = (key + (key << 2)) + (key << 4);
+  key      = key ^ static_cast<uint64_t>(static_cast<int64_t>(key) >> 28);
+  key      = key + (key << 31);
+  return key;
+}
+
+/**
+ * @brief Hash of string values in bloom filters (64-bit Murmur3, as implemented by ORC)
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_filter_string_hash(const uint8_t *data, size_t len)
+{
+  constexpr uint64_t c1   = 0x87c37b91114253d5ull;
+  constexpr uint64_t c2   = 0x4cf5ad432745937full;
+  constexpr uint64_t seed = 104729;
+
+  uint64_t hash = seed;
+  size_t pos    = 0;
+  for (; pos + 8 <= len; pos += 8) {
+    uint64_t k = 0;
+    for (int b = 7; b >= 0; --b) { k = (k << 8) | data[pos + b]; }
+    k *= c1;
+    k = (k << 31) | (k >> 33);
+    k *= c2;
+    hash ^= k;
+    hash = ((hash << 27) | (hash >> 37)) * 5 + 0x52dce729;
+  }
+  if (pos < len) {
+    uint64_t k = 0;
+    for (size_t b = len; b > pos; --b) { k = (k << 8) | data[b - 1]; }
+    k *= c1;
+    k = (k << 31) | (k >> 33);
+    k *= c2;
+    hash ^= k;
+  }
+  hash ^= len;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
 /**
  * @brief Struct to describe a single entry in the global dictionary
  **/
@@ -124,9 +182,13 @@ struct EncChunk {
   uint32_t strm_len[CI_NUM_STREAMS];  // in: max length, out: actual length
   const uint32_t *valid_map_base;     // base ptr of input valid bit map
   const void *column_data_base;       // base ptr of input column data
+  const nvstrdesc_s *string_data;     // strings of string columns, regardless of the encoding
+  uint32_t *bloom_filter;             // bloom filter bitset of this chunk (null if none)
   uint32_t start_row;                 // start row of this chunk
   uint32_t num_rows;                  // number of rows in this chunk
   uint32_t valid_rows;                // max number of valid rows
+  uint32_t bloom_filter_bits;         // number of bits of the bloom filter
+  uint32_t bloom_filter_hashes;       // number of hash functions of the bloom filter
   uint8_t encoding_kind;              // column encoding kind (orc::ColumnEncodingKind)
   uint8_t type_kind;                  // column data type (orc::TypeKind)
   uint8_t dtype_len;                  // data type length
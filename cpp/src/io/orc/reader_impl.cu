@@ -23,16 +23,38 @@
 #include "timezone.h"
 
 #include <io/comp/gpuinflate.h>
-
+#include <io/utilities/column_predicate.hpp>
+#include <io/utilities/device_read_pipeline.hpp>
+#include <io/utilities/footer_statistics.hpp>
+#include <io/utilities/metadata_cache.hpp>
+#include <io/utilities/strings_dictionary.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <tuple>
 
 namespace cudf {
 namespace io {
@@ -49,7 +71,8 @@ namespace {
 constexpr type_id to_type_id(const orc::SchemaType &schema,
                              bool use_np_dtypes,
                              type_id timestamp_type_id,
-                             bool decimals_as_float)
+                             bool decimals_as_float,
+                             bool decimals_as_fixed_point)
 {
   switch (schema.kind) {
     case orc::BOOLEAN: return type_id::BOOL8;
@@ -72,8 +95,14 @@ constexpr type_id to_type_id(const orc::SchemaType &schema,
       // There isn't a (DAYS -> np.dtype) mapping
       return (use_np_dtypes) ? type_id::TIMESTAMP_MILLISECONDS : type_id::TIMESTAMP_DAYS;
     case orc::DECIMAL:
-      // There isn't an arbitrary-precision type in cuDF, so map as float or int
+      // There isn't an arbitrary-precision type in cuDF, so map as fixed_point, float or int
+      if (decimals_as_fixed_point) { return type_id::DECIMAL64; }
       return (decimals_as_float) ? type_id::FLOAT64 : type_id::INT64;
+    case orc::LIST:
+    case orc::MAP:
+      // Maps are read as lists of key-value structs
+      return type_id::LIST;
+    case orc::STRUCT: return type_id::STRUCT;
     default: break;
   }
 
@@ -118,6 +147,269 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
   }
 }
 
+/**
+ * @brief Evaluates a predicate against the min/max statistics of an integer-like column
+ */
+bool int_range_may_satisfy(host_predicate const &pred,
+                           int64_t min,
+                           int64_t max,
+                           int64_t ns_per_tick = 0)
+{
+  int64_t lo, hi;
+  if (!literal_bounds(pred.value, ns_per_tick, lo, hi)) return true;
+  return range_may_satisfy<int64_t>(pred.op, min, max, lo, hi);
+}
+
+/**
+ * @brief Decodes the min/max of a column's statistics into host-side literals
+ *
+ * `min` and `max` are left unchanged if the statistics do not include them.
+ */
+void decode_minmax(orc::SchemaType const &type,
+                   orc::DecodedColumnStatistics const &stats,
+                   predicate_literal &min,
+                   predicate_literal &max)
+{
+  auto const set_signed = [&](int64_t min_value, int64_t max_value, int64_t ns_per_tick) {
+    min.kind        = literal_kind::SIGNED;
+    min.int_val     = min_value;
+    min.ns_per_tick = ns_per_tick;
+    max.kind        = literal_kind::SIGNED;
+    max.int_val     = max_value;
+    max.ns_per_tick = ns_per_tick;
+  };
+
+  switch (type.kind) {
+    case orc::BOOLEAN: {
+      auto const &counts = stats.bucketStatistics.count;
+      if (counts.empty() || !stats.has_numberOfValues || stats.numberOfValues == 0) return;
+      min.kind     = literal_kind::UNSIGNED;
+      min.uint_val = (counts[0] == stats.numberOfValues) ? 1 : 0;
+      max.kind     = literal_kind::UNSIGNED;
+      max.uint_val = (counts[0] > 0) ? 1 : 0;
+      return;
+    }
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG: {
+      auto const &is = stats.intStatistics;
+      if (is.has_minimum && is.has_maximum) { set_signed(is.minimum, is.maximum, 0); }
+      return;
+    }
+    case orc::DATE: {
+      constexpr int64_t ns_per_day = 86400000000000ll;
+      // Some writers store dates as integer statistics
+      auto const &ds = stats.dateStatistics;
+      auto const &is = stats.intStatistics;
+      if (ds.has_minimum && ds.has_maximum) {
+        set_signed(ds.minimum, ds.maximum, ns_per_day);
+      } else if (is.has_minimum && is.has_maximum) {
+        set_signed(is.minimum, is.maximum, ns_per_day);
+      }
+      return;
+    }
+    case orc::TIMESTAMP: {
+      // Only the UTC values match the decoded timestamps; they are truncated to milliseconds
+      auto const &ts = stats.timestampStatistics;
+      if (ts.has_minimumUtc && ts.has_maximumUtc) {
+        set_signed(ts.minimumUtc, ts.maximumUtc, 1000000);
+      }
+      return;
+    }
+    case orc::FLOAT:
+    case orc::DOUBLE: {
+      auto const &ds = stats.doubleStatistics;
+      if (!ds.has_minimum || !ds.has_maximum) return;
+      min.kind   = literal_kind::FLOAT;
+      min.fp_val = ds.minimum;
+      max.kind   = literal_kind::FLOAT;
+      max.fp_val = ds.maximum;
+      return;
+    }
+    case orc::STRING:
+    case orc::VARCHAR:
+    case orc::CHAR: {
+      // Truncated bounds are not values of the column
+      auto const &ss = stats.stringStatistics;
+      if (!ss.has_minimum || !ss.has_maximum) return;
+      min.kind    = literal_kind::STRING;
+      min.str_val = ss.minimum;
+      max.kind    = literal_kind::STRING;
+      max.str_val = ss.maximum;
+      return;
+    }
+    default: return;
+  }
+}
+
+/**
+ * @brief Determines whether a column may contain values satisfying a predicate, given the
+ * statistics of a range of its rows
+ *
+ * @param pred Predicate to evaluate
+ * @param type Schema of the column
+ * @param stats Decoded statistics of the range
+ * @param num_rows Number of rows in the range; negative if the null count cannot be derived
+ *
+ * @return `false` only if no row in the range can satisfy the predicate
+ */
+bool stats_may_satisfy(host_predicate const &pred,
+                       orc::SchemaType const &type,
+                       orc::DecodedColumnStatistics const &stats,
+                       int64_t num_rows)
+{
+  int64_t null_count = -1;
+  if (num_rows >= 0) {
+    if (stats.has_numberOfValues) {
+      null_count = std::max<int64_t>(0, num_rows - static_cast<int64_t>(stats.numberOfValues));
+    } else if (stats.has_hasNull && !stats.hasNull) {
+      null_count = 0;
+    }
+  }
+  if (!null_count_may_satisfy(pred.op, null_count, num_rows)) return false;
+  if (pred.op == filter_op::IS_NULL || pred.op == filter_op::IS_NOT_NULL) return true;
+  // Comparisons are never true for null values
+  if (stats.has_numberOfValues && stats.numberOfValues == 0) return false;
+
+  switch (type.kind) {
+    case orc::BOOLEAN: {
+      auto const &counts = stats.bucketStatistics.count;
+      if (counts.empty() || !stats.has_numberOfValues) return true;
+      uint64_t lo, hi;
+      if (!literal_bounds(pred.value, lo, hi)) return true;
+      uint64_t const min = (counts[0] == stats.numberOfValues) ? 1 : 0;
+      uint64_t const max = (counts[0] > 0) ? 1 : 0;
+      return range_may_satisfy<uint64_t>(pred.op, min, max, lo, hi);
+    }
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG: {
+      auto const &is = stats.intStatistics;
+      if (!is.has_minimum || !is.has_maximum) return true;
+      return int_range_may_satisfy(pred, is.minimum, is.maximum);
+    }
+    case orc::DATE: {
+      constexpr int64_t ns_per_day = 86400000000000ll;
+      // Some writers store dates as integer statistics
+      auto const &ds = stats.dateStatistics;
+      auto const &is = stats.intStatistics;
+      if (ds.has_minimum && ds.has_maximum) {
+        return int_range_may_satisfy(pred, ds.minimum, ds.maximum, ns_per_day);
+      }
+      if (is.has_minimum && is.has_maximum) {
+        return int_range_may_satisfy(pred, is.minimum, is.maximum, ns_per_day);
+      }
+      return true;
+    }
+    case orc::TIMESTAMP: {
+      // Only the UTC values match the decoded timestamps. They are truncated to milliseconds, so
+      // the range is widened by one millisecond on both ends.
+      auto const &ts = stats.timestampStatistics;
+      if (!ts.has_minimumUtc || !ts.has_maximumUtc) return true;
+      return int_range_may_satisfy(pred, ts.minimumUtc - 1, ts.maximumUtc + 1, 1000000);
+    }
+    case orc::FLOAT:
+    case orc::DOUBLE: {
+      // NaN values are not included in the min/max and are not equal to anything
+      auto const &ds = stats.doubleStatistics;
+      if (!ds.has_minimum || !ds.has_maximum || pred.op == filter_op::NOT_EQUAL) return true;
+      if (std::isnan(ds.minimum) || std::isnan(ds.maximum)) return true;
+      double lo, hi;
+      if (!literal_bounds(pred.value, lo, hi)) return true;
+      return range_may_satisfy<double>(pred.op, ds.minimum, ds.maximum, lo, hi);
+    }
+    case orc::STRING:
+    case orc::VARCHAR:
+    case orc::CHAR: {
+      // Truncated bounds are not values of the column
+      auto const &ss      = stats.stringStatistics;
+      auto const has_min  = ss.has_minimum || ss.has_lowerBound;
+      auto const has_max  = ss.has_maximum || ss.has_upperBound;
+      auto const is_exact = ss.has_minimum && ss.has_maximum;
+      if (!has_min || !has_max || (!is_exact && pred.op == filter_op::NOT_EQUAL)) return true;
+      std::string lo, hi;
+      if (!literal_bounds(pred.value, lo, hi)) return true;
+      return range_may_satisfy(pred.op,
+                               ss.has_minimum ? ss.minimum : ss.lowerBound,
+                               ss.has_maximum ? ss.maximum : ss.upperBound,
+                               lo,
+                               hi);
+    }
+    default: return true;
+  }
+}
+
+/**
+ * @brief Computes the bloom filter hash of the literal of an equality predicate
+ *
+ * @return `false` if bloom filters of the column cannot be probed for the literal
+ */
+bool bloom_filter_literal_hash(host_predicate const &pred, orc::TypeKind kind, uint64_t &hash)
+{
+  switch (kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG:
+    case orc::DATE: {
+      int64_t lo, hi;
+      if (!literal_bounds(pred.value, (kind == orc::DATE) ? 86400000000000ll : 0, lo, hi) ||
+          lo != hi) {
+        return false;
+      }
+      hash = gpu::bloom_filter_long_hash(lo);
+      return true;
+    }
+    case orc::FLOAT:
+    case orc::DOUBLE: {
+      // Values are added as the bits of the double; +0.0 and -0.0 hash differently
+      double lo, hi;
+      if (!literal_bounds(pred.value, lo, hi) || lo == 0) return false;
+      int64_t bits;
+      memcpy(&bits, &lo, sizeof(bits));
+      hash = gpu::bloom_filter_long_hash(bits);
+      return true;
+    }
+    case orc::STRING:
+    case orc::VARCHAR: {
+      std::string lo, hi;
+      if (!literal_bounds(pred.value, lo, hi)) return false;
+      hash =
+        gpu::bloom_filter_string_hash(reinterpret_cast<uint8_t const *>(lo.data()), lo.size());
+      return true;
+    }
+    default: return false;
+  }
+}
+
+/**
+ * @brief Probes an ORC bloom filter
+ *
+ * @return `false` only if the value hashed to `hash` is not in the filter
+ */
+bool bloom_filter_may_contain(orc::BloomFilter const &filter, uint64_t hash)
+{
+  std::vector<uint64_t> words = filter.bitset;
+  if (words.empty()) {
+    words.resize(filter.utf8bitset.size() / sizeof(uint64_t));
+    memcpy(words.data(), filter.utf8bitset.data(), words.size() * sizeof(uint64_t));
+  }
+  if (words.empty() || filter.numHashFunctions == 0) return true;
+
+  uint64_t const num_bits = words.size() * 64;
+  auto const hash1        = static_cast<uint32_t>(hash);
+  auto const hash2        = static_cast<uint32_t>(hash >> 32);
+  for (uint32_t i = 1; i <= filter.numHashFunctions; ++i) {
+    auto combined = static_cast<int32_t>(hash1 + i * hash2);
+    if (combined < 0) { combined = ~combined; }
+    auto const bit = static_cast<uint64_t>(combined) % num_bits;
+    if ((words[bit / 64] & (1ull << (bit % 64))) == 0) { return false; }
+  }
+  return true;
+}
+
 }  // namespace
 
 /**
@@ -128,14 +420,27 @@ class metadata {
   using OrcStripeInfo = std::pair<const StripeInformation *, const StripeFooter *>;
 
  public:
-  explicit metadata(datasource *const src) : source(src)
+  /**
+   * @brief Parses the postscript and footer of a source, or copies them from the metadata cache
+   * if `cache_key` is the key of a previously parsed file
+   **/
+  metadata(datasource *const src, std::string const &cache_key) : source(src)
   {
+    using cached_metadata = std::tuple<PostScript, FileFooter, size_t>;
+    if (!cache_key.empty()) {
+      if (auto const cached = metadata_cache::get().find<cached_metadata>(cache_key)) {
+        std::tie(ps, ff, ps_length) = *cached;
+        decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
+        return;
+      }
+    }
+
     const auto len         = source->size();
     const auto max_ps_size = std::min(len, static_cast<size_t>(256));
 
     // Read uncompressed postscript section (max 255 bytes + 1 byte for length)
     auto buffer            = source->host_read(len - max_ps_size, max_ps_size);
-    const size_t ps_length = buffer->data()[max_ps_size - 1];
+    ps_length              = buffer->data()[max_ps_size - 1];
     const uint8_t *ps_data = &buffer->data()[max_ps_size - ps_length - 1];
     ProtobufReader pb;
     pb.init(ps_data, ps_length);
@@ -153,6 +458,11 @@ class metadata {
     pb.init(ff_data, ff_length);
     CUDF_EXPECTS(pb.read(&ff, ff_length), "Cannot read filefooter");
     CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
+
+    if (!cache_key.empty()) {
+      metadata_cache::get().insert(
+        cache_key, std::make_shared<cached_metadata const>(ps, ff, ps_length), ff_length);
+    }
   }
 
   /**
@@ -163,6 +473,8 @@ class metadata {
    * @param[in] stripe_indices Indices of individual stripes [max_stripe_count]
    * @param[in] row_start Starting row of the selection
    * @param[in,out] row_count Total number of rows selected
+   * @param[in] predicates Predicates used to skip stripes that cannot contain matching rows;
+   * cannot be combined with a row range
    *
    * @return List of stripe info and total number of selected rows
    **/
@@ -170,7 +482,8 @@ class metadata {
                       size_type max_stripe_count,
                       const size_type *stripe_indices,
                       size_type &row_start,
-                      size_type &row_count)
+                      size_type &row_count,
+                      std::vector<host_predicate> const &predicates)
   {
     std::vector<OrcStripeInfo> selection;
 
@@ -217,6 +530,21 @@ class metadata {
       row_start = stripe_skip_rows;
     }
 
+    // Skip stripes whose file and stripe statistics show they cannot contain matching rows
+    std::vector<int> pred_columns;
+    if (not predicates.empty()) {
+      pred_columns = get_predicate_columns(predicates);
+      auto const md = read_stripe_statistics();
+      selection.erase(std::remove_if(selection.begin(),
+                                     selection.end(),
+                                     [&](auto const &info) {
+                                       auto const stripe_idx = info.first - ff.stripes.data();
+                                       return !stripe_may_satisfy(
+                                         md, stripe_idx, predicates, pred_columns);
+                                     }),
+                      selection.end());
+    }
+
     // Read each stripe's stripefooter metadata
     if (not selection.empty()) {
       orc::ProtobufReader pb;
@@ -238,9 +566,267 @@ class metadata {
       }
     }
 
+    // Skip stripes where no row group may match, based on the row indexes and bloom filters
+    if (not predicates.empty()) {
+      selection.erase(std::remove_if(selection.begin(),
+                                     selection.end(),
+                                     [&](auto const &info) {
+                                       return !row_groups_may_satisfy(
+                                         info, predicates, pred_columns);
+                                     }),
+                      selection.end());
+      auto const selected_rows =
+        std::accumulate(selection.cbegin(), selection.cend(), size_t{0}, [](auto sum, auto &info) {
+          return sum + info.first->numberOfRows;
+        });
+      row_start = 0;
+      row_count = static_cast<size_type>(
+        std::min<size_t>(selected_rows, std::numeric_limits<size_type>::max()));
+    }
+
     return selection;
   }
 
+  /**
+   * @brief Returns the ORC column index of the column referenced by each predicate
+   **/
+  std::vector<int> get_predicate_columns(std::vector<host_predicate> const &predicates)
+  {
+    std::vector<int> columns;
+    for (auto const &pred : predicates) {
+      int col = 0;
+      while (col < get_num_columns() && ff.GetColumnName(col) != pred.column_name) { ++col; }
+      CUDF_EXPECTS(col < get_num_columns(), "Predicate column not found");
+      columns.push_back(col);
+    }
+    return columns;
+  }
+
+  /**
+   * @brief Reads and parses the statistics of each stripe, stored in the file's metadata section
+   *
+   * @return The stripe statistics; empty if the file has none or they cannot be parsed
+   **/
+  Metadata read_stripe_statistics()
+  {
+    Metadata md;
+    auto const len = source->size();
+    if (ps.metadataLength == 0 || ps.metadataLength + ps.footerLength + ps_length + 1 > len) {
+      return md;
+    }
+    auto const offset = len - ps_length - 1 - ps.footerLength - ps.metadataLength;
+    auto const buffer = source->host_read(offset, ps.metadataLength);
+    size_t md_length  = 0;
+    auto md_data      = decompressor->Decompress(buffer->data(), ps.metadataLength, &md_length);
+    ProtobufReader pb(md_data, md_length);
+    if (md_data == nullptr || !pb.read(&md, md_length)) { md.stripeStats.clear(); }
+    return md;
+  }
+
+  /**
+   * @brief Determines whether a stripe may contain rows satisfying all the predicates, based on
+   * the file and stripe statistics
+   **/
+  bool stripe_may_satisfy(Metadata const &md,
+                          size_t stripe_idx,
+                          std::vector<host_predicate> const &predicates,
+                          std::vector<int> const &columns)
+  {
+    auto const stripe_rows = ff.stripes[stripe_idx].numberOfRows;
+    for (size_t p = 0; p < predicates.size(); ++p) {
+      auto const col = columns[p];
+      if (!column_stats_may_satisfy(predicates[p], col, ff.statistics, ff.numberOfRows)) {
+        return false;
+      }
+      if (stripe_idx < md.stripeStats.size() &&
+          !column_stats_may_satisfy(
+            predicates[p], col, md.stripeStats[stripe_idx].colStats, stripe_rows)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Evaluates a predicate against one of a list of encoded column statistics
+   **/
+  bool column_stats_may_satisfy(host_predicate const &pred,
+                                int col,
+                                std::vector<ColumnStatistics> const &col_stats,
+                                int64_t num_rows)
+  {
+    if (static_cast<size_t>(col) >= col_stats.size() || col_stats[col].empty()) { return true; }
+    DecodedColumnStatistics stats;
+    ProtobufReader pb(col_stats[col].data(), col_stats[col].size());
+    if (!pb.read(&stats, col_stats[col].size())) { return true; }
+    return stats_may_satisfy(pred, ff.types[col], stats, null_countable(col) ? num_rows : -1);
+  }
+
+  /**
+   * @brief Determines whether any row group of a stripe may contain rows satisfying all the
+   * predicates, based on the statistics in the row indexes and on the bloom filters
+   **/
+  bool row_groups_may_satisfy(OrcStripeInfo const &info,
+                              std::vector<host_predicate> const &predicates,
+                              std::vector<int> const &columns)
+  {
+    auto const stride = static_cast<size_t>(get_row_index_stride());
+    auto const stripe = info.first;
+    if (stride == 0 || stripe->numberOfRows == 0) { return true; }
+    auto const num_row_groups = (stripe->numberOfRows + stride - 1) / stride;
+
+    std::vector<bool> may_match(num_row_groups, true);
+    for (size_t p = 0; p < predicates.size(); ++p) {
+      auto const &pred = predicates[p];
+      auto const col   = columns[p];
+      auto const kind  = ff.types[col].kind;
+      auto const is_string =
+        kind == orc::STRING || kind == orc::VARCHAR || kind == orc::CHAR || kind == orc::BINARY;
+
+      // Locate the index streams of the column, at the start of the stripe
+      uint64_t offset       = stripe->offset;
+      const Stream *index   = nullptr;
+      const Stream *bloom   = nullptr;
+      uint64_t index_offset = 0;
+      uint64_t bloom_offset = 0;
+      for (auto const &strm : info.second->streams) {
+        if (offset >= stripe->offset + stripe->indexLength) { break; }
+        if (strm.column == static_cast<uint32_t>(col)) {
+          if (strm.kind == ROW_INDEX) {
+            index        = &strm;
+            index_offset = offset;
+          } else if (strm.kind == BLOOM_FILTER_UTF8 || (strm.kind == BLOOM_FILTER && !is_string)) {
+            // Legacy bloom filters used inconsistent string encodings
+            bloom        = &strm;
+            bloom_offset = offset;
+          }
+        }
+        offset += strm.length;
+      }
+
+      RowIndex row_index;
+      if (index != nullptr && read_index_stream(index_offset, index->length, row_index) &&
+          row_index.entry.size() == num_row_groups) {
+        for (size_t rg = 0; rg < num_row_groups; ++rg) {
+          auto const &entry = row_index.entry[rg];
+          auto const rows   = std::min<int64_t>(stride, stripe->numberOfRows - rg * stride);
+          if (entry.has_statistics &&
+              !stats_may_satisfy(
+                pred, ff.types[col], entry.statistics, null_countable(col) ? rows : -1)) {
+            may_match[rg] = false;
+          }
+        }
+      }
+
+      uint64_t hash = 0;
+      BloomFilterIndex bloom_index;
+      if (bloom != nullptr && pred.op == filter_op::EQUAL &&
+          bloom_filter_literal_hash(pred, kind, hash) &&
+          read_index_stream(bloom_offset, bloom->length, bloom_index) &&
+          bloom_index.bloomFilter.size() == num_row_groups) {
+        for (size_t rg = 0; rg < num_row_groups; ++rg) {
+          if (!bloom_filter_may_contain(bloom_index.bloomFilter[rg], hash)) {
+            may_match[rg] = false;
+          }
+        }
+      }
+
+      if (std::none_of(may_match.cbegin(), may_match.cend(), [](bool m) { return m; })) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Reads and parses a stream of the stripe index section
+   *
+   * @return `false` if the stream cannot be read or parsed
+   **/
+  template <typename T>
+  bool read_index_stream(uint64_t offset, uint64_t length, T &index)
+  {
+    if (length == 0 || offset + length > source->size()) { return false; }
+    auto const buffer   = source->host_read(offset, length);
+    size_t index_length = 0;
+    auto index_data     = decompressor->Decompress(buffer->data(), length, &index_length);
+    if (index_data == nullptr) { return false; }
+    ProtobufReader pb(index_data, index_length);
+    return pb.read(&index, index_length);
+  }
+
+  /**
+   * @brief Reads the file statistics of a list of columns
+   *
+   * Files written in chunks only have stripe statistics, which are merged instead.
+   *
+   * @param columns ORC column indexes
+   * @param types Output types of the columns, used for the min/max scalars
+   * @param mr Device memory resource used to allocate the min/max scalars
+   * @param stream CUDA stream used to initialize the min/max scalars
+   *
+   * @return The statistics of every column
+   **/
+  std::vector<column_statistics> read_statistics(std::vector<int> const &columns,
+                                                 std::vector<data_type> const &types,
+                                                 rmm::mr::device_memory_resource *mr,
+                                                 cudaStream_t stream)
+  {
+    auto const has_file_stats = [&](int col) {
+      return static_cast<size_t>(col) < ff.statistics.size() && !ff.statistics[col].empty();
+    };
+    Metadata md;
+    if (!std::all_of(columns.begin(), columns.end(), has_file_stats)) {
+      md = read_stripe_statistics();
+    }
+
+    std::vector<column_statistics> result;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      auto const col = columns[i];
+      column_statistics_builder builder;
+      if (has_file_stats(col) || md.stripeStats.size() != ff.stripes.size()) {
+        add_statistics(builder, col, ff.statistics, ff.numberOfRows);
+      } else {
+        for (size_t s = 0; s < ff.stripes.size(); ++s) {
+          add_statistics(builder, col, md.stripeStats[s].colStats, ff.stripes[s].numberOfRows);
+        }
+      }
+      result.push_back(builder.build(types[i], mr, stream));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Adds the statistics of a column, from a list of encoded column statistics, to a
+   * builder; unknown statistics are added if the column has none
+   **/
+  void add_statistics(column_statistics_builder &builder,
+                      int col,
+                      std::vector<ColumnStatistics> const &col_stats,
+                      int64_t num_rows) const
+  {
+    predicate_literal min, max;
+    int64_t null_count = -1;
+    if (static_cast<size_t>(col) < col_stats.size() && !col_stats[col].empty()) {
+      DecodedColumnStatistics stats;
+      ProtobufReader pb(col_stats[col].data(), col_stats[col].size());
+      if (pb.read(&stats, col_stats[col].size())) {
+        if (stats.has_numberOfValues && null_countable(col)) {
+          auto const num_values = static_cast<int64_t>(stats.numberOfValues);
+          null_count            = std::max<int64_t>(0, num_rows - num_values);
+        }
+        decode_minmax(ff.types[col], stats, min, max);
+      }
+    }
+    builder.add(num_rows, null_count, min, max);
+  }
+
+  /**
+   * @brief Whether null counts of a column can be derived from its number of values, which is
+   * only the case for children of the root struct
+   **/
+  bool null_countable(int col) const { return col != 0 && ff.types[col].parent_idx == 0; }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
@@ -253,6 +839,14 @@ class metadata {
   {
     std::vector<int> selection;
 
+    // Nested columns are read along with all their descendants
+    std::function<void(int)> find_timestamps = [&](int index) {
+      if (ff.types[index].kind == orc::TIMESTAMP) { has_timestamp_column = true; }
+      for (auto const child : ff.types[index].subtypes) {
+        if (child < ff.types.size()) { find_timestamps(child); }
+      }
+    };
+
     if (not use_names.empty()) {
       int index = 0;
       for (const auto &use_name : use_names) {
@@ -260,18 +854,22 @@ class metadata {
           if (index >= get_num_columns()) { index = 0; }
           if (ff.GetColumnName(index) == use_name) {
             selection.emplace_back(index);
-            if (ff.types[index].kind == orc::TIMESTAMP) { has_timestamp_column = true; }
+            find_timestamps(index);
             index++;
             break;
           }
         }
       }
+    } else if (ff.types[0].subtypes.empty()) {
+      // The root column is the only column
+      selection.emplace_back(0);
+      find_timestamps(0);
     } else {
-      // For now, only select all leaf nodes
-      for (int i = 0; i < get_num_columns(); ++i) {
-        if (ff.types[i].subtypes.size() == 0) {
-          selection.emplace_back(i);
-          if (ff.types[i].kind == orc::TIMESTAMP) { has_timestamp_column = true; }
+      // Select all the fields of the root struct, nested or not
+      for (auto const field : ff.types[0].subtypes) {
+        if (field < ff.types.size()) {
+          selection.emplace_back(field);
+          find_timestamps(field);
         }
       }
     }
@@ -280,6 +878,61 @@ class metadata {
     return selection;
   }
 
+  /**
+   * @brief Splits the file into ranges of rows made of whole stripes, as long as they are within
+   * both limits
+   *
+   * The footer only records the size of the whole stripes, so the device memory of a stripe is
+   * approximated by its compressed and decompressed data, regardless of the selected columns.
+   * Stripes larger than `byte_limit` make up a range of their own.
+   *
+   * @param byte_limit Approximate upper bound of the device memory used to read each range; `0`
+   * for no limit
+   * @param row_limit Maximum number of rows in each range; `0` for no limit
+   *
+   * @return List of (skip_rows, num_rows) pairs covering the file in order
+   **/
+  std::vector<std::pair<size_type, size_type>> chunk_row_ranges(size_t byte_limit,
+                                                                size_type row_limit) const
+  {
+    auto const max_bytes = (byte_limit != 0) ? byte_limit : std::numeric_limits<size_t>::max();
+    auto const max_rows  = (row_limit != 0) ? row_limit : std::numeric_limits<size_type>::max();
+    // Compressed and decompressed stripe data are alive at the same time
+    auto const data_copies = (ps.compression != NONE) ? 2 : 1;
+
+    std::vector<std::pair<size_type, size_type>> ranges;
+    size_type range_start = 0;
+    size_type range_rows  = 0;
+    size_t range_bytes    = 0;
+    size_type row         = 0;
+    for (auto const &stripe : ff.stripes) {
+      auto const stripe_rows  = static_cast<size_type>(stripe.numberOfRows);
+      auto const stripe_bytes = stripe.indexLength + stripe.dataLength * data_copies;
+
+      if (range_rows != 0 &&
+          (range_bytes + stripe_bytes > max_bytes || stripe_rows > max_rows - range_rows)) {
+        ranges.emplace_back(range_start, range_rows);
+        range_start = row;
+        range_rows  = 0;
+        range_bytes = 0;
+      }
+      if (stripe_rows > max_rows) {
+        for (size_type r = 0; r < stripe_rows; r += max_rows) {
+          ranges.emplace_back(row + r, std::min(max_rows, stripe_rows - r));
+        }
+        range_start = row + stripe_rows;
+      } else {
+        range_rows += stripe_rows;
+        range_bytes += stripe_bytes;
+      }
+      row += stripe_rows;
+    }
+    // Always return a range so that an empty file still produces the columns
+    if (range_rows != 0 || ranges.empty()) { ranges.emplace_back(range_start, range_rows); }
+
+    return ranges;
+  }
+
   inline size_t get_total_rows() const { return ff.numberOfRows; }
   inline int get_num_stripes() const { return ff.stripes.size(); }
   inline int get_num_columns() const { return ff.types.size(); }
@@ -288,6 +941,7 @@ class metadata {
  public:
   PostScript ps;
   FileFooter ff;
+  size_t ps_length = 0;
   std::vector<StripeFooter> stripefooters;
   std::unique_ptr<OrcDecompressor> decompressor;
 
@@ -364,8 +1018,13 @@ size_t gather_stream_info(const size_t stripe_index,
       if (src_offset >= stripeinfo->indexLength || use_index) {
         // NOTE: skip_count field is temporarily used to track index ordering
         auto &chunk = chunks[stripe_index * num_columns + col];
-        const auto idx =
+        auto idx =
           get_index_type_and_pos(stream.kind, chunk.skip_count, col == orc2gdf[stream.column]);
+        // The lengths of list and map entries are decoded as the data of the column
+        const auto kind = types[stream.column].kind;
+        if ((kind == orc::LIST || kind == orc::MAP) && stream.kind == orc::LENGTH) {
+          idx.first = gpu::CI_DATA;
+        }
         if (idx.first < gpu::CI_NUM_STREAMS) {
           chunk.strm_id[idx.first]  = stream_info.size();
           chunk.strm_len[idx.first] = stream.length;
@@ -388,6 +1047,160 @@ size_t gather_stream_info(const size_t stripe_index,
   return dst_offset;
 }
 
+/**
+ * @brief Expands the children of a struct column, which only have entries for the valid rows of
+ * the struct, to one row per row of the struct; the other rows are null
+ **/
+std::vector<std::unique_ptr<column>> expand_struct_children(
+  std::vector<std::unique_ptr<column>> &&children,
+  bitmask_type const *null_mask,
+  size_type num_rows,
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream)
+{
+  if (children.empty()) { return std::move(children); }
+
+  // Valid rows gather the entry of their rank, null rows gather past the end of the children
+  auto const num_valid = children.front()->size();
+  rmm::device_vector<size_type> gather_map(num_rows);
+  auto const is_valid = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [null_mask] __device__(size_type row) { return bit_is_set(null_mask, row) ? 1 : 0; });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), is_valid, is_valid + num_rows, gather_map.begin());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    gather_map.begin(),
+                    gather_map.begin(),
+                    [null_mask, num_valid] __device__(size_type row, size_type rank) {
+                      return bit_is_set(null_mask, row) ? rank : num_valid;
+                    });
+
+  std::vector<column_view> views;
+  for (auto const &child : children) { views.push_back(child->view()); }
+  auto const gather_map_view =
+    column_view{data_type{type_id::INT32}, num_rows, gather_map.data().get()};
+  return cudf::detail::gather(table_view{views},
+                              gather_map_view,
+                              cudf::detail::out_of_bounds_policy::NULLIFY,
+                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                              mr,
+                              stream)
+    ->release();
+}
+
+/**
+ * @brief Creates the column of a decoded ORC column, along with its descendants
+ *
+ * @param index Index of the column in `orc_columns`
+ * @param buffers Decoded data of each column; list columns hold their offsets
+ * @param num_entries Number of entries of each column
+ * @param orc_columns ORC column index of each decoded column
+ * @param orc_col_map Index of each ORC column in `orc_columns`, or -1
+ * @param types Schema of the ORC columns
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::unique_ptr<column> make_nested_column(size_t index,
+                                           std::vector<column_buffer> &buffers,
+                                           std::vector<size_type> const &num_entries,
+                                           std::vector<int> const &orc_columns,
+                                           std::vector<int32_t> const &orc_col_map,
+                                           std::vector<orc::SchemaType> const &types,
+                                           rmm::mr::device_memory_resource *mr,
+                                           cudaStream_t stream)
+{
+  auto &buffer     = buffers[index];
+  auto const &type = types[orc_columns[index]];
+  auto const is_nested =
+    (type.kind == orc::LIST || type.kind == orc::MAP || type.kind == orc::STRUCT);
+  if (!is_nested || type.subtypes.empty()) { return make_column(buffer, stream, mr); }
+
+  std::vector<std::unique_ptr<column>> children;
+  for (auto const child : type.subtypes) {
+    children.push_back(make_nested_column(
+      orc_col_map[child], buffers, num_entries, orc_columns, orc_col_map, types, mr, stream));
+  }
+  if (type.kind == orc::STRUCT) {
+    if (buffer.null_count() > 0) {
+      children = expand_struct_children(
+        std::move(children), buffer.null_mask(), buffer.size, mr, stream);
+    }
+    return make_structs_column(buffer.size,
+                               std::move(children),
+                               buffer.null_count(),
+                               std::move(buffer._null_mask),
+                               stream,
+                               mr);
+  }
+
+  // The entries of a map are structs of a key and a value
+  auto const num_child_rows = num_entries[orc_col_map[type.subtypes[0]]];
+  auto child = (type.kind == orc::MAP) ? make_structs_column(num_child_rows,
+                                                             std::move(children),
+                                                             0,
+                                                             rmm::device_buffer{},
+                                                             stream,
+                                                             mr)
+                                       : std::move(children[0]);
+  auto offsets =
+    std::make_unique<column>(data_type{type_id::INT32}, buffer.size, std::move(buffer._data));
+  return make_lists_column(buffer.size - 1,
+                           std::move(offsets),
+                           std::move(child),
+                           buffer.null_count(),
+                           std::move(buffer._null_mask),
+                           stream,
+                           mr);
+}
+
+/**
+ * @brief Returns the string dictionary entries of all the stripes of a decoded column
+ *
+ * @param chunks Column chunk descriptors of the stripes, one for each column of each stripe
+ * @param global_dict Dictionary entries of all the chunks, as positions in their dictionary
+ * streams
+ * @param col_index Index of the column in the chunks of each stripe
+ * @param num_columns Number of columns of each stripe
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+rmm::device_vector<thrust::pair<const char *, size_type>> column_dictionary_entries(
+  hostdevice_vector<gpu::ColumnDesc> const &chunks,
+  rmm::device_vector<gpu::DictionaryEntry> const &global_dict,
+  size_t col_index,
+  size_t num_columns,
+  cudaStream_t stream)
+{
+  auto is_dictionary_chunk = [](gpu::ColumnDesc const &chunk) {
+    return (chunk.encoding_kind == orc::DICTIONARY || chunk.encoding_kind == orc::DICTIONARY_V2) &&
+           chunk.dict_len > 0;
+  };
+  size_t num_entries = 0;
+  for (size_t c = col_index; c < chunks.size(); c += num_columns) {
+    if (is_dictionary_chunk(chunks[c])) { num_entries += chunks[c].dict_len; }
+  }
+
+  rmm::device_vector<thrust::pair<const char *, size_type>> entries(num_entries);
+  size_t offset = 0;
+  for (size_t c = col_index; c < chunks.size(); c += num_columns) {
+    auto const &chunk = chunks[c];
+    if (!is_dictionary_chunk(chunk)) { continue; }
+    auto const dict_data = reinterpret_cast<const char *>(chunk.streams[gpu::CI_DICTIONARY]);
+    auto const dict      = global_dict.data().get() + chunk.dictionary_start;
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      dict,
+                      dict + chunk.dict_len,
+                      entries.begin() + offset,
+                      [dict_data] __device__(gpu::DictionaryEntry const &entry) {
+                        return thrust::make_pair(dict_data + entry.pos,
+                                                 static_cast<size_type>(entry.len));
+                      });
+    offset += chunk.dict_len;
+  }
+  return entries;
+}
+
 }  // namespace
 
 rmm::device_buffer reader::impl::decompress_stripe_data(
@@ -400,6 +1213,10 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   size_t row_index_stride,
   cudaStream_t stream)
 {
+  size_t compressed_size = 0;
+  for (const auto &info : stream_info) { compressed_size += info.length; }
+  CUDF_SCOPED_RANGE_PAYLOAD("orc::decompress_stripe_data", compressed_size);
+
   // Parse the columns' compressed info
   hostdevice_vector<gpu::CompressedStreamInfo> compinfo(0, stream_info.size(), stream);
   for (const auto &info : stream_info) {
@@ -478,6 +1295,10 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
         CUDA_TRY(gpu_unsnap(
           inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
         break;
+      case orc::ZSTD:
+        CUDA_TRY(gpu_unzstd(
+          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
+        break;
       default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
     }
   }
@@ -533,7 +1354,7 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
 }
 
 void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
-                                      size_t num_dicts,
+                                      rmm::device_vector<gpu::DictionaryEntry> &global_dict,
                                       size_t skip_rows,
                                       size_t num_rows,
                                       const std::vector<int64_t> &timezone_table,
@@ -542,6 +1363,12 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
                                       std::vector<column_buffer> &out_buffers,
                                       cudaStream_t stream)
 {
+  size_t stream_bytes = 0;
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    for (auto len : chunks[i].strm_len) { stream_bytes += len; }
+  }
+  CUDF_SCOPED_RANGE_PAYLOAD("orc::decode_stream_data", stream_bytes);
+
   const auto num_columns = out_buffers.size();
   const auto num_stripes = chunks.size() / out_buffers.size();
 
@@ -554,9 +1381,6 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
     }
   }
 
-  // Allocate global dictionary for deserializing
-  rmm::device_vector<gpu::DictionaryEntry> global_dict(num_dicts);
-
   // Allocate timezone transition table timestamp conversion
   rmm::device_vector<int64_t> tz_table = timezone_table;
 
@@ -592,13 +1416,127 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
   }
 }
 
+void reader::impl::decode_nested_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
+                                             size_t num_dicts,
+                                             const std::vector<int64_t> &timezone_table,
+                                             std::vector<int> const &orc_columns,
+                                             std::vector<data_type> const &column_types,
+                                             std::vector<size_t> const &level_starts,
+                                             std::vector<int32_t> const &orc_col_map,
+                                             std::vector<column_buffer> &out_buffers,
+                                             std::vector<size_type> &num_entries,
+                                             cudaStream_t stream)
+{
+  auto const &types      = _metadata->ff.types;
+  auto const num_columns = orc_columns.size();
+  auto const num_stripes = chunks.size() / num_columns;
+  const rmm::device_vector<gpu::RowGroup> no_row_groups;
+
+  // Top-level columns have one entry per row, their chunks covering whole stripes
+  num_entries.assign(num_columns, 0);
+  for (size_t i = 0; i < level_starts[1]; ++i) {
+    for (size_t j = 0; j < num_stripes; ++j) {
+      num_entries[i] += chunks[j * num_columns + i].num_rows;
+    }
+  }
+
+  // Global dictionary for deserializing, shared by the chunks of all the levels
+  rmm::device_vector<gpu::DictionaryEntry> global_dict(num_dicts);
+
+  out_buffers.resize(num_columns);
+  for (size_t level = 0; level + 1 < level_starts.size(); ++level) {
+    auto const first      = level_starts[level];
+    auto const count      = level_starts[level + 1] - first;
+    size_type max_entries = 0;
+    hostdevice_vector<gpu::ColumnDesc> level_chunks(num_stripes * count, stream);
+    std::vector<column_buffer> level_buffers;
+    for (size_t i = 0; i < count; ++i) {
+      bool is_nullable = false;
+      for (size_t j = 0; j < num_stripes; ++j) {
+        level_chunks[j * count + i] = chunks[j * num_columns + first + i];
+        if (level_chunks[j * count + i].strm_len[gpu::CI_PRESENT] != 0) { is_nullable = true; }
+      }
+      // List columns decode the length of each entry, followed by a zero, scanned into offsets;
+      // null entries keep the zero length the buffer is initialized with
+      auto const &type = column_types[first + i];
+      auto const size  = num_entries[first + i] + ((type.id() == type_id::LIST) ? 1 : 0);
+      level_buffers.emplace_back(type, size, is_nullable, stream, _mr);
+      max_entries = std::max(max_entries, num_entries[first + i]);
+    }
+
+    decode_stream_data(level_chunks,
+                       global_dict,
+                       0,
+                       max_entries,
+                       timezone_table,
+                       no_row_groups,
+                       0,
+                       level_buffers,
+                       stream);
+
+    // Locate the entries of the children of each nested column in the stripes
+    for (size_t i = 0; i < count; ++i) {
+      auto const &type = types[orc_columns[first + i]];
+      std::vector<size_type> child_entries(num_stripes);
+      if (type.kind == orc::LIST || type.kind == orc::MAP) {
+        auto const offsets = static_cast<size_type *>(level_buffers[i].data());
+        thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                               offsets,
+                               offsets + level_buffers[i].size,
+                               offsets);
+        std::vector<size_type> stripe_offsets(num_stripes + 1);
+        for (size_t j = 0; j <= num_stripes; ++j) {
+          auto const row =
+            (j < num_stripes) ? level_chunks[j * count + i].start_row : num_entries[first + i];
+          CUDA_TRY(cudaMemcpyAsync(&stripe_offsets[j],
+                                   offsets + row,
+                                   sizeof(size_type),
+                                   cudaMemcpyDeviceToHost,
+                                   stream));
+        }
+        CUDA_TRY(cudaStreamSynchronize(stream));
+        for (size_t j = 0; j < num_stripes; ++j) {
+          child_entries[j] = stripe_offsets[j + 1] - stripe_offsets[j];
+        }
+      } else if (type.kind == orc::STRUCT) {
+        for (size_t j = 0; j < num_stripes; ++j) {
+          auto const &chunk = level_chunks[j * count + i];
+          child_entries[j]  = chunk.num_rows - chunk.null_count;
+        }
+      } else {
+        continue;
+      }
+      for (auto const child : type.subtypes) {
+        auto const index    = orc_col_map[child];
+        size_type start_row = 0;
+        for (size_t j = 0; j < num_stripes; ++j) {
+          auto &chunk     = chunks[j * num_columns + index];
+          chunk.start_row = start_row;
+          chunk.num_rows  = child_entries[j];
+          start_row += child_entries[j];
+        }
+        num_entries[index] = start_row;
+      }
+    }
+
+    std::move(level_buffers.begin(), level_buffers.end(), out_buffers.begin() + first);
+  }
+}
+
 reader::impl::impl(std::unique_ptr<datasource> source,
+                   std::string const &cache_key,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _source(std::move(source)), _mr(mr)
 {
+  // Stripe streams are read selectively, as located by the footer
+  _source->advise_access_pattern(datasource::access_pattern::RANDOM);
+
   // Open and parse the source dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  {
+    CUDF_SCOPED_RANGE("orc::read_footer");
+    _metadata = std::make_unique<metadata>(_source.get(), cache_key);
+  }
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.columns, _has_timestamp_column);
@@ -609,12 +1547,38 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Enable or disable attempt to use row index for parsing
   _use_index = options.use_index;
 
+  // Predicates used to skip stripes
+  _filters = options.filters;
+
   // Enable or disable the conversion to numpy-compatible dtypes
   _use_np_dtypes = options.use_np_dtypes;
 
-  // Control decimals conversion (float64 or int64 with optional scale)
-  _decimals_as_float     = options.decimals_as_float;
-  _decimals_as_int_scale = options.forced_decimals_scale;
+  // Control decimals conversion (fixed_point, float64 or int64 with optional scale)
+  _decimals_as_fixed_point = options.decimals_as_fixed_point;
+  _decimals_as_float       = options.decimals_as_float;
+  _decimals_as_int_scale   = options.forced_decimals_scale;
+
+  // Enable or disable returning strings as dictionary columns
+  _strings_to_dictionary = options.strings_to_dictionary;
+}
+
+std::vector<std::pair<size_type, size_type>> reader::impl::get_chunk_row_ranges(
+  size_t byte_limit, size_type row_limit) const
+{
+  return _metadata->chunk_row_ranges(byte_limit, row_limit);
+}
+
+std::vector<column_statistics> reader::impl::read_statistics(cudaStream_t stream) const
+{
+  std::vector<data_type> column_types;
+  for (auto const &col : _selected_columns) {
+    column_types.emplace_back(to_type_id(_metadata->ff.types[col],
+                                         _use_np_dtypes,
+                                         _timestamp_type.id(),
+                                         _decimals_as_float,
+                                         _decimals_as_fixed_point));
+  }
+  return _metadata->read_statistics(_selected_columns, column_types, _mr, stream);
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -627,18 +1591,47 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata out_metadata;
 
+  // Skip stripes whose statistics show they cannot contain matching rows
+  std::vector<host_predicate> predicates;
+  if (!_filters.empty()) {
+    CUDF_EXPECTS(skip_rows <= 0 && num_rows < 0,
+                 "Stripe filters cannot be combined with a row range");
+    predicates = make_host_predicates(_filters, stream);
+  }
+
   // Select only stripes required (aka row groups)
-  const auto selected_stripes =
-    _metadata->select_stripes(stripe, max_stripe_count, stripe_indices, skip_rows, num_rows);
+  const auto selected_stripes = _metadata->select_stripes(
+    stripe, max_stripe_count, stripe_indices, skip_rows, num_rows, predicates);
+
+  // Decoded ORC columns: the selected columns, followed by the descendants of the nested ones,
+  // one nesting level after the other
+  auto const &types = _metadata->ff.types;
+  std::vector<int> orc_columns(_selected_columns);
+  std::vector<size_t> level_starts{0};
+  while (level_starts.back() < orc_columns.size()) {
+    auto const first = level_starts.back();
+    auto const last  = orc_columns.size();
+    for (auto i = first; i < last; ++i) {
+      auto const kind = types[orc_columns[i]].kind;
+      if (kind == orc::LIST || kind == orc::MAP || kind == orc::STRUCT) {
+        for (auto const child : types[orc_columns[i]].subtypes) { orc_columns.push_back(child); }
+      }
+    }
+    level_starts.push_back(last);
+  }
+  const bool has_nested = (level_starts.size() > 2);
 
-  // Association between each ORC column and its cudf::column
+  // Association between each ORC column and its decoded column
   std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
 
   // Get a list of column data types
   std::vector<data_type> column_types;
-  for (const auto &col : _selected_columns) {
-    auto col_type = to_type_id(
-      _metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id(), _decimals_as_float);
+  for (const auto &col : orc_columns) {
+    auto col_type = to_type_id(types[col],
+                               _use_np_dtypes,
+                               _timestamp_type.id(),
+                               _decimals_as_float,
+                               _decimals_as_fixed_point);
     CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
     column_types.emplace_back(col_type);
 
@@ -648,12 +1641,24 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
   // If no rows or stripes to read, return empty columns
   if (num_rows <= 0 || selected_stripes.size() == 0) {
-    std::transform(column_types.cbegin(),
-                   column_types.cend(),
-                   std::back_inserter(out_columns),
-                   [](auto const &dtype) { return make_empty_column(dtype); });
+    if (has_nested) {
+      std::vector<column_buffer> out_buffers;
+      for (auto const &dtype : column_types) {
+        out_buffers.emplace_back(dtype, (dtype.id() == type_id::LIST) ? 1 : 0, false, stream, _mr);
+      }
+      std::vector<size_type> num_entries(orc_columns.size(), 0);
+      for (size_t i = 0; i < _selected_columns.size(); ++i) {
+        out_columns.emplace_back(make_nested_column(
+          i, out_buffers, num_entries, orc_columns, orc_col_map, types, _mr, stream));
+      }
+    } else {
+      std::transform(column_types.cbegin(),
+                     column_types.cend(),
+                     std::back_inserter(out_columns),
+                     [](auto const &dtype) { return make_empty_column(dtype); });
+    }
   } else {
-    const auto num_columns = _selected_columns.size();
+    const auto num_columns = orc_columns.size();
     const auto num_chunks  = selected_stripes.size() * num_columns;
     hostdevice_vector<gpu::ColumnDesc> chunks(num_chunks, stream);
     memset(chunks.host_ptr(), 0, chunks.memory_size());
@@ -666,7 +1671,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
        _metadata->get_row_index_stride() > 0 && num_columns * selected_stripes.size() < 8 * 128) &&
       // Only use if first row is aligned to a stripe boundary
       // TODO: Fix logic to handle unaligned rows
-      (skip_rows == 0);
+      (skip_rows == 0) &&
+      // Row groups of nested columns do not cover the same rows as the index stride
+      !has_nested;
 
     // Logically view streams as columns
     std::vector<orc_stream_info> stream_info;
@@ -674,6 +1681,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> stripe_data;
 
+    // Ranges of the selected streams, read in one batch once all the stripes are gathered
+    std::vector<device_read_pipeline::range> stream_reads;
+
     size_t stripe_start_row = 0;
     size_t num_dict_entries = 0;
     size_t num_rowgroups    = 0;
@@ -686,8 +1696,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                                       stripe_info,
                                                       stripe_footer,
                                                       orc_col_map,
-                                                      _selected_columns,
-                                                      _metadata->ff.types,
+                                                      orc_columns,
+                                                      types,
                                                       use_index,
                                                       &num_dict_entries,
                                                       chunks,
@@ -709,9 +1719,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           len += stream_info[stream_count].length;
           stream_count++;
         }
-        const auto buffer = _source->host_read(offset, len);
-        CUDA_TRY(cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream));
-        CUDA_TRY(cudaStreamSynchronize(stream));
+        stream_reads.push_back({offset, len, d_dst});
       }
 
       // Update chunks to reference streams pointers
@@ -719,20 +1727,26 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         auto &chunk         = chunks[i * num_columns + j];
         chunk.start_row     = stripe_start_row;
         chunk.num_rows      = stripe_info->numberOfRows;
-        chunk.encoding_kind = stripe_footer->columns[_selected_columns[j]].kind;
-        chunk.type_kind     = _metadata->ff.types[_selected_columns[j]].kind;
-        if (_decimals_as_float) {
-          chunk.decimal_scale =
-            _metadata->ff.types[_selected_columns[j]].scale | ORC_DECIMAL2FLOAT64_SCALE;
+        chunk.encoding_kind = stripe_footer->columns[orc_columns[j]].kind;
+        chunk.type_kind     = types[orc_columns[j]].kind;
+        if (_decimals_as_fixed_point) {
+          // Decoded at the column scale, which every fixed_point value then carries
+          chunk.decimal_scale = types[orc_columns[j]].scale;
+        } else if (_decimals_as_float) {
+          chunk.decimal_scale = types[orc_columns[j]].scale | ORC_DECIMAL2FLOAT64_SCALE;
         } else if (_decimals_as_int_scale < 0) {
-          chunk.decimal_scale = _metadata->ff.types[_selected_columns[j]].scale;
+          chunk.decimal_scale = types[orc_columns[j]].scale;
         } else {
           chunk.decimal_scale = _decimals_as_int_scale;
         }
         chunk.rowgroup_id = num_rowgroups;
-        chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
-                            ? sizeof(std::pair<const char *, size_t>)
-                            : cudf::size_of(column_types[j]);
+        if (column_types[j].id() == type_id::STRING) {
+          chunk.dtype_len = sizeof(std::pair<const char *, size_t>);
+        } else if (column_types[j].id() == type_id::LIST) {
+          chunk.dtype_len = sizeof(size_type);
+        } else {
+          chunk.dtype_len = is_fixed_width(column_types[j]) ? cudf::size_of(column_types[j]) : 0;
+        }
         if (chunk.type_kind == orc::TIMESTAMP) {
           chunk.ts_clock_rate = to_clockrate(_timestamp_type.id());
         }
@@ -748,6 +1762,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                          _metadata->get_row_index_stride();
       }
     }
+    {
+      size_t read_size = 0;
+      for (auto const &read : stream_reads) { read_size += read.size; }
+      CUDF_SCOPED_RANGE_PAYLOAD("orc::read_stripe_streams", read_size);
+      device_read_pipeline read_pipeline(stream);
+      read_pipeline.read(_source.get(), stream_reads);
+      read_pipeline.sync();
+    }
 
     // Process dataset chunk pages into output columns
     if (stripe_data.size() != 0) {
@@ -791,33 +1813,92 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       }
 
       std::vector<column_buffer> out_buffers;
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        bool is_nullable = false;
-        for (size_t j = 0; j < selected_stripes.size(); ++j) {
-          if (chunks[j * num_columns + i].strm_len[gpu::CI_PRESENT] != 0) {
-            is_nullable = true;
-            break;
+      if (has_nested) {
+        // The children of nested columns are decoded from the start of the stripes, so the
+        // requested rows are only selected once the columns are assembled
+        std::vector<size_type> num_entries;
+        decode_nested_stream_data(chunks,
+                                  num_dict_entries,
+                                  tz_table,
+                                  orc_columns,
+                                  column_types,
+                                  level_starts,
+                                  orc_col_map,
+                                  out_buffers,
+                                  num_entries,
+                                  stream);
+        std::vector<std::unique_ptr<column>> stripe_columns;
+        for (size_t i = 0; i < _selected_columns.size(); ++i) {
+          stripe_columns.emplace_back(make_nested_column(
+            i, out_buffers, num_entries, orc_columns, orc_col_map, types, _mr, stream));
+        }
+        if (skip_rows == 0 && num_rows == num_entries[0]) {
+          out_columns = std::move(stripe_columns);
+        } else {
+          std::vector<column_view> stripe_views;
+          for (auto const &col : stripe_columns) { stripe_views.push_back(col->view()); }
+          rmm::device_vector<size_type> gather_map(num_rows);
+          thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                           gather_map.begin(),
+                           gather_map.end(),
+                           skip_rows);
+          out_columns =
+            cudf::detail::gather(
+              table_view{stripe_views},
+              column_view{data_type{type_id::INT32}, num_rows, gather_map.data().get()},
+              cudf::detail::out_of_bounds_policy::FAIL,
+              cudf::detail::negative_index_policy::NOT_ALLOWED,
+              _mr,
+              stream)
+              ->release();
+        }
+      } else {
+        for (size_t i = 0; i < column_types.size(); ++i) {
+          bool is_nullable = false;
+          for (size_t j = 0; j < selected_stripes.size(); ++j) {
+            if (chunks[j * num_columns + i].strm_len[gpu::CI_PRESENT] != 0) {
+              is_nullable = true;
+              break;
+            }
           }
+          out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
         }
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
-      }
 
-      decode_stream_data(chunks,
-                         num_dict_entries,
-                         skip_rows,
-                         num_rows,
-                         tz_table,
-                         row_groups,
-                         _metadata->get_row_index_stride(),
-                         out_buffers,
-                         stream);
-
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_column(out_buffers[i], stream, _mr));
+        rmm::device_vector<gpu::DictionaryEntry> global_dict(num_dict_entries);
+        decode_stream_data(chunks,
+                           global_dict,
+                           skip_rows,
+                           num_rows,
+                           tz_table,
+                           row_groups,
+                           _metadata->get_row_index_stride(),
+                           out_buffers,
+                           stream);
+
+        for (size_t i = 0; i < column_types.size(); ++i) {
+          if (_strings_to_dictionary && column_types[i].id() == type_id::STRING) {
+            auto const entries =
+              column_dictionary_entries(chunks, global_dict, i, num_columns, stream);
+            out_columns.emplace_back(make_strings_dictionary(out_buffers[i], entries, stream, _mr));
+          } else {
+            out_columns.emplace_back(make_column(out_buffers[i], stream, _mr));
+          }
+        }
       }
     }
   }
 
+  // String columns read without their stripe dictionaries, such as those read along with nested
+  // columns, are encoded once decoded
+  if (_strings_to_dictionary) {
+    for (auto &col : out_columns) {
+      if (col->type().id() != type_id::STRING) { continue; }
+      col = (col->size() == 0) ? make_empty_column(data_type{type_id::DICTIONARY32})
+                               : cudf::dictionary::detail::encode(
+                                   col->view(), data_type{type_id::INT32}, _mr, stream);
+    }
+  }
+
   // Return column names (must match order of returned columns)
   out_metadata.column_names.resize(_selected_columns.size());
   for (size_t i = 0; i < _selected_columns.size(); i++) {
@@ -837,7 +1918,8 @@ reader::reader(std::vector<std::string> const &filepaths,
                rmm::mr::device_memory_resource *mr)
 {
   CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(datasource::create(filepaths[0]), options, mr);
+  _impl = std::make_unique<impl>(
+    datasource::create(filepaths[0]), file_cache_key("orc", filepaths[0]), options, mr);
 }
 
 // Forward to implementation
@@ -846,7 +1928,7 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                rmm::mr::device_memory_resource *mr)
 {
   CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(std::move(sources[0]), options, mr);
+  _impl = std::make_unique<impl>(std::move(sources[0]), std::string{}, options, mr);
 }
 
 // Destructor within this translation unit
@@ -880,6 +1962,19 @@ table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, c
   return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, -1, -1, nullptr, stream);
 }
 
+// Forward to implementation
+std::vector<std::pair<size_type, size_type>> reader::get_chunk_row_ranges(size_t byte_limit,
+                                                                         size_type row_limit) const
+{
+  return _impl->get_chunk_row_ranges(byte_limit, row_limit);
+}
+
+// Forward to implementation
+std::vector<column_statistics> reader::read_statistics(cudaStream_t stream) const
+{
+  return _impl->read_statistics(stream);
+}
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
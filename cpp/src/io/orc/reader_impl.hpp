@@ -57,10 +57,12 @@ class reader::impl {
    * @brief Constructor from a dataset source with reader options.
    *
    * @param source Dataset source
+   * @param cache_key Metadata cache key of the source, or empty to bypass the cache
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
   explicit impl(std::unique_ptr<datasource> source,
+                std::string const &cache_key,
                 reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -83,6 +85,25 @@ class reader::impl {
                            const size_type *stripe_indices,
                            cudaStream_t stream);
 
+  /**
+   * @brief Splits the file into ranges of rows of whole stripes that can each be read within
+   * the given limits
+   *
+   * @param byte_limit Approximate upper bound of the device memory used to read each range
+   * @param row_limit Maximum number of rows in each range
+   *
+   * @return List of (skip_rows, num_rows) pairs covering the file in order
+   */
+  std::vector<std::pair<size_type, size_type>> get_chunk_row_ranges(size_t byte_limit,
+                                                                    size_type row_limit) const;
+
+  /**
+   * @brief Returns the statistics of the selected columns, from the file footer
+   *
+   * @param stream CUDA stream used to initialize the min/max scalars
+   */
+  std::vector<column_statistics> read_statistics(cudaStream_t stream) const;
+
  private:
   /**
    * @brief Decompresses the stripe data, at stream granularity
@@ -111,7 +132,8 @@ class reader::impl {
    * @brief Converts the stripe column data and outputs to columns
    *
    * @param chunks List of column chunk descriptors
-   * @param num_dicts Number of dictionary entries required
+   * @param global_dict Output string dictionary entries of all the chunks, each chunk's from its
+   * `dictionary_start`
    * @param skip_rows Number of rows to offset from start
    * @param num_rows Number of rows to output
    * @param timezone_table Local time to UTC conversion table
@@ -121,7 +143,7 @@ class reader::impl {
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
   void decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
-                          size_t num_dicts,
+                          rmm::device_vector<gpu::DictionaryEntry> &global_dict,
                           size_t skip_rows,
                           size_t num_rows,
                           const std::vector<int64_t> &timezone_table,
@@ -130,18 +152,52 @@ class reader::impl {
                           std::vector<column_buffer> &out_buffers,
                           cudaStream_t stream);
 
+  /**
+   * @brief Converts the stripe column data of nested columns and their descendants, one nesting
+   * level at a time, from the start of each stripe
+   *
+   * The entries of the children of each nested column in each stripe are located once the
+   * nested column is decoded: list columns scan their lengths into offsets, and the children of
+   * struct columns have one entry per valid struct row.
+   *
+   * @param chunks List of column chunk descriptors; the rows of the descendants are updated
+   * @param num_dicts Number of dictionary entries required
+   * @param timezone_table Local time to UTC conversion table
+   * @param orc_columns ORC column index of each decoded column, by nesting level
+   * @param column_types Output type of each decoded column
+   * @param level_starts Index of the first column of each nesting level, followed by the number
+   * of columns
+   * @param orc_col_map Index of each ORC column in `orc_columns`, or -1
+   * @param out_buffers Output columns' device buffers; list columns hold their offsets
+   * @param num_entries Output number of entries of each column
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void decode_nested_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
+                                 size_t num_dicts,
+                                 const std::vector<int64_t> &timezone_table,
+                                 std::vector<int> const &orc_columns,
+                                 std::vector<data_type> const &column_types,
+                                 std::vector<size_t> const &level_starts,
+                                 std::vector<int32_t> const &orc_col_map,
+                                 std::vector<column_buffer> &out_buffers,
+                                 std::vector<size_type> &num_entries,
+                                 cudaStream_t stream);
+
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
   std::unique_ptr<datasource> _source;
   std::unique_ptr<metadata> _metadata;
 
   std::vector<int> _selected_columns;
-  bool _use_index            = true;
-  bool _use_np_dtypes        = true;
-  bool _has_timestamp_column = false;
-  bool _decimals_as_float    = true;
-  int _decimals_as_int_scale = -1;
+  bool _use_index               = true;
+  bool _use_np_dtypes           = true;
+  bool _has_timestamp_column    = false;
+  bool _decimals_as_float       = true;
+  int _decimals_as_int_scale    = -1;
+  bool _decimals_as_fixed_point = false;
+  bool _strings_to_dictionary   = false;
   data_type _timestamp_type{type_id::EMPTY};
+  std::vector<column_predicate> _filters;
 };
 
 }  // namespace orc
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/fixed_point/fixed_point.hpp>
 #include <io/utilities/block_utils.cuh>
 #include "orc_common.h"
 #include "orc_gpu.h"
@@ -1530,6 +1531,8 @@ extern "C" __global__ void __launch_bounds__(NTHREADS)
     bytestream_init(&s->bs2, s->chunk.streams[CI_DATA2], s->chunk.strm_len[CI_DATA2]);
   }
   __syncthreads();
+  // Struct columns have no data stream, only the present stream decoded with the nulls
+  if (s->chunk.type_kind == STRUCT) { return; }
   while (s->top.data.cur_row < s->top.data.end_row) {
     bytestream_fill(&s->bs, t);
     bytestream_fill(&s->bs2, t);
@@ -1609,7 +1612,16 @@ extern "C" __global__ void __launch_bounds__(NTHREADS)
         numvals = min(numvals + run_pos, (s->chunk.type_kind == BOOLEAN) ? NTHREADS * 2 : NTHREADS);
       }
       // Decode the primary data stream
-      if (s->chunk.type_kind == INT || s->chunk.type_kind == DATE || s->chunk.type_kind == SHORT) {
+      if (s->chunk.type_kind == LIST || s->chunk.type_kind == MAP) {
+        // Unsigned int32 lengths of the list entries
+        if (IS_RLEv1(s->chunk.encoding_kind)) {
+          numvals = Integer_RLEv1(&s->bs, &s->u.rlev1, s->vals.u32, numvals, t);
+        } else {
+          numvals = Integer_RLEv2(&s->bs, &s->u.rlev2, s->vals.u32, numvals, t);
+        }
+        __syncthreads();
+      } else if (s->chunk.type_kind == INT || s->chunk.type_kind == DATE ||
+                 s->chunk.type_kind == SHORT) {
         // Signed int32 primary data stream
         if (IS_RLEv1(s->chunk.encoding_kind)) {
           numvals = Integer_RLEv1(&s->bs, &s->u.rlev1, s->vals.i32, numvals, t);
@@ -1727,13 +1739,24 @@ extern "C" __global__ void __launch_bounds__(NTHREADS)
           switch (s->chunk.type_kind) {
             case FLOAT:
             case INT:
+            case LIST:
+            case MAP:
               reinterpret_cast<uint32_t *>(data_out)[row] = s->vals.u32[t + vals_skipped];
               break;
             case DOUBLE:
             case LONG:
-            case DECIMAL:
               reinterpret_cast<uint64_t *>(data_out)[row] = s->vals.u64[t + vals_skipped];
               break;
+            case DECIMAL:
+              if (s->chunk.dtype_len == sizeof(numeric::decimal64)) {
+                // Value decoded at the column scale, stored along with that scale
+                reinterpret_cast<numeric::decimal64 *>(data_out)[row] =
+                  numeric::decimal64{numeric::scaled_integer<int64_t>{
+                    s->vals.i64[t + vals_skipped], numeric::scale_type{-s->chunk.decimal_scale}}};
+              } else {
+                reinterpret_cast<uint64_t *>(data_out)[row] = s->vals.u64[t + vals_skipped];
+              }
+              break;
             case SHORT:
               reinterpret_cast<uint16_t *>(data_out)[row] =
                 static_cast<uint16_t>(s->vals.u32[t + vals_skipped]);
@@ -640,6 +640,48 @@ inline __device__ void lengths_to_positions(volatile T *vals, uint32_t numvals,
   }
 }
 
+/**
+ * @brief Adds the value of a row to the bloom filter of the chunk
+ *
+ * Values are hashed as in the ORC reference implementation: integers as longs, floating-point
+ * values as the bits of their double-precision value and strings as their UTF-8 bytes.
+ *
+ * @param[in] s encoder state
+ * @param[in] row row of the value in the column
+ *
+ **/
+static __device__ void BloomFilterAdd(const orcenc_state_s *s, uint32_t row)
+{
+  const uint8_t *base = reinterpret_cast<const uint8_t *>(s->chunk.column_data_base);
+  uint64_t hash;
+  switch (s->chunk.type_kind) {
+    case BYTE: hash = bloom_filter_long_hash(reinterpret_cast<const int8_t *>(base)[row]); break;
+    case SHORT: hash = bloom_filter_long_hash(reinterpret_cast<const int16_t *>(base)[row]); break;
+    case INT:
+    case DATE: hash = bloom_filter_long_hash(reinterpret_cast<const int32_t *>(base)[row]); break;
+    case LONG: hash = bloom_filter_long_hash(reinterpret_cast<const int64_t *>(base)[row]); break;
+    case FLOAT:
+      hash = bloom_filter_long_hash(
+        __double_as_longlong(static_cast<double>(reinterpret_cast<const float *>(base)[row])));
+      break;
+    case DOUBLE: hash = bloom_filter_long_hash(reinterpret_cast<const int64_t *>(base)[row]); break;
+    case STRING: {
+      const nvstrdesc_s *str = s->chunk.string_data + row;
+      hash = bloom_filter_string_hash(reinterpret_cast<const uint8_t *>(str->ptr), str->count);
+      break;
+    }
+    default: return;
+  }
+  uint32_t hash1 = static_cast<uint32_t>(hash);
+  uint32_t hash2 = static_cast<uint32_t>(hash >> 32);
+  for (uint32_t i = 1; i <= s->chunk.bloom_filter_hashes; i++) {
+    int32_t combined = static_cast<int32_t>(hash1 + i * hash2);
+    if (combined < 0) { combined = ~combined; }
+    uint32_t bit = static_cast<uint32_t>(combined) % s->chunk.bloom_filter_bits;
+    atomicOr(&s->chunk.bloom_filter[bit >> 5], 1u << (bit & 0x1f));
+  }
+}
+
 /**
  * @brief Timestamp scale table (powers of 10)
  **/
@@ -693,17 +735,29 @@ extern "C" __global__ void __launch_bounds__(512)
                            512 * 8 - (present_rows - (min(s->cur_row, s->present_out) & ~7)));
       uint32_t nrows_out;
       if (t * 8 < nrows) {
-        uint32_t row  = s->chunk.start_row + present_rows + t * 8;
-        uint8_t valid = 0;
+        // The valid map is buffered from the first row of the chunk, which is not byte-aligned
+        // within the column for child columns
+        uint32_t local_row = present_rows + t * 8;
+        uint32_t row       = s->chunk.start_row + local_row;
+        uint8_t valid      = 0;
         if (row < s->chunk.valid_rows) {
           const uint8_t *valid_map_base =
             reinterpret_cast<const uint8_t *>(s->chunk.valid_map_base);
-          valid = (valid_map_base) ? valid_map_base[row >> 3] : 0xff;
-          if (row + 7 > s->chunk.valid_rows) {
-            valid = valid & ((1 << (s->chunk.valid_rows & 7)) - 1);
+          if (valid_map_base) {
+            uint32_t shift = row & 7;
+            uint32_t bits  = valid_map_base[row >> 3];
+            if (shift != 0 && row - shift + 8 < s->chunk.valid_rows) {
+              bits |= valid_map_base[(row >> 3) + 1] << 8;
+            }
+            valid = bits >> shift;
+          } else {
+            valid = 0xff;
+          }
+          if (row + 8 > s->chunk.valid_rows) {
+            valid = valid & ((1 << (s->chunk.valid_rows - row)) - 1);
           }
         }
-        s->valid_buf[(row >> 3) & 0x1ff] = valid;
+        s->valid_buf[(local_row >> 3) & 0x1ff] = valid;
       }
       __syncthreads();
       present_rows += nrows;
@@ -718,9 +772,7 @@ extern "C" __global__ void __launch_bounds__(512)
           uint32_t flush = (present_rows < s->chunk.num_rows) ? 0 : 7;
           nrows_out      = (nrows_out + flush) >> 3;
           nrows_out =
-            ByteRLE<CI_PRESENT, 0x1ff>(
-              s, s->valid_buf, (s->chunk.start_row + present_out) >> 3, nrows_out, flush, t) *
-            8;
+            ByteRLE<CI_PRESENT, 0x1ff>(s, s->valid_buf, present_out >> 3, nrows_out, flush, t) * 8;
         }
         __syncthreads();
         if (!t) { s->present_out = min(present_out + nrows_out, present_rows); }
@@ -731,6 +783,12 @@ extern "C" __global__ void __launch_bounds__(512)
     if (!s->chunk.streams[CI_DATA]) {
       // Pass-through
       __syncthreads();
+      if (s->chunk.bloom_filter) {
+        // Floating-point columns are passed through when they have no nulls
+        for (uint32_t local_row = s->cur_row + t; local_row < s->present_rows; local_row += 512) {
+          BloomFilterAdd(s, s->chunk.start_row + local_row);
+        }
+      }
       if (!t) {
         s->cur_row           = s->present_rows;
         s->strm_pos[CI_DATA] = s->cur_row * s->chunk.dtype_len;
@@ -740,8 +798,10 @@ extern "C" __global__ void __launch_bounds__(512)
       uint32_t maxnumvals = (s->chunk.type_kind == BOOLEAN) ? 2048 : 1024;
       uint32_t nrows =
         min(min(s->present_rows - s->cur_row, maxnumvals - max(s->numvals, s->numlengths)), 512);
-      uint32_t row   = s->chunk.start_row + s->cur_row + t;
-      uint32_t valid = (t < nrows) ? (s->valid_buf[(row >> 3) & 0x1ff] >> (row & 7)) & 1 : 0;
+      uint32_t local_row = s->cur_row + t;
+      uint32_t row       = s->chunk.start_row + local_row;
+      uint32_t valid =
+        (t < nrows) ? (s->valid_buf[(local_row >> 3) & 0x1ff] >> (local_row & 7)) & 1 : 0;
       s->buf.u32[t]  = valid;
 
       // TODO: Could use a faster reduction relying on _popc() for the initial phase
@@ -753,6 +813,7 @@ extern "C" __global__ void __launch_bounds__(512)
         switch (s->chunk.type_kind) {
           case INT:
           case DATE:
+          case LIST:
           case FLOAT: s->vals.u32[nz_idx] = reinterpret_cast<const uint32_t *>(base)[row]; break;
           case DOUBLE:
           case LONG: s->vals.u64[nz_idx] = reinterpret_cast<const uint64_t *>(base)[row]; break;
@@ -805,6 +866,7 @@ extern "C" __global__ void __launch_bounds__(512)
             break;
           default: break;
         }
+        if (s->chunk.bloom_filter) { BloomFilterAdd(s, row); }
       }
       __syncthreads();
       if (s->chunk.type_kind == STRING && s->chunk.encoding_kind != DICTIONARY_V2) {
@@ -861,6 +923,11 @@ extern "C" __global__ void __launch_bounds__(512)
           case BYTE:
             n = ByteRLE<CI_DATA, 0x3ff>(s, s->vals.u8, s->nnz - s->numvals, s->numvals, flush, t);
             break;
+          case LIST:
+            // Unsigned lengths of the list entries
+            n = IntegerRLE<CI_DATA, uint32_t, false, 0x3ff>(
+              s, s->vals.u32, s->nnz - s->numvals, s->numvals, flush, t);
+            break;
           case BOOLEAN:
             n = ByteRLE<CI_DATA, 0x1ff>(s,
                                         s->lengths.u8,
@@ -1293,7 +1360,12 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
   dim3 dim_grid(num_stripe_streams, 1);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream>>>(
     strm_desc, chunks, comp_in, comp_out, compressed_data, comp_blk_size);
-  if (compression == SNAPPY) { gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); }
+  switch (compression) {
+    case SNAPPY: gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); break;
+    case ZLIB: gpu_deflate(comp_in, comp_out, num_compressed_blocks, 0, stream); break;
+    case ZSTD: gpu_zstd(comp_in, comp_out, num_compressed_blocks, stream); break;
+    default: break;
+  }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream>>>(
     strm_desc, comp_in, comp_out, compressed_data, comp_blk_size);
@@ -21,16 +21,29 @@
 
 #include "writer_impl.hpp"
 
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <utility>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -39,12 +52,6 @@ using namespace cudf::io::orc;
 using namespace cudf::io;
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- **/
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to ORC compression
  **/
@@ -53,11 +60,70 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::GZIP: return orc::CompressionKind::ZLIB;
+    case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
 }
 
+/**
+ * @brief Returns the uncompressed size of a column, estimated the same way as the size of the
+ * row groups when deciding stripe boundaries
+ **/
+size_t estimated_size(column_view const &col)
+{
+  switch (col.type().id()) {
+    case type_id::STRING:
+      return col.size() + (col.size() > 0 ? strings_column_view(col).chars_size() : 0);
+    case type_id::LIST: {
+      // The lengths of the entries, and the child entries
+      size_t size = sizeof(size_type) * col.size();
+      if (col.size() > 0) { size += estimated_size(lists_column_view(col).child()); }
+      return size;
+    }
+    case type_id::STRUCT: {
+      size_t size = 0;
+      for (size_type i = 0; i < col.num_children(); ++i) { size += estimated_size(col.child(i)); }
+      return size;
+    }
+    default: return cudf::size_of(col.type()) * col.size();
+  }
+}
+
+/**
+ * @brief Returns the uncompressed size of a table, estimated the same way as the size of the
+ * row groups when deciding stripe boundaries
+ **/
+size_t estimated_size(table_view const &table)
+{
+  size_t size = 0;
+  for (auto const &col : table) { size += estimated_size(col); }
+  return size;
+}
+
+/**
+ * @brief Returns whether a table has columns written as ORC columns with child columns
+ **/
+bool has_nested_columns(table_view const &table)
+{
+  return std::any_of(table.begin(), table.end(), [](column_view const &col) {
+    return cudf::is_nested(col.type());
+  });
+}
+
+/**
+ * @brief Returns the maximum number of rows of a stripe, which limits the size of the string
+ * dictionaries
+ **/
+size_t max_stripe_rows(table_view const &table)
+{
+  auto const has_strings = std::any_of(table.begin(), table.end(), [](column_view const &col) {
+    return col.type().id() == type_id::STRING;
+  });
+  return has_strings ? 1000000 : 5000000;
+}
+
 /**
  * @brief Function that translates GDF dtype to ORC datatype
  **/
@@ -77,6 +143,8 @@ constexpr orc::TypeKind to_orc_type(cudf::type_id id)
     case cudf::type_id::TIMESTAMP_MILLISECONDS:
     case cudf::type_id::TIMESTAMP_NANOSECONDS: return TypeKind::TIMESTAMP;
     case cudf::type_id::STRING: return TypeKind::STRING;
+    case cudf::type_id::LIST: return TypeKind::LIST;
+    case cudf::type_id::STRUCT: return TypeKind::STRUCT;
     default: return TypeKind::INVALID_TYPE_KIND;
   }
 }
@@ -128,6 +196,15 @@ __global__ void stringdata_to_nvstrdesc(gpu::nvstrdesc_s *dst,
   }
 }
 
+/**
+ * @brief Helper kernel for converting list offsets into the lengths of the list entries
+ **/
+__global__ void offsets_to_lengths(size_type *dst, const size_type *offsets, size_type column_size)
+{
+  size_type row = blockIdx.x * blockDim.x + threadIdx.x;
+  if (row < column_size) { dst[row] = offsets[row + 1] - offsets[row]; }
+}
+
 /**
  * @brief Helper class that adds ORC-specific column info
  **/
@@ -135,24 +212,51 @@ class orc_column_view {
  public:
   /**
    * @brief Constructor that extracts out the string position + length pairs
-   * for building dictionaries for string columns
+   * for building dictionaries for string columns, and the entry lengths of list columns
+   *
+   * @param id Index of the column in the flattened list of ORC columns
+   * @param str_id Index of the column among the string columns
+   * @param parent_index Index of the parent ORC column, or -1 for a top-level column
+   * @param col Column data
+   * @param name Name of the column
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    **/
   explicit orc_column_view(size_t id,
                            size_t str_id,
+                           int parent_index,
                            column_view const &col,
-                           const table_metadata *metadata,
+                           std::string name,
                            cudaStream_t stream)
     : _id(id),
       _str_id(str_id),
+      _parent_index(parent_index),
       _string_type(col.type().id() == type_id::STRING),
-      _type_width(_string_type ? 0 : cudf::size_of(col.type())),
+      _type_width(is_fixed_width(col.type())
+                    ? cudf::size_of(col.type())
+                    : (col.type().id() == type_id::LIST) ? sizeof(size_type) : 0),
       _data_count(col.size()),
       _null_count(col.null_count()),
-      _data(col.head<uint8_t>() + col.offset() * _type_width),
+      _data(is_fixed_width(col.type()) ? col.head<uint8_t>() + col.offset() * _type_width
+                                       : nullptr),
       _nulls(col.nullable() ? col.null_mask() : nullptr),
       _clockscale(to_clockscale<uint8_t>(col.type().id())),
+      _name(std::move(name)),
       _type_kind(to_orc_type(col.type().id()))
   {
+    // The encoders address the null mask by row, so an offset mask is copied
+    if (col.nullable() && col.offset() != 0) {
+      _null_mask = copy_bitmask(col, stream);
+      _nulls     = static_cast<uint32_t const *>(_null_mask.data());
+    }
+    if (col.type().id() == type_id::LIST && _data_count > 0) {
+      lists_column_view list{col};
+      _indexes = rmm::device_buffer(_data_count * sizeof(size_type), stream);
+      offsets_to_lengths<<<((_data_count - 1) >> 8) + 1, 256, 0, stream>>>(
+        static_cast<size_type *>(_indexes.data()),
+        list.offsets().data<size_type>() + list.offset(),
+        _data_count);
+      _data = _indexes.data();
+    }
     if (_string_type && _data_count > 0) {
       strings_column_view view{col};
       _indexes = rmm::device_buffer(_data_count * sizeof(gpu::nvstrdesc_s), stream);
@@ -163,17 +267,12 @@ class orc_column_view {
         _nulls,
         _data_count);
       _data = _indexes.data();
-      CUDA_TRY(cudaStreamSynchronize(stream));
-    }
-    // Generating default name if name isn't present in metadata
-    if (metadata && _id < metadata->column_names.size()) {
-      _name = metadata->column_names[_id];
-    } else {
-      _name = "_col" + std::to_string(_id);
     }
+    CUDA_TRY(cudaStreamSynchronize(stream));
   }
 
   auto is_string() const noexcept { return _string_type; }
+  auto parent_index() const noexcept { return _parent_index; }
   void set_dict_stride(size_t stride) noexcept { dict_stride = stride; }
   auto get_dict_stride() const noexcept { return dict_stride; }
 
@@ -208,6 +307,59 @@ class orc_column_view {
   }
   auto device_stripe_dict() const { return d_stripe_dict; }
 
+  /**
+   * @brief Sets the first entry of each row group of the column, followed by the number of
+   * entries; the entries of child columns follow the rows of their parent
+   **/
+  void set_rowgroups(std::vector<size_type> &&rowgroup_starts)
+  {
+    _rowgroup_starts = std::move(rowgroup_starts);
+  }
+  auto const &rowgroup_starts() const noexcept { return _rowgroup_starts; }
+  size_type rowgroup_start(size_t rowgroup) const { return _rowgroup_starts[rowgroup]; }
+  size_type rowgroup_rows(size_t rowgroup) const
+  {
+    return _rowgroup_starts[rowgroup + 1] - _rowgroup_starts[rowgroup];
+  }
+  size_type max_rowgroup_rows() const
+  {
+    size_type max_rows = 0;
+    for (size_t g = 0; g + 1 < _rowgroup_starts.size(); ++g) {
+      max_rows = std::max(max_rows, rowgroup_rows(g));
+    }
+    return max_rows;
+  }
+
+  /**
+   * @brief Sets the location and the parameters of the bloom filters of the row groups of the
+   * column, in a buffer shared by all columns
+   *
+   * @param offset Offset of the bitset of the first row group in the shared buffer, in words
+   * @param num_bits Number of bits in the bitset of each row group
+   * @param num_hashes Number of hash functions
+   **/
+  void set_bloom_filters(size_t offset, uint32_t num_bits, uint32_t num_hashes) noexcept
+  {
+    _bloom_filter_offset = offset;
+    _bloom_filter_bits   = num_bits;
+    _bloom_filter_hashes = num_hashes;
+  }
+  bool has_bloom_filters() const noexcept { return _bloom_filter_bits != 0; }
+  size_t bloom_filter_offset(size_t rowgroup) const noexcept
+  {
+    return _bloom_filter_offset + rowgroup * (_bloom_filter_bits / 32);
+  }
+  uint32_t bloom_filter_bits() const noexcept { return _bloom_filter_bits; }
+  uint32_t bloom_filter_hashes() const noexcept { return _bloom_filter_hashes; }
+
+  /**
+   * @brief Takes ownership of the entries written for the children of the column
+   **/
+  void attach_children_data(std::unique_ptr<table> &&children_data)
+  {
+    _children_data = std::move(children_data);
+  }
+
   size_t type_width() const noexcept { return _type_width; }
   size_t data_count() const noexcept { return _data_count; }
   size_t null_count() const noexcept { return _null_count; }
@@ -225,6 +377,7 @@ class orc_column_view {
   // Identifier within set of columns and string columns, respectively
   size_t _id        = 0;
   size_t _str_id    = 0;
+  int _parent_index = -1;
   bool _string_type = false;
 
   size_t _type_width     = 0;
@@ -238,6 +391,16 @@ class orc_column_view {
   std::string _name{};
   TypeKind _type_kind;
   ColumnEncodingKind _encoding_kind;
+  std::vector<size_type> _rowgroup_starts;
+
+  // Row group bloom filters, if any
+  size_t _bloom_filter_offset   = 0;
+  uint32_t _bloom_filter_bits   = 0;
+  uint32_t _bloom_filter_hashes = 0;
+
+  // Owned copies of the null mask and of the entries of the children, if any
+  rmm::device_buffer _null_mask;
+  std::unique_ptr<table> _children_data;
 
   // String dictionary-related members
   rmm::device_buffer _indexes;
@@ -248,6 +411,118 @@ class orc_column_view {
   gpu::StripeDictionary *d_stripe_dict     = nullptr;
 };
 
+namespace {
+/**
+ * @brief Appends the ORC column of a cudf column, followed by the ORC columns of its
+ * descendants in pre-order
+ *
+ * The children of a list column are its child entries, and the children of a struct column hold
+ * one entry per valid struct row, as in ORC. Null list entries are expected to be empty.
+ *
+ * @param col Column to append
+ * @param name Name of the column
+ * @param parent_index Index of the parent ORC column, or -1 for a top-level column
+ * @param rowgroup_starts First entry of each row group of the column, followed by the number of
+ * entries
+ * @param orc_columns ORC columns to append to
+ * @param str_col_ids Indices of the string columns to append to
+ * @param mr Device memory resource to use for device memory allocation
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+void append_orc_columns(column_view const &col,
+                        std::string name,
+                        int parent_index,
+                        std::vector<size_type> &&rowgroup_starts,
+                        std::vector<orc_column_view> &orc_columns,
+                        std::vector<int> &str_col_ids,
+                        rmm::mr::device_memory_resource *mr,
+                        cudaStream_t stream)
+{
+  auto const index = static_cast<int>(orc_columns.size());
+  orc_columns.emplace_back(index, str_col_ids.size(), parent_index, col, std::move(name), stream);
+  if (orc_columns.back().is_string()) { str_col_ids.push_back(index); }
+
+  if (col.type().id() == type_id::LIST) {
+    lists_column_view list{col};
+    auto const child = list.get_sliced_child(stream);
+    // The row groups of the child start at the offsets of the row groups of the list
+    std::vector<size_type> child_starts(rowgroup_starts.size(), 0);
+    if (col.size() > 0) {
+      auto const offsets = list.offsets().data<size_type>() + list.offset();
+      for (size_t g = 0; g < rowgroup_starts.size(); ++g) {
+        CUDA_TRY(cudaMemcpyAsync(&child_starts[g],
+                                 offsets + rowgroup_starts[g],
+                                 sizeof(size_type),
+                                 cudaMemcpyDeviceToHost,
+                                 stream));
+      }
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      auto const first_offset = child_starts.front();
+      for (auto &start : child_starts) { start -= first_offset; }
+    }
+    orc_columns.back().set_rowgroups(std::move(rowgroup_starts));
+    append_orc_columns(
+      child, "_col0", index, std::move(child_starts), orc_columns, str_col_ids, mr, stream);
+  } else if (col.type().id() == type_id::STRUCT) {
+    structs_column_view const structs{col};
+    std::vector<column_view> children;
+    for (size_type i = 0; i < col.num_children(); ++i) {
+      children.push_back(structs.get_sliced_child(i));
+    }
+    std::vector<size_type> child_starts = rowgroup_starts;
+    if (col.null_count() != 0) {
+      // Only the entries of the valid struct rows are written to the children
+      rmm::device_vector<size_type> valid_rows(col.size() - col.null_count());
+      auto const null_mask = col.null_mask();
+      auto const offset    = col.offset();
+      thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(col.size()),
+                      valid_rows.begin(),
+                      [null_mask, offset] __device__(size_type row) {
+                        return bit_is_set(null_mask, offset + row);
+                      });
+      column_view const gather_map{data_type{type_id::INT32},
+                                   static_cast<size_type>(valid_rows.size()),
+                                   valid_rows.data().get()};
+      auto compacted = cudf::detail::gather(table_view{children},
+                                            gather_map,
+                                            cudf::detail::out_of_bounds_policy::FAIL,
+                                            cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                            mr,
+                                            stream);
+      auto const compacted_view = compacted->view();
+      children.assign(compacted_view.begin(), compacted_view.end());
+      orc_columns.back().attach_children_data(std::move(compacted));
+
+      std::vector<size_type> ranges;
+      for (size_t g = 0; g + 1 < rowgroup_starts.size(); ++g) {
+        ranges.push_back(offset + rowgroup_starts[g]);
+        ranges.push_back(offset + rowgroup_starts[g + 1]);
+      }
+      auto const valid_counts = cudf::detail::segmented_count_set_bits(null_mask, ranges, stream);
+      for (size_t g = 0; g < valid_counts.size(); ++g) {
+        child_starts[g + 1] = child_starts[g] + valid_counts[g];
+      }
+    }
+    orc_columns.back().set_rowgroups(std::move(rowgroup_starts));
+    for (size_t i = 0; i < children.size(); ++i) {
+      append_orc_columns(children[i],
+                         "_col" + std::to_string(i),
+                         index,
+                         std::vector<size_type>(child_starts),
+                         orc_columns,
+                         str_col_ids,
+                         mr,
+                         stream);
+    }
+  } else {
+    orc_columns.back().set_rowgroups(std::move(rowgroup_starts));
+  }
+}
+
+}  // namespace
+
 void writer::impl::init_dictionaries(orc_column_view *columns,
                                      size_t num_rows,
                                      std::vector<int> const &str_col_ids,
@@ -256,6 +531,7 @@ void writer::impl::init_dictionaries(orc_column_view *columns,
                                      hostdevice_vector<gpu::DictionaryChunk> &dict,
                                      cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE("orc::init_dictionaries");
   const size_t num_rowgroups = dict.size() / str_col_ids.size();
 
   // Setup per-rowgroup dictionary indexes for each dictionary-aware column
@@ -268,10 +544,10 @@ void writer::impl::init_dictionaries(orc_column_view *columns,
       auto *ck              = &dict[g * str_col_ids.size() + i];
       ck->valid_map_base    = str_column.nulls();
       ck->column_data_base  = str_column.data();
-      ck->dict_data         = dict_data + i * num_rows + g * row_index_stride_;
+      ck->dict_data         = dict_data + i * num_rows + str_column.rowgroup_start(g);
       ck->dict_index        = dict_index + i * num_rows;  // Indexed by abs row
-      ck->start_row         = g * row_index_stride_;
-      ck->num_rows          = std::min<uint32_t>(row_index_stride_,
+      ck->start_row         = str_column.rowgroup_start(g);
+      ck->num_rows          = std::min<uint32_t>(str_column.rowgroup_rows(g),
                                         std::max<int>(str_column.data_count() - ck->start_row, 0));
       ck->num_strings       = 0;
       ck->string_char_count = 0;
@@ -298,6 +574,7 @@ void writer::impl::build_dictionaries(orc_column_view *columns,
                                       hostdevice_vector<gpu::StripeDictionary> &stripe_dict,
                                       cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE("orc::build_dictionaries");
   const auto num_rowgroups = dict.size() / str_col_ids.size();
 
   for (size_t i = 0; i < str_col_ids.size(); i++) {
@@ -356,7 +633,6 @@ void writer::impl::build_dictionaries(orc_column_view *columns,
 
 std::vector<Stream> writer::impl::gather_streams(orc_column_view *columns,
                                                  size_t num_columns,
-                                                 size_t num_rows,
                                                  std::vector<uint32_t> const &stripe_list,
                                                  std::vector<int32_t> &strm_ids,
                                                  const orc_chunked_state &state)
@@ -368,6 +644,7 @@ std::vector<Stream> writer::impl::gather_streams(orc_column_view *columns,
   streams[0].kind   = ROW_INDEX;
   streams[0].length = 0;
 
+  size_t num_top_columns = 0;
   for (size_t i = 0; i < num_columns; ++i) {
     TypeKind kind                    = columns[i].orc_kind();
     StreamKind data_kind             = DATA;
@@ -380,52 +657,63 @@ std::vector<Stream> writer::impl::gather_streams(orc_column_view *columns,
     int64_t dict_stream_size    = 0;
     bool is_nullable;
 
+    // Stream sizes are per row group, for the largest row group of the column
+    auto const rowgroup_rows = std::max<int64_t>(columns[i].max_rowgroup_rows(), 1);
+    auto div_rowgroups_by    = [rowgroup_rows](int64_t modulus) {
+      return cudf::util::div_rounding_up_unsafe<int64_t, int64_t>(rowgroup_rows, modulus);
+    };
+
     if (state.single_write_mode) {
-      is_nullable = (columns[i].nullable() || columns[i].data_count() < num_rows);
+      auto const num_entries = static_cast<size_t>(columns[i].rowgroup_starts().back());
+      is_nullable            = (columns[i].nullable() || columns[i].data_count() < num_entries);
+    } else if (columns[i].parent_index() < 0) {
+      // The nullability specified by the user applies to the top-level columns
+      auto const &column_nullable = state.user_metadata_with_nullability.column_nullable;
+      is_nullable =
+        (num_top_columns < column_nullable.size()) ? column_nullable[num_top_columns] : true;
     } else {
-      is_nullable = (i < state.user_metadata_with_nullability.column_nullable.size())
-                      ? state.user_metadata_with_nullability.column_nullable[i]
-                      : true;
+      is_nullable = true;
     }
+    if (columns[i].parent_index() < 0) { ++num_top_columns; }
     if (is_nullable) {
-      present_stream_size = ((row_index_stride_ + 7) >> 3);
+      present_stream_size = ((rowgroup_rows + 7) >> 3);
       present_stream_size += (present_stream_size + 0x7f) >> 7;
     }
 
     switch (kind) {
       case TypeKind::BOOLEAN:
-        data_stream_size = div_rowgroups_by<int64_t>(1024) * (128 + 1);
+        data_stream_size = div_rowgroups_by(1024) * (128 + 1);
         encoding_kind    = DIRECT;
         break;
       case TypeKind::BYTE:
-        data_stream_size = div_rowgroups_by<int64_t>(128) * (128 + 1);
+        data_stream_size = div_rowgroups_by(128) * (128 + 1);
         encoding_kind    = DIRECT;
         break;
       case TypeKind::SHORT:
-        data_stream_size = div_rowgroups_by<int64_t>(512) * (512 * 2 + 2);
+        data_stream_size = div_rowgroups_by(512) * (512 * 2 + 2);
         encoding_kind    = DIRECT_V2;
         break;
       case TypeKind::FLOAT:
         // Pass through if no nulls (no RLE encoding for floating point)
         data_stream_size = (columns[i].null_count() != 0)
-                             ? div_rowgroups_by<int64_t>(512) * (512 * 4 + 2)
+                             ? div_rowgroups_by(512) * (512 * 4 + 2)
                              : INT64_C(-1);
         encoding_kind = DIRECT;
         break;
       case TypeKind::INT:
       case TypeKind::DATE:
-        data_stream_size = div_rowgroups_by<int64_t>(512) * (512 * 4 + 2);
+        data_stream_size = div_rowgroups_by(512) * (512 * 4 + 2);
         encoding_kind    = DIRECT_V2;
         break;
       case TypeKind::DOUBLE:
         // Pass through if no nulls (no RLE encoding for floating point)
         data_stream_size = (columns[i].null_count() != 0)
-                             ? div_rowgroups_by<int64_t>(512) * (512 * 8 + 2)
+                             ? div_rowgroups_by(512) * (512 * 8 + 2)
                              : INT64_C(-1);
         encoding_kind = DIRECT;
         break;
       case TypeKind::LONG:
-        data_stream_size = div_rowgroups_by<int64_t>(512) * (512 * 8 + 2);
+        data_stream_size = div_rowgroups_by(512) * (512 * 8 + 2);
         encoding_kind    = DIRECT_V2;
         break;
       case TypeKind::STRING: {
@@ -458,23 +746,33 @@ std::vector<Stream> writer::impl::gather_streams(orc_column_view *columns,
 
         // Decide between direct or dictionary encoding
         if (enable_dict && dict_data_size < direct_data_size) {
-          data_stream_size  = div_rowgroups_by<int64_t>(512) * (512 * 4 + 2);
+          data_stream_size  = div_rowgroups_by(512) * (512 * 4 + 2);
           data2_stream_size = dict_lengths_div512 * (512 * 4 + 2);
           dict_stream_size  = std::max<size_t>(dict_data_size, 1);
           encoding_kind     = DICTIONARY_V2;
         } else {
           data_stream_size  = std::max<size_t>(direct_data_size, 1);
-          data2_stream_size = div_rowgroups_by<int64_t>(512) * (512 * 4 + 2);
+          data2_stream_size = div_rowgroups_by(512) * (512 * 4 + 2);
           encoding_kind     = DIRECT_V2;
         }
         break;
       }
       case TypeKind::TIMESTAMP:
-        data_stream_size  = ((row_index_stride_ + 0x1ff) >> 9) * (512 * 4 + 2);
+        data_stream_size  = div_rowgroups_by(512) * (512 * 4 + 2);
         data2_stream_size = data_stream_size;
         data2_kind        = SECONDARY;
         encoding_kind     = DIRECT_V2;
         break;
+      case TypeKind::LIST:
+        // The lengths of the list entries are written in place of the data stream
+        data_stream_size = div_rowgroups_by(512) * (512 * 4 + 2);
+        data_kind        = LENGTH;
+        encoding_kind    = DIRECT_V2;
+        break;
+      case TypeKind::STRUCT:
+        // Only the present stream
+        encoding_kind = DIRECT;
+        break;
       default: CUDF_FAIL("Unsupported ORC type kind");
     }
 
@@ -516,13 +814,13 @@ std::vector<Stream> writer::impl::gather_streams(orc_column_view *columns,
 
 rmm::device_buffer writer::impl::encode_columns(orc_column_view *columns,
                                                 size_t num_columns,
-                                                size_t num_rows,
                                                 size_t num_rowgroups,
                                                 std::vector<int> const &str_col_ids,
                                                 std::vector<uint32_t> const &stripe_list,
                                                 std::vector<Stream> const &streams,
                                                 std::vector<int32_t> const &strm_ids,
                                                 hostdevice_vector<gpu::EncChunk> &chunks,
+                                                uint32_t *bloom_filters,
                                                 cudaStream_t stream)
 {
   // Allocate combined buffer for RLE data and string data output
@@ -549,6 +847,7 @@ rmm::device_buffer writer::impl::encode_columns(orc_column_view *columns,
 
     return rmm::device_buffer(rle_data_size + str_data_size, stream);
   }();
+  CUDF_SCOPED_RANGE_PAYLOAD("orc::encode_columns", output.size());
   auto dst_base = static_cast<uint8_t *>(output.data());
 
   // Initialize column chunks' descriptions
@@ -557,8 +856,8 @@ rmm::device_buffer writer::impl::encode_columns(orc_column_view *columns,
   for (size_t j = 0; j < num_rowgroups; j++) {
     for (size_t i = 0; i < num_columns; i++) {
       auto *ck          = &chunks[j * num_columns + i];
-      ck->start_row     = (j * row_index_stride_);
-      ck->num_rows      = std::min<uint32_t>(row_index_stride_, num_rows - ck->start_row);
+      ck->start_row     = columns[i].rowgroup_start(j);
+      ck->num_rows      = columns[i].rowgroup_rows(j);
       ck->valid_rows    = columns[i].data_count();
       ck->encoding_kind = columns[i].orc_encoding();
       ck->type_kind     = columns[i].orc_kind();
@@ -573,7 +872,19 @@ rmm::device_buffer writer::impl::encode_columns(orc_column_view *columns,
         ck->column_data_base = columns[i].data();
         ck->dtype_len        = columns[i].type_width();
       }
-      ck->scale = columns[i].clockscale();
+      ck->scale       = columns[i].clockscale();
+      ck->string_data = (ck->type_kind == TypeKind::STRING)
+                          ? static_cast<gpu::nvstrdesc_s const *>(columns[i].data())
+                          : nullptr;
+      if (columns[i].has_bloom_filters()) {
+        ck->bloom_filter        = bloom_filters + columns[i].bloom_filter_offset(j);
+        ck->bloom_filter_bits   = columns[i].bloom_filter_bits();
+        ck->bloom_filter_hashes = columns[i].bloom_filter_hashes();
+      } else {
+        ck->bloom_filter        = nullptr;
+        ck->bloom_filter_bits   = 0;
+        ck->bloom_filter_hashes = 0;
+      }
 
       for (int k = 0; k < gpu::CI_NUM_STREAMS; k++) {
         const auto strm_id = strm_ids[i * gpu::CI_NUM_STREAMS + k];
@@ -655,6 +966,7 @@ std::vector<StripeInformation> writer::impl::gather_stripes(
   hostdevice_vector<gpu::StripeStream> &strm_desc,
   cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE("orc::gather_stripes");
   std::vector<StripeInformation> stripes(stripe_list.size());
   size_t group        = 0;
   size_t stripe_start = 0;
@@ -713,6 +1025,7 @@ std::vector<std::vector<uint8_t>> writer::impl::gather_statistic_blobs(
   hostdevice_vector<gpu::EncChunk> &chunks,
   cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE("orc::gather_statistic_blobs");
   size_t num_stat_blobs = (1 + stripe_list.size()) * num_columns;
   size_t num_chunks     = chunks.size();
   std::vector<std::vector<uint8_t>> stat_blobs(num_stat_blobs);
@@ -773,12 +1086,34 @@ std::vector<std::vector<uint8_t>> writer::impl::gather_statistic_blobs(
                            stat_merge.memory_size(),
                            cudaMemcpyHostToDevice,
                            stream));
-  CUDA_TRY(gpu::orc_init_statistics_groups(stat_groups.data().get(),
-                                           stat_desc.device_ptr(),
-                                           num_columns,
-                                           num_rowgroups,
-                                           row_index_stride_,
-                                           stream));
+  auto const has_children = std::any_of(
+    columns, columns + num_columns, [](auto const &col) { return col.parent_index() >= 0; });
+  if (has_children) {
+    // The row groups of child columns do not follow the row index stride
+    std::vector<statistics_group> groups(num_chunks);
+    for (size_t i = 0; i < num_columns; i++) {
+      for (size_t g = 0; g < num_rowgroups; g++) {
+        auto const start_row = columns[i].rowgroup_start(g);
+        auto *group          = &groups[i * num_rowgroups + g];
+        group->col           = stat_desc.device_ptr(i);
+        group->start_row     = start_row;
+        group->num_rows      = std::min<uint32_t>(
+          columns[i].rowgroup_rows(g), std::max<int>(columns[i].data_count() - start_row, 0));
+      }
+    }
+    CUDA_TRY(cudaMemcpyAsync(stat_groups.data().get(),
+                             groups.data(),
+                             groups.size() * sizeof(statistics_group),
+                             cudaMemcpyHostToDevice,
+                             stream));
+  } else {
+    CUDA_TRY(gpu::orc_init_statistics_groups(stat_groups.data().get(),
+                                             stat_desc.device_ptr(),
+                                             num_columns,
+                                             num_rowgroups,
+                                             row_index_stride_,
+                                             stream));
+  }
   CUDA_TRY(
     GatherColumnStatistics(stat_chunks.data().get(), stat_groups.data().get(), num_chunks, stream));
   CUDA_TRY(MergeColumnStatistics(stat_chunks.data().get() + num_chunks,
@@ -916,24 +1251,47 @@ void writer::impl::write_index_stream(int32_t stripe_id,
 void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
                                      gpu::EncChunk const &chunk,
                                      uint8_t const *compressed_data,
-                                     uint8_t *stream_out,
                                      StripeInformation &stripe,
                                      std::vector<Stream> &streams,
-                                     cudaStream_t stream)
+                                     device_write_pipeline &pipeline)
 {
   const auto length                                    = strm_desc.stream_size;
   streams[chunk.strm_id[strm_desc.stream_type]].length = length;
   if (length != 0) {
     const auto *stream_in = (compression_kind_ == NONE) ? chunk.streams[strm_desc.stream_type]
                                                         : (compressed_data + strm_desc.bfr_offset);
-    CUDA_TRY(cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
-
-    out_sink_->host_write(stream_out, length);
+    pipeline.write(stream_in, length);
   }
   stripe.dataLength += length;
 }
 
+Stream writer::impl::write_bloom_filter_stream(uint32_t column_id,
+                                               orc_column_view const &column,
+                                               std::vector<uint32_t> const &bloom_filters,
+                                               size_t group,
+                                               size_t groups_in_stripe,
+                                               StripeInformation &stripe,
+                                               ProtobufWriter *pbw)
+{
+  // The bitsets are sequences of little-endian 64-bit words
+  auto const bitset_size = column.bloom_filter_bits() / 8;
+  BloomFilterIndex index;
+  index.bloomFilter.resize(groups_in_stripe);
+  for (size_t g = 0; g < groups_in_stripe; g++) {
+    auto const bits = bloom_filters.data() + column.bloom_filter_offset(group + g);
+    index.bloomFilter[g].numHashFunctions = column.bloom_filter_hashes();
+    index.bloomFilter[g].utf8bitset.assign(reinterpret_cast<char const *>(bits), bitset_size);
+  }
+
+  buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
+  pbw->write(&index);
+  add_uncompressed_block_headers(buffer_);
+  out_sink_->host_write(buffer_.data(), buffer_.size());
+  stripe.indexLength += buffer_.size();
+
+  return Stream{BLOOM_FILTER_UTF8, column_id, buffer_.size()};
+}
+
 void writer::impl::add_uncompressed_block_headers(std::vector<uint8_t> &v)
 {
   if (compression_kind_ != NONE) {
@@ -959,9 +1317,25 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
                    rmm::mr::device_memory_resource *mr)
   : compression_kind_(to_orc_compression(options.compression)),
     enable_statistics_(options.enable_statistics),
+    max_stripe_size_(options.stripe_size),
+    bloom_filter_fpp_(options.bloom_filter_fpp),
     out_sink_(std::move(sink)),
     _mr(mr)
 {
+  CUDF_EXPECTS(max_stripe_size_ > 0, "Stripe size must be positive");
+  CUDF_EXPECTS(std::all_of(bloom_filter_fpp_.begin(),
+                           bloom_filter_fpp_.end(),
+                           [](double fpp) { return fpp < 1.0; }),
+               "Bloom filter false positive probability must be less than 1");
+  // Non-blocking, so that the copies of written stripes do not wait for the encoding of the next
+  // ones on the legacy default stream
+  CUDA_TRY(cudaStreamCreateWithFlags(&write_stream_, cudaStreamNonBlocking));
+}
+
+writer::impl::~impl()
+{
+  if (stripe_write_.valid()) { stripe_write_.wait(); }
+  cudaStreamDestroy(write_stream_);
 }
 
 void writer::impl::write(table_view const &table,
@@ -986,42 +1360,176 @@ void writer::impl::write_chunked_begin(orc_chunked_state &state)
 
 void writer::impl::write_chunked(table_view const &table, orc_chunked_state &state)
 {
-  size_type num_columns = table.num_columns();
-  size_type num_rows    = 0;
+  // Struct columns cannot be concatenated, so tables with nested columns are not coalesced
+  if (state.single_write_mode || !state.coalesce_chunks || has_nested_columns(table)) {
+    write_stripes(table, state);
+    return;
+  }
+
+  std::vector<table_view> views;
+  for (auto const &pending : state.pending_tables) { views.push_back(pending->view()); }
+  views.push_back(table);
+  if (views.size() > 1) {
+    CUDF_EXPECTS(views.front().num_columns() == table.num_columns(),
+                 "Mismatch in table structure between multiple calls to write_chunked");
+    CUDF_EXPECTS(std::equal(table.begin(),
+                            table.end(),
+                            views.front().begin(),
+                            [](column_view const &lhs, column_view const &rhs) {
+                              return lhs.type() == rhs.type();
+                            }),
+                 "Mismatch in column types between multiple calls to write_chunked");
+  }
+
+  // Rows of a stripe of the target size, in whole row groups
+  size_t const total_bytes = state.pending_bytes + estimated_size(table);
+  size_t num_rows          = 0;
+  for (auto const &view : views) { num_rows += view.num_rows(); }
+  auto const row_bytes = std::max<size_t>(total_bytes / std::max<size_t>(num_rows, 1), 1);
+  auto stripe_rows     = std::min(max_stripe_size_ / row_bytes, max_stripe_rows(table));
+  stripe_rows          = std::max(stripe_rows / row_index_stride_, size_t{1}) * row_index_stride_;
+
+  if (num_rows < stripe_rows) {
+    state.pending_tables.push_back(std::make_unique<cudf::table>(table, state.stream, _mr));
+    state.pending_bytes = total_bytes;
+    return;
+  }
+
+  // Write the rows that fill whole stripes, and keep buffering the others
+  auto combined = (views.size() > 1) ? cudf::detail::concatenate(views, _mr, state.stream)
+                                     : std::unique_ptr<cudf::table>{};
+  auto const all_rows   = combined ? combined->view() : table;
+  auto const write_rows = static_cast<size_type>(num_rows / stripe_rows * stripe_rows);
+  auto const parts      = cudf::split(all_rows, {write_rows});
+  write_stripes(parts[0], state);
+
+  state.pending_tables.clear();
+  state.pending_bytes = 0;
+  if (parts[1].num_rows() > 0) {
+    state.pending_tables.push_back(std::make_unique<cudf::table>(parts[1], state.stream, _mr));
+    state.pending_bytes = estimated_size(parts[1]);
+  }
+}
+
+void writer::impl::write_stripes(table_view const &table, orc_chunked_state &state)
+{
+  size_type num_rows = 0;
+  for (auto const &col : table) { num_rows = std::max(num_rows, col.size()); }
 
   // Mapping of string columns for quick look-up
   std::vector<int> str_col_ids;
 
   if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
     CUDF_EXPECTS(state.user_metadata_with_nullability.column_nullable.size() ==
-                   static_cast<size_t>(num_columns),
+                   static_cast<size_t>(table.num_columns()),
                  "When passing values in user_metadata_with_nullability, data for all columns must "
                  "be specified");
   }
 
-  // Wrapper around cudf columns to attach ORC-specific type info
+  // The PRESENT stream of a row group ends on a partial byte, and the entries of child columns
+  // do not start on byte boundaries; files with nested columns have one row group per stripe
+  auto const has_nested = has_nested_columns(table);
+  if (state.ff.headerLength == 0 && has_nested && num_rows > 0) {
+    auto const row_bytes   = std::max<size_t>(estimated_size(table) / num_rows, 1);
+    auto const stripe_rows = std::min(max_stripe_size_ / row_bytes, max_stripe_rows(table));
+
+    // Stripes of the target size, in multiples of the default stride
+    row_index_stride_ *= std::max(stripe_rows / row_index_stride_, size_t{1});
+  }
+
+  // Wrapper around cudf columns to attach ORC-specific type info, with the columns of the
+  // children of nested columns following their parent
+  const auto num_rowgroups = div_by_rowgroups<size_t>(num_rows);
   std::vector<orc_column_view> orc_columns;
-  orc_columns.reserve(num_columns);  // Avoids unnecessary re-allocation
-  for (auto it = table.begin(); it < table.end(); ++it) {
-    const auto col            = *it;
-    const auto current_id     = orc_columns.size();
-    const auto current_str_id = str_col_ids.size();
-
-    num_rows = std::max<uint32_t>(num_rows, col.size());
-    orc_columns.emplace_back(current_id, current_str_id, col, state.user_metadata, state.stream);
-    if (orc_columns.back().is_string()) { str_col_ids.push_back(current_id); }
+  for (size_type i = 0; i < table.num_columns(); ++i) {
+    // Generating default name if name isn't present in metadata
+    auto name = "_col" + std::to_string(i);
+    if (state.user_metadata && static_cast<size_t>(i) < state.user_metadata->column_names.size()) {
+      name = state.user_metadata->column_names[i];
+    }
+    std::vector<size_type> rowgroup_starts(num_rowgroups + 1);
+    for (size_t g = 0; g <= num_rowgroups; ++g) {
+      rowgroup_starts[g] = std::min<size_t>(g * row_index_stride_, num_rows);
+    }
+    append_orc_columns(table.column(i),
+                       std::move(name),
+                       -1,
+                       std::move(rowgroup_starts),
+                       orc_columns,
+                       str_col_ids,
+                       _mr,
+                       state.stream);
+  }
+  size_type num_columns = orc_columns.size();
+
+  // Bloom filters are written for the row groups of the top-level columns with a positive false
+  // positive probability; their bitsets are sized for the largest row group, as in ORC
+  size_t bloom_filter_words = 0;
+  size_t top_column         = 0;
+  for (auto &column : orc_columns) {
+    if (column.parent_index() >= 0) { continue; }
+    auto const fpp = (top_column < bloom_filter_fpp_.size()) ? bloom_filter_fpp_[top_column] : 0.0;
+    ++top_column;
+    if (fpp <= 0.0) { continue; }
+    switch (column.orc_kind()) {
+      case TypeKind::BYTE:
+      case TypeKind::SHORT:
+      case TypeKind::INT:
+      case TypeKind::LONG:
+      case TypeKind::DATE:
+      case TypeKind::FLOAT:
+      case TypeKind::DOUBLE:
+      case TypeKind::STRING: break;
+      default:
+        CUDF_FAIL("Bloom filters are not supported for the type of column " + column.orc_name());
+    }
+    auto const entries  = std::max<double>(column.max_rowgroup_rows(), 1);
+    auto const min_bits = -entries * std::log(fpp) / (std::log(2.0) * std::log(2.0));
+    auto const num_bits = static_cast<uint32_t>(std::ceil(min_bits / 64) * 64);
+    auto const num_hashes =
+      std::max<uint32_t>(1, static_cast<uint32_t>(std::lround(min_bits / entries * std::log(2.0))));
+    column.set_bloom_filters(bloom_filter_words, num_bits, num_hashes);
+    bloom_filter_words += num_rowgroups * (num_bits / 32);
   }
+  rmm::device_vector<uint32_t> bloom_filters(bloom_filter_words, 0);
 
-  rmm::device_vector<uint32_t> dict_index(str_col_ids.size() * num_rows);
-  rmm::device_vector<uint32_t> dict_data(str_col_ids.size() * num_rows);
+  if (state.ff.headerLength == 0) {
+    // First call
+    state.ff.headerLength   = std::strlen(MAGIC);
+    state.ff.rowIndexStride = row_index_stride_;
+    state.ff.types.resize(1 + num_columns);
+    state.ff.types[0].kind = STRUCT;
+    for (int i = 0; i < num_columns; ++i) {
+      auto const &column         = orc_columns[i];
+      auto &parent_type          = state.ff.types[1 + column.parent_index()];
+      state.ff.types[1 + i].kind = column.orc_kind();
+      parent_type.subtypes.push_back(1 + i);
+      if (parent_type.kind == STRUCT) { parent_type.fieldNames.push_back(column.orc_name()); }
+    }
+  } else {
+    // verify the user isn't passing mismatched tables
+    CUDF_EXPECTS(state.ff.types.size() == 1 + orc_columns.size(),
+                 "Mismatch in table structure between multiple calls to write_chunked");
+    for (auto i = 0; i < num_columns; i++) {
+      CUDF_EXPECTS(state.ff.types[1 + i].kind == orc_columns[i].orc_kind(),
+                   "Mismatch in column types between multiple calls to write_chunked");
+    }
+  }
+
+  // Dictionary memory is reserved for the entries of the largest string column
+  size_t dict_rows = 0;
+  for (auto const id : str_col_ids) {
+    dict_rows = std::max<size_t>(dict_rows, orc_columns[id].rowgroup_starts().back());
+  }
+  rmm::device_vector<uint32_t> dict_index(str_col_ids.size() * dict_rows);
+  rmm::device_vector<uint32_t> dict_data(str_col_ids.size() * dict_rows);
 
   // Build per-column dictionary indices
-  const auto num_rowgroups   = div_by_rowgroups<size_t>(num_rows);
   const auto num_dict_chunks = num_rowgroups * str_col_ids.size();
   hostdevice_vector<gpu::DictionaryChunk> dict(num_dict_chunks);
   if (str_col_ids.size() != 0) {
     init_dictionaries(orc_columns.data(),
-                      num_rows,
+                      dict_rows,
                       str_col_ids,
                       dict_data.data().get(),
                       dict_index.data().get(),
@@ -1030,23 +1538,23 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
   }
 
   // Decide stripe boundaries early on, based on uncompressed size
+  const auto max_rows = max_stripe_rows(table);
   std::vector<uint32_t> stripe_list;
   for (size_t g = 0, stripe_start = 0, stripe_size = 0; g < num_rowgroups; g++) {
     size_t rowgroup_size = 0;
     for (int i = 0; i < num_columns; i++) {
       if (orc_columns[i].is_string()) {
         const auto dt = orc_columns[i].host_dict_chunk(g);
-        rowgroup_size += 1 * row_index_stride_;
+        rowgroup_size += 1 * orc_columns[i].rowgroup_rows(g);
         rowgroup_size += dt->string_char_count;
       } else {
-        rowgroup_size += orc_columns[i].type_width() * row_index_stride_;
+        rowgroup_size += orc_columns[i].type_width() * orc_columns[i].rowgroup_rows(g);
       }
     }
 
     // Apply rows per stripe limit to limit string dictionaries
-    const size_t max_stripe_rows = !str_col_ids.empty() ? 1000000 : 5000000;
-    if ((g > stripe_start) && (stripe_size + rowgroup_size > max_stripe_size_ ||
-                               (g + 1 - stripe_start) * row_index_stride_ > max_stripe_rows)) {
+    if ((g > stripe_start) && (has_nested || stripe_size + rowgroup_size > max_stripe_size_ ||
+                               (g + 1 - stripe_start) * row_index_stride_ > max_rows)) {
       stripe_list.push_back(g - stripe_start);
       stripe_start = g;
       stripe_size  = 0;
@@ -1060,7 +1568,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
   hostdevice_vector<gpu::StripeDictionary> stripe_dict(num_stripe_dict);
   if (str_col_ids.size() != 0) {
     build_dictionaries(orc_columns.data(),
-                       num_rows,
+                       dict_rows,
                        str_col_ids,
                        stripe_list,
                        dict,
@@ -1071,22 +1579,29 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
 
   // Initialize streams
   std::vector<int32_t> strm_ids(num_columns * gpu::CI_NUM_STREAMS, -1);
-  auto streams =
-    gather_streams(orc_columns.data(), orc_columns.size(), num_rows, stripe_list, strm_ids, state);
+  auto streams = gather_streams(orc_columns.data(), num_columns, stripe_list, strm_ids, state);
 
   // Encode column data chunks
   const auto num_chunks = num_rowgroups * num_columns;
   hostdevice_vector<gpu::EncChunk> chunks(num_chunks);
   auto output = encode_columns(orc_columns.data(),
                                num_columns,
-                               num_rows,
                                num_rowgroups,
                                str_col_ids,
                                stripe_list,
                                streams,
                                strm_ids,
                                chunks,
+                               bloom_filters.data().get(),
                                state.stream);
+  std::vector<uint32_t> host_bloom_filters(bloom_filter_words);
+  if (bloom_filter_words != 0) {
+    CUDA_TRY(cudaMemcpyAsync(host_bloom_filters.data(),
+                             bloom_filters.data().get(),
+                             bloom_filter_words * sizeof(uint32_t),
+                             cudaMemcpyDeviceToHost,
+                             state.stream));
+  }
 
   // Assemble individual desparate column chunks into contiguous data streams
   const auto num_index_streams  = (num_columns + 1);
@@ -1115,43 +1630,30 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                                           state.stream);
   }
 
-  // Allocate intermediate output stream buffer
+  // Compute the layout of the compressed streams
   size_t compressed_bfr_size   = 0;
   size_t num_compressed_blocks = 0;
-  auto stream_output           = [&]() {
-    size_t max_stream_size = 0;
-
-    for (size_t stripe_id = 0; stripe_id < stripe_list.size(); stripe_id++) {
-      for (size_t i = 0; i < num_data_streams; i++) {
-        gpu::StripeStream *ss = &strm_desc[stripe_id * num_data_streams + i];
-        size_t stream_size    = ss->stream_size;
-        if (compression_kind_ != NONE) {
-          ss->first_block = num_compressed_blocks;
-          ss->bfr_offset  = compressed_bfr_size;
-
-          auto num_blocks = std::max<uint32_t>(
-            (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
-          stream_size += num_blocks * 3;
-          num_compressed_blocks += num_blocks;
-          compressed_bfr_size += stream_size;
-        }
-        max_stream_size = std::max(max_stream_size, stream_size);
-      }
+  if (compression_kind_ != NONE) {
+    for (size_t i = 0; i < strm_desc.size(); i++) {
+      gpu::StripeStream *ss = &strm_desc[i];
+      ss->first_block       = num_compressed_blocks;
+      ss->bfr_offset        = compressed_bfr_size;
+
+      auto num_blocks = std::max<uint32_t>(
+        (ss->stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
+      num_compressed_blocks += num_blocks;
+      compressed_bfr_size += ss->stream_size + num_blocks * 3;
     }
-
-    return pinned_buffer<uint8_t>{[](size_t size) {
-                                    uint8_t *ptr = nullptr;
-                                    CUDA_TRY(cudaMallocHost(&ptr, size));
-                                    return ptr;
-                                  }(max_stream_size),
-                                  cudaFreeHost};
-  }();
+  }
 
   // Compress the data streams
   rmm::device_buffer compressed_data(compressed_bfr_size, state.stream);
   hostdevice_vector<gpu_inflate_status_s> comp_out(num_compressed_blocks);
   hostdevice_vector<gpu_inflate_input_s> comp_in(num_compressed_blocks);
   if (compression_kind_ != NONE) {
+    size_t uncompressed_size = 0;
+    for (size_t i = 0; i < strm_desc.size(); ++i) { uncompressed_size += strm_desc[i].stream_size; }
+    CUDF_SCOPED_RANGE_PAYLOAD("orc::compress_data_streams", uncompressed_size);
     CUDA_TRY(cudaMemcpyAsync(strm_desc.device_ptr(),
                              strm_desc.host_ptr(),
                              strm_desc.memory_size(),
@@ -1177,87 +1679,23 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                              comp_out.memory_size(),
                              cudaMemcpyDeviceToHost,
                              state.stream));
-    CUDA_TRY(cudaStreamSynchronize(state.stream));
-  }
-
-  ProtobufWriter pbw_(&buffer_);
-
-  // Write stripes
-  size_t group = 0;
-  for (size_t stripe_id = 0; stripe_id < stripes.size(); stripe_id++) {
-    auto groups_in_stripe     = div_by_rowgroups(stripes[stripe_id].numberOfRows);
-    stripes[stripe_id].offset = out_sink_->bytes_written();
-
-    // Column (skippable) index streams appear at the start of the stripe
-    stripes[stripe_id].indexLength = 0;
-    for (size_t col_id = 0; col_id <= (size_t)num_columns; col_id++) {
-      write_index_stream(stripe_id,
-                         col_id,
-                         orc_columns.data(),
-                         num_columns,
-                         num_data_streams,
-                         group,
-                         groups_in_stripe,
-                         chunks,
-                         strm_desc,
-                         comp_out,
-                         stripes[stripe_id],
-                         streams,
-                         &pbw_);
-    }
-
-    // Column data consisting one or more separate streams
-    stripes[stripe_id].dataLength = 0;
-    for (size_t i = 0; i < num_data_streams; i++) {
-      const auto &ss = strm_desc[stripe_id * num_data_streams + i];
-      const auto &ck = chunks[group * num_columns + ss.column_id];
-
-      write_data_stream(ss,
-                        ck,
-                        static_cast<uint8_t *>(compressed_data.data()),
-                        stream_output.get(),
-                        stripes[stripe_id],
-                        streams,
-                        state.stream);
-    }
-
-    // Write stripefooter consisting of stream information
-    StripeFooter sf;
-    sf.streams = streams;
-    sf.columns.resize(num_columns + 1);
-    sf.columns[0].kind           = DIRECT;
-    sf.columns[0].dictionarySize = 0;
-    for (size_t i = 1; i < sf.columns.size(); ++i) {
-      sf.columns[i].kind           = orc_columns[i - 1].orc_encoding();
-      sf.columns[i].dictionarySize = (sf.columns[i].kind == DICTIONARY_V2)
-                                       ? orc_columns[i - 1].host_stripe_dict(stripe_id)->num_strings
-                                       : 0;
-      if (orc_columns[i - 1].orc_kind() == TIMESTAMP) { sf.writerTimezone = "UTC"; }
-    }
-    buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
-    pbw_.write(&sf);
-    stripes[stripe_id].footerLength = buffer_.size();
-    if (compression_kind_ != NONE) {
-      uint32_t uncomp_sf_len = (stripes[stripe_id].footerLength - 3) * 2 + 1;
-      buffer_[0]             = static_cast<uint8_t>(uncomp_sf_len >> 0);
-      buffer_[1]             = static_cast<uint8_t>(uncomp_sf_len >> 8);
-      buffer_[2]             = static_cast<uint8_t>(uncomp_sf_len >> 16);
-    }
-    out_sink_->host_write(buffer_.data(), buffer_.size());
-
-    group += groups_in_stripe;
   }
+  // The stripes are copied to the host on another stream
+  CUDA_TRY(cudaStreamSynchronize(state.stream));
 
   if (column_stats.size() != 0) {
+    std::vector<uint8_t> stats_buffer;
+    ProtobufWriter pbw(&stats_buffer);
+
     // File-level statistics
     // NOTE: Excluded from chunked write mode to avoid the need for merging stats accross calls
     if (state.single_write_mode) {
       state.ff.statistics.resize(1 + num_columns);
       // First entry contains total number of rows
-      buffer_.resize(0);
-      pbw_.putb(1 * 8 + PB_TYPE_VARINT);
-      pbw_.put_uint(num_rows);
-      state.ff.statistics[0] = std::move(buffer_);
+      stats_buffer.resize(0);
+      pbw.putb(1 * 8 + PB_TYPE_VARINT);
+      pbw.put_uint(num_rows);
+      state.ff.statistics[0] = std::move(stats_buffer);
       for (int i = 0; i < num_columns; i++) {
         size_t idx = stripe_list.size() * num_columns + i;
         if (idx < column_stats.size()) {
@@ -1270,10 +1708,10 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
     state.md.stripeStats.resize(first_stripe + stripe_list.size());
     for (size_t stripe_id = 0; stripe_id < stripe_list.size(); stripe_id++) {
       state.md.stripeStats[first_stripe + stripe_id].colStats.resize(1 + num_columns);
-      buffer_.resize(0);
-      pbw_.putb(1 * 8 + PB_TYPE_VARINT);
-      pbw_.put_uint(stripes[stripe_id].numberOfRows);
-      state.md.stripeStats[first_stripe + stripe_id].colStats[0] = std::move(buffer_);
+      stats_buffer.resize(0);
+      pbw.putb(1 * 8 + PB_TYPE_VARINT);
+      pbw.put_uint(stripes[stripe_id].numberOfRows);
+      state.md.stripeStats[first_stripe + stripe_id].colStats[0] = std::move(stats_buffer);
       for (int i = 0; i < num_columns; i++) {
         size_t idx = stripe_list.size() * i + stripe_id;
         if (idx < column_stats.size()) {
@@ -1283,36 +1721,148 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
       }
     }
   }
-  if (state.ff.headerLength == 0) {
-    // First call
-    state.ff.headerLength   = std::strlen(MAGIC);
-    state.ff.rowIndexStride = row_index_stride_;
-    state.ff.types.resize(1 + num_columns);
-    state.ff.types[0].kind = STRUCT;
-    state.ff.types[0].subtypes.resize(num_columns);
-    state.ff.types[0].fieldNames.resize(num_columns);
-    for (int i = 0; i < num_columns; ++i) {
-      state.ff.types[1 + i].kind      = orc_columns[i].orc_kind();
-      state.ff.types[0].subtypes[i]   = 1 + i;
-      state.ff.types[0].fieldNames[i] = orc_columns[i].orc_name();
-    }
-  } else {
-    // verify the user isn't passing mismatched tables
-    CUDF_EXPECTS(state.ff.types.size() == 1 + orc_columns.size(),
-                 "Mismatch in table structure between multiple calls to write_chunked");
-    for (auto i = 0; i < num_columns; i++) {
-      CUDF_EXPECTS(state.ff.types[1 + i].kind == orc_columns[i].orc_kind(),
-                   "Mismatch in column types between multiple calls to write_chunked");
+  state.ff.numberOfRows += num_rows;
+
+  // Only one set of stripes is written at a time; the previous one must be complete before these
+  // ones are appended to the sink
+  wait_for_stripe_write(state);
+
+  // Write the stripes in the background while the caller encodes the next table. The task owns
+  // all the encoded data, and is the only user of `buffer_` and the sink until it completes.
+  auto write_task = [this,
+                     num_columns,
+                     num_data_streams,
+                     orc_columns     = std::move(orc_columns),
+                     stripe_dict     = std::move(stripe_dict),
+                     streams         = std::move(streams),
+                     chunks          = std::move(chunks),
+                     output          = std::move(output),
+                     strm_desc       = std::move(strm_desc),
+                     compressed_data = std::move(compressed_data),
+                     comp_out        = std::move(comp_out),
+                     bloom_filters   = std::move(host_bloom_filters),
+                     stripes         = std::move(stripes)]() mutable {
+    ProtobufWriter pbw_(&buffer_);
+    device_write_pipeline pipeline(out_sink_.get(), write_stream_);
+
+    // Write stripes
+    size_t stream_bytes = 0;
+    for (size_t i = 0; i < strm_desc.size(); ++i) { stream_bytes += strm_desc[i].stream_size; }
+    CUDF_SCOPED_RANGE_PAYLOAD("orc::write_stripes", stream_bytes);
+    size_t group = 0;
+    for (size_t stripe_id = 0; stripe_id < stripes.size(); stripe_id++) {
+      auto groups_in_stripe     = div_by_rowgroups(stripes[stripe_id].numberOfRows);
+      stripes[stripe_id].offset = out_sink_->bytes_written();
+
+      // Column (skippable) index streams appear at the start of the stripe
+      stripes[stripe_id].indexLength = 0;
+      for (size_t col_id = 0; col_id <= (size_t)num_columns; col_id++) {
+        write_index_stream(stripe_id,
+                           col_id,
+                           orc_columns.data(),
+                           num_columns,
+                           num_data_streams,
+                           group,
+                           groups_in_stripe,
+                           chunks,
+                           strm_desc,
+                           comp_out,
+                           stripes[stripe_id],
+                           streams,
+                           &pbw_);
+      }
+      std::vector<Stream> bloom_filter_streams;
+      for (size_t col_id = 0; col_id < (size_t)num_columns; col_id++) {
+        if (orc_columns[col_id].has_bloom_filters()) {
+          bloom_filter_streams.push_back(write_bloom_filter_stream(1 + col_id,
+                                                                   orc_columns[col_id],
+                                                                   bloom_filters,
+                                                                   group,
+                                                                   groups_in_stripe,
+                                                                   stripes[stripe_id],
+                                                                   &pbw_));
+        }
+      }
+
+      // Column data consisting one or more separate streams; the copy of each stream to the host
+      // overlaps the write of the previous one
+      stripes[stripe_id].dataLength = 0;
+      for (size_t i = 0; i < num_data_streams; i++) {
+        const auto &ss = strm_desc[stripe_id * num_data_streams + i];
+        const auto &ck = chunks[group * num_columns + ss.column_id];
+
+        write_data_stream(ss,
+                          ck,
+                          static_cast<uint8_t const *>(compressed_data.data()),
+                          stripes[stripe_id],
+                          streams,
+                          pipeline);
+      }
+      pipeline.flush();
+
+      // Write stripefooter consisting of stream information
+      StripeFooter sf;
+      sf.streams = streams;
+      sf.streams.insert(sf.streams.begin() + num_columns + 1,
+                        bloom_filter_streams.begin(),
+                        bloom_filter_streams.end());
+      sf.columns.resize(num_columns + 1);
+      sf.columns[0].kind           = DIRECT;
+      sf.columns[0].dictionarySize = 0;
+      for (size_t i = 1; i < sf.columns.size(); ++i) {
+        const auto &column           = orc_columns[i - 1];
+        sf.columns[i].kind           = column.orc_encoding();
+        sf.columns[i].dictionarySize = (sf.columns[i].kind == DICTIONARY_V2)
+                                         ? column.host_stripe_dict(stripe_id)->num_strings
+                                         : 0;
+        if (column.orc_kind() == TIMESTAMP) { sf.writerTimezone = "UTC"; }
+      }
+      buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
+      pbw_.write(&sf);
+      stripes[stripe_id].footerLength = buffer_.size();
+      if (compression_kind_ != NONE) {
+        uint32_t uncomp_sf_len = (stripes[stripe_id].footerLength - 3) * 2 + 1;
+        buffer_[0]             = static_cast<uint8_t>(uncomp_sf_len >> 0);
+        buffer_[1]             = static_cast<uint8_t>(uncomp_sf_len >> 8);
+        buffer_[2]             = static_cast<uint8_t>(uncomp_sf_len >> 16);
+      }
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+
+      group += groups_in_stripe;
     }
-  }
+
+    return std::move(stripes);
+  };
+  stripe_write_ = std::async(std::launch::async, std::move(write_task));
+}
+
+void writer::impl::wait_for_stripe_write(orc_chunked_state &state)
+{
+  if (!stripe_write_.valid()) { return; }
+
+  auto stripes = stripe_write_.get();
   state.ff.stripes.insert(state.ff.stripes.end(),
                           std::make_move_iterator(stripes.begin()),
                           std::make_move_iterator(stripes.end()));
-  state.ff.numberOfRows += num_rows;
 }
 
 void writer::impl::write_chunked_end(orc_chunked_state &state)
 {
+  // Write the chunks that did not fill a stripe
+  if (!state.pending_tables.empty()) {
+    std::vector<table_view> views;
+    for (auto const &pending : state.pending_tables) { views.push_back(pending->view()); }
+    if (views.size() == 1) {
+      write_stripes(views.front(), state);
+    } else {
+      write_stripes(cudf::detail::concatenate(views, _mr, state.stream)->view(), state);
+    }
+    state.pending_tables.clear();
+    state.pending_bytes = 0;
+  }
+  wait_for_stripe_write(state);
+
+  CUDF_SCOPED_RANGE("orc::write_footer");
   ProtobufWriter pbw_(&buffer_);
   PostScript ps;
 
@@ -24,6 +24,7 @@
 #include "orc.h"
 #include "orc_gpu.h"
 
+#include <io/utilities/device_write_pipeline.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
@@ -32,6 +33,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -55,9 +57,6 @@ class writer::impl {
   // ORC datasets start with a 3 byte header
   static constexpr const char* MAGIC = "ORC";
 
-  // ORC datasets are divided into fixed-size, independent stripes
-  static constexpr uint32_t DEFAULT_STRIPE_SIZE = 64 * 1024 * 1024;
-
   // ORC rows are divided into groups and assigned indexes for faster seeking
   static constexpr uint32_t DEFAULT_ROW_INDEX_STRIDE = 10000;
 
@@ -76,6 +75,11 @@ class writer::impl {
                 writer_options const& options,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Destructor; waits for the stripes still being written to the sink.
+   **/
+  ~impl();
+
   /**
    * @brief Write an entire dataset to ORC format.
    *
@@ -96,6 +100,10 @@ class writer::impl {
   /**
    * @brief Writes a single subtable as part of a larger ORC file/table write.
    *
+   * Unless disabled in the state, chunks are buffered until they fill at least one stripe of the
+   * target size, so that small chunks do not produce small stripes; the rows past the last full
+   * stripe stay buffered for the next call.
+   *
    * @param[in] table The table information to be written
    * @param[in] orc_chunked_state State information that crosses _begin() / write_chunked() / _end()
    * boundaries.
@@ -111,11 +119,32 @@ class writer::impl {
   void write_chunked_end(orc_chunked_state& state);
 
  private:
+  /**
+   * @brief Encodes a table into stripes and queues their write to the sink.
+   *
+   * The stripes are written on a background thread, which overlaps with the encoding of the next
+   * table; only one set of stripes is written at a time.
+   *
+   * @param[in] table The table information to be written
+   * @param[in] orc_chunked_state State information that crosses _begin() / write_chunked() / _end()
+   * boundaries.
+   */
+  void write_stripes(table_view const& table, orc_chunked_state& state);
+
+  /**
+   * @brief Waits for the stripes queued by `write_stripes()` to be written to the sink and adds
+   * them to the file footer, or rethrows the error that occurred while writing them.
+   *
+   * @param[in] orc_chunked_state State information that crosses _begin() / write_chunked() / _end()
+   * boundaries.
+   */
+  void wait_for_stripe_write(orc_chunked_state& state);
+
   /**
    * @brief Builds up column dictionaries indices
    *
    * @param columns List of columns
-   * @param num_rows Total number of rows
+   * @param num_rows Number of entries of the dictionary memory reserved for each string column
    * @param str_col_ids List of columns that are strings type
    * @param dict_data Dictionary data memory
    * @param dict_index Dictionary index memory
@@ -134,7 +163,7 @@ class writer::impl {
    * @brief Builds up per-stripe dictionaries for string columns
    *
    * @param columns List of columns
-   * @param num_rows Total number of rows
+   * @param num_rows Number of entries of the dictionary memory reserved for each string column
    * @param str_col_ids List of columns that are strings type
    * @param stripe_list List of stripe boundaries
    * @param dict List of dictionary chunks
@@ -156,7 +185,6 @@ class writer::impl {
    *
    * @param columns List of columns
    * @param num_columns Total number of columns
-   * @param num_rows Total number of rows
    * @param stripe_list List of stripe boundaries
    * @param strm_ids List of unique stream identifiers
    *
@@ -164,7 +192,6 @@ class writer::impl {
    **/
   std::vector<Stream> gather_streams(orc_column_view* columns,
                                      size_t num_columns,
-                                     size_t num_rows,
                                      std::vector<uint32_t> const& stripe_list,
                                      std::vector<int32_t>& strm_ids,
                                      const orc_chunked_state& state);
@@ -174,26 +201,26 @@ class writer::impl {
    *
    * @param columns List of columns
    * @param num_columns Total number of columns
-   * @param num_rows Total number of rows
    * @param num_rowgroups Total number of row groups
    * @param str_col_ids List of columns that are strings type
    * @param stripe_list List of stripe boundaries
    * @param streams List of columns' index and data streams
    * @param strm_ids List of unique stream identifiers
    * @param chunks List of column data chunks
+   * @param bloom_filters Zero-initialized bitsets of the row group bloom filters
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return Device buffer containing encoded data
    **/
   rmm::device_buffer encode_columns(orc_column_view* columns,
                                     size_t num_columns,
-                                    size_t num_rows,
                                     size_t num_rowgroups,
                                     std::vector<int> const& str_col_ids,
                                     std::vector<uint32_t> const& stripe_list,
                                     std::vector<Stream> const& streams,
                                     std::vector<int32_t> const& strm_ids,
                                     hostdevice_vector<gpu::EncChunk>& chunks,
+                                    uint32_t* bloom_filters,
                                     cudaStream_t stream);
 
   /**
@@ -275,24 +302,43 @@ class writer::impl {
                           std::vector<Stream>& streams,
                           ProtobufWriter* pbw);
 
+  /**
+   * @brief Write the specified column's bloom filter stream
+   *
+   * @param column_id Column's identifier in the file schema
+   * @param column Column of the bloom filters
+   * @param bloom_filters Bitsets of the row group bloom filters of all columns
+   * @param group Starting row group in the stripe
+   * @param groups_in_stripe Number of row groups in the stripe
+   * @param stripe Stream's parent stripe
+   * @param pbw Protobuf writer
+   *
+   * @return The BLOOM_FILTER_UTF8 stream
+   **/
+  Stream write_bloom_filter_stream(uint32_t column_id,
+                                   orc_column_view const& column,
+                                   std::vector<uint32_t> const& bloom_filters,
+                                   size_t group,
+                                   size_t groups_in_stripe,
+                                   StripeInformation& stripe,
+                                   ProtobufWriter* pbw);
+
   /**
    * @brief Write the specified column's data streams
    *
    * @param strm_desc Stream's descriptor
    * @param chunk First column chunk of the stream
    * @param compressed_data Compressed stream data
-   * @param stream_out Temporary host output buffer
    * @param stripe Stream's parent stripe
    * @param streams List of all streams
-   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param pipeline Pipeline that copies the stream data to the sink
    **/
   void write_data_stream(gpu::StripeStream const& strm_desc,
                          gpu::EncChunk const& chunk,
                          uint8_t const* compressed_data,
-                         uint8_t* stream_out,
                          StripeInformation& stripe,
                          std::vector<Stream>& streams,
-                         cudaStream_t stream);
+                         device_write_pipeline& pipeline);
 
   /**
    * @brief Insert 3-byte uncompressed block headers in a byte vector
@@ -313,22 +359,10 @@ class writer::impl {
     return cudf::util::div_rounding_up_unsafe<T, T>(num_rows, row_index_stride_);
   }
 
-  /**
-   * @brief Returns the row index stride divided by the specified number
-   *
-   * @tparam T Optional type
-   * @param modulus Number to use for division
-   **/
-  template <typename T = size_t>
-  constexpr inline auto div_rowgroups_by(T modulus) const
-  {
-    return cudf::util::div_rounding_up_unsafe<T, T>(row_index_stride_, modulus);
-  }
-
  private:
   rmm::mr::device_memory_resource* _mr = nullptr;
 
-  size_t max_stripe_size_           = DEFAULT_STRIPE_SIZE;
+  size_t max_stripe_size_           = default_stripe_size;
   size_t row_index_stride_          = DEFAULT_ROW_INDEX_STRIDE;
   size_t compression_blocksize_     = DEFAULT_COMPRESSION_BLOCKSIZE;
   CompressionKind compression_kind_ = CompressionKind::NONE;
@@ -336,8 +370,15 @@ class writer::impl {
   bool enable_dictionary_ = true;
   bool enable_statistics_ = true;
 
+  std::vector<double> bloom_filter_fpp_;
+
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
+
+  // Stream of the device-to-host copies of the stripes being written
+  cudaStream_t write_stream_ = nullptr;
+  // Background write of the last encoded stripes; returns their information once written
+  std::future<std::vector<StripeInformation>> stripe_write_;
 };
 
 }  // namespace orc
@@ -16,7 +16,7 @@
 
 /**
  * @file chunked_state.hpp
- * @brief definition for chunked state structure used by Parquet writer
+ * @brief definition for chunked state structures used by Parquet reader and writer
  */
 
 #pragma once
@@ -62,6 +62,21 @@ struct pq_chunked_state {
   }
 };
 
+/**
+ * @brief Chunked reader state struct. Contains various pieces of information
+ *        needed that span the begin() / read() call process.
+ */
+struct pq_chunked_read_state {
+  /// The reader to be used
+  std::unique_ptr<reader> rp;
+  /// Cuda stream to be used
+  cudaStream_t stream = 0;
+  /// Ranges of rows (skip_rows, num_rows) returned by each read
+  std::vector<std::pair<size_type, size_type>> row_ranges;
+  /// Index of the next range to read
+  std::size_t next_range = 0;
+};
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
@@ -20,6 +20,7 @@
 #include <thrust/scan.h>
 #include <thrust/tuple.h>
 #include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <io/utilities/block_utils.cuh>
 
@@ -190,10 +191,17 @@ __device__ uint32_t InitLevelSection(page_state_s *s,
     s->initial_rle_value[lvl] = 0;
     s->lvl_start[lvl]         = cur;
   } else if (encoding == RLE) {
-    if (cur + 4 < end) {
+    // V2 data pages give the length of the levels in the page header instead of a 4-byte prefix
+    bool const is_v2 = (s->page.flags & PAGEINFO_FLAGS_V2) != 0;
+    if (is_v2 ? (s->page.lvl_bytes[lvl] > 0 && cur + s->page.lvl_bytes[lvl] <= end)
+              : (cur + 4 < end)) {
       uint32_t run;
-      len = 4 + (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
-      cur += 4;
+      if (is_v2) {
+        len = s->page.lvl_bytes[lvl];
+      } else {
+        len = 4 + (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
+        cur += 4;
+      }
       run                     = get_vlq32(cur, end);
       s->initial_rle_run[lvl] = run;
       if (!(run & 1)) {
@@ -836,6 +844,27 @@ inline __device__ void gpuOutputFast(volatile page_state_s *s, int src_pos, T *d
   gpuStoreOutput(dst, dict, dict_pos, dict_size);
 }
 
+/**
+ * @brief Output an INT32/INT64 decimal as a fixed_point value carrying the column scale
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[in] dst Pointer to row output data
+ */
+template <typename Rep>
+inline __device__ void gpuOutputFixedPoint(volatile page_state_s *s,
+                                           int src_pos,
+                                           numeric::fixed_point<Rep, numeric::Radix::BASE_10> *dst)
+{
+  using storage_type = std::conditional_t<sizeof(Rep) == 8, uint2, uint32_t>;
+  storage_type bits;
+  Rep value;
+  gpuOutputFast(s, src_pos, &bits);
+  memcpy(&value, &bits, sizeof(Rep));
+  *dst = numeric::fixed_point<Rep, numeric::Radix::BASE_10>{
+    numeric::scaled_integer<Rep>{value, numeric::scale_type{-s->col.decimal_scale}}};
+}
+
 /**
  * @brief Output a N-byte value
  *
@@ -987,7 +1016,11 @@ static __device__ bool setupLocalPageInfo(page_state_s *const s,
       // Special check for downconversions
       s->dtype_len_in = s->dtype_len;
       if (s->col.converted_type == DECIMAL) {
-        s->dtype_len = 8;  // Convert DECIMAL to 64-bit float
+        // Convert DECIMAL to 64-bit float, unless decoding INT32/INT64 into fixed_point values
+        // whose width is then given as the output length
+        bool const is_fixed_point = dtype_len_out != 0 && ((s->col.data_type & 7) == INT32 ||
+                                                           (s->col.data_type & 7) == INT64);
+        s->dtype_len = is_fixed_point ? dtype_len_out : 8;
       } else if ((s->col.data_type & 7) == INT32) {
         if (dtype_len_out == 1) s->dtype_len = 1;  // INT8 output
         if (dtype_len_out == 2) s->dtype_len = 2;  // INT16 output
@@ -1644,6 +1677,10 @@ extern "C" __global__ void __launch_bounds__(NTHREADS)
           gpuOutputString(s, src_pos, dst);
         else if (dtype == BOOLEAN)
           gpuOutputBoolean(s, src_pos, dst);
+        else if (s->col.converted_type == DECIMAL && dtype == INT32 && (s->col.data_type >> 3))
+          gpuOutputFixedPoint(s, src_pos, reinterpret_cast<numeric::decimal32 *>(dst));
+        else if (s->col.converted_type == DECIMAL && dtype == INT64 && (s->col.data_type >> 3))
+          gpuOutputFixedPoint(s, src_pos, reinterpret_cast<numeric::decimal64 *>(dst));
         else if (s->col.converted_type == DECIMAL)
           gpuOutputDecimal(s, src_pos, reinterpret_cast<double *>(dst), dtype);
         else if (dtype == INT96)
@@ -13,10 +13,17 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <hash/concurrent_unordered_map.cuh>
 #include <io/utilities/block_utils.cuh>
 #include "parquet_gpu.h"
 
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
 namespace cudf {
 namespace io {
 namespace parquet {
@@ -87,6 +94,8 @@ __device__ void FetchDictionaryFragment(dict_state_s *s,
       reinterpret_cast<const uint32_t *>(s->cur_fragment)[t];
   }
   __syncthreads();
+  // Rows of chunks with a global dictionary are already deduplicated
+  if (s->ck.global_dictionary) { return; }
   // Store the row values in shared mem and set the corresponding dict_data to zero (end-of-list)
   // It's easiest to do this here since we're only dealing with values all within a 5K-row window
   for (uint32_t i = t; i < s->frag.num_dict_vals; i += 1024) {
@@ -101,6 +110,47 @@ __device__ void FetchDictionaryFragment(dict_state_s *s,
   __syncthreads();
 }
 
+/**
+ * @brief Count the dictionary entries of a fragment deduplicated by BuildGlobalDictionaryIndex
+ *
+ * @param[in,out] s dictionary state
+ * @param[in] frag_start_row row position of current fragment
+ * @param[in] dtype physical type of the column
+ * @param[in] dtype_len length of the plain-encoded value (excluding string data)
+ * @param[in] t thread id
+ **/
+__device__ void CountGlobalDictionaryEntries(
+  dict_state_s *s, uint32_t frag_start_row, uint32_t dtype, uint32_t dtype_len, uint32_t t)
+{
+  const uint32_t *valid_map = s->col.valid_map_base;
+  for (uint32_t i = 0; i < s->frag.num_rows; i += 1024) {
+    uint32_t row      = frag_start_row + i + t;
+    uint32_t is_valid = (i + t < s->frag.num_rows && row < s->col.num_rows)
+                          ? (valid_map) ? (valid_map[row >> 5] >> (row & 0x1f)) & 1 : 1
+                          : 0;
+    uint32_t is_unique = (is_valid && s->col.dict_index[row] == row);
+    uint32_t len       = 0;
+    uint32_t frag_dict_size, new_dict_entries;
+    if (is_unique) {
+      len = dtype_len;
+      if (dtype == BYTE_ARRAY) {
+        len += (uint32_t) reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base)[row].count;
+      }
+    }
+    frag_dict_size = WarpReduceSum32(len);
+    if (!(t & 0x1f)) { s->scratch_red[t >> 5] = frag_dict_size; }
+    new_dict_entries = __syncthreads_count(is_unique);
+    if (t < 32) {
+      frag_dict_size = WarpReduceSum32(s->scratch_red[t]);
+      if (t == 0) {
+        s->frag_dict_size += frag_dict_size;
+        s->num_dict_entries += new_dict_entries;
+      }
+    }
+    __syncthreads();
+  }
+}
+
 /// Generate dictionary indices in ascending row order
 __device__ void GenerateDictionaryIndices(dict_state_s *s, uint32_t t)
 {
@@ -145,7 +195,7 @@ __device__ void GenerateDictionaryIndices(dict_state_s *s, uint32_t t)
 
 // blockDim(1024, 1, 1)
 __global__ void __launch_bounds__(1024, 1)
-  gpuBuildChunkDictionaries(EncColumnChunk *chunks, uint32_t *dev_scratch)
+  gpuBuildChunkDictionaries(EncColumnChunk *chunks, uint32_t *dev_scratch, uint32_t max_dict_size)
 {
   __shared__ __align__(8) dict_state_s state_g;
 
@@ -184,11 +234,14 @@ __global__ void __launch_bounds__(1024, 1)
     uint32_t frag_start_row = s->ck.start_row + s->row_cnt, num_dict_entries, frag_dict_size;
     FetchDictionaryFragment(s, s->col.dict_data, frag_start_row, t);
     __syncthreads();
-    num_dict_entries = s->frag.num_dict_vals;
+    num_dict_entries = (s->ck.global_dictionary) ? 0 : s->frag.num_dict_vals;
     if (!t) {
       s->num_dict_entries = 0;
       s->frag_dict_size   = 0;
     }
+    if (s->ck.global_dictionary) {
+      CountGlobalDictionaryEntries(s, frag_start_row, dtype, dtype_len, t);
+    }
     for (uint32_t i = 0; i < num_dict_entries; i += 1024) {
       bool is_valid    = (i + t < num_dict_entries);
       uint32_t len     = 0;
@@ -292,8 +345,8 @@ __global__ void __launch_bounds__(1024, 1)
     __syncthreads();
     num_dict_entries = s->num_dict_entries;
     frag_dict_size   = s->frag_dict_size;
-    if (s->total_dict_entries + num_dict_entries > 65536 ||
-        (s->dictionary_size != 0 && s->dictionary_size + frag_dict_size > 512 * 1024)) {
+    if (s->total_dict_entries + num_dict_entries > kMaxDictEntries ||
+        (s->dictionary_size != 0 && s->dictionary_size + frag_dict_size > max_dict_size)) {
       break;
     }
     __syncthreads();
@@ -319,12 +372,119 @@ __global__ void __launch_bounds__(1024, 1)
   }
 }
 
+/**
+ * @brief Returns whether a row of the column holds a valid value
+ **/
+inline __device__ bool dict_row_is_valid(const EncColumnDesc *col, uint32_t row)
+{
+  const uint32_t *valid_map = col->valid_map_base;
+  return row < col->num_rows && (!valid_map || ((valid_map[row >> 5] >> (row & 0x1f)) & 1));
+}
+
+/**
+ * @brief Returns the fixed-length value of a row (as stored in the column)
+ **/
+inline __device__ uint64_t dict_fixed_value(const EncColumnDesc *col, uint32_t row)
+{
+  uint32_t dtype = col->physical_type;
+  uint32_t dtype_len_in =
+    (dtype == INT32) ? GetDtypeLogicalLen(col->converted_type)
+                     : (dtype == INT64 || dtype == DOUBLE) ? 8 : 4;
+  switch (dtype_len_in) {
+    case 8: return reinterpret_cast<const uint64_t *>(col->column_data_base)[row];
+    case 4: return reinterpret_cast<const uint32_t *>(col->column_data_base)[row];
+    case 2: return reinterpret_cast<const uint16_t *>(col->column_data_base)[row];
+    default: return reinterpret_cast<const uint8_t *>(col->column_data_base)[row];
+  }
+}
+
+/**
+ * @brief Hashes the value of a row, for deduplicating rows with a concurrent_unordered_map
+ **/
+struct dict_value_hash {
+  const EncColumnDesc *col;
+
+  __device__ uint32_t operator()(uint32_t row) const
+  {
+    if (col->physical_type == BYTE_ARRAY) {
+      auto const &str = reinterpret_cast<const nvstrdesc_s *>(col->column_data_base)[row];
+      return MurmurHash3_32<string_view>{}(
+        string_view(str.ptr, static_cast<size_type>(str.count)));
+    }
+    return MurmurHash3_32<uint64_t>{}(dict_fixed_value(col, row));
+  }
+};
+
+/**
+ * @brief Compares the values of two rows, for deduplicating rows with a concurrent_unordered_map
+ **/
+struct dict_value_equal {
+  const EncColumnDesc *col;
+
+  __device__ bool operator()(uint32_t row1, uint32_t row2) const
+  {
+    if (col->physical_type == BYTE_ARRAY) {
+      auto const &str1 = reinterpret_cast<const nvstrdesc_s *>(col->column_data_base)[row1];
+      auto const &str2 = reinterpret_cast<const nvstrdesc_s *>(col->column_data_base)[row2];
+      return str1.count == str2.count &&
+             nvstr_is_equal(str1.ptr, (uint32_t)str1.count, str2.ptr, (uint32_t)str2.count);
+    }
+    return dict_fixed_value(col, row1) == dict_fixed_value(col, row2);
+  }
+};
+
+/**
+ * @copydoc cudf::io::parquet::gpu::BuildGlobalDictionaryIndex
+ **/
+cudaError_t BuildGlobalDictionaryIndex(EncColumnChunk const &ck, cudaStream_t stream)
+{
+  using map_type = concurrent_unordered_map<uint32_t, uint32_t, dict_value_hash, dict_value_equal>;
+  constexpr uint32_t unused_row{std::numeric_limits<uint32_t>::max()};
+  const EncColumnDesc *col = ck.col_desc;
+  auto map_ptr             = map_type::create(compute_hash_table_size(ck.num_rows),
+                                  unused_row,
+                                  unused_row,
+                                  dict_value_hash{col},
+                                  dict_value_equal{col},
+                                  map_type::allocator_type(),
+                                  stream);
+  auto map                 = *map_ptr;
+  auto rows                = thrust::make_counting_iterator<uint32_t>(ck.start_row);
+
+  // dict_data holds the first occurrence of each value until the chunk dictionary is generated
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     rows,
+                     ck.num_rows,
+                     [col] __device__(uint32_t row) { col->dict_data[row] = ~0u; });
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     rows,
+                     ck.num_rows,
+                     [map, col] __device__(uint32_t row) mutable {
+                       if (dict_row_is_valid(col, row)) {
+                         uint32_t const first = map.insert(thrust::make_pair(row, row)).first->first;
+                         col->dict_index[row] = first;
+                         atomicMin(&col->dict_data[first], row);
+                       }
+                     });
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     rows,
+                     ck.num_rows,
+                     [col] __device__(uint32_t row) {
+                       if (dict_row_is_valid(col, row)) {
+                         uint32_t const first = col->dict_data[col->dict_index[row]];
+                         col->dict_index[row] = (first == row) ? row : first | (1u << 31);
+                       }
+                     });
+  return cudaSuccess;
+}
+
 /**
  * @brief Launches kernel for building chunk dictionaries
  *
  * @param[in] chunks Column chunks
  * @param[in] dev_scratch Device scratch data (kDictScratchSize per dictionary)
  * @param[in] num_chunks Number of column chunks
+ * @param[in] max_dict_size Maximum dictionary size of a column chunk in bytes
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -333,11 +493,13 @@ cudaError_t BuildChunkDictionaries(EncColumnChunk *chunks,
                                    uint32_t *dev_scratch,
                                    size_t scratch_size,
                                    uint32_t num_chunks,
+                                   size_t max_dict_size,
                                    cudaStream_t stream)
 {
   if (num_chunks > 0 && scratch_size > 0) {  // zero scratch size implies no dictionaries
     CUDA_TRY(cudaMemsetAsync(dev_scratch, 0, scratch_size, stream));
-    gpuBuildChunkDictionaries<<<num_chunks, 1024, 0, stream>>>(chunks, dev_scratch);
+    gpuBuildChunkDictionaries<<<num_chunks, 1024, 0, stream>>>(
+      chunks, dev_scratch, static_cast<uint32_t>(max_dict_size));
   }
   return cudaSuccess;
 }
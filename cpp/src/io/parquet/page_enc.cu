@@ -16,6 +16,8 @@
 #include <io/utilities/block_utils.cuh>
 #include "parquet_gpu.h"
 
+#include <cub/cub.cuh>
+
 namespace cudf {
 namespace io {
 namespace parquet {
@@ -57,7 +59,23 @@ struct page_enc_state_s {
   EncColumnDesc col;
   gpu_inflate_input_s comp_in;
   gpu_inflate_status_s comp_out;
-  uint16_t vals[RLE_BFRSZ];
+  uint32_t vals[RLE_BFRSZ];
+};
+
+#define DELTA_BLOCK_SIZE 128  // Values per DELTA_BINARY_PACKED block, one per thread
+#define DELTA_MINIBLOCKS 4    // Miniblocks per DELTA_BINARY_PACKED block, one per warp
+
+struct delta_enc_state_s {
+  uint8_t *out;                          //!< current output ptr
+  uint32_t num_values;                   //!< number of values in the stream
+  uint32_t pos;                          //!< index of the last value of the previous block
+  uint32_t hdr_written;                  //!< nonzero once the stream header is written
+  uint32_t prev_row;                     //!< last valid row of the previous batch
+  int64_t min_delta;                     //!< min delta of the current block
+  uint32_t bit_width[DELTA_MINIBLOCKS];  //!< bit width of each miniblock of the block
+  uint8_t *miniblock[DELTA_MINIBLOCKS];  //!< output ptr of each miniblock of the block
+  uint64_t packed[DELTA_BLOCK_SIZE];     //!< deltas of the block minus the min delta
+  int64_t vals[2 * DELTA_BLOCK_SIZE];    //!< input values ring buffer
 };
 
 /**
@@ -89,6 +107,9 @@ inline __device__ uint32_t uint64_init_hash(uint64_t v)
  * @param[in] col_desc Column description array [column_id]
  * @param[in] num_fragments Number of fragments per column
  * @param[in] num_columns Number of columns
+ * @param[in] fragment_size Number of rows per fragment
+ * @param[in] max_num_rows Number of rows per column
+ * @param[in] fragment_starts Optional first row of each fragment, followed by the number of rows
  *
  **/
 // blockDim {512,1,1}
@@ -97,13 +118,14 @@ __global__ void __launch_bounds__(512) gpuInitPageFragments(PageFragment *frag,
                                                             int32_t num_fragments,
                                                             int32_t num_columns,
                                                             uint32_t fragment_size,
-                                                            uint32_t max_num_rows)
+                                                            uint32_t max_num_rows,
+                                                            const uint32_t *fragment_starts)
 {
   __shared__ __align__(16) frag_init_state_s state_g;
 
   frag_init_state_s *const s = &state_g;
   uint32_t t                 = threadIdx.x;
-  uint32_t start_row, nrows, dtype_len, dtype_len_in, dtype;
+  uint32_t start_row, end_row, nrows, dtype_len, dtype_len_in, dtype;
 
   if (t < sizeof(EncColumnDesc) / sizeof(uint32_t)) {
     reinterpret_cast<uint32_t *>(&s->col)[t] =
@@ -113,10 +135,11 @@ __global__ void __launch_bounds__(512) gpuInitPageFragments(PageFragment *frag,
     if (i + t < sizeof(s->map) / sizeof(uint32_t)) s->map.u32[i + t] = 0;
   }
   __syncthreads();
-  start_row = blockIdx.y * fragment_size;
+  start_row = (fragment_starts) ? fragment_starts[blockIdx.y] : blockIdx.y * fragment_size;
+  end_row   = (fragment_starts) ? fragment_starts[blockIdx.y + 1] : start_row + fragment_size;
   if (!t) {
     s->col.num_rows            = min(s->col.num_rows, max_num_rows);
-    s->frag.num_rows           = min(fragment_size, max_num_rows - min(start_row, max_num_rows));
+    s->frag.num_rows           = min(end_row, max_num_rows) - min(start_row, max_num_rows);
     s->frag.non_nulls          = 0;
     s->frag.num_dict_vals      = 0;
     s->frag.fragment_data_size = 0;
@@ -353,7 +376,8 @@ __global__ void __launch_bounds__(128) gpuInitFragmentStats(statistics_group *gr
                                                             const EncColumnDesc *col_desc,
                                                             int32_t num_fragments,
                                                             int32_t num_columns,
-                                                            uint32_t fragment_size)
+                                                            uint32_t fragment_size,
+                                                            const uint32_t *fragment_starts)
 {
   __shared__ __align__(8) statistics_group group_g[4];
 
@@ -363,7 +387,7 @@ __global__ void __launch_bounds__(128) gpuInitFragmentStats(statistics_group *gr
   statistics_group *const g = &group_g[threadIdx.x >> 5];
   if (!t && frag_id < num_fragments) {
     g->col       = &col_desc[column_id];
-    g->start_row = frag_id * fragment_size;
+    g->start_row = (fragment_starts) ? fragment_starts[frag_id] : frag_id * fragment_size;
     g->num_rows  = fragments[column_id * num_fragments + frag_id].num_rows;
   }
   __syncthreads();
@@ -373,6 +397,40 @@ __global__ void __launch_bounds__(128) gpuInitFragmentStats(statistics_group *gr
   }
 }
 
+/**
+ * @brief Returns the maximum size of a DELTA_BINARY_PACKED stream
+ *
+ * @param[in] num_values Number of values in the stream
+ * @param[in] value_size Size of the values in bytes
+ */
+inline __device__ uint32_t MaxDeltaBinarySize(uint32_t num_values, uint32_t value_size)
+{
+  uint32_t num_blocks = (num_values + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE;
+  // Header, then min delta, bit widths and bit-packed miniblocks of each block
+  return 18 + num_blocks * (10 + DELTA_MINIBLOCKS + DELTA_BLOCK_SIZE * value_size);
+}
+
+/**
+ * @brief Returns the maximum size of the values of a non-dictionary data page
+ *
+ * @param[in] col Column description
+ * @param[in] num_rows Number of rows in the page
+ * @param[in] plain_size Size of the PLAIN-encoded values of the page
+ */
+inline __device__ uint32_t MaxValuesSize(EncColumnDesc const &col,
+                                         uint32_t num_rows,
+                                         uint32_t plain_size)
+{
+  switch (col.value_encoding) {
+    case DELTA_BINARY_PACKED:
+      return MaxDeltaBinarySize(num_rows, (col.physical_type == INT64) ? 8 : 4);
+    case DELTA_BYTE_ARRAY:
+      // Prefix and suffix lengths, then the suffixes
+      return 2 * MaxDeltaBinarySize(num_rows, 4) + plain_size;
+    default: return plain_size;
+  }
+}
+
 // blockDim {128,1,1}
 __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
                                                     EncPage *pages,
@@ -380,7 +438,8 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
                                                     statistics_merge_group *page_grstats,
                                                     statistics_merge_group *chunk_grstats,
                                                     int32_t num_rowgroups,
-                                                    int32_t num_columns)
+                                                    int32_t num_columns,
+                                                    uint32_t target_page_size)
 {
   __shared__ __align__(8) EncColumnDesc col_g;
   __shared__ __align__(8) EncColumnChunk ck_g;
@@ -464,14 +523,16 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
       }
       SYNCWARP();
       if (ck_g.has_dictionary && fragments_in_chunk < ck_g.num_dict_fragments) {
-        fragment_data_size =
-          frag_g.num_rows * 2;  // Assume worst-case of 2-bytes per dictionary index
+        // Assume worst-case of 2 or 3 bytes per dictionary index
+        fragment_data_size = frag_g.num_rows * ((ck_g.total_dict_entries > 65536) ? 3 : 2);
       } else {
         fragment_data_size = frag_g.fragment_data_size;
       }
+      // Smaller pages for small chunks, so that they still get split into a few pages
       max_page_size = (rows_in_page * 2 >= ck_g.num_rows)
-                        ? 256 * 1024
-                        : (rows_in_page * 3 >= ck_g.num_rows) ? 384 * 1024 : 512 * 1024;
+                        ? target_page_size / 2
+                        : (rows_in_page * 3 >= ck_g.num_rows) ? target_page_size / 4 * 3
+                                                              : target_page_size;
       if (num_rows >= ck_g.num_rows ||
           (rows_in_page > 0 &&
            (page_size + fragment_data_size > max_page_size ||
@@ -490,8 +551,10 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
             dict_bits = 8;
           } else if (num_dict_entries <= 4096) {
             dict_bits = 12;
-          } else {
+          } else if (num_dict_entries <= 65536) {
             dict_bits = 16;
+          } else {
+            dict_bits = 24;
           }
           page_size       = 1 + 5 + ((rows_in_page * dict_bits + 7) >> 3) + (rows_in_page >> 8);
           dict_bits_plus1 = dict_bits + 1;
@@ -504,6 +567,8 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
             (def_level_bits)
               ? 4 + 5 + ((def_level_bits * rows_in_page + 7) >> 3) + (rows_in_page >> 8)
               : 0;
+          uint32_t values_size =
+            (dict_bits_plus1) ? page_size : MaxValuesSize(col_g, rows_in_page, page_size);
           page_g.num_fragments   = fragments_in_chunk - page_start;
           page_g.chunk_id        = blockIdx.y * num_columns + blockIdx.x;
           page_g.page_type       = DATA_PAGE;
@@ -519,7 +584,7 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
             }
             page_g.max_hdr_size += stats_hdr_len;
           }
-          page_g.max_data_size    = page_size + def_level_size;
+          page_g.max_data_size    = values_size + def_level_size;
           page_g.page_data        = ck_g.uncompressed_bfr + page_offset;
           page_g.compressed_data  = ck_g.compressed_bfr + comp_page_offset;
           page_g.start_row        = cur_row;
@@ -583,13 +648,14 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
  * @brief Mask table representing how many consecutive repeats are needed to code a repeat run
  *[nbits-1]
  **/
-static __device__ __constant__ uint32_t kRleRunMask[16] = {
-  0x00ffffff, 0x0fff, 0x00ff, 0x3f, 0x0f, 0x0f, 0x7, 0x7, 0x3, 0x3, 0x3, 0x3, 0x1, 0x1, 0x1, 0x1};
+static __device__ __constant__ uint32_t kRleRunMask[24] = {
+  0x00ffffff, 0x0fff, 0x00ff, 0x3f, 0x0f, 0x0f, 0x7, 0x7, 0x3, 0x3, 0x3, 0x3,
+  0x1,        0x1,    0x1,    0x1,  0x1,  0x1,  0x1, 0x1, 0x1, 0x1, 0x1, 0x1};
 
 /**
  * @brief Variable-length encode an integer
  **/
-inline __device__ uint8_t *VlqEncode(uint8_t *p, uint32_t v)
+inline __device__ uint8_t *VlqEncode(uint8_t *p, uint64_t v)
 {
   while (v > 0x7f) {
     *p++ = (v | 0x80);
@@ -600,7 +666,15 @@ inline __device__ uint8_t *VlqEncode(uint8_t *p, uint32_t v)
 }
 
 /**
- * @brief Pack literal values in output bitstream (1,2,4,8,12 or 16 bits per value)
+ * @brief Zigzag-encode a signed integer
+ **/
+inline __device__ uint64_t ZigZagEncode(int64_t v)
+{
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+/**
+ * @brief Pack literal values in output bitstream (1,2,4,8,12,16 or 24 bits per value)
  **/
 inline __device__ void PackLiterals(
   uint8_t *dst, uint32_t v, uint32_t count, uint32_t w, uint32_t t)
@@ -631,9 +705,15 @@ inline __device__ void PackLiterals(
         dst[(t >> 1) * 3 + 1] = v >> 8;
         dst[(t >> 1) * 3 + 2] = v >> 16;
       }
-    } else if (t < count) {  // w=16
-      dst[t * 2 + 0] = v;
-      dst[t * 2 + 1] = v >> 8;
+    } else if (w < 24) {  // w=16
+      if (t < count) {
+        dst[t * 2 + 0] = v;
+        dst[t * 2 + 1] = v >> 8;
+      }
+    } else if (t < count) {  // w=24
+      dst[t * 3 + 0] = v;
+      dst[t * 3 + 1] = v >> 8;
+      dst[t * 3 + 2] = v >> 16;
     }
   }
 }
@@ -643,7 +723,7 @@ inline __device__ void PackLiterals(
  *
  * @param[in,out] s Page encode state
  * @param[in] numvals Total count of input values
- * @param[in] nbits number of bits per symbol (1..16)
+ * @param[in] nbits number of bits per symbol (1..24)
  * @param[in] flush nonzero if last batch in block
  * @param[in] t thread id (0..127)
  */
@@ -680,6 +760,7 @@ static __device__ void RleEncode(
           uint8_t *dst           = VlqEncode(s->rle_out, rle_run);
           *dst++                 = run_val;
           if (nbits > 8) { *dst++ = run_val >> 8; }
+          if (nbits > 16) { *dst++ = run_val >> 16; }
           s->rle_out = dst;
         }
         rle_run = 0;
@@ -815,6 +896,399 @@ static __device__ void PlainBoolEncode(page_enc_state_s *s,
   }
 }
 
+/**
+ * @brief Returns whether a row of a data page holds a value
+ *
+ * @param[in] s Page encode state
+ * @param[in] r Row index in the page
+ */
+inline __device__ uint32_t IsValidRow(page_enc_state_s const *s, uint32_t r)
+{
+  const uint32_t *valid = s->col.valid_map_base;
+  uint32_t row          = s->page.start_row + r;
+  return (row < s->col.num_rows && r < s->page.num_rows)
+           ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
+           : 0;
+}
+
+/**
+ * @brief Returns the position of a value among the values of a batch of 128 rows, and sets
+ * `s->scratch_red[3]` to the number of values in the batch
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] is_valid Whether the row of the thread holds a value
+ * @param[in] t thread id (0..127)
+ */
+inline __device__ uint32_t ValuePos(page_enc_state_s *s, uint32_t is_valid, uint32_t t)
+{
+  uint32_t warp_valids = BALLOT(is_valid);
+  uint32_t pos         = __popc(warp_valids & ((1 << (t & 0x1f)) - 1));
+  if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(warp_valids); }
+  __syncthreads();
+  if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+  __syncthreads();
+  return pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0);
+}
+
+/**
+ * @brief Returns the number of values (non-null rows) of a data page
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] t thread id (0..127)
+ */
+static __device__ uint32_t CountPageValues(page_enc_state_s *s, uint32_t t)
+{
+  uint32_t count = 0;
+  for (uint32_t r = t; r < s->page.num_rows; r += 128) { count += IsValidRow(s, r); }
+  count = WarpReduceSum32(count);
+  if (!(t & 0x1f)) { s->scratch_red[t >> 5] = count; }
+  __syncthreads();
+  count = s->scratch_red[0] + s->scratch_red[1] + s->scratch_red[2] + s->scratch_red[3];
+  __syncthreads();
+  return count;
+}
+
+/**
+ * @brief Loads a fixed-width value, as it is written in PLAIN encoding
+ *
+ * @param[in] s Page encode state
+ * @param[in] row Row of the value
+ * @param[in] dtype Physical type of the column
+ * @param[in] dtype_len_in Size of the values in the column data
+ */
+inline __device__ int64_t LoadValue(page_enc_state_s const *s,
+                                    uint32_t row,
+                                    uint32_t dtype,
+                                    uint32_t dtype_len_in)
+{
+  const uint8_t *src8 =
+    reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len_in;
+  if (dtype == INT64 || dtype == DOUBLE) {
+    int64_t v        = *reinterpret_cast<const int64_t *>(src8);
+    int32_t ts_scale = s->col.ts_scale;
+    if (dtype == INT64 && ts_scale != 0) {
+      if (ts_scale < 0) {
+        v /= -ts_scale;
+      } else {
+        v *= ts_scale;
+      }
+    }
+    return v;
+  } else if (dtype_len_in == 4) {
+    return *reinterpret_cast<const int32_t *>(src8);
+  } else if (dtype_len_in == 2) {
+    return *reinterpret_cast<const int16_t *>(src8);
+  } else {
+    return *reinterpret_cast<const int8_t *>(src8);
+  }
+}
+
+/**
+ * @brief Starts a DELTA_BINARY_PACKED stream
+ *
+ * @param[out] d Delta encode state
+ * @param[in] out Output ptr of the stream
+ * @param[in] num_values Number of values in the stream
+ */
+inline __device__ void DeltaEncodeInit(delta_enc_state_s *d, uint8_t *out, uint32_t num_values)
+{
+  d->out         = out;
+  d->num_values  = num_values;
+  d->pos         = 0;
+  d->hdr_written = 0;
+  d->prev_row    = ~0u;
+}
+
+/**
+ * @brief DELTA_BINARY_PACKED encoder
+ *
+ * Codes the buffered values in blocks of 128 deltas split into 4 miniblocks of 32, one miniblock
+ * per warp. The deltas of INT32 values wrap around on 32 bits, so that they never need more than
+ * 32 bits.
+ *
+ * @param[in,out] d Delta encode state
+ * @param[in] numvals Total count of input values
+ * @param[in] flush nonzero if last batch in stream
+ * @param[in] is_int32 nonzero for INT32 values
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaEncode(
+  delta_enc_state_s *d, uint32_t numvals, uint32_t flush, uint32_t is_int32, uint32_t t)
+{
+  using block_reduce = cub::BlockReduce<int64_t, DELTA_BLOCK_SIZE>;
+  __shared__ typename block_reduce::TempStorage reduce_storage;
+
+  if (t == 0 && !d->hdr_written && (numvals != 0 || flush)) {
+    uint8_t *dst   = VlqEncode(d->out, DELTA_BLOCK_SIZE);
+    dst            = VlqEncode(dst, DELTA_MINIBLOCKS);
+    dst            = VlqEncode(dst, d->num_values);
+    d->out         = VlqEncode(dst, ZigZagEncode((numvals != 0) ? d->vals[0] : 0));
+    d->hdr_written = 1;
+  }
+  __syncthreads();
+  uint32_t pos = d->pos;
+  while (numvals > pos + DELTA_BLOCK_SIZE || (flush && numvals > pos + 1)) {
+    uint32_t n    = min(numvals - pos - 1, DELTA_BLOCK_SIZE);
+    int64_t delta = INT64_MAX;
+    if (t < n) {
+      uint64_t prev = d->vals[(pos + t) & (2 * DELTA_BLOCK_SIZE - 1)];
+      uint64_t cur  = d->vals[(pos + t + 1) & (2 * DELTA_BLOCK_SIZE - 1)];
+      delta         = (is_int32) ? static_cast<int32_t>(static_cast<uint32_t>(cur - prev))
+                               : static_cast<int64_t>(cur - prev);
+    }
+    // Only valid in thread 0
+    int64_t min_delta = block_reduce(reduce_storage).Reduce(delta, cub::Min());
+    if (!t) { d->min_delta = min_delta; }
+    __syncthreads();
+    // Less than 2^32 for INT32 values, zero for the padding of the last miniblock
+    uint64_t v = (t < n) ? static_cast<uint64_t>(delta) - static_cast<uint64_t>(d->min_delta) : 0;
+
+    uint32_t or_lo = WarpReduceOr32(static_cast<uint32_t>(v));
+    uint32_t or_hi = WarpReduceOr32(static_cast<uint32_t>(v >> 32));
+    d->packed[t]   = v;
+    if (!(t & 0x1f)) {
+      d->bit_width[t >> 5] = (or_hi) ? 64 - __clz(or_hi) : (or_lo) ? 32 - __clz(or_lo) : 0;
+    }
+    __syncthreads();
+    if (!t) {
+      uint8_t *dst = VlqEncode(d->out, ZigZagEncode(d->min_delta));
+      for (uint32_t m = 0; m < DELTA_MINIBLOCKS; m++) { *dst++ = d->bit_width[m]; }
+      // Miniblocks without values are omitted: their bit width is zero
+      for (uint32_t m = 0; m < DELTA_MINIBLOCKS; m++) {
+        d->miniblock[m] = dst;
+        dst += d->bit_width[m] * 4;
+      }
+      d->out = dst;
+    }
+    __syncthreads();
+    // Bit-pack the miniblock of each warp, one output byte per lane
+    {
+      uint32_t nbits         = d->bit_width[t >> 5];
+      const uint64_t *mb_val = &d->packed[t & ~0x1f];
+      uint8_t *mb_out        = d->miniblock[t >> 5];
+      for (uint32_t b = t & 0x1f; b < nbits * 4; b += 32) {
+        uint32_t byte = 0;
+        for (uint32_t bit = b * 8; bit < b * 8 + 8;) {
+          uint32_t idx = bit / nbits, ofs = bit % nbits;
+          uint32_t len = min(nbits - ofs, b * 8 + 8 - bit);
+          byte |= static_cast<uint32_t>((mb_val[idx] >> ofs) & ((1u << len) - 1)) << (bit - b * 8);
+          bit += len;
+        }
+        mb_out[b] = byte;
+      }
+    }
+    pos += n;
+    __syncthreads();
+  }
+  if (!t) { d->pos = pos; }
+}
+
+/**
+ * @brief DELTA_BINARY_PACKED encoder of the values of an INT32 or INT64 data page
+ *
+ * @param[in,out] s Page encode state
+ * @param[in,out] d Delta encode state
+ * @param[in] dtype Physical type of the column
+ * @param[in] dtype_len_in Size of the values in the column data
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaBinaryEncodeValues(page_enc_state_s *s,
+                                               delta_enc_state_s *d,
+                                               uint32_t dtype,
+                                               uint32_t dtype_len_in,
+                                               uint32_t t)
+{
+  uint32_t num_values = CountPageValues(s, t);
+  uint32_t numvals    = 0;
+
+  if (!t) { DeltaEncodeInit(d, s->cur, num_values); }
+  __syncthreads();
+  for (uint32_t cur_row = 0; cur_row < s->page.num_rows; cur_row += 128) {
+    uint32_t is_valid = IsValidRow(s, cur_row + t);
+    uint32_t pos      = ValuePos(s, is_valid, t);
+    if (is_valid) {
+      d->vals[(numvals + pos) & (2 * DELTA_BLOCK_SIZE - 1)] =
+        LoadValue(s, s->page.start_row + cur_row + t, dtype, dtype_len_in);
+    }
+    numvals += s->scratch_red[3];
+    __syncthreads();
+    DeltaEncode(d, numvals, 0, dtype == INT32, t);
+  }
+  DeltaEncode(d, numvals, 1, dtype == INT32, t);
+  __syncthreads();
+  if (!t) { s->cur = d->out; }
+  __syncthreads();
+}
+
+/**
+ * @brief BYTE_STREAM_SPLIT encoder of the values of a FLOAT or DOUBLE data page
+ *
+ * Byte k of each value is written to stream k, the streams being written one after the other.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] dtype Physical type of the column
+ * @param[in] dtype_len_out Size of the values in bytes
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void ByteStreamSplitEncodeValues(page_enc_state_s *s,
+                                                   uint32_t dtype,
+                                                   uint32_t dtype_len_out,
+                                                   uint32_t t)
+{
+  uint32_t num_values = CountPageValues(s, t);
+  uint32_t numvals    = 0;
+  uint8_t *dst        = s->cur;
+
+  for (uint32_t cur_row = 0; cur_row < s->page.num_rows; cur_row += 128) {
+    uint32_t is_valid = IsValidRow(s, cur_row + t);
+    uint32_t pos      = ValuePos(s, is_valid, t);
+    if (is_valid) {
+      int64_t v = LoadValue(s, s->page.start_row + cur_row + t, dtype, dtype_len_out);
+      for (uint32_t k = 0; k < dtype_len_out; k++) {
+        dst[k * num_values + numvals + pos] = v >> (k * 8);
+      }
+    }
+    numvals += s->scratch_red[3];
+    __syncthreads();
+  }
+  if (!t) { s->cur = dst + num_values * dtype_len_out; }
+  __syncthreads();
+}
+
+/**
+ * @brief DELTA_BYTE_ARRAY encoder of the values of a BYTE_ARRAY data page
+ *
+ * The page is coded in three passes over its rows: the DELTA_BINARY_PACKED lengths of the prefixes
+ * each string shares with the previous one, the DELTA_BINARY_PACKED lengths of the remaining
+ * suffixes, then the suffixes themselves.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in,out] d Delta encode state
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaByteArrayEncodeValues(page_enc_state_s *s,
+                                                  delta_enc_state_s *d,
+                                                  uint32_t t)
+{
+  const nvstrdesc_s *strings = reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base);
+  uint32_t num_values        = CountPageValues(s, t);
+
+  for (uint32_t pass = 0; pass < 3; pass++) {
+    uint32_t numvals = 0;
+    uint8_t *dst     = s->cur;
+
+    if (!t) { DeltaEncodeInit(d, dst, num_values); }
+    __syncthreads();
+    for (uint32_t cur_row = 0; cur_row < s->page.num_rows; cur_row += 128) {
+      uint32_t row      = s->page.start_row + cur_row + t;
+      uint32_t is_valid = IsValidRow(s, cur_row + t);
+      uint32_t pos      = ValuePos(s, is_valid, t);
+      uint32_t nvals    = s->scratch_red[3];
+      uint32_t len = 0, prefix_len = 0;
+      if (is_valid) { s->vals[pos] = row; }
+      __syncthreads();
+      if (is_valid) {
+        uint32_t prev_row = (pos > 0) ? s->vals[pos - 1] : d->prev_row;
+        len               = strings[row].count;
+        if (prev_row != ~0u) {
+          const char *str  = strings[row].ptr;
+          const char *prev = strings[prev_row].ptr;
+          uint32_t max_len = min(len, (uint32_t)strings[prev_row].count);
+          while (prefix_len < max_len && str[prefix_len] == prev[prefix_len]) { prefix_len++; }
+        }
+      }
+      __syncthreads();
+      if (!t && nvals != 0) { d->prev_row = s->vals[nvals - 1]; }
+      if (pass < 2) {
+        if (is_valid) {
+          d->vals[(numvals + pos) & (2 * DELTA_BLOCK_SIZE - 1)] =
+            (pass == 0) ? prefix_len : len - prefix_len;
+        }
+        numvals += nvals;
+        __syncthreads();
+        DeltaEncode(d, numvals, 0, 1, t);
+      } else {
+        uint32_t suffix_len = len - prefix_len;
+        uint32_t ofs        = WarpReducePos32(suffix_len, t);
+        if ((t & 0x1f) == 0x1f) { s->scratch_red[t >> 5] = ofs; }
+        __syncthreads();
+        if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+        __syncthreads();
+        ofs = ofs + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0) - suffix_len;
+        if (suffix_len != 0) { memcpy(dst + ofs, strings[row].ptr + prefix_len, suffix_len); }
+        dst += s->scratch_red[3];
+        __syncthreads();
+      }
+    }
+    if (pass < 2) {
+      DeltaEncode(d, numvals, 1, 1, t);
+      __syncthreads();
+      dst = d->out;
+    }
+    if (!t) { s->cur = dst; }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Inserts the plain-encoded value of a row in the bloom filter of the column chunk
+ *
+ * @param[in] s Page encoder state
+ * @param[in] row Row of the value in the column
+ * @param[in] dtype Physical type of the column
+ * @param[in] dtype_len_in Size of the values of the column, in bytes
+ */
+inline __device__ void BloomFilterInsert(const page_enc_state_s *s,
+                                         uint32_t row,
+                                         uint32_t dtype,
+                                         uint32_t dtype_len_in)
+{
+  const uint8_t *src8 =
+    reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len_in;
+  uint8_t plain[8];
+  const uint8_t *data = plain;
+  uint32_t len;
+  switch (dtype) {
+    case INT32:
+    case FLOAT: {
+      int32_t v;
+      if (dtype_len_in == 4)
+        v = *reinterpret_cast<const int32_t *>(src8);
+      else if (dtype_len_in == 2)
+        v = *reinterpret_cast<const int16_t *>(src8);
+      else
+        v = *reinterpret_cast<const int8_t *>(src8);
+      memcpy(plain, &v, 4);
+      len = 4;
+    } break;
+    case INT64: {
+      int64_t v        = *reinterpret_cast<const int64_t *>(src8);
+      int32_t ts_scale = s->col.ts_scale;
+      if (ts_scale != 0) {
+        if (ts_scale < 0) {
+          v /= -ts_scale;
+        } else {
+          v *= ts_scale;
+        }
+      }
+      memcpy(plain, &v, 8);
+      len = 8;
+    } break;
+    case DOUBLE:
+      data = src8;
+      len  = 8;
+      break;
+    case BYTE_ARRAY:
+      data = reinterpret_cast<const uint8_t *>(reinterpret_cast<const nvstrdesc_s *>(src8)->ptr);
+      len  = static_cast<uint32_t>(reinterpret_cast<const nvstrdesc_s *>(src8)->count);
+      break;
+    default: return;
+  }
+  uint64_t hash   = bloom_filter_hash(data, len);
+  uint32_t *block = s->ck.bloom_filter + bloom_filter_block(hash, s->ck.bloom_filter_blocks) * 8;
+  for (int i = 0; i < 8; i++) { atomicOr(&block[i], bloom_filter_mask(hash, i)); }
+}
+
 // blockDim(128, 1, 1)
 __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
                                                          const EncColumnChunk *chunks,
@@ -823,10 +1297,11 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
                                                          uint32_t start_page)
 {
   __shared__ __align__(8) page_enc_state_s state_g;
+  __shared__ __align__(8) delta_enc_state_s delta_g;
 
   page_enc_state_s *const s = &state_g;
   uint32_t t                = threadIdx.x;
-  uint32_t dtype, dtype_len_in, dtype_len_out;
+  uint32_t dtype, dtype_len_in, dtype_len_out, value_encoding;
   int32_t dict_bits;
 
   if (t < sizeof(EncPage) / sizeof(uint32_t)) {
@@ -893,6 +1368,9 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     dtype_len_in = (dtype == BYTE_ARRAY) ? sizeof(nvstrdesc_s) : dtype_len_out;
   }
   dict_bits = (dtype == BOOLEAN) ? 1 : (s->page.dict_bits_plus1 - 1);
+
+  value_encoding =
+    (s->page.page_type == DATA_PAGE && dict_bits < 0) ? s->col.value_encoding : PLAIN;
   if (t == 0) {
     uint8_t *dst   = s->cur;
     s->rle_run     = 0;
@@ -905,127 +1383,151 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     }
   }
   __syncthreads();
-  for (uint32_t cur_row = 0; cur_row < s->page.num_rows;) {
-    uint32_t nrows = min(s->page.num_rows - cur_row, 128);
-    uint32_t row   = s->page.start_row + cur_row + t;
-    uint32_t is_valid, warp_valids, len, pos;
-
-    if (s->page.page_type == DICTIONARY_PAGE) {
-      is_valid = (cur_row + t < s->page.num_rows);
-      row      = (is_valid) ? s->col.dict_data[row] : row;
-    } else {
-      const uint32_t *valid = s->col.valid_map_base;
-      is_valid              = (row < s->col.num_rows && cur_row + t < s->page.num_rows)
-                   ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
-                   : 0;
-    }
-    warp_valids = BALLOT(is_valid);
-    cur_row += nrows;
-    if (dict_bits >= 0) {
-      // Dictionary encoding
-      if (dict_bits > 0) {
-        uint32_t rle_numvals;
-
-        pos = __popc(warp_valids & ((1 << (t & 0x1f)) - 1));
-        if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(warp_valids); }
-        __syncthreads();
-        if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+  if (value_encoding == DELTA_BINARY_PACKED) {
+    DeltaBinaryEncodeValues(s, &delta_g, dtype, dtype_len_in, t);
+  } else if (value_encoding == BYTE_STREAM_SPLIT) {
+    ByteStreamSplitEncodeValues(s, dtype, dtype_len_out, t);
+  } else if (value_encoding == DELTA_BYTE_ARRAY) {
+    DeltaByteArrayEncodeValues(s, &delta_g, t);
+  } else {
+    for (uint32_t cur_row = 0; cur_row < s->page.num_rows;) {
+      uint32_t nrows = min(s->page.num_rows - cur_row, 128);
+      uint32_t row   = s->page.start_row + cur_row + t;
+      uint32_t is_valid, warp_valids, len, pos;
+
+      if (s->page.page_type == DICTIONARY_PAGE) {
+        is_valid = (cur_row + t < s->page.num_rows);
+        row      = (is_valid) ? s->col.dict_data[row] : row;
+      } else {
+        const uint32_t *valid = s->col.valid_map_base;
+        is_valid              = (row < s->col.num_rows && cur_row + t < s->page.num_rows)
+                     ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
+                     : 0;
+      }
+      warp_valids = BALLOT(is_valid);
+      cur_row += nrows;
+      if (dict_bits >= 0) {
+        // Dictionary encoding
+        if (dict_bits > 0) {
+          uint32_t rle_numvals;
+
+          pos = __popc(warp_valids & ((1 << (t & 0x1f)) - 1));
+          if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(warp_valids); }
+          __syncthreads();
+          if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+          __syncthreads();
+          pos         = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0);
+          rle_numvals = s->rle_numvals;
+          if (is_valid) {
+            uint32_t v;
+            if (dtype == BOOLEAN) {
+              v = reinterpret_cast<const uint8_t *>(s->col.column_data_base)[row];
+            } else {
+              v = s->col.dict_index[row];
+            }
+            s->vals[(rle_numvals + pos) & (RLE_BFRSZ - 1)] = v;
+          }
+          rle_numvals += s->scratch_red[3];
+          __syncthreads();
+  #if !ENABLE_BOOL_RLE
+          if (dtype == BOOLEAN) {
+            PlainBoolEncode(s, rle_numvals, (cur_row == s->page.num_rows), t);
+          } else
+  #endif
+          {
+            RleEncode(s, rle_numvals, dict_bits, (cur_row == s->page.num_rows), t);
+          }
+          __syncthreads();
+        }
+        if (t == 0) { s->cur = s->rle_out; }
         __syncthreads();
-        pos         = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0);
-        rle_numvals = s->rle_numvals;
+      } else {
+        // Non-dictionary encoding
+        uint8_t *dst = s->cur;
+
         if (is_valid) {
-          uint32_t v;
-          if (dtype == BOOLEAN) {
-            v = reinterpret_cast<const uint8_t *>(s->col.column_data_base)[row];
-          } else {
-            v = s->col.dict_index[row];
+          len = dtype_len_out;
+          if (dtype == BYTE_ARRAY) {
+            len +=
+              (uint32_t) reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base)[row].count;
           }
-          s->vals[(rle_numvals + pos) & (RLE_BFRSZ - 1)] = v;
+        } else {
+          len = 0;
         }
-        rle_numvals += s->scratch_red[3];
+        pos = WarpReducePos32(len, t);
+        if ((t & 0x1f) == 0x1f) { s->scratch_red[t >> 5] = pos; }
         __syncthreads();
-#if !ENABLE_BOOL_RLE
-        if (dtype == BOOLEAN) {
-          PlainBoolEncode(s, rle_numvals, (cur_row == s->page.num_rows), t);
-        } else
-#endif
-        {
-          RleEncode(s, rle_numvals, dict_bits, (cur_row == s->page.num_rows), t);
+        if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+        __syncthreads();
+        if (t == 0) { s->cur = dst + s->scratch_red[3]; }
+        pos = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0) - len;
+        if (is_valid) {
+          const uint8_t *src8 =
+            reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len_in;
+          switch (dtype) {
+            case INT32:
+            case FLOAT: {
+              int32_t v;
+              if (dtype_len_in == 4)
+                v = *reinterpret_cast<const int32_t *>(src8);
+              else if (dtype_len_in == 2)
+                v = *reinterpret_cast<const int16_t *>(src8);
+              else
+                v = *reinterpret_cast<const int8_t *>(src8);
+              dst[pos + 0] = v;
+              dst[pos + 1] = v >> 8;
+              dst[pos + 2] = v >> 16;
+              dst[pos + 3] = v >> 24;
+            } break;
+            case INT64: {
+              int64_t v        = *reinterpret_cast<const int64_t *>(src8);
+              int32_t ts_scale = s->col.ts_scale;
+              if (ts_scale != 0) {
+                if (ts_scale < 0) {
+                  v /= -ts_scale;
+                } else {
+                  v *= ts_scale;
+                }
+              }
+              dst[pos + 0] = v;
+              dst[pos + 1] = v >> 8;
+              dst[pos + 2] = v >> 16;
+              dst[pos + 3] = v >> 24;
+              dst[pos + 4] = v >> 32;
+              dst[pos + 5] = v >> 40;
+              dst[pos + 6] = v >> 48;
+              dst[pos + 7] = v >> 56;
+            } break;
+            case DOUBLE: memcpy(dst + pos, src8, 8); break;
+            case BYTE_ARRAY: {
+              const char *str_data = reinterpret_cast<const nvstrdesc_s *>(src8)->ptr;
+              uint32_t v           = len - 4;  // string length
+              dst[pos + 0]         = v;
+              dst[pos + 1]         = v >> 8;
+              dst[pos + 2]         = v >> 16;
+              dst[pos + 3]         = v >> 24;
+              if (v != 0) memcpy(dst + pos + 4, str_data, v);
+            } break;
+          }
         }
         __syncthreads();
       }
-      if (t == 0) { s->cur = s->rle_out; }
-      __syncthreads();
-    } else {
-      // Non-dictionary encoding
-      uint8_t *dst = s->cur;
-
-      if (is_valid) {
-        len = dtype_len_out;
-        if (dtype == BYTE_ARRAY) {
-          len +=
-            (uint32_t) reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base)[row].count;
-        }
+    }
+  }
+  // The values of the dictionary page and of the pages that are not dictionary-encoded make up
+  // all the values of the chunk
+  if (s->ck.bloom_filter != nullptr && dict_bits < 0) {
+    for (uint32_t i = t; i < s->page.num_rows; i += 128) {
+      uint32_t row = s->page.start_row + i;
+      if (s->page.page_type == DICTIONARY_PAGE) {
+        row = s->col.dict_data[row];
       } else {
-        len = 0;
-      }
-      pos = WarpReducePos32(len, t);
-      if ((t & 0x1f) == 0x1f) { s->scratch_red[t >> 5] = pos; }
-      __syncthreads();
-      if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
-      __syncthreads();
-      if (t == 0) { s->cur = dst + s->scratch_red[3]; }
-      pos = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0) - len;
-      if (is_valid) {
-        const uint8_t *src8 =
-          reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len_in;
-        switch (dtype) {
-          case INT32:
-          case FLOAT: {
-            int32_t v;
-            if (dtype_len_in == 4)
-              v = *reinterpret_cast<const int32_t *>(src8);
-            else if (dtype_len_in == 2)
-              v = *reinterpret_cast<const int16_t *>(src8);
-            else
-              v = *reinterpret_cast<const int8_t *>(src8);
-            dst[pos + 0] = v;
-            dst[pos + 1] = v >> 8;
-            dst[pos + 2] = v >> 16;
-            dst[pos + 3] = v >> 24;
-          } break;
-          case INT64: {
-            int64_t v        = *reinterpret_cast<const int64_t *>(src8);
-            int32_t ts_scale = s->col.ts_scale;
-            if (ts_scale != 0) {
-              if (ts_scale < 0) {
-                v /= -ts_scale;
-              } else {
-                v *= ts_scale;
-              }
-            }
-            dst[pos + 0] = v;
-            dst[pos + 1] = v >> 8;
-            dst[pos + 2] = v >> 16;
-            dst[pos + 3] = v >> 24;
-            dst[pos + 4] = v >> 32;
-            dst[pos + 5] = v >> 40;
-            dst[pos + 6] = v >> 48;
-            dst[pos + 7] = v >> 56;
-          } break;
-          case DOUBLE: memcpy(dst + pos, src8, 8); break;
-          case BYTE_ARRAY: {
-            const char *str_data = reinterpret_cast<const nvstrdesc_s *>(src8)->ptr;
-            uint32_t v           = len - 4;  // string length
-            dst[pos + 0]         = v;
-            dst[pos + 1]         = v >> 8;
-            dst[pos + 2]         = v >> 16;
-            dst[pos + 3]         = v >> 24;
-            if (v != 0) memcpy(dst + pos + 4, str_data, v);
-          } break;
+        const uint32_t *valid = s->col.valid_map_base;
+        if (row >= s->col.num_rows || (valid && !((valid[row >> 5] >> (row & 0x1f)) & 1))) {
+          continue;
         }
       }
-      __syncthreads();
+      BloomFilterInsert(s, row, dtype, dtype_len_in);
     }
   }
   if (t == 0) {
@@ -1299,11 +1801,13 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
 #if ENABLE_BOOL_RLE
     int encoding =
       (col_g.physical_type != BOOLEAN)
-        ? (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY : PLAIN
+        ? (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY
+                                                                        : col_g.value_encoding
         : RLE;
 #else
-    int encoding =
-      (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY : PLAIN;
+    int encoding = (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0)
+                     ? PLAIN_DICTIONARY
+                     : col_g.value_encoding;
 #endif
     CPW_FLD_INT32(1, page_type)
     CPW_FLD_INT32(2, uncompressed_page_size)
@@ -1399,6 +1903,10 @@ __global__ void __launch_bounds__(1024) gpuGatherPages(EncColumnChunk *chunks, c
  * @param[in] col_desc Column description array [column_id]
  * @param[in] num_fragments Number of fragments per column
  * @param[in] num_columns Number of columns
+ * @param[in] fragment_size Number of rows per fragment
+ * @param[in] num_rows Number of rows per column
+ * @param[in] fragment_starts Optional first row of each fragment, followed by the number of rows
+ * [num_fragments + 1]; fragments are `fragment_size` rows long if null
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -1409,11 +1917,12 @@ cudaError_t InitPageFragments(PageFragment *frag,
                               int32_t num_columns,
                               uint32_t fragment_size,
                               uint32_t num_rows,
+                              const uint32_t *fragment_starts,
                               cudaStream_t stream)
 {
   dim3 dim_grid(num_columns, num_fragments);  // 1 threadblock per fragment
   gpuInitPageFragments<<<dim_grid, 512, 0, stream>>>(
-    frag, col_desc, num_fragments, num_columns, fragment_size, num_rows);
+    frag, col_desc, num_fragments, num_columns, fragment_size, num_rows, fragment_starts);
   return cudaSuccess;
 }
 
@@ -1426,6 +1935,8 @@ cudaError_t InitPageFragments(PageFragment *frag,
  * @param[in] num_fragments Number of fragments
  * @param[in] num_columns Number of columns
  * @param[in] fragment_size Max size of each fragment in rows
+ * @param[in] fragment_starts Optional first row of each fragment [num_fragments]; fragments are
+ * `fragment_size` rows long if null
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -1436,11 +1947,12 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
                                    int32_t num_fragments,
                                    int32_t num_columns,
                                    uint32_t fragment_size,
+                                   const uint32_t *fragment_starts,
                                    cudaStream_t stream)
 {
   dim3 dim_grid(num_columns, (num_fragments + 3) >> 2);  // 1 warp per fragment
   gpuInitFragmentStats<<<dim_grid, 128, 0, stream>>>(
-    groups, fragments, col_desc, num_fragments, num_columns, fragment_size);
+    groups, fragments, col_desc, num_fragments, num_columns, fragment_size, fragment_starts);
   return cudaSuccess;
 }
 
@@ -1452,6 +1964,7 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
  * @param[in] col_desc Column description array [column_id]
  * @param[in] num_rowgroups Number of fragments per column
  * @param[in] num_columns Number of columns
+ * @param[in] max_page_size Target uncompressed size of the data pages, in bytes
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
  * @param[in] stream CUDA stream to use, default 0
@@ -1463,13 +1976,20 @@ cudaError_t InitEncoderPages(EncColumnChunk *chunks,
                              const EncColumnDesc *col_desc,
                              int32_t num_rowgroups,
                              int32_t num_columns,
+                             uint32_t max_page_size,
                              statistics_merge_group *page_grstats,
                              statistics_merge_group *chunk_grstats,
                              cudaStream_t stream)
 {
   dim3 dim_grid(num_columns, num_rowgroups);  // 1 threadblock per rowgroup
-  gpuInitPages<<<dim_grid, 128, 0, stream>>>(
-    chunks, pages, col_desc, page_grstats, chunk_grstats, num_rowgroups, num_columns);
+  gpuInitPages<<<dim_grid, 128, 0, stream>>>(chunks,
+                                             pages,
+                                             col_desc,
+                                             page_grstats,
+                                             chunk_grstats,
+                                             num_rowgroups,
+                                             num_columns,
+                                             max_page_size);
   return cudaSuccess;
 }
 
@@ -46,6 +46,7 @@ struct byte_stream_s {
   const uint8_t *base;
   // Parsed symbols
   PageType page_type;
+  bool is_compressed;
   PageInfo page;
   ColumnChunkDesc ck;
 };
@@ -145,6 +146,12 @@ __device__ void skip_struct_field(byte_stream_s *bs, int t)
     if (t != ST_FLD_I32) return false; \
     break;
 
+#define PARQUET_FLD_BOOL(id, m)                              \
+  case id:                                                   \
+    if (t != ST_FLD_TRUE && t != ST_FLD_FALSE) return false; \
+    bs->m = (t == ST_FLD_TRUE);                              \
+    break;
+
 #define PARQUET_FLD_STRUCT(id, m)                   \
   case id:                                          \
     if (t != ST_FLD_STRUCT || !m(bs)) return false; \
@@ -173,8 +180,9 @@ PARQUET_BEGIN_STRUCT(gpuParseDataPageHeaderV2)
 PARQUET_FLD_INT32(1, page.num_input_values)
 PARQUET_FLD_INT32(3, page.num_rows)
 PARQUET_FLD_ENUM(4, page.encoding, Encoding);
-PARQUET_FLD_ENUM(5, page.definition_level_encoding, Encoding);
-PARQUET_FLD_ENUM(6, page.repetition_level_encoding, Encoding);
+PARQUET_FLD_INT32(5, page.lvl_bytes[level_type::DEFINITION])
+PARQUET_FLD_INT32(6, page.lvl_bytes[level_type::REPETITION])
+PARQUET_FLD_BOOL(7, is_compressed)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(gpuParsePageHeader)
@@ -242,7 +250,10 @@ extern "C" __global__ void __launch_bounds__(128)
         // they will be recomputed in the preprocess step by examining repetition and
         // definition levels
         bs->page.chunk_row += bs->page.num_rows;
-        bs->page.num_rows = 0;
+        bs->page.num_rows                          = 0;
+        bs->page.lvl_bytes[level_type::DEFINITION] = 0;
+        bs->page.lvl_bytes[level_type::REPETITION] = 0;
+        bs->is_compressed                          = true;
         if (gpuParsePageHeader(bs) && bs->page.compressed_page_size >= 0) {
           switch (bs->page_type) {
             case DATA_PAGE:
@@ -250,10 +261,19 @@ extern "C" __global__ void __launch_bounds__(128)
               // they will be recomputed in the preprocess step by examining repetition and
               // definition levels
               bs->page.num_rows = bs->page.num_input_values;
+              bs->page.flags    = 0;
+              index_out         = num_dict_pages + data_page_count;
+              data_page_count++;
+              values_found += bs->page.num_input_values;
+              break;
             case DATA_PAGE_V2:
+              // V2 levels are always RLE-encoded, and are never compressed
+              bs->page.definition_level_encoding = RLE;
+              bs->page.repetition_level_encoding = RLE;
+              bs->page.flags =
+                PAGEINFO_FLAGS_V2 | (bs->is_compressed ? 0 : PAGEINFO_FLAGS_UNCOMPRESSED);
               index_out = num_dict_pages + data_page_count;
               data_page_count++;
-              bs->page.flags = 0;
               values_found += bs->page.num_input_values;
               break;
             case DICTIONARY_PAGE:
@@ -0,0 +1,561 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file page_transcode.cu
+ * @brief Conversion of DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY, DELTA_BYTE_ARRAY and
+ * BYTE_STREAM_SPLIT data pages to PLAIN, so that they can be read by the page data decoder.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "parquet_gpu.h"
+
+#include <cub/cub.cuh>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+namespace {
+constexpr int block_size = 128;
+
+/**
+ * @brief Header of a DELTA_BINARY_PACKED stream
+ */
+struct delta_binary_header {
+  const uint8_t *blocks;      // First block of the stream
+  uint32_t values_per_block;  // Number of values in a block
+  uint32_t num_miniblocks;    // Number of miniblocks in a block
+  uint32_t num_values;        // Total number of values in the stream
+  int64_t first_value;        // First value of the stream, stored in the header
+};
+
+/**
+ * @brief Reads an unsigned LEB128 varint of up to 64 bits
+ */
+inline __device__ uint64_t get_uleb128(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t v = 0;
+  for (uint32_t l = 0; cur < end && l < 64; l += 7) {
+    uint64_t const c = *cur++;
+    v |= (c & 0x7f) << l;
+    if (!(c & 0x80)) { break; }
+  }
+  return v;
+}
+
+/**
+ * @brief Reads a zigzag-encoded LEB128 varint of up to 64 bits
+ */
+inline __device__ int64_t get_zigzag64(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t const u = get_uleb128(cur, end);
+  return static_cast<int64_t>((u >> 1) ^ -(u & 1));
+}
+
+/**
+ * @brief Reads a `width`-bit little-endian value starting at bit `bit` of a bit-packed buffer
+ */
+inline __device__ uint64_t get_bits(const uint8_t *p, const uint8_t *end, uint32_t bit, uint32_t w)
+{
+  if (w == 0) { return 0; }
+  p += bit >> 3;
+  uint32_t const shift = bit & 7;
+  uint32_t const bytes = min((shift + w + 7) >> 3, 8u);
+  uint64_t v           = 0;
+  for (uint32_t i = 0; i < bytes && p + i < end; i++) {
+    v |= static_cast<uint64_t>(p[i]) << (i * 8);
+  }
+  v >>= shift;
+  if (shift + w > 64 && p + 8 < end) { v |= static_cast<uint64_t>(p[8]) << (64 - shift); }
+  return (w < 64) ? v & ((uint64_t{1} << w) - 1) : v;
+}
+
+/**
+ * @brief Parses the header of a DELTA_BINARY_PACKED stream
+ *
+ * @return false if the header is malformed
+ */
+inline __device__ bool parse_delta_header(const uint8_t *cur,
+                                          const uint8_t *end,
+                                          delta_binary_header &hdr)
+{
+  hdr.values_per_block = get_uleb128(cur, end);
+  hdr.num_miniblocks   = get_uleb128(cur, end);
+  hdr.num_values       = get_uleb128(cur, end);
+  hdr.first_value      = get_zigzag64(cur, end);
+  hdr.blocks           = cur;
+  // Blocks hold a multiple of 128 values, miniblocks a multiple of 32
+  return hdr.values_per_block != 0 && hdr.values_per_block % 128 == 0 && hdr.num_miniblocks != 0 &&
+         hdr.values_per_block % hdr.num_miniblocks == 0 &&
+         (hdr.values_per_block / hdr.num_miniblocks) % 32 == 0;
+}
+
+/**
+ * @brief Returns the end of a DELTA_BINARY_PACKED stream without decoding its values
+ */
+inline __device__ const uint8_t *skip_delta_binary(delta_binary_header const &hdr,
+                                                   const uint8_t *end)
+{
+  uint32_t const values_per_miniblock = hdr.values_per_block / hdr.num_miniblocks;
+  const uint8_t *cur                  = hdr.blocks;
+  for (uint32_t remaining = max(hdr.num_values, 1u) - 1; remaining > 0 && cur < end;) {
+    get_zigzag64(cur, end);  // Min delta
+    const uint8_t *bit_widths = cur;
+    cur += hdr.num_miniblocks;
+    if (cur > end) { break; }
+    // Miniblocks without values are omitted, even though their bit widths are present
+    for (uint32_t m = 0; m < hdr.num_miniblocks && remaining > 0; m++) {
+      cur += bit_widths[m] * values_per_miniblock / 8;
+      remaining -= min(remaining, values_per_miniblock);
+    }
+  }
+  return (cur < end) ? cur : end;
+}
+
+/**
+ * @brief Decodes a DELTA_BINARY_PACKED stream with all the threads of the block
+ *
+ * Values are decoded in batches of `block_size`: every thread of the block calls
+ * `f(index, value)` for each batch, with an index of `hdr.num_values` for the threads left without
+ * a value, so that `f` may use block-wide primitives.
+ *
+ * Values are accumulated with 64-bit wrap-around arithmetic, which also gives the 32-bit values of
+ * INT32 streams once truncated.
+ *
+ * @return The end of the stream
+ */
+template <typename Function>
+__device__ const uint8_t *decode_delta_binary(delta_binary_header const &hdr,
+                                              const uint8_t *end,
+                                              Function f)
+{
+  using block_scan = cub::BlockScan<uint64_t, block_size>;
+  __shared__ typename block_scan::TempStorage scan_storage;
+  __shared__ const uint8_t *bit_widths_g;
+  __shared__ int64_t min_delta_g;
+
+  int const t                         = threadIdx.x;
+  uint32_t const num_values           = hdr.num_values;
+  uint32_t const values_per_miniblock = hdr.values_per_block / hdr.num_miniblocks;
+  if (num_values == 0) { return hdr.blocks; }
+
+  f((t == 0) ? 0 : num_values, static_cast<uint64_t>(hdr.first_value));
+  uint64_t last_value = hdr.first_value;
+  const uint8_t *cur  = hdr.blocks;
+  for (uint32_t first = 1; first < num_values && cur < end; first += hdr.values_per_block) {
+    __syncthreads();
+    if (t == 0) {
+      min_delta_g  = get_zigzag64(cur, end);
+      bit_widths_g = cur;
+    }
+    __syncthreads();
+    const uint8_t *bit_widths  = bit_widths_g;
+    const uint8_t *miniblocks  = bit_widths + hdr.num_miniblocks;
+    uint64_t const min_delta   = min_delta_g;
+    uint32_t const block_count = min(hdr.values_per_block, num_values - first);
+    if (miniblocks > end) { return end; }
+
+    for (uint32_t batch = 0; batch < block_count; batch += block_size) {
+      uint32_t const j   = batch + t;
+      uint32_t const idx = (j < block_count) ? first + j : num_values;
+      uint64_t delta     = 0;
+      if (idx < num_values) {
+        uint32_t const m = j / values_per_miniblock;
+        size_t offset    = 0;
+        for (uint32_t k = 0; k < m; k++) { offset += bit_widths[k] * values_per_miniblock / 8; }
+        uint32_t const w = min(bit_widths[m], 64);
+        delta = min_delta + get_bits(miniblocks + offset, end, (j % values_per_miniblock) * w, w);
+      }
+      uint64_t value, batch_total;
+      block_scan(scan_storage).InclusiveSum(delta, value, batch_total);
+      f(idx, last_value + value);
+      last_value += batch_total;
+      __syncthreads();
+    }
+
+    // Miniblocks without values are omitted, even though their bit widths are present
+    uint32_t const num_miniblocks =
+      min(hdr.num_miniblocks, (block_count + values_per_miniblock - 1) / values_per_miniblock);
+    cur = miniblocks;
+    for (uint32_t k = 0; k < num_miniblocks; k++) {
+      cur += bit_widths[k] * values_per_miniblock / 8;
+    }
+  }
+  return (cur < end) ? cur : end;
+}
+
+/**
+ * @brief Parses the header of a DELTA_BINARY_PACKED stream in shared memory
+ *
+ * @return The header, or nullptr if it is malformed
+ */
+__device__ delta_binary_header const *load_delta_header(const uint8_t *cur, const uint8_t *end)
+{
+  __shared__ delta_binary_header hdr_g;
+  __shared__ bool is_valid_g;
+
+  __syncthreads();
+  if (threadIdx.x == 0) { is_valid_g = parse_delta_header(cur, end, hdr_g); }
+  __syncthreads();
+  return is_valid_g ? &hdr_g : nullptr;
+}
+
+/**
+ * @brief Converts DELTA_BINARY_PACKED values to PLAIN
+ *
+ * @param cur Start of the encoded values
+ * @param end End of the encoded values
+ * @param width Size of each value in bytes, 4 or 8
+ * @param out Output PLAIN values, or nullptr to only compute their size
+ *
+ * @return The size of the PLAIN values, or -1 if the encoded values are malformed
+ */
+__device__ int64_t delta_binary_to_plain(const uint8_t *cur,
+                                         const uint8_t *end,
+                                         uint32_t width,
+                                         uint8_t *out)
+{
+  auto const hdr = load_delta_header(cur, end);
+  if (hdr == nullptr) { return -1; }
+  uint32_t const num_values = hdr->num_values;
+  if (out != nullptr) {
+    decode_delta_binary(*hdr, end, [&](uint32_t idx, uint64_t v) {
+      if (idx < num_values) {
+        for (uint32_t b = 0; b < width; b++) { out[idx * width + b] = v >> (b * 8); }
+      }
+    });
+  }
+  return static_cast<int64_t>(num_values) * width;
+}
+
+/**
+ * @brief Converts BYTE_STREAM_SPLIT values to PLAIN
+ *
+ * The k-th byte of every value is stored in the k-th of `width` streams.
+ *
+ * @return The size of the PLAIN values
+ */
+__device__ int64_t byte_stream_split_to_plain(const uint8_t *cur,
+                                              const uint8_t *end,
+                                              uint32_t width,
+                                              uint8_t *out)
+{
+  size_t const num_values = (end - cur) / width;
+  if (out != nullptr) {
+    for (size_t i = threadIdx.x; i < num_values * width; i += block_size) {
+      out[(i % num_values) * width + i / num_values] = cur[i];
+    }
+  }
+  return num_values * width;
+}
+
+/**
+ * @brief Returns the sum of the values of a DELTA_BINARY_PACKED stream of lengths
+ *
+ * @param hdr Header of the stream
+ * @param end End of the encoded data
+ * @param[out] stream_end End of the stream
+ */
+__device__ uint64_t sum_delta_lengths(delta_binary_header const &hdr,
+                                      const uint8_t *end,
+                                      const uint8_t *&stream_end)
+{
+  using block_reduce = cub::BlockReduce<uint64_t, block_size>;
+  __shared__ typename block_reduce::TempStorage reduce_storage;
+  __shared__ uint64_t sum_g;
+
+  uint32_t const num_values = hdr.num_values;
+  uint64_t const max_length = end - hdr.blocks;
+  uint64_t sum              = 0;
+  stream_end = decode_delta_binary(hdr, end, [&](uint32_t idx, uint64_t len) {
+    uint64_t const v = (idx < num_values) ? min(len, max_length) : 0;
+    sum += block_reduce(reduce_storage).Sum(v);
+    __syncthreads();
+  });
+  // The reduction result is only valid in thread 0
+  if (threadIdx.x == 0) { sum_g = sum; }
+  __syncthreads();
+  return sum_g;
+}
+
+/**
+ * @brief Converts DELTA_LENGTH_BYTE_ARRAY values to PLAIN
+ *
+ * Also converts the suffixes of DELTA_BYTE_ARRAY values, leaving room for their prefixes.
+ *
+ * @param cur Start of the encoded values
+ * @param end End of the encoded values
+ * @param out Output PLAIN values, or nullptr to only compute their size
+ * @param prefix_lengths Length of the prefix to leave room for before each value, or nullptr
+ *
+ * @return The size of the PLAIN values including the prefixes, or -1 if the encoded values are
+ * malformed
+ */
+__device__ int64_t delta_length_to_plain(const uint8_t *cur,
+                                         const uint8_t *end,
+                                         uint8_t *out,
+                                         const uint32_t *prefix_lengths)
+{
+  using block_scan = cub::BlockScan<uint64_t, block_size>;
+  __shared__ typename block_scan::TempStorage scan_storage;
+  __shared__ const uint8_t *data_g;
+
+  auto const hdr = load_delta_header(cur, end);
+  if (hdr == nullptr) { return -1; }
+  uint32_t const num_values = hdr->num_values;
+  uint64_t const max_length = end - hdr->blocks;
+  if (out == nullptr) {
+    const uint8_t *data;
+    return static_cast<int64_t>(num_values) * 4 + sum_delta_lengths(*hdr, end, data);
+  }
+
+  if (threadIdx.x == 0) { data_g = skip_delta_binary(*hdr, end); }
+  __syncthreads();
+  const uint8_t *data = data_g;
+  uint64_t in_pos     = 0;
+  uint64_t out_pos    = 0;
+  decode_delta_binary(*hdr, end, [&](uint32_t idx, uint64_t len) {
+    bool const is_valid   = idx < num_values;
+    uint32_t const prefix = (is_valid && prefix_lengths) ? prefix_lengths[idx] : 0;
+    uint64_t in_offset, out_offset, in_total, out_total;
+    len = is_valid ? min(len, max_length) : 0;
+    block_scan(scan_storage).ExclusiveSum(len, in_offset, in_total);
+    __syncthreads();
+    block_scan(scan_storage).ExclusiveSum(is_valid ? 4 + prefix + len : 0, out_offset, out_total);
+    __syncthreads();
+    if (is_valid) {
+      const uint8_t *src = data + in_pos + in_offset;
+      uint8_t *dst       = out + out_pos + out_offset;
+      uint32_t const v   = prefix + len;
+      dst[0]             = v;
+      dst[1]             = v >> 8;
+      dst[2]             = v >> 16;
+      dst[3]             = v >> 24;
+      dst += 4 + prefix;
+      for (uint64_t i = 0; i < len && src + i < end; i++) { dst[i] = src[i]; }
+    }
+    in_pos += in_total;
+    out_pos += out_total;
+  });
+  return out_pos;
+}
+
+/**
+ * @brief Converts DELTA_BYTE_ARRAY values to PLAIN
+ *
+ * Each value is stored as the length of the prefix it shares with the previous value and the
+ * remaining suffix: the prefix lengths are kept in scratch memory while the suffixes are copied,
+ * then the prefixes are filled in order.
+ *
+ * @param cur Start of the encoded values
+ * @param end End of the encoded values
+ * @param out Output PLAIN values, or nullptr to only compute their size
+ * @param out_end End of the output memory, which includes the scratch memory
+ *
+ * @return The size of the PLAIN values, or -1 if the encoded values are malformed. When only
+ * computing the size, the size of the scratch memory and of its alignment is included.
+ */
+__device__ int64_t delta_byte_array_to_plain(const uint8_t *cur,
+                                             const uint8_t *end,
+                                             uint8_t *out,
+                                             uint8_t *out_end)
+{
+  int const t    = threadIdx.x;
+  auto const hdr = load_delta_header(cur, end);
+  if (hdr == nullptr) { return -1; }
+  uint32_t const num_values = hdr->num_values;
+  // Prefixes are never longer than the page, as they are made of the suffixes of previous values
+  uint64_t const max_length = end - hdr->blocks;
+  if (out == nullptr) {
+    const uint8_t *suffixes;
+    auto const prefix_total = sum_delta_lengths(*hdr, end, suffixes);
+    auto const suffix_size  = delta_length_to_plain(suffixes, end, nullptr, nullptr);
+    if (suffix_size < 0) { return -1; }
+    return suffix_size + prefix_total + 3 + static_cast<int64_t>(num_values) * sizeof(uint32_t);
+  }
+
+  // The prefix lengths are kept at the end of the output memory, past the PLAIN values
+  auto const scratch = reinterpret_cast<uint32_t *>(
+    (reinterpret_cast<uintptr_t>(out_end) - num_values * sizeof(uint32_t)) & ~uintptr_t{3});
+  auto const suffixes = decode_delta_binary(*hdr, end, [&](uint32_t idx, uint64_t prefix) {
+    if (idx < num_values) { scratch[idx] = min(prefix, max_length); }
+  });
+  auto const size = delta_length_to_plain(suffixes, end, out, scratch);
+  if (size < 0) { return -1; }
+  __syncthreads();
+  // A prefix is copied from the previous value, which must be complete: fill them in order
+  if (t < 32) {
+    size_t prev_pos   = 0;
+    size_t pos        = 0;
+    uint32_t prev_len = 0;
+    for (uint32_t i = 0; i < num_values; i++) {
+      uint32_t const len =
+        out[pos] | (out[pos + 1] << 8) | (out[pos + 2] << 16) | (out[pos + 3] << 24);
+      if (i > 0) {
+        uint32_t const prefix = min(scratch[i], min(prev_len, len));
+        for (uint32_t k = t; k < prefix; k += 32) { out[pos + 4 + k] = out[prev_pos + 4 + k]; }
+        SYNCWARP();
+      }
+      prev_pos = pos;
+      prev_len = len;
+      pos += 4 + len;
+    }
+  }
+  __syncthreads();
+  return size;
+}
+
+/**
+ * @brief Returns the size of the definition and repetition levels at the start of a data page
+ */
+inline __device__ uint32_t get_levels_size(PageInfo const &page,
+                                           ColumnChunkDesc const &chunk,
+                                           const uint8_t *end)
+{
+  if (page.flags & PAGEINFO_FLAGS_V2) {
+    return page.lvl_bytes[level_type::DEFINITION] + page.lvl_bytes[level_type::REPETITION];
+  }
+  const uint8_t *cur    = page.page_data;
+  int const levels[]    = {level_type::REPETITION, level_type::DEFINITION};
+  int const encodings[] = {page.repetition_level_encoding, page.definition_level_encoding};
+  for (int i = 0; i < 2; i++) {
+    uint32_t const level_bits = chunk.level_bits[levels[i]];
+    if (level_bits == 0) { continue; }
+    if (encodings[i] == RLE) {
+      if (cur + 4 > end) { return end - page.page_data; }
+      cur += 4 + (cur[0] | (cur[1] << 8) | (cur[2] << 16) | (cur[3] << 24));
+    } else if (encodings[i] == BIT_PACKED) {
+      cur += (page.num_input_values * level_bits + 7) >> 3;
+    }
+  }
+  return ((cur < end) ? cur : end) - page.page_data;
+}
+
+/**
+ * @brief Kernel for converting data pages to PLAIN, or for computing their size once converted
+ *
+ * Converted pages keep their definition and repetition levels, followed by the PLAIN values.
+ *
+ * @param[in,out] pages All pages; converted pages are updated to point to their PLAIN data
+ * @param[in] chunks All chunks
+ * @param[in] dst Output PLAIN pages, or nullptr to compute their size
+ * @param[in,out] page_offsets Offset of each page in `dst`, followed by the total size, or the
+ * output size of each page if `dst` is nullptr (0 for the pages that are not converted)
+ */
+// blockDim {128,1,1}
+__global__ void __launch_bounds__(block_size) gpuConvertPagesToPlain(PageInfo *pages,
+                                                                   ColumnChunkDesc const *chunks,
+                                                                   uint8_t *dst,
+                                                                   size_t *page_offsets)
+{
+  int const t          = threadIdx.x;
+  PageInfo const &page = pages[blockIdx.x];
+  int const encoding   = page.encoding;
+  if ((page.flags & PAGEINFO_FLAGS_DICTIONARY) ||
+      (encoding != DELTA_BINARY_PACKED && encoding != DELTA_LENGTH_BYTE_ARRAY &&
+       encoding != DELTA_BYTE_ARRAY && encoding != BYTE_STREAM_SPLIT)) {
+    if (dst == nullptr && t == 0) { page_offsets[blockIdx.x] = 0; }
+    return;
+  }
+  if (dst != nullptr && page_offsets[blockIdx.x + 1] == page_offsets[blockIdx.x]) { return; }
+
+  ColumnChunkDesc const &chunk = chunks[page.chunk_idx];
+  const uint8_t *begin         = page.page_data;
+  const uint8_t *end           = begin + page.uncompressed_page_size;
+  uint32_t const levels_size   = get_levels_size(page, chunk, end);
+  const uint8_t *values        = begin + levels_size;
+  int const type               = chunk.data_type & 7;
+  uint32_t const width         = (type == INT32 || type == FLOAT)    ? 4
+                                 : (type == INT64 || type == DOUBLE) ? 8
+                                                                     : 0;
+  uint8_t *page_dst = (dst != nullptr) ? dst + page_offsets[blockIdx.x] : nullptr;
+  uint8_t *out      = (dst != nullptr) ? page_dst + levels_size : nullptr;
+  if (page_dst != nullptr) {
+    for (uint32_t i = t; i < levels_size; i += block_size) { page_dst[i] = begin[i]; }
+  }
+
+  int64_t values_size = -1;
+  switch (encoding) {
+    case DELTA_BINARY_PACKED:
+      if (type == INT32 || type == INT64) {
+        values_size = delta_binary_to_plain(values, end, width, out);
+      }
+      break;
+    case BYTE_STREAM_SPLIT:
+      if (width != 0) { values_size = byte_stream_split_to_plain(values, end, width, out); }
+      break;
+    case DELTA_LENGTH_BYTE_ARRAY:
+      if (type == BYTE_ARRAY) { values_size = delta_length_to_plain(values, end, out, nullptr); }
+      break;
+    case DELTA_BYTE_ARRAY:
+      if (type == BYTE_ARRAY) {
+        uint8_t *out_end = (dst != nullptr) ? dst + page_offsets[blockIdx.x + 1] : nullptr;
+        values_size = delta_byte_array_to_plain(values, end, out, out_end);
+      }
+      break;
+  }
+  __syncthreads();
+  if (t == 0) {
+    if (dst == nullptr) {
+      page_offsets[blockIdx.x] = (values_size >= 0) ? levels_size + values_size : 0;
+    } else if (values_size >= 0) {
+      pages[blockIdx.x].page_data              = page_dst;
+      pages[blockIdx.x].uncompressed_page_size = levels_size + values_size;
+      pages[blockIdx.x].encoding               = PLAIN;
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::io::parquet::gpu::ComputePlainPageSizes
+ */
+cudaError_t ComputePlainPageSizes(PageInfo *pages,
+                                  int32_t num_pages,
+                                  ColumnChunkDesc const *chunks,
+                                  size_t *page_sizes,
+                                  cudaStream_t stream)
+{
+  if (num_pages > 0) {
+    gpuConvertPagesToPlain<<<num_pages, block_size, 0, stream>>>(
+      pages, chunks, nullptr, page_sizes);
+  }
+  return cudaSuccess;
+}
+
+/**
+ * @copydoc cudf::io::parquet::gpu::ConvertPagesToPlain
+ */
+cudaError_t ConvertPagesToPlain(PageInfo *pages,
+                                int32_t num_pages,
+                                ColumnChunkDesc const *chunks,
+                                uint8_t *dst,
+                                size_t *page_offsets,
+                                cudaStream_t stream)
+{
+  if (num_pages > 0) {
+    gpuConvertPagesToPlain<<<num_pages, block_size, 0, stream>>>(
+      pages, chunks, dst, page_offsets);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
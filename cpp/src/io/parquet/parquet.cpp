@@ -133,6 +133,20 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth)
     }                                        \
     break;
 
+#define PARQUET_FLD_BINARY(id, m)         \
+  case id:                                \
+    if (t != ST_FLD_BINARY)               \
+      return false;                       \
+    else {                                \
+      uint32_t n = get_u32();             \
+      if (n <= (size_t)(m_end - m_cur)) { \
+        s->m.assign(m_cur, m_cur + n);    \
+        m_cur += n;                       \
+      } else                              \
+        return false;                     \
+    }                                     \
+    break;
+
 #define PARQUET_FLD_STRUCT_LIST(id, m)              \
   case id:                                          \
     if (t != ST_FLD_LIST) return false;             \
@@ -183,6 +197,55 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth)
       break;                                        \
     }
 
+#define PARQUET_FLD_BINARY_LIST(id, m)              \
+  case id:                                          \
+    if (t != ST_FLD_LIST) return false;             \
+    {                                               \
+      int n;                                        \
+      c = getb();                                   \
+      if ((c & 0xf) != ST_FLD_BINARY) return false; \
+      n = c >> 4;                                   \
+      if (n == 0xf) n = get_u32();                  \
+      s->m.resize(n);                               \
+      for (int32_t i = 0; i < n; i++) {             \
+        uint32_t l = get_u32();                     \
+        if (l <= (size_t)(m_end - m_cur)) {         \
+          s->m[i].assign(m_cur, m_cur + l);         \
+          m_cur += l;                               \
+        } else                                      \
+          return false;                             \
+      }                                             \
+      break;                                        \
+    }
+
+#define PARQUET_FLD_BOOL_LIST(id, m)                                           \
+  case id:                                                                     \
+    if (t != ST_FLD_LIST) return false;                                        \
+    {                                                                          \
+      int n;                                                                   \
+      c = getb();                                                              \
+      if ((c & 0xf) != ST_FLD_TRUE && (c & 0xf) != ST_FLD_FALSE) return false; \
+      n = c >> 4;                                                              \
+      if (n == 0xf) n = get_u32();                                             \
+      s->m.resize(n);                                                          \
+      for (int32_t i = 0; i < n; i++) s->m[i] = (getb() == ST_FLD_TRUE);       \
+      break;                                                                   \
+    }
+
+#define PARQUET_FLD_INT64_LIST(id, m)                      \
+  case id:                                                 \
+    if (t != ST_FLD_LIST) return false;                    \
+    {                                                      \
+      int n;                                               \
+      c = getb();                                          \
+      if ((c & 0xf) != ST_FLD_I64) return false;           \
+      n = c >> 4;                                          \
+      if (n == 0xf) n = get_u32();                         \
+      s->m.resize(n);                                      \
+      for (int32_t i = 0; i < n; i++) s->m[i] = get_i64(); \
+      break;                                               \
+    }
+
 #define PARQUET_FLD_STRUCT(id, m)                         \
   case id:                                                \
     if (t != ST_FLD_STRUCT || !read(&s->m)) return false; \
@@ -253,6 +316,8 @@ PARQUET_FLD_INT64(9, data_page_offset)
 PARQUET_FLD_INT64(10, index_page_offset)
 PARQUET_FLD_INT64(11, dictionary_page_offset)
 PARQUET_FLD_STRUCT_BLOB(12, statistics_blob)
+PARQUET_FLD_INT64(14, bloom_filter_offset)
+PARQUET_FLD_INT32(15, bloom_filter_length)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(PageHeader)
@@ -280,6 +345,37 @@ PARQUET_FLD_STRING(1, key)
 PARQUET_FLD_STRING(2, value)
 PARQUET_END_STRUCT()
 
+PARQUET_BEGIN_STRUCT(Statistics)
+PARQUET_FLD_BINARY(1, max)
+PARQUET_FLD_BINARY(2, min)
+PARQUET_FLD_INT64(3, null_count)
+PARQUET_FLD_INT64(4, distinct_count)
+PARQUET_FLD_BINARY(5, max_value)
+PARQUET_FLD_BINARY(6, min_value)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(PageLocation)
+PARQUET_FLD_INT64(1, offset)
+PARQUET_FLD_INT32(2, compressed_page_size)
+PARQUET_FLD_INT64(3, first_row_index)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(OffsetIndex)
+PARQUET_FLD_STRUCT_LIST(1, page_locations)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(ColumnIndex)
+PARQUET_FLD_BOOL_LIST(1, null_pages)
+PARQUET_FLD_BINARY_LIST(2, min_values)
+PARQUET_FLD_BINARY_LIST(3, max_values)
+PARQUET_FLD_ENUM(4, boundary_order, int32_t)
+PARQUET_FLD_INT64_LIST(5, null_counts)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(BloomFilterHeader)
+PARQUET_FLD_INT32(1, num_bytes)
+PARQUET_END_STRUCT()
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
@@ -397,6 +493,20 @@ int CompactProtocolReader::WalkSchema(
   for (auto i = 0; i < s->m.size(); i++) { put_int(s->m[i]); }              \
   cur_fld = id;
 
+#define CPW_FLD_INT64_LIST(id, m)                                           \
+  put_fldh(id, cur_fld, ST_FLD_LIST);                                       \
+  putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_I64)); \
+  if (s->m.size() >= 0xf) put_uint(s->m.size());                            \
+  for (auto i = 0; i < s->m.size(); i++) { put_int(s->m[i]); }              \
+  cur_fld = id;
+
+#define CPW_FLD_BOOL_LIST(id, m)                                                           \
+  put_fldh(id, cur_fld, ST_FLD_LIST);                                                      \
+  putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE));               \
+  if (s->m.size() >= 0xf) put_uint(s->m.size());                                           \
+  for (auto i = 0; i < s->m.size(); i++) { putb((s->m[i]) ? ST_FLD_TRUE : ST_FLD_FALSE); } \
+  cur_fld = id;
+
 #define CPW_FLD_STRING_LIST(id, m)                                                     \
   put_fldh(id, cur_fld, ST_FLD_LIST);                                                  \
   putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_BINARY));         \
@@ -426,6 +536,14 @@ int CompactProtocolReader::WalkSchema(
   putb(reinterpret_cast<const uint8_t *>(s->m.data()), (uint32_t)s->m.size()); \
   cur_fld = id;
 
+// Union whose only member is an empty struct
+#define CPW_FLD_EMPTY_UNION(id)         \
+  put_fldh(id, cur_fld, ST_FLD_STRUCT); \
+  put_fldh(1, 0, ST_FLD_STRUCT);        \
+  putb(0);                              \
+  putb(0);                              \
+  cur_fld = id;
+
 #define CPW_END_STRUCT()                   \
   putb(0);                                 \
   return m_buf->size() - struct_start_pos; \
@@ -506,6 +624,35 @@ CPW_FLD_INT64(9, data_page_offset)
 if (s->index_page_offset != 0) { CPW_FLD_INT64(10, index_page_offset) }
 if (s->dictionary_page_offset != 0) { CPW_FLD_INT64(11, dictionary_page_offset) }
 if (s->statistics_blob.size() != 0) { CPW_FLD_STRUCT_BLOB(12, statistics_blob); }
+if (s->bloom_filter_offset != 0) {
+  CPW_FLD_INT64(14, bloom_filter_offset)
+  CPW_FLD_INT32(15, bloom_filter_length)
+}
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(PageLocation)
+CPW_FLD_INT64(1, offset)
+CPW_FLD_INT32(2, compressed_page_size)
+CPW_FLD_INT64(3, first_row_index)
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(OffsetIndex)
+CPW_FLD_STRUCT_LIST(1, page_locations)
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(ColumnIndex)
+CPW_FLD_BOOL_LIST(1, null_pages)
+CPW_FLD_STRING_LIST(2, min_values)
+CPW_FLD_STRING_LIST(3, max_values)
+CPW_FLD_INT32(4, boundary_order)
+if (s->null_counts.size() != 0) { CPW_FLD_INT64_LIST(5, null_counts) }
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(BloomFilterHeader)
+CPW_FLD_INT32(1, num_bytes)
+CPW_FLD_EMPTY_UNION(2)  // SplitBlockAlgorithm
+CPW_FLD_EMPTY_UNION(3)  // XxHash
+CPW_FLD_EMPTY_UNION(4)  // Uncompressed
 CPW_END_STRUCT()
 
 }  // namespace parquet
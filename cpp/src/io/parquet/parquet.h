@@ -76,6 +76,21 @@ struct SchemaElement {
   }
 };
 
+/**
+ * @brief Thrift-derived struct describing column chunk statistics
+ *
+ * Values are stored in their plain-encoded binary representation. The deprecated `min` and `max`
+ * fields use signed comparison ordering and are only meaningful for signed numeric types.
+ **/
+struct Statistics {
+  std::vector<uint8_t> max;        // deprecated max value in signed comparison order
+  std::vector<uint8_t> min;        // deprecated min value in signed comparison order
+  int64_t null_count     = -1;     // count of null values in the column (-1 if unknown)
+  int64_t distinct_count = -1;     // count of distinct values occurring (-1 if unknown)
+  std::vector<uint8_t> max_value;  // max value for the column, determined by its ColumnOrder
+  std::vector<uint8_t> min_value;  // min value for the column, determined by its ColumnOrder
+};
+
 /**
  * @brief Thrift-derived struct describing a column chunk
  **/
@@ -94,6 +109,8 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;       // Byte offset from beginning of file to bloom filter
+  int32_t bloom_filter_length = 0;       // Size of the bloom filter, including its header
 };
 
 /**
@@ -121,6 +138,49 @@ struct ColumnChunk {
   int leaf_schema_idx = -1;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page in the file
+ **/
+struct PageLocation {
+  int64_t offset               = 0;  // Offset of the page header in the file
+  int32_t compressed_page_size = 0;  // Size of the page, including the header, in bytes
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the data pages of a column chunk (page index)
+ *
+ * Page locations are listed in the order they appear in the file and do not include the
+ * dictionary page.
+ **/
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing the per-page statistics of a column chunk (page index)
+ *
+ * Min/max values are encoded the same way as in `Statistics`; the entries of pages that only
+ * contain nulls are empty.
+ **/
+struct ColumnIndex {
+  std::vector<bool> null_pages;                  // Whether each page only contains nulls
+  std::vector<std::vector<uint8_t>> min_values;  // Lower bound of the values of each page
+  std::vector<std::vector<uint8_t>> max_values;  // Upper bound of the values of each page
+  int32_t boundary_order = 0;                    // Ordering of min/max values across pages
+  std::vector<int64_t> null_counts;              // Number of nulls in each page (optional)
+};
+
+/**
+ * @brief Thrift-derived struct describing the split block bloom filter of a column chunk
+ *
+ * The header is followed by the bitset. The algorithm, hash and compression unions of the header
+ * each have a single member (split blocks, xxHash64 and no compression), so they are implied.
+ **/
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset, in bytes
+};
+
 /**
  * @brief Thrift-derived struct describing a group of row data
  *
@@ -298,6 +358,11 @@ class CompactProtocolReader {
   DECL_PARQUET_STRUCT(DataPageHeader);
   DECL_PARQUET_STRUCT(DictionaryPageHeader);
   DECL_PARQUET_STRUCT(KeyValue);
+  DECL_PARQUET_STRUCT(Statistics);
+  DECL_PARQUET_STRUCT(PageLocation);
+  DECL_PARQUET_STRUCT(OffsetIndex);
+  DECL_PARQUET_STRUCT(ColumnIndex);
+  DECL_PARQUET_STRUCT(BloomFilterHeader);
 #undef DECL_PARQUET_STRUCT
 
  public:
@@ -369,6 +434,10 @@ class CompactProtocolWriter {
   DECL_CPW_STRUCT(KeyValue);
   DECL_CPW_STRUCT(ColumnChunk);
   DECL_CPW_STRUCT(ColumnChunkMetaData);
+  DECL_CPW_STRUCT(PageLocation);
+  DECL_CPW_STRUCT(OffsetIndex);
+  DECL_CPW_STRUCT(ColumnIndex);
+  DECL_CPW_STRUCT(BloomFilterHeader);
 #undef DECL_CPW_STRUCT
 
  protected:
@@ -24,6 +24,8 @@
 #include <vector>
 #include "parquet_common.h"
 
+#include <cudf/types.hpp>
+
 namespace cudf {
 namespace io {
 namespace parquet {
@@ -33,7 +35,9 @@ namespace gpu {
  * @brief Enums for the flags in the page header
  */
 enum {
-  PAGEINFO_FLAGS_DICTIONARY = (1 << 0),  // Indicates a dictionary page
+  PAGEINFO_FLAGS_DICTIONARY   = (1 << 0),  // Indicates a dictionary page
+  PAGEINFO_FLAGS_V2           = (1 << 1),  // Indicates a V2 data page
+  PAGEINFO_FLAGS_UNCOMPRESSED = (1 << 2),  // V2 data page stored without compression
 };
 
 /**
@@ -54,6 +58,87 @@ struct nvstrdesc_s {
   size_t count;
 };
 
+/**
+ * @brief Number of bytes of a block of a split block bloom filter
+ */
+constexpr uint32_t kBloomFilterBlockSize = 32;
+
+/**
+ * @brief Hash of plain-encoded values in bloom filters (64-bit xxHash with a seed of 0)
+ */
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_filter_hash(const uint8_t *data, uint32_t len)
+{
+  constexpr uint64_t p1 = 0x9e3779b185ebca87ull;
+  constexpr uint64_t p2 = 0xc2b2ae3d27d4eb4full;
+  constexpr uint64_t p3 = 0x165667b19e3779f9ull;
+  constexpr uint64_t p4 = 0x85ebca77c2b2ae63ull;
+  constexpr uint64_t p5 = 0x27d4eb2f165667c5ull;
+
+  auto rotl  = [](uint64_t v, int r) { return (v << r) | (v >> (64 - r)); };
+  auto round = [&](uint64_t acc, uint64_t v) { return rotl(acc + v * p2, 31) * p1; };
+  auto load  = [&](uint32_t pos, uint32_t bytes) {
+    uint64_t v = 0;
+    for (uint32_t b = bytes; b > 0; --b) { v = (v << 8) | data[pos + b - 1]; }
+    return v;
+  };
+
+  uint64_t hash;
+  uint32_t pos = 0;
+  if (len >= 32) {
+    uint64_t v1 = p1 + p2, v2 = p2, v3 = 0, v4 = 0 - p1;
+    for (; pos + 32 <= len; pos += 32) {
+      v1 = round(v1, load(pos + 0, 8));
+      v2 = round(v2, load(pos + 8, 8));
+      v3 = round(v3, load(pos + 16, 8));
+      v4 = round(v4, load(pos + 24, 8));
+    }
+    hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    hash = (hash ^ round(0, v1)) * p1 + p4;
+    hash = (hash ^ round(0, v2)) * p1 + p4;
+    hash = (hash ^ round(0, v3)) * p1 + p4;
+    hash = (hash ^ round(0, v4)) * p1 + p4;
+  } else {
+    hash = p5;
+  }
+  hash += len;
+  for (; pos + 8 <= len; pos += 8) { hash = rotl(hash ^ round(0, load(pos, 8)), 27) * p1 + p4; }
+  if (pos + 4 <= len) {
+    hash = rotl(hash ^ (load(pos, 4) * p1), 23) * p2 + p3;
+    pos += 4;
+  }
+  for (; pos < len; pos++) { hash = rotl(hash ^ (data[pos] * p5), 11) * p1; }
+  hash ^= hash >> 33;
+  hash *= p2;
+  hash ^= hash >> 29;
+  hash *= p3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+/**
+ * @brief Returns the block of a split block bloom filter that holds a hash
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_block(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit set by a hash in a word of its split block bloom filter block
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_mask(uint64_t hash, int word)
+{
+  constexpr uint32_t salt[8] = {0x47b6137bu,
+                                0x44974d91u,
+                                0x8824ad5bu,
+                                0xa2b7289du,
+                                0x705495c7u,
+                                0x2df1424bu,
+                                0x9efc4947u,
+                                0x5c6bfb31u};
+  return 1u << ((static_cast<uint32_t>(hash) * salt[word]) >> 27);
+}
+
 /**
  * @brief Nesting information
  */
@@ -104,6 +189,9 @@ struct PageInfo {
   uint8_t encoding;    // Encoding for data or dictionary page
   uint8_t definition_level_encoding;  // Encoding used for definition levels (data page)
   uint8_t repetition_level_encoding;  // Encoding used for repetition levels (data page)
+  // Byte length of the definition/repetition levels, stored before the (possibly compressed)
+  // values without a length prefix (V2 data page)
+  int32_t lvl_bytes[level_type::NUM_LEVEL_TYPES];
 
   int skipped_values;
   int skipped_leaf_values;
@@ -196,7 +284,7 @@ struct EncColumnDesc : stats_column_desc {
   uint8_t converted_type;  //!< logical data type
   uint8_t level_bits;  //!< bits to encode max definition (lower nibble) & repetition (upper nibble)
                        //!< levels
-  uint8_t pad;
+  uint8_t value_encoding;  //!< Encoding of the values of non-dictionary data pages
 };
 
 #define MAX_PAGE_FRAGMENT_SIZE 5000  //!< Max number of rows in a page fragment
@@ -233,6 +321,10 @@ struct EncPage {
 /// Size of hash used for building dictionaries
 constexpr unsigned int kDictHashBits = 16;
 constexpr size_t kDictScratchSize    = (1 << kDictHashBits) * sizeof(uint32_t);
+/// Maximum number of entries in a chunk dictionary (24-bit dictionary indices)
+constexpr uint32_t kMaxDictEntries = 1 << 24;
+/// Chunks whose fragments may hold more unique values than this use a global hash map
+constexpr uint32_t kMaxLocalDictEntries = 65536;
 
 /**
  * @brief Return the byte length of parquet dtypes that are physically represented by INT32
@@ -276,10 +368,13 @@ struct EncColumnChunk {
   uint32_t dictionary_id;         //!< Dictionary id for this chunk
   uint8_t is_compressed;          //!< Nonzero if the chunk uses compression
   uint8_t has_dictionary;         //!< Nonzero if the chunk uses dictionary encoding
+  uint8_t global_dictionary;      //!< Nonzero if the dictionary is built with a global hash map
   uint16_t num_dict_fragments;    //!< Number of fragments using dictionary
   uint32_t dictionary_size;       //!< Size of dictionary
   uint32_t total_dict_entries;    //!< Total number of entries in dictionary
   uint32_t ck_stat_size;          //!< Size of chunk-level statistics (included in 1st page header)
+  uint32_t *bloom_filter;         //!< Bloom filter bitset (null if none)
+  uint32_t bloom_filter_blocks;   //!< Number of blocks of the bloom filter
 };
 
 /**
@@ -335,6 +430,50 @@ cudaError_t PreprocessColumnData(hostdevice_vector<PageInfo> &pages,
                                  size_t min_row,
                                  cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for computing the size of the data pages using the DELTA_BINARY_PACKED,
+ * DELTA_LENGTH_BYTE_ARRAY, DELTA_BYTE_ARRAY or BYTE_STREAM_SPLIT encodings once converted to PLAIN
+ *
+ * The size includes the scratch memory needed for the conversion.
+ *
+ * @param[in] pages All pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks All chunks
+ * @param[out] page_sizes Size of each page once converted, 0 for the pages that are not converted
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ */
+cudaError_t ComputePlainPageSizes(PageInfo *pages,
+                                  int32_t num_pages,
+                                  ColumnChunkDesc const *chunks,
+                                  size_t *page_sizes,
+                                  cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel for converting the data pages using the DELTA_BINARY_PACKED,
+ * DELTA_LENGTH_BYTE_ARRAY, DELTA_BYTE_ARRAY or BYTE_STREAM_SPLIT encodings to PLAIN
+ *
+ * Converted pages keep their definition and repetition levels, and are updated to point to their
+ * PLAIN data so that they can be decoded with `DecodePageData`.
+ *
+ * @param[in,out] pages All pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks All chunks
+ * @param[out] dst Converted pages
+ * @param[in] page_offsets Offset of each page in `dst` from the sizes given by
+ * `ComputePlainPageSizes`, followed by the total size
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ */
+cudaError_t ConvertPagesToPlain(PageInfo *pages,
+                                int32_t num_pages,
+                                ColumnChunkDesc const *chunks,
+                                uint8_t *dst,
+                                size_t *page_offsets,
+                                cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Launches kernel for reading the column data stored in the pages
  *
@@ -364,6 +503,8 @@ cudaError_t DecodePageData(hostdevice_vector<PageInfo> &pages,
  * @param[in] num_columns Number of columns
  * @param[in] fragment_size Number of rows per fragment
  * @param[in] num_rows Number of rows per column
+ * @param[in] fragment_starts Optional first row of each fragment, followed by the number of rows
+ * [num_fragments + 1]; fragments are `fragment_size` rows long if null
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -374,7 +515,8 @@ cudaError_t InitPageFragments(PageFragment *frag,
                               int32_t num_columns,
                               uint32_t fragment_size,
                               uint32_t num_rows,
-                              cudaStream_t stream = (cudaStream_t)0);
+                              const uint32_t *fragment_starts = nullptr,
+                              cudaStream_t stream             = (cudaStream_t)0);
 
 /**
  * @brief Launches kernel for initializing fragment statistics groups
@@ -385,6 +527,8 @@ cudaError_t InitPageFragments(PageFragment *frag,
  * @param[in] num_fragments Number of fragments
  * @param[in] num_columns Number of columns
  * @param[in] fragment_size Max size of each fragment in rows
+ * @param[in] fragment_starts Optional first row of each fragment [num_fragments]; fragments are
+ * `fragment_size` rows long if null
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -395,7 +539,8 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
                                    int32_t num_fragments,
                                    int32_t num_columns,
                                    uint32_t fragment_size,
-                                   cudaStream_t stream = (cudaStream_t)0);
+                                   const uint32_t *fragment_starts = nullptr,
+                                   cudaStream_t stream             = (cudaStream_t)0);
 
 /**
  * @brief Launches kernel for initializing encoder data pages
@@ -405,6 +550,7 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
  * @param[in] col_desc Column description array [column_id]
  * @param[in] num_rowgroups Number of fragments per column
  * @param[in] num_columns Number of columns
+ * @param[in] max_page_size Target uncompressed size of the data pages, in bytes
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
  * @param[in] stream CUDA stream to use, default 0
@@ -416,6 +562,7 @@ cudaError_t InitEncoderPages(EncColumnChunk *chunks,
                              const EncColumnDesc *col_desc,
                              int32_t num_rowgroups,
                              int32_t num_columns,
+                             uint32_t max_page_size,
                              statistics_merge_group *page_grstats  = nullptr,
                              statistics_merge_group *chunk_grstats = nullptr,
                              cudaStream_t stream                   = (cudaStream_t)0);
@@ -499,6 +646,21 @@ cudaError_t GatherPages(EncColumnChunk *chunks,
                         uint32_t num_chunks,
                         cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Deduplicates the values of a column chunk with a global-memory hash map
+ *
+ * Sets the dictionary index of every valid row of the chunk to its own row if it holds the first
+ * occurrence of its value, or to the row of the first occurrence with bit 31 set otherwise. Used
+ * instead of the fixed-size hash of BuildChunkDictionaries for chunks with `global_dictionary` set.
+ *
+ * @param[in] ck Host copy of the column chunk
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ */
+cudaError_t BuildGlobalDictionaryIndex(EncColumnChunk const &ck,
+                                       cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Launches kernel for building chunk dictionaries
  *
@@ -506,6 +668,7 @@ cudaError_t GatherPages(EncColumnChunk *chunks,
  * @param[in] dev_scratch Device scratch data (kDictScratchSize bytes per dictionary)
  * @param[in] scratch_size size of scratch data in bytes
  * @param[in] num_chunks Number of column chunks
+ * @param[in] max_dict_size Maximum dictionary size of a column chunk in bytes
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -514,6 +677,7 @@ cudaError_t BuildChunkDictionaries(EncColumnChunk *chunks,
                                    uint32_t *dev_scratch,
                                    size_t scratch_size,
                                    uint32_t num_chunks,
+                                   size_t max_dict_size,
                                    cudaStream_t stream = (cudaStream_t)0);
 
 }  // namespace gpu
@@ -22,8 +22,19 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
-
+#include <io/utilities/column_predicate.hpp>
+#include <io/utilities/footer_statistics.hpp>
+#include <io/utilities/host_parallel_for.hpp>
+#include <io/utilities/metadata_cache.hpp>
+#include <io/utilities/strings_dictionary.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/memory_estimate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
@@ -31,8 +42,14 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/transform.h>
+
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <limits>
 #include <numeric>
 #include <regex>
 
@@ -45,12 +62,17 @@ using namespace cudf::io::parquet;
 using namespace cudf::io;
 
 namespace {
+// Compressed size of the row groups decoded together when the read of the next row groups
+// overlaps their decoding
+constexpr size_t decode_batch_size = 64 * 1024 * 1024;
+
 /**
  * @brief Function that translates Parquet datatype to cuDF type enum
  */
 type_id to_type_id(SchemaElement const &schema,
                    bool strings_to_categorical,
-                   type_id timestamp_type_id)
+                   type_id timestamp_type_id,
+                   bool decimals_as_fixed_point)
 {
   parquet::Type physical         = schema.type;
   parquet::ConvertedType logical = schema.converted_type;
@@ -79,6 +101,8 @@ type_id to_type_id(SchemaElement const &schema,
       return (timestamp_type_id != type_id::EMPTY) ? timestamp_type_id
                                                    : type_id::TIMESTAMP_MILLISECONDS;
     case parquet::DECIMAL:
+      if (decimals_as_fixed_point && physical == parquet::INT32) { return type_id::DECIMAL32; }
+      if (decimals_as_fixed_point && physical == parquet::INT64) { return type_id::DECIMAL64; }
       if (decimal_scale != 0 || (physical != parquet::INT32 && physical != parquet::INT64)) {
         return type_id::FLOAT64;
       }
@@ -153,15 +177,521 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
     type_width = 4;  // str -> hash32
   } else if (is_chrono(data_type{column_type_id})) {
     clock_rate = to_clockrate(timestamp_type_id);
+  } else if (is_fixed_point(data_type{column_type_id})) {
+    type_width = size_of(data_type{column_type_id});  // I32 -> decimal32, I64 -> decimal64
   }
 
   int8_t converted_type = converted;
-  if (converted_type == parquet::DECIMAL && column_type_id != type_id::FLOAT64) {
+  if (converted_type == parquet::DECIMAL && column_type_id != type_id::FLOAT64 &&
+      not is_fixed_point(data_type{column_type_id})) {
     converted_type = parquet::UNKNOWN;  // Not converting to float64
   }
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Decodes a plain-encoded fixed-width statistics value
+ */
+template <typename T>
+bool decode_stats_value(std::vector<uint8_t> const &blob, T &value)
+{
+  if (blob.size() != sizeof(T)) return false;
+  memcpy(&value, blob.data(), sizeof(T));
+  return true;
+}
+
+/**
+ * @brief Evaluates a predicate against the encoded min/max statistics of a column chunk
+ */
+template <typename T>
+bool minmax_may_satisfy(host_predicate const &pred,
+                        std::vector<uint8_t> const &min_blob,
+                        std::vector<uint8_t> const &max_blob,
+                        int64_t ns_per_tick = 0)
+{
+  T min, max;
+  if (!decode_stats_value(min_blob, min) || !decode_stats_value(max_blob, max)) return true;
+  if (std::is_floating_point<T>::value && (std::isnan(min) || std::isnan(max))) return true;
+  if (std::is_floating_point<T>::value) {
+    double lo, hi;
+    if (!literal_bounds(pred.value, lo, hi)) return true;
+    return range_may_satisfy<double>(pred.op, min, max, lo, hi);
+  } else if (std::is_signed<T>::value) {
+    int64_t lo, hi;
+    if (!literal_bounds(pred.value, ns_per_tick, lo, hi)) return true;
+    return range_may_satisfy<int64_t>(pred.op, min, max, lo, hi);
+  } else {
+    uint64_t lo, hi;
+    if (!literal_bounds(pred.value, lo, hi)) return true;
+    return range_may_satisfy<uint64_t>(pred.op, min, max, lo, hi);
+  }
+}
+
+/**
+ * @brief Evaluates a predicate against encoded min/max values of a column
+ *
+ * Returns `true` whenever the values cannot be interpreted.
+ */
+bool stats_may_satisfy(host_predicate const &pred,
+                       SchemaElement const &schema,
+                       std::vector<uint8_t> const &min_blob,
+                       std::vector<uint8_t> const &max_blob)
+{
+  // Scaled decimals are returned as float64 and not interpreted here
+  if (schema.converted_type == parquet::DECIMAL) return true;
+
+  switch (schema.type) {
+    case parquet::BOOLEAN: return minmax_may_satisfy<uint8_t>(pred, min_blob, max_blob);
+    case parquet::INT32:
+      switch (schema.converted_type) {
+        case parquet::UINT_8:
+        case parquet::UINT_16:
+        case parquet::UINT_32: return minmax_may_satisfy<uint32_t>(pred, min_blob, max_blob);
+        case parquet::DATE:
+          return minmax_may_satisfy<int32_t>(pred, min_blob, max_blob, 86400000000000ll);
+        case parquet::TIME_MILLIS:
+          return minmax_may_satisfy<int32_t>(pred, min_blob, max_blob, 1000000);
+        default: return minmax_may_satisfy<int32_t>(pred, min_blob, max_blob);
+      }
+    case parquet::INT64:
+      switch (schema.converted_type) {
+        case parquet::UINT_64: return minmax_may_satisfy<uint64_t>(pred, min_blob, max_blob);
+        case parquet::TIMESTAMP_MILLIS:
+          return minmax_may_satisfy<int64_t>(pred, min_blob, max_blob, 1000000);
+        case parquet::TIMESTAMP_MICROS:
+        case parquet::TIME_MICROS:
+          return minmax_may_satisfy<int64_t>(pred, min_blob, max_blob, 1000);
+        default: return minmax_may_satisfy<int64_t>(pred, min_blob, max_blob);
+      }
+    case parquet::FLOAT: return minmax_may_satisfy<float>(pred, min_blob, max_blob);
+    case parquet::DOUBLE: return minmax_may_satisfy<double>(pred, min_blob, max_blob);
+    case parquet::BYTE_ARRAY:
+    case parquet::FIXED_LEN_BYTE_ARRAY: {
+      std::string lo, hi;
+      if (!literal_bounds(pred.value, lo, hi)) return true;
+      std::string const min(min_blob.cbegin(), min_blob.cend());
+      std::string const max(max_blob.cbegin(), max_blob.cend());
+      return range_may_satisfy(pred.op, min, max, lo, hi);
+    }
+    default: return true;
+  }
+}
+
+/**
+ * @brief Decodes plain-encoded fixed-width min/max statistics into host-side literals
+ */
+template <typename T>
+void decode_stats_literals(std::vector<uint8_t> const &min_blob,
+                           std::vector<uint8_t> const &max_blob,
+                           predicate_literal &min,
+                           predicate_literal &max,
+                           int64_t ns_per_tick = 0)
+{
+  T min_value, max_value;
+  if (!decode_stats_value(min_blob, min_value) || !decode_stats_value(max_blob, max_value)) return;
+  auto const to_literal = [ns_per_tick](T value) {
+    predicate_literal lit;
+    if (std::is_floating_point<T>::value) {
+      lit.kind   = literal_kind::FLOAT;
+      lit.fp_val = static_cast<double>(value);
+    } else if (std::is_signed<T>::value) {
+      lit.kind        = literal_kind::SIGNED;
+      lit.int_val     = static_cast<int64_t>(value);
+      lit.ns_per_tick = ns_per_tick;
+    } else {
+      lit.kind     = literal_kind::UNSIGNED;
+      lit.uint_val = static_cast<uint64_t>(value);
+    }
+    return lit;
+  };
+  min = to_literal(min_value);
+  max = to_literal(max_value);
+}
+
+/**
+ * @brief Decodes the min/max statistics of a column chunk into host-side literals
+ *
+ * `min` and `max` are left unchanged if the statistics are missing or cannot be interpreted.
+ */
+void decode_chunk_minmax(SchemaElement const &schema,
+                         Statistics const &stats,
+                         predicate_literal &min,
+                         predicate_literal &max)
+{
+  auto const is_unsigned = schema.converted_type == parquet::UINT_8 ||
+                           schema.converted_type == parquet::UINT_16 ||
+                           schema.converted_type == parquet::UINT_32 ||
+                           schema.converted_type == parquet::UINT_64;
+  auto const is_bytes =
+    schema.type == parquet::BYTE_ARRAY || schema.type == parquet::FIXED_LEN_BYTE_ARRAY;
+
+  // The deprecated min/max fields are in signed order and only usable for signed types
+  auto const has_minmax = !stats.min_value.empty() && !stats.max_value.empty();
+  if (!has_minmax && (is_unsigned || is_bytes || stats.min.empty() || stats.max.empty())) {
+    return;
+  }
+  auto const &min_blob = has_minmax ? stats.min_value : stats.min;
+  auto const &max_blob = has_minmax ? stats.max_value : stats.max;
+
+  // Scaled decimals are returned as float64 and not interpreted here
+  if (schema.converted_type == parquet::DECIMAL) return;
+
+  switch (schema.type) {
+    case parquet::BOOLEAN: return decode_stats_literals<uint8_t>(min_blob, max_blob, min, max);
+    case parquet::INT32:
+      switch (schema.converted_type) {
+        case parquet::UINT_8:
+        case parquet::UINT_16:
+        case parquet::UINT_32:
+          return decode_stats_literals<uint32_t>(min_blob, max_blob, min, max);
+        case parquet::DATE:
+          return decode_stats_literals<int32_t>(min_blob, max_blob, min, max, 86400000000000ll);
+        case parquet::TIME_MILLIS:
+          return decode_stats_literals<int32_t>(min_blob, max_blob, min, max, 1000000);
+        default: return decode_stats_literals<int32_t>(min_blob, max_blob, min, max);
+      }
+    case parquet::INT64:
+      switch (schema.converted_type) {
+        case parquet::UINT_64:
+          return decode_stats_literals<uint64_t>(min_blob, max_blob, min, max);
+        case parquet::TIMESTAMP_MILLIS:
+          return decode_stats_literals<int64_t>(min_blob, max_blob, min, max, 1000000);
+        case parquet::TIMESTAMP_MICROS:
+        case parquet::TIME_MICROS:
+          return decode_stats_literals<int64_t>(min_blob, max_blob, min, max, 1000);
+        default: return decode_stats_literals<int64_t>(min_blob, max_blob, min, max);
+      }
+    case parquet::FLOAT: return decode_stats_literals<float>(min_blob, max_blob, min, max);
+    case parquet::DOUBLE: return decode_stats_literals<double>(min_blob, max_blob, min, max);
+    case parquet::BYTE_ARRAY:
+    case parquet::FIXED_LEN_BYTE_ARRAY:
+      min.kind    = literal_kind::STRING;
+      min.str_val = std::string(min_blob.cbegin(), min_blob.cend());
+      max.kind    = literal_kind::STRING;
+      max.str_val = std::string(max_blob.cbegin(), max_blob.cend());
+      return;
+    default: return;
+  }
+}
+
+/**
+ * @brief Determines whether a column chunk may contain values satisfying a predicate
+ *
+ * Returns `true` whenever the chunk statistics are missing or cannot be interpreted.
+ */
+bool chunk_may_satisfy(host_predicate const &pred,
+                       SchemaElement const &schema,
+                       ColumnChunkMetaData const &meta)
+{
+  if (meta.statistics_blob.empty()) return true;
+  Statistics stats;
+  CompactProtocolReader cp(meta.statistics_blob.data(), meta.statistics_blob.size());
+  if (!cp.read(&stats)) return true;
+
+  if (!null_count_may_satisfy(pred.op, stats.null_count, meta.num_values)) return false;
+  if (pred.op == filter_op::IS_NULL || pred.op == filter_op::IS_NOT_NULL) return true;
+
+  auto const is_unsigned = schema.converted_type == parquet::UINT_8 ||
+                           schema.converted_type == parquet::UINT_16 ||
+                           schema.converted_type == parquet::UINT_32 ||
+                           schema.converted_type == parquet::UINT_64;
+  auto const is_bytes =
+    schema.type == parquet::BYTE_ARRAY || schema.type == parquet::FIXED_LEN_BYTE_ARRAY;
+
+  // The deprecated min/max fields are in signed order and only usable for signed types
+  auto const has_minmax = !stats.min_value.empty() && !stats.max_value.empty();
+  if (!has_minmax && (is_unsigned || is_bytes || stats.min.empty() || stats.max.empty())) {
+    return true;
+  }
+  auto const &min_blob = has_minmax ? stats.min_value : stats.min;
+  auto const &max_blob = has_minmax ? stats.max_value : stats.max;
+
+  return stats_may_satisfy(pred, schema, min_blob, max_blob);
+}
+
+/**
+ * @brief Determines whether any page of a column chunk may contain values satisfying a predicate
+ *
+ * Evaluates the per-page statistics of the chunk's ColumnIndex. Returns `true` whenever the index
+ * is inconsistent or cannot be interpreted.
+ */
+bool column_index_may_satisfy(host_predicate const &pred,
+                              SchemaElement const &schema,
+                              ColumnIndex const &index)
+{
+  auto const num_pages = index.null_pages.size();
+  if (num_pages == 0 || index.min_values.size() != num_pages ||
+      index.max_values.size() != num_pages) {
+    return true;
+  }
+
+  switch (pred.op) {
+    case filter_op::IS_NULL:
+      if (index.null_counts.size() != num_pages) return true;
+      return std::any_of(
+        index.null_counts.cbegin(), index.null_counts.cend(), [](auto n) { return n != 0; });
+    case filter_op::IS_NOT_NULL:
+      return std::any_of(index.null_pages.cbegin(), index.null_pages.cend(), [](bool all_nulls) {
+        return !all_nulls;
+      });
+    default:
+      for (size_t i = 0; i < num_pages; ++i) {
+        if (index.null_pages[i]) continue;
+        if (stats_may_satisfy(pred, schema, index.min_values[i], index.max_values[i])) {
+          return true;
+        }
+      }
+      return false;
+  }
+}
+
+/**
+ * @brief Reads and parses a page index structure stored at a given location of a source
+ *
+ * @return `false` if the structure is absent or cannot be parsed
+ */
+template <typename T>
+bool read_page_index(datasource *source, int64_t offset, int32_t length, T &index)
+{
+  if (offset <= 0 || length <= 0 || static_cast<size_t>(offset + length) > source->size()) {
+    return false;
+  }
+  auto const buffer = source->host_read(offset, length);
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  return cp.read(&index);
+}
+
+/**
+ * @brief Returns the plain encoding of the literal of an equality predicate, as hashed in the
+ * bloom filters of a column
+ *
+ * @return `false` if the literal has no exact plain encoding in the column
+ */
+bool bloom_filter_literal(host_predicate const &pred,
+                          SchemaElement const &schema,
+                          std::string &bytes)
+{
+  auto const to_bytes = [&bytes](auto value) {
+    bytes.assign(reinterpret_cast<char const *>(&value), sizeof(value));
+    return true;
+  };
+  // Small unsigned values may be written sign-extended, and decimals are not interpreted here
+  if (schema.converted_type == parquet::UINT_8 || schema.converted_type == parquet::UINT_16 ||
+      schema.converted_type == parquet::DECIMAL) {
+    return false;
+  }
+
+  switch (schema.type) {
+    case parquet::INT32:
+    case parquet::INT64: {
+      int64_t ns_per_tick = 0;
+      switch (schema.converted_type) {
+        case parquet::DATE: ns_per_tick = 86400000000000ll; break;
+        case parquet::TIME_MILLIS:
+        case parquet::TIMESTAMP_MILLIS: ns_per_tick = 1000000; break;
+        case parquet::TIME_MICROS:
+        case parquet::TIMESTAMP_MICROS: ns_per_tick = 1000; break;
+        default: break;
+      }
+      auto const is_unsigned =
+        schema.converted_type == parquet::UINT_32 || schema.converted_type == parquet::UINT_64;
+      int64_t lo, hi;
+      if (!literal_bounds(pred.value, ns_per_tick, lo, hi) || lo != hi || (is_unsigned && lo < 0)) {
+        return false;
+      }
+      if (schema.type == parquet::INT64) { return to_bytes(lo); }
+      // Unsigned 32-bit values are stored as their bit pattern
+      auto const min = is_unsigned ? int64_t{0} : int64_t{std::numeric_limits<int32_t>::min()};
+      auto const max = is_unsigned ? int64_t{std::numeric_limits<uint32_t>::max()}
+                                   : int64_t{std::numeric_limits<int32_t>::max()};
+      if (lo < min || lo > max) { return false; }
+      return to_bytes(static_cast<uint32_t>(lo));
+    }
+    case parquet::FLOAT:
+    case parquet::DOUBLE: {
+      // Zero is left out, as -0.0 and 0.0 are equal but hashed differently
+      double lo, hi;
+      if (!literal_bounds(pred.value, lo, hi) || lo == 0) { return false; }
+      if (schema.type == parquet::DOUBLE) { return to_bytes(lo); }
+      if (static_cast<double>(static_cast<float>(lo)) != lo) { return false; }
+      return to_bytes(static_cast<float>(lo));
+    }
+    case parquet::BYTE_ARRAY: {
+      std::string lo, hi;
+      if (!literal_bounds(pred.value, lo, hi)) { return false; }
+      bytes = std::move(lo);
+      return true;
+    }
+    default: return false;
+  }
+}
+
+/**
+ * @brief Determines whether the split block bloom filter of a column chunk may contain a value
+ *
+ * Returns `true` when the chunk has no bloom filter, or when it cannot be read.
+ *
+ * @param source Source of the column chunk
+ * @param meta Metadata of the column chunk
+ * @param value Plain encoding of the value
+ */
+bool bloom_filter_may_contain(datasource *source,
+                              ColumnChunkMetaData const &meta,
+                              std::string const &value)
+{
+  auto const offset = meta.bloom_filter_offset;
+  if (offset <= 0 || static_cast<size_t>(offset) >= source->size()) { return true; }
+
+  // Without the length of the bloom filter, the header is read first, then the bitset
+  constexpr size_t max_header_size = 64;
+  auto const available             = source->size() - offset;
+  auto buffer                      = source->host_read(
+    offset,
+    (meta.bloom_filter_length > 0) ? std::min<size_t>(meta.bloom_filter_length, available)
+                                   : std::min(max_header_size, available));
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  BloomFilterHeader header;
+  if (!cp.read(&header) || header.num_bytes <= 0 ||
+      header.num_bytes % gpu::kBloomFilterBlockSize != 0) {
+    return true;
+  }
+  auto const header_size = static_cast<size_t>(cp.bytecount());
+  auto const num_bytes   = static_cast<size_t>(header.num_bytes);
+  if (header_size + num_bytes > available) { return true; }
+  uint8_t const *bitset = buffer->data() + header_size;
+  if (buffer->size() < header_size + num_bytes) {
+    buffer = source->host_read(offset + header_size, num_bytes);
+    bitset = buffer->data();
+  }
+
+  auto const hash =
+    gpu::bloom_filter_hash(reinterpret_cast<uint8_t const *>(value.data()), value.size());
+  auto const block =
+    bitset + gpu::bloom_filter_block(hash, num_bytes / gpu::kBloomFilterBlockSize) *
+               gpu::kBloomFilterBlockSize;
+  for (int i = 0; i < 8; ++i) {
+    uint32_t word;
+    memcpy(&word, block + i * sizeof(uint32_t), sizeof(uint32_t));
+    if ((word & gpu::bloom_filter_mask(hash, i)) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief File ranges and rows of the data pages of a column chunk that cover a row window
+ */
+struct page_selection {
+  size_t dict_offset = 0;  // File offset of the pages preceding the first data page
+  size_t dict_size   = 0;  // Size of the pages preceding the first data page
+  size_t data_offset = 0;  // File offset of the first selected data page
+  size_t data_size   = 0;  // Size of the selected data pages
+  int64_t first_row  = 0;  // First row of the selected pages, relative to the row group
+  int64_t end_row    = 0;  // Row after the last row of the selected pages
+};
+
+/**
+ * @brief Selects the contiguous run of data pages that covers a window of rows of a row group
+ *
+ * @param index Offset index of the column chunk
+ * @param chunk_offset File offset of the column chunk
+ * @param chunk_size Size of the column chunk, in bytes
+ * @param num_rows Number of rows in the row group
+ * @param row_begin First row of the window, relative to the row group
+ * @param row_end Row after the last row of the window
+ * @param[out] selection Selected pages
+ *
+ * @return `false` if all pages are needed or if the index is inconsistent with the chunk
+ */
+bool select_pages(OffsetIndex const &index,
+                  size_t chunk_offset,
+                  size_t chunk_size,
+                  int64_t num_rows,
+                  int64_t row_begin,
+                  int64_t row_end,
+                  page_selection &selection)
+{
+  auto const &locations = index.page_locations;
+  if (locations.empty() || locations[0].first_row_index != 0) return false;
+  for (size_t i = 0; i < locations.size(); ++i) {
+    auto const &loc     = locations[i];
+    auto const page_end = static_cast<size_t>(loc.offset + loc.compressed_page_size);
+    if (loc.offset < static_cast<int64_t>(chunk_offset) || loc.compressed_page_size <= 0 ||
+        page_end > chunk_offset + chunk_size || loc.first_row_index >= num_rows) {
+      return false;
+    }
+    if (i > 0 && (loc.offset < locations[i - 1].offset ||
+                  loc.first_row_index <= locations[i - 1].first_row_index)) {
+      return false;
+    }
+  }
+
+  size_t first = 0;
+  while (first + 1 < locations.size() && locations[first + 1].first_row_index <= row_begin) {
+    ++first;
+  }
+  size_t last = first;
+  while (last + 1 < locations.size() && locations[last + 1].first_row_index < row_end) { ++last; }
+  if (first == 0 && last + 1 == locations.size()) return false;
+
+  selection.dict_offset = chunk_offset;
+  selection.dict_size   = locations[0].offset - chunk_offset;
+  selection.data_offset = locations[first].offset;
+  selection.data_size =
+    locations[last].offset + locations[last].compressed_page_size - locations[first].offset;
+  selection.first_row = locations[first].first_row_index;
+  selection.end_row =
+    (last + 1 < locations.size()) ? locations[last + 1].first_row_index : num_rows;
+  return true;
+}
+
+/**
+ * @brief Returns the metadata cache key of each file, or an empty vector if the cache is disabled
+ */
+std::vector<std::string> cache_keys(std::vector<std::string> const &filepaths)
+{
+  if (metadata_cache::get().capacity() == 0) { return {}; }
+  std::vector<std::string> keys;
+  keys.reserve(filepaths.size());
+  for (auto const &path : filepaths) { keys.emplace_back(file_cache_key("parquet", path)); }
+  return keys;
+}
+
+/**
+ * @brief Copies the string dictionary entries of all the column chunks of an output column
+ */
+rmm::device_vector<thrust::pair<const char *, size_type>> column_dictionary_entries(
+  hostdevice_vector<gpu::ColumnChunkDesc> const &chunks,
+  hostdevice_vector<gpu::PageInfo> const &pages,
+  rmm::device_vector<gpu::nvstrdesc_s> const &str_dict_index,
+  int32_t col_index,
+  cudaStream_t stream)
+{
+  // NOTE: Assumes first page in the chunk is always the dictionary page
+  std::vector<std::pair<gpu::nvstrdesc_s const *, size_t>> ranges;
+  size_t num_entries = 0;
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    if (chunks[c].dst_col_index == col_index && chunks[c].str_dict_index != nullptr) {
+      ranges.emplace_back(chunks[c].str_dict_index, pages[page_count].num_input_values);
+      num_entries += ranges.back().second;
+    }
+    page_count += chunks[c].max_num_pages;
+  }
+
+  rmm::device_vector<thrust::pair<const char *, size_type>> entries(num_entries);
+  size_t offset = 0;
+  for (auto const &range : ranges) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      range.first,
+                      range.first + range.second,
+                      entries.begin() + offset,
+                      [] __device__(gpu::nvstrdesc_s const &entry) {
+                        return thrust::make_pair(entry.ptr, static_cast<size_type>(entry.count));
+                      });
+    offset += range.second;
+  }
+  return entries;
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string> &path_in_schema)
@@ -205,8 +735,20 @@ std::string name_from_path(const std::vector<std::string> &path_in_schema)
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
-  explicit metadata(datasource *source)
+  metadata() = default;
+  /**
+   * @brief Parses the footer of a source, or copies it from the metadata cache if `cache_key` is
+   * the key of a previously parsed file
+   */
+  metadata(datasource *source, std::string const &cache_key)
   {
+    if (!cache_key.empty()) {
+      if (auto const cached = metadata_cache::get().find<metadata>(cache_key)) {
+        *this = *cached;
+        return;
+      }
+    }
+
     constexpr auto header_len = sizeof(file_header_s);
     constexpr auto ender_len  = sizeof(file_ender_s);
 
@@ -225,6 +767,11 @@ struct metadata : public FileMetaData {
     CompactProtocolReader cp(buffer->data(), ender->footer_len);
     CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
     CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+
+    if (!cache_key.empty()) {
+      metadata_cache::get().insert(
+        cache_key, std::make_shared<metadata const>(*this), ender->footer_len);
+    }
   }
 };
 
@@ -236,14 +783,18 @@ class aggregate_metadata {
   std::vector<std::string> const column_names;
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * The footers of separate sources are read and parsed concurrently. `cache_keys` is either
+   * empty or holds the metadata cache key of each source.
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources)
+  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources,
+                              std::vector<std::string> const &cache_keys)
   {
-    std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const &source) {
-        return metadata(source.get());
-      });
+    std::vector<metadata> metadatas(sources.size());
+    host_parallel_for(sources.size(), default_host_threads(), [&](size_t src_idx, size_t) {
+      auto const &key    = cache_keys.empty() ? std::string{} : cache_keys[src_idx];
+      metadatas[src_idx] = metadata(sources[src_idx].get(), key);
+    });
     return metadatas;
   }
 
@@ -296,8 +847,9 @@ class aggregate_metadata {
   }
 
  public:
-  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources,
+                     std::vector<std::string> const &cache_keys)
+    : per_file_metadata(metadatas_from_sources(sources, cache_keys)),
       agg_keyval_map(merge_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups()),
@@ -438,6 +990,183 @@ class aggregate_metadata {
     }
   };
 
+  /**
+   * @brief Splits the dataset into ranges of rows that can each be read within a memory budget
+   *
+   * @param columns Columns that are read
+   * @param byte_limit Approximate upper bound of the device memory used to read each range; `0`
+   * for no limit
+   * @param row_limit Maximum number of rows in each range; `0` for no limit
+   *
+   * @return List of (skip_rows, num_rows) pairs covering the dataset in order
+   */
+  std::vector<std::pair<size_type, size_type>> chunk_row_ranges(
+    std::vector<std::pair<int, std::string>> const &columns,
+    size_t byte_limit,
+    size_type row_limit) const
+  {
+    auto const max_bytes = (byte_limit != 0) ? byte_limit : std::numeric_limits<size_t>::max();
+    auto const max_rows  = (row_limit != 0) ? row_limit : std::numeric_limits<size_type>::max();
+
+    std::vector<std::pair<size_type, size_type>> ranges;
+    size_type range_start = 0;
+    size_type range_rows  = 0;
+    size_t range_bytes    = 0;
+    size_type row         = 0;
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx].row_groups.size(); ++rg_idx) {
+        auto const &row_group = get_row_group(rg_idx, src_idx);
+        auto const rg_rows    = static_cast<size_type>(row_group.num_rows);
+
+        // Compressed pages, decompressed pages and decoded columns are alive at the same time
+        size_t rg_bytes = 0;
+        for (auto const &col : columns) {
+          auto const &col_meta = row_group.columns[col.first].meta_data;
+          if (col_meta.codec != Compression::UNCOMPRESSED) {
+            rg_bytes += col_meta.total_compressed_size;
+          }
+          rg_bytes += 2 * col_meta.total_uncompressed_size;
+        }
+
+        if (range_rows != 0 &&
+            (range_bytes + rg_bytes > max_bytes || rg_rows > max_rows - range_rows)) {
+          ranges.emplace_back(range_start, range_rows);
+          range_start = row;
+          range_rows  = 0;
+          range_bytes = 0;
+        }
+        if ((rg_bytes > max_bytes || rg_rows > max_rows) && rg_rows > 1) {
+          // Split the row group; with a page index, each range only reads its overlapping pages
+          auto const num_pieces =
+            std::min<size_t>(std::max(cudf::util::div_rounding_up_safe(rg_bytes, max_bytes),
+                                      cudf::util::div_rounding_up_safe<size_t>(rg_rows, max_rows)),
+                             rg_rows);
+          auto const piece_rows = static_cast<size_type>((rg_rows + num_pieces - 1) / num_pieces);
+          for (size_type r = 0; r < rg_rows; r += piece_rows) {
+            ranges.emplace_back(row + r, std::min(piece_rows, rg_rows - r));
+          }
+          range_start = row + rg_rows;
+        } else {
+          range_rows += rg_rows;
+          range_bytes += rg_bytes;
+        }
+        row += rg_rows;
+      }
+    }
+    // Always return a range so that an empty dataset still produces the columns
+    if (range_rows != 0 || ranges.empty()) { ranges.emplace_back(range_start, range_rows); }
+
+    return ranges;
+  }
+
+  /**
+   * @brief Returns upper bounds on the device memory of reading all the row groups, from the
+   * sizes recorded in the footers
+   *
+   * The compressed and decompressed pages of all the row groups are alive while the columns are
+   * decoded. Fixed-width values are counted as 8 bytes, the widest type they are decoded to.
+   * Every list level of a column has at most one row per leaf value. The characters of strings
+   * columns are bounded by their plain encoding, or by the size limit of a column for
+   * dictionary-encoded chunks, whose expanded size is not recorded.
+   *
+   * @param columns Columns that are read
+   * @param strings_to_dictionary Whether dictionary-encoded strings are returned as DICTIONARY32
+   * columns, whose keys are the dictionaries
+   */
+  memory_estimate estimate_read_memory(std::vector<std::pair<int, std::string>> const &columns,
+                                       bool strings_to_dictionary) const
+  {
+    using cudf::detail::allocation_size;
+    memory_estimate estimate;
+    for (auto const &col : columns) {
+      size_t num_values           = 0;
+      size_t num_chars            = 0;
+      bool has_dictionary_strings = false;
+      for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+        for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx].row_groups.size(); ++rg_idx) {
+          auto const &col_meta = get_row_group(rg_idx, src_idx).columns[col.first].meta_data;
+          if (col_meta.codec != Compression::UNCOMPRESSED) {
+            estimate.temporary_bytes += allocation_size(col_meta.total_compressed_size);
+          }
+          estimate.temporary_bytes += allocation_size(col_meta.total_uncompressed_size);
+          num_values += col_meta.num_values;
+          num_chars += col_meta.total_uncompressed_size;
+          has_dictionary_strings |=
+            col_meta.type == BYTE_ARRAY &&
+            std::any_of(col_meta.encodings.begin(), col_meta.encodings.end(), [](auto e) {
+              return e == Encoding::PLAIN_DICTIONARY || e == Encoding::RLE_DICTIONARY;
+            });
+        }
+      }
+
+      auto const &pfm = per_file_metadata[0];
+      auto const null_mask_size =
+        allocation_size(bitmask_allocation_size_bytes(static_cast<size_type>(num_values)));
+      auto const offsets_size = allocation_size((num_values + 1) * sizeof(size_type));
+      for (int index = get_column_leaf_schema_index(col.first); index > 0;
+           index = pfm.schema[index].parent_idx) {
+        estimate.output_bytes +=
+          (pfm.schema[index].repetition_type == REPEATED) ? offsets_size : null_mask_size;
+      }
+      if (get_column_leaf_schema(col.first).type != BYTE_ARRAY) {
+        estimate.output_bytes += allocation_size(num_values * sizeof(int64_t));
+        continue;
+      }
+      // The string pointer and length of every value, from which the column is made
+      estimate.temporary_bytes += allocation_size(num_values * sizeof(gpu::nvstrdesc_s));
+      if (has_dictionary_strings && !strings_to_dictionary) {
+        num_chars = std::numeric_limits<size_type>::max();
+      }
+      estimate.output_bytes += offsets_size + allocation_size(num_chars);
+    }
+    return estimate;
+  }
+
+  /**
+   * @brief Combines the footer statistics of all the row groups of the selected columns
+   *
+   * @param columns Selected columns
+   * @param types Output types of the selected columns, used for the min/max scalars
+   * @param mr Device memory resource used to allocate the min/max scalars
+   * @param stream CUDA stream used to initialize the min/max scalars
+   *
+   * @return The statistics of every selected column
+   */
+  std::vector<column_statistics> read_statistics(
+    std::vector<std::pair<int, std::string>> const &columns,
+    std::vector<data_type> const &types,
+    rmm::mr::device_memory_resource *mr,
+    cudaStream_t stream) const
+  {
+    std::vector<column_statistics> result;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      column_statistics_builder builder;
+      for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+        for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx].row_groups.size(); ++rg_idx) {
+          auto const &row_group = get_row_group(rg_idx, src_idx);
+          auto const &chunk     = row_group.columns[columns[i].first];
+          auto const &blob      = chunk.meta_data.statistics_blob;
+
+          int64_t null_count     = -1;
+          int64_t distinct_count = -1;
+          predicate_literal min, max;
+          // Statistics of list columns describe the leaf values rather than the rows
+          Statistics stats;
+          CompactProtocolReader cp(blob.data(), blob.size());
+          if (chunk.schema_idx == chunk.leaf_schema_idx && !blob.empty() && cp.read(&stats)) {
+            null_count     = stats.null_count;
+            distinct_count = stats.distinct_count;
+            decode_chunk_minmax(
+              per_file_metadata[src_idx].schema[chunk.leaf_schema_idx], stats, min, max);
+          }
+          builder.add(row_group.num_rows, null_count, min, max, distinct_count);
+        }
+      }
+      result.push_back(builder.build(types[i], mr, stream));
+    }
+    return result;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
@@ -495,6 +1224,82 @@ class aggregate_metadata {
     return selection;
   }
 
+  /**
+   * @brief Filters row groups down to the ones whose statistics may satisfy all predicates
+   *
+   * Row groups that pass the chunk-level statistics are also checked against the per-page
+   * statistics of the ColumnIndex when the file has a page index, and against the bloom filters
+   * of their column chunks for equality predicates.
+   *
+   * @param sources Dataset sources, used to read the page indexes and bloom filters
+   * @param predicates Host-side predicates to evaluate
+   * @param row_groups Lists of row groups to consider, one per source; all row groups if empty
+   *
+   * @return Lists of row groups that may contain matching rows, one per source
+   */
+  std::vector<std::vector<size_type>> filter_row_groups(
+    std::vector<std::unique_ptr<datasource>> const &sources,
+    std::vector<host_predicate> const &predicates,
+    std::vector<std::vector<size_type>> const &row_groups) const
+  {
+    CUDF_EXPECTS(row_groups.empty() || row_groups.size() == per_file_metadata.size(),
+                 "Must specify row groups for each source");
+
+    // Resolve the column referenced by each predicate
+    std::vector<size_t> pred_columns;
+    for (auto const &pred : predicates) {
+      auto const it = std::find(column_names.cbegin(), column_names.cend(), pred.column_name);
+      CUDF_EXPECTS(it != column_names.cend(), "Predicate column not found");
+      pred_columns.push_back(std::distance(column_names.cbegin(), it));
+    }
+
+    std::vector<std::vector<size_type>> selection(per_file_metadata.size());
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      auto const &pfm       = per_file_metadata[src_idx];
+      auto const num_groups = static_cast<size_type>(pfm.row_groups.size());
+      auto const may_match  = [&](size_type rg_idx) {
+        // Leave out-of-range indices to be reported by select_row_groups
+        if (rg_idx < 0 || rg_idx >= num_groups) return true;
+        auto const &row_group = pfm.row_groups[rg_idx];
+        for (size_t p = 0; p < predicates.size(); ++p) {
+          auto const &chunk = row_group.columns[pred_columns[p]];
+          // Statistics of list columns describe the leaf values rather than the rows
+          if (chunk.schema_idx != chunk.leaf_schema_idx) { continue; }
+          auto const &schema = pfm.schema[chunk.leaf_schema_idx];
+          if (!chunk_may_satisfy(predicates[p], schema, chunk.meta_data)) { return false; }
+          ColumnIndex index;
+          if (read_page_index(sources[src_idx].get(),
+                              chunk.column_index_offset,
+                              chunk.column_index_length,
+                              index) &&
+              !column_index_may_satisfy(predicates[p], schema, index)) {
+            return false;
+          }
+          std::string value;
+          if (predicates[p].op == filter_op::EQUAL &&
+              bloom_filter_literal(predicates[p], schema, value) &&
+              !bloom_filter_may_contain(sources[src_idx].get(), chunk.meta_data, value)) {
+            return false;
+          }
+        }
+        return true;
+      };
+
+      if (row_groups.empty()) {
+        for (size_type rg_idx = 0; rg_idx < num_groups; ++rg_idx) {
+          if (may_match(rg_idx)) { selection[src_idx].push_back(rg_idx); }
+        }
+      } else {
+        std::copy_if(row_groups[src_idx].cbegin(),
+                     row_groups[src_idx].cend(),
+                     std::back_inserter(selection[src_idx]),
+                     may_match);
+      }
+    }
+
+    return selection;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
@@ -535,20 +1340,38 @@ void reader::impl::read_column_chunks(
   size_t begin_chunk,
   size_t end_chunk,
   const std::vector<size_t> &column_chunk_offsets,
+  std::vector<std::pair<size_t, size_t>> const &column_chunk_dict_ranges,
   std::vector<size_type> const &chunk_source_map,
   cudaStream_t stream)
 {
+  // Ranges to transfer from each source; buffers are allocated up front on the calling thread
+  std::vector<std::vector<device_read_pipeline::range>> source_reads(_sources.size());
+
   // Transfer chunk data, coalescing adjacent chunks
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
-    const size_t io_offset   = column_chunk_offsets[chunk];
-    size_t io_size           = chunks[chunk].compressed_size;
-    size_t next_chunk        = chunk + 1;
+    const size_t io_offset = column_chunk_offsets[chunk];
+    size_t io_size         = chunks[chunk].compressed_size;
+    size_t next_chunk      = chunk + 1;
+    const auto &dict_range = column_chunk_dict_ranges[chunk];
+    if (dict_range.second != 0) {
+      // Only some of the data pages are read: the pages preceding them come from a separate range
+      auto &reads         = source_reads[chunk_source_map[chunk]];
+      page_data[chunk]    = rmm::device_buffer(io_size, stream, _scratch_mr);
+      uint8_t *d_compdata = reinterpret_cast<uint8_t *>(page_data[chunk].data());
+      reads.push_back({dict_range.first, dict_range.second, d_compdata});
+      reads.push_back({io_offset, io_size - dict_range.second, d_compdata + dict_range.second});
+      chunks[chunk].compressed_data = d_compdata;
+      chunk                         = next_chunk;
+      continue;
+    }
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
     while (next_chunk < end_chunk) {
       const size_t next_offset = column_chunk_offsets[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (column_chunk_dict_ranges[next_chunk].second != 0 ||
+          chunk_source_map[next_chunk] != chunk_source_map[chunk] ||
+          next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
@@ -558,9 +1381,9 @@ void reader::impl::read_column_chunks(
       next_chunk++;
     }
     if (io_size != 0) {
-      auto buffer         = _sources[chunk_source_map[chunk]]->host_read(io_offset, io_size);
-      page_data[chunk]    = rmm::device_buffer(buffer->data(), buffer->size(), stream);
+      page_data[chunk]    = rmm::device_buffer(io_size, stream, _scratch_mr);
       uint8_t *d_compdata = reinterpret_cast<uint8_t *>(page_data[chunk].data());
+      source_reads[chunk_source_map[chunk]].push_back({io_offset, io_size, d_compdata});
       do {
         chunks[chunk].compressed_data = d_compdata;
         d_compdata += chunks[chunk].compressed_size;
@@ -569,6 +1392,30 @@ void reader::impl::read_column_chunks(
       chunk = next_chunk;
     }
   }
+
+  // Read separate sources concurrently, each thread overlapping its reads with the transfers
+  std::vector<size_t> read_sources;
+  size_t read_size = 0;
+  for (size_t src_idx = 0; src_idx < source_reads.size(); ++src_idx) {
+    if (!source_reads[src_idx].empty()) { read_sources.push_back(src_idx); }
+    for (auto const &read : source_reads[src_idx]) { read_size += read.size; }
+  }
+  CUDF_SCOPED_RANGE_PAYLOAD("parquet::read_column_chunks", read_size);
+  auto const num_threads = std::min(read_sources.size(), default_host_threads());
+  auto const staging_size =
+    (num_threads > 1) ? device_read_pipeline::default_staging_size / 4
+                      : device_read_pipeline::default_staging_size;
+  std::vector<std::unique_ptr<device_read_pipeline>> pipelines(num_threads);
+  host_parallel_for(read_sources.size(), num_threads, [&](size_t task, size_t worker) {
+    if (!pipelines[worker]) {
+      pipelines[worker] = std::make_unique<device_read_pipeline>(stream, staging_size);
+    }
+    // Batched so that the source can coalesce and overlap the requests for separate chunks
+    pipelines[worker]->read(_sources[read_sources[task]].get(), source_reads[read_sources[task]]);
+  });
+  for (auto &pipeline : pipelines) {
+    if (pipeline) { pipeline->sync(); }
+  }
 }
 
 /**
@@ -577,6 +1424,7 @@ void reader::impl::read_column_chunks(
 size_t reader::impl::count_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
                                         cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE("parquet::count_page_headers");
   size_t total_pages = 0;
 
   chunks.host_to_device(stream);
@@ -597,6 +1445,7 @@ void reader::impl::decode_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &
                                        hostdevice_vector<gpu::PageInfo> &pages,
                                        cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("parquet::decode_page_headers", pages.size());
   // IMPORTANT : if you change how pages are stored within a chunk (dist pages, then data pages),
   // please update preprocess_nested_columns to reflect this.
   for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
@@ -613,11 +1462,21 @@ void reader::impl::decode_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &
 /**
  * @copydoc cudf::io::detail::parquet::decompress_page_data
  */
-rmm::device_buffer reader::impl::decompress_page_data(
-  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-  hostdevice_vector<gpu::PageInfo> &pages,
-  cudaStream_t stream)
+void reader::impl::decompress_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                        hostdevice_vector<gpu::PageInfo> &pages,
+                                        rmm::device_buffer &decomp_pages,
+                                        cudaStream_t stream)
 {
+  // V2 data pages only compress their values, and may not be compressed at all
+  auto is_page_compressed = [&](size_t page) {
+    return !(pages[page].flags & gpu::PAGEINFO_FLAGS_UNCOMPRESSED);
+  };
+  auto levels_size = [&](size_t page) {
+    return (pages[page].flags & gpu::PAGEINFO_FLAGS_V2)
+             ? pages[page].lvl_bytes[gpu::level_type::DEFINITION] +
+                 pages[page].lvl_bytes[gpu::level_type::REPETITION]
+             : 0;
+  };
   auto for_each_codec_page = [&](parquet::Compression codec, const std::function<void(size_t)> &f) {
     for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
       const auto page_stride = chunks[c].max_num_pages;
@@ -629,52 +1488,82 @@ rmm::device_buffer reader::impl::decompress_page_data(
   };
 
   // Brotli scratch memory for decompressing
-  rmm::device_vector<uint8_t> debrotli_scratch;
+  rmm::device_buffer debrotli_scratch;
 
-  // Count the exact number of compressed pages
+  // Count the exact number of compressed pages, and of the pages or levels copied as they are
   size_t num_comp_pages    = 0;
+  size_t num_copies        = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
+  std::array<std::pair<parquet::Compression, size_t>, 4> codecs{std::make_pair(parquet::GZIP, 0),
                                                                 std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+                                                                std::make_pair(parquet::BROTLI, 0),
+                                                                std::make_pair(parquet::ZSTD, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
       total_decomp_size += pages[page].uncompressed_page_size;
-      codec.second++;
-      num_comp_pages++;
+      if (is_page_compressed(page)) {
+        codec.second++;
+        num_comp_pages++;
+      }
+      if (!is_page_compressed(page) || levels_size(page) != 0) { num_copies++; }
     });
     if (codec.first == parquet::BROTLI && codec.second > 0) {
-      debrotli_scratch.resize(get_gpu_debrotli_scratch_size(codec.second));
+      debrotli_scratch =
+        rmm::device_buffer(get_gpu_debrotli_scratch_size(codec.second), stream, _scratch_mr);
     }
   }
 
+  CUDF_SCOPED_RANGE_PAYLOAD("parquet::decompress_page_data", total_decomp_size);
+
   // Dispatch batches of pages to decompress for each codec
-  rmm::device_buffer decomp_pages(total_decomp_size, stream);
+  // Reuse the previous allocation when it is large enough
+  if (decomp_pages.capacity() < total_decomp_size) {
+    decomp_pages = rmm::device_buffer(total_decomp_size, stream, _scratch_mr);
+  } else {
+    decomp_pages.resize(total_decomp_size);
+  }
   hostdevice_vector<gpu_inflate_input_s> inflate_in(0, num_comp_pages, stream);
   hostdevice_vector<gpu_inflate_status_s> inflate_out(0, num_comp_pages, stream);
+  hostdevice_vector<gpu_inflate_input_s> copy_in(0, num_copies, stream);
 
   size_t decomp_offset = 0;
   int32_t argc         = 0;
   for (const auto &codec : codecs) {
-    if (codec.second > 0) {
+    if (codec.second > 0 || num_copies > 0) {
       int32_t start_pos = argc;
 
       for_each_codec_page(codec.first, [&](size_t page) {
-        auto dst_base              = static_cast<uint8_t *>(decomp_pages.data());
-        inflate_in[argc].srcDevice = pages[page].page_data;
-        inflate_in[argc].srcSize   = pages[page].compressed_page_size;
-        inflate_in[argc].dstDevice = dst_base + decomp_offset;
-        inflate_in[argc].dstSize   = pages[page].uncompressed_page_size;
-
-        inflate_out[argc].bytes_written = 0;
-        inflate_out[argc].status        = static_cast<uint32_t>(-1000);
-        inflate_out[argc].reserved      = 0;
-
-        pages[page].page_data = (uint8_t *)inflate_in[argc].dstDevice;
-        decomp_offset += inflate_in[argc].dstSize;
-        argc++;
+        auto dst_base       = static_cast<uint8_t *>(decomp_pages.data());
+        auto const lvl_size = levels_size(page);
+        auto const src      = pages[page].page_data;
+        auto const dst      = dst_base + decomp_offset;
+        auto const copy_size =
+          is_page_compressed(page) ? lvl_size : pages[page].compressed_page_size;
+        if (copy_size != 0) {
+          gpu_inflate_input_s copy;
+          copy.srcDevice = src;
+          copy.srcSize   = copy_size;
+          copy.dstDevice = dst;
+          copy.dstSize   = copy_size;
+          copy_in.insert(copy);
+        }
+        if (is_page_compressed(page)) {
+          inflate_in[argc].srcDevice = src + lvl_size;
+          inflate_in[argc].srcSize   = pages[page].compressed_page_size - lvl_size;
+          inflate_in[argc].dstDevice = dst + lvl_size;
+          inflate_in[argc].dstSize   = pages[page].uncompressed_page_size - lvl_size;
+
+          inflate_out[argc].bytes_written = 0;
+          inflate_out[argc].status        = static_cast<uint32_t>(-1000);
+          inflate_out[argc].reserved      = 0;
+          argc++;
+        }
+
+        pages[page].page_data = dst;
+        decomp_offset += pages[page].uncompressed_page_size;
       });
+      if (argc == start_pos) { continue; }
 
       CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(start_pos),
                                inflate_in.host_ptr(start_pos),
@@ -703,11 +1592,17 @@ rmm::device_buffer reader::impl::decompress_page_data(
         case parquet::BROTLI:
           CUDA_TRY(gpu_debrotli(inflate_in.device_ptr(start_pos),
                                 inflate_out.device_ptr(start_pos),
-                                debrotli_scratch.data().get(),
+                                debrotli_scratch.data(),
                                 debrotli_scratch.size(),
                                 argc - start_pos,
                                 stream));
           break;
+        case parquet::ZSTD:
+          CUDA_TRY(gpu_unzstd(inflate_in.device_ptr(start_pos),
+                              inflate_out.device_ptr(start_pos),
+                              argc - start_pos,
+                              stream));
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
@@ -717,14 +1612,59 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                stream));
     }
   }
+  // Copy the levels of V2 data pages, and their values when they are not compressed
+  if (copy_in.size() != 0) {
+    copy_in.host_to_device(stream);
+    CUDA_TRY(gpu_copy_uncompressed_blocks(copy_in.device_ptr(), copy_in.size(), stream));
+  }
   CUDA_TRY(cudaStreamSynchronize(stream));
 
   // Update the page information in device memory with the updated value of
   // page_data; it now points to the uncompressed data buffer
   CUDA_TRY(cudaMemcpyAsync(
     pages.device_ptr(), pages.host_ptr(), pages.memory_size(), cudaMemcpyHostToDevice, stream));
+}
 
-  return decomp_pages;
+/**
+ * @copydoc cudf::io::detail::parquet::convert_page_encodings
+ */
+void reader::impl::convert_page_encodings(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                          hostdevice_vector<gpu::PageInfo> &pages,
+                                          rmm::device_buffer &plain_pages,
+                                          cudaStream_t stream)
+{
+  auto const needs_conversion = std::any_of(
+    pages.host_ptr(), pages.host_ptr() + pages.size(), [](gpu::PageInfo const &page) {
+      return !(page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY) &&
+             (page.encoding == Encoding::DELTA_BINARY_PACKED ||
+              page.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY ||
+              page.encoding == Encoding::DELTA_BYTE_ARRAY ||
+              page.encoding == Encoding::BYTE_STREAM_SPLIT);
+    });
+  if (!needs_conversion) { return; }
+
+  CUDF_SCOPED_RANGE("parquet::convert_page_encodings");
+  hostdevice_vector<size_t> page_offsets(pages.size() + 1, stream);
+  CUDA_TRY(gpu::ComputePlainPageSizes(
+    pages.device_ptr(), pages.size(), chunks.device_ptr(), page_offsets.device_ptr(), stream));
+  page_offsets.device_to_host(stream, true);
+  size_t total_size = 0;
+  for (size_t i = 0; i < pages.size(); i++) {
+    auto const page_size = page_offsets[i];
+    page_offsets[i]      = total_size;
+    total_size += page_size;
+  }
+  page_offsets[pages.size()] = total_size;
+  page_offsets.host_to_device(stream);
+
+  plain_pages = rmm::device_buffer(total_size, stream, _scratch_mr);
+  CUDA_TRY(gpu::ConvertPagesToPlain(pages.device_ptr(),
+                                    pages.size(),
+                                    chunks.device_ptr(),
+                                    static_cast<uint8_t *>(plain_pages.data()),
+                                    page_offsets.device_ptr(),
+                                    stream));
+  pages.device_to_host(stream, true);
 }
 
 /**
@@ -860,6 +1800,7 @@ void reader::impl::preprocess_nested_columns(
   size_t total_rows,
   cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE("parquet::preprocess_nested_columns");
   // preprocess per-nesting level sizes by page
   CUDA_TRY(gpu::PreprocessColumnData(pages, chunks, nested_info, total_rows, min_row, stream));
 
@@ -875,8 +1816,13 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
                                     size_t min_row,
                                     size_t total_rows,
                                     std::vector<column_buffer> &out_buffers,
+                                    rmm::device_vector<gpu::nvstrdesc_s> &str_dict_index,
                                     cudaStream_t stream)
 {
+  size_t page_bytes = 0;
+  for (size_t p = 0; p < pages.size(); p++) { page_bytes += pages[p].uncompressed_page_size; }
+  CUDF_SCOPED_RANGE_PAYLOAD("parquet::decode_page_data", page_bytes);
+
   auto is_dict_chunk = [](const gpu::ColumnChunkDesc &chunk) {
     return (chunk.data_type & 0x7) == BYTE_ARRAY && chunk.num_dict_pages > 0;
   };
@@ -891,7 +1837,6 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
 
   // Build index for string dictionaries since they can't be indexed
   // directly due to variable-sized elements
-  rmm::device_vector<gpu::nvstrdesc_s> str_dict_index;
   if (total_str_dict_indexes > 0) { str_dict_index.resize(total_str_dict_indexes); }
 
   std::vector<hostdevice_vector<uint32_t *>> chunk_nested_valids;
@@ -987,13 +1932,113 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   }
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::read_and_decode_batches
+ */
+void reader::impl::read_and_decode_batches(
+  std::vector<rmm::device_buffer> &page_data,
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  std::vector<size_t> const &batch_offsets,
+  const std::vector<size_t> &column_chunk_offsets,
+  std::vector<std::pair<size_t, size_t>> const &column_chunk_dict_ranges,
+  std::vector<size_type> const &chunk_source_map,
+  size_t min_row,
+  size_t total_rows,
+  std::vector<column_buffer> &out_buffers,
+  std::vector<rmm::device_buffer> &decoded_page_data,
+  cudaStream_t stream)
+{
+  auto const num_batches = batch_offsets.size() - 1;
+  // Each read only touches the descriptors and buffers of the chunks of its batch
+  auto read_batch = [&](size_t batch) {
+    read_column_chunks(page_data,
+                       chunks,
+                       batch_offsets[batch],
+                       batch_offsets[batch + 1],
+                       column_chunk_offsets,
+                       column_chunk_dict_ranges,
+                       chunk_source_map,
+                       stream);
+    CUDA_TRY(cudaEventRecord(_read_done, stream));
+  };
+
+  auto pending_read = std::async(std::launch::async, read_batch, 0);
+  for (size_t batch = 0; batch < num_batches; ++batch) {
+    pending_read.get();
+    // Also orders the decoding after the allocation of the output buffers
+    CUDA_TRY(cudaStreamWaitEvent(_decode_stream, _read_done, 0));
+    if (batch + 1 < num_batches) {
+      pending_read = std::async(std::launch::async, read_batch, batch + 1);
+    }
+
+    auto const begin_chunk = batch_offsets[batch];
+    auto const end_chunk   = batch_offsets[batch + 1];
+    hostdevice_vector<gpu::ColumnChunkDesc> batch_chunks(
+      0, end_chunk - begin_chunk, _decode_stream);
+    for (auto c = begin_chunk; c < end_chunk; ++c) { batch_chunks.insert(chunks[c]); }
+
+    auto const total_pages = count_page_headers(batch_chunks, _decode_stream);
+    if (total_pages == 0) { continue; }
+    hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, _decode_stream);
+    decode_page_headers(batch_chunks, pages, _decode_stream);
+
+    auto const is_compressed = [](gpu::ColumnChunkDesc const &chunk) {
+      return chunk.codec != parquet::Compression::UNCOMPRESSED;
+    };
+    if (std::any_of(batch_chunks.host_ptr(),
+                    batch_chunks.host_ptr() + batch_chunks.size(),
+                    is_compressed)) {
+      decoded_page_data.emplace_back();
+      decompress_page_data(batch_chunks, pages, decoded_page_data.back(), _decode_stream);
+      // Free compressed data
+      for (auto c = begin_chunk; c < end_chunk; ++c) {
+        if (is_compressed(chunks[c]) && page_data[c].size() != 0) {
+          page_data[c].resize(0);
+          page_data[c].shrink_to_fit();
+        }
+      }
+    }
+
+    decoded_page_data.emplace_back();
+    convert_page_encodings(batch_chunks, pages, decoded_page_data.back(), _decode_stream);
+
+    // Flat columns have a single level of nesting
+    hostdevice_vector<gpu::PageNestingInfo> page_nesting_info;
+    std::vector<std::vector<std::pair<int, bool>>> col_nesting_info;
+    allocate_nesting_info(
+      batch_chunks, pages, page_nesting_info, col_nesting_info, out_buffers.size(), _decode_stream);
+
+    rmm::device_vector<gpu::nvstrdesc_s> str_dict_index;
+    decode_page_data(batch_chunks,
+                     pages,
+                     page_nesting_info,
+                     min_row,
+                     total_rows,
+                     out_buffers,
+                     str_dict_index,
+                     _decode_stream);
+  }
+
+  CUDA_TRY(cudaEventRecord(_decode_done, _decode_stream));
+  CUDA_TRY(cudaStreamWaitEvent(stream, _decode_done, 0));
+}
+
 reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                   std::vector<std::string> const &cache_keys,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _sources(std::move(sources)), _mr(mr)
 {
+  // Column chunks are read selectively, as located by the footer
+  for (auto const &source : _sources) {
+    source->advise_access_pattern(datasource::access_pattern::RANDOM);
+  }
+
   // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_metadata>(_sources);
+  {
+    CUDF_SCOPED_RANGE("parquet::read_footer");
+    _metadata = std::make_unique<aggregate_metadata>(_sources, cache_keys);
+  }
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.columns, options.use_pandas_metadata);
@@ -1003,28 +2048,91 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
 
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.strings_to_categorical;
+  _strings_to_dictionary  = options.strings_to_dictionary;
+
+  // Decimals may be returned as fixed_point columns instead of float64
+  _decimals_as_fixed_point = options.decimals_as_fixed_point;
+
+  // Predicates used to skip row groups
+  _filters = options.filters;
+
+  // Intermediate buffers may come from a resource the caller keeps across reads
+  if (options.scratch_mr != nullptr) { _scratch_mr = options.scratch_mr; }
+
+  CUDA_TRY(cudaStreamCreateWithFlags(&_decode_stream, cudaStreamNonBlocking));
+  CUDA_TRY(cudaEventCreateWithFlags(&_read_done, cudaEventDisableTiming));
+  CUDA_TRY(cudaEventCreateWithFlags(&_decode_done, cudaEventDisableTiming));
+}
+
+reader::impl::~impl()
+{
+  cudaEventDestroy(_decode_done);
+  cudaEventDestroy(_read_done);
+  cudaStreamDestroy(_decode_stream);
+}
+
+std::vector<std::pair<size_type, size_type>> reader::impl::get_chunk_row_ranges(
+  size_t byte_limit, size_type row_limit) const
+{
+  return _metadata->chunk_row_ranges(_selected_columns, byte_limit, row_limit);
+}
+
+memory_estimate reader::impl::estimate_read_memory() const
+{
+  return _metadata->estimate_read_memory(_selected_columns, _strings_to_dictionary);
+}
+
+std::vector<column_statistics> reader::impl::read_statistics(cudaStream_t stream) const
+{
+  std::vector<data_type> column_types;
+  for (auto const &col : _selected_columns) {
+    column_types.emplace_back(to_type_id(_metadata->get_column_schema(col.first),
+                                         _strings_to_categorical,
+                                         _timestamp_type.id(),
+                                         _decimals_as_fixed_point));
+  }
+  return _metadata->read_statistics(_selected_columns, column_types, _mr, stream);
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
                                        size_type num_rows,
                                        std::vector<std::vector<size_type>> const &row_group_list,
+                                       bool keep_scratch,
                                        cudaStream_t stream)
 {
+  // Skip row groups whose statistics show they cannot contain matching rows
+  std::vector<std::vector<size_type>> filtered_row_groups;
+  if (!_filters.empty()) {
+    CUDF_EXPECTS(skip_rows <= 0 && num_rows < 0,
+                 "Row group filters cannot be combined with a row range");
+    filtered_row_groups = _metadata->filter_row_groups(
+      _sources, make_host_predicates(_filters, stream), row_group_list);
+  }
+  auto const &row_groups = _filters.empty() ? row_group_list : filtered_row_groups;
+
   // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  const auto selected_row_groups = _metadata->select_row_groups(row_groups, skip_rows, num_rows);
 
   // Get a list of column data types
   std::vector<data_type> column_types;
   if (_metadata->get_num_row_groups() != 0) {
     for (const auto &col : _selected_columns) {
       auto &col_schema = _metadata->get_column_schema(col.first);
-      auto col_type    = to_type_id(col_schema, _strings_to_categorical, _timestamp_type.id());
+      auto col_type    = to_type_id(col_schema,
+                                    _strings_to_categorical,
+                                    _timestamp_type.id(),
+                                    _decimals_as_fixed_point);
       CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
       column_types.emplace_back(col_type);
     }
   }
 
+  // Flat string columns may be returned as dictionary columns
+  auto is_dictionary_output = [&](size_t i) {
+    return _strings_to_dictionary && column_types[i].id() == type_id::STRING &&
+           _metadata->get_column_leaf_schema(_selected_columns[i].first).max_repetition_level == 0;
+  };
+
   std::vector<std::unique_ptr<column>> out_columns;
   out_columns.reserve(column_types.size());
 
@@ -1043,9 +2151,20 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Keep track of column chunk file offsets
     std::vector<size_t> column_chunk_offsets(num_chunks);
 
+    // File ranges of the dictionary pages of chunks that only read some of their data pages
+    std::vector<std::pair<size_t, size_t>> column_chunk_dict_ranges(num_chunks);
+
+    // Row windows are narrowed down to pages using the page index, if present
+    auto const use_page_index = row_groups.empty();
+
     // information needed allocate columns (including potential nesting)
     bool has_nesting = false;
 
+    // First column chunk of each batch of row groups decoded together, followed by the number of
+    // chunks
+    std::vector<size_t> batch_offsets{0};
+    size_t batch_compressed_size = 0;
+
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
     auto remaining_rows            = num_rows;
@@ -1054,7 +2173,11 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       auto const row_group_start  = rg.start_row;
       auto const row_group_source = rg.source_index;
       auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
-      auto const io_chunk_idx     = chunks.size();
+
+      // Window of requested rows within the row group
+      auto const window_begin = std::max<int64_t>(skip_rows - row_group_start, 0);
+      auto const window_end =
+        std::min<int64_t>(skip_rows + num_rows - row_group_start, row_group.num_rows);
 
       for (size_t i = 0; i < num_columns; ++i) {
         auto col       = _selected_columns[i];
@@ -1093,13 +2216,45 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        // Only read the data pages overlapping the requested rows. Values and rows only map
+        // one-to-one in non-repeated columns, so list columns are always read whole.
+        size_t chunk_size       = col_meta.total_compressed_size;
+        size_t chunk_num_values = col_meta.num_values;
+        size_t chunk_start_row  = row_group_start;
+        uint32_t chunk_num_rows = row_group_rows;
+        page_selection pages;
+        OffsetIndex offset_index;
+        auto const &chunk_meta = row_group.columns[col.first];
+        if (use_page_index && leaf_schema.max_repetition_level == 0 &&
+            (window_begin > 0 || window_end < row_group.num_rows) &&
+            read_page_index(_sources[row_group_source].get(),
+                            chunk_meta.offset_index_offset,
+                            chunk_meta.offset_index_length,
+                            offset_index) &&
+            select_pages(offset_index,
+                         column_chunk_offsets[chunks.size()],
+                         col_meta.total_compressed_size,
+                         row_group.num_rows,
+                         window_begin,
+                         window_end,
+                         pages)) {
+          if (pages.dict_size != 0) {
+            column_chunk_dict_ranges[chunks.size()] = {pages.dict_offset, pages.dict_size};
+          }
+          column_chunk_offsets[chunks.size()] = pages.data_offset;
+          chunk_size                          = pages.dict_size + pages.data_size;
+          chunk_num_values                    = pages.end_row - pages.first_row;
+          chunk_start_row                     = row_group_start + pages.first_row;
+          chunk_num_rows                      = pages.end_row - pages.first_row;
+        }
+
+        chunks.insert(gpu::ColumnChunkDesc(chunk_size,
                                            nullptr,
-                                           col_meta.num_values,
+                                           chunk_num_values,
                                            leaf_schema.type,
                                            type_width,
-                                           row_group_start,
-                                           row_group_rows,
+                                           chunk_start_row,
+                                           chunk_num_rows,
                                            leaf_schema.max_definition_level,
                                            leaf_schema.max_repetition_level,
                                            required_bits(leaf_schema.max_definition_level),
@@ -1117,119 +2272,193 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         if (col_meta.codec != Compression::UNCOMPRESSED) {
           total_decompressed_size += col_meta.total_uncompressed_size;
         }
+        batch_compressed_size += chunk_size;
+      }
+      remaining_rows -= row_group.num_rows;
+      if (batch_compressed_size >= decode_batch_size) {
+        batch_offsets.push_back(chunks.size());
+        batch_compressed_size = 0;
+      }
+    }
+    assert(remaining_rows <= 0);
+    if (batch_offsets.back() != chunks.size()) { batch_offsets.push_back(chunks.size()); }
+
+    // Flat columns are allocated up front, so that each batch of row groups can be decoded while
+    // the next one is read. String dictionaries of dictionary outputs span all the row groups.
+    bool const has_dictionary_output = [&]() {
+      for (size_t i = 0; i < num_columns; ++i) {
+        if (is_dictionary_output(i)) { return true; }
+      }
+      return false;
+    }();
+    if (batch_offsets.size() > 2 && !has_nesting && !has_dictionary_output) {
+      std::vector<column_buffer> out_buffers;
+      out_buffers.reserve(num_columns);
+      for (size_t i = 0; i < num_columns; ++i) {
+        auto &leaf_schema = _metadata->get_column_leaf_schema(_selected_columns[i].first);
+        bool is_nullable  = leaf_schema.max_definition_level != 0;
+        out_buffers.emplace_back(
+          column_buffer{column_types[i], num_rows, is_nullable, stream, _mr});
       }
-      // Read compressed chunk data to device memory
+
+      std::vector<rmm::device_buffer> decoded_page_data;
+      read_and_decode_batches(page_data,
+                              chunks,
+                              batch_offsets,
+                              column_chunk_offsets,
+                              column_chunk_dict_ranges,
+                              chunk_source_map,
+                              skip_rows,
+                              num_rows,
+                              out_buffers,
+                              decoded_page_data,
+                              stream);
+      for (auto &buffer : out_buffers) {
+        out_columns.emplace_back(make_column(buffer, stream, _mr));
+      }
+      // The page data is freed on the decode stream, after the columns are made from it
+      CUDA_TRY(cudaEventRecord(_decode_done, stream));
+      CUDA_TRY(cudaStreamWaitEvent(_decode_stream, _decode_done, 0));
+      decoded_page_data.clear();
+    } else {
+      // Read compressed chunk data of all the row groups to device memory
       read_column_chunks(page_data,
                          chunks,
-                         io_chunk_idx,
+                         0,
                          chunks.size(),
                          column_chunk_offsets,
+                         column_chunk_dict_ranges,
                          chunk_source_map,
                          stream);
 
-      remaining_rows -= row_group.num_rows;
-    }
-    assert(remaining_rows <= 0);
-
-    // Process dataset chunk pages into output columns
-    const auto total_pages = count_page_headers(chunks, stream);
-    if (total_pages > 0) {
-      hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, stream);
-      rmm::device_buffer decomp_page_data;
-
-      // decoding of column/page information
-      decode_page_headers(chunks, pages, stream);
-      if (total_decompressed_size > 0) {
-        decomp_page_data = decompress_page_data(chunks, pages, stream);
-        // Free compressed data
-        for (size_t c = 0; c < chunks.size(); c++) {
-          if (chunks[c].codec != parquet::Compression::UNCOMPRESSED && page_data[c].size() != 0) {
-            page_data[c].resize(0);
-            page_data[c].shrink_to_fit();
+      // Process dataset chunk pages into output columns
+      const auto total_pages = count_page_headers(chunks, stream);
+      if (total_pages > 0) {
+        hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, stream);
+
+        // decoding of column/page information
+        decode_page_headers(chunks, pages, stream);
+        if (total_decompressed_size > 0) {
+          decompress_page_data(chunks, pages, _decomp_page_data, stream);
+          // Free compressed data
+          for (size_t c = 0; c < chunks.size(); c++) {
+            if (chunks[c].codec != parquet::Compression::UNCOMPRESSED && page_data[c].size() != 0) {
+              page_data[c].resize(0);
+              page_data[c].shrink_to_fit();
+            }
           }
         }
-      }
-
-      // nesting information (sizes, etc) stored -per page-
-      hostdevice_vector<gpu::PageNestingInfo> page_nesting_info;
-      // nesting information at the column level.
-      // - total column size per nesting level
-      // - nullability per nesting level
-      std::vector<std::vector<std::pair<int, bool>>> col_nesting_info;
-
-      // even for flat schemas, we allocate 1 level of "nesting" info
-      allocate_nesting_info(
-        chunks, pages, page_nesting_info, col_nesting_info, num_columns, stream);
-
-      // for nested schemas, we have to do some further preprocessing to determine:
-      // - real column output sizes per level of nesting (in a flat schema, there's only 1 level of
-      //   nesting and it's size is the row count)
-      //
-      // - output buffer offset values per-page, per nesting-level for the purposes of decoding.
-      if (has_nesting) {
-        preprocess_nested_columns(
-          chunks, pages, page_nesting_info, col_nesting_info, skip_rows, num_rows, stream);
-      }
 
-      std::vector<column_buffer> out_buffers;
-      out_buffers.reserve(column_types.size());
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col          = _selected_columns[i];
-        auto &leaf_schema = _metadata->get_column_leaf_schema(col.first);
+        // delta and byte stream split encoded pages are converted to plain ones
+        rmm::device_buffer plain_page_data;
+        convert_page_encodings(chunks, pages, plain_page_data, stream);
+
+        // nesting information (sizes, etc) stored -per page-
+        hostdevice_vector<gpu::PageNestingInfo> page_nesting_info;
+        // nesting information at the column level.
+        // - total column size per nesting level
+        // - nullability per nesting level
+        std::vector<std::vector<std::pair<int, bool>>> col_nesting_info;
+
+        // even for flat schemas, we allocate 1 level of "nesting" info
+        allocate_nesting_info(
+          chunks, pages, page_nesting_info, col_nesting_info, num_columns, stream);
+
+        // for nested schemas, we have to do some further preprocessing to determine:
+        // - real column output sizes per level of nesting (in a flat schema, there's only 1 level
+        //   of nesting and it's size is the row count)
+        //
+        // - output buffer offset values per-page, per nesting-level for the purposes of decoding.
+        if (has_nesting) {
+          preprocess_nested_columns(
+            chunks, pages, page_nesting_info, col_nesting_info, skip_rows, num_rows, stream);
+        }
 
-        int output_depth = leaf_schema.max_repetition_level + 1;
-
-        // nested schemas : sizes and nullability come from preprocess step
-        if (output_depth > 1) {
-          // the root buffer
-          out_buffers.emplace_back(column_buffer{column_types[i],
-                                                 col_nesting_info[i][0].first,
-                                                 col_nesting_info[i][0].second,
-                                                 stream,
-                                                 _mr});
-          column_buffer *col = &out_buffers[out_buffers.size() - 1];
-          // nested buffers
-          for (int idx = 1; idx < output_depth - 1; idx++) {
-            // note : all levels in a list column besides the leaf are offsets, so their length is
-            // always +1
-            col->children.push_back(column_buffer{column_types[i],
-                                                  col_nesting_info[i][idx].first,
-                                                  col_nesting_info[i][idx].second,
-                                                  stream,
-                                                  _mr});
-            col = &col->children[0];
+        std::vector<column_buffer> out_buffers;
+        out_buffers.reserve(column_types.size());
+        for (size_t i = 0; i < column_types.size(); ++i) {
+          auto col          = _selected_columns[i];
+          auto &leaf_schema = _metadata->get_column_leaf_schema(col.first);
+
+          int output_depth = leaf_schema.max_repetition_level + 1;
+
+          // nested schemas : sizes and nullability come from preprocess step
+          if (output_depth > 1) {
+            // the root buffer
+            out_buffers.emplace_back(column_buffer{column_types[i],
+                                                   col_nesting_info[i][0].first,
+                                                   col_nesting_info[i][0].second,
+                                                   stream,
+                                                   _mr});
+            column_buffer *col = &out_buffers[out_buffers.size() - 1];
+            // nested buffers
+            for (int idx = 1; idx < output_depth - 1; idx++) {
+              // note : all levels in a list column besides the leaf are offsets, so their length is
+              // always +1
+              col->children.push_back(column_buffer{column_types[i],
+                                                    col_nesting_info[i][idx].first,
+                                                    col_nesting_info[i][idx].second,
+                                                    stream,
+                                                    _mr});
+              col = &col->children[0];
+            }
+
+            // leaf buffer - plain data type. int, string, etc
+            col->children.push_back(column_buffer{
+              data_type{to_type_id(leaf_schema,
+                                   _strings_to_categorical,
+                                   _timestamp_type.id(),
+                                   _decimals_as_fixed_point)},
+              col_nesting_info[i][output_depth - 1].first,
+              col_nesting_info[i][output_depth - 1].second,
+              stream,
+              _mr});
+          }
+          // flat schemas can infer sizes directly from # of rows
+          else {
+            // note : num_rows == # values for non-nested types
+            bool is_nullable = leaf_schema.max_definition_level != 0;
+            out_buffers.emplace_back(
+              column_buffer{column_types[i], num_rows, is_nullable, stream, _mr});
           }
-
-          // leaf buffer - plain data type. int, string, etc
-          col->children.push_back(column_buffer{
-            data_type{to_type_id(leaf_schema, _strings_to_categorical, _timestamp_type.id())},
-            col_nesting_info[i][output_depth - 1].first,
-            col_nesting_info[i][output_depth - 1].second,
-            stream,
-            _mr});
-        }
-        // flat schemas can infer sizes directly from # of rows
-        else {
-          // note : num_rows == # values for non-nested types
-          bool is_nullable = leaf_schema.max_definition_level != 0;
-          out_buffers.emplace_back(
-            column_buffer{column_types[i], num_rows, is_nullable, stream, _mr});
         }
-      }
 
-      // decoding of column data itself
-      decode_page_data(chunks, pages, page_nesting_info, skip_rows, num_rows, out_buffers, stream);
+        // decoding of column data itself
+        rmm::device_vector<gpu::nvstrdesc_s> str_dict_index;
+        decode_page_data(chunks,
+                         pages,
+                         page_nesting_info,
+                         skip_rows,
+                         num_rows,
+                         out_buffers,
+                         str_dict_index,
+                         stream);
+
+        // create the final output cudf columns
+        for (size_t i = 0; i < column_types.size(); ++i) {
+          if (is_dictionary_output(i)) {
+            auto const col_index = static_cast<int32_t>(i);
+            auto const entries =
+              column_dictionary_entries(chunks, pages, str_dict_index, col_index, stream);
+            out_columns.emplace_back(make_strings_dictionary(out_buffers[i], entries, stream, _mr));
+          } else {
+            out_columns.emplace_back(make_column(out_buffers[i], stream, _mr));
+          }
+        }
 
-      // create the final output cudf columns
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_column(out_buffers[i], stream, _mr));
+        // Free decompressed data unless it is reused by the next read
+        if (!keep_scratch) {
+          _decomp_page_data.resize(0);
+          _decomp_page_data.shrink_to_fit();
+        }
       }
     }
   }
 
   // Create empty columns as needed
   for (size_t i = out_columns.size(); i < column_types.size(); ++i) {
-    out_columns.emplace_back(make_empty_column(column_types[i]));
+    out_columns.emplace_back(make_empty_column(
+      is_dictionary_output(i) ? data_type{type_id::DICTIONARY32} : column_types[i]));
   }
 
   table_metadata out_metadata;
@@ -1248,7 +2477,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 reader::reader(std::vector<std::string> const &filepaths,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepaths), options, mr))
+  : _impl(std::make_unique<impl>(
+      datasource::create(filepaths), cache_keys(filepaths), options, mr))
 {
 }
 
@@ -1256,7 +2486,7 @@ reader::reader(std::vector<std::string> const &filepaths,
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(std::move(sources), options, mr))
+  : _impl(std::make_unique<impl>(std::move(sources), std::vector<std::string>{}, options, mr))
 {
 }
 
@@ -1264,19 +2494,44 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
 reader::~reader() = default;
 
 // Forward to implementation
-table_with_metadata reader::read_all(cudaStream_t stream) { return _impl->read(0, -1, {}, stream); }
+table_with_metadata reader::read_all(cudaStream_t stream)
+{
+  return _impl->read(0, -1, {}, false, stream);
+}
 
 // Forward to implementation
 table_with_metadata reader::read_row_groups(std::vector<std::vector<size_type>> const &row_groups,
                                             cudaStream_t stream)
 {
-  return _impl->read(0, -1, row_groups, stream);
+  return _impl->read(0, -1, row_groups, false, stream);
 }
 
 // Forward to implementation
 table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream)
 {
-  return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, {}, stream);
+  return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, {}, false, stream);
+}
+
+// Forward to implementation
+std::vector<std::pair<size_type, size_type>> reader::get_chunk_row_ranges(size_t byte_limit,
+                                                                         size_type row_limit) const
+{
+  return _impl->get_chunk_row_ranges(byte_limit, row_limit);
+}
+
+// Forward to implementation
+memory_estimate reader::estimate_read_memory() const { return _impl->estimate_read_memory(); }
+
+// Forward to implementation
+std::vector<column_statistics> reader::read_statistics(cudaStream_t stream) const
+{
+  return _impl->read_statistics(stream);
+}
+
+// Forward to implementation
+table_with_metadata reader::read_chunk(size_type skip_rows, size_type num_rows, cudaStream_t stream)
+{
+  return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, {}, true, stream);
 }
 
 }  // namespace parquet
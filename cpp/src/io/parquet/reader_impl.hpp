@@ -25,6 +25,7 @@
 #include "parquet_gpu.h"
 
 #include <io/utilities/column_buffer.hpp>
+#include <io/utilities/device_read_pipeline.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
 #include <cudf/io/datasource.hpp>
@@ -54,19 +55,24 @@ class reader::impl {
    * @brief Constructor from an array of dataset sources with reader options.
    *
    * @param sources Dataset sources
+   * @param cache_keys Metadata cache key of each source, or empty to bypass the cache
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
   explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                std::vector<std::string> const &cache_keys,
                 reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
+  ~impl();
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read
    * @param row_group_indices TODO
+   * @param keep_scratch Whether to keep the decompression scratch memory for the next read
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with metadata
@@ -74,17 +80,49 @@ class reader::impl {
   table_with_metadata read(size_type skip_rows,
                            size_type num_rows,
                            std::vector<std::vector<size_type>> const &row_group_indices,
+                           bool keep_scratch,
                            cudaStream_t stream);
 
+  /**
+   * @brief Splits the dataset into ranges of rows that can each be read within a memory budget
+   *
+   * @param byte_limit Approximate upper bound of the device memory used to read each range
+   * @param row_limit Maximum number of rows in each range
+   *
+   * @return List of (skip_rows, num_rows) pairs covering the dataset in order
+   */
+  std::vector<std::pair<size_type, size_type>> get_chunk_row_ranges(size_t byte_limit,
+                                                                    size_type row_limit) const;
+
+  /**
+   * @brief Returns upper bounds on the device memory of reading all the row groups of the selected
+   * columns
+   */
+  memory_estimate estimate_read_memory() const;
+
+  /**
+   * @brief Returns the statistics of the selected columns, combined from the footers of all the
+   * row groups
+   *
+   * @param stream CUDA stream used to initialize the min/max scalars
+   */
+  std::vector<column_statistics> read_statistics(cudaStream_t stream) const;
+
  private:
   /**
    * @brief Reads compressed page data to device memory
    *
+   * Separate sources are read concurrently from a pool of host threads.
+   *
    * @param page_data Buffers to hold compressed page data for each chunk
    * @param chunks List of column chunk descriptors
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param column_chunk_dict_ranges File offset and size of the dictionary pages of chunks whose
+   * data pages are only partially read (starting at `column_chunk_offsets`); empty for chunks that
+   * are read contiguously
+   * @param chunk_source_map Association between each column chunk and its source
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
@@ -93,6 +131,7 @@ class reader::impl {
                           size_t begin_chunk,
                           size_t end_chunk,
                           const std::vector<size_t> &column_chunk_offsets,
+                          std::vector<std::pair<size_t, size_t>> const &column_chunk_dict_ranges,
                           std::vector<size_type> const &chunk_source_map,
                           cudaStream_t stream);
 
@@ -122,13 +161,26 @@ class reader::impl {
    *
    * @param chunks List of column chunk descriptors
    * @param pages List of page information
+   * @param decomp_pages Device buffer to decompressed page data; reallocated only if too small
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void decompress_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                            hostdevice_vector<gpu::PageInfo> &pages,
+                            rmm::device_buffer &decomp_pages,
+                            cudaStream_t stream);
+
+  /**
+   * @brief Converts the data pages using DELTA or BYTE_STREAM_SPLIT encodings to PLAIN.
    *
-   * @return Device buffer to decompressed page data
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param plain_pages Device buffer to the converted page data
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    */
-  rmm::device_buffer decompress_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                                          hostdevice_vector<gpu::PageInfo> &pages,
-                                          cudaStream_t stream);
+  void convert_page_encodings(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                              hostdevice_vector<gpu::PageInfo> &pages,
+                              rmm::device_buffer &plain_pages,
+                              cudaStream_t stream);
 
   /**
    * @brief Allocate nesting information storage for all pages and set pointers
@@ -189,6 +241,8 @@ class reader::impl {
    * @param min_row Minimum number of rows from start
    * @param total_rows Number of rows to output
    * @param out_buffers Output columns' device buffers
+   * @param str_dict_index Index of the entries of the string dictionaries, which the decoded
+   * strings of dictionary pages point to
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
   void decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
@@ -197,16 +251,65 @@ class reader::impl {
                         size_t min_row,
                         size_t total_rows,
                         std::vector<column_buffer> &out_buffers,
+                        rmm::device_vector<gpu::nvstrdesc_s> &str_dict_index,
                         cudaStream_t stream);
 
+  /**
+   * @brief Reads and decodes the column chunks of flat columns in batches of row groups
+   *
+   * The chunks of a batch are read on `stream` from a separate host thread while the previous
+   * batch is decompressed and decoded on the decode stream, which waits on an event recorded after
+   * each read. `stream` waits on the decoding of all the batches before returning.
+   *
+   * @param page_data Buffers to hold compressed page data for each chunk
+   * @param chunks List of column chunk descriptors
+   * @param batch_offsets Index of the first column chunk of each batch, followed by the number of
+   * chunks
+   * @param column_chunk_offsets File offset for all chunks
+   * @param column_chunk_dict_ranges File offset and size of the dictionary pages of chunks whose
+   * data pages are only partially read
+   * @param chunk_source_map Association between each column chunk and its source
+   * @param min_row Minimum number of rows from start
+   * @param total_rows Number of rows to output
+   * @param out_buffers Output columns' device buffers, allocated on `stream`
+   * @param decoded_page_data Decompressed and converted page data of the batches, which the
+   * output string columns point into
+   * @param stream CUDA stream used for the reads and the output buffers
+   */
+  void read_and_decode_batches(
+    std::vector<rmm::device_buffer> &page_data,
+    hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+    std::vector<size_t> const &batch_offsets,
+    const std::vector<size_t> &column_chunk_offsets,
+    std::vector<std::pair<size_t, size_t>> const &column_chunk_dict_ranges,
+    std::vector<size_type> const &chunk_source_map,
+    size_t min_row,
+    size_t total_rows,
+    std::vector<column_buffer> &out_buffers,
+    std::vector<rmm::device_buffer> &decoded_page_data,
+    cudaStream_t stream);
+
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
+  // Resource of the intermediate buffers of the reads
+  rmm::mr::device_memory_resource *_scratch_mr = rmm::mr::get_default_resource();
   std::vector<std::unique_ptr<datasource>> _sources;
   std::unique_ptr<aggregate_metadata> _metadata;
 
   std::vector<std::pair<int, std::string>> _selected_columns;
-  bool _strings_to_categorical = false;
+  bool _strings_to_categorical  = false;
+  bool _strings_to_dictionary   = false;
+  bool _decimals_as_fixed_point = false;
   data_type _timestamp_type{type_id::EMPTY};
+  std::vector<column_predicate> _filters;
+
+  // Decompressed page data, kept across chunked reads
+  rmm::device_buffer _decomp_page_data;
+
+  // Decoding of batches of row groups, overlapped with the reads of the next batch
+  cudaStream_t _decode_stream = nullptr;
+  cudaEvent_t _read_done      = nullptr;
+  cudaEvent_t _decode_done    = nullptr;
 };
 
 }  // namespace parquet
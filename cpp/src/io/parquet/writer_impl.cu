@@ -21,11 +21,19 @@
 
 #include "writer_impl.hpp"
 
+#include <io/utilities/device_write_pipeline.hpp>
+
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <future>
+#include <limits>
 #include <utility>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -39,12 +47,6 @@ using namespace cudf::io::parquet;
 using namespace cudf::io;
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- **/
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to parquet compression
  **/
@@ -53,6 +55,8 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::GZIP: return parquet::Compression::GZIP;
+    case compression_type::ZSTD: return parquet::Compression::ZSTD;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -60,6 +64,78 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Returns the encoding of the values of a column when the delta encodings are enabled and
+ * the values are not dictionary-encoded
+ **/
+Encoding delta_encoding(Type physical_type)
+{
+  switch (physical_type) {
+    case INT32:
+    case INT64: return DELTA_BINARY_PACKED;
+    case FLOAT:
+    case DOUBLE: return BYTE_STREAM_SPLIT;
+    case BYTE_ARRAY: return DELTA_BYTE_ARRAY;
+    default: return PLAIN;
+  }
+}
+
+/**
+ * @brief Returns the plain encoding of a statistics value, as stored in the ColumnIndex
+ *
+ * The characters of string values are copied from device memory asynchronously on `stream`.
+ **/
+std::vector<uint8_t> encode_stats_value(statistics_val const &val,
+                                        statistics_dtype dtype,
+                                        cudaStream_t stream)
+{
+  auto const to_bytes = [](void const *ptr, size_t size) {
+    auto const bytes = static_cast<uint8_t const *>(ptr);
+    return std::vector<uint8_t>(bytes, bytes + size);
+  };
+  switch (dtype) {
+    case dtype_bool: return to_bytes(&val.i_val, 1);
+    case dtype_int8:
+    case dtype_int16:
+    case dtype_int32:
+    case dtype_date32: return to_bytes(&val.i_val, 4);
+    case dtype_float32: {
+      auto const fp32_val = static_cast<float>(val.fp_val);
+      return to_bytes(&fp32_val, sizeof(fp32_val));
+    }
+    case dtype_int64:
+    case dtype_timestamp64:
+    case dtype_float64:
+    case dtype_decimal64: return to_bytes(&val, 8);
+    case dtype_decimal128: return to_bytes(&val.i128_val, 16);
+    case dtype_string: {
+      std::vector<uint8_t> chars(val.str_val.length);
+      if (!chars.empty()) {
+        CUDA_TRY(cudaMemcpyAsync(
+          chars.data(), val.str_val.ptr, chars.size(), cudaMemcpyDeviceToHost, stream));
+      }
+      return chars;
+    }
+    default: return {};
+  }
+}
+
+/**
+ * @brief Returns the number of blocks of a split block bloom filter that holds a number of distinct
+ * values with a target false positive probability
+ *
+ * The size is rounded up to a power of 2, and bounded by the 1MB default of parquet-mr.
+ **/
+uint32_t bloom_filter_num_blocks(size_t num_distinct, double fpp)
+{
+  constexpr size_t max_bytes = 1024 * 1024;
+  auto const num_bits =
+    -8.0 * std::max<size_t>(num_distinct, 1) / std::log(1.0 - std::pow(fpp, 1.0 / 8));
+  size_t num_bytes = gpu::kBloomFilterBlockSize;
+  while (num_bytes * 8 < num_bits && num_bytes < max_bytes) { num_bytes *= 2; }
+  return static_cast<uint32_t>(num_bytes / gpu::kBloomFilterBlockSize);
+}
+
 }  // namespace
 
 /**
@@ -319,8 +395,10 @@ void writer::impl::init_page_fragments(hostdevice_vector<gpu::PageFragment> &fra
                                        uint32_t num_fragments,
                                        uint32_t num_rows,
                                        uint32_t fragment_size,
+                                       uint32_t const *fragment_starts,
                                        cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE("parquet::init_page_fragments");
   CUDA_TRY(cudaMemcpyAsync(col_desc.device_ptr(),
                            col_desc.host_ptr(),
                            col_desc.memory_size(),
@@ -332,6 +410,7 @@ void writer::impl::init_page_fragments(hostdevice_vector<gpu::PageFragment> &fra
                                   num_columns,
                                   fragment_size,
                                   num_rows,
+                                  fragment_starts,
                                   stream));
   CUDA_TRY(cudaMemcpyAsync(
     frag.host_ptr(), frag.device_ptr(), frag.memory_size(), cudaMemcpyDeviceToHost, stream));
@@ -344,8 +423,10 @@ void writer::impl::gather_fragment_statistics(statistics_chunk *frag_stats_chunk
                                               uint32_t num_columns,
                                               uint32_t num_fragments,
                                               uint32_t fragment_size,
+                                              uint32_t const *fragment_starts,
                                               cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE("parquet::gather_fragment_statistics");
   rmm::device_vector<statistics_group> frag_stats_group(num_fragments * num_columns);
 
   CUDA_TRY(gpu::InitFragmentStatistics(frag_stats_group.data().get(),
@@ -354,6 +435,7 @@ void writer::impl::gather_fragment_statistics(statistics_chunk *frag_stats_chunk
                                        num_fragments,
                                        num_columns,
                                        fragment_size,
+                                       fragment_starts,
                                        stream));
   CUDA_TRY(GatherColumnStatistics(
     frag_stats_chunk, frag_stats_group.data().get(), num_fragments * num_columns, stream));
@@ -362,25 +444,68 @@ void writer::impl::gather_fragment_statistics(statistics_chunk *frag_stats_chunk
 
 void writer::impl::build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                                             hostdevice_vector<gpu::EncColumnDesc> &col_desc,
+                                            const gpu::PageFragment *fragments,
                                             uint32_t num_rowgroups,
                                             uint32_t num_columns,
                                             uint32_t num_dictionaries,
                                             cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("parquet::build_chunk_dictionaries", num_dictionaries);
   size_t dict_scratch_size = (size_t)num_dictionaries * gpu::kDictScratchSize;
   rmm::device_vector<uint32_t> dict_scratch(dict_scratch_size / sizeof(uint32_t));
+  bool has_global_dictionaries = false;
   CUDA_TRY(cudaMemcpyAsync(
     chunks.device_ptr(), chunks.host_ptr(), chunks.memory_size(), cudaMemcpyHostToDevice, stream));
+  for (uint32_t i = 0; i < num_rowgroups * num_columns; i++) {
+    if (chunks[i].has_dictionary && chunks[i].global_dictionary) {
+      CUDA_TRY(gpu::BuildGlobalDictionaryIndex(chunks[i], stream));
+      has_global_dictionaries = true;
+    }
+  }
   CUDA_TRY(gpu::BuildChunkDictionaries(chunks.device_ptr(),
                                        dict_scratch.data().get(),
                                        dict_scratch_size,
                                        num_rowgroups * num_columns,
+                                       max_dictionary_size_,
                                        stream));
+  if (has_global_dictionaries) {
+    // Global dictionaries were enabled without a size estimate: only keep the ones that are
+    // smaller than the plain encoding of the values they cover
+    CUDA_TRY(cudaMemcpyAsync(chunks.host_ptr(),
+                             chunks.device_ptr(),
+                             chunks.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    for (uint32_t i = 0; i < num_rowgroups * num_columns; i++) {
+      gpu::EncColumnChunk *ck = &chunks[i];
+      if (ck->has_dictionary && ck->global_dictionary) {
+        const gpu::PageFragment *ck_frag = &fragments[ck->first_fragment];
+        uint32_t index_bytes             = (ck->total_dict_entries > 65536) ? 3 : 2;
+        size_t plain_size                = 0;
+        size_t dict_size                 = 1 + ck->dictionary_size;
+        for (uint32_t j = 0; j < ck->num_dict_fragments; j++) {
+          plain_size += ck_frag[j].fragment_data_size;
+          dict_size += index_bytes * ck_frag[j].non_nulls;
+        }
+        if (dict_size >= plain_size) {
+          ck->has_dictionary     = 0;
+          ck->num_dict_fragments = 0;
+        }
+      }
+    }
+    CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
+                             chunks.host_ptr(),
+                             chunks.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+  }
   CUDA_TRY(gpu::InitEncoderPages(chunks.device_ptr(),
                                  nullptr,
                                  col_desc.device_ptr(),
                                  num_rowgroups,
                                  num_columns,
+                                 target_page_size_,
                                  nullptr,
                                  nullptr,
                                  stream));
@@ -400,6 +525,7 @@ void writer::impl::init_encoder_pages(hostdevice_vector<gpu::EncColumnChunk> &ch
                                       uint32_t num_stats_bfr,
                                       cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE("parquet::init_encoder_pages");
   rmm::device_vector<statistics_merge_group> page_stats_mrg(num_stats_bfr);
   CUDA_TRY(cudaMemcpyAsync(
     chunks.device_ptr(), chunks.host_ptr(), chunks.memory_size(), cudaMemcpyHostToDevice, stream));
@@ -409,6 +535,7 @@ void writer::impl::init_encoder_pages(hostdevice_vector<gpu::EncColumnChunk> &ch
     col_desc.device_ptr(),
     num_rowgroups,
     num_columns,
+    target_page_size_,
     (num_stats_bfr) ? page_stats_mrg.data().get() : nullptr,
     (num_stats_bfr > num_pages) ? page_stats_mrg.data().get() + num_pages : nullptr,
     stream));
@@ -439,12 +566,24 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                                 const statistics_chunk *chunk_stats,
                                 cudaStream_t stream)
 {
+  auto const first_chunk = first_rowgroup * num_columns;
+  auto const end_chunk   = (first_rowgroup + rowgroups_in_batch) * num_columns;
+  size_t batch_bytes     = 0;
+  for (auto c = first_chunk; c < end_chunk; c++) { batch_bytes += chunks[c].bfr_size; }
+  CUDF_SCOPED_RANGE_PAYLOAD("parquet::encode_pages", batch_bytes);
+
   CUDA_TRY(gpu::EncodePages(
     pages, chunks.device_ptr(), pages_in_batch, first_page_in_batch, comp_in, comp_out, stream));
   switch (compression_) {
     case parquet::Compression::SNAPPY:
       CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
       break;
+    case parquet::Compression::GZIP:
+      CUDA_TRY(gpu_deflate(comp_in, comp_out, pages_in_batch, 1, stream));
+      break;
+    case parquet::Compression::ZSTD:
+      CUDA_TRY(gpu_zstd(comp_in, comp_out, pages_in_batch, stream));
+      break;
     default: break;
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
@@ -475,16 +614,100 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
   CUDA_TRY(cudaStreamSynchronize(stream));
 }
 
+void writer::impl::build_page_indexes(hostdevice_vector<gpu::EncColumnChunk> &chunks,
+                                      hostdevice_vector<gpu::EncColumnDesc> &col_desc,
+                                      const gpu::EncPage *pages,
+                                      const statistics_chunk *page_stats,
+                                      uint32_t num_columns,
+                                      uint32_t rowgroups_in_batch,
+                                      uint32_t first_rowgroup,
+                                      std::vector<OffsetIndex> &offset_indexes,
+                                      std::vector<ColumnIndex> &column_indexes,
+                                      cudaStream_t stream)
+{
+  CUDF_SCOPED_RANGE("parquet::build_page_indexes");
+  auto const first_chunk = first_rowgroup * num_columns;
+  auto const end_chunk   = (first_rowgroup + rowgroups_in_batch) * num_columns;
+  auto const first_page  = chunks[first_chunk].first_page;
+  auto const end_page    = chunks[end_chunk - 1].first_page + chunks[end_chunk - 1].num_pages;
+
+  std::vector<gpu::EncPage> host_pages(end_page - first_page);
+  std::vector<statistics_chunk> host_stats(end_page - first_page);
+  CUDA_TRY(cudaMemcpyAsync(host_pages.data(),
+                           pages + first_page,
+                           host_pages.size() * sizeof(gpu::EncPage),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaMemcpyAsync(host_stats.data(),
+                           page_stats + first_page,
+                           host_stats.size() * sizeof(statistics_chunk),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  for (auto c = first_chunk; c < end_chunk; c++) {
+    auto const &ck      = chunks[c];
+    auto const dtype    = col_desc[c % num_columns].stats_dtype;
+    auto &offset_index  = offset_indexes[c];
+    auto &column_index  = column_indexes[c];
+    bool has_minmax     = true;
+    int64_t page_offset = 0;
+    for (auto p = ck.first_page; p < ck.first_page + ck.num_pages; p++) {
+      auto const &page     = host_pages[p - first_page];
+      auto const page_size = page.hdr_size + page.max_data_size;
+      if (page.page_type == DATA_PAGE) {
+        auto const &stats = host_stats[p - first_page];
+        PageLocation location;
+        location.offset               = page_offset;
+        location.compressed_page_size = page_size;
+        location.first_row_index      = page.start_row - ck.start_row;
+        offset_index.page_locations.push_back(location);
+
+        // Pages that only contain nulls have empty bounds
+        column_index.null_pages.push_back(stats.non_nulls == 0);
+        column_index.null_counts.push_back(stats.null_count);
+        if (stats.non_nulls != 0 && stats.has_minmax) {
+          column_index.min_values.push_back(encode_stats_value(stats.min_value, dtype, stream));
+          column_index.max_values.push_back(encode_stats_value(stats.max_value, dtype, stream));
+        } else {
+          has_minmax = has_minmax && stats.non_nulls == 0;
+          column_index.min_values.emplace_back();
+          column_index.max_values.emplace_back();
+        }
+      }
+      page_offset += page_size;
+    }
+    if (!has_minmax) { column_index = ColumnIndex{}; }
+  }
+  // Wait for the characters of the string bounds
+  CUDA_TRY(cudaStreamSynchronize(stream));
+}
+
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    writer_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr),
+    max_rowgroup_size_(options.row_group_size),
+    target_page_size_(options.page_size),
+    max_dictionary_size_(options.max_dictionary_size),
     compression_(to_parquet_compression(options.compression)),
     stats_granularity_(options.stats_granularity),
+    delta_encodings_(options.delta_encodings),
+    bloom_filter_fpp_(options.bloom_filter_fpp),
     out_sink_(std::move(sink))
 {
+  CUDF_EXPECTS(max_rowgroup_size_ > 0, "Row group size must be positive");
+  CUDF_EXPECTS(target_page_size_ > 0 && target_page_size_ <= std::numeric_limits<uint32_t>::max(),
+               "Page size must be positive and fit in 32 bits");
+  CUDF_EXPECTS(std::all_of(bloom_filter_fpp_.begin(),
+                           bloom_filter_fpp_.end(),
+                           [](double fpp) { return fpp < 1.0; }),
+               "Bloom filter false positive probability must be less than 1");
+  CUDA_TRY(cudaStreamCreateWithFlags(&write_stream_, cudaStreamNonBlocking));
 }
 
+writer::impl::~impl() { cudaStreamDestroy(write_stream_); }
+
 std::unique_ptr<std::vector<uint8_t>> writer::impl::write(table_view const &table,
                                                           const table_metadata *metadata,
                                                           bool return_filemetadata,
@@ -500,17 +723,114 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::write(table_view const &tabl
 
 void writer::impl::write_chunked_begin(pq_chunked_state &state)
 {
-  // Write file header
+  write_file_header(state, out_sink_.get());
+}
+
+void writer::impl::write_file_header(pq_chunked_state &state, data_sink *sink)
+{
   file_header_s fhdr;
   fhdr.magic = PARQUET_MAGIC;
-  out_sink_->host_write(&fhdr, sizeof(fhdr));
+  sink->host_write(&fhdr, sizeof(fhdr));
   state.current_chunk_offset = sizeof(file_header_s);
 }
 
 void writer::impl::write_chunked(table_view const &table, pq_chunked_state &state)
+{
+  std::vector<pq_chunked_state *> states{&state};
+  write_parts(
+    table,
+    {0, table.num_rows()},
+    states,
+    [this](size_type) { return out_sink_.get(); },
+    [](size_type) {},
+    state.stream);
+}
+
+std::unique_ptr<table> writer::impl::write_partitioned(
+  table_view const &table,
+  std::vector<size_type> const &partition_columns,
+  partition_sink_factory const &sink_factory,
+  const table_metadata *metadata,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(!partition_columns.empty(), "At least one partition column is required");
+  std::vector<bool> is_key(table.num_columns(), false);
+  for (auto const col : partition_columns) {
+    CUDF_EXPECTS(col >= 0 && col < table.num_columns(), "Partition column index out of range");
+    is_key[col] = true;
+  }
+  std::vector<size_type> value_columns;
+  for (size_type i = 0; i < table.num_columns(); ++i) {
+    if (!is_key[i]) { value_columns.push_back(i); }
+  }
+  CUDF_EXPECTS(!value_columns.empty(), "There are no columns left to write");
+
+  // The partition columns are not written to the files, nor named in their metadata
+  table_metadata value_metadata;
+  if (metadata != nullptr) {
+    value_metadata.user_data = metadata->user_data;
+    if (!metadata->column_names.empty()) {
+      for (auto const i : value_columns) {
+        value_metadata.column_names.push_back(metadata->column_names[i]);
+      }
+    }
+  }
+
+  // Group the rows of each partition together, keeping their order within the partition
+  groupby::detail::sort::sort_groupby_helper helper(table.select(partition_columns),
+                                                    null_policy::INCLUDE);
+  auto const sorted_values = cudf::detail::gather(table.select(value_columns),
+                                                  helper.key_sort_order(stream),
+                                                  cudf::detail::out_of_bounds_policy::IGNORE,
+                                                  cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                  rmm::mr::get_default_resource(),
+                                                  stream);
+  auto const &d_offsets = helper.group_offsets(stream);
+  std::vector<size_type> offsets(d_offsets.size());
+  CUDA_TRY(cudaMemcpyAsync(offsets.data(),
+                           d_offsets.data().get(),
+                           offsets.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  auto keys = helper.unique_keys(_mr, stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  auto const num_parts = static_cast<size_type>(offsets.size()) - 1;
+  std::vector<pq_chunked_state> part_states;
+  part_states.reserve(std::max(num_parts, 0));
+  for (size_type p = 0; p < num_parts; ++p) {
+    part_states.emplace_back(&value_metadata, SingleWriteMode::YES, stream);
+  }
+  std::vector<pq_chunked_state *> states;
+  for (auto &part_state : part_states) { states.push_back(&part_state); }
+
+  // Only the file of the part being written is open, whatever the number of partitions
+  std::unique_ptr<data_sink> part_sink;
+  auto const open_part = [&](size_type p) {
+    part_sink = sink_factory(keys->view(), p);
+    write_file_header(part_states[p], part_sink.get());
+    return part_sink.get();
+  };
+  auto const close_part = [&](size_type p) {
+    write_file_footer(part_states[p], part_sink.get(), false, "");
+    part_sink.reset();
+  };
+  if (num_parts > 0) {
+    write_parts(sorted_values->view(), offsets, states, open_part, close_part, stream);
+  }
+  return keys;
+}
+
+void writer::impl::write_parts(table_view const &table,
+                               std::vector<size_type> const &part_offsets,
+                               std::vector<pq_chunked_state *> const &states,
+                               std::function<data_sink *(size_type)> const &open_part,
+                               std::function<void(size_type)> const &close_part,
+                               cudaStream_t stream)
 {
   size_type num_columns = table.num_columns();
   size_type num_rows    = 0;
+  size_type num_parts   = static_cast<size_type>(states.size());
 
   // Wrapper around cudf columns to attach parquet-specific type info.
   // Note : I wish we could do this in the begin() function but since the
@@ -523,77 +843,86 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     const auto current_id = parquet_columns.size();
 
     num_rows = std::max<uint32_t>(num_rows, col.size());
-    parquet_columns.emplace_back(current_id, col, state.user_metadata, state.stream);
+    parquet_columns.emplace_back(current_id, col, states[0]->user_metadata, stream);
   }
 
-  if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
-    CUDF_EXPECTS(state.user_metadata_with_nullability.column_nullable.size() ==
-                   static_cast<size_t>(num_columns),
-                 "When passing values in user_metadata_with_nullability, data for all columns must "
-                 "be specified");
-  }
+  for (size_type p = 0; p < num_parts; p++) {
+    auto &state          = *states[p];
+    auto const part_rows = part_offsets[p + 1] - part_offsets[p];
 
-  // first call. setup metadata. num_rows will get incremented as write_chunked is
-  // called multiple times.
-  if (state.md.version == 0) {
-    state.md.version  = 1;
-    state.md.num_rows = num_rows;
-    state.md.schema.resize(1 + num_columns);
-    state.md.schema[0].type            = UNDEFINED_TYPE;
-    state.md.schema[0].repetition_type = NO_REPETITION_TYPE;
-    state.md.schema[0].name            = "schema";
-    state.md.schema[0].num_children    = num_columns;
-    state.md.column_order_listsize =
-      (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_columns : 0;
-    if (state.user_metadata != nullptr) {
-      for (auto it = state.user_metadata->user_data.begin();
-           it != state.user_metadata->user_data.end();
-           it++) {
-        state.md.key_value_metadata.push_back({it->first, it->second});
-      }
+    if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
+      CUDF_EXPECTS(
+        state.user_metadata_with_nullability.column_nullable.size() ==
+          static_cast<size_t>(num_columns),
+        "When passing values in user_metadata_with_nullability, data for all columns must "
+        "be specified");
     }
-    for (auto i = 0; i < num_columns; i++) {
-      auto &col = parquet_columns[i];
-      // Column metadata
-      state.md.schema[1 + i].type           = col.physical_type();
-      state.md.schema[1 + i].converted_type = col.converted_type();
-      // because the repetition type is global (in the sense of, not per-rowgroup or per
-      // write_chunked() call) we cannot know up front if the user is going to end up passing tables
-      // with nulls/no nulls in the multiple write_chunked() case.  so we'll do some special
-      // handling.
-      //
-      // if the user is explicitly saying "I am only calling this once", fall back to the original
-      // behavior and assume the columns in this one table tell us everything we need to know.
-      if (state.single_write_mode) {
-        state.md.schema[1 + i].repetition_type =
-          (col.nullable() || col.data_count() < (size_t)num_rows) ? OPTIONAL : REQUIRED;
+
+    // first call. setup metadata. num_rows will get incremented as write_chunked is
+    // called multiple times.
+    if (state.md.version == 0) {
+      state.md.version  = 1;
+      state.md.num_rows = part_rows;
+      state.md.schema.resize(1 + num_columns);
+      state.md.schema[0].type            = UNDEFINED_TYPE;
+      state.md.schema[0].repetition_type = NO_REPETITION_TYPE;
+      state.md.schema[0].name            = "schema";
+      state.md.schema[0].num_children    = num_columns;
+      state.md.column_order_listsize =
+        (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_columns : 0;
+      if (state.user_metadata != nullptr) {
+        for (auto it = state.user_metadata->user_data.begin();
+             it != state.user_metadata->user_data.end();
+             it++) {
+          state.md.key_value_metadata.push_back({it->first, it->second});
+        }
       }
-      // otherwise, if the user is explicitly telling us global information about all the tables
-      // that will ever get passed in
-      else if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
-        state.md.schema[1 + i].repetition_type =
-          state.user_metadata_with_nullability.column_nullable[i] ? OPTIONAL : REQUIRED;
+      for (auto i = 0; i < num_columns; i++) {
+        auto &col = parquet_columns[i];
+        // Column metadata
+        state.md.schema[1 + i].type           = col.physical_type();
+        state.md.schema[1 + i].converted_type = col.converted_type();
+        // because the repetition type is global (in the sense of, not per-rowgroup or per
+        // write_chunked() call) we cannot know up front if the user is going to end up passing
+        // tables with nulls/no nulls in the multiple write_chunked() case.  so we'll do some
+        // special handling.
+        //
+        // if the user is explicitly saying "I am only calling this once", fall back to the
+        // original behavior and assume the columns in this one table tell us everything we need
+        // to know.
+        if (state.single_write_mode) {
+          state.md.schema[1 + i].repetition_type =
+            (col.nullable() || col.data_count() < (size_t)num_rows) ? OPTIONAL : REQUIRED;
+        }
+        // otherwise, if the user is explicitly telling us global information about all the
+        // tables that will ever get passed in
+        else if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
+          state.md.schema[1 + i].repetition_type =
+            state.user_metadata_with_nullability.column_nullable[i] ? OPTIONAL : REQUIRED;
+        }
+        // otherwise assume the worst case.
+        else {
+          state.md.schema[1 + i].repetition_type = OPTIONAL;
+        }
+        state.md.schema[1 + i].name         = col.name();
+        state.md.schema[1 + i].num_children = 0;  // Leaf node
       }
-      // otherwise assume the worst case.
-      else {
-        state.md.schema[1 + i].repetition_type = OPTIONAL;
+    } else {
+      // verify the user isn't passing mismatched tables
+      CUDF_EXPECTS(state.md.schema[0].num_children == num_columns,
+                   "Mismatch in table structure between multiple calls to write_chunked");
+      for (auto i = 0; i < num_columns; i++) {
+        auto &col = parquet_columns[i];
+        CUDF_EXPECTS(state.md.schema[1 + i].type == col.physical_type(),
+                     "Mismatch in column types between multiple calls to write_chunked");
       }
-      state.md.schema[1 + i].name         = col.name();
-      state.md.schema[1 + i].num_children = 0;  // Leaf node
-    }
-  } else {
-    // verify the user isn't passing mismatched tables
-    CUDF_EXPECTS(state.md.schema[0].num_children == num_columns,
-                 "Mismatch in table structure between multiple calls to write_chunked");
-    for (auto i = 0; i < num_columns; i++) {
-      auto &col = parquet_columns[i];
-      CUDF_EXPECTS(state.md.schema[1 + i].type == col.physical_type(),
-                   "Mismatch in column types between multiple calls to write_chunked");
-    }
 
-    // increment num rows
-    state.md.num_rows += num_rows;
+      // increment num rows
+      state.md.num_rows += part_rows;
+    }
   }
+  // All the parts share the same schema
+  auto const &schema = states[0]->md.schema;
 
   // Initialize column description
   hostdevice_vector<gpu::EncColumnDesc> col_desc(num_columns);
@@ -608,7 +937,7 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     desc->valid_map_base   = col.nulls();
     desc->stats_dtype      = col.stats_type();
     desc->ts_scale         = col.ts_scale();
-    if (state.md.schema[1 + i].type != BOOLEAN && state.md.schema[1 + i].type != UNDEFINED_TYPE) {
+    if (schema[1 + i].type != BOOLEAN && schema[1 + i].type != UNDEFINED_TYPE) {
       col.alloc_dictionary(num_rows);
       desc->dict_index = col.get_dict_index();
       desc->dict_data  = col.get_dict_data();
@@ -617,9 +946,22 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       desc->dict_index = nullptr;
     }
     desc->num_rows       = col.data_count();
-    desc->physical_type  = static_cast<uint8_t>(state.md.schema[1 + i].type);
-    desc->converted_type = static_cast<uint8_t>(state.md.schema[1 + i].converted_type);
-    desc->level_bits     = (state.md.schema[1 + i].repetition_type == OPTIONAL) ? 1 : 0;
+    desc->physical_type  = static_cast<uint8_t>(schema[1 + i].type);
+    desc->converted_type = static_cast<uint8_t>(schema[1 + i].converted_type);
+    desc->level_bits     = (schema[1 + i].repetition_type == OPTIONAL) ? 1 : 0;
+    desc->value_encoding = delta_encodings_ ? delta_encoding(schema[1 + i].type) : PLAIN;
+    if (static_cast<size_t>(i) < bloom_filter_fpp_.size() && bloom_filter_fpp_[i] > 0.0) {
+      switch (schema[1 + i].type) {
+        case INT32:
+        case INT64:
+        case FLOAT:
+        case DOUBLE:
+        case BYTE_ARRAY: break;
+        default:
+          CUDF_FAIL("Bloom filters are not supported for the type of column " +
+                    schema[1 + i].name);
+      }
+    }
   }
 
   // Init page fragments
@@ -628,42 +970,82 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   // iteratively reduce this value if the largest fragment exceeds the max page size limit (we
   // ideally want the page size to be below 1MB so as to have enough pages to get good
   // compression/decompression performance).
+  // Fragments do not span two parts, so that row groups do not either: the last fragment of each
+  // part may be shorter.
   uint32_t fragment_size = 5000;
-  uint32_t num_fragments = (uint32_t)((num_rows + fragment_size - 1) / fragment_size);
+  std::vector<uint32_t> part_first_fragment(num_parts + 1, 0);
+  for (size_type p = 0; p < num_parts; p++) {
+    auto const part_rows = static_cast<uint32_t>(part_offsets[p + 1] - part_offsets[p]);
+    part_first_fragment[p + 1] =
+      part_first_fragment[p] + (part_rows + fragment_size - 1) / fragment_size;
+  }
+  uint32_t num_fragments = part_first_fragment[num_parts];
+  hostdevice_vector<uint32_t> fragment_starts(num_fragments + 1);
+  for (size_type p = 0; p < num_parts; p++) {
+    for (uint32_t f = part_first_fragment[p]; f < part_first_fragment[p + 1]; f++) {
+      fragment_starts[f] = part_offsets[p] + (f - part_first_fragment[p]) * fragment_size;
+    }
+  }
+  fragment_starts[num_fragments] = num_rows;
+  // Fixed-size fragments do not need their starts on the device
+  uint32_t const *d_fragment_starts = nullptr;
+  if (num_parts > 1 && num_fragments != 0) {
+    CUDA_TRY(cudaMemcpyAsync(fragment_starts.device_ptr(),
+                             fragment_starts.host_ptr(),
+                             fragment_starts.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    d_fragment_starts = fragment_starts.device_ptr();
+  }
   hostdevice_vector<gpu::PageFragment> fragments(num_columns * num_fragments);
   if (fragments.size() != 0) {
-    init_page_fragments(
-      fragments, col_desc, num_columns, num_fragments, num_rows, fragment_size, state.stream);
+    init_page_fragments(fragments,
+                        col_desc,
+                        num_columns,
+                        num_fragments,
+                        num_rows,
+                        fragment_size,
+                        d_fragment_starts,
+                        stream);
   }
 
-  size_t global_rowgroup_base = state.md.row_groups.size();
-
-  // Decide row group boundaries based on uncompressed data size
-  size_t rowgroup_size   = 0;
+  // Decide row group boundaries based on uncompressed data size, within each part
   uint32_t num_rowgroups = 0;
-  for (uint32_t f = 0, global_r = global_rowgroup_base, rowgroup_start = 0; f < num_fragments;
-       f++) {
-    size_t fragment_data_size = 0;
-    for (auto i = 0; i < num_columns; i++) {
-      fragment_data_size += fragments[i * num_fragments + f].fragment_data_size;
-    }
-    if (f > rowgroup_start && (rowgroup_size + fragment_data_size > max_rowgroup_size_ ||
-                               (f + 1 - rowgroup_start) * fragment_size > max_rowgroup_rows_)) {
-      // update schema
-      state.md.row_groups.resize(state.md.row_groups.size() + 1);
-      state.md.row_groups[global_r++].num_rows = (f - rowgroup_start) * fragment_size;
-      num_rowgroups++;
-      rowgroup_start = f;
-      rowgroup_size  = 0;
-    }
-    rowgroup_size += fragment_data_size;
-    if (f + 1 == num_fragments) {
-      // update schema
-      state.md.row_groups.resize(state.md.row_groups.size() + 1);
-      state.md.row_groups[global_r++].num_rows = num_rows - rowgroup_start * fragment_size;
-      num_rowgroups++;
+  std::vector<size_type> rowgroup_part;            // Part of each row group
+  std::vector<size_t> rowgroup_index;              // Index of each row group in its part metadata
+  std::vector<uint32_t> rowgroup_first_fragment;   // First fragment of each row group
+  auto add_rowgroup = [&](size_type part, uint32_t first_fragment, uint32_t end_fragment) {
+    auto &md = states[part]->md;
+    rowgroup_part.push_back(part);
+    rowgroup_index.push_back(md.row_groups.size());
+    rowgroup_first_fragment.push_back(first_fragment);
+    md.row_groups.resize(md.row_groups.size() + 1);
+    md.row_groups.back().num_rows =
+      fragment_starts[end_fragment] - fragment_starts[first_fragment];
+    num_rowgroups++;
+  };
+  for (size_type p = 0; p < num_parts; p++) {
+    size_t rowgroup_size    = 0;
+    uint32_t rowgroup_start = part_first_fragment[p];
+    for (uint32_t f = rowgroup_start; f < part_first_fragment[p + 1]; f++) {
+      size_t fragment_data_size = 0;
+      for (auto i = 0; i < num_columns; i++) {
+        fragment_data_size += fragments[i * num_fragments + f].fragment_data_size;
+      }
+      if (f > rowgroup_start &&
+          (rowgroup_size + fragment_data_size > max_rowgroup_size_ ||
+           fragment_starts[f + 1] - fragment_starts[rowgroup_start] > max_rowgroup_rows_)) {
+        add_rowgroup(p, rowgroup_start, f);
+        rowgroup_start = f;
+        rowgroup_size  = 0;
+      }
+      rowgroup_size += fragment_data_size;
+      if (f + 1 == part_first_fragment[p + 1]) { add_rowgroup(p, rowgroup_start, f + 1); }
     }
   }
+  auto rowgroup_md = [&](uint32_t r) -> RowGroup & {
+    return states[rowgroup_part[r]]->md.row_groups[rowgroup_index[r]];
+  };
 
   // Allocate column chunks and gather fragment statistics
   rmm::device_vector<statistics_chunk> frag_stats;
@@ -676,7 +1058,8 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                                  num_columns,
                                  num_fragments,
                                  fragment_size,
-                                 state.stream);
+                                 d_fragment_starts,
+                                 stream);
     }
   }
 
@@ -684,12 +1067,14 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   uint32_t num_chunks = num_rowgroups * num_columns;
   hostdevice_vector<gpu::EncColumnChunk> chunks(num_chunks);
   uint32_t num_dictionaries = 0;
-  for (uint32_t r = 0, global_r = global_rowgroup_base, f = 0, start_row = 0; r < num_rowgroups;
-       r++, global_r++) {
+  for (uint32_t r = 0; r < num_rowgroups; r++) {
+    auto &row_group = rowgroup_md(r);
+    uint32_t f      = rowgroup_first_fragment[r];
     uint32_t fragments_in_chunk =
-      (uint32_t)((state.md.row_groups[global_r].num_rows + fragment_size - 1) / fragment_size);
-    state.md.row_groups[global_r].total_byte_size = 0;
-    state.md.row_groups[global_r].columns.resize(num_columns);
+      ((r + 1 < num_rowgroups) ? rowgroup_first_fragment[r + 1] : num_fragments) - f;
+    uint32_t start_row        = fragment_starts[f];
+    row_group.total_byte_size = 0;
+    row_group.columns.resize(num_columns);
     for (int i = 0; i < num_columns; i++) {
       gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
       bool dict_enable        = false;
@@ -702,45 +1087,49 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       ck->fragments        = fragments.device_ptr() + i * num_fragments + f;
       ck->stats =
         (frag_stats.size() != 0) ? frag_stats.data().get() + i * num_fragments + f : nullptr;
-      ck->start_row      = start_row;
-      ck->num_rows       = (uint32_t)state.md.row_groups[global_r].num_rows;
-      ck->first_fragment = i * num_fragments + f;
-      ck->first_page     = 0;
-      ck->num_pages      = 0;
-      ck->is_compressed  = 0;
-      ck->dictionary_id  = num_dictionaries;
-      ck->ck_stat_size   = 0;
+      ck->start_row         = start_row;
+      ck->num_rows          = (uint32_t)row_group.num_rows;
+      ck->first_fragment    = i * num_fragments + f;
+      ck->first_page        = 0;
+      ck->num_pages         = 0;
+      ck->is_compressed     = 0;
+      ck->global_dictionary = 0;
+      ck->dictionary_id     = num_dictionaries;
+      ck->ck_stat_size      = 0;
       if (col_desc[i].dict_data) {
         const gpu::PageFragment *ck_frag = &fragments[i * num_fragments + f];
         size_t plain_size                = 0;
         size_t dict_size                 = 1;
         uint32_t num_dict_vals           = 0;
-        for (uint32_t j = 0; j < fragments_in_chunk && num_dict_vals < 65536; j++) {
+        uint32_t j                       = 0;
+        for (; j < fragments_in_chunk && num_dict_vals < gpu::kMaxLocalDictEntries; j++) {
           plain_size += ck_frag[j].fragment_data_size;
           dict_size +=
             ck_frag[j].dict_data_size + ((num_dict_vals > 256) ? 2 : 1) * ck_frag[j].non_nulls;
           num_dict_vals += ck_frag[j].num_dict_vals;
         }
-        if (dict_size < plain_size) {
+        if (j < fragments_in_chunk || num_dict_vals > gpu::kMaxLocalDictEntries) {
+          // Too many values for the fixed-size hash, and the fragment dictionaries say little
+          // about the chunk dictionary: build it with a global hash map and decide afterwards
+          ck->global_dictionary = 1;
+        }
+        if (dict_size < plain_size || ck->global_dictionary) {
           parquet_columns[i].use_dictionary(true);
           dict_enable = true;
           num_dictionaries++;
         }
       }
-      ck->has_dictionary                                           = dict_enable;
-      state.md.row_groups[global_r].columns[i].meta_data.type      = state.md.schema[1 + i].type;
-      state.md.row_groups[global_r].columns[i].meta_data.encodings = {PLAIN, RLE};
-      if (dict_enable) {
-        state.md.row_groups[global_r].columns[i].meta_data.encodings.push_back(PLAIN_DICTIONARY);
+      ck->has_dictionary                            = dict_enable;
+      row_group.columns[i].meta_data.type           = schema[1 + i].type;
+      row_group.columns[i].meta_data.encodings      = {PLAIN, RLE};
+      if (col_desc[i].value_encoding != PLAIN) {
+        row_group.columns[i].meta_data.encodings.push_back(
+          static_cast<Encoding>(col_desc[i].value_encoding));
       }
-      state.md.row_groups[global_r].columns[i].meta_data.path_in_schema = {
-        state.md.schema[1 + i].name};
-      state.md.row_groups[global_r].columns[i].meta_data.codec = UNCOMPRESSED;
-      state.md.row_groups[global_r].columns[i].meta_data.num_values =
-        state.md.row_groups[global_r].num_rows;
+      row_group.columns[i].meta_data.path_in_schema = {schema[1 + i].name};
+      row_group.columns[i].meta_data.codec          = UNCOMPRESSED;
+      row_group.columns[i].meta_data.num_values     = row_group.num_rows;
     }
-    f += fragments_in_chunk;
-    start_row += (uint32_t)state.md.row_groups[global_r].num_rows;
   }
 
   // Free unused dictionaries
@@ -748,16 +1137,61 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
 
   // Build chunk dictionaries and count pages
   if (num_chunks != 0) {
-    build_chunk_dictionaries(
-      chunks, col_desc, num_rowgroups, num_columns, num_dictionaries, state.stream);
+    build_chunk_dictionaries(chunks,
+                             col_desc,
+                             fragments.host_ptr(),
+                             num_rowgroups,
+                             num_columns,
+                             num_dictionaries,
+                             stream);
+  }
+  for (uint32_t r = 0; r < num_rowgroups; r++) {
+    for (int i = 0; i < num_columns; i++) {
+      if (chunks[r * num_columns + i].has_dictionary) {
+        rowgroup_md(r).columns[i].meta_data.encodings.push_back(PLAIN_DICTIONARY);
+      }
+    }
   }
 
-  // Initialize batches of rowgroups to encode (mainly to limit peak memory usage)
+  // Bloom filters are sized for the distinct values of their chunk: the entries of the dictionary,
+  // and at most the non-null values of the fragments that are not dictionary-encoded
+  std::vector<size_t> bloom_filter_starts(num_chunks + 1, 0);
+  for (uint32_t r = 0; r < num_rowgroups; r++) {
+    uint32_t f = rowgroup_first_fragment[r];
+    uint32_t fragments_in_chunk =
+      ((r + 1 < num_rowgroups) ? rowgroup_first_fragment[r + 1] : num_fragments) - f;
+    for (int i = 0; i < num_columns; i++) {
+      auto const c            = r * num_columns + i;
+      gpu::EncColumnChunk *ck = &chunks[c];
+      ck->bloom_filter_blocks = 0;
+      auto const fpp =
+        (static_cast<size_t>(i) < bloom_filter_fpp_.size()) ? bloom_filter_fpp_[i] : 0.0;
+      if (fpp > 0.0) {
+        const gpu::PageFragment *ck_frag = &fragments[i * num_fragments + f];
+        size_t num_distinct              = (ck->has_dictionary) ? ck->total_dict_entries : 0;
+        for (uint32_t j = (ck->has_dictionary) ? ck->num_dict_fragments : 0;
+             j < fragments_in_chunk;
+             j++) {
+          num_distinct += ck_frag[j].non_nulls;
+        }
+        ck->bloom_filter_blocks = bloom_filter_num_blocks(num_distinct, fpp);
+      }
+      bloom_filter_starts[c + 1] = bloom_filter_starts[c] + ck->bloom_filter_blocks * 8;
+    }
+  }
+  rmm::device_vector<uint32_t> bloom_filters(bloom_filter_starts.back(), 0);
+  for (uint32_t c = 0; c < num_chunks; c++) {
+    chunks[c].bloom_filter = (chunks[c].bloom_filter_blocks != 0)
+                               ? bloom_filters.data().get() + bloom_filter_starts[c]
+                               : nullptr;
+  }
+
+  // Initialize batches of rowgroups to encode, to limit peak memory usage: one batch is written to
+  // the sink while the next one is encoded, so at most two batches are held in device memory
   std::vector<uint32_t> batch_list;
   uint32_t num_pages          = 0;
-  size_t max_bytes_in_batch   = 1024 * 1024 * 1024;  // 1GB - TBD: Tune this
+  size_t max_bytes_in_batch   = max_rowgroup_size_;
   size_t max_uncomp_bfr_size  = 0;
-  size_t max_chunk_bfr_size   = 0;
   uint32_t max_pages_in_batch = 0;
   size_t bytes_in_batch       = 0;
   for (uint32_t r = 0, groups_in_batch = 0, pages_in_batch = 0; r <= num_rowgroups; r++) {
@@ -769,8 +1203,6 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
         num_pages += ck->num_pages;
         pages_in_batch += ck->num_pages;
         rowgroup_size += ck->bfr_size;
-        max_chunk_bfr_size =
-          std::max(max_chunk_bfr_size, (size_t)std::max(ck->bfr_size, ck->compressed_size));
       }
     }
     // TBD: We may want to also shorten the batch if we have enough pages (not just based on size)
@@ -798,15 +1230,25 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     (compression_ != parquet::Compression::UNCOMPRESSED) ? max_pages_in_batch : 0;
   uint32_t num_stats_bfr =
     (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_pages + num_chunks : 0;
-  rmm::device_buffer uncomp_bfr(max_uncomp_bfr_size, state.stream);
-  rmm::device_buffer comp_bfr(max_comp_bfr_size, state.stream);
+  // Consecutive batches alternate between two sets of buffers
+  auto const num_bfr_sets = std::min<size_t>(batch_list.size(), 2);
+  std::vector<rmm::device_buffer> uncomp_bfr;
+  std::vector<rmm::device_buffer> comp_bfr;
+  for (size_t i = 0; i < num_bfr_sets; ++i) {
+    uncomp_bfr.emplace_back(max_uncomp_bfr_size, stream);
+    comp_bfr.emplace_back(max_comp_bfr_size, stream);
+  }
   rmm::device_vector<gpu_inflate_input_s> comp_in(max_comp_pages);
   rmm::device_vector<gpu_inflate_status_s> comp_out(max_comp_pages);
   rmm::device_vector<gpu::EncPage> pages(num_pages);
   rmm::device_vector<statistics_chunk> page_stats(num_stats_bfr);
+  // Page-level statistics are also written as a page index, which lets readers skip pages
+  bool const write_page_index = (stats_granularity_ == statistics_freq::STATISTICS_PAGE);
+  std::vector<OffsetIndex> offset_indexes(write_page_index ? num_chunks : 0);
+  std::vector<ColumnIndex> column_indexes(write_page_index ? num_chunks : 0);
   for (uint32_t b = 0, r = 0; b < (uint32_t)batch_list.size(); b++) {
-    uint8_t *bfr   = reinterpret_cast<uint8_t *>(uncomp_bfr.data());
-    uint8_t *bfr_c = reinterpret_cast<uint8_t *>(comp_bfr.data());
+    uint8_t *bfr   = reinterpret_cast<uint8_t *>(uncomp_bfr[b & 1].data());
+    uint8_t *bfr_c = reinterpret_cast<uint8_t *>(comp_bfr[b & 1].data());
     for (uint32_t j = 0; j < batch_list[b]; j++, r++) {
       for (int i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
@@ -828,26 +1270,143 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                        num_columns,
                        num_pages,
                        num_stats_bfr,
-                       state.stream);
+                       stream);
   }
 
-  auto host_bfr = [&]() {
-    // if the writer supports device_write(), we don't need this scratch space
-    if (out_sink_->supports_device_write()) {
-      return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
-    } else {
-      return pinned_buffer<uint8_t>{[](size_t size) {
-                                      uint8_t *ptr = nullptr;
-                                      CUDA_TRY(cudaMallocHost(&ptr, size));
-                                      return ptr;
-                                    }(max_chunk_bfr_size),
-                                    cudaFreeHost};
+  // Writes the column chunks of the row groups [r, rnext) to the sinks of their parts; the pipeline
+  // overlaps the device-to-host copies with the host writes, or writes directly from device memory
+  // if the sink supports it. Each part is opened before its first row group is written, and closed
+  // after its last one.
+  std::unique_ptr<device_write_pipeline> pipeline;
+  data_sink *part_sink         = nullptr;
+  uint32_t part_first_rowgroup = 0;
+
+  // Writes the page indexes of the row groups [r, rnext) of a part after their column chunks; the
+  // ColumnIndex structures of all chunks come first, followed by their OffsetIndex structures
+  auto write_page_indexes = [&](pq_chunked_state &state, uint32_t r, uint32_t rnext) {
+    std::vector<uint8_t> buffer;
+    CompactProtocolWriter cpw(&buffer);
+    auto write_index = [&](auto const &index, int64_t &offset, int32_t &length) {
+      buffer.resize(0);
+      length = static_cast<int32_t>(cpw.write(&index));
+      offset = state.current_chunk_offset;
+      part_sink->host_write(buffer.data(), buffer.size());
+      state.current_chunk_offset += buffer.size();
+    };
+    for (auto rg = r; rg < rnext; rg++) {
+      for (auto i = 0; i < num_columns; i++) {
+        auto const &index = column_indexes[rg * num_columns + i];
+        auto &column      = rowgroup_md(rg).columns[i];
+        if (!index.null_pages.empty()) {
+          write_index(index, column.column_index_offset, column.column_index_length);
+        }
+      }
     }
-  }();
+    for (auto rg = r; rg < rnext; rg++) {
+      for (auto i = 0; i < num_columns; i++) {
+        auto const &index = offset_indexes[rg * num_columns + i];
+        auto &column      = rowgroup_md(rg).columns[i];
+        if (!index.page_locations.empty()) {
+          write_index(index, column.offset_index_offset, column.offset_index_length);
+        }
+      }
+    }
+  };
+
+  // Writes the bloom filters of the row groups [r, rnext) of a part after their column chunks
+  auto write_bloom_filters = [&](pq_chunked_state &state, uint32_t r, uint32_t rnext) {
+    std::vector<uint8_t> buffer;
+    CompactProtocolWriter cpw(&buffer);
+    for (auto c = r * num_columns; c < rnext * num_columns; c++) {
+      auto const &ck = chunks[c];
+      if (ck.bloom_filter == nullptr) { continue; }
+      BloomFilterHeader header;
+      header.num_bytes = ck.bloom_filter_blocks * gpu::kBloomFilterBlockSize;
+      buffer.resize(0);
+      cpw.write(&header);
+      auto const header_size = buffer.size();
+      buffer.resize(header_size + header.num_bytes);
+      CUDA_TRY(cudaMemcpyAsync(buffer.data() + header_size,
+                               ck.bloom_filter,
+                               header.num_bytes,
+                               cudaMemcpyDeviceToHost,
+                               write_stream_));
+      CUDA_TRY(cudaStreamSynchronize(write_stream_));
+      auto &column_md = rowgroup_md(c / num_columns).columns[c % num_columns].meta_data;
+      column_md.bloom_filter_offset = state.current_chunk_offset;
+      column_md.bloom_filter_length = static_cast<int32_t>(buffer.size());
+      part_sink->host_write(buffer.data(), buffer.size());
+      state.current_chunk_offset += buffer.size();
+    }
+  };
 
-  // Encode row groups in batches
-  for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
-       b++) {
+  auto write_batch = [&](uint32_t r, uint32_t rnext) {
+    size_t write_bytes = 0;
+    for (uint32_t c = r * num_columns; c < rnext * num_columns; c++) {
+      write_bytes += chunks[c].compressed_size;
+    }
+    CUDF_SCOPED_RANGE_PAYLOAD("parquet::write_column_chunks", write_bytes);
+    for (; r < rnext; r++) {
+      auto const part = rowgroup_part[r];
+      auto &state     = *states[part];
+      auto &row_group = rowgroup_md(r);
+      if (r == 0 || rowgroup_part[r - 1] != part) {
+        part_sink           = open_part(part);
+        part_first_rowgroup = r;
+        pipeline            = std::make_unique<device_write_pipeline>(part_sink, write_stream_);
+      }
+      for (auto i = 0; i < num_columns; i++) {
+        gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
+        auto &column_md         = row_group.columns[i].meta_data;
+        uint8_t *dev_bfr;
+        if (ck->is_compressed) {
+          column_md.codec = compression_;
+          dev_bfr         = ck->compressed_bfr;
+        } else {
+          dev_bfr = ck->uncompressed_bfr;
+        }
+
+        if (ck->ck_stat_size != 0) {
+          column_md.statistics_blob.resize(ck->ck_stat_size);
+          CUDA_TRY(cudaMemcpyAsync(column_md.statistics_blob.data(),
+                                   dev_bfr,
+                                   ck->ck_stat_size,
+                                   cudaMemcpyDeviceToHost,
+                                   write_stream_));
+        }
+        pipeline->write(dev_bfr + ck->ck_stat_size, ck->compressed_size);
+        if (write_page_index) {
+          for (auto &location : offset_indexes[r * num_columns + i].page_locations) {
+            location.offset += state.current_chunk_offset;
+          }
+        }
+
+        row_group.total_byte_size += ck->compressed_size;
+        column_md.data_page_offset =
+          state.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
+        column_md.dictionary_page_offset = (ck->has_dictionary) ? state.current_chunk_offset : 0;
+        column_md.total_uncompressed_size = ck->bfr_size;
+        column_md.total_compressed_size   = ck->compressed_size;
+        state.current_chunk_offset += ck->compressed_size;
+      }
+      if (r + 1 == num_rowgroups || rowgroup_part[r + 1] != part) {
+        pipeline->flush();
+        pipeline.reset();
+        CUDA_TRY(cudaStreamSynchronize(write_stream_));
+        write_bloom_filters(state, part_first_rowgroup, r + 1);
+        if (write_page_index) { write_page_indexes(state, part_first_rowgroup, r + 1); }
+        close_part(part);
+      }
+    }
+    if (pipeline) { pipeline->flush(); }
+    CUDA_TRY(cudaStreamSynchronize(write_stream_));
+  };
+
+  // Encode row groups in batches, each batch being written in the background while the next one is
+  // encoded. The write of a batch only reads the host copy of its own chunks, and must complete
+  // before its buffers are reused by the batch after next.
+  std::future<void> batch_write;
+  for (uint32_t b = 0, r = 0; b < (uint32_t)batch_list.size(); b++) {
     // Count pages in this batch
     uint32_t rnext               = r + batch_list[b];
     uint32_t first_page_in_batch = chunks[r * num_columns].first_page;
@@ -867,75 +1426,48 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data().get() : nullptr,
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data().get() + num_pages
                                                                : nullptr,
-      state.stream);
-    for (; r < rnext; r++, global_r++) {
-      for (auto i = 0; i < num_columns; i++) {
-        gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
-        uint8_t *dev_bfr;
-        if (ck->is_compressed) {
-          state.md.row_groups[global_r].columns[i].meta_data.codec = compression_;
-          dev_bfr                                                  = ck->compressed_bfr;
-        } else {
-          dev_bfr = ck->uncompressed_bfr;
-        }
-
-        if (out_sink_->supports_device_write()) {
-          // let the writer do what it wants to retrieve the data from the gpu.
-          out_sink_->device_write(dev_bfr + ck->ck_stat_size, ck->compressed_size, state.stream);
-          // we still need to do a (much smaller) memcpy for the statistics.
-          if (ck->ck_stat_size != 0) {
-            state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(
-              ck->ck_stat_size);
-            CUDA_TRY(cudaMemcpyAsync(
-              state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
-              dev_bfr,
-              ck->ck_stat_size,
-              cudaMemcpyDeviceToHost,
-              state.stream));
-            CUDA_TRY(cudaStreamSynchronize(state.stream));
-          }
-        } else {
-          // copy the full data
-          CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
-                                   dev_bfr,
-                                   ck->ck_stat_size + ck->compressed_size,
-                                   cudaMemcpyDeviceToHost,
-                                   state.stream));
-          CUDA_TRY(cudaStreamSynchronize(state.stream));
-          out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
-          if (ck->ck_stat_size != 0) {
-            state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(
-              ck->ck_stat_size);
-            memcpy(state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
-                   host_bfr.get(),
-                   ck->ck_stat_size);
-          }
-        }
-        state.md.row_groups[global_r].total_byte_size += ck->compressed_size;
-        state.md.row_groups[global_r].columns[i].meta_data.data_page_offset =
-          state.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
-        state.md.row_groups[global_r].columns[i].meta_data.dictionary_page_offset =
-          (ck->has_dictionary) ? state.current_chunk_offset : 0;
-        state.md.row_groups[global_r].columns[i].meta_data.total_uncompressed_size = ck->bfr_size;
-        state.md.row_groups[global_r].columns[i].meta_data.total_compressed_size =
-          ck->compressed_size;
-        state.current_chunk_offset += ck->compressed_size;
-      }
+      stream);
+    if (write_page_index) {
+      build_page_indexes(chunks,
+                         col_desc,
+                         pages.data().get(),
+                         page_stats.data().get(),
+                         num_columns,
+                         batch_list[b],
+                         r,
+                         offset_indexes,
+                         column_indexes,
+                         stream);
     }
+
+    if (batch_write.valid()) { batch_write.get(); }
+    batch_write = std::async(std::launch::async, write_batch, r, rnext);
+    r           = rnext;
   }
+  if (batch_write.valid()) { batch_write.get(); }
 }
 
 std::unique_ptr<std::vector<uint8_t>> writer::impl::write_chunked_end(
   pq_chunked_state &state, bool return_filemetadata, const std::string &metadata_out_file_path)
 {
+  return write_file_footer(state, out_sink_.get(), return_filemetadata, metadata_out_file_path);
+}
+
+std::unique_ptr<std::vector<uint8_t>> writer::impl::write_file_footer(
+  pq_chunked_state &state,
+  data_sink *sink,
+  bool return_filemetadata,
+  const std::string &metadata_out_file_path)
+{
+  CUDF_SCOPED_RANGE("parquet::write_footer");
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
   buffer_.resize(0);
   fendr.footer_len = static_cast<uint32_t>(cpw.write(&state.md));
   fendr.magic      = PARQUET_MAGIC;
-  out_sink_->host_write(buffer_.data(), buffer_.size());
-  out_sink_->host_write(&fendr, sizeof(fendr));
-  out_sink_->flush();
+  sink->host_write(buffer_.data(), buffer_.size());
+  sink->host_write(&fendr, sizeof(fendr));
+  sink->flush();
 
   // Optionally output raw file metadata with the specified column chunk file path
   if (return_filemetadata) {
@@ -997,6 +1529,16 @@ std::unique_ptr<std::vector<uint8_t>> writer::write_chunked_end(
   return _impl->write_chunked_end(state, return_filemetadata, metadata_out_file_path);
 }
 
+// Forward to implementation
+std::unique_ptr<table> writer::write_partitioned(table_view const &table,
+                                                 std::vector<size_type> const &partition_columns,
+                                                 partition_sink_factory const &sink_factory,
+                                                 const table_metadata *metadata,
+                                                 cudaStream_t stream)
+{
+  return _impl->write_partitioned(table, partition_columns, sink_factory, metadata, stream);
+}
+
 std::unique_ptr<std::vector<uint8_t>> writer::merge_rowgroup_metadata(
   const std::vector<std::unique_ptr<std::vector<uint8_t>>> &metadata_list)
 {
@@ -32,6 +32,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -52,12 +53,8 @@ using namespace cudf::io;
  * @brief Implementation for parquet writer
  **/
 class writer::impl {
-  // Parquet datasets are divided into fixed-size, independent rowgroups
-  static constexpr uint32_t DEFAULT_ROWGROUP_MAXSIZE = 128 * 1024 * 1024;  // 128MB
-  static constexpr uint32_t DEFAULT_ROWGROUP_MAXROWS = 1000000;            // Or at most 1M rows
-
-  // rowgroups are divided into pages
-  static constexpr uint32_t DEFAULT_TARGET_PAGE_SIZE = 512 * 1024;
+  // Parquet datasets are divided into fixed-size, independent rowgroups, of at most 1M rows
+  static constexpr uint32_t DEFAULT_ROWGROUP_MAXROWS = 1000000;
 
  public:
   /**
@@ -71,6 +68,11 @@ class writer::impl {
                 writer_options const& options,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Destructor.
+   **/
+  ~impl();
+
   /**
    * @brief Write an entire dataset to parquet format.
    *
@@ -118,7 +120,67 @@ class writer::impl {
     bool return_filemetadata                  = false,
     const std::string& metadata_out_file_path = "");
 
+  /**
+   * @brief Writes the rows of each partition of a table to a separate parquet file.
+   *
+   * @param table The set of columns, including the partition columns
+   * @param partition_columns Indices of the columns the rows are partitioned by
+   * @param sink_factory Returns the sink of each partition
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return The distinct partition keys, in the order of the partitions
+   **/
+  std::unique_ptr<table> write_partitioned(table_view const& table,
+                                           std::vector<size_type> const& partition_columns,
+                                           partition_sink_factory const& sink_factory,
+                                           const table_metadata* metadata,
+                                           cudaStream_t stream);
+
  private:
+  /**
+   * @brief Writes the file header and sets the write position after it.
+   *
+   * @param state State of the file being written
+   * @param sink Sink of the file
+   **/
+  void write_file_header(pq_chunked_state& state, data_sink* sink);
+
+  /**
+   * @brief Encodes consecutive row ranges of a table, each one to a separate parquet file.
+   *
+   * Row groups do not span two ranges, but are encoded in batches regardless of the range they
+   * belong to; each batch is written in the background while the next one is encoded.
+   *
+   * @param table The set of columns
+   * @param part_offsets Offsets of the row ranges, followed by the number of rows
+   * @param states State of the file of each range
+   * @param open_part Returns the sink of a range, before any of its row groups is written
+   * @param close_part Called once all the row groups of a range have been written to its sink
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void write_parts(table_view const& table,
+                   std::vector<size_type> const& part_offsets,
+                   std::vector<pq_chunked_state*> const& states,
+                   std::function<data_sink*(size_type)> const& open_part,
+                   std::function<void(size_type)> const& close_part,
+                   cudaStream_t stream);
+
+  /**
+   * @brief Writes the file footer and flushes the sink.
+   *
+   * @param state State of the file being written
+   * @param sink Sink of the file
+   * @param return_filemetadata If true, return the raw parquet file metadata
+   * @param metadata_out_file_path Column chunks file path to be set in the raw output metadata
+   * @return unique_ptr to FileMetadata thrift message if requested
+   **/
+  std::unique_ptr<std::vector<uint8_t>> write_file_footer(
+    pq_chunked_state& state,
+    data_sink* sink,
+    bool return_filemetadata,
+    const std::string& metadata_out_file_path);
+
+
   /**
    * @brief Gather page fragments
    *
@@ -128,6 +190,8 @@ class writer::impl {
    * @param num_fragments Total number of fragments per column
    * @param num_rows Total number of rows
    * @param fragment_size Number of rows per fragment
+   * @param fragment_starts Optional device array of the first row of each fragment, followed by the
+   * number of rows; fragments are `fragment_size` rows long if null
    * @param stream CUDA stream used for device memory operations and kernel launches.
    **/
   void init_page_fragments(hostdevice_vector<gpu::PageFragment>& frag,
@@ -136,6 +200,7 @@ class writer::impl {
                            uint32_t num_fragments,
                            uint32_t num_rows,
                            uint32_t fragment_size,
+                           uint32_t const* fragment_starts,
                            cudaStream_t stream);
   /**
    * @brief Gather per-fragment statistics
@@ -146,6 +211,7 @@ class writer::impl {
    * @param num_columns Total number of columns
    * @param num_fragments Total number of fragments per column
    * @param fragment_size Number of rows per fragment
+   * @param fragment_starts Optional device array of the first row of each fragment
    * @param stream CUDA stream used for device memory operations and kernel launches.
    **/
   void gather_fragment_statistics(statistics_chunk* dst_stats,
@@ -154,12 +220,14 @@ class writer::impl {
                                   uint32_t num_columns,
                                   uint32_t num_fragments,
                                   uint32_t fragment_size,
+                                  uint32_t const* fragment_starts,
                                   cudaStream_t stream);
   /**
    * @brief Build per-chunk dictionaries and count data pages
    *
    * @param chunks column chunk array
    * @param col_desc column description array
+   * @param fragments host copy of the page fragment array
    * @param num_rowgroups Total number of rowgroups
    * @param num_columns Total number of columns
    * @param num_dictionaries Total number of dictionaries
@@ -167,6 +235,7 @@ class writer::impl {
    **/
   void build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChunk>& chunks,
                                 hostdevice_vector<gpu::EncColumnDesc>& col_desc,
+                                const gpu::PageFragment* fragments,
                                 uint32_t num_rowgroups,
                                 uint32_t num_columns,
                                 uint32_t num_dictionaries,
@@ -221,19 +290,52 @@ class writer::impl {
                     const statistics_chunk* page_stats,
                     const statistics_chunk* chunk_stats,
                     cudaStream_t stream);
+  /**
+   * @brief Build the page indexes of a batch of encoded column chunks
+   *
+   * Page offsets are relative to the start of their column chunk.
+   *
+   * @param chunks column chunk array
+   * @param col_desc column description array
+   * @param pages encoder pages array
+   * @param page_stats page-level statistics
+   * @param num_columns Total number of columns
+   * @param rowgroups_in_batch number of rowgroups in this batch
+   * @param first_rowgroup first rowgroup in batch
+   * @param offset_indexes OffsetIndex of each column chunk
+   * @param column_indexes ColumnIndex of each column chunk, left empty if the statistics of a page
+   * cannot be represented
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void build_page_indexes(hostdevice_vector<gpu::EncColumnChunk>& chunks,
+                          hostdevice_vector<gpu::EncColumnDesc>& col_desc,
+                          const gpu::EncPage* pages,
+                          const statistics_chunk* page_stats,
+                          uint32_t num_columns,
+                          uint32_t rowgroups_in_batch,
+                          uint32_t first_rowgroup,
+                          std::vector<OffsetIndex>& offset_indexes,
+                          std::vector<ColumnIndex>& column_indexes,
+                          cudaStream_t stream);
 
  private:
   // TODO : figure out if we want to keep this. It is currently unused.
   rmm::mr::device_memory_resource* _mr = nullptr;
 
-  size_t max_rowgroup_size_          = DEFAULT_ROWGROUP_MAXSIZE;
+  size_t max_rowgroup_size_          = default_row_group_size;
   size_t max_rowgroup_rows_          = DEFAULT_ROWGROUP_MAXROWS;
-  size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
+  size_t target_page_size_           = default_page_size;
+  size_t max_dictionary_size_        = default_max_dictionary_size;
   Compression compression_           = Compression::UNCOMPRESSED;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
+  bool delta_encodings_              = false;
+  std::vector<double> bloom_filter_fpp_;
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
+
+  // Stream of the device-to-host copies of the column chunks being written
+  cudaStream_t write_stream_ = nullptr;
 };
 
 }  // namespace parquet
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file coalesced_read.hpp
+ * @brief cuDF-IO utility to read many ranges of a datasource with fewer, concurrent reads
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Parameters of `coalesced_host_read_async()`
+ */
+struct read_coalescing_options {
+  size_t max_gap;        ///< Ranges at most this far apart are read together
+  size_t max_read_size;  ///< Coalesced reads do not grow beyond this size
+  size_t num_workers;    ///< Maximum number of concurrent `host_read()` calls
+};
+
+/**
+ * @brief Reads several ranges with `host_read()` calls on a pool of threads, merging the ranges
+ * that are close together into single reads.
+ *
+ * This is the implementation of `datasource::host_read_async()`, for sources to call with their
+ * own coalescing parameters; sources with a high per-request latency merge across larger gaps.
+ *
+ * @param source Source to read from; must outlive the returned futures
+ * @param ranges Ranges to read, in any order; they may overlap
+ * @param options Coalescing and concurrency parameters
+ *
+ * @return One future per range, in the order of `ranges`
+ */
+std::vector<std::future<std::unique_ptr<datasource::buffer>>> coalesced_host_read_async(
+  datasource *source,
+  std::vector<datasource::read_range> const &ranges,
+  read_coalescing_options const &options);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
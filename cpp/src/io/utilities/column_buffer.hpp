@@ -87,6 +87,9 @@ struct column_buffer {
       // their individual rows
       case type_id::LIST: _data = create_data(data_type{type_id::INT32}, size, stream, mr); break;
 
+      // struct columns store no data of their own, only the children
+      case type_id::STRUCT: break;
+
       default: _data = create_data(type, size, stream, mr); break;
     }
     if (is_nullable) { _null_mask = create_null_mask(size, mask_state::ALL_NULL, stream, mr); }
@@ -156,6 +159,20 @@ std::unique_ptr<column> make_column(
                                mr);
     } break;
 
+    case type_id::STRUCT: {
+      std::vector<std::unique_ptr<cudf::column>> output_children;
+      output_children.reserve(buffer.children.size());
+      for (auto& child : buffer.children) {
+        output_children.emplace_back(make_column(child, stream, mr));
+      }
+      return make_structs_column(buffer.size,
+                                 std::move(output_children),
+                                 buffer._null_count,
+                                 std::move(buffer._null_mask),
+                                 stream,
+                                 mr);
+    } break;
+
     default: {
       return std::make_unique<column>(buffer.type,
                                       buffer.size,
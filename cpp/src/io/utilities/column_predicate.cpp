@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "column_predicate.hpp"
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Functor to copy the value of a scalar to a `predicate_literal`
+ */
+struct literal_from_scalar {
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value, predicate_literal>
+  operator()(scalar const& s, cudaStream_t stream)
+  {
+    predicate_literal lit;
+    lit.kind    = literal_kind::SIGNED;
+    lit.int_val = static_cast<numeric_scalar<T> const&>(s).value(stream);
+    return lit;
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value && !std::is_signed<T>::value, predicate_literal>
+  operator()(scalar const& s, cudaStream_t stream)
+  {
+    predicate_literal lit;
+    lit.kind     = literal_kind::UNSIGNED;
+    lit.uint_val = static_cast<numeric_scalar<T> const&>(s).value(stream);
+    return lit;
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_floating_point<T>::value, predicate_literal> operator()(
+    scalar const& s, cudaStream_t stream)
+  {
+    predicate_literal lit;
+    lit.kind   = literal_kind::FLOAT;
+    lit.fp_val = static_cast<numeric_scalar<T> const&>(s).value(stream);
+    return lit;
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_timestamp<T>(), predicate_literal> operator()(scalar const& s,
+                                                                          cudaStream_t stream)
+  {
+    using period  = typename T::period;
+    auto const ts = static_cast<timestamp_scalar<T> const&>(s).value(stream);
+    predicate_literal lit;
+    lit.kind        = literal_kind::SIGNED;
+    lit.int_val     = ts.time_since_epoch().count();
+    lit.ns_per_tick = 1000000000ll * period::num / period::den;
+    return lit;
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_duration<T>(), predicate_literal> operator()(scalar const& s,
+                                                                         cudaStream_t stream)
+  {
+    using period = typename T::period;
+    predicate_literal lit;
+    lit.kind        = literal_kind::SIGNED;
+    lit.int_val     = static_cast<duration_scalar<T> const&>(s).value(stream).count();
+    lit.ns_per_tick = 1000000000ll * period::num / period::den;
+    return lit;
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_same<T, string_view>::value, predicate_literal> operator()(
+    scalar const& s, cudaStream_t stream)
+  {
+    predicate_literal lit;
+    lit.kind    = literal_kind::STRING;
+    lit.str_val = static_cast<string_scalar const&>(s).to_string(stream);
+    return lit;
+  }
+
+  template <typename T>
+  std::enable_if_t<!std::is_arithmetic<T>::value && !cudf::is_chrono<T>() &&
+                     !std::is_same<T, string_view>::value,
+                   predicate_literal>
+  operator()(scalar const&, cudaStream_t)
+  {
+    CUDF_FAIL("Unsupported predicate literal type");
+  }
+};
+
+}  // namespace
+
+std::vector<host_predicate> make_host_predicates(std::vector<column_predicate> const& predicates,
+                                                 cudaStream_t stream)
+{
+  std::vector<host_predicate> result;
+  for (auto const& pred : predicates) {
+    host_predicate hp{pred.column_name, pred.op, {}};
+    if (pred.op != filter_op::IS_NULL && pred.op != filter_op::IS_NOT_NULL) {
+      CUDF_EXPECTS(pred.value != nullptr, "Comparison predicate requires a literal value");
+      CUDF_EXPECTS(pred.value->is_valid(stream), "Predicate literal must not be null");
+      hp.value = type_dispatcher(pred.value->type(), literal_from_scalar{}, *pred.value, stream);
+    }
+    result.emplace_back(std::move(hp));
+  }
+  return result;
+}
+
+bool literal_bounds(predicate_literal const& value, int64_t ns_per_tick, int64_t& lo, int64_t& hi)
+{
+  switch (value.kind) {
+    case literal_kind::SIGNED:
+      lo = hi = value.int_val;
+      // Rescale timestamps/durations to the units of the column
+      if (ns_per_tick != 0 && value.ns_per_tick != 0 && ns_per_tick != value.ns_per_tick) {
+        if (value.ns_per_tick > ns_per_tick) {
+          auto const scale = value.ns_per_tick / ns_per_tick;
+          if (value.int_val > std::numeric_limits<int64_t>::max() / scale ||
+              value.int_val < std::numeric_limits<int64_t>::min() / scale) {
+            return false;
+          }
+          lo = hi = value.int_val * scale;
+        } else {
+          auto const scale = ns_per_tick / value.ns_per_tick;
+          lo               = value.int_val / scale;
+          if (lo * scale > value.int_val) { --lo; }  // round towards -inf
+          hi = (lo * scale == value.int_val) ? lo : lo + 1;
+        }
+      }
+      return true;
+    case literal_kind::UNSIGNED:
+      if (value.uint_val > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+        return false;
+      }
+      lo = hi = static_cast<int64_t>(value.uint_val);
+      return true;
+    case literal_kind::FLOAT:
+      if (std::isnan(value.fp_val) || std::abs(value.fp_val) >= 9.2e18) return false;
+      lo = static_cast<int64_t>(std::floor(value.fp_val));
+      hi = static_cast<int64_t>(std::ceil(value.fp_val));
+      return true;
+    default: return false;
+  }
+}
+
+bool literal_bounds(predicate_literal const& value, uint64_t& lo, uint64_t& hi)
+{
+  switch (value.kind) {
+    case literal_kind::SIGNED:
+      if (value.int_val < 0 || value.ns_per_tick != 0) return false;
+      lo = hi = static_cast<uint64_t>(value.int_val);
+      return true;
+    case literal_kind::UNSIGNED: lo = hi = value.uint_val; return true;
+    case literal_kind::FLOAT:
+      if (std::isnan(value.fp_val) || value.fp_val < 0 || value.fp_val >= 1.8e19) return false;
+      lo = static_cast<uint64_t>(std::floor(value.fp_val));
+      hi = static_cast<uint64_t>(std::ceil(value.fp_val));
+      return true;
+    default: return false;
+  }
+}
+
+bool literal_bounds(predicate_literal const& value, double& lo, double& hi)
+{
+  switch (value.kind) {
+    case literal_kind::SIGNED:
+      if (value.ns_per_tick != 0) return false;
+      lo = hi = static_cast<double>(value.int_val);
+      return true;
+    case literal_kind::UNSIGNED: lo = hi = static_cast<double>(value.uint_val); return true;
+    case literal_kind::FLOAT:
+      if (std::isnan(value.fp_val)) return false;
+      lo = hi = value.fp_val;
+      return true;
+    default: return false;
+  }
+}
+
+bool literal_bounds(predicate_literal const& value, std::string& lo, std::string& hi)
+{
+  if (value.kind != literal_kind::STRING) return false;
+  lo = hi = value.str_val;
+  return true;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file column_predicate.hpp
+ * @brief cuDF-IO utilities for evaluating column predicates against file statistics
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/types.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Kind of value held by a `predicate_literal`
+ */
+enum class literal_kind { NONE, SIGNED, UNSIGNED, FLOAT, STRING };
+
+/**
+ * @brief Host-side copy of a predicate's literal value
+ *
+ * Created once per read so that statistics of every row group/stripe can be checked without
+ * touching device memory again.
+ */
+struct predicate_literal {
+  literal_kind kind   = literal_kind::NONE;
+  int64_t int_val     = 0;  // signed integers, booleans and timestamp/duration ticks
+  uint64_t uint_val   = 0;  // unsigned integers
+  double fp_val       = 0;  // floating-point values
+  std::string str_val = "";
+  int64_t ns_per_tick = 0;  // tick duration of timestamps/durations; 0 for other types
+};
+
+/**
+ * @brief Host-side form of a `column_predicate`
+ */
+struct host_predicate {
+  std::string column_name;
+  filter_op op;
+  predicate_literal value;
+};
+
+/**
+ * @brief Copies the literals of a list of predicates to host memory
+ *
+ * @param predicates Predicates to convert
+ * @param stream CUDA stream used to read the literal scalars
+ *
+ * @throw cudf::logic_error if a comparison predicate has a missing or null literal
+ *
+ * @return Host-side predicates, in the same order
+ */
+std::vector<host_predicate> make_host_predicates(std::vector<column_predicate> const& predicates,
+                                                 cudaStream_t stream = 0);
+
+/**
+ * @brief Determines whether `min <= x <= max` may satisfy `x <op> [lo, hi]`
+ *
+ * The literal is described as the closed interval `[lo, hi]` to allow for a literal that had to
+ * be rounded to the units of the column (`lo == hi` when it is exact). The result is conservative:
+ * `false` is only returned when no value in the range can satisfy the predicate.
+ */
+template <typename T>
+bool range_may_satisfy(filter_op op, T const& min, T const& max, T const& lo, T const& hi)
+{
+  switch (op) {
+    case filter_op::EQUAL: return !(max < lo) && !(hi < min);
+    case filter_op::NOT_EQUAL: return !(min == max && lo == hi && min == lo);
+    case filter_op::LESS: return min < hi;
+    case filter_op::LESS_EQUAL: return !(hi < min);
+    case filter_op::GREATER: return lo < max;
+    case filter_op::GREATER_EQUAL: return !(max < lo);
+    default: return true;
+  }
+}
+
+/**
+ * @brief Converts a literal to the signed integer units of a column
+ *
+ * @param value Literal to convert
+ * @param ns_per_tick Tick duration of the column if it stores a timestamp/duration, 0 otherwise
+ * @param[out] lo Largest column value not greater than the literal
+ * @param[out] hi Smallest column value not less than the literal
+ *
+ * @return `false` if the literal cannot be compared with the column
+ */
+bool literal_bounds(predicate_literal const& value, int64_t ns_per_tick, int64_t& lo, int64_t& hi);
+
+/**
+ * @copydoc literal_bounds(predicate_literal const&, int64_t, int64_t&, int64_t&)
+ */
+bool literal_bounds(predicate_literal const& value, uint64_t& lo, uint64_t& hi);
+
+/**
+ * @copydoc literal_bounds(predicate_literal const&, int64_t, int64_t&, int64_t&)
+ */
+bool literal_bounds(predicate_literal const& value, double& lo, double& hi);
+
+/**
+ * @copydoc literal_bounds(predicate_literal const&, int64_t, int64_t&, int64_t&)
+ */
+bool literal_bounds(predicate_literal const& value, std::string& lo, std::string& hi);
+
+/**
+ * @brief Determines whether data may satisfy a null-testing predicate given its null count
+ *
+ * @param op `IS_NULL` or `IS_NOT_NULL`
+ * @param null_count Number of nulls in the data; negative if unknown
+ * @param num_values Number of values (including nulls) in the data
+ */
+inline bool null_count_may_satisfy(filter_op op, int64_t null_count, int64_t num_values)
+{
+  if (null_count < 0) return true;
+  if (op == filter_op::IS_NULL) return null_count > 0;
+  if (op == filter_op::IS_NOT_NULL) return null_count < num_values;
+  // Comparisons are never true for null values
+  return null_count < num_values;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -16,9 +16,13 @@
 
 #include <fstream>
 
+#include "file_io_utilities.hpp"
+
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <cuda_runtime.h>
+
 namespace cudf {
 namespace io {
 /**
@@ -31,21 +35,41 @@ class file_sink : public data_sink {
   {
     outfile_.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
     CUDF_EXPECTS(outfile_.is_open(), "Cannot open output file");
+
+    cufile_out_ = detail::make_cufile_output(filepath);
   }
 
   virtual ~file_sink() { flush(); }
 
   void host_write(void const* data, size_t size) override
   {
+    // Device writes bypass the stream, so its position may be behind the written data
+    outfile_.seekp(bytes_written_);
     outfile_.write(reinterpret_cast<char const*>(data), size);
+    bytes_written_ += size;
+  }
+
+  bool supports_device_write() const override { return cufile_out_ != nullptr; }
+
+  void device_write(void const* gpu_data, size_t size, cudaStream_t stream) override
+  {
+    CUDF_EXPECTS(supports_device_write(), "Device writes are not supported for this file.");
+
+    // Buffered host writes must reach the file before the direct write around them
+    outfile_.flush();
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    cufile_out_->write(gpu_data, bytes_written_, size);
+    bytes_written_ += size;
   }
 
   void flush() override { outfile_.flush(); }
 
-  size_t bytes_written() override { return outfile_.tellp(); }
+  size_t bytes_written() override { return bytes_written_; }
 
  private:
   std::ofstream outfile_;
+  size_t bytes_written_ = 0;
+  std::unique_ptr<detail::cufile_output> cufile_out_;
 };
 
 /**
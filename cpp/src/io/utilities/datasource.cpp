@@ -14,6 +14,11 @@
  * limitations under the License.
  */
 
+#include "coalesced_read.hpp"
+#include "file_io_utilities.hpp"
+#include "host_parallel_for.hpp"
+#include "remote_datasource.hpp"
+
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -23,8 +28,143 @@
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+
 namespace cudf {
 namespace io {
+namespace {
+/**
+ * @brief Buffer that refers to a part of a shared buffer
+ */
+class buffer_slice : public datasource::buffer {
+  std::shared_ptr<datasource::buffer> _parent;
+  size_t _offset = 0;
+  size_t _size   = 0;
+
+ public:
+  buffer_slice(std::shared_ptr<datasource::buffer> parent, size_t offset, size_t size)
+    : _parent(std::move(parent))
+  {
+    _offset = std::min(offset, _parent->size());
+    _size   = std::min(size, _parent->size() - _offset);
+  }
+  size_t size() const override { return _size; }
+  const uint8_t *data() const override { return _parent->data() + _offset; }
+};
+
+/**
+ * @brief Read of one or more coalesced ranges
+ */
+struct coalesced_read {
+  size_t offset;
+  size_t size;
+  std::promise<std::shared_ptr<datasource::buffer>> result;
+};
+
+/**
+ * @brief Returns whether file mappings are to be pinned, with the `LIBCUDF_MMAP_REGISTER_POLICY`
+ * variable set to `ON`
+ *
+ * Pinning locks the whole mapping in physical memory, so it only pays off for files that are
+ * resident in the page cache.
+ */
+bool is_mmap_register_enabled()
+{
+  auto const policy = std::getenv("LIBCUDF_MMAP_REGISTER_POLICY");
+  return policy != nullptr && std::strcmp(policy, "ON") == 0;
+}
+
+}  // namespace
+
+namespace detail {
+std::vector<std::future<std::unique_ptr<datasource::buffer>>> coalesced_host_read_async(
+  datasource *source,
+  std::vector<datasource::read_range> const &ranges,
+  read_coalescing_options const &options)
+{
+  using buffer = datasource::buffer;
+
+  std::vector<std::future<std::unique_ptr<buffer>>> out;
+  if (ranges.empty()) { return out; }
+
+  std::vector<size_t> order(ranges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return ranges[a].offset < ranges[b].offset;
+  });
+
+  // Coalesce nearby ranges, in ascending offset order
+  auto reads = std::make_shared<std::vector<coalesced_read>>();
+  std::vector<size_t> range_reads(ranges.size());
+  for (auto const idx : order) {
+    auto const &range = ranges[idx];
+    if (!reads->empty()) {
+      auto &last     = reads->back();
+      auto const end = std::max(last.offset + last.size, range.offset + range.size);
+      if (range.offset <= last.offset + last.size + options.max_gap &&
+          end - last.offset <= options.max_read_size) {
+        last.size        = end - last.offset;
+        range_reads[idx] = reads->size() - 1;
+        continue;
+      }
+    }
+    reads->push_back({range.offset, range.size, {}});
+    range_reads[idx] = reads->size() - 1;
+  }
+
+  std::vector<std::shared_future<std::shared_ptr<buffer>>> results;
+  results.reserve(reads->size());
+  for (auto &read : *reads) { results.push_back(read.result.get_future().share()); }
+
+  // Workers are joined once all the returned futures are released
+  auto const num_workers = std::min(reads->size(), std::max<size_t>(options.num_workers, 1));
+  auto next_read         = std::make_shared<std::atomic<size_t>>(0);
+  auto workers           = std::make_shared<std::vector<std::future<void>>>();
+  for (size_t w = 0; w < num_workers; ++w) {
+    workers->push_back(std::async(std::launch::async, [source, reads, next_read]() {
+      for (size_t i = (*next_read)++; i < reads->size(); i = (*next_read)++) {
+        auto &read = (*reads)[i];
+        try {
+          read.result.set_value(source->host_read(read.offset, read.size));
+        } catch (...) {
+          read.result.set_exception(std::current_exception());
+        }
+      }
+    }));
+  }
+
+  out.reserve(ranges.size());
+  for (size_t idx = 0; idx < ranges.size(); ++idx) {
+    auto const read_idx = range_reads[idx];
+    out.push_back(std::async(std::launch::deferred,
+                             [workers,
+                              result = results[read_idx],
+                              offset = ranges[idx].offset - (*reads)[read_idx].offset,
+                              size   = ranges[idx].size]() -> std::unique_ptr<buffer> {
+                               return std::make_unique<buffer_slice>(result.get(), offset, size);
+                             }));
+  }
+  return out;
+}
+
+}  // namespace detail
+
+std::vector<std::future<std::unique_ptr<datasource::buffer>>> datasource::host_read_async(
+  std::vector<read_range> const &ranges)
+{
+  // Ranges at most 8KB apart are read together; coalesced reads stop growing at 32MB, so that
+  // large ranges are still read in parallel
+  return detail::coalesced_host_read_async(
+    this, ranges, {8 * 1024, 32 * 1024 * 1024, detail::default_host_threads()});
+}
 
 /**
  * @brief Implementation class for reading from a file or memory source using
@@ -50,6 +190,15 @@ class memory_mapped_source : public datasource {
     const uint8_t *data() const override { return _data; }
   };
 
+  class device_memory_buffer : public buffer {
+    rmm::device_buffer _buffer;
+
+   public:
+    explicit device_memory_buffer(rmm::device_buffer &&buffer) : _buffer(std::move(buffer)) {}
+    size_t size() const override { return _buffer.size(); }
+    const uint8_t *data() const override { return static_cast<const uint8_t *>(_buffer.data()); }
+  };
+
  public:
   explicit memory_mapped_source(const char *filepath, size_t offset, size_t size)
   {
@@ -60,12 +209,18 @@ class memory_mapped_source : public datasource {
     CUDF_EXPECTS(fstat(file.fd, &st) != -1, "Cannot query file size");
     file_size_ = static_cast<size_t>(st.st_size);
 
-    if (file_size_ != 0) { map(file.fd, offset, size); }
+    if (file_size_ != 0) {
+      map(file.fd, offset, size);
+      _cufile_in = detail::make_cufile_input(filepath);
+    }
   }
 
   virtual ~memory_mapped_source()
   {
-    if (map_addr_ != nullptr) { munmap(map_addr_, map_size_); }
+    if (map_addr_ != nullptr) {
+      if (is_registered_) { cudaHostUnregister(map_addr_); }
+      munmap(map_addr_, map_size_);
+    }
   }
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
@@ -91,9 +246,73 @@ class memory_mapped_source : public datasource {
     return read_size;
   }
 
+  std::vector<std::future<std::unique_ptr<buffer>>> host_read_async(
+    std::vector<read_range> const &ranges) override
+  {
+    // Reads from the mapping do not block, so there is nothing to overlap; only ask the kernel to
+    // start reading the pages in, so that they are resident by the time the caller gets to them
+    for (auto const &range : ranges) { advise_range(range.offset, range.size, MADV_WILLNEED); }
+
+    std::vector<std::future<std::unique_ptr<buffer>>> out;
+    out.reserve(ranges.size());
+    for (auto const &range : ranges) {
+      std::promise<std::unique_ptr<buffer>> result;
+      result.set_value(host_read(range.offset, range.size));
+      out.push_back(result.get_future());
+    }
+    return out;
+  }
+
+  void advise_access_pattern(access_pattern pattern) override
+  {
+    if (map_addr_ == nullptr) { return; }
+    auto const advice = [pattern]() {
+      switch (pattern) {
+        case access_pattern::SEQUENTIAL: return MADV_SEQUENTIAL;
+        case access_pattern::RANDOM: return MADV_RANDOM;
+        default: return MADV_NORMAL;
+      }
+    }();
+    // The hint only tunes readahead, so a failure is not an error
+    madvise(map_addr_, map_size_, advice);
+  }
+
+  bool supports_device_read() const override { return is_registered_ || _cufile_in != nullptr; }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override
+  {
+    rmm::device_buffer out_data(clamped_read_size(offset, size));
+    auto const read_size =
+      device_read(offset, out_data.size(), static_cast<uint8_t *>(out_data.data()));
+    out_data.resize(read_size);
+    return std::make_unique<device_memory_buffer>(std::move(out_data));
+  }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    CUDF_EXPECTS(supports_device_read(), "Device reads are not supported for this file.");
+    auto const read_size = clamped_read_size(offset, size);
+    if (read_size == 0) { return 0; }
+
+    // Pinned mapping: the copy engine reads the page cache directly, without a staging copy
+    if (is_registered_ && offset >= map_offset_ && offset + read_size <= map_offset_ + map_size_) {
+      auto const src = static_cast<uint8_t *>(map_addr_) + (offset - map_offset_);
+      CUDA_TRY(cudaMemcpy(dst, src, read_size, cudaMemcpyHostToDevice));
+      return read_size;
+    }
+    CUDF_EXPECTS(_cufile_in != nullptr, "Device read outside of the pinned file mapping");
+    return _cufile_in->read(offset, read_size, dst);
+  }
+
   size_t size() const override { return file_size_; }
 
  private:
+  // Clamp length to available data in the file; device reads are not limited to the mapping
+  size_t clamped_read_size(size_t offset, size_t size) const
+  {
+    return (offset < file_size_) ? std::min(size, file_size_ - offset) : 0;
+  }
+
   void map(int fd, size_t offset, size_t size)
   {
     CUDF_EXPECTS(offset < file_size_, "Offset is past end of file");
@@ -116,13 +335,41 @@ class memory_mapped_source : public datasource {
     CUDF_EXPECTS(map_addr_ != MAP_FAILED, "Cannot create memory mapping");
     map_offset_ = map_offset;
     map_size_   = map_size;
+
+    if (is_mmap_register_enabled()) { register_mapping(); }
+  }
+
+  // Pins the mapped pages so that copies to the device can read from the mapping directly
+  void register_mapping()
+  {
+#ifdef cudaHostRegisterReadOnly
+    // The mapping is read-only, which requires CUDA 11.1 to register; on failure the source
+    // falls back to the regular reads
+    is_registered_ =
+      cudaHostRegister(map_addr_, map_size_, cudaHostRegisterReadOnly) == cudaSuccess;
+    if (!is_registered_) { cudaGetLastError(); }
+#endif
+  }
+
+  // Applies `advice` to the pages of the mapping that overlap the given range of the file
+  void advise_range(size_t offset, size_t size, int advice)
+  {
+    if (map_addr_ == nullptr || offset < map_offset_ || offset - map_offset_ >= map_size_) {
+      return;
+    }
+    auto const page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto const begin     = (offset - map_offset_) & ~(page_size - 1);
+    auto const end       = std::min(map_size_, offset - map_offset_ + size);
+    if (end > begin) { madvise(static_cast<uint8_t *>(map_addr_) + begin, end - begin, advice); }
   }
 
  private:
-  size_t file_size_  = 0;
-  void *map_addr_    = nullptr;
-  size_t map_size_   = 0;
-  size_t map_offset_ = 0;
+  size_t file_size_   = 0;
+  void *map_addr_     = nullptr;
+  size_t map_size_    = 0;
+  size_t map_offset_  = 0;
+  bool is_registered_ = false;
+  std::unique_ptr<detail::cufile_input> _cufile_in;
 };
 
 /**
@@ -146,6 +393,17 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  std::vector<std::future<std::unique_ptr<buffer>>> host_read_async(
+    std::vector<read_range> const &ranges) override
+  {
+    return source->host_read_async(ranges);
+  }
+
+  void advise_access_pattern(access_pattern pattern) override
+  {
+    source->advise_access_pattern(pattern);
+  }
+
   bool supports_device_read() const override { return source->supports_device_read(); }
 
   size_t device_read(size_t offset, size_t size, uint8_t *dst) override
@@ -158,6 +416,8 @@ class user_datasource_wrapper : public datasource {
     return source->device_read(offset, size);
   }
 
+  std::vector<size_t> record_offsets() const override { return source->record_offsets(); }
+
   size_t size() const override { return source->size(); }
 
  private:
@@ -168,6 +428,9 @@ std::unique_ptr<datasource> datasource::create(const std::string &filepath,
                                                size_t offset,
                                                size_t size)
 {
+  // Object store and HTTP paths are read with range requests
+  if (detail::is_remote_path(filepath)) { return detail::make_remote_source(filepath); }
+
   // Use our own memory mapping implementation for direct file reads
   return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
 }
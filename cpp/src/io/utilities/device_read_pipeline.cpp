@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "device_read_pipeline.hpp"
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Returns whether the host memory is pinned or registered, so that the device can copy
+ * from it directly
+ */
+bool is_pinned_host_memory(void const *ptr)
+{
+  cudaPointerAttributes attrs{};
+  if (cudaPointerGetAttributes(&attrs, ptr) != cudaSuccess) {
+    // Older CUDA versions fail for pageable memory; clear the error
+    cudaGetLastError();
+    return false;
+  }
+  return attrs.type == cudaMemoryTypeHost;
+}
+
+}  // namespace
+
+device_read_pipeline::device_read_pipeline(cudaStream_t stream, size_t staging_size)
+  : _stream(stream), _staging_size(staging_size)
+{
+  CUDF_EXPECTS(staging_size > 0, "Staging buffers cannot be empty");
+  for (auto &event : _copy_done) {
+    CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  }
+}
+
+device_read_pipeline::~device_read_pipeline()
+{
+  // Staging buffers cannot be released while copies from them are in flight
+  for (size_t i = 0; i < _staging.size(); ++i) {
+    auto const sync_result = cudaEventSynchronize(_copy_done[i]);
+    assert(sync_result == cudaSuccess);
+    pinned_memory_pool::get().deallocate(_staging[i], _staging_size);
+    cudaEventDestroy(_copy_done[i]);
+  }
+}
+
+uint8_t *device_read_pipeline::next_staging_buffer()
+{
+  auto &staging = _staging[_next];
+  if (staging == nullptr) {
+    staging = static_cast<uint8_t *>(pinned_memory_pool::get().allocate(_staging_size));
+  } else {
+    // Wait for the previous copy out of this buffer before overwriting it
+    CUDA_TRY(cudaEventSynchronize(_copy_done[_next]));
+  }
+  return staging;
+}
+
+void device_read_pipeline::copy_from_staging(uint8_t *dst, size_t size)
+{
+  CUDA_TRY(cudaMemcpyAsync(dst, _staging[_next], size, cudaMemcpyHostToDevice, _stream));
+  CUDA_TRY(cudaEventRecord(_copy_done[_next], _stream));
+  _next ^= 1;
+}
+
+void device_read_pipeline::read(datasource *source, size_t offset, size_t size, uint8_t *dst)
+{
+  if (size == 0) { return; }
+
+  if (source->supports_device_read()) {
+    CUDF_EXPECTS(source->device_read(offset, size, dst) == size, "Unexpected end of source");
+    return;
+  }
+
+  for (size_t pos = 0; pos < size; pos += _staging_size) {
+    auto const len     = std::min(_staging_size, size - pos);
+    auto const staging = next_staging_buffer();
+    CUDF_EXPECTS(source->host_read(offset + pos, len, staging) == len, "Unexpected end of source");
+    copy_from_staging(dst + pos, len);
+  }
+}
+
+void device_read_pipeline::read(datasource *source, std::vector<range> const &ranges)
+{
+  if (source->supports_device_read() || ranges.size() == 1) {
+    for (auto const &r : ranges) { read(source, r.offset, r.size, r.dst); }
+    return;
+  }
+
+  // Requests the ranges starting at `begin`, up to the read-ahead size; returns the end of batch
+  auto request_batch = [&](size_t begin, std::vector<datasource::read_range> &batch) {
+    batch.clear();
+    size_t batch_size = 0;
+    auto end          = begin;
+    for (; end < ranges.size() && (end == begin || batch_size < max_read_ahead_size); ++end) {
+      batch.push_back({ranges[end].offset, ranges[end].size});
+      batch_size += ranges[end].size;
+    }
+    return end;
+  };
+
+  std::vector<datasource::read_range> batch;
+  auto batch_end = request_batch(0, batch);
+  auto buffers   = source->host_read_async(batch);
+  for (size_t begin = 0; begin < ranges.size();) {
+    auto const end = batch_end;
+    std::vector<std::future<std::unique_ptr<datasource::buffer>>> next_buffers;
+    if (end < ranges.size()) {
+      batch_end    = request_batch(end, batch);
+      next_buffers = source->host_read_async(batch);
+    }
+
+    for (size_t r = begin; r < end; ++r) {
+      auto const buffer = buffers[r - begin].get();
+      auto const size   = ranges[r].size;
+      CUDF_EXPECTS(buffer->size() == size, "Unexpected end of source");
+      upload(buffer->data(), size, ranges[r].dst);
+    }
+    buffers = std::move(next_buffers);
+    begin   = end;
+  }
+}
+
+void device_read_pipeline::upload(uint8_t const *src, size_t size, uint8_t *dst)
+{
+  if (is_pinned_host_memory(src)) {
+    // No staging needed; wait for the copy since the caller may release `src` on return
+    CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyHostToDevice, _stream));
+    CUDA_TRY(cudaStreamSynchronize(_stream));
+    return;
+  }
+
+  for (size_t pos = 0; pos < size; pos += _staging_size) {
+    auto const len = std::min(_staging_size, size - pos);
+    std::memcpy(next_staging_buffer(), src + pos, len);
+    copy_from_staging(dst + pos, len);
+  }
+}
+
+void device_read_pipeline::sync()
+{
+  for (auto const &event : _copy_done) { CUDA_TRY(cudaEventSynchronize(event)); }
+}
+
+rmm::device_buffer upload_to_device(void const *src, size_t size, cudaStream_t stream)
+{
+  rmm::device_buffer out(size, stream);
+  if (size != 0) {
+    device_read_pipeline pipeline(stream, std::min(size, device_read_pipeline::default_staging_size));
+    pipeline.upload(static_cast<uint8_t const *>(src), size, static_cast<uint8_t *>(out.data()));
+    pipeline.sync();
+  }
+  return out;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file device_read_pipeline.hpp
+ * @brief cuDF-IO utility to overlap host reads of a datasource with host-to-device transfers
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Copies ranges of datasources to device memory, overlapping the host reads with the
+ * host-to-device transfers
+ *
+ * Data is read in pieces into two pinned staging buffers used in turn: while a piece is being
+ * copied to the device from one buffer, the next piece is read into the other one. Batches of
+ * ranges are fetched with `datasource::host_read_async()`, so that the source can coalesce and
+ * parallelize them. Sources that support `device_read()` are read directly into device memory.
+ *
+ * Copies are asynchronous with respect to the host; `sync()` must be called before the destination
+ * memory is used from the host or from another stream.
+ */
+class device_read_pipeline {
+ public:
+  static constexpr size_t default_staging_size = 8 * 1024 * 1024;
+  // Batched reads request at most this many bytes from the source ahead of the transfers
+  static constexpr size_t max_read_ahead_size = 128 * 1024 * 1024;
+
+  /**
+   * @brief Range of a source and the device memory to copy it to
+   */
+  struct range {
+    size_t offset;  // Offset of the range in the source, in bytes
+    size_t size;    // Size of the range, in bytes
+    uint8_t *dst;   // Device memory to copy the range to
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param stream CUDA stream used for the host-to-device copies
+   * @param staging_size Size of each of the two pinned staging buffers, in bytes
+   */
+  explicit device_read_pipeline(cudaStream_t stream, size_t staging_size = default_staging_size);
+
+  ~device_read_pipeline();
+
+  device_read_pipeline(device_read_pipeline const &) = delete;
+  device_read_pipeline &operator=(device_read_pipeline const &) = delete;
+
+  /**
+   * @brief Queues the copy of a range of a source to device memory.
+   *
+   * Returns once the range has been read from the source; the transfer to the device may still
+   * be in flight.
+   *
+   * @param source Source to read from
+   * @param offset Offset of the range in the source, in bytes
+   * @param size Size of the range, in bytes
+   * @param dst Device memory to copy the range to
+   *
+   * @throw cudf::logic_error if the source returns less data than requested
+   */
+  void read(datasource *source, size_t offset, size_t size, uint8_t *dst);
+
+  /**
+   * @brief Queues the copies of several ranges of a source to device memory.
+   *
+   * The ranges are requested from the source in batches of up to `max_read_ahead_size` bytes;
+   * the next batch is requested before the data of the current one is transferred.
+   *
+   * @param source Source to read from
+   * @param ranges Ranges to copy
+   *
+   * @throw cudf::logic_error if the source returns less data than requested
+   */
+  void read(datasource *source, std::vector<range> const &ranges);
+
+  /**
+   * @brief Queues the copy of pageable host memory to device memory.
+   *
+   * Returns once the data has been copied to the staging buffers, so the source memory can be
+   * released or reused; the transfer to the device may still be in flight. Pinned or registered
+   * host memory, e.g. a registered file mapping, is copied directly without staging, and the copy
+   * is complete on return.
+   *
+   * @param src Host memory to copy
+   * @param size Number of bytes to copy
+   * @param dst Device memory to copy to
+   */
+  void upload(uint8_t const *src, size_t size, uint8_t *dst);
+
+  /**
+   * @brief Waits until all the queued copies have completed.
+   */
+  void sync();
+
+ private:
+  uint8_t *next_staging_buffer();
+  void copy_from_staging(uint8_t *dst, size_t size);
+
+  cudaStream_t _stream;
+  size_t _staging_size;
+  std::array<uint8_t *, 2> _staging{};     // Pooled pinned staging buffers, taken on first use
+  std::array<cudaEvent_t, 2> _copy_done{};  // Recorded after the copy from each staging buffer
+  int _next = 0;                            // Staging buffer used by the next piece
+};
+
+/**
+ * @brief Copies host memory to a new device buffer, through pinned staging buffers if the memory
+ * is pageable.
+ *
+ * @param src Host memory to copy
+ * @param size Number of bytes to copy
+ * @param stream CUDA stream used for the allocation and the copy
+ *
+ * @return The device buffer, with the copy completed
+ */
+rmm::device_buffer upload_to_device(void const *src, size_t size, cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "device_write_pipeline.hpp"
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace cudf {
+namespace io {
+namespace detail {
+device_write_pipeline::device_write_pipeline(data_sink *sink,
+                                             cudaStream_t stream,
+                                             size_t staging_size)
+  : _sink(sink), _stream(stream), _staging_size(staging_size)
+{
+  CUDF_EXPECTS(staging_size > 0, "Staging buffers cannot be empty");
+  for (auto &event : _copy_done) {
+    CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  }
+}
+
+device_write_pipeline::~device_write_pipeline()
+{
+  // Staging buffers cannot be released while copies into them are in flight
+  for (size_t i = 0; i < _staging.size(); ++i) {
+    auto const sync_result = cudaEventSynchronize(_copy_done[i]);
+    assert(sync_result == cudaSuccess);
+    pinned_memory_pool::get().deallocate(_staging[i], _staging_size);
+    cudaEventDestroy(_copy_done[i]);
+  }
+}
+
+void device_write_pipeline::write(uint8_t const *src, size_t size)
+{
+  if (size == 0) { return; }
+
+  if (_sink->supports_device_write()) {
+    flush();
+    _sink->device_write(src, size, _stream);
+    return;
+  }
+
+  for (size_t pos = 0; pos < size; pos += _staging_size) {
+    auto const len = std::min(_staging_size, size - pos);
+    auto &staging  = _staging[_next];
+    if (staging == nullptr) {
+      staging = static_cast<uint8_t *>(pinned_memory_pool::get().allocate(_staging_size));
+    }
+    // The piece previously copied into this buffer has already been written to the sink
+    CUDA_TRY(cudaMemcpyAsync(staging, src + pos, len, cudaMemcpyDeviceToHost, _stream));
+    CUDA_TRY(cudaEventRecord(_copy_done[_next], _stream));
+
+    // Write the previous piece while this one is being copied
+    flush();
+    _queued_len = len;
+    _next ^= 1;
+  }
+}
+
+void device_write_pipeline::flush()
+{
+  if (_queued_len == 0) { return; }
+
+  auto const queued = _next ^ 1;
+  CUDA_TRY(cudaEventSynchronize(_copy_done[queued]));
+  _sink->host_write(_staging[queued], _queued_len);
+  _queued_len = 0;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
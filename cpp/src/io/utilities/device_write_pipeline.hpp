@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file device_write_pipeline.hpp
+ * @brief cuDF-IO utility to overlap device-to-host transfers with host writes to a data sink
+ */
+
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+
+#include <cuda_runtime.h>
+
+#include <array>
+#include <cstdint>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Writes device memory to a data sink, overlapping the device-to-host transfers with the
+ * host writes
+ *
+ * Data is copied in pieces into two pinned staging buffers used in turn: while a piece is being
+ * written to the sink from one buffer, the next piece is copied from the device into the other
+ * one. Sinks that support `device_write()` are written directly from device memory.
+ *
+ * The last piece is written to the sink on `flush()`, which must be called before writing to the
+ * sink by other means.
+ */
+class device_write_pipeline {
+ public:
+  static constexpr size_t default_staging_size = 8 * 1024 * 1024;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param sink Sink to write to
+   * @param stream CUDA stream used for the device-to-host copies
+   * @param staging_size Size of each of the two pinned staging buffers, in bytes
+   */
+  device_write_pipeline(data_sink *sink,
+                        cudaStream_t stream,
+                        size_t staging_size = default_staging_size);
+
+  ~device_write_pipeline();
+
+  device_write_pipeline(device_write_pipeline const &) = delete;
+  device_write_pipeline &operator=(device_write_pipeline const &) = delete;
+
+  /**
+   * @brief Queues the write of device memory to the sink.
+   *
+   * Returns once all but the last piece of the data have been written to the sink; the device
+   * memory must stay valid until `flush()` returns.
+   *
+   * @param src Device memory to write
+   * @param size Number of bytes to write
+   */
+  void write(uint8_t const *src, size_t size);
+
+  /**
+   * @brief Writes the last queued piece to the sink.
+   */
+  void flush();
+
+ private:
+  data_sink *_sink;
+  cudaStream_t _stream;
+  size_t _staging_size;
+  std::array<uint8_t *, 2> _staging{};     // Pooled pinned staging buffers, taken on first use
+  std::array<cudaEvent_t, 2> _copy_done{};  // Recorded after the copy into each staging buffer
+  int _next          = 0;                   // Staging buffer used by the next piece
+  size_t _queued_len = 0;                   // Size of the piece copied but not yet written
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "file_io_utilities.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <cstdlib>
+#include <cstring>
+
+#ifdef CUFILE_FOUND
+#include <cufile.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Returns whether cuFile use is disabled with the `LIBCUDF_CUFILE_POLICY` variable
+ */
+bool is_cufile_disabled()
+{
+  auto const policy = std::getenv("LIBCUDF_CUFILE_POLICY");
+  return policy != nullptr && std::strcmp(policy, "OFF") == 0;
+}
+
+#ifdef CUFILE_FOUND
+/**
+ * @brief Opens the cuFile driver once per process; returns whether it is available
+ */
+bool is_cufile_driver_open()
+{
+  static bool const is_open = []() {
+    auto const status = cuFileDriverOpen();
+    return status.err == CU_FILE_SUCCESS;
+  }();
+  return is_open;
+}
+
+/**
+ * @brief File descriptor registered with cuFile
+ */
+class cufile_registered_file {
+ public:
+  cufile_registered_file(std::string const &filepath, int flags)
+  {
+    _fd = open(filepath.c_str(), flags | O_DIRECT);
+    if (_fd == -1) { return; }
+
+    CUfileDescr_t descr{};
+    descr.handle.fd = _fd;
+    descr.type      = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    if (cuFileHandleRegister(&_handle, &descr).err != CU_FILE_SUCCESS) {
+      close(_fd);
+      _fd = -1;
+    }
+  }
+
+  ~cufile_registered_file()
+  {
+    if (_fd == -1) { return; }
+    cuFileHandleDeregister(_handle);
+    close(_fd);
+  }
+
+  bool is_valid() const { return _fd != -1; }
+
+  CUfileHandle_t handle() const { return _handle; }
+
+ private:
+  int _fd = -1;
+  CUfileHandle_t _handle{};
+};
+
+class cufile_input_impl final : public cufile_input {
+ public:
+  explicit cufile_input_impl(std::string const &filepath) : _file(filepath, O_RDONLY) {}
+
+  bool is_valid() const { return _file.is_valid(); }
+
+  size_t read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    auto const result = cuFileRead(_file.handle(), dst, size, offset, 0);
+    CUDF_EXPECTS(result >= 0, "cuFile error reading from a file");
+    return static_cast<size_t>(result);
+  }
+
+ private:
+  cufile_registered_file _file;
+};
+
+class cufile_output_impl final : public cufile_output {
+ public:
+  explicit cufile_output_impl(std::string const &filepath) : _file(filepath, O_WRONLY) {}
+
+  bool is_valid() const { return _file.is_valid(); }
+
+  void write(void const *data, size_t offset, size_t size) override
+  {
+    auto const result = cuFileWrite(_file.handle(), data, size, offset, 0);
+    CUDF_EXPECTS(result >= 0 && static_cast<size_t>(result) == size,
+                 "cuFile error writing to a file");
+  }
+
+ private:
+  cufile_registered_file _file;
+};
+#endif
+
+}  // namespace
+
+std::unique_ptr<cufile_input> make_cufile_input(std::string const &filepath)
+{
+#ifdef CUFILE_FOUND
+  if (!is_cufile_disabled() && is_cufile_driver_open()) {
+    auto input = std::make_unique<cufile_input_impl>(filepath);
+    if (input->is_valid()) { return input; }
+  }
+#endif
+  return nullptr;
+}
+
+std::unique_ptr<cufile_output> make_cufile_output(std::string const &filepath)
+{
+#ifdef CUFILE_FOUND
+  if (!is_cufile_disabled() && is_cufile_driver_open()) {
+    auto output = std::make_unique<cufile_output_impl>(filepath);
+    if (output->is_valid()) { return output; }
+  }
+#endif
+  return nullptr;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file file_io_utilities.hpp
+ * @brief cuDF-IO utilities to transfer file data directly to and from device memory with cuFile
+ * (GPUDirect Storage)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Interface for reading a file directly into device memory
+ */
+class cufile_input {
+ public:
+  virtual ~cufile_input() = default;
+
+  /**
+   * @brief Reads a range of the file into device memory
+   *
+   * @param offset Number of bytes from the start of the file
+   * @param size Number of bytes to read
+   * @param dst Address of the device memory to read into
+   *
+   * @throw cudf::logic_error if the read fails
+   *
+   * @return The number of bytes read, which is less than `size` at the end of the file
+   */
+  virtual size_t read(size_t offset, size_t size, uint8_t *dst) = 0;
+};
+
+/**
+ * @brief Interface for writing device memory directly to a file
+ */
+class cufile_output {
+ public:
+  virtual ~cufile_output() = default;
+
+  /**
+   * @brief Writes device memory to a range of the file
+   *
+   * @param data Address of the device memory to write
+   * @param offset Number of bytes from the start of the file
+   * @param size Number of bytes to write
+   *
+   * @throw cudf::logic_error if the write fails
+   */
+  virtual void write(void const *data, size_t offset, size_t size) = 0;
+};
+
+/**
+ * @brief Opens a file for cuFile reads
+ *
+ * cuFile is used if cuDF is built with it, the cuFile driver can be opened, and the
+ * `LIBCUDF_CUFILE_POLICY` environment variable is not set to `OFF`.
+ *
+ * @param filepath Path of the file
+ *
+ * @return The cuFile reader, or null if cuFile cannot be used with the file
+ */
+std::unique_ptr<cufile_input> make_cufile_input(std::string const &filepath);
+
+/**
+ * @brief Opens an existing file for cuFile writes
+ *
+ * The same conditions as for `make_cufile_input()` apply.
+ *
+ * @param filepath Path of the file
+ *
+ * @return The cuFile writer, or null if cuFile cannot be used with the file
+ */
+std::unique_ptr<cufile_output> make_cufile_output(std::string const &filepath);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "footer_statistics.hpp"
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Determines whether `lhs < rhs`, for literals of the same kind and units
+ */
+bool literal_less(predicate_literal const& lhs, predicate_literal const& rhs)
+{
+  switch (lhs.kind) {
+    case literal_kind::SIGNED: return lhs.int_val < rhs.int_val;
+    case literal_kind::UNSIGNED: return lhs.uint_val < rhs.uint_val;
+    case literal_kind::FLOAT: return lhs.fp_val < rhs.fp_val;
+    case literal_kind::STRING: return lhs.str_val < rhs.str_val;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Functor to create a scalar of the dispatched type from a `predicate_literal`
+ *
+ * The literal is rounded down to the units of the type for a minimum and up for a maximum.
+ * Returns `nullptr` if the literal cannot be represented.
+ */
+struct literal_to_scalar {
+  predicate_literal const& value;
+  bool round_up;
+  rmm::mr::device_memory_resource* mr;
+  cudaStream_t stream;
+
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value, std::unique_ptr<scalar>>
+  operator()() const
+  {
+    int64_t lo, hi;
+    if (!literal_bounds(value, 0, lo, hi)) return nullptr;
+    return make_fixed_width_scalar<T>(static_cast<T>(round_up ? hi : lo), stream, mr);
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value && !std::is_signed<T>::value,
+                   std::unique_ptr<scalar>>
+  operator()() const
+  {
+    uint64_t lo, hi;
+    if (!literal_bounds(value, lo, hi)) return nullptr;
+    return make_fixed_width_scalar<T>(static_cast<T>(round_up ? hi : lo), stream, mr);
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_floating_point<T>::value, std::unique_ptr<scalar>> operator()() const
+  {
+    double lo, hi;
+    if (!literal_bounds(value, lo, hi)) return nullptr;
+    return make_fixed_width_scalar<T>(static_cast<T>(round_up ? hi : lo), stream, mr);
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_chrono<T>(), std::unique_ptr<scalar>> operator()() const
+  {
+    using period = typename T::period;
+    int64_t lo, hi;
+    if (!literal_bounds(value, 1000000000ll * period::num / period::den, lo, hi)) return nullptr;
+    auto const ticks = static_cast<typename T::rep>(round_up ? hi : lo);
+    return make_chrono_scalar<T>(ticks);
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_same<T, string_view>::value, std::unique_ptr<scalar>> operator()()
+    const
+  {
+    if (value.kind != literal_kind::STRING) return nullptr;
+    return std::make_unique<string_scalar>(value.str_val, true, stream, mr);
+  }
+
+  template <typename T>
+  std::enable_if_t<!std::is_arithmetic<T>::value && !cudf::is_chrono<T>() &&
+                     !std::is_same<T, string_view>::value,
+                   std::unique_ptr<scalar>>
+  operator()() const
+  {
+    return nullptr;
+  }
+
+ private:
+  template <typename T>
+  std::enable_if_t<cudf::is_timestamp<T>(), std::unique_ptr<scalar>> make_chrono_scalar(
+    typename T::rep ticks) const
+  {
+    return make_fixed_width_scalar<T>(T{typename T::duration{ticks}}, stream, mr);
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_duration<T>(), std::unique_ptr<scalar>> make_chrono_scalar(
+    typename T::rep ticks) const
+  {
+    return make_fixed_width_scalar<T>(T{ticks}, stream, mr);
+  }
+};
+
+}  // namespace
+
+void column_statistics_builder::add(int64_t num_rows,
+                                    int64_t null_count,
+                                    predicate_literal const& min,
+                                    predicate_literal const& max,
+                                    int64_t distinct_count)
+{
+  _num_rows += num_rows;
+  _null_count     = (_null_count < 0 || null_count < 0) ? -1 : _null_count + null_count;
+  _distinct_count = (_num_parts == 0) ? distinct_count : -1;
+  ++_num_parts;
+
+  // A row group or stripe without values has nothing to add to the min/max
+  if (null_count >= 0 && null_count == num_rows) return;
+  if (min.kind == literal_kind::NONE || max.kind == literal_kind::NONE ||
+      (_min.kind != literal_kind::NONE && (min.kind != _min.kind || max.kind != _max.kind))) {
+    _has_minmax = false;
+    return;
+  }
+  if (_min.kind == literal_kind::NONE || literal_less(min, _min)) { _min = min; }
+  if (_max.kind == literal_kind::NONE || literal_less(_max, max)) { _max = max; }
+}
+
+column_statistics column_statistics_builder::build(data_type type,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream) const
+{
+  column_statistics stats;
+  stats.num_rows              = _num_rows;
+  stats.null_count            = _null_count;
+  stats.approx_distinct_count = _distinct_count;
+  if (_has_minmax && _min.kind != literal_kind::NONE) {
+    stats.min = type_dispatcher(type, literal_to_scalar{_min, false, mr, stream});
+    stats.max = type_dispatcher(type, literal_to_scalar{_max, true, mr, stream});
+    if (stats.min == nullptr || stats.max == nullptr) {
+      stats.min.reset();
+      stats.max.reset();
+    }
+  }
+  return stats;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
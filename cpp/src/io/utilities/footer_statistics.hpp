@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file footer_statistics.hpp
+ * @brief cuDF-IO utilities for combining the statistics of file footers into column statistics
+ */
+
+#pragma once
+
+#include "column_predicate.hpp"
+
+#include <cudf/statistics.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Combines the footer statistics of the row groups or stripes of a column
+ *
+ * Min and max values are held as host-side `predicate_literal`s, in the units of the file.
+ */
+class column_statistics_builder {
+ public:
+  /**
+   * @brief Adds the statistics of a row group or stripe
+   *
+   * @param num_rows Number of rows, including nulls
+   * @param null_count Number of null rows; negative if unknown
+   * @param min Smallest non-null value; of kind `NONE` if unknown
+   * @param max Largest non-null value; of kind `NONE` if unknown
+   * @param distinct_count Number of distinct non-null values; negative if unknown
+   */
+  void add(int64_t num_rows,
+           int64_t null_count,
+           predicate_literal const& min,
+           predicate_literal const& max,
+           int64_t distinct_count = -1);
+
+  /**
+   * @brief Returns the statistics of all the row groups or stripes added so far
+   *
+   * The distinct count is only known for a single row group or stripe, as it cannot be combined.
+   * Min and max are unset if they are unknown for a row group or stripe that has non-null values,
+   * or if they cannot be represented as `type`.
+   *
+   * @param type Type of the column read from the file, and of the min/max scalars
+   * @param mr Device memory resource used to allocate the min/max scalars
+   * @param stream CUDA stream used to initialize the min/max scalars
+   */
+  column_statistics build(data_type type,
+                          rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                          cudaStream_t stream                 = 0) const;
+
+ private:
+  int64_t _num_rows{0};
+  int64_t _null_count{0};
+  int64_t _distinct_count{-1};
+  int _num_parts{0};
+  bool _has_minmax{true};
+  predicate_literal _min;
+  predicate_literal _max;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
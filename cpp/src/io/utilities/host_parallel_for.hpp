@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file host_parallel_for.hpp
+ * @brief cuDF-IO utility to process independent host tasks, such as reads of separate sources,
+ * with a pool of host threads
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Returns the default number of host threads used to process independent tasks
+ */
+inline size_t default_host_threads()
+{
+  constexpr size_t max_threads = 8;
+  return std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), max_threads));
+}
+
+/**
+ * @brief Calls `func(task, worker)` for every `task` in [0, num_tasks), from up to `num_threads`
+ * host threads
+ *
+ * Tasks are handed out in ascending order to the first idle thread. `worker` identifies the thread
+ * running the task, in [0, num_threads), so that tasks can reuse per-thread resources. The calling
+ * thread is one of the workers; no thread is started if a single one is used.
+ *
+ * If tasks throw, the remaining tasks are skipped and the first exception is rethrown once all the
+ * threads are done.
+ *
+ * @param num_tasks Number of tasks
+ * @param num_threads Maximum number of threads
+ * @param func Task function, called as `func(size_t task, size_t worker)`
+ */
+template <typename Func>
+void host_parallel_for(size_t num_tasks, size_t num_threads, Func func)
+{
+  num_threads = std::max<size_t>(1, std::min(num_threads, num_tasks));
+  if (num_threads == 1) {
+    for (size_t task = 0; task < num_tasks; ++task) { func(task, 0); }
+    return;
+  }
+
+  std::atomic<size_t> next_task{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto worker_loop = [&](size_t worker) {
+    for (size_t task = next_task++; task < num_tasks && !failed; task = next_task++) {
+      try {
+        func(task, worker);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!failed.exchange(true)) { error = std::current_exception(); }
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t worker = 1; worker < num_threads; ++worker) {
+    threads.emplace_back(worker_loop, worker);
+  }
+  worker_loop(0);
+  for (auto &thread : threads) { thread.join(); }
+  if (error) { std::rethrow_exception(error); }
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
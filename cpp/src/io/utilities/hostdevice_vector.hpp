@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <io/utilities/pinned_memory_pool.hpp>
+
 #include <rmm/device_buffer.hpp>
 
 #include <cudf/utilities/error.hpp>
@@ -27,7 +29,8 @@
  * This abstraction allocates a specified fixed chunk of device memory that can
  * initialized upfront, or gradually initialized as required.
  * The host-side memory can be used to manipulate data on the CPU before and
- * after operating on the same data on the GPU.
+ * after operating on the same data on the GPU. It is taken from the pinned memory pool, so that
+ * short-lived vectors do not allocate pinned memory every time.
  **/
 template <typename T>
 class hostdevice_vector {
@@ -49,21 +52,16 @@ class hostdevice_vector {
   }
 
   explicit hostdevice_vector(size_t initial_size, size_t max_size, cudaStream_t stream = 0)
-    : num_elements(initial_size), max_elements(max_size)
+    : stream(stream), max_elements(max_size), num_elements(initial_size)
   {
     if (max_elements != 0) {
-      CUDA_TRY(cudaMallocHost(&h_data, sizeof(T) * max_elements));
+      h_data = static_cast<T *>(
+        cudf::io::detail::pinned_memory_pool::get().allocate(sizeof(T) * max_elements));
       d_data.resize(sizeof(T) * max_elements, stream);
     }
   }
 
-  ~hostdevice_vector()
-  {
-    if (max_elements != 0) {
-      auto const free_result = cudaFreeHost(h_data);
-      assert(free_result == cudaSuccess);
-    }
-  }
+  ~hostdevice_vector() { release_host_data(); }
 
   bool insert(const T &data)
   {
@@ -89,19 +87,30 @@ class hostdevice_vector {
 
   void host_to_device(cudaStream_t stream, bool synchronize = false)
   {
+    this->stream = stream;
     cudaMemcpyAsync(d_data.data(), h_data, memory_size(), cudaMemcpyHostToDevice, stream);
     if (synchronize) { cudaStreamSynchronize(stream); }
   }
 
   void device_to_host(cudaStream_t stream, bool synchronize = false)
   {
+    this->stream = stream;
     cudaMemcpyAsync(h_data, d_data.data(), memory_size(), cudaMemcpyDeviceToHost, stream);
     if (synchronize) { cudaStreamSynchronize(stream); }
   }
 
  private:
+  // The last copy from or to the host data may still be in flight on `stream`
+  void release_host_data() noexcept
+  {
+    cudf::io::detail::pinned_memory_pool::get().deallocate(
+      h_data, sizeof(T) * max_elements, stream);
+    h_data = nullptr;
+  }
+
   void move(hostdevice_vector &&v)
   {
+    release_host_data();
     stream       = v.stream;
     max_elements = v.max_elements;
     num_elements = v.num_elements;
@@ -113,7 +122,7 @@ class hostdevice_vector {
     v.h_data       = nullptr;
   }
 
-  cudaStream_t stream = 0;
+  cudaStream_t stream = 0;  // Stream of the last copy from or to the host data
   size_t max_elements = 0;
   size_t num_elements = 0;
   T *h_data           = nullptr;
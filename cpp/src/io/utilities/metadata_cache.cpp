@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metadata_cache.hpp"
+
+#include <sys/stat.h>
+
+namespace cudf {
+namespace io {
+namespace detail {
+metadata_cache &metadata_cache::get()
+{
+  static metadata_cache cache;
+  return cache;
+}
+
+void metadata_cache::set_capacity(size_t capacity)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _capacity = capacity;
+  if (capacity == 0) {
+    _entries.clear();
+    _index.clear();
+    _size = 0;
+  } else {
+    evict(capacity);
+  }
+}
+
+size_t metadata_cache::capacity() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _capacity;
+}
+
+std::shared_ptr<void const> metadata_cache::find_entry(std::string const &key)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = _index.find(key);
+  if (it == _index.end()) { return nullptr; }
+  _entries.splice(_entries.begin(), _entries, it->second);
+  return it->second->second.first;
+}
+
+void metadata_cache::insert(std::string const &key, std::shared_ptr<void const> value, size_t size)
+{
+  if (key.empty()) { return; }
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = _index.find(key);
+  if (it != _index.end()) {
+    _size -= it->second->second.second;
+    _entries.erase(it->second);
+    _index.erase(it);
+  }
+  if (size > _capacity) { return; }
+  evict(_capacity - size);
+  _entries.emplace_front(key, std::make_pair(std::move(value), size));
+  _index.emplace(key, _entries.begin());
+  _size += size;
+}
+
+void metadata_cache::clear()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+  _index.clear();
+  _size = 0;
+}
+
+void metadata_cache::evict(size_t capacity)
+{
+  while (_size > capacity) {
+    auto const &lru = _entries.back();
+    _size -= lru.second.second;
+    _index.erase(lru.first);
+    _entries.pop_back();
+  }
+}
+
+std::string file_cache_key(std::string const &format, std::string const &path)
+{
+  if (metadata_cache::get().capacity() == 0) { return {}; }
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) { return {}; }
+  auto const mtime_ns = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+  return format + ':' + path + ':' + std::to_string(st.st_size) + ':' + std::to_string(mtime_ns);
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
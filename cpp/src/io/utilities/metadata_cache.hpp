@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file metadata_cache.hpp
+ * @brief cuDF-IO utility to keep the parsed metadata of recently opened files
+ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Process-wide cache of parsed file metadata (such as Parquet or ORC footers)
+ *
+ * Entries are keyed by strings built with `file_cache_key()`, so that a file that is modified
+ * or replaced misses the cache. The total size of the entries is bounded; the least recently
+ * used entries are evicted first. The cache is disabled (zero capacity) until a capacity is set.
+ *
+ * All member functions are thread-safe.
+ */
+class metadata_cache {
+ public:
+  /**
+   * @brief Returns the process-wide cache
+   */
+  static metadata_cache &get();
+
+  /**
+   * @brief Sets the maximum total size of the entries, evicting entries as needed
+   *
+   * @param capacity Capacity in bytes; zero disables the cache and drops all the entries
+   */
+  void set_capacity(size_t capacity);
+
+  /**
+   * @brief Returns the maximum total size of the entries, in bytes
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Returns the metadata cached for a key, or null if there is none
+   *
+   * @tparam T Type of the metadata, which must be the type it was inserted with
+   * @param key Key of the file
+   */
+  template <typename T>
+  std::shared_ptr<T const> find(std::string const &key)
+  {
+    return std::static_pointer_cast<T const>(find_entry(key));
+  }
+
+  /**
+   * @brief Adds the metadata of a file, replacing any previous entry for the key
+   *
+   * Entries larger than the capacity are not cached. Does nothing if `key` is empty.
+   *
+   * @param key Key of the file
+   * @param value Parsed metadata
+   * @param size Approximate size of the metadata in bytes
+   */
+  void insert(std::string const &key, std::shared_ptr<void const> value, size_t size);
+
+  /**
+   * @brief Drops all the entries
+   */
+  void clear();
+
+ private:
+  using entry = std::pair<std::string, std::pair<std::shared_ptr<void const>, size_t>>;
+
+  std::shared_ptr<void const> find_entry(std::string const &key);
+  void evict(size_t capacity);
+
+  mutable std::mutex _mutex;
+  size_t _capacity = 0;
+  size_t _size     = 0;
+  std::list<entry> _entries;  // Most recently used first
+  std::unordered_map<std::string, std::list<entry>::iterator> _index;
+};
+
+/**
+ * @brief Returns the cache key of a file, combining its path, size and modification time
+ *
+ * @param format Name of the file format, so that different readers never share entries
+ * @param path Path of the file
+ *
+ * @return The key, or an empty string if the cache is disabled or the file cannot be queried
+ */
+std::string file_cache_key(std::string const &format, std::string const &path);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
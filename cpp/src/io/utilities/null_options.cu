@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "null_options.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/replace.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+namespace cudf {
+namespace io {
+namespace detail {
+void apply_null_options(
+  table_with_metadata& result,
+  bool nans_to_nulls,
+  std::unordered_map<std::string, std::shared_ptr<scalar const>> const& fill_values,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  if (!nans_to_nulls && fill_values.empty()) { return; }
+
+  auto columns         = result.tbl->release();
+  auto const& names    = result.metadata.column_names;
+  auto const has_names = names.size() == columns.size();
+  for (size_t col_index = 0; col_index < columns.size(); ++col_index) {
+    auto& col = columns[col_index];
+
+    if (nans_to_nulls && is_floating_point(col->type())) {
+      auto mask = cudf::detail::nans_to_nulls(col->view(), mr, stream);
+      if (mask.second > 0) { col->set_null_mask(std::move(*mask.first), mask.second); }
+    }
+
+    if (!has_names) { continue; }
+    auto const fill = fill_values.find(names[col_index]);
+    if (fill == fill_values.end() || !fill->second->is_valid() || !col->has_nulls()) { continue; }
+    CUDF_EXPECTS(fill->second->type() == col->type(), "Fill value type mismatch");
+    if (is_fixed_width(col->type())) {
+      auto view = col->mutable_view();
+      cudf::detail::replace_nulls_in_place(view, *fill->second, stream);
+      col->set_null_mask(rmm::device_buffer{}, 0);
+    } else {
+      col = cudf::detail::replace_nulls(col->view(), *fill->second, mr, stream);
+    }
+  }
+  result.tbl = std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
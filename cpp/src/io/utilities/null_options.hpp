@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file null_options.hpp
+ * @brief cuDF-IO utilities for the readers' NaN and null replacement options
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Applies the `nans_to_nulls` and `null_fill_values` reader options to the
+ * columns of a table that was just read.
+ *
+ * The columns are updated in place wherever possible so no copies of the decoded
+ * data are made:
+ * - NaN values of floating-point columns only replace the column's null mask.
+ * - Nulls of fixed-width columns are overwritten in the data buffer and the null
+ *   mask is dropped.
+ * Only string columns with a fill value are rebuilt.
+ *
+ * Fill values for names that are not in `result` are ignored.
+ *
+ * @throw cudf::logic_error if a fill value's type differs from its column's type.
+ *
+ * @param result Table read by one of the readers and its metadata.
+ * @param nans_to_nulls Whether to turn NaN values into nulls.
+ * @param fill_values Values to replace the nulls of the named columns with.
+ * @param mr Device memory resource used to allocate new null masks and columns.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void apply_null_options(
+  table_with_metadata& result,
+  bool nans_to_nulls,
+  std::unordered_map<std::string, std::shared_ptr<scalar const>> const& fill_values,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/io/types.hpp>
 
@@ -158,8 +159,23 @@ parse_numeric(const char* data, long start, long end, ParseOptions const& opts)
     start += 2;
   }
 
-  // Handle the whole part of the number
+  // Handle the whole part of the number, eight digits at a time while the value stays exact
   long index = start;
+  if (base == 10 && !std::is_same<T, bool>::value) {
+    constexpr int exact_bits =
+      std::is_floating_point<T>::value ? std::numeric_limits<T>::digits : 0;
+    constexpr double max_exact_prefix =
+      (double(1ULL << exact_bits) - cudf::detail::eight_digits_scale) /
+      cudf::detail::eight_digits_scale;
+    while (end - index + 1 >= 8 &&
+           (std::is_integral<T>::value || static_cast<double>(value) <= max_exact_prefix)) {
+      auto const word = cudf::detail::load_8_bytes(data + index);
+      if (!cudf::detail::is_8_digits(word)) break;
+      value = (value * static_cast<T>(cudf::detail::eight_digits_scale)) +
+              static_cast<T>(cudf::detail::parse_8_digits(word));
+      index += 8;
+    }
+  }
   while (index <= end) {
     if (data[index] == opts.decimal) {
       ++index;
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+constexpr size_t min_block_size = 4096;
+
+size_t block_size(size_t size)
+{
+  size_t rounded = min_block_size;
+  while (rounded < size) { rounded *= 2; }
+  return rounded;
+}
+
+/**
+ * @brief Frees a pinned block once the work accessing it, if any, has completed
+ */
+void free_when_ready(void *ptr, cudaEvent_t ready) noexcept
+{
+  if (ready != nullptr) {
+    cudaEventSynchronize(ready);
+    cudaEventDestroy(ready);
+  }
+  cudaFreeHost(ptr);
+}
+
+}  // namespace
+
+pinned_memory_pool &pinned_memory_pool::get()
+{
+  // Never destroyed: blocks cannot be freed once the CUDA runtime is torn down at exit
+  static auto *pool = new pinned_memory_pool();
+  return *pool;
+}
+
+void *pinned_memory_pool::allocate(size_t size)
+{
+  auto const rounded = block_size(size);
+  free_block block{nullptr, nullptr};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const it = _free_blocks.find(rounded);
+    if (it != _free_blocks.end() && !it->second.empty()) {
+      block = it->second.back();
+      it->second.pop_back();
+      _cached_bytes -= rounded;
+    }
+  }
+  if (block.ptr != nullptr) {
+    if (block.ready != nullptr) {
+      // Work submitted before the release of the block may still access it
+      auto const sync_result = cudaEventSynchronize(block.ready);
+      cudaEventDestroy(block.ready);
+      CUDA_TRY(sync_result);
+    }
+    return block.ptr;
+  }
+  void *ptr = nullptr;
+  CUDA_TRY(cudaMallocHost(&ptr, rounded));
+  return ptr;
+}
+
+void pinned_memory_pool::deallocate(void *ptr, size_t size) noexcept
+{
+  if (ptr == nullptr) { return; }
+  release(ptr, size, nullptr);
+}
+
+void pinned_memory_pool::deallocate(void *ptr, size_t size, cudaStream_t stream) noexcept
+{
+  if (ptr == nullptr) { return; }
+  cudaEvent_t ready = nullptr;
+  if (cudaEventCreateWithFlags(&ready, cudaEventDisableTiming) != cudaSuccess) {
+    ready = nullptr;
+  } else if (cudaEventRecord(ready, stream) != cudaSuccess) {
+    cudaEventDestroy(ready);
+    ready = nullptr;
+  }
+  // Without an event, wait for the pending work before the block can be reused
+  if (ready == nullptr) { cudaStreamSynchronize(stream); }
+  release(ptr, size, ready);
+}
+
+void pinned_memory_pool::set_capacity(size_t capacity)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _capacity = capacity;
+  trim(capacity);
+}
+
+size_t pinned_memory_pool::capacity() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _capacity;
+}
+
+size_t pinned_memory_pool::cached_bytes() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cached_bytes;
+}
+
+void pinned_memory_pool::release(void *ptr, size_t size, cudaEvent_t ready) noexcept
+{
+  auto const rounded = block_size(size);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_cached_bytes + rounded <= _capacity) {
+      _free_blocks[rounded].push_back({ptr, ready});
+      _cached_bytes += rounded;
+      return;
+    }
+  }
+  free_when_ready(ptr, ready);
+}
+
+void pinned_memory_pool::trim(size_t capacity)
+{
+  // Free the largest blocks first
+  for (auto it = _free_blocks.rbegin(); it != _free_blocks.rend() && _cached_bytes > capacity;
+       ++it) {
+    while (!it->second.empty() && _cached_bytes > capacity) {
+      free_when_ready(it->second.back().ptr, it->second.back().ready);
+      it->second.pop_back();
+      _cached_bytes -= it->first;
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
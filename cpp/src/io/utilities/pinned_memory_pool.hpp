@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file pinned_memory_pool.hpp
+ * @brief cuDF-IO utility to reuse pinned host allocations across reads
+ */
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Process-wide pool of pinned host memory blocks
+ *
+ * Allocations are rounded up to a power of two. Released blocks are kept for reuse while the total
+ * size of the kept blocks is within the capacity, so that frequent reads do not pay for
+ * `cudaMallocHost()` and `cudaFreeHost()` every time. A block released with a stream is only
+ * handed out again once the work submitted to that stream before the release has completed.
+ *
+ * All member functions are thread-safe.
+ */
+class pinned_memory_pool {
+ public:
+  static constexpr size_t default_capacity = 64 * 1024 * 1024;
+
+  /**
+   * @brief Returns the process-wide pool
+   */
+  static pinned_memory_pool &get();
+
+  /**
+   * @brief Returns a pinned block of at least `size` bytes
+   *
+   * @throw cudf::cuda_error if the allocation fails
+   */
+  void *allocate(size_t size);
+
+  /**
+   * @brief Releases a block returned by `allocate()` that no pending work accesses
+   *
+   * @param ptr Address of the block; may be null
+   * @param size Size that the block was allocated with
+   */
+  void deallocate(void *ptr, size_t size) noexcept;
+
+  /**
+   * @brief Releases a block returned by `allocate()` that work on `stream` may still access,
+   * e.g. an asynchronous copy
+   *
+   * The block is not reused or freed before the work submitted to `stream` so far completes.
+   *
+   * @param ptr Address of the block; may be null
+   * @param size Size that the block was allocated with
+   * @param stream Stream of the pending work on the block
+   */
+  void deallocate(void *ptr, size_t size, cudaStream_t stream) noexcept;
+
+  /**
+   * @brief Sets the maximum total size of the blocks kept for reuse, freeing blocks as needed
+   *
+   * @param capacity Capacity in bytes; zero frees blocks as soon as they are released
+   */
+  void set_capacity(size_t capacity);
+
+  /**
+   * @brief Returns the maximum total size of the blocks kept for reuse, in bytes
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Returns the total size of the blocks kept for reuse, in bytes
+   */
+  size_t cached_bytes() const;
+
+ private:
+  /**
+   * @brief A released block, with the event that completes once no work accesses it
+   */
+  struct free_block {
+    void *ptr;
+    cudaEvent_t ready;  // Null if no work was pending on release
+  };
+
+  pinned_memory_pool() = default;
+
+  void release(void *ptr, size_t size, cudaEvent_t ready) noexcept;
+  void trim(size_t capacity);
+
+  mutable std::mutex _mutex;
+  size_t _capacity     = default_capacity;
+  size_t _cached_bytes = 0;
+  std::map<size_t, std::vector<free_block>> _free_blocks;  // Released blocks, by size
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "remote_datasource.hpp"
+#include "coalesced_read.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#ifdef CURL_FOUND
+#include <curl/curl.h>
+#include <strings.h>
+#endif
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+bool starts_with(std::string const &str, char const *prefix)
+{
+  return str.compare(0, std::strlen(prefix), prefix) == 0;
+}
+
+#ifdef CURL_FOUND
+constexpr size_t default_concurrency   = 16;
+constexpr size_t default_prefetch_size = 64 * 1024;
+// Each request costs a round trip, so ranges up to 1MB apart are fetched together
+constexpr size_t remote_coalesce_gap = 1024 * 1024;
+// Coalesced requests do not grow beyond this size, so that large ranges are still fetched in
+// parallel
+constexpr size_t max_remote_read_size = 64 * 1024 * 1024;
+
+std::string env_string(char const *name, std::string const &default_value = {})
+{
+  auto const value = std::getenv(name);
+  return (value != nullptr && *value != '\0') ? std::string{value} : default_value;
+}
+
+size_t env_size(char const *name, size_t default_value)
+{
+  auto const value = std::getenv(name);
+  if (value == nullptr) { return default_value; }
+  char *end         = nullptr;
+  auto const parsed = std::strtoull(value, &end, 10);
+  return (end != value && *end == '\0') ? static_cast<size_t>(parsed) : default_value;
+}
+
+/**
+ * @brief Request parameters of a remote object
+ */
+struct remote_config {
+  std::string url;
+  std::string aws_sigv4;      // libcurl SigV4 provider string; empty for unsigned requests
+  std::string credentials;    // "<access key>:<secret key>" for signed requests
+  std::string session_token;  // Temporary credentials token for signed requests
+  size_t concurrency;
+  size_t prefetch_size;
+};
+
+remote_config make_remote_config(std::string const &url)
+{
+  remote_config config;
+  config.url           = url;
+  config.concurrency =
+    std::max<size_t>(env_size("LIBCUDF_REMOTE_CONCURRENCY", default_concurrency), 1);
+  config.prefetch_size = env_size("LIBCUDF_REMOTE_PREFETCH_SIZE", default_prefetch_size);
+
+  if (starts_with(url, "s3://")) {
+    auto const path   = url.substr(std::strlen("s3://"));
+    auto const slash  = path.find('/');
+    auto const bucket = path.substr(0, slash);
+    auto const key    = (slash == std::string::npos) ? std::string{} : path.substr(slash + 1);
+    auto const region = env_string("AWS_REGION", env_string("AWS_DEFAULT_REGION", "us-east-1"));
+
+    auto endpoint = env_string("AWS_ENDPOINT_URL");
+    if (!endpoint.empty()) {
+      if (endpoint.back() == '/') { endpoint.pop_back(); }
+      config.url = endpoint + '/' + bucket + '/' + key;
+    } else {
+      config.url = "https://" + bucket + ".s3." + region + ".amazonaws.com/" + key;
+    }
+
+#if LIBCURL_VERSION_NUM >= 0x074b00
+    auto const access_key = env_string("AWS_ACCESS_KEY_ID");
+    auto const secret_key = env_string("AWS_SECRET_ACCESS_KEY");
+    if (!access_key.empty() && !secret_key.empty()) {
+      config.aws_sigv4     = "aws:amz:" + region + ":s3";
+      config.credentials   = access_key + ':' + secret_key;
+      config.session_token = env_string("AWS_SESSION_TOKEN");
+    }
+#endif
+  }
+  return config;
+}
+
+/**
+ * @brief Initializes libcurl once per process
+ */
+void init_curl()
+{
+  static bool const is_initialized = []() {
+    CUDF_EXPECTS(curl_global_init(CURL_GLOBAL_DEFAULT) == CURLE_OK, "Cannot initialize libcurl");
+    return true;
+  }();
+  (void)is_initialized;
+}
+
+/**
+ * @brief Pool of libcurl handles, so that requests reuse the open connections
+ */
+class curl_handle_pool {
+ public:
+  ~curl_handle_pool()
+  {
+    for (auto handle : _free_handles) { curl_easy_cleanup(handle); }
+  }
+
+  CURL *acquire()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (!_free_handles.empty()) {
+        auto const handle = _free_handles.back();
+        _free_handles.pop_back();
+        return handle;
+      }
+    }
+    auto const handle = curl_easy_init();
+    CUDF_EXPECTS(handle != nullptr, "Cannot create a libcurl handle");
+    return handle;
+  }
+
+  void release(CURL *handle)
+  {
+    // Resets the options, but keeps the connections and the DNS cache
+    curl_easy_reset(handle);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _free_handles.push_back(handle);
+  }
+
+ private:
+  std::mutex _mutex;
+  std::vector<CURL *> _free_handles;
+};
+
+/**
+ * @brief Result of a range request
+ */
+struct range_response {
+  long status         = 0;
+  size_t offset       = 0;  // Offset of the returned bytes, from the `Content-Range` header
+  size_t size         = 0;  // Number of returned bytes that were stored
+  size_t total_size   = 0;  // Object size, from the `Content-Range` header
+  bool has_total_size = false;
+  uint8_t *dst        = nullptr;
+  size_t capacity     = 0;
+};
+
+size_t write_body(char *data, size_t size, size_t nmemb, void *user)
+{
+  auto &response     = *static_cast<range_response *>(user);
+  auto const len     = size * nmemb;
+  auto const to_copy = std::min(len, response.capacity - response.size);
+  std::memcpy(response.dst + response.size, data, to_copy);
+  response.size += to_copy;
+  // Stop the transfer once the destination is full, in case the server ignored the range
+  return (to_copy == len) ? len : 0;
+}
+
+size_t read_header(char *data, size_t size, size_t nmemb, void *user)
+{
+  auto &response = *static_cast<range_response *>(user);
+  auto const len = size * nmemb;
+
+  // Content-Range: bytes <first>-<last>/<total>, or bytes */<total> for unsatisfiable ranges
+  constexpr char const *content_range = "content-range:";
+  std::string const header(data, len);
+  if (strncasecmp(header.c_str(), content_range, std::strlen(content_range)) == 0) {
+    auto const bytes = header.find("bytes ");
+    if (bytes != std::string::npos) {
+      response.offset = std::strtoull(header.c_str() + bytes + std::strlen("bytes "), nullptr, 10);
+    }
+    auto const slash = header.rfind('/');
+    if (slash != std::string::npos && header[slash + 1] != '*') {
+      response.total_size     = std::strtoull(header.c_str() + slash + 1, nullptr, 10);
+      response.has_total_size = true;
+    }
+  }
+  return len;
+}
+
+/**
+ * @brief Owning buffer of the bytes fetched by a request
+ */
+class fetched_buffer : public datasource::buffer {
+  std::vector<uint8_t> _data;
+
+ public:
+  explicit fetched_buffer(std::vector<uint8_t> &&data) : _data(std::move(data)) {}
+  size_t size() const override { return _data.size(); }
+  const uint8_t *data() const override { return _data.data(); }
+};
+
+/**
+ * @brief Implementation class for reading a remote object with HTTP range requests
+ */
+class remote_source : public datasource {
+  /**
+   * @brief Bytes of the object fetched on open
+   */
+  struct cached_range {
+    size_t offset = 0;
+    std::vector<uint8_t> data;
+
+    bool contains(size_t read_offset, size_t read_size) const
+    {
+      return read_offset >= offset && read_offset + read_size <= offset + data.size();
+    }
+  };
+
+ public:
+  explicit remote_source(remote_config config) : _config(std::move(config))
+  {
+    init_curl();
+    prefetch();
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const read_size = clamped_read_size(offset, size);
+    if (auto const cached = find_cached(offset, read_size)) {
+      return std::make_unique<non_owning_buffer>(const_cast<uint8_t *>(cached), read_size);
+    }
+    std::vector<uint8_t> data(read_size);
+    data.resize(fetch(offset, read_size, data.data()));
+    return std::make_unique<fetched_buffer>(std::move(data));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    auto const read_size = clamped_read_size(offset, size);
+    if (auto const cached = find_cached(offset, read_size)) {
+      std::memcpy(dst, cached, read_size);
+      return read_size;
+    }
+    return fetch(offset, read_size, dst);
+  }
+
+  std::vector<std::future<std::unique_ptr<buffer>>> host_read_async(
+    std::vector<read_range> const &ranges) override
+  {
+    return coalesced_host_read_async(
+      this, ranges, {remote_coalesce_gap, max_remote_read_size, _config.concurrency});
+  }
+
+  size_t size() const override { return _size; }
+
+ private:
+  size_t clamped_read_size(size_t offset, size_t size) const
+  {
+    return (offset < _size) ? std::min(size, _size - offset) : 0;
+  }
+
+  // Returns the address of the cached bytes of the range, or null if they are not cached
+  uint8_t const *find_cached(size_t offset, size_t size) const
+  {
+    for (auto const &cached : {&_head, &_tail}) {
+      if (cached->contains(offset, size)) {
+        return cached->data.data() + (offset - cached->offset);
+      }
+    }
+    return nullptr;
+  }
+
+  // Fetches the head and the tail of the object concurrently; the object size is taken from the
+  // response to the tail request
+  void prefetch()
+  {
+    auto const prefetch_size = std::max<size_t>(_config.prefetch_size, 1);
+    _head.data.resize(prefetch_size);
+    _tail.data.resize(prefetch_size);
+
+    auto head_response = std::async(std::launch::async, [&]() {
+      return request("0-" + std::to_string(prefetch_size - 1), _head.data.data(), prefetch_size);
+    });
+    auto const tail =
+      request('-' + std::to_string(prefetch_size), _tail.data.data(), prefetch_size);
+    auto const head = head_response.get();
+
+    if (tail.status == 416) {
+      // Suffix ranges of empty objects are unsatisfiable
+      _size = 0;
+      _head.data.clear();
+      _tail.data.clear();
+      return;
+    }
+    CUDF_EXPECTS(tail.status == 200 || tail.status == 206, "HTTP error opening remote object");
+
+    if (tail.status == 206 && tail.has_total_size) {
+      _size = tail.total_size;
+    } else {
+      // The server ignored the range; this only works if the whole object fits in the buffer
+      CUDF_EXPECTS(tail.size < prefetch_size, "Remote server does not support range requests");
+      _size = tail.size;
+    }
+    _tail.offset = (tail.status == 206) ? tail.offset : 0;
+    _tail.data.resize(tail.size);
+
+    if (head.status == 200 || head.status == 206) {
+      _head.data.resize(head.size);
+    } else {
+      _head.data.clear();
+    }
+  }
+
+  // Fetches a range that is not cached, checking that the server returned the requested bytes
+  size_t fetch(size_t offset, size_t size, uint8_t *dst)
+  {
+    if (size == 0) { return 0; }
+    auto const response =
+      request(std::to_string(offset) + '-' + std::to_string(offset + size - 1), dst, size);
+    CUDF_EXPECTS(response.status == 206 && response.offset == offset,
+                 "Unexpected response to a remote range request");
+    return response.size;
+  }
+
+  // Sends a request for the byte range, e.g. "0-99" or "-100", writing the body into `dst`
+  range_response request(std::string const &range, uint8_t *dst, size_t capacity)
+  {
+    range_response response;
+    response.dst      = dst;
+    response.capacity = capacity;
+
+    auto const handle   = _handles.acquire();
+    curl_slist *headers = nullptr;
+    curl_easy_setopt(handle, CURLOPT_URL, _config.url.c_str());
+    curl_easy_setopt(handle, CURLOPT_RANGE, range.c_str());
+    curl_easy_setopt(handle, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, write_body);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, &response);
+    curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, read_header);
+    curl_easy_setopt(handle, CURLOPT_HEADERDATA, &response);
+#if LIBCURL_VERSION_NUM >= 0x074b00
+    if (!_config.aws_sigv4.empty()) {
+      curl_easy_setopt(handle, CURLOPT_AWS_SIGV4, _config.aws_sigv4.c_str());
+      curl_easy_setopt(handle, CURLOPT_USERPWD, _config.credentials.c_str());
+      if (!_config.session_token.empty()) {
+        auto const token_header = "x-amz-security-token: " + _config.session_token;
+        headers                 = curl_slist_append(headers, token_header.c_str());
+        curl_easy_setopt(handle, CURLOPT_HTTPHEADER, headers);
+      }
+    }
+#endif
+    auto const result = curl_easy_perform(handle);
+    curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &response.status);
+    curl_slist_free_all(headers);
+    _handles.release(handle);
+
+    // A write error means that the transfer was stopped with the destination full
+    CUDF_EXPECTS(result == CURLE_OK || (result == CURLE_WRITE_ERROR && response.size == capacity),
+                 "Error reading remote object");
+    return response;
+  }
+
+  remote_config const _config;
+  curl_handle_pool _handles;
+  size_t _size = 0;
+  cached_range _head;
+  cached_range _tail;
+};
+#endif
+
+}  // namespace
+
+bool is_remote_path(std::string const &path)
+{
+  return starts_with(path, "http://") || starts_with(path, "https://") ||
+         starts_with(path, "s3://");
+}
+
+std::unique_ptr<datasource> make_remote_source(std::string const &url)
+{
+#ifdef CURL_FOUND
+  return std::make_unique<remote_source>(make_remote_config(url));
+#else
+  CUDF_FAIL("Reading remote paths requires cuDF to be built with libcurl");
+#endif
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
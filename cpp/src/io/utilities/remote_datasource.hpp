@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file remote_datasource.hpp
+ * @brief cuDF-IO datasource that reads objects from HTTP servers and S3-compatible object stores
+ * with range requests
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Returns whether the path is an `http://`, `https://` or `s3://` URL
+ */
+bool is_remote_path(std::string const &path);
+
+/**
+ * @brief Opens an object at an `http://`, `https://` or `s3://` URL
+ *
+ * The object is read with HTTP range requests. On open, the first and the last
+ * `LIBCUDF_REMOTE_PREFETCH_SIZE` bytes (64KB by default) are fetched concurrently, so that the
+ * reads of file headers and footers do not cost additional round trips. Nearby ranges passed to
+ * `host_read_async()` are merged into single requests, and up to `LIBCUDF_REMOTE_CONCURRENCY`
+ * (16 by default) requests are in flight at a time.
+ *
+ * `s3://bucket/key` URLs are sent to `AWS_ENDPOINT_URL` as `<endpoint>/bucket/key` when set,
+ * and to `https://bucket.s3.<AWS_REGION>.amazonaws.com/key` otherwise. Requests are signed with
+ * `AWS_ACCESS_KEY_ID` and `AWS_SECRET_ACCESS_KEY` (and `AWS_SESSION_TOKEN`) when these are set
+ * and libcurl supports SigV4 signing; otherwise the object must be public, or use a presigned
+ * `https://` URL.
+ *
+ * @param url URL of the object
+ *
+ * @throw cudf::logic_error if cuDF is built without libcurl, or the object cannot be read
+ *
+ * @return The datasource
+ */
+std::unique_ptr<datasource> make_remote_source(std::string const &url);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
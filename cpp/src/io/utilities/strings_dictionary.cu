@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "strings_dictionary.hpp"
+
+#include <cudf/detail/transform.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/utilities/bit.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/find.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace io {
+namespace detail {
+std::unique_ptr<column> make_strings_dictionary(
+  column_buffer& buffer,
+  rmm::device_vector<thrust::pair<const char*, size_type>> const& entries,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  using str_pair         = thrust::pair<const char*, size_type>;
+  auto const num_entries = static_cast<size_type>(entries.size());
+  auto const num_rows    = buffer.size;
+  auto const execpol     = rmm::exec_policy(stream);
+
+  // entry ids sorted by the address of the entry
+  rmm::device_vector<const char*> entry_ptrs(num_entries);
+  rmm::device_vector<size_type> entry_ids(num_entries);
+  thrust::transform(execpol->on(stream),
+                    entries.begin(),
+                    entries.end(),
+                    entry_ptrs.begin(),
+                    [] __device__(str_pair const& entry) { return entry.first; });
+  thrust::sequence(execpol->on(stream), entry_ids.begin(), entry_ids.end());
+  thrust::sort_by_key(execpol->on(stream), entry_ptrs.begin(), entry_ptrs.end(), entry_ids.begin());
+
+  // entry of every row, or -1 for rows that do not point to an entry
+  rmm::device_vector<size_type> row_entries(num_rows);
+  auto d_rows      = buffer._strings.data().get();
+  auto d_null_mask = buffer.null_mask<bitmask_type>();
+  auto d_ptrs      = entry_ptrs.data().get();
+  auto d_ids       = entry_ids.data().get();
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    row_entries.begin(),
+                    [d_rows, d_null_mask, d_ptrs, d_ids, num_entries] __device__(size_type idx) {
+                      if (d_null_mask && !bit_is_set(d_null_mask, idx)) return 0;
+                      auto const ptr = d_rows[idx].first;
+                      auto const itr =
+                        thrust::lower_bound(thrust::seq, d_ptrs, d_ptrs + num_entries, ptr);
+                      if (itr == d_ptrs + num_entries || *itr != ptr) return -1;
+                      return d_ids[itr - d_ptrs];
+                    });
+  auto const all_found = thrust::find(execpol->on(stream),
+                                      row_entries.begin(),
+                                      row_entries.end(),
+                                      -1) == row_entries.end();
+  if (!all_found || num_entries == 0) {
+    auto strings = make_column(buffer, stream, rmm::mr::get_default_resource());
+    return cudf::dictionary::detail::encode(
+      strings->view(), data_type{type_id::INT32}, mr, stream);
+  }
+
+  // the entries of all the chunks are encoded into unique, sorted keys
+  auto keys     = make_strings_column(entries, stream);
+  auto codified = cudf::detail::encode(keys->view(), mr, stream);
+  auto d_map    = codified.second->view().data<int32_t>();
+
+  auto indices = make_numeric_column(
+    data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(execpol->on(stream),
+                    row_entries.begin(),
+                    row_entries.end(),
+                    indices->mutable_view().data<int32_t>(),
+                    [d_map] __device__(size_type entry) { return d_map[entry]; });
+
+  auto const null_count = buffer.null_count();
+  return cudf::make_dictionary_column(
+    std::move(codified.first), std::move(indices), std::move(buffer._null_mask), null_count);
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
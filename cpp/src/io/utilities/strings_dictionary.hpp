@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file strings_dictionary.hpp
+ * @brief cuDF-IO utilities for returning dictionary-encoded string data as dictionary columns
+ */
+
+#pragma once
+
+#include <io/utilities/column_buffer.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/pair.h>
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Creates a dictionary column from the decoded strings of a column
+ *
+ * Rows decoded from dictionary-encoded data point to an entry of one of the string dictionaries
+ * of the file's chunks or stripes, so the keys are built from the entries alone, merging the
+ * dictionaries of the chunks, and every row is only mapped to its entry by address. If some rows
+ * were not dictionary encoded, the decoded strings are encoded instead.
+ *
+ * @param buffer Decoded column buffer of string descriptors
+ * @param entries The string dictionary entries of all the chunks of the column
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return DICTIONARY32 column of the strings of `buffer`
+ */
+std::unique_ptr<column> make_strings_dictionary(
+  column_buffer& buffer,
+  rmm::device_vector<thrust::pair<const char*, size_type>> const& entries,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -15,7 +15,9 @@
  */
 
 #include <jit/cache.h>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/jit_cache.hpp>
 
 #include <errno.h>
 #include <fcntl.h>
@@ -23,8 +25,12 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+#include <thread>
 
 #include <cuda.h>
+#include <cuda_runtime.h>
 
 namespace cudf {
 namespace jit {
@@ -85,7 +91,85 @@ boost::filesystem::path getCacheDir()
   return kernel_cache_path;
 }
 
-cudfJitCache::cudfJitCache() {}
+namespace {
+constexpr char const* bundle_magic = "cudf-jit-bundle";
+
+// Compute capability of the current device, which the bundled kernels are compiled for
+std::string current_arch()
+{
+  int device = 0;
+  int major  = 0;
+  int minor  = 0;
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device));
+  CUDA_TRY(cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device));
+  return "sm_" + std::to_string(major) + std::to_string(minor);
+}
+
+void write_string(std::ostream& out, std::string const& str)
+{
+  uint64_t const size = str.size();
+  out.write(reinterpret_cast<char const*>(&size), sizeof(size));
+  out.write(str.data(), str.size());
+}
+
+std::string read_string(std::istream& in)
+{
+  uint64_t size = 0;
+  in.read(reinterpret_cast<char*>(&size), sizeof(size));
+  CUDF_EXPECTS(in.good(), "Truncated kernel bundle.");
+  std::string str(size, '\0');
+  in.read(&str[0], size);
+  CUDF_EXPECTS(in.good(), "Truncated kernel bundle.");
+  return str;
+}
+
+void write_map(std::ostream& out, std::unordered_map<std::string, std::string> const& map)
+{
+  uint64_t const count = map.size();
+  out.write(reinterpret_cast<char const*>(&count), sizeof(count));
+  for (auto const& entry : map) {
+    write_string(out, entry.first);
+    write_string(out, entry.second);
+  }
+}
+
+std::unordered_map<std::string, std::string> read_map(std::istream& in)
+{
+  uint64_t count = 0;
+  in.read(reinterpret_cast<char*>(&count), sizeof(count));
+  CUDF_EXPECTS(in.good(), "Truncated kernel bundle.");
+  std::unordered_map<std::string, std::string> map;
+  for (uint64_t idx = 0; idx < count; ++idx) {
+    auto name = read_string(in);
+    map[name] = read_string(in);
+  }
+  return map;
+}
+
+}  // namespace
+
+cudfJitCache::cudfJitCache()
+{
+  // The in-memory size limit can be set by `LIBCUDF_KERNEL_CACHE_LIMIT`, in bytes
+  auto memory_limit = std::getenv("LIBCUDF_KERNEL_CACHE_LIMIT");
+  if (memory_limit != nullptr) {
+    try {
+      _memory_limit = std::stoull(memory_limit);
+    } catch (std::exception const&) {
+    }
+  }
+
+  // Preload the bundle named by `LIBCUDF_KERNEL_CACHE_BUNDLE`. A bundle which cannot be read only
+  // leaves the kernels to be compiled.
+  auto bundle_path = std::getenv("LIBCUDF_KERNEL_CACHE_BUNDLE");
+  if (bundle_path != nullptr) {
+    try {
+      loadBundle(bundle_path);
+    } catch (std::exception const&) {
+    }
+  }
+}
 
 cudfJitCache::~cudfJitCache() {}
 
@@ -102,7 +186,7 @@ named_prog<jitify::experimental::Program> cudfJitCache::getProgram(
   // Lock for thread safety
   std::lock_guard<std::mutex> lock(_program_cache_mutex);
 
-  return getCached(prog_name, program_map, [&]() {
+  return getCached(prog_name, program_map, bundled_programs, [&]() {
     CUDF_EXPECTS(not cuda_source.empty(), "Program not found in cache, Needs source string.");
     return jitify::experimental::Program(cuda_source, given_headers, given_options, file_callback);
   });
@@ -128,11 +212,99 @@ named_prog<jitify::experimental::KernelInstantiation> cudfJitCache::getKernelIns
 
   auto& kernel_inst_map = kernel_inst_context_map[c];
 
-  return getCached(kern_inst_name, kernel_inst_map, [&]() {
+  return getCached(kern_inst_name, kernel_inst_map, bundled_kernels, [&]() {
     return program.kernel(kern_name).instantiate(arguments);
   });
 }
 
+void cudfJitCache::writeBundle(std::string const& path)
+{
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  CUDF_EXPECTS(out.is_open(), "Cannot open kernel bundle file for writing.");
+  write_string(out, bundle_magic);
+  write_string(out, CUDF_STRINGIFY(CUDF_VERSION));
+  write_string(out, current_arch());
+  std::unordered_map<std::string, std::string> programs;
+  std::unordered_map<std::string, std::string> kernels;
+  {
+    std::lock_guard<std::mutex> lock(_program_cache_mutex);
+    program_map.for_each(
+      [&](std::string const& name, jitify::experimental::Program const& program) {
+        programs[name] = program.serialize();
+      });
+  }
+  {
+    std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
+    for (auto const& context_map : kernel_inst_context_map) {
+      context_map.second.for_each(
+        [&](std::string const& name, jitify::experimental::KernelInstantiation const& kernel) {
+          kernels[name] = kernel.serialize();
+        });
+    }
+  }
+  write_map(out, programs);
+  write_map(out, kernels);
+  out.flush();
+  CUDF_EXPECTS(out.good(), "Failed to write kernel bundle.");
+}
+
+bool cudfJitCache::loadBundle(std::string const& path)
+{
+  std::ifstream in(path, std::ios::binary);
+  CUDF_EXPECTS(in.is_open(), "Cannot open kernel bundle file for reading.");
+  CUDF_EXPECTS(read_string(in) == bundle_magic, "Not a kernel bundle.");
+  if (read_string(in) != CUDF_STRINGIFY(CUDF_VERSION)) { return false; }
+  if (read_string(in) != current_arch()) { return false; }
+  auto programs = read_map(in);
+  auto kernels  = read_map(in);
+  {
+    std::lock_guard<std::mutex> lock(_program_cache_mutex);
+    for (auto& entry : programs) { bundled_programs[entry.first] = std::move(entry.second); }
+  }
+  {
+    std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
+    for (auto& entry : kernels) { bundled_kernels[entry.first] = std::move(entry.second); }
+  }
+  return true;
+}
+
+kernel_cache_stats cudfJitCache::getStats()
+{
+  kernel_cache_stats stats{};
+  stats.memory_hits     = _memory_hits;
+  stats.bundle_hits     = _bundle_hits;
+  stats.file_hits       = _file_hits;
+  stats.misses          = _misses;
+  stats.evictions       = _evictions;
+  stats.compile_seconds = _compile_nanoseconds * 1e-9;
+  {
+    std::lock_guard<std::mutex> lock(_program_cache_mutex);
+    stats.memory_bytes += program_map.bytes();
+  }
+  {
+    std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
+    for (auto const& context_map : kernel_inst_context_map) {
+      stats.memory_bytes += context_map.second.bytes();
+    }
+  }
+  return stats;
+}
+
+void cudfJitCache::setMemoryLimit(std::size_t bytes)
+{
+  _memory_limit = bytes;
+  {
+    std::lock_guard<std::mutex> lock(_program_cache_mutex);
+    _evictions += program_map.trim(bytes);
+  }
+  {
+    std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
+    for (auto& context_map : kernel_inst_context_map) {
+      _evictions += context_map.second.trim(bytes);
+    }
+  }
+}
+
 // Another overload for getKernelInstantiation which might be useful to get
 // kernel instantiations in one step
 // ------------------------------------------------------------------------
@@ -160,45 +332,18 @@ cudfJitCache::cacheFile::~cacheFile() {}
 
 std::string cudfJitCache::cacheFile::read()
 {
-  // Open file (duh)
-  int fd = open(_file_name.c_str(), O_RDWR);
-  if (fd == -1) {
-    successful_read = false;
-    return std::string();
-  }
-
-  // Create args for file locking
-  flock fl{};
-  fl.l_type   = F_RDLCK;  // Shared lock for reading
-  fl.l_whence = SEEK_SET;
-
-  // Lock the file descriptor. Only reading is allowed now
-  if (fcntl(fd, F_SETLKW, &fl) == -1) {
+  // Cache files are replaced atomically, so an open file is always complete
+  std::ifstream file(_file_name, std::ios::binary);
+  if (not file.is_open()) {
     successful_read = false;
     return std::string();
   }
 
-  // Get file descriptor from file pointer
-  FILE* fp = fdopen(fd, "rb");
-
-  // Get file length
-  fseek(fp, 0L, SEEK_END);
-  size_t file_size = ftell(fp);
-  rewind(fp);
-
-  // Allocate memory of file length size
-  std::string content;
-  content.resize(file_size);
-  char* buffer = &content[0];
-
-  // Copy file into buffer
-  if (fread(buffer, file_size, 1, fp) != 1) {
+  std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  if (file.bad()) {
     successful_read = false;
-    fclose(fp);
-    free(buffer);
     return std::string();
   }
-  fclose(fp);
   successful_read = true;
 
   return content;
@@ -206,38 +351,52 @@ std::string cudfJitCache::cacheFile::read()
 
 void cudfJitCache::cacheFile::write(std::string content)
 {
-  // Open file and create if it doesn't exist, with access 0600
-  int fd = open(_file_name.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+  // Write to a temporary file private to this thread, with access 0600
+  std::ostringstream temp_name;
+  temp_name << _file_name << '.' << getpid() << '.' << std::this_thread::get_id() << ".tmp";
+  int fd = open(temp_name.str().c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
   if (fd == -1) {
     successful_write = false;
     return;
   }
 
-  // Create args for file locking
-  flock fl{};
-  fl.l_type   = F_WRLCK;  // Exclusive lock for writing
-  fl.l_whence = SEEK_SET;
+  // Get file pointer from file descriptor
+  FILE* fp = fdopen(fd, "wb");
 
-  // Lock the file descriptor. we the only ones now
-  if (fcntl(fd, F_SETLKW, &fl) == -1) {
+  // Copy string into file
+  bool const written = fwrite(content.c_str(), content.length(), 1, fp) == 1;
+  if (fclose(fp) != 0 or not written) {
+    unlink(temp_name.str().c_str());
     successful_write = false;
     return;
   }
 
-  // Get file descriptor from file pointer
-  FILE* fp = fdopen(fd, "wb");
-
-  // Copy string into file
-  if (fwrite(content.c_str(), content.length(), 1, fp) != 1) {
+  // Replace the cache file in one step
+  if (rename(temp_name.str().c_str(), _file_name.c_str()) != 0) {
+    unlink(temp_name.str().c_str());
     successful_write = false;
-    fclose(fp);
     return;
   }
-  fclose(fp);
 
   successful_write = true;
   return;
 }
 
+void write_kernel_bundle(std::string const& path)
+{
+  CUDF_FUNC_RANGE();
+  cudfJitCache::Instance().writeBundle(path);
+}
+
+bool load_kernel_bundle(std::string const& path)
+{
+  CUDF_FUNC_RANGE();
+  return cudfJitCache::Instance().loadBundle(path);
+}
+
+kernel_cache_stats get_kernel_cache_stats() { return cudfJitCache::Instance().getStats(); }
+
+void set_kernel_cache_limit(std::size_t bytes) { cudfJitCache::Instance().setMemoryLimit(bytes); }
+
 }  // namespace jit
 }  // namespace cudf
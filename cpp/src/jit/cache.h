@@ -19,7 +19,12 @@
 
 #include <boost/filesystem.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/jit_cache.hpp>
 #include <jitify.hpp>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -100,28 +105,142 @@ class cudfJitCache {
     std::vector<std::string> const& given_options          = {},
     jitify::experimental::file_callback_type file_callback = nullptr);
 
+  /**
+   * @brief Get the hit, miss and compile time counters of the cache
+   **/
+  kernel_cache_stats getStats();
+
+  /**
+   * @brief Set the serialized size over which the least recently used programs, and the least
+   * recently used kernels of each CUDA context, are evicted from memory
+   *
+   * @param bytes  size limit of each in-memory tier
+   **/
+  void setMemoryLimit(std::size_t bytes);
+
+  /**
+   * @brief Write every program and kernel in the in-memory cache to a bundle file
+   *
+   * The bundle is tagged with the cudf version and the compute capability of the current
+   * device, and can be loaded by `loadBundle` in another process to skip their JIT compilation.
+   *
+   * @param path  path of the bundle file to write
+   **/
+  void writeBundle(std::string const& path);
+
+  /**
+   * @brief Load the programs and kernels of a bundle file written by `writeBundle`
+   *
+   * The bundled objects are searched after the in-memory cache and before the file cache.
+   *
+   * @param path  path of the bundle file to load
+   * @return true The bundle was loaded
+   * @return false The bundle was written by another cudf version or for another compute
+   * capability and was ignored
+   **/
+  bool loadBundle(std::string const& path);
+
  private:
+  /**
+   * @brief In-memory cache tier which evicts the least recently used objects over a size limit
+   *
+   * Evicted objects stay alive as long as a launcher holds them.
+   **/
   template <typename Tv>
-  using umap_str_shptr = std::unordered_map<std::string, std::shared_ptr<Tv>>;
+  class lru_map {
+   public:
+    /**
+     * @brief Find an object and mark it as the most recently used one, or return nullptr
+     **/
+    std::shared_ptr<Tv> find(std::string const& name)
+    {
+      auto it = _entries.find(name);
+      if (it == _entries.end()) { return nullptr; }
+      _order.splice(_order.begin(), _order, it->second.position);
+      return it->second.value;
+    }
+
+    /**
+     * @brief Insert an object which is not in the map and evict objects over `limit` bytes
+     *
+     * @return The number of evicted objects
+     **/
+    std::size_t insert(std::string const& name,
+                       std::shared_ptr<Tv> value,
+                       std::size_t bytes,
+                       std::size_t limit)
+    {
+      _order.push_front(name);
+      _entries[name] = entry{std::move(value), bytes, _order.begin()};
+      _bytes += bytes;
+      return trim(limit);
+    }
+
+    /**
+     * @brief Evict the least recently used objects, but the most recent one, over `limit` bytes
+     *
+     * @return The number of evicted objects
+     **/
+    std::size_t trim(std::size_t limit)
+    {
+      std::size_t evicted = 0;
+      while (_bytes > limit and _order.size() > 1) {
+        auto it = _entries.find(_order.back());
+        _bytes -= it->second.bytes;
+        _entries.erase(it);
+        _order.pop_back();
+        ++evicted;
+      }
+      return evicted;
+    }
+
+    std::size_t bytes() const { return _bytes; }
 
-  std::unordered_map<CUcontext, umap_str_shptr<jitify::experimental::KernelInstantiation>>
+    template <typename Func>
+    void for_each(Func func) const
+    {
+      for (auto const& item : _entries) { func(item.first, *item.second.value); }
+    }
+
+   private:
+    struct entry {
+      std::shared_ptr<Tv> value;
+      std::size_t bytes;
+      std::list<std::string>::iterator position;
+    };
+    std::unordered_map<std::string, entry> _entries;
+    std::list<std::string> _order;  // most recently used first
+    std::size_t _bytes = 0;
+  };
+
+  std::unordered_map<CUcontext, lru_map<jitify::experimental::KernelInstantiation>>
     kernel_inst_context_map;
-  umap_str_shptr<jitify::experimental::Program> program_map;
+  lru_map<jitify::experimental::Program> program_map;
+
+  // serialized objects loaded from bundles, guarded by the mutex of their kind
+  std::unordered_map<std::string, std::string> bundled_programs;
+  std::unordered_map<std::string, std::string> bundled_kernels;
+
+  std::atomic<std::size_t> _memory_limit{std::numeric_limits<std::size_t>::max()};
+  std::atomic<std::size_t> _memory_hits{0};
+  std::atomic<std::size_t> _bundle_hits{0};
+  std::atomic<std::size_t> _file_hits{0};
+  std::atomic<std::size_t> _misses{0};
+  std::atomic<std::size_t> _evictions{0};
+  std::atomic<int64_t> _compile_nanoseconds{0};
 
   /*
-    Even though this class can be used as a non-singleton, the file cache
-    access should remain limited to one thread per process. The lockf locks can
-    prevent multiple processes from accessing the file but are ineffective in
-    preventing multiple threads from doing so as the lock is shared by the
-    entire process.
-    Therefore the mutexes are static.
+    The mutexes guard the in-memory tiers. Cache files are written to a
+    temporary file private to the writing thread and renamed into place, so
+    several threads and processes can share the cache directory without
+    locking.
     */
   static std::mutex _kernel_cache_mutex;
   static std::mutex _program_cache_mutex;
 
  private:
   /**
-   * @brief Class to allow process wise exclusive access to cache files
+   * @brief Class to read and atomically replace cache files
    *
    **/
   class cacheFile {
@@ -143,6 +262,8 @@ class cudfJitCache {
     /**
      * @brief Write the passed string to this file
      *
+     * The string is written to a temporary file which is renamed over this file, so readers see
+     * either the previous or the new content in full.
      **/
     void write(std::string);
 
@@ -165,27 +286,43 @@ class cudfJitCache {
 
  private:
   template <typename T, typename FallbackFunc>
-  named_prog<T> getCached(std::string const& name, umap_str_shptr<T>& map, FallbackFunc func)
+  named_prog<T> getCached(std::string const& name,
+                          lru_map<T>& map,
+                          std::unordered_map<std::string, std::string> const& bundled,
+                          FallbackFunc func)
   {
     // Find memory cached T object
-    auto it = map.find(name);
-    if (it != map.end()) {
-      return std::make_pair(name, it->second);
-    } else {  // Find file cached T object
+    auto cached = map.find(name);
+    if (cached != nullptr) {
+      ++_memory_hits;
+      return std::make_pair(name, cached);
+    } else {  // Find bundled or file cached T object
       bool successful_read = false;
       std::string serialized;
+      auto bundled_it = bundled.find(name);
+      if (bundled_it != bundled.end()) {
+        serialized      = bundled_it->second;
+        successful_read = true;
+        ++_bundle_hits;
+      }
 #if defined(JITIFY_USE_CACHE)
       boost::filesystem::path cache_dir = getCacheDir();
-      if (not cache_dir.empty()) {
+      if (not successful_read and not cache_dir.empty()) {
         boost::filesystem::path file_name = cache_dir / name;
         cacheFile file{file_name.string()};
         serialized      = file.read();
         successful_read = file.is_read_successful();
+        if (successful_read) { ++_file_hits; }
       }
 #endif
       if (not successful_read) {
         // JIT compile and write to file if possible
-        serialized = func().serialize();
+        ++_misses;
+        auto const start = std::chrono::steady_clock::now();
+        serialized       = func().serialize();
+        _compile_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count();
 #if defined(JITIFY_USE_CACHE)
         if (not cache_dir.empty()) {
           boost::filesystem::path file_name = cache_dir / name;
@@ -196,7 +333,7 @@ class cudfJitCache {
       }
       // Add deserialized T to cache and return
       auto program = std::make_shared<T>(T::deserialize(serialized));
-      map[name]    = program;
+      _evictions += map.insert(name, program, serialized.size(), _memory_limit);
       return std::make_pair(name, program);
     }
   }
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/udf.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace {
+
+std::string udf_name(std::string const& source, udf_type type, data_type output_type)
+{
+  auto const signature = std::string(type == udf_type::PTX ? "ptx." : "cuda.") +
+                         std::to_string(static_cast<int32_t>(output_type.id())) + "." + source;
+  return "prog_udf." + std::to_string(std::hash<std::string>{}(signature));
+}
+
+}  // namespace
+
+compiled_udf::compiled_udf(std::string source, udf_type type, data_type output_type)
+  : _source{std::move(source)},
+    _type{type},
+    _output_type{output_type},
+    _name{udf_name(_source, type, output_type)}
+{
+}
+
+std::pair<std::string, std::string> const& compiled_udf::program(
+  std::string const& kernel, std::function<std::string()> const& build) const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto it = _programs.find(kernel);
+  if (it == _programs.end()) {
+    it = _programs.emplace(kernel, std::make_pair(_name + "." + kernel, build())).first;
+  }
+  // Elements of an unordered_map are not moved by later insertions.
+  return it->second;
+}
+
+std::shared_ptr<compiled_udf const> compile_udf(std::string const& source,
+                                                udf_type type,
+                                                data_type output_type)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not source.empty(), "Empty UDF source");
+  return std::make_shared<compiled_udf const>(source, type, output_type);
+}
+
+}  // namespace cudf
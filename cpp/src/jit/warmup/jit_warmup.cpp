@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file jit_warmup.cpp
+ * @brief Precompiles a declared set of JIT kernels into a bundle for the kernel cache.
+ *
+ * Usage: `cudf_jit_warmup <declarations file> <bundle file>`
+ *
+ * Every line of the declarations file declares the kernels of one operation; empty lines and
+ * lines starting with `#` are ignored:
+ *
+ *     binaryop <lhs type> <rhs type> <operator> <output type>
+ *     binaryop_ptx <lhs type> <rhs type> <PTX file> <output type>
+ *
+ * Types are `type_id` names, e.g. `INT32`, and operators are `binary_operator` names, e.g. `ADD`.
+ *
+ * The bundle is written for the current device, and is loaded by setting
+ * `LIBCUDF_KERNEL_CACHE_BUNDLE` to its path or by `cudf::jit::load_kernel_bundle`.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/jit_cache.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace {
+cudf::data_type parse_type(std::string const& name)
+{
+  static std::unordered_map<std::string, cudf::type_id> const types{
+    {"INT8", cudf::type_id::INT8},
+    {"INT16", cudf::type_id::INT16},
+    {"INT32", cudf::type_id::INT32},
+    {"INT64", cudf::type_id::INT64},
+    {"UINT8", cudf::type_id::UINT8},
+    {"UINT16", cudf::type_id::UINT16},
+    {"UINT32", cudf::type_id::UINT32},
+    {"UINT64", cudf::type_id::UINT64},
+    {"FLOAT32", cudf::type_id::FLOAT32},
+    {"FLOAT64", cudf::type_id::FLOAT64},
+    {"BOOL8", cudf::type_id::BOOL8},
+    {"TIMESTAMP_DAYS", cudf::type_id::TIMESTAMP_DAYS},
+    {"TIMESTAMP_SECONDS", cudf::type_id::TIMESTAMP_SECONDS},
+    {"TIMESTAMP_MILLISECONDS", cudf::type_id::TIMESTAMP_MILLISECONDS},
+    {"TIMESTAMP_MICROSECONDS", cudf::type_id::TIMESTAMP_MICROSECONDS},
+    {"TIMESTAMP_NANOSECONDS", cudf::type_id::TIMESTAMP_NANOSECONDS},
+    {"DURATION_DAYS", cudf::type_id::DURATION_DAYS},
+    {"DURATION_SECONDS", cudf::type_id::DURATION_SECONDS},
+    {"DURATION_MILLISECONDS", cudf::type_id::DURATION_MILLISECONDS},
+    {"DURATION_MICROSECONDS", cudf::type_id::DURATION_MICROSECONDS},
+    {"DURATION_NANOSECONDS", cudf::type_id::DURATION_NANOSECONDS},
+    {"DECIMAL32", cudf::type_id::DECIMAL32},
+    {"DECIMAL64", cudf::type_id::DECIMAL64},
+    {"STRING", cudf::type_id::STRING}};
+
+  auto const it = types.find(name);
+  if (it == types.end()) { throw std::invalid_argument("Unknown type " + name); }
+  return cudf::data_type{it->second};
+}
+
+cudf::binary_operator parse_operator(std::string const& name)
+{
+  using cudf::binary_operator;
+  static std::unordered_map<std::string, binary_operator> const operators{
+    {"ADD", binary_operator::ADD},
+    {"SUB", binary_operator::SUB},
+    {"MUL", binary_operator::MUL},
+    {"DIV", binary_operator::DIV},
+    {"TRUE_DIV", binary_operator::TRUE_DIV},
+    {"FLOOR_DIV", binary_operator::FLOOR_DIV},
+    {"MOD", binary_operator::MOD},
+    {"PYMOD", binary_operator::PYMOD},
+    {"POW", binary_operator::POW},
+    {"EQUAL", binary_operator::EQUAL},
+    {"NOT_EQUAL", binary_operator::NOT_EQUAL},
+    {"LESS", binary_operator::LESS},
+    {"GREATER", binary_operator::GREATER},
+    {"LESS_EQUAL", binary_operator::LESS_EQUAL},
+    {"GREATER_EQUAL", binary_operator::GREATER_EQUAL},
+    {"BITWISE_AND", binary_operator::BITWISE_AND},
+    {"BITWISE_OR", binary_operator::BITWISE_OR},
+    {"BITWISE_XOR", binary_operator::BITWISE_XOR},
+    {"LOGICAL_AND", binary_operator::LOGICAL_AND},
+    {"LOGICAL_OR", binary_operator::LOGICAL_OR},
+    {"COALESCE", binary_operator::COALESCE},
+    {"SHIFT_LEFT", binary_operator::SHIFT_LEFT},
+    {"SHIFT_RIGHT", binary_operator::SHIFT_RIGHT},
+    {"SHIFT_RIGHT_UNSIGNED", binary_operator::SHIFT_RIGHT_UNSIGNED},
+    {"LOG_BASE", binary_operator::LOG_BASE},
+    {"ATAN2", binary_operator::ATAN2},
+    {"PMOD", binary_operator::PMOD},
+    {"NULL_EQUALS", binary_operator::NULL_EQUALS},
+    {"NULL_MAX", binary_operator::NULL_MAX},
+    {"NULL_MIN", binary_operator::NULL_MIN}};
+
+  auto const it = operators.find(name);
+  if (it == operators.end()) {
+    throw std::invalid_argument("Unknown binary operator " + name);
+  }
+  return it->second;
+}
+
+std::string read_file(std::string const& path)
+{
+  std::ifstream in(path);
+  if (not in.is_open()) { throw std::invalid_argument("Cannot open " + path); }
+  std::stringstream content;
+  content << in.rdbuf();
+  return content.str();
+}
+
+void precompile(std::string const& line)
+{
+  std::istringstream tokens(line);
+  std::string kind, lhs, rhs, op, output;
+  tokens >> kind >> lhs >> rhs >> op >> output;
+  if (output.empty()) { throw std::invalid_argument("Incomplete declaration: " + line); }
+  if (kind == "binaryop") {
+    cudf::precompile_binary_operation(
+      parse_type(lhs), parse_type(rhs), parse_operator(op), parse_type(output));
+  } else if (kind == "binaryop_ptx") {
+    cudf::precompile_binary_operation(
+      parse_type(lhs), parse_type(rhs), read_file(op), parse_type(output));
+  } else {
+    throw std::invalid_argument("Unknown kernel kind " + kind);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <declarations file> <bundle file>" << std::endl;
+    return 1;
+  }
+
+  try {
+    std::ifstream declarations(argv[1]);
+    if (not declarations.is_open()) {
+      throw std::invalid_argument(std::string{"Cannot open "} + argv[1]);
+    }
+    std::string line;
+    int count = 0;
+    while (std::getline(declarations, line)) {
+      auto const first = line.find_first_not_of(" \t");
+      if (first == std::string::npos or line[first] == '#') { continue; }
+      precompile(line);
+      ++count;
+    }
+    cudf::jit::write_kernel_bundle(argv[2]);
+    std::cout << "Wrote the kernels of " << count << " declarations to " << argv[2] << std::endl;
+  } catch (std::exception const& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+#include "join_common_utils.hpp"
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int bloom_words_per_block = 8;
+constexpr int bloom_bits_per_block  = bloom_words_per_block * 32;
+
+/**
+ * @brief Odd constants selecting the bit set in each word of a block, as in the Parquet split
+ * block Bloom filter
+ */
+__constant__ uint32_t bloom_salts[bloom_words_per_block] = {0x47b6137bU,
+                                                            0x44974d91U,
+                                                            0x8824ad5bU,
+                                                            0xa2b7289dU,
+                                                            0x705495c7U,
+                                                            0x2df1424bU,
+                                                            0x9efc4947U,
+                                                            0x5c6bfb31U};
+
+/**
+ * @brief Spreads the 32-bit row hash over 64 bits, the upper half selecting the block and the
+ * lower half the bits within the block
+ */
+__device__ inline uint64_t bloom_hash(hash_value_type row_hash_value)
+{
+  uint64_t x = row_hash_value + 0x9e3779b97f4a7c15ull;
+  x          = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x          = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+__device__ inline uint32_t bloom_block_index(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+__device__ inline uint32_t bloom_block_bit(uint64_t hash, int word)
+{
+  return 1u << ((static_cast<uint32_t>(hash) * bloom_salts[word]) >> 27);
+}
+
+__device__ inline bool row_has_nulls(table_device_view const& keys, size_type row_index)
+{
+  for (auto const& col : keys) {
+    if (col.is_null(row_index)) { return true; }
+  }
+  return false;
+}
+
+/**
+ * @brief Sets the bits of a key row in the filter
+ */
+struct insert_bloom_key {
+  table_device_view keys;
+  row_hash hash_keys;
+  uint32_t* words;
+  uint32_t num_blocks;
+  bool skip_nulls;
+
+  __device__ void operator()(size_type row_index) const
+  {
+    if (skip_nulls && row_has_nulls(keys, row_index)) { return; }
+    auto const hash = bloom_hash(hash_keys(row_index));
+    auto block      = words + bloom_block_index(hash, num_blocks) * bloom_words_per_block;
+    for (int i = 0; i < bloom_words_per_block; ++i) {
+      atomicOr(block + i, bloom_block_bit(hash, i));
+    }
+  }
+};
+
+/**
+ * @brief Returns whether all the bits of a row are set in the filter
+ */
+struct find_bloom_key {
+  table_device_view keys;
+  row_hash hash_keys;
+  uint32_t const* words;
+  uint32_t num_blocks;
+  bool skip_nulls;
+
+  __device__ bool operator()(size_type row_index) const
+  {
+    if (skip_nulls && row_has_nulls(keys, row_index)) { return false; }
+    auto const hash = bloom_hash(hash_keys(row_index));
+    auto block      = words + bloom_block_index(hash, num_blocks) * bloom_words_per_block;
+    for (int i = 0; i < bloom_words_per_block; ++i) {
+      auto const bit = bloom_block_bit(hash, i);
+      if ((block[i] & bit) != bit) { return false; }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Returns the number of blocks giving at least `bits_per_key` bits to each key row
+ */
+uint32_t compute_num_blocks(size_type num_rows, size_type bits_per_key)
+{
+  auto const num_bits = static_cast<uint64_t>(num_rows) * bits_per_key;
+  return static_cast<uint32_t>(
+    std::max<uint64_t>(1, (num_bits + bloom_bits_per_block - 1) / bloom_bits_per_block));
+}
+
+/**
+ * @brief Returns whether the minimum and maximum of a column can be pushed to the readers
+ */
+bool has_range_statistics(data_type type)
+{
+  return type.id() != type_id::BOOL8 &&
+         (is_numeric(type) || is_chrono(type) || type.id() == type_id::STRING);
+}
+
+}  // namespace
+}  // namespace detail
+
+struct bloom_filter::bloom_filter_impl {
+  rmm::device_buffer words;
+  uint32_t num_blocks;
+  null_equality compare_nulls;
+  std::vector<data_type> key_types;
+  std::vector<std::shared_ptr<scalar const>> key_min;  // null if the column cannot be bounded
+  std::vector<std::shared_ptr<scalar const>> key_max;
+
+  bloom_filter_impl(table_view const& keys,
+                    size_type bits_per_key,
+                    null_equality compare_nulls,
+                    rmm::mr::device_memory_resource* mr,
+                    cudaStream_t stream)
+    : num_blocks(0), compare_nulls(compare_nulls)
+  {
+    CUDF_FUNC_RANGE();
+    CUDF_EXPECTS(0 != keys.num_columns(), "Bloom filter key table is empty");
+    CUDF_EXPECTS(bits_per_key > 0, "Bloom filter needs at least one bit per key");
+
+    num_blocks = detail::compute_num_blocks(keys.num_rows(), bits_per_key);
+    words      = rmm::device_buffer(
+      size_t{num_blocks} * detail::bloom_words_per_block * sizeof(uint32_t), stream, mr);
+    CUDA_TRY(cudaMemsetAsync(words.data(), 0, words.size(), stream));
+
+    auto keys_d = table_device_view::create(keys, stream);
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       keys.num_rows(),
+                       detail::insert_bloom_key{*keys_d,
+                                                detail::row_hash{*keys_d},
+                                                static_cast<uint32_t*>(words.data()),
+                                                num_blocks,
+                                                compare_nulls == null_equality::UNEQUAL});
+
+    for (auto const& col : keys) {
+      key_types.push_back(col.type());
+      // Rows with a null key only match other nulls, which no range predicate can keep
+      bool const nulls_match = compare_nulls == null_equality::EQUAL && col.has_nulls();
+      if (!detail::has_range_statistics(col.type()) || nulls_match) {
+        key_min.emplace_back(nullptr);
+        key_max.emplace_back(nullptr);
+        continue;
+      }
+      std::shared_ptr<scalar const> min = reduce(col, make_min_aggregation(), col.type());
+      std::shared_ptr<scalar const> max = reduce(col, make_max_aggregation(), col.type());
+      bool const bounded                = min->is_valid(stream) && max->is_valid(stream);
+      key_min.emplace_back(bounded ? std::move(min) : nullptr);
+      key_max.emplace_back(bounded ? std::move(max) : nullptr);
+    }
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+};
+
+bloom_filter::~bloom_filter() = default;
+
+bloom_filter::bloom_filter(table_view const& keys,
+                           size_type bits_per_key,
+                           null_equality compare_nulls,
+                           rmm::mr::device_memory_resource* mr)
+  : impl{std::make_unique<const bloom_filter_impl>(keys, bits_per_key, compare_nulls, mr, 0)}
+{
+}
+
+std::unique_ptr<column> bloom_filter::contains(table_view const& keys,
+                                               rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(std::equal(impl->key_types.cbegin(),
+                          impl->key_types.cend(),
+                          keys.begin(),
+                          keys.end(),
+                          [](auto const& type, auto const& col) { return type == col.type(); }),
+               "Mismatch in Bloom filter key column types");
+
+  cudaStream_t stream = 0;
+  auto result         = make_numeric_column(
+    data_type{type_id::BOOL8}, keys.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  auto keys_d = table_device_view::create(keys, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(keys.num_rows()),
+                    result->mutable_view().begin<bool>(),
+                    detail::find_bloom_key{*keys_d,
+                                           detail::row_hash{*keys_d},
+                                           static_cast<uint32_t const*>(impl->words.data()),
+                                           impl->num_blocks,
+                                           impl->compare_nulls == null_equality::UNEQUAL});
+  return result;
+}
+
+std::vector<io::column_predicate> bloom_filter::range_predicates(
+  std::vector<std::string> const& column_names) const
+{
+  CUDF_EXPECTS(column_names.size() == impl->key_types.size(),
+               "Mismatch in number of Bloom filter key columns and names");
+
+  std::vector<io::column_predicate> predicates;
+  for (size_t i = 0; i < column_names.size(); ++i) {
+    if (impl->key_min[i] == nullptr) { continue; }
+    predicates.emplace_back(column_names[i], io::filter_op::GREATER_EQUAL, impl->key_min[i]);
+    predicates.emplace_back(column_names[i], io::filter_op::LESS_EQUAL, impl->key_max[i]);
+  }
+  return predicates;
+}
+
+}  // namespace cudf
@@ -14,11 +14,15 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/detail/transform.hpp>
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/repeat.hpp>
 #include <cudf/detail/reshape.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/filling.hpp>
 #include <cudf/join.hpp>
 #include <cudf/reshape.hpp>
@@ -27,6 +31,13 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 /**
@@ -68,14 +79,174 @@ std::unique_ptr<cudf::table> cross_join(
 
   return std::make_unique<table>(std::move(left_repeated_columns));
 }
+
+namespace {
+/**
+ * @brief Returns the row of `left` of a pair of a cross join, whose pairs are numbered from the
+ * first row of `left` of a chunk
+ */
+struct cross_join_left_row {
+  size_type first_left_row;
+  size_type right_rows;
+  CUDA_DEVICE_CALLABLE size_type operator()(size_type pair) const
+  {
+    return first_left_row + pair / right_rows;
+  }
+};
+
+/**
+ * @brief Returns the row of `right` of a pair of a cross join
+ */
+struct cross_join_right_row {
+  size_type right_rows;
+  CUDA_DEVICE_CALLABLE size_type operator()(size_type pair) const { return pair % right_rows; }
+};
+
+}  // namespace
 }  // namespace detail
 
+struct chunked_cross_join::chunked_cross_join_impl {
+  table_view left;
+  table_view right;
+  ast::expression const* predicate;
+  size_type left_rows_per_chunk;
+  size_type next_left_row{0};
+
+  chunked_cross_join_impl(table_view const& left,
+                          table_view const& right,
+                          size_type max_chunk_pairs,
+                          ast::expression const* predicate)
+    : left(left), right(right), predicate(predicate)
+  {
+    CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+    CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+    CUDF_EXPECTS(max_chunk_pairs > 0, "Chunks must hold at least one pair of rows");
+    left_rows_per_chunk = std::max(1, max_chunk_pairs / std::max(1, right.num_rows()));
+  }
+
+  bool has_next() const { return next_left_row < left.num_rows() && right.num_rows() > 0; }
+
+  /**
+   * @brief Returns the rows of `left` of the next chunk, and moves past them
+   */
+  std::pair<size_type, size_type> advance()
+  {
+    CUDF_EXPECTS(has_next(), "No chunks left in the cross join");
+    auto const begin = next_left_row;
+    next_left_row    = begin + std::min(left_rows_per_chunk, left.num_rows() - begin);
+    return {begin, next_left_row};
+  }
+
+  /**
+   * @brief Returns the indices of all the pairs of the left rows `[begin, end)`, before the
+   * predicate is applied
+   */
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> pair_indices(
+    size_type begin, size_type end, rmm::mr::device_memory_resource* mr, cudaStream_t stream) const
+  {
+    auto const num_pairs = (end - begin) * right.num_rows();
+    auto left_indices    = make_numeric_column(
+      data_type{type_id::INT32}, num_pairs, mask_state::UNALLOCATED, stream, mr);
+    auto right_indices = make_numeric_column(
+      data_type{type_id::INT32}, num_pairs, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_pairs),
+                      left_indices->mutable_view().begin<size_type>(),
+                      detail::cross_join_left_row{begin, right.num_rows()});
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_pairs),
+                      right_indices->mutable_view().begin<size_type>(),
+                      detail::cross_join_right_row{right.num_rows()});
+    return {std::move(left_indices), std::move(right_indices)};
+  }
+
+  /**
+   * @brief Returns the indices of the pairs of the left rows `[begin, end)` which satisfy the
+   * predicate
+   */
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> filtered_indices(
+    size_type begin, size_type end, rmm::mr::device_memory_resource* mr, cudaStream_t stream) const
+  {
+    auto const temp_mr       = rmm::mr::get_default_resource();
+    auto const all_pairs     = pair_indices(begin, end, temp_mr, stream);
+    auto const left_indices  = all_pairs.first->view();
+    auto const right_indices = all_pairs.second->view();
+    auto const keep          = ast::detail::compute_column(
+      left, right, left_indices, right_indices, *predicate, temp_mr, stream);
+    CUDF_EXPECTS(keep->type().id() == type_id::BOOL8, "The predicate must be a BOOL8 expression");
+    auto kept = detail::apply_boolean_mask(
+                  table_view{{left_indices, right_indices}}, keep->view(), mr, stream)
+                  ->release();
+    return {std::move(kept[0]), std::move(kept[1])};
+  }
+};
+
+chunked_cross_join::~chunked_cross_join() = default;
+
+chunked_cross_join::chunked_cross_join(table_view const& left,
+                                       table_view const& right,
+                                       size_type max_chunk_pairs,
+                                       ast::expression const* predicate)
+  : impl{std::make_unique<chunked_cross_join_impl>(left, right, max_chunk_pairs, predicate)}
+{
+}
+
+bool chunked_cross_join::has_next() const { return impl->has_next(); }
+
+size_type chunked_cross_join::remaining_left_rows() const
+{
+  return impl->left.num_rows() - impl->next_left_row;
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> chunked_cross_join::next_indices(
+  rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  auto const rows = impl->advance();
+  return impl->predicate == nullptr ? impl->pair_indices(rows.first, rows.second, mr, stream)
+                                    : impl->filtered_indices(rows.first, rows.second, mr, stream);
+}
+
+std::unique_ptr<table> chunked_cross_join::next(rmm::mr::device_memory_resource* mr,
+                                                cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  auto const rows = impl->advance();
+  if (impl->predicate == nullptr) {
+    auto const left_rows = slice(impl->left, {rows.first, rows.second})[0];
+    return detail::cross_join(left_rows, impl->right, stream, mr);
+  }
+
+  // Only the pairs which satisfy the predicate are gathered
+  auto const indices = impl->filtered_indices(
+    rows.first, rows.second, rmm::mr::get_default_resource(), stream);
+  auto columns = detail::gather(impl->left,
+                                indices.first->view(),
+                                detail::out_of_bounds_policy::IGNORE,
+                                detail::negative_index_policy::NOT_ALLOWED,
+                                mr,
+                                stream)
+                   ->release();
+  auto right_columns = detail::gather(impl->right,
+                                      indices.second->view(),
+                                      detail::out_of_bounds_policy::IGNORE,
+                                      detail::negative_index_policy::NOT_ALLOWED,
+                                      mr,
+                                      stream)
+                         ->release();
+  std::move(right_columns.begin(), right_columns.end(), std::back_inserter(columns));
+  return std::make_unique<table>(std::move(columns));
+}
+
 std::unique_ptr<cudf::table> cross_join(cudf::table_view const& left,
                                         cudf::table_view const& right,
-                                        rmm::mr::device_memory_resource* mr)
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::cross_join(left, right, 0, mr);
+  return detail::cross_join(left, right, stream, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/communicator.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Tags of the messages of a distributed join
+ */
+enum message_tag : int {
+  HEADER_TAG,          ///< Sizes of the metadata and data of both partitions
+  RIGHT_METADATA_TAG,  ///< Column layout of the partition of `right`
+  RIGHT_DATA_TAG,      ///< Contiguous data of the partition of `right`
+  LEFT_METADATA_TAG,   ///< Column layout of the partition of `left`
+  LEFT_DATA_TAG        ///< Contiguous data of the partition of `left`
+};
+
+// Metadata and data sizes in bytes of the right, then the left partition
+using message_header = std::array<int64_t, 4>;
+
+/**
+ * @brief Appends the layout of `col` to `metadata`, with its buffers as offsets from `base`
+ *
+ * Buffers outside of the `size` bytes at `base`, which only empty columns have, are written as -1.
+ */
+void pack_column(column_view const& col,
+                 uint8_t const* base,
+                 size_t size,
+                 std::vector<int64_t>& metadata)
+{
+  auto offset_of = [&](void const* ptr) -> int64_t {
+    auto const address = static_cast<uint8_t const*>(ptr);
+    if (address == nullptr || address < base || address >= base + size) { return -1; }
+    return address - base;
+  };
+  metadata.push_back(static_cast<int64_t>(col.type().id()));
+  metadata.push_back(col.size());
+  metadata.push_back(col.null_count());
+  metadata.push_back(col.offset());
+  metadata.push_back(offset_of(col.head()));
+  metadata.push_back(offset_of(col.null_mask()));
+  metadata.push_back(col.num_children());
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    pack_column(col.child(i), base, size, metadata);
+  }
+}
+
+/**
+ * @brief Rebuilds a column packed by `pack_column` over the data at `base`, advancing `metadata`
+ */
+column_view unpack_column(int64_t const*& metadata, uint8_t const* base)
+{
+  auto pointer_at = [base](int64_t offset) -> void const* {
+    return offset < 0 ? nullptr : base + offset;
+  };
+  auto const id           = static_cast<type_id>(*metadata++);
+  auto const size         = static_cast<size_type>(*metadata++);
+  auto const null_count   = static_cast<size_type>(*metadata++);
+  auto const offset       = static_cast<size_type>(*metadata++);
+  auto const data         = pointer_at(*metadata++);
+  auto const null_mask    = static_cast<bitmask_type const*>(pointer_at(*metadata++));
+  auto const num_children = static_cast<size_type>(*metadata++);
+
+  std::vector<column_view> children;
+  for (size_type i = 0; i < num_children; ++i) {
+    children.push_back(unpack_column(metadata, base));
+  }
+  return column_view(data_type{id}, size, data, null_mask, null_count, offset, children);
+}
+
+/**
+ * @brief One partition of a table, as the layout of its columns and their contiguous data
+ */
+struct packed_partition {
+  explicit packed_partition(contiguous_split_result&& split) : data(std::move(split.all_data))
+  {
+    auto const base = data ? static_cast<uint8_t const*>(data->data()) : nullptr;
+    auto const size = data ? data->size() : 0;
+    metadata.push_back(split.table.num_columns());
+    for (auto const& col : split.table) { pack_column(col, base, size, metadata); }
+  }
+
+  int64_t metadata_size() const { return metadata.size() * sizeof(int64_t); }
+  int64_t data_size() const { return data ? data->size() : 0; }
+
+  std::vector<int64_t> metadata;
+  std::unique_ptr<rmm::device_buffer> data;
+};
+
+/**
+ * @brief A partition being received from another rank
+ */
+class incoming_partition {
+ public:
+  /**
+   * @brief Starts receiving a partition of `metadata_size` and `data_size` bytes from `peer`
+   */
+  void receive(communicator& comm,
+               int peer,
+               int64_t metadata_size,
+               int64_t data_size,
+               int metadata_tag,
+               int data_tag,
+               cudaStream_t stream)
+  {
+    _metadata = rmm::device_buffer(metadata_size, stream);
+    _data     = rmm::device_buffer(data_size, stream);
+    _requests.push_back(comm.recv(_metadata.data(), metadata_size, peer, metadata_tag, stream));
+    if (data_size > 0) {
+      _requests.push_back(comm.recv(_data.data(), data_size, peer, data_tag, stream));
+    }
+  }
+
+  bool has_arrived()
+  {
+    return std::all_of(_requests.begin(), _requests.end(), [](auto& r) { return r->test(); });
+  }
+
+  /**
+   * @brief Waits for the partition and returns its view, valid until `release` is called
+   */
+  table_view view(cudaStream_t stream)
+  {
+    for (auto& r : _requests) { r->wait(); }
+    _requests.clear();
+
+    std::vector<int64_t> metadata(_metadata.size() / sizeof(int64_t));
+    CUDA_TRY(cudaMemcpyAsync(
+      metadata.data(), _metadata.data(), _metadata.size(), cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    int64_t const* it = metadata.data();
+    auto const base   = static_cast<uint8_t const*>(_data.data());
+    std::vector<column_view> columns(*it++);
+    for (auto& col : columns) { col = unpack_column(it, base); }
+    return table_view(columns);
+  }
+
+  void release()
+  {
+    _metadata = rmm::device_buffer{};
+    _data     = rmm::device_buffer{};
+  }
+
+ private:
+  rmm::device_buffer _metadata;
+  rmm::device_buffer _data;
+  std::vector<std::unique_ptr<communicator::request>> _requests;
+};
+
+/**
+ * @brief Hash partitions `input` on the `on` columns into one contiguous split per rank
+ */
+std::vector<contiguous_split_result> make_partitions(table_view const& input,
+                                                     std::vector<size_type> const& on,
+                                                     int num_ranks)
+{
+  auto partitioned = cudf::hash_partition(input, on, num_ranks);
+  // The first offset is always zero, the rest are the starts of the partitions
+  std::vector<size_type> splits(partitioned.second.begin() + 1, partitioned.second.end());
+  return cudf::contiguous_split(partitioned.first->view(), splits);
+}
+
+/**
+ * @brief Exchanges the partitions of both tables between the ranks of `comm`, and probes a hash
+ * table over the received partitions of `right` with each received partition of `left`
+ *
+ * @param join_fn Called as `join_fn(build, probe, mr)` for each partition `probe` of `left`, with
+ * the `hash_join` over the partitions of `right`
+ */
+template <typename JoinFn>
+std::unique_ptr<table> distributed_join(table_view const& left,
+                                        table_view const& right,
+                                        std::vector<size_type> const& left_on,
+                                        std::vector<size_type> const& right_on,
+                                        communicator& comm,
+                                        JoinFn join_fn,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(!left_on.empty(), "Distributed join needs columns to join on");
+  int const num_ranks = comm.size();
+  int const rank      = comm.rank();
+  CUDF_EXPECTS(num_ranks > 0 && rank >= 0 && rank < num_ranks, "Invalid communicator rank");
+
+  if (num_ranks == 1) {
+    cudf::hash_join build(right, right_on);
+    return join_fn(build, left, mr);
+  }
+
+  auto left_splits  = make_partitions(left, left_on, num_ranks);
+  auto right_splits = make_partitions(right, right_on, num_ranks);
+
+  // Receives are posted before the sends, so that no rank waits on a peer to post them
+  std::vector<message_header> headers(num_ranks);
+  std::vector<rmm::device_buffer> header_buffers;
+  header_buffers.reserve(num_ranks);
+  std::vector<std::unique_ptr<communicator::request>> header_recvs(num_ranks);
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    header_buffers.emplace_back(peer == rank ? 0 : sizeof(message_header), stream);
+    if (peer == rank) { continue; }
+    header_recvs[peer] =
+      comm.recv(header_buffers[peer].data(), sizeof(message_header), peer, HEADER_TAG, stream);
+  }
+
+  std::vector<packed_partition> outgoing;
+  std::vector<rmm::device_buffer> outgoing_buffers;
+  std::vector<std::unique_ptr<communicator::request>> sends;
+  outgoing.reserve(2 * num_ranks);
+  outgoing_buffers.reserve(3 * num_ranks);
+  auto send = [&](void const* data, int64_t size, int peer, int tag) {
+    if (size > 0) { sends.push_back(comm.send(data, size, peer, tag, stream)); }
+  };
+  auto send_buffer = [&](void const* host_data, int64_t size, int peer, int tag) {
+    outgoing_buffers.emplace_back(host_data, size, stream);
+    send(outgoing_buffers.back().data(), size, peer, tag);
+  };
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    if (peer == rank) { continue; }
+    outgoing.emplace_back(std::move(right_splits[peer]));
+    auto const& right_part = outgoing.back();
+    outgoing.emplace_back(std::move(left_splits[peer]));
+    auto const& left_part = outgoing.back();
+
+    message_header const header{right_part.metadata_size(),
+                                right_part.data_size(),
+                                left_part.metadata_size(),
+                                left_part.data_size()};
+    send_buffer(header.data(), sizeof(header), peer, HEADER_TAG);
+    send_buffer(right_part.metadata.data(), right_part.metadata_size(), peer, RIGHT_METADATA_TAG);
+    if (right_part.data) {
+      send(right_part.data->data(), right_part.data_size(), peer, RIGHT_DATA_TAG);
+    }
+    send_buffer(left_part.metadata.data(), left_part.metadata_size(), peer, LEFT_METADATA_TAG);
+    if (left_part.data) {
+      send(left_part.data->data(), left_part.data_size(), peer, LEFT_DATA_TAG);
+    }
+  }
+
+  // The partitions of `left` are received along with those of `right`, but only waited for once
+  // the hash table is built
+  std::vector<incoming_partition> incoming_right(num_ranks);
+  std::vector<incoming_partition> incoming_left(num_ranks);
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    if (peer == rank) { continue; }
+    header_recvs[peer]->wait();
+    CUDA_TRY(cudaMemcpyAsync(headers[peer].data(),
+                             header_buffers[peer].data(),
+                             sizeof(message_header),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    auto const& header = headers[peer];
+    incoming_right[peer].receive(
+      comm, peer, header[0], header[1], RIGHT_METADATA_TAG, RIGHT_DATA_TAG, stream);
+    incoming_left[peer].receive(
+      comm, peer, header[2], header[3], LEFT_METADATA_TAG, LEFT_DATA_TAG, stream);
+  }
+
+  std::vector<table_view> right_views{right_splits[rank].table};
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    if (peer != rank) { right_views.push_back(incoming_right[peer].view(stream)); }
+  }
+  auto const local_right = cudf::concatenate(right_views);
+  incoming_right.clear();
+  right_splits.clear();
+  cudf::hash_join build(local_right->view(), right_on);
+
+  // Intermediate results use the default resource; only the concatenated result uses `mr`
+  std::vector<std::unique_ptr<table>> results;
+  results.push_back(join_fn(build, left_splits[rank].table, rmm::mr::get_default_resource()));
+  left_splits.clear();
+
+  std::vector<int> pending;
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    if (peer != rank) { pending.push_back(peer); }
+  }
+  while (!pending.empty()) {
+    // Probe with the first partition that has arrived, or wait for the oldest one
+    auto next = std::find_if(
+      pending.begin(), pending.end(), [&](int peer) { return incoming_left[peer].has_arrived(); });
+    if (next == pending.end()) { next = pending.begin(); }
+    auto& partition = incoming_left[*next];
+    results.push_back(join_fn(build, partition.view(stream), rmm::mr::get_default_resource()));
+    partition.release();
+    pending.erase(next);
+  }
+
+  for (auto& s : sends) { s->wait(); }
+
+  std::vector<table_view> result_views;
+  for (auto const& result : results) { result_views.push_back(result->view()); }
+  return cudf::concatenate(result_views, mr);
+}
+
+}  // namespace
+}  // namespace detail
+
+std::unique_ptr<table> distributed_inner_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  communicator& comm,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distributed_join(
+    left,
+    right,
+    left_on,
+    right_on,
+    comm,
+    [&](hash_join const& build, table_view const& probe, rmm::mr::device_memory_resource* join_mr) {
+      auto joined = build.inner_join(probe,
+                                     left_on,
+                                     columns_in_common,
+                                     hash_join::common_columns_output_side::PROBE,
+                                     compare_nulls,
+                                     join_mr);
+      auto columns    = joined.first->release();
+      auto build_cols = joined.second->release();
+      columns.insert(columns.end(),
+                     std::make_move_iterator(build_cols.begin()),
+                     std::make_move_iterator(build_cols.end()));
+      return std::make_unique<table>(std::move(columns));
+    },
+    mr);
+}
+
+std::unique_ptr<table> distributed_left_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  communicator& comm,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distributed_join(
+    left,
+    right,
+    left_on,
+    right_on,
+    comm,
+    [&](hash_join const& build, table_view const& probe, rmm::mr::device_memory_resource* join_mr) {
+      return build.left_join(probe, left_on, columns_in_common, compare_nulls, join_mr);
+    },
+    mr);
+}
+
+}  // namespace cudf
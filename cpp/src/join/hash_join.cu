@@ -13,10 +13,31 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/memory_estimate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/launch_tuning.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/replace.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
 
 #include "hash_join.cuh"
 
@@ -184,44 +205,210 @@ get_left_join_indices_complement(rmm::device_vector<size_type> &right_indices,
   return std::make_pair(std::move(left_invalid_indices), std::move(right_indices_complement));
 }
 
+/**
+ * @brief Device functor returning the heavy key of a row, or -1 if its key is not heavy
+ */
+struct find_heavy_key {
+  heavy_key_view heavy;
+  row_hash hasher;
+
+  __device__ size_type operator()(size_type row_index) const
+  {
+    return heavy.find(hasher(row_index));
+  }
+};
+
+struct is_heavy_key {
+  __device__ bool operator()(size_type heavy_key) const { return heavy_key >= 0; }
+};
+
+struct is_heavy_count {
+  size_type threshold;
+  __device__ bool operator()(size_type count) const { return count >= threshold; }
+};
+
+/**
+ * @brief Device functor returning the number of build rows of a heavy key
+ */
+struct heavy_key_size {
+  heavy_key_view heavy;
+
+  __device__ int64_t operator()(size_type heavy_key) const
+  {
+    return heavy.offsets[heavy_key + 1] - heavy.offsets[heavy_key];
+  }
+};
+
+/**
+ * @brief Device functor mapping the index of a candidate pair to the pair (probe row, build row)
+ *
+ * Every probe row of a heavy key is paired with all the build rows of that key. The candidate
+ * pairs of the `i`th such probe row are numbered from `candidate_offsets[i]`.
+ */
+struct heavy_candidate_pair {
+  heavy_key_view heavy;
+  size_type const* probe_rows;       ///< Probe rows of heavy keys
+  size_type const* probe_keys;       ///< Heavy key of each of `probe_rows`
+  int64_t const* candidate_offsets;  ///< Exclusive scan of the number of pairs of `probe_rows`
+  size_type num_probe_rows;
+
+  __device__ size_type probe_index(int64_t candidate) const
+  {
+    return static_cast<size_type>(
+      thrust::upper_bound(
+        thrust::seq, candidate_offsets, candidate_offsets + num_probe_rows, candidate) -
+      candidate_offsets - 1);
+  }
+
+  __device__ thrust::tuple<size_type, size_type> operator()(int64_t candidate) const
+  {
+    auto const i     = probe_index(candidate);
+    auto const first = heavy.offsets[probe_keys[i]];
+    auto const build_row =
+      heavy.build_rows[first + static_cast<size_type>(candidate - candidate_offsets[i])];
+    return thrust::make_tuple(probe_rows[i], build_row);
+  }
+};
+
+/**
+ * @brief Device functor returning whether the rows of a candidate pair are equal
+ *
+ * If `probe_row_matched` is not null, it is set for the probe rows with at least one match.
+ */
+struct heavy_candidate_matches {
+  heavy_candidate_pair pairs;
+  row_equality check_row_equality;
+  bool* probe_row_matched;
+
+  __device__ bool operator()(int64_t candidate) const
+  {
+    auto const pair     = pairs(candidate);
+    bool const is_match = check_row_equality(thrust::get<0>(pair), thrust::get<1>(pair));
+    if (is_match && probe_row_matched != nullptr) {
+      probe_row_matched[pairs.probe_index(candidate)] = true;
+    }
+    return is_match;
+  }
+};
+
+/**
+ * @brief Finds the heavy-hitter keys of `build_table`.
+ *
+ * The row hash values are sorted to count the build rows of every hash value exactly; the hash
+ * values of at least `DEFAULT_JOIN_HEAVY_KEY_THRESHOLD` rows are heavy keys.
+ *
+ * @param build_table Table of build side columns to join.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The heavy keys and their build rows, empty if no key is heavy.
+ */
+heavy_keys find_heavy_keys(cudf::table_device_view build_table, cudaStream_t stream)
+{
+  CUDF_SCOPED_RANGE_PAYLOAD("hash_join::find_heavy_keys", build_table.num_rows());
+  heavy_keys heavy;
+  const size_type build_table_num_rows{build_table.num_rows()};
+  if (build_table_num_rows < DEFAULT_JOIN_HEAVY_KEY_THRESHOLD) { return heavy; }
+
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  rmm::device_vector<hash_value_type> row_hashes(build_table_num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    counting,
+                    counting + build_table_num_rows,
+                    row_hashes.begin(),
+                    row_hash{build_table});
+  rmm::device_vector<size_type> rows(build_table_num_rows);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), rows.begin(), rows.end());
+  thrust::sort_by_key(
+    rmm::exec_policy(stream)->on(stream), row_hashes.begin(), row_hashes.end(), rows.begin());
+
+  rmm::device_vector<hash_value_type> unique_hashes(build_table_num_rows);
+  rmm::device_vector<size_type> counts(build_table_num_rows);
+  auto const unique_end = thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                                                row_hashes.begin(),
+                                                row_hashes.end(),
+                                                thrust::make_constant_iterator<size_type>(1),
+                                                unique_hashes.begin(),
+                                                counts.begin());
+
+  is_heavy_count const is_heavy{DEFAULT_JOIN_HEAVY_KEY_THRESHOLD};
+  heavy.hashes.resize(unique_end.first - unique_hashes.begin());
+  heavy.hashes.resize(thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                      unique_hashes.begin(),
+                                      unique_end.first,
+                                      counts.begin(),
+                                      heavy.hashes.begin(),
+                                      is_heavy) -
+                      heavy.hashes.begin());
+  if (heavy.empty()) { return heavy; }
+
+  heavy.offsets.resize(heavy.hashes.size() + 1, 0);
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  counts.begin(),
+                  unique_end.second,
+                  heavy.offsets.begin(),
+                  is_heavy);
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         heavy.offsets.begin(),
+                         heavy.offsets.end(),
+                         heavy.offsets.begin());
+
+  // The rows are sorted by hash value, so the rows of every heavy key are already contiguous
+  rmm::device_vector<size_type> row_keys(build_table_num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    row_hashes.begin(),
+                    row_hashes.end(),
+                    row_keys.begin(),
+                    [heavy = heavy.view()] __device__(hash_value_type hash) {
+                      return heavy.find(hash);
+                    });
+  heavy.build_rows.resize(heavy.offsets.back());
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  rows.begin(),
+                  rows.end(),
+                  row_keys.begin(),
+                  heavy.build_rows.begin(),
+                  is_heavy_key{});
+  return heavy;
+}
+
 /**
  * @brief Builds the hash table based on the given `build_table`.
  *
  * @throw cudf::logic_error if the number of columns in `build` table is 0.
  * @throw cudf::logic_error if the number of rows in `build` table is 0.
- * @throw cudf::logic_error if insertion to the hash table fails.
  * @throw std::out_of_range if elements of `build_on` exceed the number of columns in the `build`
  * table.
  *
  * @param build_table Table of build side columns to join.
+ * @param heavy The heavy keys of `build_table`, whose rows are not inserted.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return Built hash table.
  */
-std::unique_ptr<multimap_type, std::function<void(multimap_type *)>> build_join_hash_table(
-  cudf::table_device_view build_table, cudaStream_t stream)
+std::unique_ptr<multimap_type> build_join_hash_table(cudf::table_device_view build_table,
+                                                     heavy_keys const &heavy,
+                                                     cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("hash_join::build", build_table.num_rows());
   CUDF_EXPECTS(0 != build_table.num_columns(), "Selected build dataset is empty");
   CUDF_EXPECTS(0 != build_table.num_rows(), "Build side table has no rows");
 
   const size_type build_table_num_rows{build_table.num_rows()};
-  size_t const hash_table_size = compute_hash_table_size(build_table_num_rows);
-
-  auto hash_table = multimap_type::create(hash_table_size,
-                                          true,
-                                          multimap_type::hasher(),
-                                          multimap_type::key_equal(),
-                                          multimap_type::allocator_type(),
-                                          stream);
+  auto hash_table = std::make_unique<multimap_type>(
+    build_table_num_rows - static_cast<size_type>(heavy.build_rows.size()),
+    JoinUnusedKey,
+    DEFAULT_HASH_TABLE_OCCUPANCY,
+    stream);
 
   row_hash hash_build{build_table};
-  rmm::device_scalar<int> failure(0, 0);
-  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-  detail::grid_1d config(build_table_num_rows, block_size);
-  build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, 0>>>(
-    *hash_table, hash_build, build_table_num_rows, failure.data());
-  // Check error code from the kernel
-  if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
+  tuned_launch_scope launch(tuned_parameter::JOIN_BUILD_BLOCK_SIZE, build_table_num_rows, stream);
+  auto const block_size = launch.value();
+  constexpr int tile_size{DEFAULT_PROBE_TILE_SIZE};
+  // One tile of threads inserts every row
+  detail::grid_1d config(build_table_num_rows, block_size / tile_size);
+  build_hash_table<tile_size><<<config.num_blocks, block_size, 0, stream>>>(
+    hash_table->view(), hash_build, build_table_num_rows, heavy.view());
+  CHECK_CUDA(stream);
 
   return hash_table;
 }
@@ -235,7 +422,10 @@ std::unique_ptr<multimap_type, std::function<void(multimap_type *)>> build_join_
  * @param build_table Table of build side columns to join.
  * @param probe_table Table of probe side columns to join.
  * @param hash_table Hash table built from `build_table`.
+ * @param heavy The heavy keys of `build_table`, whose probe rows are skipped.
  * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param build_strings The inline strings of `build_table` if it is a single strings column,
+ * otherwise null.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return Join output indices vector pair.
@@ -245,11 +435,13 @@ std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> probe_jo
   cudf::table_device_view build_table,
   cudf::table_device_view probe_table,
   multimap_type const &hash_table,
+  heavy_key_view heavy,
   null_equality compare_nulls,
+  strings::detail::inline_string const *build_strings,
   cudaStream_t stream)
 {
-  size_type estimated_size = estimate_join_output_size<JoinKind, multimap_type>(
-    build_table, probe_table, hash_table, compare_nulls, stream);
+  size_type estimated_size = estimate_join_output_size<JoinKind>(
+    build_table, probe_table, hash_table, heavy, compare_nulls, build_strings, stream);
 
   // If the estimated output size is zero, return immediately
   if (estimated_size == 0) {
@@ -270,26 +462,31 @@ std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> probe_jo
     left_indices.resize(estimated_size);
     right_indices.resize(estimated_size);
 
-    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(probe_table.num_rows(), block_size);
-    write_index.set_value(0);
+    write_index.set_value(0, stream);
+    tuned_launch_scope launch(
+      tuned_parameter::JOIN_PROBE_BLOCK_SIZE, probe_table.num_rows(), stream);
+    auto const block_size = launch.value();
+    constexpr int tile_size{DEFAULT_PROBE_TILE_SIZE};
+    detail::grid_1d config(probe_table.num_rows(), block_size / tile_size);
 
     row_hash hash_probe{probe_table};
-    row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
-    probe_hash_table<JoinKind, multimap_type, block_size, DEFAULT_JOIN_CACHE_SIZE>
-      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(hash_table,
-                                                                       build_table,
-                                                                       probe_table,
-                                                                       hash_probe,
-                                                                       equality,
-                                                                       left_indices.data().get(),
-                                                                       right_indices.data().get(),
-                                                                       write_index.data(),
-                                                                       estimated_size);
+    row_equality equality{
+      probe_table, build_table, compare_nulls == null_equality::EQUAL, build_strings};
+    probe_hash_table<JoinKind, tile_size>
+      <<<config.num_blocks, block_size, 0, stream>>>(hash_table.view(),
+                                                     build_table,
+                                                     probe_table,
+                                                     hash_probe,
+                                                     equality,
+                                                     heavy,
+                                                     left_indices.data().get(),
+                                                     right_indices.data().get(),
+                                                     write_index.data(),
+                                                     estimated_size);
 
     CHECK_CUDA(stream);
 
-    join_size              = write_index.value();
+    join_size              = write_index.value(stream);
     current_estimated_size = estimated_size;
     estimated_size *= 2;
   } while ((current_estimated_size < join_size));
@@ -299,6 +496,300 @@ std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> probe_jo
   return std::make_pair(std::move(left_indices), std::move(right_indices));
 }
 
+/**
+ * @brief Probes the `hash_table` built from `build_table` for tuples in `probe_table` in two
+ * passes, and returns the output indices of `build_table` and `probe_table` as a combined table.
+ *
+ * The first pass counts the output rows of every probe row, which are scanned into output offsets;
+ * the second pass writes the matches of every probe row at its offset. Unlike
+ * `probe_join_hash_table()`, the cost does not depend on the accuracy of an estimate, and the
+ * output is allocated at its exact size.
+ *
+ * @tparam JoinKind The type of join to be performed.
+ *
+ * @param build_table Table of build side columns to join.
+ * @param probe_table Table of probe side columns to join.
+ * @param hash_table Hash table built from `build_table`.
+ * @param heavy The heavy keys of `build_table`, whose probe rows are skipped.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param build_strings The inline strings of `build_table` if it is a single strings column,
+ * otherwise null.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Join output indices vector pair.
+ */
+template <join_kind JoinKind>
+std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>
+probe_join_hash_table_exact(cudf::table_device_view build_table,
+                            cudf::table_device_view probe_table,
+                            multimap_type const &hash_table,
+                            heavy_key_view heavy,
+                            null_equality compare_nulls,
+                            strings::detail::inline_string const *build_strings,
+                            cudaStream_t stream)
+{
+  const size_type probe_table_num_rows{probe_table.num_rows()};
+  if (probe_table_num_rows == 0) {
+    return std::make_pair(rmm::device_vector<size_type>{}, rmm::device_vector<size_type>{});
+  }
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  constexpr int tile_size{DEFAULT_PROBE_TILE_SIZE};
+  detail::grid_1d config(probe_table_num_rows, block_size / tile_size);
+  row_hash hash_probe{probe_table};
+  row_equality equality{
+    probe_table, build_table, compare_nulls == null_equality::EQUAL, build_strings};
+
+  // The extra last element stays zero, so that the scan ends with the total output size
+  rmm::device_vector<int64_t> row_offsets(probe_table_num_rows + 1, 0);
+  compute_join_output_row_sizes<JoinKind, tile_size>
+    <<<config.num_blocks, block_size, 0, stream>>>(hash_table.view(),
+                                                   build_table,
+                                                   probe_table,
+                                                   hash_probe,
+                                                   equality,
+                                                   heavy,
+                                                   row_offsets.data().get());
+  CHECK_CUDA(stream);
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         row_offsets.begin(),
+                         row_offsets.end(),
+                         row_offsets.begin());
+
+  int64_t join_size{0};
+  CUDA_TRY(cudaMemcpyAsync(&join_size,
+                           row_offsets.data().get() + probe_table_num_rows,
+                           sizeof(int64_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_EXPECTS(join_size <= std::numeric_limits<size_type>::max(),
+               "Join output size exceeds the column size limit");
+
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+  if (join_size > 0) {
+    tuned_launch_scope launch(tuned_parameter::JOIN_PROBE_BLOCK_SIZE, probe_table_num_rows, stream);
+    detail::grid_1d probe_config(probe_table_num_rows, launch.value() / tile_size);
+    probe_hash_table_exact<JoinKind, tile_size>
+      <<<probe_config.num_blocks, launch.value(), 0, stream>>>(hash_table.view(),
+                                                               build_table,
+                                                               probe_table,
+                                                               hash_probe,
+                                                               equality,
+                                                               heavy,
+                                                               row_offsets.data().get(),
+                                                               left_indices.data().get(),
+                                                               right_indices.data().get());
+    CHECK_CUDA(stream);
+  }
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+/**
+ * @brief Returns the number of output rows of probing the `hash_table` built from `build_table`
+ * for the tuples in `probe_table`, leaving out the probe rows of heavy keys.
+ *
+ * Runs the counting pass of `probe_join_hash_table_exact()`.
+ *
+ * @tparam JoinKind The type of join to be performed, `INNER_JOIN` or `LEFT_JOIN`.
+ *
+ * @param build_table Table of build side columns to join.
+ * @param probe_table Table of probe side columns to join.
+ * @param hash_table Hash table built from `build_table`.
+ * @param heavy The heavy keys of `build_table`, whose probe rows are skipped.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param build_strings The inline strings of `build_table` if it is a single strings column,
+ * otherwise null.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The number of output rows.
+ */
+template <join_kind JoinKind>
+int64_t count_join_output_rows(cudf::table_device_view build_table,
+                               cudf::table_device_view probe_table,
+                               multimap_type const &hash_table,
+                               heavy_key_view heavy,
+                               null_equality compare_nulls,
+                               strings::detail::inline_string const *build_strings,
+                               cudaStream_t stream)
+{
+  const size_type probe_table_num_rows{probe_table.num_rows()};
+  if (probe_table_num_rows == 0) { return 0; }
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  constexpr int tile_size{DEFAULT_PROBE_TILE_SIZE};
+  detail::grid_1d config(probe_table_num_rows, block_size / tile_size);
+  rmm::device_vector<int64_t> row_sizes(probe_table_num_rows);
+  compute_join_output_row_sizes<JoinKind, tile_size>
+    <<<config.num_blocks, block_size, 0, stream>>>(
+      hash_table.view(),
+      build_table,
+      probe_table,
+      row_hash{probe_table},
+      row_equality{probe_table, build_table, compare_nulls == null_equality::EQUAL, build_strings},
+      heavy,
+      row_sizes.data().get());
+  CHECK_CUDA(stream);
+  return thrust::reduce(
+    rmm::exec_policy(stream)->on(stream), row_sizes.begin(), row_sizes.end(), int64_t{0});
+}
+
+/**
+ * @brief Device functor returning the number of heavy key candidates of a probe row, plus one if
+ * the row may be output without a match
+ */
+struct heavy_candidate_count {
+  heavy_key_view heavy;
+  row_hash hasher;
+  bool count_unmatched;
+
+  __device__ int64_t operator()(size_type row_index) const
+  {
+    auto const heavy_key = heavy.find(hasher(row_index));
+    if (heavy_key < 0) { return 0; }
+    return heavy.offsets[heavy_key + 1] - heavy.offsets[heavy_key] + count_unmatched;
+  }
+};
+
+/**
+ * @brief Returns an upper bound on the number of output rows of `probe_heavy_keys()`, which is
+ * the number of its candidate pairs, plus the number of probe rows of heavy keys for left joins.
+ */
+template <join_kind JoinKind>
+int64_t heavy_keys_output_size_upper_bound(cudf::table_device_view probe_table,
+                                           heavy_keys const &heavy,
+                                           cudaStream_t stream)
+{
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  return thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    counting,
+    counting + probe_table.num_rows(),
+    heavy_candidate_count{heavy.view(), row_hash{probe_table}, JoinKind == join_kind::LEFT_JOIN},
+    int64_t{0},
+    thrust::plus<int64_t>());
+}
+
+/**
+ * @brief Joins the probe rows of the heavy keys in `heavy` to the build rows of these keys.
+ *
+ * The build rows of a heavy key are too many for one tile, so the pairs of a probe row with the
+ * build rows of its key are numbered as one flat range of candidates, each compared by its own
+ * thread, which spreads the work of a heavy key over the whole device.
+ *
+ * @tparam JoinKind The type of join to be performed, `INNER_JOIN` or `LEFT_JOIN`.
+ *
+ * @param build_table Table of build side columns to join.
+ * @param probe_table Table of probe side columns to join.
+ * @param heavy The heavy keys of `build_table`.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param build_strings The inline strings of `build_table` if it is a single strings column,
+ * otherwise null.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Join output indices vector pair of the probe rows of heavy keys.
+ */
+template <join_kind JoinKind>
+VectorPair probe_heavy_keys(cudf::table_device_view build_table,
+                            cudf::table_device_view probe_table,
+                            heavy_keys const &heavy,
+                            null_equality compare_nulls,
+                            strings::detail::inline_string const *build_strings,
+                            cudaStream_t stream)
+{
+  const size_type probe_table_num_rows{probe_table.num_rows()};
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+
+  rmm::device_vector<size_type> probe_keys(probe_table_num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    counting,
+                    counting + probe_table_num_rows,
+                    probe_keys.begin(),
+                    find_heavy_key{heavy.view(), row_hash{probe_table}});
+  rmm::device_vector<size_type> probe_rows(probe_table_num_rows);
+  probe_rows.resize(thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                    counting,
+                                    counting + probe_table_num_rows,
+                                    probe_keys.begin(),
+                                    probe_rows.begin(),
+                                    is_heavy_key{}) -
+                    probe_rows.begin());
+  const size_type num_probe_rows = probe_rows.size();
+  if (num_probe_rows == 0) { return VectorPair{}; }
+
+  rmm::device_vector<size_type> heavy_probe_keys(num_probe_rows);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 probe_rows.begin(),
+                 probe_rows.end(),
+                 probe_keys.begin(),
+                 heavy_probe_keys.begin());
+  // The extra last element stays zero, so that the scan ends with the number of candidates
+  rmm::device_vector<int64_t> candidate_offsets(num_probe_rows + 1, 0);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    heavy_probe_keys.begin(),
+                    heavy_probe_keys.end(),
+                    candidate_offsets.begin(),
+                    heavy_key_size{heavy.view()});
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         candidate_offsets.begin(),
+                         candidate_offsets.end(),
+                         candidate_offsets.begin());
+  int64_t const num_candidates = candidate_offsets.back();
+
+  heavy_candidate_pair const pairs{heavy.view(),
+                                   probe_rows.data().get(),
+                                   heavy_probe_keys.data().get(),
+                                   candidate_offsets.data().get(),
+                                   num_probe_rows};
+  rmm::device_vector<bool> matches(num_candidates);
+  rmm::device_vector<bool> probe_row_matched(
+    JoinKind == join_kind::LEFT_JOIN ? num_probe_rows : 0, false);
+  auto const candidates = thrust::make_counting_iterator<int64_t>(0);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    candidates,
+    candidates + num_candidates,
+    matches.begin(),
+    heavy_candidate_matches{
+      pairs,
+      row_equality{
+        probe_table, build_table, compare_nulls == null_equality::EQUAL, build_strings},
+      JoinKind == join_kind::LEFT_JOIN ? probe_row_matched.data().get() : nullptr});
+
+  int64_t const num_matches =
+    thrust::count(rmm::exec_policy(stream)->on(stream), matches.begin(), matches.end(), true);
+  int64_t const num_unmatched = thrust::count(rmm::exec_policy(stream)->on(stream),
+                                              probe_row_matched.begin(),
+                                              probe_row_matched.end(),
+                                              false);
+  CUDF_EXPECTS(num_matches + num_unmatched < MAX_JOIN_SIZE, "Join output size is too big");
+
+  rmm::device_vector<size_type> left_indices(num_matches + num_unmatched);
+  rmm::device_vector<size_type> right_indices(num_matches + num_unmatched);
+  thrust::copy_if(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_transform_iterator(candidates, pairs),
+    thrust::make_transform_iterator(candidates + num_candidates, pairs),
+    matches.begin(),
+    thrust::make_zip_iterator(thrust::make_tuple(left_indices.begin(), right_indices.begin())),
+    thrust::identity<bool>());
+  if (num_unmatched > 0) {
+    // Left joins have a Null output row for the probe rows without any match
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    probe_rows.begin(),
+                    probe_rows.end(),
+                    probe_row_matched.begin(),
+                    left_indices.begin() + num_matches,
+                    thrust::logical_not<bool>());
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 right_indices.begin() + num_matches,
+                 right_indices.end(),
+                 static_cast<size_type>(JoinNoneValue));
+  }
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
 /**
  * @brief  Combines the non common probe, common probe, non common build and common build
  * columns in the correct order according to `common_columns_output_side` to form the joined
@@ -390,6 +881,7 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> construct_join_output_
   rmm::mr::device_memory_resource *mr,
   cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("hash_join::gather_output", joined_indices.first.size());
   std::vector<size_type> probe_common_col;
   probe_common_col.reserve(columns_in_common.size());
   std::vector<size_type> build_common_col;
@@ -463,6 +955,26 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> construct_join_output_
                               common_columns_output_side);
 }
 
+template std::pair<std::unique_ptr<table>, std::unique_ptr<table>>
+construct_join_output_df<join_kind::INNER_JOIN>(
+  table_view const &probe,
+  table_view const &build,
+  VectorPair &joined_indices,
+  std::vector<std::pair<size_type, size_type>> const &columns_in_common,
+  cudf::hash_join::common_columns_output_side common_columns_output_side,
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream);
+
+template std::pair<std::unique_ptr<table>, std::unique_ptr<table>>
+construct_join_output_df<join_kind::LEFT_JOIN>(
+  table_view const &probe,
+  table_view const &build,
+  VectorPair &joined_indices,
+  std::vector<std::pair<size_type, size_type>> const &columns_in_common,
+  cudf::hash_join::common_columns_output_side common_columns_output_side,
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream);
+
 std::unique_ptr<cudf::table> combine_table_pair(std::unique_ptr<cudf::table> &&left,
                                                 std::unique_ptr<cudf::table> &&right)
 {
@@ -474,15 +986,38 @@ std::unique_ptr<cudf::table> combine_table_pair(std::unique_ptr<cudf::table> &&l
   return std::make_unique<cudf::table>(std::move(joined_cols));
 }
 
+std::unique_ptr<column> make_join_gather_map(rmm::device_vector<size_type> const &indices,
+                                             rmm::mr::device_memory_resource *mr,
+                                             cudaStream_t stream)
+{
+  auto gather_map = make_numeric_column(data_type{type_id::INT32},
+                                        static_cast<size_type>(indices.size()),
+                                        mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+  thrust::replace_copy(rmm::exec_policy(stream)->on(stream),
+                       indices.begin(),
+                       indices.end(),
+                       gather_map->mutable_view().begin<size_type>(),
+                       JoinNoneValue,
+                       join_no_match);
+  return gather_map;
+}
+
 }  // namespace detail
 
 hash_join::hash_join_impl::~hash_join_impl() = default;
 
 hash_join::hash_join_impl::hash_join_impl(cudf::table_view const &build,
-                                          std::vector<size_type> const &build_on)
+                                          std::vector<size_type> const &build_on,
+                                          output_size_policy size_policy,
+                                          cudaStream_t stream)
   : _build(build),
     _build_selected(build.select(build_on)),
+    _build_flattened(structs::detail::flatten_nested_columns(_build_selected, {}, {}, stream)),
+    _build_keys(dictionary::detail::indices_view(_build_flattened.flattened_columns())),
     _build_on(build_on),
+    _size_policy(size_policy),
     _hash_table(nullptr)
 {
   CUDF_FUNC_RANGE();
@@ -492,8 +1027,55 @@ hash_join::hash_join_impl::hash_join_impl(cudf::table_view const &build,
 
   if (_build_on.empty() || 0 == build.num_rows()) { return; }
 
-  auto build_table = cudf::table_device_view::create(_build_selected);
-  _hash_table      = build_join_hash_table(*build_table, 0);
+  auto build_table = cudf::table_device_view::create(_build_keys, stream);
+  _heavy_keys      = cudf::detail::find_heavy_keys(*build_table, stream);
+  _hash_table      = build_join_hash_table(*build_table, _heavy_keys, stream);
+  if (_build_selected.num_columns() == 1 &&
+      _build_selected.column(0).type().id() == type_id::STRING) {
+    _build_strings = strings::detail::create_inline_string_vector(
+      strings_column_view(_build_selected.column(0)), stream);
+  }
+  // Probes may run on other streams than the one the table was built on
+  CUDA_TRY(cudaStreamSynchronize(stream));
+}
+
+hash_join::hash_join_impl::probe_table_keys hash_join::hash_join_impl::probe_keys(
+  cudf::table_view const &probe,
+  std::vector<size_type> const &probe_on,
+  cudaStream_t stream) const
+{
+  auto probe_selected = probe.select(probe_on);
+  if (!_hash_table || probe.num_rows() == 0) {
+    return {structs::detail::flattened_table({}, {}, {}, {}), {}, probe_selected};
+  }
+
+  auto flattened = structs::detail::flatten_nested_columns(probe_selected, {}, {}, stream);
+  auto const probe_flat = flattened.flattened_columns();
+  auto const build_flat = _build_flattened.flattened_columns();
+  CUDF_EXPECTS(probe_flat.num_columns() == build_flat.num_columns(),
+               "Mismatch in number of joining struct fields");
+  std::vector<column_view> keys(probe_flat.begin(), probe_flat.end());
+  std::vector<std::unique_ptr<cudf::column>> remapped_indices;
+
+  for (size_type i = 0; i < build_flat.num_columns(); ++i) {
+    if (build_flat.column(i).type().id() != type_id::DICTIONARY32) {
+      CUDF_EXPECTS(keys[i].type() == build_flat.column(i).type(),
+                   "Mismatch in joining column data types");
+      continue;
+    }
+    CUDF_EXPECTS(keys[i].type().id() == type_id::DICTIONARY32,
+                 "Mismatch in joining column data types");
+    dictionary_column_view const build_dictionary(build_flat.column(i));
+    dictionary_column_view const probe_dictionary(keys[i]);
+    if (dictionary::detail::have_same_keys(build_dictionary, probe_dictionary)) {
+      keys[i] = probe_dictionary.get_indices_annotated();
+    } else {
+      remapped_indices.push_back(dictionary::detail::remap_indices(
+        probe_dictionary, build_dictionary.keys(), rmm::mr::get_default_resource(), stream));
+      keys[i] = remapped_indices.back()->view();
+    }
+  }
+  return {std::move(flattened), std::move(remapped_indices), table_view{keys}};
 }
 
 std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::table>>
@@ -503,11 +1085,12 @@ hash_join::hash_join_impl::inner_join(
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const &columns_in_common,
   common_columns_output_side common_columns_output_side,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource *mr) const
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream) const
 {
   CUDF_FUNC_RANGE();
   return compute_hash_join<cudf::detail::join_kind::INNER_JOIN>(
-    probe, probe_on, columns_in_common, common_columns_output_side, compare_nulls, mr);
+    probe, probe_on, columns_in_common, common_columns_output_side, compare_nulls, mr, stream);
 }
 
 std::unique_ptr<cudf::table> hash_join::hash_join_impl::left_join(
@@ -515,11 +1098,18 @@ std::unique_ptr<cudf::table> hash_join::hash_join_impl::left_join(
   std::vector<size_type> const &probe_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const &columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource *mr) const
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream) const
 {
   CUDF_FUNC_RANGE();
-  auto probe_build_pair = compute_hash_join<cudf::detail::join_kind::LEFT_JOIN>(
-    probe, probe_on, columns_in_common, common_columns_output_side::PROBE, compare_nulls, mr);
+  auto probe_build_pair =
+    compute_hash_join<cudf::detail::join_kind::LEFT_JOIN>(probe,
+                                                          probe_on,
+                                                          columns_in_common,
+                                                          common_columns_output_side::PROBE,
+                                                          compare_nulls,
+                                                          mr,
+                                                          stream);
   return cudf::detail::combine_table_pair(std::move(probe_build_pair.first),
                                           std::move(probe_build_pair.second));
 }
@@ -529,15 +1119,359 @@ std::unique_ptr<cudf::table> hash_join::hash_join_impl::full_join(
   std::vector<size_type> const &probe_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const &columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource *mr) const
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream) const
 {
   CUDF_FUNC_RANGE();
-  auto probe_build_pair = compute_hash_join<cudf::detail::join_kind::FULL_JOIN>(
-    probe, probe_on, columns_in_common, common_columns_output_side::PROBE, compare_nulls, mr);
+  auto probe_build_pair =
+    compute_hash_join<cudf::detail::join_kind::FULL_JOIN>(probe,
+                                                          probe_on,
+                                                          columns_in_common,
+                                                          common_columns_output_side::PROBE,
+                                                          compare_nulls,
+                                                          mr,
+                                                          stream);
   return cudf::detail::combine_table_pair(std::move(probe_build_pair.first),
                                           std::move(probe_build_pair.second));
 }
 
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+hash_join::hash_join_impl::inner_join_indices(cudf::table_view const &probe,
+                                              std::vector<size_type> const &probe_on,
+                                              null_equality compare_nulls,
+                                              rmm::mr::device_memory_resource *mr,
+                                              cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_join_indices<cudf::detail::join_kind::INNER_JOIN>(
+    probe, probe_on, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+hash_join::hash_join_impl::left_join_indices(cudf::table_view const &probe,
+                                             std::vector<size_type> const &probe_on,
+                                             null_equality compare_nulls,
+                                             rmm::mr::device_memory_resource *mr,
+                                             cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_join_indices<cudf::detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+hash_join::hash_join_impl::full_join_indices(cudf::table_view const &probe,
+                                             std::vector<size_type> const &probe_on,
+                                             null_equality compare_nulls,
+                                             rmm::mr::device_memory_resource *mr,
+                                             cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_join_indices<cudf::detail::join_kind::FULL_JOIN>(
+    probe, probe_on, compare_nulls, mr, stream);
+}
+
+std::unique_ptr<cudf::table> hash_join::hash_join_impl::left_semi_join(
+  cudf::table_view const &probe,
+  std::vector<size_type> const &probe_on,
+  std::vector<size_type> const &return_columns,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_semi_anti_join<cudf::detail::join_kind::LEFT_SEMI_JOIN>(
+    probe, probe_on, return_columns, compare_nulls, mr, stream);
+}
+
+std::unique_ptr<cudf::table> hash_join::hash_join_impl::left_anti_join(
+  cudf::table_view const &probe,
+  std::vector<size_type> const &probe_on,
+  std::vector<size_type> const &return_columns,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_semi_anti_join<cudf::detail::join_kind::LEFT_ANTI_JOIN>(
+    probe, probe_on, return_columns, compare_nulls, mr, stream);
+}
+
+std::unique_ptr<bloom_filter> hash_join::hash_join_impl::make_bloom_filter(
+  size_type bits_per_key, null_equality compare_nulls, rmm::mr::device_memory_resource *mr) const
+{
+  return std::make_unique<bloom_filter>(_build_selected, bits_per_key, compare_nulls, mr);
+}
+
+memory_estimate hash_join::hash_join_impl::estimate_build_memory(
+  cudf::table_view const &build, std::vector<size_type> const &build_on)
+{
+  using cudf::detail::allocation_size;
+  memory_estimate estimate;
+  std::size_t const build_num_rows = build.num_rows();
+  if (build_on.empty() || 0 == build_num_rows) { return estimate; }
+
+  estimate.output_bytes = cudf::detail::multimap_type::memory_size(build.num_rows());
+  if (build.num_rows() >= cudf::detail::DEFAULT_JOIN_HEAVY_KEY_THRESHOLD) {
+    // The row hashes, row numbers, unique hashes and their counts, and the sort of the hashes
+    estimate.temporary_bytes =
+      6 * allocation_size(build_num_rows * std::max(sizeof(hash_value_type), sizeof(size_type)));
+    // At most every row has a heavy key
+    estimate.output_bytes += allocation_size(build_num_rows * sizeof(hash_value_type)) +
+                             2 * allocation_size((build_num_rows + 1) * sizeof(size_type));
+  }
+  if (build_on.size() == 1 && build.column(build_on.front()).type().id() == type_id::STRING) {
+    estimate.output_bytes +=
+      allocation_size(build_num_rows * sizeof(strings::detail::inline_string));
+  }
+  return estimate;
+}
+
+memory_estimate hash_join::hash_join_impl::estimate_inner_join_memory(
+  cudf::table_view const &probe,
+  std::vector<size_type> const &probe_on,
+  null_equality compare_nulls,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return estimate_join_memory<cudf::detail::join_kind::INNER_JOIN>(
+    probe, probe_on, compare_nulls, stream);
+}
+
+memory_estimate hash_join::hash_join_impl::estimate_left_join_memory(
+  cudf::table_view const &probe,
+  std::vector<size_type> const &probe_on,
+  null_equality compare_nulls,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return estimate_join_memory<cudf::detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, compare_nulls, stream);
+}
+
+memory_estimate hash_join::hash_join_impl::estimate_full_join_memory(
+  cudf::table_view const &probe,
+  std::vector<size_type> const &probe_on,
+  null_equality compare_nulls,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return estimate_join_memory<cudf::detail::join_kind::FULL_JOIN>(
+    probe, probe_on, compare_nulls, stream);
+}
+
+template <cudf::detail::join_kind JoinKind>
+memory_estimate hash_join::hash_join_impl::estimate_join_memory(
+  cudf::table_view const &probe,
+  std::vector<size_type> const &probe_on,
+  null_equality compare_nulls,
+  cudaStream_t stream) const
+{
+  using cudf::detail::allocation_size;
+  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+  CUDF_EXPECTS(probe.num_rows() < cudf::detail::MAX_JOIN_SIZE,
+               "Probe column size is too big for hash join");
+  CUDF_EXPECTS(_build_on.size() == probe_on.size(),
+               "Mismatch in number of columns to be joined on");
+
+  memory_estimate estimate;
+  if (is_trivial_join(probe, _build, probe_on, _build_on, JoinKind)) { return estimate; }
+
+  constexpr cudf::detail::join_kind ProbeJoinKind = (JoinKind == cudf::detail::join_kind::FULL_JOIN)
+                                                      ? cudf::detail::join_kind::LEFT_JOIN
+                                                      : JoinKind;
+  std::size_t const probe_num_rows = probe.num_rows();
+  std::size_t const build_num_rows = _build.num_rows();
+  constexpr std::size_t index_size{sizeof(size_type)};
+  // Both sides of the join output indices
+  auto const indices_size = [](std::size_t num_rows) {
+    return 2 * allocation_size(num_rows * index_size);
+  };
+
+  std::size_t join_num_rows{0};
+  if (!_hash_table) {
+    join_num_rows = (ProbeJoinKind == cudf::detail::join_kind::LEFT_JOIN) ? probe_num_rows : 0;
+    estimate.temporary_bytes += indices_size(join_num_rows);
+  } else {
+    auto probe_selected = probe_keys(probe, probe_on, stream);
+    auto build_table    = cudf::table_device_view::create(_build_keys, stream);
+    auto probe_table    = cudf::table_device_view::create(probe_selected.keys, stream);
+    join_num_rows = cudf::detail::count_join_output_rows<ProbeJoinKind>(*build_table,
+                                                                        *probe_table,
+                                                                        *_hash_table,
+                                                                        _heavy_keys.view(),
+                                                                        compare_nulls,
+                                                                        build_strings(),
+                                                                        stream);
+    if (_size_policy == output_size_policy::EXACT) {
+      estimate.temporary_bytes += allocation_size((probe_num_rows + 1) * sizeof(int64_t)) +
+                                  indices_size(join_num_rows);
+    } else {
+      // Replays the growth of the output of `probe_join_hash_table()` from its estimate; every
+      // resize copies the previous output into the new one.
+      std::size_t size = cudf::detail::estimate_join_output_size<ProbeJoinKind>(*build_table,
+                                                                                *probe_table,
+                                                                                *_hash_table,
+                                                                                _heavy_keys.view(),
+                                                                                compare_nulls,
+                                                                                build_strings(),
+                                                                                stream);
+      std::size_t previous_size{0};
+      while (size > 0 && size < join_num_rows) {
+        previous_size = size;
+        size *= 2;
+      }
+      estimate.temporary_bytes += indices_size(size) + indices_size(previous_size);
+    }
+
+    if (!_heavy_keys.empty()) {
+      std::size_t const heavy_num_rows =
+        cudf::detail::heavy_keys_output_size_upper_bound<ProbeJoinKind>(
+          *probe_table, _heavy_keys, stream);
+      // The heavy keys and rows of the probe rows, the candidate offsets and matches, and the
+      // concatenation with the hash table output
+      estimate.temporary_bytes += 3 * allocation_size(probe_num_rows * index_size) +
+                                  allocation_size((probe_num_rows + 1) * sizeof(int64_t)) +
+                                  allocation_size(heavy_num_rows) +
+                                  allocation_size(probe_num_rows) + indices_size(heavy_num_rows) +
+                                  indices_size(join_num_rows + heavy_num_rows);
+      join_num_rows += heavy_num_rows;
+    }
+  }
+
+  if (JoinKind == cudf::detail::join_kind::FULL_JOIN) {
+    // The complement of the matched build rows, and its concatenation with the left join output
+    estimate.temporary_bytes += 2 * allocation_size(build_num_rows * index_size) +
+                                indices_size(build_num_rows) +
+                                indices_size(join_num_rows + build_num_rows);
+    join_num_rows += build_num_rows;
+  }
+
+  estimate.output_bytes =
+    cudf::detail::gather_size_upper_bound(
+      probe, join_num_rows, JoinKind == cudf::detail::join_kind::FULL_JOIN, stream) +
+    cudf::detail::gather_size_upper_bound(
+      _build, join_num_rows, JoinKind != cudf::detail::join_kind::INNER_JOIN, stream);
+  return estimate;
+}
+
+template <cudf::detail::join_kind JoinKind>
+std::unique_ptr<cudf::table> hash_join::hash_join_impl::compute_hash_semi_anti_join(
+  cudf::table_view const &probe,
+  std::vector<size_type> const &probe_on,
+  std::vector<size_type> const &return_columns,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream) const
+{
+  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+  CUDF_EXPECTS(probe.num_rows() < cudf::detail::MAX_JOIN_SIZE,
+               "Probe column size is too big for hash join");
+  CUDF_EXPECTS(_build_on.size() == probe_on.size(),
+               "Mismatch in number of columns to be joined on");
+
+  auto probe_returned = probe.select(return_columns);
+  if (return_columns.empty() || 0 == probe.num_rows() ||
+      cudf::detail::is_trivial_join(probe, _build, probe_on, _build_on, JoinKind)) {
+    return empty_like(probe_returned);
+  }
+
+  if (!_hash_table) {
+    // Nothing in the build table, so every probe row is part of the anti join
+    return std::make_unique<cudf::table>(probe_returned, stream, mr);
+  }
+
+  auto probe_selected = probe.select(probe_on);
+  CUDF_EXPECTS(std::equal(std::cbegin(_build_selected),
+                          std::cend(_build_selected),
+                          std::cbegin(probe_selected),
+                          std::cend(probe_selected),
+                          [](const auto &b, const auto &p) { return b.type() == p.type(); }),
+               "Mismatch in joining column data types");
+
+  auto probe_keys_selected = probe_keys(probe, probe_on, stream);
+  auto build_table         = cudf::table_device_view::create(_build_keys, stream);
+  auto probe_table         = cudf::table_device_view::create(probe_keys_selected.keys, stream);
+  rmm::device_vector<bool> has_match(probe.num_rows());
+  constexpr int block_size{cudf::detail::DEFAULT_JOIN_BLOCK_SIZE};
+  constexpr int tile_size{cudf::detail::DEFAULT_PROBE_TILE_SIZE};
+  cudf::detail::grid_1d config(probe.num_rows(), block_size / tile_size);
+  cudf::detail::probe_rows_have_match<tile_size><<<config.num_blocks, block_size, 0, stream>>>(
+    _hash_table->view(),
+    *probe_table,
+    cudf::detail::row_hash{*probe_table},
+    cudf::detail::row_equality{*probe_table,
+                               *build_table,
+                               compare_nulls == null_equality::EQUAL,
+                               build_strings()},
+    _heavy_keys.view(),
+    has_match.data().get());
+  CHECK_CUDA(stream);
+
+  rmm::device_vector<size_type> gather_map(probe.num_rows());
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  auto const gather_map_end =
+    (JoinKind == cudf::detail::join_kind::LEFT_SEMI_JOIN)
+      ? thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                        counting,
+                        counting + probe.num_rows(),
+                        has_match.begin(),
+                        gather_map.begin(),
+                        thrust::identity<bool>())
+      : thrust::remove_copy_if(rmm::exec_policy(stream)->on(stream),
+                               counting,
+                               counting + probe.num_rows(),
+                               has_match.begin(),
+                               gather_map.begin(),
+                               thrust::identity<bool>());
+
+  return cudf::detail::gather(
+    probe_returned, gather_map.begin(), gather_map_end, false, mr, stream);
+}
+
+template <cudf::detail::join_kind JoinKind>
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+hash_join::hash_join_impl::compute_hash_join_indices(cudf::table_view const &probe,
+                                                     std::vector<size_type> const &probe_on,
+                                                     null_equality compare_nulls,
+                                                     rmm::mr::device_memory_resource *mr,
+                                                     cudaStream_t stream) const
+{
+  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+  CUDF_EXPECTS(probe.num_rows() < cudf::detail::MAX_JOIN_SIZE,
+               "Probe column size is too big for hash join");
+  CUDF_EXPECTS(_build_on.size() == probe_on.size(),
+               "Mismatch in number of columns to be joined on");
+
+  if (is_trivial_join(probe, _build, probe_on, _build_on, JoinKind)) {
+    return std::make_pair(cudf::make_empty_column(data_type{type_id::INT32}),
+                          cudf::make_empty_column(data_type{type_id::INT32}));
+  }
+
+  auto probe_selected = probe.select(probe_on);
+  CUDF_EXPECTS(std::equal(std::cbegin(_build_selected),
+                          std::cend(_build_selected),
+                          std::cbegin(probe_selected),
+                          std::cend(probe_selected),
+                          [](const auto &b, const auto &p) { return b.type() == p.type(); }),
+               "Mismatch in joining column data types");
+
+  constexpr cudf::detail::join_kind ProbeJoinKind = (JoinKind == cudf::detail::join_kind::FULL_JOIN)
+                                                      ? cudf::detail::join_kind::LEFT_JOIN
+                                                      : JoinKind;
+  auto const probe_keys_selected = probe_keys(probe, probe_on, stream);
+  auto joined_indices =
+    probe_join_indices<ProbeJoinKind>(probe_keys_selected.keys, compare_nulls, stream);
+  if (JoinKind == cudf::detail::join_kind::FULL_JOIN) {
+    // Same row order as `construct_join_output_df`: unmatched build rows come first
+    auto complement_indices = cudf::detail::get_left_join_indices_complement(
+      joined_indices.second, probe.num_rows(), _build.num_rows(), stream);
+    joined_indices = cudf::detail::concatenate_vector_pairs(complement_indices, joined_indices);
+  }
+  return std::make_pair(cudf::detail::make_join_gather_map(joined_indices.first, mr, stream),
+                        cudf::detail::make_join_gather_map(joined_indices.second, mr, stream));
+}
+
 template <cudf::detail::join_kind JoinKind>
 std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::table>>
 hash_join::hash_join_impl::compute_hash_join(
@@ -581,7 +1515,9 @@ hash_join::hash_join_impl::compute_hash_join(
   constexpr cudf::detail::join_kind ProbeJoinKind = (JoinKind == cudf::detail::join_kind::FULL_JOIN)
                                                       ? cudf::detail::join_kind::LEFT_JOIN
                                                       : JoinKind;
-  auto joined_indices = probe_join_indices<ProbeJoinKind>(probe_selected, compare_nulls, stream);
+  auto const probe_keys_selected = probe_keys(probe, probe_on, stream);
+  auto joined_indices =
+    probe_join_indices<ProbeJoinKind>(probe_keys_selected.keys, compare_nulls, stream);
   return cudf::detail::construct_join_output_df<JoinKind>(
     probe, _build, joined_indices, columns_in_common, common_columns_output_side, mr, stream);
 }
@@ -593,6 +1529,7 @@ hash_join::hash_join_impl::probe_join_indices(cudf::table_view const &probe,
                                               null_equality compare_nulls,
                                               cudaStream_t stream) const
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("hash_join::probe", probe.num_rows());
   // Trivial left join case - exit early
   if (!_hash_table && JoinKind == cudf::detail::join_kind::LEFT_JOIN) {
     return get_trivial_left_join_indices(probe, stream);
@@ -600,10 +1537,30 @@ hash_join::hash_join_impl::probe_join_indices(cudf::table_view const &probe,
 
   CUDF_EXPECTS(_hash_table, "Hash table of hash join is null.");
 
-  auto build_table = cudf::table_device_view::create(_build_selected, stream);
+  auto build_table = cudf::table_device_view::create(_build_keys, stream);
   auto probe_table = cudf::table_device_view::create(probe, stream);
-  return cudf::detail::probe_join_hash_table<JoinKind>(
-    *build_table, *probe_table, *_hash_table, compare_nulls, stream);
+  auto joined_indices =
+    (_size_policy == output_size_policy::EXACT)
+      ? cudf::detail::probe_join_hash_table_exact<JoinKind>(*build_table,
+                                                            *probe_table,
+                                                            *_hash_table,
+                                                            _heavy_keys.view(),
+                                                            compare_nulls,
+                                                            build_strings(),
+                                                            stream)
+      : cudf::detail::probe_join_hash_table<JoinKind>(*build_table,
+                                                      *probe_table,
+                                                      *_hash_table,
+                                                      _heavy_keys.view(),
+                                                      compare_nulls,
+                                                      build_strings(),
+                                                      stream);
+  if (_heavy_keys.empty()) { return joined_indices; }
+
+  // The probe rows of heavy keys were skipped by the hash table probe
+  auto heavy_indices = cudf::detail::probe_heavy_keys<JoinKind>(
+    *build_table, *probe_table, _heavy_keys, compare_nulls, build_strings(), stream);
+  return cudf::detail::concatenate_vector_pairs(joined_indices, heavy_indices);
 }
 
 }  // namespace cudf
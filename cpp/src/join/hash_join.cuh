@@ -19,6 +19,7 @@
 #include <cudf/join.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/structs/detail/flatten.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -41,22 +42,26 @@ namespace detail {
  * @throw cudf::logic_error if JoinKind is not INNER_JOIN or LEFT_JOIN
  *
  * @tparam JoinKind The type of join to be performed
- * @tparam multimap_type The type of the hash table
  *
  * @param build_table The right hand table
  * @param probe_table The left hand table
  * @param hash_table A hash table built on the build table that maps the index
  * of every row to the hash value of that row.
+ * @param heavy The heavy keys of the build table, whose probe rows are not counted
  * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param build_strings The inline strings of the build table if it is a single strings column,
+ * otherwise null.
  * @param stream CUDA stream used for device memory operations and kernel launches
  *
  * @return An estimate of the size of the output of the join operation
  */
-template <join_kind JoinKind, typename multimap_type>
+template <join_kind JoinKind>
 size_type estimate_join_output_size(table_device_view build_table,
                                     table_device_view probe_table,
                                     multimap_type const& hash_table,
+                                    heavy_key_view heavy,
                                     null_equality compare_nulls,
+                                    strings::detail::inline_string const* build_strings,
                                     cudaStream_t stream)
 {
   const size_type build_table_num_rows{build_table.num_rows()};
@@ -95,10 +100,11 @@ size_type estimate_join_output_size(table_device_view build_table,
   CHECK_CUDA(stream);
 
   constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  constexpr int tile_size{DEFAULT_PROBE_TILE_SIZE};
   int numBlocks{-1};
 
   CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-    &numBlocks, compute_join_output_size<JoinKind, multimap_type, block_size>, block_size, 0));
+    &numBlocks, compute_join_output_size<JoinKind, tile_size, block_size>, block_size, 0));
 
   int dev_id{-1};
   CUDA_TRY(cudaGetDevice(&dev_id));
@@ -112,18 +118,20 @@ size_type estimate_join_output_size(table_device_view build_table,
   do {
     sample_probe_num_rows = std::min(sample_probe_num_rows, probe_table_num_rows);
 
-    size_estimate.set_value(0);
+    size_estimate.set_value(0, stream);
 
     row_hash hash_probe{probe_table};
-    row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
+    row_equality equality{
+      probe_table, build_table, compare_nulls == null_equality::EQUAL, build_strings};
     // Probe the hash table without actually building the output to simply
     // find what the size of the output will be.
-    compute_join_output_size<JoinKind, multimap_type, block_size>
-      <<<numBlocks * num_sms, block_size, 0, stream>>>(hash_table,
+    compute_join_output_size<JoinKind, tile_size, block_size>
+      <<<numBlocks * num_sms, block_size, 0, stream>>>(hash_table.view(),
                                                        build_table,
                                                        probe_table,
                                                        hash_probe,
                                                        equality,
+                                                       heavy,
                                                        sample_probe_num_rows,
                                                        size_estimate.data());
     CHECK_CUDA(stream);
@@ -132,9 +140,9 @@ size_type estimate_join_output_size(table_device_view build_table,
     // increase the estimated output size by a factor of the ratio between the
     // probe and build tables
     if (sample_probe_num_rows < probe_table_num_rows) {
-      h_size_estimate = size_estimate.value() * probe_to_build_ratio;
+      h_size_estimate = size_estimate.value(stream) * probe_to_build_ratio;
     } else {
-      h_size_estimate = size_estimate.value();
+      h_size_estimate = size_estimate.value(stream);
     }
 
     // If the size estimate is non-zero, then we have a valid estimate and can break
@@ -185,6 +193,69 @@ get_trivial_left_join_indices(table_view const& left, cudaStream_t stream)
 std::unique_ptr<cudf::table> combine_table_pair(std::unique_ptr<cudf::table>&& left,
                                                 std::unique_ptr<cudf::table>&& right);
 
+/**
+ * @brief Returns the empty (`probe`, `build`) table pair of a trivial join.
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> get_empty_joined_table(
+  table_view const& probe,
+  table_view const& build,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  cudf::hash_join::common_columns_output_side common_columns_output_side);
+
+/**
+ * @brief Gathers the (`probe`, `build`) table pair of a join from its output indices.
+ *
+ * Explicitly instantiated for `INNER_JOIN` and `LEFT_JOIN`, which other join implementations
+ * share.
+ */
+template <join_kind JoinKind>
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> construct_join_output_df(
+  table_view const& probe,
+  table_view const& build,
+  VectorPair& joined_indices,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  cudf::hash_join::common_columns_output_side common_columns_output_side,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream);
+
+/**
+ * @brief Copies join output indices into a public gather map column.
+ *
+ * `JoinNoneValue` entries are replaced with `cudf::join_no_match`.
+ *
+ * @param indices Join output indices of one side of the join
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Non-nullable `INT32` column of row indices
+ */
+std::unique_ptr<column> make_join_gather_map(rmm::device_vector<size_type> const& indices,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream);
+
+/**
+ * @brief The build rows of the heavy-hitter keys of a hash join, whose hash value is shared by at
+ * least `DEFAULT_JOIN_HEAVY_KEY_THRESHOLD` build rows.
+ *
+ * A single tile emitting all the matches of such a key would run far longer than the others, so
+ * these rows are kept out of the hash table and joined by `probe_heavy_keys()` instead.
+ */
+struct heavy_keys {
+  rmm::device_vector<hash_value_type> hashes;
+  rmm::device_vector<size_type> offsets;
+  rmm::device_vector<size_type> build_rows;
+
+  bool empty() const { return hashes.empty(); }
+
+  heavy_key_view view() const
+  {
+    return heavy_key_view{hashes.data().get(),
+                          offsets.data().get(),
+                          build_rows.data().get(),
+                          static_cast<size_type>(hashes.size())};
+  }
+};
+
 }  // namespace detail
 
 struct hash_join::hash_join_impl {
@@ -199,9 +270,16 @@ struct hash_join::hash_join_impl {
  private:
   cudf::table_view _build;
   cudf::table_view _build_selected;
+  // The leaves of the struct columns of `_build_selected`
+  cudf::structs::detail::flattened_table _build_flattened;
+  // `_build_flattened` with the indices of its dictionary columns, which are hashed and compared
+  cudf::table_view _build_keys;
   std::vector<size_type> _build_on;
-  std::unique_ptr<cudf::detail::multimap_type, std::function<void(cudf::detail::multimap_type*)>>
-    _hash_table;
+  output_size_policy _size_policy;
+  cudf::detail::heavy_keys _heavy_keys;
+  std::unique_ptr<cudf::detail::multimap_type> _hash_table;
+  // The inline strings of `_build_selected` if it is a single strings column
+  rmm::device_vector<strings::detail::inline_string> _build_strings;
 
  public:
   /**
@@ -215,8 +293,13 @@ struct hash_join::hash_join_impl {
    *
    * @param build The build table, from which the hash table is built.
    * @param build_on The column indices from `build` to join on.
+   * @param size_policy How the probe calls size the join output.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    */
-  hash_join_impl(cudf::table_view const& build, std::vector<size_type> const& build_on);
+  hash_join_impl(cudf::table_view const& build,
+                 std::vector<size_type> const& build_on,
+                 output_size_policy size_policy,
+                 cudaStream_t stream);
 
   std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::table>> inner_join(
     cudf::table_view const& probe,
@@ -224,23 +307,116 @@ struct hash_join::hash_join_impl {
     std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
     common_columns_output_side common_columns_output_side,
     null_equality compare_nulls,
-    rmm::mr::device_memory_resource* mr) const;
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) const;
 
   std::unique_ptr<cudf::table> left_join(
     cudf::table_view const& probe,
     std::vector<size_type> const& probe_on,
     std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
     null_equality compare_nulls,
-    rmm::mr::device_memory_resource* mr) const;
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) const;
 
   std::unique_ptr<cudf::table> full_join(
     cudf::table_view const& probe,
     std::vector<size_type> const& probe_on,
     std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
     null_equality compare_nulls,
-    rmm::mr::device_memory_resource* mr) const;
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) const;
+
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join_indices(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) const;
+
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join_indices(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) const;
+
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join_indices(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) const;
+
+  std::unique_ptr<cudf::table> left_semi_join(cudf::table_view const& probe,
+                                              std::vector<size_type> const& probe_on,
+                                              std::vector<size_type> const& return_columns,
+                                              null_equality compare_nulls,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream) const;
+
+  std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& probe,
+                                              std::vector<size_type> const& probe_on,
+                                              std::vector<size_type> const& return_columns,
+                                              null_equality compare_nulls,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream) const;
+
+  std::unique_ptr<bloom_filter> make_bloom_filter(size_type bits_per_key,
+                                                  null_equality compare_nulls,
+                                                  rmm::mr::device_memory_resource* mr) const;
+
+  static memory_estimate estimate_build_memory(cudf::table_view const& build,
+                                               std::vector<size_type> const& build_on);
+
+  memory_estimate estimate_inner_join_memory(cudf::table_view const& probe,
+                                             std::vector<size_type> const& probe_on,
+                                             null_equality compare_nulls,
+                                             cudaStream_t stream) const;
+
+  memory_estimate estimate_left_join_memory(cudf::table_view const& probe,
+                                            std::vector<size_type> const& probe_on,
+                                            null_equality compare_nulls,
+                                            cudaStream_t stream) const;
+
+  memory_estimate estimate_full_join_memory(cudf::table_view const& probe,
+                                            std::vector<size_type> const& probe_on,
+                                            null_equality compare_nulls,
+                                            cudaStream_t stream) const;
 
  private:
+  /**
+   * @brief The keys of a probe table, and the columns they view
+   */
+  struct probe_table_keys {
+    cudf::structs::detail::flattened_table flattened;
+    std::vector<std::unique_ptr<cudf::column>> remapped_indices;
+    cudf::table_view keys;
+  };
+
+  /**
+   * @brief Returns the `probe_on` columns of `probe` to hash and compare with `_build_keys`
+   *
+   * Struct columns are replaced by their leaves, as in `_build_flattened`. A probe dictionary
+   * column is replaced by its indices if it shares the keys of the build
+   * dictionary column, or else by the indices of its values into the build keys, where the values
+   * missing from the build keys do not match any build row. Only the keys are remapped, so that
+   * string keys are probed as integers.
+   *
+   * @throw cudf::logic_error if the leaves of the struct columns do not match the build leaves.
+   * @throw cudf::logic_error if a dictionary build column is joined with another type, or with a
+   * dictionary of another keys type.
+   *
+   * @param probe The probe table.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The keys to probe, and the flattened columns and remapped indices they view.
+   */
+  probe_table_keys probe_keys(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    cudaStream_t stream) const;
+
   /**
    * @brief Performs hash join by probing the columns provided in `probe` as per
    * the joining indices given in `probe_on` and returns a (`probe`, `_build`) table pair, which
@@ -292,6 +468,91 @@ struct hash_join::hash_join_impl {
     rmm::mr::device_memory_resource* mr,
     cudaStream_t stream = 0) const;
 
+  /**
+   * @brief Performs hash join by probing the columns provided in `probe` as per the joining
+   * indices given in `probe_on` and returns the (`probe`, `_build`) row indices of the logical
+   * joined table, with `cudf::join_no_match` for rows without a match.
+   *
+   * @throw cudf::logic_error under the same conditions as `compute_hash_join`.
+   *
+   * @tparam JoinKind The type of join to be performed.
+   *
+   * @param probe The probe table.
+   * @param probe_on The column's indices from `probe` to join on.
+   * Column `i` from `probe_on` will be compared against column `i` of `_build_on`.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned columns' device memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Pair of `INT32` columns of row indices into `probe` and `_build`.
+   */
+  template <cudf::detail::join_kind JoinKind>
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+  compute_hash_join_indices(cudf::table_view const& probe,
+                            std::vector<size_type> const& probe_on,
+                            null_equality compare_nulls,
+                            rmm::mr::device_memory_resource* mr,
+                            cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Returns the `return_columns` of the rows of `probe` that have (`LEFT_SEMI_JOIN`) or do
+   * not have (`LEFT_ANTI_JOIN`) a match in `_build`.
+   *
+   * Only reads `_hash_table`, which is why it can run concurrently with other probes.
+   *
+   * @throw cudf::logic_error under the same conditions as `compute_hash_join`.
+   *
+   * @tparam JoinKind `LEFT_SEMI_JOIN` or `LEFT_ANTI_JOIN`.
+   *
+   * @param probe The probe table.
+   * @param probe_on The column's indices from `probe` to join on.
+   * @param return_columns The column indices from `probe` to include in the returned table.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned table's device memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Table of the `return_columns` of the selected `probe` rows, in `probe` order.
+   */
+  template <cudf::detail::join_kind JoinKind>
+  std::unique_ptr<cudf::table> compute_hash_semi_anti_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    std::vector<size_type> const& return_columns,
+    null_equality compare_nulls,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Returns upper bounds on the device memory of `compute_hash_join<JoinKind>`, counting
+   * the output rows of the probe of the `_hash_table` exactly and bounding those of the heavy
+   * keys by their number of candidate pairs.
+   *
+   * @throw cudf::logic_error under the same conditions as `compute_hash_join`.
+   *
+   * @tparam JoinKind The type of join to be performed.
+   *
+   * @param probe The probe table.
+   * @param probe_on The column's indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Upper bounds on the temporary and output device memory of the join.
+   */
+  template <cudf::detail::join_kind JoinKind>
+  memory_estimate estimate_join_memory(cudf::table_view const& probe,
+                                       std::vector<size_type> const& probe_on,
+                                       null_equality compare_nulls,
+                                       cudaStream_t stream) const;
+
+  /**
+   * @brief Returns the inline strings of `_build_selected`, or null if it is not a single strings
+   * column.
+   */
+  strings::detail::inline_string const* build_strings() const
+  {
+    return _build_strings.empty() ? nullptr : _build_strings.data().get();
+  }
+
   /**
    * @brief Probes the `_hash_table` built from `_build` for tuples in `probe_table`,
    * and returns the output indices of `build_table` and `probe_table` as a combined table,
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <join/join_common_utils.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the number of `left` rows within the interval of a `right` row
+ */
+struct interval_match_count {
+  table_device_view null_checked;  // columns of `right` whose nulls never match
+  size_type const* lower;
+  size_type const* upper;
+
+  __device__ int64_t operator()(size_type right_row_index) const
+  {
+    for (auto const& col : null_checked) {
+      if (col.is_null(right_row_index)) { return 0; }
+    }
+    auto const count = upper[right_row_index] - lower[right_row_index];
+    return count > 0 ? count : 0;
+  }
+};
+
+/**
+ * @brief Writes the pairs of a `right` row at its offset
+ */
+struct write_interval_matches {
+  int64_t const* offsets;
+  size_type const* lower;
+  size_type const* left_order;  // sorted position to `left` row
+  size_type* left_indices;
+  size_type* right_indices;
+
+  __device__ void operator()(size_type right_row_index) const
+  {
+    auto const offset = offsets[right_row_index];
+    auto const count  = offsets[right_row_index + 1] - offset;
+    auto const first  = lower[right_row_index];
+    for (int64_t i = 0; i < count; ++i) {
+      left_indices[offset + i]  = left_order[first + i];
+      right_indices[offset + i] = right_row_index;
+    }
+  }
+};
+
+bool types_match(table_view const& lhs, table_view const& rhs)
+{
+  return std::equal(
+    lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](auto const& l, auto const& r) {
+      return l.type() == r.type();
+    });
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> interval_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_equal_on,
+  std::vector<size_type> const& right_equal_on,
+  size_type left_value,
+  size_type right_lower,
+  size_type right_upper,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(left_equal_on.size() == right_equal_on.size(),
+               "Mismatch in number of columns to be joined on");
+
+  // Sort `left` on (equality keys, value), the needles being (equality keys, bound) of `right`
+  auto left_keys_on = left_equal_on;
+  left_keys_on.push_back(left_value);
+  auto lower_on = right_equal_on;
+  lower_on.push_back(right_lower);
+  auto upper_on = right_equal_on;
+  upper_on.push_back(right_upper);
+
+  auto const left_keys    = left.select(left_keys_on);
+  auto const lower_values = right.select(lower_on);
+  auto const upper_values = right.select(upper_on);
+  CUDF_EXPECTS(types_match(left_keys, lower_values) && types_match(left_keys, upper_values),
+               "Mismatch in interval join column data types");
+
+  if (left.num_rows() == 0 || right.num_rows() == 0) {
+    return std::make_pair(make_empty_column(data_type{type_id::INT32}),
+                          make_empty_column(data_type{type_id::INT32}));
+  }
+
+  // Nulls sort last, so null values lie outside of every interval of their group
+  std::vector<order> const column_order(left_keys.num_columns(), order::ASCENDING);
+  std::vector<null_order> const null_precedence(left_keys.num_columns(), null_order::AFTER);
+  auto const left_order = detail::sorted_order(
+    left_keys, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+  auto const sorted_left = detail::gather(left_keys,
+                                          left_order->view(),
+                                          out_of_bounds_policy::FAIL,
+                                          negative_index_policy::NOT_ALLOWED,
+                                          rmm::mr::get_default_resource(),
+                                          stream);
+  auto const lower = detail::lower_bound(sorted_left->view(),
+                                         lower_values,
+                                         column_order,
+                                         null_precedence,
+                                         rmm::mr::get_default_resource(),
+                                         stream);
+  auto const upper = detail::upper_bound(sorted_left->view(),
+                                         upper_values,
+                                         column_order,
+                                         null_precedence,
+                                         rmm::mr::get_default_resource(),
+                                         stream);
+
+  std::vector<size_type> null_checked_on{right_lower, right_upper};
+  if (compare_nulls == null_equality::UNEQUAL) {
+    null_checked_on.insert(null_checked_on.end(), right_equal_on.begin(), right_equal_on.end());
+  }
+  auto null_checked = table_device_view::create(right.select(null_checked_on), stream);
+
+  auto const num_right_rows = right.num_rows();
+  rmm::device_vector<int64_t> offsets(num_right_rows + 1, 0);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_right_rows),
+    offsets.begin(),
+    interval_match_count{
+      *null_checked, lower->view().data<size_type>(), upper->view().data<size_type>()});
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), offsets.begin(), offsets.end(), offsets.begin());
+  int64_t const join_size = offsets.back();
+  CUDF_EXPECTS(join_size < MAX_JOIN_SIZE, "Join output size is too big");
+
+  auto left_indices = make_numeric_column(data_type{type_id::INT32},
+                                          static_cast<size_type>(join_size),
+                                          mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  auto right_indices = make_numeric_column(data_type{type_id::INT32},
+                                           static_cast<size_type>(join_size),
+                                           mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_right_rows,
+                     write_interval_matches{offsets.data().get(),
+                                            lower->view().data<size_type>(),
+                                            left_order->view().data<size_type>(),
+                                            left_indices->mutable_view().data<size_type>(),
+                                            right_indices->mutable_view().data<size_type>()});
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> interval_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_equal_on,
+  std::vector<size_type> const& right_equal_on,
+  size_type left_value,
+  size_type right_lower,
+  size_type right_upper,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::interval_join_indices(left,
+                                       right,
+                                       left_equal_on,
+                                       right_equal_on,
+                                       left_value,
+                                       right_lower,
+                                       right_upper,
+                                       compare_nulls,
+                                       mr,
+                                       0);
+}
+
+}  // namespace cudf
@@ -16,6 +16,7 @@
 #include <cudf/table/table.hpp>
 
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -23,6 +24,21 @@
 #include "hash_join.cuh"
 
 namespace cudf {
+namespace {
+/**
+ * @brief Adds the metrics of a join of `left` and `right` returning `output`
+ */
+void add_join_metrics(detail::operation_metrics_scope& metrics,
+                      table_view const& left,
+                      table_view const& right,
+                      table_view const& output)
+{
+  metrics.add("rows_left", left.num_rows());
+  metrics.add("rows_right", right.num_rows());
+  metrics.add("rows_out", output.num_rows());
+}
+
+}  // namespace
 
 std::unique_ptr<table> inner_join(
   table_view const& left,
@@ -31,14 +47,18 @@ std::unique_ptr<table> inner_join(
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
+  detail::operation_metrics_scope metrics("inner_join", stream);
   // For `inner_join`, we can freely choose either the `left` or `right` table to use for
   // building/probing the hash map. Because building is typically more expensive than probing, we
   // build the hash map from the smaller table.
+  std::unique_ptr<table> result;
   if (right.num_rows() > left.num_rows()) {
-    cudf::hash_join hj_obj(left, left_on);
+    metrics.decide("build_side", "left");
+    cudf::hash_join hj_obj(left, left_on, cudf::hash_join::output_size_policy::ESTIMATE, stream);
     auto actual_columns_in_common = columns_in_common;
     std::for_each(actual_columns_in_common.begin(), actual_columns_in_common.end(), [](auto& pair) {
       std::swap(pair.first, pair.second);
@@ -48,20 +68,25 @@ std::unique_ptr<table> inner_join(
                                               actual_columns_in_common,
                                               cudf::hash_join::common_columns_output_side::BUILD,
                                               compare_nulls,
-                                              mr);
-    return cudf::detail::combine_table_pair(std::move(probe_build_pair.second),
-                                            std::move(probe_build_pair.first));
+                                              mr,
+                                              stream);
+    result = cudf::detail::combine_table_pair(std::move(probe_build_pair.second),
+                                              std::move(probe_build_pair.first));
   } else {
-    cudf::hash_join hj_obj(right, right_on);
+    metrics.decide("build_side", "right");
+    cudf::hash_join hj_obj(right, right_on, cudf::hash_join::output_size_policy::ESTIMATE, stream);
     auto probe_build_pair = hj_obj.inner_join(left,
                                               left_on,
                                               columns_in_common,
                                               cudf::hash_join::common_columns_output_side::PROBE,
                                               compare_nulls,
-                                              mr);
-    return cudf::detail::combine_table_pair(std::move(probe_build_pair.first),
-                                            std::move(probe_build_pair.second));
+                                              mr,
+                                              stream);
+    result = cudf::detail::combine_table_pair(std::move(probe_build_pair.first),
+                                              std::move(probe_build_pair.second));
   }
+  add_join_metrics(metrics, left, right, result->view());
+  return result;
 }
 
 std::unique_ptr<table> left_join(
@@ -71,11 +96,15 @@ std::unique_ptr<table> left_join(
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  cudf::hash_join hj_obj(right, right_on);
-  return hj_obj.left_join(left, left_on, columns_in_common, compare_nulls, mr);
+  detail::operation_metrics_scope metrics("left_join", stream);
+  cudf::hash_join hj_obj(right, right_on, cudf::hash_join::output_size_policy::ESTIMATE, stream);
+  auto result = hj_obj.left_join(left, left_on, columns_in_common, compare_nulls, mr, stream);
+  add_join_metrics(metrics, left, right, result->view());
+  return result;
 }
 
 std::unique_ptr<table> full_join(
@@ -85,17 +114,73 @@ std::unique_ptr<table> full_join(
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  detail::operation_metrics_scope metrics("full_join", stream);
+  cudf::hash_join hj_obj(right, right_on, cudf::hash_join::output_size_policy::ESTIMATE, stream);
+  auto result = hj_obj.full_join(left, left_on, columns_in_common, compare_nulls, mr, stream);
+  add_join_metrics(metrics, left, right, result->view());
+  return result;
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inner_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  cudf::hash_join hj_obj(right, right_on);
-  return hj_obj.full_join(left, left_on, columns_in_common, compare_nulls, mr);
+  // Build the hash map from the smaller table, as in `inner_join`
+  if (right.num_rows() > left.num_rows()) {
+    cudf::hash_join hj_obj(left, left_on, cudf::hash_join::output_size_policy::ESTIMATE, stream);
+    auto probe_build_pair = hj_obj.inner_join_indices(right, right_on, compare_nulls, mr, stream);
+    return std::make_pair(std::move(probe_build_pair.second), std::move(probe_build_pair.first));
+  } else {
+    cudf::hash_join hj_obj(right, right_on, cudf::hash_join::output_size_policy::ESTIMATE, stream);
+    return hj_obj.inner_join_indices(left, left_on, compare_nulls, mr, stream);
+  }
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> left_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  cudf::hash_join hj_obj(right, right_on, cudf::hash_join::output_size_policy::ESTIMATE, stream);
+  return hj_obj.left_join_indices(left, left_on, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> full_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  cudf::hash_join hj_obj(right, right_on, cudf::hash_join::output_size_policy::ESTIMATE, stream);
+  return hj_obj.full_join_indices(left, left_on, compare_nulls, mr, stream);
 }
 
 hash_join::~hash_join() = default;
 
-hash_join::hash_join(cudf::table_view const& build, std::vector<size_type> const& build_on)
-  : impl{std::make_unique<const hash_join::hash_join_impl>(build, build_on)}
+hash_join::hash_join(cudf::table_view const& build,
+                     std::vector<size_type> const& build_on,
+                     output_size_policy size_policy,
+                     cudaStream_t stream)
+  : impl{std::make_unique<const hash_join::hash_join_impl>(build, build_on, size_policy, stream)}
 {
 }
 
@@ -105,10 +190,11 @@ std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::table>> hash_join:
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   common_columns_output_side common_columns_output_side,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr) const
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
 {
   return impl->inner_join(
-    probe, probe_on, columns_in_common, common_columns_output_side, compare_nulls, mr);
+    probe, probe_on, columns_in_common, common_columns_output_side, compare_nulls, mr, stream);
 }
 
 std::unique_ptr<cudf::table> hash_join::left_join(
@@ -116,9 +202,10 @@ std::unique_ptr<cudf::table> hash_join::left_join(
   std::vector<size_type> const& probe_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr) const
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
 {
-  return impl->left_join(probe, probe_on, columns_in_common, compare_nulls, mr);
+  return impl->left_join(probe, probe_on, columns_in_common, compare_nulls, mr, stream);
 }
 
 std::unique_ptr<cudf::table> hash_join::full_join(
@@ -126,9 +213,99 @@ std::unique_ptr<cudf::table> hash_join::full_join(
   std::vector<size_type> const& probe_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr) const
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  return impl->full_join(probe, probe_on, columns_in_common, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+hash_join::inner_join_indices(cudf::table_view const& probe,
+                              std::vector<size_type> const& probe_on,
+                              null_equality compare_nulls,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream) const
+{
+  return impl->inner_join_indices(probe, probe_on, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+hash_join::left_join_indices(cudf::table_view const& probe,
+                             std::vector<size_type> const& probe_on,
+                             null_equality compare_nulls,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream) const
+{
+  return impl->left_join_indices(probe, probe_on, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+hash_join::full_join_indices(cudf::table_view const& probe,
+                             std::vector<size_type> const& probe_on,
+                             null_equality compare_nulls,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream) const
+{
+  return impl->full_join_indices(probe, probe_on, compare_nulls, mr, stream);
+}
+
+std::unique_ptr<cudf::table> hash_join::left_semi_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  std::vector<size_type> const& return_columns,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  return impl->left_semi_join(probe, probe_on, return_columns, compare_nulls, mr, stream);
+}
+
+std::unique_ptr<cudf::table> hash_join::left_anti_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  std::vector<size_type> const& return_columns,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  return impl->left_anti_join(probe, probe_on, return_columns, compare_nulls, mr, stream);
+}
+
+std::unique_ptr<bloom_filter> hash_join::make_bloom_filter(size_type bits_per_key,
+                                                          null_equality compare_nulls,
+                                                          rmm::mr::device_memory_resource* mr) const
+{
+  return impl->make_bloom_filter(bits_per_key, compare_nulls, mr);
+}
+
+memory_estimate hash_join::estimate_build_memory(cudf::table_view const& build,
+                                                 std::vector<size_type> const& build_on)
+{
+  return hash_join_impl::estimate_build_memory(build, build_on);
+}
+
+memory_estimate hash_join::estimate_inner_join_memory(cudf::table_view const& probe,
+                                                      std::vector<size_type> const& probe_on,
+                                                      null_equality compare_nulls,
+                                                      cudaStream_t stream) const
+{
+  return impl->estimate_inner_join_memory(probe, probe_on, compare_nulls, stream);
+}
+
+memory_estimate hash_join::estimate_left_join_memory(cudf::table_view const& probe,
+                                                     std::vector<size_type> const& probe_on,
+                                                     null_equality compare_nulls,
+                                                     cudaStream_t stream) const
+{
+  return impl->estimate_left_join_memory(probe, probe_on, compare_nulls, stream);
+}
+
+memory_estimate hash_join::estimate_full_join_memory(cudf::table_view const& probe,
+                                                     std::vector<size_type> const& probe_on,
+                                                     null_equality compare_nulls,
+                                                     cudaStream_t stream) const
 {
-  return impl->full_join(probe, probe_on, columns_in_common, compare_nulls, mr);
+  return impl->estimate_full_join_memory(probe, probe_on, compare_nulls, stream);
 }
 
 }  // namespace cudf
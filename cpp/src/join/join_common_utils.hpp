@@ -16,10 +16,11 @@
 #pragma once
 
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/detail/inline_string.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
-#include <hash/concurrent_unordered_multimap.cuh>
+#include <hash/open_addressing_map.cuh>
 
 #include <algorithm>
 #include <limits>
@@ -30,25 +31,58 @@ namespace cudf {
 namespace detail {
 constexpr size_type MAX_JOIN_SIZE{std::numeric_limits<size_type>::max()};
 
-constexpr int DEFAULT_JOIN_BLOCK_SIZE = 128;
-constexpr int DEFAULT_JOIN_CACHE_SIZE = 128;
-constexpr size_type JoinNoneValue     = -1;
+constexpr int DEFAULT_JOIN_BLOCK_SIZE                = 128;
+constexpr int DEFAULT_JOIN_CACHE_SIZE                = 128;
+constexpr size_type DEFAULT_JOIN_HEAVY_KEY_THRESHOLD = 1024;
+constexpr size_type JoinNoneValue                    = -1;
 
 using VectorPair = std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>;
 
-using multimap_type =
-  concurrent_unordered_multimap<hash_value_type,
-                                size_type,
-                                size_t,
-                                std::numeric_limits<hash_value_type>::max(),
-                                std::numeric_limits<size_type>::max(),
-                                default_hash<hash_value_type>,
-                                equal_to<hash_value_type>,
-                                default_allocator<thrust::pair<hash_value_type, size_type>>>;
+/**
+ * @brief Hash table mapping the row hash values of the build table to the indices of its rows
+ */
+using multimap_type = open_addressing_map<hash_value_type, size_type>;
+
+constexpr hash_value_type JoinUnusedKey = std::numeric_limits<hash_value_type>::max();
 
 using row_hash = cudf::row_hasher<default_hash>;
 
-using row_equality = cudf::row_equality_comparator<true>;
+/**
+ * @brief Equality comparator of the rows of two tables
+ *
+ * If `rhs_strings` is not null, both tables are a single strings column and `rhs_strings` are the
+ * inline strings of `rhs`. The rows are then compared on the size and prefix of the inline string
+ * first, which reads the chars of `rhs` only for long strings with a matching prefix.
+ */
+class row_equality {
+ public:
+  row_equality(table_device_view lhs,
+               table_device_view rhs,
+               bool nulls_are_equal                              = true,
+               strings::detail::inline_string const* rhs_strings = nullptr)
+    : _lhs{lhs},
+      _equality{lhs, rhs, nulls_are_equal},
+      _rhs_strings{rhs_strings},
+      _nulls_are_equal{nulls_are_equal}
+  {
+  }
+
+  __device__ bool operator()(size_type lhs_index, size_type rhs_index) const noexcept
+  {
+    if (_rhs_strings == nullptr) { return _equality(lhs_index, rhs_index); }
+    auto const& rhs     = _rhs_strings[rhs_index];
+    bool const lhs_null = _lhs.column(0).is_null(lhs_index);
+    if (lhs_null || rhs.is_null()) { return _nulls_are_equal && lhs_null && rhs.is_null(); }
+    return strings::detail::inline_string::create(
+             _lhs.column(0).element<string_view>(lhs_index)) == rhs;
+  }
+
+ private:
+  table_device_view _lhs;
+  cudf::row_equality_comparator<true> _equality;
+  strings::detail::inline_string const* _rhs_strings;
+  bool _nulls_are_equal;
+};
 
 enum class join_kind { INNER_JOIN, LEFT_JOIN, FULL_JOIN, LEFT_SEMI_JOIN, LEFT_ANTI_JOIN };
 
@@ -20,6 +20,8 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/table/table_device_view.cuh>
 
+#include <cooperative_groups.h>
+
 #include "join_common_utils.hpp"
 
 namespace cudf {
@@ -49,47 +51,145 @@ __inline__ __device__ void add_pair_to_cache(const size_type first,
   joined_shared_r[my_current_idx] = second;
 }
 
+/**
+ * @brief Device view of the build rows of heavy-hitter keys, the hash values shared by so many
+ * build rows that they are kept out of the hash table.
+ *
+ * The rows of the heavy key `g` are `build_rows[offsets[g]]` to `build_rows[offsets[g + 1] - 1]`.
+ */
+struct heavy_key_view {
+  hash_value_type const* hashes{nullptr};  ///< Sorted hash values of the heavy keys
+  size_type const* offsets{nullptr};       ///< Offsets of the rows of every heavy key
+  size_type const* build_rows{nullptr};    ///< Build rows grouped by heavy key
+  size_type num_keys{0};                   ///< Number of heavy keys
+
+  /**
+   * @brief Returns the index of the heavy key of `hash`, or -1 if `hash` is not heavy
+   */
+  __device__ size_type find(hash_value_type hash) const
+  {
+    size_type first = 0;
+    size_type last  = num_keys;
+    while (first < last) {
+      size_type const mid = first + (last - first) / 2;
+      if (hashes[mid] < hash) {
+        first = mid + 1;
+      } else {
+        last = mid;
+      }
+    }
+    return (first < num_keys && hashes[first] == hash) ? first : -1;
+  }
+};
+
 /**
  * @brief Builds a hash table from a row hasher that maps the hash
  * values of each row to its respective row index.
  *
- * @tparam multimap_type The type of the hash table
+ * Every row is inserted by a tile of `tile_size` threads probing the table together. The rows of
+ * heavy keys are not inserted.
+ *
+ * @tparam tile_size The number of threads cooperating on the insert of a row
  *
  * @param[in,out] multi_map The hash table to be built to insert rows into
  * @param[in] hash_build Row hasher for the build table
  * @param[in] build_table_num_rows The number of rows in the build table
- * @param[out] error Pointer used to set an error code if the insert fails
+ * @param[in] heavy The heavy keys of the build table
  */
-template <typename multimap_type>
-__global__ void build_hash_table(multimap_type multi_map,
+template <int tile_size>
+__global__ void build_hash_table(multimap_type::device_view multi_map,
                                  row_hash hash_build,
                                  const cudf::size_type build_table_num_rows,
-                                 int* error)
+                                 heavy_key_view heavy)
 {
-  cudf::size_type i = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  const cudf::size_type stride = (blockDim.x * gridDim.x) / tile_size;
 
-  while (i < build_table_num_rows) {
+  for (cudf::size_type i = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size;
+       i < build_table_num_rows;
+       i += stride) {
     // Compute the hash value of this row
-    const hash_value_type row_hash_value{hash_build(i)};
+    const hash_value_type row_hash_value =
+      tile.shfl(tile.thread_rank() == 0 ? hash_build(i) : 0, 0);
+    if (heavy.find(row_hash_value) >= 0) { continue; }
 
     // Insert the (row hash value, row index) into the map
     // using the row hash value to determine the location in the
     // hash map where the new pair should be inserted
-    const auto insert_location =
-      multi_map.insert(thrust::make_pair(row_hash_value, i), true, row_hash_value);
-
-    // If the insert failed, set the error code accordingly
-    if (multi_map.end() == insert_location) { *error = 1; }
-    i += blockDim.x * gridDim.x;
+    multi_map.insert(tile, row_hash_value, row_hash_value, i);
   }
 }
 
+/**
+ * @brief Calls `output(match_mask, is_match, build_row)` on every thread of `tile` for each window
+ * of slots probed in the hash table for the probe row, and returns the number of matching build
+ * rows.
+ *
+ * `match_mask` has bit `r` set if thread `r` of the tile found a match in the window, in which
+ * case `is_match` is `true` on that thread and `build_row` is the index of the matching build row.
+ *
+ * @tparam Tile The type of the group of threads probing the hash table together
+ * @tparam OutputFn Device callable taking the window match mask, the match flag of the calling
+ * thread and the matching build row
+ *
+ * @param[in] tile The threads probing the hash table for the probe row
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] probe_row_hash_value The hash value of the probe row
+ * @param[in] check_row_equality The row equality comparator
+ * @param[in] probe_row_index The probe row to look up
+ * @param[in] output Callable invoked for every window
+ */
+template <typename Tile, typename OutputFn>
+__device__ cudf::size_type for_each_probe_row_match(Tile const& tile,
+                                                    multimap_type::device_view const& multi_map,
+                                                    hash_value_type probe_row_hash_value,
+                                                    row_equality const& check_row_equality,
+                                                    cudf::size_type probe_row_index,
+                                                    OutputFn output)
+{
+  cudf::size_type num_matches{0};
+  multi_map.probe(
+    tile, probe_row_hash_value, [&](bool occupied, hash_value_type key, size_t slot) {
+      // First check that the hash values of the two rows match, then that the rows are equal
+      const bool is_match = occupied && key == probe_row_hash_value &&
+                            check_row_equality(probe_row_index, multi_map.value(slot));
+      const unsigned match_mask = tile.ballot(is_match);
+      output(match_mask,
+             is_match,
+             is_match ? multi_map.value(slot) : static_cast<cudf::size_type>(JoinNoneValue));
+      num_matches += __popc(match_mask);
+      return false;
+    });
+  return num_matches;
+}
+
+/**
+ * @brief Returns the hash value of the probe row on every thread of `tile`
+ */
+template <typename Tile>
+__device__ hash_value_type tile_row_hash(Tile const& tile,
+                                         row_hash const& hasher,
+                                         cudf::size_type row_index)
+{
+  return tile.shfl(tile.thread_rank() == 0 ? hasher(row_index) : 0, 0);
+}
+
+/**
+ * @brief Returns the number of threads of `match_mask` ranked below the calling thread of `tile`
+ */
+template <typename Tile>
+__device__ cudf::size_type match_rank(Tile const& tile, unsigned match_mask)
+{
+  return __popc(match_mask & ((1u << tile.thread_rank()) - 1));
+}
+
 /**
  * @brief Computes the output size of joining the probe table to the build table
  * by probing the hash map with the probe table and counting the number of matches.
  *
  * @tparam JoinKind The type of join to be performed
- * @tparam multimap_type The datatype of the hash table
+ * @tparam tile_size The number of threads cooperating on the probe of a row
  * @tparam block_size The number of threads per block for this kernel
  *
  * @param[in] multi_map The hash table built on the build table
@@ -97,15 +197,17 @@ __global__ void build_hash_table(multimap_type multi_map,
  * @param[in] probe_table The probe table
  * @param[in] hash_probe Row hasher for the probe table
  * @param[in] check_row_equality The row equality comparator
+ * @param[in] heavy The heavy keys of the build table, whose probe rows are skipped
  * @param[in] probe_table_num_rows The number of rows in the probe table
  * @param[out] output_size The resulting output size
  */
-template <join_kind JoinKind, typename multimap_type, int block_size>
-__global__ void compute_join_output_size(multimap_type multi_map,
+template <join_kind JoinKind, int tile_size, int block_size>
+__global__ void compute_join_output_size(multimap_type::device_view multi_map,
                                          table_device_view build_table,
                                          table_device_view probe_table,
                                          row_hash hash_probe,
                                          row_equality check_row_equality,
+                                         heavy_key_view heavy,
                                          const cudf::size_type probe_table_num_rows,
                                          size_type* output_size)
 {
@@ -115,62 +217,27 @@ __global__ void compute_join_output_size(multimap_type multi_map,
   // thread, this implementation improves performance by reducing atomic adds to the shared memory
   // counter.
 
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
   cudf::size_type thread_counter{0};
-  const cudf::size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
-  const cudf::size_type stride    = blockDim.x * gridDim.x;
-  const auto unused_key           = multi_map.get_unused_key();
-  const auto end                  = multi_map.end();
+  const cudf::size_type start_idx = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size;
+  const cudf::size_type stride    = (blockDim.x * gridDim.x) / tile_size;
 
   for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
        probe_row_index += stride) {
-    auto found = end;
-
-    // Search the hash map for the hash value of the probe row using the row's
-    // hash value to determine the location where to search for the row in the hash map
-    hash_value_type probe_row_hash_value{0};
-    // Search the hash map for the hash value of the probe row
-    probe_row_hash_value = hash_probe(probe_row_index);
-    found                = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    auto const probe_row_hash_value = tile_row_hash(tile, hash_probe, probe_row_index);
+    if (heavy.find(probe_row_hash_value) >= 0) { continue; }
+    auto const num_matches = for_each_probe_row_match(tile,
+                                                      multi_map,
+                                                      probe_row_hash_value,
+                                                      check_row_equality,
+                                                      probe_row_index,
+                                                      [](unsigned, bool, auto) {});
 
     // for left-joins we always need to add an output
-    bool running     = (JoinKind == join_kind::LEFT_JOIN) || (end != found);
-    bool found_match = false;
-
-    while (running) {
-      // TODO Simplify this logic...
-
-      // Left joins always have an entry in the output
-      if (JoinKind == join_kind::LEFT_JOIN && (end == found)) {
-        running = false;
-      }
-      // Stop searching after encountering an empty hash table entry
-      else if (unused_key == found->first) {
-        running = false;
-      }
-      // First check that the hash values of the two rows match
-      else if (found->first == probe_row_hash_value) {
-        // If the hash values are equal, check that the rows are equal
-        if (check_row_equality(probe_row_index, found->second)) {
-          // If the rows are equal, then we have found a true match
-          found_match = true;
-          ++thread_counter;
-        }
-        // Continue searching for matching rows until you hit an empty hash map entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
-      } else {
-        // Continue searching for matching rows until you hit an empty hash table entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
-      }
-
-      if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match)) { ++thread_counter; }
+    if (tile.thread_rank() == 0) {
+      thread_counter +=
+        (JoinKind == join_kind::LEFT_JOIN && num_matches == 0) ? 1 : num_matches;
     }
   }
 
@@ -182,6 +249,110 @@ __global__ void compute_join_output_size(multimap_type multi_map,
   if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
 }
 
+/**
+ * @brief Computes whether every probe row has at least one matching build row.
+ *
+ * The search of a probe row stops at the window of its first match, so probe rows with many
+ * duplicate keys on the build side cost no more than a single match, as for semi and anti joins
+ * only existence matters. The rows of a heavy key are compared `tile_size` at a time until the
+ * first match.
+ *
+ * @tparam tile_size The number of threads cooperating on the probe of a row
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] probe_table The probe table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality The row equality comparator
+ * @param[in] heavy The heavy keys of the build table
+ * @param[out] has_match Whether each probe row has a match
+ */
+template <int tile_size>
+__global__ void probe_rows_have_match(multimap_type::device_view multi_map,
+                                      table_device_view probe_table,
+                                      row_hash hash_probe,
+                                      row_equality check_row_equality,
+                                      heavy_key_view heavy,
+                                      bool* has_match)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  const cudf::size_type probe_table_num_rows = probe_table.num_rows();
+  const cudf::size_type stride               = (blockDim.x * gridDim.x) / tile_size;
+
+  for (cudf::size_type probe_row_index = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size;
+       probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    const hash_value_type probe_row_hash_value = tile_row_hash(tile, hash_probe, probe_row_index);
+    const cudf::size_type heavy_key            = heavy.find(probe_row_hash_value);
+    bool found{false};
+    if (heavy_key >= 0) {
+      for (auto i = heavy.offsets[heavy_key]; i < heavy.offsets[heavy_key + 1] && not found;
+           i += tile_size) {
+        auto const candidate = i + static_cast<cudf::size_type>(tile.thread_rank());
+        found                = tile.any(candidate < heavy.offsets[heavy_key + 1] &&
+                         check_row_equality(probe_row_index, heavy.build_rows[candidate]));
+      }
+    } else {
+      found = multi_map.probe(
+        tile, probe_row_hash_value, [&](bool occupied, hash_value_type key, size_t slot) {
+          return occupied && key == probe_row_hash_value &&
+                 check_row_equality(probe_row_index, multi_map.value(slot));
+        });
+    }
+    if (tile.thread_rank() == 0) { has_match[probe_row_index] = found; }
+  }
+}
+
+/**
+ * @brief Computes the number of output rows of every probe row when joining the probe table to the
+ * build table.
+ *
+ * @tparam JoinKind The type of join to be performed
+ * @tparam tile_size The number of threads cooperating on the probe of a row
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] build_table The build table
+ * @param[in] probe_table The probe table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality The row equality comparator
+ * @param[in] heavy The heavy keys of the build table, whose probe rows are skipped
+ * @param[out] row_sizes The number of output rows of each probe row
+ */
+template <join_kind JoinKind, int tile_size>
+__global__ void compute_join_output_row_sizes(multimap_type::device_view multi_map,
+                                              table_device_view build_table,
+                                              table_device_view probe_table,
+                                              row_hash hash_probe,
+                                              row_equality check_row_equality,
+                                              heavy_key_view heavy,
+                                              int64_t* row_sizes)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  const cudf::size_type probe_table_num_rows = probe_table.num_rows();
+  const cudf::size_type stride               = (blockDim.x * gridDim.x) / tile_size;
+
+  for (cudf::size_type probe_row_index = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size;
+       probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    auto const probe_row_hash_value = tile_row_hash(tile, hash_probe, probe_row_index);
+    if (heavy.find(probe_row_hash_value) >= 0) {
+      if (tile.thread_rank() == 0) { row_sizes[probe_row_index] = 0; }
+      continue;
+    }
+    auto const num_matches = for_each_probe_row_match(tile,
+                                                      multi_map,
+                                                      probe_row_hash_value,
+                                                      check_row_equality,
+                                                      probe_row_index,
+                                                      [](unsigned, bool, auto) {});
+    if (tile.thread_rank() == 0) {
+      row_sizes[probe_row_index] =
+        (JoinKind == join_kind::LEFT_JOIN && num_matches == 0) ? 1 : num_matches;
+    }
+  }
+}
+
 /**
  * @brief Computes the output size of joining the left table to the right table.
  *
@@ -264,152 +435,135 @@ __device__ void flush_output_cache(const unsigned int activemask,
  * between the probe and hash table and generate the output for the desired
  * Join operation.
  *
+ * Every probe row is looked up by a tile of `tile_size` threads, which reserves the output of
+ * all the matches of a window with a single atomic add.
+ *
  * @tparam JoinKind The type of join to be performed
- * @tparam multimap_type The type of the hash table
- * @tparam block_size The number of threads per block for this kernel
- * @tparam output_cache_size The side of the shared memory buffer to cache join output results
+ * @tparam tile_size The number of threads cooperating on the probe of a row
  *
  * @param[in] multi_map The hash table built from the build table
  * @param[in] build_table The build table
  * @param[in] probe_table The probe table
  * @param[in] hash_probe Row hasher for the probe table
  * @param[in] check_row_equality The row equality comparator
+ * @param[in] heavy The heavy keys of the build table, whose probe rows are skipped
  * @param[out] join_output_l The left result of the join operation
  * @param[out] join_output_r The right result of the join operation
  * @param[in,out] current_idx A global counter used by threads to coordinate writes to the global
  output
  * @param[in] max_size The maximum size of the output
  */
-template <join_kind JoinKind,
-          typename multimap_type,
-          cudf::size_type block_size,
-          cudf::size_type output_cache_size>
-__global__ void probe_hash_table(multimap_type multi_map,
+template <join_kind JoinKind, int tile_size>
+__global__ void probe_hash_table(multimap_type::device_view multi_map,
                                  table_device_view build_table,
                                  table_device_view probe_table,
                                  row_hash hash_probe,
                                  row_equality check_row_equality,
+                                 heavy_key_view heavy,
                                  size_type* join_output_l,
                                  size_type* join_output_r,
                                  cudf::size_type* current_idx,
                                  const cudf::size_type max_size)
 {
-  constexpr int num_warps = block_size / detail::warp_size;
-  __shared__ size_type current_idx_shared[num_warps];
-  __shared__ size_type join_shared_l[num_warps][output_cache_size];
-  __shared__ size_type join_shared_r[num_warps][output_cache_size];
-
-  const int warp_id                          = threadIdx.x / detail::warp_size;
-  const int lane_id                          = threadIdx.x % detail::warp_size;
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
   const cudf::size_type probe_table_num_rows = probe_table.num_rows();
+  const cudf::size_type stride               = (blockDim.x * gridDim.x) / tile_size;
 
-  if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
-
-  __syncwarp();
-
-  size_type probe_row_index = threadIdx.x + blockIdx.x * blockDim.x;
-
-  const unsigned int activemask = __ballot_sync(0xffffffff, probe_row_index < probe_table_num_rows);
-  if (probe_row_index < probe_table_num_rows) {
-    const auto unused_key = multi_map.get_unused_key();
-    const auto end        = multi_map.end();
-    auto found            = end;
-
-    // Search the hash map for the hash value of the probe row using the row's
-    // hash value to determine the location where to search for the row in the hash map
-
-    // Only probe the hash table if the probe row is valid
-    hash_value_type probe_row_hash_value{0};
-    // Search the hash map for the hash value of the probe row
-    probe_row_hash_value = hash_probe(probe_row_index);
-    found                = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
-
-    bool running = (JoinKind == join_kind::LEFT_JOIN) ||
-                   (end != found);  // for left-joins we always need to add an output
-    bool found_match = false;
-    while (__any_sync(activemask, running)) {
-      if (running) {
-        // TODO Simplify this logic...
-
-        // Left joins always have an entry in the output
-        if ((JoinKind == join_kind::LEFT_JOIN) && (end == found)) {
-          running = false;
-        }
-        // Stop searching after encountering an empty hash table entry
-        else if (unused_key == found->first) {
-          running = false;
-        }
-        // First check that the hash values of the two rows match
-        else if (found->first == probe_row_hash_value) {
-          // If the hash values are equal, check that the rows are equal
-          // TODO : REMOVE : if(row_equal{probe_table, build_table}(probe_row_index, found->second))
-          if (check_row_equality(probe_row_index, found->second)) {
-            // If the rows are equal, then we have found a true match
-            found_match = true;
-            add_pair_to_cache(probe_row_index,
-                              found->second,
-                              current_idx_shared,
-                              warp_id,
-                              join_shared_l[warp_id],
-                              join_shared_r[warp_id]);
-          }
-          // Continue searching for matching rows until you hit an empty hash map entry
-          ++found;
-          // If you hit the end of the hash map, wrap around to the beginning
-          if (end == found) found = multi_map.begin();
-          // Next entry is empty, stop searching
-          if (unused_key == found->first) running = false;
-        } else {
-          // Continue searching for matching rows until you hit an empty hash table entry
-          ++found;
-          // If you hit the end of the hash map, wrap around to the beginning
-          if (end == found) found = multi_map.begin();
-          // Next entry is empty, stop searching
-          if (unused_key == found->first) running = false;
-        }
-
-        // If performing a LEFT join and no match was found, insert a Null into the output
-        if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match)) {
-          add_pair_to_cache(probe_row_index,
-                            static_cast<size_type>(JoinNoneValue),
-                            current_idx_shared,
-                            warp_id,
-                            join_shared_l[warp_id],
-                            join_shared_r[warp_id]);
+  for (cudf::size_type probe_row_index = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size;
+       probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    auto const probe_row_hash_value = tile_row_hash(tile, hash_probe, probe_row_index);
+    if (heavy.find(probe_row_hash_value) >= 0) { continue; }
+    auto const num_matches = for_each_probe_row_match(
+      tile,
+      multi_map,
+      probe_row_hash_value,
+      check_row_equality,
+      probe_row_index,
+      [&](unsigned match_mask, bool is_match, cudf::size_type build_row) {
+        if (match_mask == 0) { return; }
+        cudf::size_type output_offset{0};
+        if (tile.thread_rank() == 0) { output_offset = atomicAdd(current_idx, __popc(match_mask)); }
+        output_offset = tile.shfl(output_offset, 0) + match_rank(tile, match_mask);
+        // Past the estimated size, only the counter grows, to size the next attempt
+        if (is_match && output_offset < max_size) {
+          join_output_l[output_offset] = probe_row_index;
+          join_output_r[output_offset] = build_row;
         }
-      }
+      });
 
-      __syncwarp(activemask);
-      // flush output cache if next iteration does not fit
-      if (current_idx_shared[warp_id] + detail::warp_size >= output_cache_size) {
-        flush_output_cache<num_warps, output_cache_size>(activemask,
-                                                         max_size,
-                                                         warp_id,
-                                                         lane_id,
-                                                         current_idx,
-                                                         current_idx_shared,
-                                                         join_shared_l,
-                                                         join_shared_r,
-                                                         join_output_l,
-                                                         join_output_r);
-        __syncwarp(activemask);
-        if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
-        __syncwarp(activemask);
+    // If performing a LEFT join and no match was found, insert a Null into the output
+    if ((JoinKind == join_kind::LEFT_JOIN) && (num_matches == 0) && (tile.thread_rank() == 0)) {
+      const cudf::size_type output_offset = atomicAdd(current_idx, cudf::size_type{1});
+      if (output_offset < max_size) {
+        join_output_l[output_offset] = probe_row_index;
+        join_output_r[output_offset] = static_cast<size_type>(JoinNoneValue);
       }
     }
+  }
+}
 
-    // final flush of output cache
-    if (current_idx_shared[warp_id] > 0) {
-      flush_output_cache<num_warps, output_cache_size>(activemask,
-                                                       max_size,
-                                                       warp_id,
-                                                       lane_id,
-                                                       current_idx,
-                                                       current_idx_shared,
-                                                       join_shared_l,
-                                                       join_shared_r,
-                                                       join_output_l,
-                                                       join_output_r);
+/**
+ * @brief Probes the hash map with the probe table and writes the output rows of every probe row
+ * at the offset computed by `compute_join_output_row_sizes`.
+ *
+ * Each tile writes a contiguous range of the output, so no atomics are needed, and the output
+ * arrays have the exact size of the join.
+ *
+ * @tparam JoinKind The type of join to be performed
+ * @tparam tile_size The number of threads cooperating on the probe of a row
+ *
+ * @param[in] multi_map The hash table built from the build table
+ * @param[in] build_table The build table
+ * @param[in] probe_table The probe table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality The row equality comparator
+ * @param[in] heavy The heavy keys of the build table, whose probe rows are skipped
+ * @param[in] row_offsets The exclusive scan of the output row counts of the probe rows
+ * @param[out] join_output_l The left result of the join operation
+ * @param[out] join_output_r The right result of the join operation
+ */
+template <join_kind JoinKind, int tile_size>
+__global__ void probe_hash_table_exact(multimap_type::device_view multi_map,
+                                       table_device_view build_table,
+                                       table_device_view probe_table,
+                                       row_hash hash_probe,
+                                       row_equality check_row_equality,
+                                       heavy_key_view heavy,
+                                       int64_t const* row_offsets,
+                                       size_type* join_output_l,
+                                       size_type* join_output_r)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  const cudf::size_type probe_table_num_rows = probe_table.num_rows();
+  const cudf::size_type stride               = (blockDim.x * gridDim.x) / tile_size;
+
+  for (cudf::size_type probe_row_index = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size;
+       probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    auto const probe_row_hash_value = tile_row_hash(tile, hash_probe, probe_row_index);
+    if (heavy.find(probe_row_hash_value) >= 0) { continue; }
+    auto output_index      = row_offsets[probe_row_index];
+    auto const num_matches = for_each_probe_row_match(
+      tile,
+      multi_map,
+      probe_row_hash_value,
+      check_row_equality,
+      probe_row_index,
+      [&](unsigned match_mask, bool is_match, cudf::size_type build_row) {
+        if (is_match) {
+          auto const thread_index     = output_index + match_rank(tile, match_mask);
+          join_output_l[thread_index] = probe_row_index;
+          join_output_r[thread_index] = build_row;
+        }
+        output_index += __popc(match_mask);
+      });
+
+    if ((JoinKind == join_kind::LEFT_JOIN) && (num_matches == 0) && (tile.thread_rank() == 0)) {
+      join_output_l[output_index] = probe_row_index;
+      join_output_r[output_index] = static_cast<size_type>(JoinNoneValue);
     }
   }
 }
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <join/hash_join.cuh>
+#include <join/join_common_utils.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the number of output rows of a left row given its range of equal right rows
+ */
+template <join_kind JoinKind>
+struct merge_join_row_size {
+  table_device_view left_keys;
+  size_type const* lower;
+  size_type const* upper;
+  bool skip_nulls;
+
+  __device__ size_type matches(size_type left_row_index) const
+  {
+    if (skip_nulls) {
+      for (auto const& col : left_keys) {
+        if (col.is_null(left_row_index)) { return 0; }
+      }
+    }
+    return upper[left_row_index] - lower[left_row_index];
+  }
+
+  __device__ int64_t operator()(size_type left_row_index) const
+  {
+    auto const num_matches = matches(left_row_index);
+    return (JoinKind == join_kind::LEFT_JOIN && num_matches == 0) ? 1 : num_matches;
+  }
+};
+
+/**
+ * @brief Writes the output indices of a left row at its offset
+ */
+template <join_kind JoinKind>
+struct merge_join_write_rows {
+  merge_join_row_size<JoinKind> row_size;
+  int64_t const* offsets;
+  size_type* left_indices;
+  size_type* right_indices;
+
+  __device__ void operator()(size_type left_row_index) const
+  {
+    auto const offset      = offsets[left_row_index];
+    auto const first       = row_size.lower[left_row_index];
+    auto const num_matches = row_size.matches(left_row_index);
+    if (JoinKind == join_kind::LEFT_JOIN && num_matches == 0) {
+      left_indices[offset]  = left_row_index;
+      right_indices[offset] = JoinNoneValue;
+    }
+    for (size_type i = 0; i < num_matches; ++i) {
+      left_indices[offset + i]  = left_row_index;
+      right_indices[offset + i] = first + i;
+    }
+  }
+};
+
+/**
+ * @brief Computes the output indices of joining two tables sorted on their keys
+ *
+ * The equal range of each left row in `right_keys` is found with `lower_bound`/`upper_bound`;
+ * the output lists the left rows in order, each followed by its range, so it is sorted as well.
+ */
+template <join_kind JoinKind>
+VectorPair merge_join_indices(table_view const& left_keys,
+                              table_view const& right_keys,
+                              std::vector<order_info> const& keys_order,
+                              null_equality compare_nulls,
+                              cudaStream_t stream)
+{
+  std::vector<order> column_order;
+  std::vector<null_order> null_precedence;
+  for (auto const& info : keys_order) {
+    column_order.push_back(info.ordering);
+    null_precedence.push_back(info.null_ordering);
+  }
+  auto const lower = detail::lower_bound(
+    right_keys, left_keys, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+  auto const upper = detail::upper_bound(
+    right_keys, left_keys, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+
+  auto left_keys_d = table_device_view::create(left_keys, stream);
+  merge_join_row_size<JoinKind> row_size{*left_keys_d,
+                                         lower->view().data<size_type>(),
+                                         upper->view().data<size_type>(),
+                                         compare_nulls == null_equality::UNEQUAL};
+
+  auto const num_left_rows = left_keys.num_rows();
+  rmm::device_vector<int64_t> offsets(num_left_rows + 1, 0);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_left_rows),
+                    offsets.begin(),
+                    row_size);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), offsets.begin(), offsets.end(), offsets.begin());
+  int64_t const join_size = offsets.back();
+  CUDF_EXPECTS(join_size < MAX_JOIN_SIZE, "Join output size is too big");
+
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_left_rows,
+                     merge_join_write_rows<JoinKind>{row_size,
+                                                     offsets.data().get(),
+                                                     left_indices.data().get(),
+                                                     right_indices.data().get()});
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+/**
+ * @brief Joins two tables sorted on their keys with a merge join
+ *
+ * @tparam JoinKind `INNER_JOIN` or `LEFT_JOIN`
+ */
+template <join_kind JoinKind>
+std::unique_ptr<table> merge_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  null_equality compare_nulls,
+  std::vector<order_info> const& keys_order,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(keys_order.size() == left_on.size(), "Mismatch in number of key orders");
+  CUDF_EXPECTS(std::all_of(columns_in_common.begin(),
+                           columns_in_common.end(),
+                           [&left_on, &right_on](auto pair) {
+                             size_t l = std::find(left_on.begin(), left_on.end(), pair.first) -
+                                        left_on.begin();
+                             size_t r = std::find(right_on.begin(), right_on.end(), pair.second) -
+                                        right_on.begin();
+                             return (l != left_on.size()) && (r != right_on.size()) && (l == r);
+                           }),
+               "Invalid values passed to columns_in_common");
+
+  if (is_trivial_join(left, right, left_on, right_on, JoinKind)) {
+    auto empty = get_empty_joined_table(
+      left, right, columns_in_common, cudf::hash_join::common_columns_output_side::PROBE);
+    return combine_table_pair(std::move(empty.first), std::move(empty.second));
+  }
+
+  auto const left_keys  = left.select(left_on);
+  auto const right_keys = right.select(right_on);
+  CUDF_EXPECTS(std::equal(std::cbegin(left_keys),
+                          std::cend(left_keys),
+                          std::cbegin(right_keys),
+                          std::cend(right_keys),
+                          [](const auto& l, const auto& r) { return l.type() == r.type(); }),
+               "Mismatch in joining column data types");
+
+  auto joined_indices =
+    merge_join_indices<JoinKind>(left_keys, right_keys, keys_order, compare_nulls, stream);
+  auto joined = construct_join_output_df<JoinKind>(
+    left,
+    right,
+    joined_indices,
+    columns_in_common,
+    cudf::hash_join::common_columns_output_side::PROBE,
+    mr,
+    stream);
+  return combine_table_pair(std::move(joined.first), std::move(joined.second));
+}
+
+bool all_keys_sorted(std::vector<order_info> const& keys_order)
+{
+  return !keys_order.empty() && std::all_of(keys_order.begin(), keys_order.end(), [](auto info) {
+    return info.is_sorted == sorted::YES;
+  });
+}
+
+}  // namespace
+}  // namespace detail
+
+std::unique_ptr<table> inner_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  null_equality compare_nulls,
+  std::vector<order_info> const& keys_order,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (!detail::all_keys_sorted(keys_order)) {
+    return inner_join(left, right, left_on, right_on, columns_in_common, compare_nulls, mr);
+  }
+  CUDF_FUNC_RANGE();
+  return detail::merge_join<detail::join_kind::INNER_JOIN>(
+    left, right, left_on, right_on, columns_in_common, compare_nulls, keys_order, mr);
+}
+
+std::unique_ptr<table> left_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  null_equality compare_nulls,
+  std::vector<order_info> const& keys_order,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (!detail::all_keys_sorted(keys_order)) {
+    return left_join(left, right, left_on, right_on, columns_in_common, compare_nulls, mr);
+  }
+  CUDF_FUNC_RANGE();
+  return detail::merge_join<detail::join_kind::LEFT_JOIN>(
+    left, right, left_on, right_on, columns_in_common, compare_nulls, keys_order, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/spillable_partition.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+// Hash table entries are (hash value, row index) pairs, at 50% occupancy
+constexpr size_t hash_table_bytes_per_row = 2 * (sizeof(uint32_t) + sizeof(size_type));
+
+/**
+ * @brief Returns the number of partitions for which the hash table of one partition of `right`
+ * fits in the L2 cache
+ */
+size_type default_num_partitions(table_view const& right)
+{
+  int device{-1};
+  CUDA_TRY(cudaGetDevice(&device));
+  int l2_size{0};
+  CUDA_TRY(cudaDeviceGetAttribute(&l2_size, cudaDevAttrL2CacheSize, device));
+  if (l2_size <= 0) { return 1; }
+
+  auto const hash_table_size = static_cast<size_t>(right.num_rows()) * hash_table_bytes_per_row;
+  auto const num_partitions  = (hash_table_size + l2_size - 1) / l2_size;
+  return static_cast<size_type>(std::min<size_t>(num_partitions, right.num_rows()));
+}
+
+/**
+ * @brief Partitions both tables and joins each pair of partitions with `join_fn`
+ *
+ * On a device allocation failure, the partitions that are not being joined are spilled to host
+ * memory and the failed step is retried once.
+ */
+template <typename JoinFn>
+std::unique_ptr<table> partitioned_join(table_view const& left,
+                                        table_view const& right,
+                                        std::vector<size_type> const& left_on,
+                                        std::vector<size_type> const& right_on,
+                                        size_type num_partitions,
+                                        JoinFn join_fn,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(num_partitions >= 0, "Number of partitions cannot be negative");
+
+  if (num_partitions == 0) { num_partitions = default_num_partitions(right); }
+  if (num_partitions <= 1 || left_on.empty() || left.num_rows() == 0 || right.num_rows() == 0) {
+    return join_fn(left, right, mr);
+  }
+  num_partitions = hash_table_partition_count(num_partitions);
+
+  std::vector<spillable_partition> right_partitions;
+  std::vector<spillable_partition> left_partitions;
+  auto spill_all = [&](size_t except) {
+    for (auto* partitions : {&right_partitions, &left_partitions}) {
+      for (size_t i = 0; i < partitions->size(); ++i) {
+        if (i != except) { (*partitions)[i].spill(stream); }
+      }
+    }
+  };
+  auto with_spilling = [&](size_t except, auto&& fn) {
+    try {
+      return fn();
+    } catch (std::bad_alloc const&) {
+      spill_all(except);
+      return fn();
+    }
+  };
+
+  constexpr size_t none = static_cast<size_t>(-1);
+  right_partitions = make_spillable_partitions(right, right_on, num_partitions, stream);
+  left_partitions  = with_spilling(
+    none, [&]() { return make_spillable_partitions(left, left_on, num_partitions, stream); });
+
+  // Intermediate results use the default resource; only the concatenated result uses `mr`
+  std::vector<std::unique_ptr<table>> results;
+  for (size_t i = 0; i < right_partitions.size(); ++i) {
+    results.push_back(with_spilling(i, [&]() {
+      return join_fn(left_partitions[i].view(stream),
+                     right_partitions[i].view(stream),
+                     rmm::mr::get_default_resource());
+    }));
+    left_partitions[i].release();
+    right_partitions[i].release();
+  }
+
+  std::vector<table_view> result_views;
+  for (auto const& result : results) { result_views.push_back(result->view()); }
+  return cudf::concatenate(result_views, mr);
+}
+
+}  // namespace
+}  // namespace detail
+
+std::unique_ptr<table> partitioned_inner_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join(
+    left,
+    right,
+    left_on,
+    right_on,
+    num_partitions,
+    [&](table_view const& l, table_view const& r, rmm::mr::device_memory_resource* join_mr) {
+      return cudf::inner_join(l, r, left_on, right_on, columns_in_common, compare_nulls, join_mr);
+    },
+    mr);
+}
+
+std::unique_ptr<table> partitioned_left_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join(
+    left,
+    right,
+    left_on,
+    right_on,
+    num_partitions,
+    [&](table_view const& l, table_view const& r, rmm::mr::device_memory_resource* join_mr) {
+      return cudf::left_join(l, r, left_on, right_on, columns_in_common, compare_nulls, join_mr);
+    },
+    mr);
+}
+
+std::unique_ptr<table> partitioned_full_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join(
+    left,
+    right,
+    left_on,
+    right_on,
+    num_partitions,
+    [&](table_view const& l, table_view const& r, rmm::mr::device_memory_resource* join_mr) {
+      return cudf::full_join(l, r, left_on, right_on, columns_in_common, compare_nulls, join_mr);
+    },
+    mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/contains.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+namespace {
+/**
+ * @brief Returns whether the sublist `i` has a valid element equal to `key`
+ */
+template <typename T>
+struct contains_key_fn {
+  column_device_view const d_elements;
+  size_type const* d_offsets;
+  T const key;
+
+  __device__ bool operator()(size_type i) const
+  {
+    for (auto j = d_offsets[i]; j < d_offsets[i + 1]; ++j) {
+      if (d_elements.is_valid(j) and equality_compare(d_elements.element<T>(j), key)) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+struct contains_dispatch {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return (is_fixed_width<T>() and not is_fixed_point<T>() and
+            not std::is_same<T, dictionary32>::value) or
+           std::is_same<T, string_view>::value;
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  void operator()(lists_column_view const& lists_column,
+                  scalar const& search_key,
+                  mutable_column_view output,
+                  cudaStream_t stream)
+  {
+    // The offsets of a sliced view index its rows, but the child column is not sliced
+    auto const d_elements = column_device_view::create(lists_column.child(), stream);
+    auto const key        = static_cast<scalar_type_t<T> const&>(search_key).value(stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(lists_column.size()),
+                      output.begin<bool>(),
+                      contains_key_fn<T>{*d_elements,
+                                         lists_column.offsets().data<size_type>() +
+                                           lists_column.offset(),
+                                         key});
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  void operator()(lists_column_view const&, scalar const&, mutable_column_view, cudaStream_t)
+  {
+    CUDF_FAIL("lists::contains only supports fixed-width and strings elements");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> contains(lists_column_view const& lists_column,
+                                 scalar const& search_key,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
+{
+  if (lists_column.size() == 0) { return make_empty_column(data_type{type_id::BOOL8}); }
+  auto const element_type = lists_column.child().type();
+  CUDF_EXPECTS(search_key.type() == element_type, "Type of search key does not match elements");
+
+  if (not search_key.is_valid(stream)) {
+    return make_fixed_width_column(data_type{type_id::BOOL8},
+                                   lists_column.size(),
+                                   mask_state::ALL_NULL,
+                                   stream,
+                                   mr);
+  }
+  auto result = make_fixed_width_column(data_type{type_id::BOOL8},
+                                        lists_column.size(),
+                                        copy_bitmask(lists_column.parent(), stream, mr),
+                                        lists_column.null_count(),
+                                        stream,
+                                        mr);
+  type_dispatcher(element_type,
+                  contains_dispatch{},
+                  lists_column,
+                  search_key,
+                  result->mutable_view(),
+                  stream);
+  return result;
+}
+
+}  // namespace detail
+
+/**
+ * @copydoc cudf::lists::contains
+ */
+std::unique_ptr<column> contains(lists_column_view const& lists_column,
+                                 scalar const& search_key,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains(lists_column, search_key, mr, 0);
+}
+
+}  // namespace lists
+}  // namespace cudf
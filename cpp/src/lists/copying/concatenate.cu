@@ -21,10 +21,14 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
-#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/copy.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <memory>
 
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+
 namespace cudf {
 namespace lists {
 namespace detail {
@@ -32,53 +36,50 @@ namespace detail {
 namespace {
 
 /**
- * @brief Merges the offsets child columns of multiple list columns into one.
+ * @brief The offsets of one input lists column of a concatenation
+ *
+ * Built on the host and uploaded at once for all the inputs, so that the offsets of every input
+ * are merged by a single transform.
+ */
+struct lists_partition {
+  size_type const* offsets;  // offset of the first list, past the parent offset
+  size_type size;
+};
+
+/**
+ * @brief Returns the range of the child rows spanned by a partition
+ */
+struct child_range_fn {
+  __device__ thrust::pair<size_type, size_type> operator()(lists_partition const& partition) const
+  {
+    if (partition.size == 0) { return thrust::make_pair(0, 0); }
+    return thrust::make_pair(partition.offsets[0], partition.offsets[partition.size]);
+  }
+};
+
+/**
+ * @brief Returns the merged offset of a row of the concatenated lists column
  *
  * Since offsets are all relative to the start of their respective column,
  * all offsets are shifted to account for the new starting position
- *
- * @param[in] columns               Vector of lists columns to concatenate
- * @param[in] total_list_count      Total number of lists contained in the columns
- * @param[in] stream                CUDA stream used for device memory operations
- * and kernel launches.
- * @param[in] mr                    Device memory resource used to allocate the
- * returned column's device memory.
  */
-std::unique_ptr<column> merge_offsets(std::vector<lists_column_view> const& columns,
-                                      size_type total_list_count,
-                                      cudaStream_t stream,
-                                      rmm::mr::device_memory_resource* mr)
-{
-  // outgoing offsets
-  auto merged_offsets = cudf::make_fixed_width_column(
-    data_type{type_id::INT32}, total_list_count + 1, mask_state::UNALLOCATED, stream, mr);
-  mutable_column_device_view d_merged_offsets(*merged_offsets, 0, 0);
+struct merge_offsets_fn {
+  lists_partition const* partitions;
+  size_t const* input_offsets;     // prefix sum of the sizes of the partitions
+  size_type const* child_offsets;  // prefix sum of the child rows spanned by the partitions
+  size_type num_partitions;
 
-  // merge offsets
-  // TODO : this could probably be done as a single gpu operation if done as a kernel.
-  size_type shift = 0;
-  size_type count = 0;
-  std::for_each(columns.begin(), columns.end(), [&](lists_column_view const& c) {
-    if (c.size() > 0) {
-      // handle sliced columns
-      int const local_shift =
-        shift -
-        (c.offset() > 0 ? cudf::detail::get_value<size_type>(c.offsets(), c.offset(), stream) : 0);
-      column_device_view offsets(c.offsets(), 0, 0);
-      thrust::transform(
-        rmm::exec_policy(stream)->on(stream),
-        offsets.begin<size_type>() + c.offset(),
-        offsets.begin<size_type>() + c.offset() + c.size() + 1,
-        d_merged_offsets.begin<size_type>() + count,
-        [local_shift] __device__(size_type offset) { return offset + local_shift; });
-
-      shift += c.get_sliced_child(stream).size();
-      count += c.size();
-    }
-  });
-
-  return merged_offsets;
-}
+  __device__ size_type operator()(size_type index) const
+  {
+    if (index == input_offsets[num_partitions]) { return child_offsets[num_partitions]; }
+    auto const offset_it =
+      thrust::upper_bound(thrust::seq, input_offsets, input_offsets + num_partitions, index) - 1;
+    size_type const partition_index = offset_it - input_offsets;
+    auto const& partition           = partitions[partition_index];
+    return partition.offsets[index - *offset_it] - partition.offsets[0] +
+           child_offsets[partition_index];
+  }
+};
 
 }  // namespace
 
@@ -91,28 +92,54 @@ std::unique_ptr<column> concatenate(
   cudaStream_t stream                 = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
 {
-  std::vector<lists_column_view> lists_columns;
-  lists_columns.reserve(columns.size());
-  std::transform(
-    columns.begin(), columns.end(), std::back_inserter(lists_columns), [](column_view const& c) {
-      return lists_column_view(c);
-    });
+  auto partitions    = thrust::host_vector<lists_partition>();
+  auto input_offsets = thrust::host_vector<size_t>(columns.size() + 1, 0);
+  partitions.reserve(columns.size());
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    lists_column_view const list(columns[i]);
+    auto const offsets =
+      list.size() > 0 ? list.offsets().data<size_type>() + list.offset() : nullptr;
+    partitions.push_back(lists_partition{offsets, list.size()});
+    input_offsets[i + 1] = input_offsets[i] + list.size();
+  }
+  auto const d_partitions    = rmm::device_vector<lists_partition>{partitions};
+  auto const d_input_offsets = rmm::device_vector<size_t>{input_offsets};
+  size_type total_list_count = input_offsets.back();
+
+  // fetch the child rows spanned by every input at once, to slice the children
+  auto d_child_ranges = rmm::device_vector<thrust::pair<size_type, size_type>>(columns.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    d_partitions.begin(),
+                    d_partitions.end(),
+                    d_child_ranges.begin(),
+                    child_range_fn{});
+  thrust::host_vector<thrust::pair<size_type, size_type>> const child_ranges(d_child_ranges);
 
   // concatenate children. also prep data needed for offset merging
   std::vector<column_view> children;
   children.reserve(columns.size());
-  size_type total_list_count = 0;
-  std::for_each(lists_columns.begin(),
-                lists_columns.end(),
-                [&total_list_count, &children, stream](lists_column_view const& l) {
-                  // count total # of lists
-                  total_list_count += l.size();
-                  children.push_back(l.get_sliced_child(stream));
-                });
+  auto child_offsets = thrust::host_vector<size_type>(columns.size() + 1, 0);
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    auto const& range    = child_ranges[i];
+    child_offsets[i + 1] = child_offsets[i] + (range.second - range.first);
+    if (columns[i].size() == 0) continue;  // empty column may not have children
+    children.push_back(
+      cudf::detail::slice(lists_column_view(columns[i]).child(), range.first, range.second));
+  }
   auto data = cudf::detail::concatenate(children, mr, stream);
 
   // merge offsets
-  auto offsets = merge_offsets(lists_columns, total_list_count, stream, mr);
+  auto const d_child_offsets = rmm::device_vector<size_type>{child_offsets};
+  auto offsets               = cudf::make_fixed_width_column(
+    data_type{type_id::INT32}, total_list_count + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(total_list_count + 1),
+                    offsets->mutable_view().begin<size_type>(),
+                    merge_offsets_fn{d_partitions.data().get(),
+                                     d_input_offsets.data().get(),
+                                     d_child_offsets.data().get(),
+                                     static_cast<size_type>(columns.size())});
 
   // if any of the input columns have nulls, construct the output mask
   bool const has_nulls =
@@ -13,8 +13,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <thrust/binary_search.h>
-#include <thrust/iterator/iterator_facade.h>
+#include <thrust/for_each.h>
+#include <thrust/scan.h>
+#include <thrust/uninitialized_fill.h>
 #include <cudf/detail/gather.cuh>
 #include <cudf/lists/detail/gather.cuh>
 
@@ -23,12 +24,11 @@ namespace lists {
 namespace detail {
 
 /**
- * @brief List gatherer function object.
+ * @brief Materializes the gather map for level N+1.
  *
- * The iterator needed for gathering at level N+1 needs to reference the offsets
- * from level N and the "base" offsets used from level N-1.  An example of
- * the gather map needed for level N+1 (see documentation for make_gather_data for
- * the full example)
+ * The gather map for level N+1 needs to reference the offsets from level N and
+ * the "base" offsets used from level N-1.  An example of the gather map needed
+ * for level N+1 (see documentation for make_gather_data for the full example)
  *
  * @code{.pseudo}
  * level N-1 offsets               : [0, 2, 5, 10], gather map[0, 2]
@@ -39,46 +39,55 @@ namespace detail {
  * desired output sequence for the level N+1 gather map
  * [0, 1, 5, 6, 7, 8, 9]
  *
- * The generation of this sequence in this functor works as follows
+ * The generation of this sequence works as follows
  *
- * step 1, generate row index sequence
+ * step 1, write the row index at the first element of each non-empty row
+ * [0, 0, 1, 0, 0, 0, 0]
+ * step 2, spread the row indices with a max-scan
  * [0, 0, 1, 1, 1, 1, 1]
- * step 2, generate row subindex sequence
- * [0, 1, 0, 1, 2, 3, 4]
- * step 3, add base offsets to get the final sequence
+ * step 3, add the row subindex to the base offsets to get the final sequence
  * [0, 1, 5, 6, 7, 8, 9]
  * @endcode
  *
+ * This takes linear time, where searching the offsets for the row of every
+ * element does not. The map is built once per level and shared by the null
+ * mask, the offsets of the next level and the child gather.
  */
-struct list_gatherer {
-  typedef size_type argument_type;
-  typedef size_type result_type;
-
-  size_t offset_count;
-  size_type const* base_offsets;
-  size_type const* offsets;
-
-  list_gatherer(gather_data const& gd)
-    : offset_count{gd.base_offsets.size()},
-      base_offsets{gd.base_offsets.data()},
-      offsets{gd.offsets->mutable_view().data<size_type>()}
-  {
-  }
-
-  __device__ result_type operator()(argument_type index)
-  {
-    // the "upper bound" of the span for a given offset is always offsets+1;
-    size_type const* upper_bound_start = offsets + 1;
-    // "step 1" from above
-    auto const bound =
-      thrust::upper_bound(thrust::seq, upper_bound_start, upper_bound_start + offset_count, index);
-    size_type offset_index = thrust::distance(upper_bound_start, bound);
-    // "step 2" from above
-    size_type offset_subindex = offset_index == 0 ? index : index - offsets[offset_index];
-    // "step 3" from above
-    return offset_subindex + base_offsets[offset_index];
-  }
-};
+rmm::device_uvector<size_type> make_child_gather_map(gather_data const& gd, cudaStream_t stream)
+{
+  rmm::device_uvector<size_type> gather_map(gd.gather_map_size, stream);
+  if (gd.gather_map_size == 0) { return gather_map; }
+
+  auto const num_rows     = static_cast<size_type>(gd.base_offsets.size());
+  auto const offsets      = gd.offsets->view().data<size_type>();
+  auto const base_offsets = gd.base_offsets.data();
+  auto const d_map        = gather_map.data();
+
+  // "step 1" from above
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream)->on(stream), gather_map.begin(), gather_map.end(), 0);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     [offsets, d_map] __device__(size_type row) {
+                       if (offsets[row] < offsets[row + 1]) { d_map[offsets[row]] = row; }
+                     });
+  // "step 2" from above
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         gather_map.begin(),
+                         gather_map.end(),
+                         gather_map.begin(),
+                         thrust::maximum<size_type>());
+  // "step 3" from above
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     gd.gather_map_size,
+                     [offsets, base_offsets, d_map] __device__(size_type index) {
+                       auto const row = d_map[index];
+                       d_map[index]   = base_offsets[row] + (index - offsets[row]);
+                     });
+  return gather_map;
+}
 
 /**
  * @copydoc cudf::lists::detail::gather_list_leaf
@@ -89,10 +98,10 @@ std::unique_ptr<column> gather_list_leaf(column_view const& column,
                                          cudaStream_t stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  // gather map iterator for this level (N)
-  auto gather_map_begin = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0), list_gatherer{gd});
-  size_type gather_map_size = gd.gather_map_size;
+  // gather map for this level (N)
+  auto const gather_map       = make_child_gather_map(gd, stream);
+  auto const gather_map_begin = gather_map.begin();
+  size_type gather_map_size   = gd.gather_map_size;
 
   // call the normal gather
   auto leaf_column =
@@ -138,14 +147,15 @@ std::unique_ptr<column> gather_list_nested(cudf::lists_column_view const& list,
                                            cudaStream_t stream,
                                            rmm::mr::device_memory_resource* mr)
 {
-  // gather map iterator for this level (N)
-  auto gather_map_begin = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0), list_gatherer{gd});
   size_type gather_map_size = gd.gather_map_size;
 
   // if the gather map is empty, return an empty column
   if (gather_map_size == 0) { return empty_like(list.parent()); }
 
+  // gather map for this level (N)
+  auto gather_map       = make_child_gather_map(gd, stream);
+  auto gather_map_begin = gather_map.begin();
+
   // gather the bitmask, if relevant
   rmm::device_buffer null_mask{0, stream, mr};
   size_type null_count = list.null_count();
@@ -165,6 +175,9 @@ std::unique_ptr<column> gather_list_nested(cudf::lists_column_view const& list,
   // base_offsets buffer.
   gather_data child_gd = make_gather_data<false>(
     list, gather_map_begin, gather_map_size, stream, mr, std::move(gd.base_offsets));
+  // the next level builds its own map from child_gd, so this one is not kept alive during the
+  // recursion
+  gather_map.release();
 
   // the nesting case.
   if (list.child().type() == cudf::data_type{type_id::LIST}) {
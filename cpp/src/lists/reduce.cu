@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/lists/reduce.hpp>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+std::unique_ptr<column> reduce_list_elements(lists_column_view const& lists_column,
+                                             std::unique_ptr<aggregation> const& agg,
+                                             data_type output_dtype,
+                                             null_policy null_handling,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  if (lists_column.size() == 0) { return make_empty_column(output_dtype); }
+  // The offsets of a sliced view index its rows, but the child column is not sliced
+  return reduction::segmented_reduce(lists_column.child(),
+                                     lists_column.offsets().data<size_type>() +
+                                       lists_column.offset(),
+                                     lists_column.size(),
+                                     agg,
+                                     output_dtype,
+                                     null_handling,
+                                     lists_column.null_mask(),
+                                     lists_column.offset(),
+                                     mr,
+                                     stream);
+}
+
+}  // namespace detail
+
+/**
+ * @copydoc cudf::lists::reduce_list_elements
+ */
+std::unique_ptr<column> reduce_list_elements(lists_column_view const& lists_column,
+                                             std::unique_ptr<aggregation> const& agg,
+                                             data_type output_dtype,
+                                             null_policy null_handling,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce_list_elements(lists_column, agg, output_dtype, null_handling, mr, 0);
+}
+
+}  // namespace lists
+}  // namespace cudf
@@ -14,19 +14,26 @@
  * limitations under the License.
  */
 #include <rmm/thrust_rmm_allocator.h>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/detail/merge.cuh>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
 #include <queue>
 #include <vector>
 
@@ -404,6 +411,93 @@ T top_and_pop(std::priority_queue<T>& q)
   return moved;
 }
 
+// merges of at least this many non-empty tables rank every row against all the tables at once
+constexpr std::size_t kway_merge_min_tables = 4;
+
+/**
+ * @brief Scatters every row of the concatenated sorted tables to its position in the merged order.
+ *
+ * The position of a row is its position in its own table plus, for every other table, the number
+ * of rows which precede it, found by a binary search. On ties the rows of the earlier tables
+ * come first.
+ */
+template <bool has_nulls>
+struct merge_rank_fn {
+  row_lexicographic_comparator<has_nulls> comp;
+  size_type const* offsets;  // first row of every table, and the number of rows
+  size_type num_tables;
+  size_type* gather_map;
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const source = static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, offsets, offsets + num_tables + 1, row) - offsets - 1);
+    auto position = row - offsets[source];
+    for (size_type other = 0; other < num_tables; ++other) {
+      if (other == source) { continue; }
+      auto const begin = thrust::make_counting_iterator<size_type>(offsets[other]);
+      auto const end   = thrust::make_counting_iterator<size_type>(offsets[other + 1]);
+      auto const bound = other < source ? thrust::upper_bound(thrust::seq, begin, end, row, comp)
+                                        : thrust::lower_bound(thrust::seq, begin, end, row, comp);
+      position += *bound - offsets[other];
+    }
+    gather_map[position] = row;
+  }
+};
+
+/**
+ * @brief Merges many sorted tables with a single gather of their concatenation.
+ *
+ * Merging the tables pairwise copies every row once per level of the merge tree, while here
+ * the rows are copied twice whatever the number of tables.
+ */
+table_ptr_type kway_merge(std::vector<table_view> const& tables,
+                          std::vector<cudf::size_type> const& key_cols,
+                          std::vector<cudf::order> const& column_order,
+                          std::vector<cudf::null_order> const& null_precedence,
+                          rmm::mr::device_memory_resource* mr,
+                          cudaStream_t stream)
+{
+  std::vector<size_type> offsets{0};
+  for (auto const& table : tables) { offsets.push_back(offsets.back() + table.num_rows()); }
+  auto const num_rows = offsets.back();
+
+  auto concatenated = detail::concatenate(tables, rmm::mr::get_default_resource(), stream);
+  auto const keys   = concatenated->view().select(key_cols);
+  auto d_keys       = table_device_view::create(keys, stream);
+
+  rmm::device_vector<size_type> d_offsets(offsets);
+  rmm::device_vector<cudf::order> d_column_order(column_order);
+  rmm::device_vector<cudf::null_order> d_null_precedence(null_precedence);
+  auto gather_map = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream);
+  auto const d_gather_map = gather_map->mutable_view().data<size_type>();
+  auto const num_tables   = static_cast<size_type>(tables.size());
+
+  if (has_nulls(keys)) {
+    auto const comp = row_lexicographic_comparator<true>(
+      *d_keys, *d_keys, d_column_order.data().get(), d_null_precedence.data().get());
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(num_rows),
+                     merge_rank_fn<true>{comp, d_offsets.data().get(), num_tables, d_gather_map});
+  } else {
+    auto const comp = row_lexicographic_comparator<false>(
+      *d_keys, *d_keys, d_column_order.data().get(), d_null_precedence.data().get());
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(num_rows),
+                     merge_rank_fn<false>{comp, d_offsets.data().get(), num_tables, d_gather_map});
+  }
+
+  return detail::gather(concatenated->view(),
+                        gather_map->view(),
+                        detail::out_of_bounds_policy::IGNORE,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        mr,
+                        stream);
+}
+
 }  // namespace
 
 table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
@@ -446,6 +540,15 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   // No inputs have rows, return a table with same columns as the first one
   if (merge_queue.empty()) { return empty_like(first_table); }
 
+  if (merge_queue.size() >= kway_merge_min_tables) {
+    std::vector<table_view> tables;
+    std::copy_if(tables_to_merge.begin(),
+                 tables_to_merge.end(),
+                 std::back_inserter(tables),
+                 [](auto const& table) { return table.num_rows() > 0; });
+    return kway_merge(tables, key_cols, column_order, null_precedence, mr, stream);
+  }
+
   // Pick the two smallest tables and merge them
   // Until there is only one table left in the queue
   while (merge_queue.size() > 1) {
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/multi_device.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/spillable_partition.hpp>
+#include <cudf/multi_device.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Makes the work submitted to `waiting` on `waiting_device` after the call wait for the
+ * work submitted to `stream` on `device` before the call
+ */
+void wait_for_stream(cudaStream_t waiting, int waiting_device, cudaStream_t stream, int device)
+{
+  cudaEvent_t event{};
+  {
+    device_guard guard(device);
+    CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    CUDA_TRY(cudaEventRecord(event, stream));
+  }
+  device_guard guard(waiting_device);
+  CUDA_TRY(cudaStreamWaitEvent(waiting, event, 0));
+  CUDA_TRY(cudaEventDestroy(event));
+}
+
+/**
+ * @brief Lets `device` access the memory of `peer` directly, e.g. over NVLink, if it can
+ */
+void enable_peer_access(int device, int peer)
+{
+  if (device == peer) { return; }
+  int can_access{0};
+  CUDA_TRY(cudaDeviceCanAccessPeer(&can_access, device, peer));
+  if (can_access == 0) { return; }
+  device_guard guard(device);
+  auto const status = cudaDeviceEnablePeerAccess(peer, 0);
+  if (status == cudaErrorPeerAccessAlreadyEnabled) {
+    cudaGetLastError();
+    return;
+  }
+  CUDA_TRY(status);
+}
+
+}  // namespace
+
+device_guard::device_guard(int device)
+{
+  CUDA_TRY(cudaGetDevice(&_previous));
+  if (device != _previous) { CUDA_TRY(cudaSetDevice(device)); }
+}
+
+device_guard::~device_guard() { cudaSetDevice(_previous); }
+
+rmm::mr::device_memory_resource* memory_resource_of(device_resources const& resources)
+{
+  if (resources.mr != nullptr) { return resources.mr; }
+  return rmm::mr::get_per_device_resource(rmm::cuda_device_id{resources.device});
+}
+
+device_partition copy_to_device(contiguous_split_result const& split,
+                                int source_device,
+                                cudaStream_t source_stream,
+                                device_resources const& target)
+{
+  auto const size = split.all_data ? split.all_data->size() : 0;
+  device_guard guard(target.device);
+  auto data =
+    std::make_unique<rmm::device_buffer>(size, target.stream, memory_resource_of(target));
+  if (size > 0) {
+    enable_peer_access(target.device, source_device);
+    wait_for_stream(target.stream, target.device, source_stream, source_device);
+    CUDA_TRY(cudaMemcpyPeerAsync(
+      data->data(), target.device, split.all_data->data(), source_device, size, target.stream));
+    wait_for_stream(source_stream, source_device, target.stream, target.device);
+  }
+
+  auto const old_base = size > 0 ? static_cast<uint8_t const*>(split.all_data->data()) : nullptr;
+  auto const new_base = static_cast<uint8_t const*>(data->data());
+  std::vector<column_view> columns;
+  for (auto const& col : split.table) {
+    columns.push_back(rebase_column(col, old_base, size, new_base));
+  }
+  return device_partition{table_view(columns), std::move(data)};
+}
+
+}  // namespace detail
+
+multi_device_table::multi_device_table(std::vector<device_resources> devices,
+                                       std::vector<std::unique_ptr<table>> parts)
+  : _devices(std::move(devices)), _parts(std::move(parts))
+{
+  CUDF_EXPECTS(_devices.size() == _parts.size(), "Mismatch in number of devices and parts");
+}
+
+size_type multi_device_table::num_rows() const
+{
+  return std::accumulate(_parts.begin(), _parts.end(), size_type{0}, [](auto sum, auto const& p) {
+    return sum + p->num_rows();
+  });
+}
+
+std::vector<table_view> multi_device_table::views() const
+{
+  std::vector<table_view> result;
+  for (auto const& p : _parts) { result.push_back(p->view()); }
+  return result;
+}
+
+std::unique_ptr<table> multi_device_table::combine(device_resources const& target) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(!_parts.empty(), "Cannot combine a table without parts");
+
+  // The parts are packed on their own devices, so that each is copied in one transfer
+  std::vector<detail::device_partition> copies;
+  for (size_type i = 0; i < num_parts(); ++i) {
+    auto const& source = _devices[i];
+    detail::device_guard guard(source.device);
+    auto const split = detail::contiguous_split(
+      _parts[i]->view(), {}, detail::memory_resource_of(source), source.stream);
+    copies.push_back(
+      detail::copy_to_device(split.front(), source.device, source.stream, target));
+  }
+
+  detail::device_guard guard(target.device);
+  std::vector<table_view> copy_views;
+  for (auto const& c : copies) { copy_views.push_back(c.view); }
+  // The copies are made on the stream of `target`, which the concatenation runs after
+  CUDA_TRY(cudaStreamSynchronize(target.stream));
+  return cudf::concatenate(copy_views, detail::memory_resource_of(target));
+}
+
+std::vector<std::unique_ptr<table>> multi_device_table::release()
+{
+  std::vector<std::unique_ptr<table>> parts;
+  parts.swap(_parts);
+  _devices.clear();
+  return parts;
+}
+
+}  // namespace cudf
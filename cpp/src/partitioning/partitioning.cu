@@ -17,26 +17,34 @@
 #include <cub/cub.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/hashing.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/launch_tuning.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/sequence.h>
 
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
-constexpr size_type OPTIMIZED_BLOCK_SIZE                     = 512;
-constexpr size_type OPTIMIZED_ROWS_PER_THREAD                = 8;
-constexpr size_type ELEMENTS_PER_THREAD                      = 2;
-constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
+constexpr size_type OPTIMIZED_BLOCK_SIZE      = 512;
+constexpr size_type OPTIMIZED_ROWS_PER_THREAD = 8;
+constexpr size_type ELEMENTS_PER_THREAD       = 2;
 
-// Launch configuration for fallback hash partition
-constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
-constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
+// Range of the number of partitions past which the rows are radix partitioned, the threshold is
+// tuned per device (see `tuned_parameter::HASH_PARTITION_MAX_SHARED_PARTITIONS`)
+constexpr size_type MIN_THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 256;
+constexpr size_type MAX_THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1536;
 
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
@@ -167,64 +175,6 @@ __global__ void compute_row_partition_numbers(row_hasher_t the_hasher,
   }
 }
 
-/* --------------------------------------------------------------------------*/
-/**
- * @brief  Given an array of partition numbers, computes the final output
- location for each element in the output such that all rows with the same
- partition are contiguous in memory.
- *
- * @param row_partition_numbers The array that records the partition number for
- each row
- * @param num_rows The number of rows
- * @param num_partitions THe number of partitions
- * @param[out] block_partition_offsets Array that holds the offset of each
- partition for each thread block,
- * i.e., { {block0 partition0 offset, block1 partition0 offset, ...},
-         {block0 partition1 offset, block1 partition1 offset, ...},
-         ...
-         {block0 partition(num_partitions-1) offset, block1
- partition(num_partitions -1) offset, ...} }
- */
-/* ----------------------------------------------------------------------------*/
-__global__ void compute_row_output_locations(size_type* __restrict__ row_partition_numbers,
-                                             const size_type num_rows,
-                                             const size_type num_partitions,
-                                             size_type* __restrict__ block_partition_offsets)
-{
-  // Shared array that holds the offset of this blocks partitions in
-  // global memory
-  extern __shared__ size_type shared_partition_offsets[];
-
-  // Initialize array of this blocks offsets from global array
-  size_type partition_number = threadIdx.x;
-  while (partition_number < num_partitions) {
-    shared_partition_offsets[partition_number] =
-      block_partition_offsets[partition_number * gridDim.x + blockIdx.x];
-    partition_number += blockDim.x;
-  }
-  __syncthreads();
-
-  size_type row_number = threadIdx.x + blockIdx.x * blockDim.x;
-
-  // Get each row's partition number, and get it's output location by
-  // incrementing block's offset counter for that partition number
-  // and store the row's output location in-place
-  while (row_number < num_rows) {
-    // Get partition number of this row
-    const size_type partition_number = row_partition_numbers[row_number];
-
-    // Get output location based on partition number by incrementing the
-    // corresponding partition offset for this block
-    const size_type row_output_location =
-      atomicAdd(&(shared_partition_offsets[partition_number]), size_type(1));
-
-    // Store the row's output location in-place
-    row_partition_numbers[row_number] = row_output_location;
-
-    row_number += blockDim.x * gridDim.x;
-  }
-}
-
 /* --------------------------------------------------------------------------*/
 /**
  * @brief Move one column from the input table to the hashed table.
@@ -446,6 +396,116 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
+/**
+ * @brief Computes the partition number of every row by hashing the row
+ */
+template <typename row_hasher_t, typename partitioner_type>
+void compute_partition_numbers(row_hasher_t hasher,
+                               partitioner_type partitioner,
+                               size_type num_rows,
+                               size_type* partition_numbers,
+                               cudaStream_t stream)
+{
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    partition_numbers,
+                    [hasher, partitioner] __device__(size_type row_number) {
+                      return partitioner(hasher(row_number));
+                    });
+}
+
+/**
+ * @brief Computes the rows of every partition, in partition order, by radix sorting the
+ * partition numbers of the rows.
+ *
+ * The partition numbers are sorted on their lowest `ceil(log2(num_partitions))` bits only, so
+ * 4096 partitions take two digit passes. Every pass counts its digits per block and scatters
+ * the rows of a block through shared memory, without global atomics, and the rows of a
+ * partition keep their input order. The returned gather map makes every column coalesced to
+ * write.
+ *
+ * NOTE hash_has_nulls must be true if table_to_hash has nulls
+ *
+ * @param[in] table_to_hash The columns to hash
+ * @param[in] num_partitions The number of partitions
+ * @param[out] gather_map The `table_to_hash.num_rows()` row indices of the rows in partition
+ * order
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return The offset of the first row of every partition in `gather_map`
+ */
+template <bool hash_has_nulls>
+std::vector<size_type> radix_partition_map(table_view const& table_to_hash,
+                                           size_type num_partitions,
+                                           size_type* gather_map,
+                                           cudaStream_t stream)
+{
+  auto const num_rows     = table_to_hash.num_rows();
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher       = row_hasher<MurmurHash3_32, hash_has_nulls>(*device_input);
+
+  rmm::device_vector<size_type> partition_numbers(num_rows);
+  if (is_power_two(num_partitions)) {
+    compute_partition_numbers(hasher,
+                              bitwise_partitioner<hash_value_type>(num_partitions),
+                              num_rows,
+                              partition_numbers.data().get(),
+                              stream);
+  } else {
+    compute_partition_numbers(hasher,
+                              modulo_partitioner<hash_value_type>(num_partitions),
+                              num_rows,
+                              partition_numbers.data().get(),
+                              stream);
+  }
+
+  int end_bit = 1;
+  while (end_bit < 31 && (size_type{1} << end_bit) < num_partitions) { ++end_bit; }
+
+  rmm::device_vector<size_type> row_numbers(num_rows);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), row_numbers.begin(), row_numbers.end());
+  rmm::device_vector<size_type> sorted_partition_numbers(num_rows);
+  std::size_t temp_storage_bytes{};
+  cub::DeviceRadixSort::SortPairs(nullptr,
+                                  temp_storage_bytes,
+                                  partition_numbers.data().get(),
+                                  sorted_partition_numbers.data().get(),
+                                  row_numbers.data().get(),
+                                  gather_map,
+                                  num_rows,
+                                  0,
+                                  end_bit,
+                                  stream);
+  rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+  cub::DeviceRadixSort::SortPairs(temp_storage.data(),
+                                  temp_storage_bytes,
+                                  partition_numbers.data().get(),
+                                  sorted_partition_numbers.data().get(),
+                                  row_numbers.data().get(),
+                                  gather_map,
+                                  num_rows,
+                                  0,
+                                  end_bit,
+                                  stream);
+
+  // The offset of a partition is the number of rows in the partitions before it
+  rmm::device_vector<size_type> offsets(num_partitions);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      sorted_partition_numbers.begin(),
+                      sorted_partition_numbers.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_partitions),
+                      offsets.begin());
+  std::vector<size_type> partition_offsets(num_partitions);
+  CUDA_TRY(cudaMemcpyAsync(partition_offsets.data(),
+                           offsets.data().get(),
+                           num_partitions * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return partition_offsets;
+}
+
 // NOTE hash_has_nulls must be true if table_to_hash has nulls
 template <bool hash_has_nulls>
 std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
@@ -457,11 +517,28 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
 {
   auto const num_rows = table_to_hash.num_rows();
 
-  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
-  auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
-  auto const rows_per_thread =
-    use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
-  auto const rows_per_block = block_size * rows_per_thread;
+  // Only partition counts between the smallest and the largest candidate thresholds take a path
+  // that depends on the threshold, so the others are not timed
+  auto const tuned_work_size =
+    num_partitions > MIN_THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL and
+        num_partitions <= MAX_THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL
+      ? num_rows
+      : 0;
+  detail::tuned_launch_scope launch(
+    detail::tuned_parameter::HASH_PARTITION_MAX_SHARED_PARTITIONS, tuned_work_size, stream);
+
+  // Past the shared memory histograms, the rows are radix partitioned and gathered
+  if (num_partitions > launch.value()) {
+    rmm::device_vector<size_type> gather_map(num_rows);
+    auto partition_offsets = radix_partition_map<hash_has_nulls>(
+      table_to_hash, num_partitions, gather_map.data().get(), stream);
+    auto output = detail::gather(input, gather_map.begin(), gather_map.end(), false, mr, stream);
+    return std::make_pair(std::move(output), std::move(partition_offsets));
+  }
+
+  auto const block_size      = OPTIMIZED_BLOCK_SIZE;
+  auto const rows_per_thread = OPTIMIZED_ROWS_PER_THREAD;
+  auto const rows_per_block  = block_size * rows_per_thread;
 
   // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
   auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
@@ -556,69 +633,287 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                            cudaMemcpyDeviceToHost,
                            stream));
 
-  // When the number of partitions is less than a threshold, we can apply an
-  // optimization using shared memory to copy values to the output buffer.
-  // Otherwise, fallback to using scatter.
-  if (use_optimization) {
-    std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
-
-    // NOTE these pointers are non-const to workaround lambda capture bug in
-    // gcc 5.4
-    auto row_partition_numbers_ptr{row_partition_numbers.data().get()};
-    auto row_partition_offset_ptr{row_partition_offset.data().get()};
-    auto block_partition_sizes_ptr{block_partition_sizes.data().get()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
-
-    // Copy input to output by partition per column
-    std::transform(input.begin(), input.end(), output_cols.begin(), [=](auto const& col) {
-      return cudf::type_dispatcher(col.type(),
-                                   copy_block_partitions_dispatcher{},
-                                   col,
-                                   num_partitions,
-                                   row_partition_numbers_ptr,
-                                   row_partition_offset_ptr,
-                                   block_partition_sizes_ptr,
-                                   scanned_block_partition_sizes_ptr,
-                                   grid_size,
-                                   mr,
-                                   stream);
-    });
-
-    if (has_nulls(input)) {
-      // Use copy_block_partitions to compute a gather map
-      auto gather_map = compute_gather_map(num_rows,
-                                           num_partitions,
-                                           row_partition_numbers_ptr,
-                                           row_partition_offset_ptr,
-                                           block_partition_sizes_ptr,
-                                           scanned_block_partition_sizes_ptr,
-                                           grid_size,
-                                           stream);
-
-      // Handle bitmask using gather to take advantage of ballot_sync
-      detail::gather_bitmask(
-        input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, mr, stream);
+  // Copy the values to the output buffer through shared memory, one partition per warp
+  std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
+
+  // NOTE these pointers are non-const to workaround lambda capture bug in
+  // gcc 5.4
+  auto row_partition_numbers_ptr{row_partition_numbers.data().get()};
+  auto row_partition_offset_ptr{row_partition_offset.data().get()};
+  auto block_partition_sizes_ptr{block_partition_sizes.data().get()};
+  auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
+
+  // Copy input to output by partition per column
+  std::transform(input.begin(), input.end(), output_cols.begin(), [=](auto const& col) {
+    return cudf::type_dispatcher(col.type(),
+                                 copy_block_partitions_dispatcher{},
+                                 col,
+                                 num_partitions,
+                                 row_partition_numbers_ptr,
+                                 row_partition_offset_ptr,
+                                 block_partition_sizes_ptr,
+                                 scanned_block_partition_sizes_ptr,
+                                 grid_size,
+                                 mr,
+                                 stream);
+  });
+
+  if (has_nulls(input)) {
+    // Use copy_block_partitions to compute a gather map
+    auto gather_map = compute_gather_map(num_rows,
+                                         num_partitions,
+                                         row_partition_numbers_ptr,
+                                         row_partition_offset_ptr,
+                                         block_partition_sizes_ptr,
+                                         scanned_block_partition_sizes_ptr,
+                                         grid_size,
+                                         stream);
+
+    // Handle bitmask using gather to take advantage of ballot_sync
+    detail::gather_bitmask(
+      input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, mr, stream);
+  }
+
+  auto output{std::make_unique<table>(std::move(output_cols))};
+  return std::make_pair(std::move(output), std::move(partition_offsets));
+}
+
+// Every packed buffer starts at this alignment, as in `contiguous_split`
+constexpr size_t pack_split_align = 64;
+
+constexpr int pack_block_size = 256;
+// rows gathered by one block of the pack kernel, a multiple of the warp size
+constexpr size_type pack_rows_per_block = pack_block_size * 8;
+
+/**
+ * @brief Describes the gather of one buffer of one column into the packed buffer of one
+ * partition by `pack_partitions_kernel`
+ */
+struct pack_descriptor {
+  void const* src;         // data of the column, or its null mask
+  void* dst;               // data or validity of the column in the packed buffer
+  size_type element_size;  // size of an element of the data, or 0 for the validity
+  size_type src_offset;    // offset of the column
+  size_type row_begin;     // first row of the partition in the gather map
+  size_type num_rows;      // number of rows of the partition
+};
+
+template <typename T>
+__device__ void pack_elements(pack_descriptor const& desc,
+                              size_type const* rows,
+                              size_type begin,
+                              size_type end)
+{
+  auto const src = static_cast<T const*>(desc.src) + desc.src_offset;
+  auto const dst = static_cast<T*>(desc.dst);
+  for (auto idx = begin + static_cast<size_type>(threadIdx.x); idx < end;
+       idx += pack_block_size) {
+    dst[idx] = src[rows[idx]];
+  }
+}
+
+/**
+ * @brief Builds the validity words of the range and returns the number of valid rows the thread
+ * wrote.
+ */
+__device__ size_type pack_validity(pack_descriptor const& desc,
+                                   size_type const* rows,
+                                   size_type begin,
+                                   size_type end)
+{
+  auto const src = static_cast<bitmask_type const*>(desc.src);
+  auto const dst = static_cast<bitmask_type*>(desc.dst);
+  // `begin` is a multiple of the warp size, so every warp builds whole words, and all its threads
+  // run the same number of iterations
+  auto const words_end = begin + (end - begin + warp_size - 1) / warp_size * warp_size;
+  size_type valid      = 0;
+  for (auto idx = begin + static_cast<size_type>(threadIdx.x); idx < words_end;
+       idx += pack_block_size) {
+    bool const is_valid = idx < end and bit_is_set(src, desc.src_offset + rows[idx]);
+    auto const word     = __ballot_sync(0xffffffff, is_valid);
+    if (threadIdx.x % warp_size == 0) {
+      dst[word_index(idx)] = word;
+      valid += __popc(word);
+    }
+  }
+  return valid;
+}
+
+/**
+ * @brief Gathers the rows of every partition into its packed buffer.
+ *
+ * Every descriptor is gathered by a range of blocks starting at `block_offsets[i]`, each of which
+ * gathers `pack_rows_per_block` rows of the descriptor. The number of valid rows of each
+ * validity descriptor is added to `valid_counts`.
+ *
+ * @param descriptors The buffers to gather
+ * @param num_descriptors Number of descriptors
+ * @param block_offsets First block of every descriptor
+ * @param gather_map The row indices of the input in partition order
+ * @param valid_counts Number of valid rows of every descriptor, initialized to 0
+ */
+__launch_bounds__(pack_block_size) __global__
+  void pack_partitions_kernel(pack_descriptor const* __restrict__ descriptors,
+                              size_type num_descriptors,
+                              size_type const* __restrict__ block_offsets,
+                              size_type const* __restrict__ gather_map,
+                              size_type* __restrict__ valid_counts)
+{
+  // the descriptor of this block is the last one starting at or before it
+  auto const desc_idx = thrust::upper_bound(thrust::seq,
+                                            block_offsets,
+                                            block_offsets + num_descriptors,
+                                            static_cast<size_type>(blockIdx.x)) -
+                        block_offsets - 1;
+  auto const desc  = descriptors[desc_idx];
+  auto const rows  = gather_map + desc.row_begin;
+  auto const begin = static_cast<size_type>(blockIdx.x - block_offsets[desc_idx]) *
+                     pack_rows_per_block;
+  auto const end   = thrust::min(begin + pack_rows_per_block, desc.num_rows);
+
+  // the element size is the same for the whole block
+  switch (desc.element_size) {
+    case 0: {
+      using BlockReduce = cub::BlockReduce<size_type, pack_block_size>;
+      __shared__ typename BlockReduce::TempStorage temp_storage;
+      size_type const block_valid =
+        BlockReduce(temp_storage).Sum(pack_validity(desc, rows, begin, end));
+      if (threadIdx.x == 0) { atomicAdd(&valid_counts[desc_idx], block_valid); }
+      break;
     }
+    case 1: pack_elements<int8_t>(desc, rows, begin, end); break;
+    case 2: pack_elements<int16_t>(desc, rows, begin, end); break;
+    case 4: pack_elements<int32_t>(desc, rows, begin, end); break;
+    case 8: pack_elements<int64_t>(desc, rows, begin, end); break;
+  }
+}
 
-    auto output{std::make_unique<table>(std::move(output_cols))};
-    return std::make_pair(std::move(output), std::move(partition_offsets));
-  } else {
-    // Compute a scatter map from input to output such that the output rows are
-    // sorted by partition number
-    auto row_output_locations{row_partition_numbers.data().get()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
-    compute_row_output_locations<<<grid_size,
-                                   block_size,
-                                   num_partitions * sizeof(size_type),
-                                   stream>>>(
-      row_output_locations, num_rows, num_partitions, scanned_block_partition_sizes_ptr);
-
-    // Use the resulting scatter map to materialize the output
-    auto output = detail::scatter(
-      input, row_partition_numbers.begin(), row_partition_numbers.end(), input, false, mr, stream);
+/**
+ * @brief Gathers the rows of every partition of the fixed-width columns of `input` into one
+ * packed buffer per partition, in the layout of `contiguous_split`.
+ *
+ * @param input The table to partition
+ * @param gather_map The row indices of `input` in partition order
+ * @param partition_offsets The offset of the first row of every partition in `gather_map`
+ * @param mr Device memory resource used to allocate the packed buffers
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The packed buffer and the view of every partition
+ */
+std::vector<contiguous_split_result> pack_partitions(
+  table_view const& input,
+  size_type const* gather_map,
+  std::vector<size_type> const& partition_offsets,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const num_partitions = partition_offsets.size();
+  auto const num_columns    = static_cast<size_t>(input.num_columns());
+  auto const partition_size = [&](size_t partition) {
+    auto const end = partition + 1 < num_partitions ? partition_offsets[partition + 1]
+                                                    : input.num_rows();
+    return end - partition_offsets[partition];
+  };
+
+  // the data and validity of every column of every partition, indexed by
+  // `partition * num_columns + column`
+  std::vector<std::pair<void*, bitmask_type*>> packed_buffers;
+  std::vector<size_type> validity_indices;
+  std::vector<std::unique_ptr<rmm::device_buffer>> buffers;
+  std::vector<pack_descriptor> descriptors;
+  for (size_t partition = 0; partition < num_partitions; ++partition) {
+    auto const rows = partition_size(partition);
+    std::vector<std::pair<size_t, size_t>> sizes;
+    size_t total = 0;
+    for (auto const& c : input) {
+      auto const data_size =
+        cudf::util::round_up_safe(rows * size_of(c.type()), pack_split_align);
+      auto const validity_size =
+        c.nullable() ? cudf::bitmask_allocation_size_bytes(rows, pack_split_align) : 0;
+      sizes.emplace_back(data_size, validity_size);
+      total += data_size + validity_size;
+    }
+    buffers.push_back(std::make_unique<rmm::device_buffer>(total, stream, mr));
+
+    auto dst = static_cast<char*>(buffers.back()->data());
+    for (size_t col = 0; col < num_columns; ++col) {
+      auto const& c       = input.column(col);
+      auto const validity = sizes[col].second == 0
+                              ? nullptr
+                              : reinterpret_cast<bitmask_type*>(dst + sizes[col].first);
+      auto validity_index = size_type{-1};
+      if (rows > 0) {
+        descriptors.push_back({c.head(),
+                               dst,
+                               static_cast<size_type>(size_of(c.type())),
+                               c.offset(),
+                               partition_offsets[partition],
+                               rows});
+        if (validity != nullptr) {
+          validity_index = static_cast<size_type>(descriptors.size());
+          descriptors.push_back(
+            {c.null_mask(), validity, 0, c.offset(), partition_offsets[partition], rows});
+        }
+      }
+      packed_buffers.emplace_back(dst, validity);
+      validity_indices.push_back(validity_index);
+      dst += sizes[col].first + sizes[col].second;
+    }
+  }
 
-    return std::make_pair(std::move(output), std::move(partition_offsets));
+  std::vector<size_type> valid_counts(descriptors.size());
+  if (not descriptors.empty()) {
+    std::vector<size_type> block_offsets;
+    block_offsets.reserve(descriptors.size());
+    size_type num_blocks = 0;
+    for (auto const& desc : descriptors) {
+      block_offsets.push_back(num_blocks);
+      num_blocks += util::div_rounding_up_safe(desc.num_rows, pack_rows_per_block);
+    }
+
+    rmm::device_buffer d_descriptors(
+      descriptors.data(), descriptors.size() * sizeof(pack_descriptor), stream);
+    rmm::device_buffer d_block_offsets(
+      block_offsets.data(), block_offsets.size() * sizeof(size_type), stream);
+    rmm::device_buffer d_valid_counts(valid_counts.size() * sizeof(size_type), stream);
+    CUDA_TRY(cudaMemsetAsync(d_valid_counts.data(), 0, d_valid_counts.size(), stream));
+
+    pack_partitions_kernel<<<num_blocks, pack_block_size, 0, stream>>>(
+      static_cast<pack_descriptor const*>(d_descriptors.data()),
+      static_cast<size_type>(descriptors.size()),
+      static_cast<size_type const*>(d_block_offsets.data()),
+      gather_map,
+      static_cast<size_type*>(d_valid_counts.data()));
+    CHECK_CUDA(stream);
+
+    CUDA_TRY(cudaMemcpyAsync(valid_counts.data(),
+                             d_valid_counts.data(),
+                             d_valid_counts.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+
+  std::vector<contiguous_split_result> result;
+  for (size_t partition = 0; partition < num_partitions; ++partition) {
+    auto const rows = partition_size(partition);
+    std::vector<column_view> out_cols;
+    out_cols.reserve(num_columns);
+    for (size_t col = 0; col < num_columns; ++col) {
+      auto const type           = input.column(col).type();
+      auto const idx            = partition * num_columns + col;
+      auto const validity_index = validity_indices[idx];
+      auto const null_count     = validity_index < 0 ? 0 : rows - valid_counts[validity_index];
+      auto const validity       = null_count > 0 ? packed_buffers[idx].second : nullptr;
+      if (rows == 0) {
+        out_cols.emplace_back(type, 0, nullptr);
+      } else {
+        out_cols.emplace_back(type, rows, packed_buffers[idx].first, validity, null_count);
+      }
+    }
+    result.push_back(
+      contiguous_split_result{cudf::table_view{out_cols}, std::move(buffers[partition])});
   }
+  return result;
 }
 
 struct dispatch_map_type {
@@ -746,6 +1041,67 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
 }
 }  // namespace local
 
+std::pair<std::unique_ptr<column>, std::vector<size_type>> hash_partition_map(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    return std::make_pair(make_empty_column(data_type{type_to_id<size_type>()}),
+                          std::vector<size_type>{});
+  }
+
+  auto gather_map = make_numeric_column(data_type{type_to_id<size_type>()},
+                                        input.num_rows(),
+                                        mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+  auto d_gather_map = gather_map->mutable_view().data<size_type>();
+  auto partition_offsets =
+    has_nulls(table_to_hash)
+      ? radix_partition_map<true>(table_to_hash, num_partitions, d_gather_map, stream)
+      : radix_partition_map<false>(table_to_hash, num_partitions, d_gather_map, stream);
+  return std::make_pair(std::move(gather_map), std::move(partition_offsets));
+}
+
+std::vector<contiguous_split_result> contiguous_hash_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    return {};
+  }
+
+  rmm::device_vector<size_type> gather_map(input.num_rows());
+  auto partition_offsets =
+    has_nulls(table_to_hash)
+      ? radix_partition_map<true>(table_to_hash, num_partitions, gather_map.data().get(), stream)
+      : radix_partition_map<false>(table_to_hash, num_partitions, gather_map.data().get(), stream);
+
+  if (std::all_of(input.begin(), input.end(), [](column_view const& c) {
+        return is_fixed_width(c.type());
+      })) {
+    return pack_partitions(input, gather_map.data().get(), partition_offsets, mr, stream);
+  }
+
+  // the size of every partition of a strings column is only known once its rows are gathered
+  auto const partitioned = detail::gather(
+    input, gather_map.begin(), gather_map.end(), false, rmm::mr::get_default_resource(), stream);
+  std::vector<size_type> const splits(partition_offsets.begin() + 1, partition_offsets.end());
+  return detail::contiguous_split(partitioned->view(), splits, mr, stream);
+}
+
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
   column_view const& partition_map,
@@ -777,6 +1133,28 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   return detail::local::hash_partition(input, columns_to_hash, num_partitions, mr);
 }
 
+// Partition map based on hash values
+std::pair<std::unique_ptr<column>, std::vector<size_type>> hash_partition_map(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition_map(input, columns_to_hash, num_partitions, mr);
+}
+
+// Partition based on hash values into packed buffers
+std::vector<contiguous_split_result> contiguous_hash_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contiguous_hash_partition(input, columns_to_hash, num_partitions, mr, 0);
+}
+
 // Partition based on an explicit partition map
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
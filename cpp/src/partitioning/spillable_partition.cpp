@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/spillable_partition.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace detail {
+column_view rebase_column(column_view const& col,
+                          uint8_t const* old_base,
+                          size_t size,
+                          uint8_t const* new_base)
+{
+  auto rebase = [&](void const* ptr) -> void const* {
+    auto const address = static_cast<uint8_t const*>(ptr);
+    if (address < old_base || address >= old_base + size) { return ptr; }
+    return new_base + (address - old_base);
+  };
+
+  std::vector<column_view> children;
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    children.push_back(rebase_column(col.child(i), old_base, size, new_base));
+  }
+  return column_view(col.type(),
+                     col.size(),
+                     rebase(col.head()),
+                     static_cast<bitmask_type const*>(rebase(col.null_mask())),
+                     col.null_count(),
+                     col.offset(),
+                     children);
+}
+
+spillable_partition::spillable_partition(contiguous_split_result&& split,
+                                         rmm::mr::device_memory_resource* mr)
+  : _view(split.table), _data(std::move(split.all_data)), _mr(mr)
+{
+}
+
+table_view spillable_partition::view(cudaStream_t stream)
+{
+  if (is_spilled()) {
+    auto const old_base = static_cast<uint8_t const*>(_spilled_base);
+    _data               = std::make_unique<rmm::device_buffer>(_host_size, stream, _mr);
+    CUDA_TRY(
+      cudaMemcpyAsync(_data->data(), _host_data.get(), _host_size, cudaMemcpyHostToDevice, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    std::vector<column_view> columns;
+    for (auto const& col : _view) {
+      columns.push_back(
+        rebase_column(col, old_base, _host_size, static_cast<uint8_t const*>(_data->data())));
+    }
+    _view = table_view(columns);
+    _host_data.reset();
+    _host_size = 0;
+  }
+  return _view;
+}
+
+void spillable_partition::spill(cudaStream_t stream)
+{
+  if (is_spilled() || _data == nullptr || _data->size() == 0) { return; }
+  void* host_data{nullptr};
+  CUDA_TRY(cudaMallocHost(&host_data, _data->size()));
+  _host_data.reset(static_cast<uint8_t*>(host_data));
+  _host_size = _data->size();
+  CUDA_TRY(
+    cudaMemcpyAsync(_host_data.get(), _data->data(), _host_size, cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  _spilled_base = _data->data();
+  _data.reset();
+}
+
+void spillable_partition::release()
+{
+  _data.reset();
+  _host_data.reset();
+  _host_size = 0;
+}
+
+std::vector<spillable_partition> make_spillable_partitions(table_view const& input,
+                                                           std::vector<size_type> const& on,
+                                                           size_type num_partitions,
+                                                           cudaStream_t stream)
+{
+  auto partitioned =
+    hash_partition(input, on, num_partitions, rmm::mr::get_default_resource(), stream);
+  // The first offset is always zero, the rest are the starts of the partitions
+  std::vector<size_type> splits(partitioned.second.begin() + 1, partitioned.second.end());
+  auto split_results = contiguous_split(
+    partitioned.first->view(), splits, rmm::mr::get_default_resource(), stream);
+
+  std::vector<spillable_partition> partitions;
+  partitions.reserve(split_results.size());
+  for (auto& result : split_results) { partitions.emplace_back(std::move(result)); }
+  return partitions;
+}
+
+spillable_partition make_spillable_partition(table_view const& input,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  auto split_results = contiguous_split(input, {}, mr, stream);
+  return spillable_partition(std::move(split_results.front()), mr);
+}
+
+size_type hash_table_partition_count(size_type n)
+{
+  auto is_prime = [](size_type k) {
+    if (k < 2) { return false; }
+    for (size_type d = 2; d * d <= k; ++d) {
+      if (k % d == 0) { return false; }
+    }
+    return true;
+  };
+  while (!is_prime(n)) { ++n; }
+  return n;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <sort/radix_sort.cuh>
+
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -23,11 +26,96 @@
 #include <cudf/utilities/error.hpp>
 #include <quantiles/quantiles_util.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 namespace cudf {
 namespace detail {
+namespace {
+// Largest number of quantiles selected from an unsorted column rather than sorting it. Every
+// selection costs a few passes over the column, one per byte of its elements.
+constexpr std::size_t max_selected_quantiles = 8;
+
+/**
+ * @brief Returns the row at every position of the stable sorted order of a radix sortable
+ * column, without sorting the column.
+ *
+ * The key at a position among the valid elements is found by radix select. Since the stable
+ * sort keeps equal keys in row order, the row at the position is the one of the rows with that
+ * key whose rank among them is the number of positions before it with the same key. Nulls are
+ * likewise taken in row order.
+ */
+rmm::device_vector<size_type> select_sorted_rows(column_view const& input,
+                                                 std::vector<size_type> const& positions,
+                                                 order column_order,
+                                                 null_order null_precedence,
+                                                 cudaStream_t stream)
+{
+  auto column_ptr          = column_device_view::create(input, stream);
+  auto d_column            = *column_ptr;
+  auto const ascending     = column_order == order::ASCENDING;
+  auto const nulls_first   = (null_precedence == null_order::BEFORE) == ascending;
+  auto const null_count    = input.null_count();
+  auto const valid_count   = input.size() - null_count;
+  auto const first_valid   = nulls_first ? null_count : 0;
+  auto const keys          = radix::radix_keys(d_column, ascending, stream);
+  auto const d_keys        = keys.first.data().get();
+  auto const is_null_row   = [d_column] __device__(size_type idx) { return d_column.is_null(idx); };
+  auto const rows_begin    = thrust::make_counting_iterator<size_type>(0);
+  auto const rows_end      = thrust::make_counting_iterator<size_type>(input.size());
+
+  rmm::device_vector<size_type> null_rows;
+  if (null_count > 0) {
+    null_rows.resize(null_count);
+    thrust::copy_if(
+      rmm::exec_policy(stream)->on(stream), rows_begin, rows_end, null_rows.begin(), is_null_row);
+  }
+
+  rmm::device_vector<size_type> rows(positions.size());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    auto const valid_position = positions[i] - first_valid;
+    if (valid_position < 0 or valid_position >= valid_count) {
+      auto const null_position = valid_position < 0 ? positions[i] : valid_position - valid_count;
+      thrust::copy_n(rmm::exec_policy(stream)->on(stream),
+                     null_rows.begin() + null_position,
+                     1,
+                     rows.begin() + i);
+      continue;
+    }
+
+    auto const key =
+      radix::radix_select(d_column, keys.first, keys.second, valid_position + 1, stream);
+    auto const num_less = thrust::count_if(
+      rmm::exec_policy(stream)->on(stream),
+      rows_begin,
+      rows_end,
+      [d_column, d_keys, key] __device__(size_type idx) {
+        return d_column.is_valid(idx) and d_keys[idx] < key;
+      });
+    auto const has_key = [d_column, d_keys, key] __device__(size_type idx) {
+      return d_column.is_valid(idx) and d_keys[idx] == key;
+    };
+    rmm::device_vector<size_type> key_rows(
+      thrust::count_if(rmm::exec_policy(stream)->on(stream), rows_begin, rows_end, has_key));
+    thrust::copy_if(
+      rmm::exec_policy(stream)->on(stream), rows_begin, rows_end, key_rows.begin(), has_key);
+    thrust::copy_n(rmm::exec_policy(stream)->on(stream),
+                   key_rows.begin() + (valid_position - num_less),
+                   1,
+                   rows.begin() + i);
+  }
+  return rows;
+}
+
+}  // namespace
+
 template <typename SortMapIterator>
 std::unique_ptr<table> quantiles(table_view const& input,
                                  SortMapIterator sortmap,
@@ -66,6 +154,26 @@ std::unique_ptr<table> quantiles(table_view const& input,
 
   CUDF_EXPECTS(input.num_rows() > 0, "multi-column quantiles require at least one input row.");
 
+  auto const is_selectable = input.num_columns() == 1 and q.size() <= max_selected_quantiles and
+                             column_order.size() <= 1 and null_precedence.size() <= 1 and
+                             cudf::detail::is_radix_sortable(input);
+  if (is_input_sorted == sorted::NO and is_selectable) {
+    // the row of every quantile is selected at its position of the sorted order
+    std::vector<size_type> positions(q.size());
+    std::transform(q.begin(), q.end(), positions.begin(), [&](double quantile) {
+      auto const position = [](size_type idx) { return idx; };
+      return detail::select_quantile<size_type>(position, input.num_rows(), quantile, interp);
+    });
+    auto const rows =
+      detail::select_sorted_rows(input.column(0),
+                                 positions,
+                                 column_order.empty() ? order::ASCENDING : column_order.front(),
+                                 null_precedence.empty() ? null_order::BEFORE
+                                                         : null_precedence.front(),
+                                 0);
+    return detail::gather(input, rows.begin(), rows.end(), false, mr);
+  }
+
   if (is_input_sorted == sorted::YES) {
     return detail::quantiles(input, thrust::make_counting_iterator<size_type>(0), q, interp, mr);
   } else {
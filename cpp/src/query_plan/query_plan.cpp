@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/join.hpp>
+#include <cudf/query_plan.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <numeric>
+
+namespace cudf {
+
+struct query_plan::node {
+  enum class kind { SCAN, FILTER, PROJECT, GATHER, INNER_JOIN, REDUCE };
+
+  kind op;
+  std::vector<node_id> inputs;
+  size_type num_columns = 0;                           // of the table, 0 for a reduction
+  table_view table;                                    // SCAN
+  ast::expression const* predicate = nullptr;          // FILTER
+  std::vector<size_type> predicate_columns;            // FILTER
+  std::vector<size_type> columns;                      // PROJECT, left keys of a join, REDUCE
+  std::vector<size_type> right_columns;                // right keys of INNER_JOIN
+  column_view gather_map;                              // GATHER
+  null_equality compare_nulls = null_equality::EQUAL;  // INNER_JOIN
+  std::unique_ptr<aggregation> agg;                    // REDUCE
+  data_type output_dtype{type_id::EMPTY};              // REDUCE
+
+  explicit node(kind op) : op(op) {}
+};
+
+namespace {
+/**
+ * @brief A column whose rows are selected lazily.
+ *
+ * The column is `base` gathered by `rows`, or `base` itself when `rows` is null.
+ */
+struct lazy_column {
+  column_view base;
+  std::shared_ptr<column const> owner;  // keeps `base` alive when the plan computed it
+  std::shared_ptr<column const> rows;
+};
+
+/**
+ * @brief The table of an evaluated node.
+ *
+ * Columns selected by the same operations share their `rows`, so that composing or gathering
+ * the row maps is done once for all of them.
+ */
+struct lazy_table {
+  size_type num_rows = 0;
+  std::vector<lazy_column> columns;
+};
+
+using row_map = std::shared_ptr<column const>;
+
+/**
+ * @brief Gathers `rows[i]` of `map`, i.e. the row map selecting `rows` of the rows of `map`.
+ */
+row_map compose(row_map const& map, row_map const& rows)
+{
+  if (map == nullptr) { return rows; }
+  return row_map{std::move(cudf::gather(table_view{{*map}}, *rows)->release().front())};
+}
+
+/**
+ * @brief Selects `rows` of every column of `input`, composing each distinct row map once.
+ */
+std::unique_ptr<lazy_table> select_rows(lazy_table const& input, row_map const& rows)
+{
+  auto result      = std::make_unique<lazy_table>();
+  result->num_rows = rows->size();
+  std::map<column const*, row_map> composed;
+  for (auto const& col : input.columns) {
+    auto it = composed.find(col.rows.get());
+    if (it == composed.end()) {
+      it = composed.emplace(col.rows.get(), compose(col.rows, rows)).first;
+    }
+    result->columns.push_back({col.base, col.owner, it->second});
+  }
+  return result;
+}
+
+/**
+ * @brief Gathers the columns `indices` of `input`, with one gather per distinct row map.
+ *
+ * Columns without a row map are copied.
+ *
+ * @return The gathered columns, in the order of `indices`
+ */
+std::vector<std::unique_ptr<column>> gather_columns(lazy_table const& input,
+                                                    std::vector<size_type> const& indices,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<column>> result(indices.size());
+  std::map<column const*, std::vector<size_t>> groups;
+  for (size_t i = 0; i < indices.size(); ++i) {
+    auto const& col = input.columns[indices[i]];
+    if (col.rows == nullptr) {
+      result[i] = std::make_unique<column>(col.base, 0, mr);
+    } else {
+      groups[col.rows.get()].push_back(i);
+    }
+  }
+  for (auto const& group : groups) {
+    std::vector<column_view> sources;
+    for (auto i : group.second) { sources.push_back(input.columns[indices[i]].base); }
+    auto gathered = cudf::gather(table_view{sources}, *group.first, false, mr)->release();
+    for (size_t g = 0; g < group.second.size(); ++g) {
+      result[group.second[g]] = std::move(gathered[g]);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Gathers the columns `indices` of `input` which have a row map, and replaces them by
+ * the gathered columns, so that every later reader of `input` uses them.
+ */
+void materialize(lazy_table& input, std::vector<size_type> const& indices)
+{
+  std::vector<size_type> mapped;
+  std::copy_if(indices.begin(), indices.end(), std::back_inserter(mapped), [&](size_type i) {
+    return input.columns[i].rows != nullptr;
+  });
+  std::sort(mapped.begin(), mapped.end());
+  mapped.erase(std::unique(mapped.begin(), mapped.end()), mapped.end());
+  auto gathered = gather_columns(input, mapped, rmm::mr::get_default_resource());
+  for (size_t i = 0; i < mapped.size(); ++i) {
+    std::shared_ptr<column const> owner{std::move(gathered[i])};
+    input.columns[mapped[i]] = {owner->view(), owner, nullptr};
+  }
+}
+
+std::unique_ptr<lazy_table> scan_table(table_view const& input)
+{
+  auto result      = std::make_unique<lazy_table>();
+  result->num_rows = input.num_rows();
+  for (auto const& col : input) { result->columns.push_back({col, nullptr, nullptr}); }
+  return result;
+}
+
+std::unique_ptr<lazy_table> filter_rows(lazy_table& input,
+                                        ast::expression const& predicate,
+                                        std::vector<size_type> const& predicate_columns)
+{
+  materialize(input, predicate_columns);
+  auto const positions =
+    cudf::sequence(input.num_rows, numeric_scalar<size_type>(0), numeric_scalar<size_type>(1));
+  // The columns the predicate does not read are replaced by any column of the right size
+  std::vector<column_view> columns(input.columns.size(), positions->view());
+  for (auto i : predicate_columns) { columns[i] = input.columns[i].base; }
+  auto const keep = ast::compute_column(table_view{columns}, predicate);
+  auto kept       = cudf::apply_boolean_mask(table_view{{positions->view()}}, keep->view());
+  return select_rows(input, row_map{std::move(kept->release().front())});
+}
+
+std::unique_ptr<lazy_table> project_columns(lazy_table const& input,
+                                            std::vector<size_type> const& indices)
+{
+  auto result      = std::make_unique<lazy_table>();
+  result->num_rows = input.num_rows;
+  for (auto i : indices) { result->columns.push_back(input.columns[i]); }
+  return result;
+}
+
+std::unique_ptr<lazy_table> join_rows(lazy_table& left,
+                                      lazy_table& right,
+                                      std::vector<size_type> const& left_on,
+                                      std::vector<size_type> const& right_on,
+                                      null_equality compare_nulls)
+{
+  materialize(left, left_on);
+  materialize(right, right_on);
+  std::vector<column_view> left_keys, right_keys;
+  for (auto i : left_on) { left_keys.push_back(left.columns[i].base); }
+  for (auto i : right_on) { right_keys.push_back(right.columns[i].base); }
+  std::vector<size_type> keys(left_on.size());
+  std::iota(keys.begin(), keys.end(), 0);
+  auto indices = cudf::inner_join_indices(
+    table_view{left_keys}, table_view{right_keys}, keys, keys, compare_nulls);
+
+  auto result        = select_rows(left, row_map{std::move(indices.first)});
+  auto right_columns = select_rows(right, row_map{std::move(indices.second)});
+  std::move(right_columns->columns.begin(),
+            right_columns->columns.end(),
+            std::back_inserter(result->columns));
+  return result;
+}
+
+std::unique_ptr<table> to_table(lazy_table const& input, rmm::mr::device_memory_resource* mr)
+{
+  std::vector<size_type> indices(input.columns.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  return std::make_unique<table>(gather_columns(input, indices, mr));
+}
+
+/**
+ * @brief Collects the columns referred to by an expression.
+ */
+void referenced_columns(ast::expression const& expr, std::vector<size_type>& columns)
+{
+  if (auto const ref = dynamic_cast<ast::column_reference const*>(&expr)) {
+    CUDF_EXPECTS(ref->table() == ast::table_reference::LEFT,
+                 "A filter predicate cannot refer to the right table");
+    columns.push_back(ref->column_index());
+  } else if (auto const op = dynamic_cast<ast::operation const*>(&expr)) {
+    for (auto const& operand : op->operands()) { referenced_columns(operand.get(), columns); }
+  }
+}
+
+void check_columns(std::vector<size_type> const& columns, size_type num_columns)
+{
+  CUDF_EXPECTS(std::all_of(columns.begin(),
+                           columns.end(),
+                           [num_columns](size_type i) { return i >= 0 and i < num_columns; }),
+               "Column index out of range");
+}
+
+}  // namespace
+
+query_plan::query_plan()  = default;
+query_plan::~query_plan() = default;
+
+query_plan::node const& query_plan::table_node(node_id id) const
+{
+  CUDF_EXPECTS(id >= 0 and id < static_cast<node_id>(nodes.size()), "Invalid plan node");
+  CUDF_EXPECTS(nodes[id]->op != node::kind::REDUCE, "A reduction cannot be the input of a node");
+  return *nodes[id];
+}
+
+query_plan::node_id query_plan::add(std::unique_ptr<node> n)
+{
+  nodes.push_back(std::move(n));
+  return static_cast<node_id>(nodes.size()) - 1;
+}
+
+query_plan::node_id query_plan::scan(table_view const& input)
+{
+  auto n         = std::make_unique<node>(node::kind::SCAN);
+  n->num_columns = input.num_columns();
+  n->table       = input;
+  return add(std::move(n));
+}
+
+query_plan::node_id query_plan::filter(node_id input, ast::expression const& predicate)
+{
+  auto const num_columns = table_node(input).num_columns;
+  auto n                 = std::make_unique<node>(node::kind::FILTER);
+  referenced_columns(predicate, n->predicate_columns);
+  check_columns(n->predicate_columns, num_columns);
+  std::sort(n->predicate_columns.begin(), n->predicate_columns.end());
+  n->predicate_columns.erase(
+    std::unique(n->predicate_columns.begin(), n->predicate_columns.end()),
+    n->predicate_columns.end());
+  n->inputs      = {input};
+  n->num_columns = num_columns;
+  n->predicate   = &predicate;
+  return add(std::move(n));
+}
+
+query_plan::node_id query_plan::project(node_id input, std::vector<size_type> const& columns)
+{
+  check_columns(columns, table_node(input).num_columns);
+  auto n         = std::make_unique<node>(node::kind::PROJECT);
+  n->inputs      = {input};
+  n->num_columns = static_cast<size_type>(columns.size());
+  n->columns     = columns;
+  return add(std::move(n));
+}
+
+query_plan::node_id query_plan::gather(node_id input, column_view const& gather_map)
+{
+  auto const num_columns = table_node(input).num_columns;
+  CUDF_EXPECTS(is_index_type(gather_map.type()), "Gather map must be an integral type.");
+  CUDF_EXPECTS(not gather_map.has_nulls(), "Gather map contains nulls");
+  auto n         = std::make_unique<node>(node::kind::GATHER);
+  n->inputs      = {input};
+  n->num_columns = num_columns;
+  n->gather_map  = gather_map;
+  return add(std::move(n));
+}
+
+query_plan::node_id query_plan::inner_join(node_id left,
+                                           node_id right,
+                                           std::vector<size_type> const& left_on,
+                                           std::vector<size_type> const& right_on,
+                                           null_equality compare_nulls)
+{
+  auto const left_columns  = table_node(left).num_columns;
+  auto const right_columns = table_node(right).num_columns;
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+  check_columns(left_on, left_columns);
+  check_columns(right_on, right_columns);
+  auto n           = std::make_unique<node>(node::kind::INNER_JOIN);
+  n->inputs        = {left, right};
+  n->num_columns   = left_columns + right_columns;
+  n->columns       = left_on;
+  n->right_columns = right_on;
+  n->compare_nulls = compare_nulls;
+  return add(std::move(n));
+}
+
+query_plan::node_id query_plan::reduce(node_id input,
+                                       size_type column,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       data_type output_dtype)
+{
+  check_columns({column}, table_node(input).num_columns);
+  auto n          = std::make_unique<node>(node::kind::REDUCE);
+  n->inputs       = {input};
+  n->columns      = {column};
+  n->agg          = agg->clone();
+  n->output_dtype = output_dtype;
+  return add(std::move(n));
+}
+
+std::vector<query_plan::result> query_plan::execute(std::vector<node_id> const& outputs,
+                                                    rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  auto const num_nodes = static_cast<node_id>(nodes.size());
+  std::vector<size_type> output_position(num_nodes, -1);
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    CUDF_EXPECTS(outputs[i] >= 0 and outputs[i] < num_nodes, "Invalid plan node");
+    CUDF_EXPECTS(output_position[outputs[i]] < 0, "Duplicate plan output");
+    output_position[outputs[i]] = static_cast<size_type>(i);
+  }
+
+  // The inputs of a node always precede it, so a reverse pass finds every node the outputs
+  // depend on, and how many of them read each node
+  std::vector<bool> live(num_nodes, false);
+  std::vector<size_type> readers(num_nodes, 0);
+  for (auto id : outputs) { live[id] = true; }
+  for (node_id id = num_nodes - 1; id >= 0; --id) {
+    if (not live[id]) { continue; }
+    for (auto input : nodes[id]->inputs) {
+      live[input] = true;
+      ++readers[input];
+    }
+  }
+
+  std::vector<result> results(outputs.size());
+  std::vector<std::unique_ptr<lazy_table>> tables(num_nodes);
+  std::vector<bool> reduced(num_nodes, false);
+
+  // Computes all the reductions of the node `input` at once, with one multi-reduction per column
+  auto const reduce_all = [&](node_id input) {
+    std::map<size_type, std::vector<node_id>> by_column;
+    for (node_id id = input + 1; id < num_nodes; ++id) {
+      auto const& n = *nodes[id];
+      if (live[id] and n.op == node::kind::REDUCE and n.inputs.front() == input) {
+        by_column[n.columns.front()].push_back(id);
+      }
+    }
+    std::vector<size_type> columns;
+    for (auto const& entry : by_column) { columns.push_back(entry.first); }
+    materialize(*tables[input], columns);
+    for (auto const& entry : by_column) {
+      std::vector<std::unique_ptr<aggregation>> aggs;
+      std::vector<data_type> output_dtypes;
+      for (auto id : entry.second) {
+        aggs.push_back(nodes[id]->agg->clone());
+        output_dtypes.push_back(nodes[id]->output_dtype);
+      }
+      auto values =
+        cudf::reduce(tables[input]->columns[entry.first].base, aggs, output_dtypes, mr);
+      for (size_t i = 0; i < entry.second.size(); ++i) {
+        auto const id = entry.second[i];
+        results[output_position[id]].value = std::move(values[i]);
+        reduced[id]                        = true;
+      }
+    }
+  };
+
+  for (node_id id = 0; id < num_nodes; ++id) {
+    if (not live[id]) { continue; }
+    auto const& n = *nodes[id];
+    switch (n.op) {
+      case node::kind::SCAN: tables[id] = scan_table(n.table); break;
+      case node::kind::FILTER:
+        tables[id] = filter_rows(*tables[n.inputs[0]], *n.predicate, n.predicate_columns);
+        break;
+      case node::kind::PROJECT:
+        tables[id] = project_columns(*tables[n.inputs[0]], n.columns);
+        break;
+      case node::kind::GATHER:
+        tables[id] = select_rows(*tables[n.inputs[0]], std::make_shared<column>(n.gather_map));
+        break;
+      case node::kind::INNER_JOIN:
+        tables[id] = join_rows(*tables[n.inputs[0]],
+                               *tables[n.inputs[1]],
+                               n.columns,
+                               n.right_columns,
+                               n.compare_nulls);
+        break;
+      case node::kind::REDUCE:
+        if (not reduced[id]) { reduce_all(n.inputs[0]); }
+        break;
+    }
+    if (tables[id] != nullptr and output_position[id] >= 0) {
+      results[output_position[id]].rows = to_table(*tables[id], mr);
+    }
+    if (readers[id] == 0) { tables[id].reset(); }
+    // release the intermediates whose last reader is this node
+    for (auto input : n.inputs) {
+      if (--readers[input] == 0) { tables[input].reset(); }
+    }
+  }
+  return results;
+}
+
+}  // namespace cudf
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/statistics.hpp>
+#include <cudf/statistics.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Returns whether min, max, NDV and histogram are computed for columns of `type`
+ */
+bool has_order_statistics(data_type type)
+{
+  return type.id() == type_id::STRING or (is_fixed_width(type) and not is_fixed_point(type));
+}
+
+/**
+ * @brief Returns the non-null values of `input` at the quantiles `i / num_buckets`, for `i` in
+ * `[0, num_buckets]`
+ *
+ * The quantiles are rounded to the nearest value. `input` must have a non-null value.
+ */
+std::unique_ptr<column> equi_depth_histogram(column_view const& input,
+                                             size_type num_buckets,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  auto const num_valid = input.size() - input.null_count();
+
+  // The nulls are ordered after all the values
+  auto const sorted = sorted_order(table_view{{input}},
+                                   {order::ASCENDING},
+                                   {null_order::AFTER},
+                                   rmm::mr::get_default_resource(),
+                                   stream);
+
+  auto const d_sorted = sorted->view().data<size_type>();
+
+  rmm::device_vector<size_type> bounds(num_buckets + 1);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_buckets + 1),
+                    bounds.begin(),
+                    [d_sorted, num_valid, num_buckets] __device__(size_type i) {
+                      auto const position =
+                        (int64_t{i} * (num_valid - 1) + num_buckets / 2) / num_buckets;
+                      return d_sorted[position];
+                    });
+
+  auto histogram = gather(table_view{{input}}, bounds.begin(), bounds.end(), false, mr, stream);
+  return std::move(histogram->release().front());
+}
+
+}  // namespace
+
+std::vector<column_statistics> compute_column_statistics(table_view const& input,
+                                                         statistics_options const& options,
+                                                         rmm::mr::device_memory_resource* mr,
+                                                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(options.sample_size >= 0, "Sample size must not be negative");
+  CUDF_EXPECTS(options.num_histogram_buckets >= 0,
+               "Number of histogram buckets must not be negative");
+  CUDF_EXPECTS(options.distinct_count_precision >= HYPERLOGLOG_MIN_PRECISION and
+                 options.distinct_count_precision <= HYPERLOGLOG_MAX_PRECISION,
+               "HyperLogLog precision out of range");
+
+  // All the columns are sampled at the same rows
+  std::unique_ptr<table> sample;
+  auto values = input;
+  if (options.sample_size > 0 and options.sample_size < input.num_rows()) {
+    sample = detail::sample(input,
+                            options.sample_size,
+                            sample_with_replacement::FALSE,
+                            options.seed,
+                            rmm::mr::get_default_resource(),
+                            stream);
+    values = sample->view();
+  }
+
+  std::vector<column_statistics> result(input.num_columns());
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto& stats        = result[i];
+    stats.num_rows     = input.num_rows();
+    stats.null_count   = input.column(i).null_count();
+    stats.sampled_rows = values.num_rows();
+
+    auto const& column = values.column(i);
+    if (not has_order_statistics(column.type())) { continue; }
+    stats.approx_distinct_count = detail::approx_distinct_count(
+      column, options.distinct_count_precision, null_policy::EXCLUDE, stream);
+    if (column.null_count() == column.size()) { continue; }
+
+    stats.min = reduction::min(column, column.type(), mr, stream);
+    stats.max = reduction::max(column, column.type(), mr, stream);
+    if (options.num_histogram_buckets > 0) {
+      stats.histogram = equi_depth_histogram(column, options.num_histogram_buckets, mr, stream);
+    }
+  }
+  return result;
+}
+
+}  // namespace detail
+
+std::vector<column_statistics> compute_column_statistics(table_view const& input,
+                                                         statistics_options const& options,
+                                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column_statistics(input, options, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace cudf {
+namespace reduction {
+namespace {
+/**
+ * @brief Partial results of all the fused reductions over a range of rows
+ *
+ * Integral sums are kept both as `int64_t`, which wraps like the sums in the output type, and as
+ * `double`, which does not overflow, for floating point outputs and the compound reductions.
+ */
+template <typename T>
+struct fused_partials {
+  using integral_type = std::conditional_t<std::is_floating_point<T>::value, double, int64_t>;
+
+  integral_type sum;
+  integral_type sum_of_squares;
+  double real_sum;
+  double real_sum_of_squares;
+  T min;
+  T max;
+};
+
+template <typename T>
+struct element_to_partials {
+  column_device_view col;
+
+  static CUDA_HOST_DEVICE_CALLABLE fused_partials<T> identity()
+  {
+    return {0, 0, 0., 0., std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest()};
+  }
+
+  __device__ fused_partials<T> operator()(size_type i) const
+  {
+    using integral_type = typename fused_partials<T>::integral_type;
+    if (col.is_null(i)) { return identity(); }
+    auto const value    = col.element<T>(i);
+    auto const integral = static_cast<integral_type>(value);
+    auto const real     = static_cast<double>(value);
+    return {integral, integral * integral, real, real * real, value, value};
+  }
+};
+
+template <typename T>
+struct combine_partials {
+  __device__ fused_partials<T> operator()(fused_partials<T> const& lhs,
+                                          fused_partials<T> const& rhs) const
+  {
+    return {lhs.sum + rhs.sum,
+            lhs.sum_of_squares + rhs.sum_of_squares,
+            lhs.real_sum + rhs.real_sum,
+            lhs.real_sum_of_squares + rhs.real_sum_of_squares,
+            lhs.min < rhs.min ? lhs.min : rhs.min,
+            lhs.max > rhs.max ? lhs.max : rhs.max};
+  }
+};
+
+/**
+ * @brief Creates a scalar of the dispatched type holding `value`
+ */
+template <typename Source>
+struct make_cast_scalar {
+  template <typename Target, std::enable_if_t<std::is_arithmetic<Target>::value>* = nullptr>
+  std::unique_ptr<scalar> operator()(Source value,
+                                     bool is_valid,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    return std::make_unique<numeric_scalar<Target>>(
+      static_cast<Target>(value), is_valid, stream, mr);
+  }
+
+  template <typename Target, std::enable_if_t<not std::is_arithmetic<Target>::value>* = nullptr>
+  std::unique_ptr<scalar> operator()(Source, bool, rmm::mr::device_memory_resource*, cudaStream_t)
+  {
+    CUDF_FAIL("Fused reductions only support arithmetic output types");
+  }
+};
+
+template <typename Source>
+std::unique_ptr<scalar> cast_scalar(data_type type,
+                                    Source value,
+                                    bool is_valid,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  return type_dispatcher(type, make_cast_scalar<Source>{}, value, is_valid, mr, stream);
+}
+
+struct fused_reduce_dispatch {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const& col,
+                                                  std::vector<aggregation const*> const& aggs,
+                                                  std::vector<data_type> const& output_dtypes,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream)
+  {
+    size_type const count = col.size() - col.null_count();
+    bool const is_valid   = count > 0;
+
+    fused_partials<T> partials{};
+    if (is_valid) {
+      auto d_col = column_device_view::create(col, stream);
+      partials   = thrust::transform_reduce(rmm::exec_policy(stream)->on(stream),
+                                          thrust::make_counting_iterator<size_type>(0),
+                                          thrust::make_counting_iterator<size_type>(col.size()),
+                                          element_to_partials<T>{*d_col},
+                                          element_to_partials<T>::identity(),
+                                          combine_partials<T>{});
+    }
+
+    std::vector<std::unique_ptr<scalar>> results;
+    for (size_t i = 0; i < aggs.size(); ++i) {
+      auto const type        = output_dtypes[i];
+      bool const is_floating = is_floating_point(type);
+      auto variance          = [&](size_type ddof) {
+        double const mean = partials.real_sum / count;
+        size_type div     = count - ddof;
+        return partials.real_sum_of_squares / div - ((mean * mean) * count) / div;
+      };
+      switch (aggs[i]->kind) {
+        case aggregation::SUM:
+          results.push_back(
+            is_floating ? cast_scalar(type, partials.real_sum, is_valid, mr, stream)
+                        : cast_scalar(type, partials.sum, is_valid, mr, stream));
+          break;
+        case aggregation::SUM_OF_SQUARES:
+          results.push_back(
+            is_floating ? cast_scalar(type, partials.real_sum_of_squares, is_valid, mr, stream)
+                        : cast_scalar(type, partials.sum_of_squares, is_valid, mr, stream));
+          break;
+        case aggregation::MIN:
+          results.push_back(cast_scalar(type, partials.min, is_valid, mr, stream));
+          break;
+        case aggregation::MAX:
+          results.push_back(cast_scalar(type, partials.max, is_valid, mr, stream));
+          break;
+        case aggregation::MEAN:
+          CUDF_EXPECTS(is_floating, "Unsupported output data type");
+          results.push_back(cast_scalar(type, partials.real_sum / count, is_valid, mr, stream));
+          break;
+        case aggregation::VARIANCE: {
+          CUDF_EXPECTS(is_floating, "Unsupported output data type");
+          auto const ddof = static_cast<std_var_aggregation const*>(aggs[i])->_ddof;
+          results.push_back(cast_scalar(type, variance(ddof), is_valid, mr, stream));
+        } break;
+        case aggregation::STD: {
+          CUDF_EXPECTS(is_floating, "Unsupported output data type");
+          auto const ddof = static_cast<std_var_aggregation const*>(aggs[i])->_ddof;
+          results.push_back(cast_scalar(type, std::sqrt(variance(ddof)), is_valid, mr, stream));
+        } break;
+        default: CUDF_FAIL("Unsupported fused reduction operator");
+      }
+    }
+    return results;
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const&,
+                                                  std::vector<aggregation const*> const&,
+                                                  std::vector<data_type> const&,
+                                                  rmm::mr::device_memory_resource*,
+                                                  cudaStream_t)
+  {
+    CUDF_FAIL("Fused reductions only support arithmetic input types");
+  }
+};
+
+}  // namespace
+
+bool is_fusable(aggregation::Kind kind, data_type type)
+{
+  switch (kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return true;
+    case aggregation::SUM:
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return is_numeric(type);
+    default: return false;
+  }
+}
+
+std::vector<std::unique_ptr<scalar>> fused_reduce(column_view const& col,
+                                                  std::vector<aggregation const*> const& aggs,
+                                                  std::vector<data_type> const& output_dtypes,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(aggs.size() == output_dtypes.size(),
+               "Number of aggregations and output types must match");
+  CUDF_EXPECTS(std::all_of(aggs.begin(),
+                           aggs.end(),
+                           [&col](auto agg) { return is_fusable(agg->kind, col.type()); }),
+               "Unsupported fused reduction operator");
+
+  // The counts do not read the column, so they are supported for any type; the other
+  // reductions share a single pass over the column
+  std::vector<std::unique_ptr<scalar>> results(aggs.size());
+  std::vector<aggregation const*> pass_aggs;
+  std::vector<data_type> pass_dtypes;
+  std::vector<size_t> pass_indices;
+  for (size_t i = 0; i < aggs.size(); ++i) {
+    if (aggs[i]->kind == aggregation::COUNT_VALID) {
+      results[i] = cast_scalar(output_dtypes[i], col.size() - col.null_count(), true, mr, stream);
+    } else if (aggs[i]->kind == aggregation::COUNT_ALL) {
+      results[i] = cast_scalar(output_dtypes[i], col.size(), true, mr, stream);
+    } else {
+      pass_aggs.push_back(aggs[i]);
+      pass_dtypes.push_back(output_dtypes[i]);
+      pass_indices.push_back(i);
+    }
+  }
+  if (not pass_aggs.empty()) {
+    auto pass_results = type_dispatcher(
+      col.type(), fused_reduce_dispatch{}, col, pass_aggs, pass_dtypes, mr, stream);
+    for (size_t i = 0; i < pass_indices.size(); ++i) {
+      results[pass_indices[i]] = std::move(pass_results[i]);
+    }
+  }
+  return results;
+}
+
+}  // namespace reduction
+}  // namespace cudf
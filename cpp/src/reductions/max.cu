@@ -18,7 +18,7 @@
 #include <cudf/detail/reduction_functions.hpp>
 #include "simple.cuh"
 
-std::unique_ptr<cudf::scalar> cudf::reduction::max(column_view const& col,
+std::unique_ptr<cudf::scalar> cudf::reduction::max(indexed_column_view const& col,
                                                    cudf::data_type const output_dtype,
                                                    rmm::mr::device_memory_resource* mr,
                                                    cudaStream_t stream)
@@ -17,7 +17,9 @@
 #include <cudf/column/column.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/hyperloglog.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/tdigest.hpp>
 #include <cudf/quantiles.hpp>
 #include <cudf/sorting.hpp>
 
@@ -92,6 +94,21 @@ struct reduce_dispatch_functor {
           stream,
           mr);
       } break;
+      case aggregation::APPROX_NUNIQUE: {
+        auto hll_agg = static_cast<hyperloglog_aggregation const *>(agg.get());
+        return make_fixed_width_scalar(
+          detail::approx_distinct_count(col, hll_agg->_precision, hll_agg->_null_handling, stream),
+          stream,
+          mr);
+      } break;
+      case aggregation::APPROX_QUANTILE: {
+        auto tdigest_agg = static_cast<tdigest_aggregation const *>(agg.get());
+        CUDF_EXPECTS(tdigest_agg->_quantiles.size() == 1,
+                     "Reduction approx_quantile accepts only one quantile value");
+        auto digest  = detail::tdigests(col, nullptr, 1, tdigest_agg->_max_centroids, mr, stream);
+        auto col_ptr = detail::tdigest_quantiles(*digest, tdigest_agg->_quantiles, mr, stream);
+        return get_element(*col_ptr, 0, mr);
+      } break;
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
@@ -114,6 +131,64 @@ std::unique_ptr<scalar> reduce(
     aggregation_dispatcher(agg->kind, reduce_dispatch_functor{col, output_dtype, mr, stream}, agg);
   return result;
 }
+
+std::unique_ptr<scalar> reduce(
+  indexed_column_view const &col,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  if (not col.has_indices()) { return reduce(col.parent(), agg, output_dtype, mr, stream); }
+  switch (agg->kind) {
+    case aggregation::SUM: return reduction::sum(col, output_dtype, mr, stream);
+    case aggregation::PRODUCT: return reduction::product(col, output_dtype, mr, stream);
+    case aggregation::MIN: return reduction::min(col, output_dtype, mr, stream);
+    case aggregation::MAX: return reduction::max(col, output_dtype, mr, stream);
+    case aggregation::ANY: return reduction::any(col, output_dtype, mr, stream);
+    case aggregation::ALL: return reduction::all(col, output_dtype, mr, stream);
+    case aggregation::SUM_OF_SQUARES:
+      return reduction::sum_of_squares(col, output_dtype, mr, stream);
+    default: {
+      // the other reductions read the selected rows as a column
+      auto const rows = col.materialize();
+      return reduce(rows->view(), agg, output_dtype, mr, stream);
+    }
+  }
+}
+
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const &col,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  std::vector<data_type> const &output_dtypes,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(aggs.size() == output_dtypes.size(),
+               "Number of aggregations and output types must match");
+
+  // The fusable reductions are computed in one pass, the others one at a time
+  std::vector<std::unique_ptr<scalar>> results(aggs.size());
+  std::vector<aggregation const *> fused_aggs;
+  std::vector<data_type> fused_dtypes;
+  std::vector<size_t> fused_indices;
+  for (size_t i = 0; i < aggs.size(); ++i) {
+    if (reduction::is_fusable(aggs[i]->kind, col.type())) {
+      fused_aggs.push_back(aggs[i].get());
+      fused_dtypes.push_back(output_dtypes[i]);
+      fused_indices.push_back(i);
+    } else {
+      results[i] = reduce(col, aggs[i], output_dtypes[i], mr, stream);
+    }
+  }
+  if (not fused_aggs.empty()) {
+    auto fused_results = reduction::fused_reduce(col, fused_aggs, fused_dtypes, mr, stream);
+    for (size_t i = 0; i < fused_indices.size(); ++i) {
+      results[fused_indices[i]] = std::move(fused_results[i]);
+    }
+  }
+  return results;
+}
 }  // namespace detail
 
 std::unique_ptr<scalar> reduce(column_view const &col,
@@ -125,4 +200,38 @@ std::unique_ptr<scalar> reduce(column_view const &col,
   return detail::reduce(col, agg, output_dtype, mr);
 }
 
+std::unique_ptr<scalar> reduce(indexed_column_view const &col,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, agg, output_dtype, mr);
+}
+
+std::vector<std::unique_ptr<scalar>> reduce(column_view const &col,
+                                            std::vector<std::unique_ptr<aggregation>> const &aggs,
+                                            std::vector<data_type> const &output_dtypes,
+                                            rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, aggs, output_dtypes, mr);
+}
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const &table,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  std::vector<std::vector<data_type>> const &output_dtypes,
+  rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(output_dtypes.size() == static_cast<size_t>(table.num_columns()),
+               "Number of output type lists and columns must match");
+  std::vector<std::vector<std::unique_ptr<scalar>>> results;
+  for (size_type c = 0; c < table.num_columns(); ++c) {
+    results.push_back(detail::reduce(table.column(c), aggs, output_dtypes[c], mr));
+  }
+  return results;
+}
+
 }  // namespace cudf
@@ -11,11 +11,118 @@
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/reduction.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace detail {
+namespace {
+/**
+ * @brief Returns true if the scan `Op` of fixed-width elements of type `T` is supported
+ *
+ * Arithmetic types support all the operators, durations and fixed_point types support sum, min
+ * and max, and timestamps support min and max.
+ */
+template <typename Op, typename T>
+constexpr bool is_fixed_width_scan_supported()
+{
+  constexpr bool is_min_max =
+    std::is_same<Op, cudf::DeviceMin>::value || std::is_same<Op, cudf::DeviceMax>::value;
+  constexpr bool is_sum = std::is_same<Op, cudf::DeviceSum>::value;
+  return std::is_arithmetic<T>::value || (is_min_max && is_timestamp<T>()) ||
+         ((is_min_max || is_sum) && (is_duration<T>() || is_fixed_point<T>()));
+}
+
+/**
+ * @brief Binary operator `Op` over (value, validity) pairs that skips the null operands
+ */
+template <typename Op>
+struct null_skipping_op {
+  template <typename T>
+  CUDA_DEVICE_CALLABLE thrust::pair<T, bool> operator()(thrust::pair<T, bool> const& lhs,
+                                                        thrust::pair<T, bool> const& rhs)
+  {
+    if (!rhs.second) return lhs;
+    if (!lhs.second) return rhs;
+    return {Op{}(lhs.first, rhs.first), true};
+  }
+};
+
+struct pair_value_fn {
+  template <typename T>
+  CUDA_DEVICE_CALLABLE T operator()(thrust::pair<T, bool> const& pair)
+  {
+    return pair.first;
+  }
+};
+
+/**
+ * @brief Computes the inclusive scan of the valid elements of the nullable `input` column, in
+ * each run of equal `keys` if `keys` is not nullptr
+ *
+ * The null elements are replaced by the identity of `Op`.
+ */
+template <typename Op, typename T, std::enable_if_t<!is_fixed_point<T>()>* = nullptr>
+void inclusive_scan_valid(column_device_view const& input,
+                          size_type const* keys,
+                          T* output,
+                          cudaStream_t stream)
+{
+  auto values = make_null_replacement_iterator(input, Op::template identity<T>());
+  if (keys == nullptr) {
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream)->on(stream), values, values + input.size(), output, Op{});
+  } else {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  keys,
+                                  keys + input.size(),
+                                  values,
+                                  output,
+                                  thrust::equal_to<size_type>{},
+                                  Op{});
+  }
+}
+
+/**
+ * @copydoc inclusive_scan_valid
+ *
+ * The identity of a fixed_point operator depends on the scale of the elements, so the null
+ * elements are skipped by the scan operator instead.
+ */
+template <typename Op, typename T, std::enable_if_t<is_fixed_point<T>()>* = nullptr>
+void inclusive_scan_valid(column_device_view const& input,
+                          size_type const* keys,
+                          T* output,
+                          cudaStream_t stream)
+{
+  auto pairs = input.pair_begin<T, true>();
+  rmm::device_vector<thrust::pair<T, bool>> result(input.size());
+  if (keys == nullptr) {
+    thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           pairs,
+                           pairs + input.size(),
+                           result.begin(),
+                           null_skipping_op<Op>{});
+  } else {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  keys,
+                                  keys + input.size(),
+                                  pairs,
+                                  result.begin(),
+                                  thrust::equal_to<size_type>{},
+                                  null_skipping_op<Op>{});
+  }
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream), result.begin(), result.end(), output, pair_value_fn{});
+}
+
+}  // namespace
+
 /**
  * @brief Dispatcher for running Scan operation on input column
  * Dispatches scan operation on `Op` and creates output column
@@ -31,20 +138,22 @@ struct ScanDispatcher {
     return std::is_same<T, string_view>::value &&
            (std::is_same<Op, cudf::DeviceMin>::value || std::is_same<Op, cudf::DeviceMax>::value);
   }
-  // return true if T is arithmetic type (including bool)
+  // return true if T is a supported fixed-width type or a string type
   template <typename T>
   static constexpr bool is_supported()
   {
-    return std::is_arithmetic<T>::value || is_string_supported<T>();
+    return is_fixed_width_scan_supported<Op, T>() || is_string_supported<T>();
   }
 
-  // for arithmetic types
-  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, T>* = nullptr>
+  // for fixed-width types
+  template <typename T, std::enable_if_t<is_fixed_width_scan_supported<Op, T>(), T>* = nullptr>
   auto exclusive_scan(const column_view& input_view,
                       null_policy null_handling,
                       rmm::mr::device_memory_resource* mr,
                       cudaStream_t stream)
   {
+    CUDF_EXPECTS(!is_fixed_point<T>(),
+                 "fixed_point types support only inclusive sum/min/max for `cudf::scan`");
     const size_type size = input_view.size();
     auto output_column =
       detail::allocate_like(input_view, size, mask_allocation_policy::NEVER, mr, stream);
@@ -86,9 +195,13 @@ struct ScanDispatcher {
     CUDF_FAIL("String types supports only inclusive min/max for `cudf::scan`");
   }
 
-  rmm::device_buffer mask_inclusive_scan(const column_view& input_view,
-                                         rmm::mr::device_memory_resource* mr,
-                                         cudaStream_t stream)
+  /**
+   * @brief Returns the null mask of an inclusive scan including the nulls, where all the rows from
+   * the first null are null, and the position of that first null
+   */
+  std::pair<rmm::device_buffer, size_type> mask_inclusive_scan(const column_view& input_view,
+                                                               rmm::mr::device_memory_resource* mr,
+                                                               cudaStream_t stream)
   {
     rmm::device_buffer mask =
       create_null_mask(input_view.size(), mask_state::UNINITIALIZED, stream, mr);
@@ -102,11 +215,11 @@ struct ScanDispatcher {
       static_cast<cudf::bitmask_type*>(mask.data()), 0, first_null_position, true);
     cudf::set_null_mask(
       static_cast<cudf::bitmask_type*>(mask.data()), first_null_position, input_view.size(), false);
-    return mask;
+    return {std::move(mask), static_cast<size_type>(first_null_position)};
   }
 
-  // for arithmetic types
-  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, T>* = nullptr>
+  // for fixed-width types
+  template <typename T, std::enable_if_t<is_fixed_width_scan_supported<Op, T>(), T>* = nullptr>
   auto inclusive_scan(const column_view& input_view,
                       null_policy null_handling,
                       rmm::mr::device_memory_resource* mr,
@@ -115,26 +228,28 @@ struct ScanDispatcher {
     const size_type size = input_view.size();
     auto output_column =
       detail::allocate_like(input_view, size, mask_allocation_policy::NEVER, mr, stream);
+    // When the nulls are included, the rows from the first null are null: only the valid prefix
+    // is scanned, without replacing the nulls
+    size_type scan_size = size;
     if (null_handling == null_policy::EXCLUDE) {
       output_column->set_null_mask(copy_bitmask(input_view, stream, mr), input_view.null_count());
     } else {
       if (input_view.nullable()) {
-        output_column->set_null_mask(mask_inclusive_scan(input_view, mr, stream),
-                                     cudf::UNKNOWN_NULL_COUNT);
+        auto mask = mask_inclusive_scan(input_view, mr, stream);
+        scan_size = mask.second;
+        output_column->set_null_mask(std::move(mask.first), size - scan_size);
       }
     }
 
     auto d_input               = column_device_view::create(input_view, stream);
     mutable_column_view output = output_column->mutable_view();
 
-    if (input_view.has_nulls()) {
-      auto input = make_null_replacement_iterator(*d_input, Op::template identity<T>());
-      thrust::inclusive_scan(
-        rmm::exec_policy(stream)->on(stream), input, input + size, output.data<T>(), Op{});
+    if (null_handling == null_policy::EXCLUDE && input_view.has_nulls()) {
+      inclusive_scan_valid<Op>(*d_input, nullptr, output.data<T>(), stream);
     } else {
       auto input = d_input->begin<T>();
       thrust::inclusive_scan(
-        rmm::exec_policy(stream)->on(stream), input, input + size, output.data<T>(), Op{});
+        rmm::exec_policy(stream)->on(stream), input, input + scan_size, output.data<T>(), Op{});
     }
 
     CHECK_CUDA(stream);
@@ -169,8 +284,8 @@ struct ScanDispatcher {
       output_column->set_null_mask(copy_bitmask(input_view, stream, mr), input_view.null_count());
     } else {
       if (input_view.nullable()) {
-        output_column->set_null_mask(mask_inclusive_scan(input_view, mr, stream),
-                                     cudf::UNKNOWN_NULL_COUNT);
+        auto mask = mask_inclusive_scan(input_view, mr, stream);
+        output_column->set_null_mask(std::move(mask.first), size - mask.second);
       }
     }
     return output_column;
@@ -214,7 +329,7 @@ struct ScanDispatcher {
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
   {
-    CUDF_FAIL("Non-arithmetic types not supported for `cudf::scan`");
+    CUDF_FAIL("Unsupported type and aggregation operator for `cudf::scan`");
   }
 };
 
@@ -225,9 +340,6 @@ std::unique_ptr<column> scan(const column_view& input,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                              cudaStream_t stream                 = 0)
 {
-  CUDF_EXPECTS(is_numeric(input.type()) || is_compound(input.type()),
-               "Unexpected non-numeric or non-string type.");
-
   switch (agg->kind) {
     case aggregation::SUM:
       return cudf::type_dispatcher(input.type(),
@@ -264,6 +376,139 @@ std::unique_ptr<column> scan(const column_view& input,
     default: CUDF_FAIL("Unsupported aggregation operator for scan");
   }
 }
+
+/**
+ * @brief Dispatcher for running a Scan operation on each segment of a fixed-width column
+ *
+ * @tparam Op device binary operator
+ */
+template <typename Op>
+struct SegmentedScanDispatcher {
+  template <typename T, std::enable_if_t<is_fixed_width_scan_supported<Op, T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type const* d_offsets,
+                                     size_type num_segments,
+                                     scan_type inclusive,
+                                     null_policy null_handling,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    CUDF_EXPECTS(!is_fixed_point<T>() || inclusive == scan_type::INCLUSIVE,
+                 "fixed_point types support only inclusive sum/min/max for `cudf::segmented_scan`");
+    const size_type size = input.size();
+    auto output_column =
+      detail::allocate_like(input, size, mask_allocation_policy::NEVER, mr, stream);
+    if (size == 0) { return output_column; }
+
+    // label of the segment of each row, the keys of the scans
+    rmm::device_vector<size_type> labels(size);
+    thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                        d_offsets + 1,
+                        d_offsets + num_segments + 1,
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(size),
+                        labels.begin());
+
+    auto d_input = column_device_view::create(input, stream);
+    auto output  = output_column->mutable_view().data<T>();
+    // When the nulls are included, the values scanned after a null only reach null rows
+    bool const skip_nulls = null_handling == null_policy::EXCLUDE && input.has_nulls();
+    if (inclusive == scan_type::INCLUSIVE) {
+      if (skip_nulls) {
+        inclusive_scan_valid<Op>(*d_input, labels.data().get(), output, stream);
+      } else {
+        thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                      labels.begin(),
+                                      labels.end(),
+                                      d_input->begin<T>(),
+                                      output,
+                                      thrust::equal_to<size_type>{},
+                                      Op{});
+      }
+    } else {
+      auto scan = [&](auto values) {
+        thrust::exclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                      labels.begin(),
+                                      labels.end(),
+                                      values,
+                                      output,
+                                      Op::template identity<T>(),
+                                      thrust::equal_to<size_type>{},
+                                      Op{});
+      };
+      if (skip_nulls) {
+        scan(make_null_replacement_iterator(*d_input, Op::template identity<T>()));
+      } else {
+        scan(d_input->begin<T>());
+      }
+    }
+
+    if (null_handling == null_policy::EXCLUDE) {
+      output_column->set_null_mask(copy_bitmask(input, stream, mr), input.null_count());
+    } else if (input.nullable()) {
+      // a row is null if it or a previous row of its segment is null
+      rmm::device_vector<bool> valid(size);
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    labels.begin(),
+                                    labels.end(),
+                                    make_validity_iterator(*d_input),
+                                    valid.begin(),
+                                    thrust::equal_to<size_type>{},
+                                    thrust::logical_and<bool>{});
+      auto mask =
+        detail::valid_if(valid.begin(), valid.end(), thrust::identity<bool>{}, stream, mr);
+      output_column->set_null_mask(std::move(mask.first), mask.second);
+    }
+
+    CHECK_CUDA(stream);
+    return output_column;
+  }
+
+  template <typename T, std::enable_if_t<!is_fixed_width_scan_supported<Op, T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type const*,
+                                     size_type,
+                                     scan_type,
+                                     null_policy,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t)
+  {
+    CUDF_FAIL("Unsupported type and aggregation operator for `cudf::segmented_scan`");
+  }
+};
+
+std::unique_ptr<column> segmented_scan(
+  column_view const& input,
+  column_view const& segment_offsets,
+  std::unique_ptr<aggregation> const& agg,
+  scan_type inclusive,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(segment_offsets.type().id() == type_to_id<size_type>() and
+                 not segment_offsets.has_nulls() and segment_offsets.size() > 0,
+               "Segment offsets must be a non-empty size_type column without nulls");
+
+  auto dispatch = [&](auto op) {
+    return cudf::type_dispatcher(input.type(),
+                                 SegmentedScanDispatcher<decltype(op)>(),
+                                 input,
+                                 segment_offsets.data<size_type>(),
+                                 segment_offsets.size() - 1,
+                                 inclusive,
+                                 null_handling,
+                                 mr,
+                                 stream);
+  };
+  switch (agg->kind) {
+    case aggregation::SUM: return dispatch(cudf::DeviceSum{});
+    case aggregation::MIN: return dispatch(cudf::DeviceMin{});
+    case aggregation::MAX: return dispatch(cudf::DeviceMax{});
+    case aggregation::PRODUCT: return dispatch(cudf::DeviceProduct{});
+    default: CUDF_FAIL("Unsupported aggregation operator for segmented scan");
+  }
+}
 }  // namespace detail
 
 std::unique_ptr<column> scan(const column_view& input,
@@ -276,4 +521,15 @@ std::unique_ptr<column> scan(const column_view& input,
   return detail::scan(input, agg, inclusive, null_handling, mr);
 }
 
+std::unique_ptr<column> segmented_scan(column_view const& input,
+                                       column_view const& segment_offsets,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       scan_type inclusive,
+                                       null_policy null_handling,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_scan(input, segment_offsets, agg, inclusive, null_handling, mr);
+}
+
 }  // namespace cudf
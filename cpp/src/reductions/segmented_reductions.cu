@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_vector.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cub/device/device_segmented_reduce.cuh>
+
+namespace cudf {
+namespace reduction {
+namespace {
+/**
+ * @brief Reduces each segment `[d_offsets[i], d_offsets[i + 1])` of `d_in` into `d_out[i]`
+ */
+template <typename InputIterator, typename OutputIterator, typename BinaryOp, typename T>
+void segmented_reduce(InputIterator d_in,
+                      OutputIterator d_out,
+                      size_type num_segments,
+                      size_type const* d_offsets,
+                      BinaryOp binary_op,
+                      T identity,
+                      cudaStream_t stream)
+{
+  rmm::device_buffer d_temp_storage;
+  size_t temp_storage_bytes = 0;
+  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     d_offsets,
+                                     d_offsets + 1,
+                                     binary_op,
+                                     identity,
+                                     stream);
+  d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+
+  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     d_offsets,
+                                     d_offsets + 1,
+                                     binary_op,
+                                     identity,
+                                     stream);
+}
+
+/**
+ * @brief Returns whether the element `i` of a column is valid, as an integer to sum
+ */
+struct valid_element_fn {
+  column_device_view d_values;
+
+  __device__ size_type operator()(size_type i) const { return d_values.is_valid_nocheck(i); }
+};
+
+/**
+ * @brief Returns whether the result of segment `i` is valid
+ *
+ * A segment is valid if it is not masked out, and has some valid elements when the nulls are
+ * excluded or only valid elements when they are included.
+ */
+struct valid_segment_fn {
+  size_type const* d_offsets;
+  size_type const* d_valid_counts;  // nullptr if all the elements are valid
+  bitmask_type const* segment_null_mask;
+  size_type segment_mask_offset;
+  bool include_nulls;
+
+  __device__ bool operator()(size_type i) const
+  {
+    if (segment_null_mask != nullptr and
+        not bit_is_set(segment_null_mask, segment_mask_offset + i)) {
+      return false;
+    }
+    auto const length      = d_offsets[i + 1] - d_offsets[i];
+    auto const valid_count = d_valid_counts != nullptr ? d_valid_counts[i] : length;
+    return include_nulls ? length > 0 and valid_count == length : valid_count > 0;
+  }
+};
+
+template <typename ElementType, typename ResultType, typename Op>
+std::unique_ptr<column> simple_segmented_reduction(column_view const& values,
+                                                   size_type const* d_offsets,
+                                                   size_type num_segments,
+                                                   null_policy null_handling,
+                                                   bitmask_type const* segment_null_mask,
+                                                   size_type segment_mask_offset,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream)
+{
+  auto d_values = column_device_view::create(values, stream);
+  auto result   = make_fixed_width_column(
+    data_type{type_to_id<ResultType>()}, num_segments, mask_state::UNALLOCATED, stream, mr);
+  auto d_result = result->mutable_view().data<ResultType>();
+  Op simple_op{};
+  auto const identity = simple_op.template get_identity<ResultType>();
+
+  rmm::device_vector<size_type> valid_counts;
+  if (values.has_nulls()) {
+    auto it = thrust::make_transform_iterator(
+      d_values->pair_begin<ElementType, true>(),
+      simple_op.template get_null_replacing_element_transformer<ResultType>());
+    segmented_reduce(
+      it, d_result, num_segments, d_offsets, simple_op.get_binary_op(), identity, stream);
+
+    valid_counts.resize(num_segments);
+    auto valid_it = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                    valid_element_fn{*d_values});
+    segmented_reduce(valid_it,
+                     valid_counts.data().get(),
+                     num_segments,
+                     d_offsets,
+                     cudf::DeviceSum{},
+                     size_type{0},
+                     stream);
+  } else {
+    auto it = thrust::make_transform_iterator(
+      d_values->begin<ElementType>(), simple_op.template get_element_transformer<ResultType>());
+    segmented_reduce(
+      it, d_result, num_segments, d_offsets, simple_op.get_binary_op(), identity, stream);
+  }
+
+  auto null_mask = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_segments),
+    valid_segment_fn{d_offsets,
+                     values.has_nulls() ? valid_counts.data().get() : nullptr,
+                     segment_null_mask,
+                     segment_mask_offset,
+                     null_handling == null_policy::INCLUDE},
+    stream,
+    mr);
+  if (null_mask.second > 0) { result->set_null_mask(std::move(null_mask.first), null_mask.second); }
+  return result;
+}
+
+template <typename Op>
+struct segmented_reduce_dispatch {
+  template <typename ElementType, typename ResultType>
+  static constexpr bool is_supported()
+  {
+    return std::is_arithmetic<ElementType>::value and std::is_arithmetic<ResultType>::value;
+  }
+
+  template <typename ResultType, typename ElementType>
+  struct result_dispatch {
+    template <typename R                                                = ResultType,
+              std::enable_if_t<is_supported<ElementType, R>()>* = nullptr>
+    std::unique_ptr<column> operator()(column_view const& values,
+                                       size_type const* d_offsets,
+                                       size_type num_segments,
+                                       null_policy null_handling,
+                                       bitmask_type const* segment_null_mask,
+                                       size_type segment_mask_offset,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+    {
+      return simple_segmented_reduction<ElementType, ResultType, Op>(values,
+                                                                     d_offsets,
+                                                                     num_segments,
+                                                                     null_handling,
+                                                                     segment_null_mask,
+                                                                     segment_mask_offset,
+                                                                     mr,
+                                                                     stream);
+    }
+
+    template <typename R                                                    = ResultType,
+              std::enable_if_t<not is_supported<ElementType, R>()>* = nullptr>
+    std::unique_ptr<column> operator()(column_view const&,
+                                       size_type const*,
+                                       size_type,
+                                       null_policy,
+                                       bitmask_type const*,
+                                       size_type,
+                                       rmm::mr::device_memory_resource*,
+                                       cudaStream_t)
+    {
+      CUDF_FAIL("Segmented reductions only support arithmetic input and output types");
+    }
+  };
+
+  template <typename ElementType>
+  struct element_dispatch {
+    template <typename ResultType, typename... Args>
+    std::unique_ptr<column> operator()(Args&&... args)
+    {
+      return result_dispatch<ResultType, ElementType>{}(std::forward<Args>(args)...);
+    }
+  };
+
+  template <typename ElementType, typename... Args>
+  std::unique_ptr<column> operator()(data_type output_dtype, Args&&... args)
+  {
+    return type_dispatcher(
+      output_dtype, element_dispatch<ElementType>{}, std::forward<Args>(args)...);
+  }
+};
+
+template <typename Op>
+std::unique_ptr<column> dispatch_segmented_reduction(column_view const& values,
+                                                     data_type output_dtype,
+                                                     size_type const* d_offsets,
+                                                     size_type num_segments,
+                                                     null_policy null_handling,
+                                                     bitmask_type const* segment_null_mask,
+                                                     size_type segment_mask_offset,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream)
+{
+  return type_dispatcher(values.type(),
+                         segmented_reduce_dispatch<Op>{},
+                         output_dtype,
+                         values,
+                         d_offsets,
+                         num_segments,
+                         null_handling,
+                         segment_null_mask,
+                         segment_mask_offset,
+                         mr,
+                         stream);
+}
+
+}  // namespace
+
+std::unique_ptr<column> segmented_reduce(column_view const& values,
+                                         size_type const* d_offsets,
+                                         size_type num_segments,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         bitmask_type const* segment_null_mask,
+                                         size_type segment_mask_offset,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  if (num_segments == 0) { return make_empty_column(output_dtype); }
+
+  auto reduce = [&](auto op, data_type type) {
+    return dispatch_segmented_reduction<decltype(op)>(values,
+                                                      type,
+                                                      d_offsets,
+                                                      num_segments,
+                                                      null_handling,
+                                                      segment_null_mask,
+                                                      segment_mask_offset,
+                                                      mr,
+                                                      stream);
+  };
+  switch (agg->kind) {
+    case aggregation::SUM: return reduce(op::sum{}, output_dtype);
+    case aggregation::PRODUCT: return reduce(op::product{}, output_dtype);
+    case aggregation::MIN: return reduce(op::min{}, output_dtype);
+    case aggregation::MAX: return reduce(op::max{}, output_dtype);
+    case aggregation::SUM_OF_SQUARES: return reduce(op::sum_of_squares{}, output_dtype);
+    case aggregation::ANY:
+      CUDF_EXPECTS(output_dtype.id() == type_id::BOOL8, "ANY reduction must output BOOL8");
+      return reduce(op::max{}, output_dtype);
+    case aggregation::ALL:
+      CUDF_EXPECTS(output_dtype.id() == type_id::BOOL8, "ALL reduction must output BOOL8");
+      return reduce(op::min{}, output_dtype);
+    default: CUDF_FAIL("Unsupported segmented reduction operator");
+  }
+}
+
+}  // namespace reduction
+
+std::unique_ptr<column> segmented_reduce(column_view const& values,
+                                         column_view const& segment_offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(segment_offsets.type().id() == type_to_id<size_type>() and
+                 not segment_offsets.has_nulls() and segment_offsets.size() > 0,
+               "Segment offsets must be a non-empty size_type column without nulls");
+  return reduction::segmented_reduce(values,
+                                     segment_offsets.data<size_type>(),
+                                     segment_offsets.size() - 1,
+                                     agg,
+                                     output_dtype,
+                                     null_handling,
+                                     nullptr,
+                                     0,
+                                     mr,
+                                     0);
+}
+
+}  // namespace cudf
@@ -18,18 +18,115 @@
 
 #include <cudf/detail/reduction.cuh>
 
+#include <cudf/column/indexed_column_view.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include "cudf/structs/struct_view.hpp"
 
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/logical.h>
+
 namespace cudf {
 namespace reduction {
 namespace simple {
+/**
+ * @brief Reduces the elements of `it` at the rows of `col`, through its indices if it has any.
+ */
+template <typename Op, typename InputIterator>
+std::unique_ptr<scalar> reduce_rows(InputIterator it,
+                                    indexed_column_view const& col,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  if (col.has_indices()) {
+    auto const rows = thrust::make_permutation_iterator(it, col.indices().begin<size_type>());
+    return detail::reduce(rows, col.size(), Op{}, mr, stream);
+  }
+  return detail::reduce(it, col.size(), Op{}, mr, stream);
+}
+
+/**
+ * @brief Returns whether some rows of `col` are valid.
+ */
+inline bool has_valid_rows(indexed_column_view const& col, cudaStream_t stream)
+{
+  auto const parent = col.parent();
+  if (not col.has_indices()) { return parent.null_count() < parent.size(); }
+  if (not parent.has_nulls()) { return col.size() > 0; }
+  return thrust::any_of(rmm::exec_policy(stream)->on(stream),
+                        col.indices().begin<size_type>(),
+                        col.indices().end<size_type>(),
+                        [mask = parent.null_mask(), offset = parent.offset()] __device__(
+                          size_type row) { return bit_is_set(mask, row + offset); });
+}
+
+/**
+ * @brief Reduces the rows of `col`, whose parent `dcol` has nulls, replacing nulls by the identity
+ * of `Op` through a pair iterator.
+ */
+template <typename ElementType, typename ResultType, typename Op>
+std::unique_ptr<scalar> reduce_nullable_pairs(column_device_view const& dcol,
+                                              indexed_column_view const& col,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  auto it = thrust::make_transform_iterator(
+    dcol.pair_begin<ElementType, true>(),
+    Op{}.template get_null_replacing_element_transformer<ResultType>());
+  return reduce_rows<Op>(it, col, mr, stream);
+}
+
+/**
+ * @brief Whether the valid rows of a column of `ElementType` can be reduced to a `ResultType` by
+ * `detail::reduce_valid_rows`.
+ */
+template <typename ElementType, typename ResultType>
+constexpr bool is_valid_word_reducible()
+{
+  return is_fixed_width<ElementType>() && not is_fixed_point<ElementType>() &&
+         is_fixed_width<ResultType>() && not is_fixed_point<ResultType>();
+}
+
+/**
+ * @brief Reduces the rows of `col`, whose parent `dcol` has nulls.
+ *
+ * Rows not selected by indices are reduced loading their validities a word at a time.
+ */
+template <typename ElementType,
+          typename ResultType,
+          typename Op,
+          std::enable_if_t<is_valid_word_reducible<ElementType, ResultType>()>* = nullptr>
+std::unique_ptr<scalar> reduce_nullable_rows(column_device_view const& dcol,
+                                             indexed_column_view const& col,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  if (col.has_indices()) {
+    return reduce_nullable_pairs<ElementType, ResultType, Op>(dcol, col, mr, stream);
+  }
+  return detail::reduce_valid_rows<ElementType, ResultType>(dcol, Op{}, mr, stream);
+}
+
+template <typename ElementType,
+          typename ResultType,
+          typename Op,
+          std::enable_if_t<not is_valid_word_reducible<ElementType, ResultType>()>* = nullptr>
+std::unique_ptr<scalar> reduce_nullable_rows(column_device_view const& dcol,
+                                             indexed_column_view const& col,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  return reduce_nullable_pairs<ElementType, ResultType, Op>(dcol, col, mr, stream);
+}
+
 /** --------------------------------------------------------------------------*
  * @brief Reduction for 'sum', 'product', 'min', 'max', 'sum of squares'
  * which directly compute the reduction by a single step reduction call
  *
+ * The rows selected by the indices of `col` are read in place.
+ *
  * @param[in] col    input column view
  * @param[in] mr Device memory resource used to allocate the returned scalar's device memory
  * @param[in] CUDA stream used for device memory operations and kernel launches.
@@ -40,28 +137,25 @@ namespace simple {
  * @tparam Op           the operator of cudf::reduction::op::
  * ----------------------------------------------------------------------------**/
 template <typename ElementType, typename ResultType, typename Op>
-std::unique_ptr<scalar> simple_reduction(column_view const& col,
+std::unique_ptr<scalar> simple_reduction(indexed_column_view const& col,
                                          data_type const output_dtype,
                                          rmm::mr::device_memory_resource* mr,
                                          cudaStream_t stream)
 {
   // reduction by iterator
-  auto dcol = cudf::column_device_view::create(col, stream);
+  auto dcol = cudf::column_device_view::create(col.parent(), stream);
   std::unique_ptr<scalar> result;
   Op simple_op{};
 
-  if (col.has_nulls()) {
-    auto it = thrust::make_transform_iterator(
-      dcol->pair_begin<ElementType, true>(),
-      simple_op.template get_null_replacing_element_transformer<ResultType>());
-    result = detail::reduce(it, col.size(), Op{}, mr, stream);
+  if (col.parent().has_nulls()) {
+    result = reduce_nullable_rows<ElementType, ResultType, Op>(*dcol, col, mr, stream);
   } else {
     auto it = thrust::make_transform_iterator(
       dcol->begin<ElementType>(), simple_op.template get_element_transformer<ResultType>());
-    result = detail::reduce(it, col.size(), Op{}, mr, stream);
+    result = reduce_rows<Op>(it, col, mr, stream);
   }
   // set scalar is valid
-  result->set_valid((col.null_count() < col.size()), stream);
+  result->set_valid(has_valid_rows(col, stream), stream);
   return result;
 };
 
@@ -89,7 +183,7 @@ struct result_type_dispatcher {
 
  public:
   template <typename ResultType, std::enable_if_t<is_supported_v<ResultType>()>* = nullptr>
-  std::unique_ptr<scalar> operator()(column_view const& col,
+  std::unique_ptr<scalar> operator()(indexed_column_view const& col,
                                      data_type const output_dtype,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
@@ -98,7 +192,7 @@ struct result_type_dispatcher {
   }
 
   template <typename ResultType, std::enable_if_t<not is_supported_v<ResultType>()>* = nullptr>
-  std::unique_ptr<scalar> operator()(column_view const& col,
+  std::unique_ptr<scalar> operator()(indexed_column_view const& col,
                                      data_type const output_dtype,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
@@ -127,7 +221,7 @@ struct element_type_dispatcher {
 
  public:
   template <typename ElementType, std::enable_if_t<is_supported_v<ElementType>()>* = nullptr>
-  std::unique_ptr<scalar> operator()(column_view const& col,
+  std::unique_ptr<scalar> operator()(indexed_column_view const& col,
                                      data_type const output_dtype,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
@@ -137,7 +231,7 @@ struct element_type_dispatcher {
   }
 
   template <typename ElementType, std::enable_if_t<not is_supported_v<ElementType>()>* = nullptr>
-  std::unique_ptr<scalar> operator()(column_view const& col,
+  std::unique_ptr<scalar> operator()(indexed_column_view const& col,
                                      data_type const output_dtype,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
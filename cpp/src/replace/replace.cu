@@ -55,71 +55,144 @@
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/device_ptr.h>
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
 #include <cub/cub.cuh>
 
 namespace {  // anonymous
 
 static constexpr int BLOCK_SIZE = 256;
 
+// Largest number of values to replace that are searched linearly for every element
+static constexpr cudf::size_type linear_search_threshold = 32;
+
+/**
+ * @brief Returns the position of the first of the values to replace equal to `value`, or -1,
+ * by a linear search.
+ */
+template <typename T>
+struct linear_search_fn {
+  T const* values_begin;
+  T const* values_end;
+
+  __device__ cudf::size_type operator()(T const& value) const
+  {
+    auto found_ptr = thrust::find(thrust::seq, values_begin, values_end, value);
+    return found_ptr == values_end
+             ? -1
+             : static_cast<cudf::size_type>(thrust::distance(values_begin, found_ptr));
+  }
+};
+
+/**
+ * @brief Orders the values to replace for the binary search.
+ *
+ * NaNs are ordered last. They never equal a value, so they are never found.
+ */
+template <typename T>
+struct search_less {
+  template <typename U = T, std::enable_if_t<std::is_floating_point<U>::value>* = nullptr>
+  __device__ bool operator()(T const& lhs, T const& rhs) const
+  {
+    if (isnan(rhs)) { return not isnan(lhs); }
+    return not isnan(lhs) and lhs < rhs;
+  }
+
+  template <typename U = T, std::enable_if_t<not std::is_floating_point<U>::value>* = nullptr>
+  __device__ bool operator()(T const& lhs, T const& rhs) const
+  {
+    return lhs < rhs;
+  }
+};
+
+/**
+ * @brief Returns the position of the first of the values to replace equal to `value`, or -1,
+ * by a binary search of the values stably sorted with their positions.
+ *
+ * Equal values keep the order of their positions, so the first one found is the first one of
+ * the values to replace, as with the linear search.
+ */
+template <typename T>
+struct sorted_search_fn {
+  T const* sorted_values;
+  cudf::size_type const* positions;
+  cudf::size_type size;
+
+  __device__ cudf::size_type operator()(T const& value) const
+  {
+    auto const end = sorted_values + size;
+    auto const found =
+      thrust::lower_bound(thrust::seq, sorted_values, end, value, search_less<T>{});
+    if (found == end or not(*found == value)) { return -1; }
+    return positions[thrust::distance(sorted_values, found)];
+  }
+};
+
+/**
+ * @brief Sorts the values to replace in place, with their positions, and returns the
+ * `sorted_search_fn` of them. Both vectors must outlive the search.
+ */
+template <typename T>
+sorted_search_fn<T> sort_values_to_replace(rmm::device_vector<T>& values,
+                                           rmm::device_vector<cudf::size_type>& positions,
+                                           cudaStream_t stream)
+{
+  positions.resize(values.size());
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), positions.begin(), positions.end());
+  thrust::stable_sort_by_key(rmm::exec_policy(stream)->on(stream),
+                             values.begin(),
+                             values.end(),
+                             positions.begin(),
+                             search_less<T>{});
+  return sorted_search_fn<T>{
+    values.data().get(), positions.data().get(), static_cast<cudf::size_type>(values.size())};
+}
+
 // return the new_value for output column at index `idx`
-template <class T, bool replacement_has_nulls>
+template <class T, bool replacement_has_nulls, typename SearchFn>
 __device__ auto get_new_value(cudf::size_type idx,
                               const T* __restrict__ input_data,
-                              const T* __restrict__ values_to_replace_begin,
-                              const T* __restrict__ values_to_replace_end,
+                              SearchFn search_fn,
                               const T* __restrict__ d_replacement_values,
-                              cudf::bitmask_type const* __restrict__ replacement_valid)
+                              cudf::column_device_view const& replacement)
 {
-  auto found_ptr =
-    thrust::find(thrust::seq, values_to_replace_begin, values_to_replace_end, input_data[idx]);
+  auto const d = search_fn(input_data[idx]);
   T new_value{};
   bool output_is_valid{true};
 
-  if (found_ptr != values_to_replace_end) {
-    auto d    = thrust::distance(values_to_replace_begin, found_ptr);
+  if (d != -1) {
     new_value = d_replacement_values[d];
-    if (replacement_has_nulls) { output_is_valid = cudf::bit_is_set(replacement_valid, d); }
+    if (replacement_has_nulls) { output_is_valid = replacement.is_valid_nocheck(d); }
   } else {
     new_value = input_data[idx];
   }
   return thrust::make_pair(new_value, output_is_valid);
 }
 
-__device__ int get_new_string_value(cudf::size_type idx,
-                                    cudf::column_device_view& input,
-                                    cudf::column_device_view& values_to_replace,
-                                    cudf::column_device_view& replacement_values)
-{
-  cudf::string_view input_string = input.element<cudf::string_view>(idx);
-  int match                      = -1;
-  for (int i = 0; i < values_to_replace.size(); i++) {
-    cudf::string_view value_string = values_to_replace.element<cudf::string_view>(i);
-    if (input_string == value_string) {
-      match = i;
-      break;
-    }
-  }
-  return match;
-}
-
 /*
  * Kernel which does the first pass of strings replace. It computes the output null_mask,
  * null_count, and the offsets.
  *
  * @param input The input column to replace strings in.
- * @param values_to_replace The string values to replace.
+ * @param search_fn Returns the position of the first value to replace equal to a string, or -1
  * @param replacement The replacement values.
  * @param offsets The column which will contain the offsets of the new string column
  * @param indices Temporary column used to store the replacement indices
  * @param output_valid The output null_mask
  * @param output_valid_count The output valid count
  */
-template <bool input_has_nulls, bool replacement_has_nulls>
+template <bool input_has_nulls, bool replacement_has_nulls, typename SearchFn>
 __global__ void replace_strings_first_pass(cudf::column_device_view input,
-                                           cudf::column_device_view values_to_replace,
+                                           SearchFn search_fn,
                                            cudf::column_device_view replacement,
                                            cudf::mutable_column_device_view offsets,
                                            cudf::mutable_column_device_view indices,
@@ -140,7 +213,7 @@ __global__ void replace_strings_first_pass(cudf::column_device_view input,
     bool output_is_valid = input_is_valid;
 
     if (input_is_valid) {
-      int result               = get_new_string_value(i, input, values_to_replace, replacement);
+      int result               = search_fn(input.element<cudf::string_view>(i));
       cudf::string_view output = (result == -1) ? input.element<cudf::string_view>(i)
                                                 : replacement.element<cudf::string_view>(result);
       offsets.data<cudf::size_type>()[i] = output.size_bytes();
@@ -228,22 +301,19 @@ __global__ void replace_strings_second_pass(cudf::column_device_view input,
  * @param[out] output_valid Valid mask associated with output_data
  * @param[out] output_valid_count #valid in output column
  * @param[in] nrows # rows in `output_data`
- * @param[in] values_to_replace_begin Device pointer to the beginning of the sequence
- * of old values to be replaced
- * @param[in] values_to_replace_end  Device pointer to the end of the sequence
- * of old values to be replaced
- * @param[in] d_replacement_values Device array with the new values
- * @param[in] replacement_valid Valid mask associated with d_replacement_values
+ * @param[in] search_fn Returns the position of the first of the old values to be replaced
+ * equal to a value, or -1
+ * @param[in] replacement Column of the new values
  *
  * @returns
  */
 /* ----------------------------------------------------------------------------*/
-template <class T, bool input_has_nulls, bool replacement_has_nulls>
+template <class T, bool input_has_nulls, bool replacement_has_nulls, typename SearchFn>
 __global__ void replace_kernel(cudf::column_device_view input,
                                cudf::mutable_column_device_view output,
                                cudf::size_type* __restrict__ output_valid_count,
                                cudf::size_type nrows,
-                               cudf::column_device_view values_to_replace,
+                               SearchFn search_fn,
                                cudf::column_device_view replacement)
 {
   T* __restrict__ output_data = output.data<T>();
@@ -264,12 +334,7 @@ __global__ void replace_kernel(cudf::column_device_view input,
     }
     if (input_is_valid)
       thrust::tie(output_data[i], output_is_valid) = get_new_value<T, replacement_has_nulls>(
-        i,
-        input.data<T>(),
-        values_to_replace.data<T>(),
-        values_to_replace.data<T>() + values_to_replace.size(),
-        replacement.data<T>(),
-        replacement.null_mask());
+        i, input.data<T>(), search_fn, replacement.data<T>(), replacement);
 
     /* output valid counts calculations*/
     if (input_has_nulls or replacement_has_nulls) {
@@ -307,21 +372,6 @@ struct replace_kernel_forwarder {
     rmm::device_scalar<cudf::size_type> valid_counter(0, stream);
     cudf::size_type* valid_count = valid_counter.data();
 
-    auto replace = replace_kernel<col_type, true, true>;
-    if (input_col.has_nulls()) {
-      if (replacement_values.has_nulls()) {
-        replace = replace_kernel<col_type, true, true>;
-      } else {
-        replace = replace_kernel<col_type, true, false>;
-      }
-    } else {
-      if (replacement_values.has_nulls()) {
-        replace = replace_kernel<col_type, false, true>;
-      } else {
-        replace = replace_kernel<col_type, false, false>;
-      }
-    }
-
     std::unique_ptr<cudf::column> output;
     if (input_col.has_nulls() || replacement_values.has_nulls()) {
       output = cudf::detail::allocate_like(
@@ -337,15 +387,45 @@ struct replace_kernel_forwarder {
 
     auto device_in                 = cudf::column_device_view::create(input_col);
     auto device_out                = cudf::mutable_column_device_view::create(outputView);
-    auto device_values_to_replace  = cudf::column_device_view::create(values_to_replace);
     auto device_replacement_values = cudf::column_device_view::create(replacement_values);
 
-    replace<<<grid.num_blocks, BLOCK_SIZE, 0, stream>>>(*device_in,
-                                                        *device_out,
-                                                        valid_count,
-                                                        outputView.size(),
-                                                        *device_values_to_replace,
-                                                        *device_replacement_values);
+    auto launch = [&](auto search_fn) {
+      using SearchFn = decltype(search_fn);
+      auto replace   = replace_kernel<col_type, true, true, SearchFn>;
+      if (input_col.has_nulls()) {
+        if (replacement_values.has_nulls()) {
+          replace = replace_kernel<col_type, true, true, SearchFn>;
+        } else {
+          replace = replace_kernel<col_type, true, false, SearchFn>;
+        }
+      } else {
+        if (replacement_values.has_nulls()) {
+          replace = replace_kernel<col_type, false, true, SearchFn>;
+        } else {
+          replace = replace_kernel<col_type, false, false, SearchFn>;
+        }
+      }
+      replace<<<grid.num_blocks, BLOCK_SIZE, 0, stream>>>(*device_in,
+                                                          *device_out,
+                                                          valid_count,
+                                                          outputView.size(),
+                                                          search_fn,
+                                                          *device_replacement_values);
+    };
+
+    auto const values_begin = values_to_replace.data<col_type>();
+    auto const values_end   = values_begin + values_to_replace.size();
+    rmm::device_vector<col_type> sorted_values;
+    rmm::device_vector<cudf::size_type> positions;
+    if (values_to_replace.size() <= linear_search_threshold or
+        cudf::is_fixed_point<col_type>()) {
+      launch(linear_search_fn<col_type>{values_begin, values_end});
+    } else {
+      sorted_values.resize(values_to_replace.size());
+      thrust::copy(
+        rmm::exec_policy(stream)->on(stream), values_begin, values_end, sorted_values.begin());
+      launch(sort_values_to_replace(sorted_values, positions, stream));
+    }
 
     if (outputView.nullable()) {
       output->set_null_count(output->size() - valid_counter.value(stream));
@@ -375,19 +455,15 @@ std::unique_ptr<cudf::column> replace_kernel_forwarder::operator()<cudf::string_
   rmm::device_scalar<cudf::size_type> valid_counter(0, stream);
   cudf::size_type* valid_count = valid_counter.data();
 
-  auto replace_first  = replace_strings_first_pass<true, false>;
   auto replace_second = replace_strings_second_pass<true, false>;
   if (input_col.has_nulls()) {
     if (replacement_values.has_nulls()) {
-      replace_first  = replace_strings_first_pass<true, true>;
       replace_second = replace_strings_second_pass<true, true>;
     }
   } else {
     if (replacement_values.has_nulls()) {
-      replace_first  = replace_strings_first_pass<false, true>;
       replace_second = replace_strings_second_pass<false, true>;
     } else {
-      replace_first  = replace_strings_first_pass<false, false>;
       replace_second = replace_strings_second_pass<false, false>;
     }
   }
@@ -412,14 +488,45 @@ std::unique_ptr<cudf::column> replace_kernel_forwarder::operator()<cudf::string_
 
   // Call first pass kernel to get sizes in offsets
   cudf::detail::grid_1d grid{input_col.size(), BLOCK_SIZE, 1};
-  replace_first<<<grid.num_blocks, BLOCK_SIZE, 0, stream>>>(
-    *device_in,
-    *device_values_to_replace,
-    *device_replacement,
-    *device_sizes,
-    *device_indices,
-    reinterpret_cast<cudf::bitmask_type*>(valid_bits.data()),
-    valid_count);
+  auto launch_first = [&](auto search_fn) {
+    using SearchFn     = decltype(search_fn);
+    auto replace_first = replace_strings_first_pass<true, false, SearchFn>;
+    if (input_col.has_nulls()) {
+      if (replacement_values.has_nulls()) {
+        replace_first = replace_strings_first_pass<true, true, SearchFn>;
+      }
+    } else {
+      if (replacement_values.has_nulls()) {
+        replace_first = replace_strings_first_pass<false, true, SearchFn>;
+      } else {
+        replace_first = replace_strings_first_pass<false, false, SearchFn>;
+      }
+    }
+    replace_first<<<grid.num_blocks, BLOCK_SIZE, 0, stream>>>(
+      *device_in,
+      search_fn,
+      *device_replacement,
+      *device_sizes,
+      *device_indices,
+      reinterpret_cast<cudf::bitmask_type*>(valid_bits.data()),
+      valid_count);
+  };
+
+  rmm::device_vector<cudf::string_view> values(values_to_replace.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(values_to_replace.size()),
+                    values.begin(),
+                    [d_values = *device_values_to_replace] __device__(cudf::size_type i) {
+                      return d_values.element<cudf::string_view>(i);
+                    });
+  rmm::device_vector<cudf::size_type> positions;
+  if (values_to_replace.size() <= linear_search_threshold) {
+    launch_first(linear_search_fn<cudf::string_view>{values.data().get(),
+                                                     values.data().get() + values.size()});
+  } else {
+    launch_first(sort_values_to_replace(values, positions, stream));
+  }
 
   std::unique_ptr<cudf::column> offsets = cudf::strings::detail::make_offsets_child_column(
     sizes_view.begin<int32_t>(), sizes_view.end<int32_t>(), mr, stream);
@@ -791,6 +898,36 @@ std::unique_ptr<cudf::column> replace_nulls_scalar_kernel_forwarder::operator()<
   return cudf::strings::replace_nulls(input_s, repl, mr);
 }
 
+/**
+ * @brief Functor called by the `type_dispatcher` to overwrite the null elements
+ *        of a fixed-width column with a scalar.
+ */
+struct replace_nulls_in_place_kernel_forwarder {
+  template <typename col_type, std::enable_if_t<cudf::is_fixed_width<col_type>()>* = nullptr>
+  void operator()(cudf::mutable_column_view& input,
+                  cudf::scalar const& replacement,
+                  cudaStream_t stream)
+  {
+    using ScalarType = cudf::scalar_type_t<col_type>;
+    auto s1          = static_cast<ScalarType const&>(replacement);
+    auto device_in   = cudf::column_device_view::create(input, stream);
+
+    replace_nulls_functor<col_type> func(s1.data());
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      input.data<col_type>(),
+                      input.data<col_type>() + input.size(),
+                      cudf::detail::make_validity_iterator(*device_in),
+                      input.data<col_type>(),
+                      func);
+  }
+
+  template <typename col_type, std::enable_if_t<not cudf::is_fixed_width<col_type>()>* = nullptr>
+  void operator()(cudf::mutable_column_view&, cudf::scalar const&, cudaStream_t)
+  {
+    CUDF_FAIL("In-place null replacement requires a fixed-width column.");
+  }
+};
+
 }  // end anonymous namespace
 
 namespace cudf {
@@ -828,6 +965,22 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
     input.type(), replace_nulls_scalar_kernel_forwarder{}, input, replacement, mr, stream);
 }
 
+void replace_nulls_in_place(cudf::mutable_column_view& input,
+                            cudf::scalar const& replacement,
+                            cudaStream_t stream)
+{
+  CUDF_EXPECTS(input.type() == replacement.type(), "Data type mismatch");
+  CUDF_EXPECTS(replacement.is_valid(), "Replacement scalar must be valid");
+
+  if (!input.has_nulls()) { return; }
+
+  cudf::type_dispatcher(
+    input.type(), replace_nulls_in_place_kernel_forwarder{}, input, replacement, stream);
+  cudf::set_null_mask(
+    input.null_mask(), input.offset(), input.offset() + input.size(), true, stream);
+  input.set_null_count(0);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
@@ -845,6 +998,12 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
   CUDF_FUNC_RANGE();
   return cudf::detail::replace_nulls(input, replacement, mr, 0);
 }
+
+void replace_nulls_in_place(cudf::mutable_column_view& input, cudf::scalar const& replacement)
+{
+  CUDF_FUNC_RANGE();
+  cudf::detail::replace_nulls_in_place(input, replacement, 0);
+}
 }  // namespace cudf
 
 namespace cudf {
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace cudf {
+namespace {
+/**
+ * @brief Returns the number of rows list `i` explodes to, none for a null list
+ */
+struct exploded_size_fn {
+  column_device_view d_lists;
+  size_type const* d_offsets;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return d_lists.is_valid(i) ? d_offsets[i + 1] - d_offsets[i] : 0;
+  }
+};
+
+}  // anonymous namespace
+
+namespace detail {
+std::unique_ptr<table> explode(table_view const& input_table,
+                               size_type explode_column_idx,
+                               bool include_position,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(explode_column_idx >= 0 and explode_column_idx < input_table.num_columns(),
+               "Index of the column to explode is out of bounds");
+  lists_column_view const lists(input_table.column(explode_column_idx));
+  auto const num_rows  = lists.size();
+  auto const d_offsets = lists.offsets().data<size_type>() + lists.offset();
+  auto const d_lists   = column_device_view::create(lists.parent(), stream);
+  auto execpol         = rmm::exec_policy(stream);
+
+  // The offsets of the output rows of every list, with the null lists empty
+  rmm::device_vector<size_type> exploded_offsets(num_rows + 1, 0);
+  auto const sizes = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                     exploded_size_fn{*d_lists, d_offsets});
+  thrust::inclusive_scan(
+    execpol->on(stream), sizes, sizes + num_rows, exploded_offsets.begin() + 1);
+  size_type const num_output_rows = exploded_offsets.back();
+
+  // The list of output row `j` is the last list starting at or before `j`
+  rmm::device_vector<size_type> parent_rows(num_output_rows);
+  thrust::upper_bound(execpol->on(stream),
+                      exploded_offsets.begin(),
+                      exploded_offsets.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_output_rows),
+                      parent_rows.begin());
+  thrust::transform(execpol->on(stream),
+                    parent_rows.begin(),
+                    parent_rows.end(),
+                    parent_rows.begin(),
+                    [] __device__(size_type upper) { return upper - 1; });
+
+  std::vector<size_type> other_columns(input_table.num_columns() - 1);
+  std::iota(other_columns.begin(), other_columns.begin() + explode_column_idx, 0);
+  std::iota(other_columns.begin() + explode_column_idx,
+            other_columns.end(),
+            explode_column_idx + 1);
+  auto columns = detail::gather(input_table.select(other_columns),
+                                parent_rows.begin(),
+                                parent_rows.end(),
+                                false,
+                                mr,
+                                stream)
+                   ->release();
+
+  auto const d_exploded_offsets = exploded_offsets.data().get();
+  auto const d_parent_rows      = parent_rows.data().get();
+  std::unique_ptr<column> exploded;
+  if (not lists.has_nulls()) {
+    // Every element of the lists becomes a row, in order: the child is copied without a gather
+    exploded = std::make_unique<column>(lists.get_sliced_child(stream), stream, mr);
+  } else {
+    auto const elements = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d_offsets, d_exploded_offsets, d_parent_rows] __device__(size_type j) {
+        auto const row = d_parent_rows[j];
+        return d_offsets[row] + j - d_exploded_offsets[row];
+      });
+    exploded = std::move(detail::gather(table_view{{lists.child()}},
+                                        elements,
+                                        elements + num_output_rows,
+                                        false,
+                                        mr,
+                                        stream)
+                           ->release()
+                           .front());
+  }
+
+  auto insert_at = columns.begin() + explode_column_idx;
+  if (include_position) {
+    auto position = make_numeric_column(
+      data_type{type_id::INT32}, num_output_rows, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(execpol->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_output_rows),
+                      position->mutable_view().begin<size_type>(),
+                      [d_exploded_offsets, d_parent_rows] __device__(size_type j) {
+                        return j - d_exploded_offsets[d_parent_rows[j]];
+                      });
+    insert_at = columns.insert(insert_at, std::move(position)) + 1;
+  }
+  columns.insert(insert_at, std::move(exploded));
+  return std::make_unique<table>(std::move(columns));
+}
+}  // namespace detail
+
+std::unique_ptr<table> explode(table_view const& input_table,
+                               size_type explode_column_idx,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::explode(input_table, explode_column_idx, false, 0, mr);
+}
+
+std::unique_ptr<table> explode_position(table_view const& input_table,
+                                        size_type explode_column_idx,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::explode(input_table, explode_column_idx, true, 0, mr);
+}
+
+}  // namespace cudf
@@ -26,10 +26,13 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/rolling.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/types.hpp>
+#include <cudf/udf.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <rolling/rolling_detail.hpp>
 #include <rolling/rolling_jit_detail.hpp>
+#include <rolling/sliding_window.hpp>
 
 #include <jit/launcher.h>
 #include <jit/parser.h>
@@ -41,9 +44,16 @@
 #include <types.hpp.jit>
 
 #include <thrust/binary_search.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <rmm/device_scalar.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -512,6 +522,277 @@ struct dispatch_rolling {
   }
 };
 
+/**
+ * @brief The aggregations of a numeric column computed together by `gpu_multi_rolling`, as
+ * indices of their outputs.
+ */
+enum multi_rolling_slot : int {
+  SUM_SLOT,
+  MEAN_SLOT,
+  MIN_SLOT,
+  MAX_SLOT,
+  COUNT_VALID_SLOT,
+  COUNT_ALL_SLOT,
+  NUM_MULTI_ROLLING_SLOTS
+};
+
+/**
+ * @brief Returns the slot of `kind` in `multi_rolling_outputs`, or -1 if it is not computed by
+ * `gpu_multi_rolling`.
+ */
+int multi_rolling_slot_of(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM: return SUM_SLOT;
+    case aggregation::MEAN: return MEAN_SLOT;
+    case aggregation::MIN: return MIN_SLOT;
+    case aggregation::MAX: return MAX_SLOT;
+    case aggregation::COUNT_VALID: return COUNT_VALID_SLOT;
+    case aggregation::COUNT_ALL: return COUNT_ALL_SLOT;
+    default: return -1;
+  }
+}
+
+/**
+ * @brief The outputs of `gpu_multi_rolling`, with null pointers for the aggregations that are
+ * not requested.
+ */
+struct multi_rolling_outputs {
+  void* data[NUM_MULTI_ROLLING_SLOTS];
+  bitmask_type* null_mask[NUM_MULTI_ROLLING_SLOTS];
+};
+
+/**
+ * @brief Computes the SUM, MEAN, MIN, MAX, COUNT_VALID and COUNT_ALL rolling window functions of
+ * a numeric column, reading every window once for all of them.
+ *
+ * The results are computed as `gpu_rolling` computes every aggregation. The COUNT_ALL of a row is
+ * valid if its window has at least `min_periods` rows, all the others if it has at least
+ * `min_periods` valid rows.
+ *
+ * @param input Input column device view
+ * @param outputs The outputs of the requested aggregations
+ * @param valid_counts The number of rows with at least `min_periods` valid rows, followed by the
+ *                     number of rows with at least `min_periods` rows, both initialized to 0
+ * @param preceding_window_begin Rolling window size iterator in the backward direction
+ * @param following_window_begin Rolling window size iterator in the forward direction
+ * @param min_periods Minimum number of observations in window required to have a value
+ */
+template <typename T,
+          int block_size,
+          bool has_nulls,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+__launch_bounds__(block_size) __global__
+  void gpu_multi_rolling(column_device_view input,
+                         multi_rolling_outputs outputs,
+                         size_type* __restrict__ valid_counts,
+                         PrecedingWindowIterator preceding_window_begin,
+                         FollowingWindowIterator following_window_begin,
+                         size_type min_periods)
+{
+  using SumType  = target_type_t<T, aggregation::SUM>;
+  using MeanType = target_type_t<T, aggregation::MEAN>;
+
+  size_type i      = blockIdx.x * block_size + threadIdx.x;
+  size_type stride = block_size * gridDim.x;
+
+  size_type warp_valid_count{0};
+  size_type warp_all_valid_count{0};
+
+  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
+  while (i < input.size()) {
+    size_type preceding_window = preceding_window_begin[i];
+    size_type following_window = following_window_begin[i];
+
+    // compute bounds
+    size_type start       = min(input.size(), max(0, i - preceding_window + 1));
+    size_type end         = min(input.size(), max(0, i + following_window + 1));
+    size_type start_index = min(start, end);
+    size_type end_index   = max(start, end);
+
+    // aggregate
+    size_type count = 0;
+    SumType sum     = DeviceSum::identity<SumType>();
+    MeanType total  = DeviceSum::identity<MeanType>();
+    T minimum       = DeviceMin::identity<T>();
+    T maximum       = DeviceMax::identity<T>();
+    for (size_type j = start_index; j < end_index; j++) {
+      if (!has_nulls || input.is_valid(j)) {
+        T const element = input.element<T>(j);
+        sum             = DeviceSum{}(static_cast<SumType>(element), sum);
+        total           = DeviceSum{}(static_cast<MeanType>(element), total);
+        minimum         = DeviceMin{}(element, minimum);
+        maximum         = DeviceMax{}(element, maximum);
+        count++;
+      }
+    }
+
+    if (outputs.data[SUM_SLOT] != nullptr) {
+      static_cast<SumType*>(outputs.data[SUM_SLOT])[i] = sum;
+    }
+    if (outputs.data[MEAN_SLOT] != nullptr) {
+      rolling_store_output_functor<MeanType, true>{}(
+        static_cast<MeanType*>(outputs.data[MEAN_SLOT])[i], total, count);
+    }
+    if (outputs.data[MIN_SLOT] != nullptr) { static_cast<T*>(outputs.data[MIN_SLOT])[i] = minimum; }
+    if (outputs.data[MAX_SLOT] != nullptr) { static_cast<T*>(outputs.data[MAX_SLOT])[i] = maximum; }
+    if (outputs.data[COUNT_VALID_SLOT] != nullptr) {
+      static_cast<size_type*>(outputs.data[COUNT_VALID_SLOT])[i] = count;
+    }
+    if (outputs.data[COUNT_ALL_SLOT] != nullptr) {
+      static_cast<size_type*>(outputs.data[COUNT_ALL_SLOT])[i] = end_index - start_index;
+    }
+
+    // set the masks
+    cudf::bitmask_type const valid_mask{__ballot_sync(active_threads, count >= min_periods)};
+    cudf::bitmask_type const all_valid_mask{
+      __ballot_sync(active_threads, end_index - start_index >= min_periods)};
+
+    // only one thread writes the masks
+    if (0 == threadIdx.x % cudf::detail::warp_size) {
+      for (int slot = 0; slot < NUM_MULTI_ROLLING_SLOTS; ++slot) {
+        if (outputs.null_mask[slot] != nullptr) {
+          outputs.null_mask[slot][cudf::word_index(i)] =
+            slot == COUNT_ALL_SLOT ? all_valid_mask : valid_mask;
+        }
+      }
+      warp_valid_count += __popc(valid_mask);
+      warp_all_valid_count += __popc(all_valid_mask);
+    }
+
+    // process next element
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < input.size());
+  }
+
+  // sum the valid counts across the whole block
+  size_type block_valid_count =
+    cudf::detail::single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+  if (threadIdx.x == 0) { atomicAdd(&valid_counts[0], block_valid_count); }
+  // the reduction's shared memory is reused
+  __syncthreads();
+  size_type block_all_valid_count =
+    cudf::detail::single_lane_block_sum_reduce<block_size, 0>(warp_all_valid_count);
+  if (threadIdx.x == 0) { atomicAdd(&valid_counts[1], block_all_valid_count); }
+}
+
+/**
+ * @brief Returns whether `gpu_multi_rolling` computes the aggregation `kind` of a column of type
+ * `type`.
+ */
+bool is_multi_rolling_supported(data_type type, aggregation::Kind kind)
+{
+  return cudf::is_numeric(type) and type.id() != type_id::BOOL8 and
+         multi_rolling_slot_of(kind) >= 0;
+}
+
+struct dispatch_multi_rolling {
+  template <typename T,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator,
+            std::enable_if_t<cudf::is_numeric<T>() and not cudf::is_boolean<T>()>* = nullptr>
+  std::pair<size_type, size_type> operator()(column_view const& input,
+                                             multi_rolling_outputs const& outputs,
+                                             PrecedingWindowIterator preceding_window_begin,
+                                             FollowingWindowIterator following_window_begin,
+                                             size_type min_periods,
+                                             cudaStream_t stream)
+  {
+    constexpr cudf::size_type block_size = 256;
+    cudf::detail::grid_1d grid(input.size(), block_size);
+
+    auto input_device_view = column_device_view::create(input, stream);
+
+    rmm::device_vector<size_type> valid_counts(2, 0);
+
+    if (input.has_nulls()) {
+      gpu_multi_rolling<T, block_size, true><<<grid.num_blocks, block_size, 0, stream>>>(
+        *input_device_view,
+        outputs,
+        valid_counts.data().get(),
+        preceding_window_begin,
+        following_window_begin,
+        min_periods);
+    } else {
+      gpu_multi_rolling<T, block_size, false><<<grid.num_blocks, block_size, 0, stream>>>(
+        *input_device_view,
+        outputs,
+        valid_counts.data().get(),
+        preceding_window_begin,
+        following_window_begin,
+        min_periods);
+    }
+
+    // check the stream for debugging
+    CHECK_CUDA(stream);
+
+    std::vector<size_type> h_valid_counts(2);
+    CUDA_TRY(cudaMemcpyAsync(h_valid_counts.data(),
+                             valid_counts.data().get(),
+                             2 * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    return {h_valid_counts[0], h_valid_counts[1]};
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not(cudf::is_numeric<T>() and not cudf::is_boolean<T>()),
+                   std::pair<size_type, size_type>>
+  operator()(Args&&...)
+  {
+    CUDF_FAIL("Only numeric columns are aggregated together");
+  }
+};
+
+/**
+ * @brief Computes the preceding window size of a row of a fixed-size window clipped to the
+ * start of its group.
+ */
+struct grouped_preceding_fn {
+  size_type const* group_offsets;
+  size_type const* group_labels;
+  size_type preceding_window;
+
+  CUDA_DEVICE_CALLABLE size_type operator()(size_type idx) const
+  {
+    auto group_start = group_offsets[group_labels[idx]];
+    // Preceding includes current row.
+    return thrust::minimum<size_type>{}(preceding_window, idx - group_start + 1);
+  }
+};
+
+/**
+ * @brief Computes the following window size of a row of a fixed-size window clipped to the end
+ * of its group.
+ */
+struct grouped_following_fn {
+  size_type const* group_offsets;
+  size_type const* group_labels;
+  size_type following_window;
+
+  CUDA_DEVICE_CALLABLE size_type operator()(size_type idx) const
+  {
+    // Cannot fall off the end, since offsets is capped with `input.size()`.
+    auto group_end = group_offsets[group_labels[idx] + 1];
+    return thrust::minimum<size_type>{}(following_window, (group_end - 1) - idx);
+  }
+};
+
+/**
+ * @brief Returns the results of `aggs` over an empty `input`.
+ */
+std::vector<std::unique_ptr<column>> empty_results(
+  column_view const& input, std::vector<std::unique_ptr<aggregation>> const& aggs)
+{
+  std::vector<std::unique_ptr<column>> results;
+  std::transform(aggs.begin(), aggs.end(), std::back_inserter(results), [&input](auto const&) {
+    return empty_like(input);
+  });
+  return results;
+}
+
 }  // namespace
 
 // Applies a user-defined rolling window function to the values in a column.
@@ -537,27 +818,39 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
 
   auto udf_agg = static_cast<udf_aggregation*>(agg.get());
 
-  std::string hash = "prog_rolling." + std::to_string(std::hash<std::string>{}(udf_agg->_source));
-
-  std::string cuda_source;
-  switch (udf_agg->kind) {
-    case aggregation::Kind::PTX:
-      cuda_source = cudf::rolling::jit::code::kernel_headers;
-      cuda_source +=
-        cudf::jit::parse_single_function_ptx(udf_agg->_source,
-                                             udf_agg->_function_name,
-                                             cudf::jit::get_type_name(udf_agg->_output_type),
-                                             {0, 5});  // args 0 and 5 are pointers.
-      cuda_source += cudf::rolling::jit::code::kernel;
-      break;
-    case aggregation::Kind::CUDA:
-      cuda_source = cudf::rolling::jit::code::kernel_headers;
-      cuda_source +=
-        cudf::jit::parse_single_function_cuda(udf_agg->_source, udf_agg->_function_name);
-      cuda_source += cudf::rolling::jit::code::kernel;
-      break;
-    default: CUDF_FAIL("Unsupported UDF type.");
+  auto build_source = [udf_agg] {
+    std::string cuda_source;
+    switch (udf_agg->kind) {
+      case aggregation::Kind::PTX:
+        cuda_source = cudf::rolling::jit::code::kernel_headers;
+        cuda_source +=
+          cudf::jit::parse_single_function_ptx(udf_agg->_source,
+                                               udf_agg->_function_name,
+                                               cudf::jit::get_type_name(udf_agg->_output_type),
+                                               {0, 5});  // args 0 and 5 are pointers.
+        cuda_source += cudf::rolling::jit::code::kernel;
+        break;
+      case aggregation::Kind::CUDA:
+        cuda_source = cudf::rolling::jit::code::kernel_headers;
+        cuda_source +=
+          cudf::jit::parse_single_function_cuda(udf_agg->_source, udf_agg->_function_name);
+        cuda_source += cudf::rolling::jit::code::kernel;
+        break;
+      default: CUDF_FAIL("Unsupported UDF type.");
+    }
+    return cuda_source;
+  };
+
+  // A registered UDF is parsed only once, for all the rolling windows using it.
+  std::pair<std::string, std::string> unregistered_program;
+  if (udf_agg->_udf == nullptr) {
+    unregistered_program = std::make_pair(
+      "prog_rolling." + std::to_string(std::hash<std::string>{}(udf_agg->_source)),
+      build_source());
   }
+  auto const& program = udf_agg->_udf == nullptr
+                          ? unregistered_program
+                          : udf_agg->_udf->program("rolling", build_source);
 
   std::unique_ptr<column> output = make_numeric_column(
     udf_agg->_output_type, input.size(), cudf::mask_state::UNINITIALIZED, stream, mr);
@@ -572,8 +865,8 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
                                                 "-w"};
 
   // Launch the jitify kernel
-  cudf::jit::launcher(hash,
-                      cuda_source,
+  cudf::jit::launcher(program.first,
+                      program.second,
                       {cudf_types_hpp,
                        cudf_utilities_bit_hpp,
                        cudf::rolling::jit::code::operation_h,
@@ -640,6 +933,96 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                stream);
 }
 
+/**
+ * @brief Computes the rolling window functions `aggs` over the same windows, filling the results
+ * that are null in `results`.
+ *
+ * The SUM, MEAN, MIN, MAX, COUNT_VALID and COUNT_ALL aggregations of a numeric column are
+ * computed by a single kernel reading every window once. The other aggregations are computed
+ * one at a time over the same windows. An aggregation requested more than once is computed once.
+ *
+ * @param input The column to aggregate
+ * @param preceding_window_begin Rolling window size iterator in the backward direction
+ * @param following_window_begin Rolling window size iterator in the forward direction
+ * @param min_periods Minimum number of observations in window required to have a value
+ * @param aggs The rolling window aggregations, other than UDFs
+ * @param results The result of every aggregation of `aggs`, or null if it must be computed
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+void rolling_window(column_view const& input,
+                    PrecedingWindowIterator preceding_window_begin,
+                    FollowingWindowIterator following_window_begin,
+                    size_type min_periods,
+                    std::vector<std::unique_ptr<aggregation>> const& aggs,
+                    std::vector<std::unique_ptr<column>>& results,
+                    rmm::mr::device_memory_resource* mr,
+                    cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(std::none_of(aggs.begin(),
+                            aggs.end(),
+                            [](std::unique_ptr<aggregation> const& agg) {
+                              return agg->kind == aggregation::CUDA ||
+                                     agg->kind == aggregation::PTX;
+                            }),
+               "Rolling window with several aggregations does NOT support UDF.");
+
+  min_periods = std::max(min_periods, 0);
+
+  // the first aggregation of every slot computed by the fused kernel
+  std::vector<int> slot_aggs(NUM_MULTI_ROLLING_SLOTS, -1);
+  for (size_t idx = 0; idx < aggs.size(); ++idx) {
+    if (results[idx] == nullptr and is_multi_rolling_supported(input.type(), aggs[idx]->kind)) {
+      auto& slot_agg = slot_aggs[multi_rolling_slot_of(aggs[idx]->kind)];
+      if (slot_agg < 0) { slot_agg = static_cast<int>(idx); }
+    }
+  }
+
+  if (std::any_of(slot_aggs.begin(), slot_aggs.end(), [](int idx) { return idx >= 0; })) {
+    multi_rolling_outputs outputs{};
+    for (int slot = 0; slot < NUM_MULTI_ROLLING_SLOTS; ++slot) {
+      if (slot_aggs[slot] < 0) { continue; }
+      auto const kind = aggs[slot_aggs[slot]]->kind;
+      auto result     = make_fixed_width_column(
+        target_type(input.type(), kind), input.size(), mask_state::UNINITIALIZED, stream, mr);
+      outputs.data[slot]       = result->mutable_view().head();
+      outputs.null_mask[slot]  = result->mutable_view().null_mask();
+      results[slot_aggs[slot]] = std::move(result);
+    }
+
+    auto const valid_counts = cudf::type_dispatcher(input.type(),
+                                                    dispatch_multi_rolling{},
+                                                    input,
+                                                    outputs,
+                                                    preceding_window_begin,
+                                                    following_window_begin,
+                                                    min_periods,
+                                                    stream);
+
+    for (int slot = 0; slot < NUM_MULTI_ROLLING_SLOTS; ++slot) {
+      if (slot_aggs[slot] < 0) { continue; }
+      auto const valid_count = slot == COUNT_ALL_SLOT ? valid_counts.second : valid_counts.first;
+      results[slot_aggs[slot]]->set_null_count(input.size() - valid_count);
+    }
+  }
+
+  for (size_t idx = 0; idx < aggs.size(); ++idx) {
+    if (results[idx] != nullptr) { continue; }
+    // an aggregation requested again is copied from its first result
+    auto const duplicate = std::find_if(aggs.begin(), aggs.begin() + idx, [&](auto const& agg) {
+      return agg->is_equal(*aggs[idx]);
+    });
+    auto const first = duplicate - aggs.begin();
+    if (duplicate != aggs.begin() + idx) {
+      results[idx] = std::make_unique<column>(results[first]->view(), stream, mr);
+    } else {
+      results[idx] = rolling_window(
+        input, preceding_window_begin, following_window_begin, min_periods, aggs[idx], mr, stream);
+    }
+  }
+}
+
 }  // namespace detail
 
 // Applies a fixed-size rolling window function to the values in a column.
@@ -665,6 +1048,17 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                             agg,
                                             mr,
                                             0);
+  } else if (cudf::detail::is_sliding_window_supported(
+               input, preceding_window, following_window, agg->kind)) {
+    return cudf::detail::sliding_rolling_window(input,
+                                                nullptr,
+                                                nullptr,
+                                                preceding_window,
+                                                following_window,
+                                                min_periods,
+                                                agg->kind,
+                                                mr,
+                                                0);
   } else {
     auto preceding_window_begin = thrust::make_constant_iterator(preceding_window);
     auto following_window_begin = thrust::make_constant_iterator(following_window);
@@ -761,24 +1155,10 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
          group_offsets[group_offsets.size() - 1] == input.size() &&
          "Must have at least one group.");
 
-  auto preceding_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               preceding_window] __device__(size_type idx) {
-    auto group_label = d_group_labels[idx];
-    auto group_start = d_group_offsets[group_label];
-    return thrust::minimum<size_type>{}(preceding_window,
-                                        idx - group_start + 1);  // Preceding includes current row.
-  };
-
-  auto following_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               following_window] __device__(size_type idx) {
-    auto group_label = d_group_labels[idx];
-    auto group_end =
-      d_group_offsets[group_label +
-                      1];  // Cannot fall off the end, since offsets is capped with `input.size()`.
-    return thrust::minimum<size_type>{}(following_window, (group_end - 1) - idx);
-  };
+  cudf::detail::grouped_preceding_fn preceding_calculator{
+    group_offsets.data().get(), group_labels.data().get(), preceding_window};
+  cudf::detail::grouped_following_fn following_calculator{
+    group_offsets.data().get(), group_labels.data().get(), following_window};
 
   if (aggr->kind == aggregation::CUDA || aggr->kind == aggregation::PTX) {
     cudf::detail::preceding_window_wrapper grouped_preceding_window{
@@ -796,6 +1176,17 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                             aggr,
                                             mr,
                                             0);
+  } else if (cudf::detail::is_sliding_window_supported(
+               input, preceding_window, following_window, aggr->kind)) {
+    return cudf::detail::sliding_rolling_window(input,
+                                                group_offsets.data().get(),
+                                                group_labels.data().get(),
+                                                preceding_window,
+                                                following_window,
+                                                min_periods,
+                                                aggr->kind,
+                                                mr,
+                                                0);
   } else {
     return cudf::detail::rolling_window(
       input,
@@ -810,8 +1201,130 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
   }
 }
 
+// Applies several fixed-size rolling window functions to the values in a column.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  if (input.size() == 0) return cudf::detail::empty_results(input, aggs);
+  CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
+
+  std::vector<std::unique_ptr<column>> results(aggs.size());
+  for (size_t idx = 0; idx < aggs.size(); ++idx) {
+    if (cudf::detail::is_sliding_window_supported(
+          input, preceding_window, following_window, aggs[idx]->kind)) {
+      results[idx] = cudf::detail::sliding_rolling_window(input,
+                                                          nullptr,
+                                                          nullptr,
+                                                          preceding_window,
+                                                          following_window,
+                                                          min_periods,
+                                                          aggs[idx]->kind,
+                                                          mr,
+                                                          0);
+    }
+  }
+
+  cudf::detail::rolling_window(input,
+                               thrust::make_constant_iterator(preceding_window),
+                               thrust::make_constant_iterator(following_window),
+                               min_periods,
+                               aggs,
+                               results,
+                               mr,
+                               0);
+  return results;
+}
+
+std::vector<std::unique_ptr<column>> grouped_rolling_window(
+  table_view const& group_keys,
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  if (input.size() == 0) return cudf::detail::empty_results(input, aggs);
+
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == input.size()),
+               "Size mismatch between group_keys and input vector.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  if (group_keys.num_columns() == 0) {
+    // No Groupby columns specified. Treat as one big group.
+    return rolling_window(input, preceding_window, following_window, min_periods, aggs, mr);
+  }
+
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+
+  // the groups are found once for all the aggregations
+  sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
+  auto group_offsets{helper.group_offsets()};
+  auto const& group_labels{helper.group_labels()};
+
+  std::vector<std::unique_ptr<column>> results(aggs.size());
+  for (size_t idx = 0; idx < aggs.size(); ++idx) {
+    if (cudf::detail::is_sliding_window_supported(
+          input, preceding_window, following_window, aggs[idx]->kind)) {
+      results[idx] = cudf::detail::sliding_rolling_window(input,
+                                                          group_offsets.data().get(),
+                                                          group_labels.data().get(),
+                                                          preceding_window,
+                                                          following_window,
+                                                          min_periods,
+                                                          aggs[idx]->kind,
+                                                          mr,
+                                                          0);
+    }
+  }
+
+  cudf::detail::grouped_preceding_fn preceding_calculator{
+    group_offsets.data().get(), group_labels.data().get(), preceding_window};
+  cudf::detail::grouped_following_fn following_calculator{
+    group_offsets.data().get(), group_labels.data().get(), following_window};
+
+  cudf::detail::rolling_window(
+    input,
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    preceding_calculator),
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    following_calculator),
+    min_periods,
+    aggs,
+    results,
+    mr,
+    0);
+  return results;
+}
+
 namespace {
 
+/**
+ * @brief Returns the type of the range bounds of a window ordered by `orderby`: the duration of
+ * the same resolution for a timestamp, or the same type for any other numeric type.
+ */
+data_type range_type(data_type const& orderby)
+{
+  switch (orderby.id()) {
+    case type_id::TIMESTAMP_DAYS: return data_type{type_id::DURATION_DAYS};
+    case type_id::TIMESTAMP_SECONDS: return data_type{type_id::DURATION_SECONDS};
+    case type_id::TIMESTAMP_MILLISECONDS: return data_type{type_id::DURATION_MILLISECONDS};
+    case type_id::TIMESTAMP_MICROSECONDS: return data_type{type_id::DURATION_MICROSECONDS};
+    case type_id::TIMESTAMP_NANOSECONDS: return data_type{type_id::DURATION_NANOSECONDS};
+    default: return orderby;
+  }
+}
+
 bool is_supported_range_frame_unit(cudf::data_type const& data_type)
 {
   auto id = data_type.id();
@@ -839,286 +1352,349 @@ size_t multiplication_factor(cudf::data_type const& data_type)
   }
 }
 
-// Time-range window computation, with
-//   1. no grouping keys specified
-//   2. timetamps in ASCENDING order.
-// Treat as one single group.
-template <typename TimestampImpl_t>
-std::unique_ptr<column> time_range_window_ASC(column_view const& input,
-                                              column_view const& timestamp_column,
-                                              TimestampImpl_t preceding_window,
-                                              TimestampImpl_t following_window,
-                                              size_type min_periods,
-                                              std::unique_ptr<aggregation> const& aggr,
-                                              rmm::mr::device_memory_resource* mr)
-{
-  auto preceding_calculator = [d_timestamps = timestamp_column.data<TimestampImpl_t>(),
-                               preceding_window] __device__(size_type idx) {
-    auto group_start                = 0;
-    auto lowest_timestamp_in_window = d_timestamps[idx] - preceding_window;
-
-    return ((d_timestamps + idx) - thrust::lower_bound(thrust::seq,
-                                                       d_timestamps + group_start,
-                                                       d_timestamps + idx,
-                                                       lowest_timestamp_in_window)) +
-           1;  // Add 1, for `preceding` to account for current row.
-  };
+/**
+ * @brief Computes the orderby value at one end of the window of a row, `delta` below or above
+ * the value of the row, saturating instead of overflowing.
+ */
+template <typename T>
+struct range_bound_fn {
+  T const* orderby;
+  T delta;
+  bool below;
 
-  auto following_calculator = [num_rows     = input.size(),
-                               d_timestamps = timestamp_column.data<TimestampImpl_t>(),
-                               following_window] __device__(size_type idx) {
-    auto group_end                   = num_rows;
-    auto highest_timestamp_in_window = d_timestamps[idx] + following_window;
-
-    return (thrust::upper_bound(thrust::seq,
-                                d_timestamps + idx,
-                                d_timestamps + group_end,
-                                highest_timestamp_in_window) -
-            (d_timestamps + idx)) -
-           1;
-  };
+  CUDA_DEVICE_CALLABLE T operator()(size_type row) const
+  {
+    auto const value = orderby[row];
+    if (std::is_floating_point<T>::value) { return below ? value - delta : value + delta; }
+    if (below) {
+      return value < std::numeric_limits<T>::lowest() + delta ? std::numeric_limits<T>::lowest()
+                                                               : value - delta;
+    }
+    return value > std::numeric_limits<T>::max() - delta ? std::numeric_limits<T>::max()
+                                                          : value + delta;
+  }
+};
 
-  return cudf::detail::rolling_window(
-    input,
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    preceding_calculator),
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    following_calculator),
-    min_periods,
-    aggr,
-    mr);
+/**
+ * @brief Orders (group label, orderby value) pairs by group, then by value in the order the
+ * orderby column is sorted in.
+ */
+template <typename T>
+struct group_order_less {
+  bool ascending;
+
+  CUDA_DEVICE_CALLABLE bool operator()(thrust::tuple<size_type, T> const& lhs,
+                                       thrust::tuple<size_type, T> const& rhs) const
+  {
+    auto const lhs_group = thrust::get<0>(lhs);
+    auto const rhs_group = thrust::get<0>(rhs);
+    if (lhs_group != rhs_group) { return lhs_group < rhs_group; }
+    return ascending ? thrust::get<1>(lhs) < thrust::get<1>(rhs)
+                     : thrust::get<1>(rhs) < thrust::get<1>(lhs);
+  }
+};
+
+/**
+ * @brief Computes the `preceding` and `following` window sizes of every row of a range window.
+ *
+ * The window of a row spans the rows of its group whose orderby values lie within `preceding`
+ * before and `following` after its own. Since the rows are sorted by group and then by orderby
+ * value, its first row is the `lower_bound` of (group, value - preceding) and its end is the
+ * `upper_bound` of (group, value + following) in the whole column. Both are found for all rows
+ * at once by the vectorized binary searches.
+ */
+template <typename T, typename GroupLabelIterator>
+void range_window_sizes(GroupLabelIterator group_labels,
+                        T const* orderby,
+                        size_type num_rows,
+                        cudf::order order,
+                        T preceding,
+                        T following,
+                        size_type* preceding_sizes,
+                        size_type* following_sizes,
+                        cudaStream_t stream)
+{
+  auto const ascending     = order == cudf::order::ASCENDING;
+  auto const rows          = thrust::make_counting_iterator<size_type>(0);
+  auto const keys          = thrust::make_zip_iterator(thrust::make_tuple(group_labels, orderby));
+  auto const window_starts = thrust::make_zip_iterator(thrust::make_tuple(
+    group_labels,
+    thrust::make_transform_iterator(rows, range_bound_fn<T>{orderby, preceding, ascending})));
+  auto const window_ends   = thrust::make_zip_iterator(thrust::make_tuple(
+    group_labels,
+    thrust::make_transform_iterator(rows, range_bound_fn<T>{orderby, following, not ascending})));
+
+  auto execpol = rmm::exec_policy(stream);
+  thrust::lower_bound(execpol->on(stream),
+                      keys,
+                      keys + num_rows,
+                      window_starts,
+                      window_starts + num_rows,
+                      preceding_sizes,
+                      group_order_less<T>{ascending});
+  thrust::upper_bound(execpol->on(stream),
+                      keys,
+                      keys + num_rows,
+                      window_ends,
+                      window_ends + num_rows,
+                      following_sizes,
+                      group_order_less<T>{ascending});
+
+  // `preceding` accounts for the current row.
+  thrust::transform(execpol->on(stream),
+                    rows,
+                    rows + num_rows,
+                    preceding_sizes,
+                    preceding_sizes,
+                    [] __device__(size_type row, size_type start) { return row - start + 1; });
+  thrust::transform(execpol->on(stream),
+                    rows,
+                    rows + num_rows,
+                    following_sizes,
+                    following_sizes,
+                    [] __device__(size_type row, size_type end) { return end - row - 1; });
 }
 
-// Time-range window computation, for timestamps in ASCENDING order.
-template <typename TimestampImpl_t>
-std::unique_ptr<column> time_range_window_ASC(
+/**
+ * @brief Computes range window aggregations over `orderby`, whose values are of type `T`, or
+ * of the representation type `T` for timestamps.
+ *
+ * The window sizes are computed once for all the aggregations.
+ */
+template <typename T>
+std::vector<std::unique_ptr<column>> range_rolling_window(
   column_view const& input,
-  column_view const& timestamp_column,
-  rmm::device_vector<cudf::size_type> const& group_offsets,
+  column_view const& orderby,
+  cudf::order order,
   rmm::device_vector<cudf::size_type> const& group_labels,
-  TimestampImpl_t preceding_window,
-  TimestampImpl_t following_window,
+  T preceding_window,
+  T following_window,
   size_type min_periods,
-  std::unique_ptr<aggregation> const& aggr,
-  rmm::mr::device_memory_resource* mr)
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
-  auto preceding_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               d_timestamps    = timestamp_column.data<TimestampImpl_t>(),
-                               preceding_window] __device__(size_type idx) {
-    auto group_label                = d_group_labels[idx];
-    auto group_start                = d_group_offsets[group_label];
-    auto lowest_timestamp_in_window = d_timestamps[idx] - preceding_window;
-
-    return ((d_timestamps + idx) - thrust::lower_bound(thrust::seq,
-                                                       d_timestamps + group_start,
-                                                       d_timestamps + idx,
-                                                       lowest_timestamp_in_window)) +
-           1;  // Add 1, for `preceding` to account for current row.
-  };
+  CUDF_EXPECTS(std::none_of(aggs.begin(),
+                            aggs.end(),
+                            [](std::unique_ptr<aggregation> const& aggr) {
+                              return aggr->kind == aggregation::CUDA ||
+                                     aggr->kind == aggregation::PTX;
+                            }),
+               "Range rolling window does NOT (yet) support UDF.");
+
+  rmm::device_vector<size_type> preceding_sizes(input.size());
+  rmm::device_vector<size_type> following_sizes(input.size());
+  if (group_labels.empty()) {
+    range_window_sizes(thrust::make_constant_iterator<size_type>(0),
+                       orderby.data<T>(),
+                       input.size(),
+                       order,
+                       preceding_window,
+                       following_window,
+                       preceding_sizes.data().get(),
+                       following_sizes.data().get(),
+                       stream);
+  } else {
+    range_window_sizes(group_labels.data().get(),
+                       orderby.data<T>(),
+                       input.size(),
+                       order,
+                       preceding_window,
+                       following_window,
+                       preceding_sizes.data().get(),
+                       following_sizes.data().get(),
+                       stream);
+  }
 
-  auto following_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               d_timestamps    = timestamp_column.data<TimestampImpl_t>(),
-                               following_window] __device__(size_type idx) {
-    auto group_label = d_group_labels[idx];
-    auto group_end =
-      d_group_offsets[group_label +
-                      1];  // Cannot fall off the end, since offsets is capped with `input.size()`.
-    auto highest_timestamp_in_window = d_timestamps[idx] + following_window;
-
-    return (thrust::upper_bound(thrust::seq,
-                                d_timestamps + idx,
-                                d_timestamps + group_end,
-                                highest_timestamp_in_window) -
-            (d_timestamps + idx)) -
-           1;
-  };
+  std::vector<std::unique_ptr<column>> results(aggs.size());
+  cudf::detail::rolling_window(input,
+                               preceding_sizes.data().get(),
+                               following_sizes.data().get(),
+                               min_periods,
+                               aggs,
+                               results,
+                               mr,
+                               stream);
+  return results;
+}
 
-  return cudf::detail::rolling_window(
-    input,
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    preceding_calculator),
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    following_calculator),
-    min_periods,
-    aggr,
-    mr);
+/**
+ * @brief Reads a range bound of a window ordered by a column of type `T`.
+ */
+template <typename T, std::enable_if_t<not cudf::is_timestamp<T>()>* = nullptr>
+T range_value(scalar const& bound, cudaStream_t stream)
+{
+  return static_cast<numeric_scalar<T> const&>(bound).value(stream);
 }
 
-// Time-range window computation, with
-//   1. no grouping keys specified
-//   2. timetamps in DESCENDING order.
-// Treat as one single group.
-template <typename TimestampImpl_t>
-std::unique_ptr<column> time_range_window_DESC(column_view const& input,
-                                               column_view const& timestamp_column,
-                                               TimestampImpl_t preceding_window,
-                                               TimestampImpl_t following_window,
-                                               size_type min_periods,
-                                               std::unique_ptr<aggregation> const& aggr,
-                                               rmm::mr::device_memory_resource* mr)
+template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+typename T::rep range_value(scalar const& bound, cudaStream_t stream)
 {
-  auto preceding_calculator = [d_timestamps = timestamp_column.data<TimestampImpl_t>(),
-                               preceding_window] __device__(size_type idx) {
-    auto group_start                 = 0;
-    auto highest_timestamp_in_window = d_timestamps[idx] + preceding_window;
-
-    return ((d_timestamps + idx) -
-            thrust::lower_bound(thrust::seq,
-                                d_timestamps + group_start,
-                                d_timestamps + idx,
-                                highest_timestamp_in_window,
-                                thrust::greater<decltype(highest_timestamp_in_window)>())) +
-           1;  // Add 1, for `preceding` to account for current row.
-  };
+  return static_cast<duration_scalar<typename T::duration> const&>(bound).value(stream).count();
+}
 
-  auto following_calculator = [num_rows     = input.size(),
-                               d_timestamps = timestamp_column.data<TimestampImpl_t>(),
-                               following_window] __device__(size_type idx) {
-    auto group_end =
-      num_rows;  // Cannot fall off the end, since offsets is capped with `input.size()`.
-    auto lowest_timestamp_in_window = d_timestamps[idx] - following_window;
-
-    return (thrust::upper_bound(thrust::seq,
-                                d_timestamps + idx,
-                                d_timestamps + group_end,
-                                lowest_timestamp_in_window,
-                                thrust::greater<decltype(lowest_timestamp_in_window)>()) -
-            (d_timestamps + idx)) -
-           1;
-  };
+template <typename T>
+constexpr bool is_supported_range_type()
+{
+  return (cudf::is_numeric<T>() && !std::is_same<T, bool>::value) || cudf::is_timestamp<T>();
+}
 
-  return cudf::detail::rolling_window(
-    input,
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    preceding_calculator),
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    following_calculator),
-    min_periods,
-    aggr,
-    mr);
+struct dispatch_range_rolling_window {
+  template <typename T, std::enable_if_t<is_supported_range_type<T>()>* = nullptr>
+  std::vector<std::unique_ptr<column>> operator()(
+    column_view const& input,
+    column_view const& orderby,
+    cudf::order order,
+    rmm::device_vector<cudf::size_type> const& group_labels,
+    scalar const& preceding_window,
+    scalar const& following_window,
+    size_type min_periods,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+  {
+    auto const preceding = range_value<T>(preceding_window, stream);
+    auto const following = range_value<T>(following_window, stream);
+    using range_t        = std::remove_const_t<decltype(preceding)>;
+    CUDF_EXPECTS(!(preceding < range_t{0}) && !(following < range_t{0}),
+                 "Range window bounds must be non-negative");
+
+    return range_rolling_window<range_t>(input,
+                                         orderby,
+                                         order,
+                                         group_labels,
+                                         preceding,
+                                         following,
+                                         min_periods,
+                                         aggs,
+                                         mr,
+                                         stream);
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!is_supported_range_type<T>(), std::vector<std::unique_ptr<column>>>
+  operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported data-type for range-based rolling window operation!");
+  }
+};
+
+/**
+ * @brief Returns the group label of every row of `input` for the pre-sorted `group_keys`, or an
+ * empty vector if there are no group keys.
+ */
+rmm::device_vector<cudf::size_type> range_group_labels(table_view const& group_keys,
+                                                       column_view const& input)
+{
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == input.size()),
+               "Size mismatch between group_keys and input vector.");
+
+  if (group_keys.num_columns() == 0) { return rmm::device_vector<cudf::size_type>{}; }
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
+  return helper.group_labels();
 }
 
-// Time-range window computation, for timestamps in DESCENDING order.
-template <typename TimestampImpl_t>
-std::unique_ptr<column> time_range_window_DESC(
-  column_view const& input,
+/**
+ * @brief Computes time range window aggregations, for `grouped_time_range_rolling_window`.
+ */
+std::vector<std::unique_ptr<column>> time_range_rolling_window(
+  table_view const& group_keys,
   column_view const& timestamp_column,
-  rmm::device_vector<cudf::size_type> const& group_offsets,
-  rmm::device_vector<cudf::size_type> const& group_labels,
-  TimestampImpl_t preceding_window,
-  TimestampImpl_t following_window,
+  cudf::order const& timestamp_order,
+  column_view const& input,
+  size_type preceding_window_in_days,
+  size_type following_window_in_days,
   size_type min_periods,
-  std::unique_ptr<aggregation> const& aggr,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
   rmm::mr::device_memory_resource* mr)
 {
-  auto preceding_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               d_timestamps    = timestamp_column.data<TimestampImpl_t>(),
-                               preceding_window] __device__(size_type idx) {
-    auto group_label                 = d_group_labels[idx];
-    auto group_start                 = d_group_offsets[group_label];
-    auto highest_timestamp_in_window = d_timestamps[idx] + preceding_window;
-
-    return ((d_timestamps + idx) -
-            thrust::lower_bound(thrust::seq,
-                                d_timestamps + group_start,
-                                d_timestamps + idx,
-                                highest_timestamp_in_window,
-                                thrust::greater<decltype(highest_timestamp_in_window)>())) +
-           1;  // Add 1, for `preceding` to account for current row.
-  };
+  if (input.size() == 0) { return detail::empty_results(input, aggs); }
 
-  auto following_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               d_timestamps    = timestamp_column.data<TimestampImpl_t>(),
-                               following_window] __device__(size_type idx) {
-    auto group_label = d_group_labels[idx];
-    auto group_end =
-      d_group_offsets[group_label +
-                      1];  // Cannot fall off the end, since offsets is capped with `input.size()`.
-    auto lowest_timestamp_in_window = d_timestamps[idx] - following_window;
-
-    return (thrust::upper_bound(thrust::seq,
-                                d_timestamps + idx,
-                                d_timestamps + group_end,
-                                lowest_timestamp_in_window,
-                                thrust::greater<decltype(lowest_timestamp_in_window)>()) -
-            (d_timestamps + idx)) -
-           1;
-  };
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
 
-  if (aggr->kind == aggregation::CUDA || aggr->kind == aggregation::PTX) {
-    CUDF_FAIL("Time ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::detail::rolling_window(
-      input,
-      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                      preceding_calculator),
-      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                      following_calculator),
-      min_periods,
-      aggr,
-      mr,
-      0);
-  }
+  auto const group_labels = range_group_labels(group_keys, input);
+
+  // Assumes that `timestamp_column` is actually of a timestamp type.
+  CUDF_EXPECTS(is_supported_range_frame_unit(timestamp_column.type()),
+               "Unsupported data-type for `timestamp`-based rolling window operation!");
+
+  auto const mult_factor = static_cast<int64_t>(multiplication_factor(timestamp_column.type()));
+
+  return timestamp_column.type().id() == cudf::type_id::TIMESTAMP_DAYS
+           ? range_rolling_window<int32_t>(input,
+                                           timestamp_column,
+                                           timestamp_order,
+                                           group_labels,
+                                           preceding_window_in_days,
+                                           following_window_in_days,
+                                           min_periods,
+                                           aggs,
+                                           mr,
+                                           0)
+           : range_rolling_window<int64_t>(input,
+                                           timestamp_column,
+                                           timestamp_order,
+                                           group_labels,
+                                           preceding_window_in_days * mult_factor,
+                                           following_window_in_days * mult_factor,
+                                           min_periods,
+                                           aggs,
+                                           mr,
+                                           0);
 }
 
-template <typename TimestampImpl_t>
-std::unique_ptr<column> grouped_time_range_rolling_window_impl(
+/**
+ * @brief Computes value range window aggregations, for `grouped_range_rolling_window`.
+ */
+std::vector<std::unique_ptr<column>> value_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
   column_view const& input,
-  column_view const& timestamp_column,
-  cudf::order const& timestamp_ordering,
-  rmm::device_vector<cudf::size_type> const& group_offsets,
-  rmm::device_vector<cudf::size_type> const& group_labels,
-  size_type preceding_window_in_days,  // TODO: Consider taking offset-type as type_id. Assumes days
-                                       // for now.
-  size_type following_window_in_days,
+  scalar const& preceding_window,
+  scalar const& following_window,
   size_type min_periods,
-  std::unique_ptr<aggregation> const& aggr,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
   rmm::mr::device_memory_resource* mr)
 {
-  TimestampImpl_t mult_factor{
-    static_cast<TimestampImpl_t>(multiplication_factor(timestamp_column.type()))};
-
-  if (timestamp_ordering == cudf::order::ASCENDING) {
-    return (group_offsets.size() == 0)
-             ? time_range_window_ASC(input,
-                                     timestamp_column,
-                                     preceding_window_in_days * mult_factor,
-                                     following_window_in_days * mult_factor,
-                                     min_periods,
-                                     aggr,
-                                     mr)
-             : time_range_window_ASC(input,
-                                     timestamp_column,
-                                     group_offsets,
-                                     group_labels,
-                                     preceding_window_in_days * mult_factor,
-                                     following_window_in_days * mult_factor,
-                                     min_periods,
-                                     aggr,
-                                     mr);
-  } else {
-    return (group_offsets.size() == 0)
-             ? time_range_window_DESC(input,
-                                      timestamp_column,
-                                      preceding_window_in_days * mult_factor,
-                                      following_window_in_days * mult_factor,
-                                      min_periods,
-                                      aggr,
-                                      mr)
-             : time_range_window_DESC(input,
-                                      timestamp_column,
-                                      group_offsets,
-                                      group_labels,
-                                      preceding_window_in_days * mult_factor,
-                                      following_window_in_days * mult_factor,
-                                      min_periods,
-                                      aggr,
-                                      mr);
-  }
+  if (input.size() == 0) { return detail::empty_results(input, aggs); }
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+  CUDF_EXPECTS(orderby_column.size() == input.size(),
+               "Size mismatch between orderby_column and input vector.");
+  CUDF_EXPECTS(!orderby_column.has_nulls(), "orderby_column must not have nulls.");
+  CUDF_EXPECTS(preceding_window.type() == range_type(orderby_column.type()) &&
+                 following_window.type() == range_type(orderby_column.type()),
+               "Range window bounds must match the type of orderby_column.");
+  CUDF_EXPECTS(preceding_window.is_valid() && following_window.is_valid(),
+               "Range window bounds must be valid.");
+
+  auto const group_labels = range_group_labels(group_keys, input);
+
+  return cudf::type_dispatcher(orderby_column.type(),
+                               dispatch_range_rolling_window{},
+                               input,
+                               orderby_column,
+                               order,
+                               group_labels,
+                               preceding_window,
+                               following_window,
+                               min_periods,
+                               aggs,
+                               mr,
+                               0);
+}
+
+/**
+ * @brief Returns the single aggregation `aggr` as a vector of aggregations.
+ */
+std::vector<std::unique_ptr<aggregation>> single_aggregation(
+  std::unique_ptr<aggregation> const& aggr)
+{
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(aggr->clone());
+  return aggs;
 }
 
 }  // namespace
@@ -1134,49 +1710,85 @@ std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& grou
                                                           rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
+  return std::move(time_range_rolling_window(group_keys,
+                                             timestamp_column,
+                                             timestamp_order,
+                                             input,
+                                             preceding_window_in_days,
+                                             following_window_in_days,
+                                             min_periods,
+                                             single_aggregation(aggr),
+                                             mr)
+                     .front());
+}
 
-  if (input.size() == 0) return empty_like(input);
-
-  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == input.size()),
-               "Size mismatch between group_keys and input vector.");
-
-  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
-
-  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
-  using index_vector        = sort_groupby_helper::index_vector;
-
-  index_vector group_offsets, group_labels;
-  if (group_keys.num_columns() > 0) {
-    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
-    group_offsets = helper.group_offsets();
-    group_labels  = helper.group_labels();
-  }
+std::vector<std::unique_ptr<column>> grouped_time_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& timestamp_column,
+  cudf::order const& timestamp_order,
+  column_view const& input,
+  size_type preceding_window_in_days,
+  size_type following_window_in_days,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return time_range_rolling_window(group_keys,
+                                   timestamp_column,
+                                   timestamp_order,
+                                   input,
+                                   preceding_window_in_days,
+                                   following_window_in_days,
+                                   min_periods,
+                                   aggs,
+                                   mr);
+}
 
-  // Assumes that `timestamp_column` is actually of a timestamp type.
-  CUDF_EXPECTS(is_supported_range_frame_unit(timestamp_column.type()),
-               "Unsupported data-type for `timestamp`-based rolling window operation!");
+std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_keys,
+                                                     column_view const& orderby_column,
+                                                     cudf::order const& order,
+                                                     column_view const& input,
+                                                     scalar const& preceding_window,
+                                                     scalar const& following_window,
+                                                     size_type min_periods,
+                                                     std::unique_ptr<aggregation> const& aggr,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return std::move(value_range_rolling_window(group_keys,
+                                              orderby_column,
+                                              order,
+                                              input,
+                                              preceding_window,
+                                              following_window,
+                                              min_periods,
+                                              single_aggregation(aggr),
+                                              mr)
+                     .front());
+}
 
-  return timestamp_column.type().id() == cudf::type_id::TIMESTAMP_DAYS
-           ? grouped_time_range_rolling_window_impl<int32_t>(input,
-                                                             timestamp_column,
-                                                             timestamp_order,
-                                                             group_offsets,
-                                                             group_labels,
-                                                             preceding_window_in_days,
-                                                             following_window_in_days,
-                                                             min_periods,
-                                                             aggr,
-                                                             mr)
-           : grouped_time_range_rolling_window_impl<int64_t>(input,
-                                                             timestamp_column,
-                                                             timestamp_order,
-                                                             group_offsets,
-                                                             group_labels,
-                                                             preceding_window_in_days,
-                                                             following_window_in_days,
-                                                             min_periods,
-                                                             aggr,
-                                                             mr);
+std::vector<std::unique_ptr<column>> grouped_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  column_view const& input,
+  scalar const& preceding_window,
+  scalar const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return value_range_rolling_window(group_keys,
+                                    orderby_column,
+                                    order,
+                                    input,
+                                    preceding_window,
+                                    following_window,
+                                    min_periods,
+                                    aggs,
+                                    mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rolling/sliding_window.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Bounds of the window of a row, and of the block of a row for the MIN and MAX scans
+ *
+ * Blocks of `block_size` rows start at the first row of every group, and the last block of a
+ * group ends with it.
+ */
+struct window_bounds {
+  size_type const* group_offsets;
+  size_type const* group_labels;
+  size_type size;
+  size_type preceding_window;
+  size_type following_window;
+  size_type block_size;
+
+  __device__ size_type group_start(size_type i) const
+  {
+    return group_labels == nullptr ? 0 : group_offsets[group_labels[i]];
+  }
+
+  __device__ size_type group_end(size_type i) const
+  {
+    return group_labels == nullptr ? size : group_offsets[group_labels[i] + 1];
+  }
+
+  // First row of the window of row `i`
+  __device__ size_type start(size_type i) const
+  {
+    auto const first = group_start(i);
+    return i - first < preceding_window ? first : i - preceding_window + 1;
+  }
+
+  // One past the last row of the window of row `i`
+  __device__ size_type end(size_type i) const
+  {
+    auto const last = group_end(i);
+    return last - i - 1 <= following_window ? last : i + following_window + 1;
+  }
+
+  // First row of the block of row `i`
+  __device__ size_type block(size_type i) const
+  {
+    auto const first = group_start(i);
+    return first + (i - first) / block_size * block_size;
+  }
+};
+
+struct block_fn {
+  window_bounds bounds;
+
+  __device__ size_type operator()(size_type i) const { return bounds.block(i); }
+};
+
+struct is_valid_fn {
+  column_device_view input;
+
+  __device__ size_type operator()(size_type i) const { return input.is_valid(i); }
+};
+
+/**
+ * @brief Returns the valid elements sign extended to 64 bits, and 0 for the null elements
+ *
+ * Sums of these values wrap around like the INT64 accumulator of the rolling SUM.
+ */
+template <typename T>
+struct sum_value_fn {
+  column_device_view input;
+
+  __device__ uint64_t operator()(size_type i) const
+  {
+    return input.is_valid(i) ? static_cast<uint64_t>(static_cast<int64_t>(input.element<T>(i)))
+                             : uint64_t{0};
+  }
+};
+
+template <typename T, typename Op>
+struct value_or_identity_fn {
+  column_device_view input;
+
+  __device__ T operator()(size_type i) const
+  {
+    return input.is_valid(i) ? input.element<T>(i) : Op::template identity<T>();
+  }
+};
+
+template <typename Op>
+struct combine_fn {
+  template <typename T>
+  __device__ T operator()(T const& lhs, T const& rhs) const
+  {
+    return Op{}(lhs, rhs);
+  }
+};
+
+struct count_result {
+  __device__ size_type operator()(size_type, size_type, size_type count) const { return count; }
+};
+
+template <bool is_mean>
+struct sum_result {
+  uint64_t const* prefix;  // Exclusive prefix sums of the values
+
+  __device__ std::conditional_t<is_mean, double, int64_t> operator()(size_type start,
+                                                                     size_type end,
+                                                                     size_type count) const
+  {
+    auto const sum = static_cast<int64_t>(prefix[end] - prefix[start]);
+    if (is_mean) { return static_cast<double>(sum) / count; }
+    return sum;
+  }
+};
+
+template <typename T, typename Op>
+struct extremum_result {
+  window_bounds bounds;
+  T const* prefix;  // Inclusive scans of every block from its first row
+  T const* suffix;  // Inclusive scans of every block from its last row
+
+  __device__ T operator()(size_type start, size_type end, size_type) const
+  {
+    if (start == end) { return Op::template identity<T>(); }
+    auto const last  = end - 1;
+    auto const block = bounds.block(start);
+    if (block != bounds.block(last)) { return Op{}(suffix[start], prefix[last]); }
+    // A window within one block starts or ends with it
+    return start == block ? prefix[last] : suffix[start];
+  }
+};
+
+/**
+ * @brief Writes the result of the window of a row and returns its validity
+ */
+template <typename OutputType, typename Result>
+struct window_writer {
+  window_bounds bounds;
+  size_type const* valid_prefix;  // Exclusive prefix counts of valid rows, or null to count all
+  size_type min_periods;
+  Result result;
+  OutputType* output;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const start = bounds.start(i);
+    auto const end   = bounds.end(i);
+    auto const count =
+      valid_prefix == nullptr ? end - start : valid_prefix[end] - valid_prefix[start];
+    output[i] = result(start, end, count);
+    return count >= min_periods;
+  }
+};
+
+template <typename OutputType, typename Result>
+std::unique_ptr<column> write_windows(window_bounds const& bounds,
+                                      size_type const* valid_prefix,
+                                      size_type min_periods,
+                                      Result result,
+                                      data_type output_type,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  auto output =
+    make_fixed_width_column(output_type, bounds.size, mask_state::UNALLOCATED, stream, mr);
+  auto writer = window_writer<OutputType, Result>{
+    bounds, valid_prefix, min_periods, result, output->mutable_view().data<OutputType>()};
+  auto mask = valid_if(thrust::make_counting_iterator<size_type>(0),
+                       thrust::make_counting_iterator<size_type>(bounds.size),
+                       writer,
+                       stream,
+                       mr);
+  output->set_null_mask(std::move(mask.first), mask.second);
+  return output;
+}
+
+struct sum_window_fn {
+  template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_device_view const& input,
+                                     window_bounds const& bounds,
+                                     size_type const* valid_prefix,
+                                     size_type min_periods,
+                                     aggregation::Kind kind,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const
+  {
+    rmm::device_vector<uint64_t> prefix(bounds.size + 1, 0);
+    auto values = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                  sum_value_fn<T>{input});
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream)->on(stream), values, values + bounds.size, prefix.begin() + 1);
+
+    auto const output_type = target_type(input.type(), kind);
+    if (kind == aggregation::MEAN) {
+      return write_windows<double>(bounds,
+                                   valid_prefix,
+                                   min_periods,
+                                   sum_result<true>{prefix.data().get()},
+                                   output_type,
+                                   mr,
+                                   stream);
+    }
+    return write_windows<int64_t>(bounds,
+                                  valid_prefix,
+                                  min_periods,
+                                  sum_result<false>{prefix.data().get()},
+                                  output_type,
+                                  mr,
+                                  stream);
+  }
+
+  template <typename T, std::enable_if_t<not std::is_integral<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_device_view const&,
+                                     window_bounds const&,
+                                     size_type const*,
+                                     size_type,
+                                     aggregation::Kind,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t) const
+  {
+    CUDF_FAIL("Unsupported type for a sliding window sum");
+  }
+};
+
+template <typename Op>
+struct extremum_window_fn {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_numeric<T>() and not std::is_same<T, bool>::value;
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_device_view const& input,
+                                     window_bounds const& bounds,
+                                     size_type const* valid_prefix,
+                                     size_type min_periods,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const
+  {
+    auto const size = bounds.size;
+
+    auto keys   = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                block_fn{bounds});
+    auto values = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                  value_or_identity_fn<T, Op>{input});
+
+    rmm::device_vector<T> prefix(size);
+    rmm::device_vector<T> suffix(size);
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  keys,
+                                  keys + size,
+                                  values,
+                                  prefix.begin(),
+                                  thrust::equal_to<size_type>{},
+                                  combine_fn<Op>{});
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  thrust::make_reverse_iterator(keys + size),
+                                  thrust::make_reverse_iterator(keys),
+                                  thrust::make_reverse_iterator(values + size),
+                                  suffix.rbegin(),
+                                  thrust::equal_to<size_type>{},
+                                  combine_fn<Op>{});
+
+    auto const result = extremum_result<T, Op>{bounds, prefix.data().get(), suffix.data().get()};
+    return write_windows<T>(bounds, valid_prefix, min_periods, result, input.type(), mr, stream);
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_device_view const&,
+                                     window_bounds const&,
+                                     size_type const*,
+                                     size_type,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t) const
+  {
+    CUDF_FAIL("Unsupported type for a sliding window minimum or maximum");
+  }
+};
+
+}  // namespace
+
+bool is_sliding_window_supported(column_view const& input,
+                                 size_type preceding_window,
+                                 size_type following_window,
+                                 aggregation::Kind kind)
+{
+  if (preceding_window < 1 or following_window < 0) { return false; }
+  auto const window_size = static_cast<int64_t>(preceding_window) + following_window;
+  if (window_size < sliding_window_min_size) { return false; }
+
+  auto const type        = input.type();
+  auto const is_integral = is_numeric(type) and not is_floating_point(type);
+  switch (kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return true;
+    case aggregation::SUM: return is_integral;
+    // Larger values could overflow the INT64 prefix sums where the FLOAT64 sum does not
+    case aggregation::MEAN: return is_integral and size_of(type) <= sizeof(int32_t);
+    case aggregation::MIN:
+    case aggregation::MAX: return is_numeric(type) and type.id() != type_id::BOOL8;
+    default: return false;
+  }
+}
+
+std::unique_ptr<column> sliding_rolling_window(column_view const& input,
+                                               size_type const* group_offsets,
+                                               size_type const* group_labels,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               aggregation::Kind kind,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_sliding_window_supported(input, preceding_window, following_window, kind),
+               "Unsupported sliding window aggregation");
+
+  min_periods = std::max(min_periods, 0);
+
+  // A window spans at most two blocks of its size; a shorter window is clipped by a group
+  // boundary, which is also a block boundary
+  auto const window_size = static_cast<int64_t>(preceding_window) + following_window;
+  auto const block_size  = std::max<int64_t>(1, std::min<int64_t>(window_size, input.size()));
+  auto const bounds      = window_bounds{group_offsets,
+                                         group_labels,
+                                         input.size(),
+                                         preceding_window,
+                                         following_window,
+                                         static_cast<size_type>(block_size)};
+
+  auto d_input = column_device_view::create(input, stream);
+
+  // Exclusive prefix counts of the valid rows, which COUNT_ALL and non-nullable inputs skip
+  rmm::device_vector<size_type> valid_prefix;
+  if (kind != aggregation::COUNT_ALL and input.nullable()) {
+    valid_prefix.resize(input.size() + 1, 0);
+    auto validity = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                    is_valid_fn{*d_input});
+    thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           validity,
+                           validity + input.size(),
+                           valid_prefix.begin() + 1);
+  }
+  auto const d_valid_prefix = valid_prefix.empty() ? nullptr : valid_prefix.data().get();
+
+  switch (kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+      return write_windows<size_type>(bounds,
+                                      d_valid_prefix,
+                                      min_periods,
+                                      count_result{},
+                                      target_type(input.type(), kind),
+                                      mr,
+                                      stream);
+    case aggregation::SUM:
+    case aggregation::MEAN:
+      return type_dispatcher(input.type(),
+                             sum_window_fn{},
+                             *d_input,
+                             bounds,
+                             d_valid_prefix,
+                             min_periods,
+                             kind,
+                             mr,
+                             stream);
+    case aggregation::MIN:
+      return type_dispatcher(input.type(),
+                             extremum_window_fn<DeviceMin>{},
+                             *d_input,
+                             bounds,
+                             d_valid_prefix,
+                             min_periods,
+                             mr,
+                             stream);
+    default:
+      return type_dispatcher(input.type(),
+                             extremum_window_fn<DeviceMax>{},
+                             *d_input,
+                             bounds,
+                             d_valid_prefix,
+                             min_periods,
+                             mr,
+                             stream);
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Smallest window, `preceding_window + following_window`, for which the sliding window
+ * algorithms replace aggregating every window.
+ */
+constexpr size_type sliding_window_min_size = 128;
+
+/**
+ * @brief Returns whether `sliding_rolling_window` computes a fixed-size rolling window.
+ *
+ * COUNT_VALID and COUNT_ALL of any type, SUM of integral and BOOL8 types, MEAN of integral types
+ * of at most 32 bits, and MIN and MAX of numeric types other than BOOL8 are supported, for
+ * windows including the current row of at least `sliding_window_min_size` rows.
+ *
+ * Floating-point SUM and MEAN are not supported, since subtracting prefix sums is not exact and
+ * an infinity or NaN would spoil all the following windows.
+ */
+bool is_sliding_window_supported(column_view const& input,
+                                 size_type preceding_window,
+                                 size_type following_window,
+                                 aggregation::Kind kind);
+
+/**
+ * @brief Computes a fixed-size rolling window aggregation in O(1) amortized time per row.
+ *
+ * SUM, MEAN and the counts are differences of prefix sums. MIN and MAX combine a prefix and a
+ * suffix scan over blocks of the window size (van Herk/Gil-Werman), since a window spans at most
+ * two blocks.
+ *
+ * Windows are clipped to the groups given by `group_offsets` and `group_labels`, as computed by
+ * `sort_groupby_helper`, or to the column when they are null.
+ *
+ * @param input The column to aggregate
+ * @param group_offsets Offsets of the groups in `input` followed by `input.size()`, or nullptr
+ * @param group_labels Group of every row of `input`, or nullptr
+ * @param preceding_window Rows in the window up to the current row, inclusive
+ * @param following_window Rows in the window after the current row
+ * @param min_periods Minimum number of valid rows in a window for a non-null result
+ * @param kind The aggregation, supported according to `is_sliding_window_supported`
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The aggregation of the window of every row
+ */
+std::unique_ptr<column> sliding_rolling_window(
+  column_view const& input,
+  size_type const* group_offsets,
+  size_type const* group_labels,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  aggregation::Kind kind,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/row_conversion.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr size_type row_alignment{8};
+constexpr size_type string_entry_size{8};
+constexpr int block_size{256};
+// Tiles of rows are staged in shared memory so that the columns are read or written coalesced,
+// while the rows are copied one 8-byte word after the other
+constexpr size_type tile_bytes{16 * 1024};
+constexpr size_type max_tile_bytes{48 * 1024};
+
+/**
+ * @brief Offset and number of characters of a STRING value, in the fixed-width part of a row
+ */
+struct string_entry {
+  uint32_t offset;
+  uint32_t length;
+};
+
+/**
+ * @brief Positions of the values in the fixed-width part of a row
+ */
+struct row_layout {
+  std::vector<size_type> column_offsets;
+  std::vector<size_type> column_sizes;
+  std::vector<size_type> string_columns;
+  size_type validity_offset;
+  size_type fixed_size;  ///< Size of the values and validity bytes, padded to `row_alignment`
+
+  explicit row_layout(std::vector<data_type> const& schema)
+  {
+    CUDF_EXPECTS(not schema.empty(), "Rows must have at least one column");
+    size_type offset{0};
+    for (size_t c = 0; c < schema.size(); ++c) {
+      auto const type = schema[c];
+      CUDF_EXPECTS(is_fixed_width(type) || type.id() == type_id::STRING,
+                   "Only fixed-width and STRING columns can be converted to rows");
+      bool const is_string = type.id() == type_id::STRING;
+      size_type const size =
+        is_string ? string_entry_size : static_cast<size_type>(size_of(type));
+      // A string entry is a pair of 32-bit integers
+      size_type const alignment = is_string ? static_cast<size_type>(sizeof(uint32_t)) : size;
+      offset                    = util::round_up_safe(offset, alignment);
+      column_offsets.push_back(offset);
+      column_sizes.push_back(size);
+      if (is_string) { string_columns.push_back(c); }
+      offset += size;
+    }
+    validity_offset = offset;
+    fixed_size      = util::round_up_safe(
+      validity_offset + util::div_rounding_up_safe<size_type>(schema.size(), CHAR_BIT),
+      row_alignment);
+    CUDF_EXPECTS(fixed_size <= max_tile_bytes, "Rows are too wide to be converted");
+  }
+
+  /**
+   * @brief Returns the number of rows of a tile staged in shared memory
+   */
+  size_type rows_per_tile() const { return std::max(tile_bytes / fixed_size, 1); }
+};
+
+__device__ inline void copy_element(int8_t* dst, int8_t const* src, size_type size)
+{
+  switch (size) {
+    case 1: *dst = *src; break;
+    case 2: *reinterpret_cast<int16_t*>(dst) = *reinterpret_cast<int16_t const*>(src); break;
+    case 4: *reinterpret_cast<int32_t*>(dst) = *reinterpret_cast<int32_t const*>(src); break;
+    default: *reinterpret_cast<int64_t*>(dst) = *reinterpret_cast<int64_t const*>(src); break;
+  }
+}
+
+/**
+ * @brief Writes the fixed-width part of a tile of `rows_per_tile` rows per block.
+ *
+ * The values are first gathered in shared memory by consecutive threads reading consecutive rows
+ * of a column, then the rows are copied to `output` one 8-byte word per thread.
+ */
+__global__ void copy_to_rows(table_device_view input,
+                             size_type const* column_offsets,
+                             size_type const* column_sizes,
+                             size_type const* string_columns,
+                             size_type num_string_columns,
+                             size_type validity_offset,
+                             size_type fixed_size,
+                             size_type rows_per_tile,
+                             size_type const* row_offsets,
+                             int8_t* output)
+{
+  extern __shared__ int64_t shared_rows[];
+  auto const tile         = reinterpret_cast<int8_t*>(shared_rows);
+  auto const first_row    = static_cast<size_type>(blockIdx.x) * rows_per_tile;
+  auto const num_rows     = min(rows_per_tile, input.num_rows() - first_row);
+  auto const num_columns  = input.num_columns();
+  auto const num_validity = (num_columns + CHAR_BIT - 1) / CHAR_BIT;
+
+  for (size_type i = threadIdx.x; i < num_rows * num_columns; i += blockDim.x) {
+    auto const c   = i / num_rows;
+    auto const r   = i % num_rows;
+    auto const col = input.column(c);
+    if (col.type().id() == type_id::STRING) { continue; }
+    auto const size = column_sizes[c];
+    copy_element(tile + r * fixed_size + column_offsets[c],
+                 col.head<int8_t>() + static_cast<int64_t>(col.offset() + first_row + r) * size,
+                 size);
+  }
+
+  for (size_type i = threadIdx.x; i < num_rows * num_validity; i += blockDim.x) {
+    auto const r     = i / num_validity;
+    auto const first = (i % num_validity) * CHAR_BIT;
+    uint8_t byte{0};
+    for (size_type c = first; c < min(first + CHAR_BIT, num_columns); ++c) {
+      if (input.column(c).is_valid(first_row + r)) { byte |= 1 << (c - first); }
+    }
+    tile[r * fixed_size + validity_offset + i % num_validity] = byte;
+  }
+
+  for (size_type r = threadIdx.x; r < num_rows; r += blockDim.x) {
+    uint32_t offset = fixed_size;
+    for (size_type s = 0; s < num_string_columns; ++s) {
+      auto const c   = string_columns[s];
+      auto const col = input.column(c);
+      uint32_t const length =
+        col.is_valid(first_row + r) ? col.element<string_view>(first_row + r).size_bytes() : 0;
+      *reinterpret_cast<string_entry*>(tile + r * fixed_size + column_offsets[c]) =
+        string_entry{offset, length};
+      offset += length;
+    }
+  }
+
+  __syncthreads();
+
+  auto const words_per_row = fixed_size / row_alignment;
+  for (size_type i = threadIdx.x; i < num_rows * words_per_row; i += blockDim.x) {
+    auto const r = i / words_per_row;
+    auto const w = i % words_per_row;
+    reinterpret_cast<int64_t*>(output + row_offsets[first_row + r])[w] = shared_rows[i];
+  }
+}
+
+/**
+ * @brief Copies the characters of the STRING values of every row, one warp per row.
+ */
+__global__ void copy_strings_to_rows(table_device_view input,
+                                     size_type const* string_columns,
+                                     size_type num_string_columns,
+                                     size_type fixed_size,
+                                     size_type const* row_offsets,
+                                     int8_t* output)
+{
+  auto const lane = threadIdx.x % warp_size;
+  for (size_type row = (threadIdx.x + blockIdx.x * blockDim.x) / warp_size;
+       row < input.num_rows();
+       row += (blockDim.x * gridDim.x) / warp_size) {
+    auto dst = output + row_offsets[row] + fixed_size;
+    for (size_type s = 0; s < num_string_columns; ++s) {
+      auto const col = input.column(string_columns[s]);
+      if (col.is_null(row)) { continue; }
+      auto const str = col.element<string_view>(row);
+      for (size_type i = lane; i < str.size_bytes(); i += warp_size) { dst[i] = str.data()[i]; }
+      dst += str.size_bytes();
+    }
+  }
+}
+
+/**
+ * @brief Reads the fixed-width part of a tile of `rows_per_tile` rows per block.
+ *
+ * The rows are first copied to shared memory one 8-byte word per thread, then consecutive threads
+ * write consecutive rows of a column. The string entries are written to `outputs` like the
+ * values of fixed-width columns.
+ */
+__global__ void copy_from_rows(int8_t const* input,
+                               size_type const* row_offsets,
+                               size_type num_rows,
+                               size_type num_columns,
+                               size_type const* column_offsets,
+                               size_type const* column_sizes,
+                               size_type fixed_size,
+                               size_type rows_per_tile,
+                               int8_t* const* outputs)
+{
+  extern __shared__ int64_t shared_rows[];
+  auto const tile      = reinterpret_cast<int8_t const*>(shared_rows);
+  auto const first_row = static_cast<size_type>(blockIdx.x) * rows_per_tile;
+  auto const tile_rows = min(rows_per_tile, num_rows - first_row);
+
+  auto const words_per_row = fixed_size / row_alignment;
+  for (size_type i = threadIdx.x; i < tile_rows * words_per_row; i += blockDim.x) {
+    auto const r = i / words_per_row;
+    auto const w = i % words_per_row;
+    shared_rows[i] = reinterpret_cast<int64_t const*>(input + row_offsets[first_row + r])[w];
+  }
+
+  __syncthreads();
+
+  for (size_type i = threadIdx.x; i < tile_rows * num_columns; i += blockDim.x) {
+    auto const c    = i / tile_rows;
+    auto const r    = i % tile_rows;
+    auto const size = column_sizes[c];
+    copy_element(outputs[c] + static_cast<int64_t>(first_row + r) * size,
+                 tile + r * fixed_size + column_offsets[c],
+                 size);
+  }
+}
+
+/**
+ * @brief Copies the characters of the strings of one column, one warp per row.
+ */
+__global__ void copy_strings_from_rows(int8_t const* input,
+                                       size_type const* row_offsets,
+                                       size_type num_rows,
+                                       string_entry const* entries,
+                                       size_type const* offsets,
+                                       char* chars)
+{
+  auto const lane = threadIdx.x % warp_size;
+  for (size_type row = (threadIdx.x + blockIdx.x * blockDim.x) / warp_size; row < num_rows;
+       row += (blockDim.x * gridDim.x) / warp_size) {
+    auto const entry = entries[row];
+    auto const src   = input + row_offsets[row] + entry.offset;
+    for (size_type i = lane; i < entry.length; i += warp_size) { chars[offsets[row] + i] = src[i]; }
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<column> convert_to_rows(table_view const& input,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  std::vector<data_type> schema;
+  std::transform(input.begin(), input.end(), std::back_inserter(schema), [](auto const& col) {
+    return col.type();
+  });
+  row_layout const layout(schema);
+  auto const num_rows = input.num_rows();
+  if (num_rows == 0) {
+    return make_lists_column(0,
+                             make_empty_column(data_type{type_id::INT32}),
+                             make_empty_column(data_type{type_id::INT8}),
+                             0,
+                             rmm::device_buffer{},
+                             stream,
+                             mr);
+  }
+
+  auto const d_input = table_device_view::create(input, stream);
+  rmm::device_vector<size_type> const column_offsets(layout.column_offsets);
+  rmm::device_vector<size_type> const column_sizes(layout.column_sizes);
+  rmm::device_vector<size_type> const string_columns(layout.string_columns);
+  auto const num_string_columns = static_cast<size_type>(layout.string_columns.size());
+
+  auto row_size = [d_input            = *d_input,
+                   string_columns     = string_columns.data().get(),
+                   num_string_columns,
+                   fixed_size         = layout.fixed_size] __device__(size_type row) {
+    size_type size = fixed_size;
+    for (size_type s = 0; s < num_string_columns; ++s) {
+      auto const col = d_input.column(string_columns[s]);
+      if (col.is_valid(row)) { size += col.element<string_view>(row).size_bytes(); }
+    }
+    return (size + row_alignment - 1) / row_alignment * row_alignment;
+  };
+  auto const row_sizes =
+    thrust::make_transform_iterator(thrust::make_counting_iterator(0), row_size);
+
+  auto const total_size = thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(num_rows),
+    [row_size] __device__(size_type row) { return static_cast<int64_t>(row_size(row)); },
+    int64_t{0},
+    thrust::plus<int64_t>());
+  CUDF_EXPECTS(total_size <= std::numeric_limits<size_type>::max(),
+               "Rows are too large to be held in a single column");
+
+  auto offsets =
+    strings::detail::make_offsets_child_column(row_sizes, row_sizes + num_rows, mr, stream);
+  auto data = make_numeric_column(
+    data_type{type_id::INT8}, total_size, mask_state::UNALLOCATED, stream, mr);
+
+  auto const rows_per_tile = layout.rows_per_tile();
+  auto const num_tiles     = util::div_rounding_up_safe(num_rows, rows_per_tile);
+  copy_to_rows<<<num_tiles, block_size, rows_per_tile * layout.fixed_size, stream>>>(
+    *d_input,
+    column_offsets.data().get(),
+    column_sizes.data().get(),
+    string_columns.data().get(),
+    num_string_columns,
+    layout.validity_offset,
+    layout.fixed_size,
+    rows_per_tile,
+    offsets->view().data<size_type>(),
+    data->mutable_view().data<int8_t>());
+
+  if (num_string_columns > 0) {
+    auto const num_blocks = util::div_rounding_up_safe(num_rows, block_size / warp_size);
+    copy_strings_to_rows<<<num_blocks, block_size, 0, stream>>>(
+      *d_input,
+      string_columns.data().get(),
+      num_string_columns,
+      layout.fixed_size,
+      offsets->view().data<size_type>(),
+      data->mutable_view().data<int8_t>());
+  }
+
+  return make_lists_column(
+    num_rows, std::move(offsets), std::move(data), 0, rmm::device_buffer{}, stream, mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(input.child().type().id() == type_id::INT8, "Rows must be a LIST of INT8 column");
+  row_layout const layout(schema);
+  auto const num_rows    = input.size();
+  auto const num_columns = static_cast<size_type>(schema.size());
+
+  if (num_rows == 0) {
+    std::vector<std::unique_ptr<column>> columns;
+    for (auto const type : schema) {
+      columns.push_back(type.id() == type_id::STRING
+                          ? strings::detail::make_empty_strings_column(mr, stream)
+                          : make_fixed_width_column(type, 0, mask_state::UNALLOCATED, stream, mr));
+    }
+    return std::make_unique<table>(std::move(columns));
+  }
+
+  auto const d_rows        = input.child().data<int8_t>();
+  auto const d_row_offsets = input.offsets().data<size_type>() + input.offset();
+
+  // The string entries are read into temporary buffers, from which the strings are built
+  std::vector<std::unique_ptr<column>> columns;
+  std::vector<rmm::device_buffer> string_entries;
+  std::vector<int8_t*> outputs;
+  for (auto const type : schema) {
+    if (type.id() == type_id::STRING) {
+      string_entries.emplace_back(num_rows * sizeof(string_entry), stream);
+      columns.emplace_back(nullptr);
+      outputs.push_back(static_cast<int8_t*>(string_entries.back().data()));
+    } else {
+      columns.push_back(
+        make_fixed_width_column(type, num_rows, mask_state::UNALLOCATED, stream, mr));
+      outputs.push_back(columns.back()->mutable_view().head<int8_t>());
+    }
+  }
+
+  rmm::device_vector<size_type> const column_offsets(layout.column_offsets);
+  rmm::device_vector<size_type> const column_sizes(layout.column_sizes);
+  rmm::device_vector<int8_t*> const d_outputs(outputs);
+  auto const rows_per_tile = layout.rows_per_tile();
+  auto const num_tiles     = util::div_rounding_up_safe(num_rows, rows_per_tile);
+  copy_from_rows<<<num_tiles, block_size, rows_per_tile * layout.fixed_size, stream>>>(
+    d_rows,
+    d_row_offsets,
+    num_rows,
+    num_columns,
+    column_offsets.data().get(),
+    column_sizes.data().get(),
+    layout.fixed_size,
+    rows_per_tile,
+    d_outputs.data().get());
+
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const validity_byte = layout.validity_offset + c / CHAR_BIT;
+    auto mask                = valid_if(
+      thrust::make_counting_iterator(0),
+      thrust::make_counting_iterator(num_rows),
+      [d_rows, d_row_offsets, validity_byte, bit = c % CHAR_BIT] __device__(size_type row) {
+        return (d_rows[d_row_offsets[row] + validity_byte] >> bit) & 1;
+      },
+      stream,
+      mr);
+    auto null_mask = mask.second > 0 ? std::move(mask.first) : rmm::device_buffer{};
+
+    if (schema[c].id() != type_id::STRING) {
+      columns[c]->set_null_mask(std::move(null_mask), mask.second);
+      continue;
+    }
+
+    auto const entries = reinterpret_cast<string_entry const*>(outputs[c]);
+    auto const lengths = thrust::make_transform_iterator(
+      entries, [] __device__(string_entry const& e) { return static_cast<size_type>(e.length); });
+    auto offsets =
+      strings::detail::make_offsets_child_column(lengths, lengths + num_rows, mr, stream);
+    auto const num_chars = get_value<size_type>(offsets->view(), num_rows, stream);
+    auto chars =
+      strings::detail::create_chars_child_column(num_rows, mask.second, num_chars, mr, stream);
+    auto const num_blocks = util::div_rounding_up_safe(num_rows, block_size / warp_size);
+    copy_strings_from_rows<<<num_blocks, block_size, 0, stream>>>(
+      d_rows,
+      d_row_offsets,
+      num_rows,
+      entries,
+      offsets->view().data<size_type>(),
+      chars->mutable_view().data<char>());
+    columns[c] = make_strings_column(num_rows,
+                                     std::move(offsets),
+                                     std::move(chars),
+                                     mask.second,
+                                     std::move(null_mask),
+                                     stream,
+                                     mr);
+  }
+
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_to_rows(table_view const& input,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_to_rows(input, mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_from_rows(input, schema, mr);
+}
+
+}  // namespace cudf
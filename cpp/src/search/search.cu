@@ -15,7 +15,9 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/search.hpp>
 #include <cudf/table/row_operators.cuh>
@@ -30,7 +32,11 @@
 #include <cudf/strings/detail/utilities.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
 
 namespace cudf {
 namespace {
@@ -66,6 +72,129 @@ void launch_search(DataIterator it_data,
   }
 }
 
+// haystacks of at least this many rows are searched through an index of sampled rows
+constexpr size_type sampled_search_min_rows = 1 << 16;
+// number of sampled rows of the index, which fill a complete binary tree
+constexpr size_type max_search_samples = (1 << 12) - 1;
+
+/**
+ * @brief Fills `slot_order` with the sorted position of the sample in each slot of an Eytzinger
+ * layout, where the children of slot `k` are the slots `2k + 1` and `2k + 2`.
+ */
+void eytzinger_order(std::vector<size_type>& slot_order, std::size_t slot, size_type& next)
+{
+  if (slot >= slot_order.size()) return;
+  eytzinger_order(slot_order, 2 * slot + 1, next);
+  slot_order[slot] = next++;
+  eytzinger_order(slot_order, 2 * slot + 2, next);
+}
+
+/**
+ * @brief Finds the position of a needle by descending an Eytzinger index of sampled haystack
+ * rows, and then binary searching the haystack rows between two consecutive samples.
+ *
+ * The sample of sorted position `j` is the haystack row `(j + 1) * stride`. The index is small
+ * and laid out in the order it is descended, so its first levels stay in cache across needles
+ * and only the last search touches the haystack.
+ */
+template <bool has_nulls>
+struct sampled_search_fn {
+  // compares the samples and the needles, in the order of `comp`
+  row_lexicographic_comparator<has_nulls> sample_comp;
+  // compares the haystack rows and the needles, as the comparator of `launch_search`
+  row_lexicographic_comparator<has_nulls> comp;
+  size_type const* slot_order;
+  size_type num_samples;
+  size_type stride;
+  size_type num_rows;
+  bool find_first;
+
+  __device__ size_type operator()(size_type needle) const
+  {
+    // descend to the first sample not preceding the needle
+    size_type slot = 1;
+    while (slot <= num_samples) {
+      bool const precedes =
+        find_first ? sample_comp(slot - 1, needle) : not sample_comp(needle, slot - 1);
+      slot = 2 * slot + precedes;
+    }
+    slot >>= __ffs(~slot);
+    auto const sample = slot == 0 ? num_samples : slot_order[slot - 1];
+
+    // the position is after the previous sample and at most the row of the sample
+    auto const begin = thrust::make_counting_iterator<size_type>(sample * stride);
+    auto const end   = thrust::make_counting_iterator<size_type>(
+      sample == num_samples ? num_rows : (sample + 1) * stride);
+    return find_first ? *thrust::lower_bound(thrust::seq, begin, end, needle, comp)
+                      : *thrust::upper_bound(thrust::seq, begin, end, needle, comp);
+  }
+};
+
+template <bool has_nulls>
+void sampled_search(table_view const& t,
+                    table_device_view const& d_t,
+                    table_device_view const& d_values,
+                    bool find_first,
+                    order const* column_order,
+                    null_order const* null_precedence,
+                    size_type* output,
+                    cudaStream_t stream)
+{
+  auto const stride      = util::div_rounding_up_safe(t.num_rows(), max_search_samples + 1);
+  auto const num_samples = (t.num_rows() - 1) / stride;
+
+  std::vector<size_type> slot_order(num_samples);
+  size_type next = 0;
+  eytzinger_order(slot_order, 0, next);
+  std::vector<size_type> sample_rows(num_samples);
+  std::transform(slot_order.begin(), slot_order.end(), sample_rows.begin(), [stride](auto j) {
+    return (j + 1) * stride;
+  });
+
+  auto d_slot_order = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_samples, mask_state::UNALLOCATED, stream);
+  auto d_sample_rows = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_samples, mask_state::UNALLOCATED, stream);
+  CUDA_TRY(cudaMemcpyAsync(d_slot_order->mutable_view().data<size_type>(),
+                           slot_order.data(),
+                           num_samples * sizeof(size_type),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(cudaMemcpyAsync(d_sample_rows->mutable_view().data<size_type>(),
+                           sample_rows.data(),
+                           num_samples * sizeof(size_type),
+                           cudaMemcpyHostToDevice,
+                           stream));
+
+  // the samples are copied in slot order so that the index is compact
+  auto samples = detail::gather(t,
+                                d_sample_rows->view(),
+                                detail::out_of_bounds_policy::IGNORE,
+                                detail::negative_index_policy::NOT_ALLOWED,
+                                rmm::mr::get_default_resource(),
+                                stream);
+  auto d_samples = table_device_view::create(samples->view(), stream);
+
+  using comparator = row_lexicographic_comparator<has_nulls>;
+  auto const sample_comp =
+    find_first ? comparator(*d_samples, d_values, column_order, null_precedence)
+               : comparator(d_values, *d_samples, column_order, null_precedence);
+  auto const comp = find_first ? comparator(d_t, d_values, column_order, null_precedence)
+                               : comparator(d_values, d_t, column_order, null_precedence);
+
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(d_values.num_rows()),
+                    output,
+                    sampled_search_fn<has_nulls>{sample_comp,
+                                                 comp,
+                                                 d_slot_order->view().data<size_type>(),
+                                                 num_samples,
+                                                 stride,
+                                                 t.num_rows(),
+                                                 find_first});
+}
+
 std::unique_ptr<column> search_ordered(table_view const& t,
                                        table_view const& values,
                                        bool find_first,
@@ -103,7 +232,31 @@ std::unique_ptr<column> search_ordered(table_view const& t,
   rmm::device_vector<order> d_column_order(column_order.begin(), column_order.end());
   rmm::device_vector<null_order> d_null_precedence(null_precedence.begin(), null_precedence.end());
 
-  if (has_nulls(t) or has_nulls(values)) {
+  auto const search_nulls = has_nulls(t) or has_nulls(values);
+  if (t.num_rows() >= sampled_search_min_rows) {
+    if (search_nulls) {
+      sampled_search<true>(t,
+                           *d_t,
+                           *d_values,
+                           find_first,
+                           d_column_order.data().get(),
+                           d_null_precedence.data().get(),
+                           result_view.data<size_type>(),
+                           stream);
+    } else {
+      sampled_search<false>(t,
+                            *d_t,
+                            *d_values,
+                            find_first,
+                            d_column_order.data().get(),
+                            d_null_precedence.data().get(),
+                            result_view.data<size_type>(),
+                            stream);
+    }
+    return result;
+  }
+
+  if (search_nulls) {
     auto ineq_op =
       (find_first)
         ? row_lexicographic_comparator<true>(
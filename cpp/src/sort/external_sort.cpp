@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/spillable_partition.hpp>
+#include <cudf/merge.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <deque>
+
+namespace cudf {
+struct external_sorter::external_sorter_impl {
+  /**
+   * @brief A sorted run, of which the blocks not merged yet are spilled
+   */
+  struct run {
+    std::deque<detail::spillable_partition> blocks;
+    // keys of the last merged row of the run, while it has blocks left
+    std::unique_ptr<table> frontier;
+  };
+
+  external_sorter_impl(std::vector<size_type> const& key_columns,
+                       std::vector<order> const& column_order,
+                       std::vector<null_order> const& null_precedence,
+                       size_type chunk_rows)
+    : _key_columns(key_columns),
+      _column_order(column_order),
+      _null_precedence(null_precedence),
+      _chunk_rows(chunk_rows)
+  {
+    CUDF_EXPECTS(chunk_rows > 0, "chunk_rows must be positive.");
+    CUDF_EXPECTS(column_order.empty() or column_order.size() == key_columns.size(),
+                 "Mismatch between number of key columns and column order.");
+    CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == key_columns.size(),
+                 "Mismatch between number of key columns and null_precedence size.");
+    // merge and upper_bound take one order per key column
+    if (_column_order.empty()) { _column_order.resize(key_columns.size(), order::ASCENDING); }
+    if (_null_precedence.empty()) {
+      _null_precedence.resize(key_columns.size(), null_order::BEFORE);
+    }
+  }
+
+  void push(table_view const& input)
+  {
+    CUDF_EXPECTS(not _merging, "Cannot push a table after the merge has started.");
+    if (_num_columns < 0) {
+      auto const in_range = [&input](auto col) { return col >= 0 and col < input.num_columns(); };
+      CUDF_EXPECTS(std::all_of(_key_columns.begin(), _key_columns.end(), in_range),
+                   "Key column index out of range.");
+      _num_columns = input.num_columns();
+    }
+    CUDF_EXPECTS(input.num_columns() == _num_columns,
+                 "Mismatch between number of columns of the pushed tables.");
+    if (input.num_rows() == 0) { return; }
+
+    auto sorted =
+      detail::sort_by_key(input, input.select(_key_columns), _column_order, _null_precedence);
+    std::vector<size_type> splits;
+    for (size_type row = _chunk_rows; row < input.num_rows(); row += _chunk_rows) {
+      splits.push_back(row);
+    }
+    auto blocks = contiguous_split(sorted->view(), splits);
+    sorted.reset();
+
+    run sorted_run;
+    for (auto& block : blocks) {
+      sorted_run.blocks.emplace_back(std::move(block));
+      sorted_run.blocks.back().spill();
+    }
+    _runs.push_back(std::move(sorted_run));
+  }
+
+  bool has_next_chunk() const
+  {
+    if (_pending != nullptr and _pending->num_rows() > 0) { return true; }
+    return std::any_of(
+      _runs.begin(), _runs.end(), [](run const& r) { return not r.blocks.empty(); });
+  }
+
+  std::unique_ptr<table> next_chunk(rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(has_next_chunk(), "No rows left to return.");
+    if (not _merging) {
+      _merging = true;
+      for (auto& r : _runs) { merge_block(r); }
+    }
+
+    // merge more blocks until a full chunk is known to precede all the rows not merged yet
+    auto safe = safe_rows();
+    while (safe.first < _chunk_rows and safe.second >= 0) {
+      merge_block(_runs[safe.second]);
+      safe = safe_rows();
+    }
+
+    auto const pending = _pending->view();
+    auto const rows    = std::min(safe.first, _chunk_rows);
+    auto result        = std::make_unique<table>(slice(pending, {0, rows}).front(), 0, mr);
+    _pending = std::make_unique<table>(slice(pending, {rows, pending.num_rows()}).front());
+    return result;
+  }
+
+ private:
+  /**
+   * @brief Copies the next block of `r` back to the device and merges it into the pending rows
+   */
+  void merge_block(run& r)
+  {
+    auto& partition  = r.blocks.front();
+    auto const block = partition.view();
+    r.frontier.reset();
+    if (r.blocks.size() > 1) {
+      auto const keys = block.select(_key_columns);
+      auto const last = keys.num_rows() - 1;
+      r.frontier      = std::make_unique<table>(slice(keys, {last, last + 1}).front());
+    }
+    if (_pending == nullptr) {
+      _pending = std::make_unique<table>(block);
+    } else {
+      _pending = merge({_pending->view(), block}, _key_columns, _column_order, _null_precedence);
+    }
+    partition.release();
+    r.blocks.pop_front();
+  }
+
+  /**
+   * @brief Returns the number of pending rows which precede all the rows not merged yet, and the
+   * run whose next block bounds them, or -1 if every run is fully merged
+   *
+   * The unmerged rows of a run follow its frontier, so the pending rows up to the smallest
+   * frontier are final.
+   */
+  std::pair<size_type, int> safe_rows() const
+  {
+    std::vector<table_view> frontiers;
+    std::vector<int> frontier_runs;
+    for (std::size_t idx = 0; idx < _runs.size(); ++idx) {
+      if (_runs[idx].frontier == nullptr) { continue; }
+      frontiers.push_back(_runs[idx].frontier->view());
+      frontier_runs.push_back(static_cast<int>(idx));
+    }
+    if (frontiers.empty()) { return {_pending->num_rows(), -1}; }
+
+    auto const bounds = detail::upper_bound(_pending->view().select(_key_columns),
+                                            concatenate(frontiers)->view(),
+                                            _column_order,
+                                            _null_precedence);
+    std::vector<size_type> h_bounds(bounds->size());
+    CUDA_TRY(cudaMemcpy(h_bounds.data(),
+                        bounds->view().data<size_type>(),
+                        h_bounds.size() * sizeof(size_type),
+                        cudaMemcpyDeviceToHost));
+    auto const smallest = std::min_element(h_bounds.begin(), h_bounds.end());
+    return {*smallest, frontier_runs[std::distance(h_bounds.begin(), smallest)]};
+  }
+
+  std::vector<size_type> _key_columns;
+  std::vector<order> _column_order;
+  std::vector<null_order> _null_precedence;
+  size_type _chunk_rows;
+  size_type _num_columns = -1;
+  std::vector<run> _runs;
+  std::unique_ptr<table> _pending;  // merged rows not returned yet, in sorted order
+  bool _merging = false;
+};
+
+external_sorter::external_sorter(std::vector<size_type> const& key_columns,
+                                 std::vector<order> const& column_order,
+                                 std::vector<null_order> const& null_precedence,
+                                 size_type chunk_rows)
+  : impl{std::make_unique<external_sorter_impl>(
+      key_columns, column_order, null_precedence, chunk_rows)}
+{
+}
+
+external_sorter::~external_sorter() = default;
+
+void external_sorter::push(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  impl->push(input);
+}
+
+bool external_sorter::has_next_chunk() const { return impl->has_next_chunk(); }
+
+std::unique_ptr<table> external_sorter::next_chunk(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return impl->next_chunk(mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/multi_device.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+// Rows sampled per device to choose the splitters from
+constexpr size_type samples_per_device = 64;
+
+/**
+ * @brief Returns `num_parts - 1` sorted rows of `keys` that split it into parts of about equal
+ * size, chosen from a sorted sample of evenly spaced rows of `keys`
+ */
+std::unique_ptr<table> choose_splitters(table_view const& keys,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        size_type num_parts,
+                                        cudaStream_t stream)
+{
+  auto const num_samples = std::min(keys.num_rows(), num_parts * samples_per_device);
+  auto const sample_step = keys.num_rows() / num_samples;
+  auto const sample_map  = detail::sequence(num_samples,
+                                           numeric_scalar<size_type>(0),
+                                           numeric_scalar<size_type>(sample_step),
+                                           rmm::mr::get_default_resource(),
+                                           stream);
+
+  auto const sample = detail::gather(keys,
+                                     sample_map->view(),
+                                     out_of_bounds_policy::FAIL,
+                                     negative_index_policy::NOT_ALLOWED,
+                                     rmm::mr::get_default_resource(),
+                                     stream);
+
+  auto const sorted_sample = detail::sort_by_key(sample->view(),
+                                                 sample->view(),
+                                                 column_order,
+                                                 null_precedence,
+                                                 rmm::mr::get_default_resource(),
+                                                 stream);
+
+  auto const step         = num_samples / num_parts;
+  auto const splitter_map = detail::sequence(num_parts - 1,
+                                             numeric_scalar<size_type>(step),
+                                             numeric_scalar<size_type>(step),
+                                             rmm::mr::get_default_resource(),
+                                             stream);
+  return detail::gather(sorted_sample->view(),
+                        splitter_map->view(),
+                        out_of_bounds_policy::FAIL,
+                        negative_index_policy::NOT_ALLOWED,
+                        rmm::mr::get_default_resource(),
+                        stream);
+}
+
+}  // namespace
+}  // namespace detail
+
+multi_device_table multi_device_sort(table_view const& input,
+                                     std::vector<size_type> const& key_columns,
+                                     std::vector<device_resources> const& devices,
+                                     std::vector<order> const& column_order,
+                                     std::vector<null_order> const& null_precedence)
+{
+  CUDF_FUNC_RANGE();
+  cudaStream_t stream = 0;
+  CUDF_EXPECTS(not devices.empty(), "Multi-device sort needs at least one device.");
+  auto const in_range = [&input](auto col) { return col >= 0 and col < input.num_columns(); };
+  CUDF_EXPECTS(std::all_of(key_columns.begin(), key_columns.end(), in_range),
+               "Key column index out of range.");
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == key_columns.size(),
+               "Mismatch between number of key columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == key_columns.size(),
+               "Mismatch between number of key columns and null_precedence size.");
+  // upper_bound takes one order per key column
+  std::vector<order> key_order(column_order);
+  std::vector<null_order> key_null_precedence(null_precedence);
+  if (key_order.empty()) { key_order.resize(key_columns.size(), order::ASCENDING); }
+  if (key_null_precedence.empty()) {
+    key_null_precedence.resize(key_columns.size(), null_order::BEFORE);
+  }
+
+  int home_device{0};
+  CUDA_TRY(cudaGetDevice(&home_device));
+  auto const keys      = input.select(key_columns);
+  auto const num_parts = static_cast<size_type>(devices.size());
+
+  // Part `i` holds the rows that sort between splitters `i - 1` and `i`, which are the rows for
+  // which `upper_bound` in the splitters is `i`
+  std::unique_ptr<table> partitioned;
+  std::vector<size_type> splits(num_parts - 1, 0);
+  if (num_parts > 1 and input.num_rows() > 0) {
+    auto const splitters =
+      detail::choose_splitters(keys, key_order, key_null_precedence, num_parts, stream);
+    auto const partition_map = detail::upper_bound(splitters->view(),
+                                                   keys,
+                                                   key_order,
+                                                   key_null_precedence,
+                                                   rmm::mr::get_default_resource(),
+                                                   stream);
+    auto result = cudf::partition(input, partition_map->view(), num_parts);
+    partitioned = std::move(result.first);
+    // The first and last offsets are the bounds of the table
+    splits.assign(result.second.begin() + 1, result.second.end() - 1);
+  }
+  auto const split_results = detail::contiguous_split(partitioned ? partitioned->view() : input,
+                                                      splits,
+                                                      rmm::mr::get_default_resource(),
+                                                      stream);
+  partitioned.reset();
+
+  auto parts = detail::for_each_device(devices, [&](size_type i) {
+    auto const& target = devices[i];
+    auto const local   = detail::copy_to_device(split_results[i], home_device, stream, target);
+    return detail::sort_by_key(local.view,
+                               local.view.select(key_columns),
+                               column_order,
+                               null_precedence,
+                               detail::memory_resource_of(target),
+                               target.stream);
+  });
+  return multi_device_table(devices, std::move(parts));
+}
+
+}  // namespace cudf
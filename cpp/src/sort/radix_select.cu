@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "radix_sort.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace radix {
+namespace {
+constexpr int radix_bits                = 8;
+constexpr int radix_bins                = 1 << radix_bits;
+constexpr size_type block_size          = 256;
+constexpr size_type elements_per_thread = 8;  // of the histogram kernel, in a grid-stride loop
+
+struct radix_keys_fn {
+  template <typename T, std::enable_if_t<is_radix_sortable<T>()>* = nullptr>
+  std::pair<rmm::device_vector<uint64_t>, int> operator()(column_device_view const& d_column,
+                                                          bool ascending,
+                                                          cudaStream_t stream) const
+  {
+    using Key = key_type<T>;
+    rmm::device_vector<uint64_t> keys(d_column.size());
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(d_column.size()),
+                      keys.begin(),
+                      [d_column, ascending] __device__(size_type idx) {
+                        if (d_column.is_null(idx)) return uint64_t{0};
+                        auto const key = encode_key(d_column.element<T>(idx));
+                        return static_cast<uint64_t>(ascending ? key : static_cast<Key>(~key));
+                      });
+    return std::make_pair(std::move(keys), static_cast<int>(8 * sizeof(Key)));
+  }
+
+  template <typename T, std::enable_if_t<not is_radix_sortable<T>()>* = nullptr>
+  std::pair<rmm::device_vector<uint64_t>, int> operator()(column_device_view const&,
+                                                          bool,
+                                                          cudaStream_t) const
+  {
+    CUDF_FAIL("Unsupported column type for radix select");
+  }
+};
+
+/**
+ * @brief Counts the digits at `shift` of the valid keys whose higher digits match `prefix`.
+ *
+ * Every block counts in shared memory and adds its counts to `histogram` once.
+ */
+__global__ void radix_histogram_kernel(column_device_view const d_column,
+                                       uint64_t const* keys,
+                                       uint64_t prefix,
+                                       uint64_t mask,
+                                       int shift,
+                                       size_type* histogram)
+{
+  __shared__ size_type block_histogram[radix_bins];
+  for (int bin = threadIdx.x; bin < radix_bins; bin += blockDim.x) { block_histogram[bin] = 0; }
+  __syncthreads();
+
+  for (size_type idx = threadIdx.x + blockIdx.x * blockDim.x; idx < d_column.size();
+       idx += blockDim.x * gridDim.x) {
+    auto const key = keys[idx];
+    if (d_column.is_valid(idx) && (key & mask) == prefix) {
+      atomicAdd(&block_histogram[(key >> shift) & (radix_bins - 1)], 1);
+    }
+  }
+  __syncthreads();
+
+  for (int bin = threadIdx.x; bin < radix_bins; bin += blockDim.x) {
+    if (block_histogram[bin] > 0) { atomicAdd(&histogram[bin], block_histogram[bin]); }
+  }
+}
+
+}  // namespace
+
+std::pair<rmm::device_vector<uint64_t>, int> radix_keys(column_device_view const& d_column,
+                                                        bool ascending,
+                                                        cudaStream_t stream)
+{
+  return cudf::type_dispatcher(d_column.type(), radix_keys_fn{}, d_column, ascending, stream);
+}
+
+uint64_t radix_select(column_device_view const& d_column,
+                      rmm::device_vector<uint64_t> const& keys,
+                      int key_bits,
+                      size_type k,
+                      cudaStream_t stream)
+{
+  rmm::device_vector<size_type> histogram(radix_bins);
+  std::vector<size_type> h_histogram(radix_bins);
+  cudf::detail::grid_1d grid{d_column.size(), block_size, elements_per_thread};
+
+  uint64_t prefix = 0;
+  uint64_t mask   = 0;
+  for (int shift = key_bits - radix_bits; shift >= 0; shift -= radix_bits) {
+    CUDA_TRY(cudaMemsetAsync(histogram.data().get(), 0, radix_bins * sizeof(size_type), stream));
+    radix_histogram_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      d_column, keys.data().get(), prefix, mask, shift, histogram.data().get());
+    CUDA_TRY(cudaMemcpyAsync(h_histogram.data(),
+                             histogram.data().get(),
+                             radix_bins * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    int digit = 0;
+    while (k > h_histogram[digit]) { k -= h_histogram[digit++]; }
+    prefix |= static_cast<uint64_t>(digit) << shift;
+    mask |= static_cast<uint64_t>(radix_bins - 1) << shift;
+  }
+  return prefix;
+}
+
+}  // namespace radix
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+namespace radix {
+/**
+ * @brief Unsigned integer type of `size` bytes.
+ */
+template <std::size_t size>
+struct unsigned_bits;
+template <>
+struct unsigned_bits<1> {
+  using type = uint8_t;
+};
+template <>
+struct unsigned_bits<2> {
+  using type = uint16_t;
+};
+template <>
+struct unsigned_bits<4> {
+  using type = uint32_t;
+};
+template <>
+struct unsigned_bits<8> {
+  using type = uint64_t;
+};
+
+template <typename T>
+using key_type = typename unsigned_bits<sizeof(T)>::type;
+
+/**
+ * @brief Returns true if the elements of type `T` can be encoded into order-preserving
+ * unsigned keys.
+ */
+template <typename T>
+constexpr inline bool is_radix_sortable()
+{
+  return std::is_integral<T>::value || std::is_floating_point<T>::value || is_chrono<T>();
+}
+
+/**
+ * @brief Encodes an element into an unsigned key which orders the same as the element.
+ *
+ * Signed integers have their sign bit flipped. Floating-point values have their sign bit set
+ * when positive and all their bits flipped when negative, after -0.0 is made 0.0 and every NaN
+ * the positive quiet NaN, so that NaN is greater than every other value and equal to itself as
+ * in the relational comparator.
+ */
+template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+__device__ key_type<T> encode_key(T value)
+{
+  auto const key = static_cast<key_type<T>>(value);
+  if (!std::is_signed<T>::value) return key;
+  return key ^ (key_type<T>{1} << (8 * sizeof(T) - 1));
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+__device__ key_type<T> encode_key(T value)
+{
+  if (isnan(value)) {
+    value = std::numeric_limits<T>::quiet_NaN();
+  } else if (value == T{0}) {
+    value = T{0};
+  }
+  key_type<T> key;
+  memcpy(&key, &value, sizeof(T));
+  auto const sign_bit = key_type<T>{1} << (8 * sizeof(T) - 1);
+  return (key & sign_bit) ? static_cast<key_type<T>>(~key) : (key | sign_bit);
+}
+
+template <typename T, std::enable_if_t<is_timestamp<T>()>* = nullptr>
+__device__ key_type<T> encode_key(T value)
+{
+  return encode_key(value.time_since_epoch().count());
+}
+
+template <typename T, std::enable_if_t<is_duration<T>()>* = nullptr>
+__device__ key_type<T> encode_key(T value)
+{
+  return encode_key(value.count());
+}
+
+struct is_radix_sortable_fn {
+  template <typename T>
+  bool operator()() const
+  {
+    return is_radix_sortable<T>();
+  }
+};
+
+/**
+ * @brief Stably sorts the row indices by one column.
+ *
+ * The indices are sorted by the encoded key of each element, and then by a null flag if the
+ * column has nulls. Since every pass is stable, the null flag takes precedence over the keys.
+ */
+struct radix_sort_column_fn {
+  template <typename T, std::enable_if_t<is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_view const& column,
+                  order column_order,
+                  null_order null_precedence,
+                  size_type* indices,
+                  cudaStream_t stream) const
+  {
+    using Key            = key_type<T>;
+    auto column_ptr      = column_device_view::create(column, stream);
+    auto d_column        = *column_ptr;
+    auto const ascending = column_order == order::ASCENDING;
+    auto const size      = column.size();
+
+    rmm::device_vector<Key> keys(size);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      indices,
+                      indices + size,
+                      keys.begin(),
+                      [d_column, ascending] __device__(size_type idx) {
+                        if (d_column.is_null(idx)) return Key{0};
+                        auto const key = encode_key(d_column.element<T>(idx));
+                        return ascending ? key : static_cast<Key>(~key);
+                      });
+    thrust::stable_sort_by_key(
+      rmm::exec_policy(stream)->on(stream), keys.begin(), keys.end(), indices);
+
+    if (!column.has_nulls()) return;
+    // nulls are the smallest elements when BEFORE, and descending order flips them too
+    uint8_t const null_flag = (null_precedence == null_order::BEFORE) == ascending ? 0 : 1;
+    rmm::device_vector<uint8_t> flags(size);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      indices,
+                      indices + size,
+                      flags.begin(),
+                      [d_column, null_flag] __device__(size_type idx) {
+                        return static_cast<uint8_t>(d_column.is_null(idx) ? null_flag
+                                                                          : 1 - null_flag);
+                      });
+    thrust::stable_sort_by_key(
+      rmm::exec_policy(stream)->on(stream), flags.begin(), flags.end(), indices);
+  }
+
+  template <typename T, std::enable_if_t<not is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_view const&, order, null_order, size_type*, cudaStream_t) const
+  {
+    CUDF_FAIL("Unsupported column type for radix sort");
+  }
+};
+
+/**
+ * @brief Encodes the elements of a radix sortable column into order-preserving keys, widened
+ * to 64 bits.
+ *
+ * Null elements have key 0 and are told apart by the null mask of the column.
+ *
+ * @return The keys, and the number of significant bits of every key
+ */
+std::pair<rmm::device_vector<uint64_t>, int> radix_keys(column_device_view const& d_column,
+                                                        bool ascending,
+                                                        cudaStream_t stream);
+
+/**
+ * @brief Returns the `k`th smallest key of the valid elements, counting from 1.
+ *
+ * The key is found one digit at a time from the most significant, by counting the digits of the
+ * keys which match the digits found so far. Every digit costs one pass over the keys.
+ *
+ * @param d_column Column whose keys are selected from
+ * @param keys Keys of `d_column`, from `radix_keys`
+ * @param key_bits Number of significant bits of the keys
+ * @param k Rank of the key to select, in [1, number of valid elements]
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+uint64_t radix_select(column_device_view const& d_column,
+                      rmm::device_vector<uint64_t> const& keys,
+                      int key_bits,
+                      size_type k,
+                      cudaStream_t stream);
+
+}  // namespace radix
+
+/**
+ * @brief Returns true if every column of `input` can be sorted by `radix_sort_indices`.
+ */
+inline bool is_radix_sortable(table_view const& input)
+{
+  return std::all_of(input.begin(), input.end(), [](column_view const& column) {
+    return cudf::type_dispatcher(column.type(), radix::is_radix_sortable_fn{});
+  });
+}
+
+/**
+ * @brief Stably sorts row indices of a table of fixed-width columns by LSD radix sort.
+ *
+ * Every element is encoded into an unsigned key which orders like the element in the requested
+ * order, with a separate null flag for nullable columns. The indices are then radix sorted
+ * stably by the keys of the last column first and the first column last, so the result is the
+ * lexicographic order of `row_lexicographic_comparator`.
+ *
+ * @param input Table whose columns are all radix sortable
+ * @param column_order Order of each column, ascending if empty
+ * @param null_precedence Null order of each column, BEFORE if empty
+ * @param indices Row indices to sort, initialized to the sequence of the rows
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+inline void radix_sort_indices(table_view const& input,
+                               std::vector<order> const& column_order,
+                               std::vector<null_order> const& null_precedence,
+                               mutable_column_view& indices,
+                               cudaStream_t stream)
+{
+  for (auto col = input.num_columns(); col-- > 0;) {
+    cudf::type_dispatcher(input.column(col).type(),
+                          radix::radix_sort_column_fn{},
+                          input.column(col),
+                          column_order.empty() ? order::ASCENDING : column_order[col],
+                          null_precedence.empty() ? null_order::BEFORE : null_precedence[col],
+                          indices.data<size_type>(),
+                          stream);
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -331,8 +331,10 @@ std::unique_ptr<column> rank(column_view const &input,
                              null_policy null_handling,
                              null_order null_precedence,
                              bool percentage,
-                             rmm::mr::device_memory_resource *mr)
+                             rmm::mr::device_memory_resource *mr,
+                             cudaStream_t stream)
 {
-  return detail::rank(input, method, column_order, null_handling, null_precedence, percentage, mr);
+  return detail::rank(
+    input, method, column_order, null_handling, null_precedence, percentage, mr, stream);
 }
 }  // namespace cudf
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+namespace detail {
+std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
+                                               column_view const& segment_offsets,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
+               "segment_offsets must be of type size_type.");
+  CUDF_EXPECTS(not segment_offsets.has_nulls(), "segment_offsets must not have nulls.");
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.");
+  }
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null_precedence size.");
+  }
+  if (keys.num_rows() == 0 or keys.num_columns() == 0) {
+    return stable_sorted_order(keys, column_order, null_precedence, mr, stream);
+  }
+
+  // the label of a row is the number of offsets not after it, which is the segment index plus one
+  auto labels = make_numeric_column(
+    data_type(type_to_id<size_type>()), keys.num_rows(), mask_state::UNALLOCATED, stream);
+  auto const d_offsets = segment_offsets.data<size_type>();
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      d_offsets,
+                      d_offsets + segment_offsets.size(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(keys.num_rows()),
+                      labels->mutable_view().data<size_type>());
+
+  // the labels are the most significant key, so fixed-width keys are radix sorted by
+  // sorted_order in one pass per key column and one for the labels
+  std::vector<column_view> columns{labels->view()};
+  columns.insert(columns.end(), keys.begin(), keys.end());
+  std::vector<order> orders{order::ASCENDING};
+  if (column_order.empty()) {
+    orders.resize(columns.size(), order::ASCENDING);
+  } else {
+    orders.insert(orders.end(), column_order.begin(), column_order.end());
+  }
+  std::vector<null_order> nulls{null_order::BEFORE};
+  if (null_precedence.empty()) {
+    nulls.resize(columns.size(), null_order::BEFORE);
+  } else {
+    nulls.insert(nulls.end(), null_precedence.begin(), null_precedence.end());
+  }
+  return stable_sorted_order(table_view(columns), orders, nulls, mr, stream);
+}
+
+std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
+                                             table_view const& keys,
+                                             column_view const& segment_offsets,
+                                             std::vector<order> const& column_order,
+                                             std::vector<null_order> const& null_precedence,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
+               "Mismatch in number of rows for values and keys");
+
+  auto sorted_order = segmented_sorted_order(
+    keys, segment_offsets, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+
+  return gather(values,
+                sorted_order->view(),
+                out_of_bounds_policy::NULLIFY,
+                negative_index_policy::NOT_ALLOWED,
+                mr,
+                stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
+                                               column_view const& segment_offsets,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sorted_order(keys, segment_offsets, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
+                                             table_view const& keys,
+                                             column_view const& segment_offsets,
+                                             std::vector<order> const& column_order,
+                                             std::vector<null_order> const& null_precedence,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sort_by_key(
+    values, keys, segment_offsets, column_order, null_precedence, mr);
+}
+
+}  // namespace cudf
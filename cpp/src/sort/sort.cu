@@ -17,8 +17,10 @@
 #include "sort_impl.cuh"
 
 #include <cudf/column/column.hpp>
+#include <cudf/detail/memory_estimate.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -55,32 +57,88 @@ std::unique_ptr<table> sort_by_key(table_view const& values,
 
 }  // namespace detail
 
+namespace {
+/**
+ * @brief Adds the metrics of a sort of the rows of `values` by `keys`
+ */
+void add_sort_metrics(detail::operation_metrics_scope& metrics,
+                      table_view const& values,
+                      table_view const& keys)
+{
+  if (not metrics.enabled()) { return; }
+  metrics.add("rows_in", keys.num_rows());
+  metrics.add("key_columns", keys.num_columns());
+  metrics.add("value_columns", values.num_columns());
+  // The algorithms selected by `detail::sorted_order`
+  if (keys.num_columns() == 1 && keys.column(0).type().id() == type_id::STRING) {
+    metrics.decide("algorithm", "strings_radix");
+  } else {
+    metrics.decide("algorithm", detail::is_radix_sortable(keys) ? "radix" : "comparison");
+  }
+}
+
+}  // namespace
+
 std::unique_ptr<column> sorted_order(table_view input,
                                      std::vector<order> const& column_order,
                                      std::vector<null_order> const& null_precedence,
-                                     rmm::mr::device_memory_resource* mr)
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::sorted_order(input, column_order, null_precedence, mr);
+  detail::operation_metrics_scope metrics("sorted_order", stream);
+  add_sort_metrics(metrics, table_view{}, input);
+  return detail::sorted_order(input, column_order, null_precedence, mr, stream);
 }
 
 std::unique_ptr<table> sort(table_view input,
                             std::vector<order> const& column_order,
                             std::vector<null_order> const& null_precedence,
-                            rmm::mr::device_memory_resource* mr)
+                            rmm::mr::device_memory_resource* mr,
+                            cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(input, input, column_order, null_precedence, mr);
+  detail::operation_metrics_scope metrics("sort", stream);
+  add_sort_metrics(metrics, input, input);
+  return detail::sort_by_key(input, input, column_order, null_precedence, mr, stream);
 }
 
 std::unique_ptr<table> sort_by_key(table_view const& values,
                                    table_view const& keys,
                                    std::vector<order> const& column_order,
                                    std::vector<null_order> const& null_precedence,
-                                   rmm::mr::device_memory_resource* mr)
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(values, keys, column_order, null_precedence, mr);
+  detail::operation_metrics_scope metrics("sort_by_key", stream);
+  add_sort_metrics(metrics, values, keys);
+  return detail::sort_by_key(values, keys, column_order, null_precedence, mr, stream);
+}
+
+memory_estimate estimate_sort_by_key_memory(table_view const& values,
+                                            table_view const& keys,
+                                            cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
+               "Mismatch in number of rows for values and keys");
+  using detail::allocation_size;
+  std::size_t const num_rows = keys.num_rows();
+  memory_estimate estimate;
+  if (num_rows == 0) { return estimate; }
+  // The sorted order and the scratch space of its sort, the order-preserving 8-byte encodings of
+  // the keys with their double buffer, and the null flags of the radix sort
+  estimate.temporary_bytes = 3 * allocation_size(num_rows * sizeof(size_type)) +
+                             3 * allocation_size(num_rows * sizeof(uint64_t)) +
+                             allocation_size(num_rows);
+  estimate.output_bytes = detail::copy_size(values, stream);
+  return estimate;
+}
+
+memory_estimate estimate_sort_memory(table_view const& input, cudaStream_t stream)
+{
+  return estimate_sort_by_key_memory(input, input, stream);
 }
 
 }  // namespace cudf
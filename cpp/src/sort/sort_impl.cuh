@@ -16,8 +16,14 @@
 
 #pragma once
 
+#include "radix_sort.cuh"
+
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/strings/sorting.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/detail/flatten.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
@@ -49,6 +55,34 @@ std::unique_ptr<column> sorted_order(table_view input,
                  "Mismatch between number of columns and null_precedence size.");
   }
 
+  // struct rows are ordered field by field, as the rows of their leaf columns
+  if (structs::detail::has_struct_columns(input)) {
+    auto const flattened =
+      structs::detail::flatten_nested_columns(input, column_order, null_precedence, stream);
+    return sorted_order<stable>(flattened.flattened_columns(),
+                                flattened.orders(),
+                                flattened.null_orders(),
+                                mr,
+                                stream);
+  }
+
+  // the keys of a dictionary are sorted, so its rows are sorted by their integer indices
+  input = dictionary::detail::indices_view(input);
+
+  // a single strings column is radix sorted on its prefixes, which is stable
+  if (input.num_columns() == 1 && input.column(0).type().id() == type_id::STRING) {
+    auto const ascending = column_order.empty() || column_order.front() == order::ASCENDING;
+    auto const nulls_before =
+      null_precedence.empty() || null_precedence.front() == null_order::BEFORE;
+    // the comparator orders nulls as the smallest values when they are BEFORE
+    return strings::detail::sorted_order(
+      strings_column_view(input.column(0)),
+      ascending ? order::ASCENDING : order::DESCENDING,
+      nulls_before == ascending ? null_order::BEFORE : null_order::AFTER,
+      stream,
+      mr);
+  }
+
   std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
     data_type(type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
 
@@ -61,6 +95,12 @@ std::unique_ptr<column> sorted_order(table_view input,
                    mutable_indices_view.end<size_type>(),
                    0);
 
+  // fixed-width keys are radix sorted on order-preserving encodings, which is stable
+  if (is_radix_sortable(input)) {
+    radix_sort_indices(input, column_order, null_precedence, mutable_indices_view, stream);
+    return sorted_indices;
+  }
+
   rmm::device_vector<order> d_column_order(column_order);
 
   if (has_nulls(input)) {
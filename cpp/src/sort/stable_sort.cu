@@ -37,9 +37,10 @@ std::unique_ptr<column> stable_sorted_order(table_view input,
 std::unique_ptr<column> stable_sorted_order(table_view input,
                                             std::vector<order> const& column_order,
                                             std::vector<null_order> const& null_precedence,
-                                            rmm::mr::device_memory_resource* mr)
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
 {
-  return detail::stable_sorted_order(input, column_order, null_precedence, mr);
+  return detail::stable_sorted_order(input, column_order, null_precedence, mr, stream);
 }
 
 }  // namespace cudf
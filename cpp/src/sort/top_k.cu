@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "radix_sort.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+// first k indices of the full stable sorted order
+std::unique_ptr<column> sorted_prefix(table_view const& input,
+                                      size_type k,
+                                      std::vector<order> const& column_order,
+                                      std::vector<null_order> const& null_precedence,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  auto sorted = stable_sorted_order(input, column_order, null_precedence, mr, stream);
+  if (k == sorted->size()) return sorted;
+  return std::make_unique<column>(cudf::slice(sorted->view(), {0, k}).front(), stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> top_k_order(table_view const& input,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative.");
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.");
+  }
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null_precedence size.");
+  }
+
+  k = std::min(k, input.num_rows());
+  if (k == 0 or input.num_columns() == 0) {
+    return make_numeric_column(
+      data_type(type_to_id<size_type>()), 0, mask_state::UNALLOCATED, stream, mr);
+  }
+
+  auto const leading = input.column(0);
+  if (k == input.num_rows() or
+      not cudf::type_dispatcher(leading.type(), radix::is_radix_sortable_fn{})) {
+    return sorted_prefix(input, k, column_order, null_precedence, mr, stream);
+  }
+
+  // the first k rows are among the nulls and the valid rows whose leading key is at most the
+  // kth smallest one, which are the only rows sorted
+  auto const ascending   = column_order.empty() or column_order.front() == order::ASCENDING;
+  auto const nulls_first = (null_precedence.empty() or
+                            null_precedence.front() == null_order::BEFORE) == ascending;
+  auto const null_count  = leading.null_count();
+  if (not nulls_first and input.num_rows() - null_count < k) {
+    return sorted_prefix(input, k, column_order, null_precedence, mr, stream);
+  }
+
+  auto column_ptr          = column_device_view::create(leading, stream);
+  auto d_column            = *column_ptr;
+  auto const keys          = radix::radix_keys(d_column, ascending, stream);
+  auto const d_keys        = keys.first.data().get();
+  auto const valid_k       = nulls_first ? k - null_count : k;
+  auto const include_nulls = nulls_first;
+  auto const include_valid = valid_k > 0;
+  auto const threshold =
+    include_valid ? radix::radix_select(d_column, keys.first, keys.second, valid_k, stream) : 0;
+  auto is_candidate = [d_column, d_keys, include_nulls, include_valid, threshold] __device__(
+                        size_type idx) {
+    if (d_column.is_null(idx)) return include_nulls;
+    return include_valid and d_keys[idx] <= threshold;
+  };
+
+  auto const candidates_count = thrust::count_if(rmm::exec_policy(stream)->on(stream),
+                                                 thrust::make_counting_iterator<size_type>(0),
+                                                 thrust::make_counting_iterator(input.num_rows()),
+                                                 is_candidate);
+  auto candidates = make_numeric_column(
+    data_type(type_to_id<size_type>()), candidates_count, mask_state::UNALLOCATED, stream);
+  auto d_candidates = candidates->mutable_view().data<size_type>();
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator(input.num_rows()),
+                  d_candidates,
+                  is_candidate);
+
+  // the candidates are in row order, so their stable order breaks ties as the full sort does
+  auto candidates_table = gather(input,
+                                 candidates->view(),
+                                 out_of_bounds_policy::IGNORE,
+                                 negative_index_policy::NOT_ALLOWED,
+                                 rmm::mr::get_default_resource(),
+                                 stream);
+  auto candidates_order = stable_sorted_order(candidates_table->view(),
+                                              column_order,
+                                              null_precedence,
+                                              rmm::mr::get_default_resource(),
+                                              stream);
+  auto d_candidates_order = candidates_order->view().data<size_type>();
+
+  auto result = make_numeric_column(
+    data_type(type_to_id<size_type>()), k, mask_state::UNALLOCATED, stream, mr);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 d_candidates_order,
+                 d_candidates_order + k,
+                 d_candidates,
+                 result->mutable_view().data<size_type>());
+  return result;
+}
+
+std::unique_ptr<table> top_k(table_view const& input,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
+{
+  auto indices = top_k_order(
+    input, k, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+  return gather(input,
+                indices->view(),
+                out_of_bounds_policy::IGNORE,
+                negative_index_policy::NOT_ALLOWED,
+                mr,
+                stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k_order(table_view const& input,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k_order(input, k, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<table> top_k(table_view const& input,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(input, k, column_order, null_precedence, mr);
+}
+
+}  // namespace cudf
@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
@@ -28,12 +29,15 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
+#include <hash/concurrent_unordered_map.cuh>
 
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/logical.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace cudf {
 namespace detail {
@@ -145,39 +149,157 @@ column_view get_unique_ordered_indices(cudf::table_view const& keys,
   }
 }
 
+namespace {
+template <bool has_nulls>
+using row_hash_map = concurrent_unordered_map<size_type,
+                                              size_type,
+                                              row_hasher<default_hash, has_nulls>,
+                                              row_equality_comparator<has_nulls>>;
+
+/**
+ * @brief Sentinel stored in a map entry whose rows have duplicates under KEEP_NONE
+ */
+constexpr size_type DUPLICATE_ROW = -1;
+
+/**
+ * @brief Creates an empty map keyed by row index of `d_keys`, hashing and comparing whole rows.
+ */
+template <bool has_nulls>
+auto create_row_hash_map(table_device_view const& d_keys,
+                         null_equality nulls_equal,
+                         cudaStream_t stream)
+{
+  using map_type = row_hash_map<has_nulls>;
+  return map_type::create(compute_hash_table_size(d_keys.num_rows()),
+                          std::numeric_limits<size_type>::max(),
+                          std::numeric_limits<size_type>::max(),
+                          row_hasher<default_hash, has_nulls>{d_keys},
+                          row_equality_comparator<has_nulls>{
+                            d_keys, d_keys, nulls_equal == null_equality::EQUAL},
+                          typename map_type::allocator_type{},
+                          stream);
+}
+
+/**
+ * @brief Counts the distinct rows of `d_keys` as the number of successful inserts into a hash map.
+ */
+template <bool has_nulls>
+size_type count_distinct_rows(table_device_view const& d_keys,
+                              null_equality nulls_equal,
+                              cudaStream_t stream)
+{
+  auto map_ptr = create_row_hash_map<has_nulls>(d_keys, nulls_equal, stream);
+  auto map     = *map_ptr;
+  return thrust::count_if(rmm::exec_policy(stream)->on(stream),
+                          thrust::make_counting_iterator<size_type>(0),
+                          thrust::make_counting_iterator<size_type>(d_keys.num_rows()),
+                          [map] __device__(size_type i) mutable {
+                            return map.insert(thrust::make_pair(i, i)).second;
+                          });
+}
+
+/**
+ * @brief Returns the indices of the rows of `d_keys` retained as per `keep`.
+ *
+ * Every row is inserted into a hash map with its own index as the value. A row that finds its
+ * key already present updates the stored index with `atomicMin` (KEEP_FIRST) or `atomicMax`
+ * (KEEP_LAST), or marks the entry as DUPLICATE_ROW (KEEP_NONE). The retained indices are then
+ * collected either in input order, by looking each row up again, or in map order, by compacting
+ * the map's values directly. A row with nulls is not found again if nulls compare unequal, and is
+ * then retained as the only row of its entry.
+ */
+template <bool has_nulls>
+rmm::device_vector<size_type> get_distinct_indices(table_device_view const& d_keys,
+                                                   duplicate_keep_option keep,
+                                                   null_equality nulls_equal,
+                                                   bool preserve_input_order,
+                                                   cudaStream_t stream)
+{
+  auto const num_rows = d_keys.num_rows();
+  auto map_ptr        = create_row_hash_map<has_nulls>(d_keys, nulls_equal, stream);
+  auto map            = *map_ptr;
+
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     [map, keep] __device__(size_type i) mutable {
+                       auto const result = map.insert(thrust::make_pair(i, i));
+                       if (result.second) { return; }
+                       size_type* kept = &(result.first->second);
+                       if (keep == duplicate_keep_option::KEEP_FIRST) {
+                         atomicMin(kept, i);
+                       } else if (keep == duplicate_keep_option::KEEP_LAST) {
+                         atomicMax(kept, i);
+                       } else {
+                         atomicExch(kept, DUPLICATE_ROW);
+                       }
+                     });
+
+  rmm::device_vector<size_type> indices(num_rows);
+  if (preserve_input_order) {
+    auto const end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                     thrust::make_counting_iterator<size_type>(0),
+                                     thrust::make_counting_iterator<size_type>(num_rows),
+                                     indices.begin(),
+                                     [map] __device__(size_type i) {
+                                       // Rows with nulls that compare unequal are never found,
+                                       // and every one of them is a distinct row of its own
+                                       auto const found = map.find(i);
+                                       return found == map.end() or found->second == i;
+                                     });
+    indices.resize(thrust::distance(indices.begin(), end));
+  } else {
+    // unused entries hold max(size_type), so only retained row indices fall in [0, num_rows)
+    auto values = thrust::make_transform_iterator(
+      map.data(),
+      [] __device__(thrust::pair<size_type, size_type> const& entry) { return entry.second; });
+    auto const end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                     values,
+                                     values + map.capacity(),
+                                     indices.begin(),
+                                     [num_rows] __device__(size_type index) {
+                                       return index >= 0 and index < num_rows;
+                                     });
+    indices.resize(thrust::distance(indices.begin(), end));
+  }
+  return indices;
+}
+}  // namespace
+
 cudf::size_type distinct_count(table_view const& keys,
                                null_equality nulls_equal,
                                cudaStream_t stream)
 {
-  // sort only indices
-  auto sorted_indices = sorted_order(
-    keys, std::vector<order>{}, std::vector<null_order>{}, rmm::mr::get_default_resource(), stream);
+  if (0 == keys.num_rows()) { return 0; }
 
-  // count unique elements
-  auto sorted_row_index   = sorted_indices->view().data<cudf::size_type>();
   auto device_input_table = cudf::table_device_view::create(keys, stream);
+  return cudf::has_nulls(keys)
+           ? count_distinct_rows<true>(*device_input_table, nulls_equal, stream)
+           : count_distinct_rows<false>(*device_input_table, nulls_equal, stream);
+}
 
-  if (cudf::has_nulls(keys)) {
-    row_equality_comparator<true> comp(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    return thrust::count_if(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::counting_iterator<cudf::size_type>(0),
-      thrust::counting_iterator<cudf::size_type>(keys.num_rows()),
-      [sorted_row_index, comp] __device__(cudf::size_type i) {
-        return (i == 0 || not comp(sorted_row_index[i], sorted_row_index[i - 1]));
-      });
-  } else {
-    row_equality_comparator<false> comp(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    return thrust::count_if(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::counting_iterator<cudf::size_type>(0),
-      thrust::counting_iterator<cudf::size_type>(keys.num_rows()),
-      [sorted_row_index, comp] __device__(cudf::size_type i) {
-        return (i == 0 || not comp(sorted_row_index[i], sorted_row_index[i - 1]));
-      });
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                bool preserve_input_order,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream)
+{
+  if (0 == input.num_rows() || 0 == input.num_columns() || 0 == keys.size()) {
+    return empty_like(input);
   }
+
+  auto keys_view          = input.select(keys);
+  auto device_input_table = cudf::table_device_view::create(keys_view, stream);
+  auto const indices =
+    cudf::has_nulls(keys_view)
+      ? get_distinct_indices<true>(
+          *device_input_table, keep, nulls_equal, preserve_input_order, stream)
+      : get_distinct_indices<false>(
+          *device_input_table, keep, nulls_equal, preserve_input_order, stream);
+
+  return detail::gather(input, indices.begin(), indices.end(), false, mr, stream);
 }
 
 std::unique_ptr<table> drop_duplicates(table_view const& input,
@@ -329,6 +451,17 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
   return detail::drop_duplicates(input, keys, keep, nulls_equal, mr);
 }
 
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option const keep,
+                                null_equality nulls_equal,
+                                bool preserve_input_order,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct(input, keys, keep, nulls_equal, preserve_input_order, mr);
+}
+
 cudf::size_type distinct_count(column_view const& input,
                                null_policy null_handling,
                                nan_policy nan_handling)
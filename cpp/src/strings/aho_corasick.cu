@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <strings/aho_corasick.cuh>
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+std::unique_ptr<aho_corasick> aho_corasick::create(strings_column_view const& targets,
+                                                   cudaStream_t stream)
+{
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+  auto const targets_count = targets.size();
+
+  // copy the targets to the host
+  std::vector<int32_t> h_offsets(targets_count + 1, 0);
+  std::vector<uint8_t> h_chars;
+  if (targets_count > 0) {
+    CUDA_TRY(cudaMemcpyAsync(h_offsets.data(),
+                             targets.offsets().data<int32_t>() + targets.offset(),
+                             h_offsets.size() * sizeof(int32_t),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    h_chars.resize(h_offsets.back());
+    if (!h_chars.empty()) {
+      CUDA_TRY(cudaMemcpyAsync(h_chars.data(),
+                               targets.chars().data<char>() + h_offsets.front(),
+                               h_chars.size(),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+    }
+  }
+  auto const target_begin = [&](size_type idx) {
+    return h_chars.data() + (h_offsets[idx] - h_offsets.front());
+  };
+
+  // the bytes that appear in the targets each have a class; all other bytes share class 0
+  std::vector<uint8_t> byte_classes(256, 0);
+  int32_t classes_count = 1;
+  for (auto const byte : h_chars) {
+    if (byte_classes[byte] == 0) byte_classes[byte] = static_cast<uint8_t>(classes_count++);
+  }
+
+  // build the trie of the targets; state 0 is the root
+  std::vector<int32_t> transitions(classes_count, -1);
+  std::vector<std::vector<int32_t>> outputs(1);
+  std::vector<size_type> target_chars(targets_count);
+  std::vector<size_type> target_bytes(targets_count);
+  for (size_type idx = 0; idx < targets_count; ++idx) {
+    auto const begin  = target_begin(idx);
+    auto const bytes  = h_offsets[idx + 1] - h_offsets[idx];
+    target_bytes[idx] = bytes;
+    target_chars[idx] = static_cast<size_type>(
+      std::count_if(begin, begin + bytes, [](uint8_t byte) { return is_begin_utf8_char(byte); }));
+    if (bytes == 0) continue;
+    int32_t state = 0;
+    for (auto ptr = begin; ptr < begin + bytes; ++ptr) {
+      auto& next = transitions[state * classes_count + byte_classes[*ptr]];
+      if (next < 0) {
+        next = static_cast<int32_t>(outputs.size());
+        outputs.emplace_back();
+        transitions.resize(transitions.size() + classes_count, -1);
+      }
+      state = transitions[state * classes_count + byte_classes[*ptr]];
+    }
+    outputs[state].push_back(idx);
+  }
+
+  // complete the transitions with the failure links, in order of the depths of the states:
+  // a missing transition goes where the longest proper suffix of the state that is in the trie
+  // goes, and a state also outputs the targets of that suffix
+  auto const states_count = static_cast<int32_t>(outputs.size());
+  std::vector<int32_t> failures(states_count, 0);
+  std::queue<int32_t> queue;
+  for (int32_t cls = 0; cls < classes_count; ++cls) {
+    auto& next = transitions[cls];
+    if (next < 0) {
+      next = 0;
+    } else {
+      queue.push(next);
+    }
+  }
+  while (!queue.empty()) {
+    auto const state = queue.front();
+    queue.pop();
+    auto& state_outputs        = outputs[state];
+    auto const& suffix_outputs = outputs[failures[state]];
+    state_outputs.insert(state_outputs.end(), suffix_outputs.begin(), suffix_outputs.end());
+    std::sort(state_outputs.begin(), state_outputs.end());
+    for (int32_t cls = 0; cls < classes_count; ++cls) {
+      auto const suffix_next = transitions[failures[state] * classes_count + cls];
+      auto& next             = transitions[state * classes_count + cls];
+      if (next < 0) {
+        next = suffix_next;
+      } else {
+        failures[next] = suffix_next;
+        queue.push(next);
+      }
+    }
+  }
+
+  std::vector<int32_t> output_offsets(states_count + 1, 0);
+  std::vector<int32_t> flat_outputs;
+  for (int32_t state = 0; state < states_count; ++state) {
+    flat_outputs.insert(flat_outputs.end(), outputs[state].begin(), outputs[state].end());
+    output_offsets[state + 1] = static_cast<int32_t>(flat_outputs.size());
+  }
+
+  std::unique_ptr<aho_corasick> result(new aho_corasick());
+  result->_byte_classes   = byte_classes;
+  result->_classes_count  = classes_count;
+  result->_transitions    = transitions;
+  result->_output_offsets = output_offsets;
+  result->_outputs        = flat_outputs;
+  result->_target_chars   = target_chars;
+  result->_target_bytes   = target_bytes;
+  return result;
+}
+
+aho_corasick_device aho_corasick::view() const
+{
+  aho_corasick_device result;
+  result.byte_classes   = _byte_classes.data().get();
+  result.classes_count  = _classes_count;
+  result.transitions    = _transitions.data().get();
+  result.output_offsets = _output_offsets.data().get();
+  result.outputs        = _outputs.data().get();
+  result.target_chars   = _target_chars.data().get();
+  result.target_bytes   = _target_bytes.data().get();
+  return result;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
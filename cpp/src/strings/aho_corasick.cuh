@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <memory>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief Aho-Corasick automaton of a set of target strings stored on the device.
+ *
+ * Reading a string byte by byte through the automaton finds all the occurrences of all the
+ * targets in one pass over the string, independently of the number of targets.
+ */
+struct aho_corasick_device {
+  const uint8_t* byte_classes{};    // class of every byte value; bytes in no target share 0
+  int32_t classes_count{};
+  const int32_t* transitions{};     // next state of every state and byte class
+  const int32_t* output_offsets{};  // range of `outputs` of every state
+  const int32_t* outputs{};         // indices of the targets that end at a state, ascending
+  const size_type* target_chars{};  // number of characters of every target
+  const size_type* target_bytes{};  // number of bytes of every target
+
+  /**
+   * @brief Calls `fn(target_idx, end_byte, end_char)` for every occurrence of every non-empty
+   * target in `d_str`.
+   *
+   * The occurrences are visited in the order of their end positions, and the occurrences that
+   * end at the same position in the order of their target indices. `end_byte` and `end_char`
+   * are the byte and character positions just after the occurrence.
+   */
+  template <typename Function>
+  __device__ void for_each_match(string_view const& d_str, Function fn) const
+  {
+    auto const ptr = reinterpret_cast<const uint8_t*>(d_str.data());
+    int32_t state  = 0;
+    size_type chars{0};
+    for (size_type pos = 0; pos < d_str.size_bytes(); ++pos) {
+      auto const byte = ptr[pos];
+      chars += is_begin_utf8_char(byte);
+      state = transitions[state * classes_count + byte_classes[byte]];
+      for (auto out = output_offsets[state]; out < output_offsets[state + 1]; ++out)
+        fn(outputs[out], pos + 1, chars);
+    }
+  }
+};
+
+/**
+ * @brief Owns the device memory of an `aho_corasick_device` automaton.
+ */
+class aho_corasick {
+ public:
+  /**
+   * @brief Builds the automaton of `targets` on the host and copies it to the device.
+   *
+   * Empty targets are never found by the automaton.
+   *
+   * @throw cudf::logic_error if `targets` has nulls
+   *
+   * @param targets The strings to search for.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  static std::unique_ptr<aho_corasick> create(strings_column_view const& targets,
+                                              cudaStream_t stream = 0);
+
+  aho_corasick_device view() const;
+
+ private:
+  aho_corasick() = default;
+
+  rmm::device_vector<uint8_t> _byte_classes;
+  int32_t _classes_count{};
+  rmm::device_vector<int32_t> _transitions;
+  rmm::device_vector<int32_t> _output_offsets;
+  rmm::device_vector<int32_t> _outputs;
+  rmm::device_vector<size_type> _target_chars;
+  rmm::device_vector<size_type> _target_bytes;
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -18,11 +18,13 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <strings/regex/prefilter.cuh>
 #include <strings/regex/regex.cuh>
 #include <strings/utilities.hpp>
 
@@ -62,6 +64,59 @@ struct contains_fn {
   }
 };
 
+/**
+ * @brief Computes the result of every string with the deterministic automaton of the regex
+ * program read from shared memory.
+ *
+ * The result of the string at `idx` is `fn(idx, match)`, where `match` is the result of the
+ * automaton: 1 or 0 if the string matches or not, and -1 if the string has a character that
+ * only the regex program can evaluate.
+ */
+template <typename Function, typename ResultType>
+__global__ void dfa_match_kernel(redfa_device dfa,
+                                 column_device_view d_strings,
+                                 Function fn,
+                                 ResultType* d_results)
+{
+  extern __shared__ uint8_t shared_dfa[];
+  auto const d_dfa = dfa.load(shared_dfa);
+  for (size_type idx = threadIdx.x + blockIdx.x * blockDim.x; idx < d_strings.size();
+       idx += blockDim.x * gridDim.x) {
+    int32_t match =
+      d_strings.is_null(idx) ? 0 : d_dfa.is_match(d_strings.element<string_view>(idx));
+    d_results[idx] = fn(idx, match);
+  }
+}
+
+template <typename Function, typename ResultType>
+void dfa_match(redfa_device const& dfa,
+               column_device_view const& d_strings,
+               Function fn,
+               ResultType* d_results,
+               cudaStream_t stream)
+{
+  if (d_strings.size() == 0) return;
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d grid{d_strings.size(), block_size};
+  dfa_match_kernel<<<grid.num_blocks, grid.num_threads_per_block, dfa.size, stream>>>(
+    dfa, d_strings, fn, d_results);
+  CHECK_CUDA(stream);
+}
+
+/**
+ * @brief Uses the automaton result of a string and runs the regex program only when the
+ * automaton could not tell.
+ */
+template <size_t stack_size>
+struct contains_dfa_fn {
+  contains_fn<stack_size> nfa;
+
+  __device__ bool operator()(size_type idx, int32_t match)
+  {
+    return match < 0 ? nfa(idx) : static_cast<bool>(match);
+  }
+};
+
 //
 std::unique_ptr<column> contains_util(
   strings_column_view const& strings,
@@ -88,26 +143,46 @@ std::unique_ptr<column> contains_util(
   auto d_results = results->mutable_view().data<bool>();
 
   // fill the output column
-  auto execpol    = rmm::exec_policy(stream);
   int regex_insts = d_prog.insts_counts();
-  if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      contains_fn<RX_STACK_SMALL>{d_prog, d_column, beginning_only});
+  auto const dfa  = d_prog.get_dfa(beginning_only);
+  if (dfa.states_count > 0) {
+    // the automaton decides most strings; the program runs only for the others
+    if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+      dfa_match(dfa,
+                d_column,
+                contains_dfa_fn<RX_STACK_SMALL>{{d_prog, d_column, beginning_only}},
+                d_results,
+                stream);
+    else if (regex_insts <= RX_MEDIUM_INSTS)
+      dfa_match(dfa,
+                d_column,
+                contains_dfa_fn<RX_STACK_MEDIUM>{{d_prog, d_column, beginning_only}},
+                d_results,
+                stream);
+    else
+      dfa_match(dfa,
+                d_column,
+                contains_dfa_fn<RX_STACK_LARGE>{{d_prog, d_column, beginning_only}},
+                d_results,
+                stream);
+  } else if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+    prefiltered_transform(d_prog,
+                          d_column,
+                          contains_fn<RX_STACK_SMALL>{d_prog, d_column, beginning_only},
+                          d_results,
+                          stream);
   else if (regex_insts <= RX_MEDIUM_INSTS)
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      contains_fn<RX_STACK_MEDIUM>{d_prog, d_column, beginning_only});
+    prefiltered_transform(d_prog,
+                          d_column,
+                          contains_fn<RX_STACK_MEDIUM>{d_prog, d_column, beginning_only},
+                          d_results,
+                          stream);
   else
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      contains_fn<RX_STACK_LARGE>{d_prog, d_column, beginning_only});
+    prefiltered_transform(d_prog,
+                          d_column,
+                          contains_fn<RX_STACK_LARGE>{d_prog, d_column, beginning_only},
+                          d_results,
+                          stream);
 
   results->set_null_count(strings.null_count());
   return results;
@@ -183,6 +258,16 @@ struct count_fn {
   }
 };
 
+/**
+ * @brief Counts the matches of the strings that the automaton found a match in.
+ */
+template <size_t stack_size>
+struct count_dfa_fn {
+  count_fn<stack_size> nfa;
+
+  __device__ int32_t operator()(size_type idx, int32_t match) { return match == 0 ? 0 : nfa(idx); }
+};
+
 }  // namespace
 
 std::unique_ptr<column> count_re(
@@ -209,26 +294,28 @@ std::unique_ptr<column> count_re(
   auto d_results = results->mutable_view().data<int32_t>();
 
   // fill the output column
-  auto execpol    = rmm::exec_policy(stream);
   int regex_insts = d_prog.insts_counts();
-  if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      count_fn<RX_STACK_SMALL>{d_prog, d_column});
+  auto const dfa  = d_prog.get_dfa(false);
+  if (dfa.states_count > 0) {
+    // the automaton finds the strings without any match; the program counts the others
+    if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+      dfa_match(
+        dfa, d_column, count_dfa_fn<RX_STACK_SMALL>{{d_prog, d_column}}, d_results, stream);
+    else if (regex_insts <= RX_MEDIUM_INSTS)
+      dfa_match(
+        dfa, d_column, count_dfa_fn<RX_STACK_MEDIUM>{{d_prog, d_column}}, d_results, stream);
+    else
+      dfa_match(
+        dfa, d_column, count_dfa_fn<RX_STACK_LARGE>{{d_prog, d_column}}, d_results, stream);
+  } else if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+    prefiltered_transform(
+      d_prog, d_column, count_fn<RX_STACK_SMALL>{d_prog, d_column}, d_results, stream);
   else if (regex_insts <= RX_MEDIUM_INSTS)
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      count_fn<RX_STACK_MEDIUM>{d_prog, d_column});
+    prefiltered_transform(
+      d_prog, d_column, count_fn<RX_STACK_MEDIUM>{d_prog, d_column}, d_results, stream);
   else
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      count_fn<RX_STACK_LARGE>{d_prog, d_column});
+    prefiltered_transform(
+      d_prog, d_column, count_fn<RX_STACK_LARGE>{d_prog, d_column}, d_results, stream);
 
   results->set_null_count(strings.null_count());
   return results;
@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/iso_datetime.cuh>
 #include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -118,6 +119,10 @@ struct format_compiler {
                                               {'p', 2},
                                               {'j', 3}};
 
+  // set by compile_to_device if the format is one of the fixed-width ISO-8601 forms
+  bool is_iso_format{false};
+  cudf::detail::iso_datetime_format iso_format;
+
   format_compiler(const char* format, timestamp_units units) : format(format), units(units) {}
 
   format_item const* compile_to_device()
@@ -156,6 +161,7 @@ struct format_compiler {
       items.push_back(format_item::new_specifier(ch, spec_length));
       template_string.append((size_t)spec_length, ch);
     }
+    match_iso_format(items);
     // create program in device memory
     d_items.resize(items.size());
     CUDA_TRY(cudaMemcpyAsync(
@@ -163,6 +169,39 @@ struct format_compiler {
     return d_items.data().get();
   }
 
+  // Checks whether the items are `%Y-%m-%d`, optionally followed by 'T' or ' ' and `%H:%M:%S`,
+  // then `.%f` and a 'Z', so that the strings can be parsed at fixed offsets.
+  void match_iso_format(std::vector<format_item> const& items)
+  {
+    std::string signature;
+    for (auto const& item : items) {
+      if (item.item_type == format_char_type::specifier || item.value == '%') {
+        signature.append(1, '%');
+      }
+      signature.append(1, item.value);
+    }
+    auto const matches = [&signature](std::string const& prefix) {
+      auto const found = signature.compare(0, prefix.size(), prefix) == 0;
+      if (found) { signature.erase(0, prefix.size()); }
+      return found;
+    };
+
+    cudf::detail::iso_datetime_format iso;
+    if (!matches("%Y-%m-%d")) return;
+    if (matches("T%H:%M:%S") || matches(" %H:%M:%S")) {
+      iso.has_time       = true;
+      iso.time_separator = items[5].value;
+      if (matches(".%f")) { iso.subsecond_digits = subsecond_precision(); }
+    }
+    iso.has_utc_suffix = matches("Z");
+    // the sizes differ for a `%0f` specifier, which reads no digits after the '.'
+    if (!signature.empty() || iso.size() != static_cast<size_type>(template_string.size())) {
+      return;
+    }
+    is_iso_format = true;
+    iso_format    = iso;
+  }
+
   // these calls are only valid after compile_to_device is called
   size_type template_bytes() const { return static_cast<size_type>(template_string.size()); }
   size_type items_count() const { return static_cast<size_type>(d_items.size()); }
@@ -177,6 +216,8 @@ struct parse_datetime {
   size_type items_count;
   timestamp_units units;
   int8_t subsecond_precision;
+  bool is_iso_format;
+  cudf::detail::iso_datetime_format iso_format;
 
   //
   __device__ int32_t str2int(const char* str, size_type bytes)
@@ -247,6 +288,24 @@ struct parse_datetime {
     return 0;
   }
 
+  // Reads the datetime string at the fixed offsets of an ISO-8601 format.
+  // Returns false if the format is not ISO-8601 or the string does not match it, in which
+  // case the format_items are walked instead.
+  __device__ bool parse_iso_into_parts(string_view const& d_string, int32_t* timeparts)
+  {
+    if (!is_iso_format || d_string.size_bytes() < iso_format.size()) return false;
+    cudf::detail::datetime_fields fields;
+    if (!cudf::detail::parse_iso_datetime(d_string.data(), iso_format, fields)) return false;
+    timeparts[TP_YEAR]      = fields.year;
+    timeparts[TP_MONTH]     = fields.month;
+    timeparts[TP_DAY]       = fields.day;
+    timeparts[TP_HOUR]      = fields.hour;
+    timeparts[TP_MINUTE]    = fields.minute;
+    timeparts[TP_SECOND]    = fields.second;
+    timeparts[TP_SUBSECOND] = fields.subsecond;
+    return true;
+  }
+
   __device__ int64_t timestamp_from_parts(int32_t const* timeparts, timestamp_units units)
   {
     auto year = timeparts[TP_YEAR];
@@ -305,13 +364,21 @@ struct parse_datetime {
     string_view d_str = d_strings.element<string_view>(idx);
     if (d_str.empty()) return epoch_time;
     //
-    int32_t timeparts[TP_ARRAYSIZE] = {0, 1, 1};                // month and day are 1-based
-    if (parse_into_parts(d_str, timeparts)) return epoch_time;  // unexpected parse case
+    int32_t timeparts[TP_ARRAYSIZE] = {0, 1, 1};  // month and day are 1-based
+    if (!parse_iso_into_parts(d_str, timeparts) && parse_into_parts(d_str, timeparts))
+      return epoch_time;  // unexpected parse case
     //
     return T{T::duration(timestamp_from_parts(timeparts, units))};
   }
 };
 
+// the conversion functors are only instantiated for the timestamp types
+using timestamp_type_ids = type_id_list<type_id::TIMESTAMP_DAYS,
+                                        type_id::TIMESTAMP_SECONDS,
+                                        type_id::TIMESTAMP_MILLISECONDS,
+                                        type_id::TIMESTAMP_MICROSECONDS,
+                                        type_id::TIMESTAMP_NANOSECONDS>;
+
 // convert cudf type to timestamp units
 struct dispatch_timestamp_to_units_fn {
   template <typename T>
@@ -359,23 +426,19 @@ struct dispatch_to_timestamps_fn {
     format_compiler compiler(format.c_str(), units);
     auto d_items   = compiler.compile_to_device();
     auto d_results = results_view.data<T>();
-    parse_datetime<T> pfn{
-      d_strings, d_items, compiler.items_count(), units, compiler.subsecond_precision()};
+    parse_datetime<T> pfn{d_strings,
+                          d_items,
+                          compiler.items_count(),
+                          units,
+                          compiler.subsecond_precision(),
+                          compiler.is_iso_format,
+                          compiler.iso_format};
     thrust::transform(rmm::exec_policy(stream)->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(results_view.size()),
                       d_results,
                       pfn);
   }
-  template <typename T, std::enable_if_t<not cudf::is_timestamp<T>()>* = nullptr>
-  void operator()(column_device_view const&,
-                  std::string const&,
-                  timestamp_units,
-                  mutable_column_view&,
-                  cudaStream_t) const
-  {
-    CUDF_FAIL("Only timestamps type are expected");
-  }
 };
 
 }  // namespace
@@ -391,7 +454,8 @@ std::unique_ptr<cudf::column> to_timestamps(strings_column_view const& strings,
   if (strings_count == 0) return make_timestamp_column(timestamp_type, 0);
 
   CUDF_EXPECTS(!format.empty(), "Format parameter must not be empty.");
-  timestamp_units units = cudf::type_dispatcher(timestamp_type, dispatch_timestamp_to_units_fn());
+  timestamp_units units =
+    cudf::type_dispatcher<timestamp_type_ids>(timestamp_type, dispatch_timestamp_to_units_fn());
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
@@ -403,7 +467,7 @@ std::unique_ptr<cudf::column> to_timestamps(strings_column_view const& strings,
                                        stream,
                                        mr);
   auto results_view = results->mutable_view();
-  cudf::type_dispatcher(
+  cudf::type_dispatcher<timestamp_type_ids>(
     timestamp_type, dispatch_to_timestamps_fn(), d_column, format, units, results_view, stream);
   results->set_null_count(strings.null_count());
   return results;
@@ -667,17 +731,6 @@ struct dispatch_from_timestamps_fn {
                        d_timestamps.size(),
                        pfn);
   }
-  template <typename T, std::enable_if_t<not cudf::is_timestamp<T>()>* = nullptr>
-  void operator()(column_device_view const&,
-                  format_item const*,
-                  size_type,
-                  timestamp_units,
-                  const int32_t*,
-                  char* d_chars,
-                  cudaStream_t stream) const
-  {
-    CUDF_FAIL("Only timestamps type are expected");
-  }
 };
 
 }  // namespace
@@ -693,7 +746,7 @@ std::unique_ptr<column> from_timestamps(column_view const& timestamps,
 
   CUDF_EXPECTS(!format.empty(), "Format parameter must not be empty.");
   timestamp_units units =
-    cudf::type_dispatcher(timestamps.type(), dispatch_timestamp_to_units_fn());
+    cudf::type_dispatcher<timestamp_type_ids>(timestamps.type(), dispatch_timestamp_to_units_fn());
 
   format_compiler compiler(format.c_str(), units);
   auto d_format_items = compiler.compile_to_device();
@@ -725,15 +778,15 @@ std::unique_ptr<column> from_timestamps(column_view const& timestamps,
   auto d_chars    = chars_view.template data<char>();
   // fill in chars column with timestamps
   // dispatcher is called to handle the different timestamp types
-  cudf::type_dispatcher(timestamps.type(),
-                        dispatch_from_timestamps_fn(),
-                        d_column,
-                        d_format_items,
-                        compiler.items_count(),
-                        units,
-                        d_new_offsets,
-                        d_chars,
-                        stream);
+  cudf::type_dispatcher<timestamp_type_ids>(timestamps.type(),
+                                            dispatch_from_timestamps_fn(),
+                                            d_column,
+                                            d_format_items,
+                                            compiler.items_count(),
+                                            units,
+                                            d_new_offsets,
+                                            d_chars,
+                                            stream);
   //
   return make_strings_column(strings_count,
                              std::move(offsets_column),
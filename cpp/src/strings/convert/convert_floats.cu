@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/strings/convert/convert_floats.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -61,13 +62,28 @@ __device__ inline double stod(string_view const& d_str)
     ++in_ptr;
   }
   unsigned long max_mantissa = 0x0FFFFFFFFFFFFF;
-  unsigned long digits       = 0;
-  int exp_off                = 0;
-  bool decimal               = false;
+  // eight more digits never exceed the mantissa from this value
+  unsigned long max_eight_digits_prefix =
+    (max_mantissa - (cudf::detail::eight_digits_scale - 1)) / cudf::detail::eight_digits_scale;
+  unsigned long digits = 0;
+  int exp_off          = 0;
+  bool decimal         = false;
+  bool eight_digits    = true;  // false after a chunk failed, until the decimal point
   while (in_ptr < end) {
+    if (eight_digits && (end - in_ptr) >= 8 && digits <= max_eight_digits_prefix) {
+      auto const word = cudf::detail::load_8_bytes(in_ptr);
+      if (cudf::detail::is_8_digits(word)) {
+        digits = (digits * cudf::detail::eight_digits_scale) + cudf::detail::parse_8_digits(word);
+        exp_off -= 8 * (int)decimal;
+        in_ptr += 8;
+        continue;
+      }
+      eight_digits = false;
+    }
     char ch = *in_ptr;
     if (ch == '.') {
-      decimal = true;
+      decimal      = true;
+      eight_digits = true;
       ++in_ptr;
       continue;
     }
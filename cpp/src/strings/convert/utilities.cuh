@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/strings/string_view.cuh>
 
 namespace cudf {
@@ -29,6 +30,7 @@ namespace detail {
  * The string is expected to contain base-10 [0-9] characters only.
  * Any other character will end the parse.
  * Overflow of the int64 type is not detected.
+ * The digits are parsed eight at a time while there are eight left.
  */
 __device__ inline int64_t string_to_integer(string_view const& d_str)
 {
@@ -42,6 +44,14 @@ __device__ inline int64_t string_to_integer(string_view const& d_str)
     ++ptr;
     --bytes;
   }
+  while (bytes >= 8) {
+    auto const word = cudf::detail::load_8_bytes(ptr);
+    if (!cudf::detail::is_8_digits(word)) break;
+    value = value * static_cast<int64_t>(cudf::detail::eight_digits_scale) +
+            static_cast<int64_t>(cudf::detail::parse_8_digits(word));
+    ptr += 8;
+    bytes -= 8;
+  }
   for (size_type idx = 0; idx < bytes; ++idx) {
     char chr = *ptr++;
     if (chr < '0' || chr > '9') break;
@@ -44,65 +44,58 @@ constexpr bool use_fused_kernel_heuristic(bool const has_nulls,
                    : total_bytes < num_columns * 393216;  // midpoint of 262144 and 524288
 }
 
-// Using a functor instead of a lambda as a workaround for:
-// error: The enclosing parent function ("create_strings_device_views") for an
-// extended __device__ lambda must not have deduced return type
+/**
+ * @brief The buffers of one input strings column of a concatenation
+ *
+ * Built on the host and uploaded at once for all the inputs, instead of creating a device view
+ * of every input and its children.
+ */
+struct strings_partition {
+  int32_t const* offsets;         // offset of the first string, past the parent offset
+  char const* chars;              // nullptr if the column is empty
+  bitmask_type const* null_mask;  // nullptr if every string is valid
+  size_type offset;               // parent offset, for the null mask
+  size_type size;
+
+  __device__ bool is_valid(size_type element_index) const
+  {
+    return null_mask == nullptr or bit_is_set(null_mask, offset + element_index);
+  }
+};
+
 struct chars_size_transform {
-  __device__ size_t operator()(column_device_view const& col) const
+  __device__ size_t operator()(strings_partition const& partition) const
   {
-    if (col.size() > 0) {
-      constexpr auto offsets_index = strings_column_view::offsets_column_index;
-      auto d_offsets               = col.child(offsets_index).data<int32_t>();
-      return d_offsets[col.size() + col.offset()] - d_offsets[col.offset()];
-    } else {
-      return 0;
-    }
+    return partition.size > 0 ? partition.offsets[partition.size] - partition.offsets[0] : 0;
   }
 };
 
-auto create_strings_device_views(std::vector<column_view> const& views, cudaStream_t stream)
+auto create_strings_partitions(std::vector<column_view> const& views, cudaStream_t stream)
 {
-  // Create device views for each input view
-  using CDViewPtr =
-    decltype(column_device_view::create(std::declval<column_view>(), std::declval<cudaStream_t>()));
-  auto device_view_owners = std::vector<CDViewPtr>(views.size());
-  std::transform(
-    views.cbegin(), views.cend(), device_view_owners.begin(), [stream](auto const& col) {
-      return column_device_view::create(col, stream);
-    });
-
-  // Assemble contiguous array of device views
-  auto device_views = thrust::host_vector<column_device_view>();
-  device_views.reserve(views.size());
-  std::transform(device_view_owners.cbegin(),
-                 device_view_owners.cend(),
-                 std::back_inserter(device_views),
-                 [](auto const& col) { return *col; });
-  auto d_views = rmm::device_vector<column_device_view>{device_views};
-
-  // Compute the partition offsets and size of offset column
   // Note: Using 64-bit size_t so we can detect overflow of 32-bit size_type
-  auto input_offsets = thrust::host_vector<size_t>(views.size() + 1);
-  thrust::transform_inclusive_scan(
-    thrust::host,
-    device_views.cbegin(),
-    device_views.cend(),
-    std::next(input_offsets.begin()),
-    [](auto const& col) { return static_cast<size_t>(col.size()); },
-    thrust::plus<size_t>{});
+  auto partitions    = thrust::host_vector<strings_partition>();
+  auto input_offsets = thrust::host_vector<size_t>(views.size() + 1, 0);
+  partitions.reserve(views.size());
+  for (std::size_t i = 0; i < views.size(); ++i) {
+    auto const& view = views[i];
+    strings_partition partition{nullptr, nullptr, view.null_mask(), view.offset(), view.size()};
+    if (view.size() > 0) {  // empty column may not have children
+      partition.offsets =
+        view.child(strings_column_view::offsets_column_index).data<int32_t>() + view.offset();
+      partition.chars = view.child(strings_column_view::chars_column_index).data<char>();
+    }
+    partitions.push_back(partition);
+    input_offsets[i + 1] = input_offsets[i] + view.size();
+  }
+  auto d_partitions          = rmm::device_vector<strings_partition>{partitions};
   auto const d_input_offsets = rmm::device_vector<size_t>{input_offsets};
   auto const output_size     = input_offsets.back();
 
   // Compute the partition offsets and size of chars column
-  // Note: Using 64-bit size_t so we can detect overflow of 32-bit size_type
-  // Note: Using separate transform and inclusive_scan because
-  // transform_inclusive_scan fails to compile with:
-  // error: the default constructor of "cudf::column_device_view" cannot be
-  // referenced -- it is a deleted function
-  auto d_partition_offsets = rmm::device_vector<size_t>(views.size() + 1);
+  auto d_partition_offsets = rmm::device_vector<size_t>(views.size() + 1, 0);
   thrust::transform(rmm::exec_policy(stream)->on(stream),
-                    d_views.cbegin(),
-                    d_views.cend(),
+                    d_partitions.cbegin(),
+                    d_partitions.cend(),
                     std::next(d_partition_offsets.begin()),
                     chars_size_transform{});
   thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
@@ -111,8 +104,7 @@ auto create_strings_device_views(std::vector<column_view> const& views, cudaStre
                          d_partition_offsets.begin());
   auto const output_chars_size = d_partition_offsets.back();
 
-  return std::make_tuple(std::move(device_view_owners),
-                         std::move(d_views),
+  return std::make_tuple(std::move(d_partitions),
                          std::move(d_input_offsets),
                          std::move(d_partition_offsets),
                          output_size,
@@ -120,7 +112,7 @@ auto create_strings_device_views(std::vector<column_view> const& views, cudaStre
 }
 
 template <size_type block_size, bool Nullable>
-__global__ void fused_concatenate_string_offset_kernel(column_device_view const* input_views,
+__global__ void fused_concatenate_string_offset_kernel(strings_partition const* input_views,
                                                        size_t const* input_offsets,
                                                        size_t const* partition_offsets,
                                                        size_type const num_input_views,
@@ -142,14 +134,12 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
              thrust::seq, input_offsets, input_offsets + num_input_views, output_index);
     size_type const partition_index = offset_it - input_offsets;
 
-    auto const offset_index      = output_index - *offset_it;
-    auto const& input_view       = input_views[partition_index];
-    constexpr auto offsets_child = strings_column_view::offsets_column_index;
-    auto const* input_data       = input_view.child(offsets_child).data<int32_t>();
-    output_data[output_index] =
-      input_data[offset_index + input_view.offset()]  // handle parent offset
-      - input_data[input_view.offset()]               // subract first offset if non-zero
-      + partition_offsets[partition_index];           // add offset of source column
+    auto const offset_index   = output_index - *offset_it;
+    auto const& input_view    = input_views[partition_index];
+    auto const* input_data    = input_view.offsets;
+    output_data[output_index] = input_data[offset_index]       // parent offset already applied
+                                - input_data[0]                // subract first offset if non-zero
+                                + partition_offsets[partition_index];  // add offset of source
 
     if (Nullable) {
       bool const bit_is_set       = input_view.is_valid(offset_index);
@@ -179,7 +169,7 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
   }
 }
 
-__global__ void fused_concatenate_string_chars_kernel(column_device_view const* input_views,
+__global__ void fused_concatenate_string_chars_kernel(strings_partition const* input_views,
                                                       size_t const* partition_offsets,
                                                       size_type const num_input_views,
                                                       size_type const output_size,
@@ -198,30 +188,31 @@ __global__ void fused_concatenate_string_chars_kernel(column_device_view const*
     auto const offset_index = output_index - *offset_it;
     auto const& input_view  = input_views[partition_index];
 
-    constexpr auto offsets_child   = strings_column_view::offsets_column_index;
-    auto const* input_offsets_data = input_view.child(offsets_child).data<int32_t>();
-
-    constexpr auto chars_child   = strings_column_view::chars_column_index;
-    auto const* input_chars_data = input_view.child(chars_child).data<char>();
-
-    auto const first_char     = input_offsets_data[input_view.offset()];
-    output_data[output_index] = input_chars_data[offset_index + first_char];
+    auto const first_char     = input_view.offsets[0];
+    output_data[output_index] = input_view.chars[offset_index + first_char];
 
     output_index += blockDim.x * gridDim.x;
   }
 }
 
+struct first_char_transform {
+  __device__ int32_t operator()(strings_partition const& partition) const
+  {
+    return partition.size > 0 ? partition.offsets[0] : 0;
+  }
+};
+
 std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
                                     rmm::mr::device_memory_resource* mr,
                                     cudaStream_t stream)
 {
   // Compute output sizes
-  auto const device_views         = create_strings_device_views(columns, stream);
-  auto const& d_views             = std::get<1>(device_views);
-  auto const& d_input_offsets     = std::get<2>(device_views);
-  auto const& d_partition_offsets = std::get<3>(device_views);
-  auto const strings_count        = std::get<4>(device_views);
-  auto const total_bytes          = std::get<5>(device_views);
+  auto const partitions           = create_strings_partitions(columns, stream);
+  auto const& d_views             = std::get<0>(partitions);
+  auto const& d_input_offsets     = std::get<1>(partitions);
+  auto const& d_partition_offsets = std::get<2>(partitions);
+  auto const strings_count        = std::get<3>(partitions);
+  auto const total_bytes          = std::get<4>(partitions);
   auto const offsets_count        = strings_count + 1;
 
   if (strings_count == 0) { return make_empty_strings_column(mr, stream); }
@@ -253,7 +244,7 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
   }
 
   {  // Copy offsets columns with single kernel launch
-    rmm::device_scalar<size_type> d_valid_count(0);
+    rmm::device_scalar<size_type> d_valid_count(0, stream);
 
     constexpr size_type block_size{256};
     cudf::detail::grid_1d config(offsets_count, block_size);
@@ -286,25 +277,26 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
         total_bytes,
         d_new_chars);
     } else {
-      // Memcpy each input chars column (more efficient for very large strings)
-      for (auto column = columns.begin(); column != columns.end(); ++column) {
-        size_type column_size = column->size();
-        if (column_size == 0)  // nothing to do
-          continue;            // empty column may not have children
-        size_type column_offset   = column->offset();
-        column_view offsets_child = column->child(strings_column_view::offsets_column_index);
-        column_view chars_child   = column->child(strings_column_view::chars_column_index);
-
-        auto d_offsets       = offsets_child.data<int32_t>() + column_offset;
-        int32_t bytes_offset = thrust::device_pointer_cast(d_offsets)[0];
-
-        // copy the chars column data
-        auto d_chars    = chars_child.data<char>() + bytes_offset;
-        size_type bytes = thrust::device_pointer_cast(d_offsets)[column_size] - bytes_offset;
-        CUDA_TRY(cudaMemcpyAsync(d_new_chars, d_chars, bytes, cudaMemcpyDeviceToDevice, stream));
-
-        // get ready for the next column
-        d_new_chars += bytes;
+      // Memcpy each input chars column (more efficient for very large strings), with the
+      // ranges of all the inputs fetched at once
+      auto d_first_chars = rmm::device_vector<int32_t>(d_views.size());
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        d_views.cbegin(),
+                        d_views.cend(),
+                        d_first_chars.begin(),
+                        first_char_transform{});
+      thrust::host_vector<int32_t> const first_chars(d_first_chars);
+      thrust::host_vector<size_t> const partition_offsets(d_partition_offsets);
+      for (std::size_t i = 0; i < columns.size(); ++i) {
+        auto const bytes = partition_offsets[i + 1] - partition_offsets[i];
+        if (bytes == 0) continue;  // empty column may not have children
+        auto const d_chars =
+          columns[i].child(strings_column_view::chars_column_index).data<char>() + first_chars[i];
+        CUDA_TRY(cudaMemcpyAsync(d_new_chars + partition_offsets[i],
+                                 d_chars,
+                                 bytes,
+                                 cudaMemcpyDeviceToDevice,
+                                 stream));
       }
     }
   }
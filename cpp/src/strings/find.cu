@@ -23,6 +23,8 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <strings/utilities.cuh>
+#include <strings/utilities.hpp>
 
 #include <thrust/transform.h>
 
@@ -30,6 +32,80 @@ namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+// Threads per block for the kernels that process each string with a warp
+constexpr size_type warp_per_string_block_size = 256;
+
+/**
+ * @brief Returns the number of blocks for processing each string with a warp
+ */
+size_type warp_per_string_blocks(size_type strings_count)
+{
+  return cudf::util::div_rounding_up_safe(strings_count,
+                                          warp_per_string_block_size / cudf::detail::warp_size);
+}
+
+/**
+ * @brief Finds the character position of `d_target` in each string with a warp per string.
+ *
+ * The results are the same as the `find` or `rfind` functors of a `find_fn` call.
+ *
+ * @param d_strings Strings to search.
+ * @param d_target String to search for.
+ * @param start First character position to start the search.
+ * @param stop Last character position (exclusive) to end the search.
+ * @param forward True for the first occurrence, false for the last.
+ * @param d_results Character positions of the occurrences, or -1 if there is none.
+ */
+__global__ void find_warp_parallel_fn(column_device_view const d_strings,
+                                      string_view const d_target,
+                                      size_type const start,
+                                      size_type const stop,
+                                      bool const forward,
+                                      int32_t* d_results)
+{
+  auto const tid     = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  auto const str_idx = static_cast<size_type>(tid / cudf::detail::warp_size);
+  auto const lane    = static_cast<int>(tid % cudf::detail::warp_size);
+  if (str_idx >= d_strings.size()) return;  // every thread of a warp has the same string
+
+  int32_t position = -1;
+  if (!d_strings.is_null(str_idx)) {
+    auto const d_str  = d_strings.element<string_view>(str_idx);
+    auto const length = warp_characters_count(d_str, d_str.size_bytes(), lane);
+    auto const begin  = (start > length) ? length : start;
+    auto const end    = (stop < 0) || (stop > length) ? length : stop;
+    if (d_target.empty()) {
+      position = start > length ? -1 : (forward ? start : end);
+    } else {
+      auto const spos  = warp_byte_offset(d_str, begin, lane);
+      auto const epos  = warp_byte_offset(d_str, end, lane);
+      auto const found = warp_find(d_str, d_target, spos, epos, lane, forward);
+      if (found >= 0) position = warp_characters_count(d_str, found, lane);
+    }
+  }
+  if (lane == 0) d_results[str_idx] = position;
+}
+
+/**
+ * @brief Checks whether each string contains `d_target` with a warp per string.
+ */
+__global__ void contains_warp_parallel_fn(column_device_view const d_strings,
+                                          string_view const d_target,
+                                          bool* d_results)
+{
+  auto const tid     = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  auto const str_idx = static_cast<size_type>(tid / cudf::detail::warp_size);
+  auto const lane    = static_cast<int>(tid % cudf::detail::warp_size);
+  if (str_idx >= d_strings.size()) return;  // every thread of a warp has the same string
+
+  bool found = false;
+  if (!d_strings.is_null(str_idx)) {
+    auto const d_str = d_strings.element<string_view>(str_idx);
+    found            = warp_find(d_str, d_target, 0, d_str.size_bytes(), lane) >= 0;
+  }
+  if (lane == 0) d_results[str_idx] = found;
+}
+
 /**
  * @brief Utility to return integer column indicating the postion of
  * target string within each string in a strings column.
@@ -43,6 +119,7 @@ namespace {
  * @param start First character position to start the search.
  * @param stop Last character position (exclusive) to end the search.
  * @param pfn Functor used for locating `target` in each string.
+ * @param forward True if `pfn` finds the first occurrence, false if it finds the last.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return New integer column with character position values.
@@ -53,6 +130,7 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                 size_type start,
                                 size_type stop,
                                 FindFunction& pfn,
+                                bool forward,
                                 rmm::mr::device_memory_resource* mr,
                                 cudaStream_t stream)
 {
@@ -73,6 +151,15 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<int32_t>();
+  if (is_warp_per_string(strings, stream)) {
+    // long strings are searched by all the threads of a warp
+    find_warp_parallel_fn<<<warp_per_string_blocks(strings_count),
+                            warp_per_string_block_size,
+                            0,
+                            stream>>>(d_strings, d_target, start, stop, forward, d_results);
+    results->set_null_count(strings.null_count());
+    return results;
+  }
   // set the position values by evaluating the passed function
   thrust::transform(rmm::exec_policy(stream)->on(stream),
                     thrust::make_counting_iterator<size_type>(0),
@@ -107,7 +194,7 @@ std::unique_ptr<column> find(strings_column_view const& strings,
     return d_string.find(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, mr, stream);
+  return find_fn(strings, target, start, stop, pfn, true, mr, stream);
 }
 
 std::unique_ptr<column> rfind(strings_column_view const& strings,
@@ -126,7 +213,7 @@ std::unique_ptr<column> rfind(strings_column_view const& strings,
     return d_string.rfind(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, mr, stream);
+  return find_fn(strings, target, start, stop, pfn, false, mr, stream);
 }
 
 }  // namespace detail
@@ -284,6 +371,24 @@ std::unique_ptr<column> contains(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
 {
+  if (target.is_valid() && target.size() > 0 && is_warp_per_string(strings, stream)) {
+    // long strings are searched by all the threads of a warp
+    auto d_target       = string_view(target.data(), target.size());
+    auto strings_column = column_device_view::create(strings.parent(), stream);
+    auto results        = make_numeric_column(data_type{type_id::BOOL8},
+                                       strings.size(),
+                                       copy_bitmask(strings.parent(), stream, mr),
+                                       strings.null_count(),
+                                       stream,
+                                       mr);
+    contains_warp_parallel_fn<<<warp_per_string_blocks(strings.size()),
+                                warp_per_string_block_size,
+                                0,
+                                stream>>>(
+      *strings_column, d_target, results->mutable_view().data<bool>());
+    results->set_null_count(strings.null_count());
+    return results;
+  }
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) >= 0;
   };
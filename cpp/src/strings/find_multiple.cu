@@ -20,9 +20,11 @@
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/utilities/error.hpp>
+#include <strings/aho_corasick.cuh>
 
-#include <thrust/transform.h>
+#include <thrust/for_each.h>
 
 namespace cudf {
 namespace strings {
@@ -41,8 +43,8 @@ std::unique_ptr<column> find_multiple(
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
-  auto targets_column = column_device_view::create(targets.parent(), stream);
-  auto d_targets      = *targets_column;
+  auto automaton      = aho_corasick::create(targets, stream);
+  auto d_automaton    = automaton->view();
 
   // create output column
   auto total_count  = strings_count * targets_count;
@@ -54,22 +56,77 @@ std::unique_ptr<column> find_multiple(
                                      mr);  // no nulls
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<int32_t>();
-  // fill output column with position values
-  thrust::transform(rmm::exec_policy(stream)->on(stream),
-                    thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(total_count),
-                    d_results,
-                    [d_strings, d_targets, targets_count] __device__(size_type idx) {
-                      size_type str_idx = idx / targets_count;
-                      if (d_strings.is_null(str_idx)) return -1;
-                      string_view d_str = d_strings.element<string_view>(str_idx);
-                      string_view d_tgt = d_targets.element<string_view>(idx % targets_count);
-                      return d_str.find(d_tgt);
-                    });
+  // fill output column with the position of the first occurrence of each target
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    [d_strings, d_automaton, targets_count, d_results] __device__(size_type idx) {
+      auto const d_positions = d_results + idx * targets_count;
+      auto const is_null     = d_strings.is_null(idx);
+      // empty targets are found at the start of every string but never matched by the automaton
+      for (size_type tgt_idx = 0; tgt_idx < targets_count; ++tgt_idx)
+        d_positions[tgt_idx] = (!is_null && d_automaton.target_bytes[tgt_idx] == 0) ? 0 : -1;
+      if (is_null) return;
+      d_automaton.for_each_match(
+        d_strings.element<string_view>(idx),
+        [d_positions, d_automaton](size_type tgt_idx, size_type, size_type end_char) {
+          if (d_positions[tgt_idx] < 0)
+            d_positions[tgt_idx] = end_char - d_automaton.target_chars[tgt_idx];
+        });
+    });
   results->set_null_count(0);
   return results;
 }
 
+std::unique_ptr<table> contains_multiple(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto targets_count = targets.size();
+  CUDF_EXPECTS(targets_count > 0, "Must include at least one search target");
+  auto automaton   = aho_corasick::create(targets, stream);
+  auto d_automaton = automaton->view();
+
+  // create a column for each target
+  auto strings_count = strings.size();
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<bool*> h_results;
+  for (size_type tgt_idx = 0; tgt_idx < targets_count; ++tgt_idx) {
+    results.push_back(make_numeric_column(data_type{type_id::BOOL8},
+                                          strings_count,
+                                          copy_bitmask(strings.parent(), stream, mr),
+                                          strings.null_count(),
+                                          stream,
+                                          mr));
+    h_results.push_back(results.back()->mutable_view().data<bool>());
+  }
+  if (strings_count == 0) return std::make_unique<table>(std::move(results));
+
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+  rmm::device_vector<bool*> results_pointers(h_results);
+  auto d_results = results_pointers.data().get();
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    [d_strings, d_automaton, targets_count, d_results] __device__(size_type idx) {
+      // empty targets are in every string but are never matched by the automaton
+      for (size_type tgt_idx = 0; tgt_idx < targets_count; ++tgt_idx)
+        d_results[tgt_idx][idx] = d_automaton.target_bytes[tgt_idx] == 0;
+      if (d_strings.is_null(idx)) return;
+      d_automaton.for_each_match(
+        d_strings.element<string_view>(idx),
+        [d_results, idx](size_type tgt_idx, size_type, size_type) {
+          d_results[tgt_idx][idx] = true;
+        });
+    });
+  return std::make_unique<table>(std::move(results));
+}
+
 }  // namespace detail
 
 // external API
@@ -81,5 +138,13 @@ std::unique_ptr<column> find_multiple(strings_column_view const& strings,
   return detail::find_multiple(strings, targets, mr);
 }
 
+std::unique_ptr<table> contains_multiple(strings_column_view const& strings,
+                                         strings_column_view const& targets,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_multiple(strings, targets, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/detail/combine.hpp>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <strings/convert/utilities.cuh>
+#include <strings/utilities.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/logical.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+/**
+ * @brief Part of a format template: a literal or the value of a column.
+ */
+struct format_item {
+  size_type column;  ///< column of the value, or -1 for a literal
+  size_type offset;  ///< position of the literal in the literals buffer
+  size_type size;    ///< size of the literal in bytes
+};
+
+/**
+ * @brief Parses the format template into its items and the buffer of their literals.
+ *
+ * @return Number of `{}` in the template.
+ */
+size_type parse_format(std::string const& format_template,
+                       std::vector<format_item>& items,
+                       std::string& literals)
+{
+  size_type columns_count = 0;
+  auto add_literal        = [&](char chr) {
+    if (items.empty() || items.back().column >= 0) {
+      items.push_back(format_item{-1, static_cast<size_type>(literals.size()), 0});
+    }
+    literals.push_back(chr);
+    ++items.back().size;
+  };
+  for (size_t pos = 0; pos < format_template.size(); ++pos) {
+    auto const chr  = format_template[pos];
+    auto const next = pos + 1 < format_template.size() ? format_template[pos + 1] : 0;
+    if (chr == '{' && next == '{') {
+      add_literal('{');
+      ++pos;
+    } else if (chr == '}' && next == '}') {
+      add_literal('}');
+      ++pos;
+    } else if (chr == '{') {
+      CUDF_EXPECTS(next == '}', "Unmatched '{' in the format template");
+      items.push_back(format_item{columns_count++, 0, 0});
+      ++pos;
+    } else {
+      CUDF_EXPECTS(chr != '}', "Unmatched '}' in the format template");
+      add_literal(chr);
+    }
+  }
+  return columns_count;
+}
+
+/**
+ * @brief Writes a value padded with zeros to the given width.
+ *
+ * @return Number of bytes of the value.
+ */
+__device__ size_type write_padded(char* d_buffer, int64_t value, size_type width)
+{
+  auto const digits = count_digits(value);
+  auto const bytes  = value < 0 ? digits : std::max(digits, width);
+  if (d_buffer) {
+    for (size_type idx = digits; idx < bytes; ++idx) *d_buffer++ = '0';
+    integer_to_string(value, d_buffer);
+  }
+  return bytes;
+}
+
+/**
+ * @brief Writes the value of a row of a column and returns its size in bytes.
+ *
+ * Only the size is computed if `d_buffer` is null.
+ */
+struct format_value_fn {
+  column_device_view const d_column;
+  size_type const idx;
+  char* const d_buffer;
+
+  template <typename T, std::enable_if_t<std::is_same<T, string_view>::value>* = nullptr>
+  __device__ size_type operator()()
+  {
+    auto const d_str = d_column.element<string_view>(idx);
+    if (d_buffer) copy_string(d_buffer, d_str);
+    return d_str.size_bytes();
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, bool>::value>* = nullptr>
+  __device__ size_type operator()()
+  {
+    auto const d_str = d_column.element<bool>(idx) ? string_view("true", 4)
+                                                   : string_view("false", 5);
+    if (d_buffer) copy_string(d_buffer, d_str);
+    return d_str.size_bytes();
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>* =
+              nullptr>
+  __device__ size_type operator()()
+  {
+    auto const value = d_column.element<T>(idx);
+    if (d_buffer) integer_to_string(value, d_buffer);
+    return count_digits(value);
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  __device__ size_type operator()()
+  {
+    using period = typename T::period;
+    // seconds since epoch, rounded down
+    auto const count   = static_cast<int64_t>(d_column.element<T>(idx).time_since_epoch().count());
+    auto const scaled  = count * period::num;
+    auto const seconds = scaled / period::den - ((scaled % period::den) < 0 ? 1 : 0);
+    auto days          = seconds / 86400 - ((seconds % 86400) < 0 ? 1 : 0);
+    auto const secs    = seconds - days * 86400;
+
+    // civil date from days since epoch
+    days += 719468;
+    auto const era = (days >= 0 ? days : days - 146096) / 146097;
+    auto const doe = days - era * 146097;
+    auto const yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    auto const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    auto const mp  = (5 * doy + 2) / 153;
+    auto const day = doy - (153 * mp + 2) / 5 + 1;
+    auto const mon = mp < 10 ? mp + 3 : mp - 9;
+    auto const yr  = yoe + era * 400 + (mon <= 2);
+
+    // the parts are written one after the other, the separators are single characters
+    char* ptr       = d_buffer;
+    size_type bytes = 0;
+    auto write      = [&ptr, &bytes](char separator, int64_t value, size_type width) {
+      if (separator) {
+        if (ptr) *ptr++ = separator;
+        ++bytes;
+      }
+      auto const size = write_padded(ptr, value, width);
+      if (ptr) ptr += size;
+      bytes += size;
+    };
+    write(0, yr, 4);
+    write('-', mon, 2);
+    write('-', day, 2);
+    if (std::is_same<T, cudf::timestamp_D>::value) return bytes;
+    write('T', secs / 3600, 2);
+    write(':', (secs / 60) % 60, 2);
+    write(':', secs % 60, 2);
+    if (ptr) *ptr = 'Z';
+    ++bytes;
+    return bytes;
+  }
+
+  template <typename T,
+            std::enable_if_t<!std::is_same<T, string_view>::value && !std::is_integral<T>::value &&
+                             !cudf::is_timestamp<T>()>* = nullptr>
+  __device__ size_type operator()()
+  {
+    release_assert(false && "format_value_fn: unsupported type");
+    return 0;
+  }
+};
+
+/**
+ * @brief Returns true if values of the type can be formatted.
+ */
+struct is_formattable_fn {
+  template <typename T>
+  bool operator()()
+  {
+    return std::is_same<T, string_view>::value || std::is_integral<T>::value ||
+           cudf::is_timestamp<T>();
+  }
+};
+
+/**
+ * @brief Computes the size of each output string and then writes it.
+ */
+struct format_fn {
+  table_device_view const d_table;
+  format_item const* d_items;
+  size_type const items_count;
+  char const* d_literals;
+  string_scalar_device_view const d_narep;
+  int32_t* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    bool const null_element = thrust::any_of(
+      thrust::seq, d_table.begin(), d_table.end(), [idx](column_device_view const& col) {
+        return col.is_null(idx);
+      });
+    if (null_element && !d_narep.is_valid()) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+    char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes = 0;
+    for (size_type item_idx = 0; item_idx < items_count; ++item_idx) {
+      auto const item = d_items[item_idx];
+      size_type size  = 0;
+      if (item.column < 0) {
+        size = item.size;
+        if (d_buffer) memcpy(d_buffer, d_literals + item.offset, size);
+      } else {
+        auto const d_column = d_table.column(item.column);
+        if (d_column.is_null(idx)) {
+          size = d_narep.size();
+          if (d_buffer) copy_string(d_buffer, d_narep.value());
+        } else {
+          size =
+            type_dispatcher(d_column.type(), format_value_fn{d_column, idx, d_buffer});
+        }
+      }
+      if (d_buffer) d_buffer += size;
+      bytes += size;
+    }
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> format(table_view const& columns,
+                               std::string const& format_template,
+                               string_scalar const& narep,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  std::vector<format_item> h_items;
+  std::string h_literals;
+  auto const columns_count = parse_format(format_template, h_items, h_literals);
+  CUDF_EXPECTS(columns_count == columns.num_columns(),
+               "The format template must have a {} for each column");
+  CUDF_EXPECTS(std::all_of(columns.begin(),
+                           columns.end(),
+                           [](auto const& col) {
+                             return type_dispatcher(col.type(), is_formattable_fn{});
+                           }),
+               "Only strings, integer, boolean and timestamp columns can be formatted");
+
+  auto strings_count = columns.num_columns() > 0 ? columns.num_rows() : 0;
+  if (strings_count == 0) return make_empty_strings_column(mr, stream);
+
+  rmm::device_vector<format_item> items(h_items);
+  rmm::device_vector<char> literals(h_literals.begin(), h_literals.end());
+  auto d_narep = get_scalar_device_view(const_cast<string_scalar&>(narep));
+
+  auto table   = table_device_view::create(columns, stream);
+  auto d_table = *table;
+
+  // create resulting null mask
+  auto valid_mask = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    [d_table, d_narep] __device__(size_type idx) {
+      bool null_element = thrust::any_of(
+        thrust::seq, d_table.begin(), d_table.end(), [idx](auto col) { return col.is_null(idx); });
+      return (!null_element || d_narep.is_valid());
+    },
+    stream,
+    mr);
+  auto& null_mask       = valid_mask.first;
+  auto const null_count = valid_mask.second;
+
+  // this utility calls the formatter to build the offsets and chars columns
+  auto children = make_strings_children(format_fn{d_table,
+                                                  items.data().get(),
+                                                  static_cast<size_type>(h_items.size()),
+                                                  literals.data().get(),
+                                                  d_narep},
+                                        strings_count,
+                                        null_count,
+                                        mr,
+                                        stream);
+
+  return make_strings_column(strings_count,
+                             std::move(children.first),
+                             std::move(children.second),
+                             null_count,
+                             std::move(null_mask),
+                             stream,
+                             mr);
+}
+
+}  // namespace detail
+
+// external API
+
+std::unique_ptr<column> format(table_view const& columns,
+                               std::string const& format_template,
+                               string_scalar const& narep,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::format(columns, format_template, narep, 0, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/detail/inline_string.cuh>
+#include <cudf/strings/detail/strings_column_factories.cuh>
+
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+// build a vector of inline strings from a strings column
+rmm::device_vector<inline_string> create_inline_string_vector(strings_column_view const& strings,
+                                                              cudaStream_t stream)
+{
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_column       = *strings_column;
+
+  rmm::device_vector<inline_string> strings_vector(strings.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings.size()),
+                    strings_vector.begin(),
+                    [d_column] __device__(size_type idx) {
+                      return d_column.is_null(idx)
+                               ? inline_string::null()
+                               : inline_string::create(d_column.element<string_view>(idx));
+                    });
+  return strings_vector;
+}
+
+// build a strings column from a vector of inline strings
+std::unique_ptr<column> make_strings_column(rmm::device_vector<inline_string> const& strings,
+                                            cudaStream_t stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  // the inline bytes are copied from the vector itself
+  auto pairs = thrust::make_transform_iterator(
+    strings.data().get(), [] __device__(inline_string const& d_str) {
+      auto const view = d_str.view();
+      return thrust::pair<const char*, size_type>{view.data(), view.size_bytes()};
+    });
+  return make_strings_column(pairs, pairs + strings.size(), mr, stream);
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
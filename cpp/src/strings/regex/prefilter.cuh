@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <strings/regex/regex.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief Computes `fn(idx)` for the strings that contain the literal that every match of the
+ * regex program contains, and `ResultType{}` for the other strings.
+ *
+ * The strings are searched for the literal first so that the regex program, which is much
+ * slower per string, only runs on the strings that may match.
+ *
+ * @param prog The regex program that `fn` executes.
+ * @param d_strings The strings to evaluate.
+ * @param fn Returns the result of the string at an index; `ResultType{}` must be the result of
+ * strings that do not match.
+ * @param d_results The results of the strings.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename Function, typename ResultType>
+void prefiltered_transform(reprog_device const& prog,
+                           column_device_view const& d_strings,
+                           Function fn,
+                           ResultType* d_results,
+                           cudaStream_t stream)
+{
+  auto execpol             = rmm::exec_policy(stream);
+  auto const strings_count = d_strings.size();
+  if (!prog.has_required_literal()) {
+    thrust::transform(execpol->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_results,
+                      fn);
+    return;
+  }
+
+  rmm::device_vector<size_type> candidates(strings_count);
+  auto const candidates_end =
+    thrust::copy_if(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    candidates.begin(),
+                    [prog, d_strings] __device__(size_type idx) {
+                      return !d_strings.is_null(idx) &&
+                             prog.has_required_literal(d_strings.element<string_view>(idx));
+                    });
+  thrust::fill(execpol->on(stream), d_results, d_results + strings_count, ResultType{});
+  thrust::transform(execpol->on(stream),
+                    candidates.begin(),
+                    candidates_end,
+                    thrust::make_permutation_iterator(d_results, candidates.begin()),
+                    fn);
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -15,11 +15,13 @@
  */
 
 #include <strings/regex/regcomp.h>
+#include <strings/char_types/is_flags.h>
 #include <cudf/utilities/error.hpp>
 
 #include <string.h>
 #include <algorithm>
 #include <array>
+#include <map>
 
 namespace cudf {
 namespace strings {
@@ -905,6 +907,238 @@ void reprog::optimize2()
   _startinst_ids.push_back(-1);  // terminator mark
 }
 
+namespace {
+// Context of the position at which a closure of instructions is computed
+enum class line_context { STRING_START, AFTER_NEWLINE, OTHER };
+
+bool is_char_inst(int32_t type)
+{
+  return type == CHAR || type == ANY || type == ANYNL || type == CCLASS || type == NCCLASS;
+}
+
+// Same as reclass_device::is_match for ASCII characters
+bool class_matches(reclass const& cls, char32_t ch, const uint8_t* ascii_flags)
+{
+  for (size_t i = 0; i + 1 < cls.literals.size(); i += 2) {
+    if (ch >= cls.literals[i] && ch <= cls.literals[i + 1]) return true;
+  }
+  uint8_t fl = ascii_flags[ch];
+  return ((cls.builtins & 1) && ((ch == '_') || IS_ALPHANUM(fl))) ||
+         ((cls.builtins & 2) && IS_SPACE(fl)) || ((cls.builtins & 4) && IS_DIGIT(fl)) ||
+         ((cls.builtins & 8) && ((ch != '\n') && (ch != '_') && !IS_ALPHANUM(fl))) ||
+         ((cls.builtins & 16) && !IS_SPACE(fl)) ||
+         ((cls.builtins & 32) && ((ch != '\n') && !IS_DIGIT(fl)));
+}
+
+// True if the class matches no non-ASCII character, false if it may match some
+bool class_is_ascii(reclass const& cls)
+{
+  return cls.builtins == 0 && std::all_of(cls.literals.begin(),
+                                          cls.literals.end(),
+                                          [](char32_t ch) { return ch < 128; });
+}
+
+}  // namespace
+
+bool reprog::build_dfa(const uint8_t* ascii_flags, bool anchored, redfa& dfa) const
+{
+  auto const count = insts_count();
+  auto skip_groups = [&](int32_t id) {
+    while (_insts[id].type == LBRA || _insts[id].type == RBRA) id = _insts[id].u2.next_id;
+    return id;
+  };
+  // Only the ends of the pattern may look ahead at the next character
+  for (auto const& inst : _insts) {
+    if (inst.type == BOW || inst.type == NBOW) return false;
+    if (inst.type == EOL && _insts[skip_groups(inst.u2.next_id)].type != END) return false;
+  }
+
+  // The character instructions, which make up the states
+  std::vector<int32_t> char_insts;
+  std::vector<int32_t> char_index(count, -1);
+  for (int32_t id = 0; id < count; ++id) {
+    if (is_char_inst(_insts[id].type)) {
+      char_index[id] = static_cast<int32_t>(char_insts.size());
+      char_insts.push_back(id);
+    }
+  }
+
+  // The class of a character is the set of character instructions that accept it, and
+  // whether it starts a new line
+  using signature = std::vector<bool>;
+  auto accepts    = [&](reinst const& inst, char32_t ch) {
+    switch (inst.type) {
+      case CHAR: return inst.u1.c == ch;
+      case ANY: return ch != '\n';
+      case ANYNL: return true;
+      case CCLASS: return class_matches(_classes[inst.u1.cls_id], ch, ascii_flags);
+      default: return !class_matches(_classes[inst.u1.cls_id], ch, ascii_flags);  // NCCLASS
+    }
+  };
+  // All non-ASCII characters are in one class unless an instruction may tell them apart
+  bool const uniform_non_ascii = std::all_of(char_insts.begin(), char_insts.end(), [&](int32_t id) {
+    auto const& inst = _insts[id];
+    if (inst.type == CHAR) return inst.u1.c < 128;
+    if (inst.type == CCLASS || inst.type == NCCLASS) {
+      return class_is_ascii(_classes[inst.u1.cls_id]);
+    }
+    return true;
+  });
+
+  std::map<signature, uint8_t> class_ids;
+  std::vector<signature> class_signatures;
+  auto add_class = [&](signature const& sig) {
+    auto const found = class_ids.find(sig);
+    if (found != class_ids.end()) return found->second;
+    auto const id = static_cast<uint8_t>(class_signatures.size());
+    class_ids.emplace(sig, id);
+    class_signatures.push_back(sig);
+    return id;
+  };
+  dfa.char_classes.assign(129, redfa::FALLBACK_CLASS);
+  for (char32_t ch = 1; ch < 128; ++ch) {  // the NUL character ends the program
+    signature sig(char_insts.size() + 1);
+    for (size_t i = 0; i < char_insts.size(); ++i) sig[i] = accepts(_insts[char_insts[i]], ch);
+    sig.back()          = (ch == '\n');
+    dfa.char_classes[ch] = add_class(sig);
+  }
+  if (uniform_non_ascii) {
+    signature sig(char_insts.size() + 1);
+    for (size_t i = 0; i < char_insts.size(); ++i) {
+      auto const type = _insts[char_insts[i]].type;
+      sig[i]          = (type == ANY || type == ANYNL || type == NCCLASS);
+    }
+    dfa.char_classes[128] = add_class(sig);
+  }
+  dfa.classes_count = static_cast<int32_t>(class_signatures.size());
+
+  // A state is the set of character instructions reached and its accept flags
+  using state = std::pair<std::vector<int32_t>, uint8_t>;
+  auto closure = [&](std::vector<int32_t> const& seeds, line_context context) {
+    state result{{}, 0};
+    std::vector<bool> visited(count, false);
+    std::vector<int32_t> stack(seeds);
+    while (!stack.empty()) {
+      auto const id = stack.back();
+      stack.pop_back();
+      if (visited[id]) continue;
+      visited[id]      = true;
+      auto const& inst = _insts[id];
+      switch (inst.type) {
+        case LBRA:
+        case RBRA: stack.push_back(inst.u2.next_id); break;
+        case OR:
+          stack.push_back(inst.u1.right_id);
+          stack.push_back(inst.u2.left_id);
+          break;
+        case BOL:
+          if (context == line_context::STRING_START ||
+              (context == line_context::AFTER_NEWLINE && inst.u1.c == '^'))
+            stack.push_back(inst.u2.next_id);
+          break;
+        case EOL:
+          result.second |= redfa::ACCEPT_AT_END;
+          if (inst.u1.c == '$') result.second |= redfa::ACCEPT_BEFORE_NEWLINE;
+          break;
+        case END: result.second |= redfa::ACCEPT; break;
+        default: result.first.push_back(id);
+      }
+    }
+    std::sort(result.first.begin(), result.first.end());
+    return result;
+  };
+
+  std::vector<int32_t> starts(_startinst_ids.begin(), _startinst_ids.end() - 1);  // drop the -1
+  std::map<state, uint8_t> state_ids;
+  std::vector<state> states;
+  auto add_state = [&](state const& s) -> int32_t {
+    auto const found = state_ids.find(s);
+    if (found != state_ids.end()) return found->second;
+    if (static_cast<int32_t>(states.size()) == redfa::MAX_STATES) return -1;
+    auto const id = static_cast<uint8_t>(states.size());
+    state_ids.emplace(s, id);
+    states.push_back(s);
+    return id;
+  };
+  add_state(closure(starts, line_context::STRING_START));
+
+  dfa.transitions.clear();
+  for (size_t id = 0; id < states.size(); ++id) {
+    if (static_cast<int32_t>(states.size()) * dfa.classes_count > redfa::MAX_TABLE_SIZE)
+      return false;
+    // The matching stops at the first accepting state so its transitions are never read
+    if (states[id].second & redfa::ACCEPT) {
+      dfa.transitions.insert(dfa.transitions.end(), dfa.classes_count, static_cast<uint8_t>(id));
+      continue;
+    }
+    for (auto const& sig : class_signatures) {
+      std::vector<int32_t> seeds;
+      for (auto const inst_id : states[id].first) {
+        if (sig[char_index[inst_id]]) seeds.push_back(_insts[inst_id].u2.next_id);
+      }
+      if (!anchored) seeds.insert(seeds.end(), starts.begin(), starts.end());
+      auto const next =
+        add_state(closure(seeds, sig.back() ? line_context::AFTER_NEWLINE : line_context::OTHER));
+      if (next < 0) return false;
+      dfa.transitions.push_back(static_cast<uint8_t>(next));
+    }
+  }
+
+  dfa.states_count = static_cast<int32_t>(states.size());
+  dfa.accepts.resize(dfa.states_count);
+  for (int32_t id = 0; id < dfa.states_count; ++id) {
+    dfa.accepts[id]  = states[id].second;
+    auto const begin = dfa.transitions.begin() + id * dfa.classes_count;
+    bool const stuck = std::all_of(
+      begin, begin + dfa.classes_count, [id](uint8_t next) { return next == id; });
+    if (dfa.accepts[id] == 0 && stuck) dfa.accepts[id] = redfa::DEAD;
+  }
+  return true;
+}
+
+std::u32string reprog::required_literal() const
+{
+  auto const count = insts_count();
+  std::vector<int32_t> starts(_startinst_ids.begin(), _startinst_ids.end() - 1);  // drop the -1
+  // Returns true if the END instruction can be reached without executing `avoid_id`
+  auto reaches_end = [&](int32_t avoid_id) {
+    std::vector<bool> visited(count, false);
+    std::vector<int32_t> stack(starts);
+    while (!stack.empty()) {
+      auto const id = stack.back();
+      stack.pop_back();
+      if (id == avoid_id || visited[id]) continue;
+      visited[id]      = true;
+      auto const& inst = _insts[id];
+      if (inst.type == END) return true;
+      if (inst.type == OR) {
+        stack.push_back(inst.u1.right_id);
+        stack.push_back(inst.u2.left_id);
+      } else {
+        stack.push_back(inst.u2.next_id);
+      }
+    }
+    return false;
+  };
+  auto skip_groups = [&](int32_t id) {
+    while (_insts[id].type == LBRA || _insts[id].type == RBRA) id = _insts[id].u2.next_id;
+    return id;
+  };
+
+  // A character that every match executes is followed by the characters it leads to
+  // unconditionally
+  std::u32string result;
+  for (int32_t id = 0; id < count; ++id) {
+    if (_insts[id].type != CHAR || reaches_end(id)) continue;
+    std::u32string literal;
+    for (auto next = id; _insts[next].type == CHAR && static_cast<int32_t>(literal.size()) < count;
+         next = skip_groups(_insts[next].u2.next_id))
+      literal += _insts[next].u1.c;
+    if (literal.size() > result.size()) result = literal;
+  }
+  return result;
+}
+
 void reprog::print()
 {
   printf("Instructions:\n");
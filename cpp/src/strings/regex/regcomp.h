@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -72,6 +73,33 @@ struct reinst {
   int32_t reserved4;
 };
 
+/**
+ * @brief Deterministic automaton of a regex program, which tells whether a
+ * string matches with one table lookup per character
+ *
+ * Every state stands for a set of the character instructions of the program.
+ * The characters are read by class: every ASCII character has the class of the
+ * instructions that accept it, and all other characters share the last class.
+ * Characters of `FALLBACK_CLASS` need the program itself to be executed.
+ */
+struct redfa {
+  static constexpr uint8_t FALLBACK_CLASS = 0xFF;
+  static constexpr int32_t MAX_STATES     = 128;
+  static constexpr int32_t MAX_TABLE_SIZE = 8192;  // transitions, in bytes
+
+  // Accept flags of a state
+  static constexpr uint8_t ACCEPT                = 1;  // a match ends here
+  static constexpr uint8_t ACCEPT_AT_END         = 2;  // a match ends here if the string does
+  static constexpr uint8_t ACCEPT_BEFORE_NEWLINE = 4;  // a match ends here if '\n' is next
+  static constexpr uint8_t DEAD                  = 8;  // no match can be found from here
+
+  std::vector<uint8_t> char_classes;  // class of the 128 ASCII characters, then of the others
+  std::vector<uint8_t> accepts;       // accept flags of every state
+  std::vector<uint8_t> transitions;   // next state of every state and class
+  int32_t classes_count{};
+  int32_t states_count{};  // the start state is 0
+};
+
 /**
  * @brief Regex program handles parsing a pattern in to individual set
  * of chained instructions.
@@ -111,6 +139,28 @@ class reprog {
   void set_start_inst(int32_t id);
   int32_t get_start_inst() const;
 
+  /**
+   * @brief Builds the deterministic automaton of the program, see `redfa`.
+   *
+   * Capturing groups are ignored. Word boundaries and `$` anchors followed by
+   * more of the pattern are not supported.
+   *
+   * @param ascii_flags The character type flags of the 128 ASCII code-points
+   * @param anchored Whether matches must start at the beginning of the string
+   * @param[out] dfa The automaton
+   * @return false if the program is not supported or the automaton would have
+   * more than `redfa::MAX_STATES` states or `redfa::MAX_TABLE_SIZE` transitions
+   */
+  bool build_dfa(const uint8_t* ascii_flags, bool anchored, redfa& dfa) const;
+
+  /**
+   * @brief Returns the longest run of characters that every match of the program contains,
+   * or an empty string if there is none.
+   *
+   * Strings without this literal need not be evaluated by the program.
+   */
+  std::u32string required_literal() const;
+
   void optimize1();
   void optimize2();
   void print();  // for debugging
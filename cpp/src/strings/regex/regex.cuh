@@ -43,6 +43,35 @@ class reclass_device {
   __device__ bool is_match(char32_t ch, const uint8_t* flags);
 };
 
+/**
+ * @brief Deterministic automaton of a regex program stored on the device, see `redfa`.
+ *
+ * The tables are kept in one block of `size` bytes so a kernel can copy them to shared memory:
+ * the classes of the characters, the accept flags of the states, and then the transitions.
+ */
+class redfa_device {
+ public:
+  int32_t states_count{};  // 0 if the program has no automaton
+  int32_t classes_count{};
+  int32_t size{};
+  const uint8_t* data{};
+
+  /**
+   * @brief Returns a copy of this automaton with its tables in `buffer`.
+   *
+   * All the threads of the block must call this since it synchronizes them.
+   *
+   * @param buffer Shared memory of at least `size` bytes.
+   */
+  __device__ inline redfa_device load(uint8_t* buffer) const;
+
+  /**
+   * @brief Returns 1 if the program matches the given string, 0 if it does not, and -1 if
+   * the string has a character that only the program can evaluate.
+   */
+  __device__ inline int32_t is_match(string_view const& d_str) const;
+};
+
 /**
  * @brief Regex program of instructions/data for a specific regex pattern.
  *
@@ -92,6 +121,27 @@ class reprog_device {
    */
   __device__ bool is_empty() const { return insts_counts() == 0 || get_inst(0)->type == END; }
 
+  /**
+   * @brief Returns the deterministic automaton of the program.
+   *
+   * @param anchored Whether the matches must start at the beginning of the string.
+   */
+  __host__ __device__ redfa_device get_dfa(bool anchored) const
+  {
+    return anchored ? _anchored_dfa : _dfa;
+  }
+
+  /**
+   * @brief Returns false if the given string does not contain the literal that every match of
+   * the program contains, see `reprog::required_literal`.
+   */
+  __device__ inline bool has_required_literal(string_view const& d_str) const;
+
+  /**
+   * @brief Returns true if the program has a literal that every match contains.
+   */
+  bool has_required_literal() const { return _literal_bytes > 0; }
+
   /**
    * @brief Returns the number of regex groups found in the expression.
    */
@@ -164,6 +214,10 @@ class reprog_device {
   void* _relists_mem{};               // runtime relist memory for regexec
   u_char* _stack_mem1{};              // memory for relist object 1
   u_char* _stack_mem2{};              // memory for relist object 2
+  redfa_device _dfa{};                // automaton for matches anywhere in the string
+  redfa_device _anchored_dfa{};       // automaton for matches at the beginning of the string
+  const char* _literal{};             // UTF-8 literal that every match contains
+  int32_t _literal_bytes{};
 
   /**
    * @brief Executes the regex pattern on the given string.
@@ -157,6 +157,51 @@ __device__ inline bool reclass_device::is_match(char32_t ch, const uint8_t* code
   return false;
 }
 
+__device__ inline redfa_device redfa_device::load(uint8_t* buffer) const
+{
+  for (int32_t i = threadIdx.x; i < size; i += blockDim.x) buffer[i] = data[i];
+  __syncthreads();
+  redfa_device result = *this;
+  result.data         = buffer;
+  return result;
+}
+
+__device__ inline int32_t redfa_device::is_match(string_view const& d_str) const
+{
+  const uint8_t* char_classes = data;
+  const uint8_t* accepts      = char_classes + 129;
+  const uint8_t* transitions  = accepts + states_count;
+
+  int32_t state    = 0;
+  auto const bytes = reinterpret_cast<const uint8_t*>(d_str.data());
+  for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+    uint8_t const byte = bytes[i];
+    if ((byte & 0xC0) == 0x80) continue;  // rest of a multi-byte character
+    auto const cls = char_classes[byte < 0x80 ? byte : 128];
+    if (cls == redfa::FALLBACK_CLASS) return -1;
+    auto const flags = accepts[state];
+    if ((flags & redfa::ACCEPT) || ((byte == '\n') && (flags & redfa::ACCEPT_BEFORE_NEWLINE)))
+      return 1;
+    if (flags & redfa::DEAD) return 0;
+    state = transitions[state * classes_count + cls];
+  }
+  return (accepts[state] & (redfa::ACCEPT | redfa::ACCEPT_AT_END)) ? 1 : 0;
+}
+
+__device__ inline bool reprog_device::has_required_literal(string_view const& d_str) const
+{
+  if (_literal_bytes == 0) return true;
+  auto const bytes = d_str.data();
+  auto const last  = d_str.size_bytes() - _literal_bytes;  // UTF-8 can be searched bytewise
+  for (size_type i = 0; i <= last; ++i) {
+    if (bytes[i] != _literal[0]) continue;
+    int32_t j = 1;
+    while ((j < _literal_bytes) && (bytes[i + j] == _literal[j])) ++j;
+    if (j == _literal_bytes) return true;
+  }
+  return false;
+}
+
 /**
  * @brief Set the device data to be used for holding the state data of a string.
  *
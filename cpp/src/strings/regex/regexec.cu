@@ -90,7 +90,26 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     cudf::util::round_up_safe<size_t>(classes_count * sizeof(_classes[0]), sizeof(size_t));
   for (int32_t idx = 0; idx < classes_count; ++idx)
     classes_size += static_cast<int32_t>((h_prog.class_at(idx).literals.size()) * sizeof(char32_t));
-  size_t memsize  = insts_size + startids_size + classes_size;
+  // build the automata from the character types of the ASCII code-points
+  std::vector<uint8_t> ascii_flags(128);
+  CUDA_TRY(cudaMemcpyAsync(
+    ascii_flags.data(), codepoint_flags, 128, cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  redfa dfa, anchored_dfa;
+  if (!h_prog.build_dfa(ascii_flags.data(), false, dfa)) dfa = redfa{};
+  if (!h_prog.build_dfa(ascii_flags.data(), true, anchored_dfa)) anchored_dfa = redfa{};
+  auto dfa_size = [](redfa const& d) -> size_t {
+    if (d.states_count == 0) return 0;
+    return d.char_classes.size() + d.accepts.size() + d.transitions.size();
+  };
+  size_t dfas_size = dfa_size(dfa) + dfa_size(anchored_dfa);
+  // strings without the literal that every match contains are rejected before executing
+  std::string literal;
+  for (auto const chr : h_prog.required_literal()) {
+    char buffer[4];
+    literal.append(buffer, from_char_utf8(chr, buffer));
+  }
+  size_t memsize = insts_size + startids_size + classes_size + dfas_size + literal.size();
   size_t rlm_size = 0;
   // check memory size needed for executing regex
   if (insts_count > MAX_STACK_INSTS) {
@@ -135,6 +154,26 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     h_end += h_class.literals.size() * sizeof(char32_t);
     d_end += h_class.literals.size() * sizeof(char32_t);
   }
+  // copy the automata tables last (bytes)
+  auto copy_dfa = [&](redfa const& h_dfa, redfa_device& d_dfa) {
+    auto const size = dfa_size(h_dfa);
+    if (size == 0) return;
+    d_dfa.states_count  = h_dfa.states_count;
+    d_dfa.classes_count = h_dfa.classes_count;
+    d_dfa.size          = static_cast<int32_t>(size);
+    d_dfa.data          = d_end;
+    for (auto const* table : {&h_dfa.char_classes, &h_dfa.accepts, &h_dfa.transitions}) {
+      memcpy(h_end, table->data(), table->size());
+      h_end += table->size();
+    }
+    d_end += size;
+  };
+  copy_dfa(dfa, d_prog->_dfa);
+  copy_dfa(anchored_dfa, d_prog->_anchored_dfa);
+  // copy the required literal
+  memcpy(h_end, literal.data(), literal.size());
+  d_prog->_literal       = reinterpret_cast<const char*>(d_end);
+  d_prog->_literal_bytes = static_cast<int32_t>(literal.size());
   // initialize the rest of the elements
   d_prog->_insts_count     = insts_count;
   d_prog->_starts_count    = starts_count;
@@ -148,7 +187,9 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   }
 
   // copy flat prog to device memory
-  CUDA_TRY(cudaMemcpy(d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice));
+  CUDA_TRY(cudaMemcpyAsync(
+    d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
   //
   auto deleter = [d_buffer, d_relists](reprog_device* t) {
     t->destroy();
@@ -21,6 +21,7 @@
 #include <cudf/strings/replace.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <strings/aho_corasick.cuh>
 #include <strings/utilities.cuh>
 #include <strings/utilities.hpp>
 
@@ -231,12 +232,16 @@ namespace {
  * @brief Function logic for the replace_multi API.
  *
  * This will perform the multi-replace operation on each string.
+ * The target replaced at each byte position is the first of the targets that start there,
+ * found beforehand by `first_targets_fn`.
  */
 template <two_pass Pass = two_pass::SIZE_ONLY>
 struct replace_multi_fn {
   column_device_view const d_strings;
   column_device_view const d_targets;
   column_device_view const d_repls;
+  const size_type* d_first_targets{};  // first target at every byte of the chars column
+  const char* d_chars_begin{};         // beginning of the chars column
   const int32_t* d_offsets{};
   char* d_chars{};
 
@@ -246,30 +251,27 @@ struct replace_multi_fn {
     string_view d_str = d_strings.element<string_view>(idx);
     char* out_ptr     = nullptr;
     if (Pass == two_pass::EXECUTE_OP) out_ptr = d_chars + d_offsets[idx];
-    const char* in_ptr = d_str.data();
-    size_type size     = d_str.size_bytes();
+    const char* in_ptr       = d_str.data();
+    const size_type* tgt_ids = d_first_targets + (in_ptr - d_chars_begin);
+    size_type size           = d_str.size_bytes();
     size_type bytes = size, spos = 0, lpos = 0;
-    while (spos < size) {  // check each character against each target
-      for (int tgt_idx = 0; tgt_idx < d_targets.size(); ++tgt_idx) {
+    while (spos < size) {
+      auto const tgt_idx = tgt_ids[spos];
+      if (tgt_idx >= 0) {  // found one
         string_view d_tgt = d_targets.element<string_view>(tgt_idx);
-        if ((d_tgt.size_bytes() <= (size - spos)) &&                  // check fit
-            (d_tgt.compare(in_ptr + spos, d_tgt.size_bytes()) == 0))  // does it match
-        {                                                             // found one
-          string_view d_repl;
-          if (d_repls.size() == 1)
-            d_repl = d_repls.element<string_view>(0);
-          else
-            d_repl = d_repls.element<string_view>(tgt_idx);
-          if (Pass == two_pass::SIZE_ONLY)
-            bytes += d_repl.size_bytes() - d_tgt.size_bytes();
-          else {
-            out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
-            out_ptr = copy_string(out_ptr, d_repl);
-            lpos    = spos + d_tgt.size_bytes();
-          }
-          spos += d_tgt.size_bytes() - 1;
-          break;
+        string_view d_repl;
+        if (d_repls.size() == 1)
+          d_repl = d_repls.element<string_view>(0);
+        else
+          d_repl = d_repls.element<string_view>(tgt_idx);
+        if (Pass == two_pass::SIZE_ONLY)
+          bytes += d_repl.size_bytes() - d_tgt.size_bytes();
+        else {
+          out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
+          out_ptr = copy_string(out_ptr, d_repl);
+          lpos    = spos + d_tgt.size_bytes();
         }
+        spos += d_tgt.size_bytes() - 1;
       }
       ++spos;
     }
@@ -279,6 +281,31 @@ struct replace_multi_fn {
   }
 };
 
+/**
+ * @brief Records the lowest index of the targets that start at every byte of each string.
+ *
+ * Each string is searched for all the targets in one pass with the Aho-Corasick automaton.
+ */
+struct first_targets_fn {
+  column_device_view const d_strings;
+  aho_corasick_device const d_automaton;
+  size_type* d_first_targets{};  // first target at every byte of the chars column, or -1
+  const char* d_chars_begin{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) return;
+    string_view d_str = d_strings.element<string_view>(idx);
+    auto tgt_ids      = d_first_targets + (d_str.data() - d_chars_begin);
+    auto tgt_bytes    = d_automaton.target_bytes;
+    d_automaton.for_each_match(
+      d_str, [tgt_ids, tgt_bytes](size_type tgt_idx, size_type end_byte, size_type) {
+        auto& first = tgt_ids[end_byte - tgt_bytes[tgt_idx]];
+        if (first < 0 || tgt_idx < first) first = tgt_idx;
+      });
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<column> replace(
@@ -304,12 +331,24 @@ std::unique_ptr<column> replace(
   auto repls_column   = column_device_view::create(repls.parent(), stream);
   auto d_repls        = *repls_column;
 
+  // find the target to replace at each byte of the strings
+  auto automaton     = aho_corasick::create(targets, stream);
+  auto d_chars_begin = strings.chars().data<char>();
+  rmm::device_vector<size_type> first_targets(strings.chars().size(), -1);
+  auto d_first_targets = first_targets.data().get();
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    first_targets_fn{d_strings, automaton->view(), d_first_targets, d_chars_begin});
+
   // copy the null mask
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
   // build offsets column
   auto offsets_transformer_itr = thrust::make_transform_iterator(
     thrust::make_counting_iterator<int32_t>(0),
-    replace_multi_fn<two_pass::SIZE_ONLY>{d_strings, d_targets, d_repls});
+    replace_multi_fn<two_pass::SIZE_ONLY>{
+      d_strings, d_targets, d_repls, d_first_targets, d_chars_begin});
   auto offsets_column = make_offsets_child_column(
     offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
   auto d_offsets = offsets_column->view().data<int32_t>();
@@ -323,7 +362,8 @@ std::unique_ptr<column> replace(
     rmm::exec_policy(stream)->on(stream),
     thrust::make_counting_iterator<size_type>(0),
     strings_count,
-    replace_multi_fn<two_pass::EXECUTE_OP>{d_strings, d_targets, d_repls, d_offsets, d_chars});
+    replace_multi_fn<two_pass::EXECUTE_OP>{
+      d_strings, d_targets, d_repls, d_first_targets, d_chars_begin, d_offsets, d_chars});
   //
   return make_strings_column(strings_count,
                              std::move(offsets_column),
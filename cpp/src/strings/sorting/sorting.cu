@@ -15,18 +15,223 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/strings/sorting.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
 namespace cudf {
 namespace strings {
 namespace detail {
+namespace {
+// Number of bytes of a string sorted in each radix sort round
+constexpr size_type prefix_bytes = sizeof(uint64_t);
+// Rows still tied after this many rounds are sorted by comparing the rest of their strings
+constexpr size_type max_prefix_rounds = 8;
+
+/**
+ * @brief Returns 8 bytes of the string from `pos`, padded with zeros, packed into an integer
+ * that compares as the bytes do.
+ */
+__device__ uint64_t string_prefix(string_view const& d_str, size_type pos)
+{
+  auto const ptr   = reinterpret_cast<uint8_t const*>(d_str.data());
+  auto const bytes = d_str.size_bytes();
+  uint64_t key     = 0;
+  for (size_type idx = pos; idx < pos + prefix_bytes; ++idx) {
+    key = (key << 8) | (idx < bytes ? ptr[idx] : 0);
+  }
+  return key;
+}
+
+/**
+ * @brief Number of rows, and minimum and maximum string size in bytes, of a run of rows with
+ * equal prefixes
+ */
+using run_info = thrust::tuple<size_type, size_type, size_type>;
+
+struct merge_run_info {
+  __device__ run_info operator()(run_info const& lhs, run_info const& rhs) const
+  {
+    return run_info{thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                    thrust::min(thrust::get<1>(lhs), thrust::get<1>(rhs)),
+                    thrust::max(thrust::get<2>(lhs), thrust::get<2>(rhs))};
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> sorted_order(strings_column_view const& strings,
+                                           cudf::order order,
+                                           cudf::null_order null_order,
+                                           cudaStream_t stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto const strings_count = strings.size();
+  auto result              = make_numeric_column(
+    data_type{type_id::INT32}, strings_count, mask_state::UNALLOCATED, stream, mr);
+  if (strings_count == 0) return result;
+
+  auto execpol        = rmm::exec_policy(stream);
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_column       = *strings_column;
+  auto d_result       = result->mutable_view().data<size_type>();
+
+  // nulls go before or after the valid rows, in row order
+  auto const null_count  = strings.null_count();
+  auto const valid_count = strings_count - null_count;
+  auto d_rows            = d_result + (null_order == cudf::null_order::BEFORE ? null_count : 0);
+  thrust::copy_if(execpol->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(strings_count),
+                  d_rows,
+                  [d_column] __device__(size_type idx) { return d_column.is_valid(idx); });
+  if (null_count > 0) {
+    thrust::copy_if(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    d_result + (null_order == cudf::null_order::BEFORE ? 0 : valid_count),
+                    [d_column] __device__(size_type idx) { return d_column.is_null(idx); });
+  }
+
+  // Positions in d_rows of the rows still tied with others, and the run of tied rows of each.
+  // The runs cover consecutive positions, in order.
+  rmm::device_vector<size_type> positions(valid_count);
+  rmm::device_vector<size_type> runs(valid_count, 0);
+  thrust::sequence(execpol->on(stream), positions.begin(), positions.end());
+  rmm::device_vector<size_type> rows;
+  rmm::device_vector<uint64_t> keys;
+  rmm::device_vector<size_type> run_flags;
+  rmm::device_vector<run_info> infos;
+  auto const descending = order == cudf::order::DESCENDING;
+
+  for (size_type round = 0; round < max_prefix_rounds && !positions.empty(); ++round) {
+    auto const tied_count = static_cast<size_type>(positions.size());
+    auto const pos        = round * prefix_bytes;
+    rows.resize(tied_count);
+    keys.resize(tied_count);
+    thrust::gather(
+      execpol->on(stream), positions.begin(), positions.end(), d_rows, rows.begin());
+    thrust::transform(execpol->on(stream),
+                      rows.begin(),
+                      rows.end(),
+                      keys.begin(),
+                      [d_column, pos, descending] __device__(size_type row) {
+                        auto const key = string_prefix(d_column.element<string_view>(row), pos);
+                        return descending ? ~key : key;
+                      });
+
+    // radix sort by the prefix and then by the run, both stable, to sort each run by prefix
+    thrust::stable_sort_by_key(execpol->on(stream),
+                               keys.begin(),
+                               keys.end(),
+                               thrust::make_zip_iterator(
+                                 thrust::make_tuple(rows.begin(), runs.begin())));
+    thrust::stable_sort_by_key(execpol->on(stream),
+                               runs.begin(),
+                               runs.end(),
+                               thrust::make_zip_iterator(
+                                 thrust::make_tuple(rows.begin(), keys.begin())));
+    thrust::scatter(execpol->on(stream), rows.begin(), rows.end(), positions.begin(), d_rows);
+
+    // split the runs where the prefixes differ
+    auto d_keys = keys.data().get();
+    auto d_runs = runs.data().get();
+    run_flags.resize(tied_count);
+    thrust::transform(execpol->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(tied_count),
+                      run_flags.begin(),
+                      [d_keys, d_runs] __device__(size_type idx) {
+                        return idx > 0 && (d_keys[idx] != d_keys[idx - 1] ||
+                                           d_runs[idx] != d_runs[idx - 1]);
+                      });
+    thrust::inclusive_scan(execpol->on(stream), run_flags.begin(), run_flags.end(), runs.begin());
+
+    // a run is resolved if it has one row, or if its strings are equal
+    infos.resize(tied_count);
+    auto info_itr =
+      thrust::make_transform_iterator(rows.begin(), [d_column] __device__(size_type row) {
+        auto const bytes = d_column.element<string_view>(row).size_bytes();
+        return run_info{1, bytes, bytes};
+      });
+    thrust::reduce_by_key(execpol->on(stream),
+                          runs.begin(),
+                          runs.end(),
+                          info_itr,
+                          thrust::make_discard_iterator(),
+                          infos.begin(),
+                          thrust::equal_to<size_type>{},
+                          merge_run_info{});
+    auto d_infos        = infos.data().get();
+    auto const end_byte = pos + prefix_bytes;
+    thrust::transform(execpol->on(stream),
+                      runs.begin(),
+                      runs.end(),
+                      run_flags.begin(),
+                      [d_infos, end_byte] __device__(size_type run) {
+                        auto const info = d_infos[run];
+                        return thrust::get<0>(info) > 1 &&
+                               !(thrust::get<1>(info) == thrust::get<2>(info) &&
+                                 thrust::get<2>(info) <= end_byte);
+                      });
+
+    // keep only the tied rows for the next round
+    auto tied_itr = thrust::make_zip_iterator(thrust::make_tuple(positions.begin(), runs.begin()));
+    auto tied_end = thrust::remove_if(execpol->on(stream),
+                                      tied_itr,
+                                      tied_itr + tied_count,
+                                      run_flags.begin(),
+                                      [] __device__(size_type tied) { return tied == 0; });
+    auto const remaining = static_cast<size_type>(thrust::distance(tied_itr, tied_end));
+    positions.resize(remaining);
+    runs.resize(remaining);
+  }
+
+  // the rows still tied are sorted by comparing the rest of their strings
+  if (!positions.empty()) {
+    auto const pos = max_prefix_rounds * prefix_bytes;
+    rows.resize(positions.size());
+    thrust::gather(
+      execpol->on(stream), positions.begin(), positions.end(), d_rows, rows.begin());
+    auto tied_itr = thrust::make_zip_iterator(thrust::make_tuple(runs.begin(), rows.begin()));
+    thrust::stable_sort(
+      execpol->on(stream),
+      tied_itr,
+      tied_itr + positions.size(),
+      [d_column, descending, pos] __device__(thrust::tuple<size_type, size_type> const& lhs,
+                                             thrust::tuple<size_type, size_type> const& rhs) {
+        if (thrust::get<0>(lhs) != thrust::get<0>(rhs))
+          return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+        auto const lhs_str = d_column.element<string_view>(thrust::get<1>(lhs));
+        auto const rhs_str = d_column.element<string_view>(thrust::get<1>(rhs));
+        // the strings of a run are equal up to pos
+        auto const skip =
+          thrust::min(pos, thrust::min(lhs_str.size_bytes(), rhs_str.size_bytes()));
+        auto const cmp = string_view(lhs_str.data() + skip, lhs_str.size_bytes() - skip)
+                           .compare(rhs_str.data() + skip, rhs_str.size_bytes() - skip);
+        return descending ? cmp > 0 : cmp < 0;
+      });
+    thrust::scatter(execpol->on(stream), rows.begin(), rows.end(), positions.begin(), d_rows);
+  }
+
+  return result;
+}
+
 // return sorted version of the given strings column
 std::unique_ptr<cudf::column> sort(strings_column_view strings,
                                    sort_type stype,
@@ -40,31 +245,32 @@ std::unique_ptr<cudf::column> sort(strings_column_view strings,
   auto d_column       = *strings_column;
 
   // sort the indices of the strings
-  size_type num_strings = strings.size();
-  rmm::device_vector<size_type> indices(num_strings);
-  thrust::sequence(execpol->on(stream), indices.begin(), indices.end());
-  thrust::sort(execpol->on(stream),
-               indices.begin(),
-               indices.end(),
-               [d_column, stype, order, null_order] __device__(size_type lhs, size_type rhs) {
-                 bool lhs_null{d_column.is_null(lhs)};
-                 bool rhs_null{d_column.is_null(rhs)};
-                 if (lhs_null || rhs_null)
-                   return (null_order == cudf::null_order::BEFORE ? !rhs_null : !lhs_null);
-                 string_view lhs_str = d_column.element<string_view>(lhs);
-                 string_view rhs_str = d_column.element<string_view>(rhs);
-                 int cmp             = 0;
-                 if (stype & sort_type::length) cmp = lhs_str.length() - rhs_str.length();
-                 if (stype & sort_type::name) cmp = lhs_str.compare(rhs_str);
-                 return (order == cudf::order::ASCENDING ? (cmp < 0) : (cmp > 0));
-               });
-
-  // create a column_view as a wrapper of these indices
-  column_view indices_view(
-    data_type{type_id::INT32}, num_strings, indices.data().get(), nullptr, 0);
+  auto indices = (stype & sort_type::name) ? sorted_order(strings, order, null_order, stream)
+                                           : make_numeric_column(data_type{type_id::INT32},
+                                                                 strings.size(),
+                                                                 mask_state::UNALLOCATED,
+                                                                 stream);
+  if (!(stype & sort_type::name)) {
+    auto d_indices = indices->mutable_view().data<size_type>();
+    thrust::sequence(execpol->on(stream), d_indices, d_indices + strings.size());
+    thrust::sort(execpol->on(stream),
+                 d_indices,
+                 d_indices + strings.size(),
+                 [d_column, order, null_order] __device__(size_type lhs, size_type rhs) {
+                   bool lhs_null{d_column.is_null(lhs)};
+                   bool rhs_null{d_column.is_null(rhs)};
+                   if (lhs_null || rhs_null)
+                     return (null_order == cudf::null_order::BEFORE ? !rhs_null : !lhs_null);
+                   string_view lhs_str = d_column.element<string_view>(lhs);
+                   string_view rhs_str = d_column.element<string_view>(rhs);
+                   int cmp             = lhs_str.length() - rhs_str.length();
+                   return (order == cudf::order::ASCENDING ? (cmp < 0) : (cmp > 0));
+                 });
+  }
+
   // now build a new strings column from the indices
   auto table_sorted = cudf::detail::gather(table_view{{strings.parent()}},
-                                           indices_view,
+                                           indices->view(),
                                            cudf::detail::out_of_bounds_policy::NULLIFY,
                                            cudf::detail::negative_index_policy::NOT_ALLOWED,
                                            mr,
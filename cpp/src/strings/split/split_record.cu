@@ -19,7 +19,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
-#include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/split/split.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -38,6 +38,22 @@ namespace {
 
 enum class Dir { FORWARD, BACKWARD };
 
+/**
+ * @brief Records a token as its byte position in the chars of the strings column, and its size,
+ * which is written where the offsets of the output strings go.
+ */
+struct token_writer {
+  char const* d_chars_begin{};     // chars of the strings column
+  size_type* d_token_positions{};  // byte position of every token
+  int32_t* d_token_sizes{};        // byte size of every token
+
+  __device__ void operator()(size_type token, string_index_pair const& item) const
+  {
+    d_token_positions[token] = item.second > 0 ? item.first - d_chars_begin : 0;
+    d_token_sizes[token]     = item.second;
+  }
+};
+
 /**
  * @brief Compute the number of tokens for the `idx'th` string element of `d_strings`.
  *
@@ -73,8 +89,8 @@ template <Dir dir>
 struct token_reader_fn {
   column_device_view const d_strings;  // strings to split
   string_view const d_delimiter;       // delimiter for split
-  int32_t* d_token_offsets{};          // for locating tokens in d_tokens
-  string_index_pair* d_tokens{};
+  int32_t* d_token_offsets{};          // for locating tokens in the output
+  token_writer writer{};
 
   __device__ string_index_pair resolve_token(string_view const& d_str,
                                              size_type start_pos,
@@ -98,11 +114,10 @@ struct token_reader_fn {
 
     auto const token_offset = d_token_offsets[idx];
     auto const token_count  = d_token_offsets[idx + 1] - token_offset;
-    auto d_result           = d_tokens + token_offset;
     auto const d_str        = d_strings.element<string_view>(idx);
     if (d_str.empty()) {
       // Pandas str.split("") for non-whitespace delimiter is an empty string
-      *d_result = string_index_pair{"", 0};
+      writer(token_offset, string_index_pair{"", 0});
       return;
     }
 
@@ -115,11 +130,11 @@ struct token_reader_fn {
       if (delimiter_pos < 0) break;
       auto const token = resolve_token(d_str, start_pos, end_pos, delimiter_pos);
       if (dir == Dir::FORWARD) {
-        d_result[token_idx] = token;
-        start_pos           = delimiter_pos + d_delimiter.length();
+        writer(token_offset + token_idx, token);
+        start_pos = delimiter_pos + d_delimiter.length();
       } else {
-        d_result[token_count - 1 - token_idx] = token;
-        end_pos                               = delimiter_pos;
+        writer(token_offset + token_count - 1 - token_idx, token);
+        end_pos = delimiter_pos;
       }
       token_idx++;
     }
@@ -127,10 +142,11 @@ struct token_reader_fn {
     // set last token to remainder of the string
     if (dir == Dir::FORWARD) {
       auto const offset_bytes = d_str.byte_offset(start_pos);
-      d_result[token_idx] =
-        string_index_pair{d_str.data() + offset_bytes, d_str.byte_offset(end_pos) - offset_bytes};
+      writer(token_offset + token_idx,
+             string_index_pair{d_str.data() + offset_bytes,
+                               d_str.byte_offset(end_pos) - offset_bytes});
     } else {
-      d_result[0] = string_index_pair{d_str.data(), d_str.byte_offset(end_pos)};
+      writer(token_offset, string_index_pair{d_str.data(), d_str.byte_offset(end_pos)});
     }
   }
 };
@@ -177,14 +193,13 @@ struct whitespace_token_reader_fn {
   column_device_view const d_strings;  // strings to split
   size_type const max_tokens{};
   int32_t* d_token_offsets{};
-  string_index_pair* d_tokens{};
+  token_writer writer{};
 
   __device__ void operator()(size_type idx)
   {
     auto const token_offset = d_token_offsets[idx];
     auto const token_count  = d_token_offsets[idx + 1] - token_offset;
     if (token_count == 0) { return; }
-    auto d_result = d_tokens + token_offset;
 
     auto const d_str = d_strings.element<string_view>(idx);
     whitespace_string_tokenizer tokenizer(d_str, dir != Dir::FORWARD);
@@ -193,16 +208,16 @@ struct whitespace_token_reader_fn {
     if (dir == Dir::FORWARD) {
       while (tokenizer.next_token() && (token_idx < token_count)) {
         token = tokenizer.get_token();
-        d_result[token_idx++] =
-          string_index_pair{d_str.data() + token.first, token.second - token.first};
+        writer(token_offset + token_idx++,
+               string_index_pair{d_str.data() + token.first, token.second - token.first});
       }
       --token_idx;
       token.second = d_str.size_bytes() - token.first;
     } else {
       while (tokenizer.prev_token() && (token_idx < token_count)) {
         token = tokenizer.get_token();
-        d_result[token_count - 1 - token_idx] =
-          string_index_pair{d_str.data() + token.first, token.second - token.first};
+        writer(token_offset + token_count - 1 - token_idx,
+               string_index_pair{d_str.data() + token.first, token.second - token.first});
         ++token_idx;
       }
       token_idx   = token_count - token_idx;  // token_count - 1 - (token_idx-1)
@@ -210,7 +225,8 @@ struct whitespace_token_reader_fn {
     }
     // reset last token only if we hit the max
     if (token_count == max_tokens)
-      d_result[token_idx] = string_index_pair{d_str.data() + token.first, token.second};
+      writer(token_offset + token_idx,
+             string_index_pair{d_str.data() + token.first, token.second});
   }
 };
 
@@ -239,16 +255,49 @@ std::unique_ptr<column> split_record_fn(strings_column_view const& strings,
 
   // last entry is the total number of tokens to be generated
   auto total_tokens = cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
-  // split each string into an array of index-pair values
-  rmm::device_vector<string_index_pair> tokens(total_tokens);
-  reader.d_token_offsets = d_offsets;
-  reader.d_tokens        = tokens.data().get();
+
+  // locate the tokens, writing their sizes where the output strings offsets go
+  auto token_offsets = make_numeric_column(
+    data_type{type_id::INT32}, total_tokens + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_token_offsets = token_offsets->mutable_view().data<int32_t>();
+  rmm::device_vector<size_type> token_positions(total_tokens);
+  auto const d_chars_begin = strings.chars_size() > 0 ? strings.chars().data<char>() : nullptr;
+  reader.d_token_offsets   = d_offsets;
+  reader.writer = token_writer{d_chars_begin, token_positions.data().get(), d_token_offsets};
   thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
                      thrust::make_counting_iterator<size_type>(0),
                      strings_count,
                      reader);
-  // convert the index-pairs into one big strings column
-  auto strings_output = make_strings_column(tokens.begin(), tokens.end(), mr, stream);
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         d_token_offsets,
+                         d_token_offsets + total_tokens + 1,
+                         d_token_offsets);
+
+  // copy the chars of all the tokens, one token per thread
+  auto const chars_bytes =
+    cudf::detail::get_value<int32_t>(token_offsets->view(), total_tokens, stream);
+  auto chars_column = create_chars_child_column(total_tokens, 0, chars_bytes, mr, stream);
+  auto d_chars      = chars_column->mutable_view().data<char>();
+  auto d_positions  = token_positions.data().get();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     total_tokens,
+                     [d_chars_begin, d_positions, d_token_offsets, d_chars] __device__(
+                       size_type token) {
+                       memcpy(d_chars + d_token_offsets[token],
+                              d_chars_begin + d_positions[token],
+                              d_token_offsets[token + 1] - d_token_offsets[token]);
+                     });
+  auto strings_output = total_tokens == 0
+                          ? make_empty_strings_column(mr, stream)
+                          : cudf::make_strings_column(total_tokens,
+                                                      std::move(token_offsets),
+                                                      std::move(chars_column),
+                                                      0,
+                                                      rmm::device_buffer{0, stream, mr},
+                                                      stream,
+                                                      mr);
+
   // create a lists column using the offsets and the strings columns
   return make_lists_column(strings_count,
                            std::move(offsets),
@@ -189,6 +189,29 @@ const special_case_mapping* get_special_case_mapping_table()
   });
 }
 
+namespace {
+// Average and longest string sizes, in bytes, above which a warp processes each string
+constexpr size_type warp_per_string_average_bytes = 128;
+constexpr size_type warp_per_string_max_bytes     = 4096;
+}  // namespace
+
+bool is_warp_per_string(strings_column_view const& strings, cudaStream_t stream)
+{
+  auto const valid_count = strings.size() - strings.null_count();
+  if (valid_count == 0) return false;
+  if (strings.chars_size() / valid_count >= warp_per_string_average_bytes) return true;
+
+  auto const d_offsets = strings.offsets().data<int32_t>() + strings.offset();
+  auto const max_bytes = thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings.size()),
+    [d_offsets] __device__(size_type idx) { return d_offsets[idx + 1] - d_offsets[idx]; },
+    0,
+    thrust::maximum<size_type>());
+  return max_bytes >= warp_per_string_max_bytes;
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -169,6 +170,102 @@ __host__ __device__ inline cudf::char_utf8 codepoint_to_utf8(uint32_t unchr)
   return utf8;
 }
 
+/**
+ * @brief Returns the number of characters in the first `bytes` bytes of a string.
+ *
+ * The threads of a warp count the characters together: all of them must call this with the
+ * same arguments, and all of them get the result.
+ *
+ * @param d_str The string.
+ * @param bytes The number of bytes to count the characters of.
+ * @param lane The index of the calling thread within its warp.
+ */
+__device__ inline size_type warp_characters_count(string_view const& d_str,
+                                                  size_type bytes,
+                                                  int lane)
+{
+  auto const ptr  = reinterpret_cast<const uint8_t*>(d_str.data());
+  size_type count = 0;
+  for (size_type i = lane; i < bytes; i += cudf::detail::warp_size)
+    count += is_begin_utf8_char(ptr[i]);
+  for (int offset = cudf::detail::warp_size / 2; offset > 0; offset /= 2)
+    count += __shfl_xor_sync(0xffffffff, count, offset);
+  return count;
+}
+
+/**
+ * @brief Returns the byte offset of a character position in a string, or the size of the
+ * string in bytes if it has fewer characters.
+ *
+ * The threads of a warp find the offset together: all of them must call this with the same
+ * arguments, and all of them get the result.
+ *
+ * @param d_str The string.
+ * @param char_pos The character position.
+ * @param lane The index of the calling thread within its warp.
+ */
+__device__ inline size_type warp_byte_offset(string_view const& d_str,
+                                             size_type char_pos,
+                                             int lane)
+{
+  auto const ptr   = reinterpret_cast<const uint8_t*>(d_str.data());
+  auto const bytes = d_str.size_bytes();
+  size_type chars  = 0;
+  for (size_type base = 0; base < bytes; base += cudf::detail::warp_size) {
+    auto const pos   = base + lane;
+    uint32_t starts  = __ballot_sync(0xffffffff, (pos < bytes) && is_begin_utf8_char(ptr[pos]));
+    auto const count = __popc(starts);
+    if (chars + count > char_pos) {
+      for (auto skip = char_pos - chars; skip > 0; --skip) starts &= starts - 1;
+      return base + __ffs(starts) - 1;
+    }
+    chars += count;
+  }
+  return bytes;
+}
+
+/**
+ * @brief Returns the byte position of the first occurrence of `d_target` within the bytes
+ * `[spos, epos)` of a string, or -1 if there is none.
+ *
+ * The threads of a warp search the string together: all of them must call this with the same
+ * arguments, and all of them get the result.
+ *
+ * @param d_str The string to search.
+ * @param d_target The non-empty string to find.
+ * @param spos The byte position to start the search at.
+ * @param epos The byte position to end the search at.
+ * @param lane The index of the calling thread within its warp.
+ * @param forward False to find the last occurrence instead.
+ */
+__device__ inline size_type warp_find(string_view const& d_str,
+                                      string_view const& d_target,
+                                      size_type spos,
+                                      size_type epos,
+                                      int lane,
+                                      bool forward = true)
+{
+  auto const ptr          = d_str.data();
+  auto const target_bytes = d_target.size_bytes();
+  auto const last         = epos - target_bytes;  // last position an occurrence can start at
+  auto const matches_at   = [&](size_type pos) {
+    if (pos < spos || pos > last) return false;
+    for (size_type i = 0; i < target_bytes; ++i) {
+      if (ptr[pos + i] != d_target.data()[i]) return false;
+    }
+    return true;
+  };
+  auto const chunks = (last - spos + cudf::detail::warp_size) / cudf::detail::warp_size;
+  for (size_type chunk = 0; chunk < chunks; ++chunk) {
+    auto const base = forward ? spos + chunk * cudf::detail::warp_size
+                              : last - chunk * cudf::detail::warp_size;
+    auto const found =
+      __ballot_sync(0xffffffff, matches_at(forward ? base + lane : base - lane));
+    if (found) return forward ? base + __ffs(found) - 1 : base - (__ffs(found) - 1);
+  }
+  return -1;
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
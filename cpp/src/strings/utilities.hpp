@@ -15,6 +15,10 @@
  */
 #pragma once
 
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <cuda_runtime.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -60,6 +64,19 @@ const character_cases_table_type* get_character_cases_table();
  */
 const struct special_case_mapping* get_special_case_mapping_table();
 
+/**
+ * @brief Returns true if the strings are long enough to be processed by a warp of threads
+ * per string instead of one thread per string.
+ *
+ * With one thread per string, every thread of a warp walks its whole string while the
+ * threads of shorter strings idle. This is the case when the strings are long on average, or
+ * when some of them are much longer than the others.
+ *
+ * @param strings The strings to process.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+bool is_warp_per_string(strings_column_view const& strings, cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
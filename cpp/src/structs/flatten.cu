@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/structs/detail/flatten.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace structs {
+namespace detail {
+namespace {
+bool is_struct(column_view const& col) { return col.type().id() == type_id::STRUCT; }
+
+bool has_nested_nulls(column_view const& col)
+{
+  if (col.has_nulls()) { return true; }
+  return is_struct(col) and
+         std::any_of(col.child_begin(), col.child_end(), [](auto const& child) {
+           return has_nested_nulls(child);
+         });
+}
+
+/**
+ * @brief Appends the leaves of columns to the flattened columns
+ */
+struct flattener {
+  std::vector<column_view> columns;
+  std::vector<order> column_order;
+  std::vector<null_order> null_precedence;
+  std::vector<rmm::device_buffer> null_masks;
+  cudaStream_t stream;
+
+  /**
+   * @brief Returns `child`, sliced to the rows of `parent`, with the nulls of `parent`
+   */
+  column_view with_parent_nulls(column_view const& child, column_view const& parent)
+  {
+    // both masks are indexed from the start of the parent
+    CUDF_EXPECTS(child.offset() == parent.offset(),
+                 "Children of nullable struct columns must not have an offset");
+    auto null_mask = parent.null_mask();
+    if (child.nullable()) {
+      null_masks.push_back(cudf::detail::bitmask_and({parent.null_mask(), child.null_mask()},
+                                                     {0, 0},
+                                                     parent.offset() + parent.size(),
+                                                     stream,
+                                                     rmm::mr::get_default_resource()));
+      null_mask = static_cast<bitmask_type const*>(null_masks.back().data());
+    }
+    return column_view(child.type(),
+                       child.size(),
+                       child.head(),
+                       null_mask,
+                       UNKNOWN_NULL_COUNT,
+                       child.offset(),
+                       std::vector<column_view>(child.child_begin(), child.child_end()));
+  }
+
+  void flatten(column_view const& col, order col_order, null_order col_null_order, bool ordered)
+  {
+    if (not is_struct(col)) {
+      columns.push_back(col);
+      if (ordered) {
+        column_order.push_back(col_order);
+        null_precedence.push_back(col_null_order);
+      }
+      return;
+    }
+    structs_column_view const structs(col);
+    for (size_type i = 0; i < structs.num_children(); ++i) {
+      auto child = structs.get_sliced_child(i);
+      if (structs.nullable()) { child = with_parent_nulls(child, col); }
+      flatten(child, col_order, col_null_order, ordered);
+    }
+  }
+};
+
+}  // namespace
+
+bool has_struct_columns(table_view const& input)
+{
+  return std::any_of(input.begin(), input.end(), is_struct);
+}
+
+bool has_nested_nulls(table_view const& input)
+{
+  return std::any_of(
+    input.begin(), input.end(), [](auto const& col) { return has_nested_nulls(col); });
+}
+
+flattened_table flatten_nested_columns(table_view const& input,
+                                       std::vector<order> const& column_order,
+                                       std::vector<null_order> const& null_precedence,
+                                       cudaStream_t stream)
+{
+  flattener flat{{}, {}, {}, {}, stream};
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    // the orders are only flattened if they are given, as for the row comparators
+    flat.flatten(input.column(i),
+                 column_order.empty() ? order::ASCENDING : column_order[i],
+                 null_precedence.empty() ? null_order::BEFORE : null_precedence[i],
+                 not column_order.empty() or not null_precedence.empty());
+  }
+  if (column_order.empty()) { flat.column_order.clear(); }
+  if (null_precedence.empty()) { flat.null_precedence.clear(); }
+  return flattened_table(
+    flat.columns, flat.column_order, flat.null_precedence, std::move(flat.null_masks));
+}
+
+}  // namespace detail
+}  // namespace structs
+}  // namespace cudf
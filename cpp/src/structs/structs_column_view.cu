@@ -25,4 +25,18 @@ structs_column_view::structs_column_view(column_view const& rhs) : column_view{r
   CUDF_EXPECTS(type().id() == type_id::STRUCT, "structs_column_view only supports struct columns");
 }
 
+column_view structs_column_view::parent() const { return static_cast<column_view>(*this); }
+
+column_view structs_column_view::get_sliced_child(size_type index) const
+{
+  auto const child = column_view::child(index);
+  return column_view(child.type(),
+                     size(),
+                     child.head(),
+                     child.null_mask(),
+                     UNKNOWN_NULL_COUNT,
+                     child.offset() + offset(),
+                     std::vector<column_view>(child.child_begin(), child.child_end()));
+}
+
 }  // namespace cudf
\ No newline at end of file
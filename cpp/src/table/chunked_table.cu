@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/chunked_table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/gather.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace {
+void check_same_columns(table_view const& first, table_view const& other)
+{
+  CUDF_EXPECTS(first.num_columns() == other.num_columns(), "Mismatch in number of columns");
+  CUDF_EXPECTS(std::equal(first.begin(),
+                          first.end(),
+                          other.begin(),
+                          [](column_view const& lhs, column_view const& rhs) {
+                            return lhs.type() == rhs.type();
+                          }),
+               "Mismatch in column types");
+}
+
+int64_t chars_size(column_view const& col)
+{
+  return col.type().id() == type_id::STRING ? strings_column_view(col).chars_size() : 0;
+}
+
+std::unique_ptr<table> concatenate_views(std::vector<table_view> const& views,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  return views.size() == 1 ? std::make_unique<table>(views.front(), 0, mr)
+                           : cudf::concatenate(views, mr);
+}
+
+}  // namespace
+
+chunked_table::chunked_table(std::vector<std::unique_ptr<table>>&& chunks)
+  : _chunks{std::move(chunks)}
+{
+  for (auto const& chunk : _chunks) {
+    CUDF_EXPECTS(chunk != nullptr, "Unexpected null chunk");
+    check_same_columns(_chunks.front()->view(), chunk->view());
+    _offsets.push_back(_offsets.back() + chunk->num_rows());
+  }
+}
+
+chunked_table chunked_table::concatenate(std::vector<table_view> const& tables,
+                                         size_type max_chunk_rows,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(max_chunk_rows > 0, "The maximum number of rows of a chunk must be positive");
+  // cudf::concatenate requires fewer than `size_type` rows and at most `size_type` chars
+  int64_t const max_rows  = std::min(max_chunk_rows, std::numeric_limits<size_type>::max() - 1);
+  int64_t const max_chars = std::numeric_limits<size_type>::max();
+
+  std::vector<std::unique_ptr<table>> chunks;
+  std::vector<table_view> group;
+  int64_t group_rows = 0;
+  std::vector<int64_t> group_chars;
+  auto const flush = [&]() {
+    if (not group.empty()) { chunks.push_back(concatenate_views(group, mr)); }
+    group.clear();
+    group_rows = 0;
+    std::fill(group_chars.begin(), group_chars.end(), 0);
+  };
+
+  for (auto const& t : tables) {
+    check_same_columns(tables.front(), t);
+    group_chars.resize(t.num_columns(), 0);
+    bool fits = group_rows + t.num_rows() <= max_rows;
+    for (size_type c = 0; c < t.num_columns(); ++c) {
+      fits = fits and group_chars[c] + chars_size(t.column(c)) <= max_chars;
+    }
+    if (not fits) { flush(); }
+    group.push_back(t);
+    group_rows += t.num_rows();
+    for (size_type c = 0; c < t.num_columns(); ++c) { group_chars[c] += chars_size(t.column(c)); }
+  }
+  flush();
+  return chunked_table{std::move(chunks)};
+}
+
+std::vector<std::unique_ptr<table>> chunked_table::release()
+{
+  _offsets = {0};
+  return std::move(_chunks);
+}
+
+std::unique_ptr<table> chunked_table::slice(int64_t begin,
+                                            int64_t end,
+                                            rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(begin >= 0 and begin <= end and end <= num_rows(), "Slice range out of bounds.");
+  CUDF_EXPECTS(end - begin < std::numeric_limits<size_type>::max(),
+               "The rows do not fit in a single table");
+  if (_chunks.empty()) { return std::make_unique<table>(); }
+
+  std::vector<table_view> views;
+  for (size_type i = 0; i < num_chunks(); ++i) {
+    auto const first = std::max(begin, _offsets[i]);
+    auto const last  = std::min(end, _offsets[i + 1]);
+    if (first < last) {
+      auto const lo = static_cast<size_type>(first - _offsets[i]);
+      auto const hi = static_cast<size_type>(last - _offsets[i]);
+      views.push_back(cudf::slice(chunk(i), {lo, hi}).front());
+    }
+  }
+  if (views.empty()) { return empty_like(chunk(0)); }
+  return concatenate_views(views, mr);
+}
+
+std::unique_ptr<table> chunked_table::gather(column_view const& gather_map,
+                                             rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(gather_map.type().id() == type_id::INT64, "Gather map must be INT64");
+  CUDF_EXPECTS(not gather_map.has_nulls(), "Gather map contains nulls");
+  CUDF_EXPECTS(not _chunks.empty(), "Gather from a chunked table without chunks");
+  auto const size = gather_map.size();
+  if (size == 0) { return empty_like(chunk(0)); }
+
+  auto const d_map    = gather_map.begin<int64_t>();
+  auto const num_rows = this->num_rows();
+  CUDF_EXPECTS(thrust::none_of(rmm::exec_policy(0)->on(0),
+                               d_map,
+                               d_map + size,
+                               [num_rows] __device__(int64_t row) {
+                                 return row < 0 or row >= num_rows;
+                               }),
+               "Index out of bounds");
+
+  // chunk of every row, and its index within the chunk
+  rmm::device_vector<int64_t> d_offsets(_offsets);
+  rmm::device_vector<size_type> chunk_ids(size);
+  rmm::device_vector<size_type> local_rows(size);
+  thrust::upper_bound(rmm::exec_policy(0)->on(0),
+                      d_offsets.begin(),
+                      d_offsets.end(),
+                      d_map,
+                      d_map + size,
+                      chunk_ids.begin());
+  thrust::transform(rmm::exec_policy(0)->on(0),
+                    chunk_ids.begin(),
+                    chunk_ids.end(),
+                    chunk_ids.begin(),
+                    [] __device__(size_type c) { return c - 1; });
+  thrust::transform(rmm::exec_policy(0)->on(0),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(size),
+                    local_rows.begin(),
+                    [d_map,
+                     d_offsets = d_offsets.data().get(),
+                     d_chunks  = chunk_ids.data().get()] __device__(size_type i) {
+                      return static_cast<size_type>(d_map[i] - d_offsets[d_chunks[i]]);
+                    });
+
+  // rows grouped by chunk, keeping their order within each chunk
+  rmm::device_vector<size_type> positions(size);
+  thrust::sequence(rmm::exec_policy(0)->on(0), positions.begin(), positions.end());
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(0)->on(0), chunk_ids.begin(), chunk_ids.end(), positions.begin());
+  rmm::device_vector<size_type> d_starts(num_chunks() + 1);
+  thrust::lower_bound(rmm::exec_policy(0)->on(0),
+                      chunk_ids.begin(),
+                      chunk_ids.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_chunks() + 1),
+                      d_starts.begin());
+  thrust::host_vector<size_type> starts(d_starts);
+
+  auto const first_chunk = chunk_ids[0];
+  if (starts[first_chunk + 1] - starts[first_chunk] == size) {
+    // a single chunk is gathered in the order of the map
+    column_view const rows(data_type{type_to_id<size_type>()}, size, local_rows.data().get());
+    return cudf::gather(chunk(first_chunk), rows, false, mr);
+  }
+
+  rmm::device_vector<size_type> sorted_rows(size);
+  thrust::gather(rmm::exec_policy(0)->on(0),
+                 positions.begin(),
+                 positions.end(),
+                 local_rows.begin(),
+                 sorted_rows.begin());
+  std::vector<std::unique_ptr<table>> partials;
+  std::vector<table_view> views;
+  for (size_type c = 0; c < num_chunks(); ++c) {
+    auto const count = starts[c + 1] - starts[c];
+    if (count == 0) { continue; }
+    column_view const rows(
+      data_type{type_to_id<size_type>()}, count, sorted_rows.data().get() + starts[c]);
+    partials.push_back(cudf::gather(chunk(c), rows));
+    views.push_back(partials.back()->view());
+  }
+  auto const grouped = cudf::concatenate(views);
+
+  // row `positions[k]` of the result is row `k` of `grouped`
+  rmm::device_vector<size_type> order(size);
+  thrust::scatter(rmm::exec_policy(0)->on(0),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(size),
+                  positions.begin(),
+                  order.begin());
+  column_view const order_view(data_type{type_to_id<size_type>()}, size, order.data().get());
+  return cudf::gather(grouped->view(), order_view, false, mr);
+}
+
+}  // namespace cudf
@@ -21,9 +21,17 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <nvtext/edit_distance.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 #include <rmm/device_uvector.hpp>
@@ -134,6 +142,122 @@ struct edit_distance_matrix_levenshtein_algorithm {
   }
 };
 
+/**
+ * @brief Compute the edit-distance between two strings up to `max_distance`.
+ *
+ * Only the diagonals `|i - j| <= max_distance` of the Levenshtein matrix are computed
+ * (Ukkonen's banded algorithm) and the calculation stops as soon as every value in
+ * a row of the band exceeds `max_distance`.
+ *
+ * The two band rows are `2 * max_distance + 1` int16 values each, and consecutive
+ * values are `stride` elements apart so the threads of a block can interleave
+ * their buffers in shared memory.
+ *
+ * @param d_str First string
+ * @param d_tgt Second string
+ * @param max_distance Largest distance of interest
+ * @param prev Buffer for the previous row of the band
+ * @param curr Buffer for the current row of the band
+ * @param stride Distance between consecutive values in `prev` and `curr`
+ * @return Edit distance value or `max_distance + 1` if the distance is larger
+ */
+__device__ cudf::size_type compute_banded_distance(cudf::string_view const& d_str,
+                                                   cudf::string_view const& d_tgt,
+                                                   cudf::size_type max_distance,
+                                                   int16_t* prev,
+                                                   int16_t* curr,
+                                                   cudf::size_type stride)
+{
+  auto const str_length = d_str.length();
+  auto const tgt_length = d_tgt.length();
+  auto const over       = static_cast<int16_t>(max_distance + 1);
+  if (abs(str_length - tgt_length) > max_distance) return over;
+
+  // band index `d` of row `i` is column `j = i + d - max_distance`
+  auto const width = 2 * max_distance + 1;
+  for (cudf::size_type d = 0; d < width; ++d) {
+    auto const j     = d - max_distance;
+    prev[d * stride] = (j >= 0 && j <= tgt_length) ? static_cast<int16_t>(j) : over;
+  }
+
+  auto itr_str  = d_str.begin();
+  auto itr_band = d_tgt.begin();  // first target character compared in the current row
+  for (cudf::size_type i = 1; i <= str_length; ++i, ++itr_str) {
+    if (i > max_distance + 1) ++itr_band;
+    auto const chr  = *itr_str;
+    auto itr_tgt    = itr_band;
+    int16_t row_min = over;
+    for (cudf::size_type d = 0; d < width; ++d) {
+      auto const j  = i + d - max_distance;
+      int16_t value = over;
+      if (j == 0) {
+        value = static_cast<int16_t>(i);
+      } else if (j > 0 && j <= tgt_length) {
+        int16_t const w = prev[d * stride] + static_cast<int16_t>(chr != *itr_tgt);
+        int16_t const u = (d + 1 < width) ? prev[(d + 1) * stride] + 1 : over;
+        int16_t const v = (d > 0) ? curr[(d - 1) * stride] + 1 : over;
+        value           = std::min(std::min(u, v), std::min(w, over));
+        ++itr_tgt;
+      }
+      curr[d * stride] = value;
+      row_min          = std::min(row_min, value);
+    }
+    if (row_min > max_distance) return over;
+    auto tmp = prev;
+    prev     = curr;
+    curr     = tmp;
+  }
+  return prev[(tgt_length - str_length + max_distance) * stride];
+}
+
+/**
+ * @brief Finds the pairs of strings within `max_distance` of each other.
+ *
+ * A block is assigned to each row and its threads compute the banded distance
+ * to the rows after it. The band buffers for each thread are in shared memory.
+ *
+ * On the first pass `d_offsets` is null and the number of pairs for each row
+ * is written to `d_counts`. On the second pass the pairs are written starting
+ * at `d_offsets[row]`. The order of the pairs within a row is not deterministic.
+ */
+__global__ void edit_distance_pairs_kernel(cudf::column_device_view const d_strings,
+                                           cudf::size_type max_distance,
+                                           cudf::size_type* d_counts,
+                                           cudf::size_type const* d_offsets,
+                                           int32_t* d_first,
+                                           int32_t* d_second,
+                                           int32_t* d_distances)
+{
+  extern __shared__ int16_t band_buffers[];
+  __shared__ cudf::size_type row_count;
+  auto const width = 2 * max_distance + 1;
+  auto prev        = band_buffers + threadIdx.x;
+  auto curr        = prev + width * blockDim.x;
+
+  auto const strings_count = d_strings.size();
+  for (cudf::size_type row = blockIdx.x; row < strings_count; row += gridDim.x) {
+    if (threadIdx.x == 0) row_count = 0;
+    __syncthreads();
+    auto const d_str =
+      d_strings.is_null(row) ? cudf::string_view{} : d_strings.element<cudf::string_view>(row);
+    for (cudf::size_type col = row + 1 + threadIdx.x; col < strings_count; col += blockDim.x) {
+      auto const d_tgt =
+        d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col);
+      auto const distance =
+        compute_banded_distance(d_str, d_tgt, max_distance, prev, curr, blockDim.x);
+      if (distance > max_distance) continue;
+      auto const pos = atomicAdd(&row_count, 1);
+      if (d_offsets) {
+        d_first[d_offsets[row] + pos]     = row;
+        d_second[d_offsets[row] + pos]    = col;
+        d_distances[d_offsets[row] + pos] = distance;
+      }
+    }
+    __syncthreads();
+    if (threadIdx.x == 0 && !d_offsets) d_counts[row] = row_count;
+  }
+}
+
 }  // namespace
 
 /**
@@ -289,6 +413,171 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
                                  mr);
 }
 
+/**
+ * @copydoc nvtext::edit_distance_pairs
+ */
+std::unique_ptr<cudf::table> edit_distance_pairs(cudf::strings_column_view const& strings,
+                                                 cudf::size_type max_distance,
+                                                 cudaStream_t stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_distance >= 0 && max_distance <= max_banded_edit_distance,
+               "max_distance must be between 0 and max_banded_edit_distance");
+  auto const strings_count = strings.size();
+  auto make_pairs_table    = [stream, mr](cudf::size_type size) {
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    for (int idx = 0; idx < 3; ++idx)
+      columns.emplace_back(cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                     size,
+                                                     cudf::mask_state::UNALLOCATED,
+                                                     stream,
+                                                     mr));
+    return std::make_unique<cudf::table>(std::move(columns));
+  };
+  if (strings_count < 2) return make_pairs_table(0);
+
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+  auto execpol        = rmm::exec_policy(stream);
+
+  constexpr int block_size = 128;
+  auto const shared_size   = 2 * (2 * max_distance + 1) * block_size * sizeof(int16_t);
+
+  // count the pairs for each row
+  rmm::device_uvector<cudf::size_type> offsets(strings_count + 1, stream);
+  edit_distance_pairs_kernel<<<strings_count, block_size, shared_size, stream>>>(
+    d_strings, max_distance, offsets.data(), nullptr, nullptr, nullptr, nullptr);
+  auto const total_pairs =
+    thrust::reduce(execpol->on(stream), offsets.begin(), offsets.end() - 1, size_t{0});
+  CUDF_EXPECTS(total_pairs < static_cast<size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "too many pairs to create the output columns");
+  thrust::exclusive_scan(
+    execpol->on(stream), offsets.begin(), offsets.end() - 1, offsets.begin());
+
+  // write the pairs
+  auto results     = make_pairs_table(static_cast<cudf::size_type>(total_pairs));
+  auto d_first     = results->get_column(0).mutable_view().data<int32_t>();
+  auto d_second    = results->get_column(1).mutable_view().data<int32_t>();
+  auto d_distances = results->get_column(2).mutable_view().data<int32_t>();
+  edit_distance_pairs_kernel<<<strings_count, block_size, shared_size, stream>>>(
+    d_strings, max_distance, nullptr, offsets.data(), d_first, d_second, d_distances);
+
+  // order the pairs within each row
+  auto pairs = thrust::make_zip_iterator(thrust::make_tuple(d_first, d_second, d_distances));
+  thrust::sort(execpol->on(stream), pairs, pairs + total_pairs);
+  return results;
+}
+
+/**
+ * @copydoc nvtext::edit_distance_nearest
+ */
+std::unique_ptr<cudf::table> edit_distance_nearest(cudf::strings_column_view const& strings,
+                                                   cudf::size_type count,
+                                                   cudf::size_type max_distance,
+                                                   cudaStream_t stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(count > 0, "count must be greater than 0");
+  auto const strings_count = strings.size();
+  auto pairs =
+    edit_distance_pairs(strings, max_distance, stream, rmm::mr::get_default_resource());
+  auto const pairs_count = pairs->num_rows();
+
+  // each pair is a candidate for both of its rows
+  auto const candidates_count = 2 * static_cast<size_t>(pairs_count);
+  CUDF_EXPECTS(candidates_count < static_cast<size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "too many pairs to create the output columns");
+  rmm::device_uvector<int32_t> rows(candidates_count, stream);
+  rmm::device_uvector<int32_t> distances(candidates_count, stream);
+  rmm::device_uvector<int32_t> indices(candidates_count, stream);
+  auto execpol     = rmm::exec_policy(stream);
+  auto d_first     = pairs->get_column(0).view().data<int32_t>();
+  auto d_second    = pairs->get_column(1).view().data<int32_t>();
+  auto d_pair_dist = pairs->get_column(2).view().data<int32_t>();
+  auto candidates  = thrust::make_zip_iterator(
+    thrust::make_tuple(rows.begin(), distances.begin(), indices.begin()));
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(pairs_count * 2),
+                    candidates,
+                    [d_first, d_second, d_pair_dist, pairs_count] __device__(auto idx) {
+                      auto const pair_idx = idx % pairs_count;
+                      auto const swapped  = idx >= pairs_count;
+                      return thrust::make_tuple(swapped ? d_second[pair_idx] : d_first[pair_idx],
+                                                d_pair_dist[pair_idx],
+                                                swapped ? d_first[pair_idx] : d_second[pair_idx]);
+                    });
+  // order by row, then distance, then index
+  thrust::sort(execpol->on(stream), candidates, candidates + candidates_count);
+
+  // keep the first `count` candidates of each row
+  rmm::device_uvector<cudf::size_type> ranks(candidates_count, stream);
+  thrust::exclusive_scan_by_key(execpol->on(stream),
+                                rows.begin(),
+                                rows.end(),
+                                thrust::make_constant_iterator<cudf::size_type>(1),
+                                ranks.begin());
+  auto d_ranks = ranks.data();
+  auto const output_count =
+    thrust::count_if(execpol->on(stream),
+                     ranks.begin(),
+                     ranks.end(),
+                     [count] __device__(auto rank) { return rank < count; });
+  rmm::device_uvector<int32_t> output_rows(output_count, stream);
+  auto output_indices   = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                  output_count,
+                                                  cudf::mask_state::UNALLOCATED,
+                                                  stream,
+                                                  mr);
+  auto output_distances = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                    output_count,
+                                                    cudf::mask_state::UNALLOCATED,
+                                                    stream,
+                                                    mr);
+  thrust::copy_if(execpol->on(stream),
+                  candidates,
+                  candidates + candidates_count,
+                  thrust::make_counting_iterator<cudf::size_type>(0),
+                  thrust::make_zip_iterator(
+                    thrust::make_tuple(output_rows.begin(),
+                                       output_distances->mutable_view().begin<int32_t>(),
+                                       output_indices->mutable_view().begin<int32_t>())),
+                  [d_ranks, count] __device__(auto idx) { return d_ranks[idx] < count; });
+
+  // the list offsets are the first position of each row in the sorted output
+  auto make_offsets = [&] {
+    auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                             strings_count + 1,
+                                             cudf::mask_state::UNALLOCATED,
+                                             stream,
+                                             mr);
+    thrust::lower_bound(execpol->on(stream),
+                        output_rows.begin(),
+                        output_rows.end(),
+                        thrust::make_counting_iterator<int32_t>(0),
+                        thrust::make_counting_iterator<int32_t>(strings_count + 1),
+                        offsets->mutable_view().begin<int32_t>());
+    return offsets;
+  };
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.emplace_back(cudf::make_lists_column(strings_count,
+                                               make_offsets(),
+                                               std::move(output_indices),
+                                               0,
+                                               rmm::device_buffer{0, stream, mr},
+                                               stream,
+                                               mr));
+  columns.emplace_back(cudf::make_lists_column(strings_count,
+                                               make_offsets(),
+                                               std::move(output_distances),
+                                               0,
+                                               rmm::device_buffer{0, stream, mr},
+                                               stream,
+                                               mr));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
 }  // namespace detail
 
 // external APIs
@@ -314,4 +603,27 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
   return detail::edit_distance_matrix(strings, 0, mr);
 }
 
+/**
+ * @copydoc nvtext::edit_distance_pairs
+ */
+std::unique_ptr<cudf::table> edit_distance_pairs(cudf::strings_column_view const& strings,
+                                                 cudf::size_type max_distance,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance_pairs(strings, max_distance, 0, mr);
+}
+
+/**
+ * @copydoc nvtext::edit_distance_nearest
+ */
+std::unique_ptr<cudf::table> edit_distance_nearest(cudf::strings_column_view const& strings,
+                                                   cudf::size_type count,
+                                                   cudf::size_type max_distance,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance_nearest(strings, count, max_distance, 0, mr);
+}
+
 }  // namespace nvtext
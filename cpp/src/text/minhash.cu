@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <nvtext/minhash.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/logical.h>
+#include <thrust/sequence.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Number of seeds hashed for each n-gram located by the minhash kernel.
+ *
+ * Locating an n-gram costs about as much as hashing it so the minimums for
+ * this many seeds are kept in registers for each pass over a string.
+ */
+constexpr cudf::size_type seeds_per_pass = 8;
+
+__device__ bool is_whitespace(char chr) { return static_cast<uint8_t>(chr) <= ' '; }
+
+/**
+ * @brief Locates the n-gram that starts at byte position `pos` of `d_str`.
+ *
+ * A window that runs past the end of the string is only an n-gram when it
+ * is the first one in the string, i.e. the string is shorter than `width`.
+ *
+ * @param d_str String to search
+ * @param pos Byte position within `d_str`
+ * @param width Number of characters or words in each n-gram
+ * @param type Character or word n-grams
+ * @return The end byte position of the n-gram or -1 if no n-gram starts at `pos`
+ */
+__device__ cudf::size_type ngram_end(cudf::string_view const& d_str,
+                                     cudf::size_type pos,
+                                     cudf::size_type width,
+                                     ngram_type type)
+{
+  auto const d_chars    = d_str.data();
+  auto const bytes      = d_str.size_bytes();
+  cudf::size_type count = 0;
+  if (type == ngram_type::CHARACTER) {
+    if (!cudf::strings::detail::is_begin_utf8_char(d_chars[pos])) return -1;
+    auto end = pos;
+    while ((count < width) && (end < bytes)) {
+      do {
+        ++end;
+      } while ((end < bytes) && !cudf::strings::detail::is_begin_utf8_char(d_chars[end]));
+      ++count;
+    }
+    return (count < width) && (pos > 0) ? -1 : end;
+  }
+
+  // only the first byte of a word can start a word n-gram
+  if (is_whitespace(d_chars[pos]) || ((pos > 0) && !is_whitespace(d_chars[pos - 1]))) return -1;
+  auto end      = pos;
+  auto word_end = pos;
+  while ((count < width) && (end < bytes)) {
+    while ((end < bytes) && !is_whitespace(d_chars[end])) ++end;
+    word_end = end;
+    ++count;
+    while ((end < bytes) && is_whitespace(d_chars[end])) ++end;
+  }
+  if (count < width) {
+    // check for an earlier word
+    for (auto idx = pos - 1; idx >= 0; --idx)
+      if (!is_whitespace(d_chars[idx])) return -1;
+  }
+  return word_end;
+}
+
+/**
+ * @brief Computes the minhash values for each string.
+ *
+ * A warp is assigned to each string. Each lane locates and hashes the
+ * n-grams starting at its byte positions and the warp then reduces the
+ * minimum hash value for each seed.
+ *
+ * @param d_strings Strings to hash
+ * @param d_seeds Seed values for the hash function
+ * @param seeds_size Number of seeds
+ * @param width Number of characters or words in each n-gram
+ * @param type Character or word n-grams
+ * @param d_results Output of `seeds_size` values per string
+ */
+__global__ void minhash_kernel(cudf::column_device_view const d_strings,
+                               uint32_t const* d_seeds,
+                               cudf::size_type seeds_size,
+                               cudf::size_type width,
+                               ngram_type type,
+                               uint32_t* d_results)
+{
+  auto const idx = static_cast<std::size_t>(threadIdx.x) +
+                   static_cast<std::size_t>(blockIdx.x) * static_cast<std::size_t>(blockDim.x);
+  auto const str_idx = static_cast<cudf::size_type>(idx / cudf::detail::warp_size);
+  if (str_idx >= d_strings.size()) return;  // the whole warp exits here
+  auto const lane_idx = static_cast<cudf::size_type>(idx % cudf::detail::warp_size);
+
+  auto const d_str = d_strings.is_null(str_idx) ? cudf::string_view{}
+                                                 : d_strings.element<cudf::string_view>(str_idx);
+  auto const d_output = d_results + static_cast<std::size_t>(str_idx) * seeds_size;
+
+  for (cudf::size_type seed_idx = 0; seed_idx < seeds_size; seed_idx += seeds_per_pass) {
+    auto const pass_size = min(seeds_per_pass, seeds_size - seed_idx);
+    uint32_t mins[seeds_per_pass];
+    for (auto s = 0; s < seeds_per_pass; ++s) mins[s] = std::numeric_limits<uint32_t>::max();
+
+    for (auto pos = lane_idx; pos < d_str.size_bytes(); pos += cudf::detail::warp_size) {
+      auto const end = ngram_end(d_str, pos, width, type);
+      if (end < 0) continue;
+      cudf::string_view const ngram(d_str.data() + pos, end - pos);
+      for (auto s = 0; s < pass_size; ++s) {
+        auto const hasher = MurmurHash3_32<cudf::string_view>{d_seeds[seed_idx + s]};
+        mins[s]           = min(mins[s], hasher(ngram));
+      }
+    }
+
+    for (auto s = 0; s < pass_size; ++s) {
+      auto value = mins[s];
+      for (auto offset = cudf::detail::warp_size / 2; offset > 0; offset /= 2)
+        value = min(value, __shfl_down_sync(0xffffffff, value, offset));
+      if (lane_idx == 0) d_output[seed_idx + s] = value;
+    }
+  }
+}
+
+/**
+ * @brief Creates the offsets column for a lists column with `size` values in every row.
+ */
+std::unique_ptr<cudf::column> make_fixed_size_offsets(cudf::size_type rows,
+                                                      cudf::size_type size,
+                                                      cudaStream_t stream,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  auto offsets   = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           rows + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), d_offsets, d_offsets + rows + 1, 0, size);
+  return offsets;
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      ngram_type type,
+                                      cudaStream_t stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(seeds.type().id() == cudf::type_id::UINT32, "seeds must be of type UINT32");
+  CUDF_EXPECTS(!seeds.has_nulls(), "seeds must not contain nulls");
+  CUDF_EXPECTS(!seeds.is_empty(), "at least one seed is required");
+  CUDF_EXPECTS(width > 0, "width must be greater than 0");
+  auto const strings_count = strings.size();
+  CUDF_EXPECTS(static_cast<std::size_t>(strings_count) * static_cast<std::size_t>(seeds.size()) <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "strings.size() x seeds.size() is too large for the output column");
+
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          strings_count * seeds.size(),
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  if (strings_count > 0) {
+    auto strings_column      = cudf::column_device_view::create(strings.parent(), stream);
+    constexpr int block_size = 256;
+    auto const num_blocks    = cudf::util::div_rounding_up_safe<std::size_t>(
+      static_cast<std::size_t>(strings_count) * cudf::detail::warp_size, block_size);
+    minhash_kernel<<<num_blocks, block_size, 0, stream>>>(
+      *strings_column,
+      seeds.data<uint32_t>(),
+      seeds.size(),
+      width,
+      type,
+      hashes->mutable_view().data<uint32_t>());
+  }
+
+  return cudf::make_lists_column(strings_count,
+                                 make_fixed_size_offsets(strings_count, seeds.size(), stream, mr),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+std::unique_ptr<cudf::column> minhash_bands(cudf::lists_column_view const& minhashes,
+                                            cudf::size_type bands,
+                                            cudaStream_t stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(bands > 0, "bands must be greater than 0");
+  auto const rows = minhashes.size();
+  if (rows == 0)
+    return cudf::make_lists_column(0,
+                                   make_fixed_size_offsets(0, bands, stream, mr),
+                                   cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                                   0,
+                                   rmm::device_buffer{0, stream, mr},
+                                   stream,
+                                   mr);
+  CUDF_EXPECTS(minhashes.child().type().id() == cudf::type_id::UINT32,
+               "minhash values must be of type UINT32");
+
+  auto const offsets   = minhashes.offsets();
+  auto const d_offsets = offsets.data<int32_t>() + minhashes.offset();
+  auto const size      = cudf::detail::get_value<int32_t>(offsets, minhashes.offset() + 1, stream) -
+                    cudf::detail::get_value<int32_t>(offsets, minhashes.offset(), stream);
+  CUDF_EXPECTS(size % bands == 0, "number of minhash values must be a multiple of bands");
+  auto const execpol = rmm::exec_policy(stream);
+  CUDF_EXPECTS(thrust::all_of(execpol->on(stream),
+                              thrust::make_counting_iterator<cudf::size_type>(0),
+                              thrust::make_counting_iterator<cudf::size_type>(rows),
+                              [d_offsets, size] __device__(auto idx) {
+                                return d_offsets[idx + 1] - d_offsets[idx] == size;
+                              }),
+               "all rows must have the same number of minhash values");
+
+  auto results             = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                           rows * bands,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_results           = results->mutable_view().data<uint32_t>();
+  auto const d_values      = minhashes.child().data<uint32_t>();
+  auto const rows_per_band = size / bands;
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    rows * bands,
+    [d_offsets, d_values, d_results, bands, rows_per_band] __device__(auto idx) {
+      auto const values = d_values + d_offsets[idx / bands] + (idx % bands) * rows_per_band;
+      MurmurHash3_32<uint32_t> hasher{};
+      auto band_hash = hasher(values[0]);
+      for (auto jdx = 1; jdx < rows_per_band; ++jdx)
+        band_hash = hasher.hash_combine(band_hash, hasher(values[jdx]));
+      d_results[idx] = band_hash;
+    });
+
+  return cudf::make_lists_column(rows,
+                                 make_fixed_size_offsets(rows, bands, stream, mr),
+                                 std::move(results),
+                                 minhashes.null_count(),
+                                 cudf::copy_bitmask(minhashes.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      ngram_type type,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, seeds, width, type, 0, mr);
+}
+
+std::unique_ptr<cudf::column> minhash_bands(cudf::lists_column_view const& minhashes,
+                                            cudf::size_type bands,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_bands(minhashes, bands, 0, mr);
+}
+
+}  // namespace nvtext
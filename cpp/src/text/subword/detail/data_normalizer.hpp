@@ -92,6 +92,21 @@ class data_normalizer {
                                                         uint32_t num_strings,
                                                         cudaStream_t stream);
 
+  /**
+   * @brief Returns the device table of metadata values for every unicode code point value.
+   */
+  codepoint_metadata_type const* get_cp_metadata() const { return d_cp_metadata; }
+
+  /**
+   * @brief Returns the device table mapping some code points to multiple code points.
+   */
+  aux_codepoint_data_type const* get_aux_table() const { return d_aux_table; }
+
+  /**
+   * @brief Returns true if the normalizer converts characters to lower case.
+   */
+  bool is_lower_case() const { return do_lower_case; }
+
  private:
   bool const do_lower_case;
   codepoint_metadata_type const* d_cp_metadata;
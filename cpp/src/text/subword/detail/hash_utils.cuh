@@ -65,9 +65,9 @@ __device__ uint64_t mul_mod_48(uint64_t num_48bit, uint64_t num)
  * @param start_value Initializes the hash computation.
  * @return The sdbm hash of all elements in range `[sequence_start, sequence_start + length)`
  */
-__device__ uint64_t sdbm_hash(uint32_t const* sequence_start,
-                              uint32_t length,
-                              uint64_t start_value = 0)
+__host__ __device__ inline uint64_t sdbm_hash(uint32_t const* sequence_start,
+                                              uint32_t length,
+                                              uint64_t start_value = 0)
 {
   // This expression computes h_{i} = (65599*h{i-1} + new_val) mod 2^48 and was obtained from here:
   // http://www.cse.yorku.ca/~oz/hash.html
@@ -118,7 +118,7 @@ __device__ uint64_t prev_sdbm_hash(uint64_t current_hash, uint32_t last_val)
  * @param table_size Number of bins in the hash table.
  * @return The computed hash value.
  */
-__device__ uint32_t hash(uint64_t key, uint64_t a, uint64_t b, uint32_t table_size)
+__host__ __device__ inline uint32_t hash(uint64_t key, uint64_t a, uint64_t b, uint32_t table_size)
 {
   return ((a * key + b) % PRIME) % table_size;
 }
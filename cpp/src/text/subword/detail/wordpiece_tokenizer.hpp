@@ -75,6 +75,8 @@ class wordpiece_tokenizer {
    * @brief Splits the input text into token ids.
    *
    * This class is simply a wrapper around the basic and word piece tokenizers.
+   * When every string fits in shared memory, each string is normalized and tokenized
+   * by a single block, without writing the normalized code points to device memory.
    *
    * @param d_strings A vector of strings which MUST be encoded in the utf8 format.
    * @param d_offsets A vector of byte offsets to the beginning of individual strings in
@@ -105,6 +107,16 @@ class wordpiece_tokenizer {
                 ptr_length_pair& offsets_and_length,
                 cudaStream_t stream);
 
+  /**
+   * @brief Normalizes and splits strings that fit in shared memory into token ids.
+   *
+   * The parameters and the result are the same as for the public `tokenize`.
+   */
+  std::pair<uint32_t*, uint32_t*> tokenize_in_shared_memory(char const* d_strings,
+                                                            uint32_t const* d_offsets,
+                                                            uint32_t num_strings,
+                                                            cudaStream_t stream);
+
   data_normalizer normalizer;  // removes punctuation, accents, etc
   uint32_t const max_sequence_length;
   uint32_t const stride;
@@ -118,6 +130,7 @@ class wordpiece_tokenizer {
   rmm::device_uvector<uint32_t> device_token_ids;
   rmm::device_uvector<uint32_t> device_word_indices;
   rmm::device_uvector<uint8_t> device_tokens_per_word;
+  rmm::device_uvector<uint32_t> device_token_offsets;
   rmm::device_uvector<uint32_t> device_num_selected;
   rmm::device_uvector<size_t> cub_temp_storage;
   size_t max_cub_storage_bytes;
@@ -15,17 +15,89 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/error.hpp>
 #include <nvtext/detail/load_hash_file.hpp>
+#include <text/subword/detail/hash_utils.cuh>
 
 #include <stdint.h>
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <unordered_set>
 #include <vector>
 
 namespace nvtext {
 namespace detail {
+namespace {
+
+/**
+ * @brief Copy host values into a new non-nullable column.
+ */
+template <typename T>
+std::unique_ptr<cudf::column> make_vocabulary_column(std::vector<T> const& values,
+                                                     cudf::type_id id,
+                                                     cudaStream_t stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  auto result = cudf::make_numeric_column(
+    cudf::data_type{id}, values.size(), cudf::mask_state::UNALLOCATED, stream, mr);
+  CUDA_TRY(cudaMemcpyAsync(result->mutable_view().data<T>(),
+                           values.data(),
+                           values.size() * sizeof(T),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  return result;
+}
+
+/**
+ * @brief Decode a UTF-8 encoded string into unicode code points.
+ *
+ * The tokenizer hashes the code points of each word so the vocabulary
+ * entries must be hashed the same way.
+ */
+std::vector<uint32_t> to_code_points(std::string const& str)
+{
+  std::vector<uint32_t> result;
+  std::size_t idx = 0;
+  while (idx < str.size()) {
+    auto const lead   = static_cast<uint8_t>(str[idx]);
+    auto const length = lead < 0xC0 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+    uint32_t code_point = length == 1 ? lead : lead & (0xFF >> (length + 1));
+    for (int jdx = 1; jdx < length && (idx + jdx) < str.size(); ++jdx)
+      code_point = (code_point << 6) | (static_cast<uint8_t>(str[idx + jdx]) & 0x3F);
+    result.push_back(code_point);
+    idx += length;
+  }
+  return result;
+}
+
+// Largest first-level bin accepted when building the perfect hash.
+// Each bin is then hashed with no collisions into a table of the same size
+// and the expected number of tries grows exponentially with the bin size.
+constexpr std::size_t max_first_level_bin_size = 12;
+
+/**
+ * @brief Process-level cache of loaded vocabularies keyed by path and file format.
+ *
+ * The cache is intentionally never destroyed so no device memory is freed
+ * after the CUDA runtime has been torn down at exit.
+ */
+struct vocabulary_cache {
+  std::mutex mutex;
+  std::map<std::pair<std::string, bool>, std::shared_ptr<hashed_vocabulary const>> entries;
+
+  static vocabulary_cache& instance()
+  {
+    static auto* cache = new vocabulary_cache();
+    return *cache;
+  }
+};
+
+}  // namespace
 
 /**
  * @brief Loads a text file representing the hashed vocabulary into hashed_vocabulary struct.
@@ -102,48 +174,171 @@ hashed_vocabulary load_vocabulary_file(std::string const& filename_hashed_vocabu
   result.separator_token_id = std::stoi(line);
 
   // Transfer hash table to columns
-  result.table = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT64},
-                                           table.size(),
-                                           cudf::mask_state::UNALLOCATED,
-                                           stream,
-                                           mr);
-  CUDA_TRY(cudaMemcpyAsync(result.table->mutable_view().data<uint64_t>(),
-                           table.data(),
-                           table.size() * sizeof(uint64_t),
-                           cudaMemcpyHostToDevice,
-                           stream));
+  result.table = make_vocabulary_column(table, cudf::type_id::UINT64, stream, mr);
+  result.bin_coefficients =
+    make_vocabulary_column(bin_coefficients, cudf::type_id::UINT64, stream, mr);
+  result.bin_offsets = make_vocabulary_column(bin_offsets, cudf::type_id::UINT16, stream, mr);
 
-  result.bin_coefficients = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT64},
-                                                      bin_coefficients.size(),
-                                                      cudf::mask_state::UNALLOCATED,
-                                                      stream,
-                                                      mr);
-  CUDA_TRY(cudaMemcpyAsync(result.bin_coefficients->mutable_view().data<uint64_t>(),
-                           bin_coefficients.data(),
-                           bin_coefficients.size() * sizeof(uint64_t),
-                           cudaMemcpyHostToDevice,
-                           stream));
+  return result;
+}
 
-  result.bin_offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT16},
-                                                 bin_offsets.size(),
-                                                 cudf::mask_state::UNALLOCATED,
-                                                 stream,
-                                                 mr);
-  CUDA_TRY(cudaMemcpyAsync(result.bin_offsets->mutable_view().data<uint16_t>(),
-                           bin_offsets.data(),
-                           bin_offsets.size() * sizeof(uint16_t),
-                           cudaMemcpyHostToDevice,
-                           stream));
+/**
+ * @brief Builds the hashed vocabulary from a vocab.txt file.
+ *
+ * This creates the same two-level perfect hash as the python/perfect_hash.py script.
+ * Each word is keyed by the sdbm hash of its code points and the first level
+ * `((a*key + b) % PRIME) % num_bins` assigns the keys to `num_vocab/4` bins.
+ * Each bin is then given its own `a` and `b` coefficients that map its keys
+ * into a table the size of the bin with no collisions.
+ * The coefficients are found with a fixed seed so the result is reproducible.
+ *
+ * @param filename_vocabulary Path to text file containing one word per line
+ * @return object containing hash table elements for the wordpiece tokenizer
+ */
+hashed_vocabulary build_hashed_vocabulary(std::string const& filename_vocabulary,
+                                          cudaStream_t stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  std::ifstream vocab_file(filename_vocabulary);
+  CUDF_EXPECTS(vocab_file.good(), "Could not open " + filename_vocabulary);
+
+  // the token-id of each word is its line number in the file
+  hashed_vocabulary result;
+  std::vector<std::pair<uint64_t, uint16_t>> entries;
+  std::unordered_set<uint64_t> keys;
+  bool found_unknown = false, found_first = false, found_separator = false;
+  uint32_t token_id = 0;
+  std::string line;
+  while (std::getline(vocab_file, line)) {
+    CUDF_EXPECTS(token_id <= std::numeric_limits<uint16_t>::max(),
+                 "vocabulary has too many entries");
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line == "[UNK]") {
+      result.unknown_token_id = token_id;
+      found_unknown           = true;
+    } else if (line == "[CLS]") {
+      result.first_token_id = token_id;
+      found_first           = true;
+    } else if (line == "[SEP]") {
+      result.separator_token_id = token_id;
+      found_separator           = true;
+    }
+    auto const code_points = to_code_points(line);
+    auto const key         = sdbm_hash(code_points.data(), code_points.size());
+    // words with the same hash are indistinguishable to the tokenizer; keep the first one
+    if (keys.insert(key).second) entries.emplace_back(key, static_cast<uint16_t>(token_id));
+    ++token_id;
+  }
+  CUDF_EXPECTS(found_unknown && found_first && found_separator,
+               "vocabulary must include the [UNK], [CLS] and [SEP] tokens");
+
+  std::mt19937_64 engine{0};
+
+  // first level: pick coefficients until no bin is too large
+  uint32_t const num_bins = std::max<std::size_t>(1, entries.size() / 4);
+  std::vector<std::vector<std::pair<uint64_t, uint16_t>>> bins;
+  std::uniform_int_distribution<uint32_t> outer_dist(1 << 12, (1 << 15) - 1);
+  do {
+    result.outer_hash_a = outer_dist(engine);
+    result.outer_hash_b = outer_dist(engine);
+    bins.assign(num_bins, {});
+    for (auto const& entry : entries)
+      bins[hash(entry.first, result.outer_hash_a, result.outer_hash_b, num_bins)].push_back(entry);
+  } while (std::any_of(bins.begin(), bins.end(), [](auto const& bin) {
+    return bin.size() > max_first_level_bin_size;
+  }));
+  result.num_bins = num_bins;
+
+  // second level: find collision-free coefficients for each bin
+  std::vector<uint64_t> table;
+  std::vector<uint64_t> bin_coefficients(num_bins);
+  std::vector<uint16_t> bin_offsets(num_bins);
+  std::uniform_int_distribution<uint64_t> inner_a_dist(1ULL << 16, (1ULL << 48) - 1);
+  std::uniform_int_distribution<uint64_t> inner_b_dist(0, (1 << 7) - 1);
+  for (uint32_t idx = 0; idx < num_bins; ++idx) {
+    auto const& bin = bins[idx];
+    if (bin.empty()) {
+      // a single slot at offset 0: no key that hashes here can match its entry
+      bin_coefficients[idx] = 1;
+      bin_offsets[idx]      = 0;
+      continue;
+    }
+    uint64_t const bin_size = bin.size();
+    std::vector<uint64_t> slots(bin_size);
+    uint64_t a = 0, b = 0;
+    bool found = false;
+    while (!found) {
+      a = inner_a_dist(engine);
+      b = inner_b_dist(engine);
+      std::fill(slots.begin(), slots.end(), 0);
+      found = std::all_of(bin.begin(), bin.end(), [&](auto const& entry) {
+        auto& slot = slots[hash(entry.first, a, b, bin_size)];
+        if (slot != 0) return false;
+        slot = (entry.first << 16) | entry.second;
+        return true;
+      });
+    }
+    bin_coefficients[idx] = (a << 16) | (b << 9) | bin_size;
+    bin_offsets[idx]      = static_cast<uint16_t>(table.size());
+    table.insert(table.end(), slots.begin(), slots.end());
+  }
+
+  result.table = make_vocabulary_column(table, cudf::type_id::UINT64, stream, mr);
+  result.bin_coefficients =
+    make_vocabulary_column(bin_coefficients, cudf::type_id::UINT64, stream, mr);
+  result.bin_offsets = make_vocabulary_column(bin_offsets, cudf::type_id::UINT16, stream, mr);
 
   return result;
 }
 
+std::shared_ptr<hashed_vocabulary const> get_cached_vocabulary(std::string const& filename,
+                                                               bool is_hashed_file,
+                                                               cudaStream_t stream)
+{
+  auto& cache = vocabulary_cache::instance();
+  // loading while holding the lock keeps concurrent callers from loading the same file twice
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  auto& entry = cache.entries[{filename, is_hashed_file}];
+  if (!entry) {
+    auto vocabulary =
+      is_hashed_file
+        ? load_vocabulary_file(filename, stream, rmm::mr::get_default_resource())
+        : build_hashed_vocabulary(filename, stream, rmm::mr::get_default_resource());
+    // the vocabulary may be used on any stream once it is in the cache
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    entry = std::make_shared<hashed_vocabulary const>(std::move(vocabulary));
+  }
+  return entry;
+}
+
 }  // namespace detail
 
 hashed_vocabulary load_vocabulary_file(std::string const& filename_hashed_vocabulary,
                                        rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::load_vocabulary_file(filename_hashed_vocabulary, 0, mr);
 }
 
+hashed_vocabulary build_hashed_vocabulary(std::string const& filename_vocabulary,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::build_hashed_vocabulary(filename_vocabulary, 0, mr);
+}
+
+std::shared_ptr<hashed_vocabulary const> get_cached_vocabulary(std::string const& filename,
+                                                               bool is_hashed_file)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_cached_vocabulary(filename, is_hashed_file, 0);
+}
+
+void clear_vocabulary_cache()
+{
+  auto& cache = detail::vocabulary_cache::instance();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.entries.clear();
+}
+
 }  // namespace nvtext
@@ -15,6 +15,8 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
@@ -24,7 +26,9 @@
 #include <text/subword/detail/wordpiece_tokenizer.hpp>
 
 #include <thrust/for_each.h>
+#include <thrust/transform.h>
 #include <thrust/transform_scan.h>
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <vector>
@@ -44,6 +48,7 @@ namespace {
  * @param[in] nrows_tensor_token_ids Total number of output tensor rows
  * @param[in] stride Number of tokens in sub-rows
  * @param[in] do_truncate True if tokens should not spill into sub-rows in the output
+ * @param[in] first_row_id Value added to each string index written to the metadata
  * @param[out] final_tensor Output vector of token-ids
  * @param[out] attn_mask Identifies valid token id entries
  * @param[out] metadata Additional data per row
@@ -58,6 +63,7 @@ __global__ void kernel_compute_tensor_metadata(
   uint32_t nrows_tensor_token_ids,
   uint32_t stride,
   bool do_truncate,
+  uint32_t first_row_id,
   // output
   uint32_t* final_tensor,
   uint32_t* attn_mask,
@@ -106,7 +112,7 @@ __global__ void kernel_compute_tensor_metadata(
   // write metadata
   if (token_idx == 0) {
     auto const metadata_idx = absolute_row_id * 3;  // three metadata values per output row
-    metadata[metadata_idx]  = tensor_id;
+    metadata[metadata_idx]  = first_row_id + tensor_id;
     if (row_within_tensor == 0)
       metadata[metadata_idx + 1] = 0;
     else
@@ -127,47 +133,34 @@ __global__ void kernel_compute_tensor_metadata(
   }
 }
 
-}  // namespace
-
-tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
-                                  hashed_vocabulary const& vocab_table,
-                                  uint32_t max_sequence_length,
-                                  uint32_t stride,
-                                  bool do_lower_case,
-                                  bool do_truncate,
-                                  uint32_t max_num_strings,
-                                  uint32_t max_num_chars,
-                                  uint32_t max_rows_tensor,
-                                  cudaStream_t stream,
-                                  rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Run the tokenizer over a set of strings and build the output tensors.
+ *
+ * The `d_offsets` must be relative to `d_chars` and the strings must fit
+ * within the working memory of `tokenizer`.
+ *
+ * @param tokenizer Tokenizer instance with its working memory
+ * @param d_chars Characters of the strings to tokenize
+ * @param d_offsets Offsets of the `strings_count` strings into `d_chars`
+ * @param strings_count Number of strings
+ * @param max_sequence_length Maximum number of tokens in a row
+ * @param stride Number of tokens in sub-rows
+ * @param do_truncate True if tokens should not spill into sub-rows in the output
+ * @param first_row_id Row index of the first string written to the metadata
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Memory resource to allocate any returned objects.
+ */
+tokenizer_result build_tensors(wordpiece_tokenizer& tokenizer,
+                               char const* d_chars,
+                               uint32_t const* d_offsets,
+                               uint32_t strings_count,
+                               uint32_t max_sequence_length,
+                               uint32_t stride,
+                               bool do_truncate,
+                               uint32_t first_row_id,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource* mr)
 {
-  CUDF_EXPECTS(stride <= max_sequence_length,
-               "stride must be less than or equal to max_sequence_length");
-  CUDF_EXPECTS(max_sequence_length * max_rows_tensor < std::numeric_limits<cudf::size_type>::max(),
-               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
-  auto const strings_count = strings.size();
-  if (strings_count == 0 || strings.chars_size() == 0)
-    return tokenizer_result{0,
-                            max_sequence_length,
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
-
-  auto const offsets   = strings.offsets();
-  auto const d_offsets = offsets.data<uint32_t>() + strings.offset();
-  auto const offset    = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
-  auto const d_chars   = strings.chars().data<char>() + offset;
-
-  // Create tokenizer
-  wordpiece_tokenizer tokenizer(vocab_table,
-                                max_num_strings,
-                                max_num_chars,
-                                max_rows_tensor,
-                                max_sequence_length,
-                                stride,
-                                do_truncate,
-                                do_lower_case,
-                                stream);
   // Run tokenizer
   auto const tokens = tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
   // assign output components
@@ -245,6 +238,7 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
     nrows_tensor_token_ids,
     stride,
     do_truncate,
+    first_row_id,
     tensor_token_ids->mutable_view().data<uint32_t>(),
     tensor_attention_mask->mutable_view().data<uint32_t>(),
     tensor_metadata->mutable_view().data<uint32_t>());
@@ -256,6 +250,59 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                           std::move(tensor_metadata)};
 }
 
+}  // namespace
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  hashed_vocabulary const& vocab_table,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  uint32_t max_num_strings,
+                                  uint32_t max_num_chars,
+                                  uint32_t max_rows_tensor,
+                                  cudaStream_t stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  CUDF_EXPECTS(max_sequence_length * max_rows_tensor < std::numeric_limits<cudf::size_type>::max(),
+               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
+  auto const strings_count = strings.size();
+  if (strings_count == 0 || strings.chars_size() == 0)
+    return tokenizer_result{0,
+                            max_sequence_length,
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
+
+  auto const offsets   = strings.offsets();
+  auto const d_offsets = offsets.data<uint32_t>() + strings.offset();
+  auto const offset    = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
+  auto const d_chars   = strings.chars().data<char>() + offset;
+
+  // Create tokenizer
+  wordpiece_tokenizer tokenizer(vocab_table,
+                                max_num_strings,
+                                max_num_chars,
+                                max_rows_tensor,
+                                max_sequence_length,
+                                stride,
+                                do_truncate,
+                                do_lower_case,
+                                stream);
+  return build_tensors(tokenizer,
+                       d_chars,
+                       d_offsets,
+                       strings_count,
+                       max_sequence_length,
+                       stride,
+                       do_truncate,
+                       0,
+                       stream,
+                       mr);
+}
+
 }  // namespace detail
 
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
@@ -270,9 +317,9 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  hashed_vocabulary vocab_table = load_vocabulary_file(filename_hashed_vocabulary, mr);
+  auto const vocab_table = detail::get_cached_vocabulary(filename_hashed_vocabulary, true, 0);
   return detail::subword_tokenize(strings,
-                                  vocab_table,
+                                  *vocab_table,
                                   max_sequence_length,
                                   stride,
                                   do_lower_case,
@@ -309,4 +356,182 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   mr);
 }
 
+/**
+ * @brief Holds the vocabulary and the working memory for the subword_tokenizer.
+ */
+struct subword_tokenizer::impl {
+  impl(hashed_vocabulary&& vocabulary_table,
+       uint32_t max_sequence_length,
+       uint32_t stride,
+       bool do_lower_case,
+       bool do_truncate,
+       uint32_t max_num_strings,
+       uint32_t max_num_chars,
+       uint32_t max_rows_tensor,
+       cudaStream_t stream)
+    : vocab_table(std::move(vocabulary_table)),
+      max_sequence_length(max_sequence_length),
+      stride(stride),
+      do_truncate(do_truncate),
+      max_num_strings(max_num_strings),
+      max_num_chars(max_num_chars),
+      max_rows_tensor(max_rows_tensor),
+      stream(stream),
+      tokenizer(vocab_table,
+                max_num_strings,
+                max_num_chars,
+                max_rows_tensor,
+                max_sequence_length,
+                stride,
+                do_truncate,
+                do_lower_case,
+                stream),
+      batch_offsets(max_num_strings + 1, stream)
+  {
+  }
+
+  /**
+   * @brief Tokenize the strings in batches that fit in the working memory.
+   *
+   * Each batch is tokenized independently and the results are then
+   * re-sliced into chunks of `max_rows_tensor` rows.
+   */
+  std::vector<tokenizer_result> tokenize(cudf::strings_column_view const& strings,
+                                         rmm::mr::device_memory_resource* mr)
+  {
+    std::vector<tokenizer_result> results;
+    auto const strings_count = strings.size();
+    if (strings_count == 0 || strings.chars_size() == 0) return results;
+
+    // the batch boundaries are computed from the offsets on the host
+    auto const d_offsets = strings.offsets().data<int32_t>() + strings.offset();
+    auto const d_chars   = strings.chars().data<char>();
+    std::vector<int32_t> h_offsets(strings_count + 1);
+    CUDA_TRY(cudaMemcpyAsync(h_offsets.data(),
+                             d_offsets,
+                             h_offsets.size() * sizeof(int32_t),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    std::vector<tokenizer_result> batches;
+    uint32_t total_rows   = 0;
+    cudf::size_type begin = 0;
+    while (begin < strings_count) {
+      auto end = begin;
+      while ((end < strings_count) && (static_cast<uint32_t>(end - begin) < max_num_strings) &&
+             (static_cast<uint32_t>(h_offsets[end + 1] - h_offsets[begin]) <= max_num_chars))
+        ++end;
+      CUDF_EXPECTS(end > begin, "string size exceeds max_num_chars");
+      auto const base = h_offsets[begin];
+      if (h_offsets[end] > base) {
+        // the tokenizer expects offsets relative to the first string of the batch
+        thrust::transform(rmm::exec_policy(stream)->on(stream),
+                          d_offsets + begin,
+                          d_offsets + end + 1,
+                          batch_offsets.begin(),
+                          [base] __device__(int32_t offset) {
+                            return static_cast<uint32_t>(offset - base);
+                          });
+        batches.emplace_back(detail::build_tensors(tokenizer,
+                                                   d_chars + base,
+                                                   batch_offsets.data(),
+                                                   end - begin,
+                                                   max_sequence_length,
+                                                   stride,
+                                                   do_truncate,
+                                                   begin,
+                                                   stream,
+                                                   rmm::mr::get_default_resource()));
+        total_rows += batches.back().nrows_tensor;
+      }
+      begin = end;
+    }
+
+    // gather the batch outputs into max_rows_tensor sized results
+    std::size_t batch_idx = 0;
+    uint32_t batch_row    = 0;
+    for (uint32_t row = 0; row < total_rows; row += max_rows_tensor) {
+      auto const nrows = std::min(max_rows_tensor, total_rows - row);
+      std::vector<cudf::column_view> token_ids, attention_mask, metadata;
+      for (uint32_t remaining = nrows; remaining > 0;) {
+        auto const& batch = batches[batch_idx];
+        auto const count  = std::min(remaining, batch.nrows_tensor - batch_row);
+        auto const first  = static_cast<cudf::size_type>(batch_row);
+        auto const last   = static_cast<cudf::size_type>(batch_row + count);
+        token_ids.push_back(cudf::detail::slice(batch.tensor_token_ids->view(),
+                                                first * max_sequence_length,
+                                                last * max_sequence_length));
+        attention_mask.push_back(cudf::detail::slice(batch.tensor_attention_mask->view(),
+                                                     first * max_sequence_length,
+                                                     last * max_sequence_length));
+        metadata.push_back(
+          cudf::detail::slice(batch.tensor_metadata->view(), first * 3, last * 3));
+        remaining -= count;
+        batch_row += count;
+        if (batch_row == batch.nrows_tensor) {
+          ++batch_idx;
+          batch_row = 0;
+        }
+      }
+      results.push_back(tokenizer_result{nrows,
+                                         max_sequence_length,
+                                         cudf::detail::concatenate(token_ids, mr, stream),
+                                         cudf::detail::concatenate(attention_mask, mr, stream),
+                                         cudf::detail::concatenate(metadata, mr, stream)});
+    }
+    return results;
+  }
+
+  hashed_vocabulary vocab_table;
+  uint32_t const max_sequence_length;
+  uint32_t const stride;
+  bool const do_truncate;
+  uint32_t const max_num_strings;
+  uint32_t const max_num_chars;
+  uint32_t const max_rows_tensor;
+  cudaStream_t stream;
+  detail::wordpiece_tokenizer tokenizer;        // references vocab_table
+  rmm::device_uvector<uint32_t> batch_offsets;  // offsets of the current batch
+};
+
+subword_tokenizer::subword_tokenizer(hashed_vocabulary&& vocabulary_table,
+                                     uint32_t max_sequence_length,
+                                     uint32_t stride,
+                                     bool do_lower_case,
+                                     bool do_truncate,
+                                     uint32_t max_num_strings,
+                                     uint32_t max_num_chars,
+                                     uint32_t max_rows_tensor,
+                                     cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  CUDF_EXPECTS(max_sequence_length * max_rows_tensor < std::numeric_limits<cudf::size_type>::max(),
+               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
+  CUDF_EXPECTS(max_num_strings > 0 && max_num_chars > 0 && max_rows_tensor > 0,
+               "max_num_strings, max_num_chars and max_rows_tensor must be greater than 0");
+  _impl = std::make_unique<impl>(std::move(vocabulary_table),
+                                 max_sequence_length,
+                                 stride,
+                                 do_lower_case,
+                                 do_truncate,
+                                 max_num_strings,
+                                 max_num_chars,
+                                 max_rows_tensor,
+                                 stream);
+}
+
+subword_tokenizer::~subword_tokenizer()                             = default;
+subword_tokenizer::subword_tokenizer(subword_tokenizer&&)           = default;
+subword_tokenizer& subword_tokenizer::operator=(subword_tokenizer&&) = default;
+
+std::vector<tokenizer_result> subword_tokenizer::tokenize(cudf::strings_column_view const& strings,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->tokenize(strings, mr);
+}
+
 }  // namespace nvtext
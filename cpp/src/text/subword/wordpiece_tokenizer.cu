@@ -19,11 +19,16 @@
 #include <cudf/utilities/error.hpp>
 #include <nvtext/subword_tokenize.hpp>
 #include <text/subword/detail/hash_utils.cuh>
+#include <text/subword/detail/normalizer_utils.cuh>
 #include <text/subword/detail/tokenizer_utils.cuh>
 #include <text/subword/detail/wordpiece_tokenizer.hpp>
 
 #include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
+#include <cub/block/block_scan.cuh>
 #include <cub/device/device_scan.cuh>
 #include <cub/device/device_select.cuh>
 #include <iostream>
@@ -134,6 +139,98 @@ __global__ void mark_string_start_and_ends(uint32_t const* code_points,
   }
 }
 
+/**
+ * @brief The device data of the hashed vocabulary used to look up the tokens.
+ */
+struct vocabulary_view {
+  uint64_t const* hash_table;        ///< The flattened hash table with key, value pairs
+  uint64_t const* bin_coefficients;  ///< The hashing parameters of each hash bin
+  uint16_t const* bin_offsets;       ///< The start index of each bin in the hash table
+  uint16_t unk_token_id;             ///< The token id to be place for unknown tokens
+  uint32_t outer_hash_a_param;       ///< The a parameter for the outer hash
+  uint32_t outer_hash_b_param;       ///< The b parameter for the outer hash
+  uint16_t num_outer_bins;           ///< The number of bins for the outer hash
+};
+
+/**
+ * @brief Converts the word in `[token_start, token_end)` of `code_points` into token ids.
+ *
+ * The token ids are written to `token_ids` from index `token_start`, which holds at least one
+ * entry per code point of the word. The entries not holding a token id of the word are left
+ * with, or reset to, the max uint32_t value, which should be their initial value.
+ *
+ * @param code_points The code points of the normalized strings
+ * @param token_start Index of the first code point of the word
+ * @param token_end Index past the last code point of the word
+ * @param max_word_length The maximum length of a word. Any word longer than this length is
+ *        replaced by the unknown token.
+ * @param vocab The vocabulary to look up the tokens in
+ * @param token_ids The token ids indexed by code point
+ * @return The number of token ids of the word
+ */
+__device__ uint16_t tokenize_word(uint32_t const* code_points,
+                                  uint32_t const token_start,
+                                  uint32_t const token_end,
+                                  uint32_t const max_word_length,
+                                  vocabulary_view const& vocab,
+                                  uint32_t* token_ids)
+{
+  auto const word_length = token_end - token_start;
+
+  // The sdbm hash of "##"
+  constexpr uint32_t hashtag_hash = 2296000;
+  uint16_t num_values_tokenized   = 0;
+  // initialize start, end
+  uint32_t start = token_start;
+  uint32_t end   = token_end;
+
+  if (word_length > max_word_length) {
+    start                  = token_end;
+    num_values_tokenized   = 1;
+    token_ids[token_start] = vocab.unk_token_id;
+  }
+
+  while (start < token_end) {
+    end = token_end;
+    // init token_id to no token
+    int token_id = -1;
+    // compute current length
+    uint32_t const length = token_end - start;
+    uint64_t substr_hash =
+      sdbm_hash(code_points + start, length, start == token_start ? 0 : hashtag_hash);
+    while (start < end) {
+      token_id = retrieve(substr_hash,
+                          vocab.outer_hash_a_param,
+                          vocab.outer_hash_b_param,
+                          vocab.num_outer_bins,
+                          vocab.hash_table,
+                          vocab.bin_coefficients,
+                          vocab.bin_offsets);
+      if (token_id != -1) { break; }
+      --end;
+      // Pop off the last value from the substr hash
+      substr_hash = prev_sdbm_hash(substr_hash, code_points[end]);
+    }
+
+    if (token_id == -1) {
+      end      = token_end;
+      token_id = vocab.unk_token_id;
+      // We need to clean up the global array. This case is very uncommon.
+      //  Only 0.016% of words cannot be resolved to a token from the squad dev set.
+      for (uint32_t i = 1; i < num_values_tokenized; ++i) {
+        token_ids[token_start + i] = std::numeric_limits<uint32_t>::max();
+      }
+      num_values_tokenized = 0;
+    }
+
+    token_ids[token_start + num_values_tokenized] = token_id;
+    ++num_values_tokenized;
+    start = end;
+  }
+
+  return num_values_tokenized;
+}
+
 /**
  * @brief Converts words into token ids.
  *
@@ -202,61 +299,165 @@ __global__ void kernel_wordpiece_tokenizer(uint32_t const* code_points,
   // the default value. In a post processing step, all of these values will be removed.
   auto const token_start = word_starts[word_to_tokenize];
   auto const token_end   = word_ends[word_to_tokenize];
-  auto const word_length = token_end - token_start;
 
-  // The sdbm hash of "##"
-  constexpr uint32_t hashtag_hash = 2296000;
-  uint16_t num_values_tokenized   = 0;
-  // initialize start, end
-  uint32_t start = token_start;
-  uint32_t end   = token_end;
+  vocabulary_view const vocab{hash_table,
+                              bin_coefficients,
+                              bin_offsets,
+                              unk_token_id,
+                              outer_hash_a_param,
+                              outer_hash_b_param,
+                              num_outer_bins};
+  tokens_per_word[token_start] =
+    tokenize_word(code_points, token_start, token_end, max_word_length, vocab, token_ids);
+}
 
-  if (word_length > max_word_length) {
-    start                        = token_end;
-    num_values_tokenized         = 1;
-    token_ids[token_start]       = unk_token_id;
-    tokens_per_word[token_start] = num_values_tokenized;
-  }
+// Strings of up to this many bytes are normalized and tokenized in shared memory
+constexpr uint32_t MAX_FUSED_STRING_BYTES = 1024;
+constexpr uint32_t MAX_FUSED_CODE_POINTS  = MAX_NEW_CHARS * MAX_FUSED_STRING_BYTES;
+// The metadata of the code points below U+0400 is kept in shared memory, covering the Latin,
+// IPA and Greek characters that most text is made of
+constexpr uint32_t CACHED_CP_METADATA_SIZE = 1024;
+constexpr int FUSED_THREADS_PER_BLOCK      = 128;
 
-  while (start < token_end) {
-    end = token_end;
-    // init token_id to no token
-    int token_id = -1;
-    // compute current length
-    uint32_t const length = token_end - start;
-    uint64_t substr_hash =
-      sdbm_hash(code_points + start, length, start == token_start ? 0 : hashtag_hash);
-    while (start < end) {
-      token_id = retrieve(substr_hash,
-                          outer_hash_a_param,
-                          outer_hash_b_param,
-                          num_outer_bins,
-                          hash_table,
-                          bin_coefficients,
-                          bin_offsets);
-      if (token_id != -1) { break; }
-      --end;
-      // Pop off the last value from the substr hash
-      substr_hash = prev_sdbm_hash(substr_hash, code_points[end]);
+/**
+ * @brief Normalizes and tokenizes each string within a block.
+ *
+ * Each block loads the most used part of the code point metadata table into shared memory,
+ * then processes the strings `blockIdx.x`, `blockIdx.x + gridDim.x`, ... one at a time:
+ * the characters are normalized into code points in shared memory, the thread at the first
+ * code point of each word converts the word into token ids in shared memory, and the token ids
+ * are written in order to the output.
+ *
+ * Every string must have at most `MAX_FUSED_STRING_BYTES` bytes.
+ *
+ * @param strings The input strings, encoded in UTF-8.
+ * @param strings_offsets The `num_strings + 1` byte offsets of the strings in `strings`.
+ * @param num_strings The number of strings.
+ * @param cp_metadata The metadata lookup table for every unicode code point value.
+ * @param aux_table Aux table for mapping some multi-byte code point values.
+ * @param do_lower_case True if normalization should include lower-casing.
+ * @param vocab The vocabulary to look up the tokens in.
+ * @param max_word_length The maximum length of a word. Any word longer than this length is
+ *        replaced by the unknown token.
+ * @param[out] scattered_token_ids The token ids of each string are written from index
+ *        `MAX_NEW_CHARS * strings_offsets[i]`, which leaves room for one per code point.
+ * @param[out] token_counts The number of token ids of string `i` is written at index `i + 1`,
+ *        and 0 at index 0, so that an inclusive scan gives the token offsets of the strings.
+ */
+__global__ void __launch_bounds__(FUSED_THREADS_PER_BLOCK)
+  kernel_normalize_and_tokenize(unsigned char const* strings,
+                                uint32_t const* strings_offsets,
+                                uint32_t num_strings,
+                                codepoint_metadata_type const* cp_metadata,
+                                aux_codepoint_data_type const* aux_table,
+                                bool do_lower_case,
+                                vocabulary_view vocab,
+                                uint32_t max_word_length,
+                                uint32_t* scattered_token_ids,
+                                uint32_t* token_counts)
+{
+  using BlockScan = cub::BlockScan<uint32_t, FUSED_THREADS_PER_BLOCK>;
+  __shared__ typename BlockScan::TempStorage scan_storage;
+  __shared__ codepoint_metadata_type cached_metadata[CACHED_CP_METADATA_SIZE];
+  __shared__ uint32_t code_points[MAX_FUSED_CODE_POINTS];
+  __shared__ uint32_t token_ids[MAX_FUSED_CODE_POINTS];
+
+  for (auto idx = threadIdx.x; idx < CACHED_CP_METADATA_SIZE; idx += blockDim.x) {
+    cached_metadata[idx] = cp_metadata[idx];
+  }
+  if (blockIdx.x == 0 && threadIdx.x == 0) { token_counts[0] = 0; }
+  __syncthreads();
+
+  auto const total_bytes  = strings_offsets[num_strings];
+  auto const cached       = static_cast<codepoint_metadata_type const*>(cached_metadata);
+  auto const get_metadata = [cp_metadata, cached](uint32_t code_point) {
+    return code_point < CACHED_CP_METADATA_SIZE ? cached[code_point]
+                                                : __ldg(cp_metadata + code_point);
+  };
+  constexpr uint32_t no_token = std::numeric_limits<uint32_t>::max();
+
+  for (auto str_idx = blockIdx.x; str_idx < num_strings; str_idx += gridDim.x) {
+    auto const begin = strings_offsets[str_idx];
+    auto const end   = strings_offsets[str_idx + 1];
+
+    // Normalize the characters, keeping the code points in the order of the characters
+    uint32_t num_code_points = 0;
+    for (auto tile = begin; tile < end; tile += blockDim.x) {
+      auto const byte_idx = tile + threadIdx.x;
+      uint32_t replacement_code_points[MAX_NEW_CHARS];
+      uint32_t const num_new_chars = byte_idx < end ? normalize_character(strings,
+                                                                          total_bytes,
+                                                                          byte_idx,
+                                                                          get_metadata,
+                                                                          aux_table,
+                                                                          do_lower_case,
+                                                                          replacement_code_points)
+                                                    : 0;
+      uint32_t position, tile_code_points;
+      BlockScan(scan_storage).ExclusiveSum(num_new_chars, position, tile_code_points);
+      for (uint32_t i = 0; i < num_new_chars; ++i) {
+        code_points[num_code_points + position + i] = replacement_code_points[i];
+      }
+      num_code_points += tile_code_points;
+      __syncthreads();
     }
-
-    if (token_id == -1) {
-      end      = token_end;
-      token_id = unk_token_id;
-      // We need to clean up the global array. This case is very uncommon.
-      //  Only 0.016% of words cannot be resolved to a token from the squad dev set.
-      for (uint32_t i = 1; i < num_values_tokenized; ++i) {
-        token_ids[token_start + i] = std::numeric_limits<uint32_t>::max();
+    for (auto idx = threadIdx.x; idx < num_code_points; idx += blockDim.x) {
+      token_ids[idx] = no_token;
+    }
+    __syncthreads();
+
+    // Each word is tokenized by the thread of its first code point
+    for (auto idx = threadIdx.x; idx < num_code_points; idx += blockDim.x) {
+      if (code_points[idx] == SPACE_CODE_POINT) continue;
+      if (idx > 0 && code_points[idx - 1] != SPACE_CODE_POINT) continue;
+      auto word_end = idx + 1;
+      while (word_end < num_code_points && code_points[word_end] != SPACE_CODE_POINT) {
+        ++word_end;
       }
-      num_values_tokenized = 0;
+      tokenize_word(code_points, idx, word_end, max_word_length, vocab, token_ids);
     }
-
-    token_ids[token_start + num_values_tokenized] = token_id;
-    ++num_values_tokenized;
-    start = end;
+    __syncthreads();
+
+    // Write the token ids in the order of the code points
+    auto const output   = scattered_token_ids + MAX_NEW_CHARS * begin;
+    uint32_t num_tokens = 0;
+    for (uint32_t tile = 0; tile < num_code_points; tile += blockDim.x) {
+      auto const idx           = tile + threadIdx.x;
+      uint32_t const has_token = idx < num_code_points && token_ids[idx] != no_token;
+      uint32_t position, tile_tokens;
+      BlockScan(scan_storage).ExclusiveSum(has_token, position, tile_tokens);
+      if (has_token) { output[num_tokens + position] = token_ids[idx]; }
+      num_tokens += tile_tokens;
+      __syncthreads();
+    }
+    if (threadIdx.x == 0) { token_counts[str_idx + 1] = num_tokens; }
   }
+}
 
-  tokens_per_word[token_start] = num_values_tokenized;
+/**
+ * @brief Gathers the token ids written by `kernel_normalize_and_tokenize` contiguously.
+ *
+ * @param scattered_token_ids The token ids of each string, from `MAX_NEW_CHARS` times its byte
+ *        offset.
+ * @param strings_offsets The byte offsets of the strings.
+ * @param token_offsets The offsets of the token ids of the strings in `token_ids`.
+ * @param num_strings The number of strings.
+ * @param[out] token_ids The token ids of all the strings.
+ */
+__global__ void kernel_gather_string_tokens(uint32_t const* scattered_token_ids,
+                                            uint32_t const* strings_offsets,
+                                            uint32_t const* token_offsets,
+                                            uint32_t num_strings,
+                                            uint32_t* token_ids)
+{
+  for (auto str_idx = blockIdx.x; str_idx < num_strings; str_idx += gridDim.x) {
+    auto const input      = scattered_token_ids + MAX_NEW_CHARS * strings_offsets[str_idx];
+    auto const output     = token_ids + token_offsets[str_idx];
+    auto const num_tokens = token_offsets[str_idx + 1] - token_offsets[str_idx];
+    for (auto idx = threadIdx.x; idx < num_tokens; idx += blockDim.x) {
+      output[idx] = input[idx];
+    }
+  }
 }
 
 }  // namespace
@@ -280,6 +481,7 @@ wordpiece_tokenizer::wordpiece_tokenizer(hashed_vocabulary const& vocab_table,
     device_token_ids(MAX_NEW_CHARS * max_num_chars, stream),
     device_word_indices(2 * MAX_NEW_CHARS * max_num_chars, stream),
     device_tokens_per_word(0, stream),
+    device_token_offsets(max_num_strings + 1, stream),
     device_num_selected(1, stream),
     cub_temp_storage(0, stream)
 {
@@ -316,11 +518,70 @@ std::pair<uint32_t*, uint32_t*> wordpiece_tokenizer::tokenize(char const* d_stri
                                                               uint32_t num_strings,
                                                               cudaStream_t stream)
 {
+  if (num_strings > 0 && num_strings < device_token_offsets.size()) {
+    auto const max_string_bytes = thrust::transform_reduce(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<uint32_t>(0),
+      thrust::make_counting_iterator<uint32_t>(num_strings),
+      [d_offsets] __device__(uint32_t idx) { return d_offsets[idx + 1] - d_offsets[idx]; },
+      uint32_t{0},
+      thrust::maximum<uint32_t>());
+    if (max_string_bytes <= MAX_FUSED_STRING_BYTES) {
+      return tokenize_in_shared_memory(d_strings, d_offsets, num_strings, stream);
+    }
+  }
+
   auto cps_and_offsets = normalizer.normalize(d_strings, d_offsets, num_strings, stream);
   tokenize(cps_and_offsets.first, cps_and_offsets.second, stream);
   return std::make_pair(cps_and_offsets.first.gpu_ptr, cps_and_offsets.second.gpu_ptr);
 }
 
+std::pair<uint32_t*, uint32_t*> wordpiece_tokenizer::tokenize_in_shared_memory(
+  char const* d_strings, uint32_t const* d_offsets, uint32_t num_strings, cudaStream_t stream)
+{
+  int blocks_per_sm{-1};
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &blocks_per_sm, detail::kernel_normalize_and_tokenize, FUSED_THREADS_PER_BLOCK, 0));
+  int device_id{-1};
+  CUDA_TRY(cudaGetDevice(&device_id));
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device_id));
+  auto const num_blocks =
+    static_cast<int>(std::min<int64_t>(num_strings, int64_t{blocks_per_sm} * num_sms));
+
+  vocabulary_view const vocab{vocab_table.table->view().data<uint64_t>(),
+                              vocab_table.bin_coefficients->view().data<uint64_t>(),
+                              vocab_table.bin_offsets->view().data<uint16_t>(),
+                              vocab_table.unknown_token_id,
+                              vocab_table.outer_hash_a,
+                              vocab_table.outer_hash_b,
+                              vocab_table.num_bins};
+  uint32_t* token_offsets = device_token_offsets.data();
+  detail::kernel_normalize_and_tokenize<<<num_blocks, FUSED_THREADS_PER_BLOCK, 0, stream>>>(
+    reinterpret_cast<unsigned char const*>(d_strings),
+    d_offsets,
+    num_strings,
+    normalizer.get_cp_metadata(),
+    normalizer.get_aux_table(),
+    normalizer.is_lower_case(),
+    vocab,
+    max_word_length,
+    device_token_ids.data(),
+    token_offsets);
+  CHECK_CUDA(stream);
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         token_offsets,
+                         token_offsets + num_strings + 1,
+                         token_offsets);
+
+  // The word indices are only used by the two-stage path, so they hold the token ids here
+  uint32_t* token_ids = device_word_indices.data();
+  detail::kernel_gather_string_tokens<<<num_blocks, FUSED_THREADS_PER_BLOCK, 0, stream>>>(
+    device_token_ids.data(), d_offsets, token_offsets, num_strings, token_ids);
+  CHECK_CUDA(stream);
+  return std::make_pair(token_ids, token_offsets);
+}
+
 void wordpiece_tokenizer::tokenize(ptr_length_pair& cp_and_length,
                                    ptr_length_pair& offsets_and_length,
                                    cudaStream_t stream)
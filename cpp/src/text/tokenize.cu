@@ -17,8 +17,11 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -26,6 +29,7 @@
 #include <nvtext/tokenize.hpp>
 #include <text/utilities/tokenize_ops.cuh>
 
+#include <thrust/binary_search.h>
 #include <thrust/count.h>
 #include <thrust/transform.h>
 
@@ -221,6 +225,100 @@ std::unique_ptr<cudf::column> character_tokenize(cudf::strings_column_view const
                                    mr);
 }
 
+// create the sorted vocabulary and its token-ids
+std::unique_ptr<tokenize_vocabulary> load_vocabulary(cudf::strings_column_view const& input,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream)
+{
+  CUDF_EXPECTS(!input.has_nulls(), "vocabulary must not have nulls");
+  // the stable sort keeps the first of any duplicate strings in front
+  auto ids = cudf::detail::stable_sorted_order(
+    cudf::table_view({input.parent()}), {}, {}, mr, stream);
+  auto sorted = cudf::detail::gather(cudf::table_view({input.parent()}),
+                                     ids->view(),
+                                     cudf::detail::out_of_bounds_policy::NULLIFY,
+                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                     mr,
+                                     stream);
+  auto result        = std::make_unique<tokenize_vocabulary>();
+  result->vocabulary = std::move(sorted->release().front());
+  result->ids        = std::move(ids);
+  return result;
+}
+
+// tokenize and replace each token with its vocabulary token-id
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& input,
+                                                       tokenize_vocabulary const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::mr::device_memory_resource* mr,
+                                                       cudaStream_t stream)
+{
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  auto const strings_count = input.size();
+  auto execpol             = rmm::exec_policy(stream);
+  cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
+  auto strings_column = cudf::column_device_view::create(input.parent(), stream);
+  strings_tokenizer tokenizer{*strings_column, d_delimiter};
+
+  // the token counts become the offsets of the output lists
+  auto offsets   = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           strings_count + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                    d_offsets,
+                    tokenizer);
+  thrust::exclusive_scan(
+    execpol->on(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+  auto const total_tokens =
+    cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+
+  // locate the tokens
+  rmm::device_vector<string_index_pair> tokens(total_tokens);
+  tokenizer.d_offsets = d_offsets;
+  tokenizer.d_tokens  = tokens.data().get();
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     tokenizer);
+
+  // look up each token in the sorted vocabulary
+  auto token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                             total_tokens,
+                                             cudf::mask_state::UNALLOCATED,
+                                             stream,
+                                             mr);
+  auto vocabulary_column = cudf::column_device_view::create(vocabulary.vocabulary->view(), stream);
+  auto d_vocabulary      = *vocabulary_column;
+  auto d_ids             = vocabulary.ids->view().data<int32_t>();
+  thrust::transform(
+    execpol->on(stream),
+    tokens.begin(),
+    tokens.end(),
+    token_ids->mutable_view().data<int32_t>(),
+    [d_vocabulary, d_ids, default_id] __device__(string_index_pair const& token) {
+      cudf::string_view const d_token(token.first, token.second);
+      auto const begin = d_vocabulary.begin<cudf::string_view>();
+      auto const end   = d_vocabulary.end<cudf::string_view>();
+      auto const found = thrust::lower_bound(thrust::seq, begin, end, d_token);
+      return (found != end) && (*found == d_token) ? d_ids[thrust::distance(begin, found)]
+                                                   : default_id;
+    });
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(token_ids),
+                                 input.null_count(),
+                                 cudf::copy_bitmask(input.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -264,4 +362,21 @@ std::unique_ptr<cudf::column> character_tokenize(cudf::strings_column_view const
   return detail::character_tokenize(strings, 0, mr);
 }
 
+std::unique_ptr<tokenize_vocabulary> load_vocabulary(cudf::strings_column_view const& input,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::load_vocabulary(input, mr);
+}
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& input,
+                                                       tokenize_vocabulary const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_with_vocabulary(input, vocabulary, delimiter, default_id, mr);
+}
+
 }  // namespace nvtext
@@ -19,6 +19,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/udf.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -47,15 +48,11 @@ std::istream* headers_code(std::string filename, std::iostream& stream)
   return nullptr;
 }
 
-void unary_operation(mutable_column_view output,
-                     column_view input,
-                     const std::string& udf,
-                     data_type output_type,
-                     bool is_ptx,
-                     cudaStream_t stream)
+/**
+ * @brief Returns the CUDA source of the transform program of a PTX or CUDA unary function
+ */
+std::string unary_source(std::string const& udf, data_type output_type, bool is_ptx)
 {
-  std::string hash = "prog_transform" + std::to_string(std::hash<std::string>{}(udf));
-
   std::string cuda_source = code::kernel_header;
   if (is_ptx) {
     cuda_source += cudf::jit::parse_single_function_ptx(
@@ -64,7 +61,15 @@ void unary_operation(mutable_column_view output,
   } else {
     cuda_source += cudf::jit::parse_single_function_cuda(udf, "GENERIC_UNARY_OP") + code::kernel;
   }
+  return cuda_source;
+}
 
+void unary_operation(mutable_column_view output,
+                     column_view input,
+                     std::string const& hash,
+                     std::string const& cuda_source,
+                     cudaStream_t stream)
+{
   // Launch the jitify kernel
   cudf::jit::launcher(hash,
                       cuda_source,
@@ -78,6 +83,30 @@ void unary_operation(mutable_column_view output,
     .launch(output.size(), cudf::jit::get_data_ptr(output), cudf::jit::get_data_ptr(input));
 }
 
+void unary_operation(mutable_column_view output,
+                     column_view input,
+                     const std::string& udf,
+                     data_type output_type,
+                     bool is_ptx,
+                     cudaStream_t stream)
+{
+  std::string hash = "prog_transform" + std::to_string(std::hash<std::string>{}(udf));
+
+  unary_operation(output, input, hash, unary_source(udf, output_type, is_ptx), stream);
+}
+
+void unary_operation(mutable_column_view output,
+                     column_view input,
+                     compiled_udf const& udf,
+                     cudaStream_t stream)
+{
+  auto const& program = udf.program("transform", [&udf] {
+    return unary_source(udf.source(), udf.output_type(), udf.type() == udf_type::PTX);
+  });
+
+  unary_operation(output, input, program.first, program.second, stream);
+}
+
 }  // namespace jit
 }  // namespace transformation
 
@@ -104,6 +133,29 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::unique_ptr<column> transform(column_view const& input,
+                                  compiled_udf const& unary_udf,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_fixed_width(input.type()), "Unexpected non-fixed-width type.");
+
+  std::unique_ptr<column> output = make_fixed_width_column(unary_udf.output_type(),
+                                                           input.size(),
+                                                           copy_bitmask(input),
+                                                           cudf::UNKNOWN_NULL_COUNT,
+                                                           stream,
+                                                           mr);
+
+  if (input.size() == 0) { return output; }
+
+  mutable_column_view output_view = *output;
+
+  transformation::jit::unary_operation(output_view, input, unary_udf, stream);
+
+  return output;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -116,4 +168,12 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, mr);
 }
 
+std::unique_ptr<column> transform(column_view const& input,
+                                  compiled_udf const& unary_udf,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform(input, unary_udf, mr);
+}
+
 }  // namespace cudf
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -21,11 +22,141 @@
 #include <cudf/reshape.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/transpose.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/device_vector.hpp>
+
 namespace cudf {
 namespace detail {
+namespace {
+// Launch configuration for the tiled transpose
+constexpr size_type TRANSPOSE_TILE_DIM   = 32;
+constexpr size_type TRANSPOSE_BLOCK_ROWS = 8;
+
+/**
+ * @brief Transposes one tile of `TRANSPOSE_TILE_DIM` columns by `TRANSPOSE_TILE_DIM` rows.
+ *
+ * The tile is read along the rows of each input column and written along the
+ * elements of each output row so both the loads and the stores are coalesced.
+ * Element `row` of input column `col` is written to `row * num_columns + col`.
+ *
+ * The validity bits of each output row segment are collected with a warp ballot
+ * and or-ed into the zero-initialized output mask.
+ *
+ * @tparam T Unsigned integer type of the same size as the input element type.
+ * @tparam has_nulls Whether any input column has nulls.
+ */
+template <typename T, bool has_nulls>
+__global__ void transpose_tiled_kernel(T const* const* d_columns,
+                                       bitmask_type const* const* d_masks,
+                                       size_type const* d_mask_offsets,
+                                       size_type num_columns,
+                                       size_type num_rows,
+                                       T* d_output,
+                                       bitmask_type* d_output_mask)
+{
+  // the extra column avoids shared memory bank conflicts on the transposed reads
+  __shared__ T tile[TRANSPOSE_TILE_DIM][TRANSPOSE_TILE_DIM + 1];
+  __shared__ bool valid_tile[TRANSPOSE_TILE_DIM][TRANSPOSE_TILE_DIM + 1];
+
+  size_type const row_begin = blockIdx.x * TRANSPOSE_TILE_DIM;
+  size_type const col_begin = blockIdx.y * TRANSPOSE_TILE_DIM;
+
+  for (size_type idx = threadIdx.y; idx < TRANSPOSE_TILE_DIM; idx += TRANSPOSE_BLOCK_ROWS) {
+    auto const col = col_begin + idx;
+    auto const row = row_begin + static_cast<size_type>(threadIdx.x);
+    if (col < num_columns && row < num_rows) {
+      tile[idx][threadIdx.x] = d_columns[col][row];
+      if (has_nulls) {
+        valid_tile[idx][threadIdx.x] =
+          d_masks[col] == nullptr || bit_is_set(d_masks[col], d_mask_offsets[col] + row);
+      }
+    }
+  }
+  __syncthreads();
+
+  for (size_type idx = threadIdx.y; idx < TRANSPOSE_TILE_DIM; idx += TRANSPOSE_BLOCK_ROWS) {
+    auto const row       = row_begin + idx;
+    auto const col       = col_begin + static_cast<size_type>(threadIdx.x);
+    bool const in_bounds = row < num_rows && col < num_columns;
+    auto const position  = static_cast<size_type>(row * num_columns + col);
+    if (in_bounds) { d_output[position] = tile[threadIdx.x][idx]; }
+    if (has_nulls) {
+      // each warp holds one output row segment since the tile is one warp wide
+      auto const valid_bits = __ballot_sync(0xffffffff, in_bounds && valid_tile[threadIdx.x][idx]);
+      if (threadIdx.x == 0 && valid_bits != 0) {
+        auto const word  = word_index(position);
+        auto const shift = intra_word_index(position);
+        atomicOr(d_output_mask + word, valid_bits << shift);
+        if (shift > 0 && (valid_bits >> (detail::size_in_bits<bitmask_type>() - shift)) != 0) {
+          atomicOr(d_output_mask + word + 1,
+                   valid_bits >> (detail::size_in_bits<bitmask_type>() - shift));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Transposes a table of fixed-width columns of the same type with a tiled kernel.
+ *
+ * @tparam T Unsigned integer type of the same size as the column type.
+ */
+template <typename T>
+std::unique_ptr<column> transpose_fixed_width(table_view const& input,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  auto const num_columns = input.num_columns();
+  auto const num_rows    = input.num_rows();
+  CUDF_EXPECTS(static_cast<int64_t>(num_columns) * num_rows <
+                 static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+               "Transposed table size exceeds the column size limit");
+
+  std::vector<T const*> h_columns(num_columns);
+  std::vector<bitmask_type const*> h_masks(num_columns);
+  std::vector<size_type> h_mask_offsets(num_columns);
+  size_type null_count = 0;
+  for (size_type col = 0; col < num_columns; ++col) {
+    auto const& view    = input.column(col);
+    h_columns[col]      = view.data<T>();
+    h_masks[col]        = view.null_mask();
+    h_mask_offsets[col] = view.offset();
+    null_count += view.null_count();
+  }
+  bool const nullable = null_count > 0;
+
+  auto output = make_fixed_width_column(input.column(0).type(),
+                                        num_columns * num_rows,
+                                        nullable ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+
+  rmm::device_vector<T const*> d_columns(h_columns);
+  rmm::device_vector<bitmask_type const*> d_masks(h_masks);
+  rmm::device_vector<size_type> d_mask_offsets(h_mask_offsets);
+
+  dim3 const grid((num_rows + TRANSPOSE_TILE_DIM - 1) / TRANSPOSE_TILE_DIM,
+                  (num_columns + TRANSPOSE_TILE_DIM - 1) / TRANSPOSE_TILE_DIM);
+  dim3 const block(TRANSPOSE_TILE_DIM, TRANSPOSE_BLOCK_ROWS);
+  auto const kernel = nullable ? transpose_tiled_kernel<T, true> : transpose_tiled_kernel<T, false>;
+  kernel<<<grid, block, 0, stream>>>(d_columns.data().get(),
+                                      d_masks.data().get(),
+                                      d_mask_offsets.data().get(),
+                                      num_columns,
+                                      num_rows,
+                                      output->mutable_view().data<T>(),
+                                      output->mutable_view().null_mask());
+  CHECK_CUDA(stream);
+
+  if (nullable) { output->set_null_count(null_count); }
+  return output;
+}
+
+}  // namespace
+
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::mr::device_memory_resource* mr,
                                                          cudaStream_t stream)
@@ -42,7 +173,19 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
       input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
     "Column type mismatch");
 
-  auto output_column = cudf::interleave_columns(input, mr);
+  // Fixed-width columns are moved as raw elements of the same size
+  auto output_column = [&] {
+    if (is_fixed_width(dtype)) {
+      switch (size_of(dtype)) {
+        case 1: return transpose_fixed_width<uint8_t>(input, mr, stream);
+        case 2: return transpose_fixed_width<uint16_t>(input, mr, stream);
+        case 4: return transpose_fixed_width<uint32_t>(input, mr, stream);
+        case 8: return transpose_fixed_width<uint64_t>(input, mr, stream);
+        default: break;
+      }
+    }
+    return cudf::interleave_columns(input, mr);
+  }();
   auto one_iter      = thrust::make_counting_iterator<size_type>(1);
   auto splits_iter   = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
@@ -14,14 +14,19 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <unary/unary_ops.cuh>
 
 #include <algorithm>
 #include <cmath>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -391,6 +396,172 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   }
 }
 
+/**
+ * @brief Bitwise inverts integral values; other types are rejected before the kernel runs
+ */
+template <typename T>
+__device__ std::enable_if_t<std::is_integral<T>::value, T> invert_unary_op(T data)
+{
+  return DeviceInvert{}(data);
+}
+
+template <typename T>
+__device__ std::enable_if_t<!std::is_integral<T>::value, T> invert_unary_op(T data)
+{
+  return data;
+}
+
+/**
+ * @brief The operations of a fused chain, passed to the kernel by value
+ */
+struct unary_op_chain {
+  cudf::unary_op ops[max_fused_unary_ops];
+  size_type size;
+};
+
+template <typename T>
+__device__ T apply_unary_op(cudf::unary_op op, T data)
+{
+  switch (op) {
+    case cudf::unary_op::SIN: return DeviceSin{}(data);
+    case cudf::unary_op::COS: return DeviceCos{}(data);
+    case cudf::unary_op::TAN: return DeviceTan{}(data);
+    case cudf::unary_op::ARCSIN: return DeviceArcSin{}(data);
+    case cudf::unary_op::ARCCOS: return DeviceArcCos{}(data);
+    case cudf::unary_op::ARCTAN: return DeviceArcTan{}(data);
+    case cudf::unary_op::SINH: return DeviceSinH{}(data);
+    case cudf::unary_op::COSH: return DeviceCosH{}(data);
+    case cudf::unary_op::TANH: return DeviceTanH{}(data);
+    case cudf::unary_op::ARCSINH: return DeviceArcSinH{}(data);
+    case cudf::unary_op::ARCCOSH: return DeviceArcCosH{}(data);
+    case cudf::unary_op::ARCTANH: return DeviceArcTanH{}(data);
+    case cudf::unary_op::EXP: return DeviceExp{}(data);
+    case cudf::unary_op::LOG: return DeviceLog{}(data);
+    case cudf::unary_op::SQRT: return DeviceSqrt{}(data);
+    case cudf::unary_op::CBRT: return DeviceCbrt{}(data);
+    case cudf::unary_op::CEIL: return DeviceCeil{}(data);
+    case cudf::unary_op::FLOOR: return DeviceFloor{}(data);
+    case cudf::unary_op::ABS: return DeviceAbs{}(data);
+    case cudf::unary_op::RINT: return DeviceRInt{}(data);
+    case cudf::unary_op::BIT_INVERT: return invert_unary_op(data);
+    default: return data;
+  }
+}
+
+/**
+ * @brief Applies a chain of operations to a value, keeping the intermediate results in registers
+ *
+ * A trailing NOT of the chain is applied by `Negate`, since it changes the type to bool.
+ */
+template <typename T, typename Tout, bool Negate>
+struct fused_unary_fn {
+  unary_op_chain chain;
+
+  __device__ Tout operator()(T data) const
+  {
+    for (size_type i = 0; i < chain.size; ++i) { data = apply_unary_op(chain.ops[i], data); }
+    return Negate ? static_cast<Tout>(!data) : static_cast<Tout>(data);
+  }
+};
+
+struct FusedOpDispatcher {
+  template <typename T, typename std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(cudf::column_view const& input,
+                  unary_op_chain const& chain,
+                  bool negate,
+                  cudf::mutable_column_view& output,
+                  cudaStream_t stream)
+  {
+    if (negate) {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        input.begin<T>(),
+                        input.end<T>(),
+                        output.begin<bool>(),
+                        fused_unary_fn<T, bool, true>{chain});
+    } else {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        input.begin<T>(),
+                        input.end<T>(),
+                        output.begin<T>(),
+                        fused_unary_fn<T, T, false>{chain});
+    }
+  }
+
+  template <typename T, typename std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(cudf::column_view const& input,
+                  unary_op_chain const& chain,
+                  bool negate,
+                  cudf::mutable_column_view& output,
+                  cudaStream_t stream)
+  {
+    CUDF_FAIL("Unsupported datatype for operation");
+  }
+};
+
+/**
+ * @brief Validates a chain of operations on `type` and returns it without its trailing NOT, and
+ * whether there was one
+ */
+std::pair<unary_op_chain, bool> make_unary_op_chain(std::vector<cudf::unary_op> const& ops,
+                                                    data_type type)
+{
+  CUDF_EXPECTS(not ops.empty(), "Empty chain of unary operations");
+  CUDF_EXPECTS(ops.size() <= static_cast<std::size_t>(max_fused_unary_ops),
+               "Too many unary operations to fuse");
+
+  auto const negate = ops.back() == cudf::unary_op::NOT;
+  unary_op_chain chain{};
+  chain.size = static_cast<size_type>(ops.size()) - (negate ? 1 : 0);
+  for (size_type i = 0; i < chain.size; ++i) {
+    auto const op = ops[i];
+    CUDF_EXPECTS(op != cudf::unary_op::NOT, "NOT can only be the last fused unary operation");
+    CUDF_EXPECTS(op != cudf::unary_op::RINT or is_floating_point(type),
+                 "rint expects floating point values");
+    CUDF_EXPECTS(
+      op != cudf::unary_op::BIT_INVERT or (is_numeric(type) and !is_floating_point(type)),
+      "Unsupported datatype for operation");
+    chain.ops[i] = op;
+  }
+  return std::make_pair(chain, negate);
+}
+
+std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
+                                              std::vector<cudf::unary_op> const& ops,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  auto const chain       = make_unary_op_chain(ops, input.type());
+  auto const output_type = chain.second ? data_type{type_id::BOOL8} : input.type();
+
+  auto output = make_fixed_width_column(output_type,
+                                        input.size(),
+                                        copy_bitmask(input, stream, mr),
+                                        input.null_count(),
+                                        stream,
+                                        mr);
+  if (input.size() == 0) { return output; }
+
+  auto output_view = output->mutable_view();
+  cudf::type_dispatcher(
+    input.type(), FusedOpDispatcher{}, input, chain.first, chain.second, output_view, stream);
+  return output;
+}
+
+void unary_operation(cudf::column_view const& input,
+                     std::vector<cudf::unary_op> const& ops,
+                     cudf::mutable_column_view& output,
+                     cudaStream_t stream)
+{
+  auto const chain = make_unary_op_chain(ops, input.type());
+  CUDF_EXPECTS(output.size() == input.size(), "Size mismatch between input and output");
+  CUDF_EXPECTS(output.type() == (chain.second ? data_type{type_id::BOOL8} : input.type()),
+               "Unexpected output type for the chain of unary operations");
+  if (input.size() == 0) { return; }
+
+  cudf::type_dispatcher(
+    input.type(), FusedOpDispatcher{}, input, chain.first, chain.second, output, stream);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
@@ -401,4 +572,20 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   return detail::unary_operation(input, op, mr);
 }
 
+std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
+                                              std::vector<cudf::unary_op> const& ops,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::unary_operation(input, ops, mr);
+}
+
+void unary_operation(cudf::column_view const& input,
+                     std::vector<cudf::unary_op> const& ops,
+                     cudf::mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::unary_operation(input, ops, output);
+}
+
 }  // namespace cudf
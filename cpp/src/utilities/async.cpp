@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/async.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/sorting.hpp>
+
+namespace cudf {
+
+async_result<io::table_with_metadata> read_parquet_async(io::read_parquet_args const& args,
+                                                         cudaStream_t stream,
+                                                         rmm::mr::device_memory_resource* mr)
+{
+  return detail::launch_async(stream, [args, stream, mr]() {
+    return io::read_parquet(args, mr, stream);
+  });
+}
+
+async_result<io::table_with_metadata> read_orc_async(io::read_orc_args const& args,
+                                                     cudaStream_t stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  return detail::launch_async(stream, [args, stream, mr]() {
+    return io::read_orc(args, mr, stream);
+  });
+}
+
+async_result<io::table_with_metadata> read_csv_async(io::read_csv_args const& args,
+                                                     cudaStream_t stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  return detail::launch_async(stream, [args, stream, mr]() {
+    return io::read_csv(args, mr, stream);
+  });
+}
+
+async_result<std::unique_ptr<table>> inner_join_async(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  null_equality compare_nulls,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return detail::launch_async(
+    stream, [left, right, left_on, right_on, columns_in_common, compare_nulls, stream, mr]() {
+      return cudf::inner_join(
+        left, right, left_on, right_on, columns_in_common, compare_nulls, mr, stream);
+    });
+}
+
+async_result<std::unique_ptr<table>> sort_async(table_view const& input,
+                                                std::vector<order> const& column_order,
+                                                std::vector<null_order> const& null_precedence,
+                                                cudaStream_t stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  return detail::launch_async(stream, [input, column_order, null_precedence, stream, mr]() {
+    return cudf::sort(input, column_order, null_precedence, mr, stream);
+  });
+}
+
+async_result<std::vector<contiguous_split_result>> contiguous_split_async(
+  table_view const& input,
+  std::vector<size_type> const& splits,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return detail::launch_async(stream, [input, splits, stream, mr]() {
+    return detail::contiguous_split(input, splits, mr, stream);
+  });
+}
+
+async_result<std::pair<std::unique_ptr<table>, std::vector<groupby::aggregation_result>>>
+aggregate_async(groupby::groupby& grouper,
+                std::vector<groupby::aggregation_request> const& requests,
+                cudaStream_t stream,
+                rmm::mr::device_memory_resource* mr)
+{
+  // aggregation requests own their aggregations, so they are referred to instead of copied
+  return detail::launch_async(stream, [&grouper, &requests, stream, mr]() {
+    return grouper.aggregate(requests, mr, stream);
+  });
+}
+
+}  // namespace cudf
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/launch_tuning.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/launch_tuning.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cudf {
+namespace {
+/**
+ * @brief Returns the mode set by the `LIBCUDF_LAUNCH_TUNING` variable, `TABLE` by default
+ */
+launch_tuning_mode environment_mode()
+{
+  auto const mode = std::getenv("LIBCUDF_LAUNCH_TUNING");
+  return mode != nullptr && std::strcmp(mode, "AUTOTUNE") == 0 ? launch_tuning_mode::AUTOTUNE
+                                                               : launch_tuning_mode::TABLE;
+}
+
+std::atomic<launch_tuning_mode>& current_mode()
+{
+  static std::atomic<launch_tuning_mode> mode{environment_mode()};
+  return mode;
+}
+
+}  // namespace
+
+namespace detail {
+namespace {
+constexpr auto num_tuned_parameters =
+  static_cast<std::size_t>(tuned_parameter::NUM_TUNED_PARAMETERS);
+
+// Launches of less work are dominated by their latency, so their timings are not comparable
+constexpr int64_t min_timed_work_size = 1 << 16;
+
+// Timings of each candidate averaged to choose the fastest
+constexpr int timings_per_candidate = 3;
+
+/**
+ * @brief The candidate values of a tuned parameter, and the value used on each architecture
+ */
+struct tuned_parameter_info {
+  char const* name;
+  std::vector<int> candidates;
+  int default_value;
+  /// Value by compute capability (major * 10 + minor), used on that architecture and the newer
+  /// ones up to the next entry; `default_value` is used on the older ones
+  std::map<int, int> arch_values;
+};
+
+/**
+ * @brief Returns the tuning table, indexed by `tuned_parameter`
+ *
+ * The default values are the launch parameters the kernels were tuned with on Pascal and Volta.
+ * Autotuning measures the candidates on the device at hand.
+ */
+std::array<tuned_parameter_info, num_tuned_parameters> const& tuning_table()
+{
+  static std::array<tuned_parameter_info, num_tuned_parameters> const table{{
+    {"join_build_block_size", {128, 256, 512}, 128, {}},
+    {"join_probe_block_size", {128, 256, 512}, 128, {}},
+    // The copy kernel of the shared memory histograms uses 32KB for the rows of a block plus 8
+    // bytes per partition, which must stay under the 48KB a block can use without opting in.
+    // The 164KB of shared memory of an Ampere SM keep three such blocks resident up to 1536
+    // partitions, where Turing only keeps one.
+    {"hash_partition_max_shared_partitions", {256, 512, 1024, 1536}, 1024, {{80, 1536}}},
+  }};
+  return table;
+}
+
+/**
+ * @brief A pending timing of the launches of a scope
+ */
+struct launch_timing {
+  std::size_t candidate;
+  int64_t work_size;
+  cudaEvent_t start;
+  cudaEvent_t stop;
+};
+
+/**
+ * @brief The values of a tuned parameter on a device, and its timings while it is autotuned
+ */
+struct tuned_parameter_state {
+  int table_value{};
+  int pinned_value{-1};
+  int tuned_value{-1};
+  std::vector<int> started;  ///< Timings started per candidate, pending or complete
+  std::vector<int> completed;
+  std::vector<double> elapsed_ms;
+  std::vector<double> work_size;
+  std::vector<launch_timing> pending;
+};
+
+/**
+ * @brief Process-wide state of the tuned parameters of every device
+ */
+class launch_tuner {
+ public:
+  /**
+   * @brief Returns the tuner, which is never destroyed since pending timings hold CUDA events
+   * that cannot be destroyed once the CUDA context is torn down at exit
+   */
+  static launch_tuner& get()
+  {
+    static auto tuner = new launch_tuner;
+    return *tuner;
+  }
+
+  /**
+   * @brief Returns the value to use, along with the index of the candidate to time or -1
+   */
+  std::pair<int, int> choose(int device, tuned_parameter parameter, int64_t work_size)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& state = get_state(device, parameter);
+    if (state.pinned_value >= 0) { return {state.pinned_value, -1}; }
+    if (get_launch_tuning_mode() != launch_tuning_mode::AUTOTUNE) {
+      return {state.table_value, -1};
+    }
+    collect(state, parameter);
+    if (state.tuned_value >= 0) { return {state.tuned_value, -1}; }
+    if (work_size < min_timed_work_size) { return {state.table_value, -1}; }
+
+    // Time the candidate with the fewest timings, unless all timings are started
+    auto const next = std::min_element(state.started.begin(), state.started.end());
+    if (*next >= timings_per_candidate) { return {state.table_value, -1}; }
+    ++*next;
+    auto const candidate = static_cast<int>(next - state.started.begin());
+    return {info(parameter).candidates[candidate], candidate};
+  }
+
+  /**
+   * @brief Adds the timing of the launches of a scope, which is abandoned if `stop` is null
+   */
+  void finish(int device,
+              tuned_parameter parameter,
+              int candidate,
+              int64_t work_size,
+              cudaEvent_t start,
+              cudaEvent_t stop)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& state = get_state(device, parameter);
+    if (stop == nullptr) {
+      --state.started[candidate];
+      return;
+    }
+    state.pending.push_back({static_cast<std::size_t>(candidate), work_size, start, stop});
+  }
+
+  std::map<std::string, int> values(int device)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto const autotune = get_launch_tuning_mode() == launch_tuning_mode::AUTOTUNE;
+    std::map<std::string, int> values;
+    for (std::size_t i = 0; i < num_tuned_parameters; ++i) {
+      auto const parameter = static_cast<tuned_parameter>(i);
+      auto& state          = get_state(device, parameter);
+      if (autotune) { collect(state, parameter); }
+      auto value = state.table_value;
+      if (autotune and state.tuned_value >= 0) { value = state.tuned_value; }
+      if (state.pinned_value >= 0) { value = state.pinned_value; }
+      values[info(parameter).name] = value;
+    }
+    return values;
+  }
+
+  void pin(int device, std::string const& name, int value)
+  {
+    auto const& table = tuning_table();
+    auto const found  = std::find_if(
+      table.begin(), table.end(), [&name](auto const& entry) { return name == entry.name; });
+    CUDF_EXPECTS(found != table.end(), "Unknown launch parameter " + name);
+    auto const& candidates = found->candidates;
+    auto const is_candidate =
+      std::find(candidates.begin(), candidates.end(), value) != candidates.end();
+    CUDF_EXPECTS(value == -1 or is_candidate, "Invalid value for launch parameter " + name);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto const parameter = static_cast<tuned_parameter>(found - table.begin());
+    get_state(device, parameter).pinned_value = value;
+  }
+
+ private:
+  static tuned_parameter_info const& info(tuned_parameter parameter)
+  {
+    return tuning_table()[static_cast<std::size_t>(parameter)];
+  }
+
+  /**
+   * @brief Returns the state of `parameter` on `device`, initialized from the tuning table on
+   * first use
+   */
+  tuned_parameter_state& get_state(int device, tuned_parameter parameter)
+  {
+    auto& states = states_[device];
+    if (states.empty()) {
+      int major{}, minor{};
+      CUDA_TRY(cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device));
+      CUDA_TRY(cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device));
+      auto const arch = major * 10 + minor;
+
+      std::vector<tuned_parameter_state> initial(num_tuned_parameters);
+      for (std::size_t i = 0; i < num_tuned_parameters; ++i) {
+        auto const& entry = tuning_table()[i];
+
+        // the value of the newest architecture up to the one of the device
+        auto const newer       = entry.arch_values.upper_bound(arch);
+        initial[i].table_value = newer == entry.arch_values.begin() ? entry.default_value
+                                                                    : std::prev(newer)->second;
+
+        auto const num_candidates = entry.candidates.size();
+        initial[i].started.assign(num_candidates, 0);
+        initial[i].completed.assign(num_candidates, 0);
+        initial[i].elapsed_ms.assign(num_candidates, 0);
+        initial[i].work_size.assign(num_candidates, 0);
+      }
+      states = std::move(initial);
+    }
+    return states[static_cast<std::size_t>(parameter)];
+  }
+
+  /**
+   * @brief Adds the pending timings that completed, and chooses the fastest candidate once all
+   * of them are timed
+   */
+  void collect(tuned_parameter_state& state, tuned_parameter parameter)
+  {
+    auto const complete = [&state](launch_timing const& timing) {
+      auto const status = cudaEventQuery(timing.stop);
+      if (status == cudaErrorNotReady) { return false; }
+      float elapsed_ms{};
+      if (status == cudaSuccess and
+          cudaEventElapsedTime(&elapsed_ms, timing.start, timing.stop) == cudaSuccess) {
+        state.elapsed_ms[timing.candidate] += elapsed_ms;
+        state.work_size[timing.candidate] += static_cast<double>(timing.work_size);
+        ++state.completed[timing.candidate];
+      } else {
+        // the timing failed, so the candidate is timed again
+        --state.started[timing.candidate];
+      }
+      cudaEventDestroy(timing.start);
+      cudaEventDestroy(timing.stop);
+      return true;
+    };
+    state.pending.erase(std::remove_if(state.pending.begin(), state.pending.end(), complete),
+                        state.pending.end());
+
+    if (state.tuned_value >= 0 or
+        std::any_of(state.completed.begin(), state.completed.end(), [](int completed) {
+          return completed < timings_per_candidate;
+        })) {
+      return;
+    }
+    std::size_t fastest = 0;
+    for (std::size_t i = 1; i < state.completed.size(); ++i) {
+      if (state.elapsed_ms[i] / state.work_size[i] <
+          state.elapsed_ms[fastest] / state.work_size[fastest]) {
+        fastest = i;
+      }
+    }
+    state.tuned_value = info(parameter).candidates[fastest];
+  }
+
+  std::mutex mutex_;
+  std::map<int, std::vector<tuned_parameter_state>> states_;
+};
+
+}  // namespace
+
+tuned_launch_scope::tuned_launch_scope(tuned_parameter parameter,
+                                       int64_t work_size,
+                                       cudaStream_t stream)
+  : parameter_(parameter), work_size_(work_size), stream_(stream)
+{
+  CUDA_TRY(cudaGetDevice(&device_));
+  std::tie(value_, candidate_) = launch_tuner::get().choose(device_, parameter, work_size);
+  if (candidate_ < 0) { return; }
+  if (cudaEventCreate(&start_) != cudaSuccess or cudaEventRecord(start_, stream_) != cudaSuccess) {
+    if (start_ != nullptr) { cudaEventDestroy(start_); }
+    launch_tuner::get().finish(device_, parameter_, candidate_, work_size_, nullptr, nullptr);
+    candidate_ = -1;
+  }
+}
+
+tuned_launch_scope::~tuned_launch_scope()
+{
+  if (candidate_ < 0) { return; }
+  // Errors cannot be thrown from the destructor, so the timing is abandoned if it fails
+  cudaEvent_t stop{};
+  if (std::uncaught_exception() or cudaEventCreate(&stop) != cudaSuccess or
+      cudaEventRecord(stop, stream_) != cudaSuccess) {
+    if (stop != nullptr) { cudaEventDestroy(stop); }
+    cudaEventDestroy(start_);
+    start_ = nullptr;
+    stop   = nullptr;
+  }
+  try {
+    launch_tuner::get().finish(device_, parameter_, candidate_, work_size_, start_, stop);
+  } catch (...) {
+  }
+}
+
+}  // namespace detail
+
+void set_launch_tuning_mode(launch_tuning_mode mode) { current_mode().store(mode); }
+
+launch_tuning_mode get_launch_tuning_mode() { return current_mode().load(); }
+
+std::map<std::string, int> get_launch_parameters()
+{
+  int device{};
+  CUDA_TRY(cudaGetDevice(&device));
+  return detail::launch_tuner::get().values(device);
+}
+
+void set_launch_parameter(std::string const& name, int value)
+{
+  int device{};
+  CUDA_TRY(cudaGetDevice(&device));
+  detail::launch_tuner::get().pin(device, name, value);
+}
+
+}  // namespace cudf
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/metrics.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/metrics.hpp>
+
+#include <atomic>
+#include <exception>
+
+namespace cudf {
+namespace {
+std::atomic<metrics_sink*>& current_sink()
+{
+  static std::atomic<metrics_sink*> sink{nullptr};
+  return sink;
+}
+
+}  // namespace
+
+void set_metrics_sink(metrics_sink* sink) { current_sink().store(sink); }
+
+metrics_sink* get_metrics_sink() { return current_sink().load(); }
+
+namespace detail {
+operation_metrics_scope::operation_metrics_scope(char const* operation, cudaStream_t stream)
+  : sink_(get_metrics_sink()), stream_(stream)
+{
+  if (not enabled()) { return; }
+  metrics_.operation = operation;
+  CUDA_TRY(cudaEventCreate(&start_));
+  CUDA_TRY(cudaEventCreate(&stop_));
+  CUDA_TRY(cudaEventRecord(start_, stream_));
+}
+
+operation_metrics_scope::~operation_metrics_scope()
+{
+  if (not enabled()) { return; }
+  // Errors cannot be thrown from the destructor, so the metrics are dropped if the timing fails
+  if (not std::uncaught_exception() and cudaEventRecord(stop_, stream_) == cudaSuccess and
+      cudaEventSynchronize(stop_) == cudaSuccess) {
+    cudaEventElapsedTime(&metrics_.elapsed_ms, start_, stop_);
+    try {
+      sink_->record(metrics_);
+    } catch (...) {
+    }
+  }
+  cudaEventDestroy(start_);
+  cudaEventDestroy(stop_);
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+using namespace cudf::test;
+using cudf::ast::ast_operator;
+using cudf::ast::column_reference;
+using cudf::ast::operation;
+using cudf::ast::table_reference;
+
+struct ExpressionTest : public BaseFixture {
+};
+
+TEST_F(ExpressionTest, FusedArithmeticAndComparison)
+{
+  auto a     = fixed_width_column_wrapper<int32_t>{1, 2, 3, 4};
+  auto b     = fixed_width_column_wrapper<int32_t>{5, 6, 7, 8};
+  auto c     = fixed_width_column_wrapper<int32_t>{{1, 1, 1, 1}, {1, 1, 0, 1}};
+  auto d     = fixed_width_column_wrapper<int32_t>{10, 10, 10, 40};
+  auto table = cudf::table_view{{a, b, c, d}};
+
+  // (a * b + c) > d
+  auto col_a   = column_reference(0);
+  auto col_b   = column_reference(1);
+  auto col_c   = column_reference(2);
+  auto col_d   = column_reference(3);
+  auto ab      = operation(ast_operator::MUL, col_a, col_b);
+  auto abc     = operation(ast_operator::ADD, ab, col_c);
+  auto greater = operation(ast_operator::GREATER, abc, col_d);
+
+  auto sum          = cudf::ast::compute_column(table, abc);
+  auto expected_sum = fixed_width_column_wrapper<int32_t>{{6, 13, 0, 33}, {1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sum, sum->view());
+
+  auto result   = cudf::ast::compute_column(table, greater);
+  auto expected = fixed_width_column_wrapper<bool>{{false, true, false, false}, {1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(ExpressionTest, MixedTypesAndLiterals)
+{
+  auto a     = fixed_width_column_wrapper<int16_t>{1, -2, 3};
+  auto b     = fixed_width_column_wrapper<double>{0.5, 0.5, 0.25};
+  auto table = cudf::table_view{{a, b}};
+
+  // a * 2 + b, in INT64 then FLOAT64
+  auto two    = cudf::numeric_scalar<int64_t>(2);
+  auto col_a  = column_reference(0);
+  auto col_b  = column_reference(1);
+  auto lit    = cudf::ast::literal(two);
+  auto scaled = operation(ast_operator::MUL, col_a, lit);
+  auto sum    = operation(ast_operator::ADD, scaled, col_b);
+
+  auto result   = cudf::ast::compute_column(table, sum);
+  auto expected = fixed_width_column_wrapper<double>{2.5, -3.5, 6.25};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(ExpressionTest, NullsAndDivisionByZero)
+{
+  auto a     = fixed_width_column_wrapper<int32_t>{{7, 8, 9}, {1, 0, 1}};
+  auto b     = fixed_width_column_wrapper<int32_t>{2, 2, 0};
+  auto table = cudf::table_view{{a, b}};
+
+  auto col_a    = column_reference(0);
+  auto col_b    = column_reference(1);
+  auto quotient = operation(ast_operator::DIV, col_a, col_b);
+  auto result   = cudf::ast::compute_column(table, quotient);
+  auto expected = fixed_width_column_wrapper<int32_t>{{3, 0, 0}, {1, 0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  auto is_null       = operation(ast_operator::IS_NULL, quotient);
+  auto null_result   = cudf::ast::compute_column(table, is_null);
+  auto null_expected = fixed_width_column_wrapper<bool>{false, true, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(null_expected, null_result->view());
+}
+
+TEST_F(ExpressionTest, JoinCondition)
+{
+  auto left_col  = fixed_width_column_wrapper<int64_t>{10, 20, 30};
+  auto right_col = fixed_width_column_wrapper<int64_t>{15, 25};
+  auto left      = cudf::table_view{{left_col}};
+  auto right     = cudf::table_view{{right_col}};
+  auto left_map  = fixed_width_column_wrapper<cudf::size_type>{0, 1, 2, 2};
+  auto right_map = fixed_width_column_wrapper<cudf::size_type>{0, 0, 1, cudf::join_no_match};
+
+  auto left_value  = column_reference(0, table_reference::LEFT);
+  auto right_value = column_reference(0, table_reference::RIGHT);
+  auto condition   = operation(ast_operator::LESS, left_value, right_value);
+
+  auto result   = cudf::ast::compute_column(left, right, left_map, right_map, condition);
+  auto expected = fixed_width_column_wrapper<bool>{{true, false, false, false}, {1, 1, 1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(ExpressionTest, InvalidExpressions)
+{
+  auto a     = fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto flag  = fixed_width_column_wrapper<bool>{true, false, true};
+  auto table = cudf::table_view{{a, flag}};
+
+  auto col_a      = column_reference(0);
+  auto col_flag   = column_reference(1);
+  auto out_range  = column_reference(2);
+  auto right_ref  = column_reference(0, table_reference::RIGHT);
+  auto mixed_and  = operation(ast_operator::LOGICAL_AND, col_a, col_flag);
+  auto mixed_less = operation(ast_operator::LESS, col_a, col_flag);
+
+  EXPECT_THROW(operation(ast_operator::NOT, col_a, col_flag), cudf::logic_error);
+  EXPECT_THROW(cudf::ast::compute_column(table, out_range), cudf::logic_error);
+  EXPECT_THROW(cudf::ast::compute_column(table, right_ref), cudf::logic_error);
+  EXPECT_THROW(cudf::ast::compute_column(table, mixed_and), cudf::logic_error);
+  EXPECT_THROW(cudf::ast::compute_column(table, mixed_less), cudf::logic_error);
+
+  // Every level of a right-deep chain keeps one more value on the stack
+  std::vector<std::unique_ptr<operation>> chain;
+  chain.push_back(std::make_unique<operation>(ast_operator::ADD, col_a, col_a));
+  for (int i = 0; i < 32; ++i) {
+    chain.push_back(std::make_unique<operation>(ast_operator::ADD, col_a, *chain.back()));
+  }
+  EXPECT_THROW(cudf::ast::compute_column(table, *chain.back()), cudf::logic_error);
+}
+
+TEST_F(ExpressionTest, Filter)
+{
+  auto a     = fixed_width_column_wrapper<int32_t>{{5, 1, 7, 3, 9}, {1, 1, 1, 0, 1}};
+  auto names = strings_column_wrapper{"e", "a", "g", "c", "i"};
+  auto table = cudf::table_view{{a, names}};
+
+  // a > 4 AND a != 7
+  auto four      = cudf::numeric_scalar<int32_t>(4);
+  auto seven     = cudf::numeric_scalar<int32_t>(7);
+  auto col_a     = column_reference(0);
+  auto lit_four  = cudf::ast::literal(four);
+  auto lit_seven = cudf::ast::literal(seven);
+  auto greater   = operation(ast_operator::GREATER, col_a, lit_four);
+  auto not_seven = operation(ast_operator::NOT_EQUAL, col_a, lit_seven);
+  auto predicate = operation(ast_operator::LOGICAL_AND, greater, not_seven);
+
+  auto result         = cudf::ast::filter(table, predicate);
+  auto expected_a     = fixed_width_column_wrapper<int32_t>{5, 9};
+  auto expected_names = strings_column_wrapper{"e", "i"};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_a, result->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_names, result->get_column(1));
+
+  EXPECT_THROW(cudf::ast::filter(table, col_a), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -23,6 +23,7 @@
 
 #include <cudf/binaryop.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/utilities/jit_cache.hpp>
 #include "cudf/types.hpp"
 #include "cudf/utilities/type_dispatcher.hpp"
 #include "tests/utilities/column_utilities.hpp"
@@ -214,6 +215,61 @@ TEST_F(BinaryOperationIntegrationTest, Mul_Vector_Vector_SI64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, MUL());
 }
 
+TEST_F(BinaryOperationIntegrationTest, KernelCacheStats_Sub_Vector_Vector_SI64_SI16_SI16)
+{
+  using TypeOut = int64_t;
+  using TypeLhs = int16_t;
+  using TypeRhs = int16_t;
+
+  using SUB = cudf::library::operation::Sub<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100);
+  auto rhs = make_random_wrapped_column<TypeRhs>(100);
+
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::SUB, data_type(type_to_id<TypeOut>()));
+  auto const before = cudf::jit::get_kernel_cache_stats();
+  out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::SUB, data_type(type_to_id<TypeOut>()));
+  auto const after = cudf::jit::get_kernel_cache_stats();
+
+  // the program and the kernel are both found in memory
+  EXPECT_EQ(before.memory_hits + 2, after.memory_hits);
+  EXPECT_EQ(before.misses, after.misses);
+  EXPECT_GT(after.memory_bytes, 0u);
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, SUB());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Precompiled_Add_Less_Same_Types_Skip_JIT)
+{
+  using TypeOut = int32_t;
+  using TypeLhs = int32_t;
+  using TypeRhs = int32_t;
+
+  using ADD  = cudf::library::operation::Add<TypeOut, TypeLhs, TypeRhs>;
+  using LESS = cudf::library::operation::Less<bool, double, double>;
+
+  auto lhs      = make_random_wrapped_column<TypeLhs>(1000);
+  auto rhs      = make_random_wrapped_column<TypeRhs>(1000);
+  auto lhs_fp64 = make_random_wrapped_scalar<double>();
+  auto rhs_fp64 = make_random_wrapped_column<double>(1000);
+
+  auto const before = cudf::jit::get_kernel_cache_stats();
+  auto sum =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, data_type(type_to_id<TypeOut>()));
+  auto less = cudf::binary_operation(
+    lhs_fp64, rhs_fp64, cudf::binary_operator::LESS, data_type(type_id::BOOL8));
+  auto const after = cudf::jit::get_kernel_cache_stats();
+
+  // same-type operations never look up a JIT kernel
+  EXPECT_EQ(before.memory_hits, after.memory_hits);
+  EXPECT_EQ(before.misses, after.misses);
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*sum, lhs, rhs, ADD());
+  ASSERT_BINOP<bool, double, double>(*less, lhs_fp64, rhs_fp64, LESS());
+}
+
 TEST_F(BinaryOperationIntegrationTest, Mul_Vector_Vector_SI64_FP32_FP32)
 {
   using TypeOut = int64_t;
@@ -2047,6 +2103,31 @@ TEST_F(BinaryOperationIntegrationTest, ATan2_Vector_Vector_FP64_SI32_SI64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ATAN2(), NearEqualComparator<TypeOut>{2});
 }
 
+TEST_F(BinaryOperationIntegrationTest, Precompile_Mul_Vector_Vector_SI64_SI16_SI32)
+{
+  using TypeOut = int64_t;
+  using TypeLhs = int16_t;
+  using TypeRhs = int32_t;
+
+  using MUL = cudf::library::operation::Mul<TypeOut, TypeLhs, TypeRhs>;
+
+  cudf::precompile_binary_operation(data_type(type_to_id<TypeLhs>()),
+                                    data_type(type_to_id<TypeRhs>()),
+                                    cudf::binary_operator::MUL,
+                                    data_type(type_to_id<TypeOut>()));
+  auto const bundle = ::testing::TempDir() + "binop_kernel_bundle";
+  cudf::jit::write_kernel_bundle(bundle);
+  EXPECT_TRUE(cudf::jit::load_kernel_bundle(bundle));
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(10000);
+  auto rhs = make_random_wrapped_column<TypeRhs>(10000);
+
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::MUL, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, MUL());
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -2113,6 +2194,35 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointBinaryOpMultiply)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_col, result->view());
 }
 
+TYPED_TEST(FixedPointTestBothReps, FixedPointBinaryOpDivide)
+{
+  using namespace numeric;
+  using decimalXX = TypeParam;
+
+  auto const sz = std::size_t{1000};
+
+  auto vec1       = std::vector<decimalXX>(sz);
+  auto const vec2 = std::vector<decimalXX>(sz, decimalXX{2, scale_type{-1}});
+  auto expected   = std::vector<decimalXX>(sz);
+
+  std::iota(std::begin(vec1), std::end(vec1), decimalXX{});
+
+  std::transform(std::cbegin(vec1),
+                 std::cend(vec1),
+                 std::cbegin(vec2),
+                 std::begin(expected),
+                 std::divides<decimalXX>());
+
+  auto const lhs          = wrapper<decimalXX>(vec1.begin(), vec1.end());
+  auto const rhs          = wrapper<decimalXX>(vec2.begin(), vec2.end());
+  auto const expected_col = wrapper<decimalXX>(expected.begin(), expected.end());
+
+  auto const result = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::DIV, static_cast<cudf::column_view>(lhs).type());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_col, result->view());
+}
+
 TYPED_TEST(FixedPointTestBothReps, FixedPointBinaryOpEqualSimple)
 {
   using namespace numeric;
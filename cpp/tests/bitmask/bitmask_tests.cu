@@ -16,6 +16,7 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <tests/utilities/base_fixture.hpp>
@@ -25,6 +26,7 @@
 
 #include <thrust/device_ptr.h>
 #include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
 
 struct BitmaskUtilitiesTest : public cudf::test::BaseFixture {
 };
@@ -496,4 +498,94 @@ TEST_F(CopyBitmaskTest, TestCopyColumnViewVectorDiscontiguous)
     concatenated_bitmask.data(), gold_mask.data(), num_elements / CHAR_BIT);
 }
 
+struct BitmaskBinopTest : public cudf::test::BaseFixture, cudf::test::UniformRandomGenerator<int> {
+  BitmaskBinopTest() : cudf::test::UniformRandomGenerator<int>{0, 1} {}
+
+  // Returns three columns of `num_rows` rows with random validities and their gold AND and OR
+  auto make_input(cudf::size_type num_rows)
+  {
+    std::vector<thrust::host_vector<int>> validities(3, thrust::host_vector<int>(num_rows));
+    thrust::host_vector<int> and_bits(num_rows, 1);
+    thrust::host_vector<int> or_bits(num_rows, 0);
+    for (auto &validity : validities) {
+      for (cudf::size_type i = 0; i < num_rows; ++i) {
+        validity[i] = this->generate();
+        and_bits[i] = and_bits[i] and validity[i];
+        or_bits[i]  = or_bits[i] or validity[i];
+      }
+    }
+
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    for (auto const &validity : validities) {
+      columns.push_back(cudf::test::fixed_width_column_wrapper<int32_t>(
+                          thrust::make_counting_iterator(0),
+                          thrust::make_counting_iterator(num_rows),
+                          validity.begin())
+                          .release());
+    }
+    return std::make_tuple(std::move(columns), and_bits, or_bits);
+  }
+};
+
+TEST_F(BitmaskBinopTest, AlignedMasks)
+{
+  cudf::size_type num_rows = 1000;
+  auto input               = make_input(num_rows);
+  auto &columns            = std::get<0>(input);
+  cudf::table_view view{{columns[0]->view(), columns[1]->view(), columns[2]->view()}};
+
+  auto const &and_bits = std::get<1>(input);
+  auto const &or_bits  = std::get<2>(input);
+  auto gold_and        = cudf::test::detail::make_null_mask(and_bits.begin(), and_bits.end());
+  auto gold_or         = cudf::test::detail::make_null_mask(or_bits.begin(), or_bits.end());
+
+  auto result_and = cudf::bitmask_and(view);
+  auto result_or  = cudf::bitmask_or(view);
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(gold_and.data(), result_and.data(), num_rows / CHAR_BIT);
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(gold_or.data(), result_or.data(), num_rows / CHAR_BIT);
+}
+
+TEST_F(BitmaskBinopTest, OffsetMasks)
+{
+  cudf::size_type num_rows = 1000;
+  auto input               = make_input(num_rows);
+  auto &columns            = std::get<0>(input);
+
+  cudf::size_type begin = 37;
+  cudf::size_type end   = 941;
+  std::vector<cudf::column_view> views;
+  for (auto const &column : columns) {
+    views.push_back(cudf::slice(column->view(), {begin, end}).front());
+  }
+  cudf::table_view view{views};
+
+  auto const &and_bits = std::get<1>(input);
+  auto const &or_bits  = std::get<2>(input);
+  auto gold_and =
+    cudf::test::detail::make_null_mask(and_bits.begin() + begin, and_bits.begin() + end);
+  auto gold_or = cudf::test::detail::make_null_mask(or_bits.begin() + begin, or_bits.begin() + end);
+
+  auto result_and = cudf::bitmask_and(view);
+  auto result_or  = cudf::bitmask_or(view);
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(gold_and.data(), result_and.data(), (end - begin) / CHAR_BIT);
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(gold_or.data(), result_or.data(), (end - begin) / CHAR_BIT);
+}
+
+TEST_F(BitmaskBinopTest, SingleNullableColumn)
+{
+  cudf::size_type num_rows = 1000;
+  auto input               = make_input(num_rows);
+  auto &columns            = std::get<0>(input);
+  cudf::test::fixed_width_column_wrapper<int32_t> non_nullable(
+    thrust::make_counting_iterator(0), thrust::make_counting_iterator(num_rows));
+
+  auto gold = cudf::copy_bitmask(columns[0]->view());
+
+  auto result_and = cudf::bitmask_and(cudf::table_view{{columns[0]->view(), non_nullable}});
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(gold.data(), result_and.data(), num_rows / CHAR_BIT);
+
+  auto result_or = cudf::bitmask_or(cudf::table_view{{columns[0]->view(), non_nullable}});
+  EXPECT_EQ(0, static_cast<int>(result_or.size()));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
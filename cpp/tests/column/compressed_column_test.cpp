@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/compressed_column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/scalar_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+using cudf::test::fixed_width_column_wrapper;
+
+template <typename T>
+struct CompressedColumnTest : public cudf::test::BaseFixture {
+};
+
+using IntegerTypes = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, uint8_t, uint64_t>;
+TYPED_TEST_CASE(CompressedColumnTest, IntegerTypes);
+
+std::vector<cudf::cascade_scheme> const all_schemes{cudf::cascade_scheme::BITPACK,
+                                                   cudf::cascade_scheme::DELTA_BITPACK,
+                                                   cudf::cascade_scheme::RLE_BITPACK,
+                                                   cudf::cascade_scheme::RLE_DELTA_BITPACK};
+
+TYPED_TEST(CompressedColumnTest, RoundTrip)
+{
+  auto const iter = thrust::make_counting_iterator(0);
+  auto values     = thrust::make_transform_iterator(iter, [](auto i) { return (i / 7) % 100; });
+  auto valids     = thrust::make_transform_iterator(iter, [](auto i) { return i % 5 != 0; });
+  fixed_width_column_wrapper<TypeParam> input(values, values + 1000, valids);
+
+  for (auto const scheme : all_schemes) {
+    auto const compressed = cudf::compress(input, scheme);
+    EXPECT_EQ(scheme, compressed->scheme);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, cudf::decompress(*compressed)->view());
+  }
+}
+
+TYPED_TEST(CompressedColumnTest, Extremes)
+{
+  using limits = std::numeric_limits<TypeParam>;
+  fixed_width_column_wrapper<TypeParam> input({limits::max(), limits::min(), TypeParam{0}});
+
+  for (auto const scheme : all_schemes) {
+    auto const compressed = cudf::compress(input, scheme);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, cudf::decompress(*compressed)->view());
+  }
+}
+
+TYPED_TEST(CompressedColumnTest, GatherFilterReduce)
+{
+  auto const iter = thrust::make_counting_iterator(0);
+  auto values     = thrust::make_transform_iterator(iter, [](auto i) { return (i * 3) % 50; });
+  auto valids     = thrust::make_transform_iterator(iter, [](auto i) { return i % 4 != 0; });
+  fixed_width_column_wrapper<TypeParam> input(values, values + 200, valids);
+  fixed_width_column_wrapper<int32_t> gather_map({199, 0, 5, 5, 42});
+  auto mask_values = thrust::make_transform_iterator(iter, [](auto i) { return i % 3 == 0; });
+  fixed_width_column_wrapper<bool> boolean_mask(mask_values, mask_values + 200);
+  cudf::table_view const table({input});
+
+  auto const expected_gather = cudf::gather(table, gather_map);
+  auto const expected_filter = cudf::apply_boolean_mask(table, boolean_mask);
+  auto const type     = cudf::data_type{cudf::type_to_id<TypeParam>()};
+  auto const sum_type = cudf::data_type{std::is_signed<TypeParam>::value ? cudf::type_id::INT64
+                                                                         : cudf::type_id::UINT64};
+  auto const min      = cudf::make_min_aggregation();
+  auto const max      = cudf::make_max_aggregation();
+  auto const sum      = cudf::make_sum_aggregation();
+
+  for (auto const scheme : all_schemes) {
+    auto const compressed = cudf::compress(input, scheme);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_gather->get_column(0),
+                                   cudf::gather(*compressed, gather_map)->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_filter->get_column(0),
+                                   cudf::apply_boolean_mask(*compressed, boolean_mask)->view());
+
+    cudf::test::expect_scalars_equal(*cudf::reduce(input, min, type),
+                                     *cudf::reduce(*compressed, min, type));
+    cudf::test::expect_scalars_equal(*cudf::reduce(input, max, type),
+                                     *cudf::reduce(*compressed, max, type));
+    cudf::test::expect_scalars_equal(*cudf::reduce(input, sum, sum_type),
+                                     *cudf::reduce(*compressed, sum, sum_type));
+  }
+}
+
+TYPED_TEST(CompressedColumnTest, AllNulls)
+{
+  fixed_width_column_wrapper<TypeParam> input({1, 2, 3}, {0, 0, 0});
+  auto const compressed = cudf::compress(input, cudf::cascade_scheme::BITPACK);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, cudf::decompress(*compressed)->view());
+  auto const result = cudf::reduce(
+    *compressed, cudf::make_max_aggregation(), cudf::data_type{cudf::type_to_id<TypeParam>()});
+  EXPECT_FALSE(result->is_valid());
+}
+
+struct CompressedColumnUntypedTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(CompressedColumnUntypedTest, ChoosesSmallestScheme)
+{
+  auto const iter = thrust::make_counting_iterator(0);
+
+  // Sorted values far from zero are best delta encoded
+  auto sorted = thrust::make_transform_iterator(iter, [](auto i) { return 1000000000l + 3 * i; });
+  fixed_width_column_wrapper<int64_t> increasing(sorted, sorted + 10000);
+  auto compressed = cudf::compress(increasing);
+  EXPECT_EQ(cudf::cascade_scheme::DELTA_BITPACK, compressed->scheme);
+  EXPECT_LT(compressed->compressed_size(), 10000 * sizeof(int64_t) / 10);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(increasing, cudf::decompress(*compressed)->view());
+
+  // Long runs of unordered values are best run-length encoded
+  auto runs = thrust::make_transform_iterator(iter, [](auto i) { return (i / 1000) % 2 * 12345; });
+  fixed_width_column_wrapper<int32_t> repeated(runs, runs + 10000);
+  compressed = cudf::compress(repeated);
+  EXPECT_EQ(cudf::cascade_scheme::RLE_BITPACK, compressed->scheme);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(repeated, cudf::decompress(*compressed)->view());
+}
+
+TEST_F(CompressedColumnUntypedTest, UnsupportedType)
+{
+  fixed_width_column_wrapper<double> input({1.0, 2.0});
+  EXPECT_THROW(cudf::compress(input), cudf::logic_error);
+}
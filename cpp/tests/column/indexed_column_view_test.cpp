@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/column/indexed_column_view.hpp>
+#include <cudf/hashing.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/scalar_utilities.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+
+struct IndexedColumnViewTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(IndexedColumnViewTest, Materialize)
+{
+  fixed_width_column_wrapper<int32_t> parent{{10, 11, 12, 13, 14}, {1, 0, 1, 1, 1}};
+  fixed_width_column_wrapper<int32_t> indices{4, 1, 1, 0};
+  cudf::indexed_column_view const view{parent, indices};
+  EXPECT_TRUE(view.has_indices());
+  EXPECT_EQ(view.size(), 4);
+
+  fixed_width_column_wrapper<int32_t> expect{{14, 11, 11, 10}, {1, 0, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, view.materialize()->view());
+
+  cudf::indexed_column_view const all{parent};
+  EXPECT_FALSE(all.has_indices());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(parent, all.materialize()->view());
+
+  fixed_width_column_wrapper<int64_t> wide_indices{0, 1};
+  EXPECT_THROW(cudf::indexed_column_view(parent, wide_indices), cudf::logic_error);
+}
+
+TEST_F(IndexedColumnViewTest, Reduce)
+{
+  fixed_width_column_wrapper<int32_t> parent{{5, 100, 7, 1, 3}, {1, 1, 1, 0, 1}};
+  fixed_width_column_wrapper<int32_t> indices{0, 2, 3, 2};
+  cudf::indexed_column_view const view{parent, indices};
+  auto const rows = view.materialize();
+
+  auto const type = cudf::data_type{cudf::type_id::INT64};
+  for (auto const& agg : {cudf::make_sum_aggregation(),
+                          cudf::make_min_aggregation(),
+                          cudf::make_max_aggregation(),
+                          cudf::make_sum_of_squares_aggregation(),
+                          cudf::make_mean_aggregation()}) {
+    auto const output_type = agg->kind == cudf::aggregation::MEAN
+                               ? cudf::data_type{cudf::type_id::FLOAT64}
+                               : type;
+    cudf::test::expect_scalars_equal(*cudf::reduce(view, agg, output_type),
+                                     *cudf::reduce(rows->view(), agg, output_type));
+  }
+
+  // only the null row is selected
+  fixed_width_column_wrapper<int32_t> null_row{3};
+  auto const result =
+    cudf::reduce(cudf::indexed_column_view{parent, null_row}, cudf::make_sum_aggregation(), type);
+  EXPECT_FALSE(result->is_valid());
+}
+
+TEST_F(IndexedColumnViewTest, BinaryOperation)
+{
+  fixed_width_column_wrapper<int32_t> lhs{{1, 2, 3, 4}, {1, 1, 0, 1}};
+  fixed_width_column_wrapper<int32_t> rhs{10, 20, 30};
+  fixed_width_column_wrapper<int32_t> lhs_indices{3, 2, 0};
+  fixed_width_column_wrapper<int32_t> rhs_indices{0, 1, 2};
+  cudf::indexed_column_view const lhs_view{lhs, lhs_indices};
+
+  auto const type = cudf::data_type{cudf::type_id::INT32};
+  fixed_width_column_wrapper<int32_t> expect{{14, 0, 31}, {1, 0, 1}};
+  auto result = cudf::binary_operation(
+    lhs_view, cudf::indexed_column_view{rhs, rhs_indices}, cudf::binary_operator::ADD, type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, result->view());
+
+  // without indices for the right operand
+  result = cudf::binary_operation(
+    lhs_view, cudf::indexed_column_view{rhs}, cudf::binary_operator::ADD, type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, result->view());
+
+  // an operation without a precompiled kernel
+  fixed_width_column_wrapper<int32_t> expect_mod{{4, 0, 1}, {1, 0, 1}};
+  result = cudf::binary_operation(
+    lhs_view, cudf::indexed_column_view{rhs}, cudf::binary_operator::MOD, type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_mod, result->view());
+}
+
+TEST_F(IndexedColumnViewTest, Hash)
+{
+  fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper strings{"a", "bb", "ccc", "dddd"};
+  cudf::table_view const table{{ints, strings}};
+  fixed_width_column_wrapper<int32_t> indices{3, 1, 1, 2};
+  cudf::indexed_table_view const view{table, indices};
+  auto const rows = view.materialize();
+
+  for (auto const hash_function : {cudf::hash_id::HASH_MURMUR3,
+                                   cudf::hash_id::HASH_SPARK_MURMUR3,
+                                   cudf::hash_id::HASH_XXHASH64,
+                                   cudf::hash_id::HASH_MD5}) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::hash(rows->view(), hash_function)->view(),
+                                   cudf::hash(view, hash_function)->view());
+  }
+}
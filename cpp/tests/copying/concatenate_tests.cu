@@ -146,6 +146,40 @@ TEST_F(StringColumnTest, ConcatenateColumnView)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringColumnTest, ConcatenateManySlices)
+{
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  std::vector<std::string> h_strings(1000);
+  for (std::size_t i = 0; i < h_strings.size(); ++i) {
+    h_strings[i] = std::string(i % 7, 'a' + i % 26);
+  }
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), valids);
+
+  // Slices of 0 to 4 rows, including empty ones
+  std::vector<cudf::size_type> indices;
+  for (cudf::size_type begin = 0, i = 0; begin < 1000; ++i) {
+    auto const end = std::min(begin + i % 5, 1000);
+    indices.push_back(begin);
+    indices.push_back(end);
+    begin = end;
+  }
+  auto const slices = cudf::slice(strings, indices);
+
+  auto results = cudf::concatenate(slices);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, strings);
+}
+
+TEST_F(StringColumnTest, ConcatenateLargeStrings)
+{
+  // Large enough for the chars to be copied column by column
+  std::vector<std::string> h_strings{
+    std::string(300000, 'a'), std::string(300000, 'b'), "", std::string(600000, 'c')};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+
+  auto results = cudf::concatenate(cudf::slice(strings, {0, 1, 1, 3, 3, 4}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, strings);
+}
+
 struct TableTest : public cudf::test::BaseFixture {
 };
 
@@ -652,6 +686,29 @@ TEST_F(ListsColumnTest, SlicedColumns)
   }
 }
 
+TEST_F(ListsColumnTest, ConcatenateManySlices)
+{
+  using LCW = cudf::test::lists_column_wrapper<int>;
+
+  std::vector<LCW> rows;
+  for (int i = 0; i < 500; ++i) {
+    rows.emplace_back(thrust::make_counting_iterator(i), thrust::make_counting_iterator(i + i % 4));
+  }
+  auto lists = cudf::concatenate(std::vector<cudf::column_view>(rows.begin(), rows.end()));
+
+  // Slices of 0 to 4 rows, including empty ones
+  std::vector<cudf::size_type> indices;
+  for (cudf::size_type begin = 0, i = 0; begin < 500; ++i) {
+    auto const end = std::min(begin + i % 5, 500);
+    indices.push_back(begin);
+    indices.push_back(end);
+    begin = end;
+  }
+
+  auto results = cudf::concatenate(cudf::slice(*lists, indices));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *lists);
+}
+
 TEST_F(ListsColumnTest, SlicedColumnsWithNulls)
 {
   using LCW = cudf::test::lists_column_wrapper<int>;
@@ -27,6 +27,10 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <string>
 
 template <typename T>
 struct CopyTest : public cudf::test::BaseFixture {
@@ -449,6 +453,37 @@ TEST_F(CopyTestUntyped, CopyIfElseTypeMismatch)
   EXPECT_THROW(cudf::copy_if_else(lhs_w, rhs_w, mask_w), cudf::logic_error);
 }
 
+TEST_F(CopyTestUntyped, CopyIfElseTable)
+{
+  constexpr cudf::size_type num_rows = 100;
+  auto mask       = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto mask_valid = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto values     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto lhs_valid  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  auto strings    = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 4, 'a'); });
+  cudf::test::fixed_width_column_wrapper<bool> mask_w(mask, mask + num_rows, mask_valid);
+
+  wrapper<int32_t> lhs_ints(values, values + num_rows, lhs_valid);
+  wrapper<int32_t> rhs_ints(values + num_rows, values + 2 * num_rows);
+  wrapper<double> lhs_doubles(values, values + num_rows);
+  wrapper<double> rhs_doubles(values + 1, values + num_rows + 1);
+  wrapper<int8_t> lhs_bytes(values, values + num_rows);
+  wrapper<int8_t> rhs_bytes(values + 2, values + num_rows + 2, lhs_valid);
+  cudf::test::strings_column_wrapper lhs_strings(strings, strings + num_rows, lhs_valid);
+  cudf::test::strings_column_wrapper rhs_strings(strings + 1, strings + num_rows + 1);
+
+  cudf::table_view lhs({lhs_ints, lhs_doubles, lhs_strings, lhs_bytes});
+  cudf::table_view rhs({rhs_ints, rhs_doubles, rhs_strings, rhs_bytes});
+  auto results = cudf::copy_if_else(lhs, rhs, mask_w);
+
+  ASSERT_EQ(results->num_columns(), lhs.num_columns());
+  for (cudf::size_type c = 0; c < lhs.num_columns(); ++c) {
+    auto expected = cudf::copy_if_else(lhs.column(c), rhs.column(c), mask_w);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(c), *expected);
+  }
+}
+
 struct StringsCopyIfElseTest : public cudf::test::BaseFixture {
 };
 
@@ -27,6 +27,8 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <string>
+
 template <typename T>
 class GatherTest : public cudf::test::BaseFixture {
 };
@@ -242,3 +244,50 @@ TYPED_TEST(GatherTest, MultiColNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_column, result->view().column(i));
   }
 }
+
+TYPED_TEST(GatherTest, GatherPlanMatchesGather)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto words  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 4, 'a' + i % 26); });
+
+  cudf::test::fixed_width_column_wrapper<TypeParam> column0(data, data + source_size, valids);
+  cudf::test::fixed_width_column_wrapper<int64_t> column1(data, data + source_size);
+  cudf::test::strings_column_wrapper column2(words, words + source_size, valids);
+  cudf::test::fixed_width_column_wrapper<TypeParam> column3(data, data + source_size);
+
+  auto map_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i % 2 == 0 ? (i * 7) % source_size : -1 - i % source_size; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(map_data, map_data + 2500);
+
+  cudf::gather_plan plan(gather_map, source_size);
+  cudf::table_view first({column0, column1, column2});
+  cudf::table_view second({column3, column0});
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::gather(first, gather_map)->view(),
+                                plan.gather(first)->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::gather(second, gather_map)->view(),
+                                plan.gather(second)->view());
+}
+
+TYPED_TEST(GatherTest, GatherPlanOutOfBounds)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> source{1, 2, 3, 4};
+  cudf::test::strings_column_wrapper strings{"a", "b", "c", "d"};
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{3, 4, -1, -5, 0};
+
+  EXPECT_THROW(cudf::gather_plan(gather_map, 4, true), cudf::logic_error);
+
+  cudf::gather_plan plan(gather_map, 4);
+  EXPECT_THROW(plan.gather(cudf::table_view({cudf::column_view(gather_map)})), cudf::logic_error);
+
+  auto result = plan.gather(cudf::table_view({source, strings}));
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_source{{4, 0, 4, 0, 1},
+                                                                  {1, 0, 1, 0, 1}};
+  cudf::test::strings_column_wrapper expect_strings({"d", "", "d", "", "a"}, {1, 0, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_source, result->view().column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_strings, result->view().column(1));
+}
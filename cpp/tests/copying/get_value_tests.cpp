@@ -75,6 +75,38 @@ TYPED_TEST(FixedWidthGetValueTest, IndexOutOfBounds)
   CUDF_EXPECT_THROW_MESSAGE(get_element(col, 4);, "Index out of bounds");
 }
 
+TYPED_TEST(FixedWidthGetValueTest, GetElements)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> col({9, 8, 7, 6}, {0, 1, 0, 1});
+  auto results = get_elements(col, {3, 1, 2, 3});
+  ASSERT_EQ(results.size(), 4u);
+
+  using ScalarType = scalar_type_t<TypeParam>;
+  EXPECT_TRUE(results[0]->is_valid());
+  EXPECT_EQ(cudf::test::make_type_param_scalar<TypeParam>(6),
+            static_cast<ScalarType const*>(results[0].get())->value());
+  EXPECT_EQ(cudf::test::make_type_param_scalar<TypeParam>(8),
+            static_cast<ScalarType const*>(results[1].get())->value());
+  EXPECT_FALSE(results[2]->is_valid());
+  EXPECT_TRUE(results[3]->is_valid());
+
+  EXPECT_TRUE(get_elements(col, {}).empty());
+  CUDF_EXPECT_THROW_MESSAGE(get_elements(col, {0, 4});, "Index out of bounds");
+}
+
+TYPED_TEST(FixedWidthGetValueTest, GetElementsToHost)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> col({9, 8, 7, 6}, {0, 1, 0, 1});
+  auto results = get_elements_to_host<TypeParam>(col, {3, 1, 2});
+
+  ASSERT_EQ(results.first.size(), 3u);
+  EXPECT_EQ(cudf::test::make_type_param_scalar<TypeParam>(6), results.first[0]);
+  EXPECT_EQ(cudf::test::make_type_param_scalar<TypeParam>(8), results.first[1]);
+  EXPECT_EQ(results.second, (std::vector<bool>{true, true, false}));
+
+  CUDF_EXPECT_THROW_MESSAGE(get_elements_to_host<TypeParam>(col, {-1});, "Index out of bounds");
+}
+
 struct StringGetValueTest : public BaseFixture {
 };
 
@@ -119,6 +151,19 @@ TEST_F(StringGetValueTest, GetNull)
   EXPECT_FALSE(s->is_valid());
 }
 
+TEST_F(StringGetValueTest, GetElements)
+{
+  strings_column_wrapper col({"this", "is", "", "test"}, {1, 1, 1, 0});
+  auto results = get_elements(col, {1, 3, 2, 0});
+  ASSERT_EQ(results.size(), 4u);
+
+  EXPECT_EQ("is", static_cast<string_scalar const*>(results[0].get())->to_string());
+  EXPECT_FALSE(results[1]->is_valid());
+  EXPECT_TRUE(results[2]->is_valid());
+  EXPECT_EQ("", static_cast<string_scalar const*>(results[2].get())->to_string());
+  EXPECT_EQ("this", static_cast<string_scalar const*>(results[3].get())->to_string());
+}
+
 template <typename T>
 struct DictionaryGetValueTest : public BaseFixture {
 };
@@ -961,3 +961,60 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointScatter)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_table, result->view());
 }
+
+class ScatterNestedTests : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScatterNestedTests, Lists)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+
+  LCW source{{1, 2}, {3}, {4, 5, 6}};
+  LCW target{{10}, {20, 21}, {}, {30, 31, 32}, {40}};
+  auto const scatter_map = wrapper<int32_t>({3, 0, -3});
+  LCW expected{{3}, {20, 21}, {4, 5, 6}, {1, 2}, {40}};
+
+  auto const result =
+    cudf::scatter(cudf::table_view({source}), scatter_map, cudf::table_view({target}), true);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->get_column(0));
+}
+
+TEST_F(ScatterNestedTests, ListsOfLists)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+
+  LCW source{{{1, 2}, {3}}, {{4}}};
+  LCW target{{{10}}, {{20, 21}, {22}}, {{30}, {}, {31}}};
+  auto const scatter_map = wrapper<int32_t>({2, 0});
+  LCW expected{{{4}}, {{20, 21}, {22}}, {{1, 2}, {3}}};
+
+  auto const result =
+    cudf::scatter(cudf::table_view({source}), scatter_map, cudf::table_view({target}), true);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->get_column(0));
+}
+
+TEST_F(ScatterNestedTests, Structs)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+
+  auto source_ints  = wrapper<int32_t>({1, 2}, {1, 0});
+  auto source_lists = LCW{{1}, {2, 3}};
+  auto source       = cudf::test::structs_column_wrapper{{source_ints, source_lists}};
+
+  auto target_ints  = wrapper<int32_t>({10, 20, 30, 40});
+  auto target_lists = LCW{{10, 11}, {}, {30}, {40, 41, 42}};
+  auto target       = cudf::test::structs_column_wrapper{{target_ints, target_lists}};
+
+  auto const scatter_map = wrapper<int32_t>({3, 1});
+
+  auto expected_ints  = wrapper<int32_t>({10, 2, 30, 1}, {1, 0, 1, 1});
+  auto expected_lists = LCW{{10, 11}, {2, 3}, {30}, {1}};
+  auto expected       = cudf::test::structs_column_wrapper{{expected_ints, expected_lists}};
+
+  auto const result =
+    cudf::scatter(cudf::table_view({source}), scatter_map, cudf::table_view({target}), true);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->get_column(0));
+}
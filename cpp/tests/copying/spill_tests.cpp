@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/spill.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+struct SpillTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+// A table of one INT32 column of `size` rows, which is `4 * size` bytes of device memory
+cudf::test::fixed_width_column_wrapper<int32_t> make_column(int32_t size)
+{
+  return cudf::test::fixed_width_column_wrapper<int32_t>(thrust::make_counting_iterator(0),
+                                                         thrust::make_counting_iterator(size));
+}
+}  // namespace
+
+TEST_F(SpillTest, PinnedViewMatchesInput)
+{
+  auto col = make_column(1000);
+  cudf::spill_manager manager(1 << 20);
+  auto table = manager.make_spillable(cudf::table_view{{col}});
+  EXPECT_FALSE(table->is_spilled());
+  EXPECT_EQ(manager.device_size(), table->size());
+
+  auto pinned = table->pin();
+  EXPECT_TRUE(table->is_pinned());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{col}}, pinned.table);
+  pinned.pin.reset();
+  EXPECT_FALSE(table->is_pinned());
+}
+
+TEST_F(SpillTest, SpillsLeastRecentlyUsed)
+{
+  auto col0 = make_column(1000);
+  auto col1 = make_column(2000);
+  auto col2 = make_column(3000);
+
+  // room for any two of the tables
+  cudf::spill_manager manager(4 * 5000 + 1024);
+  auto table0 = manager.make_spillable(cudf::table_view{{col0}});
+  auto table1 = manager.make_spillable(cudf::table_view{{col1}});
+  table0->pin();  // table1 becomes the least recently used
+  auto table2 = manager.make_spillable(cudf::table_view{{col2}});
+
+  EXPECT_FALSE(table0->is_spilled());
+  EXPECT_TRUE(table1->is_spilled());
+  EXPECT_FALSE(table2->is_spilled());
+  EXPECT_EQ(manager.device_size(), table0->size() + table2->size());
+
+  // bringing table1 back spills table0, now the least recently used
+  auto pinned = table1->pin();
+  EXPECT_FALSE(table1->is_spilled());
+  EXPECT_TRUE(table0->is_spilled());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{col1}}, pinned.table);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{col0}}, table0->pin().table);
+}
+
+TEST_F(SpillTest, PinnedTablesAreNotSpilled)
+{
+  auto col0 = make_column(1000);
+  auto col1 = make_column(1000);
+
+  cudf::spill_manager manager(4 * 1000 + 1024);
+  auto table0  = manager.make_spillable(cudf::table_view{{col0}});
+  auto pinned0 = table0->pin();
+  auto table1  = manager.make_spillable(cudf::table_view{{col1}});
+
+  // the limit is exceeded rather than spilling a pinned table
+  EXPECT_FALSE(table0->is_spilled());
+  EXPECT_FALSE(table1->is_spilled());
+  EXPECT_FALSE(table0->spill());
+  EXPECT_EQ(manager.spill(table0->size()), table1->size());
+  EXPECT_TRUE(table1->is_spilled());
+
+  pinned0.pin.reset();
+  EXPECT_TRUE(table0->spill());
+  EXPECT_TRUE(table0->is_spilled());
+  EXPECT_EQ(manager.device_size(), 0u);
+}
+
+TEST_F(SpillTest, SlicedAndNullableColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  cudf::test::strings_column_wrapper strings({"a", "bb", "", "dddd", "e"}, {1, 1, 0, 1, 1});
+  auto const sliced = cudf::slice(cudf::table_view{{ints, strings}}, {1, 4}).front();
+
+  cudf::spill_manager manager(1 << 20);
+  auto table = manager.make_spillable(sliced);
+  EXPECT_TRUE(table->spill());
+  EXPECT_TRUE(table->is_spilled());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sliced, table->pin().table);
+}
+
+TEST_F(SpillTest, TablesOutliveManager)
+{
+  auto col = make_column(1000);
+  std::shared_ptr<cudf::spillable_table> table;
+  {
+    cudf::spill_manager manager(1 << 20);
+    table = manager.make_spillable(cudf::table_view{{col}});
+  }
+  EXPECT_TRUE(table->spill());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{col}}, table->pin().table);
+}
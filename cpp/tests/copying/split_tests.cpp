@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/ipc.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <tests/utilities/base_fixture.hpp>
@@ -806,3 +807,107 @@ TEST_F(ContiguousSplitTableCornerCases, MixedColumnTypes)
     CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected[index], result[index].table);
   }
 }
+
+TEST_F(ContiguousSplitTableCornerCases, ManySplits)
+{
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto iter   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto words  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 5, 'a' + i % 26); });
+
+  cudf::test::fixed_width_column_wrapper<int> c0(iter, iter + 300, valids);
+  cudf::test::fixed_width_column_wrapper<int8_t> c1(iter, iter + 300);
+  cudf::test::strings_column_wrapper c2(words, words + 300, valids);
+  cudf::table_view tbl({c0, c1, c2});
+
+  // splits of uneven sizes, most of them not aligned to a validity word
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type row = 3; row < 300; row += 3 + row % 11) { splits.push_back(row); }
+
+  auto result   = cudf::contiguous_split(tbl, splits);
+  auto expected = cudf::split(tbl, splits);
+  ASSERT_EQ(expected.size(), result.size());
+
+  for (unsigned long index = 0; index < expected.size(); index++) {
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected[index], result[index].table);
+  }
+}
+
+struct PackTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PackTest, MixedColumnTypes)
+{
+  using LCW = cudf::test::lists_column_wrapper<int>;
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  std::vector<std::string> strings{"", "this", "is", "a", "column", "of", "strings"};
+
+  cudf::test::fixed_width_column_wrapper<int> c0({0, 1, 2, 3, 4, 5, 6}, valids);
+  cudf::test::fixed_width_column_wrapper<double> c1({0, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5});
+  cudf::test::strings_column_wrapper c2(strings.begin(), strings.end(), valids);
+  LCW c3({{1, 2}, {3}, LCW{}, {4, 5, 6}, {7}, {8, 9}, {10}}, valids);
+  cudf::table_view input({c0, c1, c2, c3});
+
+  auto packed = cudf::pack(input);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, cudf::unpack(packed));
+  auto from_buffers = cudf::unpack(packed.metadata->data(),
+                                   static_cast<uint8_t const*>(packed.gpu_data->data()));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, from_buffers);
+}
+
+TEST_F(PackTest, SlicedColumns)
+{
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 2 == 0; });
+  std::vector<std::string> strings{"a", "bb", "ccc", "dddd", "eeeee", "ffffff", "g"};
+
+  cudf::test::fixed_width_column_wrapper<int16_t> c0({0, 1, 2, 3, 4, 5, 6}, valids);
+  cudf::test::strings_column_wrapper c1(strings.begin(), strings.end(), valids);
+  cudf::table_view input({c0, c1});
+  auto sliced = cudf::slice(input, {3, 6}).front();
+
+  auto packed = cudf::pack(sliced);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sliced, cudf::unpack(packed));
+}
+
+TEST_F(PackTest, EmptyTable)
+{
+  cudf::test::fixed_width_column_wrapper<int> c0{};
+  cudf::test::strings_column_wrapper c1{};
+  cudf::table_view input({c0, c1});
+
+  auto packed = cudf::pack(input);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, cudf::unpack(packed));
+}
+
+TEST_F(PackTest, IpcExport)
+{
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 2 == 0; });
+  std::vector<std::string> strings{"a", "bb", "ccc", "dddd", "eeeee", "ffffff", "g"};
+
+  cudf::test::fixed_width_column_wrapper<int16_t> c0({0, 1, 2, 3, 4, 5, 6}, valids);
+  cudf::test::strings_column_wrapper c1(strings.begin(), strings.end(), valids);
+  cudf::table_view input({c0, c1});
+
+  auto exported = cudf::export_ipc(input);
+  EXPECT_GT(exported.handle.size(), exported.packed.metadata->size());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, cudf::unpack(exported.packed));
+}
+
+TEST_F(PackTest, IpcImportWithoutDeviceMemory)
+{
+  // A table without device memory maps nothing, so it can be imported by the exporting process
+  cudf::test::fixed_width_column_wrapper<int> c0{};
+  cudf::table_view input({c0});
+
+  auto exported = cudf::export_ipc(input);
+  auto imported = cudf::import_ipc(exported.handle.data(), exported.handle.size());
+  EXPECT_EQ(nullptr, imported.mapping);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, imported.table);
+}
+
+TEST_F(PackTest, IpcImportInvalidHandle)
+{
+  std::vector<uint8_t> handle(256, 0);
+  EXPECT_THROW(cudf::import_ipc(handle.data(), handle.size()), cudf::logic_error);
+  EXPECT_THROW(cudf::import_ipc(handle.data(), 1), cudf::logic_error);
+}
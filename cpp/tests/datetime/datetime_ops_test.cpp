@@ -17,6 +17,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
@@ -53,6 +54,7 @@ TYPED_TEST(NonTimestampTest, TestThrowsOnNonTimestamp)
   EXPECT_THROW(extract_hour(col), cudf::logic_error);
   EXPECT_THROW(extract_minute(col), cudf::logic_error);
   EXPECT_THROW(extract_second(col), cudf::logic_error);
+  EXPECT_THROW(extract_components(col, {datetime_component::YEAR}), cudf::logic_error);
   EXPECT_THROW(last_day_of_month(col), cudf::logic_error);
   EXPECT_THROW(day_of_year(col), cudf::logic_error);
   EXPECT_THROW(
@@ -265,6 +267,41 @@ TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedNullableDatetimeComponen
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_second(timestamps), expected_seconds);
 }
 
+TYPED_TEST(TypedDatetimeOpsTest, TestExtractingMultipleComponents)
+{
+  using T = TypeParam;
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace simt::std::chrono;
+
+  auto start = milliseconds(-2500000000000);  // Sat, 11 Oct 1890 19:33:20 GMT
+  auto stop_ = milliseconds(2500000000000);   // Mon, 22 Mar 2049 04:26:40 GMT
+  auto timestamps =
+    generate_timestamps<T, true>(this->size(), time_point_ms(start), time_point_ms(stop_));
+
+  auto const components = std::vector<datetime_component>{datetime_component::SECOND,
+                                                          datetime_component::YEAR,
+                                                          datetime_component::WEEKDAY,
+                                                          datetime_component::HOUR,
+                                                          datetime_component::DAY,
+                                                          datetime_component::MINUTE,
+                                                          datetime_component::MONTH,
+                                                          datetime_component::YEAR};
+  auto const results = extract_components(timestamps, components);
+
+  ASSERT_EQ(results->num_columns(), static_cast<cudf::size_type>(components.size()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), *extract_second(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), *extract_year(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), *extract_weekday(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(3), *extract_hour(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(4), *extract_day(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(5), *extract_minute(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(6), *extract_month(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(7), *extract_year(timestamps));
+
+  EXPECT_THROW(extract_components(timestamps, {datetime_component::INVALID}), cudf::logic_error);
+}
+
 TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithSeconds)
 {
   using namespace cudf::test;
@@ -534,4 +571,51 @@ TEST_F(BasicDatetimeOpsTest, TestAddMonthsWithSecondsAndNullValues)
     true);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestTimezoneConversions)
+{
+  using namespace cudf::datetime;
+  using ts_wrapper =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>;
+
+  auto const timezone = get_timezone_table("America/Los_Angeles");
+  EXPECT_EQ(timezone, get_timezone_table("America/Los_Angeles"));
+
+  auto const utc = ts_wrapper{{
+                                1593604800L,  // 2020-07-01 12:00:00 GMT
+                                1606824000L,  // 2020-12-01 12:00:00 GMT
+                                1604219400L,  // 2020-11-01 08:30:00 GMT
+                                1604223000L,  // 2020-11-01 09:30:00 GMT
+                                4118126400L,  // 2100-07-01 12:00:00 GMT
+                                0L            // null value
+                              },
+                              {true, true, true, true, true, false}};
+  auto const local = ts_wrapper{{
+                                  1593579600L,  // 2020-07-01 05:00:00 PDT
+                                  1606795200L,  // 2020-12-01 04:00:00 PST
+                                  1604194200L,  // 2020-11-01 01:30:00 PDT
+                                  1604194200L,  // 2020-11-01 01:30:00 PST
+                                  4118101200L,  // 2100-07-01 05:00:00 PDT
+                                  0L            // null value
+                                },
+                                {true, true, true, true, true, false}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*utc_to_local(utc, *timezone), local);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *extract_local_component(utc, *timezone, datetime_component::HOUR),
+    cudf::test::fixed_width_column_wrapper<int16_t>{{5, 4, 1, 1, 5, 0},
+                                                    {true, true, true, true, true, false}});
+
+  // the repeated 01:30 is the earlier instant, and the skipped 02:30 is shifted to 03:30 PDT
+  auto const local_times = ts_wrapper{1593579600L, 1604194200L, 1583634600L};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*local_to_utc(local_times, *timezone),
+                                 ts_wrapper{1593604800L, 1604219400L, 1583663400L});
+
+  auto const utc_table = get_timezone_table("UTC");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*utc_to_local(utc, *utc_table), utc);
+
+  auto const days =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep>{1, 2};
+  EXPECT_THROW(utc_to_local(days, *timezone), cudf::logic_error);
+  EXPECT_THROW(get_timezone_table("Not/A_Zone"), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/copying.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <tests/utilities/base_fixture.hpp>
@@ -72,6 +73,23 @@ TEST_F(DictionaryEncodeTest, EncodeWithNull)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), expected);
 }
 
+TEST_F(DictionaryEncodeTest, EncodeSlicedStringsWithNulls)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"zz", "eee", "", "aaa", "eee", "ccc", "aaa", "", "ccc", "zz"}, {1, 1, 0, 1, 1, 1, 1, 0, 1, 1});
+  auto const sliced = cudf::slice(strings, {1, 9}).front();
+
+  auto dictionary = cudf::dictionary::encode(sliced);
+  cudf::dictionary_column_view view(dictionary->view());
+
+  cudf::test::strings_column_wrapper keys_expected({"aaa", "ccc", "eee"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{2, 3, 0, 2, 1, 0, 3, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), expected);
+  EXPECT_EQ(view.null_count(), 2);
+}
+
 TEST_F(DictionaryEncodeTest, InvalidEncode)
 {
   cudf::test::fixed_width_column_wrapper<int16_t> input{0, 1, 2, 3, -1, -2, -3};
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/dictionary/transform.hpp>
+#include <cudf/strings/case.hpp>
+#include <cudf/strings/contains.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <vector>
+
+struct DictionaryTransformTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DictionaryTransformTest, StringsKeys)
+{
+  cudf::test::strings_column_wrapper strings{"eee", "aaa", "EEE", "bbb", "AAA", "ccc", "eee"};
+  auto dictionary = cudf::dictionary::encode(strings);
+
+  auto to_upper = [](cudf::column_view const& keys) { return cudf::strings::to_upper(keys); };
+  auto result   = cudf::dictionary::transform_keys(dictionary->view(), to_upper);
+  EXPECT_EQ(result->type().id(), cudf::type_id::DICTIONARY32);
+  // the upper-case keys are merged
+  EXPECT_EQ(cudf::dictionary_column_view(result->view()).keys_size(), 4);
+
+  cudf::test::strings_column_wrapper expected{"EEE", "AAA", "EEE", "BBB", "AAA", "CCC", "EEE"};
+  auto decoded = cudf::dictionary::decode(result->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, expected);
+}
+
+TEST_F(DictionaryTransformTest, FixedWidthResult)
+{
+  cudf::test::strings_column_wrapper strings{"the quick", "brown fox", "the quick", "lazy dog"};
+  auto dictionary = cudf::dictionary::encode(strings);
+
+  auto result =
+    cudf::dictionary::transform_keys(dictionary->view(), [](cudf::column_view const& keys) {
+      return cudf::strings::contains_re(keys, "o[gx]");
+    });
+  cudf::test::fixed_width_column_wrapper<bool> expected{0, 1, 0, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(DictionaryTransformTest, WithNulls)
+{
+  cudf::test::strings_column_wrapper strings({"aa", "", "Bb", "aA", "bb", "bB"},
+                                             {1, 0, 1, 1, 1, 1});
+  auto dictionary = cudf::dictionary::encode(strings);
+  auto sliced     = cudf::slice(dictionary->view(), {1, 6}).front();
+  auto to_lower   = [](cudf::column_view const& keys) { return cudf::strings::to_lower(keys); };
+
+  auto result = cudf::dictionary::transform_keys(sliced, to_lower);
+  cudf::test::strings_column_wrapper expected({"", "bb", "aa", "bb", "bb"}, {0, 1, 1, 1, 1});
+  auto decoded = cudf::dictionary::decode(result->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, expected);
+
+  auto bools = cudf::dictionary::transform_keys(sliced, [](cudf::column_view const& keys) {
+    return cudf::strings::contains_re(keys, "B");
+  });
+  cudf::test::fixed_width_column_wrapper<bool> expected_bools({0, 1, 0, 0, 1}, {0, 1, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*bools, expected_bools);
+}
+
+TEST_F(DictionaryTransformTest, Errors)
+{
+  cudf::test::strings_column_wrapper strings{"aaa", "bbb", "aaa"};
+  auto dictionary = cudf::dictionary::encode(strings);
+
+  // the transform must return a row for each key
+  auto first_key = [](cudf::column_view const& keys) {
+    return std::make_unique<cudf::column>(cudf::slice(keys, {0, 1}).front());
+  };
+  EXPECT_THROW(cudf::dictionary::transform_keys(dictionary->view(), first_key), cudf::logic_error);
+}
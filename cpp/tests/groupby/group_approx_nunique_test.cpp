@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+#include <cmath>
+
+namespace cudf {
+namespace test {
+struct groupby_approx_nunique_test : public cudf::test::BaseFixture {
+};
+
+using R = cudf::detail::target_type_t<int32_t, aggregation::APPROX_NUNIQUE>;
+
+// clang-format off
+TEST_F(groupby_approx_nunique_test, basic)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<int32_t> vals { 0, 1, 2, 3, 4, 5, 3, 2, 2, 9};
+
+    fixed_width_column_wrapper<int32_t> expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<R>       expect_vals { 2, 4, 1 };
+
+    test_single_agg(keys, vals, expect_keys, expect_vals, make_approx_nunique_aggregation());
+    test_single_agg(keys, vals, expect_keys, expect_vals, make_approx_nunique_aggregation(),
+                    force_use_sort_impl::YES);
+}
+
+TEST_F(groupby_approx_nunique_test, null_values)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<int32_t> vals({ 0, 1, 2, 3, 4, 5, 3, 2, 2, 9},
+                                             { 1, 0, 1, 1, 0, 1, 1, 0, 0, 1});
+
+    fixed_width_column_wrapper<int32_t> expect_keys         { 1, 2, 3 };
+    fixed_width_column_wrapper<R>       expect_vals         { 2, 2, 1 };
+    fixed_width_column_wrapper<R>       expect_vals_w_nulls { 2, 3, 2 };
+
+    test_single_agg(keys, vals, expect_keys, expect_vals, make_approx_nunique_aggregation());
+    test_single_agg(keys, vals, expect_keys, expect_vals_w_nulls,
+                    make_approx_nunique_aggregation(14, null_policy::INCLUDE));
+    test_single_agg(keys, vals, expect_keys, expect_vals_w_nulls,
+                    make_approx_nunique_aggregation(14, null_policy::INCLUDE),
+                    force_use_sort_impl::YES);
+}
+// clang-format on
+
+TEST_F(groupby_approx_nunique_test, empty_cols)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  fixed_width_column_wrapper<int32_t> vals{};
+
+  fixed_width_column_wrapper<int32_t> expect_keys{};
+  fixed_width_column_wrapper<R> expect_vals{};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, make_approx_nunique_aggregation());
+}
+
+TEST_F(groupby_approx_nunique_test, many_distinct_values)
+{
+  constexpr size_type num_rows = 400000;
+  auto key_iter   = make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  auto value_iter = make_counting_transform_iterator(0, [](auto i) { return i / 2; });
+  fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(value_iter, value_iter + num_rows);
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_approx_nunique_aggregation());
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  // Every group holds num_rows / 2 distinct values, estimated within about 3 standard errors
+  auto const estimates = to_host<R>(*result.second[0].results[0]).first;
+  ASSERT_EQ(estimates.size(), 2u);
+  for (auto const estimate : estimates) {
+    EXPECT_LT(std::abs(estimate - num_rows / 2), 0.025 * num_rows / 2);
+  }
+}
+
+TEST_F(groupby_approx_nunique_test, merged_sketches_match_whole_sketch)
+{
+  constexpr size_type num_rows = 10000;
+  auto key_iter   = make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto value_iter = make_counting_transform_iterator(0, [](auto i) { return (i * 7) % 2000; });
+  fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(value_iter, value_iter + num_rows);
+
+  std::vector<std::unique_ptr<aggregation>> aggregations;
+  aggregations.push_back(make_approx_nunique_aggregation(12));
+
+  auto const key_batches   = cudf::slice(keys, {0, 4000, 4000, num_rows});
+  auto const value_batches = cudf::slice(vals, {0, 4000, 4000, num_rows});
+  std::vector<std::pair<std::unique_ptr<table>, std::unique_ptr<table>>> partials;
+  for (size_t i = 0; i < key_batches.size(); i++) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = value_batches[i];
+    requests[0].aggregations.push_back(aggregations[0]->clone());
+    groupby::groupby gb_obj(table_view({key_batches[i]}));
+    partials.push_back(gb_obj.aggregate_partial(requests));
+  }
+  auto const merged = groupby::merge_partial_aggregations(
+    {partials[0].first->view(), partials[1].first->view()},
+    {partials[0].second->view(), partials[1].second->view()},
+    aggregations);
+  auto const results = groupby::finalize_partial_aggregations(merged.second->view(), aggregations);
+
+  // Merging the sketches of the batches loses nothing over sketching all rows at once
+  fixed_width_column_wrapper<int32_t> expect_keys{0, 1, 2};
+  auto const expect = [&]() {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(aggregations[0]->clone());
+    requests[0].aggregations.push_back(make_median_aggregation());
+    groupby::groupby gb_obj(table_view({keys}));
+    return gb_obj.aggregate(requests);
+  }();
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), merged.first->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), expect.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expect.second[0].results[0], *results[0]);
+}
+
+TEST_F(groupby_approx_nunique_test, sketches)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals{5, 6, 5, 7};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_hyperloglog_aggregation(4));
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  auto const& sketches = *result.second[0].results[0];
+  EXPECT_EQ(sketches.type().id(), type_id::LIST);
+  EXPECT_EQ(sketches.size(), 2);
+  EXPECT_EQ(sketches.child(lists_column_view::child_column_index).size(), 2 * 16);
+
+  EXPECT_THROW(make_hyperloglog_aggregation(3), cudf::logic_error);
+  EXPECT_THROW(make_approx_nunique_aggregation(19), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+#include <cmath>
+
+namespace cudf {
+namespace test {
+struct groupby_approx_quantile_test : public cudf::test::BaseFixture {
+};
+
+using R = cudf::detail::target_type_t<int32_t, aggregation::APPROX_QUANTILE>;
+
+// clang-format off
+TEST_F(groupby_approx_quantile_test, basic)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<int32_t> vals { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // Every value of a small group is a centroid of its own, so the median is exact
+                                          //  { 1, 1, 1,   2, 2, 2, 2,   3, 3, 3}
+    fixed_width_column_wrapper<int32_t> expect_keys { 1,         2,            3      };
+                                          //  { 0, 3, 6,   1, 4, 5, 9,   2, 7, 8}
+    fixed_width_column_wrapper<R>       expect_vals(  {   3.,      4.5,          7.   });
+
+    test_single_agg(keys, vals, expect_keys, expect_vals,
+                    make_approx_quantile_aggregation({0.5}));
+}
+
+TEST_F(groupby_approx_quantile_test, null_values)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<int32_t> vals({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                             { 1, 0, 1, 1, 0, 1, 1, 0, 0, 0});
+
+                                          //  { 1, 1, 1,   2, 2, 2, 2,   3, 3, 3}
+    fixed_width_column_wrapper<int32_t> expect_keys { 1,         2,            3      };
+                                          //  { 0, 3, 6,   5,            2     }
+    fixed_width_column_wrapper<R>       expect_vals({ 0., 6.,    5., 5.,       2., 2. });
+
+    test_single_agg(keys, vals, expect_keys, expect_vals,
+                    make_approx_quantile_aggregation({0, 1}));
+}
+// clang-format on
+
+TEST_F(groupby_approx_quantile_test, all_null_group)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals({4, 5, 6}, {1, 0, 1});
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  fixed_width_column_wrapper<R> expect_vals({5., 0.}, {1, 0});
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, make_approx_quantile_aggregation({0.5}));
+}
+
+TEST_F(groupby_approx_quantile_test, empty_cols)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  fixed_width_column_wrapper<int32_t> vals{};
+
+  fixed_width_column_wrapper<int32_t> expect_keys{};
+  fixed_width_column_wrapper<R> expect_vals{};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, make_approx_quantile_aggregation({0.5}));
+}
+
+TEST_F(groupby_approx_quantile_test, many_values)
+{
+  constexpr size_type num_rows = 200000;
+  auto key_iter   = make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  auto value_iter = make_counting_transform_iterator(0, [](auto i) { return (i * 7919) % 100000; });
+  fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(value_iter, value_iter + num_rows);
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_approx_quantile_aggregation({0.5, 0.99}, 200));
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  // Every group holds about the values 0 to 99999 once, digested in at most 200 centroids
+  auto const estimates = to_host<R>(*result.second[0].results[0]).first;
+  ASSERT_EQ(estimates.size(), 4u);
+  for (size_t g = 0; g < 2; g++) {
+    EXPECT_LT(std::abs(estimates[2 * g] - 50000), 0.01 * 100000);
+    EXPECT_LT(std::abs(estimates[2 * g + 1] - 99000), 0.001 * 100000);
+  }
+}
+
+TEST_F(groupby_approx_quantile_test, merged_digests)
+{
+  constexpr size_type num_rows = 30000;
+  auto key_iter   = make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto value_iter = make_counting_transform_iterator(0, [](auto i) { return (i * 7) % 10000; });
+  fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(value_iter, value_iter + num_rows);
+
+  std::vector<std::unique_ptr<aggregation>> aggregations;
+  aggregations.push_back(make_approx_quantile_aggregation({0.01, 0.5, 0.99}, 100));
+
+  auto const key_batches   = cudf::slice(keys, {0, 12000, 12000, num_rows});
+  auto const value_batches = cudf::slice(vals, {0, 12000, 12000, num_rows});
+  std::vector<std::pair<std::unique_ptr<table>, std::unique_ptr<table>>> partials;
+  for (size_t i = 0; i < key_batches.size(); i++) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = value_batches[i];
+    requests[0].aggregations.push_back(aggregations[0]->clone());
+    groupby::groupby gb_obj(table_view({key_batches[i]}));
+    partials.push_back(gb_obj.aggregate_partial(requests));
+  }
+  auto const merged = groupby::merge_partial_aggregations(
+    {partials[0].first->view(), partials[1].first->view()},
+    {partials[0].second->view(), partials[1].second->view()},
+    aggregations);
+  auto const results = groupby::finalize_partial_aggregations(merged.second->view(), aggregations);
+
+  fixed_width_column_wrapper<int32_t> expect_keys{0, 1, 2};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), merged.first->view());
+
+  // The merged digests of every group, of the values 0 to 9999, stay within 100 centroids
+  auto const& digests = merged.second->get_column(0);
+  EXPECT_LE(digests.child(lists_column_view::child_column_index).size(), 3 * 2 * 100);
+
+  auto const estimates = to_host<R>(*results[0]).first;
+  ASSERT_EQ(estimates.size(), 9u);
+  for (size_t g = 0; g < 3; g++) {
+    EXPECT_LT(std::abs(estimates[3 * g] - 100), 0.002 * 10000);
+    EXPECT_LT(std::abs(estimates[3 * g + 1] - 5000), 0.02 * 10000);
+    EXPECT_LT(std::abs(estimates[3 * g + 2] - 9900), 0.002 * 10000);
+  }
+}
+
+TEST_F(groupby_approx_quantile_test, digests)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 2, 1};
+  fixed_width_column_wrapper<double> vals{5, 6, 5, 7, 1};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_tdigest_aggregation(1));
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  // A digest of a single centroid is the mean and the count of its group
+  fixed_width_column_wrapper<double> expect_centroids{11. / 3, 3., 6.5, 2.};
+  auto const& digests = *result.second[0].results[0];
+  EXPECT_EQ(digests.type().id(), type_id::LIST);
+  EXPECT_EQ(digests.size(), 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(digests.child(lists_column_view::child_column_index),
+                                 expect_centroids);
+
+  EXPECT_THROW(make_tdigest_aggregation(0), cudf::logic_error);
+  EXPECT_THROW(make_approx_quantile_aggregation({1.5}), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_key_index_test : public cudf::test::BaseFixture {
+};
+
+namespace {
+/// Sorts the keys and the first result of every request of a groupby by the keys
+std::unique_ptr<table> sorted_result(
+  std::pair<std::unique_ptr<table>, std::vector<groupby::aggregation_result>> const& result)
+{
+  std::vector<column_view> columns{result.first->get_column(0)};
+  for (auto const& r : result.second) { columns.push_back(r.results[0]->view()); }
+  auto const sort_order = sorted_order(result.first->view(), {}, {null_order::AFTER});
+  return gather(table_view(columns), *sort_order);
+}
+
+std::vector<groupby::aggregation_request> make_requests(column_view const& values,
+                                                        std::unique_ptr<aggregation>&& agg)
+{
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(std::move(agg));
+  return requests;
+}
+}  // namespace
+
+TEST_F(groupby_key_index_test, reused_across_requests)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4},
+                                           {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int32_t> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                           {1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1});
+
+  groupby::groupby indexed(table_view({keys}));
+  indexed.persist_key_index();
+  EXPECT_EQ(indexed.key_index_size(), 0u);
+
+  auto make_aggs = []() {
+    std::vector<std::unique_ptr<aggregation>> aggs;
+    aggs.push_back(make_sum_aggregation());
+    aggs.push_back(make_count_aggregation());
+    aggs.push_back(make_max_aggregation());
+    aggs.push_back(make_mean_aggregation());
+    aggs.push_back(make_variance_aggregation());
+    aggs.push_back(make_approx_nunique_aggregation());
+    return aggs;
+  };
+  auto aggs = make_aggs();
+  for (auto& agg : aggs) {
+    auto const expect = [&]() {
+      groupby::groupby gb_obj(table_view({keys}));
+      return sorted_result(gb_obj.aggregate(make_requests(vals, agg->clone())));
+    }();
+    auto const result = sorted_result(indexed.aggregate(make_requests(vals, std::move(agg))));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expect, *result);
+
+    // The groups of the 11 key rows, and of the 3 valid keys, are kept after the first request
+    EXPECT_EQ(indexed.key_index_size(), (11 + 3) * sizeof(size_type));
+  }
+
+  indexed.release_key_index();
+  EXPECT_EQ(indexed.key_index_size(), 0u);
+}
+
+TEST_F(groupby_key_index_test, null_keys_included)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 1, 2, 3}, {1, 0, 1, 0, 1});
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3, 4, 5};
+
+  fixed_width_column_wrapper<int32_t> expect_keys({1, 3, 2}, {1, 1, 0});
+  fixed_width_column_wrapper<int64_t> expect_sums{4, 5, 6};
+  fixed_width_column_wrapper<int32_t> expect_mins{1, 5, 2};
+
+  groupby::groupby gb_obj(table_view({keys}), null_policy::INCLUDE);
+  gb_obj.persist_key_index();
+  auto const sums = sorted_result(gb_obj.aggregate(make_requests(vals, make_sum_aggregation())));
+  auto const mins = sorted_result(gb_obj.aggregate(make_requests(vals, make_min_aggregation())));
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys, expect_sums}), *sums);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys, expect_mins}), *mins);
+}
+
+TEST_F(groupby_key_index_test, not_persisted)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3};
+
+  groupby::groupby gb_obj(table_view({keys}));
+  gb_obj.aggregate(make_requests(vals, make_sum_aggregation()));
+  EXPECT_EQ(gb_obj.key_index_size(), 0u);
+
+  // The sort-based implementation keeps its sort order of the keys
+  gb_obj.aggregate(make_requests(vals, make_median_aggregation()));
+  EXPECT_GT(gb_obj.key_index_size(), 0u);
+  gb_obj.release_key_index();
+  EXPECT_EQ(gb_obj.key_index_size(), 0u);
+}
+
+}  // namespace test
+}  // namespace cudf
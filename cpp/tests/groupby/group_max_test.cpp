@@ -169,5 +169,35 @@ TEST_F(groupby_max_string_test, zero_valid_values)
 }
 // clang-format on
 
+template <typename T>
+struct groupby_max_fixed_point_test : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(groupby_max_fixed_point_test, cudf::test::FixedPointTypes);
+
+TYPED_TEST(groupby_max_fixed_point_test, basic)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  auto const scale = numeric::scale_type{-2};
+  auto const vals_it =
+    make_counting_transform_iterator(0, [scale](auto i) { return V{i * 0.25, scale}; });
+  auto const valid_it = make_counting_transform_iterator(0, [](auto i) { return i != 5; });
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals(vals_it, vals_it + 10, valid_it);
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  auto const expect = std::vector<V>{V{1.5, scale}, V{2.25, scale}, V{2.0, scale}};
+  fixed_width_column_wrapper<V> expect_vals(expect.begin(), expect.end());
+
+  auto agg = cudf::make_max_aggregation();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_max_aggregation();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -63,6 +63,9 @@ TYPED_TEST(groupby_mean_test, basic)
 
     auto agg = cudf::make_mean_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_mean_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_mean_test, empty_cols)
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/multi_device.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_multi_device_test : public cudf::test::BaseFixture {
+  /// The current device listed three times, so that the partitions are exchanged between
+  /// "devices"
+  std::vector<device_resources> devices()
+  {
+    int device{0};
+    CUDA_TRY(cudaGetDevice(&device));
+    return std::vector<device_resources>(3, device_resources{device});
+  }
+};
+
+TEST_F(groupby_multi_device_test, same_as_aggregate)
+{
+  constexpr size_type num_rows = 10000;
+  auto key_iter   = make_counting_transform_iterator(0, [](auto i) { return (i * 7) % 1009; });
+  auto value_iter = make_counting_transform_iterator(0, [](auto i) { return i % 97; });
+  auto valid_iter = make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + num_rows, valid_iter);
+  fixed_width_column_wrapper<int32_t> vals(value_iter, value_iter + num_rows);
+
+  for (auto include_null_keys : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+    groupby::groupby gb_obj(table_view({keys}), include_null_keys);
+    auto const expect = sorted_result(gb_obj.aggregate(make_requests(vals)));
+    auto const result = gb_obj.multi_device_aggregate(make_requests(vals), devices());
+    ASSERT_EQ(result.num_parts(), 3);
+    // Every group is aggregated on exactly one device
+    EXPECT_EQ(result.num_rows(), expect->num_rows());
+    for (size_type i = 0; i < result.num_parts(); ++i) { EXPECT_GT(result.part(i).num_rows(), 0); }
+
+    auto const combined = result.combine(result.device(0));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expect, *sorted_result(combined->view()));
+  }
+}
+
+TEST_F(groupby_multi_device_test, empty_cols)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  fixed_width_column_wrapper<int32_t> vals{};
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.multi_device_aggregate(make_requests(vals), devices());
+  EXPECT_EQ(result.num_parts(), 3);
+  EXPECT_EQ(result.num_rows(), 0);
+  // The keys, then the four aggregations of the two requests
+  EXPECT_EQ(result.part(0).num_columns(), 5);
+}
+
+TEST_F(groupby_multi_device_test, invalid_arguments)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3};
+
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.multi_device_aggregate(make_requests(vals), devices()), cudf::logic_error);
+  EXPECT_THROW(gb_obj.multi_device_aggregate(make_requests(column_view(keys)), {}),
+               cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
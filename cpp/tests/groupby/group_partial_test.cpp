@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace test {
+namespace {
+std::vector<std::unique_ptr<aggregation>> clone_all(
+  std::vector<std::unique_ptr<aggregation>> const& aggregations)
+{
+  std::vector<std::unique_ptr<aggregation>> clones;
+  for (auto const& agg : aggregations) { clones.push_back(agg->clone()); }
+  return clones;
+}
+
+// Partial state of every batch of rows `[bounds[2i], bounds[2i + 1])`
+std::vector<std::pair<std::unique_ptr<table>, std::unique_ptr<table>>> aggregate_batches(
+  column_view const& keys,
+  column_view const& values,
+  std::vector<size_type> const& bounds,
+  std::vector<std::unique_ptr<aggregation>> const& aggregations,
+  null_policy include_null_keys = null_policy::EXCLUDE)
+{
+  auto const key_batches   = cudf::slice(keys, bounds);
+  auto const value_batches = cudf::slice(values, bounds);
+
+  std::vector<std::pair<std::unique_ptr<table>, std::unique_ptr<table>>> partials;
+  for (size_t i = 0; i < key_batches.size(); i++) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values       = value_batches[i];
+    requests[0].aggregations = clone_all(aggregations);
+    groupby::groupby gb_obj(table_view({key_batches[i]}), include_null_keys);
+    partials.push_back(gb_obj.aggregate_partial(requests));
+  }
+  return partials;
+}
+
+}  // namespace
+
+struct groupby_partial_test : public cudf::test::BaseFixture {
+};
+
+// clang-format off
+TEST_F(groupby_partial_test, merges_batches)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 3, 1, 2,   2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<int32_t> vals { 0, 1, 2, 3, 4,   5, 6, 7, 8, 9};
+
+    std::vector<std::unique_ptr<aggregation>> aggregations;
+    aggregations.push_back(make_sum_aggregation());
+    aggregations.push_back(make_min_aggregation());
+    aggregations.push_back(make_max_aggregation());
+    aggregations.push_back(make_count_aggregation());
+    aggregations.push_back(make_mean_aggregation());
+    aggregations.push_back(make_variance_aggregation());
+    aggregations.push_back(make_std_aggregation());
+
+    auto const partials = aggregate_batches(keys, vals, {0, 5, 5, 10}, aggregations);
+    auto const merged   = groupby::merge_partial_aggregations(
+      {partials[0].first->view(), partials[1].first->view()},
+      {partials[0].second->view(), partials[1].second->view()},
+      aggregations);
+    auto const results = groupby::finalize_partial_aggregations(merged.second->view(),
+                                                                aggregations);
+
+                                              //  { 0, 3, 6,  1, 4, 5, 9,  2, 7, 8}
+    fixed_width_column_wrapper<int32_t> expect_keys { 1,        2,           3      };
+    fixed_width_column_wrapper<int64_t> expect_sum  { 9,        19,          17     };
+    fixed_width_column_wrapper<int32_t> expect_min  { 0,        1,           2      };
+    fixed_width_column_wrapper<int32_t> expect_max  { 6,        9,           8      };
+    fixed_width_column_wrapper<int32_t> expect_count{ 3,        4,           3      };
+    fixed_width_column_wrapper<double>  expect_mean { 3.,       19./4,       17./3  };
+    fixed_width_column_wrapper<double>  expect_var  { 9.,       131./12,     31./3  };
+    fixed_width_column_wrapper<double>  expect_std  { 3., std::sqrt(131./12), std::sqrt(31./3)};
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), merged.first->view());
+    ASSERT_EQ(results.size(), aggregations.size());
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_sum, *results[0], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_min, *results[1], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_max, *results[2], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_count, *results[3], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_mean, *results[4], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_var, *results[5], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_std, *results[6], true);
+}
+
+TEST_F(groupby_partial_test, merges_incrementally_with_nulls)
+{
+    fixed_width_column_wrapper<int32_t> keys({ 1, 0, 2, 1, 3,   2, 0, 1},
+                                             { 1, 0, 1, 1, 1,   1, 0, 1});
+    fixed_width_column_wrapper<int32_t> vals({ 4, 1, 0, 2, 5,   6, 3, 0},
+                                             { 1, 1, 0, 1, 0,   1, 1, 0});
+
+    std::vector<std::unique_ptr<aggregation>> aggregations;
+    aggregations.push_back(make_sum_aggregation());
+    aggregations.push_back(make_count_aggregation());
+    aggregations.push_back(make_mean_aggregation());
+    aggregations.push_back(make_variance_aggregation());
+
+    auto const partials =
+      aggregate_batches(keys, vals, {0, 5, 5, 8}, aggregations, null_policy::INCLUDE);
+
+    // The running state is merged with one batch at a time
+    auto running = groupby::merge_partial_aggregations(
+      {partials[0].first->view()}, {partials[0].second->view()}, aggregations);
+    running = groupby::merge_partial_aggregations(
+      {running.first->view(), partials[1].first->view()},
+      {running.second->view(), partials[1].second->view()},
+      aggregations);
+    auto const results = groupby::finalize_partial_aggregations(running.second->view(),
+                                                                aggregations);
+
+                                                  //  { 4, 2,   -, 6,   -,   1, 3}
+    fixed_width_column_wrapper<int32_t> expect_keys ({ 1,      2,      3,   0   }, { 1, 1, 1, 0});
+    fixed_width_column_wrapper<int64_t> expect_sum  ({ 6,      6,      0,   4   }, { 1, 1, 0, 1});
+    fixed_width_column_wrapper<int32_t> expect_count { 2,      1,      0,   2   };
+    fixed_width_column_wrapper<double>  expect_mean ({ 3.,     6.,     0.,  2.  }, { 1, 1, 0, 1});
+    fixed_width_column_wrapper<double>  expect_var  ({ 2.,     0.,     0.,  2.  }, { 1, 0, 0, 1});
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), running.first->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_sum, *results[0], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_count, *results[1], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_mean, *results[2], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_var, *results[3], true);
+}
+// clang-format on
+
+TEST_F(groupby_partial_test, unsupported_aggregation)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals{3, 4, 5};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_median_aggregation());
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.aggregate_partial(requests), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
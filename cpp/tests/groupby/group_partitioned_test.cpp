@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_partitioned_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_partitioned_test, same_as_aggregate)
+{
+  constexpr size_type num_rows = 10000;
+  auto key_iter   = make_counting_transform_iterator(0, [](auto i) { return (i * 7) % 1009; });
+  auto value_iter = make_counting_transform_iterator(0, [](auto i) { return i % 97; });
+  auto valid_iter = make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + num_rows, valid_iter);
+  fixed_width_column_wrapper<int32_t> vals(value_iter, value_iter + num_rows);
+
+  for (auto include_null_keys : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+    groupby::groupby gb_obj(table_view({keys}), include_null_keys);
+    auto const expect = sorted_result(gb_obj.aggregate(make_requests(vals)));
+    for (size_type num_partitions : {0, 1, 7, 16}) {
+      auto const result =
+        sorted_result(gb_obj.partitioned_aggregate(make_requests(vals), num_partitions));
+      CUDF_TEST_EXPECT_TABLES_EQUAL(*expect, *result);
+    }
+  }
+}
+
+TEST_F(groupby_partitioned_test, more_partitions_than_groups)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3, 4, 5};
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  fixed_width_column_wrapper<int64_t> expect_sums{9, 6};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = sorted_result(gb_obj.partitioned_aggregate(requests, 5));
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys, expect_sums}), *result);
+}
+
+TEST_F(groupby_partitioned_test, empty_cols)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  fixed_width_column_wrapper<int32_t> vals{};
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.partitioned_aggregate(make_requests(vals), 4);
+  EXPECT_EQ(result.first->num_rows(), 0);
+  EXPECT_EQ(result.second.size(), 2u);
+  EXPECT_EQ(result.second[1].results.size(), 2u);
+}
+
+TEST_F(groupby_partitioned_test, invalid_arguments)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3};
+
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.partitioned_aggregate(make_requests(vals), 2), cudf::logic_error);
+  EXPECT_THROW(gb_obj.partitioned_aggregate(make_requests(column_view(keys)), -1),
+               cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
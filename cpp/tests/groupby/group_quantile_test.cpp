@@ -17,7 +17,9 @@
 #include <tests/groupby/groupby_test_util.hpp>
 
 #include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
@@ -125,6 +127,46 @@ TYPED_TEST(groupby_quantile_test, null_keys_and_values)
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
 
+TYPED_TEST(groupby_quantile_test, several_requests)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::QUANTILE>;
+    using N = cudf::detail::target_type_t<V, aggregation::NUNIQUE>;
+
+    // The values of all requests are sorted within groups together
+    fixed_width_column_wrapper<K> keys(       { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4},
+                                              { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+    fixed_width_column_wrapper<V> vals1(      { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                              { 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+    fixed_width_column_wrapper<V> vals2       { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 5};
+
+    fixed_width_column_wrapper<K> expect_keys({ 1,        2,         3,       4}, all_valid());
+                                          //  { 3, 6,     1, 4, 9,   2, 8,    -}
+    fixed_width_column_wrapper<R> expect_vals1({ 4.5,       4.,       5.,    0.},
+                                               {  1,         1,        1,     0});
+                                          //  { 9, 6, 3,  8, 5, 4, 0,  7, 1,   5}
+    fixed_width_column_wrapper<R> expect_vals2({  6.,        4.5,       4.,    5.},
+                                               all_valid());
+    fixed_width_column_wrapper<N> expect_nunique{ 2,        3,         2,     0};
+
+    std::vector<groupby::aggregation_request> requests(3);
+    requests[0].values = vals1;
+    requests[0].aggregations.push_back(make_median_aggregation());
+    requests[1].values = vals2;
+    requests[1].aggregations.push_back(make_quantile_aggregation({0.5}));
+    requests[2].values = vals1;
+    requests[2].aggregations.push_back(make_nunique_aggregation());
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals1, *result.second[0].results[0], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals2, *result.second[1].results[0], true);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_nunique, *result.second[2].results[0], true);
+}
+
 TYPED_TEST(groupby_quantile_test, multiple_quantile)
 {
     using K = int32_t;
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+struct groupby_scan_test : public cudf::test::BaseFixture {
+};
+
+// clang-format off
+TEST_F(groupby_scan_test, basic)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 1, 3, 1};
+    fixed_width_column_wrapper<int32_t> vals { 3, 1, 4, 9, 2};
+
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(make_sum_aggregation());
+    requests[0].aggregations.push_back(make_min_aggregation());
+    requests[0].aggregations.push_back(make_max_aggregation());
+    requests[0].aggregations.push_back(make_row_number_aggregation());
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto const result = gb_obj.scan(requests);
+
+    fixed_width_column_wrapper<int32_t>   expect_keys { 1, 1, 1,  2,  3};
+    fixed_width_column_wrapper<int64_t>   expect_sum  { 3, 7, 9,  1,  9};
+    fixed_width_column_wrapper<int32_t>   expect_min  { 3, 3, 2,  1,  9};
+    fixed_width_column_wrapper<int32_t>   expect_max  { 3, 4, 4,  1,  9};
+    fixed_width_column_wrapper<size_type> expect_rank { 1, 2, 3,  1,  1};
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+    ASSERT_EQ(result.second[0].results.size(), 4u);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_sum, *result.second[0].results[0]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_min, *result.second[0].results[1]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_max, *result.second[0].results[2]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_rank, *result.second[0].results[3]);
+}
+
+TEST_F(groupby_scan_test, null_keys_and_values)
+{
+    fixed_width_column_wrapper<int32_t> keys({ 1, 2, 1, 0, 2, 1},
+                                             { 1, 1, 1, 0, 1, 1});
+    fixed_width_column_wrapper<int32_t> vals({ 5, 1, 0, 7, 3, 2},
+                                             { 1, 1, 0, 1, 1, 1});
+
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(make_sum_aggregation());
+    requests[0].aggregations.push_back(make_count_aggregation());
+    requests[0].aggregations.push_back(make_count_aggregation(null_policy::INCLUDE));
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto const result = gb_obj.scan(requests);
+
+                                                  //  { 5, -, 2,  1, 3}
+    fixed_width_column_wrapper<int32_t>   expect_keys  { 1, 1, 1,  2, 2};
+    fixed_width_column_wrapper<int64_t>   expect_sum  ({ 5, 5, 7,  1, 4}, { 1, 0, 1,  1, 1});
+    fixed_width_column_wrapper<size_type> expect_count { 1, 1, 2,  1, 2};
+    fixed_width_column_wrapper<size_type> expect_all   { 1, 2, 3,  1, 2};
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_sum, *result.second[0].results[0]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_count, *result.second[0].results[1]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_all, *result.second[0].results[2]);
+}
+
+TEST_F(groupby_scan_test, rank)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 1, 2, 1, 1};
+    fixed_width_column_wrapper<int32_t> vals { 5, 3, 2, 3, 5, 7};
+
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(make_rank_aggregation(rank_method::MIN));
+    requests[0].aggregations.push_back(
+      make_rank_aggregation(rank_method::DENSE, order::DESCENDING));
+    requests[0].aggregations.push_back(make_rank_aggregation(rank_method::AVERAGE));
+    requests[0].aggregations.push_back(make_rank_aggregation(
+      rank_method::MAX, order::ASCENDING, null_policy::EXCLUDE, null_order::AFTER, true));
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto const result = gb_obj.scan(requests);
+
+                                                   // { 5, 2, 5, 7, 3, 3}
+    fixed_width_column_wrapper<int32_t>   expect_keys   { 1, 1, 1, 1, 2, 2};
+    fixed_width_column_wrapper<size_type> expect_min    { 2, 1, 2, 4, 1, 1};
+    fixed_width_column_wrapper<size_type> expect_dense  { 2, 3, 2, 1, 1, 1};
+    fixed_width_column_wrapper<double>    expect_avg    { 2.5, 1, 2.5, 4, 1.5, 1.5};
+    fixed_width_column_wrapper<double>    expect_pct    { 0.75, 0.25, 0.75, 1, 1, 1};
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_min, *result.second[0].results[0]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_dense, *result.second[0].results[1]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_avg, *result.second[0].results[2]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_pct, *result.second[0].results[3]);
+}
+
+TEST_F(groupby_scan_test, rank_with_nulls)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 1, 1, 1};
+    fixed_width_column_wrapper<int32_t> vals({ 4, 0, 1, 4},
+                                             { 1, 0, 1, 1});
+
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(make_rank_aggregation(rank_method::FIRST));
+    requests[0].aggregations.push_back(make_rank_aggregation(
+      rank_method::FIRST, order::ASCENDING, null_policy::INCLUDE, null_order::BEFORE));
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto const result = gb_obj.scan(requests);
+
+    fixed_width_column_wrapper<size_type> expect_exclude({ 2, 4, 1, 3}, { 1, 0, 1, 1});
+    fixed_width_column_wrapper<size_type> expect_include { 3, 1, 2, 4};
+
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_exclude, *result.second[0].results[0]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_include, *result.second[0].results[1]);
+}
+// clang-format on
+
+TEST_F(groupby_scan_test, unsupported_aggregation)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals{3, 4, 5};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_mean_aggregation());
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.scan(requests), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -134,7 +134,62 @@ TYPED_TEST(groupby_sum_test, null_keys_and_values)
     auto agg2 = cudf::make_sum_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
+TYPED_TEST(groupby_sum_test, many_rows_few_keys)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+    constexpr size_type num_rows = 10000;
+    auto key_it   = make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+    auto val_it   = make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+    auto valid_it = make_counting_transform_iterator(0, [](auto i) { return i % 5 != 4; });
+
+    fixed_width_column_wrapper<K> keys(key_it, key_it + num_rows);
+    fixed_width_column_wrapper<V, int> vals(val_it, val_it + num_rows, valid_it);
+
+    // Key k aggregates 1000 values k and 1000 values k + 5, and key 4 only null values
+    fixed_width_column_wrapper<K> expect_keys { 0, 1, 2, 3, 4 };
+    fixed_width_column_wrapper<R, int> expect_vals({ 5000, 7000, 9000, 11000, 0 },
+                                                   { 1,    1,    1,    1,     0 });
+
+    auto agg = cudf::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
 // clang-format on
 
+template <typename T>
+struct groupby_sum_fixed_point_test : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(groupby_sum_fixed_point_test, cudf::test::FixedPointTypes);
+
+TYPED_TEST(groupby_sum_fixed_point_test, basic)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  auto const scale = numeric::scale_type{-2};
+  auto const vals_it =
+    make_counting_transform_iterator(0, [scale](auto i) { return V{i * 0.25, scale}; });
+  auto const valid_it = make_counting_transform_iterator(0, [](auto i) { return i != 5; });
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals(vals_it, vals_it + 10, valid_it);
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  auto const expect = std::vector<V>{V{2.25, scale}, V{3.5, scale}, V{4.25, scale}};
+  fixed_width_column_wrapper<V> expect_vals(expect.begin(), expect.end());
+
+  auto agg = cudf::make_sum_aggregation();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_sum_aggregation();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
 }  // namespace test
 }  // namespace cudf
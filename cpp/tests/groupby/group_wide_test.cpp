@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_wide_test : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::vector<std::unique_ptr<aggregation>> make_aggregations()
+{
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(make_sum_aggregation());
+  aggs.push_back(make_min_aggregation());
+  aggs.push_back(make_max_aggregation());
+  aggs.push_back(make_count_aggregation());
+  aggs.push_back(make_count_aggregation(null_policy::INCLUDE));
+  aggs.push_back(make_sum_of_squares_aggregation());
+  aggs.push_back(make_mean_aggregation());
+  aggs.push_back(make_variance_aggregation());
+  aggs.push_back(make_std_aggregation());
+  return aggs;
+}
+}  // namespace
+
+// Requests of many aggregations find the group of every row once and then
+// aggregate every column from these groups
+TEST_F(groupby_wide_test, same_as_narrow_requests)
+{
+  constexpr size_type num_rows = 10000;
+  auto key_iter    = make_counting_transform_iterator(0, [](auto i) { return (i * 7) % 2003; });
+  auto key_valid   = make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  auto value_iter  = make_counting_transform_iterator(0, [](auto i) { return (i * 13) % 101; });
+  auto value_valid = make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + num_rows, key_valid);
+  fixed_width_column_wrapper<int32_t> ints(value_iter, value_iter + num_rows, value_valid);
+  fixed_width_column_wrapper<double> doubles(value_iter, value_iter + num_rows);
+
+  for (auto include_null_keys : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+    groupby::groupby gb_obj(table_view({keys}), include_null_keys);
+
+    // Every aggregation on its own, too narrow to take the wide path
+    std::vector<std::unique_ptr<table>> narrow_results;
+    std::vector<column_view> expect_columns;
+    for (column_view const& values : {column_view(ints), column_view(doubles)}) {
+      for (auto& agg : make_aggregations()) {
+        std::vector<groupby::aggregation_request> requests(1);
+        requests[0].values = values;
+        requests[0].aggregations.push_back(std::move(agg));
+        narrow_results.push_back(sorted_result(gb_obj.aggregate(requests)));
+        auto const narrow_result = narrow_results.back()->view();
+        if (expect_columns.empty()) { expect_columns.push_back(narrow_result.column(0)); }
+        expect_columns.push_back(narrow_result.column(1));
+      }
+    }
+
+    std::vector<groupby::aggregation_request> wide_requests(2);
+    wide_requests[0].values       = ints;
+    wide_requests[0].aggregations = make_aggregations();
+    wide_requests[1].values       = doubles;
+    wide_requests[1].aggregations = make_aggregations();
+    auto const result = sorted_result(gb_obj.aggregate(wide_requests));
+
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(table_view(expect_columns), *result);
+  }
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -21,6 +21,7 @@
 #include <tests/utilities/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/dictionary/encode.hpp>
 
 namespace cudf {
 namespace test {
@@ -193,6 +194,54 @@ TEST_F(groupby_string_keys_test, basic)
     auto agg = cudf::make_sum_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
+
+struct groupby_dictionary_keys_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_dictionary_keys_test, basic)
+{
+    using V = int32_t;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+    strings_column_wrapper        keys       ({ "aaa", "año", "₹1", "aaa", "año", "",  "aaa", "₹1", "₹1", "año"},
+                                              {     1,     1,    1,     1,     1,   0,     1,    1,    1,     1});
+    fixed_width_column_wrapper<V> vals        {     0,     1,    2,     3,     4,   5,     6,    7,    8,     9};
+
+    strings_column_wrapper        expect_keys({ "aaa", "año", "₹1" });
+    fixed_width_column_wrapper<R> expect_vals {     9,    14,   17 };
+
+    auto dictionary_keys        = cudf::dictionary::encode(keys);
+    auto expect_dictionary_keys = cudf::dictionary::encode(expect_keys);
+
+    auto agg = cudf::make_sum_aggregation();
+    test_single_agg(*dictionary_keys, vals, *expect_dictionary_keys, expect_vals, std::move(agg));
+}
+
+struct groupby_struct_keys_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_struct_keys_test, basic)
+{
+    using V = int32_t;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+    fixed_width_column_wrapper<int32_t> ints       ({   1,   2,   1,   0,   2,   2,   0,   1},
+                                                    {   1,   1,   1,   0,   1,   1,   0,   1});
+    strings_column_wrapper              strings    ({ "a", "b", "a", "b", "b", "x", "b", "c"});
+    structs_column_wrapper              keys       ({ ints, strings },
+                                                    {   1,   1,   1,   1,   1,   0,   1,   1});
+    fixed_width_column_wrapper<V>       vals        {   0,   1,   2,   3,   4,   5,   6,   7};
+
+    // a null field of a valid struct key is a value of the key, unlike a null struct key
+    fixed_width_column_wrapper<int32_t> expect_ints   ({   1,   1,   2,   0}, {1, 1, 1, 0});
+    strings_column_wrapper              expect_strings({ "a", "c", "b", "b"});
+    structs_column_wrapper              expect_keys   ({ expect_ints, expect_strings });
+    fixed_width_column_wrapper<R>       expect_vals    {   2,   7,   5,   9};
+
+    auto agg = cudf::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    agg = cudf::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg), force_use_sort_impl::YES);
+}
 // clang-format on
 
 }  // namespace test
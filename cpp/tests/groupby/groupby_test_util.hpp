@@ -27,6 +27,10 @@
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace cudf {
 namespace test {
 enum class force_use_sort_impl : bool { NO, YES };
@@ -98,6 +102,43 @@ inline void test_single_agg(column_view const& keys,
   }
 }
 
+/**
+ * @brief Sorts a table of the keys of a groupby, followed by its results, by the first key column
+ */
+inline std::unique_ptr<table> sorted_result(table_view const& result)
+{
+  auto const sort_order = sorted_order(result.select({0}), {}, {null_order::AFTER});
+  return gather(result, *sort_order);
+}
+
+/**
+ * @brief Sorts the keys and all results of a groupby by the first key column
+ */
+inline std::unique_ptr<table> sorted_result(
+  std::pair<std::unique_ptr<table>, std::vector<groupby::aggregation_result>> const& result)
+{
+  std::vector<column_view> columns{result.first->get_column(0)};
+  for (auto const& r : result.second) {
+    for (auto const& col : r.results) { columns.push_back(col->view()); }
+  }
+  return sorted_result(table_view(columns));
+}
+
+/**
+ * @brief Returns two requests on `values`, of a SUM and a MEAN, and of a COUNT and a MEDIAN
+ */
+inline std::vector<groupby::aggregation_request> make_requests(column_view const& values)
+{
+  std::vector<groupby::aggregation_request> requests(2);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  requests[0].aggregations.push_back(make_mean_aggregation());
+  requests[1].values = values;
+  requests[1].aggregations.push_back(make_count_aggregation());
+  requests[1].aggregations.push_back(make_median_aggregation());
+  return requests;
+}
+
 inline auto all_valid()
 {
   auto all_valid = make_counting_transform_iterator(0, [](auto i) { return true; });
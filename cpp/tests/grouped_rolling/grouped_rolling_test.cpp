@@ -23,6 +23,7 @@
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/rolling.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <src/rolling/rolling_detail.hpp>
@@ -30,6 +31,8 @@
 #include <thrust/iterator/constant_iterator.h>
 
 #include <algorithm>
+#include <limits>
+#include <numeric>
 #include <vector>
 
 using cudf::bitmask_type;
@@ -584,6 +587,34 @@ TYPED_TEST(GroupedRollingTest, SimplePartitionedStaticWindowWithNoGroupKeys)
     grouping_keys, input, expected_group_offsets, preceding_window, following_window, 1);
 }
 
+// windows larger than some of the groups, with some invalid rows
+TYPED_TEST(GroupedRollingTest, LargeWindowsWithGroupKeys)
+{
+  const size_type DATA_SIZE{1000};
+  std::vector<int32_t> col_data(DATA_SIZE);
+  std::iota(col_data.begin(), col_data.end(), 0);
+  std::vector<bool> col_mask(DATA_SIZE);
+  std::generate(col_mask.begin(), col_mask.end(), [i = 0]() mutable { return i++ % 7 != 0; });
+  fixed_width_column_wrapper<TypeParam, int32_t> input(
+    col_data.begin(), col_data.end(), col_mask.begin());
+
+  // 3 groups: [0, 100), [100, 550), [550, 1000), smaller and larger than the windows
+  std::vector<int64_t> key_vec(DATA_SIZE);
+  std::generate(key_vec.begin(), key_vec.end(), [i = 0]() mutable {
+    auto const row = i++;
+    return row < 100 ? 0 : (row < 550 ? 1 : 2);
+  });
+  const fixed_width_column_wrapper<TypeParam, int64_t> key(key_vec.begin(), key_vec.end());
+  const cudf::table_view grouping_keys{std::vector<cudf::column_view>{key}};
+
+  size_type preceding_window = 150;
+  size_type following_window = 50;
+  std::vector<size_type> expected_group_offsets{0, 100, 550, DATA_SIZE};
+
+  this->run_test_col_agg(
+    grouping_keys, input, expected_group_offsets, preceding_window, following_window, 1);
+}
+
 // all rows are invalid
 TYPED_TEST(GroupedRollingTest, AllInvalid)
 {
@@ -1235,4 +1266,159 @@ TYPED_TEST(GroupedTimeRangeRollingTest, SimplePartitionedStaticWindowsWithNoGrou
                          1);
 }
 
+class GroupedRangeRollingTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GroupedRangeRollingTest, IntegerOrderByWithGroupKeys)
+{
+  fixed_width_column_wrapper<int32_t> input{1, 1, 1, 1, 1, 1, 1, 1};
+  fixed_width_column_wrapper<int32_t> key{0, 0, 0, 0, 0, 1, 1, 1};
+  const cudf::table_view grouping_keys{std::vector<cudf::column_view>{key}};
+  cudf::numeric_scalar<int64_t> preceding{1};
+  cudf::numeric_scalar<int64_t> following{2};
+
+  fixed_width_column_wrapper<int64_t> ascending{1, 2, 4, 5, 9, 1, 3, 3};
+  auto result = cudf::grouped_range_rolling_window(grouping_keys,
+                                                   ascending,
+                                                   cudf::order::ASCENDING,
+                                                   input,
+                                                   preceding,
+                                                   following,
+                                                   1,
+                                                   cudf::make_count_aggregation());
+  cudf::test::expect_columns_equivalent(
+    *result, fixed_width_column_wrapper<size_type>{2, 3, 2, 2, 1, 3, 2, 2});
+
+  fixed_width_column_wrapper<int64_t> descending{9, 5, 4, 2, 1, 3, 3, 1};
+  result = cudf::grouped_range_rolling_window(grouping_keys,
+                                              descending,
+                                              cudf::order::DESCENDING,
+                                              input,
+                                              preceding,
+                                              following,
+                                              1,
+                                              cudf::make_count_aggregation());
+  cudf::test::expect_columns_equivalent(
+    *result, fixed_width_column_wrapper<size_type>{1, 2, 3, 2, 2, 3, 3, 1});
+
+  // Unbounded preceding window, which must not overflow.
+  cudf::numeric_scalar<int64_t> unbounded{std::numeric_limits<int64_t>::max()};
+  cudf::numeric_scalar<int64_t> current_row{0};
+  result = cudf::grouped_range_rolling_window(grouping_keys,
+                                              ascending,
+                                              cudf::order::ASCENDING,
+                                              input,
+                                              unbounded,
+                                              current_row,
+                                              1,
+                                              cudf::make_count_aggregation());
+  cudf::test::expect_columns_equivalent(
+    *result, fixed_width_column_wrapper<size_type>{1, 2, 3, 4, 5, 1, 2, 3});
+}
+
+TEST_F(GroupedRangeRollingTest, NanosecondTimestampsWithNoGroupKeys)
+{
+  fixed_width_column_wrapper<int32_t> input{10, 20, 30, 40, 50};
+  const cudf::table_view grouping_keys{std::vector<cudf::column_view>{}};
+  fixed_width_column_wrapper<cudf::timestamp_ns, cudf::timestamp_ns::rep> timestamps{
+    0, 1000, 1500, 4000, 4001};
+  cudf::duration_scalar<cudf::duration_ns> preceding{cudf::duration_ns{1000}};
+  cudf::duration_scalar<cudf::duration_ns> following{cudf::duration_ns{0}};
+
+  auto result = cudf::grouped_range_rolling_window(grouping_keys,
+                                                   timestamps,
+                                                   cudf::order::ASCENDING,
+                                                   input,
+                                                   preceding,
+                                                   following,
+                                                   1,
+                                                   cudf::make_max_aggregation());
+  cudf::test::expect_columns_equivalent(*result,
+                                        fixed_width_column_wrapper<int32_t>{10, 20, 30, 40, 50});
+
+  result = cudf::grouped_range_rolling_window(grouping_keys,
+                                              timestamps,
+                                              cudf::order::ASCENDING,
+                                              input,
+                                              preceding,
+                                              following,
+                                              2,
+                                              cudf::make_min_aggregation());
+  cudf::test::expect_columns_equivalent(
+    *result, fixed_width_column_wrapper<int32_t>{{0, 10, 20, 0, 40}, {0, 1, 1, 0, 1}});
+}
+
+TEST_F(GroupedRangeRollingTest, MultipleAggregations)
+{
+  fixed_width_column_wrapper<int32_t> input{{1, 2, 3, 4, 5, 6, 7, 8}, {1, 1, 0, 1, 1, 1, 0, 1}};
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 1, 1, 2, 2, 2};
+  fixed_width_column_wrapper<int64_t> orderby{1, 2, 4, 5, 9, 1, 3, 3};
+  fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep> days{
+    1, 2, 4, 5, 9, 1, 3, 3};
+  const cudf::table_view grouping_keys{std::vector<cudf::column_view>{keys}};
+  cudf::numeric_scalar<int64_t> preceding{1};
+  cudf::numeric_scalar<int64_t> following{2};
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_count_aggregation());
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+  aggs.push_back(cudf::make_row_number_aggregation());
+  aggs.push_back(cudf::make_sum_aggregation());
+
+  // every result is the one of the aggregation alone
+  auto const ranges = cudf::grouped_range_rolling_window(
+    grouping_keys, orderby, cudf::order::ASCENDING, input, preceding, following, 2, aggs);
+  auto const time_ranges = cudf::grouped_time_range_rolling_window(
+    grouping_keys, days, cudf::order::ASCENDING, input, 1, 2, 2, aggs);
+  auto const rows = cudf::grouped_rolling_window(grouping_keys, input, 2, 1, 2, aggs);
+  ASSERT_EQ(aggs.size(), ranges.size());
+  ASSERT_EQ(aggs.size(), time_ranges.size());
+  ASSERT_EQ(aggs.size(), rows.size());
+  for (size_t i = 0; i < aggs.size(); ++i) {
+    cudf::test::expect_columns_equal(
+      *ranges[i],
+      *cudf::grouped_range_rolling_window(
+        grouping_keys, orderby, cudf::order::ASCENDING, input, preceding, following, 2, aggs[i]));
+    cudf::test::expect_columns_equal(
+      *time_ranges[i],
+      *cudf::grouped_time_range_rolling_window(
+        grouping_keys, days, cudf::order::ASCENDING, input, 1, 2, 2, aggs[i]));
+    cudf::test::expect_columns_equal(
+      *rows[i], *cudf::grouped_rolling_window(grouping_keys, input, 2, 1, 2, aggs[i]));
+  }
+}
+
+TEST_F(GroupedRangeRollingTest, InvalidRangeBounds)
+{
+  fixed_width_column_wrapper<int32_t> input{1, 1, 1};
+  fixed_width_column_wrapper<int64_t> orderby{1, 2, 3};
+  const cudf::table_view grouping_keys{std::vector<cudf::column_view>{}};
+  cudf::numeric_scalar<int64_t> bound{1};
+  cudf::numeric_scalar<int32_t> narrow_bound{1};
+  cudf::numeric_scalar<int64_t> negative_bound{-1};
+
+  EXPECT_THROW(cudf::grouped_range_rolling_window(grouping_keys,
+                                                  orderby,
+                                                  cudf::order::ASCENDING,
+                                                  input,
+                                                  narrow_bound,
+                                                  bound,
+                                                  1,
+                                                  cudf::make_count_aggregation()),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::grouped_range_rolling_window(grouping_keys,
+                                                  orderby,
+                                                  cudf::order::ASCENDING,
+                                                  input,
+                                                  bound,
+                                                  negative_bound,
+                                                  1,
+                                                  cudf::make_count_aggregation()),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
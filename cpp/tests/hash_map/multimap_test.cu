@@ -95,7 +95,9 @@ TYPED_TEST(MultimapTest, CheckUnusedValues)
 {
   EXPECT_EQ(this->the_map->get_unused_key(), this->unused_key);
 
-  auto begin = this->the_map->begin();
-  EXPECT_EQ(begin->first, this->unused_key);
-  EXPECT_EQ(begin->second, this->unused_value);
+  // the storage is device memory
+  typename TestFixture::multimap_type::value_type first;
+  CUDA_TRY(cudaMemcpy(&first, &*this->the_map->begin(), sizeof(first), cudaMemcpyDeviceToHost));
+  EXPECT_EQ(first.first, this->unused_key);
+  EXPECT_EQ(first.second, this->unused_value);
 }
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/types.hpp>
+#include <hash/open_addressing_map.cuh>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <gtest/gtest.h>
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+
+#include <cooperative_groups.h>
+
+#include <limits>
+#include <vector>
+
+namespace {
+constexpr int tile_size{cudf::detail::DEFAULT_PROBE_TILE_SIZE};
+constexpr int block_size{128};
+
+using set_type = cudf::detail::open_addressing_map<int32_t, void>;
+using map_type = cudf::detail::open_addressing_map<int32_t, int32_t>;
+
+struct modulo_equal {
+  int32_t modulus;
+  __device__ bool operator()(int32_t lhs, int32_t rhs) const
+  {
+    return lhs % modulus == rhs % modulus;
+  }
+};
+
+// Every key `i` is inserted with the hash of `i % modulus`, as a groupby inserts row indices
+__global__ void insert_or_find_keys(set_type::device_view set,
+                                    int32_t num_keys,
+                                    int32_t modulus,
+                                    int32_t* stored)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  int32_t const i = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size;
+  if (i >= num_keys) { return; }
+  auto const key = set.insert_or_find(tile, i, i % modulus, modulo_equal{modulus});
+  if (tile.thread_rank() == 0) { stored[i] = key; }
+}
+
+// Every key `i % modulus` is inserted with the value `i`, as a join inserts row hash values
+__global__ void insert_pairs(map_type::device_view map, int32_t num_keys, int32_t modulus)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  int32_t const i = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size;
+  if (i >= num_keys) { return; }
+  map.insert(tile, i % modulus, i % modulus, i);
+}
+
+__global__ void count_matches(map_type::device_view map, int32_t num_keys, int32_t* counts)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  int32_t const key = (threadIdx.x + blockIdx.x * blockDim.x) / tile_size;
+  if (key >= num_keys) { return; }
+  int32_t count{0};
+  map.probe(tile, key, [&](bool occupied, int32_t stored, size_t slot) {
+    count += __popc(tile.ballot(occupied && stored == key && map.value(slot) % num_keys == key));
+    return false;
+  });
+  if (tile.thread_rank() == 0) { counts[key] = count; }
+}
+
+int num_blocks(int32_t num_keys) { return (num_keys * tile_size + block_size - 1) / block_size; }
+
+}  // namespace
+
+struct OpenAddressingMapTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(OpenAddressingMapTest, InsertOrFindKeepsFirstEqualKey)
+{
+  int32_t const num_keys = 10000;
+  int32_t const modulus  = 97;
+  set_type set(num_keys, std::numeric_limits<int32_t>::max());
+
+  rmm::device_vector<int32_t> stored(num_keys);
+  insert_or_find_keys<<<num_blocks(num_keys), block_size>>>(
+    set.view(), num_keys, modulus, stored.data().get());
+  CUDA_TRY(cudaDeviceSynchronize());
+
+  // One key of every class is stored, and all the keys of a class find the same one
+  EXPECT_EQ(modulus,
+            thrust::count_if(rmm::exec_policy(0)->on(0),
+                             set.keys(),
+                             set.keys() + set.capacity(),
+                             [empty_key = set.empty_key()] __device__(int32_t key) {
+                               return key != empty_key;
+                             }));
+  std::vector<int32_t> h_stored(stored.size());
+  thrust::copy(stored.begin(), stored.end(), h_stored.begin());
+  for (int32_t i = 0; i < num_keys; ++i) {
+    EXPECT_EQ(i % modulus, h_stored[i] % modulus);
+    EXPECT_EQ(h_stored[i % modulus], h_stored[i]);
+  }
+}
+
+TEST_F(OpenAddressingMapTest, InsertKeepsDuplicateKeys)
+{
+  int32_t const num_pairs = 10000;
+  int32_t const modulus   = 100;
+  map_type map(num_pairs, std::numeric_limits<int32_t>::max(), 80);
+  EXPECT_GE(map.capacity(), static_cast<size_t>(num_pairs) * 100 / 80);
+
+  insert_pairs<<<num_blocks(num_pairs), block_size>>>(map.view(), num_pairs, modulus);
+  rmm::device_vector<int32_t> counts(modulus);
+  count_matches<<<num_blocks(modulus), block_size>>>(map.view(), modulus, counts.data().get());
+  CUDA_TRY(cudaDeviceSynchronize());
+
+  std::vector<int32_t> h_counts(counts.size());
+  thrust::copy(counts.begin(), counts.end(), h_counts.begin());
+  for (auto count : h_counts) {
+    EXPECT_EQ(num_pairs / modulus, count);
+  }
+}
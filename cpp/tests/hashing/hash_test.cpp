@@ -223,6 +223,30 @@ TEST_F(MD5HashTest, MultiValue)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(md5_output1->view(), md5_output2->view());
 }
 
+TEST_F(MD5HashTest, LongStrings)
+{
+  // The average string length is large enough to hash each row with a warp
+  strings_column_wrapper const strings_col({std::string(300, 'a'),
+                                            std::string(
+                                              "The quick brown fox jumps over the lazy dog. "
+                                              "The quick brown fox jumps over the lazy dog. "
+                                              "The quick brown fox jumps over the lazy dog. "
+                                              "The quick brown fox jumps over the lazy dog. "
+                                              "The quick brown fox jumps over the lazy dog. "
+                                              "The quick brown fox jumps over the lazy dog. "
+                                              "The quick brown fox jumps over the lazy dog. "
+                                              "The quick brown fox jumps over the lazy dog. "),
+                                            std::string(400, 'z')});
+  fixed_width_column_wrapper<int32_t> const ints_col({1, 0, -5}, {1, 0, 1});
+
+  strings_column_wrapper const expected({"35d89099662f008aa5a2e9d1c1e9937c",
+                                         "e2e397cc2ee3a3897429fee2c60c4b87",
+                                         "cf04f5cc152d907305f3e13693b556fc"});
+  auto const input  = cudf::table_view({strings_col, ints_col});
+  auto const output = cudf::hash(input, cudf::hash_id::HASH_MD5);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected);
+}
+
 TEST_F(MD5HashTest, MultiValueNulls)
 {
   // Nulls with different values should be equal
@@ -328,4 +352,62 @@ TYPED_TEST(MD5HashTestFloatTyped, TestExtremes)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view(), true);
 }
 
+class SparkHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SparkHashTest, MultiValue)
+{
+  // The first row is `hash('Spark', array(123), 2)` from the Spark SQL documentation
+  strings_column_wrapper const strings_col({"Spark", "", "a", "cuDF \xe2\x9d\xa4"});
+  fixed_width_column_wrapper<int32_t> const ints_col({123, 0, -1, 0}, {1, 0, 1, 1});
+  fixed_width_column_wrapper<int8_t> const bytes_col({2, 1, 0, -128}, {1, 1, 0, 1});
+  auto const input = cudf::table_view({strings_col, ints_col, bytes_col});
+
+  fixed_width_column_wrapper<int32_t> const murmur_expected(
+    {-1321691492, 990749207, 1559839990, 1897153012});
+  auto const murmur_output = cudf::hash(input, cudf::hash_id::HASH_SPARK_MURMUR3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(murmur_output->view(), murmur_expected);
+
+  fixed_width_column_wrapper<int64_t> const xxhash_expected(
+    {5602566077635097486, 5760822842262958265, 3557319972953161241, -241978368386119949});
+  auto const xxhash_output = cudf::hash(input, cudf::hash_id::HASH_XXHASH64);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(xxhash_output->view(), xxhash_expected);
+}
+
+TEST_F(SparkHashTest, Seed)
+{
+  strings_column_wrapper const strings_col({std::string(40, 'a')});
+  auto const input = cudf::table_view({strings_col});
+
+  fixed_width_column_wrapper<int32_t> const murmur_expected({-1093089612});
+  auto const murmur_output = cudf::hash(input, cudf::hash_id::HASH_SPARK_MURMUR3, {0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(murmur_output->view(), murmur_expected);
+
+  fixed_width_column_wrapper<int64_t> const xxhash_expected({6241609220271238915});
+  auto const xxhash_output = cudf::hash(input, cudf::hash_id::HASH_XXHASH64, {0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(xxhash_output->view(), xxhash_expected);
+
+  EXPECT_THROW(cudf::hash(input, cudf::hash_id::HASH_XXHASH64, {0, 1}), cudf::logic_error);
+}
+
+TEST_F(SparkHashTest, FloatingPoint)
+{
+  // -0.0 hashes as 0.0 and all NaNs hash the same
+  using limits = std::numeric_limits<double>;
+  fixed_width_column_wrapper<double> const col1({0.0, limits::quiet_NaN(), 1.5});
+  fixed_width_column_wrapper<double> const col2({-0.0, -limits::quiet_NaN(), 1.5});
+
+  for (auto hash_function : {cudf::hash_id::HASH_SPARK_MURMUR3, cudf::hash_id::HASH_XXHASH64}) {
+    auto const output1 = cudf::hash(cudf::table_view({col1}), hash_function);
+    auto const output2 = cudf::hash(cudf::table_view({col2}), hash_function);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
+  }
+
+  fixed_width_column_wrapper<double> const zero_col({0.0});
+  fixed_width_column_wrapper<int32_t> const murmur_expected({-1670924195});
+  auto const murmur_output =
+    cudf::hash(cudf::table_view({zero_col}), cudf::hash_id::HASH_SPARK_MURMUR3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(murmur_output->view(), murmur_expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
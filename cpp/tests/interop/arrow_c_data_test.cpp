@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/arrow_c_data.hpp>
+#include <cudf/copying.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <string>
+
+using namespace cudf::test;
+
+struct ArrowCDataTest : public BaseFixture {
+};
+
+namespace {
+cudf::table make_test_table()
+{
+  fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 0}};
+  strings_column_wrapper strings{{"a", "", "bcd", "ef", "ghij"}, {1, 1, 0, 1, 1}};
+  fixed_width_column_wrapper<bool> bools{{true, false, true, true, false}, {1, 1, 1, 0, 1}};
+  lists_column_wrapper<int64_t> lists{{1, 2}, {}, {3}, {4, 5, 6}, {7}};
+  return cudf::table{cudf::table_view{{ints, strings, bools, lists}}};
+}
+
+}  // namespace
+
+TEST_F(ArrowCDataTest, DeviceRoundTrip)
+{
+  auto input          = std::make_unique<cudf::table>(make_test_table());
+  auto const expected = make_test_table();
+  auto const ints     = input->view().column(0).head();
+  auto const chars    = input->view().column(1).child(1).head();
+
+  ArrowSchema schema;
+  ArrowDeviceArray array;
+  cudf::to_arrow_device(std::move(input), &schema, &array, {"ints", "strings", "bools", "lists"});
+
+  EXPECT_EQ(std::string{schema.format}, "+s");
+  ASSERT_EQ(schema.n_children, 4);
+  EXPECT_EQ(std::string{schema.children[0]->format}, "i");
+  EXPECT_EQ(std::string{schema.children[0]->name}, "ints");
+  EXPECT_EQ(std::string{schema.children[1]->format}, "u");
+  EXPECT_EQ(std::string{schema.children[2]->format}, "b");
+  EXPECT_EQ(std::string{schema.children[3]->format}, "+l");
+  EXPECT_EQ(std::string{schema.children[3]->children[0]->format}, "l");
+  EXPECT_EQ(array.device_type, ARROW_DEVICE_CUDA);
+  EXPECT_EQ(array.array.length, 5);
+  EXPECT_EQ(array.array.children[0]->null_count, 2);
+  EXPECT_EQ(array.array.children[0]->buffers[1], ints);
+
+  auto const result = cudf::from_arrow_device(&schema, &array);
+  EXPECT_EQ(array.array.release, nullptr);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.view(), result.table);
+  // numeric data and characters are viewed in place
+  EXPECT_EQ(result.table.column(0).head(), ints);
+  EXPECT_EQ(result.table.column(1).child(1).head(), chars);
+
+  schema.release(&schema);
+  EXPECT_EQ(schema.release, nullptr);
+}
+
+TEST_F(ArrowCDataTest, MovedChildOutlivesParent)
+{
+  fixed_width_column_wrapper<int16_t> col{{10, 20, 30}, {1, 0, 1}};
+  auto input = std::make_unique<cudf::table>(cudf::table_view{{col}});
+
+  ArrowSchema schema;
+  ArrowDeviceArray array;
+  cudf::to_arrow_device(std::move(input), &schema, &array);
+
+  // move the child out of the array as a consumer would
+  ArrowArray child = *array.array.children[0];
+
+  array.array.children[0]->release = nullptr;
+  array.array.release(&array.array);
+
+  std::vector<int16_t> values(3);
+  CUDA_TRY(cudaMemcpy(values.data(), child.buffers[1], 3 * sizeof(int16_t), cudaMemcpyDefault));
+  EXPECT_EQ(values, (std::vector<int16_t>{10, 20, 30}));
+
+  child.release(&child);
+  schema.release(&schema);
+}
+
+TEST_F(ArrowCDataTest, HostRoundTrip)
+{
+  auto const table = make_test_table();
+  auto const input = cudf::slice(table.view(), {1, 4})[0];
+
+  ArrowSchema schema;
+  ArrowArray array;
+  cudf::to_arrow_host(input, &schema, &array);
+
+  ASSERT_EQ(array.n_children, 4);
+  auto const& ints = *array.children[0];
+  EXPECT_EQ(ints.length, 3);
+  EXPECT_EQ(ints.offset, 1);
+  EXPECT_EQ(static_cast<int32_t const*>(ints.buffers[1])[ints.offset + 1], 3);
+  auto const& bools = *array.children[2];
+  EXPECT_EQ(static_cast<uint8_t const*>(bools.buffers[1])[0], 0b1101);
+
+  auto const result = cudf::from_arrow_host(&schema, &array);
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(result.array, nullptr);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, result.table);
+
+  schema.release(&schema);
+}
+
+TEST_F(ArrowCDataTest, UnsupportedType)
+{
+  fixed_width_column_wrapper<cudf::duration_D, int32_t> durations{1, 2, 3};
+  auto input = std::make_unique<cudf::table>(cudf::table_view{{durations}});
+
+  ArrowSchema schema;
+  ArrowDeviceArray array;
+  EXPECT_THROW(cudf::to_arrow_device(std::move(input), &schema, &array), cudf::logic_error);
+}
@@ -368,3 +368,58 @@ TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
   // Verify that from_dlpack(to_dlpack(input)) == input
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
+
+TYPED_TEST(DLPackNumericTests, ToDlpackColumnWithoutCopy)
+{
+  fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4});
+  auto column     = std::make_unique<cudf::column>(col);
+  auto const data = column->view().head();
+  unique_managed_tensor result(cudf::to_dlpack(std::move(column)));
+
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(4, tensor.shape[0]);
+  EXPECT_EQ(nullptr, tensor.strides);
+  EXPECT_EQ(data, tensor.data);
+
+  auto view = cudf::from_dlpack_view(result.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({col}), view);
+  EXPECT_EQ(data, view.column(0).head());
+}
+
+TYPED_TEST(DLPackNumericTests, ToDlpackInterleavedWithoutCopy)
+{
+  // Rows {1, 4}, {2, 5} and {3, 6} of an interleaved table of two columns
+  fixed_width_column_wrapper<TypeParam> interleaved({1, 4, 2, 5, 3, 6});
+  unique_managed_tensor result(cudf::to_dlpack(std::make_unique<cudf::column>(interleaved), 2));
+
+  auto const& tensor = result->dl_tensor;
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(3, tensor.shape[0]);
+  EXPECT_EQ(2, tensor.shape[1]);
+  EXPECT_EQ(2, tensor.strides[0]);
+  EXPECT_EQ(1, tensor.strides[1]);
+
+  // Row-major tensors cannot be viewed as columns
+  EXPECT_THROW(cudf::from_dlpack_view(result.get()), cudf::logic_error);
+  EXPECT_THROW(cudf::to_dlpack(std::make_unique<cudf::column>(interleaved), 4), cudf::logic_error);
+}
+
+TYPED_TEST(DLPackNumericTests, ToDlpackContiguousSplitWithoutCopy)
+{
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4, 5});
+  fixed_width_column_wrapper<TypeParam> col2({6, 7, 8, 9, 10});
+  cudf::table_view input({col1, col2});
+  auto splits     = cudf::contiguous_split(input, {});
+  auto const data = splits[0].all_data->data();
+  unique_managed_tensor result(cudf::to_dlpack(std::move(splits[0])));
+
+  auto const& tensor = result->dl_tensor;
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(data, tensor.data);
+  EXPECT_EQ(1, tensor.strides[0]);
+  EXPECT_LE(tensor.shape[0], tensor.strides[1]);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, cudf::from_dlpack_view(result.get()));
+}
@@ -31,6 +31,8 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <arrow/gpu/cuda_api.h>
+
 std::unique_ptr<cudf::table> get_cudf_table()
 {
   std::vector<std::unique_ptr<cudf::column>> columns;
@@ -260,3 +262,85 @@ INSTANTIATE_TEST_CASE_P(FromArrowTest,
                                           std::make_tuple(0, 0),
                                           std::make_tuple(0, 3000),
                                           std::make_tuple(10000, 10000)));
+
+// Returns a copy of `data` whose buffers, and those of its children, are in device memory
+std::shared_ptr<arrow::ArrayData> to_device(arrow::cuda::CudaContext& context,
+                                            arrow::ArrayData const& data)
+{
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+  for (auto const& buffer : data.buffers) {
+    if (buffer == nullptr) {
+      buffers.push_back(nullptr);
+      continue;
+    }
+    // Padded as arrow pads its allocations, so that cudf can read whole mask words
+    auto device_buffer =
+      context.Allocate(arrow::BitUtil::RoundUpToMultipleOf64(buffer->size())).ValueOrDie();
+    CUDF_EXPECTS(device_buffer->CopyFromHost(0, buffer->data(), buffer->size()).ok(),
+                 "Failed to copy buffer to device");
+    buffers.push_back(device_buffer);
+  }
+  std::vector<std::shared_ptr<arrow::ArrayData>> children;
+  for (auto const& child : data.child_data) { children.push_back(to_device(context, *child)); }
+  return arrow::ArrayData::Make(
+    data.type, data.length, buffers, children, data.null_count, data.offset);
+}
+
+// Returns a copy of `table` whose columns are in device memory, except for dictionary columns
+std::shared_ptr<arrow::Table> to_device(arrow::Table const& table)
+{
+  auto manager = arrow::cuda::CudaDeviceManager::Instance().ValueOrDie();
+  auto context = manager->GetContext(0).ValueOrDie();
+
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  for (auto const& chunked_array : table.columns()) {
+    auto array = chunked_array->chunk(0);
+    arrays.push_back(array->type_id() == arrow::Type::DICTIONARY
+                       ? array
+                       : arrow::MakeArray(to_device(*context, *array->data())));
+  }
+  return arrow::Table::Make(table.schema(), arrays);
+}
+
+TEST_F(FromArrowTest, ViewDeviceTable)
+{
+  auto tables       = get_tables(1000);
+  auto arrow_table  = to_device(*tables.second);
+  auto device_array = arrow_table->column(0)->chunk(0);
+
+  auto got = cudf::from_arrow_view(arrow_table);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(tables.first->view(), got.table);
+  // The INT64 and STRING columns are viewed in place, the DICTIONARY and BOOL8 columns copied
+  EXPECT_EQ(2u, got.copied_columns.size());
+  EXPECT_EQ(reinterpret_cast<void const*>(device_array->data()->buffers[1]->address()),
+            got.table.column(0).head());
+  EXPECT_EQ(reinterpret_cast<void const*>(device_array->data()->buffers[0]->address()),
+            got.table.column(0).null_mask());
+}
+
+TEST_F(FromArrowTest, ViewSlicedDeviceTable)
+{
+  auto tables      = get_tables(1000);
+  auto arrow_table = to_device(*tables.second);
+
+  auto sliced_cudf_table   = cudf::slice(tables.first->view(), {37, 901})[0];
+  auto sliced_arrow_table  = arrow_table->Slice(37, 901 - 37);
+  auto got                 = cudf::from_arrow_view(sliced_arrow_table);
+  auto expected_cudf_table = cudf::table{sliced_cudf_table};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_cudf_table.view(), got.table);
+  EXPECT_EQ(2u, got.copied_columns.size());
+  EXPECT_EQ(37, got.table.column(0).offset());
+}
+
+TEST_F(FromArrowTest, ViewHostTable)
+{
+  auto tables      = get_tables(1000);
+  auto arrow_table = tables.second;
+
+  auto got = cudf::from_arrow_view(arrow_table);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(tables.first->view(), got.table);
+  EXPECT_EQ(static_cast<std::size_t>(arrow_table->num_columns()), got.copied_columns.size());
+}
@@ -193,6 +193,20 @@ TEST_F(ToArrowTest, NestedList)
   ASSERT_TRUE(expected_arrow_table->Equals(*got_arrow_table, true));
 }
 
+TEST_F(ToArrowTest, PinnedMemoryPool)
+{
+  auto tables = get_tables(10000);
+
+  auto cudf_table_view      = tables.first->view();
+  auto expected_arrow_table = tables.second;
+
+  auto got_arrow_table =
+    cudf::to_arrow(cudf_table_view, {"a", "b", "c", "d"}, cudf::pinned_arrow_memory_pool());
+
+  ASSERT_EQ(expected_arrow_table->Equals(*got_arrow_table, true), true);
+  EXPECT_GT(cudf::pinned_arrow_memory_pool()->bytes_allocated(), 0);
+}
+
 struct ToArrowTestSlice
   : public ToArrowTest,
     public ::testing::WithParamInterface<std::tuple<cudf::size_type, cudf::size_type>> {
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/io/functions.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+namespace {
+// Rows of the test files: a long column and a string column
+constexpr char const* schema =
+  R"({"type":"record","name":"test","fields":[{"name":"a","type":"long"},)"
+  R"({"name":"b","type":"string"}]})";
+
+int64_t long_value(int64_t row) { return row * 3 - 500; }
+std::string string_value(int64_t row) { return "row_" + std::to_string(row); }
+
+void append_varint(std::string& out, uint64_t value)
+{
+  while (value >= 0x80) {
+    out.push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<char>(value));
+}
+
+// Avro longs, including lengths, are zigzag encoded
+void append_long(std::string& out, int64_t value)
+{
+  append_varint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void append_string(std::string& out, std::string const& value)
+{
+  append_long(out, value.size());
+  out += value;
+}
+
+/**
+ * @brief Returns the Avro encoding of the rows in `[begin, end)`
+ */
+std::string encode_rows(int64_t begin, int64_t end)
+{
+  std::string out;
+  for (auto row = begin; row < end; ++row) {
+    append_long(out, long_value(row));
+    append_string(out, string_value(row));
+  }
+  return out;
+}
+
+uint32_t crc32(std::string const& data)
+{
+  uint32_t crc = 0xffffffffu;
+  for (unsigned char c : data) {
+    crc ^= c;
+    for (int k = 0; k < 8; ++k) { crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u))); }
+  }
+  return ~crc;
+}
+
+/**
+ * @brief Returns a snappy block of `data` followed by the big-endian CRC32 trailer `crc`
+ *
+ * The data is stored as snappy literals. The stream declares `declared_size` uncompressed bytes,
+ * which is the size of `data` for a valid stream.
+ */
+std::string snappy_block(std::string const& data, uint32_t crc, size_t declared_size)
+{
+  std::string out;
+  append_varint(out, declared_size);
+  for (size_t pos = 0; pos < data.size(); pos += 60) {
+    auto const len = std::min<size_t>(60, data.size() - pos);
+    out.push_back(static_cast<char>((len - 1) << 2));
+    out.append(data, pos, len);
+  }
+  for (int shift = 24; shift >= 0; shift -= 8) { out.push_back(static_cast<char>(crc >> shift)); }
+  return out;
+}
+
+/**
+ * @brief Returns an Avro object container file of snappy blocks
+ *
+ * @param blocks Number of rows and data, including the CRC trailer, of every block
+ */
+std::string snappy_container(std::vector<std::pair<int64_t, std::string>> const& blocks)
+{
+  std::string const sync_marker = "0123456789abcdef";
+  std::string out               = "Obj\x01";
+  append_long(out, 2);
+  append_string(out, "avro.codec");
+  append_string(out, "snappy");
+  append_string(out, "avro.schema");
+  append_string(out, schema);
+  append_long(out, 0);
+  out += sync_marker;
+  for (auto const& block : blocks) {
+    append_long(out, block.first);
+    append_long(out, block.second.size());
+    out += block.second;
+    out += sync_marker;
+  }
+  return out;
+}
+
+}  // namespace
+
+struct AvroReaderTest : public cudf::test::BaseFixture {
+  // Two blocks, so that the offsets of the second one depend on the size of the first
+  static constexpr int64_t num_rows   = 1000;
+  static constexpr int64_t block_rows = 600;
+
+  /**
+   * @brief Returns a container of two valid blocks, applying `corrupt` to the first one
+   */
+  template <typename Corrupt>
+  static std::string make_file(Corrupt corrupt)
+  {
+    auto const first  = encode_rows(0, block_rows);
+    auto const second = encode_rows(block_rows, num_rows);
+    auto first_block  = snappy_block(first, crc32(first), first.size());
+    auto second_block = snappy_block(second, crc32(second), second.size());
+    corrupt(first, first_block);
+    return snappy_container({{block_rows, first_block}, {num_rows - block_rows, second_block}});
+  }
+
+  static cudf_io::table_with_metadata read(std::string const& file)
+  {
+    cudf_io::read_avro_args args{cudf_io::source_info{file.data(), file.size()}};
+    return cudf_io::read_avro(args);
+  }
+
+  static void expect_all_rows(cudf::table_view const& result)
+  {
+    auto longs   = cudf::test::make_counting_transform_iterator(0, long_value);
+    auto strings = cudf::test::make_counting_transform_iterator(0, string_value);
+    cudf::test::fixed_width_column_wrapper<int64_t> a(longs, longs + num_rows);
+    cudf::test::strings_column_wrapper b(strings, strings + num_rows);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({a, b}), result);
+  }
+};
+
+TEST_F(AvroReaderTest, SnappyWithCrc)
+{
+  auto const file   = make_file([](std::string const&, std::string&) {});
+  auto const result = read(file);
+  EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"a", "b"}));
+  expect_all_rows(result.tbl->view());
+}
+
+TEST_F(AvroReaderTest, SnappyCorruptedCrc)
+{
+  // The checksum is not part of the compressed data, so the rows still decode
+  auto const file = make_file([](std::string const&, std::string& block) { block.back() ^= 0x5a; });
+  expect_all_rows(read(file).tbl->view());
+}
+
+TEST_F(AvroReaderTest, SnappyCorruptedData)
+{
+  // The stream declares more data than it holds
+  auto const file = make_file([](std::string const& data, std::string& block) {
+    block = snappy_block(data, crc32(data), data.size() + 10);
+  });
+  EXPECT_THROW(read(file), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
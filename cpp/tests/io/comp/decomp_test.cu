@@ -15,8 +15,10 @@
  */
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
 #include <tests/utilities/base_fixture.hpp>
 
+#include <string>
 #include <vector>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -123,6 +125,16 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Derived fixture for ZSTD decompression
+ **/
+struct ZstdDecompressTest : public DecompressTest<ZstdDecompressTest> {
+  cudaError_t dispatch()
+  {
+    return cudf::io::gpu_unzstd(d_inf_args.data().get(), d_inf_stat.data().get(), 1);
+  }
+};
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -136,6 +148,24 @@ TEST_F(GzipDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+struct GzipMembersTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GzipMembersTest, BlockedGzip)
+{
+  // "hello world" as a BGZF block: a gzip member whose size is in a "BC" extra subfield
+  constexpr uint8_t block[] = {0x1f, 0x8b, 0x8,  0x4,  0x0,  0x0,  0x0,  0x0,  0x0,  0xff,
+                               0x6,  0x0,  0x42, 0x43, 0x2,  0x0,  0x26, 0x0,  0xcb, 0x48,
+                               0xcd, 0xc9, 0xc9, 0x57, 0x28, 0xcf, 0x2f, 0xca, 0x49, 0x1,
+                               0x0,  0x85, 0x11, 0x4a, 0xd,  0xb,  0x0,  0x0,  0x0};
+  std::vector<uint8_t> compressed(block, block + sizeof(block));
+  compressed.insert(compressed.end(), block, block + sizeof(block));
+
+  auto const output = cudf::io::io_uncompress_single_h2d(
+    compressed.data(), compressed.size(), cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP);
+  EXPECT_EQ(std::string(output.begin(), output.end()), "hello worldhello world");
+}
+
 TEST_F(SnappyDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -171,4 +201,35 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(ZstdDecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x0b, 0x59, 0x00, 0x00, 0x68,
+                                    0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, CompressedBlock)
+{
+  constexpr char uncompressed[] =
+    "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. "
+    "The quick brown fox!";
+  constexpr uint8_t compressed[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x6e, 0xb5, 0x01, 0x00, 0xe4, 0x02, 0x54, 0x68, 0x65, 0x20, 0x71,
+    0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a,
+    0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61,
+    0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e, 0x20, 0x21, 0x01, 0x00, 0x2d, 0x94, 0x54, 0x19};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+  EXPECT_EQ(inf_stat->status, 0u);
+  EXPECT_EQ(inf_stat->bytes_written, input.size());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
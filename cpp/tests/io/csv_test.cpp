@@ -405,6 +405,31 @@ TEST_F(CsvReaderTest, Dates)
                            view.column(0));
 }
 
+TEST_F(CsvReaderTest, IsoDates)
+{
+  auto filepath = temp_env->get_temp_dir() + "IsoDates.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "2001-03-05\n2010-10-31 12:00:00\n1994-10-20T01:02:03.456\n2005-09-16 1:2:30\n";
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.names  = {"A"};
+  in_args.dtype  = {"date"};
+  in_args.header = -1;
+  auto result    = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(cudf::type_id::TIMESTAMP_MILLISECONDS, view.column(0).type().id());
+
+  using namespace simt::std::chrono_literals;
+  expect_column_data_equal(std::vector<cudf::timestamp_ms>{cudf::timestamp_ms{983750400000ms},
+                                                           cudf::timestamp_ms{1288526400000ms},
+                                                           cudf::timestamp_ms{782614923456ms},
+                                                           cudf::timestamp_ms{1126832550000ms}},
+                           view.column(0));
+}
+
 TEST_F(CsvReaderTest, DatesCastToTimestampSeconds)
 {
   auto filepath = temp_env->get_temp_dir() + "DatesCastToTimestampS.csv";
@@ -578,6 +603,24 @@ TEST_F(CsvReaderTest, FloatingPoint)
   ASSERT_EQ((1u << ref_vals.size()) - 1, bitmask[0]);
 }
 
+TEST_F(CsvReaderTest, LongIntegers)
+{
+  std::string input = "1234567890123456789\n-12345678\n00000000000000000042\n1'2345'678\n";
+  cudf_io::read_csv_args in_args{cudf_io::source_info{input.c_str(), input.size()}};
+  in_args.names     = {"A"};
+  in_args.dtype     = {"int64"};
+  in_args.header    = -1;
+  in_args.thousands = '\'';
+  auto result       = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  EXPECT_EQ(1, view.num_columns());
+  ASSERT_EQ(cudf::type_id::INT64, view.column(0).type().id());
+
+  expect_column_data_equal(std::vector<int64_t>{1234567890123456789L, -12345678L, 42L, 12345678L},
+                           view.column(0));
+}
+
 TEST_F(CsvReaderTest, Strings)
 {
   std::vector<std::string> names{"line", "verse"};
@@ -1169,4 +1212,64 @@ TEST_F(CsvReaderTest, UserImplementedSource)
   expect_column_data_equal(int32_values, view.column(2));
 }
 
+/**
+ * @brief Source of back-to-back messages, which knows where each of them starts
+ */
+class MessageSource : public TestSource {
+ public:
+  explicit MessageSource(std::vector<std::string> const& messages)
+    : TestSource(std::accumulate(messages.begin(), messages.end(), std::string{}))
+  {
+    size_t offset = 0;
+    for (auto const& msg : messages) {
+      offsets.push_back(offset);
+      offset += msg.size();
+    }
+  }
+
+  std::vector<size_t> record_offsets() const override { return offsets; }
+
+ private:
+  std::vector<size_t> offsets;
+};
+
+TEST_F(CsvReaderTest, SourceRecordOffsets)
+{
+  // No line terminators: the rows are only delimited by the offsets of the source
+  MessageSource source{{"a,b", "1,10", "2,20", "3,30"}};
+  cudf_io::read_csv_args in_args{cudf_io::source_info{&source}};
+  in_args.dtype = {"int32", "int32"};
+  auto result   = cudf_io::read_csv(in_args);
+
+  std::vector<std::string> const expected_names{"a", "b"};
+  EXPECT_EQ(result.metadata.column_names, expected_names);
+  auto const view = result.tbl->view();
+  ASSERT_EQ(view.num_rows(), 3);
+  expect_column_data_equal(std::vector<int32_t>{1, 2, 3}, view.column(0));
+  expect_column_data_equal(std::vector<int32_t>{10, 20, 30}, view.column(1));
+}
+
+TEST_F(CsvReaderTest, ChunkedRead)
+{
+  std::ostringstream csv_data;
+  csv_data << "id,text\n";
+  for (int i = 0; i < 2000; ++i) {
+    // Quoted terminators must not be taken as row boundaries between pieces
+    csv_data << i << ",\"row " << i << ((i % 7 == 0) ? "\nwith a newline" : "") << "\"\n";
+  }
+  auto filepath = temp_env->get_temp_dir() + "ChunkedRead.csv";
+  std::ofstream(filepath) << csv_data.str();
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.dtype = {"int32", "str"};
+  auto const expected = cudf_io::read_csv(in_args);
+
+  for (size_t chunk_size : {256, 1000, 4096}) {
+    in_args.chunk_size = chunk_size;
+    auto const result  = cudf_io::read_csv(in_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result.tbl->view());
+    EXPECT_EQ(expected.metadata.column_names, result.metadata.column_names);
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
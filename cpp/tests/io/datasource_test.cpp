@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/device_read_pipeline.hpp>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using cudf::io::datasource;
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+/**
+ * @brief Sets an environment variable for the lifetime of the object, restoring it afterwards
+ */
+class scoped_env_var {
+ public:
+  scoped_env_var(char const* name, char const* value) : _name{name}
+  {
+    auto const previous = std::getenv(name);
+    _had_value          = previous != nullptr;
+    if (_had_value) { _previous = previous; }
+    setenv(name, value, 1);
+  }
+
+  ~scoped_env_var()
+  {
+    if (_had_value) {
+      setenv(_name.c_str(), _previous.c_str(), 1);
+    } else {
+      unsetenv(_name.c_str());
+    }
+  }
+
+ private:
+  std::string _name;
+  std::string _previous;
+  bool _had_value = false;
+};
+
+struct DatasourceTest : public cudf::test::BaseFixture {
+  // Sizes that are not multiples of the page size or of the staging buffer size
+  static constexpr size_t file_size = 3 * 1024 * 1024 + 123;
+
+  /**
+   * @brief Writes a file of random bytes and returns its path
+   */
+  static std::string write_random_file(std::string const& name)
+  {
+    std::mt19937 engine{31337};
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<char> data(file_size);
+    for (auto& c : data) { c = static_cast<char>(dist(engine)); }
+
+    auto const filepath = temp_env->get_temp_filepath(name);
+    std::ofstream out(filepath, std::ofstream::out | std::ofstream::binary);
+    out.write(data.data(), data.size());
+    return filepath;
+  }
+
+  /**
+   * @brief Returns the bytes of `size` bytes of device memory
+   */
+  static std::vector<uint8_t> to_host(void const* data, size_t size)
+  {
+    std::vector<uint8_t> host(size);
+    CUDA_TRY(cudaMemcpy(host.data(), data, size, cudaMemcpyDeviceToHost));
+    return host;
+  }
+
+  /**
+   * @brief Checks that both `device_read()` overloads return the same data as `host_read()`
+   */
+  static void expect_device_read_equal(datasource* source, size_t offset, size_t size)
+  {
+    auto const expected = source->host_read(offset, size);
+    std::vector<uint8_t> const expected_data(expected->data(),
+                                             expected->data() + expected->size());
+
+    auto const buffer = source->device_read(offset, size);
+    EXPECT_EQ(to_host(buffer->data(), buffer->size()), expected_data);
+
+    rmm::device_buffer dst(size);
+    auto const read_size = source->device_read(offset, size, static_cast<uint8_t*>(dst.data()));
+    EXPECT_EQ(to_host(dst.data(), read_size), expected_data);
+  }
+};
+
+// Ranges within the first page, across pages, and past the end of the file
+std::vector<std::pair<size_t, size_t>> const read_ranges{
+  {0, 100}, {4000, 200000}, {1024 * 1024 + 7, 1024 * 1024}, {DatasourceTest::file_size - 10, 100}};
+
+TEST_F(DatasourceTest, CufileDisabled)
+{
+  // Without cuFile and without a pinned mapping, device reads go through the host
+  scoped_env_var cufile_policy("LIBCUDF_CUFILE_POLICY", "OFF");
+  scoped_env_var register_policy("LIBCUDF_MMAP_REGISTER_POLICY", "OFF");
+  auto const filepath = write_random_file("CufileDisabled.bin");
+  auto source         = datasource::create(filepath);
+
+  EXPECT_FALSE(source->supports_device_read());
+  EXPECT_THROW(source->device_read(0, 100), cudf::logic_error);
+
+  // The readers stage host reads through pinned buffers instead
+  for (auto const& range : read_ranges) {
+    auto const expected = source->host_read(range.first, range.second);
+    std::vector<uint8_t> const expected_data(expected->data(),
+                                             expected->data() + expected->size());
+
+    rmm::device_buffer dst(expected->size());
+    cudf::io::detail::device_read_pipeline pipeline(0, 64 * 1024);
+    pipeline.read(source.get(), range.first, expected->size(), static_cast<uint8_t*>(dst.data()));
+    pipeline.sync();
+    EXPECT_EQ(to_host(dst.data(), dst.size()), expected_data);
+  }
+}
+
+TEST_F(DatasourceTest, CufileDisabledPinnedMapping)
+{
+  // Without cuFile, device reads copy from the pinned mapping, where it can be registered
+  scoped_env_var cufile_policy("LIBCUDF_CUFILE_POLICY", "OFF");
+  scoped_env_var register_policy("LIBCUDF_MMAP_REGISTER_POLICY", "ON");
+  auto const filepath = write_random_file("CufileDisabledPinnedMapping.bin");
+  auto source         = datasource::create(filepath);
+
+  if (!source->supports_device_read()) {
+    // Registration of the read-only mapping is not supported by this CUDA version
+    EXPECT_THROW(source->device_read(0, 100), cudf::logic_error);
+    return;
+  }
+  for (auto const& range : read_ranges) {
+    expect_device_read_equal(source.get(), range.first, range.second);
+  }
+
+  // Reads outside of the mapping need cuFile
+  auto partial = datasource::create(filepath, 1024 * 1024, 4096);
+  ASSERT_TRUE(partial->supports_device_read());
+  EXPECT_THROW(partial->device_read(0, 100), cudf::logic_error);
+}
+
+TEST_F(DatasourceTest, DefaultPolicy)
+{
+  // cuFile reads, when cuFile is available, return the same data as host reads
+  auto const filepath = write_random_file("DefaultPolicy.bin");
+  auto source         = datasource::create(filepath);
+  if (!source->supports_device_read()) { return; }
+  for (auto const& range : read_ranges) {
+    expect_device_read_equal(source.get(), range.first, range.second);
+  }
+}
+
+CUDF_TEST_PROGRAM_MAIN()
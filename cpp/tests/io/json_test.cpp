@@ -22,6 +22,7 @@
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/functions.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
@@ -32,6 +33,7 @@
 #include <arrow/io/api.h>
 
 #include <fstream>
+#include <limits>
 
 #include <type_traits>
 
@@ -616,4 +618,157 @@ TEST_F(JsonReaderTest, StringInference)
   EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::STRING);
 }
 
+TEST_F(JsonReaderTest, JsonLinesNestedObjectsAndArrays)
+{
+  std::string buffer =
+    "{\"id\": 1, \"tags\": [\"a\", \"b\"], \"info\": {\"x\": 1.5, \"y\": [1, 2, 3]}}\n"
+    "{\"id\": 2, \"tags\": [], \"info\": {\"x\": 2.5, \"y\": null}}\n"
+    "{\"id\": 3, \"tags\": [\"c\"], \"info\": null}\n";
+  cudf_io::read_json_args in_args{cudf_io::source_info{buffer.c_str(), buffer.size()}};
+  in_args.lines                       = true;
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.tbl->num_rows(), 3);
+  const std::vector<std::string> expected_names{"id", "tags", "info", "x", "y"};
+  EXPECT_EQ(result.metadata.column_names, expected_names);
+
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), int64_wrapper{{1, 2, 3}, validity});
+
+  ASSERT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::LIST);
+  cudf::lists_column_view const tags(result.tbl->get_column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(tags.offsets(), wrapper<cudf::size_type>{0, 2, 2, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(tags.child(), cudf::test::strings_column_wrapper{"a", "b", "c"});
+
+  ASSERT_EQ(result.tbl->get_column(2).type().id(), cudf::type_id::STRUCT);
+  auto const info = result.tbl->get_column(2).view();
+  EXPECT_EQ(info.null_count(), 1);
+  ASSERT_EQ(info.num_children(), 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(info.child(0), float64_wrapper{{1.5, 2.5, 0.}, {1, 1, 0}});
+
+  ASSERT_EQ(info.child(1).type().id(), cudf::type_id::LIST);
+  cudf::lists_column_view const y(info.child(1));
+  EXPECT_EQ(y.null_count(), 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(y.offsets(), wrapper<cudf::size_type>{0, 3, 3, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(y.child(), int64_wrapper{{1, 2, 3}, validity});
+}
+
+TEST_F(JsonReaderTest, JsonLinesNestedColumnBeforeFlatColumns)
+{
+  std::string buffer =
+    "{\"a\": [1, 2], \"b\": 1.5, \"c\": \"x\"}\n"
+    "{\"c\": \"y\", \"b\": null, \"a\": [3]}\n"
+    "{\"b\": 3.5}\n";
+  cudf_io::read_json_args in_args{cudf_io::source_info{buffer.c_str(), buffer.size()}};
+  in_args.lines                       = true;
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.tbl->num_rows(), 3);
+  const std::vector<std::string> expected_names{"a", "b", "c"};
+  EXPECT_EQ(result.metadata.column_names, expected_names);
+
+  ASSERT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::LIST);
+  cudf::lists_column_view const a(result.tbl->get_column(0));
+  EXPECT_EQ(a.null_count(), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(a.offsets(), wrapper<cudf::size_type>{0, 2, 3, 3});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1),
+                                 float64_wrapper{{1.5, 0., 3.5}, {1, 0, 1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(2),
+                                 cudf::test::strings_column_wrapper({"x", "y", ""}, {1, 1, 0}));
+}
+
+/**
+ * @brief Source of back-to-back messages, which knows where each of them starts
+ */
+class MessageSource : public cudf::io::datasource {
+ public:
+  explicit MessageSource(std::vector<std::string> const& messages)
+  {
+    for (auto const& msg : messages) {
+      offsets.push_back(str.size());
+      str += msg;
+    }
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    size = std::min(size, str.size() - offset);
+    return std::make_unique<non_owning_buffer>((uint8_t*)str.data() + offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const read_size = std::min(size, str.size() - offset);
+    memcpy(dst, str.data() + offset, read_size);
+    return read_size;
+  }
+
+  std::vector<size_t> record_offsets() const override { return offsets; }
+
+  size_t size() const override { return str.size(); }
+
+ private:
+  std::string str;
+  std::vector<size_t> offsets;
+};
+
+TEST_F(JsonReaderTest, JsonLinesSourceRecordOffsets)
+{
+  // No line terminators: the records are only delimited by the offsets of the source
+  MessageSource source{{"[1,\"a\"]", "[2,\"b\"]", "[3,\"c\"]"}};
+  cudf_io::read_json_args in_args{cudf_io::source_info{&source}};
+  in_args.lines = true;
+  in_args.dtype = {"int64", "str"};
+  auto result   = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), int64_wrapper{1, 2, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1),
+                                 cudf::test::strings_column_wrapper({"a", "b", "c"}));
+}
+
+TEST_F(JsonReaderTest, WriteJsonLines)
+{
+  int_wrapper ints{{1, 2, 3}, {1, 0, 1}};
+  float64_wrapper floats{1.5, std::numeric_limits<double>::quiet_NaN(), -2.0};
+  cudf::test::strings_column_wrapper strings({"a\"b", "c\\d", "e\nf"});
+  bool_wrapper bools{true, false, true};
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"int", "float", "str", "bool"};
+
+  std::vector<char> out_buffer;
+  cudf_io::write_json_args out_args{cudf_io::sink_info{&out_buffer},
+                                    cudf::table_view{{ints, floats, strings, bools}},
+                                    &metadata};
+  cudf_io::write_json(out_args);
+
+  std::string const expected =
+    "{\"int\":1,\"float\":1.5,\"str\":\"a\\\"b\",\"bool\":true}\n"
+    "{\"int\":null,\"float\":null,\"str\":\"c\\\\d\",\"bool\":false}\n"
+    "{\"int\":3,\"float\":-2.0,\"str\":\"e\\nf\",\"bool\":true}\n";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
+TEST_F(JsonReaderTest, WriteJsonLinesChunksAndLists)
+{
+  using LCW = cudf::test::lists_column_wrapper<int>;
+  LCW lists{{1, 2}, LCW{}, {3}};
+  int_wrapper ints{{4, 5, 6}, {1, 0, 1}};
+
+  std::vector<char> out_buffer;
+  cudf_io::write_json_args out_args{
+    cudf_io::sink_info{&out_buffer}, cudf::table_view{{lists, ints}}, nullptr, 2, false};
+  cudf_io::write_json(out_args);
+
+  std::string const expected =
+    "{\"0\":[1,2],\"1\":4}\n"
+    "{\"0\":[]}\n"
+    "{\"0\":[3],\"1\":6}\n";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
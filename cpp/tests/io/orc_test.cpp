@@ -22,7 +22,10 @@
 
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/functions.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
@@ -473,6 +476,45 @@ TEST_F(OrcWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, Compression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto ints               = cudf::test::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int>((i / 7) % 1000);
+  });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "string_" + std::to_string(i % 321); });
+  const auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  column_wrapper<int> col0{ints, ints + num_rows, validity};
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows, validity);
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("ints");
+  expected_metadata.column_names.emplace_back("strings");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  for (auto compression : {cudf_io::compression_type::SNAPPY,
+                           cudf_io::compression_type::GZIP,
+                           cudf_io::compression_type::ZSTD}) {
+    std::vector<char> out_buffer;
+    cudf_io::write_orc_args out_args{
+      cudf_io::sink_info(&out_buffer), expected->view(), &expected_metadata, compression};
+    cudf_io::write_orc(out_args);
+
+    cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    in_args.use_index = false;
+    const auto result = cudf_io::read_orc(in_args);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+    EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+  }
+}
+
 TEST_F(OrcWriterTest, negTimestampsNano)
 {
   // This is a separate test because ORC format has a bug where writing a timestamp between -1 and 0
@@ -504,6 +546,65 @@ TEST_F(OrcWriterTest, negTimestampsNano)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
 }
 
+TEST_F(OrcWriterTest, MetadataCache)
+{
+  srand(31337);
+  cudf_io::set_metadata_cache_capacity(1 << 20);
+  auto filepath = temp_env->get_temp_filepath("MetadataCache.orc");
+
+  auto table1 = create_random_fixed_table<int>(3, 1000, true);
+  cudf_io::write_orc_args out_args1{cudf_io::sink_info{filepath}, *table1};
+  cudf_io::write_orc(out_args1);
+
+  // The second read reuses the cached postscript and footer
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  for (int i = 0; i < 2; ++i) {
+    auto result = cudf_io::read_orc(in_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*table1, result.tbl->view());
+  }
+
+  // Rewriting the file invalidates the entry
+  auto table2 = create_random_fixed_table<int>(4, 700, true);
+  cudf_io::write_orc_args out_args2{cudf_io::sink_info{filepath}, *table2};
+  cudf_io::write_orc(out_args2);
+  auto result = cudf_io::read_orc(in_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*table2, result.tbl->view());
+
+  cudf_io::set_metadata_cache_capacity(0);
+}
+
+TEST_F(OrcWriterTest, NestedColumns)
+{
+  auto list_valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  cudf::test::lists_column_wrapper<int> col0(
+    {{1, 2}, {3}, {0}, {4, 5, 6}, {7, 8}, {9}}, list_valids);
+
+  std::vector<bool> struct_valids{1, 1, 0, 1, 0, 1};
+  column_wrapper<int> ints{{10, 20, 30, 40, 50, 60}, {1, 0, 0, 1, 0, 1}};
+  column_wrapper<cudf::string_view> strings{{"a", "bc", "", "def", "", "g"}, {1, 1, 0, 1, 0, 1}};
+  cudf::test::structs_column_wrapper col1{{ints, strings}, struct_valids};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("lists");
+  expected_metadata.column_names.emplace_back("structs");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("OrcNestedColumns.orc");
+  cudf_io::write_orc_args out_args{
+    cudf_io::sink_info{filepath}, expected->view(), &expected_metadata};
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_orc(in_args);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+}
+
 TEST_F(OrcChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -622,6 +723,47 @@ TEST_F(OrcChunkedWriterTest, Strings)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
 }
 
+TEST_F(OrcChunkedWriterTest, StringsToDictionary)
+{
+  std::vector<const char*> h_strings1{"one", "two", "three", "two", "", "one", "three"};
+  auto valids1 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 4; });
+  cudf::test::strings_column_wrapper strings1(h_strings1.begin(), h_strings1.end(), valids1);
+  column_wrapper<int> ints1{1, 2, 3, 4, 5, 6, 7};
+  cudf::table_view tbl1{{strings1, ints1}};
+
+  std::vector<const char*> h_strings2{"four", "one", "four", "two", "four", "one", "two"};
+  cudf::test::strings_column_wrapper strings2(h_strings2.begin(), h_strings2.end());
+  column_wrapper<int> ints2{8, 9, 10, 11, 12, 13, 14};
+  cudf::table_view tbl2{{strings2, ints2}};
+
+  auto expected = cudf::concatenate({tbl1, tbl2});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStringsToDictionary.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  args.coalesce_chunks = false;
+  auto state           = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(tbl1, state);
+  cudf_io::write_orc_chunked(tbl2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.strings_to_dictionary = true;
+  auto result                     = cudf_io::read_orc(read_args);
+
+  // the keys merge the dictionaries of both stripes
+  auto const& dictionary = result.tbl->get_column(0);
+  ASSERT_EQ(dictionary.type().id(), cudf::type_id::DICTIONARY32);
+  EXPECT_EQ(cudf::dictionary_column_view(dictionary.view()).keys_size(), 4);
+  auto decoded = cudf::dictionary::decode(dictionary.view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->get_column(0), *decoded);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->get_column(1), result.tbl->get_column(1));
+
+  read_args.stripe_list = {1};
+  result                = cudf_io::read_orc(read_args);
+  decoded               = cudf::dictionary::decode(result.tbl->get_column(0).view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings2, *decoded);
+}
+
 TEST_F(OrcChunkedWriterTest, MismatchedTypes)
 {
   srand(31337);
@@ -660,7 +802,8 @@ TEST_F(OrcChunkedWriterTest, ReadStripes)
 
   auto filepath = temp_env->get_temp_filepath("ChunkedStripes.orc");
   cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
-  auto state = cudf_io::write_orc_chunked_begin(args);
+  args.coalesce_chunks = false;
+  auto state           = cudf_io::write_orc_chunked_begin(args);
   cudf_io::write_orc_chunked(*table1, state);
   cudf_io::write_orc_chunked(*table2, state);
   cudf_io::write_orc_chunked_end(state);
@@ -672,6 +815,203 @@ TEST_F(OrcChunkedWriterTest, ReadStripes)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(OrcChunkedWriterTest, CoalescedStripes)
+{
+  srand(31337);
+  std::vector<std::unique_ptr<table>> tables;
+  std::vector<table_view> table_views;
+  for (int idx = 0; idx < 5; idx++) {
+    auto tbl = create_random_fixed_table<int>(1, 3000, true);
+    table_views.push_back(*tbl);
+    tables.push_back(std::move(tbl));
+  }
+  auto expected = cudf::concatenate(table_views);
+
+  // Stripes of one 10000-row group; the small chunks are buffered into a full stripe, then the
+  // remaining rows are written at the end
+  auto filepath = temp_env->get_temp_filepath("ChunkedCoalescedStripes.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  args.stripe_size = 10000 * sizeof(int);
+  auto state       = cudf_io::write_orc_chunked_begin(args);
+  for (auto const& tbl : table_views) { cudf_io::write_orc_chunked(tbl, state); }
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_orc(read_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+  read_args.stripe_list = {1};
+  result                = cudf_io::read_orc(read_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, cudf::slice(*expected, {10000, 15000})[0]);
+
+  read_args.stripe_list = {2};
+  EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
+}
+
+TEST_F(OrcChunkedWriterTest, FooterStatistics)
+{
+  using ts_wrapper = cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, int64_t>;
+  auto a1 = cudf::test::fixed_width_column_wrapper<int>{{1, 2, 3, 4}, {1, 1, 0, 1}};
+  auto b1 = cudf::test::strings_column_wrapper{"apple", "banana", "cherry", "date"};
+  auto c1 = ts_wrapper{1000, 2000, 3000, 4000};
+  auto a2 = cudf::test::fixed_width_column_wrapper<int>{101, 102, 103, 104};
+  auto b2 = cudf::test::strings_column_wrapper{"melon", "orange", "peach", "plum"};
+  auto c2 = ts_wrapper{5000, 6000, 7000, 8000};
+  cudf::table_view tbl1{{a1, b1, c1}};
+  cudf::table_view tbl2{{a2, b2, c2}};
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFooterStatistics.orc");
+  cudf_io::table_metadata_with_nullability md;
+  md.column_names    = {"a", "b", "c"};
+  md.column_nullable = {true, false, false};
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}, &md};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(tbl1, state);
+  cudf_io::write_orc_chunked(tbl2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.timestamp_type = cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS};
+  auto const stats         = cudf_io::read_orc_statistics(read_args);
+  ASSERT_EQ(stats.size(), 3u);
+  EXPECT_EQ(stats[0].num_rows, 8);
+  EXPECT_EQ(stats[0].null_count, 1);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int>*>(stats[0].min.get())->value(), 1);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int>*>(stats[0].max.get())->value(), 104);
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(stats[1].min.get())->to_string(), "apple");
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(stats[1].max.get())->to_string(), "plum");
+  auto const ts_max = static_cast<cudf::timestamp_scalar<cudf::timestamp_ms>*>(stats[2].max.get());
+  EXPECT_EQ(ts_max->ticks_since_epoch(), 8000);
+}
+
+TEST_F(OrcChunkedWriterTest, StripeFilters)
+{
+  using ts_wrapper = cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, int64_t>;
+  auto a1 = cudf::test::fixed_width_column_wrapper<int>{1, 2, 3, 4};
+  auto b1 = cudf::test::strings_column_wrapper{"apple", "banana", "cherry", "date"};
+  auto c1 = ts_wrapper{1000, 2000, 3000, 4000};
+  auto a2 = cudf::test::fixed_width_column_wrapper<int>{101, 102, 103, 104};
+  auto b2 = cudf::test::strings_column_wrapper{"melon", "orange", "peach", "plum"};
+  auto c2 = ts_wrapper{5000, 6000, 7000, 8000};
+  cudf::table_view tbl1{{a1, b1, c1}};
+  cudf::table_view tbl2{{a2, b2, c2}};
+
+  // Each chunk is written as a separate stripe with its own statistics
+  auto filepath = temp_env->get_temp_filepath("ChunkedStripeFilters.orc");
+  cudf_io::table_metadata_with_nullability md;
+  md.column_names    = {"a", "b", "c"};
+  md.column_nullable = {false, false, false};
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}, &md};
+  args.coalesce_chunks = false;
+  auto state           = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(tbl1, state);
+  cudf_io::write_orc_chunked(tbl2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  auto read_filtered = [&](std::vector<cudf_io::column_predicate> filters) {
+    cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+    read_args.timestamp_type = cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS};
+    read_args.filters        = std::move(filters);
+    return cudf_io::read_orc(read_args);
+  };
+
+  {
+    auto value  = std::make_shared<cudf::numeric_scalar<int>>(100);
+    auto result = read_filtered({{"a", cudf_io::filter_op::GREATER, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl2);
+  }
+  {
+    auto value  = std::make_shared<cudf::string_scalar>("banana");
+    auto result = read_filtered({{"b", cudf_io::filter_op::EQUAL, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl1);
+  }
+  {
+    // Timestamp literals are compared in the units of the statistics
+    auto value = std::make_shared<cudf::timestamp_scalar<cudf::timestamp_s>>(
+      cudf::duration_s{5}, true);
+    auto result = read_filtered({{"c", cudf_io::filter_op::GREATER_EQUAL, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl2);
+  }
+  {
+    // Stripes can be selected and filtered at the same time
+    cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+    read_args.timestamp_type = cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS};
+    read_args.stripe_list    = {1, 0};
+    read_args.filters        = {
+      {"a", cudf_io::filter_op::LESS, std::make_shared<cudf::numeric_scalar<int>>(50)}};
+    auto result = cudf_io::read_orc(read_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl1);
+  }
+  {
+    // Conjunction that no stripe can satisfy
+    auto low    = std::make_shared<cudf::numeric_scalar<int>>(2);
+    auto high   = std::make_shared<cudf::string_scalar>("peach");
+    auto result = read_filtered(
+      {{"a", cudf_io::filter_op::LESS, low}, {"b", cudf_io::filter_op::GREATER_EQUAL, high}});
+    EXPECT_EQ(result.tbl->num_columns(), 3);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  {
+    auto result = read_filtered({{"a", cudf_io::filter_op::IS_NULL}});
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  {
+    auto value = std::make_shared<cudf::numeric_scalar<int>>(1);
+    EXPECT_THROW(read_filtered({{"d", cudf_io::filter_op::EQUAL, value}}), cudf::logic_error);
+    EXPECT_THROW(read_filtered({{"a", cudf_io::filter_op::EQUAL}}), cudf::logic_error);
+  }
+}
+
+TEST_F(OrcChunkedWriterTest, BloomFilters)
+{
+  // The value ranges of the stripes overlap, so only the bloom filters can skip them
+  auto a1 = cudf::test::fixed_width_column_wrapper<int>{1, 3, 5, 7};
+  auto b1 = cudf::test::strings_column_wrapper{"apple", "cherry", "melon", "plum"};
+  auto a2 = cudf::test::fixed_width_column_wrapper<int>{2, 4, 6, 8};
+  auto b2 = cudf::test::strings_column_wrapper{"banana", "date", "orange", "peach"};
+  cudf::table_view tbl1{{a1, b1}};
+  cudf::table_view tbl2{{a2, b2}};
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedBloomFilters.orc");
+  cudf_io::table_metadata_with_nullability md;
+  md.column_names    = {"a", "b"};
+  md.column_nullable = {false, false};
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}, &md};
+  args.coalesce_chunks  = false;
+  args.bloom_filter_fpp = {0.001, 0.001};
+  auto state            = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(tbl1, state);
+  cudf_io::write_orc_chunked(tbl2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  auto read_filtered = [&](std::vector<cudf_io::column_predicate> filters) {
+    cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+    read_args.filters = std::move(filters);
+    return cudf_io::read_orc(read_args);
+  };
+
+  {
+    auto result = cudf_io::read_orc(cudf_io::read_orc_args{cudf_io::source_info{filepath}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), cudf::concatenate({tbl1, tbl2})->view());
+  }
+  {
+    auto value  = std::make_shared<cudf::numeric_scalar<int>>(4);
+    auto result = read_filtered({{"a", cudf_io::filter_op::EQUAL, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl2);
+  }
+  {
+    auto value  = std::make_shared<cudf::string_scalar>("cherry");
+    auto result = read_filtered({{"b", cudf_io::filter_op::EQUAL, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl1);
+  }
+  {
+    // Values within the ranges of both stripes that neither of them contains
+    auto value  = std::make_shared<cudf::string_scalar>("kiwi");
+    auto result = read_filtered({{"b", cudf_io::filter_op::EQUAL, value}});
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+}
+
 TEST_F(OrcChunkedWriterTest, ReadStripesError)
 {
   srand(31337);
@@ -690,6 +1030,57 @@ TEST_F(OrcChunkedWriterTest, ReadStripesError)
   EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
 }
 
+TEST_F(OrcChunkedWriterTest, ChunkedRead)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(2, 15000, true);
+
+  // Stripes of 10000 and 5000 rows
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  args.stripe_size = 10000 * 2 * sizeof(int);
+  auto state       = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(*expected, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  auto read_chunked = [&](size_t byte_limit, cudf::size_type row_limit) {
+    cudf_io::read_orc_chunked_args read_args{
+      cudf_io::source_info{filepath}, byte_limit, row_limit};
+    auto read_state = cudf_io::read_orc_chunked_begin(read_args);
+    std::vector<std::unique_ptr<cudf::table>> pieces;
+    while (cudf_io::read_orc_chunked_has_next(read_state)) {
+      pieces.emplace_back(cudf_io::read_orc_chunked(read_state).tbl);
+    }
+    EXPECT_THROW(cudf_io::read_orc_chunked(read_state), cudf::logic_error);
+    return pieces;
+  };
+  auto expect_concatenated = [&](std::vector<std::unique_ptr<cudf::table>> const& pieces) {
+    std::vector<cudf::table_view> views;
+    for (auto const& piece : pieces) { views.push_back(*piece); }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(views), *expected);
+  };
+
+  // Both stripes fit in a single piece
+  auto pieces = read_chunked(0, 20000);
+  ASSERT_EQ(pieces.size(), 1u);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*pieces[0], *expected);
+
+  // Stripes are split by rows: 4000 + 4000 + 2000, then 4000 + 1000
+  pieces = read_chunked(0, 4000);
+  ASSERT_EQ(pieces.size(), 5u);
+  EXPECT_EQ(pieces[2]->num_rows(), 2000);
+  expect_concatenated(pieces);
+
+  // Each stripe is larger than the byte limit and read on its own
+  pieces = read_chunked(1, 0);
+  ASSERT_EQ(pieces.size(), 2u);
+  EXPECT_EQ(pieces[0]->num_rows(), 10000);
+  expect_concatenated(pieces);
+
+  cudf_io::read_orc_chunked_args zero_args{cudf_io::source_info{filepath}, 0, 0};
+  EXPECT_THROW(cudf_io::read_orc_chunked_begin(zero_args), cudf::logic_error);
+}
+
 TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
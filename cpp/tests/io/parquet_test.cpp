@@ -22,14 +22,20 @@
 
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
 #include <cudf/io/functions.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <atomic>
 #include <fstream>
+#include <limits>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -539,6 +545,88 @@ TEST_F(ParquetWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, Compression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto ints               = cudf::test::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int>((i / 7) % 1000);
+  });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "string_" + std::to_string(i % 321); });
+  const auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  column_wrapper<int> col0{ints, ints + num_rows, validity};
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows, validity);
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("ints");
+  expected_metadata.column_names.emplace_back("strings");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  for (auto compression : {cudf_io::compression_type::SNAPPY,
+                           cudf_io::compression_type::GZIP,
+                           cudf_io::compression_type::ZSTD}) {
+    std::vector<char> out_buffer;
+    cudf_io::write_parquet_args out_args{
+      cudf_io::sink_info(&out_buffer), expected->view(), &expected_metadata, compression};
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    const auto result = cudf_io::read_parquet(in_args);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+    EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+  }
+}
+
+TEST_F(ParquetWriterTest, HighCardinalityDictionary)
+{
+  // More unique values than a fragment-based dictionary holds, each repeated a few times
+  constexpr auto num_rows = 400000;
+  auto strings            = cudf::test::make_counting_transform_iterator(0, [](auto i) {
+    return "identifier_" + std::to_string((i * 7919) % (num_rows / 4));
+  });
+  auto ints = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>((i * 104729) % (num_rows / 4)); });
+  const auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  cudf::test::strings_column_wrapper col0(strings, strings + num_rows, validity);
+  column_wrapper<int64_t> col1(ints, ints + num_rows);
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> dict_buffer;
+  cudf_io::write_parquet_args dict_args{cudf_io::sink_info(&dict_buffer),
+                                        expected->view(),
+                                        nullptr,
+                                        cudf_io::compression_type::NONE};
+  dict_args.max_dictionary_size = 16 * 1024 * 1024;
+  cudf_io::write_parquet(dict_args);
+
+  std::vector<char> small_dict_buffer;
+  cudf_io::write_parquet_args small_dict_args{cudf_io::sink_info(&small_dict_buffer),
+                                              expected->view(),
+                                              nullptr,
+                                              cudf_io::compression_type::NONE};
+  small_dict_args.max_dictionary_size = 16 * 1024;
+  cudf_io::write_parquet(small_dict_args);
+
+  EXPECT_LT(dict_buffer.size(), small_dict_buffer.size());
+
+  for (auto const &buffer : {dict_buffer, small_dict_buffer}) {
+    cudf_io::read_parquet_args in_args{cudf_io::source_info(buffer.data(), buffer.size())};
+    const auto result = cudf_io::read_parquet(in_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+  }
+}
+
 TEST_F(ParquetWriterTest, NonNullable)
 {
   srand(31337);
@@ -643,6 +731,185 @@ TEST_F(ParquetWriterTest, DeviceWriteLargeishFile)
   auto custom_tbl = cudf_io::read_parquet(custom_args);
   CUDF_TEST_EXPECT_TABLES_EQUAL(custom_tbl.tbl->view(), expected->view());
 }
+TEST_F(ParquetWriterTest, RowGroupAndPageSize)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 100000, true);
+
+  // Small row groups, written through both the host and the device write paths
+  auto filepath = temp_env->get_temp_filepath("RowGroupAndPageSize.parquet");
+  custom_test_data_sink custom_sink(filepath);
+  std::vector<char> buf_sink;
+  for (auto const &sink : {cudf_io::sink_info{&custom_sink}, cudf_io::sink_info{&buf_sink}}) {
+    cudf_io::write_parquet_args args{sink, *expected};
+    args.row_group_size = 256 * 1024;
+    args.page_size      = 16 * 1024;
+    cudf_io::write_parquet(args);
+  }
+  custom_sink.flush();
+
+  for (auto const &source : {cudf_io::source_info{filepath},
+                             cudf_io::source_info{buf_sink.data(), buf_sink.size()}}) {
+    cudf_io::read_parquet_args read_args{source};
+    auto result = cudf_io::read_parquet(read_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected->view());
+
+    read_args.row_groups = {{1}};
+    result               = cudf_io::read_parquet(read_args);
+    EXPECT_GT(result.tbl->num_rows(), 0);
+    EXPECT_LT(result.tbl->num_rows(), expected->num_rows());
+  }
+}
+
+TEST_F(ParquetWriterTest, DeltaEncodings)
+{
+  constexpr auto num_rows = 20000;
+
+  // Sorted timestamp-like values, wide deltas, floats and sorted strings sharing prefixes
+  auto col0_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return int64_t{1577836800000} + i * 1000 + (i % 7); });
+  auto col1_data = random_values<int32_t>(num_rows);
+  auto col2_data = random_values<double>(num_rows);
+  std::vector<std::string> strings(num_rows);
+  for (int i = 0; i < num_rows; ++i) { strings[i] = "key_" + std::to_string(1000000 + i * 3); }
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  column_wrapper<int64_t> col0{col0_data, col0_data + num_rows, validity};
+  column_wrapper<int32_t> col1{col1_data.begin(), col1_data.end()};
+  column_wrapper<double> col2{col2_data.begin(), col2_data.end(), validity};
+  cudf::test::strings_column_wrapper col3{strings.begin(), strings.end(), validity};
+  auto expected = table_view{{col0, col1, col2, col3}};
+
+  auto filepath = temp_env->get_temp_filepath("DeltaEncodings.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  out_args.page_size       = 16 * 1024;
+  out_args.delta_encodings = true;
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, PageIndex)
+{
+  constexpr auto num_rows = 40000;
+
+  auto ints    = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "key_" + std::to_string(100000 + i); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  column_wrapper<int> col0{ints, ints + num_rows, validity};
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows, validity);
+  auto expected = table_view{{col0, col1}};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names = {"ints", "strings"};
+
+  auto filepath = temp_env->get_temp_filepath("PageIndex.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath},
+                                       expected,
+                                       &expected_metadata,
+                                       cudf_io::compression_type::SNAPPY,
+                                       cudf_io::statistics_freq::STATISTICS_PAGE};
+  out_args.page_size = 16 * 1024;
+  cudf_io::write_parquet(out_args);
+
+  {
+    // Only the pages covering the requested rows are read
+    cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+    in_args.skip_rows   = 25000;
+    in_args.num_rows    = 100;
+    auto result         = cudf_io::read_parquet(in_args);
+    auto expected_slice = cudf::slice(expected, {25000, 25100});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_slice[0], result.tbl->view());
+  }
+  {
+    // Every page of the row group is checked against the predicates
+    cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+    auto value      = std::make_shared<cudf::string_scalar>("key_125000");
+    in_args.filters = {{"strings", cudf_io::filter_op::EQUAL, value}};
+    auto result     = cudf_io::read_parquet(in_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+    auto max_value  = std::make_shared<cudf::numeric_scalar<int>>(3 * num_rows);
+    in_args.filters = {{"ints", cudf_io::filter_op::GREATER, max_value}};
+    result          = cudf_io::read_parquet(in_args);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+}
+
+TEST_F(ParquetWriterTest, Partitioned)
+{
+  column_wrapper<int32_t> keys{2, 1, 2, 3, 1, 2};
+  column_wrapper<int64_t> values{0, 1, 2, 3, 4, 5};
+  cudf::test::strings_column_wrapper strings{"a", "b", "c", "d", "e", "f"};
+  table_view input{{keys, values, strings}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"key", "value", "string"};
+
+  std::vector<std::vector<char>> buffers(3);
+  cudf_io::write_parquet_partitioned_args args{
+    input, {0}, [&](table_view const &, cudf::size_type p) {
+      return cudf_io::sink_info{&buffers[p]};
+    }};
+  args.metadata = &metadata;
+  auto const result_keys = cudf_io::write_parquet_partitioned(args);
+
+  column_wrapper<int32_t> expected_keys{1, 2, 3};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result_keys->view(), table_view{{expected_keys}});
+
+  column_wrapper<int64_t> values0{1, 4}, values1{0, 2, 5}, values2{3};
+  cudf::test::strings_column_wrapper strings0{"b", "e"}, strings1{"a", "c", "f"}, strings2{"d"};
+  std::vector<table_view> expected{table_view{{values0, strings0}},
+                                   table_view{{values1, strings1}},
+                                   table_view{{values2, strings2}}};
+  for (size_t p = 0; p < buffers.size(); ++p) {
+    cudf_io::read_parquet_args read_args{
+      cudf_io::source_info{buffers[p].data(), buffers[p].size()}};
+    auto const result = cudf_io::read_parquet(read_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected[p]);
+    EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"value", "string"}));
+  }
+}
+
+TEST_F(ParquetWriterTest, PartitionedSmallRowGroups)
+{
+  // Partitions that do not end on a page fragment, each split in several row groups
+  constexpr cudf::size_type num_rows      = 100000;
+  constexpr cudf::size_type rows_per_part = 12345;
+  constexpr cudf::size_type num_parts     = (num_rows + rows_per_part - 1) / rows_per_part;
+  auto key_iter                           = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return num_parts - i / rows_per_part; });
+  auto value_iter = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> keys(key_iter, key_iter + num_rows);
+  column_wrapper<int32_t> values(value_iter, value_iter + num_rows);
+  table_view input{{keys, values}};
+
+  std::vector<std::vector<char>> buffers(num_parts);
+  cudf_io::write_parquet_partitioned_args args{
+    input, {0}, [&](table_view const &, cudf::size_type p) {
+      return cudf_io::sink_info{&buffers[p]};
+    }};
+  args.row_group_size = 16 * 1024;
+  cudf_io::write_parquet_partitioned(args);
+
+  // The smallest key is that of the last rows
+  for (cudf::size_type p = 0; p < num_parts; ++p) {
+    auto const first = (num_parts - 1 - p) * rows_per_part;
+    auto const last  = std::min(first + rows_per_part, num_rows);
+    auto const expected =
+      cudf::slice(static_cast<cudf::column_view>(values), {first, last}).front();
+
+    cudf_io::read_parquet_args read_args{
+      cudf_io::source_info{buffers[p].data(), buffers[p].size()}};
+    auto const result = cudf_io::read_parquet(read_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), table_view{{expected}});
+  }
+}
+
 template <typename T>
 std::string create_parquet_file(int num_cols)
 {
@@ -1317,4 +1584,572 @@ TEST_F(ParquetReaderTest, ReorderedColumns)
   }
 }
 
+TEST_F(ParquetReaderTest, RowGroupFilters)
+{
+  auto a1 = cudf::test::fixed_width_column_wrapper<int>{1, 2, 3, 4};
+  auto b1 = cudf::test::strings_column_wrapper{"apple", "banana", "cherry", "date"};
+  auto a2 = cudf::test::fixed_width_column_wrapper<int>{101, 102, 103, 104};
+  auto b2 = cudf::test::strings_column_wrapper{"melon", "orange", "peach", "plum"};
+  cudf::table_view tbl1{{a1, b1}};
+  cudf::table_view tbl2{{a2, b2}};
+
+  // Each chunk is written as a separate row group with its own statistics
+  auto filepath = temp_env->get_temp_filepath("RowGroupFilters.parquet");
+  cudf_io::table_metadata_with_nullability md;
+  md.column_names    = {"a", "b"};
+  md.column_nullable = {false, false};
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}, &md};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(tbl1, state);
+  cudf_io::write_parquet_chunked(tbl2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto read_filtered = [&](std::vector<cudf_io::column_predicate> filters) {
+    cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+    read_args.filters = std::move(filters);
+    return cudf_io::read_parquet(read_args);
+  };
+
+  {
+    auto value  = std::make_shared<cudf::numeric_scalar<int>>(100);
+    auto result = read_filtered({{"a", cudf_io::filter_op::GREATER, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl2);
+  }
+  {
+    auto value  = std::make_shared<cudf::numeric_scalar<int64_t>>(3);
+    auto result = read_filtered({{"a", cudf_io::filter_op::LESS_EQUAL, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl1);
+  }
+  {
+    auto value  = std::make_shared<cudf::string_scalar>("orange");
+    auto result = read_filtered({{"b", cudf_io::filter_op::EQUAL, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl2);
+  }
+  {
+    // Conjunction that no row group can satisfy
+    auto low    = std::make_shared<cudf::numeric_scalar<int>>(2);
+    auto high   = std::make_shared<cudf::string_scalar>("peach");
+    auto result = read_filtered(
+      {{"a", cudf_io::filter_op::LESS, low}, {"b", cudf_io::filter_op::GREATER_EQUAL, high}});
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  {
+    auto result = read_filtered({{"a", cudf_io::filter_op::IS_NULL}});
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  {
+    auto value = std::make_shared<cudf::numeric_scalar<int>>(1);
+    EXPECT_THROW(read_filtered({{"c", cudf_io::filter_op::EQUAL, value}}), cudf::logic_error);
+    EXPECT_THROW(read_filtered({{"a", cudf_io::filter_op::EQUAL}}), cudf::logic_error);
+  }
+}
+
+TEST_F(ParquetReaderTest, BloomFilters)
+{
+  // The value ranges of the row groups overlap, so only the bloom filters can skip them
+  auto a1 = cudf::test::fixed_width_column_wrapper<int>{1, 3, 5, 7};
+  auto b1 = cudf::test::strings_column_wrapper{"apple", "cherry", "melon", "plum"};
+  auto a2 = cudf::test::fixed_width_column_wrapper<int>{2, 4, 6, 8};
+  auto b2 = cudf::test::strings_column_wrapper{"banana", "date", "orange", "peach"};
+  cudf::table_view tbl1{{a1, b1}};
+  cudf::table_view tbl2{{a2, b2}};
+
+  auto filepath = temp_env->get_temp_filepath("BloomFilters.parquet");
+  cudf_io::table_metadata_with_nullability md;
+  md.column_names    = {"a", "b"};
+  md.column_nullable = {false, false};
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}, &md};
+  args.bloom_filter_fpp = {0.01, 0.01};
+  auto state            = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(tbl1, state);
+  cudf_io::write_parquet_chunked(tbl2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto read_filtered = [&](std::vector<cudf_io::column_predicate> filters) {
+    cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+    read_args.filters = std::move(filters);
+    return cudf_io::read_parquet(read_args);
+  };
+
+  {
+    auto result = read_filtered({});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), cudf::concatenate({tbl1, tbl2})->view());
+  }
+  {
+    auto value  = std::make_shared<cudf::numeric_scalar<int>>(4);
+    auto result = read_filtered({{"a", cudf_io::filter_op::EQUAL, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl2);
+  }
+  {
+    auto value  = std::make_shared<cudf::string_scalar>("cherry");
+    auto result = read_filtered({{"b", cudf_io::filter_op::EQUAL, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl1);
+  }
+  {
+    // Values within the ranges of both row groups that neither of them contains
+    auto value  = std::make_shared<cudf::string_scalar>("kiwi");
+    auto result = read_filtered({{"b", cudf_io::filter_op::EQUAL, value}});
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  {
+    // Boolean columns have no bloom filters
+    auto flags = cudf::test::fixed_width_column_wrapper<bool>{true, false};
+    cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, cudf::table_view{{flags}}};
+    out_args.bloom_filter_fpp = {0.01};
+    EXPECT_THROW(cudf_io::write_parquet(out_args), cudf::logic_error);
+  }
+}
+
+TEST_F(ParquetReaderTest, PageIndexRowWindows)
+{
+  constexpr cudf::size_type num_rows = 100000;
+
+  auto ints    = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  auto doubles = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  // Few distinct strings, so that the chunks start with a dictionary page
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "key_" + std::to_string(i % 100); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  column_wrapper<int> col0{ints, ints + num_rows, validity};
+  column_wrapper<double> col1{doubles, doubles + num_rows};
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows, validity);
+  auto expected = table_view{{col0, col1, col2}};
+
+  auto filepath = temp_env->get_temp_filepath("PageIndexRowWindows.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath},
+                                       expected,
+                                       nullptr,
+                                       cudf_io::compression_type::SNAPPY,
+                                       cudf_io::statistics_freq::STATISTICS_PAGE};
+  out_args.row_group_size = 256 * 1024;
+  out_args.page_size      = 4 * 1024;
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args full_args{cudf_io::source_info{filepath}};
+  auto const full = cudf_io::read_parquet(full_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, full.tbl->view());
+
+  // Windows within a page, across pages and row groups, and up to the end of the file
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const windows{
+    {0, 1}, {4999, 2}, {12345, 30000}, {50001, 777}, {num_rows - 7, 7}, {60000, -1}};
+  for (auto const &window : windows) {
+    cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+    in_args.skip_rows = window.first;
+    in_args.num_rows  = window.second;
+    auto const result = cudf_io::read_parquet(in_args);
+
+    auto const end = (window.second < 0) ? num_rows : window.first + window.second;
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(full.tbl->view(), {window.first, end}).front(),
+                                  result.tbl->view());
+  }
+}
+
+TEST_F(ParquetReaderTest, PageIndexPredicates)
+{
+  constexpr cudf::size_type rows_per_group = 20000;
+
+  // The first row group has no values between 10000 and 100000, which its column chunk
+  // statistics do not show but the statistics of its pages do
+  auto ints0 = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i < rows_per_group / 2) ? i : 90000 + i; });
+  auto ints1   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 40000 + i; });
+  auto ints2   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 200000 + i; });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "name_" + std::to_string(i); });
+  column_wrapper<int> a0(ints0, ints0 + rows_per_group);
+  column_wrapper<int> a1(ints1, ints1 + rows_per_group);
+  column_wrapper<int> a2(ints2, ints2 + rows_per_group);
+  cudf::test::strings_column_wrapper b(strings, strings + rows_per_group);
+
+  // Each table is written as a separate row group, with one page per fragment of rows
+  auto filepath = temp_env->get_temp_filepath("PageIndexPredicates.parquet");
+  cudf_io::table_metadata_with_nullability md;
+  md.column_names    = {"a", "b"};
+  md.column_nullable = {false, false};
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath},
+                                           &md,
+                                           cudf_io::compression_type::SNAPPY,
+                                           cudf_io::statistics_freq::STATISTICS_PAGE};
+  args.page_size = 1024;
+  auto state     = cudf_io::write_parquet_chunked_begin(args);
+  for (auto const &a : {&a0, &a1, &a2}) {
+    cudf_io::write_parquet_chunked(table_view{{*a, b}}, state);
+  }
+  cudf_io::write_parquet_chunked_end(state);
+
+  cudf_io::read_parquet_args full_args{cudf_io::source_info{filepath}};
+  auto const full = cudf_io::read_parquet(full_args);
+  auto const row_groups = cudf::slice(full.tbl->view(),
+                                      {0,
+                                       rows_per_group,
+                                       rows_per_group,
+                                       2 * rows_per_group,
+                                       2 * rows_per_group,
+                                       3 * rows_per_group});
+
+  auto read_filtered = [&](std::vector<cudf_io::column_predicate> filters) {
+    cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+    read_args.filters = std::move(filters);
+    return cudf_io::read_parquet(read_args);
+  };
+
+  {
+    auto value  = std::make_shared<cudf::numeric_scalar<int>>(50000);
+    auto result = read_filtered({{"a", cudf_io::filter_op::EQUAL, value}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(row_groups[1], result.tbl->view());
+  }
+  {
+    auto value    = std::make_shared<cudf::numeric_scalar<int>>(105000);
+    auto result   = read_filtered({{"a", cudf_io::filter_op::GREATER_EQUAL, value}});
+    auto expected = cudf::concatenate({row_groups[0], row_groups[2]});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+  }
+  {
+    // Within the statistics of the first column chunk, but not of any of its pages
+    auto value  = std::make_shared<cudf::numeric_scalar<int>>(70000);
+    auto result = read_filtered({{"a", cudf_io::filter_op::EQUAL, value}});
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+}
+
+TEST_F(ParquetReaderTest, LargeColumnChunks)
+{
+  // Uncompressed chunks larger than the reader's staging buffers are transferred in pieces
+  constexpr auto num_rows = 3 << 20;
+  auto values             = random_values<int64_t>(num_rows);
+  column_wrapper<int64_t> col{values.begin(), values.end()};
+  cudf::table_view expected{{col}};
+
+  auto filepath = temp_env->get_temp_filepath("LargeColumnChunks.parquet");
+  cudf_io::write_parquet_args out_args{
+    cudf_io::sink_info{filepath}, expected, nullptr, cudf_io::compression_type::NONE};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionary)
+{
+  std::vector<const char*> strings{"one", "two", "three", "two", "", "one", "three", "four"};
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 3; });
+  cudf::test::strings_column_wrapper col(strings.begin(), strings.end(), valids);
+  column_wrapper<int32_t> ints{1, 2, 3, 4, 5, 6, 7, 8};
+  cudf::table_view expected{{col, ints}};
+
+  auto read_dictionary = [&](std::string const& filename, size_t max_dictionary_size) {
+    auto filepath = temp_env->get_temp_filepath(filename);
+    cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+    out_args.max_dictionary_size = max_dictionary_size;
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+    in_args.strings_to_dictionary = true;
+    auto result = cudf_io::read_parquet(in_args);
+    EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::DICTIONARY32);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(ints, result.tbl->get_column(1));
+    auto decoded = cudf::dictionary::decode(result.tbl->get_column(0).view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(col, *decoded);
+    return cudf::dictionary_column_view(result.tbl->get_column(0).view()).keys_size();
+  };
+
+  // keys are the unique strings of the chunk dictionaries
+  EXPECT_EQ(read_dictionary("StringsToDictionary.parquet", 1024 * 1024), 5);
+  // strings that are not dictionary encoded are encoded after decoding
+  read_dictionary("StringsToDictionaryPlain.parquet", 0);
+}
+
+TEST_F(ParquetReaderTest, NansToNullsAndFillValues)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  column_wrapper<double> doubles{{1.5, nan, 3.5, 4.5}, {1, 1, 1, 0}};
+  column_wrapper<int32_t> ints{{1, 2, 3, 4}, {0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper strings{{"a", "", "c", "d"}, {1, 0, 1, 1}};
+  cudf::table_view expected{{doubles, ints, strings}};
+
+  auto filepath = temp_env->get_temp_filepath("NansToNullsAndFillValues.parquet");
+  cudf_io::table_metadata md;
+  md.column_names = {"doubles", "ints", "strings"};
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  out_args.metadata = &md;
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.nans_to_nulls = true;
+  auto result           = cudf_io::read_parquet(in_args);
+  column_wrapper<double> expected_doubles{{1.5, nan, 3.5, 4.5}, {1, 0, 1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_doubles, result.tbl->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ints, result.tbl->get_column(1));
+
+  in_args.null_fill_values = {{"doubles", std::make_shared<cudf::numeric_scalar<double>>(0.0)},
+                              {"ints", std::make_shared<cudf::numeric_scalar<int32_t>>(-1)},
+                              {"strings", std::make_shared<cudf::string_scalar>("z")}};
+  result = cudf_io::read_parquet(in_args);
+  column_wrapper<double> filled_doubles{1.5, 0.0, 3.5, 0.0};
+  column_wrapper<int32_t> filled_ints{-1, 2, 3, -1};
+  cudf::test::strings_column_wrapper filled_strings{"a", "z", "c", "d"};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(filled_doubles, result.tbl->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(filled_ints, result.tbl->get_column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(filled_strings, result.tbl->get_column(2));
+
+  in_args.null_fill_values = {{"ints", std::make_shared<cudf::numeric_scalar<int64_t>>(-1)}};
+  EXPECT_THROW(cudf_io::read_parquet(in_args), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, FooterStatistics)
+{
+  column_wrapper<int32_t> ints{{5, 0, 1, 9}, {1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper strings{"pear", "fig", "apple", "plum"};
+  cudf::table_view expected{{ints, strings}};
+
+  auto filepath = temp_env->get_temp_filepath("FooterStatistics.parquet");
+  cudf_io::table_metadata md;
+  md.column_names = {"ints", "strings"};
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  out_args.metadata = &md;
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto const stats = cudf_io::read_parquet_statistics(in_args);
+  ASSERT_EQ(stats.size(), 2u);
+  EXPECT_EQ(stats[0].num_rows, 4);
+  EXPECT_EQ(stats[0].null_count, 1);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>*>(stats[0].min.get())->value(), 1);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>*>(stats[0].max.get())->value(), 9);
+  EXPECT_EQ(stats[1].null_count, 0);
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(stats[1].min.get())->to_string(), "apple");
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(stats[1].max.get())->to_string(), "plum");
+}
+
+TEST_F(ParquetReaderTest, MultipleFiles)
+{
+  // Sources are read concurrently but decoded together, in source order
+  srand(31337);
+  constexpr int num_files = 24;
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<cudf::table_view> views;
+  std::vector<std::string> filepaths;
+  for (int i = 0; i < num_files; ++i) {
+    tables.push_back(create_random_fixed_table<int>(3, 500 + 10 * i, true));
+    views.push_back(*tables.back());
+    filepaths.push_back(
+      temp_env->get_temp_filepath("MultipleFiles" + std::to_string(i) + ".parquet"));
+    cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepaths.back()}, views.back()};
+    cudf_io::write_parquet(out_args);
+  }
+  auto full_table = cudf::concatenate(views);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepaths}};
+  auto result = cudf_io::read_parquet(in_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*full_table, result.tbl->view());
+
+  // Errors parsing any of the footers are rethrown on the calling thread
+  filepaths.push_back(temp_env->get_temp_filepath("MultipleFilesCorrupted.parquet"));
+  std::ofstream(filepaths.back()) << std::string(64, 'x');
+  cudf_io::read_parquet_args corrupted_args{cudf_io::source_info{filepaths}};
+  EXPECT_THROW(cudf_io::read_parquet(corrupted_args), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, ScratchMemoryResource)
+{
+  auto expected = create_random_fixed_table<int>(4, 10000, true);
+
+  auto filepath = temp_env->get_temp_filepath("ScratchMemoryResource.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, *expected};
+  cudf_io::write_parquet(out_args);
+
+  // The intermediate buffers of each read are recycled by the pool
+  auto scratch = cudf::test::make_pool();
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.scratch_mr = scratch.get();
+  for (int i = 0; i < 2; ++i) {
+    auto result = cudf_io::read_parquet(in_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+  }
+}
+
+TEST_F(ParquetReaderTest, MetadataCache)
+{
+  srand(31337);
+  cudf_io::set_metadata_cache_capacity(1 << 20);
+  auto filepath = temp_env->get_temp_filepath("MetadataCache.parquet");
+
+  auto table1 = create_random_fixed_table<int>(3, 1000, true);
+  cudf_io::write_parquet_args out_args1{cudf_io::sink_info{filepath}, *table1};
+  cudf_io::write_parquet(out_args1);
+
+  // The second read reuses the cached footer
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  for (int i = 0; i < 2; ++i) {
+    auto result = cudf_io::read_parquet(in_args);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*table1, result.tbl->view());
+  }
+
+  // Rewriting the file invalidates the entry
+  auto table2 = create_random_fixed_table<int>(4, 700, true);
+  cudf_io::write_parquet_args out_args2{cudf_io::sink_info{filepath}, *table2};
+  cudf_io::write_parquet(out_args2);
+  auto result = cudf_io::read_parquet(in_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*table2, result.tbl->view());
+
+  cudf_io::set_metadata_cache_capacity(0);
+}
+
+// User datasource that counts the reads that reach it
+class counting_test_datasource : public cudf::io::datasource {
+ public:
+  explicit counting_test_datasource(std::vector<char> const& data) : data(data) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    ++num_reads;
+    size = std::min(size, data.size() - offset);
+    return std::make_unique<non_owning_buffer>((uint8_t*)data.data() + offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    ++num_reads;
+    auto const read_size = std::min(size, data.size() - offset);
+    memcpy(dst, data.data() + offset, read_size);
+    return read_size;
+  }
+
+  size_t size() const override { return data.size(); }
+
+  std::vector<char> const& data;
+  std::atomic<int> num_reads{0};
+};
+
+TEST_F(ParquetReaderTest, BatchedSourceReads)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(3, 1000, true);
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{&out_buffer}, *expected};
+  cudf_io::write_parquet(out_args);
+
+  // The chunks of the first and last columns are a few kilobytes apart, so they are read together
+  counting_test_datasource source(out_buffer);
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{&source}};
+  in_args.columns = {"_col0", "_col2"};
+  auto result     = cudf_io::read_parquet(in_args);
+
+  auto const expected_view = expected->view();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_view.column(0), expected_view.column(2)}),
+                                result.tbl->view());
+  // Header, ender and footer, then a single read for both chunks
+  EXPECT_EQ(source.num_reads, 4);
+
+  // Batches of ranges are returned in request order
+  std::vector<cudf::io::datasource::read_range> const ranges{{100, 10}, {0, 50}, {30, 40}};
+  auto buffers = source.host_read_async(ranges);
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    auto const buffer = buffers[i].get();
+    ASSERT_EQ(buffer->size(), ranges[i].size);
+    EXPECT_EQ(0, memcmp(buffer->data(), out_buffer.data() + ranges[i].offset, ranges[i].size));
+  }
+}
+
+TEST_F(ParquetReaderTest, DecodeBatches)
+{
+  // Row groups are decoded in batches while the next ones are read, once the data of the read is
+  // larger than a batch
+  constexpr auto num_rows = 5 << 20;
+  auto col0_data          = random_values<int64_t>(num_rows);
+  auto col1_data          = random_values<double>(num_rows);
+  auto strings            = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 1000); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  column_wrapper<int64_t> col0{col0_data.begin(), col0_data.end(), validity};
+  column_wrapper<double> col1{col1_data.begin(), col1_data.end()};
+  cudf::test::strings_column_wrapper col2{strings, strings + num_rows, validity};
+  auto expected = table_view{{col0, col1, col2}};
+
+  auto filepath = temp_env->get_temp_filepath("DecodeBatches.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  out_args.row_group_size = 8 * 1024 * 1024;
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // Rows that start and end within row groups
+  in_args.skip_rows = 12345;
+  in_args.num_rows  = num_rows - 2 * 12345;
+  result            = cudf_io::read_parquet(in_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {12345, num_rows - 12345}).front(),
+                                result.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, ChunkedRead)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(4, 1000, true);
+  auto table2 = create_random_fixed_table<int>(4, 1000, true);
+  auto table3 = create_random_fixed_table<int>(4, 1000, true);
+
+  auto full_table = cudf::concatenate({*table1, *table2, *table3});
+
+  // Each chunk is written as a separate row group
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(*table1, state);
+  cudf_io::write_parquet_chunked(*table2, state);
+  cudf_io::write_parquet_chunked(*table3, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto read_chunked = [&](size_t byte_limit) {
+    cudf_io::read_parquet_chunked_args read_args{cudf_io::source_info{filepath}, byte_limit};
+    auto read_state = cudf_io::read_parquet_chunked_begin(read_args);
+    std::vector<std::unique_ptr<cudf::table>> pieces;
+    while (cudf_io::read_parquet_chunked_has_next(read_state)) {
+      pieces.emplace_back(cudf_io::read_parquet_chunked(read_state).tbl);
+    }
+    EXPECT_THROW(cudf_io::read_parquet_chunked(read_state), cudf::logic_error);
+    return pieces;
+  };
+
+  {
+    // Everything fits in a single piece
+    auto pieces = read_chunked(size_t{1} << 30);
+    ASSERT_EQ(pieces.size(), 1u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*pieces[0], *full_table);
+  }
+  {
+    // Row groups are split into several pieces
+    auto pieces = read_chunked(1);
+    EXPECT_GT(pieces.size(), 3u);
+    std::vector<cudf::table_view> views;
+    for (auto const& piece : pieces) { views.push_back(*piece); }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(views), *full_table);
+  }
+  {
+    // Only bounded by rows: two row groups do not fit in one piece
+    cudf_io::read_parquet_chunked_args read_args{cudf_io::source_info{filepath}, 0};
+    read_args.row_limit = 1500;
+    auto read_state     = cudf_io::read_parquet_chunked_begin(read_args);
+    std::vector<std::unique_ptr<cudf::table>> pieces;
+    while (cudf_io::read_parquet_chunked_has_next(read_state)) {
+      pieces.emplace_back(cudf_io::read_parquet_chunked(read_state).tbl);
+      EXPECT_LE(pieces.back()->num_rows(), read_args.row_limit);
+    }
+    EXPECT_EQ(pieces.size(), 3u);
+    std::vector<cudf::table_view> views;
+    for (auto const& piece : pieces) { views.push_back(*piece); }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(views), *full_table);
+  }
+
+  cudf_io::read_parquet_chunked_args zero_args{cudf_io::source_info{filepath}, 0};
+  EXPECT_THROW(cudf_io::read_parquet_chunked_begin(zero_args), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
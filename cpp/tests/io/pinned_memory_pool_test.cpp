@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/pinned_memory_pool.hpp>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <cudf/io/functions.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+using cudf::io::detail::pinned_memory_pool;
+
+struct PinnedMemoryPoolTest : public cudf::test::BaseFixture {
+  // Every test starts from an empty pool with the default capacity
+  void SetUp() override { reset(); }
+  void TearDown() override { reset(); }
+
+  static void reset()
+  {
+    pinned_memory_pool::get().set_capacity(0);
+    pinned_memory_pool::get().set_capacity(pinned_memory_pool::default_capacity);
+  }
+};
+
+TEST_F(PinnedMemoryPoolTest, ReusesReleasedBlocks)
+{
+  auto& pool       = pinned_memory_pool::get();
+  auto const first = pool.allocate(1000);
+  pool.deallocate(first, 1000);
+  // Sizes are rounded up to a power of two of at least 4KB
+  EXPECT_EQ(pool.cached_bytes(), 4096u);
+
+  auto const second = pool.allocate(3000);
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(pool.cached_bytes(), 0u);
+  pool.deallocate(second, 3000);
+}
+
+TEST_F(PinnedMemoryPoolTest, CapacityLimitsCachedBlocks)
+{
+  auto& pool = pinned_memory_pool::get();
+  pool.set_capacity(8192);
+  void* blocks[3];
+  for (auto& block : blocks) { block = pool.allocate(4096); }
+  for (auto block : blocks) { pool.deallocate(block, 4096); }
+  EXPECT_EQ(pool.cached_bytes(), 8192u);
+
+  pool.set_capacity(4096);
+  EXPECT_EQ(pool.capacity(), 4096u);
+  EXPECT_EQ(pool.cached_bytes(), 4096u);
+}
+
+TEST_F(PinnedMemoryPoolTest, ZeroCapacityAllocatesPlainPinnedMemory)
+{
+  cudf::io::set_pinned_memory_pool_capacity(0);
+  auto& pool = pinned_memory_pool::get();
+  EXPECT_EQ(pool.capacity(), 0u);
+
+  auto const ptr = pool.allocate(1000);
+  cudaPointerAttributes attrs{};
+  CUDA_TRY(cudaPointerGetAttributes(&attrs, ptr));
+  EXPECT_EQ(attrs.type, cudaMemoryTypeHost);
+
+  pool.deallocate(ptr, 1000);
+  EXPECT_EQ(pool.cached_bytes(), 0u);
+}
+
+TEST_F(PinnedMemoryPoolTest, ReuseWaitsForPendingCopies)
+{
+  constexpr size_t size = 16 * 1024 * 1024;
+  cudaStream_t stream;
+  CUDA_TRY(cudaStreamCreate(&stream));
+  rmm::device_buffer source(size, stream);
+  CUDA_TRY(cudaMemsetAsync(source.data(), 0x5a, size, stream));
+
+  auto& pool       = pinned_memory_pool::get();
+  auto const first = static_cast<uint8_t*>(pool.allocate(size));
+  std::memset(first, 0, size);
+  CUDA_TRY(cudaMemcpyAsync(first, source.data(), size, cudaMemcpyDeviceToHost, stream));
+  // Released while the copy may still be running
+  pool.deallocate(first, size, stream);
+
+  auto const second = static_cast<uint8_t*>(pool.allocate(size));
+  EXPECT_EQ(second, first);
+  EXPECT_TRUE(std::all_of(second, second + size, [](uint8_t b) { return b == 0x5a; }));
+  pool.deallocate(second, size);
+  CUDA_TRY(cudaStreamDestroy(stream));
+}
+
+CUDF_TEST_PROGRAM_MAIN()
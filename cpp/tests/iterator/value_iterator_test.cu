@@ -14,6 +14,8 @@
  */
 #include <tests/iterator/iterator_tests.cuh>
 
+#include <cudf/copying.hpp>
+
 auto strings_to_string_views(std::vector<std::string>& input_strings)
 {
   auto all_valid = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
@@ -219,6 +221,36 @@ TEST_F(TransformedIteratorTest, large_size_reduction)
   this->iterator_test_cub(expected_value, it_dev, d_col->size());
 }
 
+// Tests the validity words of a sliced column, whose rows start within a word of its bitmask
+TEST_F(TransformedIteratorTest, validity_word_iterator)
+{
+  using T = int8_t;
+
+  const int column_size{200};
+  const int offset{37};
+  const int size{100};
+
+  std::vector<T> host_values(column_size, T{1});
+  std::vector<bool> host_bools(column_size);
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(host_bools.begin(), host_bools.end(), [&rbg]() { return rbg.generate(); });
+
+  cudf::test::fixed_width_column_wrapper<T> w_col(
+    host_values.begin(), host_values.end(), host_bools.begin());
+  auto const sliced = cudf::slice(w_col, {offset, offset + size}).front();
+  auto d_col        = cudf::column_device_view::create(sliced);
+
+  // calculate the expected value by CPU.
+  thrust::host_vector<cudf::bitmask_type> expected((size + 31) / 32, 0);
+  for (int row = 0; row < size; ++row) {
+    if (host_bools[offset + row]) { expected[row / 32] |= cudf::bitmask_type{1} << (row % 32); }
+  }
+
+  // GPU test
+  auto it_dev = cudf::detail::make_validity_word_iterator(*d_col);
+  this->iterator_test_thrust(expected, it_dev, expected.size());
+}
+
 struct StringIteratorTest : public IteratorTest<cudf::string_view> {
 };
 
@@ -347,6 +379,8 @@ TYPED_TEST(IteratorTest, error_handling)
 
   CUDF_EXPECT_THROW_MESSAGE((d_col_no_null->pair_begin<T, true>()),
                             "Unexpected non-nullable column.");
+  CUDF_EXPECT_THROW_MESSAGE((cudf::detail::make_validity_word_iterator(*d_col_no_null)),
+                            "Unexpected non-nullable column.");
   CUDF_EXPECT_NO_THROW((d_col_null->pair_begin<T, false>()));
   CUDF_EXPECT_NO_THROW((d_col_null->pair_begin<T, true>()));
 
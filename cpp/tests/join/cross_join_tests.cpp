@@ -14,8 +14,10 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -142,3 +144,67 @@ TEST_F(CrossJoinEmptyResult, NoRows)
   EXPECT_EQ(join_table_reverse->num_columns(), table_a.num_columns() + table_b.num_columns());
   EXPECT_EQ(join_table_reverse->num_rows(), 0);
 }
+
+class ChunkedCrossJoinTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ChunkedCrossJoinTest, SameAsCrossJoin)
+{
+  auto a_0 = column_wrapper<int32_t>{{10, 20, 20, 50}, {1, 1, 0, 1}};
+  auto a_1 = cudf::test::strings_column_wrapper({"quick", "accénted", "turtlé", "composéd"});
+  auto b_0 = column_wrapper<int32_t>{10, 20, 30};
+  auto b_1 = column_wrapper<float>{5.0, .7, .7};
+
+  auto table_a = cudf::table_view{{a_0, a_1}};
+  auto table_b = cudf::table_view{{b_0, b_1}};
+  auto expect  = cudf::cross_join(table_a, table_b);
+
+  // one row of the left table per chunk, then two, then all of them
+  for (cudf::size_type max_chunk_pairs : {1, 5, 6, 100}) {
+    cudf::chunked_cross_join join(table_a, table_b, max_chunk_pairs);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (join.has_next()) {
+      chunks.push_back(join.next());
+      EXPECT_LE(chunks.back()->num_rows(), std::max(max_chunk_pairs, table_b.num_rows()));
+    }
+    EXPECT_EQ(join.remaining_left_rows(), 0);
+    EXPECT_THROW(join.next(), cudf::logic_error);
+
+    std::vector<cudf::table_view> views;
+    for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expect->view(), cudf::concatenate(views)->view());
+  }
+}
+
+TEST_F(ChunkedCrossJoinTest, Predicate)
+{
+  auto a_0 = column_wrapper<int32_t>{10, 20, 20, 50};
+  auto a_1 = cudf::test::strings_column_wrapper({"quick", "accénted", "turtlé", "composéd"});
+  auto b_0 = column_wrapper<int32_t>{{15, 25, 30}, {1, 0, 1}};
+
+  auto table_a = cudf::table_view{{a_0, a_1}};
+  auto table_b = cudf::table_view{{b_0}};
+
+  auto a    = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto b    = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto less = cudf::ast::operation(cudf::ast::ast_operator::LESS, a, b);
+
+  cudf::chunked_cross_join join(table_a, table_b, 6, &less);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (join.has_next()) { chunks.push_back(join.next()); }
+  ASSERT_EQ(chunks.size(), 2);
+
+  // pairs with a null right value do not satisfy the predicate
+  auto expect_0 = column_wrapper<int32_t>{10, 10, 20, 20};
+  auto expect_1 = cudf::test::strings_column_wrapper({"quick", "quick", "accénted", "turtlé"});
+  auto expect_2 = column_wrapper<int32_t>{15, 30, 30, 30};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(cudf::table_view({expect_0, expect_1, expect_2}),
+                                     cudf::concatenate({chunks[0]->view(), chunks[1]->view()})
+                                       ->view());
+
+  cudf::chunked_cross_join indices_join(table_a, table_b, 100, &less);
+  auto indices = indices_join.next_indices();
+  EXPECT_FALSE(indices_join.has_next());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{0, 0, 1, 2}, indices.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{0, 2, 2, 2}, indices.second->view());
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/communicator.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace {
+/**
+ * @brief Messages in flight between the ranks of one process, keyed by (source, target, tag)
+ */
+struct mailbox {
+  std::mutex mutex;
+  std::condition_variable delivered;
+  std::map<std::tuple<int, int, int>, std::deque<rmm::device_buffer>> messages;
+};
+
+struct completed_request : public cudf::communicator::request {
+  bool test() override { return true; }
+  void wait() override {}
+};
+
+class pending_receive : public cudf::communicator::request {
+ public:
+  pending_receive(mailbox& box, std::tuple<int, int, int> key, void* data, std::size_t size)
+    : _box(box), _key(key), _data(data), _size(size)
+  {
+  }
+
+  bool test() override
+  {
+    std::lock_guard<std::mutex> lock(_box.mutex);
+    return try_receive();
+  }
+
+  void wait() override
+  {
+    std::unique_lock<std::mutex> lock(_box.mutex);
+    _box.delivered.wait(lock, [this]() { return try_receive(); });
+  }
+
+ private:
+  // Called with the mailbox locked
+  bool try_receive()
+  {
+    if (_done) { return true; }
+    auto& queue = _box.messages[_key];
+    if (queue.empty()) { return false; }
+    CUDF_EXPECTS(queue.front().size() == _size, "Message size mismatch");
+    CUDA_TRY(cudaMemcpy(_data, queue.front().data(), _size, cudaMemcpyDeviceToDevice));
+    queue.pop_front();
+    _done = true;
+    return true;
+  }
+
+  mailbox& _box;
+  std::tuple<int, int, int> _key;
+  void* _data;
+  std::size_t _size;
+  bool _done = false;
+};
+
+/**
+ * @brief Communicator between threads of one process sharing the device, which sends by copy
+ */
+class loopback_communicator : public cudf::communicator {
+ public:
+  loopback_communicator(mailbox& box, int rank, int size) : _box(box), _rank(rank), _size(size) {}
+
+  int rank() const override { return _rank; }
+  int size() const override { return _size; }
+
+  std::unique_ptr<request> send(
+    void const* data, std::size_t size, int peer, int tag, cudaStream_t stream) override
+  {
+    rmm::device_buffer message(data, size, stream);
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    {
+      std::lock_guard<std::mutex> lock(_box.mutex);
+      _box.messages[std::make_tuple(_rank, peer, tag)].push_back(std::move(message));
+    }
+    _box.delivered.notify_all();
+    return std::make_unique<completed_request>();
+  }
+
+  std::unique_ptr<request> recv(
+    void* data, std::size_t size, int peer, int tag, cudaStream_t stream) override
+  {
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    return std::make_unique<pending_receive>(_box, std::make_tuple(peer, _rank, tag), data, size);
+  }
+
+ private:
+  mailbox& _box;
+  int _rank;
+  int _size;
+};
+
+/**
+ * @brief Calls `fn(comm, rank)` on one thread per rank and concatenates the results
+ */
+template <typename Fn>
+std::unique_ptr<cudf::table> run_on_ranks(int num_ranks, Fn fn)
+{
+  mailbox box;
+  std::vector<std::unique_ptr<cudf::table>> results(num_ranks);
+  std::vector<std::thread> threads;
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    threads.emplace_back([&, rank]() {
+      loopback_communicator comm(box, rank, num_ranks);
+      results[rank] = fn(comm, rank);
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  std::vector<cudf::table_view> views;
+  for (auto const& result : results) { views.push_back(result->view()); }
+  return cudf::concatenate(views);
+}
+
+std::unique_ptr<cudf::table> sorted(cudf::table_view const& input)
+{
+  return cudf::gather(input, *cudf::sorted_order(input));
+}
+
+}  // namespace
+
+struct DistributedJoinTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DistributedJoinTest, MatchesJoinOfWholeTables)
+{
+  constexpr cudf::size_type num_rows = 300;
+  constexpr int num_ranks            = 3;
+
+  auto left_keys =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return (i * 7) % 90; });
+  auto right_keys = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 60; });
+  auto values     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  std::vector<std::string> names;
+  for (cudf::size_type i = 0; i < num_rows; ++i) { names.push_back("row" + std::to_string(i)); }
+
+  cudf::test::fixed_width_column_wrapper<int32_t> left_key_col(left_keys, left_keys + num_rows);
+  cudf::test::strings_column_wrapper left_name_col(names.begin(), names.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> right_key_col(right_keys,
+                                                                right_keys + num_rows);
+  cudf::test::fixed_width_column_wrapper<int32_t> right_value_col(values, values + num_rows);
+  cudf::table_view left({left_key_col, left_name_col});
+  cudf::table_view right({right_key_col, right_value_col});
+
+  // Every rank starts with a slice of both tables
+  std::vector<cudf::size_type> bounds;
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    bounds.push_back(rank * num_rows / num_ranks);
+    bounds.push_back((rank + 1) * num_rows / num_ranks);
+  }
+  auto const left_slices  = cudf::slice(left, bounds);
+  auto const right_slices = cudf::slice(right, bounds);
+
+  {
+    auto expected = cudf::inner_join(left, right, {0}, {0}, {{0, 0}});
+    auto result   = run_on_ranks(num_ranks, [&](cudf::communicator& comm, int rank) {
+      return cudf::distributed_inner_join(
+        left_slices[rank], right_slices[rank], {0}, {0}, {{0, 0}}, comm);
+    });
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted(expected->view()), *sorted(result->view()));
+  }
+
+  {
+    auto expected = cudf::left_join(left, right, {0}, {0}, {{0, 0}});
+    auto result   = run_on_ranks(num_ranks, [&](cudf::communicator& comm, int rank) {
+      return cudf::distributed_left_join(
+        left_slices[rank], right_slices[rank], {0}, {0}, {{0, 0}}, comm);
+    });
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted(expected->view()), *sorted(result->view()));
+  }
+}
+
+TEST_F(DistributedJoinTest, SingleRank)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> left_col{3, 1, 2, 0, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> right_col{0, 1, 3, 3};
+  cudf::table_view left({left_col});
+  cudf::table_view right({right_col});
+
+  auto expected = cudf::inner_join(left, right, {0}, {0}, {});
+  auto result   = run_on_ranks(1, [&](cudf::communicator& comm, int) {
+    return cudf::distributed_inner_join(left, right, {0}, {0}, {}, comm);
+  });
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted(expected->view()), *sorted(result->view()));
+}
@@ -17,8 +17,14 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/memory_estimate.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -29,6 +35,8 @@
 #include <tests/utilities/type_lists.hpp>
 #include "cudf/types.hpp"
 
+#include <thread>
+
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
 using strcol_wrapper = cudf::test::strings_column_wrapper;
@@ -525,6 +533,39 @@ TEST_F(JoinTest, InnerJoinNoNulls)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinTest, InnerJoinOnSeveralStreams)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2}};
+  strcol_wrapper col0_1({"s1", "s1", "s0", "s4", "s0"});
+  column_wrapper<int32_t> col1_0{{2, 2, 0, 4, 3}};
+  strcol_wrapper col1_1({"s1", "s0", "s1", "s2", "s1"});
+
+  cudf::table_view t0({col0_0, col0_1});
+  cudf::table_view t1({col1_0, col1_1});
+
+  auto expected = cudf::sort(cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}})->view());
+
+  // Independent joins from several host threads, each on its own stream
+  std::vector<cudaStream_t> streams(4);
+  for (auto& stream : streams) { CUDA_TRY(cudaStreamCreate(&stream)); }
+  std::vector<std::unique_ptr<cudf::table>> results(streams.size());
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < streams.size(); ++i) {
+    threads.emplace_back([&, i] {
+      auto const mr = rmm::mr::get_default_resource();
+      auto joined =
+        cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}}, cudf::null_equality::EQUAL, mr, streams[i]);
+      results[i] = cudf::sort(joined->view(), {}, {}, mr, streams[i]);
+      cudaStreamSynchronize(streams[i]);
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  for (auto const& result : results) { CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result); }
+  results.clear();
+  for (auto stream : streams) { CUDA_TRY(cudaStreamDestroy(stream)); }
+}
+
 TEST_F(JoinTest, InnerJoinNonAlignedCommon)
 {
   CVector cols0, cols1;
@@ -1194,4 +1235,357 @@ TEST_F(JoinTest, HashJoinSequentialProbes)
   }
 }
 
+TEST_F(JoinTest, HashJoinExactOutputSize)
+{
+  // Most build rows share one key, so that the sampled estimate is far off
+  auto build_keys = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 100 == 0) ? i : 7; });
+  auto probe_keys = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 2 == 0) ? 7 : i; });
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>(build_keys, build_keys + 1000).release());
+  Table t1(std::move(cols1));
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>(probe_keys, probe_keys + 5000).release());
+  Table t0(std::move(cols0));
+
+  cudf::hash_join estimate_join(t1, {0});
+  cudf::hash_join exact_join(t1, {0}, cudf::hash_join::output_size_policy::EXACT);
+
+  {
+    auto expected = estimate_join.left_join(t0, {0}, {});
+    auto result   = exact_join.left_join(t0, {0}, {});
+    EXPECT_EQ(result->num_rows(), expected->num_rows());
+
+    auto sorted_expected = cudf::gather(expected->view(), *cudf::sorted_order(expected->view()));
+    auto sorted_result   = cudf::gather(result->view(), *cudf::sorted_order(result->view()));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted_expected, *sorted_result);
+  }
+
+  {
+    auto to_table = [](auto&& probe_build_pair) {
+      auto joined_cols = probe_build_pair.first->release();
+      auto build_cols  = probe_build_pair.second->release();
+      joined_cols.insert(joined_cols.end(),
+                         std::make_move_iterator(build_cols.begin()),
+                         std::make_move_iterator(build_cols.end()));
+      return std::make_unique<cudf::table>(std::move(joined_cols));
+    };
+    auto expected = to_table(estimate_join.inner_join(t0, {0}, {}));
+    auto result   = to_table(exact_join.inner_join(t0, {0}, {}));
+    EXPECT_EQ(result->num_rows(), expected->num_rows());
+
+    auto sorted_expected = cudf::gather(expected->view(), *cudf::sorted_order(expected->view()));
+    auto sorted_result   = cudf::gather(result->view(), *cudf::sorted_order(result->view()));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted_expected, *sorted_result);
+  }
+}
+
+TEST_F(JoinTest, HashJoinHeavyKeys)
+{
+  // Key 7 has 2000 build rows, above the heavy key threshold, the other keys are unique
+  auto build_keys =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return (i % 3 == 0) ? i : 7; });
+  auto probe_keys =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return (i % 2 == 0) ? 7 : i; });
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>(build_keys, build_keys + 3000).release());
+  Table t1(std::move(cols1));
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>(probe_keys, probe_keys + 100).release());
+  Table t0(std::move(cols0));
+
+  // 50 probe rows match key 7, and the 17 odd multiples of 3 below 100 match one row each
+  for (auto policy : {cudf::hash_join::output_size_policy::ESTIMATE,
+                      cudf::hash_join::output_size_policy::EXACT}) {
+    cudf::hash_join hash_join(t1, {0}, policy);
+    EXPECT_EQ(50 * 2000 + 17, hash_join.inner_join(t0, {0}, {}).first->num_rows());
+    EXPECT_EQ(50 * 2000 + 50, hash_join.left_join(t0, {0}, {})->num_rows());
+    EXPECT_EQ(50 + 17, hash_join.left_semi_join(t0, {0}, {0})->num_rows());
+    EXPECT_EQ(50 - 17, hash_join.left_anti_join(t0, {0}, {0})->num_rows());
+  }
+}
+
+TEST_F(JoinTest, PartitionedJoinsMatchJoins)
+{
+  auto left_keys =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return (i * 7) % 300; });
+  auto right_keys = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 400; });
+  auto values     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>(left_keys, left_keys + 1000).release());
+  cols0.emplace_back(column_wrapper<int32_t>(values, values + 1000).release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>(right_keys, right_keys + 800).release());
+  cols1.emplace_back(column_wrapper<int32_t>(values, values + 800).release());
+  Table t1(std::move(cols1));
+
+  auto expect_same_rows = [](cudf::table_view const& expected, cudf::table_view const& result) {
+    auto sorted_expected = cudf::gather(expected, *cudf::sorted_order(expected));
+    auto sorted_result   = cudf::gather(result, *cudf::sorted_order(result));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted_expected, *sorted_result);
+  };
+
+  auto inner_expected = cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}});
+  auto inner_result   = cudf::partitioned_inner_join(t0, t1, {0}, {0}, {{0, 0}}, 4);
+  expect_same_rows(inner_expected->view(), inner_result->view());
+
+  auto left_expected = cudf::left_join(t0, t1, {0}, {0}, {{0, 0}});
+  auto left_result   = cudf::partitioned_left_join(t0, t1, {0}, {0}, {{0, 0}}, 4);
+  expect_same_rows(left_expected->view(), left_result->view());
+
+  auto full_expected = cudf::full_join(t0, t1, {0}, {0}, {});
+  auto full_result   = cudf::partitioned_full_join(t0, t1, {0}, {0}, {}, 4);
+  expect_same_rows(full_expected->view(), full_result->view());
+}
+
+TEST_F(JoinTest, JoinIndicesMatchJoins)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2}};
+  strcol_wrapper col0_1({"s1", "s1", "s0", "s4", "s0"}, {1, 1, 0, 1, 1});
+  column_wrapper<int32_t> col1_0{{2, 2, 0, 4, 3, 5}};
+  strcol_wrapper col1_1({"s1", "s0", "s1", "s2", "s1", "s3"});
+
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(col0_1.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  auto expect_gathered_equal = [&](cudf::table_view const& expected, auto const& gather_maps) {
+    auto left  = cudf::detail::gather(t0,
+                                      gather_maps.first->view(),
+                                      cudf::detail::out_of_bounds_policy::NULLIFY,
+                                      cudf::detail::negative_index_policy::NOT_ALLOWED);
+    auto right = cudf::detail::gather(t1,
+                                      gather_maps.second->view(),
+                                      cudf::detail::out_of_bounds_policy::NULLIFY,
+                                      cudf::detail::negative_index_policy::NOT_ALLOWED);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf::table_view({left->view(), right->view()}));
+  };
+
+  auto inner_expected = cudf::inner_join(t0, t1, {0}, {0}, {});
+  expect_gathered_equal(inner_expected->view(), cudf::inner_join_indices(t0, t1, {0}, {0}));
+
+  auto left_expected = cudf::left_join(t0, t1, {0}, {0}, {});
+  expect_gathered_equal(left_expected->view(), cudf::left_join_indices(t0, t1, {0}, {0}));
+
+  auto full_expected = cudf::full_join(t0, t1, {0}, {0}, {});
+  expect_gathered_equal(full_expected->view(), cudf::full_join_indices(t0, t1, {0}, {0}));
+
+  cudf::hash_join hash_join(t1, {0});
+  auto probe_expected = hash_join.left_join(t0, {0}, {});
+  expect_gathered_equal(probe_expected->view(), hash_join.left_join_indices(t0, {0}));
+}
+
+TEST_F(JoinTest, InnerJoinOnStrings)
+{
+  // equal sizes and prefixes, around the 12 bytes stored inline
+  strcol_wrapper col0_0(
+    {"abcd", "abcdefghijklmnop", "abcdefghijklmnoq", "", "ab", "", "abcdefghijkl"},
+    {1, 1, 1, 0, 1, 1, 1});
+  column_wrapper<int32_t> col0_1{{0, 1, 2, 3, 4, 5, 6}};
+  strcol_wrapper col1_0({"abcdefghijklmnoq", "abcd", "abcdefghijklm", "", "", "abcdefghijkl"},
+                        {1, 1, 1, 0, 1, 1});
+  column_wrapper<int32_t> col1_1{{0, 1, 2, 3, 4, 5}};
+
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(col0_1.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  auto result        = cudf::inner_join(t0, t1, {0}, {0}, {});
+  auto sorted_result = cudf::sort_by_key(result->view(), result->view().select({1}));
+
+  strcol_wrapper strings_gold({"abcd", "abcdefghijklmnoq", "", "", "abcdefghijkl"},
+                              {1, 1, 0, 1, 1});
+  column_wrapper<int32_t> left_gold{{0, 2, 3, 5, 6}};
+  column_wrapper<int32_t> right_gold{{1, 0, 3, 4, 5}};
+  cudf::table_view gold({strings_gold, left_gold, strings_gold, right_gold});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(gold, sorted_result->view());
+}
+
+TEST_F(JoinTest, InnerJoinOnDictionaries)
+{
+  strcol_wrapper left_strings({"b", "a", "c", "", "d", "b"}, {1, 1, 1, 0, 1, 1});
+  strcol_wrapper right_strings({"c", "b", "e", "", "a"}, {1, 1, 1, 0, 1});
+  auto const left_dictionary  = cudf::dictionary::encode(left_strings);
+  auto const right_dictionary = cudf::dictionary::encode(right_strings);
+
+  auto sorted_indices = [](auto const& gather_maps) {
+    return cudf::sort(cudf::table_view({gather_maps.first->view(), gather_maps.second->view()}));
+  };
+  auto join_indices = [&](cudf::column_view const& left, cudf::column_view const& right) {
+    return sorted_indices(
+      cudf::inner_join_indices(cudf::table_view({left}), cudf::table_view({right}), {0}, {0}));
+  };
+
+  // the dictionaries have different keys, so one side is remapped to the keys of the other
+  CUDF_TEST_EXPECT_TABLES_EQUAL(join_indices(left_strings, right_strings)->view(),
+                                join_indices(*left_dictionary, *right_dictionary)->view());
+  // a self join shares the keys, and compares the indices directly
+  CUDF_TEST_EXPECT_TABLES_EQUAL(join_indices(left_strings, left_strings)->view(),
+                                join_indices(*left_dictionary, *left_dictionary)->view());
+}
+
+TEST_F(JoinTest, InnerJoinOnStructs)
+{
+  column_wrapper<int32_t> left_ints{{1, 2, 1, 3, 2, 1}, {1, 1, 1, 1, 0, 1}};
+  strcol_wrapper left_strings{"a", "b", "a", "c", "b", "x"};
+  column_wrapper<int32_t> right_ints{{2, 1, 3, 1, 4}, {0, 1, 1, 1, 1}};
+  strcol_wrapper right_strings{"b", "a", "d", "x", "a"};
+  cudf::test::structs_column_wrapper left_structs{{left_ints, left_strings}, {1, 1, 1, 0, 1, 1}};
+  cudf::test::structs_column_wrapper right_structs{{right_ints, right_strings}, {1, 1, 1, 1, 0}};
+
+  auto sorted_indices = [](auto const& gather_maps) {
+    return cudf::sort(cudf::table_view({gather_maps.first->view(), gather_maps.second->view()}));
+  };
+
+  // struct rows join as the rows of their fields, which carry the nulls of the struct rows
+  auto const left_fields  = cudf::structs_column_view(left_structs);
+  auto const right_fields = cudf::structs_column_view(right_structs);
+  auto const expected     = sorted_indices(cudf::inner_join_indices(
+    cudf::table_view({left_fields.child(0), left_fields.child(1)}),
+    cudf::table_view({right_fields.child(0), right_fields.child(1)}),
+    {0, 1},
+    {0, 1}));
+  auto const result       = sorted_indices(cudf::inner_join_indices(
+    cudf::table_view({left_structs}), cudf::table_view({right_structs}), {0}, {0}));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(JoinTest, BloomFilterHasNoFalseNegatives)
+{
+  auto build_keys =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 3 + 100; });
+  auto probe_keys = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> build_col(build_keys, build_keys + 500);
+  column_wrapper<int32_t> probe_col(probe_keys, probe_keys + 2000);
+  cudf::table_view build({build_col});
+  cudf::table_view probe({probe_col});
+
+  cudf::bloom_filter filter(build);
+  auto const all_true = cudf::test::make_counting_transform_iterator(0, [](auto) { return true; });
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*filter.contains(build),
+                                 column_wrapper<bool>(all_true, all_true + 500));
+
+  // Every probe row that joins must pass the filter
+  auto kept_by_filter = cudf::apply_boolean_mask(probe, filter.contains(probe)->view());
+  auto semi_expected  = cudf::left_semi_join(probe, build, {0}, {0}, {0});
+  auto semi_result    = cudf::left_semi_join(kept_by_filter->view(), build, {0}, {0}, {0});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*semi_expected, *semi_result);
+  EXPECT_LT(kept_by_filter->num_rows(), probe.num_rows());
+
+  cudf::hash_join hash_join(build, {0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*filter.contains(probe),
+                                 *hash_join.make_bloom_filter()->contains(probe));
+
+  auto predicates = filter.range_predicates({"key"});
+  ASSERT_EQ(predicates.size(), 2u);
+  EXPECT_EQ(predicates[0].op, cudf::io::filter_op::GREATER_EQUAL);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t> const&>(*predicates[0].value).value(), 100);
+  EXPECT_EQ(predicates[1].op, cudf::io::filter_op::LESS_EQUAL);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t> const&>(*predicates[1].value).value(), 1597);
+}
+
+TEST_F(JoinTest, MergeJoinOnSortedKeys)
+{
+  column_wrapper<int32_t> col0_0{{1, 1, 2, 4, 5}};
+  column_wrapper<int32_t> col0_1{{0, 1, 2, 3, 4}};
+  column_wrapper<int32_t> col1_0{{1, 2, 2, 3, 5, 5}};
+  column_wrapper<int32_t> col1_1{{10, 11, 12, 13, 14, 15}};
+
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(col0_1.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  std::vector<cudf::order_info> keys_order{
+    {cudf::sorted::YES, cudf::order::ASCENDING, cudf::null_order::BEFORE}};
+
+  // The merge join output is sorted on the keys, and within equal keys on the input row order
+  auto hash_inner   = cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}});
+  auto sorted_inner = cudf::gather(hash_inner->view(), *cudf::sorted_order(hash_inner->view()));
+  auto merge_inner =
+    cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}}, cudf::null_equality::EQUAL, keys_order);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted_inner, *merge_inner);
+
+  auto hash_left   = cudf::left_join(t0, t1, {0}, {0}, {{0, 0}});
+  auto sorted_left = cudf::gather(hash_left->view(), *cudf::sorted_order(hash_left->view()));
+  auto merge_left =
+    cudf::left_join(t0, t1, {0}, {0}, {{0, 0}}, cudf::null_equality::EQUAL, keys_order);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted_left, *merge_left);
+}
+
+TEST_F(JoinTest, IntervalJoinIndices)
+{
+  column_wrapper<int32_t> left_group{{1, 1, 2, 1, 2}};
+  column_wrapper<int64_t> left_ts{{9, 1, 5, 6, 12}, {1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> right_group{{1, 2, 1, 2}};
+  column_wrapper<int64_t> right_start{{0, 4, 6, 10}};
+  column_wrapper<int64_t> right_end{{5, 10, 30, 20}};
+
+  cudf::table_view left({left_group, left_ts});
+  cudf::table_view right({right_group, right_start, right_end});
+
+  auto result = cudf::interval_join_indices(left, right, {0}, {0}, 1, 1, 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result.first, column_wrapper<int32_t>{{1, 2, 3, 0}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result.second, column_wrapper<int32_t>{{0, 1, 2, 2}});
+
+  auto without_groups = cudf::interval_join_indices(left, right, {}, {}, 1, 1, 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*without_groups.first,
+                                 column_wrapper<int32_t>{{1, 2, 2, 3, 0, 3, 0}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*without_groups.second,
+                                 column_wrapper<int32_t>{{0, 0, 1, 1, 1, 2, 2}});
+}
+
+TEST_F(JoinTest, EstimateJoinMemoryBoundsOutput)
+{
+  column_wrapper<int32_t> build_keys{{1, 2, 2, 3, 5}};
+  strcol_wrapper build_names{"a", "bb", "ccc", "dddd", "eeeee"};
+  column_wrapper<int32_t> probe_keys{{2, 2, 4, 5, 1, 1}};
+  strcol_wrapper probe_names{"", "f", "gg", "hhhhhhhhhh", "i", "jj"};
+
+  cudf::table_view build({build_keys, build_names});
+  cudf::table_view probe({probe_keys, probe_names});
+
+  auto const build_estimate = cudf::hash_join::estimate_build_memory(build, {0});
+  EXPECT_GT(build_estimate.output_bytes, 0u);
+
+  using policy_type = cudf::hash_join::output_size_policy;
+  for (auto policy : {policy_type::ESTIMATE, policy_type::EXACT}) {
+    cudf::hash_join hash_join(build, {0}, policy);
+
+    auto const inner_estimate = hash_join.estimate_inner_join_memory(probe, {0});
+    auto const inner          = hash_join.inner_join(probe, {0}, {});
+    EXPECT_GE(inner_estimate.output_bytes,
+              cudf::detail::copy_size(inner.first->view()) +
+                cudf::detail::copy_size(inner.second->view()));
+
+    auto const left_estimate = hash_join.estimate_left_join_memory(probe, {0});
+    auto const left          = hash_join.left_join(probe, {0}, {});
+    EXPECT_GE(left_estimate.output_bytes, cudf::detail::copy_size(left->view()));
+
+    auto const full_estimate = hash_join.estimate_full_join_memory(probe, {0});
+    auto const full          = hash_join.full_join(probe, {0}, {});
+    EXPECT_GE(full_estimate.output_bytes, cudf::detail::copy_size(full->view()));
+    EXPECT_GE(full_estimate.peak_bytes(), left_estimate.peak_bytes());
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -691,3 +691,33 @@ TEST_F(JoinTest, LeftAntiJoin_empty_right_table)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(join_table->get_column(2), expect_2);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(join_table->get_column(3), expect_3);
 }
+
+TEST_F(JoinTest, HashJoinSemiAntiJoinMatchFreeFunctions)
+{
+  column_wrapper<int32_t> a_0{{10, 20, 20, 30, 40, 50, 20}, {1, 1, 1, 1, 0, 1, 1}};
+  column_wrapper<int8_t> a_1{90, 77, 78, 61, 62, 63, 41};
+  column_wrapper<int32_t> b_0{{20, 20, 50, 60, 70}, {1, 1, 1, 1, 0}};
+
+  std::vector<std::unique_ptr<cudf::column>> column_a;
+  column_a.push_back(a_0.release());
+  column_a.push_back(a_1.release());
+  std::vector<std::unique_ptr<cudf::column>> column_b;
+  column_b.push_back(b_0.release());
+
+  cudf::table table_a(std::move(column_a));
+  cudf::table table_b(std::move(column_b));
+
+  cudf::hash_join hash_join(table_b, {0});
+  for (auto compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    // Probe the same object more than once to check it is reusable
+    for (int probe = 0; probe < 2; ++probe) {
+      auto semi_expected = cudf::left_semi_join(table_a, table_b, {0}, {0}, {0, 1}, compare_nulls);
+      auto semi_result = hash_join.left_semi_join(table_a, {0}, {0, 1}, compare_nulls);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(*semi_expected, *semi_result);
+
+      auto anti_expected = cudf::left_anti_join(table_a, table_b, {0}, {0}, {0, 1}, compare_nulls);
+      auto anti_result = hash_join.left_anti_join(table_a, {0}, {0, 1}, compare_nulls);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(*anti_expected, *anti_result);
+    }
+  }
+}
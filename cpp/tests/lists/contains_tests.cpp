@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/lists/contains.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+struct ListsContainsTest : public cudf::test::BaseFixture {
+};
+
+template <typename T>
+class ListsContainsNumericsTest : public ListsContainsTest {
+};
+
+TYPED_TEST_CASE(ListsContainsNumericsTest, cudf::test::NumericTypes);
+
+TYPED_TEST(ListsContainsNumericsTest, ContainsKey)
+{
+  auto validity = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0), [](auto i) { return i != 2; });
+  using LCW = cudf::test::lists_column_wrapper<TypeParam>;
+  LCW input({LCW{3, 2, 1}, LCW{}, LCW{1}, LCW({0, 1}, {1, 0}), LCW{0, 0}}, validity);
+
+  cudf::numeric_scalar<TypeParam> key(1);
+  auto result = cudf::lists::contains(cudf::lists_column_view(input), key);
+  cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0}, {1, 1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+
+  auto const sliced = cudf::slice(input, {3, 5}).front();
+  cudf::numeric_scalar<TypeParam> zero(0);
+  auto sliced_result = cudf::lists::contains(cudf::lists_column_view(sliced), zero);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<bool>{1, 1},
+                                 *sliced_result);
+}
+
+TEST_F(ListsContainsTest, Strings)
+{
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW input{LCW{"tag", "event"}, LCW{}, LCW{"Tag", "tags"}, LCW{"event", "tag"}};
+
+  auto result = cudf::lists::contains(cudf::lists_column_view(input), cudf::string_scalar("tag"));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<bool>{1, 0, 0, 1},
+                                 *result);
+}
+
+TEST_F(ListsContainsTest, InvalidKey)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW input{LCW{1, 2}, LCW{3}};
+
+  auto result = cudf::lists::contains(cudf::lists_column_view(input),
+                                      cudf::numeric_scalar<int32_t>(1, false));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<bool>({0, 0}, {0, 0}),
+                                 *result);
+  EXPECT_THROW(cudf::lists::contains(cudf::lists_column_view(input), cudf::string_scalar("1")),
+               cudf::logic_error);
+}
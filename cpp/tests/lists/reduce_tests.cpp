@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/lists/reduce.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <thrust/iterator/transform_iterator.h>
+
+struct ListsReduceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ListsReduceTest, ReduceElements)
+{
+  auto validity = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0), [](auto i) { return i != 2; });
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW input({LCW{3, 2, 1}, LCW{}, LCW{7, 8}, LCW{10, 20, 30}, LCW{4}}, validity);
+  auto const dtype = cudf::data_type{cudf::type_id::INT64};
+
+  auto sum = cudf::lists::reduce_list_elements(
+    cudf::lists_column_view(input), cudf::make_sum_aggregation(), dtype);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_sum({6, 0, 0, 60, 4}, {1, 0, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sum, *sum);
+
+  auto max = cudf::lists::reduce_list_elements(
+    cudf::lists_column_view(input), cudf::make_max_aggregation(), dtype);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_max({3, 0, 0, 30, 4}, {1, 0, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_max, *max);
+}
+
+TEST_F(ListsReduceTest, SlicedInput)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW input{LCW{1, 2}, LCW{3, 4, 5}, LCW{6}, LCW{7, 8}};
+  auto sliced = cudf::slice(input, {1, 3}).front();
+
+  auto result = cudf::lists::reduce_list_elements(cudf::lists_column_view(sliced),
+                                                  cudf::make_sum_aggregation(),
+                                                  cudf::data_type{cudf::type_id::INT32});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<int32_t>{12, 6}, *result);
+}
@@ -695,4 +695,39 @@ TYPED_TEST(MergeTest_, NMerge1KeyColumns)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_column_view2, output_column_view2);
 }
 
+struct MergeManyTablesTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MergeManyTablesTest, NullsAndTies)
+{
+  using cudf::test::fixed_width_column_wrapper;
+  using cudf::test::strings_column_wrapper;
+
+  fixed_width_column_wrapper<int32_t> keys0{{0, 1, 3, 3}, {0, 1, 1, 1}};
+  strings_column_wrapper values0{"a0", "a1", "a2", "a3"};
+  fixed_width_column_wrapper<int32_t> keys1{{0, 2, 3}, {0, 1, 1}};
+  strings_column_wrapper values1{"b0", "b1", "b2"};
+  fixed_width_column_wrapper<int32_t> keys2{0, 3, 5};
+  strings_column_wrapper values2{"c0", "c1", "c2"};
+  fixed_width_column_wrapper<int32_t> keys3{1, 4};
+  strings_column_wrapper values3{"d0", "d1"};
+  fixed_width_column_wrapper<int32_t> keys4{};
+  strings_column_wrapper values4{};
+
+  std::vector<cudf::table_view> tables{cudf::table_view{{keys0, values0}},
+                                       cudf::table_view{{keys1, values1}},
+                                       cudf::table_view{{keys4, values4}},
+                                       cudf::table_view{{keys2, values2}},
+                                       cudf::table_view{{keys3, values3}}};
+  auto result = cudf::merge(tables, {0}, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+
+  // equal keys keep the order of the tables, and the order of the rows within a table
+  fixed_width_column_wrapper<int32_t> expected_keys{{0, 0, 0, 1, 1, 2, 3, 3, 3, 3, 4, 5},
+                                                    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}};
+  strings_column_wrapper expected_values{
+    "a0", "b0", "c0", "a1", "d0", "b1", "a2", "a3", "b2", "c1", "d1", "c2"};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_keys, result->view().column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_values, result->view().column(1));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/sorting.hpp>
@@ -284,4 +285,97 @@ TYPED_TEST(HashPartitionFixedWidth, HasNulls)
   run_fixed_width_test<TypeParam>(10, 1000, 10, true);
 }
 
+TYPED_TEST(HashPartitionFixedWidth, ManyPartitions)
+{
+  run_fixed_width_test<TypeParam>(3, 10000, 4096);
+}
+
+TYPED_TEST(HashPartitionFixedWidth, ManyPartitionsHasNulls)
+{
+  run_fixed_width_test<TypeParam>(2, 5000, 3000, true);
+}
+
+TEST_F(HashPartition, PartitionMap)
+{
+  auto iter = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> integers(iter, iter + 5000);
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h", "", "jj"});
+  auto input   = cudf::table_view({integers});
+  auto columns = std::vector<cudf::size_type>({0});
+
+  for (cudf::size_type num_partitions : {7, 2048}) {
+    std::unique_ptr<cudf::column> map;
+    std::unique_ptr<cudf::table> output;
+    std::vector<cudf::size_type> map_offsets, offsets;
+    std::tie(map, map_offsets) = cudf::hash_partition_map(input, columns, num_partitions);
+    std::tie(output, offsets)  = cudf::hash_partition(input, columns, num_partitions);
+
+    EXPECT_EQ(offsets, map_offsets);
+    EXPECT_EQ(input.num_rows(), map->size());
+
+    // the rows of every partition keep their order
+    thrust::host_vector<cudf::size_type> h_map(map->size());
+    CUDA_TRY(cudaMemcpy(h_map.data(),
+                        map->view().data<cudf::size_type>(),
+                        h_map.size() * sizeof(cudf::size_type),
+                        cudaMemcpyDefault));
+    map_offsets.push_back(input.num_rows());
+    for (cudf::size_type i = 0; i < num_partitions; ++i) {
+      EXPECT_TRUE(
+        std::is_sorted(h_map.begin() + map_offsets[i], h_map.begin() + map_offsets[i + 1]));
+    }
+  }
+
+  auto strings_input = cudf::table_view({strings});
+  std::unique_ptr<cudf::column> map;
+  std::vector<cudf::size_type> map_offsets;
+  std::tie(map, map_offsets) = cudf::hash_partition_map(strings_input, columns, 0);
+  EXPECT_EQ(0, map->size());
+  EXPECT_TRUE(map_offsets.empty());
+}
+
+TEST_F(HashPartition, ContiguousHashPartition)
+{
+  auto iter   = thrust::make_counting_iterator(0);
+  auto valids = thrust::make_transform_iterator(iter, [](auto i) { return i % 3 != 0; });
+  fixed_width_column_wrapper<int32_t> integers(iter, iter + 3000);
+  fixed_width_column_wrapper<int64_t> longs(iter, iter + 3000, valids);
+  fixed_width_column_wrapper<int8_t> bytes(iter, iter + 3000, valids);
+  auto sliced  = cudf::slice(cudf::table_view({integers, longs, bytes}), {5, 2005}).front();
+  auto columns = std::vector<cudf::size_type>({0, 1});
+
+  auto expect_partitions = [&](cudf::table_view const& input, cudf::size_type num_partitions) {
+    auto const result = cudf::contiguous_hash_partition(input, columns, num_partitions);
+    ASSERT_EQ(static_cast<size_t>(num_partitions), result.size());
+
+    // the same rows as the partitioned table, in the same order
+    std::unique_ptr<cudf::column> map;
+    std::vector<cudf::size_type> offsets;
+    std::tie(map, offsets) = cudf::hash_partition_map(input, columns, num_partitions);
+    auto const partitioned = cudf::gather(input, map->view());
+    std::vector<cudf::size_type> indices;
+    for (cudf::size_type i = 0; i < num_partitions; ++i) {
+      indices.push_back(offsets[i]);
+      indices.push_back(i + 1 < num_partitions ? offsets[i + 1] : input.num_rows());
+    }
+    auto const expected = cudf::slice(partitioned->view(), indices);
+    for (cudf::size_type i = 0; i < num_partitions; ++i) {
+      CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected[i], result[i].table);
+    }
+  };
+
+  for (cudf::size_type num_partitions : {1, 7, 2048}) {
+    expect_partitions(sliced, num_partitions);
+  }
+
+  // strings columns are partitioned before they are packed
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h", "", "jj"},
+                                 {1, 1, 0, 1, 1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int32_t> keys({3, 1, 4, 1, 5, 9, 2, 6, 5, 3});
+  expect_partitions(cudf::table_view({keys, strings}), 3);
+
+  EXPECT_TRUE(cudf::contiguous_hash_partition(sliced, columns, 0).empty());
+  EXPECT_TRUE(cudf::contiguous_hash_partition(sliced, {}, 4).empty());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
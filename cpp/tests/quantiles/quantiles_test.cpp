@@ -29,6 +29,8 @@
 #include <cudf/quantiles.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <limits>
+
 using namespace cudf;
 using namespace test;
 
@@ -173,3 +175,49 @@ TYPED_TEST(QuantilesTest, TestMultiColumnAssumedSorted)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, actual->view());
 }
+
+struct QuantilesSelectTest : public BaseFixture {
+};
+
+TEST_F(QuantilesSelectTest, TestSingleColumnUnsortedWithNulls)
+{
+  fixed_width_column_wrapper<int32_t> input_a({4, 1, 0, 3, 1, 5, 0, 2}, {1, 1, 0, 1, 1, 1, 0, 1});
+  auto input = table_view({input_a});
+
+  // [null, null, 1, 1, 2, 3, 4, 5]
+  auto actual = quantiles(input, {0.0, 0.25, 0.5, 0.9, 1.0});
+  fixed_width_column_wrapper<int32_t> expected_nearest({0, 1, 2, 4, 5}, {0, 1, 1, 1, 1});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected_nearest}), actual->view());
+
+  // [null, null, 5, 4, 3, 2, 1, 1]
+  actual = quantiles(input,
+                     {0.3, 0.5, 1.0},
+                     interpolation::LOWER,
+                     sorted::NO,
+                     {order::DESCENDING},
+                     {null_order::AFTER});
+  fixed_width_column_wrapper<int32_t> expected_lower({5, 4, 1});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected_lower}), actual->view());
+
+  // [1, 1, 2, 3, 4, 5, null, null]
+  actual = quantiles(input,
+                     {0.7, 0.8},
+                     interpolation::HIGHER,
+                     sorted::NO,
+                     {order::ASCENDING},
+                     {null_order::AFTER});
+  fixed_width_column_wrapper<int32_t> expected_higher({5, 0}, {1, 0});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected_higher}), actual->view());
+}
+
+TEST_F(QuantilesSelectTest, TestSingleColumnUnsortedNaN)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  fixed_width_column_wrapper<double> input_a{nan, -1.5, 0.0, 2.5, nan};
+  auto input = table_view({input_a});
+
+  // [-1.5, 0.0, 2.5, nan, nan]
+  auto actual = quantiles(input, {0.0, 0.5, 1.0});
+  fixed_width_column_wrapper<double> expected{-1.5, 2.5, nan};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected}), actual->view());
+}
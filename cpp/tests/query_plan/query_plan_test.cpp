@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/query_plan.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+using namespace cudf::test;
+using cudf::ast::ast_operator;
+using cudf::ast::column_reference;
+using cudf::ast::operation;
+
+struct QueryPlanTest : public BaseFixture {
+};
+
+TEST_F(QueryPlanTest, FilterJoinProjectReduce)
+{
+  auto id        = fixed_width_column_wrapper<int32_t>{0, 1, 2, 3, 4, 5};
+  auto customer  = fixed_width_column_wrapper<int32_t>{1, 2, 1, 3, 2, 9};
+  auto amount    = fixed_width_column_wrapper<int32_t>{50, 150, 200, 30, 120, 500};
+  auto orders    = cudf::table_view{{id, customer, amount}};
+  auto cid       = fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto score     = fixed_width_column_wrapper<int32_t>{10, 20, 30};
+  auto customers = cudf::table_view{{cid, score}};
+
+  // amount > 100
+  auto hundred   = cudf::numeric_scalar<int32_t>(100);
+  auto lit       = cudf::ast::literal(hundred);
+  auto col_amt   = column_reference(2);
+  auto predicate = operation(ast_operator::GREATER, col_amt, lit);
+
+  cudf::query_plan plan;
+  auto big      = plan.filter(plan.scan(orders), predicate);
+  auto joined   = plan.inner_join(big, plan.scan(customers), {1}, {0});
+  auto selected = plan.project(joined, {0, 4});
+  auto total    = plan.reduce(
+    selected, 1, cudf::make_sum_aggregation(), cudf::data_type{cudf::type_id::INT64});
+  auto largest = plan.reduce(
+    joined, 2, cudf::make_max_aggregation(), cudf::data_type{cudf::type_id::INT32});
+  auto first = plan.reduce(
+    selected, 0, cudf::make_min_aggregation(), cudf::data_type{cudf::type_id::INT32});
+
+  auto results = plan.execute({selected, total, largest, first});
+  ASSERT_EQ(results.size(), 4u);
+
+  auto sorted          = cudf::sort(results[0].rows->view());
+  auto expected_id     = fixed_width_column_wrapper<int32_t>{1, 2, 4};
+  auto expected_score  = fixed_width_column_wrapper<int32_t>{20, 10, 20};
+  auto expected_select = cudf::table_view{{expected_id, expected_score}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_select, sorted->view());
+
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int64_t>*>(results[1].value.get())->value(), 50);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>*>(results[2].value.get())->value(), 200);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>*>(results[3].value.get())->value(), 1);
+  EXPECT_TRUE(results[1].rows == nullptr);
+  EXPECT_TRUE(results[0].value == nullptr);
+}
+
+TEST_F(QueryPlanTest, GatherChainThenFilter)
+{
+  auto a     = fixed_width_column_wrapper<int32_t>{10, 20, 30, 40, 50};
+  auto b     = fixed_width_column_wrapper<double>{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 1}};
+  auto input = cudf::table_view{{a, b}};
+  auto map1  = fixed_width_column_wrapper<int32_t>{4, 3, 2, 1};
+  auto map2  = fixed_width_column_wrapper<int64_t>{0, 2, -1};
+
+  // a > 25
+  auto bound     = cudf::numeric_scalar<int32_t>(25);
+  auto lit       = cudf::ast::literal(bound);
+  auto col_a     = column_reference(0);
+  auto predicate = operation(ast_operator::GREATER, col_a, lit);
+
+  cudf::query_plan plan;
+  auto gathered = plan.gather(plan.gather(plan.scan(input), map1), map2);
+  auto filtered = plan.filter(gathered, predicate);
+  auto swapped  = plan.project(filtered, {1, 0});
+
+  auto results = plan.execute({gathered, swapped});
+
+  auto expected_a = fixed_width_column_wrapper<int32_t>{50, 30, 20};
+  auto expected_b = fixed_width_column_wrapper<double>{{5, 3, 2}, {1, 1, 0}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_a, expected_b}),
+                                results[0].rows->view());
+
+  auto filtered_a = fixed_width_column_wrapper<int32_t>{50, 30};
+  auto filtered_b = fixed_width_column_wrapper<double>{5, 3};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({filtered_b, filtered_a}),
+                                results[1].rows->view());
+
+  // the plan is not consumed by its execution
+  auto again = plan.execute({swapped});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(results[1].rows->view(), again[0].rows->view());
+}
+
+TEST_F(QueryPlanTest, ScanOutputIsCopied)
+{
+  auto a     = fixed_width_column_wrapper<int32_t>{{1, 2, 3}, {1, 0, 1}};
+  auto input = cudf::table_view{{a}};
+
+  cudf::query_plan plan;
+  auto results = plan.execute({plan.scan(input)});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, results[0].rows->view());
+}
+
+TEST_F(QueryPlanTest, InvalidNodes)
+{
+  auto a     = fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto input = cudf::table_view{{a}};
+
+  cudf::query_plan plan;
+  auto scanned = plan.scan(input);
+  auto sum     = plan.reduce(
+    scanned, 0, cudf::make_sum_aggregation(), cudf::data_type{cudf::type_id::INT64});
+  EXPECT_THROW(plan.project(scanned, {1}), cudf::logic_error);
+  EXPECT_THROW(plan.project(sum, {0}), cudf::logic_error);
+  EXPECT_THROW(plan.project(7, {0}), cudf::logic_error);
+  EXPECT_THROW(plan.execute({scanned, scanned}), cudf::logic_error);
+
+  auto col_b     = column_reference(1);
+  auto predicate = operation(ast_operator::IS_NULL, col_b);
+  EXPECT_THROW(plan.filter(scanned, predicate), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
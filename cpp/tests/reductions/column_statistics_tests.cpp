@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/statistics.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+struct ColumnStatisticsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ColumnStatisticsTest, AllRows)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 5, 3, 0, 9, 5}, {1, 1, 1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper strings{"pear", "apple", "fig", "plum", "kiwi", "apple"};
+  cudf::test::fixed_width_column_wrapper<double> nulls{{1.0, 1.0, 1.0, 1.0, 1.0, 1.0},
+                                                       {0, 0, 0, 0, 0, 0}};
+
+  cudf::statistics_options options;
+  options.num_histogram_buckets = 2;
+  auto const stats = cudf::compute_column_statistics(cudf::table_view{{ints, strings, nulls}},
+                                                     options);
+  ASSERT_EQ(stats.size(), 3u);
+
+  EXPECT_EQ(stats[0].num_rows, 6);
+  EXPECT_EQ(stats[0].null_count, 1);
+  EXPECT_EQ(stats[0].sampled_rows, 6);
+  EXPECT_EQ(stats[0].approx_distinct_count, 4);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>*>(stats[0].min.get())->value(), 1);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>*>(stats[0].max.get())->value(), 9);
+  // The non-null values are {1, 3, 5, 5, 9}
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_histogram{1, 5, 9};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_histogram, stats[0].histogram->view());
+
+  EXPECT_EQ(stats[1].null_count, 0);
+  EXPECT_EQ(stats[1].approx_distinct_count, 5);
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(stats[1].min.get())->to_string(), "apple");
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(stats[1].max.get())->to_string(), "plum");
+  cudf::test::strings_column_wrapper expected_strings_histogram{"apple", "kiwi", "plum"};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_strings_histogram, stats[1].histogram->view());
+
+  // Nothing but the counts is known for a column without values
+  EXPECT_EQ(stats[2].null_count, 6);
+  EXPECT_EQ(stats[2].approx_distinct_count, 0);
+  EXPECT_EQ(stats[2].min, nullptr);
+  EXPECT_EQ(stats[2].max, nullptr);
+  EXPECT_EQ(stats[2].histogram, nullptr);
+}
+
+TEST_F(ColumnStatisticsTest, Sampled)
+{
+  auto const begin = thrust::make_counting_iterator<int64_t>(0);
+  auto const valid = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 4; });
+  cudf::test::fixed_width_column_wrapper<int64_t> values(begin, begin + 1000, valid);
+
+  cudf::statistics_options options;
+  options.sample_size           = 100;
+  options.num_histogram_buckets = 0;
+  auto const stats = cudf::compute_column_statistics(cudf::table_view{{values}}, options);
+
+  // The counts are exact, the rest comes from the sample
+  EXPECT_EQ(stats[0].num_rows, 1000);
+  EXPECT_EQ(stats[0].null_count, 250);
+  EXPECT_EQ(stats[0].sampled_rows, 100);
+  EXPECT_LE(stats[0].approx_distinct_count, 100);
+  EXPECT_GE(static_cast<cudf::numeric_scalar<int64_t>*>(stats[0].min.get())->value(), 0);
+  EXPECT_LT(static_cast<cudf::numeric_scalar<int64_t>*>(stats[0].max.get())->value(), 1000);
+  EXPECT_EQ(stats[0].histogram, nullptr);
+}
+
+TEST_F(ColumnStatisticsTest, InvalidOptions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> values{1, 2, 3};
+  cudf::statistics_options options;
+  options.distinct_count_precision = 2;
+  EXPECT_THROW(cudf::compute_column_statistics(cudf::table_view{{values}}, options),
+               cudf::logic_error);
+}
@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 #include <vector>
 
 #include <tests/utilities/base_fixture.hpp>
@@ -900,6 +902,37 @@ TYPED_TEST(ReductionTest, Quantile)
                        cudf::make_quantile_aggregation({1}, interp));
 }
 
+TYPED_TEST(ReductionTest, ApproxQuantile)
+{
+  using T = TypeParam;
+  //{-20, -14, -13,  0, 6, 13, 45, 64/None}
+  std::vector<int> int_values({6, -14, 13, 64, 0, -13, -20, 45});
+  std::vector<bool> host_bools({1, 1, 1, 0, 1, 1, 1, 1});
+  std::vector<T> v = convert_values<T>(int_values);
+
+  // Every value of a small column is a centroid of its own, so the extremes are exact
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  double expected_value0 = std::is_same<T, bool>::value || std::is_unsigned<T>::value ? v[4] : v[6];
+  this->reduction_test(
+    col, expected_value0, this->ret_non_arithmetic, cudf::make_approx_quantile_aggregation({0.0}));
+  double expected_value1 = v[3];
+  this->reduction_test(
+    col, expected_value1, this->ret_non_arithmetic, cudf::make_approx_quantile_aggregation({1.0}));
+
+  // test with nulls
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  double expected_null_value1                         = v[7];
+
+  this->reduction_test(col_nulls,
+                       expected_value0,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_quantile_aggregation({0}));
+  this->reduction_test(col_nulls,
+                       expected_null_value1,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_quantile_aggregation({1}));
+}
+
 TYPED_TEST(ReductionTest, UniqueCount)
 {
   using T = TypeParam;
@@ -934,6 +967,40 @@ TYPED_TEST(ReductionTest, UniqueCount)
                        cudf::make_nunique_aggregation(cudf::null_policy::EXCLUDE));
 }
 
+TYPED_TEST(ReductionTest, ApproxUniqueCount)
+{
+  using T = TypeParam;
+  std::vector<int> int_values({1, -3, 1, 2, 0, 2, -4, 45});  // 6 unique values
+  std::vector<bool> host_bools({1, 1, 1, 0, 1, 1, 1, 1});
+  std::vector<T> v = convert_values<T>(int_values);
+
+  // test without nulls
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  int64_t expected_value = std::is_same<T, bool>::value ? 2 : 6;
+  this->reduction_test(col,
+                       expected_value,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_nunique_aggregation(14, cudf::null_policy::INCLUDE));
+  this->reduction_test(col,
+                       expected_value,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_nunique_aggregation(14, cudf::null_policy::EXCLUDE));
+
+  // test with nulls
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  int64_t expected_null_value0                        = std::is_same<T, bool>::value ? 3 : 7;
+  int64_t expected_null_value1                        = std::is_same<T, bool>::value ? 2 : 6;
+
+  this->reduction_test(col_nulls,
+                       expected_null_value0,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_nunique_aggregation(14, cudf::null_policy::INCLUDE));
+  this->reduction_test(col_nulls,
+                       expected_null_value1,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_nunique_aggregation(14, cudf::null_policy::EXCLUDE));
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -992,4 +1059,134 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointReductionSum)
   // EXPECT_EQ(result_scalar->value(), TEN);
 }
 
+struct MultiReductionTest : public cudf::test::BaseFixture {
+};
+
+template <typename T>
+T scalar_value(std::unique_ptr<cudf::scalar> const &s)
+{
+  EXPECT_TRUE(s->is_valid());
+  return static_cast<cudf::scalar_type_t<T> *>(s.get())->value();
+}
+
+TEST_F(MultiReductionTest, MatchesSingleReductions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({5, -3, 8, 1000, 2, -7}, {1, 1, 0, 1, 1, 1});
+  auto const int64_type  = cudf::data_type{cudf::type_id::INT64};
+  auto const int32_type  = cudf::data_type{cudf::type_id::INT32};
+  auto const double_type = cudf::data_type{cudf::type_id::FLOAT64};
+
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_count_aggregation());
+  aggs.push_back(cudf::make_sum_of_squares_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+  aggs.push_back(cudf::make_variance_aggregation(1));
+  aggs.push_back(cudf::make_std_aggregation(0));
+  aggs.push_back(cudf::make_median_aggregation());
+  std::vector<cudf::data_type> types{int32_type,
+                                     int32_type,
+                                     int64_type,
+                                     int32_type,
+                                     int64_type,
+                                     double_type,
+                                     double_type,
+                                     double_type,
+                                     double_type};
+
+  auto const results = cudf::reduce(col, aggs, types);
+  ASSERT_EQ(results.size(), aggs.size());
+  EXPECT_EQ(scalar_value<int32_t>(results[0]), -7);
+  EXPECT_EQ(scalar_value<int32_t>(results[1]), 1000);
+  EXPECT_EQ(scalar_value<int64_t>(results[2]), 997);
+  EXPECT_EQ(scalar_value<int32_t>(results[3]), 5);
+  EXPECT_EQ(scalar_value<int64_t>(results[4]), 1000087);
+  for (size_t i : {5, 6, 7, 8}) {
+    auto const expected = cudf::reduce(col, aggs[i], types[i]);
+    EXPECT_DOUBLE_EQ(scalar_value<double>(results[i]), scalar_value<double>(expected));
+  }
+}
+
+TEST_F(MultiReductionTest, AllNulls)
+{
+  cudf::test::fixed_width_column_wrapper<double> col({1., 2., 3.}, {0, 0, 0});
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+  auto const results = cudf::reduce(
+    col, aggs, {cudf::data_type{cudf::type_id::FLOAT64}, cudf::data_type{cudf::type_id::INT32}});
+
+  EXPECT_FALSE(results[0]->is_valid());
+  EXPECT_EQ(scalar_value<int32_t>(results[1]), 3);
+}
+
+TEST_F(MultiReductionTest, Table)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col0{4, 1, 9};
+  cudf::test::strings_column_wrapper col1({"b", "", "a", "c"}, {1, 0, 1, 1});
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_count_aggregation());
+  aggs.push_back(cudf::make_min_aggregation());
+
+  auto const int32_type  = cudf::data_type{cudf::type_id::INT32};
+  auto const string_type = cudf::data_type{cudf::type_id::STRING};
+  EXPECT_THROW(cudf::reduce(cudf::table_view{{col0}}, aggs, {}), cudf::logic_error);
+
+  auto const results = cudf::reduce(cudf::table_view{{col0}},
+                                    aggs,
+                                    {{int32_type, cudf::data_type{cudf::type_id::INT16}}});
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(scalar_value<int32_t>(results[0][0]), 3);
+  EXPECT_EQ(scalar_value<int16_t>(results[0][1]), 1);
+
+  auto const strings_results = cudf::reduce(col1, aggs, {int32_type, string_type});
+  EXPECT_EQ(scalar_value<int32_t>(strings_results[0]), 3);
+  EXPECT_EQ(static_cast<cudf::string_scalar *>(strings_results[1].get())->to_string(), "a");
+}
+
+struct ValidityWordReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ValidityWordReductionTest, SlicedRuns)
+{
+  // runs of 128 valid rows, 128 null rows and 128 rows with some nulls
+  auto const num_rows = 1000;
+  std::vector<int32_t> values(num_rows);
+  std::vector<bool> validity(num_rows);
+  for (int row = 0; row < num_rows; ++row) {
+    values[row]   = row % 7 - 3;
+    validity[row] = (row / 128) % 3 == 0 || ((row / 128) % 3 == 2 && row % 5 != 0);
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> col(
+    values.begin(), values.end(), validity.begin());
+  auto const int32_type = cudf::data_type{cudf::type_id::INT32};
+  auto const int64_type = cudf::data_type{cudf::type_id::INT64};
+
+  // slices starting within and on mask words, and ending within and on them
+  auto const slices = cudf::slice(col, {0, 1000, 5, 1000, 37, 700, 64, 96, 100, 101, 131, 253});
+  for (auto const &slice : slices) {
+    std::vector<int32_t> valid_values;
+    for (int row = slice.offset(); row < slice.offset() + slice.size(); ++row) {
+      if (validity[row]) { valid_values.push_back(values[row]); }
+    }
+
+    auto const sum_result = cudf::reduce(slice, cudf::make_sum_aggregation(), int64_type);
+    auto const min_result = cudf::reduce(slice, cudf::make_min_aggregation(), int32_type);
+    auto const max_result = cudf::reduce(slice, cudf::make_max_aggregation(), int32_type);
+    if (valid_values.empty()) {
+      EXPECT_FALSE(sum_result->is_valid());
+      EXPECT_FALSE(min_result->is_valid());
+      continue;
+    }
+    EXPECT_EQ(scalar_value<int64_t>(sum_result),
+              std::accumulate(valid_values.begin(), valid_values.end(), int64_t{0}));
+    EXPECT_EQ(scalar_value<int32_t>(min_result),
+              *std::min_element(valid_values.begin(), valid_values.end()));
+    EXPECT_EQ(scalar_value<int32_t>(max_result),
+              *std::max_element(valid_values.begin(), valid_values.end()));
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -469,3 +469,107 @@ TYPED_TEST(ScanTest, EmptyColumnskip_nulls)
   CUDF_TEST_EXPECT_COLUMN_PROPERTIES_EQUAL(expected_col_out2, col_out->view());
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_col_out2, col_out->view());
 }
+
+template <typename T>
+struct ScanDurationTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(ScanDurationTest, cudf::test::DurationTypes);
+
+TYPED_TEST(ScanDurationTest, Sum)
+{
+  using wrapper = cudf::test::fixed_width_column_wrapper<TypeParam, int32_t>;
+  wrapper const col_in({1, 2, 3, 4, 5}, {1, 1, 0, 1, 1});
+
+  auto const inclusive = cudf::scan(col_in, cudf::make_sum_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(wrapper({1, 3, 0, 7, 12}, {1, 1, 0, 1, 1}), *inclusive);
+
+  auto const exclusive = cudf::scan(col_in, cudf::make_sum_aggregation(), scan_type::EXCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(wrapper({0, 1, 0, 3, 7}, {1, 1, 0, 1, 1}), *exclusive);
+
+  auto const include_nulls = cudf::scan(
+    col_in, cudf::make_sum_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(wrapper({1, 3, 0, 0, 0}, {1, 1, 0, 0, 0}), *include_nulls);
+
+  EXPECT_THROW(cudf::scan(col_in, cudf::make_product_aggregation(), scan_type::INCLUSIVE),
+               cudf::logic_error);
+}
+
+struct ScanFixedWidthTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScanFixedWidthTest, TimestampMinMax)
+{
+  using wrapper = cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, int32_t>;
+  wrapper const col_in({30, 10, 20, 5, 40}, {1, 1, 1, 0, 1});
+
+  auto const min = cudf::scan(col_in, cudf::make_min_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(wrapper({30, 10, 10, 0, 10}, {1, 1, 1, 0, 1}), *min);
+
+  auto const max = cudf::scan(col_in, cudf::make_max_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(wrapper({30, 30, 30, 0, 40}, {1, 1, 1, 0, 1}), *max);
+
+  EXPECT_THROW(cudf::scan(col_in, cudf::make_sum_aggregation(), scan_type::INCLUSIVE),
+               cudf::logic_error);
+}
+
+TEST_F(ScanFixedWidthTest, FixedPointSum)
+{
+  using numeric::decimal32;
+  using numeric::scale_type;
+  auto const scale = scale_type{-2};
+  std::vector<decimal32> const v{decimal32{1.25, scale},
+                                 decimal32{-0.5, scale},
+                                 decimal32{3.0, scale},
+                                 decimal32{2.75, scale}};
+  std::vector<decimal32> const exact{decimal32{1.25, scale},
+                                     decimal32{0.75, scale},
+                                     decimal32{0.75, scale},
+                                     decimal32{3.5, scale}};
+  auto const b = std::vector<bool>{1, 1, 0, 1};
+  cudf::test::fixed_width_column_wrapper<decimal32> const col_in(v.begin(), v.end(), b.begin());
+
+  auto const result = cudf::scan(col_in, cudf::make_sum_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<decimal32>(exact.begin(), exact.end(), b.begin()),
+    *result);
+
+  EXPECT_THROW(cudf::scan(col_in, cudf::make_sum_aggregation(), scan_type::EXCLUSIVE),
+               cudf::logic_error);
+}
+
+struct SegmentedScanTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedScanTest, Sum)
+{
+  using wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+  wrapper const col_in({1, 2, 3, 4, 5, 6, 7}, {1, 1, 1, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> const offsets{0, 3, 3, 7};
+
+  auto const inclusive = cudf::segmented_scan(
+    col_in, offsets, cudf::make_sum_aggregation(), scan_type::INCLUSIVE, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(wrapper({1, 3, 6, 4, 0, 10, 17}, {1, 1, 1, 1, 0, 1, 1}),
+                                 *inclusive);
+
+  auto const exclusive = cudf::segmented_scan(
+    col_in, offsets, cudf::make_sum_aggregation(), scan_type::EXCLUSIVE, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(wrapper({0, 1, 3, 0, 0, 4, 10}, {1, 1, 1, 1, 0, 1, 1}),
+                                 *exclusive);
+
+  auto const include_nulls = cudf::segmented_scan(
+    col_in, offsets, cudf::make_sum_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(wrapper({1, 3, 6, 4, 0, 0, 0}, {1, 1, 1, 1, 0, 0, 0}),
+                                 *include_nulls);
+}
+
+TEST_F(SegmentedScanTest, MaxDuration)
+{
+  using wrapper = cudf::test::fixed_width_column_wrapper<cudf::duration_ms, int32_t>;
+  wrapper const col_in{5, 1, 7, 2, 9, 3};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> const offsets{0, 2, 6};
+
+  auto const result =
+    cudf::segmented_scan(col_in, offsets, cudf::make_max_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(wrapper{5, 5, 7, 7, 9, 9}, *result);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/reduction.hpp>
+
+using cudf::null_policy;
+using cudf::size_type;
+using cudf::test::fixed_width_column_wrapper;
+
+template <typename T>
+struct SegmentedReductionTest : public cudf::test::BaseFixture {
+};
+
+using NumericTypesNotBool =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+
+TYPED_TEST_CASE(SegmentedReductionTest, NumericTypesNotBool);
+
+TYPED_TEST(SegmentedReductionTest, SumMinMax)
+{
+  // segments: {1, 2, 3}, {}, {4, 5}, {6}
+  fixed_width_column_wrapper<TypeParam> values{1, 2, 3, 4, 5, 6};
+  fixed_width_column_wrapper<size_type> offsets{0, 3, 3, 5, 6};
+  auto const dtype = cudf::data_type{cudf::type_to_id<TypeParam>()};
+
+  auto sum = cudf::segmented_reduce(values, offsets, cudf::make_sum_aggregation(), dtype);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<TypeParam>({6, 0, 9, 6}, {1, 0, 1, 1}),
+                                 *sum);
+
+  auto min = cudf::segmented_reduce(values, offsets, cudf::make_min_aggregation(), dtype);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<TypeParam>({1, 0, 4, 6}, {1, 0, 1, 1}),
+                                 *min);
+
+  auto max = cudf::segmented_reduce(values, offsets, cudf::make_max_aggregation(), dtype);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<TypeParam>({3, 0, 5, 6}, {1, 0, 1, 1}),
+                                 *max);
+}
+
+TYPED_TEST(SegmentedReductionTest, NullHandling)
+{
+  // segments: {1, null, 3}, {null, null}, {4}
+  fixed_width_column_wrapper<TypeParam> values({1, 0, 3, 0, 0, 4}, {1, 0, 1, 0, 0, 1});
+  fixed_width_column_wrapper<size_type> offsets{0, 3, 5, 6};
+  auto const dtype = cudf::data_type{cudf::type_to_id<TypeParam>()};
+
+  auto exclude = cudf::segmented_reduce(
+    values, offsets, cudf::make_sum_aggregation(), dtype, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<TypeParam>({4, 0, 4}, {1, 0, 1}),
+                                 *exclude);
+
+  auto include = cudf::segmented_reduce(
+    values, offsets, cudf::make_sum_aggregation(), dtype, null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<TypeParam>({0, 0, 4}, {0, 0, 1}),
+                                 *include);
+}
+
+struct SegmentedReductionInt32Test : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedReductionInt32Test, AnyAll)
+{
+  fixed_width_column_wrapper<int32_t> values{0, 1, 0, 0, 2, 3};
+  fixed_width_column_wrapper<size_type> offsets{0, 2, 4, 6};
+  auto const dtype = cudf::data_type{cudf::type_id::BOOL8};
+
+  auto any = cudf::segmented_reduce(values, offsets, cudf::make_any_aggregation(), dtype);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<bool>{true, false, true}, *any);
+
+  auto all = cudf::segmented_reduce(values, offsets, cudf::make_all_aggregation(), dtype);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<bool>{false, false, true}, *all);
+}
+
+TEST_F(SegmentedReductionInt32Test, InvalidInputs)
+{
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3};
+  auto const dtype = cudf::data_type{cudf::type_id::INT32};
+
+  fixed_width_column_wrapper<int64_t> wrong_type_offsets{0, 3};
+  EXPECT_THROW(
+    cudf::segmented_reduce(values, wrong_type_offsets, cudf::make_sum_aggregation(), dtype),
+    cudf::logic_error);
+
+  fixed_width_column_wrapper<size_type> offsets{0, 3};
+  EXPECT_THROW(cudf::segmented_reduce(values, offsets, cudf::make_mean_aggregation(), dtype),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::segmented_reduce(values, offsets, cudf::make_any_aggregation(), dtype),
+               cudf::logic_error);
+}
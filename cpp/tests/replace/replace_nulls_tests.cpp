@@ -243,6 +243,27 @@ TYPED_TEST(ReplaceNullsTest, ReplaceScalar)
                                   expectedColumn.begin(), expectedColumn.end()));
 }
 
+TYPED_TEST(ReplaceNullsTest, ReplaceScalarInPlace)
+{
+  std::vector<TypeParam> inputColumn =
+    cudf::test::make_type_param_vector<TypeParam>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  std::vector<cudf::valid_type> inputValid{0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+  std::vector<TypeParam> expectedColumn =
+    cudf::test::make_type_param_vector<TypeParam>({1, 1, 1, 1, 1, 5, 6, 7, 8, 9});
+  cudf::numeric_scalar<TypeParam> replacement(1);
+
+  cudf::test::fixed_width_column_wrapper<TypeParam> input(
+    inputColumn.begin(), inputColumn.end(), inputValid.begin());
+  auto column                       = input.release();
+  cudf::mutable_column_view mutable = column->mutable_view();
+  cudf::replace_nulls_in_place(mutable, replacement);
+
+  EXPECT_EQ(0, column->null_count());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<TypeParam>(expectedColumn.begin(), expectedColumn.end()),
+    column->view());
+}
+
 TYPED_TEST(ReplaceNullsTest, ReplacementHasNulls)
 {
   using T = TypeParam;
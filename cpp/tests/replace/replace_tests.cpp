@@ -31,6 +31,7 @@
 #include <gtest/gtest.h>
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <vector>
 
 struct ReplaceErrorTest : public cudf::test::BaseFixture {
@@ -283,6 +284,42 @@ TEST_F(ReplaceStringsTest, StringsLargeScale)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_wrapper);
 }
 
+TEST_F(ReplaceStringsTest, StringsManyValuesToReplace)
+{
+  // more values to replace than are searched linearly, with a repeated value whose first
+  // replacement is used
+  std::vector<std::string> values_to_replace;
+  std::vector<std::string> replacement;
+  for (int i = 0; i < 100; i++) {
+    values_to_replace.push_back("v" + std::to_string(i));
+    replacement.push_back("r" + std::to_string(i));
+  }
+  values_to_replace.push_back("v7");
+  replacement.push_back("unused");
+  std::vector<cudf::valid_type> replacement_valid(replacement.size(), 1);
+  replacement_valid[42] = 0;
+
+  std::vector<std::string> input{"v7", "x", "v99", "", "v42", "v0", "v100", "v5"};
+  std::vector<cudf::valid_type> input_valid{1, 1, 1, 1, 1, 1, 1, 0};
+  std::vector<std::string> expected{"r7", "x", "r99", "", "", "r0", "v100", ""};
+  std::vector<cudf::valid_type> ex_valid{1, 1, 1, 1, 0, 1, 1, 0};
+
+  cudf::test::strings_column_wrapper input_wrapper{
+    input.begin(), input.end(), input_valid.begin()};
+  cudf::test::strings_column_wrapper values_to_replace_wrapper{values_to_replace.begin(),
+                                                               values_to_replace.end()};
+  cudf::test::strings_column_wrapper replacement_wrapper{
+    replacement.begin(), replacement.end(), replacement_valid.begin()};
+  cudf::test::strings_column_wrapper expected_wrapper{
+    expected.begin(), expected.end(), ex_valid.begin()};
+
+  std::unique_ptr<cudf::column> result;
+  ASSERT_NO_THROW(result = cudf::find_and_replace_all(
+                    input_wrapper, values_to_replace_wrapper, replacement_wrapper, mr()));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_wrapper);
+}
+
 //// This is the main test feature
 template <class T>
 struct ReplaceTest : cudf::test::BaseFixture {
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+
+using namespace cudf::test;
+
+struct ExplodeTest : public BaseFixture {
+};
+
+TEST_F(ExplodeTest, Basic)
+{
+  using LCW = lists_column_wrapper<int32_t>;
+  LCW lists{LCW{1, 2}, LCW{}, LCW{5, 6, 7}, LCW{4}};
+  fixed_width_column_wrapper<int32_t> values{7, 8, 9, 10};
+  strings_column_wrapper names{"a", "b", "c", "d"};
+
+  fixed_width_column_wrapper<int32_t> expected_values{7, 7, 9, 9, 9, 10};
+  fixed_width_column_wrapper<int32_t> expected_elements{1, 2, 5, 6, 7, 4};
+  strings_column_wrapper expected_names{"a", "a", "c", "c", "c", "d"};
+  fixed_width_column_wrapper<int32_t> expected_positions{0, 1, 0, 1, 2, 0};
+
+  cudf::table_view input{{values, lists, names}};
+  auto result = cudf::explode(input, 1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    cudf::table_view({expected_values, expected_elements, expected_names}), result->view());
+
+  auto with_positions = cudf::explode_position(input, 1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    cudf::table_view({expected_values, expected_positions, expected_elements, expected_names}),
+    with_positions->view());
+}
+
+TEST_F(ExplodeTest, SlicedNullListsAndStrings)
+{
+  using LCW    = lists_column_wrapper<cudf::string_view>;
+  auto validity = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0), [](auto i) { return i != 2; });
+  LCW lists({LCW{"x"}, LCW{"a", "b"}, LCW{"null", "list"}, LCW{"c"}, LCW{"y", "z"}}, validity);
+  fixed_width_column_wrapper<int64_t> values({10, 11, 12, 13, 14}, {1, 0, 1, 1, 1});
+  auto const sliced = cudf::slice(cudf::table_view{{lists, values}}, {1, 4}).front();
+
+  strings_column_wrapper expected_elements{"a", "b", "c"};
+  fixed_width_column_wrapper<int64_t> expected_values({11, 11, 13}, {0, 0, 1});
+  fixed_width_column_wrapper<int32_t> expected_positions{0, 1, 0};
+
+  auto result = cudf::explode_position(sliced, 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    cudf::table_view({expected_positions, expected_elements, expected_values}), result->view());
+}
+
+TEST_F(ExplodeTest, InvalidColumn)
+{
+  fixed_width_column_wrapper<int32_t> values{7, 8, 9, 10};
+  cudf::table_view input{{values}};
+  EXPECT_THROW(cudf::explode(input, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::explode(input, 1), cudf::logic_error);
+}
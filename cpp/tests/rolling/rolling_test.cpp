@@ -23,6 +23,7 @@
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/rolling.hpp>
+#include <cudf/udf.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <src/rolling/rolling_detail.hpp>
 
@@ -689,6 +690,27 @@ TYPED_TEST(RollingTest, RandomStaticWithInvalid)
   this->run_test_col_agg(input, window, window, periods);
 }
 
+// random input data, static window large enough for the sliding window algorithms, with nulls
+TYPED_TEST(RollingTest, RandomStaticLargeWindowWithInvalid)
+{
+  size_type num_rows = 10000;
+
+  // random input
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  std::vector<size_type> preceding_window({300});
+  std::vector<size_type> following_window({100});
+  size_type periods = 150;
+
+  this->run_test_col_agg(input, preceding_window, following_window, periods);
+}
+
 // random input data, dynamic parameters, no nulls
 TYPED_TEST(RollingTest, RandomDynamicAllValid)
 {
@@ -742,6 +764,43 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+using RollingTestMultipleAggregations = RollingTest<int16_t>;
+
+TEST_F(RollingTestMultipleAggregations, SameAsEachAggregation)
+{
+  auto const iter   = thrust::make_counting_iterator(0);
+  auto const valids = thrust::make_transform_iterator(iter, [](auto i) { return i % 7 != 0; });
+  fixed_width_column_wrapper<int16_t> shorts(iter, iter + 1000, valids);
+  fixed_width_column_wrapper<double> doubles(iter, iter + 1000, valids);
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_count_aggregation());
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+  aggs.push_back(cudf::make_row_number_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+
+  // small windows are aggregated together, large ones by the sliding window algorithms
+  for (cudf::column_view const input : {cudf::column_view{shorts}, cudf::column_view{doubles}}) {
+    for (size_type const window : {3, 200}) {
+      auto const results = cudf::rolling_window(input, window, 2, 4, aggs);
+      ASSERT_EQ(aggs.size(), results.size());
+      for (size_t i = 0; i < aggs.size(); ++i) {
+        cudf::test::expect_columns_equal(*results[i],
+                                         *cudf::rolling_window(input, window, 2, 4, aggs[i]));
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<cudf::aggregation>> udf_aggs;
+  udf_aggs.push_back(
+    cudf::make_udf_aggregation(cudf::udf_type::CUDA, std::string{}, cudf::data_type{}));
+  EXPECT_THROW(cudf::rolling_window(shorts, 2, 2, 0, udf_aggs), cudf::logic_error);
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
@@ -952,4 +1011,35 @@ TEST_F(RollingTestUdf, DynamicWindow)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*output, expected);
 }
 
+TEST_F(RollingTestUdf, CompiledUdfReusedAcrossCalls)
+{
+  size_type size = 1000;
+
+  fixed_width_column_wrapper<int32_t> input(thrust::make_counting_iterator(0),
+                                            thrust::make_counting_iterator(size),
+                                            thrust::make_constant_iterator(true));
+
+  auto start = cudf::test::make_counting_transform_iterator(0, [size] __device__(size_type row) {
+    return std::accumulate(thrust::make_counting_iterator(std::max(0, row - 2 + 1)),
+                           thrust::make_counting_iterator(std::min(size, row + 2 + 1)),
+                           0);
+  });
+
+  auto valid = cudf::test::make_counting_transform_iterator(0, [size] __device__(size_type row) {
+    return (row != 0 && row != size - 2 && row != size - 1);
+  });
+
+  fixed_width_column_wrapper<int64_t> expected{start, start + size, valid};
+
+  for (auto type : {cudf::udf_type::CUDA, cudf::udf_type::PTX}) {
+    auto const& source = type == cudf::udf_type::CUDA ? this->cuda_func : this->ptx_func;
+    auto udf           = cudf::compile_udf(source, type, cudf::data_type{cudf::type_id::INT64});
+
+    for (int i = 0; i < 2; ++i) {
+      auto output = cudf::rolling_window(input, 2, 2, 4, cudf::make_udf_aggregation(udf));
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*output, expected);
+    }
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/row_conversion.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+using namespace cudf::test;
+
+struct RowConversionTest : public BaseFixture {
+};
+
+std::vector<cudf::data_type> schema_of(cudf::table_view const& input)
+{
+  std::vector<cudf::data_type> schema;
+  for (auto const& col : input) { schema.push_back(col.type()); }
+  return schema;
+}
+
+TEST_F(RowConversionTest, FixedWidthLayout)
+{
+  fixed_width_column_wrapper<int32_t> col1({1, 2});
+  fixed_width_column_wrapper<int16_t> col2({3, 4}, {1, 0});
+  cudf::table_view input({col1, col2});
+
+  auto rows = cudf::convert_to_rows(input);
+
+  // INT32 at 0, INT16 at 4, validity at 6, padded to 8 bytes
+  fixed_width_column_wrapper<cudf::size_type> expected_offsets({0, 8, 16});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::lists_column_view(*rows).offsets(), expected_offsets);
+  auto const h_rows = to_host<int8_t>(cudf::lists_column_view(*rows).child()).first;
+  EXPECT_EQ(1, h_rows[0]);
+  EXPECT_EQ(3, h_rows[4]);
+  EXPECT_EQ(0b11, h_rows[6]);
+  EXPECT_EQ(2, h_rows[8]);
+  EXPECT_EQ(0b01, h_rows[14]);
+}
+
+TEST_F(RowConversionTest, RoundTripFixedWidth)
+{
+  auto const iter     = thrust::make_counting_iterator(0);
+  auto valids         = thrust::make_transform_iterator(iter, [](auto i) { return i % 3 != 0; });
+  auto const num_rows = 10000;
+  fixed_width_column_wrapper<int8_t> col1(iter, iter + num_rows);
+  fixed_width_column_wrapper<int64_t> col2(iter, iter + num_rows, valids);
+  fixed_width_column_wrapper<double> col3(iter, iter + num_rows);
+  fixed_width_column_wrapper<int16_t> col4(iter, iter + num_rows, valids);
+  fixed_width_column_wrapper<float> col5(iter, iter + num_rows, valids);
+  cudf::table_view input({col1, col2, col3, col4, col5});
+
+  auto rows   = cudf::convert_to_rows(input);
+  auto result = cudf::convert_from_rows(cudf::lists_column_view(*rows), schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, result->view());
+}
+
+TEST_F(RowConversionTest, RoundTripStrings)
+{
+  fixed_width_column_wrapper<int32_t> col1({1, 2, 3, 4});
+  strings_column_wrapper col2({"a", "", "longer string", "bc"}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<int16_t> col3({5, 6, 7, 8}, {0, 1, 1, 1});
+  strings_column_wrapper col4({"", "xyz", "é", "last"});
+  cudf::table_view input({col1, col2, col3, col4});
+
+  auto rows          = cudf::convert_to_rows(input);
+  auto const offsets = to_host<cudf::size_type>(cudf::lists_column_view(*rows).offsets()).first;
+  for (size_t i = 1; i < offsets.size(); ++i) { EXPECT_EQ(0, offsets[i] % 8); }
+
+  auto result = cudf::convert_from_rows(cudf::lists_column_view(*rows), schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, result->view());
+}
+
+TEST_F(RowConversionTest, Empty)
+{
+  fixed_width_column_wrapper<int32_t> col1({});
+  strings_column_wrapper col2({});
+  cudf::table_view input({col1, col2});
+
+  auto rows = cudf::convert_to_rows(input);
+  EXPECT_EQ(0, rows->size());
+  auto result = cudf::convert_from_rows(cudf::lists_column_view(*rows), schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, result->view());
+}
+
+TEST_F(RowConversionTest, UnsupportedType)
+{
+  lists_column_wrapper<int32_t> col1({{1, 2}, {3}});
+  cudf::table_view input({col1});
+  EXPECT_THROW(cudf::convert_to_rows(input), cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t> col2({1, 2});
+  auto rows = cudf::convert_to_rows(cudf::table_view({col2}));
+  EXPECT_THROW(cudf::convert_from_rows(cudf::lists_column_view(*rows),
+                                       {cudf::data_type{cudf::type_id::LIST}}),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
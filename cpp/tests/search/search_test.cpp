@@ -1816,6 +1816,60 @@ TEST_F(SearchTest, multi_contains_empty_input_set_string)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, large_table_lower_upper_bound)
+{
+  // a haystack large enough to be searched through sampled rows, with runs of 3 equal values
+  size_type const num_rows = 200000;
+  auto iter = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i / 3; });
+  fixed_width_column_wrapper<int32_t> column(iter, iter + num_rows);
+  fixed_width_column_wrapper<int32_t> values{-5, 0, 1, 777, 33333, 66666, 66667, 70000};
+
+  fixed_width_column_wrapper<size_type> expect_lower{0, 0, 3, 2331, 99999, 199998, 200000, 200000};
+  fixed_width_column_wrapper<size_type> expect_upper{0, 3, 6, 2334, 100002, 200000, 200000, 200000};
+
+  auto lower = cudf::lower_bound(
+    cudf::table_view{{column}}, cudf::table_view{{values}}, {cudf::order::ASCENDING}, {});
+  auto upper = cudf::upper_bound(
+    cudf::table_view{{column}}, cudf::table_view{{values}}, {cudf::order::ASCENDING}, {});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*lower, expect_lower);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*upper, expect_upper);
+}
+
+TEST_F(SearchTest, large_table_multi_column_with_nulls)
+{
+  // 1000 null rows first, then runs of 4 rows whose second column descends from 3 to 0
+  size_type const num_rows = 100000;
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i >= 1000; });
+  auto iter_a =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return (i - 1000) / 4; });
+  auto iter_b = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i < 1000 ? 999 - i : 3 - (i - 1000) % 4; });
+  fixed_width_column_wrapper<int32_t> column_a(iter_a, iter_a + num_rows, valids);
+  fixed_width_column_wrapper<int32_t> column_b(iter_b, iter_b + num_rows);
+
+  fixed_width_column_wrapper<int32_t> values_a{{0, 10, 0, 24749}, {0, 1, 0, 1}};
+  fixed_width_column_wrapper<int32_t> values_b{500, 2, -1, 0};
+
+  fixed_width_column_wrapper<size_type> expect_lower{499, 1041, 1000, 99999};
+  fixed_width_column_wrapper<size_type> expect_upper{500, 1042, 1000, 100000};
+
+  std::vector<cudf::order> column_order{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  std::vector<cudf::null_order> null_precedence{cudf::null_order::BEFORE,
+                                                cudf::null_order::BEFORE};
+  auto lower = cudf::lower_bound(cudf::table_view{{column_a, column_b}},
+                                 cudf::table_view{{values_a, values_b}},
+                                 column_order,
+                                 null_precedence);
+  auto upper = cudf::upper_bound(cudf::table_view{{column_a, column_b}},
+                                 cudf::table_view{{values_a, values_b}},
+                                 column_order,
+                                 null_precedence);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*lower, expect_lower);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*upper, expect_upper);
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
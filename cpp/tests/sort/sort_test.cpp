@@ -21,13 +21,21 @@
 #include <tests/utilities/type_lists.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/memory_estimate.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <string>
 #include <vector>
 
 namespace cudf {
@@ -214,6 +222,26 @@ TYPED_TEST(Sort, Stable)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
 }
 
+TYPED_TEST(Sort, FixedWidthKeys)
+{
+  using T = TypeParam;
+  using R = int32_t;
+
+  fixed_width_column_wrapper<T> col1({1, 0, 1, 0, 0, 1}, {1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<R> col2({5, 7, 0, 2, 7, 5}, {1, 1, 0, 1, 1, 1});
+  table_view input{{col1, col2}};
+
+  fixed_width_column_wrapper<R> expected{{3, 0, 5, 2, 1, 4}};
+  std::vector<order> column_order{order::DESCENDING, order::ASCENDING};
+  std::vector<null_order> null_precedence{null_order::AFTER, null_order::AFTER};
+
+  auto got = stable_sorted_order(input, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  // Run test for sort and sort_by_key
+  run_sort_test(input, expected, column_order, null_precedence);
+}
+
 TYPED_TEST(Sort, MisMatchInColumnOrderSize)
 {
   using T = TypeParam;
@@ -285,6 +313,258 @@ TEST_F(SortByKey, ValueKeysSizeMismatch)
   EXPECT_THROW(sort_by_key(values, keys), logic_error);
 }
 
+struct SortFloats : public BaseFixture {
+};
+
+TEST_F(SortFloats, NaNAndSignedZeros)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  auto const inf = std::numeric_limits<double>::infinity();
+
+  fixed_width_column_wrapper<double> col1{{nan, -0.0, 1.5, -inf, 0.0, -2.0, -nan}};
+  fixed_width_column_wrapper<int32_t> col2{{1, 1, 0, 0, 2, 0, 3}};
+  table_view input{{col1, col2}};
+
+  // -0.0 equals 0.0 and NaN is greater than every other value
+  fixed_width_column_wrapper<int32_t> expected{{3, 5, 4, 1, 2, 6, 0}};
+  std::vector<order> column_order{order::ASCENDING, order::DESCENDING};
+
+  auto got = stable_sorted_order(input, column_order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+struct SegmentedSort : public BaseFixture {
+};
+
+TEST_F(SegmentedSort, FixedWidthKeys)
+{
+  fixed_width_column_wrapper<int32_t> col1({3, 1, 2, 9, 0, 8, 4, 4, 5},
+                                           {1, 1, 1, 1, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> col2{{0, 0, 0, 0, 0, 0, 1, 2, 0}};
+  fixed_width_column_wrapper<int32_t> offsets{{0, 3, 6, 6, 9}};
+  table_view keys{{col1, col2}};
+
+  // the empty segment is skipped and the ties of the last segment are broken by col2
+  fixed_width_column_wrapper<int32_t> expected{{0, 2, 1, 3, 5, 4, 8, 7, 6}};
+  std::vector<order> column_order{order::DESCENDING, order::DESCENDING};
+  std::vector<null_order> null_precedence{null_order::BEFORE, null_order::BEFORE};
+
+  auto got = segmented_sorted_order(keys, offsets, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  auto got_table = segmented_sort_by_key(keys, keys, offsets, column_order, null_precedence);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(gather(keys, expected)->view(), got_table->view());
+}
+
+TEST_F(SegmentedSort, ListElements)
+{
+  lists_column_wrapper<cudf::string_view> lists{{"c", "a", "b"}, {}, {"z"}, {"y", "x"}};
+  lists_column_view lcv(lists);
+  auto offsets = lcv.offsets();
+  table_view keys{{lcv.child()}};
+
+  fixed_width_column_wrapper<int32_t> expected{{1, 2, 0, 3, 5, 4}};
+  auto got = segmented_sorted_order(keys, offsets);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(SegmentedSort, InvalidOffsets)
+{
+  fixed_width_column_wrapper<int32_t> col1{{3, 1, 2}};
+  fixed_width_column_wrapper<int64_t> offsets{{0, 3}};
+
+  EXPECT_THROW(segmented_sorted_order(table_view{{col1}}, offsets), logic_error);
+}
+
+struct TopK : public BaseFixture {
+};
+
+TEST_F(TopK, FixedWidthLeadingColumn)
+{
+  fixed_width_column_wrapper<int32_t> col1({5, 3, 0, 9, 3, 7, 0, 3, 1},
+                                           {1, 1, 0, 1, 1, 1, 0, 1, 1});
+  strings_column_wrapper col2({"a", "c", "b", "a", "b", "a", "a", "a", "a"});
+  table_view input{{col1, col2}};
+  std::vector<order> column_order{order::ASCENDING, order::DESCENDING};
+
+  // ties on 3 straddle k, and are broken by the second column
+  fixed_width_column_wrapper<int32_t> expected{{2, 6, 8, 1, 4}};
+  auto got = top_k_order(input, 5, column_order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+  auto got_rows = top_k(input, 5, column_order);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(gather(input, expected)->view(), got_rows->view());
+
+  // the first k indices of the stable sorted order for every order and null order
+  for (auto col_order : {order::ASCENDING, order::DESCENDING}) {
+    for (auto null_prec : {null_order::BEFORE, null_order::AFTER}) {
+      std::vector<order> orders{col_order, order::ASCENDING};
+      std::vector<null_order> nulls{null_prec, null_order::BEFORE};
+      auto sorted = stable_sorted_order(input, orders, nulls);
+      for (size_type k : {0, 1, 2, 4, 7, 9, 20}) {
+        auto top          = top_k_order(input, k, orders, nulls);
+        auto expected_top = slice(sorted->view(), {0, std::min(k, input.num_rows())}).front();
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_top, top->view());
+      }
+    }
+  }
+}
+
+TEST_F(TopK, StringsLeadingColumn)
+{
+  strings_column_wrapper col1({"d", "e", "a", "d", "k"});
+  fixed_width_column_wrapper<int32_t> col2{{10, 40, 70, 5, 2}};
+  table_view input{{col1, col2}};
+
+  fixed_width_column_wrapper<int32_t> expected{{4, 1}};
+  auto got = top_k_order(input, 2, {order::DESCENDING, order::ASCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(TopK, NegativeK)
+{
+  fixed_width_column_wrapper<int32_t> col1{{5, 4, 3}};
+  table_view input{{col1}};
+
+  EXPECT_THROW(top_k_order(input, -1), logic_error);
+  EXPECT_THROW(top_k(input, -1), logic_error);
+}
+
+struct ExternalSort : public BaseFixture {
+};
+
+TEST_F(ExternalSort, MergesSpilledRuns)
+{
+  fixed_width_column_wrapper<int32_t> keys1({9, 3, 0, 12, 6, 1}, {1, 1, 0, 1, 1, 1});
+  strings_column_wrapper values1({"9", "3", "n", "12", "6", "1"});
+  fixed_width_column_wrapper<int32_t> keys2{{4, 11, 2, 8, 13, 5, 7}};
+  strings_column_wrapper values2({"4", "11", "2", "8", "13", "5", "7"});
+  fixed_width_column_wrapper<int32_t> keys3{{10}};
+  strings_column_wrapper values3({"10"});
+
+  // descending with nulls last, in chunks smaller than the runs
+  external_sorter sorter({0}, {order::DESCENDING}, {null_order::BEFORE}, 3);
+  sorter.push(table_view{{keys1, values1}});
+  sorter.push(table_view{{keys2, values2}});
+  sorter.push(table_view{{keys3, values3}});
+  EXPECT_THROW(sorter.push(table_view{{keys3}}), logic_error);
+
+  std::vector<std::unique_ptr<table>> chunks;
+  while (sorter.has_next_chunk()) { chunks.push_back(sorter.next_chunk()); }
+  EXPECT_THROW(sorter.next_chunk(), logic_error);
+
+  std::vector<table_view> views;
+  for (auto const& chunk : chunks) {
+    EXPECT_LE(chunk->num_rows(), 3);
+    views.push_back(chunk->view());
+  }
+  EXPECT_EQ(chunks.size(), 5u);
+
+  fixed_width_column_wrapper<int32_t> expected_keys(
+    {13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0});
+  strings_column_wrapper expected_values(
+    {"13", "12", "11", "10", "9", "8", "7", "6", "5", "4", "3", "2", "1", "n"});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected_keys, expected_values}),
+                                concatenate(views)->view());
+}
+
+TEST_F(ExternalSort, EstimateSortMemoryOfSlice)
+{
+  fixed_width_column_wrapper<int32_t> keys({5, 3, 0, 4, 1, 2}, {1, 1, 0, 1, 1, 1});
+  strings_column_wrapper values({"five", "three", "", "four", "one", "two"});
+  auto const input = slice(table_view{{keys, values}}, {1, 5}).front();
+
+  auto const estimate = estimate_sort_memory(input);
+  // A sort is a permutation of its input, so the output has exactly the size of a copy
+  EXPECT_EQ(estimate.output_bytes, cudf::detail::copy_size(sort(input)->view()));
+  EXPECT_GT(estimate.temporary_bytes, 0u);
+  EXPECT_THROW(estimate_sort_by_key_memory(input, table_view{{keys}}), logic_error);
+}
+
+struct MultiDeviceSort : public BaseFixture {
+  /// The current device listed three times, so that the parts are exchanged between "devices"
+  std::vector<device_resources> devices()
+  {
+    int device{0};
+    CUDA_TRY(cudaGetDevice(&device));
+    return std::vector<device_resources>(3, device_resources{device});
+  }
+};
+
+TEST_F(MultiDeviceSort, PartsInOrder)
+{
+  constexpr size_type num_rows = 1000;
+  auto key_iter   = make_counting_transform_iterator(0, [](auto i) { return (i * 7) % num_rows; });
+  auto value_iter = make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); });
+  fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + num_rows);
+  strings_column_wrapper values(value_iter, value_iter + num_rows);
+  table_view input{{values, keys}};
+
+  auto const expected = sort_by_key(input, input.select({1}), {order::DESCENDING});
+  auto const result   = multi_device_sort(input, {1}, devices(), {order::DESCENDING});
+  ASSERT_EQ(result.num_parts(), 3);
+  EXPECT_EQ(result.num_rows(), num_rows);
+  for (size_type i = 0; i < result.num_parts(); ++i) { EXPECT_GT(result.part(i).num_rows(), 0); }
+
+  auto const combined = result.combine(result.device(0));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), combined->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), concatenate(result.views())->view());
+}
+
+TEST_F(MultiDeviceSort, EmptyAndInvalid)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  table_view input{{keys}};
+  auto const result = multi_device_sort(input, {0}, devices());
+  EXPECT_EQ(result.num_parts(), 3);
+  EXPECT_EQ(result.num_rows(), 0);
+
+  EXPECT_THROW(multi_device_sort(input, {0}, {}), logic_error);
+  EXPECT_THROW(multi_device_sort(input, {1}, devices()), logic_error);
+  EXPECT_THROW(multi_device_sort(input, {0}, devices(), {order::ASCENDING, order::ASCENDING}),
+               logic_error);
+}
+
+struct SortDictionary : public BaseFixture {
+};
+
+TEST_F(SortDictionary, SortedOrderMatchesKeys)
+{
+  strings_column_wrapper strings({"eee", "a", "", "dd", "a", "ccc", "b"}, {1, 1, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> values{{3, 2, 5, 1, 0, 4, 6}};
+  auto const dictionary = cudf::dictionary::encode(strings);
+
+  std::vector<order> const column_order{order::DESCENDING, order::ASCENDING};
+  std::vector<null_order> const null_precedence{null_order::AFTER, null_order::BEFORE};
+  auto const expected =
+    stable_sorted_order(table_view{{strings, values}}, column_order, null_precedence);
+  auto const result =
+    stable_sorted_order(table_view{{dictionary->view(), values}}, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->view());
+}
+
+struct SortStructs : public BaseFixture {
+};
+
+TEST_F(SortStructs, SortedOrderMatchesFields)
+{
+  fixed_width_column_wrapper<int32_t> ints{{2, 1, 2, 0, 1, 3, 1}, {1, 1, 1, 1, 0, 1, 1}};
+  strings_column_wrapper strings{"b", "c", "a", "z", "c", "a", "a"};
+  structs_column_wrapper structs{{ints, strings}, {1, 1, 1, 0, 1, 1, 1}};
+  fixed_width_column_wrapper<int32_t> values{{3, 2, 5, 1, 0, 4, 6}};
+
+  // the struct rows are ordered field by field, and the fields carry the nulls of the rows
+  structs_column_view const fields(structs);
+  std::vector<order> const column_order{order::DESCENDING, order::ASCENDING};
+  std::vector<null_order> const null_precedence{null_order::AFTER, null_order::BEFORE};
+  auto const expected = stable_sorted_order(
+    table_view{{fields.child(0), fields.child(1), values}},
+    {order::DESCENDING, order::DESCENDING, order::ASCENDING},
+    {null_order::AFTER, null_order::AFTER, null_order::BEFORE});
+  auto const result =
+    stable_sorted_order(table_view{{structs, values}}, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->view());
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
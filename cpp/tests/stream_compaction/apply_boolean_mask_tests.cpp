@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,6 +25,12 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
 struct ApplyBooleanMask : public cudf::test::BaseFixture {
 };
 
@@ -170,4 +176,44 @@ TEST_F(ApplyBooleanMask, NoNullInput)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got->view());
 }
 
+TEST_F(ApplyBooleanMask, ManyTiles)
+{
+  // spans many tiles of the single pass filter, each of which passes a different number of rows
+  constexpr cudf::size_type size = 100000;
+  auto const rows                = thrust::make_counting_iterator<int32_t>(0);
+  auto const keep =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 < 3; });
+  auto const valid =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  auto const names =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); });
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(rows, rows + size, valid);
+  cudf::test::fixed_width_column_wrapper<int64_t> col2(rows, rows + size);
+  cudf::test::strings_column_wrapper col3(names, names + size, valid);
+  cudf::test::fixed_width_column_wrapper<bool> mask(keep, keep + size);
+
+  std::vector<int32_t> kept;
+  std::vector<bool> kept_valid;
+  std::vector<std::string> kept_names;
+  for (int32_t i = 0; i < size; ++i) {
+    if (keep[i]) {
+      kept.push_back(i);
+      kept_valid.push_back(valid[i]);
+      kept_names.push_back(names[i]);
+    }
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected(
+    kept.begin(), kept.end(), kept_valid.begin());
+  cudf::test::fixed_width_column_wrapper<int64_t> col2_expected(kept.begin(), kept.end());
+  cudf::test::strings_column_wrapper col3_expected(
+    kept_names.begin(), kept_names.end(), kept_valid.begin());
+
+  auto got = cudf::apply_boolean_mask(cudf::table_view{{col1, col2, col3}}, mask);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({col1_expected, col2_expected, col3_expected}),
+                                got->view());
+  EXPECT_EQ(got->get_column(0).null_count(),
+            std::count(kept_valid.begin(), kept_valid.end(), false));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
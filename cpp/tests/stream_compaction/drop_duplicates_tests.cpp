@@ -18,6 +18,7 @@
 #include <cmath>
 #include <ctgmath>
 #include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -394,3 +395,115 @@ TEST_F(DropDuplicate, EmptyKeys)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{empty_col}}, got->view());
 }
+
+struct Distinct : public cudf::test::BaseFixture {
+};
+
+TEST_F(Distinct, KeepOptions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{5, 4, 3, 5, 8, 5}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{0, 1, 2, 3, 4, 5}};
+  cudf::table_view input{{col1, col2}};
+  std::vector<cudf::size_type> keys{0};
+
+  // Retained rows keep their input order
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_first{{5, 4, 3, 8}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_first{{0, 1, 2, 4}};
+  auto got_first = cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_FIRST);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_col1_first, exp_col2_first}),
+                                got_first->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_last{{4, 3, 8, 5}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_last{{1, 2, 4, 5}};
+  auto got_last = cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_LAST);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_col1_last, exp_col2_last}),
+                                got_last->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_none{{4, 3, 8}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_none{{1, 2, 4}};
+  auto got_none = cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_NONE);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_col1_none, exp_col2_none}),
+                                got_none->view());
+}
+
+TEST_F(Distinct, WithNull)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 0, 2, 0, 1}, {1, 0, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{0, 1, 2, 3, 4}};
+  cudf::table_view input{{col1, col2}};
+  std::vector<cudf::size_type> keys{0};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_equal{{1, 0, 2}, {1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_equal{{0, 1, 2}};
+  auto got_equal =
+    cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_FIRST, null_equality::EQUAL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_col1_equal, exp_col2_equal}),
+                                got_equal->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_unequal{{1, 0, 2, 0}, {1, 0, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_unequal{{0, 1, 2, 3}};
+  auto got_unequal =
+    cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_FIRST, null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_col1_unequal, exp_col2_unequal}),
+                                got_unequal->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_none{{2}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_none{{2}};
+  auto got_none =
+    cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_NONE, null_equality::EQUAL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_col1_none, exp_col2_none}),
+                                got_none->view());
+}
+
+TEST_F(Distinct, MoreNullsThanKeys)
+{
+  // More null rows than distinct keys, so that a null row cannot be kept by reading another entry
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{0, 5, 0, 0, 5, 0, 0, 7},
+                                                       {0, 1, 0, 0, 1, 0, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{0, 1, 2, 3, 4, 5, 6, 7}};
+  cudf::table_view input{{col1, col2}};
+  std::vector<cudf::size_type> keys{0};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_first{{0, 5, 0, 0, 0, 0, 7},
+                                                                 {0, 1, 0, 0, 0, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_first{{0, 1, 2, 3, 5, 6, 7}};
+  auto got_first =
+    cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_FIRST, null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_col1_first, exp_col2_first}),
+                                got_first->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_none{{0, 0, 0, 0, 0, 7},
+                                                                {0, 0, 0, 0, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_none{{0, 2, 3, 5, 6, 7}};
+  auto got_none =
+    cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_NONE, null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_col1_none, exp_col2_none}),
+                                got_none->view());
+
+  EXPECT_EQ(cudf::distinct_count(cudf::table_view{{col1}}, null_equality::UNEQUAL), 7);
+}
+
+TEST_F(Distinct, UnorderedOutput)
+{
+  cudf::test::strings_column_wrapper col1{{"b", "a", "c", "b", "d", "b"}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{0, 1, 2, 3, 4, 5}};
+  cudf::table_view input{{col1, col2}};
+  std::vector<cudf::size_type> keys{0};
+
+  cudf::test::strings_column_wrapper exp_col1{{"a", "b", "c", "d"}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2{{1, 5, 2, 4}};
+  auto got = cudf::distinct(
+    input, keys, cudf::duplicate_keep_option::KEEP_LAST, null_equality::EQUAL, false);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_col1, exp_col2}),
+                                cudf::sort(got->view())->view());
+}
+
+TEST_F(Distinct, EmptyInputTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col(std::initializer_list<int32_t>{});
+  cudf::table_view input{{col}};
+  std::vector<cudf::size_type> keys{0};
+
+  auto got = cudf::distinct(input, keys);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, got->view());
+}
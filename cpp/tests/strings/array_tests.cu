@@ -19,6 +19,7 @@
 #include <cudf/copying.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/copying.hpp>
+#include <cudf/strings/detail/inline_string.cuh>
 #include <cudf/strings/detail/scatter.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/sorting.hpp>
@@ -49,6 +50,39 @@ TEST_F(StringsColumnTest, Sort)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, h_expected);
 }
 
+TEST_F(StringsColumnTest, SortLongPrefixes)
+{
+  std::string const prefix(70, 'x');
+  std::vector<std::string> h_strings{prefix + "b", prefix, "a", prefix + "a", "", prefix + "b"};
+  h_strings.push_back(std::string("a\0", 2));
+  h_strings.push_back(prefix + std::string("\0", 1));
+  std::vector<bool> h_valids{1, 1, 1, 1, 0, 1, 1, 1};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), h_valids.begin());
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::detail::sorted_order(strings_view);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{4, 2, 6, 1, 7, 3, 0, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = cudf::strings::detail::sorted_order(
+    strings_view, cudf::order::DESCENDING, cudf::null_order::AFTER);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_desc{0, 5, 3, 7, 1, 6, 2, 4};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_desc);
+}
+
+TEST_F(StringsColumnTest, InlineStrings)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"", "abcd", "<null>", "abcdefghijkl", "abcdefghijklm", "ééééééééé", "a"},
+    {1, 1, 0, 1, 1, 1, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto inline_strings = cudf::strings::detail::create_inline_string_vector(strings_view);
+  EXPECT_EQ(inline_strings.size(), static_cast<size_t>(strings_view.size()));
+  auto results = cudf::strings::detail::make_strings_column(inline_strings);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, strings);
+}
+
 TEST_F(StringsColumnTest, SortZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
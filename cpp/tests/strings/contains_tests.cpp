@@ -275,6 +275,70 @@ TEST_F(StringsContainsTests, CountTest)
   }
 }
 
+TEST_F(StringsContainsTests, AutomatonTest)
+{
+  std::vector<const char*> h_strings{
+    "abc", "xcd", "abc\ndef", "aéc", "日本ab", "", nullptr, "zzz"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    auto results = cudf::strings::contains_re(strings_view, "ab|cd");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 1, 0, 1, 0, 0, 0}, validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "^def");
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 1, 0, 0, 0, 0, 0}, validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "a.c");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 1, 1, 0, 0, 0, 0}, validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // strings with non-ASCII characters are evaluated by the regex program
+    auto results = cudf::strings::contains_re(strings_view, "本a");
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 0, 0, 1, 0, 0, 0}, validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::matches_re(strings_view, "a.c$");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 1, 1, 0, 0, 0, 0}, validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::count_re(strings_view, "a|c");
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({2, 1, 2, 2, 1, 0, 0, 0}, validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, LiteralPrefilterTest)
+{
+  std::vector<const char*> h_strings{
+    "error: timeout", "errors timeout", "no problem", nullptr, "an error at time 5"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto strings_view = cudf::strings_column_view(strings);
+
+  // word boundaries are evaluated by the regex program for the strings with "error" only
+  std::string pattern = "\\berror\\b.*time";
+  {
+    auto results = cudf::strings::contains_re(strings_view, pattern);
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 1}, validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::count_re(strings_view, pattern);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 0, 0, 0, 1}, validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsContainsTests, MediumRegex)
 {
   // This results in 95 regex instructions and falls in the 'medium' range.
@@ -118,6 +118,30 @@ TEST_F(StringsDatetimeTest, ToTimestampMillisecond)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_ns);
 }
 
+TEST_F(StringsDatetimeTest, ToTimestampIsoFallback)
+{
+  // strings not in the fixed-width form are parsed as the format describes
+  cudf::test::strings_column_wrapper strings{"2019-07-17 21:34:37.123",
+                                             "2019/07/17 21:34:37.123",
+                                             "1969-12-31 23:59:59.999xyz",
+                                             "2019-07-17 21:34:37",
+                                             "2019-7-17 21:34:37.123"};
+  auto strings_view = cudf::strings_column_view(strings);
+  auto results      = cudf::strings::to_timestamps(
+    strings_view, cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS}, "%Y-%m-%d %H:%M:%S.%3f");
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep> expected{
+    1563399277123, 1563399277123, -1, 0, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  cudf::test::strings_column_wrapper dates{"2020-02-29", "1970-01-01", "1969-12-31", "2020-2-29"};
+  results = cudf::strings::to_timestamps(cudf::strings_column_view(dates),
+                                         cudf::data_type{cudf::type_id::TIMESTAMP_DAYS},
+                                         "%Y-%m-%d");
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep> expected_days{
+    18321, 0, -1, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_days);
+}
+
 TEST_F(StringsDatetimeTest, ToTimestampTimezone)
 {
   cudf::test::strings_column_wrapper strings{"1974-02-28 01:23:45+0100",
@@ -169,6 +169,27 @@ TEST_F(StringsExtractTests, EmptyExtractTest)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*results, table_expected);
 }
 
+TEST_F(StringsExtractTests, ExtractLiteralTest)
+{
+  std::vector<const char*> h_strings{
+    "ERROR 42: timeout", "INFO 7", nullptr, "ERROR: 13 timeouts", "", "WARN timeout 3"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  // only the strings with "ERROR" are evaluated by the regex program
+  auto results = cudf::strings::extract(strings_view, "ERROR\\D*(\\d+)");
+
+  std::vector<const char*> h_expected{"42", nullptr, nullptr, "13", nullptr, nullptr};
+  cudf::test::strings_column_wrapper expected(
+    h_expected.begin(),
+    h_expected.end(),
+    thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view().column(0), expected);
+}
+
 TEST_F(StringsExtractTests, MediumRegex)
 {
   // This results in 95 regex instructions and falls in the 'medium' range.
@@ -51,6 +51,33 @@ TEST_F(StringsFindMultipleTest, FindMultiple)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsFindMultipleTest, ContainsMultiple)
+{
+  cudf::test::strings_column_wrapper strings({"Héllo", "thesé", "", "lease", "test strings", ""},
+                                             {1, 1, 0, 1, 1, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+  cudf::test::strings_column_wrapper targets({"é", "es", "ease", "ings", "", "lé"});
+  auto targets_view = cudf::strings_column_view(targets);
+
+  auto results = cudf::strings::contains_multiple(strings_view, targets_view);
+  EXPECT_EQ(results->num_columns(), 6);
+
+  std::vector<bool> validity{1, 1, 0, 1, 1, 1};
+  using bools = cudf::test::fixed_width_column_wrapper<bool>;
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0),
+                                 bools({1, 1, 0, 0, 0, 0}, validity.begin()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1),
+                                 bools({0, 1, 0, 0, 1, 0}, validity.begin()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2),
+                                 bools({0, 0, 0, 1, 0, 0}, validity.begin()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(3),
+                                 bools({0, 0, 0, 0, 1, 0}, validity.begin()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(4),
+                                 bools({1, 1, 0, 1, 1, 1}, validity.begin()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(5),
+                                 bools({0, 0, 0, 0, 0, 0}, validity.begin()));
+}
+
 TEST_F(StringsFindMultipleTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
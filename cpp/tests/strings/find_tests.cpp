@@ -141,6 +141,52 @@ TEST_F(StringsFindTest, Find)
   }
 }
 
+TEST_F(StringsFindTest, FindLongStrings)
+{
+  // long strings are searched by a warp of threads per string
+  std::string accents;
+  for (int i = 0; i < 150; ++i) accents += "é";
+  cudf::test::strings_column_wrapper strings(
+    {std::string(100, 'a') + "é" + std::string(100, 'b') + "target",
+     std::string(300, 'z'),
+     "target" + accents + "target",
+     "",
+     ""},
+    {1, 1, 1, 0, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  cudf::string_scalar target("target");
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({201, -1, 0, 0, -1},
+                                                             {1, 1, 1, 0, 1});
+    auto results = cudf::strings::find(strings_view, target);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({201, -1, 156, 0, -1},
+                                                             {1, 1, 1, 0, 1});
+    auto results = cudf::strings::find(strings_view, target, 1);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({201, -1, 156, 0, -1},
+                                                             {1, 1, 1, 0, 1});
+    auto results = cudf::strings::rfind(strings_view, target);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({-1, -1, 0, 0, -1},
+                                                             {1, 1, 1, 0, 1});
+    auto results = cudf::strings::rfind(strings_view, target, 0, 150);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 1, 0, 0}, {1, 1, 1, 0, 1});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("é"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsFindTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
@@ -165,6 +165,18 @@ TEST_F(StringsConvertTest, ToFloats64)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
 }
 
+TEST_F(StringsConvertTest, ToFloats64LongDigits)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"1234567812345678", "12345678.5", "-0000000000000001.5", "87654321e2", "1234.56781234"});
+  cudf::test::fixed_width_column_wrapper<double> expected{
+    1234567812345678.0, 12345678.5, -1.5, 8765432100.0, 1234.56781234};
+
+  auto strings_view = cudf::strings_column_view(strings);
+  auto results = cudf::strings::to_floats(strings_view, cudf::data_type{cudf::type_id::FLOAT64});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
 TEST_F(StringsConvertTest, FromFloats64)
 {
   std::vector<double> h_floats{100,
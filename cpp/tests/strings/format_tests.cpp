@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/combine.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+struct StringsFormatTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StringsFormatTest, Format)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> ids({1, -22, 333, 0}, {1, 1, 0, 1});
+  cudf::test::strings_column_wrapper names({"aa", "", "ccc", "déf"});
+  cudf::test::fixed_width_column_wrapper<bool> flags({1, 0, 1, 0});
+  cudf::table_view columns({ids, names, flags});
+
+  auto results = cudf::strings::format(columns, "user:{}/{}={}");
+  cudf::test::strings_column_wrapper expected(
+    {"user:1/aa=true", "user:-22/=false", "", "user:0/déf=false"}, {1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = cudf::strings::format(columns, "{{{}}}{}}}{{{}", cudf::string_scalar("?"));
+  cudf::test::strings_column_wrapper expected_narep(
+    {"{1}aa}{true", "{-22}}{false", "{?}ccc}{true", "{0}déf}{false"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_narep);
+}
+
+TEST_F(StringsFormatTest, Timestamps)
+{
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> seconds{
+    1530705600L, -1L, 0L};
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep> millis{
+    1530705600123L, -1L, 951782400000L};
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep> days{
+    17716, -1, 11016};
+  cudf::table_view columns({seconds, millis, days});
+
+  auto results = cudf::strings::format(columns, "{} {} {}");
+  cudf::test::strings_column_wrapper expected(
+    {"2018-07-04T12:00:00Z 2018-07-04T12:00:00Z 2018-07-04",
+     "1969-12-31T23:59:59Z 1969-12-31T23:59:59Z 1969-12-31",
+     "1970-01-01T00:00:00Z 2000-02-29T00:00:00Z 2000-02-29"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsFormatTest, ZeroSizeColumns)
+{
+  cudf::column_view zero_size_strings_column(
+    cudf::data_type{cudf::type_id::STRING}, 0, nullptr, nullptr, 0);
+  auto results = cudf::strings::format(cudf::table_view({zero_size_strings_column}), "name:{}");
+  EXPECT_EQ(results->size(), 0);
+}
+
+TEST_F(StringsFormatTest, Errors)
+{
+  cudf::test::strings_column_wrapper names({"aa"});
+  cudf::test::fixed_width_column_wrapper<float> floats({1.5f});
+  EXPECT_THROW(cudf::strings::format(cudf::table_view({names}), "{} {}"), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format(cudf::table_view({names}), "{ }"), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format(cudf::table_view({names}), "{}}"), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format(cudf::table_view({floats}), "{}"), cudf::logic_error);
+}
@@ -49,6 +49,28 @@ TEST_F(StringsConvertTest, ToInteger)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsConvertTest, ToIntegerLongDigits)
+{
+  cudf::test::strings_column_wrapper strings({"1234567890123456789",
+                                              "-12345678",
+                                              "+000000001234",
+                                              "12345678x9",
+                                              "1234567",
+                                              "98765432.1",
+                                              "-9223372036854775807"});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{1234567890123456789L,
+                                                           -12345678L,
+                                                           1234L,
+                                                           12345678L,
+                                                           1234567L,
+                                                           98765432L,
+                                                           -9223372036854775807L};
+
+  auto strings_view = cudf::strings_column_view(strings);
+  auto results = cudf::strings::to_integers(strings_view, cudf::data_type{cudf::type_id::INT64});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsConvertTest, FromInteger)
 {
   int32_t minint = std::numeric_limits<int32_t>::min();
@@ -196,6 +196,20 @@ TEST_F(StringsReplaceTest, ReplaceMulti)
   }
 }
 
+TEST_F(StringsReplaceTest, ReplaceMultiOverlapping)
+{
+  cudf::test::strings_column_wrapper strings({"abcabc", "bcd", "aab", "xyz", "cabd"});
+  auto strings_view = cudf::strings_column_view(strings);
+  // the first target matching at a position is replaced
+  cudf::test::strings_column_wrapper targets({"bc", "abc", "ab", "d"});
+  cudf::test::strings_column_wrapper repls({"1", "2", "3", "4"});
+
+  auto results = cudf::strings::replace(
+    strings_view, cudf::strings_column_view(targets), cudf::strings_column_view(repls));
+  cudf::test::strings_column_wrapper expected({"22", "14", "a3", "xyz", "c34"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsReplaceTest, ReplaceNulls)
 {
   std::vector<const char*> h_strings{"Héllo", "thesé", nullptr, "ARE THE", "tést strings", ""};
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/split/partition.hpp>
 #include <cudf/strings/split/split.hpp>
@@ -339,6 +340,26 @@ TEST_F(StringsSplitTest, SplitRecordWhitespaceWithMaxSplit)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
 }
 
+TEST_F(StringsSplitTest, SplitRecordSliced)
+{
+  std::vector<const char*> h_strings{"skip me", "a_b", nullptr, "", "_cd_éf", "ghi", "not this"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto sliced = cudf::slice(strings, {1, 6}).front();
+
+  auto result =
+    cudf::strings::split_record(cudf::strings_column_view(sliced), cudf::string_scalar("_"));
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected({LCW{"a", "b"}, LCW{}, LCW{""}, LCW{"", "cd", "éf"}, LCW{"ghi"}}, validity + 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+
+  result =
+    cudf::strings::rsplit_record(cudf::strings_column_view(sliced), cudf::string_scalar("_"), 1);
+  LCW rexpected({LCW{"a", "b"}, LCW{}, LCW{""}, LCW{"_cd", "éf"}, LCW{"ghi"}}, validity + 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), rexpected);
+}
+
 TEST_F(StringsSplitTest, RSplitRecord)
 {
   std::vector<const char*> h_strings{
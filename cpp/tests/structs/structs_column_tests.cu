@@ -594,4 +594,23 @@ TEST_F(StructColumnWrapperTest, SimpleTestExpectStructColumnsEqual)
   cudf::test::expect_columns_equivalent(structs_col, structs_col);
 }
 
+TEST_F(StructColumnWrapperTest, GatherSlicedStructs)
+{
+  auto names = cudf::test::strings_column_wrapper{"a", "b", "c", "d", "e"};
+  auto ages =
+    cudf::test::fixed_width_column_wrapper<int32_t>{{10, 20, 30, 40, 50}, {1, 1, 0, 1, 1}};
+  auto structs_col = cudf::test::structs_column_wrapper{{names, ages}, {1, 0, 1, 1, 1}};
+
+  // the fields are gathered from the rows of the slice, not of the children
+  auto const sliced     = cudf::slice(structs_col, {1, 5}).front();
+  auto const gather_map = cudf::test::fixed_width_column_wrapper<int32_t>{3, 0, 1};
+  auto const result     = cudf::gather(cudf::table_view{{sliced}}, gather_map);
+
+  auto expected_names = cudf::test::strings_column_wrapper{{"e", "b", "c"}, {1, 0, 1}};
+  auto expected_ages  = cudf::test::fixed_width_column_wrapper<int32_t>{{50, 20, 30}, {1, 0, 0}};
+  auto expected = cudf::test::structs_column_wrapper{{expected_names, expected_ages}, {1, 0, 1}};
+
+  cudf::test::expect_columns_equivalent(result->get_column(0), expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/table/chunked_table.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+using s_col_wrapper = cudf::test::strings_column_wrapper;
+
+struct ChunkedTableTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ChunkedTableTest, ConcatenateIntoChunks)
+{
+  column_wrapper<int32_t> a1{1, 2, 3};
+  s_col_wrapper s1{"a", "b", "c"};
+  column_wrapper<int32_t> a2{{4, 5}, {1, 0}};
+  s_col_wrapper s2{"d", "e"};
+  column_wrapper<int32_t> a3{6, 7, 8, 9};
+  s_col_wrapper s3{"f", "g", "h", "i"};
+  std::vector<cudf::table_view> tables{
+    cudf::table_view{{a1, s1}}, cudf::table_view{{a2, s2}}, cudf::table_view{{a3, s3}}};
+
+  auto chunked = cudf::chunked_table::concatenate(tables, 5);
+  EXPECT_EQ(chunked.num_rows(), 9);
+  EXPECT_EQ(chunked.num_columns(), 2);
+  ASSERT_EQ(chunked.num_chunks(), 2);
+  EXPECT_EQ(chunked.chunk_offset(1), 5);
+
+  column_wrapper<int32_t> expect_a{{1, 2, 3, 4, 5}, {1, 1, 1, 1, 0}};
+  s_col_wrapper expect_s{"a", "b", "c", "d", "e"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expect_a, expect_s}), chunked.chunk(0));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(tables[2], chunked.chunk(1));
+}
+
+TEST_F(ChunkedTableTest, SliceAcrossChunks)
+{
+  column_wrapper<int32_t> a1{1, 2, 3};
+  column_wrapper<int32_t> a2{4, 5};
+  column_wrapper<int32_t> a3{6, 7, 8, 9};
+  auto chunked = cudf::chunked_table::concatenate(
+    {cudf::table_view{{a1}}, cudf::table_view{{a2}}, cudf::table_view{{a3}}}, 3);
+  EXPECT_EQ(chunked.num_chunks(), 3);
+
+  auto result = chunked.slice(2, 7);
+  column_wrapper<int32_t> expect{3, 4, 5, 6, 7};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, result->get_column(0));
+
+  EXPECT_EQ(chunked.slice(4, 4)->num_rows(), 0);
+  EXPECT_THROW(chunked.slice(4, 10), cudf::logic_error);
+}
+
+TEST_F(ChunkedTableTest, GatherAcrossChunks)
+{
+  column_wrapper<int32_t> a1{1, 2, 3};
+  s_col_wrapper s1{"a", "b", "c"};
+  column_wrapper<int32_t> a2{4, 5};
+  s_col_wrapper s2{"d", "e"};
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  chunks.push_back(std::make_unique<cudf::table>(cudf::table_view{{a1, s1}}));
+  chunks.push_back(std::make_unique<cudf::table>(cudf::table_view{{a2, s2}}));
+  cudf::chunked_table chunked{std::move(chunks)};
+
+  column_wrapper<int64_t> map{4, 0, 3, 3, 2};
+  auto result = chunked.gather(map);
+  column_wrapper<int32_t> expect_a{5, 1, 4, 4, 3};
+  s_col_wrapper expect_s{"e", "a", "d", "d", "c"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expect_a, expect_s}), result->view());
+
+  column_wrapper<int64_t> one_chunk{4, 3};
+  column_wrapper<int32_t> expect_one{5, 4};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_one, chunked.gather(one_chunk)->get_column(0));
+
+  column_wrapper<int64_t> out_of_bounds{0, 5};
+  EXPECT_THROW(chunked.gather(out_of_bounds), cudf::logic_error);
+  column_wrapper<int32_t> narrow{0, 1};
+  EXPECT_THROW(chunked.gather(narrow), cudf::logic_error);
+}
+
+TEST_F(ChunkedTableTest, MismatchedColumns)
+{
+  column_wrapper<int32_t> a{1, 2};
+  column_wrapper<int64_t> b{1, 2};
+  EXPECT_THROW(cudf::chunked_table::concatenate({cudf::table_view{{a}}, cudf::table_view{{b}}}),
+               cudf::logic_error);
+}
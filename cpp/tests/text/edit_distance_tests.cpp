@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <nvtext/edit_distance.hpp>
 
 #include <tests/utilities/base_fixture.hpp>
@@ -98,3 +99,57 @@ TEST_F(TextEditDistanceTest, ErrorsTest)
     cudf::logic_error);
   EXPECT_THROW(nvtext::edit_distance_matrix(cudf::strings_column_view(strings)), cudf::logic_error);
 }
+
+TEST_F(TextEditDistanceTest, EditDistancePairs)
+{
+  std::vector<const char*> h_strings{
+    "dog", nullptr, "hog", "frog", "cat", "", "hat", "clog", "thé", "the"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  auto results = nvtext::edit_distance_pairs(cudf::strings_column_view(strings), 2);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_first(
+    {0, 0, 0, 1, 2, 2, 2, 3, 4, 8});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_second(
+    {2, 3, 7, 5, 3, 6, 7, 7, 6, 9});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_distance(
+    {1, 2, 2, 0, 2, 2, 2, 2, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected_first);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), expected_second);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), expected_distance);
+
+  results = nvtext::edit_distance_pairs(cudf::strings_column_view(strings), 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0),
+                                 cudf::test::fixed_width_column_wrapper<int32_t>({1}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1),
+                                 cudf::test::fixed_width_column_wrapper<int32_t>({5}));
+
+  EXPECT_THROW(nvtext::edit_distance_pairs(cudf::strings_column_view(strings), -1),
+               cudf::logic_error);
+  EXPECT_THROW(nvtext::edit_distance_pairs(cudf::strings_column_view(strings),
+                                           nvtext::max_banded_edit_distance + 1),
+               cudf::logic_error);
+}
+
+TEST_F(TextEditDistanceTest, EditDistanceNearest)
+{
+  cudf::test::strings_column_wrapper strings({"hello", "hallo", "world", "hella"});
+  auto results = nvtext::edit_distance_nearest(cudf::strings_column_view(strings), 1, 2);
+
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW expected_indices({LCW{1}, LCW{0}, LCW{}, LCW{0}});
+  LCW expected_distances({LCW{1}, LCW{1}, LCW{}, LCW{1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected_indices);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), expected_distances);
+
+  results = nvtext::edit_distance_nearest(cudf::strings_column_view(strings), 3, 2);
+  LCW expected_all_indices({LCW{1, 3}, LCW{0, 3}, LCW{}, LCW{0, 1}});
+  LCW expected_all_distances({LCW{1, 1}, LCW{1, 2}, LCW{}, LCW{1, 2}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected_all_indices);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), expected_all_distances);
+
+  EXPECT_THROW(nvtext::edit_distance_nearest(cudf::strings_column_view(strings), 0, 2),
+               cudf::logic_error);
+}
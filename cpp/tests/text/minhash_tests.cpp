@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <nvtext/minhash.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <limits>
+#include <vector>
+
+struct MinHashTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::unique_ptr<cudf::column> minhash_of(char const* str,
+                                         cudf::column_view const& seeds,
+                                         cudf::size_type width,
+                                         nvtext::ngram_type type = nvtext::ngram_type::CHARACTER)
+{
+  cudf::test::strings_column_wrapper strings({str});
+  return nvtext::minhash(cudf::strings_column_view(strings), seeds, width, type);
+}
+}  // namespace
+
+TEST_F(MinHashTest, Basic)
+{
+  std::vector<const char*> h_strings{"abcab", nullptr, "abcabcab", "", "thé"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  // more seeds than are processed in a single pass
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+
+  auto results = nvtext::minhash(cudf::strings_column_view(strings), seeds, 3);
+  EXPECT_EQ(5, results->size());
+  EXPECT_EQ(1, results->null_count());
+  cudf::lists_column_view lists(*results);
+  EXPECT_EQ(55, lists.child().size());
+  EXPECT_EQ(cudf::type_id::UINT32, lists.child().type().id());
+
+  // same set of n-grams produces the same minhash values
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*minhash_of("abcab", seeds, 3), *minhash_of("abcabcab", seeds, 3));
+  // a string shorter than the width is hashed as a single n-gram
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*minhash_of("thé", seeds, 5), *minhash_of("thé", seeds, 3));
+  // the empty string has no n-grams
+  std::vector<uint32_t> h_max(11, std::numeric_limits<uint32_t>::max());
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_max(h_max.begin(), h_max.end());
+  auto empty = minhash_of("", seeds, 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::lists_column_view(*empty).child(), expected_max);
+}
+
+TEST_F(MinHashTest, Words)
+{
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({7, 11, 13});
+  auto const type = nvtext::ngram_type::WORD;
+  auto expected   = minhash_of("the cat the cat", seeds, 2, type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*minhash_of("  the cat the cat the cat ", seeds, 2, type),
+                                 *expected);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*minhash_of("the cat", seeds, 2, type),
+                                 *minhash_of("the cat", seeds, 7, type));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*minhash_of("the cat", seeds, 2, type),
+                                 *minhash_of("the cat", seeds, 7));
+  std::vector<uint32_t> h_max(3, std::numeric_limits<uint32_t>::max());
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_max(h_max.begin(), h_max.end());
+  auto whitespace = minhash_of("   ", seeds, 2, type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::lists_column_view(*whitespace).child(), expected_max);
+}
+
+TEST_F(MinHashTest, Bands)
+{
+  cudf::test::strings_column_wrapper strings({"abcdefgh", "abcdefgx", "abcdefgh"});
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({1, 2, 3, 4, 5, 6});
+  auto minhashes = nvtext::minhash(cudf::strings_column_view(strings), seeds, 4);
+  auto results   = nvtext::minhash_bands(cudf::lists_column_view(*minhashes), 3);
+  EXPECT_EQ(3, results->size());
+  cudf::lists_column_view lists(*results);
+  EXPECT_EQ(9, lists.child().size());
+  auto const bands = cudf::slice(lists.child(), {0, 3, 6, 9});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(bands[0], bands[2]);
+
+  EXPECT_THROW(nvtext::minhash_bands(cudf::lists_column_view(*minhashes), 4), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash_bands(cudf::lists_column_view(*minhashes), 0), cudf::logic_error);
+}
+
+TEST_F(MinHashTest, EmptyAndErrors)
+{
+  cudf::test::strings_column_wrapper strings({"abc", "def"});
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({1, 2});
+  auto empty   = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  auto results = nvtext::minhash(cudf::strings_column_view(empty->view()), seeds);
+  EXPECT_EQ(0, results->size());
+  EXPECT_EQ(0, nvtext::minhash_bands(cudf::lists_column_view(*results), 2)->size());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> bad_seeds({1, 2});
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), bad_seeds),
+               cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<uint32_t> no_seeds{};
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), no_seeds), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), seeds, 0), cudf::logic_error);
+}
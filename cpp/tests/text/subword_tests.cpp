@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
@@ -245,6 +246,153 @@ TEST(TextSubwordTest, TokenizeFromVocabStruct)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
 
+TEST(TextSubwordTest, TokenizeLongStrings)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  // strings up to 1024 bytes are tokenized within shared memory, longer ones are not
+  std::string sentence("This is a tést. ");
+  std::string short_string, long_string;
+  for (int idx = 0; idx < 60; ++idx) short_string += sentence;
+  for (int idx = 0; idx < 70; ++idx) long_string += sentence;
+
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_tokens(
+    {2023, 2003, 1037, 3231, 1012, 2023, 2003, 1037, 3231, 1012, 2023, 2003});
+  for (auto const& str : {short_string, long_string}) {
+    cudf::test::strings_column_wrapper strings({str});
+    auto result = nvtext::subword_tokenize(cudf::strings_column_view{strings},
+                                           vocab,
+                                           12,
+                                           12,
+                                           true,  // do_lower_case
+                                           true,  // do_truncate
+                                           MAX_NUM_SENTENCES,
+                                           MAX_NUM_CHARS,
+                                           MAX_ROWS_TENSOR);
+    EXPECT_EQ(1, result.nrows_tensor);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_token_ids->view(), expected_tokens);
+  }
+}
+
+TEST(TextSubwordTest, TokenizerBatches)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+
+  std::vector<const char*> h_strings{"This is a test.",
+                                     "This is a test. This is a tést.",
+                                     "",
+                                     "a test",
+                                     "This is a test. This is a tést.",
+                                     "is this a test?",
+                                     "tést"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  auto const input = cudf::slice(strings, {1, 7}).front();
+
+  auto expected = nvtext::subword_tokenize(cudf::strings_column_view{input},
+                                           hash_file,
+                                           8,
+                                           6,
+                                           true,   // do_lower_case
+                                           false,  // do_truncate
+                                           MAX_NUM_SENTENCES,
+                                           MAX_NUM_CHARS,
+                                           MAX_ROWS_TENSOR);
+  EXPECT_EQ(8, expected.nrows_tensor);
+
+  // small working memory limits force the input to be processed in several batches
+  nvtext::subword_tokenizer tokenizer(nvtext::load_vocabulary_file(hash_file),
+                                      8,
+                                      6,
+                                      true,   // do_lower_case
+                                      false,  // do_truncate
+                                      3,      // max_num_strings
+                                      40,     // max_num_chars
+                                      3);     // max_rows_tensor
+  for (int pass = 0; pass < 2; ++pass) {  // the working memory is reused
+    auto results = tokenizer.tokenize(cudf::strings_column_view{input});
+    ASSERT_EQ(3, results.size());
+    std::vector<cudf::column_view> token_ids, attention_mask, metadata;
+    for (auto const& result : results) {
+      EXPECT_EQ(8, result.sequence_length);
+      token_ids.push_back(result.tensor_token_ids->view());
+      attention_mask.push_back(result.tensor_attention_mask->view());
+      metadata.push_back(result.tensor_metadata->view());
+    }
+    EXPECT_EQ(3, results[0].nrows_tensor);
+    EXPECT_EQ(3, results[1].nrows_tensor);
+    EXPECT_EQ(2, results[2].nrows_tensor);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::concatenate(token_ids),
+                                   expected.tensor_token_ids->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::concatenate(attention_mask),
+                                   expected.tensor_attention_mask->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::concatenate(metadata), expected.tensor_metadata->view());
+  }
+
+  cudf::test::strings_column_wrapper empty({});
+  EXPECT_TRUE(tokenizer.tokenize(cudf::strings_column_view{empty}).empty());
+  // a single string larger than max_num_chars cannot be tokenized
+  cudf::test::strings_column_wrapper large({"This is a test. This is a test. This is a test."});
+  EXPECT_THROW(tokenizer.tokenize(cudf::strings_column_view{large}), cudf::logic_error);
+}
+
+TEST(TextSubwordTest, BuildVocabulary)
+{
+  std::string vocab_file = temp_env->get_temp_filepath("vocab.txt");
+  {
+    std::ofstream outfile(vocab_file, std::ofstream::out);
+    outfile << "[PAD]\n[UNK]\n[CLS]\n[SEP]\nthis\nis\na\ntest\n.\n##s\ntést\n";
+  }
+  auto vocab = nvtext::build_hashed_vocabulary(vocab_file);
+  EXPECT_EQ(1, vocab.unknown_token_id);
+  EXPECT_EQ(2, vocab.first_token_id);
+  EXPECT_EQ(3, vocab.separator_token_id);
+
+  std::vector<const char*> h_strings{"This is a test.", "these tests"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  auto result = nvtext::subword_tokenize(cudf::strings_column_view{strings},
+                                         vocab,
+                                         8,
+                                         6,
+                                         false,  // do_lower_case
+                                         true,   // do_truncate
+                                         MAX_NUM_SENTENCES,
+                                         MAX_NUM_CHARS,
+                                         MAX_ROWS_TENSOR);
+  EXPECT_EQ(2, result.nrows_tensor);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_tokens(
+    {1, 5, 6, 7, 8, 0, 0, 0, 1, 7, 9, 0, 0, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_token_ids->view(), expected_tokens);
+
+  std::string bad_file = temp_env->get_temp_filepath("bad_vocab.txt");
+  {
+    std::ofstream outfile(bad_file, std::ofstream::out);
+    outfile << "this\nis\na\ntest\n";
+  }
+  EXPECT_THROW(nvtext::build_hashed_vocabulary(bad_file), cudf::logic_error);
+  EXPECT_THROW(nvtext::build_hashed_vocabulary(temp_env->get_temp_filepath("nothing.txt")),
+               cudf::logic_error);
+}
+
+TEST(TextSubwordTest, CachedVocabulary)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+
+  auto vocab = nvtext::get_cached_vocabulary(hash_file);
+  EXPECT_EQ(vocab, nvtext::get_cached_vocabulary(hash_file));
+  EXPECT_EQ(100, vocab->unknown_token_id);
+
+  nvtext::clear_vocabulary_cache();
+  auto reloaded = nvtext::get_cached_vocabulary(hash_file);
+  EXPECT_NE(vocab, reloaded);
+  EXPECT_EQ(vocab->table->size(), reloaded->table->size());
+  EXPECT_THROW(nvtext::get_cached_vocabulary(temp_env->get_temp_filepath("nothing.txt")),
+               cudf::logic_error);
+}
+
 TEST(TextSubwordTest, LoadVocabFileErrors)
 {
   std::vector<const char*> h_strings{"This is a test.", "This is a test. This is a tést."};
@@ -190,3 +190,29 @@ TEST_F(TextTokenizeTest, DetokenizeErrors)
   EXPECT_THROW(nvtext::detokenize(strings_view, one, cudf::string_scalar("", false)),
                cudf::logic_error);
 }
+
+TEST_F(TextTokenizeTest, TokenizeWithVocabulary)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  cudf::test::strings_column_wrapper vocabulary({"hello", "world", "goodbye", "hello"});
+  auto vocab = nvtext::load_vocabulary(cudf::strings_column_view(vocabulary));
+
+  std::vector<const char*> h_strings{"hello world", nullptr, "goodbye cruel world", ""};
+  auto validity = thrust::make_transform_iterator(h_strings.begin(),
+                                                  [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto input = cudf::strings_column_view(strings);
+
+  auto results = nvtext::tokenize_with_vocabulary(input, *vocab);
+  LCW expected({LCW{0, 1}, LCW{}, LCW{2, -1, 1}, LCW{}}, validity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = nvtext::tokenize_with_vocabulary(input, *vocab, cudf::string_scalar("o"), 99);
+  LCW expected_o({LCW{99, 99, 99}, LCW{}, LCW{99, 99, 99}, LCW{}}, validity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_o);
+
+  EXPECT_THROW(nvtext::tokenize_with_vocabulary(input, *vocab, cudf::string_scalar("", false)),
+               cudf::logic_error);
+  cudf::test::strings_column_wrapper nulls({"a", "b"}, {1, 0});
+  EXPECT_THROW(nvtext::load_vocabulary(cudf::strings_column_view(nulls)), cudf::logic_error);
+}
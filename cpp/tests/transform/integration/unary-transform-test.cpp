@@ -18,6 +18,7 @@
  */
 
 #include <cudf/transform.hpp>
+#include <cudf/udf.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_wrapper.hpp>
@@ -222,6 +223,31 @@ __device__ inline void f(cudf::timestamp_us* output, cudf::timestamp_us input)
   test_udf<dtype>(cuda, op, data_init, 500, false);
 }
 
+TEST_F(UnaryOperationIntegrationTest, Transform_CompiledUDF)
+{
+  const char cuda[] =
+    R"***(
+__device__ inline void f(int* output, int input)
+{
+  *output = input * input + 1;
+}
+)***";
+
+  using dtype = int32_t;
+  auto op     = [](dtype a) { return a * a + 1; };
+  auto udf    = cudf::compile_udf(cuda, cudf::udf_type::CUDA, data_type(type_to_id<dtype>()));
+
+  // The registered function is reused across calls and column sizes.
+  for (cudf::size_type size : {500, 37, 500}) {
+    auto data_iter = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i - 50; });
+    cudf::test::fixed_width_column_wrapper<dtype> in(data_iter, data_iter + size);
+
+    std::unique_ptr<cudf::column> out = cudf::transform(in, *udf);
+
+    ASSERT_UNARY<dtype, dtype>(out->view(), in, op);
+  }
+}
+
 }  // namespace transformation
 }  // namespace test
 }  // namespace cudf
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/transpose.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
@@ -178,6 +179,23 @@ TYPED_TEST(TransposeTest, EmptyTable) { run_test<TypeParam>(0, 0, false); }
 
 TYPED_TEST(TransposeTest, EmptyColumns) { run_test<TypeParam>(10, 0, false); }
 
+TYPED_TEST(TransposeTest, Sliced)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> col1({1, 2, 3, 4}, {1, 0, 1, 1});
+  fixed_width_column_wrapper<TypeParam, int32_t> col2({5, 6, 7, 8}, {1, 1, 0, 1});
+  auto const input  = cudf::slice(cudf::table_view{{col1, col2}}, {1, 4}).front();
+  auto const result = cudf::transpose(input);
+
+  fixed_width_column_wrapper<TypeParam, int32_t> expected1({2, 6}, {0, 1});
+  fixed_width_column_wrapper<TypeParam, int32_t> expected2({3, 7}, {1, 0});
+  fixed_width_column_wrapper<TypeParam, int32_t> expected3({4, 8}, {1, 1});
+  auto const result_view = std::get<1>(result);
+  ASSERT_EQ(result_view.num_columns(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_view.column(0), expected1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_view.column(1), expected2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_view.column(2), expected3);
+}
+
 TYPED_TEST(TransposeTest, MismatchedColumns)
 {
   fixed_width_column_wrapper<TypeParam, int32_t> col1({1, 2, 3});
@@ -84,6 +84,47 @@ TEST_P(IdDispatcherTest, IdToType)
   EXPECT_TRUE(cudf::type_dispatcher(cudf::data_type{t}, verify_dispatched_type{}, t));
 }
 
+namespace {
+using integer_ids = cudf::type_id_list<cudf::type_id::INT32, cudf::type_id::INT64>;
+
+struct verify_integer_dispatched_type {
+  // Fails to compile if instantiated for any type outside of `integer_ids`
+  template <typename T>
+  __host__ __device__ bool operator()(cudf::type_id id)
+  {
+    static_assert(std::is_integral<T>::value, "Dispatched a type outside of the type list");
+    return id == cudf::type_to_id<T>();
+  }
+};
+
+__global__ void restricted_dispatch_test_kernel(cudf::type_id id, bool* d_result)
+{
+  if (0 == threadIdx.x + blockIdx.x * blockDim.x)
+    *d_result =
+      cudf::type_dispatcher<integer_ids>(cudf::data_type{id}, verify_integer_dispatched_type{}, id);
+}
+}  // namespace
+
+TEST_F(DispatcherTest, RestrictedDispatch)
+{
+  for (auto t : {cudf::type_id::INT32, cudf::type_id::INT64}) {
+    EXPECT_TRUE(
+      cudf::type_dispatcher<integer_ids>(cudf::data_type{t}, verify_integer_dispatched_type{}, t));
+  }
+  EXPECT_THROW(cudf::type_dispatcher<integer_ids>(cudf::data_type{cudf::type_id::FLOAT32},
+                                                  verify_integer_dispatched_type{},
+                                                  cudf::type_id::FLOAT32),
+               cudf::logic_error);
+}
+
+TEST_F(DispatcherTest, RestrictedDeviceDispatch)
+{
+  thrust::device_vector<bool> result(1, false);
+  restricted_dispatch_test_kernel<<<1, 1>>>(cudf::type_id::INT64, result.data().get());
+  CUDA_TRY(cudaDeviceSynchronize());
+  EXPECT_EQ(true, result[0]);
+}
+
 template <typename T>
 struct TypedDoubleDispatcherTest : public DispatcherTest {
 };
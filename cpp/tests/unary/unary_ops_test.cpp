@@ -347,6 +347,42 @@ TYPED_TEST(cudf_math_with_floating_point_test, SimpleCBRT)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, output->view());
 }
 
+TYPED_TEST(cudf_math_with_floating_point_test, FusedChain)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input{{-1, 4, -16, 64}, {1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<TypeParam> expected{{1, 2, 4, 8}, {1, 1, 0, 1}};
+  auto output = cudf::unary_operation(input, {cudf::unary_op::ABS, cudf::unary_op::SQRT});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, output->view());
+}
+
+TYPED_TEST(cudf_math_with_floating_point_test, FusedChainEndingWithNot)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input{{0.5, 1.5, -0.5}};
+  cudf::test::fixed_width_column_wrapper<bool> expected{{true, false, false}};
+  auto output = cudf::unary_operation(input, {cudf::unary_op::FLOOR, cudf::unary_op::NOT});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, output->view());
+}
+
+TYPED_TEST(cudf_math_with_floating_point_test, FusedChainInPlace)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input{{-1, 4, -16, 64}, {1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<TypeParam> expected{{1, 2, 4, 8}, {1, 1, 0, 1}};
+  auto column = input.release();
+  auto view   = column->mutable_view();
+  cudf::unary_operation(view, {cudf::unary_op::ABS, cudf::unary_op::SQRT}, view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, column->view());
+}
+
+TYPED_TEST(cudf_math_with_floating_point_test, FusedChainFail)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input{1.0};
+  EXPECT_THROW(cudf::unary_operation(input, std::vector<cudf::unary_op>{}), cudf::logic_error);
+  EXPECT_THROW(cudf::unary_operation(input, {cudf::unary_op::NOT, cudf::unary_op::ABS}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::unary_operation(input, {cudf::unary_op::ABS, cudf::unary_op::BIT_INVERT}),
+               cudf::logic_error);
+}
+
 template <typename T>
 struct cudf_math_with_char_test : public cudf::test::BaseFixture {
 };
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/async.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <vector>
+
+struct AsyncTest : public cudf::test::BaseFixture {
+  void SetUp() override
+  {
+    CUDA_TRY(cudaStreamCreate(&first));
+    CUDA_TRY(cudaStreamCreate(&second));
+  }
+
+  void TearDown() override
+  {
+    CUDA_TRY(cudaStreamDestroy(first));
+    CUDA_TRY(cudaStreamDestroy(second));
+  }
+
+  cudaStream_t first{};
+  cudaStream_t second{};
+};
+
+TEST_F(AsyncTest, IndependentOperations)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{3, 1, 2, 5, 4};
+  cudf::test::strings_column_wrapper names{"c", "a", "b", "e", "d"};
+  cudf::test::fixed_width_column_wrapper<int32_t> other{5, 3, 7};
+  auto const input = cudf::table_view{{keys, names}};
+  auto const right = cudf::table_view{{other}};
+
+  auto sorted = cudf::sort_async(input, {}, {}, first);
+  auto joined = cudf::inner_join_async(
+    input, right, {0}, {0}, {}, cudf::null_equality::EQUAL, second);
+  EXPECT_EQ(sorted.stream(), first);
+  EXPECT_EQ(joined.stream(), second);
+
+  auto const sorted_table = sorted.get();
+  auto const joined_table = joined.get();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::sort(input)->view(), sorted_table->view());
+  auto const expected = cudf::inner_join(input, right, {0}, {0}, {});
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(cudf::sort(expected->view())->view(),
+                                     cudf::sort(joined_table->view())->view());
+}
+
+TEST_F(AsyncTest, ContiguousSplit)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 0}};
+  auto const input = cudf::table_view{{col}};
+
+  auto result      = cudf::contiguous_split_async(input, {2}, first).get();
+  auto const split = cudf::split(input, {2});
+  ASSERT_EQ(result.size(), split.size());
+  for (size_t i = 0; i < split.size(); ++i) {
+    CUDF_TEST_EXPECT_TABLES_EQUAL(split[i], result[i].table);
+  }
+}
+
+TEST_F(AsyncTest, ExceptionsAreRethrown)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+  auto const input = cudf::table_view{{col}};
+
+  auto result = cudf::contiguous_split_async(input, {4}, first);
+  EXPECT_THROW(result.get(), cudf::logic_error);
+}
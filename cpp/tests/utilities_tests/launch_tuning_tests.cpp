@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/launch_tuning.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <set>
+#include <string>
+
+struct LaunchTuningTest : public cudf::test::BaseFixture {
+  void TearDown() override
+  {
+    cudf::set_launch_tuning_mode(cudf::launch_tuning_mode::TABLE);
+    for (auto const& parameter : cudf::get_launch_parameters()) {
+      cudf::set_launch_parameter(parameter.first, -1);
+    }
+  }
+};
+
+TEST_F(LaunchTuningTest, Parameters)
+{
+  EXPECT_EQ(cudf::get_launch_tuning_mode(), cudf::launch_tuning_mode::TABLE);
+
+  auto const parameters = cudf::get_launch_parameters();
+  ASSERT_EQ(parameters.size(), 3u);
+  EXPECT_EQ(parameters.count("join_build_block_size"), 1u);
+  EXPECT_EQ(parameters.count("join_probe_block_size"), 1u);
+  EXPECT_EQ(parameters.count("hash_partition_max_shared_partitions"), 1u);
+
+  cudf::set_launch_parameter("join_probe_block_size", 512);
+  EXPECT_EQ(cudf::get_launch_parameters().at("join_probe_block_size"), 512);
+  cudf::set_launch_parameter("join_probe_block_size", -1);
+  EXPECT_EQ(cudf::get_launch_parameters(), parameters);
+
+  EXPECT_THROW(cudf::set_launch_parameter("no_such_parameter", 128), cudf::logic_error);
+  EXPECT_THROW(cudf::set_launch_parameter("join_probe_block_size", 100), cudf::logic_error);
+}
+
+TEST_F(LaunchTuningTest, PinnedPartitionThreshold)
+{
+  auto const num_rows = 10000;
+  auto const begin    = thrust::make_counting_iterator(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> keys(begin, begin + num_rows);
+  cudf::table_view input{{keys}};
+
+  // 1024 partitions are radix partitioned below the first threshold and not the second
+  cudf::set_launch_parameter("hash_partition_max_shared_partitions", 256);
+  auto const radix = cudf::hash_partition(input, {0}, 1024);
+  cudf::set_launch_parameter("hash_partition_max_shared_partitions", 1536);
+  auto const shared = cudf::hash_partition(input, {0}, 1024);
+
+  EXPECT_EQ(radix.second, shared.second);
+  EXPECT_EQ(radix.first->num_rows(), num_rows);
+  EXPECT_EQ(shared.first->num_rows(), num_rows);
+}
+
+TEST_F(LaunchTuningTest, Autotune)
+{
+  auto const num_rows = 1 << 17;
+  auto const begin    = thrust::make_counting_iterator(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> left(begin, begin + num_rows);
+  cudf::test::fixed_width_column_wrapper<int32_t> right(begin, begin + num_rows);
+  cudf::table_view left_table{{left}};
+  cudf::table_view right_table{{right}};
+  auto const expected_offsets = cudf::hash_partition(left_table, {0}, 1024).second;
+
+  cudf::set_launch_tuning_mode(cudf::launch_tuning_mode::AUTOTUNE);
+  EXPECT_EQ(cudf::get_launch_tuning_mode(), cudf::launch_tuning_mode::AUTOTUNE);
+
+  // Enough launches to time every candidate, whichever values the results are computed with
+  for (int i = 0; i < 20; ++i) {
+    auto const joined = cudf::inner_join(left_table, right_table, {0}, {0}, {});
+    EXPECT_EQ(joined->num_rows(), num_rows);
+    EXPECT_EQ(cudf::hash_partition(left_table, {0}, 1024).second, expected_offsets);
+  }
+
+  auto const parameters = cudf::get_launch_parameters();
+  std::set<int> const block_sizes{128, 256, 512};
+  EXPECT_EQ(block_sizes.count(parameters.at("join_build_block_size")), 1u);
+  EXPECT_EQ(block_sizes.count(parameters.at("join_probe_block_size")), 1u);
+  std::set<int> const thresholds{256, 512, 1024, 1536};
+  EXPECT_EQ(thresholds.count(parameters.at("hash_partition_max_shared_partitions")), 1u);
+}
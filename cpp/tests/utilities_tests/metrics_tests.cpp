@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/groupby.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/metrics.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <vector>
+
+struct recording_sink : public cudf::metrics_sink {
+  void record(cudf::operation_metrics const& metrics) override { records.push_back(metrics); }
+
+  std::vector<cudf::operation_metrics> records;
+};
+
+struct MetricsTest : public cudf::test::BaseFixture {
+  void TearDown() override { cudf::set_metrics_sink(nullptr); }
+};
+
+TEST_F(MetricsTest, DisabledByDefault)
+{
+  EXPECT_EQ(cudf::get_metrics_sink(), nullptr);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{3, 1, 2};
+  recording_sink sink;
+  cudf::sort(cudf::table_view{{col}});
+  EXPECT_TRUE(sink.records.empty());
+
+  cudf::set_metrics_sink(&sink);
+  EXPECT_EQ(cudf::get_metrics_sink(), &sink);
+  cudf::set_metrics_sink(nullptr);
+  cudf::sort(cudf::table_view{{col}});
+  EXPECT_TRUE(sink.records.empty());
+}
+
+TEST_F(MetricsTest, Sort)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{3, 1, 2, 5};
+  cudf::test::strings_column_wrapper strings{"c", "a", "b", "e"};
+  recording_sink sink;
+  cudf::set_metrics_sink(&sink);
+
+  cudf::sort_by_key(cudf::table_view{{strings}}, cudf::table_view{{keys}});
+  cudf::sorted_order(cudf::table_view{{strings}});
+
+  ASSERT_EQ(sink.records.size(), 2u);
+  auto const& by_key = sink.records[0];
+  EXPECT_EQ(by_key.operation, "sort_by_key");
+  EXPECT_GE(by_key.elapsed_ms, 0);
+  EXPECT_EQ(by_key.counters.at("rows_in"), 4);
+  EXPECT_EQ(by_key.counters.at("key_columns"), 1);
+  EXPECT_EQ(by_key.counters.at("value_columns"), 1);
+  EXPECT_EQ(by_key.decisions.at("algorithm"), "radix");
+  EXPECT_EQ(sink.records[1].operation, "sorted_order");
+  EXPECT_EQ(sink.records[1].decisions.at("algorithm"), "strings_radix");
+}
+
+TEST_F(MetricsTest, InnerJoin)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> left{0, 1, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> right{1, 3, 5};
+  recording_sink sink;
+  cudf::set_metrics_sink(&sink);
+
+  cudf::inner_join(cudf::table_view{{left}}, cudf::table_view{{right}}, {0}, {0}, {});
+
+  ASSERT_EQ(sink.records.size(), 1u);
+  auto const& join = sink.records[0];
+  EXPECT_EQ(join.operation, "inner_join");
+  EXPECT_EQ(join.counters.at("rows_left"), 5);
+  EXPECT_EQ(join.counters.at("rows_right"), 3);
+  EXPECT_EQ(join.counters.at("rows_out"), 2);
+  EXPECT_EQ(join.decisions.at("build_side"), "right");
+}
+
+TEST_F(MetricsTest, GroupbyAggregate)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 3, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4};
+  recording_sink sink;
+  cudf::set_metrics_sink(&sink);
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  cudf::groupby::groupby(cudf::table_view{{keys}}).aggregate(requests);
+  requests[0].aggregations.push_back(cudf::make_median_aggregation());
+  cudf::groupby::groupby(cudf::table_view{{keys}}).aggregate(requests);
+
+  ASSERT_EQ(sink.records.size(), 2u);
+  for (auto const& aggregate : sink.records) {
+    EXPECT_EQ(aggregate.operation, "groupby_aggregate");
+    EXPECT_EQ(aggregate.counters.at("rows_in"), 5);
+    EXPECT_EQ(aggregate.counters.at("requests"), 1);
+    EXPECT_EQ(aggregate.counters.at("groups_out"), 3);
+  }
+  EXPECT_EQ(sink.records[0].decisions.at("algorithm"), "hash");
+  EXPECT_EQ(sink.records[1].decisions.at("algorithm"), "sort");
+}
+
+TEST_F(MetricsTest, ReadParquet)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> col{1, 2, 3, 4, 5, 6};
+  std::vector<char> buffer;
+  cudf::io::write_parquet_args write_args{cudf::io::sink_info(&buffer),
+                                          cudf::table_view{{col, col}}};
+  cudf::io::write_parquet(write_args);
+  recording_sink sink;
+  cudf::set_metrics_sink(&sink);
+
+  cudf::io::read_parquet_args read_args{cudf::io::source_info(buffer.data(), buffer.size())};
+  cudf::io::read_parquet(read_args);
+
+  ASSERT_EQ(sink.records.size(), 1u);
+  auto const& read = sink.records[0];
+  EXPECT_EQ(read.operation, "read_parquet");
+  EXPECT_EQ(read.counters.at("source_bytes"), static_cast<int64_t>(buffer.size()));
+  EXPECT_EQ(read.counters.at("rows_out"), 6);
+  EXPECT_EQ(read.counters.at("columns_out"), 2);
+  EXPECT_GT(read.counters.at("bytes_out"), 0);
+}
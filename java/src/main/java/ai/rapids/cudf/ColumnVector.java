@@ -701,6 +701,27 @@ public final class ColumnVector implements AutoCloseable, BinaryOperable, Column
     return new ColumnVector(replaceNulls(getNativeView(), scalar.getScalarHandle()));
   }
 
+  /**
+   * Replace the nulls of many columns in a single native call, which avoids the per call
+   * overhead for wide tables. Equivalent to calling columns[i].replaceNulls(scalars[i]) for each
+   * column.
+   * @param columns the columns to replace nulls in.
+   * @param scalars the replacement value for each column.
+   * @return the new columns. NOTE: It is the responsibility of the caller to close them.
+   */
+  public static ColumnVector[] replaceNulls(ColumnVector[] columns, Scalar[] scalars) {
+    if (columns.length != scalars.length) {
+      throw new IllegalArgumentException("One scalar is needed per column");
+    }
+    long[] views = new long[columns.length];
+    long[] scalarHandles = new long[columns.length];
+    for (int i = 0; i < columns.length; i++) {
+      views[i] = columns[i].getNativeView();
+      scalarHandles[i] = scalars[i].getScalarHandle();
+    }
+    return fromNativeHandles(replaceNullsMany(views, scalarHandles));
+  }
+
   /**
    * For a BOOL8 vector, computes a vector whose rows are selected from two other vectors
    * based on the boolean value of this vector in the corresponding row.
@@ -782,6 +803,17 @@ public final class ColumnVector implements AutoCloseable, BinaryOperable, Column
   // Slice/Split and Concatenate
   /////////////////////////////////////////////////////////////////////////////
 
+  /**
+   * Wrap the handles of new native columns, as returned by the batched native calls.
+   */
+  private static ColumnVector[] fromNativeHandles(long[] nativeHandles) {
+    ColumnVector[] columnVectors = new ColumnVector[nativeHandles.length];
+    for (int i = 0; i < nativeHandles.length; i++) {
+      columnVectors[i] = new ColumnVector(nativeHandles[i]);
+    }
+    return columnVectors;
+  }
+
   /**
    * Slices a column (including null values) into a set of columns
    * according to a set of indices. The caller owns the ColumnVectors and is responsible
@@ -1314,6 +1346,45 @@ public final class ColumnVector implements AutoCloseable, BinaryOperable, Column
     }
   }
 
+  /**
+   * Run many binary operations in a single native call, which avoids the per call overhead for
+   * wide tables. Equivalent to calling lhs[i].binaryOp(ops[i], rhs[i], outTypes[i]) for each i.
+   * @param ops the operation to run for each pair of operands.
+   * @param lhs the left hand side columns.
+   * @param rhs the right hand side columns or scalars.
+   * @param outTypes the type of each output column.
+   * @return the new columns. NOTE: It is the responsibility of the caller to close them.
+   */
+  public static ColumnVector[] binaryOp(BinaryOp[] ops, ColumnVector[] lhs, BinaryOperable[] rhs,
+                                        DType[] outTypes) {
+    int count = ops.length;
+    if (lhs.length != count || rhs.length != count || outTypes.length != count) {
+      throw new IllegalArgumentException("All arguments must have the same length");
+    }
+    long[] lhsViews = new long[count];
+    long[] rhsHandles = new long[count];
+    boolean[] rhsIsScalar = new boolean[count];
+    int[] nativeOps = new int[count];
+    int[] nativeTypes = new int[count];
+    for (int i = 0; i < count; i++) {
+      lhsViews[i] = lhs[i].getNativeView();
+      if (rhs[i] instanceof ColumnVector) {
+        assert lhs[i].getRowCount() == ((ColumnVector) rhs[i]).getRowCount();
+        rhsHandles[i] = ((ColumnVector) rhs[i]).getNativeView();
+      } else if (rhs[i] instanceof Scalar) {
+        rhsHandles[i] = ((Scalar) rhs[i]).getScalarHandle();
+        rhsIsScalar[i] = true;
+      } else {
+        throw new IllegalArgumentException(rhs[i].getClass() + " is not supported as a binary op" +
+            " with ColumnVector");
+      }
+      nativeOps[i] = ops[i].nativeId;
+      nativeTypes[i] = outTypes[i].nativeId;
+    }
+    return fromNativeHandles(
+        binaryOpMany(lhsViews, rhsHandles, rhsIsScalar, nativeOps, nativeTypes));
+  }
+
   static long binaryOp(ColumnVector lhs, ColumnVector rhs, BinaryOp op, DType outputType) {
     return binaryOpVV(lhs.getNativeView(), rhs.getNativeView(),
         op.nativeId, outputType.nativeId);
@@ -1667,6 +1738,41 @@ public final class ColumnVector implements AutoCloseable, BinaryOperable, Column
     return new ColumnVector(castTo(getNativeView(), type.nativeId));
   }
 
+  /**
+   * Cast many columns in a single native call, which avoids the per call overhead for wide
+   * tables. Equivalent to calling columns[i].castTo(types[i]) for each column.
+   * @param columns the columns to cast.
+   * @param types the type to cast each column to.
+   * @return the new columns. NOTE: It is the responsibility of the caller to close them.
+   */
+  public static ColumnVector[] castTo(ColumnVector[] columns, DType[] types) {
+    if (columns.length != types.length) {
+      throw new IllegalArgumentException("One type is needed per column");
+    }
+    // Columns that already have the right type are not cast, same as castTo(DType)
+    int numToCast = 0;
+    for (int i = 0; i < columns.length; i++) {
+      if (columns[i].getType() != types[i]) {
+        numToCast++;
+      }
+    }
+    long[] views = new long[numToCast];
+    int[] nativeTypes = new int[numToCast];
+    for (int i = 0, j = 0; i < columns.length; i++) {
+      if (columns[i].getType() != types[i]) {
+        views[j] = columns[i].getNativeView();
+        nativeTypes[j] = types[i].nativeId;
+        j++;
+      }
+    }
+    ColumnVector[] cast = fromNativeHandles(castToMany(views, nativeTypes));
+    ColumnVector[] results = new ColumnVector[columns.length];
+    for (int i = 0, j = 0; i < columns.length; i++) {
+      results[i] = (columns[i].getType() != types[i]) ? cast[j++] : columns[i].incRefCount();
+    }
+    return results;
+  }
+
   /**
    * Cast to Byte - ColumnVector
    * This method takes the value provided by the ColumnVector and casts to byte
@@ -2803,12 +2909,17 @@ public final class ColumnVector implements AutoCloseable, BinaryOperable, Column
 
   private static native long binaryOpVV(long lhs, long rhs, int op, int dtype);
 
+  private static native long[] binaryOpMany(long[] lhs, long[] rhs, boolean[] rhsIsScalar,
+                                            int[] ops, int[] dtypes);
+
   private static native long byteCount(long viewHandle) throws CudfException;
 
   private static native long extractListElement(long nativeView, int index);
 
   private static native long castTo(long nativeHandle, int type);
 
+  private static native long[] castToMany(long[] nativeHandles, int[] types);
+
   private static native long[] slice(long nativeHandle, int[] indices) throws CudfException;
 
   private static native long[] split(long nativeHandle, int[] indices) throws CudfException;
@@ -2849,6 +2960,9 @@ public final class ColumnVector implements AutoCloseable, BinaryOperable, Column
 
   private static native long replaceNulls(long viewHandle, long scalarHandle) throws CudfException;
 
+  private static native long[] replaceNullsMany(long[] viewHandles,
+                                                long[] scalarHandles) throws CudfException;
+
   private static native long ifElseVV(long predVec, long trueVec, long falseVec) throws CudfException;
 
   private static native long ifElseVS(long predVec, long trueVec, long falseScalar) throws CudfException;
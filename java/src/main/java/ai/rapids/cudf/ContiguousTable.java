@@ -27,19 +27,37 @@ import java.util.Arrays;
 public final class ContiguousTable implements AutoCloseable {
   private Table table;
   private DeviceMemoryBuffer buffer;
+  private final byte[] packedMetadata;
 
   //Will be called from JNI
   static ContiguousTable fromContiguousColumnViews(long[] columnViewAddresses,
                                            long address, long lengthInBytes, long rmmBufferAddress) {
+    DeviceMemoryBuffer buffer = DeviceMemoryBuffer.fromRmm(address, lengthInBytes, rmmBufferAddress);
+    return fromColumnViews(columnViewAddresses, buffer, null);
+  }
+
+  //Will be called from JNI
+  static ContiguousTable fromPackedColumnViews(long[] columnViewAddresses,
+                                               long address, long lengthInBytes,
+                                               long rmmBufferAddress, byte[] packedMetadata) {
+    DeviceMemoryBuffer buffer = DeviceMemoryBuffer.fromRmm(address, lengthInBytes, rmmBufferAddress);
+    return fromColumnViews(columnViewAddresses, buffer, packedMetadata);
+  }
+
+  /**
+   * Wrap column views that point into buffer. Takes ownership of buffer, which is closed if the
+   * table cannot be created.
+   */
+  static ContiguousTable fromColumnViews(long[] columnViewAddresses, DeviceMemoryBuffer buffer,
+                                         byte[] packedMetadata) {
     Table table = null;
     ColumnVector[] vectors = new ColumnVector[columnViewAddresses.length];
-    DeviceMemoryBuffer buffer = DeviceMemoryBuffer.fromRmm(address, lengthInBytes, rmmBufferAddress);
     try {
       for (int i = 0; i < vectors.length; i++) {
         vectors[i] = ColumnVector.fromViewWithContiguousAllocation(columnViewAddresses[i], buffer);
       }
       table = new Table(vectors);
-      ContiguousTable ret = new ContiguousTable(table, buffer);
+      ContiguousTable ret = new ContiguousTable(table, buffer, packedMetadata);
       buffer = null;
       table = null;
       return ret;
@@ -61,8 +79,13 @@ public final class ContiguousTable implements AutoCloseable {
   }
 
   ContiguousTable(Table table, DeviceMemoryBuffer buffer) {
+    this(table, buffer, null);
+  }
+
+  private ContiguousTable(Table table, DeviceMemoryBuffer buffer, byte[] packedMetadata) {
     this.table = table;
     this.buffer = buffer;
+    this.packedMetadata = packedMetadata;
   }
 
   public Table getTable() {
@@ -73,6 +96,17 @@ public final class ContiguousTable implements AutoCloseable {
     return buffer;
   }
 
+  /**
+   * Get the metadata describing the layout of the columns in the buffer, if this table was
+   * created by {@link Table#pack()} or {@link Table#unpack(byte[], DeviceMemoryBuffer)}.
+   * Together with the buffer it is all that is needed to recreate the table with
+   * {@link Table#unpack(byte[], DeviceMemoryBuffer)}.
+   * @return the packed metadata or null if the table was not packed.
+   */
+  public byte[] getPackedMetadata() {
+    return packedMetadata;
+  }
+
   @Override
   public void close() {
     if (table != null) {
@@ -24,7 +24,9 @@ package ai.rapids.cudf;
 public enum HashType {
   // TODO IDENTITY(0),
   // TODO MURMUR3(1),
-  HASH_MD5(2);
+  HASH_MD5(2),
+  HASH_SPARK_MURMUR3(3),
+  HASH_XXHASH64(4);
 
   private static final HashType[] HASH_TYPES = HashType.values();
   final int nativeId;
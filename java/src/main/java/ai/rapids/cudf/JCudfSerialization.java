@@ -63,6 +63,11 @@ public class JCudfSerialization {
    */
   private static final int SER_FORMAT_MAGIC_NUMBER = 0x43554446;
   private static final short VERSION_NUMBER = 0x0000;
+  /**
+   * Version of the packed format, where the table is packed into a single buffer on the GPU and
+   * written as the packed metadata followed by that buffer.
+   */
+  private static final short PACKED_VERSION_NUMBER = 0x0001;
 
   private static final class ColumnOffsets {
     private final long validity;
@@ -1523,6 +1528,90 @@ public class JCudfSerialization {
     }
   }
 
+  /**
+   * Write a table out in the packed format. The table is packed into a single device buffer on
+   * the GPU, which is copied to the host in one transfer, instead of copying and writing each
+   * column buffer separately. It can only be read back by readPackedTableFrom.
+   * @param t the table to be written.
+   * @param out the stream to write the serialized table out to.
+   * @throws IOException on any error.
+   */
+  public static void writePackedToStream(Table t, OutputStream out) throws IOException {
+    try (ContiguousTable packed = t.pack()) {
+      byte[] metadata = packed.getPackedMetadata();
+      DeviceMemoryBuffer devBuffer = packed.getBuffer();
+      DataWriter writer = writerFrom(out);
+      writer.writeInt(SER_FORMAT_MAGIC_NUMBER);
+      writer.writeShort(PACKED_VERSION_NUMBER);
+      writer.writeInt((int) t.getRowCount());
+      writer.writeInt(metadata.length);
+      writer.write(metadata, 0, metadata.length);
+      writer.writeLong(devBuffer.getLength());
+      if (devBuffer.getLength() > 0) {
+        try (HostMemoryBuffer hostBuffer = HostMemoryBuffer.allocate(devBuffer.getLength())) {
+          try (NvtxRange range = new NvtxRange("Copy Data To Host", NvtxColor.WHITE)) {
+            hostBuffer.copyFromDeviceBuffer(devBuffer);
+          }
+          try (NvtxRange range = new NvtxRange("Write Data", NvtxColor.BLUE)) {
+            writer.copyDataFrom(hostBuffer, 0, hostBuffer.getLength());
+          }
+        }
+      }
+      writer.flush();
+    }
+  }
+
+  /**
+   * Read a table written by writePackedToStream from the given InputStream. The data is copied
+   * to the device in one transfer and the columns are unpacked from it on the GPU.
+   * @param in the stream to read the table data from.
+   * @return the deserialized table in device memory, or null if the stream has no table to read
+   * from, an end of the stream at the very beginning.
+   * @throws IOException on any error.
+   * @throws EOFException if the data stream ended unexpectedly in the middle of processing.
+   */
+  public static TableAndRowCountPair readPackedTableFrom(InputStream in) throws IOException {
+    DataInputStream din;
+    if (in instanceof DataInputStream) {
+      din = (DataInputStream) in;
+    } else {
+      din = new DataInputStream(in);
+    }
+
+    try {
+      int num = din.readInt();
+      if (num != SER_FORMAT_MAGIC_NUMBER) {
+        throw new IllegalStateException("THIS DOES NOT LOOK LIKE CUDF SERIALIZED DATA. " +
+            "Expected magic number " + SER_FORMAT_MAGIC_NUMBER + " Found " + num);
+      }
+    } catch (EOFException e) {
+      // An EOF at the very beginning means there is nothing left to read
+      return new TableAndRowCountPair(0, null);
+    }
+    short version = din.readShort();
+    if (version != PACKED_VERSION_NUMBER) {
+      throw new IllegalStateException("READING THE WRONG SERIALIZATION FORMAT VERSION FOUND "
+          + version + " EXPECTED " + PACKED_VERSION_NUMBER);
+    }
+    int numRows = din.readInt();
+    byte[] metadata = new byte[din.readInt()];
+    din.readFully(metadata);
+    long dataLen = din.readLong();
+
+    try (HostMemoryBuffer hostBuffer = HostMemoryBuffer.allocate(dataLen);
+         DeviceMemoryBuffer devBuffer = DeviceMemoryBuffer.allocate(dataLen)) {
+      if (dataLen > 0) {
+        try (NvtxRange range = new NvtxRange("Read Data", NvtxColor.RED)) {
+          hostBuffer.copyFromStream(0, din, dataLen);
+        }
+        try (NvtxRange range = new NvtxRange("Copy Data To Device", NvtxColor.WHITE)) {
+          devBuffer.copyFromHostBuffer(hostBuffer);
+        }
+      }
+      return new TableAndRowCountPair(numRows, Table.unpack(metadata, devBuffer));
+    }
+  }
+
   /** Holds the result of deserializing a table. */
   public static final class TableAndRowCountPair implements Closeable {
     private final int numRows;
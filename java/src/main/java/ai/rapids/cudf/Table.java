@@ -167,6 +167,10 @@ public final class Table implements AutoCloseable {
   
   private static native ContiguousTable[] contiguousSplit(long inputTable, int[] indices);
 
+  private static native ContiguousTable pack(long inputTable);
+
+  private static native long[] unpack(byte[] metadata, long gpuDataAddress);
+
   private static native long[] hashPartition(long inputTable,
                                              int[] columnsToHash,
                                              int numberOfPartitions,
@@ -220,6 +224,36 @@ public final class Table implements AutoCloseable {
   private static native long[] readParquet(String[] filterColumnNames, String filePath,
                                            long address, long length, int timeUnit) throws CudfException;
 
+  /**
+   * Setup a chunked read of Parquet formatted data.
+   * @param filterColumnNames name of the columns to read, or an empty array if we want to read
+   *                          all of them
+   * @param filePath          the path of the file to read, or null if no path should be read.
+   * @param address           the address of the buffer to read from or 0 if we should not.
+   * @param length            the length of the buffer to read from.
+   * @param timeUnit          return type of TimeStamp in units
+   * @param byteLimit         approximate device memory used to read each chunk, or 0 for no limit
+   * @param rowLimit          maximum number of rows in each chunk, or 0 for no limit
+   * @return a handle that is used in later calls to readParquetChunk and readParquetChunkedEnd.
+   */
+  private static native long readParquetChunkedBegin(String[] filterColumnNames, String filePath,
+                                                     long address, long length, int timeUnit,
+                                                     long byteLimit,
+                                                     int rowLimit) throws CudfException;
+
+  /**
+   * Read the next chunk of a chunked Parquet read.
+   * @param handle the handle to the reader.
+   * @return the columns of the next chunk, or null if the whole file has been read.
+   */
+  private static native long[] readParquetChunk(long handle) throws CudfException;
+
+  /**
+   * Release the native reader of a chunked Parquet read.
+   * @param handle the handle.  Do not use again once this returns.
+   */
+  private static native void readParquetChunkedEnd(long handle);
+
   /**
    * Setup everything to write parquet formatted data to a file.
    * @param columnNames     names that correspond to the table columns
@@ -287,6 +321,38 @@ public final class Table implements AutoCloseable {
                                        String filePath, long address, long length,
                                        boolean usingNumPyTypes, int timeUnit) throws CudfException;
 
+  /**
+   * Setup a chunked read of ORC formatted data.
+   * @param filterColumnNames name of the columns to read, or an empty array if we want to read
+   *                          all of them
+   * @param filePath          the path of the file to read, or null if no path should be read.
+   * @param address           the address of the buffer to read from or 0 for no buffer.
+   * @param length            the length of the buffer to read from.
+   * @param usingNumPyTypes   whether the parser should implicitly promote TIMESTAMP
+   *                          columns to TIMESTAMP_MILLISECONDS for compatibility with NumPy.
+   * @param timeUnit          return type of TimeStamp in units
+   * @param byteLimit         approximate device memory used to read each chunk, or 0 for no limit
+   * @param rowLimit          maximum number of rows in each chunk, or 0 for no limit
+   * @return a handle that is used in later calls to readORCChunk and readORCChunkedEnd.
+   */
+  private static native long readORCChunkedBegin(String[] filterColumnNames,
+                                                 String filePath, long address, long length,
+                                                 boolean usingNumPyTypes, int timeUnit,
+                                                 long byteLimit, int rowLimit) throws CudfException;
+
+  /**
+   * Read the next chunk of a chunked ORC read.
+   * @param handle the handle to the reader.
+   * @return the columns of the next chunk, or null if the whole file has been read.
+   */
+  private static native long[] readORCChunk(long handle) throws CudfException;
+
+  /**
+   * Release the native reader of a chunked ORC read.
+   * @param handle the handle.  Do not use again once this returns.
+   */
+  private static native void readORCChunkedEnd(long handle);
+
   /**
    * Setup everything to write ORC formatted data to a file.
    * @param columnNames     names that correspond to the table columns
@@ -711,6 +777,139 @@ public final class Table implements AutoCloseable {
         opts.timeUnit().nativeId));
   }
 
+  private static final class ParquetChunkedTableReader implements StreamedTableReader {
+    private long handle;
+
+    private ParquetChunkedTableReader(ParquetOptions opts, String path, long address, long len,
+                                      long byteLimit, int rowLimit) {
+      this.handle = readParquetChunkedBegin(opts.getIncludeColumnNames(), path, address, len,
+          opts.timeUnit().nativeId, byteLimit, rowLimit);
+    }
+
+    @Override
+    public Table getNextIfAvailable() throws CudfException {
+      long[] columns = readParquetChunk(handle);
+      if (columns == null) {
+        return null;
+      }
+      return new Table(columns);
+    }
+
+    @Override
+    public void close() throws CudfException {
+      if (handle != 0) {
+        readParquetChunkedEnd(handle);
+      }
+      handle = 0;
+    }
+  }
+
+  /**
+   * Read a Parquet file in chunks, each bounded by an approximate amount of device memory and a
+   * number of rows. The file footer is parsed once, and the same native reader decodes every
+   * chunk. Every file produces at least one table, even without rows.
+   * @param opts various parquet parsing options.
+   * @param path the local file to read.
+   * @param byteLimit approximate device memory used to read each chunk, or 0 for no limit.
+   * @param rowLimit maximum number of rows in each chunk, or 0 for no limit.
+   * @return a reader of the chunks, in order.
+   */
+  public static StreamedTableReader readParquetChunked(ParquetOptions opts, File path,
+                                                       long byteLimit, int rowLimit) {
+    return new ParquetChunkedTableReader(opts, path.getAbsolutePath(), 0, 0, byteLimit, rowLimit);
+  }
+
+  /**
+   * Read parquet formatted data in chunks, each bounded by an approximate amount of device memory
+   * and a number of rows.
+   * @param opts various parquet parsing options.
+   * @param buffer raw parquet formatted bytes. It must stay open until the reader is closed.
+   * @param offset the starting offset into buffer.
+   * @param len the number of bytes to parse.
+   * @param byteLimit approximate device memory used to read each chunk, or 0 for no limit.
+   * @param rowLimit maximum number of rows in each chunk, or 0 for no limit.
+   * @return a reader of the chunks, in order.
+   */
+  public static StreamedTableReader readParquetChunked(ParquetOptions opts, HostMemoryBuffer buffer,
+                                                       long offset, long len,
+                                                       long byteLimit, int rowLimit) {
+    if (len <= 0) {
+      len = buffer.length - offset;
+    }
+    assert len > 0;
+    assert len <= buffer.getLength() - offset;
+    assert offset >= 0 && offset < buffer.length;
+    return new ParquetChunkedTableReader(opts, null, buffer.getAddress() + offset, len,
+        byteLimit, rowLimit);
+  }
+
+  private static final class ORCChunkedTableReader implements StreamedTableReader {
+    private long handle;
+
+    private ORCChunkedTableReader(ORCOptions opts, String path, long address, long len,
+                                  long byteLimit, int rowLimit) {
+      this.handle = readORCChunkedBegin(opts.getIncludeColumnNames(), path, address, len,
+          opts.usingNumPyTypes(), opts.timeUnit().nativeId, byteLimit, rowLimit);
+    }
+
+    @Override
+    public Table getNextIfAvailable() throws CudfException {
+      long[] columns = readORCChunk(handle);
+      if (columns == null) {
+        return null;
+      }
+      return new Table(columns);
+    }
+
+    @Override
+    public void close() throws CudfException {
+      if (handle != 0) {
+        readORCChunkedEnd(handle);
+      }
+      handle = 0;
+    }
+  }
+
+  /**
+   * Read an ORC file in chunks of whole stripes, each bounded by an approximate amount of device
+   * memory and a number of rows. Stripes with more rows than the limit are split, but stripes
+   * larger than the memory limit are read in one piece. The file footer is parsed once, and the
+   * same native reader decodes every chunk.
+   * @param opts ORC parsing options.
+   * @param path the local file to read.
+   * @param byteLimit approximate device memory used to read each chunk, or 0 for no limit.
+   * @param rowLimit maximum number of rows in each chunk, or 0 for no limit.
+   * @return a reader of the chunks, in order.
+   */
+  public static StreamedTableReader readORCChunked(ORCOptions opts, File path,
+                                                   long byteLimit, int rowLimit) {
+    return new ORCChunkedTableReader(opts, path.getAbsolutePath(), 0, 0, byteLimit, rowLimit);
+  }
+
+  /**
+   * Read ORC formatted data in chunks of whole stripes, each bounded by an approximate amount of
+   * device memory and a number of rows.
+   * @param opts ORC parsing options.
+   * @param buffer raw ORC formatted bytes. It must stay open until the reader is closed.
+   * @param offset the starting offset into buffer.
+   * @param len the number of bytes to parse.
+   * @param byteLimit approximate device memory used to read each chunk, or 0 for no limit.
+   * @param rowLimit maximum number of rows in each chunk, or 0 for no limit.
+   * @return a reader of the chunks, in order.
+   */
+  public static StreamedTableReader readORCChunked(ORCOptions opts, HostMemoryBuffer buffer,
+                                                   long offset, long len,
+                                                   long byteLimit, int rowLimit) {
+    if (len <= 0) {
+      len = buffer.length - offset;
+    }
+    assert len > 0;
+    assert len <= buffer.getLength() - offset;
+    assert offset >= 0 && offset < buffer.length;
+    return new ORCChunkedTableReader(opts, null, buffer.getAddress() + offset, len,
+        byteLimit, rowLimit);
+  }
+
   private static class ParquetTableWriter implements TableWriter {
     private long handle;
     HostBufferConsumer consumer;
@@ -1471,6 +1670,32 @@ public final class Table implements AutoCloseable {
     return contiguousSplit(nativeHandle, indices);
   }
 
+  /**
+   * Copy this table into a single contiguous device buffer on the GPU. The layout of the columns
+   * in the buffer is described by host metadata, see
+   * {@link ContiguousTable#getPackedMetadata()}. The metadata and the buffer can be sent
+   * elsewhere as they are and turned back into a table with
+   * {@link #unpack(byte[], DeviceMemoryBuffer)}.
+   * @return the packed table. NOTE: It is the responsibility of the caller to close the result.
+   */
+  public ContiguousTable pack() {
+    return pack(nativeHandle);
+  }
+
+  /**
+   * Recreate a table packed by {@link #pack()} from its metadata and device buffer. No device
+   * memory is copied, the columns of the result point into gpuData.
+   * @param metadata the packed metadata of the table.
+   * @param gpuData the device buffer of the packed table. The result takes its own reference to
+   *                it, so the caller must still close it.
+   * @return the unpacked table. NOTE: It is the responsibility of the caller to close the result.
+   */
+  public static ContiguousTable unpack(byte[] metadata, DeviceMemoryBuffer gpuData) {
+    long[] views = unpack(metadata, gpuData.getAddress());
+    gpuData.incRefCount();
+    return ContiguousTable.fromColumnViews(views, gpuData, metadata);
+  }
+
 
   /**
    * Gathers the rows of this table according to `gatherMap` such that row "i"
@@ -81,6 +81,104 @@ cudf::data_type timestamp_to_duration(cudf::data_type dt) {
   return cudf::data_type(duration_type_id);
 }
 
+// cast a column, with special handling for strings and for timestamps to and from integers
+std::unique_ptr<cudf::column> cast_column(JNIEnv *env, cudf::column_view const &column,
+                                          cudf::data_type n_data_type) {
+  std::unique_ptr<cudf::column> result;
+  if (n_data_type.id() == cudf::type_id::STRING) {
+    switch (column.type().id()) {
+      case cudf::type_id::BOOL8:
+        result = cudf::strings::from_booleans(column);
+        break;
+      case cudf::type_id::FLOAT32:
+      case cudf::type_id::FLOAT64:
+        result = cudf::strings::from_floats(column);
+        break;
+      case cudf::type_id::INT8:
+      case cudf::type_id::UINT8:
+      case cudf::type_id::INT16:
+      case cudf::type_id::UINT16:
+      case cudf::type_id::INT32:
+      case cudf::type_id::UINT32:
+      case cudf::type_id::INT64:
+      case cudf::type_id::UINT64:
+        result = cudf::strings::from_integers(column);
+        break;
+      default: cudf::jni::throw_java_exception(env, cudf::jni::ILLEGAL_ARG_CLASS, "Invalid data type");
+    }
+  } else if (column.type().id() == cudf::type_id::STRING) {
+    switch (n_data_type.id()) {
+      case cudf::type_id::BOOL8:
+        result = cudf::strings::to_booleans(column);
+        break;
+      case cudf::type_id::FLOAT32:
+      case cudf::type_id::FLOAT64:
+        result = cudf::strings::to_floats(column, n_data_type);
+        break;
+      case cudf::type_id::INT8:
+      case cudf::type_id::UINT8:
+      case cudf::type_id::INT16:
+      case cudf::type_id::UINT16:
+      case cudf::type_id::INT32:
+      case cudf::type_id::UINT32:
+      case cudf::type_id::INT64:
+      case cudf::type_id::UINT64:
+        result = cudf::strings::to_integers(column, n_data_type);
+        break;
+      default: cudf::jni::throw_java_exception(env, cudf::jni::ILLEGAL_ARG_CLASS, "Invalid data type");
+    }
+  } else if (cudf::is_timestamp(n_data_type) && cudf::is_numeric(column.type())) {
+    // This is a temporary workaround to allow Java to cast from integral types into a timestamp
+    // without forcing an intermediate duration column to be manifested.  Ultimately this style of
+    // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
+    if (n_data_type.id() == cudf::type_id::TIMESTAMP_DAYS) {
+      if (column.type().id() != cudf::type_id::INT32) {
+        cudf::jni::throw_java_exception(env, cudf::jni::ILLEGAL_ARG_CLASS,
+                                        "Numeric cast to TIMESTAMP_DAYS requires INT32");
+      }
+    } else {
+      if (column.type().id() != cudf::type_id::INT64) {
+        cudf::jni::throw_java_exception(env, cudf::jni::ILLEGAL_ARG_CLASS,
+                                        "Numeric cast to non-day timestamp requires INT64");
+      }
+    }
+    cudf::data_type duration_type = timestamp_to_duration(n_data_type);
+    cudf::column_view duration_view = cudf::column_view(duration_type,
+                                                        column.size(),
+                                                        column.head(),
+                                                        column.null_mask(),
+                                                        column.null_count());
+    result = cudf::cast(duration_view, n_data_type);
+  } else if (cudf::is_timestamp(column.type()) && cudf::is_numeric(n_data_type)) {
+    // This is a temporary workaround to allow Java to cast from timestamp types to integral types
+    // without forcing an intermediate duration column to be manifested.  Ultimately this style of
+    // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
+    cudf::data_type duration_type = timestamp_to_duration(column.type());
+    cudf::column_view duration_view = cudf::column_view(duration_type,
+                                                        column.size(),
+                                                        column.head(),
+                                                        column.null_mask(),
+                                                        column.null_count());
+    result = cudf::cast(duration_view, n_data_type);
+  } else {
+    result = cudf::cast(column, n_data_type);
+  }
+  return result;
+}
+
+// pass ownership of the columns to java as an array of handles
+jlongArray release_as_handles(JNIEnv *env, std::vector<std::unique_ptr<cudf::column>> &columns) {
+  cudf::jni::native_jlongArray n_result(env, columns.size());
+  for (int i = 0; i < columns.size(); i++) {
+    n_result[i] = reinterpret_cast<jlong>(columns[i].get());
+  }
+  n_result.commit();
+  for (auto &column : columns) {
+    column.release();
+  }
+  return n_result.get_jArray();
+}
+
 } // anonymous namespace
 
 extern "C" {
@@ -207,6 +305,27 @@ JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnVector_replaceNulls(JNIEnv *en
   CATCH_STD(env, 0);
 }
 
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_ColumnVector_replaceNullsMany(
+    JNIEnv *env, jclass, jlongArray j_cols, jlongArray j_scalars) {
+  JNI_NULL_CHECK(env, j_cols, "columns are null", 0);
+  JNI_NULL_CHECK(env, j_scalars, "scalars are null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jpointerArray<cudf::column_view> n_columns(env, j_cols);
+    cudf::jni::native_jpointerArray<cudf::scalar> n_scalars(env, j_scalars);
+    JNI_ARG_CHECK(env, n_columns.size() == n_scalars.size(), "one scalar is needed per column",
+                  0);
+    std::vector<std::unique_ptr<cudf::column>> results;
+    for (int i = 0; i < n_columns.size(); i++) {
+      JNI_NULL_CHECK(env, n_columns[i], "column is null", 0);
+      JNI_NULL_CHECK(env, n_scalars[i], "scalar is null", 0);
+      results.push_back(cudf::replace_nulls(*n_columns[i], *n_scalars[i]));
+    }
+    return release_as_handles(env, results);
+  }
+  CATCH_STD(env, 0);
+}
+
 JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnVector_ifElseVV(JNIEnv *env, jclass,
                                                                   jlong j_pred_vec,
                                                                   jlong j_true_vec,
@@ -678,88 +797,33 @@ JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnVector_castTo(JNIEnv *env, job
     cudf::jni::auto_set_device(env);
     cudf::column_view *column = reinterpret_cast<cudf::column_view *>(handle);
     cudf::data_type n_data_type(static_cast<cudf::type_id>(type));
-    std::unique_ptr<cudf::column> result;
-    if (n_data_type.id() == cudf::type_id::STRING) {
-      switch (column->type().id()) {
-        case cudf::type_id::BOOL8:
-          result = cudf::strings::from_booleans(*column);
-          break;
-        case cudf::type_id::FLOAT32:
-        case cudf::type_id::FLOAT64:
-          result = cudf::strings::from_floats(*column);
-          break;
-        case cudf::type_id::INT8:
-        case cudf::type_id::UINT8:
-        case cudf::type_id::INT16:
-        case cudf::type_id::UINT16:
-        case cudf::type_id::INT32:
-        case cudf::type_id::UINT32:
-        case cudf::type_id::INT64:
-        case cudf::type_id::UINT64:
-          result = cudf::strings::from_integers(*column);
-          break;
-        default: JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Invalid data type", 0);
-      }
-    } else if (column->type().id() == cudf::type_id::STRING) {
-      switch (n_data_type.id()) {
-        case cudf::type_id::BOOL8:
-          result = cudf::strings::to_booleans(*column);
-          break;
-        case cudf::type_id::FLOAT32:
-        case cudf::type_id::FLOAT64:
-          result = cudf::strings::to_floats(*column, n_data_type);
-          break;
-        case cudf::type_id::INT8:
-        case cudf::type_id::UINT8:
-        case cudf::type_id::INT16:
-        case cudf::type_id::UINT16:
-        case cudf::type_id::INT32:
-        case cudf::type_id::UINT32:
-        case cudf::type_id::INT64:
-        case cudf::type_id::UINT64:
-          result = cudf::strings::to_integers(*column, n_data_type);
-          break;
-        default: JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Invalid data type", 0);
-      }
-    } else if (cudf::is_timestamp(n_data_type) && cudf::is_numeric(column->type())) {
-      // This is a temporary workaround to allow Java to cast from integral types into a timestamp
-      // without forcing an intermediate duration column to be manifested.  Ultimately this style of
-      // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
-      if (n_data_type.id() == cudf::type_id::TIMESTAMP_DAYS) {
-        if (column->type().id() != cudf::type_id::INT32) {
-          JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Numeric cast to TIMESTAMP_DAYS requires INT32", 0);
-        }
-      } else {
-        if (column->type().id() != cudf::type_id::INT64) {
-          JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Numeric cast to non-day timestamp requires INT64", 0);
-        }
-      }
-      cudf::data_type duration_type = timestamp_to_duration(n_data_type);
-      cudf::column_view duration_view = cudf::column_view(duration_type,
-                                                          column->size(),
-                                                          column->head(),
-                                                          column->null_mask(),
-                                                          column->null_count());
-      result = cudf::cast(duration_view, n_data_type);
-    } else if (cudf::is_timestamp(column->type()) && cudf::is_numeric(n_data_type)) {
-      // This is a temporary workaround to allow Java to cast from timestamp types to integral types
-      // without forcing an intermediate duration column to be manifested.  Ultimately this style of
-      // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
-      cudf::data_type duration_type = timestamp_to_duration(column->type());
-      cudf::column_view duration_view = cudf::column_view(duration_type,
-                                                          column->size(),
-                                                          column->head(),
-                                                          column->null_mask(),
-                                                          column->null_count());
-      result = cudf::cast(duration_view, n_data_type);
-    } else {
-      result = cudf::cast(*column, n_data_type);
-    }
+    std::unique_ptr<cudf::column> result = cast_column(env, *column, n_data_type);
     return reinterpret_cast<jlong>(result.release());
   }
   CATCH_STD(env, 0);
 }
 
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_ColumnVector_castToMany(JNIEnv *env, jclass,
+                                                                         jlongArray handles,
+                                                                         jintArray types) {
+  JNI_NULL_CHECK(env, handles, "native handles are null", 0);
+  JNI_NULL_CHECK(env, types, "types are null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jpointerArray<cudf::column_view> n_columns(env, handles);
+    cudf::jni::native_jintArray n_types(env, types);
+    JNI_ARG_CHECK(env, n_columns.size() == n_types.size(), "one type is needed per column", 0);
+    std::vector<std::unique_ptr<cudf::column>> results;
+    for (int i = 0; i < n_columns.size(); i++) {
+      JNI_NULL_CHECK(env, n_columns[i], "column is null", 0);
+      cudf::data_type n_data_type(static_cast<cudf::type_id>(n_types[i]));
+      results.push_back(cast_column(env, *n_columns[i], n_data_type));
+    }
+    return release_as_handles(env, results);
+  }
+  CATCH_STD(env, 0);
+}
+
 JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnVector_stringTimestampToTimestamp(
     JNIEnv *env, jobject j_object, jlong handle, jint time_unit, jstring formatObj) {
   JNI_NULL_CHECK(env, handle, "column is null", 0);
@@ -995,6 +1059,44 @@ JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnVector_binaryOpVS(JNIEnv *env,
   CATCH_STD(env, 0);
 }
 
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_ColumnVector_binaryOpMany(
+    JNIEnv *env, jclass, jlongArray lhs_views, jlongArray rhs_handles,
+    jbooleanArray rhs_is_scalar, jintArray int_ops, jintArray out_dtypes) {
+  JNI_NULL_CHECK(env, lhs_views, "lhs is null", 0);
+  JNI_NULL_CHECK(env, rhs_handles, "rhs is null", 0);
+  JNI_NULL_CHECK(env, rhs_is_scalar, "rhs kinds are null", 0);
+  JNI_NULL_CHECK(env, int_ops, "ops are null", 0);
+  JNI_NULL_CHECK(env, out_dtypes, "output types are null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jpointerArray<cudf::column_view> n_lhs(env, lhs_views);
+    cudf::jni::native_jlongArray n_rhs(env, rhs_handles);
+    cudf::jni::native_jbooleanArray n_rhs_is_scalar(env, rhs_is_scalar);
+    cudf::jni::native_jintArray n_ops(env, int_ops);
+    cudf::jni::native_jintArray n_dtypes(env, out_dtypes);
+    JNI_ARG_CHECK(env,
+                  n_lhs.size() == n_rhs.size() && n_lhs.size() == n_rhs_is_scalar.size() &&
+                      n_lhs.size() == n_ops.size() && n_lhs.size() == n_dtypes.size(),
+                  "all arguments must have the same length", 0);
+    std::vector<std::unique_ptr<cudf::column>> results;
+    for (int i = 0; i < n_lhs.size(); i++) {
+      JNI_NULL_CHECK(env, n_lhs[i], "lhs is null", 0);
+      JNI_NULL_CHECK(env, n_rhs[i], "rhs is null", 0);
+      cudf::binary_operator op = static_cast<cudf::binary_operator>(n_ops[i]);
+      cudf::data_type out_type(static_cast<cudf::type_id>(n_dtypes[i]));
+      if (n_rhs_is_scalar[i]) {
+        auto rhs = reinterpret_cast<cudf::scalar *>(n_rhs[i]);
+        results.push_back(cudf::binary_operation(*n_lhs[i], *rhs, op, out_type));
+      } else {
+        auto rhs = reinterpret_cast<cudf::column_view *>(n_rhs[i]);
+        results.push_back(cudf::binary_operation(*n_lhs[i], *rhs, op, out_type));
+      }
+    }
+    return release_as_handles(env, results);
+  }
+  CATCH_STD(env, 0);
+}
+
 JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnVector_substring(JNIEnv *env, jclass,
                                                                    jlong column_view, jint start,
                                                                    jint end) {
@@ -38,6 +38,7 @@ namespace jni {
 
 static jclass Contiguous_table_jclass;
 static jmethodID From_contiguous_column_views;
+static jmethodID From_packed_column_views;
 
 #define CONTIGUOUS_TABLE_CLASS "ai/rapids/cudf/ContiguousTable"
 #define CONTIGUOUS_TABLE_FACTORY_SIG(param_sig) "(" param_sig ")L" CONTIGUOUS_TABLE_CLASS ";"
@@ -54,6 +55,12 @@ static bool cache_contiguous_table_jni(JNIEnv *env) {
     return false;
   }
 
+  From_packed_column_views = env->GetStaticMethodID(cls, "fromPackedColumnViews",
+                                                    CONTIGUOUS_TABLE_FACTORY_SIG("[JJJJ[B"));
+  if (From_packed_column_views == nullptr) {
+    return false;
+  }
+
   // Convert local reference to global so it cannot be garbage collected.
   Contiguous_table_jclass = static_cast<jclass>(env->NewGlobalRef(cls));
   if (Contiguous_table_jclass == nullptr) {
@@ -69,11 +76,8 @@ static void release_contiguous_table_jni(JNIEnv *env) {
   }
 }
 
-jobject contiguous_table_from(JNIEnv *env, cudf::contiguous_split_result &split) {
-  jlong address = reinterpret_cast<jlong>(split.all_data->data());
-  jlong size = static_cast<jlong>(split.all_data->size());
-  jlong buff_address = reinterpret_cast<jlong>(split.all_data.get());
-  int num_columns = split.table.num_columns();
+jlongArray column_view_array(JNIEnv *env, cudf::table_view const &table) {
+  int num_columns = table.num_columns();
   cudf::jni::native_jlongArray views(env, num_columns);
   for (int i = 0; i < num_columns; i++) {
     // TODO Exception handling is not ideal, if no exceptions are thrown ownership of the new cv
@@ -85,13 +89,21 @@ jobject contiguous_table_from(JNIEnv *env, cudf::contiguous_split_result &split)
     // In the ideal case we would keep the view where it is at, and pass in a pointer to it
     // That pointer would then be copied when java takes ownership of it, but that adds an
     // extra JNI call that I would like to avoid for performance reasons.
-    cudf::column_view *cv = new cudf::column_view(split.table.column(i));
+    cudf::column_view *cv = new cudf::column_view(table.column(i));
     views[i] = reinterpret_cast<jlong>(cv);
   }
 
   views.commit();
+  return views.get_jArray();
+}
+
+jobject contiguous_table_from(JNIEnv *env, cudf::contiguous_split_result &split) {
+  jlong address = reinterpret_cast<jlong>(split.all_data->data());
+  jlong size = static_cast<jlong>(split.all_data->size());
+  jlong buff_address = reinterpret_cast<jlong>(split.all_data.get());
+  jlongArray views = column_view_array(env, split.table);
   jobject ret = env->CallStaticObjectMethod(Contiguous_table_jclass, From_contiguous_column_views,
-                                            views.get_jArray(), address, size, buff_address);
+                                            views, address, size, buff_address);
 
   if (ret != nullptr) {
     split.all_data.release();
@@ -99,6 +111,24 @@ jobject contiguous_table_from(JNIEnv *env, cudf::contiguous_split_result &split)
   return ret;
 }
 
+jobject contiguous_table_from(JNIEnv *env, cudf::packed_columns &packed) {
+  jlong address = reinterpret_cast<jlong>(packed.gpu_data->data());
+  jlong size = static_cast<jlong>(packed.gpu_data->size());
+  jlong buff_address = reinterpret_cast<jlong>(packed.gpu_data.get());
+  jlongArray views = column_view_array(env, cudf::unpack(packed));
+  cudf::jni::native_jbyteArray metadata(
+      env, reinterpret_cast<jbyte const *>(packed.metadata->data()),
+      static_cast<int>(packed.metadata->size()));
+  jobject ret = env->CallStaticObjectMethod(Contiguous_table_jclass, From_packed_column_views,
+                                            views, address, size, buff_address,
+                                            metadata.get_jArray());
+
+  if (ret != nullptr) {
+    packed.gpu_data.release();
+  }
+  return ret;
+}
+
 native_jobjectArray<jobject> contiguous_table_array(JNIEnv *env, jsize length) {
   return native_jobjectArray<jobject>(
       env, env->NewObjectArray(length, Contiguous_table_jclass, nullptr));
@@ -533,6 +533,21 @@ public:
   }
 };
 
+/**
+ * Owns the state of a chunked Parquet or ORC read, which keeps the reader and the footer it parsed
+ * alive between the calls that read each chunk.
+ */
+template <typename State> struct native_chunked_reader_handle final {
+  explicit native_chunked_reader_handle(std::shared_ptr<State> state) : state(std::move(state)) {}
+
+  std::shared_ptr<State> state;
+};
+
+using native_parquet_chunked_reader_handle =
+    native_chunked_reader_handle<cudf::io::detail::parquet::pq_chunked_read_state>;
+using native_orc_chunked_reader_handle =
+    native_chunked_reader_handle<cudf::io::detail::orc::orc_chunked_read_state>;
+
 /**
  * Take a table returned by some operation and turn it into an array of column* so we can track them
  * ourselves in java instead of having their life tied to the table.
@@ -1072,6 +1087,150 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_readORC(
   CATCH_STD(env, NULL);
 }
 
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_readParquetChunkedBegin(
+    JNIEnv *env, jclass, jobjectArray filter_col_names, jstring inputfilepath, jlong buffer,
+    jlong buffer_length, jint unit, jlong byte_limit, jint row_limit) {
+  bool read_buffer = true;
+  if (buffer == 0) {
+    JNI_NULL_CHECK(env, inputfilepath, "input file or buffer must be supplied", 0);
+    read_buffer = false;
+  } else if (inputfilepath != NULL) {
+    JNI_THROW_NEW(env, "java/lang/IllegalArgumentException",
+                  "cannot pass in both a buffer and an inputfilepath", 0);
+  } else if (buffer_length <= 0) {
+    JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "An empty buffer is not supported",
+                  0);
+  }
+  JNI_ARG_CHECK(env, byte_limit > 0 || row_limit > 0, "a byte or row limit must be set", 0);
+  JNI_ARG_CHECK(env, byte_limit >= 0 && row_limit >= 0, "limits cannot be negative", 0);
+
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jstring filename(env, inputfilepath);
+    if (!read_buffer && filename.is_empty()) {
+      JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "inputfilepath can't be empty",
+                    0);
+    }
+
+    cudf::jni::native_jstringArray n_filter_col_names(env, filter_col_names);
+
+    std::unique_ptr<cudf::io::source_info> source;
+    if (read_buffer) {
+      source.reset(new cudf::io::source_info(reinterpret_cast<char *>(buffer), buffer_length));
+    } else {
+      source.reset(new cudf::io::source_info(filename.get()));
+    }
+
+    cudf::io::read_parquet_chunked_args read_arg(*source, byte_limit);
+    read_arg.row_limit = row_limit;
+    read_arg.columns = n_filter_col_names.as_cpp_vector();
+    read_arg.strings_to_categorical = false;
+    read_arg.timestamp_type = cudf::data_type(static_cast<cudf::type_id>(unit));
+
+    auto ret = new cudf::jni::native_parquet_chunked_reader_handle(
+        cudf::io::read_parquet_chunked_begin(read_arg));
+    return reinterpret_cast<jlong>(ret);
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_readParquetChunk(JNIEnv *env, jclass,
+                                                                        jlong j_handle) {
+  JNI_NULL_CHECK(env, j_handle, "null handle", NULL);
+  auto handle = reinterpret_cast<cudf::jni::native_parquet_chunked_reader_handle *>(j_handle);
+  try {
+    cudf::jni::auto_set_device(env);
+    if (!cudf::io::read_parquet_chunked_has_next(handle->state)) {
+      return NULL;
+    }
+    cudf::io::table_with_metadata result = cudf::io::read_parquet_chunked(handle->state);
+    return cudf::jni::convert_table_for_return(env, result.tbl);
+  }
+  CATCH_STD(env, NULL);
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Table_readParquetChunkedEnd(JNIEnv *env, jclass,
+                                                                       jlong j_handle) {
+  JNI_NULL_CHECK(env, j_handle, "null handle", );
+  try {
+    cudf::jni::auto_set_device(env);
+    delete reinterpret_cast<cudf::jni::native_parquet_chunked_reader_handle *>(j_handle);
+  }
+  CATCH_STD(env, );
+}
+
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_readORCChunkedBegin(
+    JNIEnv *env, jclass, jobjectArray filter_col_names, jstring inputfilepath, jlong buffer,
+    jlong buffer_length, jboolean usingNumPyTypes, jint unit, jlong byte_limit, jint row_limit) {
+  bool read_buffer = true;
+  if (buffer == 0) {
+    JNI_NULL_CHECK(env, inputfilepath, "input file or buffer must be supplied", 0);
+    read_buffer = false;
+  } else if (inputfilepath != NULL) {
+    JNI_THROW_NEW(env, "java/lang/IllegalArgumentException",
+                  "cannot pass in both a buffer and an inputfilepath", 0);
+  } else if (buffer_length <= 0) {
+    JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "An empty buffer is not supported",
+                  0);
+  }
+  JNI_ARG_CHECK(env, byte_limit > 0 || row_limit > 0, "a byte or row limit must be set", 0);
+  JNI_ARG_CHECK(env, byte_limit >= 0 && row_limit >= 0, "limits cannot be negative", 0);
+
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jstring filename(env, inputfilepath);
+    if (!read_buffer && filename.is_empty()) {
+      JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "inputfilepath can't be empty",
+                    0);
+    }
+
+    cudf::jni::native_jstringArray n_filter_col_names(env, filter_col_names);
+
+    std::unique_ptr<cudf::io::source_info> source;
+    if (read_buffer) {
+      source.reset(new cudf::io::source_info(reinterpret_cast<char *>(buffer), buffer_length));
+    } else {
+      source.reset(new cudf::io::source_info(filename.get()));
+    }
+
+    cudf::io::read_orc_chunked_args read_arg{*source, static_cast<size_t>(byte_limit), row_limit};
+    read_arg.columns = n_filter_col_names.as_cpp_vector();
+    read_arg.use_index = false;
+    read_arg.use_np_dtypes = static_cast<bool>(usingNumPyTypes);
+    read_arg.timestamp_type = cudf::data_type(static_cast<cudf::type_id>(unit));
+
+    auto ret = new cudf::jni::native_orc_chunked_reader_handle(
+        cudf::io::read_orc_chunked_begin(read_arg));
+    return reinterpret_cast<jlong>(ret);
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_readORCChunk(JNIEnv *env, jclass,
+                                                                    jlong j_handle) {
+  JNI_NULL_CHECK(env, j_handle, "null handle", NULL);
+  auto handle = reinterpret_cast<cudf::jni::native_orc_chunked_reader_handle *>(j_handle);
+  try {
+    cudf::jni::auto_set_device(env);
+    if (!cudf::io::read_orc_chunked_has_next(handle->state)) {
+      return NULL;
+    }
+    cudf::io::table_with_metadata result = cudf::io::read_orc_chunked(handle->state);
+    return cudf::jni::convert_table_for_return(env, result.tbl);
+  }
+  CATCH_STD(env, NULL);
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Table_readORCChunkedEnd(JNIEnv *env, jclass,
+                                                                   jlong j_handle) {
+  JNI_NULL_CHECK(env, j_handle, "null handle", );
+  try {
+    cudf::jni::auto_set_device(env);
+    delete reinterpret_cast<cudf::jni::native_orc_chunked_reader_handle *>(j_handle);
+  }
+  CATCH_STD(env, );
+}
+
 JNIEXPORT long JNICALL Java_ai_rapids_cudf_Table_writeORCBufferBegin(
     JNIEnv *env, jclass, jobjectArray j_col_names, jbooleanArray j_col_nullability,
     jobjectArray j_metadata_keys, jobjectArray j_metadata_values, jint j_compression,
@@ -1793,6 +1952,35 @@ JNIEXPORT jobjectArray JNICALL Java_ai_rapids_cudf_Table_contiguousSplit(JNIEnv
   CATCH_STD(env, NULL);
 }
 
+JNIEXPORT jobject JNICALL Java_ai_rapids_cudf_Table_pack(JNIEnv *env, jclass clazz,
+                                                          jlong input_table) {
+  JNI_NULL_CHECK(env, input_table, "native handle is null", 0);
+
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::table_view *n_table = reinterpret_cast<cudf::table_view *>(input_table);
+    cudf::packed_columns result = cudf::pack(*n_table);
+    return cudf::jni::contiguous_table_from(env, result);
+  }
+  CATCH_STD(env, NULL);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_unpack(JNIEnv *env, jclass clazz,
+                                                              jbyteArray metadata,
+                                                              jlong gpu_data) {
+  JNI_NULL_CHECK(env, metadata, "metadata is null", 0);
+
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jbyteArray n_metadata(env, metadata);
+    cudf::table_view table = cudf::unpack(reinterpret_cast<uint8_t const *>(n_metadata.data()),
+                                          reinterpret_cast<uint8_t const *>(gpu_data));
+    n_metadata.cancel();
+    return cudf::jni::column_view_array(env, table);
+  }
+  CATCH_STD(env, NULL);
+}
+
 JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_rollingWindowAggregate(
     JNIEnv *env, jclass clazz, jlong j_input_table, jintArray j_keys,
     jintArray j_aggregate_column_indices, jintArray j_agg_types, jintArray j_min_periods,
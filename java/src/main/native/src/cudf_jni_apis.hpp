@@ -26,6 +26,17 @@ namespace jni {
 
 jobject contiguous_table_from(JNIEnv *env, cudf::contiguous_split_result &split);
 
+/**
+ * Create a ContiguousTable that owns the device memory of a packed table and holds its metadata
+ */
+jobject contiguous_table_from(JNIEnv *env, cudf::packed_columns &packed);
+
+/**
+ * Create an array of new column views of the columns of the table. Ownership of the views is
+ * passed to java.
+ */
+jlongArray column_view_array(JNIEnv *env, cudf::table_view const &table);
+
 native_jobjectArray<jobject> contiguous_table_array(JNIEnv *env, jsize length);
 
 std::unique_ptr<cudf::aggregation> map_jni_aggregation(jint op);
@@ -1019,6 +1019,41 @@ public class ColumnVectorTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testBatchedOperations() {
+    try (ColumnVector ints = ColumnVector.fromBoxedInts(1, 2, null, 4);
+         ColumnVector longs = ColumnVector.fromBoxedLongs(10L, null, 30L, 40L);
+         Scalar intZero = Scalar.fromInt(0);
+         Scalar longOne = Scalar.fromLong(1L)) {
+      ColumnVector[] replaced = ColumnVector.replaceNulls(
+          new ColumnVector[]{ints, longs}, new Scalar[]{intZero, longOne});
+      ColumnVector[] cast = ColumnVector.castTo(
+          new ColumnVector[]{ints, longs}, new DType[]{DType.INT64, DType.INT64});
+      ColumnVector[] sums = ColumnVector.binaryOp(
+          new BinaryOp[]{BinaryOp.ADD, BinaryOp.MUL},
+          new ColumnVector[]{ints, longs},
+          new BinaryOperable[]{longs, longOne},
+          new DType[]{DType.INT64, DType.INT64});
+      try (ColumnVector expectedInts = ColumnVector.fromBoxedInts(1, 2, 0, 4);
+           ColumnVector expectedLongs = ColumnVector.fromBoxedLongs(10L, 1L, 30L, 40L);
+           ColumnVector intsAsLongs = ColumnVector.fromBoxedLongs(1L, 2L, null, 4L);
+           ColumnVector expectedSum = ColumnVector.fromBoxedLongs(11L, null, null, 44L)) {
+        assertColumnsAreEqual(expectedInts, replaced[0]);
+        assertColumnsAreEqual(expectedLongs, replaced[1]);
+        assertColumnsAreEqual(intsAsLongs, cast[0]);
+        assertColumnsAreEqual(longs, cast[1]);
+        assertColumnsAreEqual(expectedSum, sums[0]);
+        assertColumnsAreEqual(longs, sums[1]);
+      } finally {
+        for (ColumnVector[] results : new ColumnVector[][]{replaced, cast, sums}) {
+          for (ColumnVector cv : results) {
+            cv.close();
+          }
+        }
+      }
+    }
+  }
+
   static QuantileMethod[] methods = {LINEAR, LOWER, HIGHER, MIDPOINT, NEAREST};
   static double[] quantiles = {0.0, 0.25, 0.33, 0.5, 1.0};
 
@@ -669,6 +669,50 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testReadParquetChunked() {
+    ParquetOptions opts = ParquetOptions.builder()
+        .includeColumn("loan_id")
+        .includeColumn("zip")
+        .build();
+    List<Table> pieces = new ArrayList<>();
+    try (Table expected = Table.readParquet(opts, TEST_PARQUET_FILE);
+         StreamedTableReader reader = Table.readParquetChunked(opts, TEST_PARQUET_FILE, 0, 300)) {
+      Table t;
+      while ((t = reader.getNextIfAvailable()) != null) {
+        pieces.add(t);
+        assertTrue(t.getRowCount() <= 300);
+      }
+      assertTrue(pieces.size() >= 4);
+      try (Table result = Table.concatenate(pieces.toArray(new Table[0]))) {
+        assertTablesAreEqual(expected, result);
+      }
+    } finally {
+      pieces.forEach(Table::close);
+    }
+  }
+
+  @Test
+  void testReadORCChunked() {
+    ORCOptions opts = ORCOptions.builder()
+        .includeColumn("string1")
+        .includeColumn("int1")
+        .build();
+    try (StreamedTableReader reader = Table.readORCChunked(opts, TEST_ORC_FILE, 0, 1)) {
+      try (Table expected = new Table.TestBuilder().column("hi").column(65536).build();
+           Table t = reader.getNextIfAvailable()) {
+        assertTablesAreEqual(expected, t);
+      }
+      try (Table expected = new Table.TestBuilder().column("bye").column(65536).build();
+           Table t = reader.getNextIfAvailable()) {
+        assertTablesAreEqual(expected, t);
+      }
+      assertNull(reader.getNextIfAvailable());
+    }
+    assertThrows(IllegalArgumentException.class,
+        () -> Table.readORCChunked(opts, TEST_ORC_FILE, 0, 0));
+  }
+
   @Test
   void testReadORC() {
     ORCOptions opts = ORCOptions.builder()
@@ -1581,6 +1625,23 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testPackAndUnpack() {
+    try (Table t1 = new Table.TestBuilder()
+        .column(10, 12, 14, 16, 18, 20, 22, 24, null, 28)
+        .column(50.0, 52.0, 54.0, 56.0, 58.0, 60.0, 62.0, 64.0, 66.0, null)
+        .column("A", "B", "C", "D", null, "F", "G", "H", "I", "J")
+        .build();
+         ContiguousTable packed = t1.pack()) {
+      assertNotNull(packed.getPackedMetadata());
+      assertTablesAreEqual(t1, packed.getTable());
+      try (ContiguousTable unpacked =
+               Table.unpack(packed.getPackedMetadata(), packed.getBuffer())) {
+        assertTablesAreEqual(t1, unpacked.getTable());
+      }
+    }
+  }
+
   @Test
   void testPartStability() {
     final int PARTS = 5;
@@ -1685,6 +1746,32 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testPackedSerializationRoundTrip() throws IOException {
+    try (Table t = new Table.TestBuilder()
+        .column(1, null, 3, 4)
+        .column(1.5, 2.5, null, 4.5)
+        .column("a", "bb", null, "dddd")
+        .build()) {
+      ByteArrayOutputStream bout = new ByteArrayOutputStream();
+      JCudfSerialization.writePackedToStream(t, bout);
+      JCudfSerialization.writePackedToStream(t, bout);
+      ByteArrayInputStream bin = new ByteArrayInputStream(bout.toByteArray());
+      DataInputStream din = new DataInputStream(bin);
+      for (int i = 0; i < 2; i++) {
+        try (JCudfSerialization.TableAndRowCountPair result =
+                 JCudfSerialization.readPackedTableFrom(din)) {
+          assertEquals(4, result.getNumRows());
+          assertTablesAreEqual(t, result.getTable());
+        }
+      }
+      try (JCudfSerialization.TableAndRowCountPair result =
+               JCudfSerialization.readPackedTableFrom(din)) {
+        assertNull(result.getContiguousTable());
+      }
+    }
+  }
+
   @Test
   void testSerializationZeroColumns() throws IOException {
     ByteArrayOutputStream bout = new ByteArrayOutputStream();
@@ -77,6 +77,8 @@ cdef extern from "cudf/types.hpp" namespace "cudf" nogil:
         HASH_IDENTITY "cudf::hash_id::HASH_IDENTITY"
         HASH_MURMUR3 "cudf::hash_id::HASH_MURMUR3"
         HASH_MD5 "cudf::hash_id::HASH_MD5"
+        HASH_SPARK_MURMUR3 "cudf::hash_id::HASH_SPARK_MURMUR3"
+        HASH_XXHASH64 "cudf::hash_id::HASH_XXHASH64"
 
     cdef cppclass data_type:
         data_type() except +
@@ -89,6 +89,10 @@ cpdef write_orc(Table table,
         compression_ = compression_type.NONE
     elif compression == "snappy":
         compression_ = compression_type.SNAPPY
+    elif compression == "zlib":
+        compression_ = compression_type.GZIP
+    elif compression == "zstd":
+        compression_ = compression_type.ZSTD
     else:
         raise ValueError(
             "Unsupported compression type `{}`".format(compression)